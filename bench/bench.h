@@ -0,0 +1,155 @@
+/*
+  MusicXML Library
+  Copyright (C) Grame 2006-2013
+
+  This Source Code Form is subject to the terms of the Mozilla Public
+  License, v. 2.0. If a copy of the MPL was not distributed with this
+  file, You can obtain one at http://mozilla.org/MPL/2.0/.
+
+  Grame Research Laboratory, 11, cours de Verdun Gensoul 69002 Lyon - France
+  research@grame.fr
+*/
+
+#ifndef __bench__
+#define __bench__
+
+#include <stdlib.h>
+#include <string.h>
+#include <chrono>
+#include <ctime>
+#include <iostream>
+#include <string>
+#include <vector>
+
+#ifndef WIN32
+# include <sys/resource.h>
+#endif
+
+/*!
+\brief What the benchmarks have in common: timing and command line parsing.
+*/
+namespace bench
+{
+
+typedef std::chrono::steady_clock clock;
+
+//! the seconds elapsed since start
+inline double since (clock::time_point start)
+{
+	return std::chrono::duration<double>(clock::now() - start).count();
+}
+
+//! the CPU seconds used by the process since start, a clock() value
+inline double cpuSince (std::clock_t start)
+{
+	return double(std::clock() - start) / CLOCKS_PER_SEC;
+}
+
+//! the peak resident set size of the process in KB, -1 if unknown
+inline long peakKB ()
+{
+#ifdef WIN32
+	return -1;
+#else
+	struct rusage usage;
+	if (getrusage (RUSAGE_SELF, &usage)) return -1;
+#ifdef __APPLE__
+	return usage.ru_maxrss / 1024;		// in bytes on Mac OS X
+#else
+	return usage.ru_maxrss;
+#endif
+#endif
+}
+
+//______________________________________________________________________________
+/*!
+\brief A benchmark command line: options followed by arguments.
+
+	The options are declared with flag(), text() and number() before parse(),
+	which sets the variables given to the declarations. The usage is generated
+	from the declarations.
+*/
+class options
+{
+	enum kind { kFlag, kText, kNumber };
+	typedef struct {
+		const char*	fName;
+		const char*	fArg;
+		const char*	fHelp;
+		kind		fKind;
+		void*		fValue;
+		long		fDefault;
+	} option;
+
+	const char*			fTool;
+	const char*			fArgs;
+	const char*			fDescription;
+	std::vector<option>	fOptions;
+	std::vector<char*>	fArguments;
+
+	void add (const char* name, const char* arg, const char* help, kind k, void* value, long def = 0) {
+		option o = { name, arg, help, k, value, def };
+		fOptions.push_back (o);
+	}
+	const option* find (const char* name) const {
+		for (size_t i = 0; i < fOptions.size(); i++)
+			if (!strcmp (fOptions[i].fName, name)) return &fOptions[i];
+		return 0;
+	}
+
+	public:
+				 options (const char* tool, const char* args, const char* description)
+					: fTool(tool), fArgs(args), fDescription(description) {}
+
+		//! an option without argument, sets value to true when present
+		void	flag (const char* name, const char* help, bool& value)		{ add (name, 0, help, kFlag, &value); }
+		//! an option with a string argument
+		void	text (const char* name, const char* arg, const char* help, const char*& value)	{ add (name, arg, help, kText, &value); }
+		//! an option with a strictly positive number argument, value is the default
+		void	number (const char* name, const char* arg, const char* help, long& value)		{ add (name, arg, help, kNumber, &value, value); }
+
+		//! prints the usage and exits
+		void	usage () const {
+			std::cerr << "usage: " << fTool << (fOptions.empty() ? " " : " [options] ") << fArgs << std::endl;
+			std::cerr << "       " << fDescription << std::endl;
+			for (size_t i = 0; i < fOptions.size(); i++) {
+				const option& o = fOptions[i];
+				std::cerr << (i ? "                " : "       options: ") << o.fName;
+				if (o.fArg) std::cerr << " <" << o.fArg << ">";
+				std::cerr << " " << o.fHelp;
+				if (o.fKind == kNumber) std::cerr << " (defaults to " << o.fDefault << ")";
+				std::cerr << std::endl;
+			}
+			exit(1);
+		}
+
+		/*!
+		\brief parses the command line
+		\param min the minimum number of arguments
+		\param max the maximum number of arguments, -1 for no limit
+		\return the arguments, the usage is printed and the program exits when the command line is incorrect
+		*/
+		const std::vector<char*>& parse (int argc, char* argv[], int min = 1, int max = -1) {
+			int i = 1;
+			for (; (i < argc) && (argv[i][0] == '-'); i++) {
+				const option* o = find (argv[i]);
+				if (!o) usage();
+				if (o->fKind == kFlag) *(bool*)o->fValue = true;
+				else if (i + 1 == argc) usage();
+				else if (o->fKind == kText) *(const char**)o->fValue = argv[++i];
+				else {
+					long n = atol (argv[++i]);
+					if (n <= 0) usage();
+					*(long*)o->fValue = n;
+				}
+			}
+			fArguments.assign (argv + i, argv + argc);
+			int n = int(fArguments.size());
+			if ((n < min) || ((max >= 0) && (n > max))) usage();
+			return fArguments;
+		}
+};
+
+} // namespace
+
+#endif
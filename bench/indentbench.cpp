@@ -0,0 +1,79 @@
+/*
+  MusicXML Library
+  Copyright (C) Grame 2006-2013
+
+  This Source Code Form is subject to the terms of the Mozilla Public
+  License, v. 2.0. If a copy of the MPL was not distributed with this
+  file, You can obtain one at http://mozilla.org/MPL/2.0/.
+
+  Grame Research Laboratory, 11, cours de Verdun Gensoul 69002 Lyon - France
+  research@grame.fr
+*/
+
+#include <stdlib.h>
+#include <fstream>
+#include <iomanip>
+#include <iostream>
+#include <sstream>
+#include <string>
+#include <vector>
+
+#include "bench.h"
+#include "utilities.h"
+
+using namespace std;
+using namespace MusicXML2;
+
+//_______________________________________________________________________________
+// writes lines looking like lilypond code, returns the time in seconds
+static double write (const char* path, long lines, bool buffered)
+{
+	ofstream file (path);
+	if (!file.is_open()) {
+		cerr << "can't open " << path << endl;
+		exit(1);
+	}
+	bench::clock::time_point start = bench::clock::now();
+	{
+		indenter idtr;
+		indentedOstream out (file, idtr, buffered);
+		for (long l = 0; l < lines; l++) {
+			int depth = l % 8;
+			while (idtr.getIndent() < depth) idtr++;
+			while (idtr.getIndent() > depth) idtr--;
+			out << "c'" << (l % 4 ? 8 : 4) << " \\" << "mf % measure " << l / 16 << endl;
+		}
+	}	// the destructor flushes the buffered stream
+	file.close();
+	return bench::since (start);
+}
+
+static string contents (const char* path)
+{
+	ifstream file (path);
+	stringstream s;
+	s << file.rdbuf();
+	return s.str();
+}
+
+//_______________________________________________________________________________
+int main(int argc, char *argv[])
+{
+	long lines = 1000000;
+	bench::options opts ("indentbench", "<output file>",
+		"writes indented lines to a file with a line-flushed and with a buffered indentedOstream");
+	opts.number ("-n", "lines", "the number of lines", lines);
+	const char* path = opts.parse (argc, argv, 1, 1)[0];
+
+	double flushed = write (path, lines, false);
+	string expected = contents (path);
+	double buffered = write (path, lines, true);
+	bool same = (contents (path) == expected);
+
+	cout << lines << " lines written to " << path << endl;
+	cout << fixed << setprecision(0);
+	cout << "  line-flushed: " << flushed * 1e9 / lines << " ns/line" << endl;
+	cout << "  buffered:     " << buffered * 1e9 / lines << " ns/line" << endl;
+	cout << "  output " << (same ? "identical" : "differs") << endl;
+	return same ? 0 : 1;
+}
@@ -0,0 +1,279 @@
+/*
+  MusicXML Library
+  Copyright (C) Grame 2006-2013
+
+  This Source Code Form is subject to the terms of the Mozilla Public
+  License, v. 2.0. If a copy of the MPL was not distributed with this
+  file, You can obtain one at http://mozilla.org/MPL/2.0/.
+
+  Grame Research Laboratory, 11, cours de Verdun Gensoul 69002 Lyon - France
+  research@grame.fr
+*/
+
+#ifdef WIN32
+# pragma warning (disable : 4786)
+#endif
+
+#include <string.h>
+#include <fstream>
+#include <iomanip>
+#include <iostream>
+#include <map>
+#include <string>
+#include <vector>
+
+#ifdef WIN32
+#define NULLDEVICE "NUL"
+#else
+#define NULLDEVICE "/dev/null"
+#endif
+
+#include "bench.h"
+#include "xml.h"
+#include "xmlfile.h"
+#include "xmlreader.h"
+#include "midicontextvisitor.h"
+#include "smfwriter.h"
+#include "unrolled_xml_tree_browser.h"
+
+using namespace std;
+using namespace MusicXML2;
+
+//_______________________________________________________________________________
+// a writer that collects the events in maps and sorts the whole file at the end,
+// used as a reference
+class mapwriter : public midiwriter
+{
+	typedef multimap<long, vector<unsigned char> >	track;
+	vector<track>	fTracks;
+	track			fTempo;
+	long			fTPQ;
+
+	void add (track& t, long date, unsigned char s, unsigned char d1, unsigned char d2) {
+		vector<unsigned char> e;
+		e.push_back (s); e.push_back (d1); e.push_back (d2);
+		t.insert (make_pair (date < 0 ? 0 : date, e));
+	}
+	static void vlq (vector<unsigned char>& out, unsigned long v) {
+		unsigned char b[5]; int n = 0;
+		b[n++] = v & 0x7f;
+		while (v >>= 7) b[n++] = (v & 0x7f) | 0x80;
+		while (n) out.push_back (b[--n]);
+	}
+	static void write (ostream& out, const track& t) {
+		vector<unsigned char> data;
+		long date = 0;
+		for (track::const_iterator i = t.begin(); i != t.end(); i++) {
+			vlq (data, i->first - date);
+			date = i->first;
+			data.insert (data.end(), i->second.begin(), i->second.end());
+		}
+		unsigned char eot[] = { 0, 0xff, 0x2f, 0 };
+		data.insert (data.end(), eot, eot + 4);
+		unsigned long size = data.size();
+		char header[8] = { 'M', 'T', 'r', 'k', char(size >> 24), char(size >> 16), char(size >> 8), char(size) };
+		out.write (header, 8);
+		out.write ((const char*)&data[0], data.size());
+	}
+
+	public:
+				 mapwriter(long tpq) : fTPQ(tpq) {}
+		virtual ~mapwriter() {}
+
+		void startPart (int instrCount)							{ fTracks.push_back (track()); }
+		void newInstrument (std::string instrName, int chan)	{}
+		void endPart (long date)								{}
+		void newNote (long date, int chan, float pitch, int velocity, int duration) {
+			unsigned char c = (chan >= 1 && chan <= 16) ? chan - 1 : 0;
+			add (fTracks.back(), date, 0x90 | c, (unsigned char)pitch, velocity & 0x7f);
+			add (fTracks.back(), date + duration, 0x80 | c, (unsigned char)pitch, 0);
+		}
+		void tempoChange (long date, int bpm) {
+			long t = 60000000 / bpm;
+			vector<unsigned char> e;
+			e.push_back (0xff); e.push_back (0x51); e.push_back (3);
+			e.push_back (t >> 16); e.push_back (t >> 8); e.push_back (t);
+			fTempo.insert (make_pair (date, e));
+		}
+		void pedalChange (long date, pedalType t, int value)	{ add (fTracks.back(), date, 0xb0, 64 + t, value & 0x7f); }
+		void volChange (long date, int chan, int vol)			{ add (fTracks.back(), date, 0xb0, 7, vol & 0x7f); }
+		void bankChange (long date, int chan, int bank)			{ add (fTracks.back(), date, 0xb0, 0, bank & 0x7f); }
+		void progChange (long date, int chan, int prog)			{ add (fTracks.back(), date, 0xc0, prog & 0x7f, 0); }
+
+		void write (ostream& out) {
+			unsigned long n = fTracks.size() + 1;
+			char header[14] = { 'M', 'T', 'h', 'd', 0, 0, 0, 6, 0, 1, char(n >> 8), char(n), char(fTPQ >> 8), char(fTPQ) };
+			out.write (header, 14);
+			write (out, fTempo);
+			for (size_t i = 0; i < fTracks.size(); i++) write (out, fTracks[i]);
+		}
+};
+
+// a writer that does nothing, to measure the score visit
+class nullwriter : public midiwriter
+{
+	public:
+		void startPart (int instrCount)							{}
+		void newInstrument (std::string instrName, int chan)	{}
+		void endPart (long date)								{}
+		void newNote (long date, int chan, float pitch, int velocity, int duration)	{}
+		void tempoChange (long date, int bpm)					{}
+		void pedalChange (long date, pedalType t, int value)	{}
+		void volChange (long date, int chan, int vol)			{}
+		void bankChange (long date, int chan, int bank)			{}
+		void progChange (long date, int chan, int prog)			{}
+};
+
+static void visitOnly (Sxmlelement tree)
+{
+	nullwriter w;
+	midicontextvisitor v(480, &w);
+	unrolled_xml_tree_browser browser(&v);
+	browser.browse (*tree);
+}
+
+static void mapWrite (Sxmlelement tree, const char* file)
+{
+	mapwriter w(480);
+	midicontextvisitor v(480, &w);
+	unrolled_xml_tree_browser browser(&v);
+	browser.browse (*tree);
+	ofstream out (file, ios::binary);
+	w.write (out);
+}
+
+//_______________________________________________________________________________
+// checks the Standard MIDI File structure, returns the count of events or -1
+static unsigned long read (const unsigned char*& p, int bytes)
+{
+	unsigned long v = 0;
+	while (bytes--) v = (v << 8) | *p++;
+	return v;
+}
+
+static bool readVlq (const unsigned char*& p, const unsigned char* end, unsigned long& v)
+{
+	v = 0;
+	for (int i = 0; (i < 4) && (p < end); i++) {
+		v = (v << 7) | (*p & 0x7f);
+		if (!(*p++ & 0x80)) return true;
+	}
+	return false;
+}
+
+static long check (const char* file, long& bytes)
+{
+	ifstream in (file, ios::binary);
+	string data ((istreambuf_iterator<char>(in)), istreambuf_iterator<char>());
+	bytes = long(data.size());
+	const unsigned char* p = (const unsigned char*)data.data();
+	const unsigned char* end = p + data.size();
+	if ((data.size() < 14) || memcmp (p, "MThd", 4)) return -1;
+	p += 4;
+	if ((read (p, 4) != 6) || (read (p, 2) != 1)) return -1;
+	unsigned long tracks = read (p, 2);
+	p += 2;
+
+	long events = 0, notes = 0;
+	for (unsigned long t = 0; t < tracks; t++) {
+		if ((end - p < 8) || memcmp (p, "MTrk", 4)) return -1;
+		p += 4;
+		unsigned long size = read (p, 4);
+		if (size > (unsigned long)(end - p)) return -1;
+		const unsigned char* tend = p + size;
+		unsigned char status = 0;
+		bool eot = false;
+		while (p < tend) {
+			unsigned long delta, len;
+			if (eot || !readVlq (p, tend, delta) || (p >= tend)) return -1;
+			if (*p == 0xff) {
+				if (tend - p < 3) return -1;
+				eot = (p[1] == 0x2f);
+				p += 2;
+				if (!readVlq (p, tend, len) || (len > (unsigned long)(tend - p))) return -1;
+				p += len;
+				status = 0;
+			}
+			else {
+				if (*p & 0x80) status = *p++;
+				if (!status) return -1;
+				int n = ((status & 0xf0) == 0xc0) || ((status & 0xf0) == 0xd0) ? 1 : 2;
+				if (tend - p < n) return -1;
+				if ((status & 0xf0) == 0x90) notes += p[1] ? 1 : -1;
+				p += n;
+			}
+			events++;
+		}
+		if (!eot) return -1;
+	}
+	return ((p == end) && !notes) ? events : -1;
+}
+
+//_______________________________________________________________________________
+int main(int argc, char *argv[])
+{
+	long runs = 10;
+	const char* dir = 0;
+	bench::options opts ("smfbench", "<musicxml files>",
+		"converts the files to Standard MIDI Files several times");
+	opts.number ("-n", "runs", "the number of conversions of each file", runs);
+	opts.text ("-d", "dir", "writes the MIDI files to dir and checks them (defaults to no output)", dir);
+	const vector<char*>& args = opts.parse (argc, argv);
+
+	vector<Sxmlelement> trees;
+	vector<string> outputs;
+	for (size_t i = 0; i < args.size(); i++) {
+		xmlreader r;
+		SXMLFile file = r.read (args[i]);
+		if (!file || !file->elements()) continue;
+		trees.push_back (file->elements());
+		if (dir) {
+			string name = args[i];
+			size_t pos = name.find_last_of ("/\\");
+			if (pos != string::npos) name = name.substr (pos + 1);
+			outputs.push_back (string(dir) + "/" + name.substr (0, name.rfind ('.')) + ".mid");
+		}
+	}
+	if (trees.empty()) return -1;
+
+	double visit = 0, maps = 0, smf = 0;
+	for (long n = 0; n < runs; n++) {			// interleaved runs
+		bench::clock::time_point start = bench::clock::now();
+		for (size_t f = 0; f < trees.size(); f++) visitOnly (trees[f]);
+		visit += bench::since (start);
+
+		start = bench::clock::now();
+		for (size_t f = 0; f < trees.size(); f++) mapWrite (trees[f], NULLDEVICE);
+		maps += bench::since (start);
+
+		start = bench::clock::now();
+		for (size_t f = 0; f < trees.size(); f++) smfwriter::write (trees[f], NULLDEVICE, 480);
+		smf += bench::since (start);
+	}
+	// the writers time excludes the score visit
+	maps -= visit;
+	smf -= visit;
+
+	cout << trees.size() << " files converted " << runs << " times" << endl << fixed << setprecision(1);
+	cout << "  score visit       " << setw(8) << visit * 1000 / runs << " ms per run" << endl;
+	cout << "  std::map writer   " << setw(8) << maps * 1000 / runs << " ms per run" << endl;
+	cout << "  smfwriter         " << setw(8) << smf * 1000 / runs << " ms per run  " << setprecision(2) << maps / smf << "x" << endl;
+
+	int errors = 0;
+	if (dir) {
+		long events = 0, bytes = 0;
+		for (size_t f = 0; f < outputs.size(); f++) {
+			smfwriter::write (trees[f], outputs[f].c_str(), 480);
+			long size;
+			long n = check (outputs[f].c_str(), size);
+			if (n < 0) {
+				cerr << outputs[f] << ": incorrect Standard MIDI File" << endl;
+				errors++;
+			}
+			else events += n;
+			bytes += size;
+		}
+		cout << "  " << outputs.size() - errors << " files checked, " << events << " events, " << bytes << " bytes" << endl;
+	}
+	return errors ? -1 : 0;
+}
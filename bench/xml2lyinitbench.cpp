@@ -0,0 +1,50 @@
+/*
+  MusicXML Library
+  Copyright (C) Grame 2006-2013
+
+  This Source Code Form is subject to the terms of the Mozilla Public
+  License, v. 2.0. If a copy of the MPL was not distributed with this
+  file, You can obtain one at http://mozilla.org/MPL/2.0/.
+
+  Grame Research Laboratory, 11, cours de Verdun Gensoul 69002 Lyon - France
+  research@grame.fr
+*/
+
+#include <iomanip>
+#include <iostream>
+
+#include "bench.h"
+#include "conversionContext.h"
+#include "msr.h"
+#include "lpsr.h"
+#include "xml2lyOptionsHandling.h"
+
+using namespace std;
+using namespace MusicXML2;
+
+//_______________________________________________________________________________
+int main(int argc, char *argv[])
+{
+	long runs = 100;
+	bench::options opts ("xml2lyinitbench", "",
+		"gives the time of the xml2ly startup steps, the tables initialization is done once per process: run it several times");
+	opts.number ("-n", "runs", "the number of options handlers creations", runs);
+	opts.parse (argc, argv, 0, 0);
+
+	bench::clock::time_point start = bench::clock::now();
+	initializeMSR ();
+	initializeLPSR ();
+	double tables = bench::since (start);
+
+	start = bench::clock::now();
+	for (long n = 0; n < runs; n++) {
+		conversionContext::current ().reset ();
+		S_xml2lyOptionsHandler handler = xml2lyOptionsHandler::create (gOutputIOstream ());
+	}
+	double handlers = bench::since (start);
+
+	cout << fixed << setprecision(1);
+	cout << "  initializeMSR () + initializeLPSR (): " << tables * 1e6 << " us" << endl;
+	cout << "  xml2ly options handler creation:      " << handlers * 1e6 / runs << " us (average of " << runs << ")" << endl;
+	return 0;
+}
@@ -0,0 +1,130 @@
+/*
+  MusicXML Library
+  Copyright (C) Grame 2006-2013
+
+  This Source Code Form is subject to the terms of the Mozilla Public
+  License, v. 2.0. If a copy of the MPL was not distributed with this
+  file, You can obtain one at http://mozilla.org/MPL/2.0/.
+
+  Grame Research Laboratory, 11, cours de Verdun Gensoul 69002 Lyon - France
+  research@grame.fr
+*/
+
+#include <ctime>
+#include <iomanip>
+#include <iostream>
+#include <sstream>
+#include <string>
+#include <vector>
+
+#include "bench.h"
+#include "xml.h"
+#include "xmlfile.h"
+#include "xmlreader.h"
+
+#include "setTraceOptionsIfDesired.h"
+#include "conversionContext.h"
+#include "messagesHandling.h"
+#include "msr.h"
+#include "lpsr.h"
+#include "xml2lyOptionsHandling.h"
+#include "mxmlTree2MsrSkeletonBuilderInterface.h"
+#include "mxmlTree2MsrTranslatorInterface.h"
+#include "msr2LpsrInterface.h"
+#include "lpsr2LilypondInterface.h"
+
+using namespace std;
+using namespace MusicXML2;
+
+//_______________________________________________________________________________
+enum { kPass2a, kPass2b, kPass3, kPass4, kPasses };
+static const char* gPassNames[] = { "2a", "2b", "3", "4" };
+
+//_______________________________________________________________________________
+// returns false when the conversion fails
+static bool convert (int argc, char* argv[], const string& file, Sxmlelement tree, double times[])
+{
+	conversionContext& context = conversionContext::current ();
+	context.reset ();
+	context.fErrorsThrowExceptions = true;
+
+	try {
+		S_xml2lyOptionsHandler handler = xml2lyOptionsHandler::create (gOutputIOstream ());
+		handler->decipherOptionsAndArguments (argc, argv);
+		gXml2lyOptions ()->fInputSourceName = file;
+
+		clock_t start = clock();
+		S_msrScore mScore = buildMsrSkeletonFromElementsTree (gMsrOptions (), tree, gLogIOstream ());
+		times[kPass2a] += bench::cpuSince (start);
+		if (!mScore) return false;
+
+		start = clock();
+		populateMsrSkeletonFromMxmlTree (gMsrOptions (), tree, mScore, gLogIOstream ());
+		times[kPass2b] += bench::cpuSince (start);
+
+		start = clock();
+		S_lpsrScore lpScore = buildLpsrScoreFromMsrScore (mScore, gMsrOptions (), gLpsrOptions (), gLogIOstream ());
+		times[kPass3] += bench::cpuSince (start);
+
+		start = clock();
+		stringstream out;
+		indentedOstream lilypondCode (out, gIndenter (), true);
+		generateLilypondCodeFromLpsrScore (lpScore, gMsrOptions (), gLpsrOptions (), gLogIOstream (), lilypondCode);
+		times[kPass4] += bench::cpuSince (start);
+		gIndenter ().resetToZero ();
+	}
+	catch (const msrException& e) {
+		gIndenter ().resetToZero ();
+		return false;
+	}
+	return true;
+}
+
+//_______________________________________________________________________________
+int main(int argc, char *argv[])
+{
+	long runs = 5;
+	bench::options opts ("xml2lypassesbench", "<musicxml files>",
+		"converts the files to lilypond several times and gives the CPU time of each xml2ly pass\n"
+		"       compare a default build with a 'cmake -DTRACE=off' build");
+	opts.number ("-n", "runs", "the number of conversions of each file", runs);
+	const vector<char*>& paths = opts.parse (argc, argv);
+
+	initializeMSR ();
+	initializeLPSR ();
+
+	double times[kPasses] = { 0, 0, 0, 0 };
+	int files = 0, failures = 0;
+	for (size_t i = 0; i < paths.size(); i++) {
+		xmlreader r;
+		SXMLFile file = r.read (paths[i]);
+		if (!file || !file->elements()) continue;
+
+		// the xml2ly options: quiet, the file name is required but not used
+		char* lyArgv[] = { argv[0], (char*)"-q", paths[i], 0 };
+		double fileTimes[kPasses] = { 0, 0, 0, 0 };
+		bool ok = true;
+		for (int n = 0; ok && (n < runs); n++)
+			ok = convert (3, lyArgv, paths[i], file->elements(), fileTimes);
+		// only the files that convert are counted
+		if (!ok) {
+			failures++;
+			continue;
+		}
+		for (int p = 0; p < kPasses; p++) times[p] += fileTimes[p];
+		files++;
+	}
+	if (!files) return -1;
+
+#ifdef TRACE_OPTIONS
+	const char* trace = "with";
+#else
+	const char* trace = "without";
+#endif
+	cout << files << " files converted " << runs << " times " << trace << " the trace options";
+	if (failures) cout << " (" << failures << " failed and ignored)";
+	cout << endl << fixed << setprecision(3);
+	for (int p = 0; p < kPasses; p++)
+		cout << "  pass " << setw(2) << left << gPassNames[p] << right << setw(8) << times[p] << " s" << endl;
+	return 0;
+}
@@ -0,0 +1,70 @@
+/*
+  MusicXML Library
+  Copyright (C) Grame 2006-2013
+
+  This Source Code Form is subject to the terms of the Mozilla Public
+  License, v. 2.0. If a copy of the MPL was not distributed with this
+  file, You can obtain one at http://mozilla.org/MPL/2.0/.
+
+  Grame Research Laboratory, 11, cours de Verdun Gensoul 69002 Lyon - France
+  research@grame.fr
+*/
+
+#include <iomanip>
+#include <iostream>
+#include <vector>
+
+#include "bench.h"
+#include "xml.h"
+#include "xmlfile.h"
+#include "xmlreader.h"
+
+using namespace std;
+using namespace MusicXML2;
+
+//_______________________________________________________________________________
+// reads all the files, then releases them: returns the number of files read
+static int read (const vector<char*>& paths, bool arena, double& parse, double& release)
+{
+	vector<SXMLFile> files;
+	bench::clock::time_point start = bench::clock::now();
+	for (size_t i = 0; i < paths.size(); i++) {
+		xmlreader r;
+		r.useArena (arena);
+		SXMLFile file = r.read (paths[i]);
+		if (file) files.push_back (file);
+	}
+	parse += bench::since (start);
+
+	int count = int(files.size());
+	start = bench::clock::now();
+	files.clear();
+	release += bench::since (start);
+	return count;
+}
+
+//_______________________________________________________________________________
+int main(int argc, char *argv[])
+{
+	long runs = 5;
+	bench::options opts ("xmlarenabench", "<musicxml files>",
+		"compares the parse and the release of the files with and without arena allocation");
+	opts.number ("-n", "runs", "the number of reads of the files", runs);
+	const vector<char*>& paths = opts.parse (argc, argv);
+
+	double heapParse = 0, heapRelease = 0, arenaParse = 0, arenaRelease = 0;
+	int files = 0;
+	// the two modes alternate so that both see the same system state
+	for (long n = 0; n < runs; n++) {
+		files = read (paths, false, heapParse, heapRelease);
+		read (paths, true, arenaParse, arenaRelease);
+	}
+	if (!files) return -1;
+
+	cout << files << " files read " << runs << " times, per run:" << endl;
+	cout << fixed << setprecision(3);
+	cout << "             parse      release" << endl;
+	cout << "  heap   " << setw(8) << heapParse / runs << " s  " << setw(8) << heapRelease / runs << " s" << endl;
+	cout << "  arena  " << setw(8) << arenaParse / runs << " s  " << setw(8) << arenaRelease / runs << " s" << endl;
+	return 0;
+}
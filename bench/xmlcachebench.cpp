@@ -0,0 +1,135 @@
+/*
+  MusicXML Library
+  Copyright (C) Grame 2006-2013
+
+  This Source Code Form is subject to the terms of the Mozilla Public
+  License, v. 2.0. If a copy of the MPL was not distributed with this
+  file, You can obtain one at http://mozilla.org/MPL/2.0/.
+
+  Grame Research Laboratory, 11, cours de Verdun Gensoul 69002 Lyon - France
+  research@grame.fr
+*/
+
+#include <stdlib.h>
+#include <iomanip>
+#include <iostream>
+#include <new>
+#include <sstream>
+#include <string>
+#include <vector>
+#include <sys/stat.h>
+
+#include "bench.h"
+#include "xml.h"
+#include "xmlfile.h"
+#include "xmlreader.h"
+#include "xmlcache.h"
+#include "filebuffer.h"
+
+using namespace std;
+using namespace MusicXML2;
+
+//_______________________________________________________________________________
+// allocations counting, the benchmark is single-threaded: plain counters are fine
+static size_t gAllocations = 0;
+
+void* operator new (size_t size)
+{
+	gAllocations++;
+	void* p = malloc (size ? size : 1);
+	if (!p) throw bad_alloc();
+	return p;
+}
+
+void operator delete (void* p) noexcept		{ free (p); }
+
+//_______________________________________________________________________________
+static string asString (SXMLFile file)
+{
+	stringstream s;
+	file->print (s);
+	return s.str();
+}
+
+static size_t fileSize (const string& path)
+{
+	struct stat st;
+	return stat (path.c_str(), &st) ? 0 : size_t(st.st_size);
+}
+
+//_______________________________________________________________________________
+int main(int argc, char *argv[])
+{
+	long runs = 10;
+	bool arena = false;
+	bench::options opts ("xmlcachebench", "<cache directory> <musicxml files>",
+		"compares the parse of the files (cold) to their load from the cache (warm)");
+	opts.number ("-n", "runs", "the number of reads of each file", runs);
+	opts.flag ("-arena", "allocates the documents in arenas", arena);
+	const vector<char*>& args = opts.parse (argc, argv, 2);
+
+	xmlcache cache (args[0]);
+	cache.useArena (arena);
+
+	int files = 0, mismatches = 0;
+	double coldSeconds = 0, warmSeconds = 0, inputBytes = 0, cacheBytes = 0;
+	size_t coldAllocations = 0, warmAllocations = 0;
+	for (size_t i = 1; i < args.size(); i++) {
+		const char* file = args[i];
+
+		// cold: the file is parsed
+		SXMLFile parsed;
+		size_t allocations = gAllocations;
+		bench::clock::time_point start = bench::clock::now();
+		for (long n = 0; n < runs; n++) {
+			xmlreader r;
+			r.useArena (arena);
+			parsed = r.read (file);
+		}
+		coldSeconds += bench::since (start);
+		coldAllocations += gAllocations - allocations;
+		if (!parsed) {
+			cerr << file << ": can't be parsed, ignored" << endl;
+			continue;
+		}
+
+		// the first read through the cache creates the entry if needed
+		if (!cache.read (file)) continue;
+
+		// warm: the file is loaded from the cache
+		SXMLFile loaded;
+		allocations = gAllocations;
+		start = bench::clock::now();
+		for (long n = 0; n < runs; n++)
+			loaded = cache.read (file);
+		warmSeconds += bench::since (start);
+		warmAllocations += gAllocations - allocations;
+
+		if (!loaded || (asString (parsed) != asString (loaded))) {
+			cerr << file << ": the cached document differs from the parsed one" << endl;
+			mismatches++;
+		}
+
+		// the entry size
+		filebuffer buffer;
+		if (buffer.open (file))
+			cacheBytes += fileSize (cache.entry (buffer.data(), buffer.size()));
+		inputBytes += fileSize (file);
+		files++;
+	}
+
+	double reads = double(files) * runs;
+	if (!reads) return -1;
+	cout << fixed << setprecision(3);
+	cout << files << " files read " << runs << " times" << (arena ? " (arena)" : "") << endl;
+	cout << "  input:  " << inputBytes / 1e6 << " MB, cache: " << cacheBytes / 1e6 << " MB" << endl;
+	cout << "  cold:   " << coldSeconds * 1000 / reads << " ms/file, "
+		 << setprecision(0) << coldAllocations / reads << " allocations/file" << endl;
+	cout << setprecision(3);
+	cout << "  warm:   " << warmSeconds * 1000 / reads << " ms/file, "
+		 << setprecision(0) << warmAllocations / reads << " allocations/file" << endl;
+	cout << setprecision(2);
+	cout << "  speedup: " << (warmSeconds > 0 ? coldSeconds / warmSeconds : 0) << endl;
+	if (mismatches) cout << "  mismatches: " << mismatches << endl;
+	return mismatches ? -1 : 0;
+}
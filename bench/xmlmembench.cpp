@@ -0,0 +1,95 @@
+/*
+  MusicXML Library
+  Copyright (C) Grame 2006-2013
+
+  This Source Code Form is subject to the terms of the Mozilla Public
+  License, v. 2.0. If a copy of the MPL was not distributed with this
+  file, You can obtain one at http://mozilla.org/MPL/2.0/.
+
+  Grame Research Laboratory, 11, cours de Verdun Gensoul 69002 Lyon - France
+  research@grame.fr
+*/
+
+#include <stdlib.h>
+#include <iostream>
+#include <new>
+#include <vector>
+
+#include "bench.h"
+#include "xml.h"
+#include "xmlfile.h"
+#include "xmlreader.h"
+
+using namespace std;
+using namespace MusicXML2;
+
+//_______________________________________________________________________________
+// heap accounting: each block is prefixed with its size
+// the benchmark is single-threaded: plain counters are fine
+static size_t gLiveBytes = 0;
+static size_t gLiveBlocks = 0;
+
+enum { kHeader = 16 };		// keeps the blocks aligned
+
+void* operator new (size_t size)
+{
+	char* p;
+	while (!(p = (char*)malloc (size + kHeader))) {
+		new_handler handler = get_new_handler();
+		if (!handler) throw bad_alloc();
+		handler();
+	}
+	*(size_t*)p = size;
+	gLiveBytes += size;
+	gLiveBlocks++;
+	return p + kHeader;
+}
+
+void operator delete (void* ptr) noexcept
+{
+	if (!ptr) return;
+	char* p = (char*)ptr - kHeader;
+	gLiveBytes -= *(size_t*)p;
+	gLiveBlocks--;
+	free (p);
+}
+
+//_______________________________________________________________________________
+int main(int argc, char *argv[])
+{
+	bool arena = false;
+	bench::options opts ("xmlmembench", "<musicxml files>",
+		"reads all the files and gives the heap footprint of their elements trees");
+	opts.flag ("-arena", "allocates the documents in arenas", arena);
+	const vector<char*>& paths = opts.parse (argc, argv);
+
+	vector<SXMLFile> files;
+	files.reserve (paths.size());
+	size_t bytes = gLiveBytes, blocks = gLiveBlocks;
+	for (size_t i = 0; i < paths.size(); i++) {
+		xmlreader r;
+		r.useArena (arena);
+		SXMLFile file = r.read (paths[i]);
+		if (file && file->elements()) files.push_back (file);
+	}
+	bytes = gLiveBytes - bytes;
+	blocks = gLiveBlocks - blocks;
+
+	size_t nodes = 0, attributes = 0;
+	for (size_t f = 0; f < files.size(); f++) {
+		Sxmlelement root = files[f]->elements();
+		nodes++;
+		attributes += root->attributes().size();
+		for (ctree<xmlelement>::iterator e = root->begin(); e != root->end(); e++) {
+			nodes++;
+			attributes += (*e)->attributes().size();
+		}
+	}
+	if (!nodes) return -1;
+
+	cout << files.size() << " files" << (arena ? " (arena)" : "") << ": "
+		 << nodes << " elements, " << attributes << " attributes" << endl;
+	cout << "  heap: " << bytes << " bytes in " << blocks << " blocks" << endl;
+	cout << "  bytes per element: " << bytes / nodes << " (values and attributes included)" << endl;
+	return 0;
+}
@@ -0,0 +1,167 @@
+/*
+  MusicXML Library
+  Copyright (C) Grame 2006-2013
+
+  This Source Code Form is subject to the terms of the Mozilla Public
+  License, v. 2.0. If a copy of the MPL was not distributed with this
+  file, You can obtain one at http://mozilla.org/MPL/2.0/.
+
+  Grame Research Laboratory, 11, cours de Verdun Gensoul 69002 Lyon - France
+  research@grame.fr
+*/
+
+#include <algorithm>
+#include <iomanip>
+#include <iostream>
+#include <sstream>
+#include <string>
+#include <vector>
+
+#include "bench.h"
+#include "libmusicxml.h"
+#include "xml.h"
+#include "xmlfile.h"
+#include "xmlreader.h"
+#include "xml2guidovisitor.h"
+#include "midicontextvisitor.h"
+#include "unrolled_xml_tree_browser.h"
+
+#include "conversionContext.h"
+#include "messagesHandling.h"
+#include "msr.h"
+#include "lpsr.h"
+#include "xml2lyOptionsHandling.h"
+#include "mxmlTree2MsrSkeletonBuilderInterface.h"
+#include "mxmlTree2MsrTranslatorInterface.h"
+#include "msr2LpsrInterface.h"
+#include "lpsr2LilypondInterface.h"
+
+using namespace std;
+using namespace MusicXML2;
+
+//_______________________________________________________________________________
+// a midi writer that only counts the events
+class countwriter : public midiwriter
+{
+	public:
+		long fEvents;
+
+				 countwriter() : fEvents(0) {}
+		virtual ~countwriter() {}
+
+		void startPart (int instrCount)							{}
+		void newInstrument (std::string instrName, int chan)	{}
+		void endPart (long date)								{}
+		void newNote (long date, int chan, float pitch, int velocity, int duration)	{ fEvents++; }
+		void tempoChange (long date, int bpm)					{ fEvents++; }
+		void pedalChange (long date, pedalType t, int value)	{ fEvents++; }
+		void volChange (long date, int chan, int vol)			{ fEvents++; }
+		void bankChange (long date, int chan, int bank)			{ fEvents++; }
+		void progChange (long date, int chan, int prog)			{ fEvents++; }
+};
+
+//_______________________________________________________________________________
+static void toGuido (Sxmlelement tree)
+{
+	xml2guidovisitor v(true, true, true, 0);
+	Sguidoelement gmn = v.convert (tree);
+	stringstream out;
+	out << gmn;
+}
+
+static void toMidi (Sxmlelement tree)
+{
+	countwriter w;
+	midicontextvisitor v(480, &w);
+	unrolled_xml_tree_browser browser(&v);
+	browser.browse (*tree);
+}
+
+// returns false when the conversion fails
+static bool toLilypond (int argc, char* argv[], const string& file, Sxmlelement tree)
+{
+	conversionContext& context = conversionContext::current ();
+	context.reset ();
+	context.fErrorsThrowExceptions = true;
+
+	try {
+		S_xml2lyOptionsHandler handler = xml2lyOptionsHandler::create (gOutputIOstream ());
+		handler->decipherOptionsAndArguments (argc, argv);
+		gXml2lyOptions ()->fInputSourceName = file;
+
+		S_msrScore mScore = buildMsrSkeletonFromElementsTree (gMsrOptions (), tree, gLogIOstream ());
+		if (!mScore) return false;
+		populateMsrSkeletonFromMxmlTree (gMsrOptions (), tree, mScore, gLogIOstream ());
+		S_lpsrScore lpScore = buildLpsrScoreFromMsrScore (mScore, gMsrOptions (), gLpsrOptions (), gLogIOstream ());
+
+		stringstream out;
+		indentedOstream lilypondCode (out, gIndenter (), true);
+		generateLilypondCodeFromLpsrScore (lpScore, gMsrOptions (), gLpsrOptions (), gLogIOstream (), lilypondCode);
+		gIndenter ().resetToZero ();
+	}
+	catch (const msrException& e) {
+		gIndenter ().resetToZero ();
+		return false;
+	}
+	return true;
+}
+
+//_______________________________________________________________________________
+int main(int argc, char *argv[])
+{
+	long runs = 5;
+	bench::options opts ("xmlpassesbench", "<musicxml files>",
+		"converts each file to guido, midi and lilypond several times using a single parsed tree");
+	opts.number ("-n", "runs", "the number of conversions of each tree", runs);
+	const vector<char*>& args = opts.parse (argc, argv);
+
+	initializeMSR ();
+	initializeLPSR ();
+
+	double guido = 0, midi = 0, lilypond = 0, guidoFirst = 0, midiFirst = 0, lilypondFirst = 0;
+	int files = 0, failures = 0;
+	for (size_t i = 0; i < args.size(); i++) {
+		xmlreader r;
+		SXMLFile file = r.read (args[i]);
+		if (!file || !file->elements()) continue;
+		Sxmlelement tree = file->elements();
+
+		// the xml2ly options: quiet, the file name is required but not used
+		char* lyArgv[] = { argv[0], (char*)"-q", args[i], 0 };
+		bool lyOk = true;
+		for (long n = 0; n < runs; n++) {
+			bench::clock::time_point start = bench::clock::now();
+			toGuido (tree);
+			double t = bench::since (start);
+			guido += t;
+			if (!n) guidoFirst += t;
+
+			start = bench::clock::now();
+			toMidi (tree);
+			t = bench::since (start);
+			midi += t;
+			if (!n) midiFirst += t;
+
+			if (lyOk) {
+				start = bench::clock::now();
+				lyOk = toLilypond (3, lyArgv, args[i], tree);
+				t = bench::since (start);
+				lilypond += t;
+				if (!n) lilypondFirst += t;
+			}
+		}
+		if (!lyOk) failures++;
+		files++;
+	}
+	if (!files) return -1;
+
+	cout << files << " trees converted " << runs << " times";
+	if (failures) cout << " (" << failures << " lilypond conversions failed)";
+	cout << endl << fixed << setprecision(1);
+	cout << "                first run   next runs (per run)" << endl;
+	cout << "  guido     " << setw(10) << guidoFirst * 1000 << " ms " << setw(10) << (guido - guidoFirst) * 1000 / max(runs - 1, 1L) << " ms" << endl;
+	cout << "  midi      " << setw(10) << midiFirst * 1000 << " ms " << setw(10) << (midi - midiFirst) * 1000 / max(runs - 1, 1L) << " ms" << endl;
+	cout << "  lilypond  " << setw(10) << lilypondFirst * 1000 << " ms " << setw(10) << (lilypond - lilypondFirst) * 1000 / max(runs - 1, 1L) << " ms" << endl;
+	cout << "  total     " << setw(10) << (guido + midi + lilypond) * 1000 << " ms" << endl;
+	return 0;
+}
@@ -0,0 +1,76 @@
+/*
+  MusicXML Library
+  Copyright (C) Grame 2006-2013
+
+  This Source Code Form is subject to the terms of the Mozilla Public
+  License, v. 2.0. If a copy of the MPL was not distributed with this
+  file, You can obtain one at http://mozilla.org/MPL/2.0/.
+
+  Grame Research Laboratory, 11, cours de Verdun Gensoul 69002 Lyon - France
+  research@grame.fr
+*/
+
+#include <iostream>
+#include <vector>
+
+#include "bench.h"
+#include "typedefs.h"
+#include "xml.h"
+#include "xmlfile.h"
+#include "xmlreader.h"
+#include "xmlstreamreader.h"
+#include "xml_tree_browser.h"
+#include "partsummary.h"
+
+using namespace std;
+using namespace MusicXML2;
+
+//_______________________________________________________________________________
+class summary : public partsummary
+{
+	public:
+		long fNotes, fStaves;
+
+				 summary() : fNotes(0), fStaves(0) {}
+		virtual ~summary() {}
+
+	protected:
+		virtual void visitEnd ( S_note& elt )	{ partsummary::visitEnd (elt); fNotes++; }
+		virtual void visitEnd ( S_part& elt )	{ fStaves += countStaves(); }
+};
+
+//_______________________________________________________________________________
+int main(int argc, char *argv[])
+{
+	bool stream = false;
+	bench::options opts ("xmlstreambench", "<musicxml files>",
+		"counts the notes and summarizes the parts of the files, and gives the peak memory use\n"
+		"       run it once in each mode to compare the peak memory use");
+	opts.flag ("-stream", "visits the elements while parsing, instead of building the trees", stream);
+	const vector<char*>& paths = opts.parse (argc, argv);
+
+	long startKB = bench::peakKB();
+	summary v;
+	int files = 0;
+	for (size_t i = 0; i < paths.size(); i++) {
+		if (stream) {
+			xmlstreamreader r(&v);
+			r.subtree (k_print);		// partsummary inspects the print subelements
+			if (r.read (paths[i])) files++;
+		}
+		else {
+			xmlreader r;
+			SXMLFile file = r.read (paths[i]);
+			if (file && file->elements()) {
+				xml_tree_browser browser(&v);
+				browser.browse (*file->elements());
+				files++;
+			}
+		}
+	}
+
+	cout << files << " files " << (stream ? "streamed" : "read as trees") << ": "
+		 << v.fNotes << " notes, " << v.fStaves << " staves" << endl;
+	cout << "  peak memory: " << bench::peakKB() / 1024.0 << " MB (" << startKB / 1024.0 << " MB at start)" << endl;
+	return 0;
+}
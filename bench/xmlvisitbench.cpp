@@ -0,0 +1,93 @@
+/*
+  MusicXML Library
+  Copyright (C) Grame 2006-2013
+
+  This Source Code Form is subject to the terms of the Mozilla Public
+  License, v. 2.0. If a copy of the MPL was not distributed with this
+  file, You can obtain one at http://mozilla.org/MPL/2.0/.
+
+  Grame Research Laboratory, 11, cours de Verdun Gensoul 69002 Lyon - France
+  research@grame.fr
+*/
+
+#include <iomanip>
+#include <iostream>
+#include <vector>
+
+#include "bench.h"
+#include "xml.h"
+#include "xmlfile.h"
+#include "xmlreader.h"
+#include "xml_tree_browser.h"
+#include "notevisitor.h"
+#include "partsummary.h"
+
+using namespace std;
+using namespace MusicXML2;
+
+//_______________________________________________________________________________
+// counts the notes that are not in a chord
+class notescounter : public notevisitor
+{
+	public:
+		long fCount;
+
+				 notescounter() : fCount(0) {}
+		virtual ~notescounter() {}
+
+	protected:
+		virtual void visitEnd ( S_note& elt )	{ notevisitor::visitEnd (elt); if (!inChord()) fCount++; }
+};
+
+//_______________________________________________________________________________
+// browses the trees with a visitor V, using the dispatch table or the cross casts
+// returns the time in seconds, count sums what counter gives for each browse
+template <typename V> double browse (const vector<Sxmlelement>& trees, long runs, bool table, long& count, long (*counter)(V&))
+{
+	bench::clock::time_point start = bench::clock::now();
+	for (long n = 0; n < runs; n++) {
+		for (size_t t = 0; t < trees.size(); t++) {
+			V v;
+			v.useDispatchTable (table);
+			xml_tree_browser browser(&v);
+			browser.browse (*trees[t]);
+			count += counter (v);
+		}
+	}
+	return bench::since (start);
+}
+
+static long notes (notescounter& v)		{ return v.fCount; }
+static long staves (partsummary& v)		{ return v.countStaves(); }
+
+//_______________________________________________________________________________
+int main(int argc, char *argv[])
+{
+	long runs = 5;
+	bench::options opts ("xmlvisitbench", "<musicxml files>",
+		"browses the parsed files with a note visitor and with a part summary, with and without the dispatch table");
+	opts.number ("-n", "runs", "the number of browses of the files", runs);
+	const vector<char*>& paths = opts.parse (argc, argv);
+
+	vector<Sxmlelement> trees;
+	for (size_t i = 0; i < paths.size(); i++) {
+		xmlreader r;
+		SXMLFile file = r.read (paths[i]);
+		if (file && file->elements()) trees.push_back (file->elements());
+	}
+	if (trees.empty()) return -1;
+
+	long notesCount = 0, stavesCount = 0, unused = 0;
+	double noteTable = browse<notescounter> (trees, runs, true, notesCount, notes);
+	double noteCast  = browse<notescounter> (trees, runs, false, unused, notes);
+	double summaryTable = browse<partsummary> (trees, runs, true, stavesCount, staves);
+	double summaryCast  = browse<partsummary> (trees, runs, false, unused, staves);
+
+	cout << trees.size() << " files browsed " << runs << " times ("
+		 << notesCount / runs << " notes, " << stavesCount / runs << " staves)" << endl;
+	cout << fixed << setprecision(3);
+	cout << "                table      cross cast" << endl;
+	cout << "  notevisitor " << setw(8) << noteTable << " s " << setw(8) << noteCast << " s" << endl;
+	cout << "  partsummary " << setw(8) << summaryTable << " s " << setw(8) << summaryCast << " s" << endl;
+	return 0;
+}
@@ -0,0 +1,160 @@
+/*
+  MusicXML Library
+  Copyright (C) Grame 2006-2013
+
+  This Source Code Form is subject to the terms of the Mozilla Public
+  License, v. 2.0. If a copy of the MPL was not distributed with this
+  file, You can obtain one at http://mozilla.org/MPL/2.0/.
+
+  Grame Research Laboratory, 11, cours de Verdun Gensoul 69002 Lyon - France
+  research@grame.fr
+*/
+
+#include <fcntl.h>
+#include <fstream>
+#include <iomanip>
+#include <iostream>
+#include <sstream>
+#include <string>
+#include <vector>
+
+#ifdef WIN32
+#include <io.h>
+#define NULLDEVICE "NUL"
+#else
+#include <unistd.h>
+#define NULLDEVICE "/dev/null"
+#endif
+
+#include "bench.h"
+#include "tree_browser.h"
+#include "xml.h"
+#include "xmlfile.h"
+#include "xmlreader.h"
+#include "xmlvisitor.h"
+#include "xmlwriter.h"
+
+using namespace std;
+using namespace MusicXML2;
+
+//_______________________________________________________________________________
+// the document output through the xmlvisitor
+static void visitorWrite (SXMLFile file, ostream& out)
+{
+	if (file->getXMLDecl()) file->getXMLDecl()->print (out);
+	if (file->getDocType()) file->getDocType()->print (out);
+	xmlvisitor v(out);
+	tree_browser<xmlelement> browser(&v);
+	browser.browse (*file->elements());
+}
+
+//_______________________________________________________________________________
+typedef struct {
+	const char*	fName;
+	double		fSeconds;
+} measure;
+
+static void report (const measure& m, double bytes, double reference)
+{
+	cout << "  " << left << setw(28) << m.fName << right << fixed
+		 << setprecision(1) << setw(8) << m.fSeconds * 1000 << " ms "
+		 << setw(8) << bytes / m.fSeconds / 1e6 << " MB/s "
+		 << setprecision(2) << setw(6) << reference / m.fSeconds << "x" << endl;
+}
+
+//_______________________________________________________________________________
+int main(int argc, char *argv[])
+{
+	long runs = 10;
+	bench::options opts ("xmlwritebench", "<musicxml files>",
+		"compares the xmlvisitor output to the xmlwriter output of the files");
+	opts.number ("-n", "runs", "the number of writes of each file", runs);
+	const vector<char*>& args = opts.parse (argc, argv);
+
+	vector<SXMLFile> files;
+	int mismatches = 0;
+	double bytes = 0;
+	for (size_t i = 0; i < args.size(); i++) {
+		xmlreader r;
+		SXMLFile file = r.read (args[i]);
+		if (!file || !file->elements()) continue;
+
+		stringstream s;
+		visitorWrite (file, s);
+		xmlwriter w;
+		if (w.write (file) != s.str()) {
+			cerr << args[i] << ": the xmlwriter output differs from the xmlvisitor output" << endl;
+			mismatches++;
+		}
+		bytes += double(s.str().size());
+		files.push_back (file);
+	}
+	if (files.empty()) return -1;
+
+	vector<measure> measures;
+	bench::clock::time_point start;
+
+	// the xmlvisitor, to a file and to memory
+	{
+		ofstream out (NULLDEVICE);
+		start = bench::clock::now();
+		for (long n = 0; n < runs; n++)
+			for (size_t f = 0; f < files.size(); f++) visitorWrite (files[f], out);
+		measure m = { "xmlvisitor -> ofstream", bench::since (start) };
+		measures.push_back (m);
+	}
+	{
+		start = bench::clock::now();
+		for (long n = 0; n < runs; n++)
+			for (size_t f = 0; f < files.size(); f++) {
+				stringstream out;
+				visitorWrite (files[f], out);
+			}
+		measure m = { "xmlvisitor -> stringstream", bench::since (start) };
+		measures.push_back (m);
+	}
+
+	// the xmlwriter, to a file, to a file descriptor and to its buffer
+	{
+		ofstream out (NULLDEVICE);
+		xmlwriter w;
+		start = bench::clock::now();
+		for (long n = 0; n < runs; n++)
+			for (size_t f = 0; f < files.size(); f++) w.write (files[f], out);
+		measure m = { "xmlwriter -> ofstream", bench::since (start) };
+		measures.push_back (m);
+	}
+	{
+		int fd = open (NULLDEVICE, O_WRONLY);
+		xmlwriter w;
+		start = bench::clock::now();
+		for (long n = 0; n < runs; n++)
+			for (size_t f = 0; f < files.size(); f++) w.write (files[f], fd);
+		measure m = { "xmlwriter -> fd", bench::since (start) };
+		measures.push_back (m);
+		close (fd);
+	}
+	{
+		xmlwriter w;
+		start = bench::clock::now();
+		for (long n = 0; n < runs; n++)
+			for (size_t f = 0; f < files.size(); f++) w.write (files[f]);
+		measure m = { "xmlwriter -> buffer", bench::since (start) };
+		measures.push_back (m);
+	}
+	{
+		xmlwriter w (false);
+		start = bench::clock::now();
+		for (long n = 0; n < runs; n++)
+			for (size_t f = 0; f < files.size(); f++) w.write (files[f]);
+		measure m = { "xmlwriter compact -> buffer", bench::since (start) };
+		measures.push_back (m);
+	}
+
+	double total = bytes * runs;
+	cout << files.size() << " files written " << runs << " times, " << fixed << setprecision(1) << total / 1e6 << " MB" << endl;
+	for (size_t m = 0; m < measures.size(); m++)
+		report (measures[m], total, measures[0].fSeconds);
+	if (mismatches) cout << "  mismatches: " << mismatches << endl;
+	return mismatches ? -1 : 0;
+}
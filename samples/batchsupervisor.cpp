@@ -0,0 +1,224 @@
+/*
+  MusicXML Library
+  Copyright (C) Grame 2006-2013
+
+  This Source Code Form is subject to the terms of the Mozilla Public
+  License, v. 2.0. If a copy of the MPL was not distributed with this
+  file, You can obtain one at http://mozilla.org/MPL/2.0/.
+
+  Grame Research Laboratory, 11, cours de Verdun Gensoul 69002 Lyon - France
+  research@grame.fr
+*/
+
+#include <algorithm>
+#include <cstdio>
+#include <functional>
+#include <iostream>
+#include <mutex>
+#include <sstream>
+#include <string>
+
+#ifndef WIN32
+#include <cerrno>
+#include <unistd.h>
+#include <sys/types.h>
+#include <sys/wait.h>
+#endif
+
+#include "batchsupervisor.h"
+
+using namespace std;
+
+namespace MusicXML2
+{
+
+#ifndef WIN32
+//______________________________________________________________________________
+// the child process notifies the progress of the conversions with lines:
+//	S <index>						the conversion has started
+//	D <index> <seconds> [reason]	the conversion is done, reason is given on failure
+//	T <steals>						all the conversions are done
+class pipeListener : public batch::listener
+{
+	public:
+		pipeListener (int fd) : fFd(fd) {}
+
+		void started (size_t index) {
+			stringstream s;
+			s << "S " << index << '\n';
+			send (s.str());
+		}
+
+		void done (size_t index, const string& reason, double seconds) {
+			string line = reason.substr (0, 1024);
+			replace (line.begin(), line.end(), '\n', ' ');
+			replace (line.begin(), line.end(), '\r', ' ');
+			stringstream s;
+			s << "D " << index << ' ' << seconds << ' ' << line << '\n';
+			send (s.str());
+		}
+
+		void send (const string& line) {
+			lock_guard<mutex> lock (fMutex);
+			const char* p = line.c_str();
+			size_t n = line.size();
+			while (n) {
+				ssize_t written = write (fFd, p, n);
+				if (written < 0) {
+					if (errno == EINTR) continue;
+					return;
+				}
+				p += written;
+				n -= written;
+			}
+		}
+
+	private:
+		int		fFd;
+		mutex	fMutex;
+};
+
+// how the child process ended
+static string childEnd (int status)
+{
+	stringstream s;
+	if (WIFSIGNALED(status))
+		s << "conversion crashed with signal " << WTERMSIG(status);
+	else
+		s << "conversion exited with code " << WEXITSTATUS(status);
+	return s.str();
+}
+
+static int runChild (function<size_t (batch::listener&)> convert, batch::listener& l, size_t& steals)
+{
+	int fds[2];
+	if (pipe (fds)) return -1;
+
+	// the buffered outputs would be written twice
+	cout.flush();
+	cerr.flush();
+	fflush (0);
+
+	pid_t pid = fork();
+	if (pid < 0) {
+		close (fds[0]);
+		close (fds[1]);
+		return -1;
+	}
+
+	if (pid == 0) {
+		close (fds[0]);
+		pipeListener child (fds[1]);
+		size_t childSteals = convert (child);
+		stringstream s;
+		s << "T " << childSteals << '\n';
+		child.send (s.str());
+		cout.flush();
+		cerr.flush();
+		fflush (0);
+		_exit (0);
+	}
+
+	close (fds[1]);
+	string pending;
+	char buffer[4096];
+	for (;;) {
+		ssize_t n = read (fds[0], buffer, sizeof(buffer));
+		if (n < 0) {
+			if (errno == EINTR) continue;
+			break;
+		}
+		if (n == 0) break;
+		pending.append (buffer, n);
+
+		size_t eol;
+		while ((eol = pending.find ('\n')) != string::npos) {
+			string line = pending.substr (0, eol);
+			pending.erase (0, eol + 1);
+			istringstream s (line);
+			char kind = 0;
+			s >> kind;
+			if (kind == 'S') {
+				size_t index;
+				if (s >> index) l.started (index);
+			}
+			else if (kind == 'D') {
+				size_t index;
+				double seconds;
+				if (s >> index >> seconds) {
+					string reason;
+					s.get();		// the separator
+					getline (s, reason);
+					l.done (index, reason, seconds);
+				}
+			}
+			else if (kind == 'T') s >> steals;
+		}
+	}
+	close (fds[0]);
+
+	int status;
+	while (waitpid (pid, &status, 0) < 0) {
+		if (errno != EINTR) return -1;
+	}
+	return status;
+}
+
+//______________________________________________________________________________
+void superviseBatch (const batch& b, const vector<size_t>& indexes, batch::converter& convert, int threads, batch::results& r)
+{
+	vector<size_t> pending (indexes);
+	while (pending.size()) {
+		size_t steals = 0;
+		int status = runChild (
+			[&] (batch::listener& l) { return b.convertJobs (pending, convert, threads, l); },
+			r, steals);
+		r.fSteals += steals;
+
+		if (status == -1) {			// no child process, convert in process
+			r.fSteals += b.convertJobs (pending, convert, threads, r);
+			return;
+		}
+
+		vector<size_t> running, remaining;
+		for (size_t i = 0; i < pending.size(); i++) {
+			if (r.fStates[pending[i]] == batch::results::kRunning) running.push_back (pending[i]);
+			else if (r.fStates[pending[i]] == batch::results::kPending) remaining.push_back (pending[i]);
+		}
+		if (running.empty() && remaining.size() == pending.size()) {
+			// the child died before converting anything
+			for (size_t i = 0; i < remaining.size(); i++)
+				r.done (remaining[i], childEnd (status), 0);
+			return;
+		}
+
+		if (running.size() == 1)
+			r.done (running[0], childEnd (status), 0);
+		else {
+			// one of the running conversions at least failed:
+			// find which ones by converting them again one at a time
+			for (size_t i = 0; i < running.size(); i++) {
+				vector<size_t> alone (1, running[i]);
+				r.fRestarts++;
+				int aloneStatus = runChild (
+					[&] (batch::listener& l) { return b.convertJobs (alone, convert, 1, l); },
+					r, steals);
+				if (r.fStates[running[i]] != batch::results::kDone)
+					r.done (running[i], aloneStatus == -1 ? childEnd (status) : childEnd (aloneStatus), 0);
+			}
+		}
+
+		if (remaining.size()) r.fRestarts++;
+		pending.swap (remaining);
+	}
+}
+
+#else
+//______________________________________________________________________________
+void superviseBatch (const batch& b, const vector<size_t>& indexes, batch::converter& convert, int threads, batch::results& r)
+{
+	r.fSteals += b.convertJobs (indexes, convert, threads, r);
+}
+#endif
+
+}
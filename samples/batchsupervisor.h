@@ -0,0 +1,39 @@
+/*
+  MusicXML Library
+  Copyright (C) Grame 2006-2013
+
+  This Source Code Form is subject to the terms of the Mozilla Public
+  License, v. 2.0. If a copy of the MPL was not distributed with this
+  file, You can obtain one at http://mozilla.org/MPL/2.0/.
+
+  Grame Research Laboratory, 11, cours de Verdun Gensoul 69002 Lyon - France
+  research@grame.fr
+*/
+
+#ifndef __batchsupervisor__
+#define __batchsupervisor__
+
+#include <vector>
+
+#include "batch.h"
+
+namespace MusicXML2
+{
+
+/*!
+\brief converts the jobs of a batch in child processes
+
+	Crashes and exits can't be caught in process: the workers run in a
+	child process that notifies the progress of the conversions through
+	a pipe. When the child process dies, the files being converted are
+	converted again one at a time to find which ones are failing, and the
+	batch goes on with the remaining files in a new child process.
+\n	It is the supervisor of batch::run for the command line tools. On
+	Windows, or when no child process can be started, the jobs are
+	converted in process.
+*/
+void superviseBatch (const batch& b, const std::vector<size_t>& indexes, batch::converter& convert, int threads, batch::results& r);
+
+}
+
+#endif
@@ -12,14 +12,19 @@
 #endif
 
 #include <string>
+#include <fstream>
+#include <stdexcept>
 
 #include <stdlib.h>
 #include <string.h>
+#include <sys/stat.h>
 #ifndef WIN32
 #include <signal.h>
 #endif
 
 #include "libmusicxml.h"
+#include "batch.h"
+#include "batchsupervisor.h"
 
 using namespace std;
 using namespace MusicXML2;
@@ -28,7 +33,15 @@ static void usage() {
 	cerr << "usage: xml2guido [options]  <musicxml file>" << endl;
 	cerr << "       reads stdin when <musicxml file> is '-'" << endl;
 	cerr << "       option: --autobars don't generates barlines" << endl;
+	cerr << "       option: --threads converts the parts concurrently" << endl;
 	cerr << "       option: --version print version and exit" << endl;
+	cerr << "       option: --batch <musicxml file> is a manifest (one file per line) or a directory," << endl;
+	cerr << "               the files are converted to .gmn files and a report is written to stderr" << endl;
+	cerr << "       option: --jobs <n> the number of files converted at the same time in batch mode" << endl;
+	cerr << "               (defaults to the number of cores)" << endl;
+	cerr << "       option: --outdir <dir> the output directory in batch mode (defaults to '.')" << endl;
+	cerr << "               input files with the same name are prefixed with their directories names" << endl;
+	cerr << "       option: --cache <dir> keeps the parsed files in <dir> and reads them from there" << endl;
 	exit(1);
 }
 
@@ -66,6 +79,54 @@ static bool checkOpt(int argc, char *argv[], const string& option)
 	return false;
 }
 
+//_______________________________________________________________________________
+static const char* getOpt(int argc, char *argv[], const string& option, const char* defaultValue)
+{
+	for (int i=1; i<argc-1;i++) {
+		if (option == argv[i]) return argv[i+1];
+	}
+	return defaultValue;
+}
+
+//_______________________________________________________________________________
+static int batchConversion(const char* source, bool generateBars, const char* outdir, int jobs)
+{
+	vector<string> files;
+	struct stat st;
+	bool readable;
+	if (!stat(source, &st) && ((st.st_mode & S_IFMT) == S_IFDIR)) {
+		vector<string> suffixes;
+		suffixes.push_back (".xml");
+		suffixes.push_back (".musicxml");
+		suffixes.push_back (".mxl");
+		readable = batch::listDirectory (source, suffixes, files);
+	}
+	else readable = batch::readManifest (source, files);
+	if (!readable) {
+		cerr << "can't read batch directory or manifest " << source << endl;
+		return -1;
+	}
+
+	vector<string> outputs;
+	batch::outputFiles (files, outdir, ".gmn", outputs);
+	batch conversions;
+	for (size_t i = 0; i < files.size(); i++)
+		conversions.add (files[i], outputs[i]);
+
+	batch::report report = conversions.run (
+		[generateBars] (const string& input, const string& output) {
+			ofstream out (output.c_str());
+			if (!out.is_open()) throw runtime_error ("can't open output file " + output);
+			xmlErr err = musicxmlfile2guido (input.c_str(), generateBars, out);
+			if (err == kUnsupported) throw runtime_error ("unsupported xml format");
+			if (err != kNoErr) throw runtime_error ("conversion failed");
+			out.close();
+			if (out.fail()) throw runtime_error ("can't write output file " + output);
+		}, jobs, superviseBatch);
+	report.print (cerr);
+	return report.fFailed ? -1 : 0;
+}
+
 //_______________________________________________________________________________
 static void versionInfo()
 {
@@ -77,7 +138,8 @@ static void versionInfo()
 //_______________________________________________________________________________
 int main(int argc, char *argv[])
 {
-	catchsigs();
+	// in batch mode, the crashes are reported by the batch
+	if (!checkOpt (argc, argv, "--batch")) catchsigs();
 
 	bool version = checkOpt (argc, argv, "--version") || checkOpt (argc, argv, "-v");
 	if (version) versionInfo();
@@ -85,8 +147,14 @@ int main(int argc, char *argv[])
 	if (argc < 2) usage();
 
 	bool generateBars = checkOpt (argc, argv, "--autobars");
+	if (checkOpt (argc, argv, "--threads")) musicxml2guidoThreads (0);
+	const char* cache = getOpt (argc, argv, "--cache", 0);
+	if (cache) musicxmlCacheDirectory (cache);
 	char * file = argv[argc-1];
 
+	if (checkOpt (argc, argv, "--batch"))
+		return batchConversion (file, generateBars, getOpt (argc, argv, "--outdir", "."), atoi (getOpt (argc, argv, "--jobs", "0")));
+
 	xmlErr err = kNoErr;
 	if (!strcmp(file, "-"))
 		err = musicxmlfd2guido(stdin, generateBars, cout);
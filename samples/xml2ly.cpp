@@ -15,10 +15,19 @@
 
 #include <fstream>      // ofstream, ofstream::open(), ofstream::close()
 
+#include <cstdlib>      // malloc(), free()
+#include <new>          // bad_alloc
+
+#include <sys/stat.h>   // stat()
+
 #include "libmusicxml.h"
 #include "version.h"
+#include "batch.h"
+#include "batchsupervisor.h"
 
 #include "utilities.h"
+#include "profiling.h"
+#include "messagesHandling.h"
 
 #include "setTraceOptionsIfDesired.h"
 #ifdef TRACE_OPTIONS
@@ -48,6 +57,51 @@ using namespace std;
 using namespace MusicXML2;
 
 
+//_______________________________________________________________________________
+// allocations counting for the profiling, only when profiling is requested,
+// the conversions of a batch run on several threads,
+// hence the counters of each thread are its own
+static bool gCountAllocations = false;
+
+static thread_local size_t gAllocationsCount = 0;
+static thread_local size_t gAllocatedBytes   = 0;
+
+void* operator new (size_t size)
+{
+  if (gCountAllocations) {
+    gAllocationsCount++;
+    gAllocatedBytes += size;
+  }
+
+  void* result;
+
+  // call the new handler until the allocation succeeds, as the standard one does
+  while (! (result = malloc (size ? size : 1))) {
+    new_handler handler = get_new_handler ();
+
+    if (! handler)
+      throw bad_alloc ();
+
+    handler ();
+  }
+
+  return result;
+}
+
+void operator delete (void* p) noexcept
+{
+  free (p);
+}
+
+static void countAllocations (
+  size_t& allocationsCount,
+  size_t& allocatedBytes)
+{
+  allocationsCount = gAllocationsCount;
+  allocatedBytes   = gAllocatedBytes;
+}
+
+
 //_______________________________________________________________________________
 vector<string> handleOptionsAndArguments (
   S_xml2lyOptionsHandler optionsHandler,
@@ -76,8 +130,8 @@ Sxmlelement convertMusicXMLToMxmlTree_Pass1 (
     mxmlTree =
       musicXMLFd2mxmlTree (
         stdin,
-        gMusicXMLOptions,
-        gLogIOstream);
+        gMusicXMLOptions (),
+        gLogIOstream ());
   }
   
   else {
@@ -109,8 +163,8 @@ Sxmlelement convertMusicXMLToMxmlTree_Pass1 (
     mxmlTree =
       musicXMLFile2mxmlTree (
         inputSourceName.c_str(),
-        gMusicXMLOptions,
-        gLogIOstream);
+        gMusicXMLOptions (),
+        gLogIOstream ());
   }
     
   return mxmlTree;
@@ -123,34 +177,36 @@ S_msrScore convertMxmlTreeToAScoreSkeleton_Pass2a (
   S_msrScore
     mScore =
       buildMsrSkeletonFromElementsTree (
-        gMsrOptions,
+        gMsrOptions (),
         mxmlTree,
-        gLogIOstream);
+        gLogIOstream ());
 
-  if (gIndenter != 0) {
-    if (! gGeneralOptions->fQuiet) {
+  if (gIndenter () != 0) {
+    if (! gGeneralOptions ()->fQuiet) {
       stringstream s;
       
       s <<
         "gIndenter value after pass 2a: "<<
-        gIndenter.getIndent ();
+        gIndenter ().getIndent ();
         
       msrMusicXMLWarning (
-        gXml2lyOptions->fInputSourceName,
+        gXml2lyOptions ()->fInputSourceName,
         1, // JMI inputLineNumber,
         s.str ());
     }
 
-    gIndenter.resetToZero ();
+    gIndenter ().resetToZero ();
   }
 
   if (! mScore) {
-    gLogIOstream <<
+    gLogIOstream () <<
       "### Conversion from MusicCML to an MSR skeleton failed ###" <<
       endl <<
       endl;
 
-    exit (1);
+    msrStopConversion (
+      1,
+      "conversion from MusicXML to an MSR skeleton failed");
   }
 
   return mScore;
@@ -162,26 +218,26 @@ void populateScoreSkeletonFromMusicXML_Pass2b (
   S_msrScore  scoreSkeleton)
 {
   populateMsrSkeletonFromMxmlTree (
-    gMsrOptions,
+    gMsrOptions (),
     mxmlTree,
     scoreSkeleton,
-    gLogIOstream);
+    gLogIOstream ());
 
-  if (gIndenter != 0) {
-    if (! gGeneralOptions->fQuiet) {
+  if (gIndenter () != 0) {
+    if (! gGeneralOptions ()->fQuiet) {
       stringstream s;
       
       s <<
         "gIndenter value after pass 2b: "<<
-        gIndenter.getIndent ();
+        gIndenter ().getIndent ();
         
       msrMusicXMLWarning (
-        gXml2lyOptions->fInputSourceName,
+        gXml2lyOptions ()->fInputSourceName,
         1, // JMI inputLineNumber,
         s.str ());
     }
 
-    gIndenter.resetToZero ();
+    gIndenter ().resetToZero ();
   }
 }
 
@@ -194,23 +250,23 @@ void displayMsrScore_OptionalPass (
   displayMSRPopulatedScore (
     msrOpts,
     mScore,
-    gLogIOstream);
+    gLogIOstream ());
 
-  if (gIndenter != 0) {
-    if (! gGeneralOptions->fQuiet) {
+  if (gIndenter () != 0) {
+    if (! gGeneralOptions ()->fQuiet) {
       stringstream s;
       
       s <<
         "gIndenter value after MSR score display: "<<
-        gIndenter.getIndent ();
+        gIndenter ().getIndent ();
         
       msrMusicXMLWarning (
-        gXml2lyOptions->fInputSourceName,
+        gXml2lyOptions ()->fInputSourceName,
         1, // JMI inputLineNumber,
         s.str ());
     }
 
-    gIndenter.resetToZero ();
+    gIndenter ().resetToZero ();
   }
 }
 
@@ -220,39 +276,41 @@ S_lpsrScore convertMsrScoreToLpsrScore_Pass3 (
 {
   S_lpsrScore lpScore;
 
-  if (! gLilypondOptions->fNoLilypondCode) {
+  if (! gLilypondOptions ()->fNoLilypondCode) {
     lpScore =
       buildLpsrScoreFromMsrScore (
         mScore,
-        gMsrOptions,
-        gLpsrOptions,
-        gLogIOstream);
+        gMsrOptions (),
+        gLpsrOptions (),
+        gLogIOstream ());
   }
 
-  if (gIndenter != 0) {
-    if (! gGeneralOptions->fQuiet) {
+  if (gIndenter () != 0) {
+    if (! gGeneralOptions ()->fQuiet) {
       stringstream s;
       
       s <<
         "gIndenter value after pass 3: "<<
-        gIndenter.getIndent ();
+        gIndenter ().getIndent ();
         
       msrMusicXMLWarning (
-        gXml2lyOptions->fInputSourceName,
+        gXml2lyOptions ()->fInputSourceName,
         1, // JMI inputLineNumber,
         s.str ());
     }
 
-    gIndenter.resetToZero ();
+    gIndenter ().resetToZero ();
   }
 
   if (! lpScore) {
-    gLogIOstream <<
+    gLogIOstream () <<
       "### Conversion from MSR to LPSR failed ###" <<
       endl <<
       endl;
       
-    exit (2);
+    msrStopConversion (
+      2,
+      "conversion from MSR to LPSR failed");
   }
 
   return lpScore;
@@ -269,23 +327,23 @@ void displayLpsrScore_OptionalPass (
     lpScore,
     msrOpts,
     lpsrOpts,
-    gLogIOstream);
+    gLogIOstream ());
 
-  if (gIndenter != 0) {
-    if (! gGeneralOptions->fQuiet) {
+  if (gIndenter () != 0) {
+    if (! gGeneralOptions ()->fQuiet) {
       stringstream s;
       
       s <<
         "gIndenter value after LPSR score display: "<<
-        gIndenter.getIndent ();
+        gIndenter ().getIndent ();
         
       msrMusicXMLWarning (
-        gXml2lyOptions->fInputSourceName,
+        gXml2lyOptions ()->fInputSourceName,
         1, // JMI inputLineNumber,
         s.str ());
     }
 
-    gIndenter.resetToZero ();
+    gIndenter ().resetToZero ();
   }
 }
 
@@ -296,7 +354,7 @@ void convertLpsrScoreToLilypondCode_Pass4 (
 {  
   int outputFileNameSize = outputFileName.size ();
 
-  if (! gLilypondOptions->fNoLilypondCode) {
+  if (! gLilypondOptions ()->fNoLilypondCode) {
     // open output file if need be
     // ------------------------------------------------------
   
@@ -304,8 +362,8 @@ void convertLpsrScoreToLilypondCode_Pass4 (
         
     if (outputFileNameSize) {
 #ifdef TRACE_OPTIONS
-      if (gTraceOptions->fTracePasses) {
-        gLogIOstream <<
+      if (gTraceOptions ()->fTracePasses) {
+        gLogIOstream () <<
           "Opening file '" << outputFileName << "' for writing" <<
           endl;
       }
@@ -320,21 +378,22 @@ void convertLpsrScoreToLilypondCode_Pass4 (
       indentedOstream
         lilypondCodeFileOutputStream (
           outFileStream,
-          gIndenter);
+          gIndenter (),
+          true); // buffered
       
       // convert the LPSR score to LilyPond code
       generateLilypondCodeFromLpsrScore (
         lpScore,
-        gMsrOptions,
-        gLpsrOptions,
-        gLogIOstream,
+        gMsrOptions (),
+        gLpsrOptions (),
+        gLogIOstream (),
         lilypondCodeFileOutputStream);
     }
     
     else {
 #ifdef TRACE_OPTIONS
-      if (gTraceOptions->fTracePasses) {
-        gLogIOstream <<
+      if (gTraceOptions ()->fTracePasses) {
+        gLogIOstream () <<
           endl <<
           "LilyPond code will be written to standard output" <<
           endl;
@@ -346,21 +405,22 @@ void convertLpsrScoreToLilypondCode_Pass4 (
       indentedOstream
         lilypondCodeCoutOutputStream (
           cout,
-          gIndenter);
+          gIndenter (),
+          true); // buffered
       
       // convert the LPSR score to LilyPond code
       generateLilypondCodeFromLpsrScore (
         lpScore,
-        gMsrOptions,
-        gLpsrOptions,
-        gLogIOstream,
+        gMsrOptions (),
+        gLpsrOptions (),
+        gLogIOstream (),
         lilypondCodeCoutOutputStream);
     }
 
     if (outputFileNameSize) {
 #ifdef TRACE_OPTIONS
-      if (gTraceOptions->fTracePasses) {
-        gLogIOstream <<
+      if (gTraceOptions ()->fTracePasses) {
+        gLogIOstream () <<
           endl <<
           "Closing file '" << outputFileName << "'" <<
           endl;
@@ -371,21 +431,21 @@ void convertLpsrScoreToLilypondCode_Pass4 (
     }
   }
 
-  if (gIndenter != 0) {
-    if (! gGeneralOptions->fQuiet) {
+  if (gIndenter () != 0) {
+    if (! gGeneralOptions ()->fQuiet) {
       stringstream s;
       
       s <<
         "gIndenter value after pass 4: "<<
-        gIndenter.getIndent ();
+        gIndenter ().getIndent ();
         
       msrMusicXMLWarning (
-        gXml2lyOptions->fInputSourceName,
+        gXml2lyOptions ()->fInputSourceName,
         1, // JMI inputLineNumber,
         s.str ());
     }
 
-    gIndenter.resetToZero ();
+    gIndenter ().resetToZero ();
   }
 }
 
@@ -411,7 +471,7 @@ void convertMusicXMLToLilypond (
       convertMxmlTreeToAScoreSkeleton_Pass2a (
         mxmlTree);
 
-  if (gGeneralOptions->fExit2a)
+  if (gGeneralOptions ()->fExit2a)
     return;
 
     
@@ -422,45 +482,49 @@ void convertMusicXMLToLilypond (
     mxmlTree,
     mScore);
   
-  if (gGeneralOptions->fExit2b)
+  if (gGeneralOptions ()->fExit2b)
     return;
     
 
   // display the MSR score summary if requested
   // ------------------------------------------------------
 
-  if (gMsrOptions->fDisplayMsr) {
+  if (gMsrOptions ()->fDisplayMsr) {
     displayMsrScore_OptionalPass (
       mScore,
-      gMsrOptions);
+      gMsrOptions ());
   }
 
 
   // display the score summary if requested
   // ------------------------------------------------------
 
-  if (gMsrOptions->fDisplayMsrSummary) {
+  if (gMsrOptions ()->fDisplayMsrSummary) {
     // display the score summary
     displayMSRPopulatedScoreSummary (
-      gMsrOptions,
+      gMsrOptions (),
       mScore,
-      gLogIOstream);
+      gLogIOstream ());
 
-    exit (444);
+    msrStopConversion (
+      444,
+      "stopped after the MSR score summary display");
   }
 
 
   // display the score names if requested
   // ------------------------------------------------------
 
-  if (gMsrOptions->fDisplayMsrNames) {
+  if (gMsrOptions ()->fDisplayMsrNames) {
     // display the score name
     displayMSRPopulatedScoreNames (
-      gMsrOptions,
+      gMsrOptions (),
       mScore,
-      gLogIOstream);
+      gLogIOstream ());
 
-    exit (555);
+    msrStopConversion (
+      555,
+      "stopped after the MSR score names display");
   }
 
 
@@ -472,18 +536,18 @@ void convertMusicXMLToLilypond (
       convertMsrScoreToLpsrScore_Pass3 (
         mScore);
 
-  if (gGeneralOptions->fExit3)
+  if (gGeneralOptions ()->fExit3)
     return;
 
 
   // display the LPSR score if requested
   // ------------------------------------------------------
 
-  if (gLpsrOptions->fDisplayLpsr) {
+  if (gLpsrOptions ()->fDisplayLpsr) {
     displayLpsrScore_OptionalPass (
       lpScore,
-      gMsrOptions,
-      gLpsrOptions);
+      gMsrOptions (),
+      gLpsrOptions ());
   }
 
     
@@ -495,6 +559,132 @@ void convertMusicXMLToLilypond (
     lpScore);
 }
 
+//_______________________________________________________________________________
+// batch conversions
+static void convertBatchFile (
+  int           argc,
+  char*         argv [],
+  const string& inputFileName,
+  const string& outputFileName)
+{
+  // a fresh context for each file, whose errors are reported to the batch
+  conversionContext&
+    context =
+      conversionContext::current ();
+
+  context.reset ();
+  context.fErrorsThrowExceptions = true;
+
+  // the options are those of the command line,
+  // the input and output file names are the batch's ones
+  S_xml2lyOptionsHandler
+    optionsHandler =
+      xml2lyOptionsHandler::create (
+        gOutputIOstream ());
+
+  optionsHandler->
+    decipherOptionsAndArguments (
+      argc, argv);
+
+  if (gGeneralOptions ()->fQuiet) {
+    optionsHandler->
+      enforceOptionsHandlerQuietness ();
+  }
+
+  gXml2lyOptions ()->fInputSourceName = inputFileName;
+  gXml2lyOptions ()->fOutputFileName  = outputFileName;
+
+  convertMusicXMLToLilypond (
+    inputFileName,
+    outputFileName);
+}
+
+static int batchConversion (
+  int   argc,
+  char* argv [])
+{
+  string
+    batchSource =
+      gXml2lyOptions ()->fInputSourceName;
+
+  string
+    outputDirectoryName =
+      gXml2lyOptions ()->fOutputDirectoryName;
+
+  int
+    jobs =
+      gXml2lyOptions ()->fJobs;
+
+  // the argument is a directory or a manifest
+  // ------------------------------------------------------
+
+  vector<string> inputFileNames;
+  bool           sourceIsReadable;
+
+  struct stat sourceStat;
+  
+  if (
+    stat (batchSource.c_str (), &sourceStat) == 0
+      &&
+    (sourceStat.st_mode & S_IFMT) == S_IFDIR
+  ) {
+    vector<string> suffixes;
+    
+    suffixes.push_back (".xml");
+    suffixes.push_back (".musicxml");
+    suffixes.push_back (".mxl");
+
+    sourceIsReadable =
+      batch::listDirectory (
+        batchSource, suffixes, inputFileNames);
+  }
+  else {
+    sourceIsReadable =
+      batch::readManifest (
+        batchSource, inputFileNames);
+  }
+
+  if (! sourceIsReadable) {
+    gLogIOstream () <<
+      "### Could not read batch directory or manifest \"" <<
+      batchSource <<
+      "\" ###" <<
+      endl;
+
+    return 1;
+  }
+
+  vector<string> outputFileNames;
+  
+  batch::outputFiles (
+    inputFileNames, outputDirectoryName, ".ly", outputFileNames);
+
+  batch conversionsBatch;
+  
+  for (unsigned int i = 0; i < inputFileNames.size (); i++) {
+    conversionsBatch.add (
+      inputFileNames [i],
+      outputFileNames [i]);
+  } // for
+
+  // convert the files
+  // ------------------------------------------------------
+
+  batch::report
+    report =
+      conversionsBatch.run (
+        [argc, argv] (const string& input, const string& output)
+          {
+            convertBatchFile (argc, argv, input, output);
+          },
+        jobs,
+        superviseBatch);
+
+  report.print (cerr);
+
+  return report.fFailed ? 1 : 0;
+}
+
 //_______________________________________________________________________________
 int main (int argc, char *argv[]) 
 {
@@ -511,7 +701,7 @@ int main (int argc, char *argv[])
   S_xml2lyOptionsHandler
     optionsHandler =
       xml2lyOptionsHandler::create (
-        gOutputIOstream);
+        gOutputIOstream ());
     
   // analyze the command line options and arguments
   // ------------------------------------------------------
@@ -521,13 +711,13 @@ int main (int argc, char *argv[])
       handleOptionsAndArguments (
         optionsHandler,
         argc, argv,
-        gLogIOstream);
+        gLogIOstream ());
 
 /* JMI
   // print the resulting options
 #ifdef TRACE_OPTIONS
-  if (gTraceOptions->fDisplayOptionsHandler) {
-    gLogIOstream <<
+  if (gTraceOptions ()->fDisplayOptionsHandler) {
+    gLogIOstream () <<
       optionsHandler <<
       endl <<
       endl;
@@ -537,20 +727,29 @@ int main (int argc, char *argv[])
 
   string
     inputSourceName =
-      gXml2lyOptions->fInputSourceName;
+      gXml2lyOptions ()->fInputSourceName;
       
   string
     outputFileName =
-      gXml2lyOptions->fOutputFileName;
+      gXml2lyOptions ()->fOutputFileName;
 
   int
     outputFileNameSize =
       outputFileName.size ();
 
+  // batch mode
+  // ------------------------------------------------------
+
+  if (gXml2lyOptions ()->fBatch) {
+    return
+      batchConversion (
+        argc, argv);
+  }
+
   // has quiet mode been requested?
   // ------------------------------------------------------
 
-  if (gGeneralOptions->fQuiet) {
+  if (gGeneralOptions ()->fQuiet) {
     // disable all trace and display options
     optionsHandler->
       enforceOptionsHandlerQuietness ();
@@ -560,68 +759,68 @@ int main (int argc, char *argv[])
   // ------------------------------------------------------
 
 #ifdef TRACE_OPTIONS
-  if (gTraceOptions->fTracePasses) {
-    gLogIOstream <<
+  if (gTraceOptions ()->fTracePasses) {
+    gLogIOstream () <<
       "This is xml2ly " << currentVersionNumber () << 
       " from libmusicxml2 v" << musicxmllibVersionStr () <<
       endl;
 
-    gLogIOstream <<
+    gLogIOstream () <<
       "Launching conversion of ";
 
     if (inputSourceName == "-")
-      gLogIOstream <<
+      gLogIOstream () <<
         "standard input";
     else
-      gLogIOstream <<
+      gLogIOstream () <<
         "\"" << inputSourceName << "\"";
 
-    gLogIOstream <<
+    gLogIOstream () <<
       " to LilyPond" <<
       endl;
 
-    gLogIOstream <<
-      "Time is " << gXml2lyOptions->fTranslationDate <<
+    gLogIOstream () <<
+      "Time is " << gXml2lyOptions ()->fTranslationDate <<
       endl;      
 
-    gLogIOstream <<
+    gLogIOstream () <<
       "LilyPond code will be written to ";
     if (outputFileNameSize) {
-      gLogIOstream <<
+      gLogIOstream () <<
         outputFileName;
     }
     else {
-      gLogIOstream <<
+      gLogIOstream () <<
         "standard output";
     }
-    gLogIOstream <<
+    gLogIOstream () <<
       endl <<
       endl;
     
-    gLogIOstream <<
+    gLogIOstream () <<
       "The command line is:" <<
       endl;
 
-    gIndenter++;
+    gIndenter ()++;
     
-    gLogIOstream <<
+    gLogIOstream () <<
       optionsHandler->
         getCommandLineWithLongOptions () <<
       endl;
 
-    gIndenter--;
-    gLogIOstream <<
+    gIndenter ()--;
+    gLogIOstream () <<
       "or:" <<
       endl;
-    gIndenter++;
+    gIndenter ()++;
     
-    gLogIOstream <<
+    gLogIOstream () <<
       optionsHandler->
         getCommandLineWithShortOptions () <<
       endl <<
       endl;
 
-    gIndenter--;
+    gIndenter ()--;
   }
 #endif
 
@@ -629,12 +828,12 @@ int main (int argc, char *argv[])
   // ------------------------------------------------------
 
 #ifdef TRACE_OPTIONS
-  if (gTraceOptions->fDisplayOptionsValues) {
+  if (gTraceOptions ()->fDisplayOptionsValues) {
     optionsHandler->
       printAllOptionsValues (
-        gLogIOstream);
+        gLogIOstream ());
 
-    gLogIOstream <<
+    gLogIOstream () <<
       endl;
   }
 #endif
@@ -644,14 +843,26 @@ int main (int argc, char *argv[])
   // ------------------------------------------------------
 
 #ifdef TRACE_OPTIONS
-  if (gTraceOptions->fTracePasses) {
-    gLogIOstream <<
+  if (gTraceOptions ()->fTracePasses) {
+    gLogIOstream () <<
       "The command line options and arguments have been analyzed" <<
       endl;
   }
 #endif
 
   
+  // start profiling if requested
+  // ------------------------------------------------------
+
+  if (gGeneralOptions ()->fProfilingJSONFileName.size ()) {
+    gCountAllocations = true;
+
+    gProfiling ().setAllocationsCounter (
+      countAllocations);
+      
+    gProfiling ().activate ();
+  }
+
   // do the translation
   // ------------------------------------------------------
 
@@ -667,14 +878,37 @@ int main (int argc, char *argv[])
   // print timing information
   // ------------------------------------------------------
 
-  if (gGeneralOptions->fDisplayCPUusage)
-    timing::gTiming.print (
-      gLogIOstream);
+  if (gGeneralOptions ()->fDisplayCPUusage)
+    gTiming ().print (
+      gLogIOstream ());
+
+  // write profiling information
+  // ------------------------------------------------------
+
+  if (gProfiling ().isActive ()) {
+    ofstream
+      profilingStream (
+        gGeneralOptions ()->fProfilingJSONFileName.c_str (),
+        ofstream::out);
+
+    if (profilingStream.is_open ()) {
+      gProfiling ().printJSON (
+        profilingStream,
+        inputSourceName);
+    }
+    else {
+      gLogIOstream () <<
+        "### Could not open profiling file \"" <<
+        gGeneralOptions ()->fProfilingJSONFileName <<
+        "\" for writing ###" <<
+        endl;
+    }
+  }
 
   // check indentation
-  if (gIndenter != 0) {
-    gLogIOstream <<
-      "### gIndenter final value: "<< gIndenter.getIndent () << " ###" <<
+  if (gIndenter () != 0) {
+    gLogIOstream () <<
+      "### gIndenter final value: "<< gIndenter ().getIndent () << " ###" <<
       endl <<
       endl;
 
@@ -685,7 +919,7 @@ int main (int argc, char *argv[])
   // ------------------------------------------------------
 
   if (! true) { // JMI
-    gLogIOstream <<
+    gLogIOstream () <<
       "### Conversion from LPSR to LilyPond code failed ###" <<
       endl <<
       endl;
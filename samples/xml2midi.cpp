@@ -11,6 +11,7 @@
 # pragma warning (disable : 4786)
 #endif
 
+#include <stdlib.h>
 #include <string.h>
 #include <iostream>
 
@@ -18,6 +19,7 @@
 #include "xmlfile.h"
 #include "xmlreader.h"
 #include "midicontextvisitor.h"
+#include "smfwriter.h"
 #include "unrolled_xml_tree_browser.h"
 
 using namespace std;
@@ -51,18 +53,42 @@ class mymidiwriter : public midiwriter {
 			{ cout << date << " progChange chan " << chan << " prog " << prog << endl; }
 };
 
+//_______________________________________________________________________________
+static void usage()
+{
+	cerr << "usage: xml2midi [-o <midi file>] [<musicxml file> | -]" << endl;
+	cerr << "       prints the MIDI events of a MusicXML file" << endl;
+	cerr << "       option: -o <midi file> writes a Standard MIDI File instead" << endl;
+	exit(1);
+}
+
 //_______________________________________________________________________________
 int main(int argc, char *argv[]) {
-	char * file = argv[1];
+	const char* midifile = 0;
+	int i = 1;
+	if ((i + 1 < argc) && !strcmp(argv[i], "-o")) {
+		midifile = argv[i+1];
+		i += 2;
+	}
+	if (i + 1 < argc) usage();
+
+	char * file = (i < argc) ? argv[i] : 0;
 	xmlreader r;
 	SXMLFile xmlfile;
-	if ((argc > 1) && strcmp(file, "-"))
+	if (file && strcmp(file, "-"))
 		xmlfile = r.read(file);
 	else
 		xmlfile = r.read(stdin);
 	if (xmlfile) {
 		Sxmlelement st = xmlfile->elements();
 		if (st) {
+			if (midifile) {
+				if (!smfwriter::write(st, midifile, 480)) {
+					cerr << "can't write " << midifile << endl;
+					return 1;
+				}
+				return 0;
+			}
 			mymidiwriter writer;
 			midicontextvisitor v(480, &writer);
 			unrolled_xml_tree_browser browser(&v);
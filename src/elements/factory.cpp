@@ -21,6 +21,7 @@
 #endif
 
 #include <iostream>
+#include <string.h>
 #include "elements.h"
 #include "factory.h"
 #include "types.h"
@@ -28,7 +29,8 @@
 using namespace std; 
 
 // libmxmllineno is outside of name space MusicXML2
-extern int libmxmllineno;
+// it is thread local: each thread reports the line of its own parse
+extern thread_local int libmxmllineno;
 
 
 namespace MusicXML2 
@@ -51,26 +53,79 @@ class newElementFunctor : public functor<Sxmlelement>
 };
 
 
+//______________________________________________________________________________
+// FNV-1a hash of an element name
+static inline unsigned int hashName (const char* name)
+{
+	unsigned int h = 2166136261u;
+	while (*name) {
+		h ^= (unsigned char)*name++;
+		h *= 16777619u;
+	}
+	return h;
+}
+
+void factory::buildIndex ()
+{
+	size_t size = 1;
+	while (size < 4 * fMap.size()) size <<= 1;		// keeps the load factor under 25%
+	indexEntry empty = { 0, kNoElement };
+	fIndex.assign (size, empty);
+	fFunctors.assign (kEndElement, 0);
+	fNames.assign (kEndElement, symbols::empty());
+
+	for (map<int, const char*>::const_iterator i = fType2Name.begin(); i != fType2Name.end(); i++) {
+		map<std::string, functor<Sxmlelement>*>::const_iterator f = fMap.find(i->second);
+		if (f == fMap.end()) continue;
+		fFunctors[i->first] = f->second;
+		// the names out of the vocabulary (a factory generated from another schema than the symbols table) use the map keys, which are stable
+		symbol name = symbols::find (f->first);
+		fNames[i->first] = name ? name : &f->first;
+		size_t slot = hashName (f->first.c_str()) & (size - 1);
+		while (fIndex[slot].fName) slot = (slot + 1) & (size - 1);
+		fIndex[slot].fName = f->first.c_str();		// map keys are stable
+		fIndex[slot].fType = i->first;
+	}
+}
+
+int factory::type (const char* eltname) const
+{
+	size_t mask = fIndex.size() - 1;
+	size_t slot = hashName (eltname) & mask;
+	while (const char* name = fIndex[slot].fName) {
+		if (!strcmp (name, eltname)) return fIndex[slot].fType;
+		slot = (slot + 1) & mask;
+	}
+	return kNoElement;
+}
+
+symbol factory::name (int type) const
+{
+	return ((type >= 0) && (type < int(fNames.size()))) ? fNames[type] : symbols::empty();
+}
+
 Sxmlelement factory::create (const string& eltname) const
 { 
-	map<std::string, functor<Sxmlelement>*>::const_iterator i = fMap.find( eltname );
-	if (i != fMap.end()) {
-		functor<Sxmlelement>* f= i->second;
-		if (f) {
-			Sxmlelement elt = (*f)();
-			elt->setName(eltname);
-			return elt;
-		}
-	}
+	return create (eltname.c_str());
+}
+
+Sxmlelement factory::create (const char* eltname) const
+{ 
+	int t = type (eltname);
+	if (t != kNoElement) return create (t);
 	cerr << "Sxmlelement factory::create called with unknown element \"" << eltname << "\"" << endl;
 	return 0;
 }
 
 Sxmlelement factory::create(int type) const
 { 
-	map<int, const char*>::const_iterator i = fType2Name.find( type );
-	if (i != fType2Name.end()) {
-		return create (i->second);
+	if ((type > kNoElement) && (type < kEndElement)) {
+		functor<Sxmlelement>* f= fFunctors[type];
+		if (f) {
+			Sxmlelement elt = (*f)();
+			elt->setName(fNames[type]);
+			return elt;
+		}
 	}
 	cerr << "Sxmlelement factory::create called with unknown type \"" << type << "\"" << endl;
 	return 0;
@@ -906,5 +961,7 @@ factory::factory()
 	fType2Name[k_work] 	= "work";
 	fType2Name[k_work_number] 	= "work-number";
 	fType2Name[k_work_title] 	= "work-title";
+
+	buildIndex();
 }
 }
@@ -15,6 +15,7 @@
 
 #include <string>
 #include <map>
+#include <vector>
 #include "functor.h"
 #include "singleton.h"
 #include "xml.h"
@@ -31,12 +32,26 @@ class EXP factory : public singleton<factory>{
 
 	std::map<std::string, functor<Sxmlelement>*> fMap;
 	std::map<int, const char*>	fType2Name;
+
+	typedef struct { const char* fName; int fType; } indexEntry;
+	std::vector<indexEntry>				fIndex;		// open addressing hash table: element name -> type
+	std::vector<functor<Sxmlelement>*>	fFunctors;	// element constructors indexed by type
+	std::vector<symbol>					fNames;		// element names indexed by type
+
+	void	buildIndex();
+
 	public:
 				 factory();
 		virtual ~factory() {}
 
 		Sxmlelement create(const std::string& elt) const;	
+		Sxmlelement create(const char* elt) const;	
 		Sxmlelement create(int type) const;	
+
+		//! gives the type of an element name, or kNoElement when the name is unknown
+		int			type(const char* elt) const;
+		//! gives the interned name of an element type, the empty symbol when the type is unknown
+		symbol		name(int type) const;
 };
 
 }
@@ -0,0 +1,335 @@
+/*
+  MusicXML Library
+  Copyright (C) Grame 2006-2013
+
+  This Source Code Form is subject to the terms of the Mozilla Public
+  License, v. 2.0. If a copy of the MPL was not distributed with this
+  file, You can obtain one at http://mozilla.org/MPL/2.0/.
+
+  Grame Research Laboratory, 11, cours de Verdun Gensoul 69002 Lyon - France
+  research@grame.fr
+*/
+
+#ifdef MSVC
+# pragma warning (disable : 4786)
+#endif
+
+#include <algorithm>
+#include <climits>
+#include <iostream>
+
+#include "elements.h"
+#include "playbackplan.h"
+
+using namespace std;
+namespace MusicXML2
+{
+
+//______________________________________________________________________________
+// controls collection
+//______________________________________________________________________________
+static void collectControls (const xmlelement& elt, vector<playbackplan::control>& ctrls)
+{
+	playbackplan::control c;
+	switch (elt.getType()) {
+		case k_ending: {
+			const string& type = elt.getAttributeValue(attributeNames::type);
+			if (type == "start") {
+				c.fType = playbackplan::kEndingStart;
+				c.fValue = elt.getAttributeIntValue(attributeNames::number, 1);
+			}
+			else if ((type == "stop") || (type == "discontinue")) {
+				c.fType = playbackplan::kEndingStop;
+				c.fValue = 0;
+			}
+			else return;
+			break;
+		}
+		case k_repeat: {
+			const string& direction = elt.getAttributeValue(attributeNames::direction);
+			if (direction == "backward") {
+				c.fType = playbackplan::kBackwardRepeat;
+				c.fValue = elt.getAttributeIntValue(attributeNames::times, 1);
+			}
+			else if (direction == "forward") {
+				c.fType = playbackplan::kForwardRepeat;
+				c.fValue = 0;
+			}
+			else return;
+			break;
+		}
+		case k_sound: {
+			c.fType = playbackplan::kSound;
+			c.fValue = 0;
+			if (!elt.getAttributeValue(attributeNames::segno).empty())		c.fValue |= playbackplan::kSegno;
+			if (!elt.getAttributeValue(attributeNames::coda).empty())		c.fValue |= playbackplan::kCoda;
+			if (!elt.getAttributeValue(attributeNames::fine).empty())		c.fValue |= playbackplan::kFine;
+			if (elt.getAttributeValue(attributeNames::dacapo) == "yes")		c.fValue |= playbackplan::kDaCapo;
+			if (!elt.getAttributeValue(attributeNames::dalsegno).empty())	c.fValue |= playbackplan::kDalSegno;
+			if (!elt.getAttributeValue(attributeNames::tocoda).empty())		c.fValue |= playbackplan::kToCoda;
+			if (!c.fValue) return;
+			break;
+		}
+		default:
+			for (ctree<xmlelement>::branchs::const_iterator i = elt.elements().begin(); i != elt.elements().end(); i++)
+				collectControls (**i, ctrls);
+			return;
+	}
+	ctrls.push_back (c);
+}
+
+//______________________________________________________________________________
+void playbackplan::collect (const xmlelement& part, controls& ctrls, vector<bool>& measures)
+{
+	const ctree<xmlelement>::branchs& elts = part.elements();
+	ctrls.clear();
+	ctrls.resize (elts.size());
+	measures.resize (elts.size());
+	for (size_t i = 0; i < elts.size(); i++) {
+		measures[i] = (elts[i]->getType() == k_measure);
+		collectControls (*elts[i], ctrls[i]);
+	}
+}
+
+//______________________________________________________________________________
+// playbackplan
+//______________________________________________________________________________
+Splaybackplan playbackplan::create (const controls& ctrls, const vector<bool>& measures)
+{
+	playbackplan* o = new playbackplan(ctrls, measures); assert(o!=0); return o;
+}
+
+Splaybackplan playbackplan::create (const xmlelement& part)
+{
+	controls ctrls;
+	vector<bool> measures;
+	collect (part, ctrls, measures);
+	return create (ctrls, measures);
+}
+
+//______________________________________________________________________________
+namespace {
+
+typedef struct { int current; int next; } state;
+enum { kUndefined=-1, kNoInstruction=0 };
+enum { kNoJump, kDaCapo, kDalSegno, kToCoda };
+
+// the state of the playback of a part, positions are the part elements indices
+class playbackState
+{
+	public:
+		state	fJump;			// indicates the current and next jump state
+		state	fRound;			// the current time we're playing a section
+		state	fExpectedRound;	// the expected time to play a section (0 when no instruction)
+		int		fSectionIndex;	// the current measure number within the current section
+		vector<int>	fRepeats;	// the times each backward repeat has been played, to avoid loops in miswritten scores
+
+		int		fFirstMeasure, fForwardRepeat, fEnd, fNext, fSegno, fCoda;
+		int*	fStore;			// a location to store the current position
+		int		fStoreDelay;	// an iterations counter for delayed store
+
+		playbackState (int size, int repeats) : fRepeats(repeats) {
+			fJump.current = fJump.next = kNoJump;
+			fFirstMeasure = fForwardRepeat = 0;
+			fEnd = fSegno = fCoda = size;
+			fNext = 0;
+			fStore = 0;
+			fStoreDelay = 0;
+			reset();
+		}
+
+		void reset () {
+			fill (fRepeats.begin(), fRepeats.end(), 0);
+			fSectionIndex = 0;
+			fRound.current = 1;	fRound.next = kNoInstruction;	// this is the first time we play the part
+			fExpectedRound.current = kNoInstruction;			// and there is no specific instruction for the round
+			fExpectedRound.next = kUndefined;					// and there is no specific instruction for the next iteration
+		}
+
+		// adjust the state at the beginning of a measure
+		void measure () {
+			if (fExpectedRound.next != kUndefined) {
+				fExpectedRound.current = fExpectedRound.next;
+				fExpectedRound.next = kUndefined;
+			}
+			if (fRound.next > 0) {
+				fRound.current = fRound.next;
+				fRound.next = kUndefined;
+			}
+			if (fJump.next) {
+				fJump.current = fJump.next;
+				fJump.next = kNoJump;
+			}
+			fSectionIndex++;
+		}
+
+		// checks that we're not looking for the coda sign and that we're playing the correct round
+		bool playing () const {
+			if (fJump.current == kToCoda) return false;
+			return (fExpectedRound.current == kNoInstruction) || (fRound.current == fExpectedRound.current);
+		}
+
+		void ending (const playbackplan::control& c) {
+			if (c.fType == playbackplan::kEndingStart) {
+				// it is assumed that ending starting just after a repeat bar denotes a continuation
+				// of the previous repeat, thus it is ignored whatever value it has
+				if (fSectionIndex > 1) fExpectedRound.current = c.fValue;
+			}
+			else fExpectedRound.next = kNoInstruction;			// no specific round expected at next iteration
+		}
+
+		void backwardRepeat (int repeat, int times) {
+			fRepeats[repeat]++;
+			// check first for times to play the repeat section and for possible loop
+			if ((fRound.current <= times) && (fRepeats[repeat] <= times)) {
+				fNext = fForwardRepeat;						// jump to the forward repeat at next iteration
+				fRound.next = fRound.current + 1;			// increments the current round at next iteration
+				fExpectedRound.next = fRound.current + 1;	// and adjust the corresponding round for next iteration
+			}
+			else {											// jump out of the repeat section:
+				fRound.next = 1;							// next round will be 1
+				fExpectedRound.next = kNoInstruction;		// no specific round expected at next iteration
+				fSectionIndex = 0;							// and starts a new section
+			}
+		}
+
+		void sound (int flags) {
+			// we first collect possible locations of the score
+			if (flags & playbackplan::kSegno)	{ fStore = &fSegno; }
+			if (flags & playbackplan::kCoda)	{ fJump.current = kNoJump; fStore = &fCoda; }
+			if (flags & playbackplan::kFine)	{ fStoreDelay = 1; fStore = &fEnd; }
+
+			// next we look for possible jumps
+			// note that multiple jumps in a single sound element are not supported
+			if (flags & playbackplan::kDaCapo) {
+				if (fJump.current == kNoJump) {
+					fNext = fFirstMeasure;
+					fJump.current = kDaCapo;
+					reset();
+				}
+			}
+			else if (flags & playbackplan::kDalSegno) {
+				if (fJump.current == kNoJump) {
+					fNext = fSegno;
+					fJump.current = kDalSegno;
+					reset();
+				}
+			}
+			else if (flags & playbackplan::kToCoda) {
+				if ((fJump.current == kDaCapo) || (fJump.current == kDalSegno)) {
+					if (fCoda != fEnd)		// when the coda sign has already been seen, jump to coda
+						fNext = fCoda;		// otherwise set the state to kToCoda
+					else fJump.next = kToCoda;	// it inhibits the playback until we find the coda sign
+					reset();
+				}
+			}
+		}
+};
+
+}
+
+//______________________________________________________________________________
+// the playback order is computed the way the unrolled_xml_tree_browser used to
+// jump across the measures: anchor points (forward repeat, segno, coda, fine)
+// are stored at the end of the measure that contains them, or one measure later
+// for fine.
+// The number of iterations is bounded to terminate with miswritten scores that
+// would loop for ever (e.g. a coda sign before a da capo). Between two jumps,
+// the part is browsed at most once plus once per time a backward repeat is
+// taken, and each jump is taken at most once by a well written score: the
+// bound is computed from these counts, and reaching it truncates the plan.
+playbackplan::playbackplan (const controls& ctrls, const vector<bool>& measures) : fTruncated(false)
+{
+	const int size = int(ctrls.size());
+	// the backward repeats are numbered in their order in the part
+	vector<vector<int> > repeats (size);
+	int count = 0;
+	double rounds = 1, jumps = 1;
+	for (int i = 0; i < size; i++) {
+		for (size_t c = 0; c < ctrls[i].size(); c++) {
+			const control& ctrl = ctrls[i][c];
+			repeats[i].push_back ((ctrl.fType == kBackwardRepeat) ? count++ : -1);
+			if (ctrl.fType == kBackwardRepeat) rounds += max(ctrl.fValue, 0);
+			else if ((ctrl.fType == kSound) && (ctrl.fValue & (playbackplan::kDaCapo | playbackplan::kDalSegno | playbackplan::kToCoda))) jumps++;
+		}
+	}
+
+	playbackState s (size, count);
+	const double bound = (size + 1) * rounds * jumps;
+	const long maxIterations = (bound < LONG_MAX) ? long(bound) : LONG_MAX;
+	long iterations = 0;
+	int pos = 0;
+	while ((pos != s.fEnd) && (pos < size) && (pos >= 0)) {
+		if (iterations++ == maxIterations) {
+			fTruncated = true;
+			cerr << "playbackplan: the playback loops, it is truncated after " << fOrder.size() << " measures" << endl;
+			break;
+		}
+		s.fNext = pos + 1;					// default value for next position is the next measure
+		bool measure = measures[pos];
+		if (measure) s.measure();
+		const vector<control>& c = ctrls[pos];
+		for (size_t i = 0; i < c.size(); i++) {
+			switch (c[i].fType) {
+				case kEndingStart:
+				case kEndingStop:		s.ending (c[i]); break;
+				case kForwardRepeat:	s.fStore = &s.fForwardRepeat; break;
+				case kBackwardRepeat:	s.backwardRepeat (repeats[pos][i], c[i].fValue); break;
+				case kSound:			s.sound (c[i].fValue); break;
+			}
+		}
+		if (measure && s.playing()) fOrder.push_back (pos);
+
+		if (s.fStore) {						// check if we need to store the current position
+			if (s.fStoreDelay == 0) {
+				*s.fStore = pos;
+				s.fStore = 0;
+			}
+			else s.fStoreDelay--;			// this is actually a delayed store
+		}
+		pos = s.fNext;						// switch to next position (which may be changed by the controls)
+	}
+}
+
+//______________________________________________________________________________
+// playbackplans
+//______________________________________________________________________________
+void playbackplans::sign (const playbackplan::controls& ctrls, const vector<bool>& measures, signature& s)
+{
+	s.push_back (int(ctrls.size()));
+	for (size_t i = 0; i < ctrls.size(); i++) {
+		if (ctrls[i].empty() && measures[i]) continue;
+		s.push_back (int(i));
+		s.push_back (measures[i]);
+		s.push_back (int(ctrls[i].size()));
+		for (size_t c = 0; c < ctrls[i].size(); c++) {
+			s.push_back (ctrls[i][c].fType);
+			s.push_back (ctrls[i][c].fValue);
+		}
+	}
+}
+
+//______________________________________________________________________________
+Splaybackplan playbackplans::get (const Sxmlelement& part)
+{
+	map<Sxmlelement, Splaybackplan>::const_iterator i = fParts.find (part);
+	if (i != fParts.end()) return i->second;
+
+	playbackplan::controls ctrls;
+	vector<bool> measures;
+	playbackplan::collect (*part, ctrls, measures);
+	signature s;
+	sign (ctrls, measures, s);
+	Splaybackplan& plan = fPlans[s];
+	if (!plan) plan = playbackplan::create (ctrls, measures);
+	fParts[part] = plan;
+	return plan;
+}
+
+void playbackplans::clear ()
+{
+	fParts.clear();
+	fPlans.clear();
+}
+
+}
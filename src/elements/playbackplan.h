@@ -0,0 +1,115 @@
+/*
+  MusicXML Library
+  Copyright (C) Grame 2006-2013
+
+  This Source Code Form is subject to the terms of the Mozilla Public
+  License, v. 2.0. If a copy of the MPL was not distributed with this
+  file, You can obtain one at http://mozilla.org/MPL/2.0/.
+
+  Grame Research Laboratory, 11, cours de Verdun Gensoul 69002 Lyon - France
+  research@grame.fr
+*/
+
+#ifndef __playbackplan__
+#define __playbackplan__
+
+#include <map>
+#include <vector>
+
+#include "exports.h"
+#include "smartpointer.h"
+#include "xml.h"
+
+namespace MusicXML2
+{
+
+/*!
+\addtogroup MusicXML
+@{
+*/
+
+class playbackplan;
+typedef SMARTP<playbackplan> Splaybackplan;
+
+//______________________________________________________________________________
+/*!
+\brief the playback order of the measures of a part
+
+  The plan is computed once from the \b repeat, \b ending and \b sound elements
+  of a part (segno, coda, fine, dacapo, dalsegno and tocoda attributes), as a
+  musician would play the score. It is the list of the indices of the measures
+  in the part elements, in playback order: for example a section repeated
+  twice appears twice.
+
+  The plan depends only on the structure of the part: parts sharing the same
+  structure may share the same plan.
+*/
+class EXP playbackplan : public smartable
+{
+	public:
+		//! a repeat, ending or sound element that controls the playback
+		typedef struct {
+			int	fType;			///< the control type
+			int	fValue;			///< the ending number, the backward repeat times or the sound flags
+		} control;
+		enum { kEndingStart, kEndingStop, kForwardRepeat, kBackwardRepeat, kSound };
+		//! the controls of each element of a part
+		typedef std::vector<std::vector<control> >	controls;
+
+		//! the sound flags
+		enum { kSegno=1, kCoda=2, kFine=4, kDaCapo=8, kDalSegno=16, kToCoda=32 };
+
+		static Splaybackplan create (const xmlelement& part);
+		static Splaybackplan create (const controls& ctrls, const std::vector<bool>& measures);
+
+		//! collects the controls of a part, the measures flags tells which of the part elements are measures
+		static void collect (const xmlelement& part, controls& ctrls, std::vector<bool>& measures);
+
+		//! the measures indices in playback order
+		const std::vector<int>&	order () const		{ return fOrder; }
+		size_t					size () const		{ return fOrder.size(); }
+		//! true when the playback loops for ever (a miswritten score): the order is then truncated
+		bool					truncated () const	{ return fTruncated; }
+
+	protected:
+				 playbackplan (const controls& ctrls, const std::vector<bool>& measures);
+		virtual ~playbackplan() {}
+
+	private:
+		std::vector<int>	fOrder;
+		bool				fTruncated;
+};
+
+//______________________________________________________________________________
+/*!
+\brief a cache of playback plans
+
+  Plans are computed at the first request for a part and next retrieved from the
+  cache. Parts with the same structure share the same plan. The cache assumes that
+  the parts are not modified: it should be cleared otherwise.
+*/
+class EXP playbackplans
+{
+	typedef std::vector<int>	signature;
+
+	std::map<Sxmlelement, Splaybackplan>	fParts;
+	std::map<signature, Splaybackplan>		fPlans;		// the plans by part structure
+
+	static void sign (const playbackplan::controls& ctrls, const std::vector<bool>& measures, signature& s);
+
+	public:
+				 playbackplans() {}
+		virtual ~playbackplans() {}
+
+		//! returns the plan of a part
+		Splaybackplan	get (const Sxmlelement& part);
+		//! the number of distinct plans
+		size_t			size () const		{ return fPlans.size(); }
+		void			clear ();
+};
+
+/*! @} */
+
+}
+
+#endif
@@ -47,11 +47,30 @@ case $3 in
     done
 
     # generate epiloque
+    echo
+    echo '  buildIndex();'
     echo '}'
     echo '}'
     ;;
 
 
+  'vocabulary')
+    # copy license and the vocabulary preamble
+    # to standard output
+    cat $2/license.txt $2/vocabulary.txt
+
+    # generate the names of the markups and of the attributes ($4) found in
+    # the schema, with the names of the template, each one once
+    for a in $(cat $1 $4 $2/vocabulary-names.txt | cut -d' ' -f1 | sort -u)
+    do
+      echo "  \"$a\","
+    done
+
+    # generate epiloque
+    echo '};'
+    ;;
+
+
   'typemap') #  UNUSED JMI ???
     # copy license and and the fMap preamble
     # to standard output
@@ -87,7 +106,7 @@ case $3 in
 
 
   *)
-    echo "usage: elements.bash eltsfile templatedir [constants | map | types]"
+    echo "usage: elements.bash eltsfile templatedir [constants | map | types | vocabulary attrsfile]"
     exit 1
     ;;
 esac  
@@ -45,7 +45,7 @@ template <int elt> class musicxml : public xmlelement
 		{ musicxml<elt>* o = new musicxml<elt>(elts, inputLineNumber); assert(o!=0); return o; }
 
     virtual void acceptIn (basevisitor& v) {
-		if (visitor<SMARTP<musicxml<elt> > >* p = dynamic_cast<visitor<SMARTP<musicxml<elt> > >*>(&v)) {
+		if (visitor<SMARTP<musicxml<elt> > >* p = v.dispatch<visitor<SMARTP<musicxml<elt> > > >(elt)) {
 			SMARTP<musicxml<elt> > sptr = this;
 			p->visitStart (sptr);
 		}
@@ -53,7 +53,7 @@ template <int elt> class musicxml : public xmlelement
 	}
 
     virtual void acceptOut (basevisitor& v) {
-        if ( visitor<SMARTP<musicxml<elt> > >* p = dynamic_cast<visitor<SMARTP<musicxml<elt> > >*>(&v)) {
+        if ( visitor<SMARTP<musicxml<elt> > >* p = v.dispatch<visitor<SMARTP<musicxml<elt> > > >(elt)) {
 			SMARTP<musicxml<elt> > sptr = this;
 			p->visitEnd (sptr);
         }
@@ -10,11 +10,15 @@
   research@grame.fr
 */
 
+#include <errno.h>
+#include <math.h>
 #include <stdlib.h>
 #include <string>
 #include <sstream>
 #include <iostream>
 
+#include "elements.h"
+#include "rational.h"
 #include "xml.h"
 #include "visitor.h"
 
@@ -23,30 +27,94 @@ using namespace std;
 namespace MusicXML2 
 {
 
+//______________________________________________________________________________
+// numericvalue
+//______________________________________________________________________________
+// the values are those of atol and atof: most values are integers, their
+// double value is then converted from the long value instead of parsed again
+void numericvalue::compute (const string& value, long& l, double& d) const
+{
+	const char* str = value.c_str();
+	char* end;
+	errno = 0;
+	l = strtol (str, &end, 10);
+	const long kExactDouble = 1L << 53;		// integers that convert exactly to double
+	if ((end != str) && !*end && !errno && (l < kExactDouble) && (l > -kExactDouble))
+		d = double(l);
+	else
+		d = atof (str);
+
+	// the values are stored by the first reader only
+	unsigned char state = kUnparsed;
+	if (fState.compare_exchange_strong (state, kParsing, memory_order_acquire)) {
+		fLong = l;
+		fDouble = d;
+		fState.store (kParsed, memory_order_release);
+	}
+}
+
+rational numericvalue::getRational (const string& value) const
+{
+	if (value.find ('/') != string::npos) return rational (value);
+	long l = getLong (value);
+	double d = getDouble (value);
+	if (d == double(l)) return rational (l, 1);
+
+	// a decimal number: the smallest power of 10 that makes it an integer
+	long denom = 1;
+	while ((denom < 1000000000L) && (d * denom != floor (d * denom))) denom *= 10;
+	rational r (long(floor (d * denom + 0.5)), denom);
+	r.rationalise ();
+	return r;
+}
+
+//______________________________________________________________________________
+// xmlname
+//______________________________________________________________________________
+void xmlname::own (const string& name)
+{
+	if (fOwn) *fOwn = name;
+	else fOwn = new string (name);
+	fName = fOwn;
+}
+
+void xmlname::set (const char* name)
+{
+	symbol s = symbols::find (name);
+	if (s) set (s);
+	else own (name);
+}
+
+void xmlname::set (const string& name)
+{
+	symbol s = symbols::find (name);
+	if (s) set (s);
+	else own (name);
+}
+
 //______________________________________________________________________________
 // xmlattribute
 //______________________________________________________________________________
 Sxmlattribute xmlattribute::create() { xmlattribute * o = new xmlattribute; assert(o!=0); return o; }
 
 //______________________________________________________________________________
-void xmlattribute::setName (const string& name) 		{ fName = name; }
-void xmlattribute::setValue (const string& value) 		{ fValue = value; }
+void xmlattribute::setValue (const string& value) 		{ fValue = value; fNumeric.reset (); }
 
 //______________________________________________________________________________
+// the integer values are known: they are not parsed again
 void xmlattribute::setValue (long value)
 {
 	stringstream s;
 	s << value;
 	s >> fValue;
+	fNumeric.set (value);
 }
 
 //______________________________________________________________________________
-void xmlattribute::setValue (int value)
-{
-	stringstream s;
-	s << value;
-	s >> fValue;
-}
+rational xmlattribute::getRationalValue () const	{ return fNumeric.getRational (fValue); }
+
+//______________________________________________________________________________
+void xmlattribute::setValue (int value)		{ setValue (long(value)); }
 
 //______________________________________________________________________________
 void xmlattribute::setValue (float value)
@@ -54,25 +122,46 @@ void xmlattribute::setValue (float value)
 	stringstream s;
 	s << value;
 	s >> fValue;
+	fNumeric.reset ();
 }
 
-xmlattribute::operator int () const		{ return atoi(fValue.c_str()); }
-xmlattribute::operator long () const	{ return atol(fValue.c_str()); }
-xmlattribute::operator float () const	{ return (float)atof(fValue.c_str()); }
+//______________________________________________________________________________
+// attributeNames
+//______________________________________________________________________________
+const symbol attributeNames::coda			= symbols::find("coda");
+const symbol attributeNames::dacapo			= symbols::find("dacapo");
+const symbol attributeNames::dalsegno		= symbols::find("dalsegno");
+const symbol attributeNames::default_x		= symbols::find("default-x");
+const symbol attributeNames::default_y		= symbols::find("default-y");
+const symbol attributeNames::direction		= symbols::find("direction");
+const symbol attributeNames::dynamics		= symbols::find("dynamics");
+const symbol attributeNames::fine			= symbols::find("fine");
+const symbol attributeNames::id				= symbols::find("id");
+const symbol attributeNames::number			= symbols::find("number");
+const symbol attributeNames::placement		= symbols::find("placement");
+const symbol attributeNames::print_object	= symbols::find("print-object");
+const symbol attributeNames::relative_x		= symbols::find("relative-x");
+const symbol attributeNames::relative_y		= symbols::find("relative-y");
+const symbol attributeNames::segno			= symbols::find("segno");
+const symbol attributeNames::size			= symbols::find("size");
+const symbol attributeNames::tempo			= symbols::find("tempo");
+const symbol attributeNames::times			= symbols::find("times");
+const symbol attributeNames::tocoda			= symbols::find("tocoda");
+const symbol attributeNames::type			= symbols::find("type");
 
 //______________________________________________________________________________
 // xmlelement
 //______________________________________________________________________________
 Sxmlelement xmlelement::create(int lineno)			{ xmlelement * o = new xmlelement(lineno); assert(o!=0); return o; }
 void xmlelement::setValue (int value)				{ setValue((long)value); }
-void xmlelement::setValue (const string& value) 	{ fValue = value; }
-void xmlelement::setName (const string& name) 		{ fName = name; }
+void xmlelement::setValue (const string& value) 	{ fValue = value; fNumeric.reset (); }
 //______________________________________________________________________________
 void xmlelement::setValue (long value)
 {
 	stringstream s;
 	s << value;
 	s >> fValue;
+	fNumeric.set (value);
 }
 
 //______________________________________________________________________________
@@ -81,6 +170,7 @@ void xmlelement::setValue (unsigned long value)
 	stringstream s;
 	s << value;
 	s >> fValue;
+	fNumeric.reset ();
 }
 
 //______________________________________________________________________________
@@ -89,8 +179,12 @@ void xmlelement::setValue (float value)
 	stringstream s;
 	s << value;
 	s >> fValue;
+	fNumeric.reset ();
 }
 
+//______________________________________________________________________________
+rational xmlelement::getRationalValue () const		{ return fNumeric.getRational (fValue); }
+
 //______________________________________________________________________________
 long xmlelement::add (const Sxmlattribute& attr)
 { 
@@ -99,8 +193,9 @@ long xmlelement::add (const Sxmlattribute& attr)
 }
 
 //______________________________________________________________________________
+// generic xmlelement visitors are dispatched using the kNoElement entry
 void xmlelement::acceptIn(basevisitor& v) {
-	visitor<Sxmlelement>* p = dynamic_cast<visitor<Sxmlelement>*>(&v);
+	visitor<Sxmlelement>* p = v.dispatch<visitor<Sxmlelement> >(kNoElement);
 	if (p) {
 		Sxmlelement xml = this;
 		p->visitStart (xml);
@@ -109,7 +204,7 @@ void xmlelement::acceptIn(basevisitor& v) {
 
 //______________________________________________________________________________
 void xmlelement::acceptOut(basevisitor& v) {
-	visitor<Sxmlelement>* p = dynamic_cast<visitor<Sxmlelement>*>(&v);
+	visitor<Sxmlelement>* p = v.dispatch<visitor<Sxmlelement> >(kNoElement);
 	if (p) {
 		Sxmlelement xml = this;
 		p->visitEnd (xml);
@@ -119,7 +214,7 @@ void xmlelement::acceptOut(basevisitor& v) {
 //______________________________________________________________________________
 const Sxmlattribute xmlelement::getAttribute(const string& attrname) const 
 {
-	vector<Sxmlattribute>::const_iterator it;
+	attributesList::const_iterator it;
 	for (it = attributes().begin(); it != attributes().end(); it++) {
 		if ((*it)->getName() == attrname)
 			return *it;
@@ -138,42 +233,74 @@ const string xmlelement::getAttributeValue (const string& attrname) const
 long xmlelement::getAttributeLongValue (const string& attrname, long defaultvalue) const
 {
 	Sxmlattribute attribute = getAttribute(attrname);
-	return attribute ? atol(attribute->getValue().c_str()) : defaultvalue;
+	return attribute ? attribute->getLongValue() : defaultvalue;
 }
 
 //______________________________________________________________________________
 int xmlelement::getAttributeIntValue (const string& attrname, int defaultvalue) const
 {
 	Sxmlattribute attribute = getAttribute(attrname);
-	return attribute ? atoi(attribute->getValue().c_str()) : defaultvalue;
+	return attribute ? int(attribute->getLongValue()) : defaultvalue;
 }
 
 //______________________________________________________________________________
 float xmlelement::getAttributeFloatValue (const string& attrname, float defaultvalue) const
 {
 	Sxmlattribute attribute = getAttribute(attrname);
-	return attribute ? (float)atof(attribute->getValue().c_str()) : defaultvalue;
+	return attribute ? attribute->getFloatValue() : defaultvalue;
 }
 
-xmlelement::operator int () const	{ return atoi(fValue.c_str()); }
-xmlelement::operator long () const	{ return atol(fValue.c_str()); }
-xmlelement::operator float () const { return (float)atof(fValue.c_str()); }
+//______________________________________________________________________________
+// the interned names are compared by pointer
+xmlattribute* xmlelement::getAttribute (symbol attrname) const
+{
+	attributesList::const_iterator it;
+	for (it = attributes().begin(); it != attributes().end(); it++) {
+		if ((*it)->getNameSymbol() == attrname)
+			return *it;
+	}
+	return 0;
+}
+
+const string& xmlelement::getAttributeValue (symbol attrname) const
+{
+	const xmlattribute* attribute = getAttribute(attrname);
+	return attribute ? attribute->getValue() : *symbols::empty();
+}
+
+long xmlelement::getAttributeLongValue (symbol attrname, long defaultvalue) const
+{
+	const xmlattribute* attribute = getAttribute(attrname);
+	return attribute ? attribute->getLongValue() : defaultvalue;
+}
+
+int xmlelement::getAttributeIntValue (symbol attrname, int defaultvalue) const
+{
+	const xmlattribute* attribute = getAttribute(attrname);
+	return attribute ? int(attribute->getLongValue()) : defaultvalue;
+}
+
+float xmlelement::getAttributeFloatValue (symbol attrname, float defaultvalue) const
+{
+	const xmlattribute* attribute = getAttribute(attrname);
+	return attribute ? attribute->getFloatValue() : defaultvalue;
+}
 
 //______________________________________________________________________________
 bool xmlelement::operator ==(const xmlelement& elt) const
 {
 	if (getType() != elt.getType()) return false;
-	if (getName() != elt.getName()) return false;
+	if (fName != elt.fName) return false;
 	if (getValue()!= elt.getValue()) return false;
-	const vector<Sxmlattribute>& attr1 = attributes();
-	const vector<Sxmlattribute>& attr2 = elt.attributes();
+	const attributesList& attr1 = attributes();
+	const attributesList& attr2 = elt.attributes();
 	if (attr1.size() != attr2.size()) return false;
 
-	vector<Sxmlattribute>::const_iterator iter1 = attr1.begin();
-	vector<Sxmlattribute>::const_iterator iter2 = attr2.begin();
+	attributesList::const_iterator iter1 = attr1.begin();
+	attributesList::const_iterator iter2 = attr2.begin();
 	while (iter1 != attr1.end()) {
 		if (iter2 == attr2.end()) return false;
-		if ((*iter1)->getName() != (*iter2)->getName()) return false;
+		if ((*iter1)->getXmlName() != (*iter2)->getXmlName()) return false;
 		if ((*iter1)->getValue() != (*iter2)->getValue()) return false;
 		iter1++; iter2++;
 	}
@@ -220,4 +347,16 @@ float xmlelement::getFloatValue	(int subElementType, float defaultvalue)
 	return (iter != end()) ? float(*(*iter)) : defaultvalue;
 }
 
+double xmlelement::getDoubleValue (int subElementType, double defaultvalue)
+{
+	ctree<xmlelement>::iterator iter = find(subElementType);
+	return (iter != end()) ? (*iter)->getDoubleValue() : defaultvalue;
+}
+
+rational xmlelement::getRationalValue (int subElementType, const rational& defaultvalue)
+{
+	ctree<xmlelement>::iterator iter = find(subElementType);
+	return (iter != end()) ? (*iter)->getRationalValue() : defaultvalue;
+}
+
 }
@@ -13,6 +13,8 @@
 #ifndef __xml__
 #define __xml__
 
+#include <stdlib.h>
+#include <atomic>
 #include <string>
 #include <vector>
 
@@ -21,8 +23,12 @@
 #endif
 
 #include "exports.h"
+#include "arena.h"
 #include "ctree.h"
 #include "smartpointer.h"
+#include "symbols.h"
+
+class rational;
 
 namespace MusicXML2
 {
@@ -38,38 +44,155 @@ class xmlattribute;
 typedef SMARTP<xmlattribute> 	Sxmlattribute;
 typedef SMARTP<xmlelement> 		Sxmlelement;
 
+/*!
+\brief The numeric values of an attribute or element string value.
+
+	The values are computed from the string value on first use, and kept
+	until the string value is set again. Reading them is safe from several
+	threads: the first reader stores the values, the readers that find them
+	being stored use the values they computed themselves.
+\n	The rational value is not kept: integers come from the long value, the
+	other values are parsed again.
+*/
+//______________________________________________________________________________
+class EXP numericvalue {
+	enum { kUnparsed, kParsing, kParsed };
+
+	mutable std::atomic<unsigned char>	fState;
+	mutable long	fLong;
+	mutable double	fDouble;
+
+	bool	parsed () const		{ return fState.load (std::memory_order_acquire) == kParsed; }
+	void	compute (const std::string& value, long& l, double& d) const;
+
+	public:
+				numericvalue() : fState(kUnparsed), fLong(0), fDouble(0) {}
+				numericvalue(const numericvalue& v) : fState(v.parsed() ? kParsed : kUnparsed), fLong(v.fLong), fDouble(v.fDouble) {}
+
+		//! the string value has been set
+		void	reset ()			{ fState.store (kUnparsed, std::memory_order_relaxed); }
+		//! the string value has been set from an integer
+		void	set (long value)	{ fLong = value; fDouble = double(value); fState.store (kParsed, std::memory_order_release); }
+
+		//! the values of the string value, as given by atol and atof
+		long		getLong (const std::string& value) const	{ if (parsed()) return fLong; long l; double d; compute (value, l, d); return l; }
+		double		getDouble (const std::string& value) const	{ if (parsed()) return fDouble; long l; double d; compute (value, l, d); return d; }
+		//! the value of a fraction (e.g. 3/4) or of a decimal number
+		rational	getRational (const std::string& value) const;
+};
+
+/*!
+\brief An element or attribute name.
+
+	The names of the MusicXML vocabulary are symbols (see symbols), the
+	other names, which may come from any document, are copied in a string
+	owned by the name. Thus the symbols table never grows.
+	getSymbol() gives either a symbol or the owned string.
+*/
+//______________________________________________________________________________
+class EXP xmlname {
+	symbol			fName;		// a symbol or fOwn
+	std::string*	fOwn;		// a name out of the vocabulary
+
+	void	own (const std::string& name);
+
+	// names are not copied
+			xmlname (const xmlname&);
+	xmlname& operator= (const xmlname&);
+
+	public:
+				 xmlname() : fName(symbols::empty()), fOwn(0) {}
+				~xmlname()		{ delete fOwn; }
+
+		void	set (const char* name);
+		void	set (const std::string& name);
+		//! sets the name from a symbol, or from another name getSymbol()
+		void	set (symbol name)	{ if (symbols::known (name)) { delete fOwn; fOwn = 0; fName = name; } else own (*name); }
+
+		const std::string&	get () const			{ return *fName; }
+		symbol				getSymbol () const		{ return fName; }
+
+		//! names out of the vocabulary are compared as strings
+		bool	operator == (const xmlname& n) const	{ return (fName == n.fName) || (fOwn && n.fOwn && (*fOwn == *n.fOwn)); }
+		bool	operator != (const xmlname& n) const	{ return !(*this == n); }
+};
+
 /*!
 \brief A generic xml attribute representation.
 
 	An attribute is represented by its name and its value.
+	The attribute name is an interned string when it belongs to the MusicXML vocabulary.
 */
 //______________________________________________________________________________
-class EXP xmlattribute : public smartable {
+class EXP xmlattribute : public smartable, public arenaobject {
 	//! the attribute name
-	std::string	fName;
+	xmlname		fName;
 	//! the attribute value
 	std::string 	fValue;
+	//! the attribute numeric values
+	numericvalue	fNumeric;
+
     protected:
 		xmlattribute() {}
 		virtual ~xmlattribute() {}
     public:
 		static SMARTP<xmlattribute> create();
 
-		void setName (const std::string& name);
+		void setName (const std::string& name)	{ fName.set (name); }
+		void setName (const char* name)			{ fName.set (name); }
+		void setName (symbol name)				{ fName.set (name); }
 		void setValue (const std::string& value);
 		void setValue (long value);
 		void setValue (int value);
 		void setValue (float value);
 
-		const std::string& getName () const		{ return fName; }
+		const std::string& getName () const		{ return fName.get(); }
+		symbol			getNameSymbol () const	{ return fName.getSymbol(); }
+		const xmlname&	getXmlName () const		{ return fName; }
 		//! returns the attribute value as a string
 		const std::string& getValue () const	{ return fValue; }
 		//! returns the attribute value as a int
-		operator int () const;
+		operator int () const					{ return int(getLongValue()); }
 		//! returns the attribute value as a long
-		operator long () const;
+		operator long () const					{ return getLongValue(); }
 		//! returns the attribute value as a float
-		operator float () const;
+		operator float () const					{ return getFloatValue(); }
+
+		long		getLongValue () const			{ return fNumeric.getLong (fValue); }
+		float		getFloatValue () const			{ return float(fNumeric.getDouble (fValue)); }
+		double		getDoubleValue () const			{ return fNumeric.getDouble (fValue); }
+		rational	getRationalValue () const;
+};
+
+/*!
+\brief The interned names of the most used attributes.
+
+	The xmlelement attributes getters taking a symbol compare the names
+	by pointer and return the string values by reference.
+*/
+//______________________________________________________________________________
+class EXP attributeNames {
+	public:
+		static const symbol coda;
+		static const symbol dacapo;
+		static const symbol dalsegno;
+		static const symbol default_x;
+		static const symbol default_y;
+		static const symbol direction;
+		static const symbol dynamics;
+		static const symbol fine;
+		static const symbol id;
+		static const symbol number;
+		static const symbol placement;
+		static const symbol print_object;
+		static const symbol relative_x;
+		static const symbol relative_y;
+		static const symbol segno;
+		static const symbol size;
+		static const symbol tempo;
+		static const symbol times;
+		static const symbol tocoda;
+		static const symbol type;
 };
 
 
@@ -79,16 +202,20 @@ class EXP xmlattribute : public smartable {
 	An element is represented by its name, its value,
 	the lists of its attributes and its enclosed elements.
 	Attributes and elements must be added in the required
-	order.
+	order. The element name is an interned string when it belongs to the
+	MusicXML vocabulary, which is always the case for the elements created
+	by the factory.
 */
 //______________________________________________________________________________
-class EXP xmlelement : public ctree<xmlelement>, public visitable
+class EXP xmlelement : public ctree<xmlelement>, public visitable, public arenaobject
 {
 	private:
 		//! the element name
-		std::string fName;
+		xmlname		fName;
 		//! the element value
 		std::string fValue;
+		//! the element numeric values
+		numericvalue fNumeric;
 		//! list of the element attributes
 		std::vector<Sxmlattribute> fAttributes;
 
@@ -103,6 +230,7 @@ class EXP xmlelement : public ctree<xmlelement>, public visitable
 
 	public:
 		typedef ctree<xmlelement>::iterator     iterator;
+		typedef std::vector<Sxmlattribute>  attributesList;	///< the attributes container type
 
 		static SMARTP<xmlelement> create (int inputLineNumber);
 
@@ -110,26 +238,33 @@ class EXP xmlelement : public ctree<xmlelement>, public visitable
 		virtual void acceptOut (basevisitor& visitor);
 
 		int getInputLineNumber () { return fInputLineNumber; }
+		void setInputLineNumber (int inputLineNumber)	{ fInputLineNumber = inputLineNumber; }
 
 		void setValue (unsigned long value);
 		void setValue (long value);
 		void setValue (int value);
 		void setValue (float value);
 		void setValue (const std::string& value);
-		void setName  (const std::string& name);
+		void setName  (const std::string& name)	{ fName.set (name); }
+		void setName  (symbol name)				{ fName.set (name); }
 
 		int                 getType () const    { return fType; }
-		const std::string&  getName () const    { return fName; }
+		const std::string&  getName () const    { return fName.get(); }
+		symbol              getNameSymbol () const	{ return fName.getSymbol(); }
 
 		//! returns the element value as a string
 		const std::string& getValue () const    { return fValue; }
 
 		//! returns the element value as a long
-		operator long () const;
+		operator long () const					{ return fNumeric.getLong (fValue); }
 		//! returns the element value as a int
-		operator int () const;
+		operator int () const					{ return int(fNumeric.getLong (fValue)); }
 		//! returns the element value as a float
-		operator float () const;
+		operator float () const					{ return float(fNumeric.getDouble (fValue)); }
+		//! returns the element value as a double
+		double   getDoubleValue () const		{ return fNumeric.getDouble (fValue); }
+		//! returns the element value as a rational
+		rational getRationalValue () const;
 		//! elements comparison
 		bool operator ==(const xmlelement& elt) const;
 		bool operator !=(const xmlelement& elt) const { return !(*this == elt); }
@@ -138,13 +273,21 @@ class EXP xmlelement : public ctree<xmlelement>, public visitable
 		long add (const Sxmlattribute& attr);
 
 		// getting information about attributes
-		const std::vector<Sxmlattribute>& attributes() const { return fAttributes; }
+		const attributesList& attributes() const { return fAttributes; }
 		const Sxmlattribute getAttribute      (const std::string& attrname) const;
 		const std::string   getAttributeValue   (const std::string& attrname) const;
 		long                getAttributeLongValue (const std::string& attrname, long defaultvalue) const;
 		int                 getAttributeIntValue  (const std::string& attrname, int defaultvalue) const;
 		float               getAttributeFloatValue  (const std::string& attrname, float defaultvalue) const;
 
+		// the same using the attribute interned name (see attributeNames), the values are not copied
+		// the names out of the MusicXML vocabulary are not found this way
+		xmlattribute*       getAttribute      (symbol attrname) const;
+		const std::string&  getAttributeValue   (symbol attrname) const;
+		long                getAttributeLongValue (symbol attrname, long defaultvalue) const;
+		int                 getAttributeIntValue  (symbol attrname, int defaultvalue) const;
+		float               getAttributeFloatValue  (symbol attrname, float defaultvalue) const;
+
 		// finding sub elements by type
 		ctree<xmlelement>::iterator     find(int type);
 		ctree<xmlelement>::iterator     find(int type, ctree<xmlelement>::iterator start);
@@ -154,6 +297,8 @@ class EXP xmlelement : public ctree<xmlelement>, public visitable
 		int               getIntValue   (int subElementType, int defaultvalue);
 		long              getLongValue  (int subElementType, long defaultvalue);
 		float             getFloatValue (int subElementType, float defaultvalue);
+		double            getDoubleValue (int subElementType, double defaultvalue);
+		rational          getRationalValue (int subElementType, const rational& defaultvalue);
 
 		// misc
 		bool empty () const	{ return fValue.empty() && elements().empty(); }
@@ -339,7 +339,7 @@ void musicxmlfactory::sort()
 //------------------------------------------------------------------------
 Sxmlelement	musicxmlfactory::getSubElement (Sxmlelement elt, int type) const
 {
-	vector<Sxmlelement>&  subelts = elt->elements();
+	ctree<xmlelement>::branchs&  subelts = elt->elements();
 	for (unsigned int i=0; i < subelts.size(); i++) {
 		if (subelts[i]->getType() == type)
 			return subelts[i];
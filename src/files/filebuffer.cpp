@@ -0,0 +1,108 @@
+/*
+  MusicXML Library
+  Copyright (C) Grame 2006-2013
+
+  This Source Code Form is subject to the terms of the Mozilla Public
+  License, v. 2.0. If a copy of the MPL was not distributed with this
+  file, You can obtain one at http://mozilla.org/MPL/2.0/.
+
+  Grame Research Laboratory, 11, cours de Verdun Gensoul 69002 Lyon - France
+  research@grame.fr
+*/
+
+#include <stdio.h>
+#include <stdlib.h>
+
+#ifndef WIN32
+#include <fcntl.h>
+#include <unistd.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#endif
+
+#include "filebuffer.h"
+
+namespace MusicXML2
+{
+
+//______________________________________________________________________________
+#ifndef WIN32
+// maps the file followed by at least two null bytes:
+// an anonymous mapping is first reserved for the whole buffer, next the file
+// is mapped over it. The end of the last file page is zero filled and the
+// remaining pages are anonymous zero pages.
+static char* mapfile (const char* file, size_t& size, size_t& mapped)
+{
+	int fd = ::open (file, O_RDONLY);
+	if (fd < 0) return 0;
+
+	char* data = 0;
+	struct stat st;
+	if ((fstat (fd, &st) == 0) && S_ISREG(st.st_mode) && (st.st_size > 0)) {
+		size = size_t(st.st_size);
+		size_t page = size_t(sysconf(_SC_PAGESIZE));
+		mapped = ((size + 2 + page - 1) / page) * page;
+		void* area = mmap (0, mapped, PROT_READ | PROT_WRITE, MAP_PRIVATE | MAP_ANONYMOUS, -1, 0);
+		if (area != MAP_FAILED) {
+			if (mmap (area, size, PROT_READ | PROT_WRITE, MAP_PRIVATE | MAP_FIXED, fd, 0) != MAP_FAILED)
+				data = (char*)area;
+			else munmap (area, mapped);
+		}
+	}
+	::close (fd);
+	return data;
+}
+#endif
+
+//______________________________________________________________________________
+// reads the file at once
+static char* readfile (const char* file, size_t& size)
+{
+	FILE* fd = fopen (file, "rb");
+	if (!fd) return 0;
+
+	char* data = 0;
+	if ((fseek (fd, 0, SEEK_END) == 0)) {
+		long n = ftell (fd);
+		if ((n >= 0) && (fseek (fd, 0, SEEK_SET) == 0)) {
+			size = size_t(n);
+			data = (char*)malloc (size + 2);
+			if (data && (fread (data, 1, size, fd) == size)) {
+				data[size] = data[size+1] = 0;
+			}
+			else {
+				free (data);
+				data = 0;
+			}
+		}
+	}
+	fclose (fd);
+	return data;
+}
+
+//______________________________________________________________________________
+bool filebuffer::open (const char* file)
+{
+	close();
+#ifndef WIN32
+	fData = mapfile (file, fSize, fMapped);
+	if (fData) return true;
+	fMapped = 0;
+#endif
+	fData = readfile (file, fSize);
+	return fData != 0;
+}
+
+//______________________________________________________________________________
+void filebuffer::close ()
+{
+#ifndef WIN32
+	if (fMapped) munmap (fData, fMapped);
+	else
+#endif
+	free (fData);
+	fData = 0;
+	fSize = fMapped = 0;
+}
+
+}
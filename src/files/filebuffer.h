@@ -0,0 +1,55 @@
+/*
+  MusicXML Library
+  Copyright (C) Grame 2006-2013
+
+  This Source Code Form is subject to the terms of the Mozilla Public
+  License, v. 2.0. If a copy of the MPL was not distributed with this
+  file, You can obtain one at http://mozilla.org/MPL/2.0/.
+
+  Grame Research Laboratory, 11, cours de Verdun Gensoul 69002 Lyon - France
+  research@grame.fr
+*/
+
+#ifndef __filebuffer__
+#define __filebuffer__
+
+#include <cstddef>
+
+#include "exports.h"
+
+namespace MusicXML2
+{
+
+/*!
+\brief a file content available as a writable memory buffer
+
+	The file content is memory mapped when the platform supports it (private
+	copy on write mapping), otherwise it is read at once. In both cases, the
+	buffer is terminated by two null bytes that are not part of the file size,
+	as expected by the xml lexer.
+*/
+//______________________________________________________________________________
+class EXP filebuffer
+{
+	char*	fData;
+	size_t	fSize;
+	size_t	fMapped;		// the mapping size, 0 when the buffer is allocated
+
+	public:
+				 filebuffer() : fData(0), fSize(0), fMapped(0) {}
+		virtual ~filebuffer()	{ close(); }
+
+		//! maps or reads a file, returns false when the file can't be read
+		bool	open (const char* file);
+		//! releases the file content
+		void	close ();
+
+		//! the file content, followed by two null bytes
+		char*	data () const	{ return fData; }
+		//! the file size
+		size_t	size () const	{ return fSize; }
+};
+
+}
+
+#endif
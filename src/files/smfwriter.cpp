@@ -0,0 +1,334 @@
+/*
+  MusicXML Library
+  Copyright (C) Grame 2006-2013
+
+  This Source Code Form is subject to the terms of the Mozilla Public
+  License, v. 2.0. If a copy of the MPL was not distributed with this
+  file, You can obtain one at http://mozilla.org/MPL/2.0/.
+
+  Grame Research Laboratory, 11, cours de Verdun Gensoul 69002 Lyon - France
+  research@grame.fr
+*/
+
+#ifdef MSVC
+# pragma warning (disable : 4786)
+#endif
+
+#include <math.h>
+#include <string.h>
+#include <algorithm>
+
+#include "smfwriter.h"
+#include "unrolled_xml_tree_browser.h"
+
+using namespace std;
+
+namespace MusicXML2
+{
+
+//______________________________________________________________________________
+static bool earlier (const smfwriter::event& e1, const smfwriter::event& e2)	{ return e1.fDate < e2.fDate; }
+
+static inline int clip (int value, int min, int max)	{ return (value < min) ? min : (value > max) ? max : value; }
+
+static void bigEndian (unsigned long value, int bytes, char* out)
+{
+	for (int i = bytes - 1; i >= 0; i--) {
+		out[i] = char(value & 0xff);
+		value >>= 8;
+	}
+}
+
+//______________________________________________________________________________
+smfwriter::smfwriter (long tpq, size_t spoolSize)
+	: fTPQ(tpq), fOut(0), fSpool(0), fSpoolSize(spoolSize), fFailed(false), fTracks(0),
+	  fSorted(true), fOrder(0), fTrackDate(0), fStatus(0), fChan(0), fNamed(false), fEndDate(0)
+{
+}
+
+smfwriter::~smfwriter()		{ if (fOut) close(); }
+
+//______________________________________________________________________________
+bool smfwriter::open (const char* file)
+{
+	if (fOut) close();
+	fOut = fopen (file, "wb");
+	if (!fOut) return false;
+	fParts.clear();
+	fFailed = false;
+	fTracks = 0;
+	fTempo.clear();
+	fEndDate = 0;
+	return true;
+}
+
+//______________________________________________________________________________
+bool smfwriter::writeHeader (int tracks)
+{
+	char header[14] = { 'M', 'T', 'h', 'd', 0, 0, 0, 6, 0, 1 };
+	bigEndian (tracks, 2, &header[10]);
+	bigEndian (fTPQ, 2, &header[12]);
+	return fwrite (header, 1, sizeof(header), fOut) == sizeof(header);
+}
+
+//______________________________________________________________________________
+bool smfwriter::close ()
+{
+	if (!fOut) return false;
+
+	// the conductor track: tempo changes coming from several parts are merged
+	fTrack.clear();
+	fTrackDate = 0;
+	fStatus = 0;
+	stable_sort (fTempo.begin(), fTempo.end(), earlier);
+	const event* last = 0;
+	for (vector<event>::const_iterator i = fTempo.begin(); i != fTempo.end(); i++) {
+		if (last && equal (i->fData, i->fData + 3, last->fData)) continue;
+		delta (i->fDate);
+		meta (0x51, string((const char*)i->fData, 3));
+		last = &(*i);
+	}
+	endOfTrack (fEndDate);
+
+	if (!writeHeader (fTracks + 1)) fFailed = true;
+	writeTrack (fOut, fTrack);
+
+	// next the parts tracks are copied from the spool, if any, and from memory
+	if (fSpool) {
+		if (fflush (fSpool) || fseek (fSpool, 0, SEEK_SET)) fFailed = true;
+		char buffer[64*1024];
+		size_t n;
+		while (!fFailed && ((n = fread (buffer, 1, sizeof(buffer), fSpool)) > 0)) {
+			if (fwrite (buffer, 1, n, fOut) != n) fFailed = true;
+		}
+		if (ferror (fSpool)) fFailed = true;
+		fclose (fSpool);
+		fSpool = 0;
+	}
+	if (fwrite (fParts.data(), 1, fParts.size(), fOut) != fParts.size()) fFailed = true;
+	if (fclose (fOut)) fFailed = true;
+	fOut = 0;
+	fParts.clear();
+	return !fFailed;
+}
+
+//______________________________________________________________________________
+// encoding
+//______________________________________________________________________________
+// the Standard MIDI File quantities are at most 4 bytes long: the larger values,
+// i.e. the delta times over 0x0FFFFFFF ticks, are clamped to the largest one
+void smfwriter::vlq (unsigned long value)
+{
+	if (value > 0x0FFFFFFF) value = 0x0FFFFFFF;
+	char bytes[4];
+	int i = sizeof(bytes) - 1;
+	bytes[i] = char(value & 0x7f);
+	while (value >>= 7)
+		bytes[--i] = char((value & 0x7f) | 0x80);
+	fTrack.append (&bytes[i], sizeof(bytes) - i);
+}
+
+void smfwriter::delta (long date)
+{
+	if (date < fTrackDate) date = fTrackDate;
+	vlq (date - fTrackDate);
+	fTrackDate = date;
+}
+
+//______________________________________________________________________________
+// channel events use the running status
+void smfwriter::encode (const event& e)
+{
+	delta (e.fDate);
+	int i = 0;
+	if (e.fData[0] == fStatus) i++;
+	else fStatus = e.fData[0];
+	fTrack.append ((const char*)&e.fData[i], e.fSize - i);
+}
+
+//______________________________________________________________________________
+// meta events cancel the running status
+void smfwriter::meta (int type, const string& data)
+{
+	fTrack += char(0xff);
+	fTrack += char(type);
+	vlq (data.size());
+	fTrack += data;
+	fStatus = 0;
+}
+
+void smfwriter::endOfTrack (long date)
+{
+	delta (date);
+	meta (0x2f, "");
+}
+
+//______________________________________________________________________________
+static void trackHeader (size_t size, char* header)
+{
+	memcpy (header, "MTrk", 4);
+	bigEndian (size, 4, &header[4]);
+}
+
+void smfwriter::writeTrack (FILE* out, const string& track)
+{
+	char header[8];
+	trackHeader (track.size(), header);
+	if ((fwrite (header, 1, sizeof(header), out) != sizeof(header))
+		|| (fwrite (track.data(), 1, track.size(), out) != track.size()))
+		fFailed = true;
+}
+
+//______________________________________________________________________________
+// the parts tracks are kept in memory up to the spool size, next they go to disk
+void smfwriter::spool ()
+{
+	char header[8];
+	trackHeader (fTrack.size(), header);
+	fParts.append (header, sizeof(header));
+	fParts += fTrack;
+	if (fParts.size() < fSpoolSize) return;
+
+	if (!fSpool) fSpool = tmpfile();
+	if (!fSpool || (fwrite (fParts.data(), 1, fParts.size(), fSpool) != fParts.size()))
+		fFailed = true;
+	fParts.clear();
+}
+
+//______________________________________________________________________________
+// events collection
+//______________________________________________________________________________
+int smfwriter::channel (int chan) const	{ return ((chan >= 1) && (chan <= 16)) ? chan - 1 : fChan; }
+
+void smfwriter::add (long date, int chan, int status, int data1, int data2)
+{
+	event e;
+	e.fDate = max (date, 0L);
+	e.fOrder = fOrder++;
+	e.fData[0] = (unsigned char)(status | channel(chan));
+	e.fData[1] = (unsigned char)clip (data1, 0, 127);
+	e.fData[2] = (unsigned char)clip (data2, 0, 127);
+	e.fSize = (status == 0xc0) ? 2 : 3;
+	if (!fEvents.empty() && (e.fDate < fEvents.back().fDate)) fSorted = false;
+	fEvents.push_back (e);
+}
+
+//______________________________________________________________________________
+void smfwriter::startPart (int instrCount)
+{
+	fTrack.clear();
+	fEvents.clear();
+	fSorted = true;
+	fOrder = 0;
+	fTrackDate = 0;
+	fStatus = 0;
+	fNamed = false;
+	// the default channel is the part index, skipping the percussion channel
+	fChan = fTracks % 15;
+	if (fChan >= 9) fChan++;
+}
+
+//______________________________________________________________________________
+// the instruments names are written at the beginning of the track
+void smfwriter::newInstrument (string instrName, int chan)
+{
+	if (!fNamed) {
+		vlq (0);
+		meta (0x03, instrName);
+		fNamed = true;
+		if ((chan >= 1) && (chan <= 16)) fChan = chan - 1;
+	}
+	vlq (0);
+	meta (0x04, instrName);
+}
+
+//______________________________________________________________________________
+void smfwriter::endPart (long date)
+{
+	if (!fSorted) stable_sort (fEvents.begin(), fEvents.end(), earlier);
+	for (vector<event>::const_iterator i = fEvents.begin(); i != fEvents.end(); i++) {
+		while (!fOffs.empty() && (fOffs.top().fDate <= i->fDate)) {
+			encode (fOffs.top());
+			fOffs.pop();
+		}
+		encode (*i);
+	}
+	while (!fOffs.empty()) {
+		encode (fOffs.top());
+		fOffs.pop();
+	}
+	endOfTrack (date);
+
+	if (fOut) spool();
+	fEndDate = max (fEndDate, fTrackDate);
+	fTracks++;
+}
+
+//______________________________________________________________________________
+void smfwriter::newNote (long date, int chan, float pitch, int velocity, int duration)
+{
+	int key = int(floor (pitch + 0.5f));
+	if ((duration <= 0) || (key < 0) || (key > 127)) return;
+	add (date, chan, 0x90, key, clip (velocity, 1, 127));
+
+	// notes off are notes on with a null velocity: they take advantage of the running status
+	event off = fEvents.back();
+	off.fDate += duration;
+	off.fOrder = fOrder++;
+	off.fData[2] = 0;
+	fOffs.push (off);
+}
+
+//______________________________________________________________________________
+void smfwriter::tempoChange (long date, int bpm)
+{
+	if (bpm <= 0) return;
+	event e;
+	e.fDate = max (date, 0L);
+	e.fOrder = fTempo.size();
+	bigEndian (60000000 / bpm, 3, (char*)e.fData);
+	e.fSize = 3;
+	fTempo.push_back (e);
+}
+
+//______________________________________________________________________________
+void smfwriter::pedalChange (long date, pedalType t, int value)
+{
+	int control;
+	switch (t) {
+		case kDamperPedal:		control = 64; break;
+		case kSoftpedal:		control = 67; break;
+		case kSostenutoPedal:	control = 66; break;
+		default: return;
+	}
+	controlChange (date, -1, control, clip (value, 0, 127));
+}
+
+//______________________________________________________________________________
+// volume is a percentage
+void smfwriter::volChange (long date, int chan, int vol)		{ controlChange (date, chan, 7, clip(vol, 0, 100) * 127 / 100); }
+// MusicXML programs are numbered from 1 to 128
+void smfwriter::progChange (long date, int chan, int prog)		{ add (date, chan, 0xc0, clip (prog - 1, 0, 127), 0); }
+
+//______________________________________________________________________________
+// MusicXML banks are numbered from 1 to 16384
+void smfwriter::bankChange (long date, int chan, int bank)
+{
+	bank = clip (bank - 1, 0, 16383);
+	controlChange (date, chan, 0, bank >> 7);
+	controlChange (date, chan, 32, bank & 0x7f);
+}
+
+//______________________________________________________________________________
+bool smfwriter::write (const Sxmlelement& score, const char* file, long tpq, playbackplans* plans)
+{
+	if (!score) return false;
+	smfwriter writer (tpq);
+	if (!writer.open (file)) return false;
+	midicontextvisitor v (tpq, &writer);
+	unrolled_xml_tree_browser browser (&v, plans);
+	browser.browse (*score);
+	return writer.close();
+}
+
+}
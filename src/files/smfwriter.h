@@ -0,0 +1,136 @@
+/*
+  MusicXML Library
+  Copyright (C) Grame 2006-2013
+
+  This Source Code Form is subject to the terms of the Mozilla Public
+  License, v. 2.0. If a copy of the MPL was not distributed with this
+  file, You can obtain one at http://mozilla.org/MPL/2.0/.
+
+  Grame Research Laboratory, 11, cours de Verdun Gensoul 69002 Lyon - France
+  research@grame.fr
+*/
+
+#ifndef __smfwriter__
+#define __smfwriter__
+
+#include <stdio.h>
+#include <queue>
+#include <string>
+#include <vector>
+
+#include "exports.h"
+#include "midicontextvisitor.h"
+#include "playbackplan.h"
+#include "xml.h"
+
+namespace MusicXML2
+{
+
+/*!
+\brief a Standard MIDI File writer
+
+	Writes a format 1 Standard MIDI File from the midicontextvisitor calls:
+	the first track is the conductor track (the tempo changes), next there is
+	one track per part.
+\n	Parts are visited one after the other: the events of the current part
+	are collected, then encoded with their delta times at the end of the
+	part into a byte buffer that is reused from one track to the other.
+	Since the conductor track is complete only when the writer is closed,
+	the parts tracks are kept in memory up to the spool size, and next
+	written to a temporary file as soon as they are encoded.
+\n	Notes on events are sorted only when a part goes back in time (backup
+	elements) and notes off are kept in a heap, thus notes off and notes on
+	are merged while encoding. At the same date, notes off come first.
+\n	MusicXML values are converted to MIDI values: midi-channel, midi-bank and
+	midi-program are 1 based, volume is a percentage. Notes without channel
+	are sent to the part default channel, which is the part index, skipping
+	the percussion channel.
+*/
+//______________________________________________________________________________
+class EXP smfwriter : public midiwriter
+{
+	public:
+		typedef struct {
+			long			fDate;
+			unsigned long	fOrder;		// the event arrival order, for events at the same date
+			unsigned char	fData[3];
+			unsigned char	fSize;
+		} event;
+
+	private:
+		struct later {
+			bool operator() (const event& e1, const event& e2) const
+				{ return (e1.fDate > e2.fDate) || ((e1.fDate == e2.fDate) && (e1.fOrder > e2.fOrder)); }
+		};
+		typedef std::priority_queue<event, std::vector<event>, later>	offsHeap;
+
+		long				fTPQ;
+		FILE*				fOut;
+		FILE*				fSpool;			// the parts tracks, until the conductor track is known
+		size_t				fSpoolSize;
+		std::string			fParts;			// the parts tracks not yet in the spool
+		bool				fFailed;
+		int					fTracks;		// the count of parts tracks
+
+		std::string			fTrack;			// the current track data
+		std::vector<event>	fEvents;		// the current part events, except notes off
+		offsHeap			fOffs;			// the current part notes off
+		bool				fSorted;		// true while fEvents dates are not decreasing
+		unsigned long		fOrder;
+		long				fTrackDate;		// the date of the last event encoded in fTrack
+		unsigned char		fStatus;		// the running status of the current track
+		int					fChan;			// the current part default channel (0 based)
+		bool				fNamed;			// the current track has a name
+
+		std::vector<event>	fTempo;			// the conductor track events
+		long				fEndDate;		// the conductor track end date
+
+		void	add (long date, int chan, int status, int data1, int data2);
+		void	controlChange (long date, int chan, int control, int value)		{ add (date, chan, 0xb0, control, value); }
+		int		channel (int chan) const;
+
+		void	vlq (unsigned long value);
+		void	delta (long date);
+		void	encode (const event& e);
+		void	meta (int type, const std::string& data);
+		void	endOfTrack (long date);
+		void	writeTrack (FILE* out, const std::string& track);
+		void	spool ();
+		bool	writeHeader (int tracks);
+
+	public:
+				 smfwriter (long tpq = 480, size_t spoolSize = 1024*1024);
+		virtual ~smfwriter();
+
+		//! opens the output file, returns false when it can't be opened
+		bool	open (const char* file);
+		//! writes the conductor track and the parts tracks to the output file and closes it, returns false on output error
+		bool	close ();
+
+		//! the ticks per quarter note: it should be the midicontextvisitor one
+		long	tpq () const		{ return fTPQ; }
+
+		virtual void startPart (int instrCount);
+		virtual void newInstrument (std::string instrName, int chan=-1);
+		virtual void endPart (long date);
+
+		virtual void newNote (long date, int chan, float pitch, int velocity, int duration);
+		virtual void tempoChange (long date, int bpm);
+		virtual void pedalChange (long date, pedalType t, int value);
+
+		virtual void volChange (long date, int chan, int vol);
+		virtual void bankChange (long date, int chan, int bank);
+		virtual void progChange (long date, int chan, int prog);
+
+		/*! \brief converts a score to a Standard MIDI File
+
+			The score is browsed using an unrolled_xml_tree_browser: repeats and jumps are expanded.
+			\param plans an optional playback plans cache, to be reused when the score is written again
+			\return false when the file can't be written
+		*/
+		static bool write (const Sxmlelement& score, const char* file, long tpq = 480, playbackplans* plans = 0);
+};
+
+}
+
+#endif
@@ -0,0 +1,440 @@
+/*
+  MusicXML Library
+  Copyright (C) Grame 2006-2013
+
+  This Source Code Form is subject to the terms of the Mozilla Public
+  License, v. 2.0. If a copy of the MPL was not distributed with this
+  file, You can obtain one at http://mozilla.org/MPL/2.0/.
+
+  Grame Research Laboratory, 11, cours de Verdun Gensoul 69002 Lyon - France
+  research@grame.fr
+*/
+
+#ifdef MSVC
+# pragma warning (disable : 4786)
+#endif
+
+#include <stdio.h>
+#include <string.h>
+#include <deque>
+#include <iostream>
+#include <map>
+#include <mutex>
+#include <sstream>
+#include <thread>
+#include <vector>
+
+#ifdef WIN32
+#include <direct.h>
+#include <process.h>
+#else
+#include <unistd.h>
+#include <sys/stat.h>
+#include <sys/types.h>
+#endif
+
+#include "xmlcache.h"
+#include "elements.h"
+#include "factory.h"
+#include "filebuffer.h"
+#include "xmlreader.h"
+
+using namespace std;
+
+namespace MusicXML2
+{
+
+/*
+	The cache format, all the numbers are 32 bits little endian unsigned integers
+	and the strings are made of their size followed by their bytes:
+
+	header:		"MXC1" types-signature
+	names:		count name*						the attributes names
+	xml decl:	flag [version encoding standalone]
+	doctype:	flag [start public publit syslit]
+	tree:		flag [element]
+	element:	type line value attributes-count (name-index value)* children-count element*
+*/
+static const char		kMagic[4]		= { 'M', 'X', 'C', '1' };
+static const unsigned	kMaxDepth		= 1000;
+
+//______________________________________________________________________________
+// a signature of the elements types: the entries of another library version are invalid
+static unsigned typesSignature ()
+{
+	static const unsigned signature = [] () {
+		unsigned h = 2166136261u;
+		for (int type = 0; type < kEndElement; type++) {
+			const string& name = *factory::instance().name (type);
+			for (size_t i = 0; i <= name.size(); i++) {		// includes the terminating null
+				h ^= (unsigned char)name.c_str()[i];
+				h *= 16777619u;
+			}
+		}
+		return h;
+	} ();
+	return signature;
+}
+
+//______________________________________________________________________________
+class cachewriter
+{
+	string					fData;
+	map<symbol, unsigned>	fIndexes;
+
+	public:
+		vector<symbol>		fNames;
+
+		void u32 (unsigned n) {
+			char bytes[4] = { char(n & 0xff), char((n >> 8) & 0xff), char((n >> 16) & 0xff), char((n >> 24) & 0xff) };
+			fData.append (bytes, 4);
+		}
+		void str (const string& s)		{ u32 (unsigned(s.size())); fData.append (s); }
+		void raw (const char* s, size_t n)	{ fData.append (s, n); }
+
+		unsigned nameIndex (symbol name) {
+			map<symbol, unsigned>::const_iterator i = fIndexes.find (name);
+			if (i != fIndexes.end()) return i->second;
+			unsigned index = unsigned(fNames.size());
+			fIndexes[name] = index;
+			fNames.push_back (name);
+			return index;
+		}
+
+		void element (const Sxmlelement& elt) {
+			u32 (unsigned(elt->getType()));
+			u32 (unsigned(elt->getInputLineNumber()));
+			str (elt->getValue());
+			const xmlelement::attributesList& attributes = elt->attributes();
+			u32 (unsigned(attributes.size()));
+			for (xmlelement::attributesList::const_iterator i = attributes.begin(); i != attributes.end(); i++) {
+				u32 (nameIndex ((*i)->getNameSymbol()));
+				str ((*i)->getValue());
+			}
+			u32 (unsigned(elt->elements().size()));
+			for (ctree<xmlelement>::literator i = elt->lbegin(); i != elt->lend(); i++)
+				element (*i);
+		}
+
+		const string& data () const		{ return fData; }
+};
+
+//______________________________________________________________________________
+// all the reads are bounds checked: an invalid entry is detected, not trusted
+class cachereader
+{
+	const unsigned char*	fPtr;
+	const unsigned char*	fEnd;
+
+	public:
+		vector<symbol>	fNames;
+		deque<string>	fOwnNames;	// the names out of the symbols vocabulary
+		string			fValue;		// reused for the values to save allocations
+
+				cachereader (const char* data, size_t size)
+					: fPtr((const unsigned char*)data), fEnd((const unsigned char*)data + size) {}
+
+		bool u32 (unsigned& n) {
+			if (fEnd - fPtr < 4) return false;
+			n = fPtr[0] | (fPtr[1] << 8) | (fPtr[2] << 16) | (unsigned(fPtr[3]) << 24);
+			fPtr += 4;
+			return true;
+		}
+		bool str (string& s) {
+			unsigned n;
+			if (!u32 (n) || (unsigned(fEnd - fPtr) < n)) return false;
+			s.assign ((const char*)fPtr, n);
+			fPtr += n;
+			return true;
+		}
+		bool magic () {
+			if ((fEnd - fPtr < 4) || memcmp (fPtr, kMagic, 4)) return false;
+			fPtr += 4;
+			return true;
+		}
+		bool atEnd () const		{ return fPtr == fEnd; }
+
+		Sxmlelement element (unsigned depth) {
+			unsigned type, line, count;
+			if ((depth > kMaxDepth) || !u32 (type) || !u32 (line) || (type == unsigned(kNoElement)) || (type >= unsigned(kEndElement)))
+				return 0;
+			Sxmlelement elt = factory::instance().create (int(type));
+			if (!elt || !str (fValue)) return 0;
+			elt->setInputLineNumber (int(line));
+			elt->setValue (fValue);
+
+			if (!u32 (count)) return 0;
+			for (unsigned i = 0; i < count; i++) {
+				unsigned index;
+				if (!u32 (index) || (index >= fNames.size()) || !str (fValue)) return 0;
+				Sxmlattribute attr = xmlattribute::create();
+				attr->setName (fNames[index]);
+				attr->setValue (fValue);
+				elt->add (attr);
+			}
+
+			if (!u32 (count)) return 0;
+			if (count > unsigned(fEnd - fPtr)) return 0;	// an element takes more than a byte
+			elt->elements().reserve (count);
+			for (unsigned i = 0; i < count; i++) {
+				Sxmlelement sub = element (depth + 1);
+				if (!sub) return 0;
+				elt->push (sub);
+			}
+			return elt;
+		}
+};
+
+//______________________________________________________________________________
+bool xmlcache::save (const SXMLFile& xmlfile, const string& path)
+{
+	cachewriter tree;
+	Sxmlelement root = xmlfile->elements();
+	tree.u32 (root ? 1 : 0);
+	if (root) tree.element (root);
+
+	cachewriter w;
+	w.raw (kMagic, 4);
+	w.u32 (typesSignature());
+	w.u32 (unsigned(tree.fNames.size()));
+	for (vector<symbol>::const_iterator i = tree.fNames.begin(); i != tree.fNames.end(); i++)
+		w.str (**i);
+
+	TXMLDecl* decl = xmlfile->getXMLDecl();
+	w.u32 (decl ? 1 : 0);
+	if (decl) {
+		w.str (decl->getVersion());
+		w.str (decl->getEncoding());
+		w.u32 (unsigned(decl->getStandalone()));
+	}
+	TDocType* doctype = xmlfile->getDocType();
+	w.u32 (doctype ? 1 : 0);
+	if (doctype) {
+		w.str (doctype->getStartElement());
+		w.u32 (doctype->getPublic() ? 1 : 0);
+		w.str (doctype->getPubLitteral());
+		w.str (doctype->getSysLitteral());
+	}
+	w.raw (tree.data().c_str(), tree.data().size());
+
+	// writes a temporary file, unique for the process and thread, and renames it
+	stringstream tmp;
+#ifdef WIN32
+	tmp << path << ".tmp" << _getpid();
+#else
+	tmp << path << ".tmp" << getpid();
+#endif
+	tmp << "-" << std::hash<std::thread::id>() (this_thread::get_id());
+	string tmpPath = tmp.str();
+
+	FILE* fd = fopen (tmpPath.c_str(), "wb");
+	if (!fd) return false;
+	bool written = fwrite (w.data().c_str(), 1, w.data().size(), fd) == w.data().size();
+	written = (fclose (fd) == 0) && written;
+	if (!written || rename (tmpPath.c_str(), path.c_str())) {
+		remove (tmpPath.c_str());
+		return false;
+	}
+	return true;
+}
+
+//______________________________________________________________________________
+SXMLFile xmlcache::load (const char* data, size_t size, bool useArena)
+{
+	cachereader r (data, size);
+	unsigned signature, count, flag;
+	if (!r.magic() || !r.u32 (signature) || (signature != typesSignature()) || !r.u32 (count))
+		return 0;
+	if (count > size) return 0;
+	string name;
+	r.fNames.reserve (count);
+	for (unsigned i = 0; i < count; i++) {
+		if (!r.str (name)) return 0;
+		symbol s = symbols::find (name);
+		if (!s) {
+			r.fOwnNames.push_back (name);
+			s = &r.fOwnNames.back();
+		}
+		r.fNames.push_back (s);
+	}
+
+	SXMLFile xmlfile = TXMLFile::create();
+	if (useArena) xmlfile->setArena (arena::create());
+	arena::scope scope (xmlfile->getArena());
+
+	if (!r.u32 (flag)) return 0;
+	if (flag) {
+		string version, encoding;
+		unsigned standalone;
+		if (!r.str (version) || !r.str (encoding) || !r.u32 (standalone)) return 0;
+		xmlfile->set (new TXMLDecl (version, encoding, int(standalone)));
+	}
+	if (!r.u32 (flag)) return 0;
+	if (flag) {
+		string start, publit, syslit;
+		unsigned pub;
+		if (!r.str (start) || !r.u32 (pub) || !r.str (publit) || !r.str (syslit)) return 0;
+		xmlfile->set (new TDocType (start, pub != 0, publit, syslit));
+	}
+	if (!r.u32 (flag)) return 0;
+	if (flag) {
+		Sxmlelement root = r.element (0);
+		if (!root) return 0;
+		xmlfile->set (root);
+	}
+	return r.atEnd() ? xmlfile : 0;
+}
+
+SXMLFile xmlcache::load (const string& path, bool useArena)
+{
+	filebuffer buffer;
+	if (!buffer.open (path.c_str())) return 0;
+	return load (buffer.data(), buffer.size(), useArena);
+}
+
+//______________________________________________________________________________
+string xmlcache::entry (const char* data, size_t size) const
+{
+	string path = fDirectory;
+	if (path.size() && (path[path.size()-1] != '/') && (path[path.size()-1] != '\\'))
+		path += '/';
+	return path + hash (data, size) + ".mxc";
+}
+
+SXMLFile xmlcache::read (const char* file)
+{
+	filebuffer buffer;
+	if (!buffer.open (file)) {
+		cerr << "can't open file " << file << endl;
+		return 0;
+	}
+
+	string path = entry (buffer.data(), buffer.size());
+	SXMLFile xmlfile = load (path, fUseArena);
+	if (xmlfile) return xmlfile;
+
+	// the buffer is parsed in place: the entry name has been computed before
+	xmlreader r;
+	r.useArena (fUseArena);
+	xmlfile = r.read (buffer.data(), buffer.size(), file);
+	if (xmlfile) {
+#ifdef WIN32
+		_mkdir (fDirectory.c_str());
+#else
+		mkdir (fDirectory.c_str(), 0777);
+#endif
+		save (xmlfile, path);
+	}
+	return xmlfile;
+}
+
+//______________________________________________________________________________
+static mutex	gDefaultDirectoryMutex;
+static string	gDefaultDirectory;
+
+void xmlcache::setDefaultDirectory (const string& directory)
+{
+	lock_guard<mutex> lock (gDefaultDirectoryMutex);
+	gDefaultDirectory = directory;
+}
+
+string xmlcache::defaultDirectory ()
+{
+	lock_guard<mutex> lock (gDefaultDirectoryMutex);
+	return gDefaultDirectory;
+}
+
+//______________________________________________________________________________
+// SHA-256 (FIPS 180-4)
+//______________________________________________________________________________
+class sha256
+{
+	unsigned		fH[8];
+	unsigned char	fBlock[64];
+	size_t			fUsed;
+	unsigned long long fLength;
+
+	static unsigned rotr (unsigned x, int n)	{ return ((x >> n) | (x << (32 - n))) & 0xffffffffu; }
+
+	void transform (const unsigned char* p) {
+		static const unsigned k[64] = {
+			0x428a2f98, 0x71374491, 0xb5c0fbcf, 0xe9b5dba5, 0x3956c25b, 0x59f111f1, 0x923f82a4, 0xab1c5ed5,
+			0xd807aa98, 0x12835b01, 0x243185be, 0x550c7dc3, 0x72be5d74, 0x80deb1fe, 0x9bdc06a7, 0xc19bf174,
+			0xe49b69c1, 0xefbe4786, 0x0fc19dc6, 0x240ca1cc, 0x2de92c6f, 0x4a7484aa, 0x5cb0a9dc, 0x76f988da,
+			0x983e5152, 0xa831c66d, 0xb00327c8, 0xbf597fc7, 0xc6e00bf3, 0xd5a79147, 0x06ca6351, 0x14292967,
+			0x27b70a85, 0x2e1b2138, 0x4d2c6dfc, 0x53380d13, 0x650a7354, 0x766a0abb, 0x81c2c92e, 0x92722c85,
+			0xa2bfe8a1, 0xa81a664b, 0xc24b8b70, 0xc76c51a3, 0xd192e819, 0xd6990624, 0xf40e3585, 0x106aa070,
+			0x19a4c116, 0x1e376c08, 0x2748774c, 0x34b0bcb5, 0x391c0cb3, 0x4ed8aa4a, 0x5b9cca4f, 0x682e6ff3,
+			0x748f82ee, 0x78a5636f, 0x84c87814, 0x8cc70208, 0x90befffa, 0xa4506ceb, 0xbef9a3f7, 0xc67178f2 };
+
+		unsigned w[64];
+		for (int i = 0; i < 16; i++)
+			w[i] = (unsigned(p[4*i]) << 24) | (p[4*i+1] << 16) | (p[4*i+2] << 8) | p[4*i+3];
+		for (int i = 16; i < 64; i++) {
+			unsigned s0 = rotr(w[i-15], 7) ^ rotr(w[i-15], 18) ^ (w[i-15] >> 3);
+			unsigned s1 = rotr(w[i-2], 17) ^ rotr(w[i-2], 19) ^ (w[i-2] >> 10);
+			w[i] = (w[i-16] + s0 + w[i-7] + s1) & 0xffffffffu;
+		}
+
+		unsigned a = fH[0], b = fH[1], c = fH[2], d = fH[3], e = fH[4], f = fH[5], g = fH[6], h = fH[7];
+		for (int i = 0; i < 64; i++) {
+			unsigned t1 = (h + (rotr(e, 6) ^ rotr(e, 11) ^ rotr(e, 25)) + ((e & f) ^ (~e & g)) + k[i] + w[i]) & 0xffffffffu;
+			unsigned t2 = ((rotr(a, 2) ^ rotr(a, 13) ^ rotr(a, 22)) + ((a & b) ^ (a & c) ^ (b & c))) & 0xffffffffu;
+			h = g; g = f; f = e;
+			e = (d + t1) & 0xffffffffu;
+			d = c; c = b; b = a;
+			a = (t1 + t2) & 0xffffffffu;
+		}
+		fH[0] += a; fH[1] += b; fH[2] += c; fH[3] += d;
+		fH[4] += e; fH[5] += f; fH[6] += g; fH[7] += h;
+		for (int i = 0; i < 8; i++) fH[i] &= 0xffffffffu;
+	}
+
+	public:
+		sha256 () : fUsed(0), fLength(0) {
+			static const unsigned h[8] = { 0x6a09e667, 0xbb67ae85, 0x3c6ef372, 0xa54ff53a, 0x510e527f, 0x9b05688c, 0x1f83d9ab, 0x5be0cd19 };
+			memcpy (fH, h, sizeof(fH));
+		}
+
+		void update (const unsigned char* data, size_t size) {
+			fLength += size;
+			if (fUsed) {
+				size_t n = (64 - fUsed < size) ? 64 - fUsed : size;
+				memcpy (fBlock + fUsed, data, n);
+				fUsed += n; data += n; size -= n;
+				if (fUsed < 64) return;
+				transform (fBlock);
+				fUsed = 0;
+			}
+			for (; size >= 64; data += 64, size -= 64)
+				transform (data);
+			memcpy (fBlock, data, size);
+			fUsed = size;
+		}
+
+		string hexdigest () {
+			unsigned long long bits = fLength * 8;
+			unsigned char pad[72] = { 0x80 };
+			size_t n = (fUsed < 56) ? 56 - fUsed : 120 - fUsed;
+			update (pad, n);
+			unsigned char length[8];
+			for (int i = 0; i < 8; i++) length[i] = (unsigned char)(bits >> (56 - 8*i));
+			update (length, 8);
+
+			static const char digits[] = "0123456789abcdef";
+			string result;
+			for (int i = 0; i < 8; i++)
+				for (int shift = 28; shift >= 0; shift -= 4)
+					result += digits[(fH[i] >> shift) & 0xf];
+			return result;
+		}
+};
+
+string xmlcache::hash (const char* data, size_t size)
+{
+	sha256 h;
+	h.update ((const unsigned char*)data, size);
+	return h.hexdigest();
+}
+
+}
@@ -0,0 +1,77 @@
+/*
+  MusicXML Library
+  Copyright (C) Grame 2006-2013
+
+  This Source Code Form is subject to the terms of the Mozilla Public
+  License, v. 2.0. If a copy of the MPL was not distributed with this
+  file, You can obtain one at http://mozilla.org/MPL/2.0/.
+
+  Grame Research Laboratory, 11, cours de Verdun Gensoul 69002 Lyon - France
+  research@grame.fr
+*/
+
+#ifndef __xmlcache__
+#define __xmlcache__
+
+#include <cstddef>
+#include <string>
+
+#include "exports.h"
+#include "xmlfile.h"
+
+namespace MusicXML2
+{
+
+/*!
+\brief a cache of parsed MusicXML files
+
+	The parsed files are stored in a directory in a compact binary form:
+	the elements types, line numbers and values, the attributes names
+	and values and the xml declaration and document type.
+	A cache entry is named after the SHA-256 hash of the file content,
+	thus a file is parsed once whatever its name or location, and a modified
+	file gets a new entry. Loading an entry (memory mapped) skips the parser.
+\n	The entries depend on the elements types of the library: they carry a
+	signature of the types and the entries of another library version are
+	ignored (and replaced). Entries are written to a temporary file first and
+	renamed, thus the cache can be shared by threads and processes.
+\n	The files read from the standard input are not cached.
+*/
+//______________________________________________________________________________
+class EXP xmlcache
+{
+	std::string	fDirectory;
+	bool		fUseArena;
+
+	public:
+				 xmlcache (const std::string& directory) : fDirectory(directory), fUseArena(false) {}
+		virtual ~xmlcache() {}
+
+		//! when set, the nodes of a document are allocated in an arena owned by the document
+		void	useArena (bool state)	{ fUseArena = state; }
+		bool	useArena () const		{ return fUseArena; }
+
+		const std::string&	directory () const	{ return fDirectory; }
+
+		//! reads a MusicXML file, from its cache entry when there is one, the parsed file is added to the cache otherwise
+		SXMLFile	read (const char* file);
+		//! the cache entry of a file content
+		std::string	entry (const char* data, size_t size) const;
+
+		//! writes a parsed file to path in the cache format
+		static bool		save (const SXMLFile& xmlfile, const std::string& path);
+		//! reads a file in the cache format, returns 0 when the file is invalid
+		static SXMLFile	load (const std::string& path, bool useArena = false);
+		static SXMLFile	load (const char* data, size_t size, bool useArena = false);
+
+		//! the SHA-256 hash of data as an hexadecimal string
+		static std::string	hash (const char* data, size_t size);
+
+		//! the cache directory used by the library conversion functions (none by default)
+		static void			setDefaultDirectory (const std::string& directory);
+		static std::string	defaultDirectory ();
+};
+
+}
+
+#endif
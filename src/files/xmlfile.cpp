@@ -12,8 +12,7 @@
 
 #include <iostream>
 #include "xmlfile.h"
-#include "xmlvisitor.h"
-#include "tree_browser.h"
+#include "xmlwriter.h"
 
 using namespace std; 
 using namespace MusicXML2; 
@@ -38,7 +37,7 @@ TDocType::TDocType (const string start) : fStartElement(start), fPublic(true)
 //______________________________________________________________________________
 void TDocType::print (ostream& s) 
 {
-	s	<< endl << "<!DOCTYPE " << fStartElement
+	s	<< '\n' << "<!DOCTYPE " << fStartElement
 		<< (fPublic ? " PUBLIC " : " SYSTEM ") 
 		<< "\"" << fPubLitteral << "\"\n\t\t\t\"" 
 		<< fSysLitteral << "\">";	
@@ -56,11 +55,8 @@ void TXMLDecl::print (ostream& s)
 //______________________________________________________________________________
 void TXMLFile::print (ostream& stream) 
 {
-	if (fXMLDecl) fXMLDecl->print(stream);
-	if (fDocType) fDocType->print(stream);
-	xmlvisitor v(stream);
-	tree_browser<xmlelement> browser(&v);
-	browser.browse(*elements());
+	xmlwriter w;
+	w.write (this, stream);
 }
 
 }
@@ -16,6 +16,7 @@
 #include <ostream>
 #include <string>
 #include "exports.h"
+#include "arena.h"
 #include "xml.h"
 #include "ctree.h"
 
@@ -71,6 +72,7 @@ class EXP TXMLFile : public smartable
   private:
     TXMLDecl*             fXMLDecl;
     TDocType*             fDocType;
+    Sarena                fArena;      // the arena owning the document nodes (optional)
     Sxmlelement           fXMLTree;
   
   protected:
@@ -84,10 +86,12 @@ class EXP TXMLFile : public smartable
     TXMLDecl* 		getXMLDecl ()			{ return fXMLDecl; }
     TDocType* 		getDocType ()			{ return fDocType; }
     Sxmlelement		elements () 			{ return fXMLTree; }
+    Sarena			getArena ()				{ return fArena; }
 
     void 			set (Sxmlelement root)	{ fXMLTree = root; }
     void 			set (TXMLDecl * dec)	{ fXMLDecl = dec; }
     void 			set (TDocType * dt)		{ fDocType = dt; }
+    void 			setArena (Sarena a)		{ fArena = a; }
 
     void 			print (std::ostream& s);
 };
@@ -14,9 +14,14 @@
 # pragma warning (disable : 4786)
 #endif
 
+#include <ctype.h>
 #include <iostream>
+#include <string>
 #include "xmlreader.h"
+#include "elements.h"
 #include "factory.h"
+#include "filebuffer.h"
+#include "zipfile.h"
 
 using namespace std;
 
@@ -27,6 +32,7 @@ extern "C" {
 bool readfile   (const char * file, reader * r);
 bool readstream (FILE * file, reader * r);
 bool readbuffer (const char * buffer, reader * r);
+bool readbytes  (char * buffer, size_t size, reader * r);
 }
 
 #if 0
@@ -35,33 +41,159 @@ bool readbuffer (const char * buffer, reader * r);
 #define debug(str,val)
 #endif
 
+//_______________________________________________________________________________
+SXMLFile xmlreader::newFile()
+{
+	SXMLFile file = TXMLFile::create();
+	if (fUseArena) file->setArena (arena::create());
+	return file;
+}
+
 //_______________________________________________________________________________
 SXMLFile xmlreader::readbuff(const char* buffer)
 {
-	fFile = TXMLFile::create();
+	fFile = newFile();
+	arena::scope scope (fFile->getArena());
 	debug("read buffer", '-');
 	return readbuffer (buffer, this) ? fFile : 0;
 }
 
 //_______________________________________________________________________________
+// converts an UTF-16 buffer to UTF-8 (followed by two null bytes)
+static void utf16to8 (const unsigned char* src, size_t size, bool bigendian, string& dst)
+{
+	dst.reserve (size + size/2 + 2);
+	for (size_t i = 0; i + 1 < size; i += 2) {
+		unsigned long c = bigendian ? (src[i] << 8) | src[i+1] : (src[i+1] << 8) | src[i];
+		if ((c >= 0xd800) && (c < 0xdc00) && (i + 3 < size)) {		// surrogate pair
+			unsigned long low = bigendian ? (src[i+2] << 8) | src[i+3] : (src[i+3] << 8) | src[i+2];
+			if ((low >= 0xdc00) && (low < 0xe000)) {
+				c = 0x10000 + ((c - 0xd800) << 10) + (low - 0xdc00);
+				i += 2;
+			}
+		}
+		if (c < 0x80)			dst += char(c);
+		else if (c < 0x800)		{ dst += char(0xc0 | (c >> 6)); dst += char(0x80 | (c & 0x3f)); }
+		else if (c < 0x10000)	{ dst += char(0xe0 | (c >> 12)); dst += char(0x80 | ((c >> 6) & 0x3f)); dst += char(0x80 | (c & 0x3f)); }
+		else { 
+			dst += char(0xf0 | (c >> 18)); dst += char(0x80 | ((c >> 12) & 0x3f));
+			dst += char(0x80 | ((c >> 6) & 0x3f)); dst += char(0x80 | (c & 0x3f));
+		}
+	}
+	dst.append (2, '\0');
+}
+
+//_______________________________________________________________________________
+// parses a buffer in place, the buffer must be followed by two null bytes
+// UTF-16 data are converted to UTF-8 first
+SXMLFile xmlreader::readdata(char* data, size_t size)
+{
+	const unsigned char* bom = (const unsigned char*)data;
+	if ((size >= 2) && (((bom[0] == 0xff) && (bom[1] == 0xfe)) || ((bom[0] == 0xfe) && (bom[1] == 0xff)))) {
+		string utf8;
+		utf16to8 (bom + 2, size - 2, bom[0] == 0xfe, utf8);
+		return readbytes (&utf8[0], utf8.size(), this) ? fFile : 0;
+	}
+	if ((size >= 3) && (bom[0] == 0xef) && (bom[1] == 0xbb) && (bom[2] == 0xbf)) {	// skip the UTF-8 byte order mark
+		data += 3;
+		size -= 3;
+	}
+	return readbytes (data, size + 2, this) ? fFile : 0;
+}
+
+//_______________________________________________________________________________
+// gets the path of the first rootfile of a compressed MusicXML container
+// (META-INF/container.xml), which is the MusicXML file by definition
+// the container is scanned directly: it has no DOCTYPE, thus it is not accepted by the parser
+static string rootfile (const string& container)
+{
+	size_t pos = container.find ("<rootfile");
+	while ((pos != string::npos) && !isspace (container[pos + 9]))		// skips <rootfiles>
+		pos = container.find ("<rootfile", pos + 9);
+	if (pos == string::npos) return "";
+	size_t end = container.find ('>', pos);
+	pos = container.find ("full-path", pos);
+	if ((pos == string::npos) || (pos > end)) return "";
+	pos = container.find_first_of ("\"'", pos);
+	if (pos == string::npos) return "";
+	size_t last = container.find (container[pos], pos + 1);
+	return (last == string::npos) ? "" : container.substr (pos + 1, last - pos - 1);
+}
+
+//_______________________________________________________________________________
+// reads a compressed MusicXML file: the MusicXML file designated by the container
+// is uncompressed in memory and parsed in place
+SXMLFile xmlreader::readmxl(const char* data, size_t size, const char* file)
+{
+	zipfile zip (data, size);
+	if (!zip.valid()) {
+		cerr << file << ": invalid compressed file" << endl;
+		return 0;
+	}
+
+	string content, path;
+	if (zip.extract ("META-INF/container.xml", content))
+		path = rootfile (content);
+	else {		// no container: takes the first xml file outside of META-INF
+		for (size_t i = 0; i < zip.entries(); i++) {
+			const string& name = zip.name(i);
+			if ((name.find ("META-INF/") != 0) && (name.size() > 4) && (name.rfind (".xml") == name.size() - 4)) {
+				path = name;
+				break;
+			}
+		}
+	}
+	if (path.empty()) {
+		cerr << file << ": can't find the MusicXML file in the compressed file" << endl;
+		return 0;
+	}
+	if (!zip.extract (path, content)) {
+		cerr << file << ": can't uncompress " << path << " (corrupted or too large)" << endl;
+		return 0;
+	}
+	debug("read mxl", path);
+	size = content.size();
+	content.append (2, '\0');
+	return readdata (&content[0], size);
+}
+
+//_______________________________________________________________________________
+// the file is parsed in place from a memory mapped buffer
+// compressed MusicXML files (.mxl) are uncompressed in memory
 SXMLFile xmlreader::read(const char* file)
 {
-	fFile = TXMLFile::create();
+	filebuffer buffer;
+	if (!buffer.open (file)) {
+		cerr << "can't open file " << file << endl;
+		return 0;
+	}
+	return read (buffer.data(), buffer.size(), file);
+}
+
+//_______________________________________________________________________________
+SXMLFile xmlreader::read(char* data, size_t size, const char* file)
+{
+	fFile = newFile();
+	arena::scope scope (fFile->getArena());
 	debug("read", file);
-	return readfile (file, this) ? fFile : 0;
+
+	if (zipfile::isZip (data, size))
+		return readmxl (data, size, file);
+	return readdata (data, size);
 }
 
 //_______________________________________________________________________________
 SXMLFile xmlreader::read(FILE* file)
 {
-	fFile = TXMLFile::create();
+	fFile = newFile();
+	arena::scope scope (fFile->getArena());
 	return readstream (file, this) ? fFile : 0;
 }
 
 //_______________________________________________________________________________
 void xmlreader::newComment (const char* comment)
 {
-	Sxmlelement elt = factory::instance().create("comment");
+	Sxmlelement elt = factory::instance().create(kComment);
 	elt->setValue(comment);
 	// comments outside the xml hierarchy are lost
 	if (fStack.size()) fStack.top()->push(elt);
@@ -70,7 +202,7 @@ void xmlreader::newComment (const char* comment)
 //_______________________________________________________________________________
 void xmlreader::newProcessingInstruction (const char* pi)
 {
-	Sxmlelement elt = factory::instance().create("pi");
+	Sxmlelement elt = factory::instance().create(kProcessingInstruction);
 	elt->setValue(pi);
 	// processing instructions outside the xml hierarchy are lost
 	if (fStack.size()) fStack.top()->push(elt);
@@ -100,7 +232,8 @@ bool xmlreader::endElement (const char* eltName)
 	debug("endElement", eltName);
 	Sxmlelement top = fStack.top();
 	fStack.pop();
-	return top->getName() == eltName;
+	// element names are unique per type: compares the types instead of the names
+	return top->getType() == factory::instance().type(eltName);
 }
 
 //_______________________________________________________________________________
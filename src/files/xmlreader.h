@@ -27,13 +27,25 @@ class EXP xmlreader : public reader
 { 
 	std::stack<Sxmlelement>	fStack;
 	SXMLFile				fFile;
+	bool					fUseArena;
+
+	SXMLFile	newFile();
+	SXMLFile	readdata(char* data, size_t size);
+	SXMLFile	readmxl(const char* data, size_t size, const char* file);
 
 	public:
-				 xmlreader() {}
+				 xmlreader() : fUseArena(false) {}
 		virtual ~xmlreader() {}
-		
+
+		//! when set, the nodes of a document are allocated in an arena owned by the document
+		void	useArena (bool state)	{ fUseArena = state; }
+		bool	useArena () const		{ return fUseArena; }
+
 		SXMLFile readbuff(const char* file);
+		//! reads a MusicXML file, compressed files (.mxl) are supported
 		SXMLFile read(const char* file);
+		//! reads a MusicXML file content in place, data must be followed by two null bytes (see filebuffer)
+		SXMLFile read(char* data, size_t size, const char* file);
 		SXMLFile read(FILE* file);
 
 		bool	xmlDecl (const char* version, const char *encoding, int standalone);
@@ -0,0 +1,126 @@
+/*
+  MusicXML Library
+  Copyright (C) Grame 2006-2013
+
+  This Source Code Form is subject to the terms of the Mozilla Public
+  License, v. 2.0. If a copy of the MPL was not distributed with this
+  file, You can obtain one at http://mozilla.org/MPL/2.0/.
+
+  Grame Research Laboratory, 11, cours de Verdun Gensoul 69002 Lyon - France
+  research@grame.fr
+*/
+
+#ifdef MSVC
+# pragma warning (disable : 4786)
+#endif
+
+#include "xmlstreamreader.h"
+#include "elements.h"
+#include "factory.h"
+#include "xml_tree_browser.h"
+
+using namespace std;
+
+namespace MusicXML2
+{
+
+//_______________________________________________________________________________
+void xmlstreamreader::subtree (int type)
+{
+	if (type < 0) return;
+	if (size_t(type) >= fSubtrees.size()) fSubtrees.resize (type + 1, false);
+	fSubtrees[type] = true;
+}
+
+//_______________________________________________________________________________
+// the current element is visited before its first child
+void xmlstreamreader::enterParent ()
+{
+	if (fStack.empty()) return;
+	node& parent = fStack.back();
+	if (!parent.fEntered) {
+		parent.fElt->acceptIn (*fVisitor);
+		parent.fEntered = true;
+	}
+}
+
+//_______________________________________________________________________________
+// comments and processing instructions
+void xmlstreamreader::newLeaf (int type, const char* value)
+{
+	// comments outside the xml hierarchy are lost
+	if (fStack.empty()) return;
+	Sxmlelement elt = factory::instance().create(type);
+	elt->setValue (value);
+	if (fSubtreeDepth) fStack.back().fElt->push (elt);
+	else {
+		enterParent();
+		elt->acceptIn (*fVisitor);
+		elt->acceptOut (*fVisitor);
+	}
+}
+
+void xmlstreamreader::newComment (const char* comment)			{ newLeaf (kComment, comment); }
+void xmlstreamreader::newProcessingInstruction (const char* pi)	{ newLeaf (kProcessingInstruction, pi); }
+
+//_______________________________________________________________________________
+bool xmlstreamreader::newElement (const char* eltName)
+{
+	Sxmlelement elt = factory::instance().create(eltName);
+	if (!elt) return false;
+
+	if (fSubtreeDepth) {
+		fStack.back().fElt->push (elt);
+		fSubtreeDepth++;
+	}
+	else {
+		enterParent();
+		int type = elt->getType();
+		if ((size_t(type) < fSubtrees.size()) && fSubtrees[type])
+			fSubtreeDepth = 1;
+	}
+	node n = { elt, false };
+	fStack.push_back (n);
+	return true;
+}
+
+//_______________________________________________________________________________
+bool xmlstreamreader::endElement (const char* eltName)
+{
+	if (fStack.empty()) return false;
+	node n = fStack.back();
+	fStack.pop_back();
+
+	if (fSubtreeDepth) {
+		// the subtree is complete when its root ends
+		if (--fSubtreeDepth == 0) {
+			xml_tree_browser browser (fVisitor);
+			browser.browse (*n.fElt);
+		}
+	}
+	else {
+		if (!n.fEntered) n.fElt->acceptIn (*fVisitor);
+		n.fElt->acceptOut (*fVisitor);
+	}
+	// element names are unique per type: compares the types instead of the names
+	return n.fElt->getType() == factory::instance().type(eltName);
+}
+
+//_______________________________________________________________________________
+bool xmlstreamreader::newAttribute (const char* name, const char *value)
+{
+	if (fStack.empty()) return false;
+	Sxmlattribute attr = xmlattribute::create();
+	attr->setName (name);
+	attr->setValue (value);
+	fStack.back().fElt->add (attr);
+	return true;
+}
+
+//_______________________________________________________________________________
+void xmlstreamreader::setValue (const char* value)
+{
+	if (fStack.size()) fStack.back().fElt->setValue (value);
+}
+
+}
@@ -0,0 +1,81 @@
+/*
+  MusicXML Library
+  Copyright (C) Grame 2006-2013
+
+  This Source Code Form is subject to the terms of the Mozilla Public
+  License, v. 2.0. If a copy of the MPL was not distributed with this
+  file, You can obtain one at http://mozilla.org/MPL/2.0/.
+
+  Grame Research Laboratory, 11, cours de Verdun Gensoul 69002 Lyon - France
+  research@grame.fr
+*/
+
+#ifndef __xmlstreamreader__
+#define __xmlstreamreader__
+
+#include <vector>
+
+#ifdef WIN32
+#pragma warning (disable : 4251)
+#endif
+
+#include "exports.h"
+#include "basevisitor.h"
+#include "xmlreader.h"
+
+namespace MusicXML2
+{
+
+/*!
+\brief a reader that visits the elements while parsing, without building the tree
+
+	Each element is visited (acceptIn) as soon as its attributes and its value
+	are known, i.e. when its first child starts or when it ends, and it is
+	released after acceptOut. Thus only the current path from the root is kept
+	in memory and the visitor sees the elements in the xml_tree_browser order.
+\n	Visitors that need the content of an element at visit time (e.g. to look for
+	subelements) can request the element subtree: elements of these types are built
+	with their subtree, which is browsed with an xml_tree_browser when the element
+	ends (e.g. \c k_measure for a measure by measure processing).
+\n	The file returned by the read methods contains the xml declaration and
+	the document type, but no elements.
+*/
+//______________________________________________________________________________
+class EXP xmlstreamreader : public xmlreader
+{
+	struct node {
+		Sxmlelement	fElt;
+		bool		fEntered;		// true when acceptIn has been called
+	};
+
+	basevisitor*		fVisitor;
+	std::vector<node>	fStack;
+	std::vector<bool>	fSubtrees;		// the subtree types, indexed by element type
+	int					fSubtreeDepth;	// the depth in a subtree, 0 when outside
+
+	void	reset ()		{ fStack.clear(); fSubtreeDepth = 0; }
+	void	enterParent ();
+	void	newLeaf (int type, const char* value);
+
+	public:
+				 xmlstreamreader(basevisitor* v) : fVisitor(v), fSubtreeDepth(0) {}
+		virtual ~xmlstreamreader() {}
+
+		//! elements of type \c type are visited with their subtree
+		void	subtree (int type);
+
+		SXMLFile readbuff(const char* buffer)	{ reset(); return xmlreader::readbuff (buffer); }
+		SXMLFile read(const char* file)			{ reset(); return xmlreader::read (file); }
+		SXMLFile read(FILE* file)				{ reset(); return xmlreader::read (file); }
+
+		void	newComment (const char* comment);
+		void	newProcessingInstruction (const char* pi);
+		bool	newElement (const char* eltName);
+		bool	newAttribute (const char* eltName, const char *val);
+		void	setValue (const char* value);
+		bool	endElement (const char* eltName);
+};
+
+}
+
+#endif
@@ -0,0 +1,257 @@
+/*
+  MusicXML Library
+  Copyright (C) Grame 2006-2013
+
+  This Source Code Form is subject to the terms of the Mozilla Public
+  License, v. 2.0. If a copy of the MPL was not distributed with this
+  file, You can obtain one at http://mozilla.org/MPL/2.0/.
+
+  Grame Research Laboratory, 11, cours de Verdun Gensoul 69002 Lyon - France
+  research@grame.fr
+*/
+
+#include <errno.h>
+
+#ifdef WIN32
+#include <io.h>
+#else
+#include <unistd.h>
+#endif
+
+#include "xmlwriter.h"
+#include "elements.h"
+
+using namespace std;
+
+namespace MusicXML2
+{
+
+//______________________________________________________________________________
+// the characters to check when escaping: 1 for text, 2 for attributes only
+static const unsigned char* escapeTable ()
+{
+	static unsigned char table[256] = { 0 };
+	static bool init = [] () {
+		table[(unsigned char)'&'] = 1;
+		table[(unsigned char)'<'] = 1;
+		table[(unsigned char)'"'] = 2;
+		return true;
+	} ();
+	(void)init;
+	return table;
+}
+
+static inline bool isNameStart (char c)	{ return ((c >= 'a') && (c <= 'z')) || ((c >= 'A') && (c <= 'Z')) || (c == '_') || (c == ':'); }
+static inline bool isNameChar (char c)	{ return isNameStart(c) || ((c >= '0') && (c <= '9')) || (c == '-') || (c == '.'); }
+static inline bool isHexDigit (char c)	{ return ((c >= '0') && (c <= '9')) || ((c >= 'a') && (c <= 'f')) || ((c >= 'A') && (c <= 'F')); }
+
+// checks if s[i] (a '&') starts an entity or a character reference
+static bool isReference (const string& s, size_t i)
+{
+	size_t n = s.size();
+	size_t j = i + 1;
+	if ((j < n) && (s[j] == '#')) {
+		j++;
+		bool hex = (j < n) && (s[j] == 'x');
+		if (hex) j++;
+		size_t start = j;
+		while ((j < n) && (hex ? isHexDigit(s[j]) : ((s[j] >= '0') && (s[j] <= '9')))) j++;
+		return (j > start) && (j < n) && (s[j] == ';');
+	}
+	if ((j >= n) || !isNameStart(s[j])) return false;
+	while ((j < n) && isNameChar(s[j])) j++;
+	return (j < n) && (s[j] == ';');
+}
+
+void xmlwriter::escape (const string& value, bool attribute, string& out)
+{
+	const unsigned char* table = escapeTable();
+	const unsigned char mask = attribute ? 3 : 1;
+	const char* data = value.data();
+	size_t n = value.size();
+	size_t run = 0;			// the start of the characters not yet copied
+	for (size_t i = 0; i < n; i++) {
+		if (!(table[(unsigned char)data[i]] & mask)) continue;
+		const char* replacement;
+		switch (data[i]) {
+			case '&':
+				if (isReference (value, i)) continue;
+				replacement = "&amp;";
+				break;
+			case '<':	replacement = "&lt;"; break;
+			default:	replacement = "&quot;";
+		}
+		out.append (data + run, i - run);
+		out.append (replacement);
+		run = i + 1;
+	}
+	out.append (data + run, n - run);
+}
+
+//______________________________________________________________________________
+xmlwriter::xmlwriter (bool indent, size_t flushSize)
+	: fFlushSize(flushSize ? flushSize : 1), fIndent(indent), fStream(0), fFd(-1), fFailed(false)
+{
+	fBuffer.reserve (fFlushSize + 1024);
+}
+
+//______________________________________________________________________________
+void xmlwriter::flush ()
+{
+	if (fStream) {
+		fStream->write (fBuffer.data(), fBuffer.size());
+		if (fStream->fail()) fFailed = true;
+	}
+	else if (fFd >= 0) {
+		const char* data = fBuffer.data();
+		size_t size = fBuffer.size();
+		while (size && !fFailed) {
+#ifdef WIN32
+			int n = _write (fFd, data, unsigned(size));
+#else
+			ssize_t n = ::write (fFd, data, size);
+#endif
+			if (n > 0) { data += n; size -= size_t(n); }
+			else if ((n < 0) && (errno == EINTR)) continue;
+			else fFailed = true;
+		}
+	}
+	else return;		// no output: the buffer holds the whole document
+	fBuffer.clear();
+}
+
+//______________________________________________________________________________
+// the indented output starts each element on a new line (see xmlvisitor)
+void xmlwriter::newline (int indent)
+{
+	if (!fIndent) return;
+	fBuffer += '\n';
+	fBuffer.append (size_t(indent) * 4, ' ');
+}
+
+void xmlwriter::header (TXMLFile& file)
+{
+	TXMLDecl* decl = file.getXMLDecl();
+	if (decl) {
+		fBuffer += "<?xml version=\"";
+		fBuffer += decl->getVersion();
+		fBuffer += '"';
+		if (!decl->getEncoding().empty()) {
+			fBuffer += " encoding=\"";
+			fBuffer += decl->getEncoding();
+			fBuffer += '"';
+		}
+		if (decl->getStandalone() != TXMLDecl::kundefined)
+			fBuffer += decl->getStandalone() ? " standalone=\"yes\"" : " standalone=\"no\"";
+		fBuffer += "?>";
+	}
+	TDocType* doctype = file.getDocType();
+	if (doctype) {
+		if (fIndent) fBuffer += '\n';
+		fBuffer += "<!DOCTYPE ";
+		fBuffer += doctype->getStartElement();
+		fBuffer += doctype->getPublic() ? " PUBLIC \"" : " SYSTEM \"";
+		fBuffer += doctype->getPubLitteral();
+		fBuffer += fIndent ? "\"\n\t\t\t\"" : "\" \"";
+		fBuffer += doctype->getSysLitteral();
+		fBuffer += "\">";
+	}
+}
+
+//______________________________________________________________________________
+void xmlwriter::element (xmlelement& elt, int indent)
+{
+	newline (indent);
+	switch (elt.getType()) {
+		case kComment:
+			fBuffer += "<!--";
+			fBuffer += elt.getValue();
+			fBuffer += "-->";
+			return;
+		case kProcessingInstruction:
+			fBuffer += "<?";
+			fBuffer += elt.getValue();
+			fBuffer += "?>";
+			return;
+	}
+
+	const string& name = elt.getName();
+	fBuffer += '<';
+	fBuffer += name;
+	const xmlelement::attributesList& attributes = elt.attributes();
+	for (xmlelement::attributesList::const_iterator i = attributes.begin(); i != attributes.end(); i++) {
+		fBuffer += ' ';
+		fBuffer += (*i)->getName();
+		fBuffer += "=\"";
+		escape ((*i)->getValue(), true, fBuffer);
+		fBuffer += '"';
+	}
+	if (elt.empty()) {
+		fBuffer += "/>";
+		checkFlush();
+		return;
+	}
+
+	fBuffer += '>';
+	escape (elt.getValue(), false, fBuffer);
+	checkFlush();
+	if (elt.size()) {
+		for (ctree<xmlelement>::literator i = elt.lbegin(); i != elt.lend(); i++)
+			element (**i, indent + 1);
+		newline (indent);
+	}
+	fBuffer += "</";
+	fBuffer += name;
+	fBuffer += '>';
+}
+
+void xmlwriter::document (TXMLFile& file)
+{
+	header (file);
+	Sxmlelement root = file.elements();
+	if (root) element (*root, 0);
+	flush();
+}
+
+//______________________________________________________________________________
+const string& xmlwriter::write (const SXMLFile& file)
+{
+	fBuffer.clear();
+	fStream = 0;
+	fFd = -1;
+	document (*file);
+	return fBuffer;
+}
+
+const string& xmlwriter::write (const Sxmlelement& elt)
+{
+	fBuffer.clear();
+	fStream = 0;
+	fFd = -1;
+	element (*elt, 0);
+	return fBuffer;
+}
+
+bool xmlwriter::write (const SXMLFile& file, ostream& out)
+{
+	fBuffer.clear();
+	fStream = &out;
+	fFd = -1;
+	fFailed = false;
+	document (*file);
+	fStream = 0;
+	return !fFailed;
+}
+
+bool xmlwriter::write (const SXMLFile& file, int fd)
+{
+	fBuffer.clear();
+	fStream = 0;
+	fFd = fd;
+	fFailed = false;
+	document (*file);
+	fFd = -1;
+	return !fFailed;
+}
+
+}
@@ -0,0 +1,85 @@
+/*
+  MusicXML Library
+  Copyright (C) Grame 2006-2013
+
+  This Source Code Form is subject to the terms of the Mozilla Public
+  License, v. 2.0. If a copy of the MPL was not distributed with this
+  file, You can obtain one at http://mozilla.org/MPL/2.0/.
+
+  Grame Research Laboratory, 11, cours de Verdun Gensoul 69002 Lyon - France
+  research@grame.fr
+*/
+
+#ifndef __xmlwriter__
+#define __xmlwriter__
+
+#include <cstddef>
+#include <ostream>
+#include <string>
+
+#include "exports.h"
+#include "xml.h"
+#include "xmlfile.h"
+
+namespace MusicXML2
+{
+
+/*!
+\brief a MusicXML serializer
+
+	The document is written to a buffer that is reused from one document
+	to the other. When writing to a stream or to a file descriptor, the
+	buffer is written each time it reaches the flush size, thus large
+	documents are streamed without being built in memory.
+\n	The indented output is the output of the xmlvisitor: each element on its
+	own line, indented by 4 spaces. The compact output has no spaces between
+	the elements.
+\n	The values are escaped in one pass: '<' and the '&' that don't start an
+	entity or character reference are escaped, as well as '"' in attributes
+	values. The references are kept since the parser doesn't expand them.
+*/
+//______________________________________________________________________________
+class EXP xmlwriter
+{
+	std::string		fBuffer;
+	size_t			fFlushSize;
+	bool			fIndent;
+	std::ostream*	fStream;		// the current output stream, if any
+	int				fFd;			// the current output file descriptor, -1 when none
+	bool			fFailed;		// an output error occured
+
+	void	flush ();
+	void	checkFlush ()		{ if (fBuffer.size() >= fFlushSize) flush(); }
+	void	newline (int indent);
+	void	header (TXMLFile& file);
+	void	element (xmlelement& elt, int indent);
+	void	document (TXMLFile& file);
+
+	public:
+				 xmlwriter (bool indent = true, size_t flushSize = 64*1024);
+		virtual ~xmlwriter() {}
+
+		//! sets the indented (the default) or compact output
+		void	indent (bool state)		{ fIndent = state; }
+		bool	indent () const			{ return fIndent; }
+
+		//! writes a document to the buffer and returns the buffer
+		const std::string&	write (const SXMLFile& file);
+		//! writes an element and its subelements to the buffer and returns the buffer
+		const std::string&	write (const Sxmlelement& elt);
+
+		//! writes a document to a stream, returns false on output error
+		bool	write (const SXMLFile& file, std::ostream& out);
+		//! writes a document to a file descriptor, returns false on output error
+		bool	write (const SXMLFile& file, int fd);
+
+		//! the last output written to the buffer
+		const std::string&	buffer () const		{ return fBuffer; }
+
+		//! appends the escaped form of a value to a string
+		static void	escape (const std::string& value, bool attribute, std::string& out);
+};
+
+}
+
+#endif
@@ -0,0 +1,402 @@
+/*
+  MusicXML Library
+  Copyright (C) Grame 2006-2013
+
+  This Source Code Form is subject to the terms of the Mozilla Public
+  License, v. 2.0. If a copy of the MPL was not distributed with this
+  file, You can obtain one at http://mozilla.org/MPL/2.0/.
+
+  Grame Research Laboratory, 11, cours de Verdun Gensoul 69002 Lyon - France
+  research@grame.fr
+*/
+
+#include "zipfile.h"
+
+using namespace std;
+
+namespace MusicXML2
+{
+
+//______________________________________________________________________________
+// inflate (RFC 1951) decoder
+//______________________________________________________________________________
+enum { kMaxBits = 15, kMaxLCodes = 286, kMaxDCodes = 30, kFixLCodes = 288 };
+
+// canonical huffman code: number of codes of each length and symbols ordered by code
+struct huffman {
+	short	fCount[kMaxBits+1];
+	short*	fSymbol;
+};
+
+class inflater
+{
+	const unsigned char* fIn;
+	size_t			fInSize;
+	size_t			fPos;
+	unsigned long	fBitBuf;
+	int				fBitCnt;
+	bool			fError;
+	string&			fOut;
+	size_t			fLimit;			// the expected output size, exceeding it is an error
+
+	int		bits (int need);
+	int		decode (const huffman& h);
+	bool	stored ();
+	bool	codes (const huffman& lencode, const huffman& distcode);
+	bool	fixed ();
+	bool	dynamic ();
+
+	public:
+				 inflater (const unsigned char* in, size_t size, string& out, size_t limit)
+					: fIn(in), fInSize(size), fPos(0), fBitBuf(0), fBitCnt(0), fError(false), fOut(out), fLimit(limit) {}
+
+		bool	run ();
+};
+
+//______________________________________________________________________________
+// reads need bits, least significant bit first
+int inflater::bits (int need)
+{
+	unsigned long val = fBitBuf;
+	while (fBitCnt < need) {
+		if (fPos >= fInSize) {
+			fError = true;
+			return 0;
+		}
+		val |= (unsigned long)fIn[fPos++] << fBitCnt;
+		fBitCnt += 8;
+	}
+	fBitBuf = val >> need;
+	fBitCnt -= need;
+	return int(val & ((1UL << need) - 1));
+}
+
+//______________________________________________________________________________
+// decodes a symbol, codes are read bit by bit (huffman codes are stored msb first)
+int inflater::decode (const huffman& h)
+{
+	int code = 0, first = 0, index = 0;
+	for (int len = 1; len <= kMaxBits; len++) {
+		code |= bits(1);
+		int count = h.fCount[len];
+		if (code - count < first)
+			return fError ? -1 : h.fSymbol[index + (code - first)];
+		index += count;
+		first += count;
+		first <<= 1;
+		code <<= 1;
+	}
+	return -1;
+}
+
+//______________________________________________________________________________
+// builds a canonical huffman code from the codes lengths
+// incomplete codes are accepted (allowed for single distance codes)
+static bool construct (huffman& h, const short* length, int n)
+{
+	for (int len = 0; len <= kMaxBits; len++) h.fCount[len] = 0;
+	for (int i = 0; i < n; i++) h.fCount[length[i]]++;
+	if (h.fCount[0] == n) return true;
+
+	int left = 1;
+	for (int len = 1; len <= kMaxBits; len++) {
+		left <<= 1;
+		left -= h.fCount[len];
+		if (left < 0) return false;			// over-subscribed
+	}
+
+	short offs[kMaxBits+1];
+	offs[1] = 0;
+	for (int len = 1; len < kMaxBits; len++)
+		offs[len + 1] = offs[len] + h.fCount[len];
+	for (int i = 0; i < n; i++)
+		if (length[i]) h.fSymbol[offs[length[i]]++] = short(i);
+	return true;
+}
+
+//______________________________________________________________________________
+// the fixed literal/length and distance codes
+struct fixedcodes {
+	short	fLSymbol[kFixLCodes];
+	short	fDSymbol[kMaxDCodes];
+	huffman	fLenCode;
+	huffman	fDistCode;
+
+	fixedcodes () {
+		short lengths[kFixLCodes];
+		int i = 0;
+		for (; i < 144; i++) lengths[i] = 8;
+		for (; i < 256; i++) lengths[i] = 9;
+		for (; i < 280; i++) lengths[i] = 7;
+		for (; i < kFixLCodes; i++) lengths[i] = 8;
+		fLenCode.fSymbol = fLSymbol;
+		construct (fLenCode, lengths, kFixLCodes);
+		for (i = 0; i < kMaxDCodes; i++) lengths[i] = 5;
+		fDistCode.fSymbol = fDSymbol;
+		construct (fDistCode, lengths, kMaxDCodes);
+	}
+};
+
+//______________________________________________________________________________
+bool inflater::stored ()
+{
+	// stored blocks start on a byte boundary
+	fBitBuf = 0;
+	fBitCnt = 0;
+	if (fPos + 4 > fInSize) return false;
+	unsigned len = fIn[fPos] | (fIn[fPos+1] << 8);
+	unsigned nlen = fIn[fPos+2] | (fIn[fPos+3] << 8);
+	fPos += 4;
+	if ((len != (~nlen & 0xffff)) || (fPos + len > fInSize)) return false;
+	if (len > fLimit - fOut.size()) return false;
+	fOut.append ((const char*)fIn + fPos, len);
+	fPos += len;
+	return true;
+}
+
+//______________________________________________________________________________
+bool inflater::codes (const huffman& lencode, const huffman& distcode)
+{
+	static const short lbase[29] = {
+		3, 4, 5, 6, 7, 8, 9, 10, 11, 13, 15, 17, 19, 23, 27, 31,
+		35, 43, 51, 59, 67, 83, 99, 115, 131, 163, 195, 227, 258 };
+	static const short lext[29] = {
+		0, 0, 0, 0, 0, 0, 0, 0, 1, 1, 1, 1, 2, 2, 2, 2,
+		3, 3, 3, 3, 4, 4, 4, 4, 5, 5, 5, 5, 0 };
+	static const short dbase[30] = {
+		1, 2, 3, 4, 5, 7, 9, 13, 17, 25, 33, 49, 65, 97, 129, 193,
+		257, 385, 513, 769, 1025, 1537, 2049, 3073, 4097, 6145, 8193, 12289, 16385, 24577 };
+	static const short dext[30] = {
+		0, 0, 0, 0, 1, 1, 2, 2, 3, 3, 4, 4, 5, 5, 6, 6,
+		7, 7, 8, 8, 9, 9, 10, 10, 11, 11, 12, 12, 13, 13 };
+
+	for (;;) {
+		int symbol = decode (lencode);
+		if (symbol < 0) return false;
+		if (symbol < 256) {
+			if (fOut.size() == fLimit) return false;
+			fOut += char(symbol);
+		}
+		else if (symbol == 256) return true;	// end of block
+		else {
+			symbol -= 257;
+			if (symbol >= 29) return false;
+			size_t len = lbase[symbol] + bits(lext[symbol]);
+			symbol = decode (distcode);
+			if ((symbol < 0) || (symbol >= 30)) return false;
+			size_t dist = dbase[symbol] + bits(dext[symbol]);
+			if (fError || (dist > fOut.size()) || (len > fLimit - fOut.size())) return false;
+			// the copy may overlap the bytes being written
+			size_t from = fOut.size() - dist;
+			while (len--) fOut += fOut[from++];
+		}
+	}
+}
+
+//______________________________________________________________________________
+bool inflater::fixed ()
+{
+	static const fixedcodes f;		// the fixed codes are built once (thread safe initialization)
+	return codes (f.fLenCode, f.fDistCode);
+}
+
+//______________________________________________________________________________
+bool inflater::dynamic ()
+{
+	static const short order[19] = { 16, 17, 18, 0, 8, 7, 9, 6, 10, 5, 11, 4, 12, 3, 13, 2, 14, 1, 15 };
+
+	int nlen = bits(5) + 257;
+	int ndist = bits(5) + 1;
+	int ncode = bits(4) + 4;
+	if (fError || (nlen > kMaxLCodes) || (ndist > kMaxDCodes)) return false;
+
+	short lengths[kMaxLCodes + kMaxDCodes];
+	short lsymbol[kMaxLCodes], dsymbol[kMaxDCodes];
+	huffman lencode = { {0}, lsymbol }, distcode = { {0}, dsymbol };
+
+	// the code lengths code
+	int index = 0;
+	for (; index < ncode; index++) lengths[order[index]] = short(bits(3));
+	for (; index < 19; index++) lengths[order[index]] = 0;
+	if (fError || !construct (lencode, lengths, 19)) return false;
+
+	// the literal/length and distance code lengths
+	index = 0;
+	while (index < nlen + ndist) {
+		int symbol = decode (lencode);
+		if (symbol < 0) return false;
+		if (symbol < 16) lengths[index++] = short(symbol);
+		else {
+			short len = 0;
+			if (symbol == 16) {
+				if (index == 0) return false;
+				len = lengths[index - 1];
+				symbol = 3 + bits(2);
+			}
+			else if (symbol == 17) symbol = 3 + bits(3);
+			else symbol = 11 + bits(7);
+			if (index + symbol > nlen + ndist) return false;
+			while (symbol--) lengths[index++] = len;
+		}
+	}
+	if (fError || (lengths[256] == 0)) return false;	// no end of block code
+
+	if (!construct (lencode, lengths, nlen)) return false;
+	if (!construct (distcode, lengths + nlen, ndist)) return false;
+	return codes (lencode, distcode);
+}
+
+//______________________________________________________________________________
+bool inflater::run ()
+{
+	int last;
+	do {
+		last = bits(1);
+		int type = bits(2);
+		if (fError) return false;
+		bool ok = false;
+		switch (type) {
+			case 0:	ok = stored(); break;
+			case 1:	ok = fixed(); break;
+			case 2:	ok = dynamic(); break;
+		}
+		if (!ok || fError) return false;
+	} while (!last);
+	return true;
+}
+
+//______________________________________________________________________________
+static unsigned long crc32 (const string& data)
+{
+	struct table {
+		unsigned long fValues[256];
+		table () {
+			for (unsigned long n = 0; n < 256; n++) {
+				unsigned long c = n;
+				for (int k = 0; k < 8; k++)
+					c = (c & 1) ? 0xedb88320UL ^ (c >> 1) : c >> 1;
+				fValues[n] = c;
+			}
+		}
+	};
+	static const table crc;		// thread safe initialization
+
+	unsigned long c = 0xffffffffUL;
+	for (size_t i = 0; i < data.size(); i++)
+		c = crc.fValues[(c ^ (unsigned char)data[i]) & 0xff] ^ (c >> 8);
+	return (c ^ 0xffffffffUL) & 0xffffffffUL;
+}
+
+//______________________________________________________________________________
+// zipfile
+//______________________________________________________________________________
+enum {
+	kLocalSignature = 0x04034b50, kLocalHeaderSize = 30,
+	kCentralSignature = 0x02014b50, kCentralHeaderSize = 46,
+	kEndSignature = 0x06054b50, kEndSize = 22,
+	kStored = 0, kDeflated = 8,
+	kEncrypted = 1
+};
+
+// the size of the entries is taken from the archive directory and bounded before
+// being trusted: deflate can't expand data more than 1032 times, and larger files
+// than kMaxEntrySize are not expected in MusicXML archives
+enum { kMaxRatio = 1032 };
+static const size_t kMaxEntrySize = 512 * 1024 * 1024;
+
+static inline unsigned read16 (const unsigned char* p)		{ return p[0] | (p[1] << 8); }
+static inline unsigned long read32 (const unsigned char* p)	{ return p[0] | (p[1] << 8) | (p[2] << 16) | ((unsigned long)p[3] << 24); }
+
+zipfile::zipfile (const char* data, size_t size)
+	: fData((const unsigned char*)data), fSize(size)
+{
+	if (!readDirectory()) fEntries.clear();
+}
+
+//______________________________________________________________________________
+bool zipfile::isZip (const char* data, size_t size)
+{
+	return data && (size >= 4) && (read32 ((const unsigned char*)data) == kLocalSignature);
+}
+
+//______________________________________________________________________________
+// reads the central directory, located by the end of central directory record
+// which is at the end of the archive, possibly followed by a comment
+bool zipfile::readDirectory ()
+{
+	if (!fData || (fSize < kEndSize)) return false;
+	size_t end = fSize - kEndSize;
+	size_t limit = end > 0xffff ? end - 0xffff : 0;
+	while (read32 (fData + end) != kEndSignature) {
+		if (end == limit) return false;
+		end--;
+	}
+
+	unsigned count = read16 (fData + end + 10);
+	size_t pos = read32 (fData + end + 16);
+	for (unsigned i = 0; i < count; i++) {
+		if ((pos + kCentralHeaderSize > fSize) || (read32 (fData + pos) != kCentralSignature)) return false;
+		const unsigned char* h = fData + pos;
+		entry e;
+		e.fFlags			= read16 (h + 8);
+		e.fMethod			= read16 (h + 10);
+		e.fCrc				= read32 (h + 16);
+		e.fCompressedSize	= read32 (h + 20);
+		e.fSize				= read32 (h + 24);
+		e.fOffset			= read32 (h + 42);
+		size_t nameLen = read16 (h + 28);
+		size_t extraLen = read16 (h + 30);
+		size_t commentLen = read16 (h + 32);
+		if (pos + kCentralHeaderSize + nameLen > fSize) return false;
+		e.fName.assign ((const char*)h + kCentralHeaderSize, nameLen);
+		fEntries.push_back (e);
+		pos += kCentralHeaderSize + nameLen + extraLen + commentLen;
+	}
+	return true;
+}
+
+//______________________________________________________________________________
+bool zipfile::extract (const string& name, string& content) const
+{
+	for (size_t i = 0; i < fEntries.size(); i++)
+		if (fEntries[i].fName == name) return extract (i, content);
+	return false;
+}
+
+bool zipfile::extract (size_t i, string& content) const
+{
+	content.clear();
+	if (i >= fEntries.size()) return false;
+	const entry& e = fEntries[i];
+	if (e.fFlags & kEncrypted) return false;
+
+	// the data follows the local header, which name and extra fields may differ from the central ones
+	size_t pos = e.fOffset;
+	if ((pos + kLocalHeaderSize > fSize) || (read32 (fData + pos) != kLocalSignature)) return false;
+	pos += kLocalHeaderSize + read16 (fData + pos + 26) + read16 (fData + pos + 28);
+	if ((pos > fSize) || (e.fCompressedSize > fSize - pos)) return false;
+
+	const unsigned char* data = fData + pos;
+	switch (e.fMethod) {
+		case kStored:
+			if (e.fCompressedSize != e.fSize) return false;
+			content.assign ((const char*)data, e.fSize);
+			break;
+		case kDeflated: {
+			if ((e.fSize > kMaxEntrySize) || (e.fSize / kMaxRatio > e.fCompressedSize)) return false;
+			content.reserve (e.fSize + 2);		// + 2 to let the caller add the null bytes expected by the parser
+			// inflating stops as soon as the output would exceed the expected size
+			inflater in (data, e.fCompressedSize, content, e.fSize);
+			if (!in.run()) {
+				content.clear();
+				return false;
+			}
+			break;
+		}
+		default:
+			return false;
+	}
+	return (content.size() == e.fSize) && (crc32 (content) == e.fCrc);
+}
+
+}
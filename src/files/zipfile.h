@@ -0,0 +1,83 @@
+/*
+  MusicXML Library
+  Copyright (C) Grame 2006-2013
+
+  This Source Code Form is subject to the terms of the Mozilla Public
+  License, v. 2.0. If a copy of the MPL was not distributed with this
+  file, You can obtain one at http://mozilla.org/MPL/2.0/.
+
+  Grame Research Laboratory, 11, cours de Verdun Gensoul 69002 Lyon - France
+  research@grame.fr
+*/
+
+#ifndef __zipfile__
+#define __zipfile__
+
+#include <cstddef>
+#include <string>
+#include <vector>
+
+#ifdef WIN32
+#pragma warning (disable : 4251)
+#endif
+
+#include "exports.h"
+
+namespace MusicXML2
+{
+
+/*!
+\brief a read only access to a ZIP archive held in memory
+
+	Used to read compressed MusicXML files (.mxl). Entries may be stored or
+	deflated, which are the methods used by MusicXML applications; encrypted
+	entries and ZIP64 archives are not supported.
+	The archive data must remain valid during the zipfile lifetime.
+*/
+//______________________________________________________________________________
+class EXP zipfile
+{
+	struct entry {
+		std::string	fName;
+		unsigned	fMethod;
+		unsigned	fFlags;
+		unsigned long fCrc;
+		size_t		fCompressedSize;
+		size_t		fSize;
+		size_t		fOffset;		// the local header offset
+	};
+
+	const unsigned char*	fData;
+	size_t					fSize;
+	std::vector<entry>		fEntries;
+
+	bool	readDirectory ();
+
+	public:
+				 zipfile (const char* data, size_t size);
+		virtual ~zipfile() {}
+
+		//! checks for a ZIP archive signature
+		static bool isZip (const char* data, size_t size);
+
+		//! false when the archive directory can't be read
+		bool	valid () const					{ return fEntries.size() != 0; }
+		//! the number of entries in the archive
+		size_t	entries () const				{ return fEntries.size(); }
+		//! the name of an entry
+		const std::string& name (size_t i) const	{ return fEntries[i].fName; }
+
+		/*!
+		\brief uncompresses an entry
+		\param name the entry name
+		\param content on output, the entry content
+		\return false when the entry is not found or can't be uncompressed, which includes
+		entries larger than their size in the archive directory or larger than 512 MB
+		*/
+		bool	extract (const std::string& name, std::string& content) const;
+		bool	extract (size_t i, std::string& content) const;
+};
+
+}
+
+#endif
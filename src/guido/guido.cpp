@@ -40,7 +40,7 @@ Sguidotag guidotag::create(string name)	{ guidotag* o = new guidotag(name); asse
 Sguidotag guidotag::create(string name, string sep)	{ guidotag* o = new guidotag(name, sep); assert(o!=0); return o;}
 
 //______________________________________________________________________________
-guidonotestatus* guidonotestatus::fInstances[kMaxInstances] = { 0 };
+thread_local guidonotestatus* guidonotestatus::fInstances[kMaxInstances] = { 0 };
 guidonotestatus* guidonotestatus::get (unsigned short voice)
 { 
     if (voice < kMaxInstances) {
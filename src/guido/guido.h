@@ -217,7 +217,7 @@ class EXP guidonotestatus {
 	protected:
 		guidonotestatus() :	fOctave(defoctave), fDur(defnum, defdenom, 0) {}
 	private:
-		static guidonotestatus * fInstances[kMaxInstances];
+		static thread_local guidonotestatus * fInstances[kMaxInstances];	// per thread, for concurrent conversions
 };
 
 /*!
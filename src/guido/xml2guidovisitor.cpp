@@ -14,9 +14,11 @@
 # pragma warning (disable : 4786)
 #endif
 
+#include <atomic>
 #include <iostream>
 #include <sstream>
 #include <string>
+#include <thread>
 
 #include "partsummary.h"
 #include "rational.h"
@@ -34,9 +36,8 @@ namespace MusicXML2
     xml2guidovisitor::xml2guidovisitor(bool generateComments, bool generateStem, bool generateBar, int partNum) :
     fGenerateComments(generateComments), fGenerateStem(generateStem),
     fGenerateBars(generateBar), fGeneratePositions(true),
-    fCurrentStaffIndex(0), previousStaffHasLyrics(false), fCurrentAccoladeIndex(0), fPartNum(partNum), defaultStaffDistance(0), defaultGuidoStaffDistance(1)
+    fCurrentStaffIndex(0), fThreads(1), previousStaffHasLyrics(false), fCurrentAccoladeIndex(0), fPartNum(partNum), defaultStaffDistance(0), defaultGuidoStaffDistance(1)
     {
-        timePositions.clear();
     }
     
     //______________________________________________________________________________
@@ -46,6 +47,7 @@ namespace MusicXML2
         if (xml) {
             tree_browser<xmlelement> browser(this);
             browser.browse(*xml);
+            if (fParts.size()) convertParts();
             gmn = current();
         }
         return gmn;
@@ -72,7 +74,7 @@ namespace MusicXML2
         }
         vector<S_creator>::const_iterator i;
         for (i=header.fCreators.begin(); i!=header.fCreators.end(); i++) {
-            string type = (*i)->getAttributeValue("type");
+            string type = (*i)->getAttributeValue(attributeNames::type);
             if ((type == "Composer") || (type == "composer")) {
                 Sguidoelement tag = guidotag::create("composer");
                 tag->add (guidoparam::create((*i)->getValue()));
@@ -187,7 +189,7 @@ namespace MusicXML2
     //______________________________________________________________________________
     void xml2guidovisitor::visitStart ( S_movement_title& elt )		{ fHeader.fTitle = elt; }
     void xml2guidovisitor::visitStart ( S_creator& elt )			{ fHeader.fCreators.push_back(elt); }
-    //void xml2guidovisitor::visitStart ( S_score_part& elt )			{ fCurrentPartID = elt->getAttributeValue("id"); }
+    //void xml2guidovisitor::visitStart ( S_score_part& elt )			{ fCurrentPartID = elt->getAttributeValue(attributeNames::id); }
     //void xml2guidovisitor::visitStart ( S_part_name& elt )			{ fPartHeaders[fCurrentPartID].fPartName = elt; }
     
     //______________________________________________________________________________
@@ -197,60 +199,120 @@ namespace MusicXML2
         if (fPartNum != 0) {
             std::stringstream s;
             s << "P"<<fPartNum;
-            std::string thisPart = elt->getAttributeValue("id");
+            std::string thisPart = elt->getAttributeValue(attributeNames::id);
             if ( thisPart != s.str() ) {
                 return;
             }
         }
         
+        partConversion part;
+        prepare (elt, part);
+        if (fThreads == 1) {
+            convertVoices (part);
+            flushPart (part);
+        }
+        // the parts are converted in parallel at the end of the score (see convert())
+        else fParts.push_back (part);
+    }
+    
+    //______________________________________________________________________________
+    // computes the voices to convert and the guido staves indexes
+    void xml2guidovisitor::prepare ( S_part& elt, partConversion& part )
+    {
         partsummary ps;
         xml_tree_browser browser(&ps);
         browser.browse(*elt);
         
+        part.fPart = elt;
+        part.fStavesCount = ps.countStaves();
+        part.fStaffDistances = ps.fStaffDistances;
+        
         smartlist<int>::ptr voices = ps.getVoices ();
         int targetStaff = 0xffff;	// initialized to a value we'll unlikely encounter
-        bool notesOnly = false;
-        rational currentTimeSign (0,1);
-        
-        staffClefMap.clear();
-        //timePositions.clear();
         
         // browse the parts voice by voice: allows to describe voices that spans over several staves
         for (unsigned int i = 0; i < voices->size(); i++) {
-            int targetVoice = (*voices)[i];
-            int mainstaff = ps.getMainStaff(targetVoice);
+            voiceConversion voice;
+            voice.fVoice = (*voices)[i];
+            int mainstaff = ps.getMainStaff(voice.fVoice);
             if (targetStaff == mainstaff) {
-                notesOnly = true;
+                voice.fNotesOnly = true;
             }
             else {
-                notesOnly = false;
+                voice.fNotesOnly = false;
                 targetStaff = mainstaff;
                 fCurrentStaffIndex++;
-                /// Clear timePositions so that we only track voices on a specific Staff
-                timePositions.clear();
             }
+            voice.fStaff = targetStaff;
+            voice.fStaffIndex = fCurrentStaffIndex;
+            voice.fHasLyrics = false;
+            part.fVoices.push_back (voice);
+        }
+    }
+    
+    //______________________________________________________________________________
+    // converts the voices of a part: the voices are converted in sequence since they
+    // share the clefs, time positions and time signature state, but different parts
+    // are independent: this method is thread safe.
+    void xml2guidovisitor::convertVoices ( partConversion& part ) const
+    {
+        rational currentTimeSign (0,1);
+        /// multimap containing <staff-num, measureNum, position, clef type>
+        std::multimap<int,  std::pair< int, std::pair< rational, string > > > staffClefMap;
+        /// Containing default-x positions on a fCurrentVoicePosition (rational) of measure(int)
+        std::map< int, std::map< rational, std::vector<int> > > timePositions;
+        
+        for (unsigned int i = 0; i < part.fVoices.size(); i++) {
+            voiceConversion& voice = part.fVoices[i];
+            /// Clear timePositions so that we only track voices on a specific Staff
+            if (!voice.fNotesOnly) timePositions.clear();
+            
+            //// Browse XML and convert
+            voice.fContent = guidoseq::create();
+            xmlpart2guido pv(fGenerateComments, fGenerateStem, fGenerateBars);
+            pv.generatePositions (fGeneratePositions);
+            xml_tree_browser browser(&pv);
+            pv.initialize(voice.fContent, voice.fStaff, voice.fStaffIndex, voice.fVoice, voice.fNotesOnly, currentTimeSign);
+            pv.staffClefMap = staffClefMap;
+            pv.timePositions = timePositions;
+            browser.browse(*part.fPart);
+            currentTimeSign = pv.getTimeSign();
+            voice.fHasLyrics = pv.hasLyrics();
+            staffClefMap = pv.staffClefMap;
+            timePositions = pv.timePositions;
+        }
+    }
+    
+    //______________________________________________________________________________
+    // adds the converted voices to the score, preceded by the staff settings
+    void xml2guidovisitor::flushPart ( partConversion& part )
+    {
+        S_part elt = part.fPart;
+        for (unsigned int i = 0; i < part.fVoices.size(); i++) {
+            voiceConversion& voice = part.fVoices[i];
+            int targetStaff = voice.fStaff;
             
             Sguidoelement seq = guidoseq::create();
             push (seq);
             
             Sguidoelement tag = guidotag::create("staff");
-            tag->add (guidoparam::create(fCurrentStaffIndex, false));
+            tag->add (guidoparam::create(voice.fStaffIndex, false));
             add (tag);
                         
             //// Add staffFormat if needed
             // Case1: If previous staff has Lyrics, then move current staff lower to create space: \staffFormat<dy=-5>
             int stafflines = elt->getIntValue(k_staff_lines, 0);
             
-            if ((previousStaffHasLyrics)||stafflines||defaultGuidoStaffDistance||ps.fStaffDistances.size())
+            if ((previousStaffHasLyrics)||stafflines||defaultGuidoStaffDistance||part.fStaffDistances.size())
             {
                 Sguidoelement tag2 = guidotag::create("staffFormat");
                 if (previousStaffHasLyrics)
                 {
                     tag2->add (guidoparam::create("dy=-5", false));
-                }else if (ps.fStaffDistances.size()> (targetStaff-1)) {
+                }else if (part.fStaffDistances.size()> (targetStaff-1)) {
                     
-                    if (ps.fStaffDistances[targetStaff-1] > 0) {
-                        float xmlDistance = ps.fStaffDistances[targetStaff-1] - 50.0;
+                    if (part.fStaffDistances[targetStaff-1] > 0) {
+                        float xmlDistance = part.fStaffDistances[targetStaff-1] - 50.0;
                         float HalfSpaceDistance = -1.0 * (xmlDistance / 10) * 2 ; // -1.0 for Guido scale // (pos/10)*2
                     
                         stringstream s;
@@ -274,18 +336,18 @@ namespace MusicXML2
             ////
             
             flushHeader (fHeader);
-            flushPartHeader (fPartHeaders[elt->getAttributeValue("id")]);
-            flushPartGroup  (elt->getAttributeValue("id"));
+            flushPartHeader (fPartHeaders[elt->getAttributeValue(attributeNames::id)]);
+            flushPartGroup  (elt->getAttributeValue(attributeNames::id));
             
             //// Add Accolade if countStaves on this Part is >1, and we are entering span
-            if ((ps.countStaves()>1)&&(fCurrentStaffIndex>fCurrentAccoladeIndex))
+            if ((part.fStavesCount>1)&&(voice.fStaffIndex>fCurrentAccoladeIndex))
             {
-                int rangeEnd = fCurrentStaffIndex + ps.countStaves() - 1;
+                int rangeEnd = voice.fStaffIndex + part.fStavesCount - 1;
 
 				stringstream accol;
-				accol << "id=" << fCurrentAccoladeIndex << ", range=\"" << fCurrentStaffIndex << "-" << rangeEnd << "\"";
+				accol << "id=" << fCurrentAccoladeIndex << ", range=\"" << voice.fStaffIndex << "-" << rangeEnd << "\"";
 				stringstream barformat;
-				barformat << "style= \"system\", range=\"" << fCurrentStaffIndex << "-" << rangeEnd << "\"";
+				barformat << "style= \"system\", range=\"" << voice.fStaffIndex << "-" << rangeEnd << "\"";
 				
                 Sguidoelement tag3 = guidotag::create("accol");
                 tag3->add (guidoparam::create(accol.str(), false));
@@ -301,10 +363,10 @@ namespace MusicXML2
                 
                 // if we have multiple staves, and this staff has NO barFormat, then we should add one like \barFormat<style="system", range="1">
                 // Otherwise there'll be no bar lines!!!
-                if (checkLonelyBarFormat(fCurrentStaffIndex))
+                if (checkLonelyBarFormat(voice.fStaffIndex))
                 {
 					stringstream barformat;
-					barformat << "style= \"system\", range=\"" << fCurrentStaffIndex << "\"";
+					barformat << "style= \"system\", range=\"" << voice.fStaffIndex << "\"";
                     Sguidoelement tag4 = guidotag::create("barFormat");
                     tag4->add (guidoparam::create(barformat.str(), false));
                     add (tag4);
@@ -313,33 +375,53 @@ namespace MusicXML2
             
             ////
             
-            //// Browse XML and convert
-            xmlpart2guido pv(fGenerateComments, fGenerateStem, fGenerateBars);
-            pv.generatePositions (fGeneratePositions);
-            xml_tree_browser browser(&pv);
-            pv.initialize(seq, targetStaff, fCurrentStaffIndex, targetVoice, notesOnly, currentTimeSign);
-            pv.staffClefMap = staffClefMap;
-            pv.timePositions = timePositions;
-            browser.browse(*elt);
+            // the voice content follows the staff settings
+            vector<Sguidoelement>& content = voice.fContent->elements();
+            for (vector<Sguidoelement>::iterator e = content.begin(); e != content.end(); e++)
+                seq->add (*e);
+            voice.fContent = Sguidoelement();
             pop();
-            currentTimeSign = pv.getTimeSign();
-            previousStaffHasLyrics = pv.hasLyrics();
-            staffClefMap = pv.staffClefMap;
-            timePositions = pv.timePositions;
+            previousStaffHasLyrics = voice.fHasLyrics;
         }
     }
     
+    //______________________________________________________________________________
+    // converts the pending parts on a pool of threads and adds them to the score in order
+    void xml2guidovisitor::convertParts ()
+    {
+        size_t threads = fThreads > 0 ? fThreads : std::thread::hardware_concurrency();
+        if (threads > fParts.size()) threads = fParts.size();
+        
+        std::atomic<size_t> next (0);
+        auto worker = [this, &next] () {
+            size_t i;
+            while ((i = next++) < fParts.size())
+                convertVoices (fParts[i]);
+            guidonotestatus::freeall();		// the notes status is thread local
+        };
+        std::vector<std::thread> pool;
+        for (size_t i = 1; i < threads; i++)
+            pool.push_back (std::thread(worker));
+        worker();
+        for (size_t i = 0; i < pool.size(); i++)
+            pool[i].join();
+        
+        for (size_t i = 0; i < fParts.size(); i++)
+            flushPart (fParts[i]);
+        fParts.clear();
+    }
+    
     //______________________________________________________________________________
     void xml2guidovisitor::addPosition	( Sxmlelement elt, Sguidoelement& tag, int yoffset)
     {
-        float posx = elt->getAttributeFloatValue("default-x", 0) + elt->getAttributeFloatValue("relative-x", 0);
+        float posx = elt->getAttributeFloatValue(attributeNames::default_x, 0) + elt->getAttributeFloatValue(attributeNames::relative_x, 0);
         if (posx) {
             posx = (posx / 10) * 2;   // convert to half spaces
             stringstream s;
             s << "dx=" << posx << "hs";
             tag->add (guidoparam::create(s.str(), false));
         }
-        float posy = elt->getAttributeFloatValue("default-y", 0) + elt->getAttributeFloatValue("relative-y", 0);
+        float posy = elt->getAttributeFloatValue(attributeNames::default_y, 0) + elt->getAttributeFloatValue(attributeNames::relative_y, 0);
         if (posy) {
             posy = (posy / 10) * 2;   // convert to half spaces
             posy += yoffset;		  // anchor point convertion (defaults to upper line in xml)
@@ -352,7 +434,7 @@ namespace MusicXML2
     //______________________________________________________________________________
     void xml2guidovisitor::addPosition	( Sxmlelement elt, Sguidoelement& tag, int yoffset, int xoffset)
     {
-        float posx = elt->getAttributeFloatValue("default-x", 0) + elt->getAttributeFloatValue("relative-x", 0);
+        float posx = elt->getAttributeFloatValue(attributeNames::default_x, 0) + elt->getAttributeFloatValue(attributeNames::relative_x, 0);
         if (posx) {
             posx = (posx / 10) * 2;   // convert to half spaces
             posx += xoffset;
@@ -360,7 +442,7 @@ namespace MusicXML2
             s << "dx=" << posx << "hs";
             tag->add (guidoparam::create(s.str(), false));
         }
-        float posy = elt->getAttributeFloatValue("default-y", 0) + elt->getAttributeFloatValue("relative-y", 0);
+        float posy = elt->getAttributeFloatValue(attributeNames::default_y, 0) + elt->getAttributeFloatValue(attributeNames::relative_y, 0);
         if (posy) {
             posy = (posy / 10) * 2;   // convert to half spaces
             posy += yoffset;		  // anchor point convertion (defaults to upper line in xml)
@@ -373,7 +455,7 @@ namespace MusicXML2
     //______________________________________________________________________________
     void xml2guidovisitor::addPosY	( Sxmlelement elt, Sguidoelement& tag, int yoffset, int ymultiplier = 1.0)
     {
-        float posy = elt->getAttributeFloatValue("default-y", 0) + elt->getAttributeFloatValue("relative-y", 0);
+        float posy = elt->getAttributeFloatValue(attributeNames::default_y, 0) + elt->getAttributeFloatValue(attributeNames::relative_y, 0);
         if (posy) {
             posy = (posy / 10) * 2;   // convert to half spaces
             posy += yoffset;		  // anchor point convertion (defaults to upper line in xml)
@@ -386,7 +468,7 @@ namespace MusicXML2
     
     void xml2guidovisitor::addPlacement	( Sxmlelement elt, Sguidoelement& tag)
     {
-        string placement = elt->getAttributeValue("placement");
+        string placement = elt->getAttributeValue(attributeNames::placement);
         
         if (placement.size()) {
             
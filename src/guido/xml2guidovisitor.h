@@ -17,6 +17,7 @@
 #include <stack>
 #include <map>
 #include <string>
+#include <vector>
 
 #include "exports.h"
 #include "guido.h"
@@ -80,6 +81,30 @@ class EXP xml2guidovisitor :
 	void flushPartHeader ( partHeader& header );
     void flushPartGroup (std::string partID);
 
+	// a voice conversion: the voice content is converted apart from the staff settings
+	struct voiceConversion {
+		int				fVoice, fStaff, fStaffIndex;
+		bool			fNotesOnly;
+		Sguidoelement	fContent;
+		bool			fHasLyrics;
+	};
+
+	// a part conversion: parts are independent and may be converted concurrently
+	struct partConversion {
+		S_part					fPart;
+		int						fStavesCount;
+		std::map<int, int>		fStaffDistances;
+		std::vector<voiceConversion> fVoices;
+	};
+
+	int							fThreads;	// the number of threads used to convert the parts
+	std::vector<partConversion>	fParts;		// the parts waiting for a parallel conversion
+
+	void prepare		(S_part& elt, partConversion& part);
+	void convertVoices	(partConversion& part) const;
+	void flushPart		(partConversion& part);
+	void convertParts	();
+
 	protected:
 
 		virtual void visitStart( S_score_partwise& elt);
@@ -99,13 +124,6 @@ class EXP xml2guidovisitor :
     
     int defaultStaffDistance;   // xml staff-distance value in defaults
     int defaultGuidoStaffDistance;  // the above converted to Guido value
-    
-    /// multimap containing <staff-num, measureNum, position, clef type>
-    //std::multimap<int, std::pair< rational, string > > staffClefMap;
-    std::multimap<int,  std::pair< int, std::pair< rational, string > > > staffClefMap;
-
-    /// Containing default-x positions on a fCurrentVoicePosition (rational) of measure(int)
-    std::map< int, std::map< rational, std::vector<int> > > timePositions;
 
 
     public:
@@ -118,6 +136,10 @@ class EXP xml2guidovisitor :
 		// ie converts relative-x/-y into dx/dy attributes
 		void generatePositions (bool state)		{ fGeneratePositions = state; }
 
+		// sets the number of threads used to convert the parts (0 for the hardware concurrency)
+		// the output is the same than the sequential conversion (the default)
+		void parallel (int threads)				{ fThreads = threads; }
+
     static void addPosition	 ( Sxmlelement elt, Sguidoelement& tag, int yoffset);
 	static void addPosition	 ( Sxmlelement elt, Sguidoelement& tag, int yoffset, int xoffset);
     static void addPosY	( Sxmlelement elt, Sguidoelement& tag, int yoffset, int ymultiplier);
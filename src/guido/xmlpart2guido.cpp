@@ -139,7 +139,6 @@ namespace MusicXML2
                 Sguidoelement note = guidonote::create(fTargetVoice, "empty", 0, dur, "");
                 add (note);
                 fCurrentVoicePosition += durationInCue;
-                fCurrentVoicePosition.rationalise();
             }
             
             durationInCue = 0;
@@ -177,12 +176,10 @@ namespace MusicXML2
         rational r(duration, fCurrentDivision*4);
         r.rationalise();
         fCurrentMeasurePosition += r;
-        fCurrentMeasurePosition.rationalise();
         if (fCurrentMeasurePosition > fCurrentMeasureLength)
             fCurrentMeasureLength = fCurrentMeasurePosition;
         if (moveVoiceToo) {
             fCurrentVoicePosition += r;
-            fCurrentVoicePosition.rationalise();
         }
     }
     
@@ -193,13 +190,11 @@ namespace MusicXML2
     void xmlpart2guido::checkVoiceTime ( const rational& currTime, const rational& voiceTime)
     {
         rational diff = currTime - voiceTime;
-        diff.rationalise();
         if (diff.getNumerator() > 0) {
             guidonoteduration dur (diff.getNumerator(), diff.getDenominator());
             Sguidoelement note = guidonote::create(fTargetVoice, "empty", 0, dur, "");
             add (note);
             fCurrentVoicePosition += diff;
-            fCurrentVoicePosition.rationalise();
         }
         else if (diff.getNumerator() < 0)
         {
@@ -261,7 +256,7 @@ namespace MusicXML2
         if (fPendingBar) {
             // before adding a bar, we need to check that there are no repeat begin at this location
             ctree<xmlelement>::iterator repeat = elt->find(k_repeat);
-            if ((repeat == elt->end()) || (repeat->getAttributeValue("direction") != "forward")) {
+            if ((repeat == elt->end()) || (repeat->getAttributeValue(attributeNames::direction) != "forward")) {
                 checkStaff (fTargetStaff);
                 
                 Sguidoelement tag;
@@ -330,7 +325,7 @@ namespace MusicXML2
             fCurrentOffset = elt->getLongValue(k_offset, 0);
         }
         
-        string placement = elt->getAttributeValue("placement");
+        string placement = elt->getAttributeValue(attributeNames::placement);
         if (placement == "above")
         {
             directionPlacementAbove = true;
@@ -532,7 +527,7 @@ namespace MusicXML2
         
         bool wedgeStart = false;
         
-        string type = elt->getAttributeValue("type");
+        string type = elt->getAttributeValue(attributeNames::type);
         Sguidoelement tag;
         if (type == "crescendo") {
             tag = guidotag::create("crescBegin");
@@ -571,23 +566,23 @@ namespace MusicXML2
             }else if (type == "crescendo")
             {
                 ctree<xmlelement>::iterator nextevent = find(fCurrentPart->begin(), fCurrentPart->end(), elt);
-                int crescendoNumber = elt->getAttributeIntValue("number", 1);   // default is 1 for wedge!
+                int crescendoNumber = elt->getAttributeIntValue(attributeNames::number, 1);   // default is 1 for wedge!
                 
                 nextevent++;    // advance one step
                 
                 // find next S_direction in measure
                 ctree<xmlelement>::iterator nextWedge = fCurrentMeasure->find(k_wedge, nextevent);
                 
-                while ( ( nextWedge->getAttributeIntValue("number", 1) != crescendoNumber)
+                while ( ( nextWedge->getAttributeIntValue(attributeNames::number, 1) != crescendoNumber)
                        &&
-                       (nextWedge->getAttributeValue("type")!="stop") )
+                       (nextWedge->getAttributeValue(attributeNames::type)!="stop") )
                 {
                     nextWedge = fCurrentMeasure->find(k_wedge, nextevent++);
                 }
                 
                 /// fetch dx1 and dx2 value based on ending
-                float posx2 = nextWedge->getAttributeFloatValue("relative-x", 0);
-                float posx1 = elt->getAttributeFloatValue("relative-x", 0);  //elt->getAttributeFloatValue("default-x", 0) +
+                float posx2 = nextWedge->getAttributeFloatValue(attributeNames::relative_x, 0);
+                float posx1 = elt->getAttributeFloatValue(attributeNames::relative_x, 0);  //elt->getAttributeFloatValue(attributeNames::default_x, 0) +
 
                 if (fCurrentOffset) {
                     /*rational offsetDur(fCurrentOffset, fCurrentDivision);
@@ -601,7 +596,7 @@ namespace MusicXML2
                     
                     auto timePos4measure = timePositions.find(fMeasNum+measureJump);
 
-                    cout<<"Crescendo Begin at "<< fMeasNum<< " default-x="<< elt->getAttributeIntValue("default-x", 0)<< " relative-x="<<elt->getAttributeIntValue("relative-x", 0)<<" Offset="<<fCurrentOffset<<" ENDING: default-x="<< nextWedge->getAttributeIntValue("default-x", 0) << " relative-x="<<nextWedge->getAttributeIntValue("relative-x", 0)<<endl;
+                    cout<<"Crescendo Begin at "<< fMeasNum<< " default-x="<< elt->getAttributeIntValue(attributeNames::default_x, 0)<< " relative-x="<<elt->getAttributeIntValue(attributeNames::relative_x, 0)<<" Offset="<<fCurrentOffset<<" ENDING: default-x="<< nextWedge->getAttributeIntValue(attributeNames::default_x, 0) << " relative-x="<<nextWedge->getAttributeIntValue(attributeNames::relative_x, 0)<<endl;
 
                     cout<<"-----Dealing with offset "<< fCurrentOffset<< " with Division "<< fCurrentDivision<<" measure jump: "<<measureJump<<endl;
 
@@ -668,7 +663,7 @@ namespace MusicXML2
             xml2guidovisitor::addPosY(elt, tag, 12, 1.0);    // removed negative multiplier. Fixed in GuidoLib 1.6.5
             
             // add only RELATIVE-X since it doesn't depend on TimePosition
-            /*float posx = elt->getAttributeFloatValue("relative-x", 0);  //elt->getAttributeFloatValue("default-x", 0) +
+            /*float posx = elt->getAttributeFloatValue(attributeNames::relative_x, 0);  //elt->getAttributeFloatValue(attributeNames::default_x, 0) +
             if (posx && wedgeStart && (type != "diminuendo")) {
                 posx = (posx / 10) * 2;   // convert to half spaces
                 
@@ -735,10 +730,10 @@ namespace MusicXML2
                     //if (fGeneratePositions) xml2guidovisitor::addPosition(elt, tag, 12, 1);  // Avoid using default-x since it is measured from the beginning of the measure for S_direction!
                     /// Infer X-Position from TimePosition
                     
-                    int measureNum = fCurrentMeasure->getAttributeIntValue("number", 0);
+                    int measureNum = fCurrentMeasure->getAttributeIntValue(attributeNames::number, 0);
                     auto timePos4measure = timePositions.find(measureNum);
-                    float intens_default_x =fDynamics->getAttributeFloatValue("default-x", 0);
-                    float intens_relative_x =fDynamics->getAttributeFloatValue("relative-x", 0);
+                    float intens_default_x =fDynamics->getAttributeFloatValue(attributeNames::default_x, 0);
+                    float intens_relative_x =fDynamics->getAttributeFloatValue(attributeNames::relative_x, 0);
                     float intens_xpos = intens_default_x + intens_relative_x;
                     //cout<<"Measure: "<<fMeasNum <<": Got to Intens "<< (*iter)->getName()<<" with default-x="<< intens_default_x<< " relative-x="<<intens_relative_x ;
                     
@@ -806,8 +801,8 @@ namespace MusicXML2
     {
         if (fSkipDirection) return;
         
-        const string& type = elt->getAttributeValue("type");
-        int size = elt->getAttributeIntValue("size", 0);
+        const string& type = elt->getAttributeValue(attributeNames::type);
+        int size = elt->getAttributeIntValue(attributeNames::size, 0);
         
         switch (size) {
             case 8:		size = 1; break;
@@ -860,16 +855,16 @@ namespace MusicXML2
         Sguidoelement tag = 0;
         Sxmlattribute attribute;
         
-        if ((attribute = elt->getAttribute("dacapo")))
+        if ((attribute = elt->getAttribute(attributeNames::dacapo)))
             tag = guidotag::create("daCapo");
         else {
-            if ((attribute = elt->getAttribute("dalsegno"))) {
+            if ((attribute = elt->getAttribute(attributeNames::dalsegno))) {
                 tag = guidotag::create("dalSegno");
             }
-            else if ((attribute = elt->getAttribute("tocoda"))) {
+            else if ((attribute = elt->getAttribute(attributeNames::tocoda))) {
                 tag = guidotag::create("daCoda");
             }
-            else if ((attribute = elt->getAttribute("fine"))) {
+            else if ((attribute = elt->getAttribute(attributeNames::fine))) {
                 tag = guidotag::create("fine");
             }
             //		if (tag) tag->add(guidoparam::create("id="+attribute->getValue(), false));
@@ -880,10 +875,10 @@ namespace MusicXML2
     //______________________________________________________________________________
     void xmlpart2guido::visitEnd ( S_ending& elt )
     {
-        string type = elt->getAttributeValue("type");
+        string type = elt->getAttributeValue(attributeNames::type);
         if (type == "start") {
             Sguidoelement tag = guidotag::create("volta");
-            string num = elt->getAttributeValue ("number");
+            string num = elt->getAttributeValue (attributeNames::number);
             tag->add(guidoparam::create(num, true));
             tag->add(guidoparam::create(num + ".", true));
             push(tag);
@@ -899,7 +894,7 @@ namespace MusicXML2
     void xmlpart2guido::visitEnd ( S_repeat& elt )
     {
         Sguidoelement tag;
-        string direction = elt->getAttributeValue("direction");
+        string direction = elt->getAttributeValue(attributeNames::direction);
         if (direction == "forward")
             tag = guidotag::create("repeatBegin");
         else if (direction == "backward") {
@@ -1013,7 +1008,7 @@ namespace MusicXML2
             int clefoctavechange = iter->getIntValue(k_clef_octave_change, 0);
             
             /// Actions:
-            int staffnum = iter->getAttributeIntValue("number", 0);
+            int staffnum = iter->getAttributeIntValue(attributeNames::number, 0);
             if ((staffnum != fTargetStaff) || fNotesOnly)
             {
                 /// Search again for other clefs:
@@ -1148,7 +1143,7 @@ namespace MusicXML2
             tag->add (guidoparam::create(timesign));
             if (fGenerateBars) tag->add (guidoparam::create("autoBarlines=\"off\"", false));
             if (fGenerateAutoMeasureNum) tag->add (guidoparam::create("autoMeasuresNum=\"system\"", false));
-            if (iter->getAttributeValue("print-object")!="no")
+            if (iter->getAttributeValue(attributeNames::print_object)!="no")
                 add(tag);
         }
     }
@@ -1156,7 +1151,7 @@ namespace MusicXML2
     //______________________________________________________________________________
     void xmlpart2guido::visitEnd ( S_clef& elt )
     {
-        int staffnum = elt->getAttributeIntValue("number", 0);
+        int staffnum = elt->getAttributeIntValue(attributeNames::number, 0);
         if ((staffnum != fTargetStaff) || fNotesOnly) return;
         
         stringstream s;
@@ -1192,7 +1187,7 @@ namespace MusicXML2
     {
         std::vector<S_slur>::const_iterator i;
         for (i = slurs.begin(); i != slurs.end(); i++) {
-            if ((*i)->getAttributeValue("type") == val) break;
+            if ((*i)->getAttributeValue(attributeNames::type) == val) break;
         }
         return i;
     }
@@ -1202,7 +1197,7 @@ namespace MusicXML2
     {
         std::vector<S_tied>::const_iterator i;
         for (i = tied.begin(); i != tied.end(); i++) {
-            if ((*i)->getAttributeValue("type") == val) break;
+            if ((*i)->getAttributeValue(attributeNames::type) == val) break;
         }
         return i;
     }
@@ -1222,12 +1217,12 @@ namespace MusicXML2
     {
         std::vector<S_tied>::const_iterator i;
         for (i = tied.begin(); i != tied.end(); i++) {
-            if ((*i)->getAttributeValue("type") == "start") {
+            if ((*i)->getAttributeValue(attributeNames::type) == "start") {
                 Sguidoelement tag = guidotag::create("tieBegin");
-                string num = (*i)->getAttributeValue ("number");
+                string num = (*i)->getAttributeValue (attributeNames::number);
                 if (num.size())
                     tag->add (guidoparam::create(num, false));
-                string placement = (*i)->getAttributeValue("placement");
+                string placement = (*i)->getAttributeValue(attributeNames::placement);
                 if (placement == "below")
                     tag->add (guidoparam::create("curve=\"down\"", false));
                 add(tag);
@@ -1239,9 +1234,9 @@ namespace MusicXML2
     {
         std::vector<S_tied>::const_iterator i;
         for (i = tied.begin(); i != tied.end(); i++) {
-            if ((*i)->getAttributeValue("type") == "stop") {
+            if ((*i)->getAttributeValue(attributeNames::type) == "stop") {
                 Sguidoelement tag = guidotag::create("tieEnd");
-                string num = (*i)->getAttributeValue ("number");
+                string num = (*i)->getAttributeValue (attributeNames::number);
                 if (num.size())
                     tag->add (guidoparam::create(num, false));
                 add(tag);
@@ -1254,13 +1249,13 @@ namespace MusicXML2
     {
         std::vector<S_slur>::const_iterator i;
         for (i = slurs.begin(); i != slurs.end(); i++) {
-            if ((*i)->getAttributeValue("type") == "start") {
+            if ((*i)->getAttributeValue(attributeNames::type) == "start") {
                 string tagName = "slurBegin";
-                string num = (*i)->getAttributeValue("number");
+                string num = (*i)->getAttributeValue(attributeNames::number);
                 if (num.size()) tagName += ":" + num;
                 Sguidoelement tag = guidotag::create(tagName);
-                string placement = (*i)->getAttributeValue("placement");
-                string orientation = (*i)->getAttributeValue("placement");
+                string placement = (*i)->getAttributeValue(attributeNames::placement);
+                string orientation = (*i)->getAttributeValue(attributeNames::placement);
                 if ((placement == "below")||(orientation=="under"))
                     tag->add (guidoparam::create("curve=\"down\"", false));
                 if ((placement == "above")||(orientation=="over"))
@@ -1274,9 +1269,9 @@ namespace MusicXML2
     {
         std::vector<S_slur>::const_iterator i;
         for (i = slurs.begin(); i != slurs.end(); i++) {
-            if ((*i)->getAttributeValue("type") == "stop") {
+            if ((*i)->getAttributeValue(attributeNames::type) == "stop") {
                 string tagName = "slurEnd";
-                string num = (*i)->getAttributeValue("number");
+                string num = (*i)->getAttributeValue(attributeNames::number);
                 if (num.size()) tagName += ":" + num;
                 Sguidoelement tag = guidotag::create (tagName);
                 add(tag);
@@ -1298,7 +1293,7 @@ namespace MusicXML2
                 std::pair<int, int> toto = fBeamStack.top();
                 lastBeamInternalNumber = toto.first + 1;
             }
-            std::pair<int,int> toto2(lastBeamInternalNumber, (*i)->getAttributeIntValue("number", 0));
+            std::pair<int,int> toto2(lastBeamInternalNumber, (*i)->getAttributeIntValue(attributeNames::number, 0));
             fBeamStack.push(toto2);
             
             /// Using \beamBegin:NUMBER
@@ -1328,7 +1323,7 @@ namespace MusicXML2
         size_t beamStackSizeBeforeClosing = fBeamStack.size();
         for (i = beams.rbegin(); (i != beams.rend() && (!fBeamStack.empty())); i++)
         {
-            if (((*i)->getValue() == "end") && ((*i)->getAttributeIntValue("number", 1) == fBeamStack.top().second)) {
+            if (((*i)->getValue() == "end") && ((*i)->getAttributeIntValue(attributeNames::number, 1) == fBeamStack.top().second)) {
                 // There is a Beam End. create tag and pop from stack
                 int lastBeamInternalNumber = 0;
                 if (!fBeamStack.empty()) {
@@ -1366,7 +1361,7 @@ namespace MusicXML2
         std::vector<S_tuplet>::const_iterator i;
         
         for (i = tuplets.begin(); i != tuplets.end(); i++) {
-            if ( (*i)->getAttributeValue("type") == "start") break;
+            if ( (*i)->getAttributeValue(attributeNames::type) == "start") break;
         }
         
         if (i != tuplets.end()) {
@@ -1374,9 +1369,9 @@ namespace MusicXML2
                 /// Determine whether we need Brackets or not
                 bool withBracket = ((*i)->getAttributeValue("bracket")=="yes");
                 /// Get Tuplet Number
-                int thisTupletNumber = (*i)->getAttributeIntValue("number", 1);
+                int thisTupletNumber = (*i)->getAttributeIntValue(attributeNames::number, 1);
                 /// Get Tuplet Placement and graphic type
-                std::string tupletPlacement = (*i)->getAttributeValue("placement");
+                std::string tupletPlacement = (*i)->getAttributeValue(attributeNames::placement);
                 std::string tupletGraphicType = nv.fGraphicType;
                 long numberOfEventsInTuplet = 1;
                 
@@ -1412,8 +1407,8 @@ namespace MusicXML2
                             if (iterTuplet != iter->end())
                             {
                                 // There is a tuplet tag!
-                                int newTupletNumber = iterTuplet->getAttributeIntValue("number", 0);
-                                if ((iterTuplet->getAttributeValue("type")=="stop")&&(newTupletNumber==thisTupletNumber))
+                                int newTupletNumber = iterTuplet->getAttributeIntValue(attributeNames::number, 0);
+                                if ((iterTuplet->getAttributeValue(attributeNames::type)=="stop")&&(newTupletNumber==thisTupletNumber))
                                 {
                                     break;
                                 }
@@ -1510,7 +1505,7 @@ namespace MusicXML2
     {
         std::vector<S_tuplet>::const_iterator i;
         for (i = tuplets.begin(); (i != tuplets.end()) && fTupletOpened; i++) {
-            if (((*i)->getAttributeValue("type") == "stop") && ((*i)->getAttributeIntValue("number", 1) == fCurrentTupletNumber)) {
+            if (((*i)->getAttributeValue(attributeNames::type) == "stop") && ((*i)->getAttributeIntValue(attributeNames::number, 1) == fCurrentTupletNumber)) {
                 fCurrentTupletNumber = 0;
                 pop();
                 fTupletOpened = false;
@@ -1767,7 +1762,7 @@ namespace MusicXML2
             {
                 std::vector<S_wavy_line>::const_iterator i;
                 for (i = nv.getWavylines().begin(); i != nv.getWavylines().end(); i++) {
-                    if ((*i)->getAttributeValue("type") == "start") {
+                    if ((*i)->getAttributeValue(attributeNames::type) == "start") {
                         fWavyTrillOpened = true;
                     }
                 }
@@ -1788,7 +1783,7 @@ namespace MusicXML2
         {
             std::vector<S_wavy_line>::const_iterator i;
             for (i = nv.getWavylines().begin(); i != nv.getWavylines().end(); i++) {
-                if ((*i)->getAttributeValue("type") == "stop") {
+                if ((*i)->getAttributeValue(attributeNames::type) == "stop") {
                     fWavyTrillOpened = false;
                 }
             }
@@ -1847,7 +1842,7 @@ namespace MusicXML2
         }
         
         if (note.fTremolo) {
-            std::string tremType = note.fTremolo->getAttributeValue("type");
+            std::string tremType = note.fTremolo->getAttributeValue(attributeNames::type);
             if (tremType == "single") {
                 tag = guidotag::create("trem");
                 // trem style is the number int value
@@ -1922,7 +1917,6 @@ namespace MusicXML2
                 Sguidoelement note = guidonote::create(fTargetVoice, "empty", 0, dur, "");
                 add (note);
                 fCurrentVoicePosition += durationInCue;
-                fCurrentVoicePosition.rationalise();
             }
             
             durationInCue = 0;
@@ -2021,7 +2015,6 @@ namespace MusicXML2
                 r.rationalise();
                 rational tm = nv.getTimeModification();
                 r *= tm;
-                r.rationalise();
                 dur.set (r.getNumerator(), r.getDenominator(), nv.getDots());
             }
         }
@@ -2032,7 +2025,6 @@ namespace MusicXML2
             r.rationalise();
             rational tm = nv.getTimeModification();
             r *= tm;
-            r.rationalise();
             dur.set (r.getNumerator(), r.getDenominator(), nv.getDots());
         }
         return dur;
@@ -2061,7 +2053,7 @@ namespace MusicXML2
         
         /// Add Note head of X offset for note if necessary
         bool noteFormat = false;
-        int measureNum = fCurrentMeasure->getAttributeIntValue("number", 0);
+        int measureNum = fCurrentMeasure->getAttributeIntValue(attributeNames::number, 0);
         auto timePos4measure = timePositions.find(measureNum);
         if ( (nv.fNotehead
              || ((timePos4measure != timePositions.end()) ) )             // if we need to infer default-x
@@ -2117,7 +2109,7 @@ namespace MusicXML2
     
     int xmlpart2guido::checkNoteFormatDx	 ( const notevisitor& nv , rational posInMeasure)
     {
-        int measureNum = fCurrentMeasure->getAttributeIntValue("number", 0);
+        int measureNum = fCurrentMeasure->getAttributeIntValue(attributeNames::number, 0);
         auto timePos4measure = timePositions.find(measureNum);
         
         if ( timePos4measure != timePositions.end())
@@ -2203,7 +2195,7 @@ namespace MusicXML2
             //////// Track all voice default-x parameters, as positions in measures
 
             if (true) {     // had fNotesOnly
-                int measureNum = fCurrentMeasure->getAttributeIntValue("number", 0);
+                int measureNum = fCurrentMeasure->getAttributeIntValue(attributeNames::number, 0);
                 auto timePos4measure = timePositions.find(measureNum);
                 if (notevisitor::x_default != -1) {
                     if ( timePos4measure !=  timePositions.end())
@@ -15,6 +15,7 @@
 #include "libmusicxml.h"
 #include "musicxmlfactory.h"
 #include "versions.h"
+#include "xmlcache.h"
 
 using namespace std;
 namespace MusicXML2
@@ -28,6 +29,8 @@ EXP float   musicxml2lilypondVersion()      { return versions::xml2lilypondVersi
 EXP const char* musicxml2lilypondVersionStr()   { return versions::xml2lilypondVersionStr(); }
 //EXP int     musicxml2antescofoVersion()     { return versions::xml2antescofoVersion(); }
 //EXP const char* musicxml2antescofoVersionStr()    { return versions::xml2antescofoVersionStr(); }
+
+EXP void  musicxmlCacheDirectory(const char* dir) { xmlcache::setDefaultDirectory (dir ? dir : ""); }
  
 
 //------------------------------------------------------------------------
@@ -51,6 +51,16 @@ EXP float       musicxmllibVersion();
 */
 EXP const char*   musicxmllibVersionStr();
 
+/*!
+  \brief Sets the directory of the parsed files cache.
+
+  When set, the conversion functions taking a file name read the file from
+  the cache when it has already been parsed, and add it to the cache otherwise
+  (see xmlcache). The cache entries are keyed by the file content.
+  \param directory the cache directory, an empty string or null disables the cache (the default)
+*/
+EXP void        musicxmlCacheDirectory(const char* directory);
+
 
 /*!
 \addtogroup Converting MusicXML to Guido Music Notation format
@@ -122,6 +132,16 @@ EXP xmlErr      musicxmlstring2guido(const char *buff, bool generateBars, std::o
  */
 EXP xmlErr      musicxmlstring2guidoOnPart(const char * buffer, bool generateBars, int partFilter, std::ostream& out);
 
+/*!
+ \brief Sets the number of threads used by the Guido converter
+ 
+ The parts of a score are converted concurrently. The output is the same than
+ the sequential conversion, which is the default.
+ 
+ \param threads the number of threads: 1 for a sequential conversion, 0 to use all the available cores
+ */
+EXP void        musicxml2guidoThreads(int threads);
+
 /*! @} */
 
 
@@ -51,12 +51,12 @@ void generateLilypondCodeFromLpsrScore (
     "%--------------------------------------------------------------";
 
 #ifdef TRACE_OPTIONS
-  if (gTraceOptions->fTracePasses) {
+  if (gTraceOptions ()->fTracePasses) {
     logIOstream <<
       endl <<
       separator <<
       endl <<
-      gTab <<
+      gTab () <<
       "Pass 4: writing the LPSR as LilyPond code" <<
       endl <<
       separator <<
@@ -76,10 +76,13 @@ void generateLilypondCodeFromLpsrScore (
   // build the LPSR score    
   translator.generateLilypondCodeFromLpsrScore ();
 
+  // write the remaining LilyPond code if the stream is buffered
+  lilypondCodeIOstream.flush ();
+
   clock_t endClock = clock ();
 
   // register time spent
-  timing::gTiming.appendTimingItem (
+  gTiming ().appendTimingItem (
     "Pass 4",
     "translate LPSR to LilyPond",
     timingItem::kMandatory,
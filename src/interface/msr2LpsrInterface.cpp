@@ -50,9 +50,11 @@ S_lpsrScore buildLpsrScoreFromMsrScore (
     "mScore is null");
     
   clock_t startClock = clock ();
+
+  long startPeakMemoryKB = timing::peakMemoryKB ();
       
 #ifdef TRACE_OPTIONS
-  if (gTraceOptions->fTracePasses) {
+  if (gTraceOptions ()->fTracePasses) {
     string separator =
       "%--------------------------------------------------------------";
   
@@ -60,7 +62,7 @@ S_lpsrScore buildLpsrScoreFromMsrScore (
       endl <<
       separator <<
       endl <<
-      gTab <<
+      gTab () <<
       "Pass 3: translating the MSR into a LPSR" <<
       endl <<
       separator <<
@@ -79,13 +81,18 @@ S_lpsrScore buildLpsrScoreFromMsrScore (
 
   clock_t endClock = clock ();
 
-  // register time spent
-  timing::gTiming.appendTimingItem (
+  long endPeakMemoryKB = timing::peakMemoryKB ();
+
+  // register time spent and memory used
+  gTiming ().appendTimingItem (
     "Pass 3",
     "translate MSR to LPSR",
     timingItem::kMandatory,
     startClock,
-    endClock);
+    endClock,
+    startPeakMemoryKB >= 0
+      ? endPeakMemoryKB - startPeakMemoryKB
+      : -1);
 
   // get the LPSR score
   S_lpsrScore
@@ -116,7 +123,7 @@ void displayLpsrScore (
   logIOstream <<
     separator <<
     endl <<
-    gTab <<
+    gTab () <<
     "Optional pass: displaying the LPSR as text" <<
     endl <<
     separator <<
@@ -130,7 +137,7 @@ void displayLpsrScore (
   clock_t endClock = clock ();
 
   // register time spent
-  timing::gTiming.appendTimingItem (
+  gTiming ().appendTimingItem (
     "",
     "display the LPSR",
     timingItem::kOptional,
@@ -15,20 +15,13 @@
 #endif
 
 #include <string.h> // for strlen()
-#include <regex>
 
 #include <iomanip> // for setw()
 
-#ifdef WIN32
-  // JMI
-#else
-  #include <unistd.h> // for pipe(), fork(), ...
-  #include <stdio.h> // for popen()
-#endif
-
 #include "xml.h"
 #include "xmlfile.h"
 #include "xmlreader.h"
+#include "xmlcache.h"
 
 #include "setTraceOptionsIfDesired.h"
 #ifdef TRACE_OPTIONS
@@ -66,7 +59,7 @@ void displayXMLDeclaration (
     "XML Declaration:" <<
     endl;
 
-  gIndenter++;
+  gIndenter ()++;
   
   logIOstream << left <<
     setw (fieldWidth) <<
@@ -80,7 +73,7 @@ void displayXMLDeclaration (
     endl <<
     endl;
 
-  gIndenter--;
+  gIndenter ()--;
 }
 
 //_______________________________________________________________________________
@@ -94,7 +87,7 @@ void displayDocumentType (
     "Document Type:" <<
     endl;
 
-  gIndenter++;
+  gIndenter ()++;
 
   std::string xmlStartElement = documentType->getStartElement ();
   bool        xmlPublic       = documentType->getPublic ();
@@ -116,301 +109,7 @@ void displayDocumentType (
     endl <<
     endl;
     
-  gIndenter--;
-}
-
-//_______________________________________________________________________________
-string uncompressMXLFile (
-  string           mxlFileName,
-  indentedOstream& logIOstream)
-{
-  string fileBaseName = baseName (mxlFileName);
-
-  logIOstream <<
-    "The compressed file name is '" <<
-    mxlFileName <<
-    "'" <<
-    endl <<
-    endl;
-    
-  string uncompressedFileName;
-
-#ifdef WIN32
-  // JMI
-#else
-  {
-    // build shell command to list the contents of the uncompress file
-    stringstream s1;
-  
-    s1 <<
-      "unzip -l " <<
-      mxlFileName;
-  
-    string listContentsShellCommand = s1.str ();
-              
-    if (true) {
-      logIOstream <<
-        "Listing the contents of the compressed file '" <<
-        mxlFileName <<
-        "' with command:" <<
-        endl;
-  
-      gIndenter++;
-      
-      logIOstream <<
-        listContentsShellCommand <<
-        endl <<
-        endl;
-      
-      gIndenter--;
-    }
-
-      // create a stream to receive the result of listContentsShellCommand
-    FILE* inputStream =
-      popen (
-        listContentsShellCommand.c_str (),
-        "r");
-  
-    if (inputStream == nullptr) {
-      stringstream s;
-  
-      s <<
-        "Cannot list the contents of compressed file '" <<
-        mxlFileName <<
-        "' with 'popen ()'";
-              
-      msrInternalError (
-        gXml2lyOptions->fInputSourceName,
-        0, // inputLineNumber
-        __FILE__, __LINE__,
-        s.str ());
-    }
-  
-    else {
-      string contentsList;
-      
-      // read the list from inputStream 
-      char tampon [1024];
-      
-      while (
-        ! feof (inputStream)
-          &&
-        ! ferror (inputStream)
-          &&
-        fgets (tampon, sizeof (tampon), inputStream) != NULL
-        ) {
-        // append the contents of tampon to contentsList
-        contentsList += tampon;
-      } // while
-      // terminate the string in tampon
-      tampon [strlen (tampon) -1] = '\0';
-    
-      // close the stream
-      if (pclose (inputStream) < 0) {
-        msrInternalError (
-          gXml2lyOptions->fInputSourceName,
-          0, // inputLineNumber
-          __FILE__, __LINE__,
-          "Cannot close the input stream after 'popen ()'");
-      }
-
-      logIOstream <<
-        "The contents of the compressed file '" <<
-        mxlFileName <<
-        "' is:" <<
-        endl;
-  
-      gIndenter++;
-      
-      logIOstream <<
-        contentsList <<
-        endl;
-      
-      gIndenter--;
-
-      // analyze the contents list      
-      list<string> linesList;
-    
-      istringstream inputStream (contentsList);
-      string        currentLine;
-      
-      while (getline (inputStream, currentLine)) {
-
-        if (inputStream.eof ()) break;
-              
-#ifdef TRACE_OPTIONS
-        {
-          logIOstream <<
-            "*** currentLine:" <<
-            endl;
-
-          gIndenter++;
-          
-          logIOstream <<
-            currentLine <<
-            endl;
-            
-          gIndenter--;
-        }
-#endif
-
-        /*
-        user@lilydev: ~/libmusicxml-git/files/samples/musicxml > unzip -l UnofficialTestSuite/90a-Compressed-MusicXML.mxl
-        Archive:  UnofficialTestSuite/90a-Compressed-MusicXML.mxl
-          Length      Date    Time    Name
-        ---------  ---------- -----   ----
-                0  2007-11-14 16:04   META-INF/
-              246  2007-11-14 16:02   META-INF/container.xml
-             2494  2008-11-14 23:03   20a-Compressed-MusicXML.xml
-            30903  2007-11-14 15:51   20a-Compressed-MusicXML.pdf
-        ---------                     -------
-            33643                     4 files
-        */
-
-        string regularExpression (
-          "[[:space:]]*"
-          ".*"   // length
-          "[[:space:]]+"
-          ".*"   // date
-          "[[:space:]]+"
-          ".*"   // time
-          "[[:space:]]+"
-          "(.*)" // name
-          );
-        
-        regex  e (regularExpression);
-        smatch sm;
-  
-        regex_match (currentLine, sm, e);
-  
-        if (sm.size ()) {
-#ifdef TRACE_OPTIONS
-          if (gTraceOptions->fTracePasses) { // JMI ???
-            logIOstream <<
-              "There are " << sm.size () - 1 << " match(es) " <<
-              "with regex '" << regularExpression <<
-              "':" <<
-              endl;
-  
-            for (unsigned i = 1; i < sm.size (); ++i) {
-              logIOstream <<
-                "[" << sm [i] << "] " <<
-                endl;
-            } // for
-          
-            logIOstream <<
-              endl <<
-              endl;
-          }
-#endif
-  
-          string stringFromLine = sm [1];
-              
-          // has stringFromLine a ".xml" suffix?    
-          size_t
-            posInString =
-              stringFromLine.rfind (".xml");
-                
-          // JMI if (posInString == stringFromLine.size () - 4) {
-          if (posInString != stringFromLine.npos) {  // JMI STRANGISSIMO!!!
-    //      if (posInString != stringFromLine.npos && stringFromLine != "files") {  // JMI STRANGISSIMO!!!
-            // yes, this is a MusicXML file
-
-            // is this file part of META-INF?
-            size_t
-              posInString =
-                stringFromLine.find ("META-INF");
-                  
-            if (posInString == stringFromLine.npos) {
-              // no, this is an actual MusicXML file
-
-              if (uncompressedFileName.size ()) {
-                stringstream s;
-        
-                s <<
-                  "Compressed file '" << mxlFileName <<
-                  "' contains multiple MusicMXL files" <<
-                  ", found '" << uncompressedFileName <<
-                  "' and then '" << stringFromLine << "'";
-                  
-                msrInternalError (
-                  gXml2lyOptions->fInputSourceName,
-                  0, // inputLineNumber
-                  __FILE__, __LINE__,
-                  s.str ());
-              }
-              
-              else {
-                // we've got the uncompressed file name
-                uncompressedFileName = stringFromLine;
-          
-                logIOstream <<
-                  "The uncompressed file name is '" <<
-                  uncompressedFileName <<
-                  "'" <<
-                  endl <<
-                  endl;
-              }
-            }
-          }
-        }
-      } // while
-    }
-  }
-
-  {
-    // build shell command to uncompress the file
-    stringstream s2;
-  
-    s2 <<
-      "unzip -u -d /tmp " <<
-      mxlFileName;
-  
-    string uncompressShellCommand = s2.str ();
-              
-    if (true) {
-      logIOstream <<
-        "Uncompressing '" <<
-        mxlFileName <<
-        "' into '/tmp/" <<
-        uncompressedFileName <<
-        "' with command:" <<
-        endl;
-  
-      gIndenter++;
-      
-      logIOstream <<
-        uncompressShellCommand <<
-        endl <<
-        endl;
-      
-      gIndenter--;
-    }
-  
-    // create a stream to receive the result of uncompressShellCommand
-    FILE* inputStream =
-      popen (
-        uncompressShellCommand.c_str (),
-        "r");
-  
-    if (inputStream == nullptr) {
-      stringstream s;
-  
-      s <<
-        "Cannot uncompress the file '" <<
-        mxlFileName <<
-        "' with 'popen ()'";
-              
-      msrInternalError (
-        gXml2lyOptions->fInputSourceName,
-        0, // inputLineNumber
-        __FILE__, __LINE__,
-        s.str ());
-    }
-  }
-#endif
-
-  return uncompressedFileName;
+  gIndenter ()--;
 }
 
 //_______________________________________________________________________________
@@ -424,7 +123,7 @@ EXP Sxmlelement musicXMLFile2mxmlTree (
   string fileNameAsString = fileName;
   
 #ifdef TRACE_OPTIONS
-  if (gTraceOptions->fTracePasses) {
+  if (gTraceOptions ()->fTracePasses) {
     string separator =
       "%--------------------------------------------------------------";
     
@@ -432,7 +131,7 @@ EXP Sxmlelement musicXMLFile2mxmlTree (
       endl <<
       separator <<
       endl <<
-      gTab <<
+      gTab () <<
       "Pass 1: building the xmlelement tree from \"" << fileNameAsString << "\"" <<
       endl <<
       separator <<
@@ -441,44 +140,23 @@ EXP Sxmlelement musicXMLFile2mxmlTree (
   }
 #endif
 
-  // has the input file name a ".mxl" suffix?    
-  size_t
-    posInString =
-      fileNameAsString.rfind (".mxl");
-        
-  if (posInString == fileNameAsString.size () - 4) {
- // JMI  if (posInString != fileNameAsString.npos) {
-    // yes, this is a compressed file
-
-    /* JMI OS dependent
-    string uncompressedFileName =
-      uncompressMXLFile (
-        fileNameAsString,
-        logIOstream);
-
-    // the incompressed file in /tmp will be handled
-    // instead of the compressed one 
-    fileName = uncompressedFileName.c_str ();
-    */
+  // read the input MusicXML data from the file,
+  // compressed files (.mxl) are uncompressed in memory by the reader,
+  // the files already parsed are read from the cache if there is one
+  string cacheDirectory = xmlcache::defaultDirectory ();
 
-    stringstream s;
-    
-    s <<
-      "you should uncompress this file prior to running xml2ly";
-          
-    msrMusicXMLError (
-      gXml2lyOptions->fInputSourceName,
-      1, // inputLineNumber,
-      __FILE__, __LINE__,
-      s.str ());
+  SXMLFile xmlFile;
 
-    exit (333);
-  }
+  if (cacheDirectory.size ()) {
+    xmlcache cache (cacheDirectory);
 
-  // read the input MusicXML data from the file
-  xmlreader r;
+    xmlFile = cache.read (fileName);
+  }
+  else {
+    xmlreader r;
   
-  SXMLFile xmlFile = r.read (fileName);
+    xmlFile = r.read (fileName);
+  }
 
   // has there been a problem?
   if (! xmlFile) {
@@ -486,7 +164,7 @@ EXP Sxmlelement musicXMLFile2mxmlTree (
   }
 
 #ifdef TRACE_OPTIONS
-  if (gTraceOptions->fTraceEncoding) {
+  if (gTraceOptions ()->fTraceEncoding) {
     logIOstream <<
       endl <<
       "!!!!! xmlFile contents from file:" <<
@@ -505,7 +183,7 @@ EXP Sxmlelement musicXMLFile2mxmlTree (
   TXMLDecl * xmlDecl = xmlFile->getXMLDecl ();
   
 #ifdef TRACE_OPTIONS
-  if (gTraceOptions->fTraceEncoding) {
+  if (gTraceOptions ()->fTraceEncoding) {
     logIOstream <<
       endl <<
       "!!!!! xmlDecl contents from file:" <<
@@ -523,7 +201,7 @@ EXP Sxmlelement musicXMLFile2mxmlTree (
   // get the docType
   TDocType * docType = xmlFile->getDocType ();
   
-  if (gTraceOptions->fTraceEncoding) {
+  if (gTraceOptions ()->fTraceEncoding) {
     logIOstream <<
       endl <<
       "!!!!! docType from file:" <<
@@ -548,7 +226,7 @@ EXP Sxmlelement musicXMLFile2mxmlTree (
   
   if (encoding == desiredEncoding) {
 #ifdef TRACE_OPTIONS
-    if (gTraceOptions->fTracePasses) {
+    if (gTraceOptions ()->fTracePasses) {
       logIOstream <<
         "% MusicXML data uses \"" <<
         desiredEncoding <<
@@ -566,7 +244,7 @@ EXP Sxmlelement musicXMLFile2mxmlTree (
       " doesn't contain any encoding specification; assuming it is UTF-8";
           
     msrMusicXMLWarning (
-      gXml2lyOptions->fInputSourceName,
+      gXml2lyOptions ()->fInputSourceName,
       1, // inputLineNumber,
       s.str ());
   }
@@ -581,7 +259,7 @@ EXP Sxmlelement musicXMLFile2mxmlTree (
       ", for example with iconv; handling it as is";
           
     msrMusicXMLWarning (
-      gXml2lyOptions->fInputSourceName,
+      gXml2lyOptions ()->fInputSourceName,
       1, // inputLineNumber,
       s.str ());
   }
@@ -591,7 +269,7 @@ EXP Sxmlelement musicXMLFile2mxmlTree (
   clock_t endClock = clock ();
 
   // register time spent
-  timing::gTiming.appendTimingItem (
+  gTiming ().appendTimingItem (
     "Pass 1",
     "build xmlelement tree from file",
     timingItem::kMandatory,
@@ -610,7 +288,7 @@ EXP Sxmlelement musicXMLFd2mxmlTree (
   clock_t startClock = clock ();
   
 #ifdef TRACE_OPTIONS
-  if (gTraceOptions->fTracePasses) {
+  if (gTraceOptions ()->fTracePasses) {
     string separator =
       "%--------------------------------------------------------------";
     
@@ -618,7 +296,7 @@ EXP Sxmlelement musicXMLFd2mxmlTree (
       endl <<
       separator <<
       endl <<
-      gTab <<
+      gTab () <<
       "Pass 1: building the xmlelement tree from standard input" <<
       endl <<
       separator <<
@@ -637,7 +315,7 @@ EXP Sxmlelement musicXMLFd2mxmlTree (
   }
 
 #ifdef TRACE_OPTIONS
-  if (gTraceOptions->fTraceEncoding) {
+  if (gTraceOptions ()->fTraceEncoding) {
     logIOstream <<
       "!!!!! xmlFile contents from stream:" <<
       endl;
@@ -651,7 +329,7 @@ EXP Sxmlelement musicXMLFd2mxmlTree (
   TXMLDecl *xmlDecl = xmlFile->getXMLDecl ();
   
 #ifdef TRACE_OPTIONS
-  if (gTraceOptions->fTraceEncoding) {
+  if (gTraceOptions ()->fTraceEncoding) {
     logIOstream <<
       endl <<
       "xmlDecl contents:" <<
@@ -669,7 +347,7 @@ EXP Sxmlelement musicXMLFd2mxmlTree (
   // get the docType
   TDocType * docType = xmlFile->getDocType ();
   
-  if (gTraceOptions->fTraceEncoding) {
+  if (gTraceOptions ()->fTraceEncoding) {
     logIOstream <<
       endl <<
       "!!!!! docType from stream:" <<
@@ -706,7 +384,7 @@ EXP Sxmlelement musicXMLFd2mxmlTree (
       ", for example with iconv; exiting";
           
     msrMusicXMLError (
-      gXml2lyOptions->fInputSourceName,
+      gXml2lyOptions ()->fInputSourceName,
       1, // inputLineNumber,
       __FILE__, __LINE__,
       s.str ());
@@ -717,7 +395,7 @@ EXP Sxmlelement musicXMLFd2mxmlTree (
   clock_t endClock = clock ();
 
   // register time spent
-  timing::gTiming.appendTimingItem (
+  gTiming ().appendTimingItem (
     "Pass 1",
     "build xmlelement tree from standard input",
     timingItem::kMandatory,
@@ -739,7 +417,7 @@ EXP Sxmlelement musicXMLString2mxmlTree (
   clock_t startClock = clock ();
 
 #ifdef TRACE_OPTIONS
-  if (gTraceOptions->fTracePasses) {
+  if (gTraceOptions ()->fTracePasses) {
     string separator =
       "%--------------------------------------------------------------";
     
@@ -747,7 +425,7 @@ EXP Sxmlelement musicXMLString2mxmlTree (
       endl <<
       separator <<
       endl <<
-      gTab <<
+      gTab () <<
       "Pass 1: building the xmlelement tree from a buffer" <<
       endl <<
       separator <<
@@ -762,7 +440,7 @@ EXP Sxmlelement musicXMLString2mxmlTree (
   clock_t endClock = clock ();
 
   // register time spent
-  timing::gTiming.appendTimingItem (
+  gTiming ().appendTimingItem (
     "Pass 1",
     "build xmlelement tree from buffer",
     timingItem::kMandatory,
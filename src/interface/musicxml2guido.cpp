@@ -14,11 +14,13 @@
 # pragma warning (disable : 4786)
 #endif
 
+#include <atomic>
 #include <iostream>
 #include "libmusicxml.h"
 #include "xml.h"
 #include "xmlfile.h"
 #include "xmlreader.h"
+#include "xmlcache.h"
 #include "xml2guidovisitor.h"
 
 using namespace std;
@@ -26,6 +28,11 @@ using namespace std;
 namespace MusicXML2 
 {
 
+// the number of threads used to convert the parts
+static std::atomic<int> gThreads (1);
+
+EXP void musicxml2guidoThreads(int threads)		{ gThreads = threads; }
+
 //_______________________________________________________________________________
 static xmlErr xml2guido(SXMLFile& xmlfile, bool generateBars, int partFilter, ostream& out, const char* file)
 {
@@ -34,6 +41,7 @@ static xmlErr xml2guido(SXMLFile& xmlfile, bool generateBars, int partFilter, os
 		if (st->getName() == "score-timewise") return kUnsupported;
 		
 		xml2guidovisitor v(true, true, generateBars, partFilter);
+		v.parallel (gThreads);
 		Sguidoelement gmn = v.convert(st);
 		if (file) {
 			out << "(*\n  gmn code converted from '" << file << "'"
@@ -53,7 +61,8 @@ EXP xmlErr musicxmlfile2guido(const char *file, bool generateBars, ostream& out)
 {
 	xmlreader r;
 	SXMLFile xmlfile;
-	xmlfile = r.read(file);
+	string cache = xmlcache::defaultDirectory();
+	xmlfile = cache.size() ? xmlcache(cache).read(file) : r.read(file);
 	if (xmlfile) {
 		return xml2guido(xmlfile, generateBars, 0, out, file);
 	}
@@ -55,7 +55,7 @@ S_msrScore buildMsrSkeletonFromElementsTree (
   clock_t startClock = clock ();
 
 #ifdef TRACE_OPTIONS
-  if (gTraceOptions->fTracePasses) {
+  if (gTraceOptions ()->fTracePasses) {
     string separator =
       "%--------------------------------------------------------------";
   
@@ -63,7 +63,7 @@ S_msrScore buildMsrSkeletonFromElementsTree (
       endl <<
       separator <<
       endl <<
-      gTab <<
+      gTab () <<
       "Pass 2a: translating the xmlelement tree into an MSR skeleton" <<
       endl;
     
@@ -90,7 +90,7 @@ S_msrScore buildMsrSkeletonFromElementsTree (
   clock_t endClock = clock ();
 
   // register time spent
-  timing::gTiming.appendTimingItem (
+  gTiming ().appendTimingItem (
     "Pass 2a",
     "build the MSR skeleton",
     timingItem::kMandatory,
@@ -129,7 +129,7 @@ void displayMsrSkeleton (
     endl <<
     separator <<
     endl <<
-    gTab <<
+    gTab () <<
     "Optional pass: displaying the MSR skeleton as text" <<
     endl <<
     separator <<
@@ -140,7 +140,7 @@ void displayMsrSkeleton (
   clock_t endClock = clock ();
 
   // register time spent
-  timing::gTiming.appendTimingItem (
+  gTiming ().appendTimingItem (
     "",
     "display the MSR skeleton",
     timingItem::kOptional,
@@ -163,7 +163,7 @@ void displayMsrSkeletonSummary (
   clock_t startClock = clock ();
   
 #ifdef TRACE_OPTIONS
-  if (gTraceOptions->fTracePasses) {
+  if (gTraceOptions ()->fTracePasses) {
     string separator =
       "%--------------------------------------------------------------";
     
@@ -171,7 +171,7 @@ void displayMsrSkeletonSummary (
       endl <<
       separator <<
       endl <<
-      gTab <<
+      gTab () <<
       "Optional pass: outputting a summary of the MSR" <<
       endl <<
       separator <<
@@ -191,7 +191,7 @@ void displayMsrSkeletonSummary (
   clock_t endClock = clock ();
 
   // register time spent
-  timing::gTiming.appendTimingItem (
+  gTiming ().appendTimingItem (
     "",
     "display MSR skeleton summary",
     timingItem::kOptional,
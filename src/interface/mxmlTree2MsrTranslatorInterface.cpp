@@ -59,7 +59,7 @@ void populateMsrSkeletonFromMxmlTree (
   clock_t startClock = clock ();
 
 #ifdef TRACE_OPTIONS
-  if (gTraceOptions->fTracePasses) {
+  if (gTraceOptions ()->fTracePasses) {
     string separator =
       "%--------------------------------------------------------------";
   
@@ -67,7 +67,7 @@ void populateMsrSkeletonFromMxmlTree (
       endl <<
       separator <<
       endl <<
-      gTab <<
+      gTab () <<
       "Pass 2b: translating the xmlelement tree into a MSR" <<
       endl;
     
@@ -90,7 +90,7 @@ void populateMsrSkeletonFromMxmlTree (
   clock_t endClock = clock ();
 
   // register time spent
-  timing::gTiming.appendTimingItem (
+  gTiming ().appendTimingItem (
     "Pass 2b",
     "build the MSR",
     timingItem::kMandatory,
@@ -118,7 +118,7 @@ void displayMSRPopulatedScore (
     endl <<
     separator <<
     endl <<
-    gTab <<
+    gTab () <<
     "Optional pass: displaying the MSR as text" <<
     endl <<
     separator <<
@@ -129,7 +129,7 @@ void displayMSRPopulatedScore (
   clock_t endClock = clock ();
 
   // register time spent
-  timing::gTiming.appendTimingItem (
+  gTiming ().appendTimingItem (
     "",
     "display the MSR",
     timingItem::kOptional,
@@ -151,7 +151,7 @@ void displayMSRPopulatedScoreSummary (
   clock_t startClock = clock ();
   
 #ifdef TRACE_OPTIONS
-  if (gTraceOptions->fTracePasses) {
+  if (gTraceOptions ()->fTracePasses) {
     string separator =
       "%--------------------------------------------------------------";
     
@@ -159,7 +159,7 @@ void displayMSRPopulatedScoreSummary (
       endl <<
       separator <<
       endl <<
-      gTab <<
+      gTab () <<
       "Optional pass: outputting a summary of the MSR" <<
       endl <<
       separator <<
@@ -180,7 +180,7 @@ void displayMSRPopulatedScoreSummary (
   clock_t endClock = clock ();
 
   // register time spent
-  timing::gTiming.appendTimingItem (
+  gTiming ().appendTimingItem (
     "",
     "display MSR summary",
     timingItem::kOptional,
@@ -202,7 +202,7 @@ void displayMSRPopulatedScoreNames (
   clock_t startClock = clock ();
   
 #ifdef TRACE_OPTIONS
-  if (gTraceOptions->fTracePasses) {
+  if (gTraceOptions ()->fTracePasses) {
     string separator =
       "%--------------------------------------------------------------";
     
@@ -210,7 +210,7 @@ void displayMSRPopulatedScoreNames (
       endl <<
       separator <<
       endl <<
-      gTab <<
+      gTab () <<
       "Optional pass: outputting the names in the MSR" <<
       endl <<
       separator <<
@@ -231,7 +231,7 @@ void displayMSRPopulatedScoreNames (
   clock_t endClock = clock ();
 
   // register time spent
-  timing::gTiming.appendTimingItem (
+  gTiming ().appendTimingItem (
     "",
     "display MSR names",
     timingItem::kOptional,
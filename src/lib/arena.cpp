@@ -0,0 +1,95 @@
+/*
+  MusicXML Library
+  Copyright (C) Grame 2006-2013
+
+  This Source Code Form is subject to the terms of the Mozilla Public
+  License, v. 2.0. If a copy of the MPL was not distributed with this
+  file, You can obtain one at http://mozilla.org/MPL/2.0/.
+
+  Grame Research Laboratory, 11, cours de Verdun Gensoul 69002 Lyon - France
+  research@grame.fr
+*/
+
+#include <new>
+#include "arena.h"
+
+using namespace std;
+
+namespace MusicXML2
+{
+
+// allocations are aligned on the largest fundamental alignment
+static const size_t kAlign = sizeof(long double) > sizeof(void*) ? sizeof(long double) : sizeof(void*);
+static inline size_t align (size_t size)	{ return (size + kAlign - 1) & ~(kAlign - 1); }
+
+// the arena in use for the current thread
+static thread_local arena* gCurrentArena = 0;
+
+//______________________________________________________________________________
+Sarena arena::create (size_t blockSize)	{ arena* o = new arena(blockSize); assert(o!=0); return o; }
+
+arena::arena (size_t blockSize)
+	: fBlockSize(align(blockSize)), fNext(0), fAvailable(0), fUsed(0) {}
+
+arena::~arena ()
+{
+	for (vector<char*>::iterator i = fBlocks.begin(); i != fBlocks.end(); i++)
+		::operator delete (*i);
+}
+
+//______________________________________________________________________________
+void* arena::allocate (size_t size)
+{
+	size = align(size);
+	if (size > fAvailable) {
+		if (size > fBlockSize / 4) {
+			// large allocations get their own block and leave the current one untouched
+			char* block = (char*)::operator new (size);
+			fBlocks.push_back (block);
+			fUsed += size;
+			return block;
+		}
+		fNext = (char*)::operator new (fBlockSize);
+		fBlocks.push_back (fNext);
+		fAvailable = fBlockSize;
+	}
+	void* ptr = fNext;
+	fNext += size;
+	fAvailable -= size;
+	fUsed += size;
+	return ptr;
+}
+
+//______________________________________________________________________________
+arena* arena::current ()		{ return gCurrentArena; }
+
+arena::scope::scope (arena* a) : fPrevious(gCurrentArena)	{ gCurrentArena = a; }
+arena::scope::~scope ()										{ gCurrentArena = fPrevious; }
+
+//______________________________________________________________________________
+// arenaobject
+//______________________________________________________________________________
+// each object is preceded by a header that stores the owning arena (null for heap objects)
+// the header size preserves pointer alignment, which is enough for the library objects
+static const size_t kHeaderSize = sizeof(arena*);
+
+void* arenaobject::operator new (size_t size)
+{
+	arena* a = arena::current();
+	char* mem = (char*)(a ? a->allocate (size + kHeaderSize) : ::operator new (size + kHeaderSize));
+	*(arena**)mem = a;
+	if (a) a->addReference();
+	return mem + kHeaderSize;
+}
+
+void arenaobject::operator delete (void* ptr)
+{
+	if (!ptr) return;
+	char* mem = (char*)ptr - kHeaderSize;
+	arena* a = *(arena**)mem;
+	// arena memory is released with the arena itself
+	if (a) a->removeReference();
+	else ::operator delete (mem);
+}
+
+}
@@ -0,0 +1,97 @@
+/*
+  MusicXML Library
+  Copyright (C) Grame 2006-2013
+
+  This Source Code Form is subject to the terms of the Mozilla Public
+  License, v. 2.0. If a copy of the MPL was not distributed with this
+  file, You can obtain one at http://mozilla.org/MPL/2.0/.
+
+  Grame Research Laboratory, 11, cours de Verdun Gensoul 69002 Lyon - France
+  research@grame.fr
+*/
+
+#ifndef __arena__
+#define __arena__
+
+#include <cstddef>
+#include <vector>
+
+#ifdef WIN32
+#pragma warning (disable : 4251)
+#endif
+
+#include "exports.h"
+#include "smartpointer.h"
+
+namespace MusicXML2
+{
+
+/*!
+\brief a bump allocator for objects sharing the same lifetime
+
+	An arena allocates memory from large contiguous blocks and releases
+	all the blocks at once when it is deleted. Objects allocated in an arena
+	(see arenaobject) keep a reference to the arena, thus the arena memory
+	remains valid as long as one of these objects is alive.
+\n	An arena is made current for the calling thread using an arena::scope.
+*/
+//______________________________________________________________________________
+class EXP arena : public smartable
+{
+	public:
+		enum { kDefaultBlockSize = 256*1024 };
+
+		static SMARTP<arena> create (size_t blockSize = kDefaultBlockSize);
+
+		//! allocates \c size bytes, the memory is released with the arena
+		void*	allocate (size_t size);
+
+		//! the number of bytes allocated in the arena
+		size_t	size () const		{ return fUsed; }
+		//! the number of blocks owned by the arena
+		size_t	blocks () const		{ return fBlocks.size(); }
+
+		//! the arena currently in use for the calling thread (or null)
+		static arena*	current ();
+
+		/*!
+		\brief makes an arena current for the lifetime of the scope object
+		*/
+		class EXP scope {
+			arena*	fPrevious;
+			public:
+						 scope (arena* a);
+						~scope ();
+		};
+
+	protected:
+				 arena (size_t blockSize);
+		virtual ~arena ();
+
+	private:
+		std::vector<char*>	fBlocks;
+		size_t				fBlockSize;
+		char*				fNext;
+		size_t				fAvailable;
+		size_t				fUsed;
+};
+typedef SMARTP<arena> Sarena;
+
+/*!
+\brief base class for objects that can be allocated in an arena
+
+	Objects are allocated in the current arena when there is one,
+	otherwise they are allocated on the heap as usual.
+	Objects are aligned on pointers size.
+*/
+//______________________________________________________________________________
+class EXP arenaobject
+{
+	public:
+		static void* operator new (size_t size);
+		static void  operator delete (void* ptr);
+};
+
+}
+
+#endif
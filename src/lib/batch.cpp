@@ -0,0 +1,386 @@
+/*
+  MusicXML Library
+  Copyright (C) Grame 2006-2013
+
+  This Source Code Form is subject to the terms of the Mozilla Public
+  License, v. 2.0. If a copy of the MPL was not distributed with this
+  file, You can obtain one at http://mozilla.org/MPL/2.0/.
+
+  Grame Research Laboratory, 11, cours de Verdun Gensoul 69002 Lyon - France
+  research@grame.fr
+*/
+
+#include <algorithm>
+#include <chrono>
+#include <cstdio>
+#include <cstdlib>
+#include <deque>
+#include <fstream>
+#include <iomanip>
+#include <map>
+#include <mutex>
+#include <set>
+#include <sstream>
+#include <thread>
+
+#include <sys/types.h>
+#include <sys/stat.h>
+#ifdef WIN32
+#include <io.h>
+#else
+#include <dirent.h>
+#endif
+
+#include "batch.h"
+
+using namespace std;
+
+namespace MusicXML2
+{
+
+//______________________________________________________________________________
+batch::results::results (const vector<batch::job>& jobs)
+	: fStates(jobs.size(), kPending), fSucceeded(0), fSteals(0), fRestarts(0),
+	  fSlowestSeconds(0), fJobs(jobs) {}
+
+void batch::results::started (size_t index)
+{
+	lock_guard<mutex> lock (fMutex);
+	fStates[index] = kRunning;
+}
+
+void batch::results::done (size_t index, const string& reason, double seconds)
+{
+	lock_guard<mutex> lock (fMutex);
+	fStates[index] = kDone;
+	if (reason.empty()) {
+		fSucceeded++;
+		if (seconds > fSlowestSeconds) {
+			fSlowestSeconds = seconds;
+			fSlowestInput = fJobs[index].fInput;
+		}
+	}
+	else {
+		remove (fJobs[index].fOutput.c_str());
+		batch::failure f;
+		f.fInput = fJobs[index].fInput;
+		f.fReason = reason;
+		fFailures.push_back (f);
+	}
+}
+
+//______________________________________________________________________________
+// the queue of a worker: the owner takes the jobs at the front,
+// the thieves at the back
+typedef struct {
+	mutex			fMutex;
+	deque<size_t>	fJobs;
+} jobsQueue;
+
+static bool takeJob (jobsQueue& queue, bool front, size_t& index)
+{
+	lock_guard<mutex> lock (queue.fMutex);
+	if (queue.fJobs.empty()) return false;
+	if (front) {
+		index = queue.fJobs.front();
+		queue.fJobs.pop_front();
+	}
+	else {
+		index = queue.fJobs.back();
+		queue.fJobs.pop_back();
+	}
+	return true;
+}
+
+//______________________________________________________________________________
+batch::report::report ()
+	: fFiles(0), fSucceeded(0), fFailed(0), fThreads(0), fSteals(0), fRestarts(0),
+	  fBytes(0), fSeconds(0), fSlowestSeconds(0) {}
+
+void batch::report::print (ostream& os) const
+{
+	double seconds = fSeconds > 0 ? fSeconds : 1e-9;
+	os << "Converted " << fSucceeded << " of " << fFiles << " files"
+		<< " in " << fixed << setprecision(2) << fSeconds << " s"
+		<< " using " << fThreads << (fThreads > 1 ? " threads" : " thread") << endl;
+	os << "  failed:     " << fFailed << endl;
+	os << "  input:      " << setprecision(1) << fBytes / 1e6 << " MB" << endl;
+	os << "  throughput: " << setprecision(1) << fFiles / seconds << " files/s, "
+		<< setprecision(2) << fBytes / 1e6 / seconds << " MB/s" << endl;
+	os << "  steals:     " << fSteals << endl;
+	if (fRestarts)
+		os << "  restarts:   " << fRestarts << endl;
+	if (fSlowestInput.size())
+		os << "  slowest:    " << fSlowestInput << " (" << setprecision(2) << fSlowestSeconds << " s)" << endl;
+	os.unsetf (ios_base::floatfield);
+
+	if (fFailures.size()) {
+		os << "Failures:" << endl;
+		for (vector<failure>::const_iterator i = fFailures.begin(); i != fFailures.end(); i++)
+			os << "  " << i->fInput << ": " << i->fReason << endl;
+	}
+}
+
+//______________________________________________________________________________
+void batch::add (const string& input, const string& output)
+{
+	job j;
+	j.fInput = input;
+	j.fOutput = output;
+	struct stat st;
+	j.fSize = stat (input.c_str(), &st) ? 0 : st.st_size;
+	fJobs.push_back (j);
+}
+
+//______________________________________________________________________________
+size_t batch::convertJobs (const vector<size_t>& indexes, converter& convert, int threads, listener& l) const
+{
+	// deal the jobs largest first, the stable sort keeps the equal sizes in order
+	vector<size_t> order (indexes);
+	stable_sort (order.begin(), order.end(),
+		[this] (size_t a, size_t b) { return fJobs[a].fSize > fJobs[b].fSize; });
+	vector<jobsQueue> queues (threads);
+	for (size_t i = 0; i < order.size(); i++)
+		queues[i % threads].fJobs.push_back (order[i]);
+
+	vector<size_t> steals (threads, 0);
+	auto work = [&] (int w) {
+		for (;;) {
+			size_t index;
+			bool found = takeJob (queues[w], true, index);
+			// steal the smallest job of the next non empty queue
+			for (int k = 1; !found && k < threads; k++) {
+				found = takeJob (queues[(w + k) % threads], false, index);
+				if (found) steals[w]++;
+			}
+			if (!found) break;
+
+			const job& j = fJobs[index];
+			l.started (index);
+			chrono::steady_clock::time_point start = chrono::steady_clock::now();
+			string reason;
+			try {
+				convert (j.fInput, j.fOutput);
+			}
+			catch (const exception& e) {
+				reason = e.what();
+				if (reason.empty()) reason = "conversion failed";
+			}
+			catch (...) {
+				reason = "conversion failed with an unknown exception";
+			}
+			l.done (index, reason, chrono::duration<double>(chrono::steady_clock::now() - start).count());
+		}
+	};
+
+	vector<thread> workers;
+	for (int w = 1; w < threads; w++)
+		workers.push_back (thread (work, w));
+	work (0);		// the calling thread is the first worker
+	for (size_t i = 0; i < workers.size(); i++)
+		workers[i].join();
+
+	size_t total = 0;
+	for (int w = 0; w < threads; w++) total += steals[w];
+	return total;
+}
+
+//______________________________________________________________________________
+batch::report batch::run (converter convert, int threads, supervisor supervise)
+{
+	report result;
+	result.fFiles = fJobs.size();
+
+	if (threads <= 0) threads = thread::hardware_concurrency();
+	if (threads <= 0) threads = 1;
+	if (size_t(threads) > fJobs.size()) threads = fJobs.size() ? int(fJobs.size()) : 1;
+	result.fThreads = threads;
+
+	// the outputs must be distinct: the later duplicates fail without conversion
+	vector<size_t> indexes;
+	set<string> outputs;
+	vector<failure> duplicates;
+	for (size_t i = 0; i < fJobs.size(); i++) {
+		result.fBytes += fJobs[i].fSize;
+		if (outputs.insert (fJobs[i].fOutput).second)
+			indexes.push_back (i);
+		else {
+			failure f;
+			f.fInput = fJobs[i].fInput;
+			f.fReason = "output file '" + fJobs[i].fOutput + "' is produced by another input";
+			duplicates.push_back (f);
+		}
+	}
+
+	results r (fJobs);
+	chrono::steady_clock::time_point start = chrono::steady_clock::now();
+	if (supervise)
+		supervise (*this, indexes, convert, threads, r);
+	else
+		r.fSteals = convertJobs (indexes, convert, threads, r);
+	result.fSeconds = chrono::duration<double>(chrono::steady_clock::now() - start).count();
+
+	result.fSucceeded = r.fSucceeded;
+	result.fSteals = r.fSteals;
+	result.fRestarts = r.fRestarts;
+	result.fSlowestInput = r.fSlowestInput;
+	result.fSlowestSeconds = r.fSlowestSeconds;
+	result.fFailures = r.fFailures;
+	result.fFailures.insert (result.fFailures.end(), duplicates.begin(), duplicates.end());
+	result.fFailed = result.fFailures.size();
+	return result;
+}
+
+//______________________________________________________________________________
+bool batch::readManifest (const string& file, vector<string>& inputs)
+{
+	ifstream in (file.c_str());
+	if (!in.is_open()) return false;
+
+	string line;
+	while (getline (in, line)) {
+		// trim the line, including a DOS end of line
+		size_t first = line.find_first_not_of (" \t\r");
+		if (first == string::npos) continue;
+		size_t last = line.find_last_not_of (" \t\r");
+		line = line.substr (first, last - first + 1);
+		if (line[0] != '#') inputs.push_back (line);
+	}
+	return true;
+}
+
+static bool hasSuffix (const string& name, const vector<string>& suffixes)
+{
+	for (vector<string>::const_iterator i = suffixes.begin(); i != suffixes.end(); i++) {
+		if ((name.size() > i->size()) && (name.compare (name.size() - i->size(), i->size(), *i) == 0))
+			return true;
+	}
+	return false;
+}
+
+bool batch::listDirectory (const string& dir, const vector<string>& suffixes, vector<string>& inputs)
+{
+	string prefix = dir;
+	if (prefix.size() && (prefix[prefix.size()-1] != '/') && (prefix[prefix.size()-1] != '\\'))
+		prefix += '/';
+
+	vector<string> names;
+#ifdef WIN32
+	struct _finddata_t data;
+	intptr_t handle = _findfirst ((prefix + "*").c_str(), &data);
+	if (handle == -1) return false;
+	do {
+		if (!(data.attrib & _A_SUBDIR) && hasSuffix (data.name, suffixes))
+			names.push_back (data.name);
+	} while (_findnext (handle, &data) == 0);
+	_findclose (handle);
+#else
+	DIR* d = opendir (dir.c_str());
+	if (!d) return false;
+	while (struct dirent* entry = readdir (d)) {
+		string name = entry->d_name;
+		struct stat st;
+		if (hasSuffix (name, suffixes) && !stat ((prefix + name).c_str(), &st) && S_ISREG(st.st_mode))
+			names.push_back (name);
+	}
+	closedir (d);
+#endif
+
+	sort (names.begin(), names.end());
+	for (vector<string>::const_iterator i = names.begin(); i != names.end(); i++)
+		inputs.push_back (prefix + *i);
+	return true;
+}
+
+string batch::outputFile (const string& input, const string& outDir, const string& suffix)
+{
+	size_t pos = input.find_last_of ("/\\");
+	string name = (pos == string::npos) ? input : input.substr (pos + 1);
+	pos = name.rfind ('.');
+	if (pos != string::npos) name.erase (pos);
+	name += suffix;
+
+	if (outDir.empty()) return name;
+	char last = outDir[outDir.size()-1];
+	return ((last == '/') || (last == '\\')) ? outDir + name : outDir + "/" + name;
+}
+
+//______________________________________________________________________________
+// the directories of a path, innermost first, '.' and '..' excepted
+static vector<string> directories (const string& path)
+{
+	vector<string> dirs;
+	size_t end = path.find_last_of ("/\\");
+	while ((end != string::npos) && (end > 0)) {
+		size_t start = path.find_last_of ("/\\", end - 1);
+		string dir = path.substr (start == string::npos ? 0 : start + 1, end - (start == string::npos ? 0 : start + 1));
+		if (dir.size() && (dir != ".") && (dir != "..") && (dir.find (':') == string::npos))
+			dirs.push_back (dir);
+		end = start;
+	}
+	return dirs;
+}
+
+void batch::outputFiles (const vector<string>& inputs, const string& outDir, const string& suffix, vector<string>& outputs)
+{
+	const size_t n = inputs.size();
+	vector<vector<string> > dirs (n);
+	vector<size_t> depth (n, 0);		// the number of directories prefixed to the name
+	for (size_t i = 0; i < n; i++) dirs[i] = directories (inputs[i]);
+
+	// the prefix of the name of input i, made of its depth innermost directories
+	auto name = [&] (size_t i) {
+		string prefix;
+		for (size_t d = depth[i]; d > 0; d--) prefix += dirs[i][d-1] + "_";
+		return outputFile (prefix + outputFile (inputs[i], "", ""), outDir, suffix);
+	};
+
+	outputs.resize (n);
+	for (size_t i = 0; i < n; i++) outputs[i] = name (i);
+
+	// the colliding names of different inputs get one more directory until they differ
+	for (bool collisions = true; collisions; ) {
+		collisions = false;
+		map<string, vector<size_t> > users;
+		for (size_t i = 0; i < n; i++) users[outputs[i]].push_back (i);
+		for (map<string, vector<size_t> >::const_iterator u = users.begin(); u != users.end(); u++) {
+			const vector<size_t>& same = u->second;
+			bool distinct = false;
+			for (size_t k = 1; k < same.size(); k++)
+				if (inputs[same[k]] != inputs[same[0]]) distinct = true;
+			if (!distinct) continue;
+			for (size_t k = 0; k < same.size(); k++) {
+				size_t i = same[k];
+				if (depth[i] < dirs[i].size()) {
+					depth[i]++;
+					outputs[i] = name (i);
+					collisions = true;
+				}
+			}
+		}
+	}
+
+	// the names that still collide are numbered, in the inputs order,
+	// skipping the numbered names that are already used
+	map<string, vector<size_t> > users;
+	for (size_t i = 0; i < n; i++) users[outputs[i]].push_back (i);
+	set<string> used (outputs.begin(), outputs.end());
+	for (map<string, vector<size_t> >::const_iterator u = users.begin(); u != users.end(); u++) {
+		const vector<size_t>& same = u->second;
+		map<string, string> numbered;		// the output of each distinct input
+		numbered[inputs[same[0]]] = u->first;
+		int number = 1;
+		for (size_t k = 1; k < same.size(); k++) {
+			size_t i = same[k];
+			string& output = numbered[inputs[i]];
+			while (output.empty()) {
+				stringstream s;
+				s << u->first.substr (0, u->first.size() - suffix.size()) << "-" << ++number << suffix;
+				if (used.insert (s.str()).second) output = s.str();
+			}
+			outputs[i] = output;
+		}
+	}
+}
+
+}
@@ -0,0 +1,168 @@
+/*
+  MusicXML Library
+  Copyright (C) Grame 2006-2013
+
+  This Source Code Form is subject to the terms of the Mozilla Public
+  License, v. 2.0. If a copy of the MPL was not distributed with this
+  file, You can obtain one at http://mozilla.org/MPL/2.0/.
+
+  Grame Research Laboratory, 11, cours de Verdun Gensoul 69002 Lyon - France
+  research@grame.fr
+*/
+
+#ifndef __batch__
+#define __batch__
+
+#include <functional>
+#include <iostream>
+#include <mutex>
+#include <string>
+#include <vector>
+
+#ifdef WIN32
+#pragma warning (disable : 4251)
+#endif
+
+#include "exports.h"
+
+namespace MusicXML2
+{
+
+/*!
+\brief converts many files in one process using a pool of threads
+
+	The files are dealt to the worker threads largest first. Each worker
+	converts the files of its own queue, and steals the remaining files
+	of the other queues when its queue is empty, so that a few large scores
+	don't keep the other threads idle at the end of the batch.
+\n	A conversion reports a failure by throwing an exception: the failure
+	is recorded with the exception message and the batch goes on with the
+	next file. The partial output of a failed conversion is removed.
+\n	Crashes and exits can't be caught in process: the way the jobs are
+	run is left to an optional supervisor, given to run(), which may
+	convert them in child processes (see the xml2ly and xml2guido
+	batchsupervisor). Without supervisor, the jobs are converted in the
+	calling process and a crash ends the batch.
+*/
+//______________________________________________________________________________
+class EXP batch
+{
+	public:
+		//! converts the input file to the output file, throws on failure
+		typedef std::function<void (const std::string& input, const std::string& output)> converter;
+
+		typedef struct {
+			std::string	fInput;
+			std::string	fReason;
+		} failure;
+
+		//! the aggregate results of a batch run
+		class EXP report {
+			public:
+				size_t		fFiles;
+				size_t		fSucceeded;
+				size_t		fFailed;
+				int			fThreads;
+				size_t		fSteals;
+				size_t		fRestarts;		// the child processes started after a crash
+				double		fBytes;			// the size of the input files
+				double		fSeconds;		// the wall clock time
+				std::string	fSlowestInput;
+				double		fSlowestSeconds;
+				std::vector<failure> fFailures;
+
+						report ();
+				void	print (std::ostream& os) const;
+		};
+
+				 batch () {}
+		virtual ~batch () {}
+
+		//! adds a conversion of input to output
+		void	add (const std::string& input, const std::string& output);
+		size_t	size () const		{ return fJobs.size(); }
+
+		//! a conversion of the batch
+		typedef struct {
+			std::string	fInput;
+			std::string	fOutput;
+			long long	fSize;
+		} job;
+
+		//! the progress of the conversions, notified by the worker threads
+		class EXP listener {
+			public:
+				virtual ~listener () {}
+				virtual void started (size_t index) = 0;
+				//! reason is empty when the conversion succeeded
+				virtual void done (size_t index, const std::string& reason, double seconds) = 0;
+		};
+
+		//! the results of the conversions, the output of a failed conversion is removed
+		class EXP results : public listener {
+			public:
+				enum { kPending, kRunning, kDone };
+
+				std::vector<int>	fStates;		// the state of each job
+				size_t				fSucceeded;
+				size_t				fSteals;
+				size_t				fRestarts;
+				std::string			fSlowestInput;
+				double				fSlowestSeconds;
+				std::vector<failure> fFailures;
+
+						results (const std::vector<job>& jobs);
+				void	started (size_t index);
+				void	done (size_t index, const std::string& reason, double seconds);
+
+			private:
+				const std::vector<job>&	fJobs;
+				std::mutex				fMutex;
+		};
+
+		/*!
+		\brief runs the jobs of indexes, by calling convertJobs
+		
+			A supervisor updates the results fSteals and fRestarts, and notifies
+			every job to the results, including the jobs it could not convert.
+		*/
+		typedef std::function<void (const batch& b, const std::vector<size_t>& indexes, converter& convert, int threads, results& r)> supervisor;
+
+		/*!
+		\brief converts all the files
+		\param convert the conversion of a file, called concurrently by the workers
+		\param threads the number of worker threads, 0 to use the available cores
+		\param supervise the way the jobs are run, in the calling process by default
+		*/
+		report	run (converter convert, int threads = 0, supervisor supervise = supervisor());
+
+		//! converts the jobs of indexes with threads workers, notifies l and returns the steals count
+		size_t	convertJobs (const std::vector<size_t>& indexes, converter& convert, int threads, listener& l) const;
+
+		//! reads a manifest file: one path per line, empty lines and lines starting with '#' are ignored
+		static bool	readManifest (const std::string& file, std::vector<std::string>& inputs);
+		//! lists the files of a directory (not recursively) ending with one of the suffixes, sorted by name
+		static bool	listDirectory (const std::string& dir, const std::vector<std::string>& suffixes, std::vector<std::string>& inputs);
+		//! the output file for an input: its base name in outDir, with its suffix replaced by suffix
+		static std::string	outputFile (const std::string& input, const std::string& outDir, const std::string& suffix);
+		/*!
+		\brief the output files of a set of inputs, using outputFile
+		
+			Inputs from different directories may have the same base name: the colliding
+			names are prefixed with their directories, innermost first, until they differ
+			(e.g. repeats_Repeat.ly and misc_Repeat.ly), and numbered when they still collide.
+			The same input given twice keeps the same output.
+		*/
+		static void	outputFiles (const std::vector<std::string>& inputs, const std::string& outDir, const std::string& suffix, std::vector<std::string>& outputs);
+
+	private:
+		std::vector<job>	fJobs;
+
+		// batches are not copied
+				batch (const batch&);
+		batch&	operator= (const batch&);
+};
+
+}
+
+#endif
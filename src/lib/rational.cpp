@@ -11,11 +11,23 @@
 */
 
 #include "rational.h"
+#include <climits>
+#include <iostream>
 #include <sstream>
 #include <cmath>
 #include <stdlib.h>
 #include <string.h>
 
+//______________________________________________________________________________
+// makes the denominator positive, the comparisons rely on it
+static inline void positive (long int& num, long int& denom)
+{
+	if ((denom < 0) && (denom != LONG_MIN) && (num != LONG_MIN)) {
+		num = -num;
+		denom = -denom;
+	}
+}
+
 //______________________________________________________________________________
 rational::rational (const string &str)
 {
@@ -25,13 +37,16 @@ rational::rational (const string &str)
     denom = strstr(cstr,"/");
     if (denom) ++denom;
     fNumerator = atol(cstr);
-    if (denom) fDenominator = atol(denom);
+    fDenominator = denom ? atol(denom) : 1;
+    if (fDenominator == 0) fDenominator = 1;
+    positive (fNumerator, fDenominator);
 }
 
 rational::rational(long int num, long int denom) : fNumerator(num), fDenominator(denom)
 {
     // don't allow zero denominators!
     if (fDenominator == 0) fDenominator = 1;
+    positive (fNumerator, fDenominator);
 }
 
 rational::rational(const rational& d)
@@ -41,66 +56,187 @@ rational::rational(const rational& d)
 }
 
 //______________________________________________________________________________
-rational rational::operator +(const rational &dur) const {
-    return rational(fNumerator * dur.fDenominator + dur.fNumerator * fDenominator, fDenominator * dur.fDenominator);
+// overflow checked operations on long int
+//______________________________________________________________________________
+#if defined(__GNUC__) || defined(__clang__)
+static inline bool addOverflow (long int a, long int b, long int& r)	{ return __builtin_add_overflow (a, b, &r); }
+static inline bool mulOverflow (long int a, long int b, long int& r)	{ return __builtin_mul_overflow (a, b, &r); }
+static inline int  trailingZeros (unsigned long a)						{ return __builtin_ctzl (a); }
+#else
+static inline bool addOverflow (long int a, long int b, long int& r)
+{
+	if ((b > 0) ? (a > LONG_MAX - b) : (a < LONG_MIN - b)) return true;
+	r = a + b;
+	return false;
 }
-
-rational rational::operator -(const rational &dur) const {
-    return rational(fNumerator * dur.fDenominator - dur.fNumerator * fDenominator, fDenominator * dur.fDenominator);
+static inline bool mulOverflow (long int a, long int b, long int& r)
+{
+	long double p = (long double)a * (long double)b;
+	if ((p > (long double)LONG_MAX) || (p < (long double)LONG_MIN)) return true;
+	r = a * b;
+	return false;
 }
-
-rational rational::operator *(const rational &dur) const {
-    return rational(fNumerator * dur.fNumerator, fDenominator * dur.fDenominator);
+static inline int trailingZeros (unsigned long a)
+{
+	int n = 0;
+	while (!(a & 1)) { a >>= 1; n++; }
+	return n;
 }
+#endif
 
-rational rational::operator /(const rational &dur) const {
-    return rational(fNumerator * dur.fDenominator, fDenominator * dur.fNumerator);
-}
+static inline bool powerOf2 (long int a)	{ return (a > 0) && !(a & (a - 1)); }
 
-rational rational::operator *(int num) const {
-	return rational(fNumerator * num, fDenominator);
-}
+// an overflowing result is approximated by continued fractions, with a limited denominator
+static const long int kMaxDenominator = 1L << 30;
 
-rational rational::operator /(int num) const {
-	return rational(fNumerator, fDenominator * num);
+static void approximate (long double v, long int& num, long int& denom)
+{
+	if (fabsl(v) >= (long double)LONG_MAX) {
+		num = (v > 0) ? LONG_MAX : -LONG_MAX;
+		denom = 1;
+		return;
+	}
+	long int p0 = 0, q0 = 1, p1 = 1, q1 = 0;
+	long double x = v;
+	for (int i = 0; i < 64; i++) {
+		long int a = (long int)floorl (x);
+		long int p2, q2;
+		if (mulOverflow (a, p1, p2) || addOverflow (p2, p0, p2) || mulOverflow (a, q1, q2) || addOverflow (q2, q0, q2)
+			|| (q2 > kMaxDenominator)) break;
+		p0 = p1; q0 = q1; p1 = p2; q1 = q2;
+		long double frac = x - a;
+		if (frac < 1e-15) break;
+		x = 1 / frac;
+	}
+	num = p1;
+	denom = q1;
 }
 
-rational& rational::operator +=(const rational &dur)
+// approximates the result of an overflowing operation
+static int overflow (const char* op, long int n1, long int d1, long int n2, long int d2, long int& num, long int& denom)
 {
-    if(fDenominator == dur.fDenominator) {
-		fNumerator += dur.fNumerator;
-	} else {
-		fNumerator = fNumerator * dur.fDenominator + dur.fNumerator * fDenominator;
-		fDenominator *= dur.fDenominator;
-	}
-    return (*this);
+	long double v1 = (long double)n1 / d1;
+	long double v2 = (long double)n2 / d2;
+	approximate ((*op == '+') ? v1 + v2 : v1 * v2, num, denom);
+	return rational::kOverflow;
 }
 
-rational& rational::operator -=(const rational &dur)
+//______________________________________________________________________________
+// the status of the operations of each thread
+static thread_local int gStatus = rational::kExact;
+
+int rational::status ()			{ return gStatus; }
+void rational::clearStatus ()	{ gStatus = kExact; }
+
+//______________________________________________________________________________
+// reduces the rational and makes the denominator positive
+void rational::reduce ()
 {
-	if(fDenominator == dur.fDenominator) {
-		fNumerator -= dur.fNumerator;
-	} else {
-		fNumerator = fNumerator * dur.fDenominator - dur.fNumerator * fDenominator;
-		fDenominator *= dur.fDenominator;
-    }
-	return (*this);
+	if (fDenominator < 0) {
+		fNumerator = -fNumerator;
+		fDenominator = -fDenominator;
+	}
+	else if (fDenominator == 0) fDenominator = 1;	// as the constructor does
+
+	if (fNumerator == 0) fDenominator = 1;
+	else if (powerOf2 (fDenominator)) {
+		// power of 2 denominators: only the factors 2 are common
+		int n = trailingZeros ((unsigned long)fNumerator);
+		int d = trailingZeros ((unsigned long)fDenominator);
+		int shift = n < d ? n : d;
+		fNumerator >>= shift;
+		fDenominator >>= shift;
+	}
+	else if (fDenominator != 1) {
+		long int g = gcd (fNumerator, fDenominator);
+		fNumerator /= g;
+		fDenominator /= g;
+	}
 }
 
-rational& rational::operator *=(const rational &dur)
+//______________________________________________________________________________
+// adds num/denom to the rational, the result is reduced
+// a zero denominator is taken as 1, as the constructor does
+int rational::add (long int num, long int denom)
 {
-    fNumerator   *= dur.fNumerator;
-    fDenominator *= dur.fDenominator;
-    return (*this);
+	if (denom == 0) denom = 1;
+	if (fDenominator == 0) fDenominator = 1;
+	long int n1 = fNumerator, d1 = fDenominator;
+	long int a, b;
+	bool ovf = false;
+	if ((fDenominator == denom) || (fNumerator == 0) || (num == 0)) {
+		// same denominators or a zero operand: only the numerators are added
+		if (fNumerator == 0) fDenominator = denom;
+		ovf = addOverflow (fNumerator, num, fNumerator);
+	}
+	else if (powerOf2 (fDenominator) && powerOf2 (denom)) {
+		// power of 2 denominators: the common denominator is the largest one
+		int s1 = trailingZeros (fDenominator);
+		int s2 = trailingZeros (denom);
+		if (s1 < s2) {
+			ovf = mulOverflow (fNumerator, 1L << (s2 - s1), a) || addOverflow (a, num, fNumerator);
+			fDenominator = denom;
+		}
+		else ovf = mulOverflow (num, 1L << (s1 - s2), b) || addOverflow (fNumerator, b, fNumerator);
+	}
+	else {
+		// a/b + c/d = t / (b/g * d/g2) where g = gcd(b,d), t = a*(d/g) + c*(b/g) and g2 = gcd(t,g)
+		// this keeps the intermediate values small, and only small numbers are involved in the gcds
+		long int g = gcd (fDenominator, denom);
+		long int bg = fDenominator / g;
+		long int dg = denom / g;
+		ovf = mulOverflow (fNumerator, dg, a) || mulOverflow (num, bg, b) || addOverflow (a, b, fNumerator);
+		if (!ovf) {
+			long int g2 = gcd (fNumerator, g);
+			fNumerator /= g2;
+			ovf = mulOverflow (bg, denom / g2, fDenominator);
+		}
+	}
+	int status = ovf ? overflow ("+", n1, d1, num, denom, fNumerator, fDenominator) : kExact;
+	// the operands may not be reduced
+	reduce();
+	return status;
 }
 
-rational& rational::operator /=(const rational &dur)
+//______________________________________________________________________________
+// multiplies the rational by num/denom, the result is reduced
+// a zero denom is a division by zero: the result is the largest value of its sign
+int rational::mult (long int num, long int denom)
 {
-    fNumerator   *= dur.fDenominator;
-    fDenominator *= dur.fNumerator;
-    return (*this);
+	if (fDenominator == 0) fDenominator = 1;
+	if (denom == 0) {
+		long int sign = ((fNumerator > 0) - (fNumerator < 0)) * ((num > 0) - (num < 0));
+		fNumerator = sign * LONG_MAX;
+		fDenominator = 1;
+		return kDivisionByZero;
+	}
+
+	// cross reduction first: keeps the products small
+	long int g1 = gcd (fNumerator, denom);
+	long int g2 = gcd (num, fDenominator);
+	long int n1 = fNumerator, d1 = fDenominator;
+	int status = kExact;
+	if (mulOverflow (fNumerator / g1, num / g2, fNumerator) || mulOverflow (fDenominator / g2, denom / g1, fDenominator))
+		status = overflow ("*", n1, d1, num, denom, fNumerator, fDenominator);
+	reduce();
+	return status;
 }
 
+//______________________________________________________________________________
+rational rational::operator +(const rational &dur) const	{ rational r(*this); gStatus |= r.add (dur.fNumerator, dur.fDenominator); return r; }
+rational rational::operator -(const rational &dur) const	{ rational r(*this); gStatus |= r.add (-dur.fNumerator, dur.fDenominator); return r; }
+rational rational::operator *(const rational &dur) const	{ rational r(*this); gStatus |= r.mult (dur.fNumerator, dur.fDenominator); return r; }
+rational rational::operator /(const rational &dur) const	{ rational r(*this); gStatus |= r.mult (dur.fDenominator, dur.fNumerator); return r; }
+rational rational::operator *(int num) const				{ rational r(*this); gStatus |= r.mult (num, 1); return r; }
+rational rational::operator /(int num) const				{ rational r(*this); gStatus |= r.mult (1, num); return r; }
+
+rational& rational::operator +=(const rational &dur)	{ gStatus |= add (dur.fNumerator, dur.fDenominator); return (*this); }
+rational& rational::operator -=(const rational &dur)	{ gStatus |= add (-dur.fNumerator, dur.fDenominator); return (*this); }
+rational& rational::operator *=(const rational &dur)	{ gStatus |= mult (dur.fNumerator, dur.fDenominator); return (*this); }
+rational& rational::operator /=(const rational &dur)	{ gStatus |= mult (dur.fDenominator, dur.fNumerator); return (*this); }
+rational& rational::operator *=(long int num)			{ gStatus |= mult (num, 1); return (*this); }
+rational& rational::operator /=(long int num)			{ gStatus |= mult (1, num); return (*this); }
+
 rational& rational::operator = (const rational& rat) {
   fNumerator   = rat.fNumerator;
   fDenominator = rat.fDenominator;
@@ -108,22 +244,42 @@ rational& rational::operator = (const rational& rat) {
 }
 
 //______________________________________________________________________________
+// compares a/b and c/d i.e. a * d and b * c, returns a value <0, 0 or >0
+// a * d < b * c is equivalent to a/b < c/d for positive denominators only: the denominators
+// are positive unless set with setDenominator() or set(), their sign is fixed first
+static int compare (long int a, long int b, long int c, long int d)
+{
+	positive (a, b);
+	positive (c, d);
+	if ((b < 0) || (d < 0)) {		// LONG_MIN can't be negated
+		long double x = (long double)a / b, y = (long double)c / d;
+		return (x < y) ? -1 : (x > y);
+	}
+	if (b == d) return (a < c) ? -1 : (a > c);
+	long int ad, bc;
+	if (mulOverflow (a, d, ad) || mulOverflow (b, c, bc)) {
+		long double x = (long double)a * d, y = (long double)b * c;
+		return (x < y) ? -1 : (x > y);
+	}
+	return (ad < bc) ? -1 : (ad > bc);
+}
+
 bool rational::operator > (const rational &rat) const
 {
   // a/b > c/d if and only if a * d > b * c.
-  return ((fNumerator * rat.fDenominator) > (fDenominator * rat.fNumerator));
+  return compare (fNumerator, fDenominator, rat.fNumerator, rat.fDenominator) > 0;
 }
 
 bool rational::operator < (const rational &rat) const
 {
   // a/b < c/d if and only if a * d < b * c.
-  return ((fNumerator * rat.fDenominator) < (fDenominator * rat.fNumerator));
+  return compare (fNumerator, fDenominator, rat.fNumerator, rat.fDenominator) < 0;
 }
 
 bool rational::operator == (const rational &rat) const
 {
-  // a/b < c/d if and only if a * d < b * c.
-	return ((fNumerator * rat.fDenominator) == (fDenominator * rat.fNumerator));
+  // a/b == c/d if and only if a * d == b * c.
+  return compare (fNumerator, fDenominator, rat.fNumerator, rat.fDenominator) == 0;
 }
 
 bool rational::operator > (double num) const 	{ return (toDouble() > num); }
@@ -133,25 +289,27 @@ bool rational::operator <= (double num) const	{ return (toDouble() <= num); }
 bool rational::operator == (double num) const	{ return (toDouble() == num); }
 
 //______________________________________________________________________________
-// gcd(a, b) calculates the gcd of a and b using Euclid's algorithm.
+// gcd(a, b) calculates the gcd of a and b using the binary GCD algorithm,
+// after a first Euclid step that brings the larger value down to the smaller one.
 long int rational::gcd (long int a1, long int b1)
 {
-  long int r;
-
-  long int a = labs(a1);
-  long int b = labs(b1);
-
-  if (! (a == 0) || (b == 0)) {
-    while (b > 0){
-      r = a % b;
-      a = b;
-      b = r;
-    } // while
-    
-    return a;
-  }
-  
-  return 1;
+  unsigned long a = a1 < 0 ? 0UL - (unsigned long)a1 : a1;
+  unsigned long b = b1 < 0 ? 0UL - (unsigned long)b1 : b1;
+
+  if (a < b) { unsigned long t = a; a = b; b = t; }
+  if (b == 0) return a ? a : 1;
+  a %= b;
+  if (a == 0) return b;
+
+  int shift = trailingZeros (a | b);
+  a >>= trailingZeros (a);
+  do {
+    b >>= trailingZeros (b);
+    if (a > b) { unsigned long t = a; a = b; b = t; }
+    b -= a;
+  } while (b);
+
+  return (long int)(a << shift);
 }
 
 //______________________________________________________________________________
@@ -161,6 +319,7 @@ void rational::rationalise ()
   
   fNumerator /= g;
   fDenominator /= g;
+  positive (fNumerator, fDenominator);
   
   if (fNumerator == 0)
     fDenominator = 1;
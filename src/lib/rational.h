@@ -20,6 +20,14 @@ using namespace std;
 
 /*!
 \brief	Rational number representation.
+
+	The results of the arithmetic operations are reduced, which keeps the
+	denominators small when durations are accumulated. The intermediate
+	computations are checked for overflow: an overflowing result is
+	approximated, and a division by zero gives the largest value of the
+	result sign. Both are reported by status(). Note that the constructors keep the numerator and
+	denominator as given (e.g. a 6/8 time signature), except for the sign
+	which is carried by the numerator.
 */
 
 class EXP rational {
@@ -30,9 +38,21 @@ class EXP rational {
         long int fDenominator;        
         
         // Used by rationalise()
-        long int gcd(long int a, long int b); 
+        static long int gcd(long int a, long int b); 
+
+        // arithmetic helpers: the result is reduced, they return the operation status
+        int  add (long int num, long int denom);
+        int  mult (long int num, long int denom);
+        void reduce ();
  
     public:    
+
+        //! the operations status flags
+        enum { kExact = 0, kOverflow = 1, kDivisionByZero = 2 };
+
+        //! the flags of the inexact operations done by the calling thread since the last clearStatus()
+        static int  status ();
+        static void clearStatus ();
 	
         rational(long int num = 0, long int denom = 1);
         rational(const rational& d);
@@ -61,8 +81,8 @@ class EXP rational {
         rational& operator /=(const rational &dur);
         // (i.e. dur * 3/2 or dur * 7/4)
 
-        rational& operator *=(long int num) { fNumerator *= num; return *this; }
-        rational& operator /=(long int num) { fDenominator *= num; return *this; }
+        rational& operator *=(long int num);
+        rational& operator /=(long int num);
  
         rational& operator =(const rational& dur);
     
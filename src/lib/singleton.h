@@ -13,7 +13,8 @@
 #ifndef __singleton__
 #define __singleton__
 
-// warning: this is NOT a thread safe implementation
+// the instance creation is thread safe (C++11 static local initialization)
+// but the instance itself is not protected
 template <typename T> class singleton {
 	public:
 		static T& instance () {
@@ -115,7 +115,7 @@ template<class T> class SMARTP {
 		//! dynamic cast support
 		template<class T2> SMARTP& cast(const SMARTP<T2>& p_) { return operator=(dynamic_cast<T*>(p_)); }
 		//! operator < (require by VC6 for maps)
-		bool operator < (const SMARTP<T>& p_) const			  { return (void*)this < (void*)p_; }
+		bool operator < (const SMARTP<T>& p_) const			  { return (void*)fSmartPtr < (void*)p_.fSmartPtr; }
 };
 
 }
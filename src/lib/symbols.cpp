@@ -0,0 +1,90 @@
+/*
+  MusicXML Library
+  Copyright (C) Grame 2006-2013
+
+  This Source Code Form is subject to the terms of the Mozilla Public
+  License, v. 2.0. If a copy of the MPL was not distributed with this
+  file, You can obtain one at http://mozilla.org/MPL/2.0/.
+
+  Grame Research Laboratory, 11, cours de Verdun Gensoul 69002 Lyon - France
+  research@grame.fr
+*/
+
+#include <string.h>
+#include <functional>
+#include <vector>
+
+#include "symbols.h"
+
+using namespace std;
+
+namespace MusicXML2
+{
+
+//______________________________________________________________________________
+// kVocabulary: generated from the MusicXML schema, as the elements factory (see schema/Makefile)
+#include "vocabulary.h"
+
+//______________________________________________________________________________
+// an open addressing hash table of strings, built once
+//______________________________________________________________________________
+class symbolsTable
+{
+	vector<string>		fStrings;		// never resized once built: the symbols remain valid
+	vector<symbol>		fSlots;
+
+	static size_t hash (const char* str, size_t& len) {
+		size_t h = 2166136261u;
+		const char* ptr = str;
+		while (*ptr) {
+			h ^= (unsigned char)*ptr++;
+			h *= 16777619u;
+		}
+		len = ptr - str;
+		return h;
+	}
+
+	// gives the slot of a string: either the slot holding the string or a free slot
+	size_t slot (const char* str) const {
+		size_t len;
+		size_t mask = fSlots.size() - 1;
+		size_t i = hash(str, len) & mask;
+		while (fSlots[i]) {
+			if ((fSlots[i]->size() == len) && !memcmp(fSlots[i]->data(), str, len)) break;
+			i = (i + 1) & mask;
+		}
+		return i;
+	}
+
+	public:
+		symbolsTable() {
+			const size_t count = sizeof(kVocabulary) / sizeof(kVocabulary[0]);
+			fStrings.assign (kVocabulary, kVocabulary + count);
+			size_t size = 1;
+			while (size < 4 * count) size <<= 1;		// keeps the load factor under 25%
+			fSlots.assign (size, (symbol)0);
+			for (size_t i = 0; i < count; i++) {
+				size_t s = slot (fStrings[i].c_str());
+				if (!fSlots[s]) fSlots[s] = &fStrings[i];
+			}
+		}
+
+		symbol find (const char* str) const		{ return fSlots[slot(str)]; }
+
+		bool known (const string* str) const {
+			less<const string*> before;
+			return !before (str, &fStrings.front()) && !before (&fStrings.back(), str);
+		}
+};
+
+// the table is built once (thread safe initialization) and is never deleted
+// so that symbols remain valid until the process ends
+static const symbolsTable& table ()		{ static const symbolsTable* t = new symbolsTable; return *t; }
+
+//______________________________________________________________________________
+symbol symbols::find (const char* str)				{ return table().find (str); }
+symbol symbols::find (const std::string& str)		{ return table().find (str.c_str()); }
+bool   symbols::known (const std::string* str)		{ return str && table().known (str); }
+symbol symbols::empty ()							{ static symbol e = find(""); return e; }
+
+}
@@ -0,0 +1,57 @@
+/*
+  MusicXML Library
+  Copyright (C) Grame 2006-2013
+
+  This Source Code Form is subject to the terms of the Mozilla Public
+  License, v. 2.0. If a copy of the MPL was not distributed with this
+  file, You can obtain one at http://mozilla.org/MPL/2.0/.
+
+  Grame Research Laboratory, 11, cours de Verdun Gensoul 69002 Lyon - France
+  research@grame.fr
+*/
+
+#ifndef __symbols__
+#define __symbols__
+
+#include <string>
+
+#include "exports.h"
+
+namespace MusicXML2
+{
+
+/*!
+\brief the table of the MusicXML names
+
+	The table holds a fixed vocabulary: the MusicXML elements and attributes
+	names, generated from the MusicXML schema as the elements factory (see
+	vocabulary.h). It is built at the first use and is never modified
+	afterwards, thus the lookups don't need any lock, and the names read
+	from the documents are never added to the table.
+\n	A symbol (a pointer to a string of the table) remains valid for the process
+	lifetime. Two symbols are equal if and only if the corresponding strings are
+	equal, which makes symbols comparison a pointer comparison.
+	Names out of the vocabulary have no symbol: the elements and attributes
+	keep them as strings of their own (see xmlname).
+*/
+//______________________________________________________________________________
+class EXP symbols
+{
+	public:
+		typedef const std::string* symbol;
+
+		//! gives the symbol of a name of the vocabulary, null for other names
+		static symbol	find (const char* str);
+		static symbol	find (const std::string& str);
+
+		//! checks that a string pointer is a symbol of the table
+		static bool		known (const std::string* str);
+
+		//! the symbol of the empty string
+		static symbol	empty ();
+};
+typedef symbols::symbol symbol;
+
+}
+
+#endif
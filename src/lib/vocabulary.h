@@ -0,0 +1,577 @@
+/*
+  MusicXML Library
+  Copyright (C) Grame 2006-2013
+
+  This Source Code Form is subject to the terms of the Mozilla Public
+  License, v. 2.0. If a copy of the MPL was not distributed with this
+  file, You can obtain one at http://mozilla.org/MPL/2.0/.
+
+  Grame Research Laboratory, 11, cours de Verdun Gensoul 69002 Lyon - France
+  research@grame.fr
+*/
+
+//======================================================================
+// You should not modify this file!
+// It is automatically generated from the MusicXML DTDs and from 
+// template files (located in the templates folder). 
+//======================================================================
+
+// the MusicXML elements and attributes names, the names given by the
+// factory to comments and processing instructions, and the attributes
+// that are not in the schema: the container.xml ones of the .mxl files
+// and xmlns:xlink (misspelled in the schema)
+// this file is included by symbols.cpp only
+static const char* kVocabulary[] = {
+  "",
+  "abbreviated",
+  "accelerate",
+  "accent",
+  "accidental",
+  "accidental-mark",
+  "accidental-text",
+  "accord",
+  "accordion-high",
+  "accordion-low",
+  "accordion-middle",
+  "accordion-registration",
+  "actual-notes",
+  "additional",
+  "after-barline",
+  "alter",
+  "alternate",
+  "appearance",
+  "approach",
+  "arpeggiate",
+  "arrow",
+  "arrow-direction",
+  "arrow-style",
+  "arrowhead",
+  "articulations",
+  "artificial",
+  "attack",
+  "attribute",
+  "attributes",
+  "backup",
+  "bar-style",
+  "barline",
+  "barre",
+  "base-pitch",
+  "bass",
+  "bass-alter",
+  "bass-step",
+  "beam",
+  "beat-repeat",
+  "beat-type",
+  "beat-unit",
+  "beat-unit-dot",
+  "beat-unit-tied",
+  "beater",
+  "beats",
+  "bend",
+  "bend-alter",
+  "bezier-offset",
+  "bezier-offset2",
+  "bezier-x",
+  "bezier-x2",
+  "bezier-y",
+  "bezier-y2",
+  "blank-page",
+  "bookmark",
+  "bottom-margin",
+  "bottom-staff",
+  "bracket",
+  "bracket-degrees",
+  "brass-bend",
+  "breath-mark",
+  "caesura",
+  "cancel",
+  "capo",
+  "cautionary",
+  "chord",
+  "chromatic",
+  "circular-arrow",
+  "clef",
+  "clef-octave-change",
+  "coda",
+  "color",
+  "comment",
+  "creator",
+  "credit",
+  "credit-image",
+  "credit-symbol",
+  "credit-type",
+  "credit-words",
+  "cue",
+  "dacapo",
+  "dalsegno",
+  "damp",
+  "damp-all",
+  "damper-pedal",
+  "dash-length",
+  "dashed-circle",
+  "dashes",
+  "default-x",
+  "default-y",
+  "defaults",
+  "degree",
+  "degree-alter",
+  "degree-type",
+  "degree-value",
+  "delayed-inverted-turn",
+  "delayed-turn",
+  "departure",
+  "detached-legato",
+  "diatonic",
+  "dir",
+  "direction",
+  "direction-type",
+  "directive",
+  "display-octave",
+  "display-step",
+  "display-text",
+  "distance",
+  "divisions",
+  "doit",
+  "dot",
+  "double",
+  "double-tongue",
+  "down-bow",
+  "duration",
+  "dynamics",
+  "editorial",
+  "effect",
+  "element",
+  "elevation",
+  "elision",
+  "enclosure",
+  "encoder",
+  "encoding",
+  "encoding-date",
+  "encoding-description",
+  "end-dynamics",
+  "end-length",
+  "end-line",
+  "end-paragraph",
+  "ending",
+  "ensemble",
+  "except-voice",
+  "extend",
+  "eyeglasses",
+  "f",
+  "falloff",
+  "fan",
+  "feature",
+  "fermata",
+  "ff",
+  "fff",
+  "ffff",
+  "fffff",
+  "ffffff",
+  "fifths",
+  "figure",
+  "figure-number",
+  "figured-bass",
+  "filled",
+  "fine",
+  "fingering",
+  "fingernails",
+  "first-beat",
+  "first-fret",
+  "flip",
+  "font-family",
+  "font-size",
+  "font-style",
+  "font-weight",
+  "footnote",
+  "forward",
+  "forward-repeat",
+  "fp",
+  "frame",
+  "frame-frets",
+  "frame-note",
+  "frame-strings",
+  "fret",
+  "full-path",
+  "function",
+  "fz",
+  "glass",
+  "glissando",
+  "glyph",
+  "golpe",
+  "grace",
+  "group",
+  "group-abbreviation",
+  "group-abbreviation-display",
+  "group-barline",
+  "group-name",
+  "group-name-display",
+  "group-symbol",
+  "group-time",
+  "grouping",
+  "half-muted",
+  "halign",
+  "hammer-on",
+  "hand",
+  "handbell",
+  "harmon-closed",
+  "harmon-mute",
+  "harmonic",
+  "harmony",
+  "harp-pedals",
+  "haydn",
+  "heel",
+  "height",
+  "hole",
+  "hole-closed",
+  "hole-shape",
+  "hole-type",
+  "humming",
+  "id",
+  "identification",
+  "image",
+  "implicit",
+  "instrument",
+  "instrument-abbreviation",
+  "instrument-name",
+  "instrument-sound",
+  "instruments",
+  "interchangeable",
+  "inversion",
+  "inverted-mordent",
+  "inverted-turn",
+  "inverted-vertical-turn",
+  "ipa",
+  "justify",
+  "key",
+  "key-accidental",
+  "key-alter",
+  "key-octave",
+  "key-step",
+  "kind",
+  "last-beat",
+  "laughing",
+  "left-divider",
+  "left-margin",
+  "letter-spacing",
+  "level",
+  "line",
+  "line-end",
+  "line-height",
+  "line-length",
+  "line-shape",
+  "line-through",
+  "line-type",
+  "line-width",
+  "link",
+  "location",
+  "long",
+  "lyric",
+  "lyric-font",
+  "lyric-language",
+  "make-time",
+  "measure",
+  "measure-distance",
+  "measure-layout",
+  "measure-numbering",
+  "measure-repeat",
+  "measure-style",
+  "media-type",
+  "member-of",
+  "membrane",
+  "metal",
+  "metronome",
+  "metronome-arrows",
+  "metronome-beam",
+  "metronome-dot",
+  "metronome-note",
+  "metronome-relation",
+  "metronome-tied",
+  "metronome-tuplet",
+  "metronome-type",
+  "mf",
+  "midi-bank",
+  "midi-channel",
+  "midi-device",
+  "midi-instrument",
+  "midi-name",
+  "midi-program",
+  "midi-unpitched",
+  "millimeters",
+  "miscellaneous",
+  "miscellaneous-field",
+  "mode",
+  "mordent",
+  "movement-number",
+  "movement-title",
+  "mp",
+  "multiple-rest",
+  "music-font",
+  "mute",
+  "n",
+  "name",
+  "natural",
+  "new-page",
+  "new-system",
+  "niente",
+  "non-arpeggiate",
+  "non-controlling",
+  "normal-dot",
+  "normal-notes",
+  "normal-type",
+  "notations",
+  "note",
+  "note-size",
+  "notehead",
+  "notehead-text",
+  "number",
+  "octave",
+  "octave-change",
+  "octave-shift",
+  "offset",
+  "open",
+  "open-string",
+  "opus",
+  "orientation",
+  "ornaments",
+  "other-appearance",
+  "other-articulation",
+  "other-direction",
+  "other-dynamics",
+  "other-notation",
+  "other-ornament",
+  "other-percussion",
+  "other-play",
+  "other-technical",
+  "overline",
+  "p",
+  "page",
+  "page-height",
+  "page-layout",
+  "page-margins",
+  "page-number",
+  "page-width",
+  "pan",
+  "parentheses",
+  "parentheses-degrees",
+  "part",
+  "part-abbreviation",
+  "part-abbreviation-display",
+  "part-group",
+  "part-list",
+  "part-name",
+  "part-name-display",
+  "part-symbol",
+  "pedal",
+  "pedal-alter",
+  "pedal-step",
+  "pedal-tuning",
+  "per-minute",
+  "percussion",
+  "pf",
+  "pi",
+  "pitch",
+  "pitched",
+  "pizzicato",
+  "placement",
+  "play",
+  "plop",
+  "pluck",
+  "plus-minus",
+  "port",
+  "position",
+  "pp",
+  "ppp",
+  "pppp",
+  "ppppp",
+  "pppppp",
+  "pre-bend",
+  "prefix",
+  "principal-voice",
+  "print",
+  "print-dot",
+  "print-frame",
+  "print-leger",
+  "print-lyric",
+  "print-object",
+  "print-spacing",
+  "pull-off",
+  "reference",
+  "rehearsal",
+  "relation",
+  "relative-x",
+  "relative-y",
+  "release",
+  "repeat",
+  "repeater",
+  "rest",
+  "rf",
+  "rfz",
+  "right-divider",
+  "right-margin",
+  "rights",
+  "root",
+  "root-alter",
+  "root-step",
+  "rotation",
+  "scaling",
+  "schleifer",
+  "scoop",
+  "scordatura",
+  "score-instrument",
+  "score-part",
+  "score-partwise",
+  "score-timewise",
+  "second-beat",
+  "segno",
+  "semi-pitched",
+  "senza-misura",
+  "separator",
+  "sf",
+  "sffz",
+  "sfp",
+  "sfpp",
+  "sfz",
+  "sfzp",
+  "shake",
+  "show-frets",
+  "show-number",
+  "show-type",
+  "sign",
+  "size",
+  "slash",
+  "slash-dot",
+  "slash-type",
+  "slashes",
+  "slide",
+  "slur",
+  "smear",
+  "smufl",
+  "snap-pizzicato",
+  "soft-accent",
+  "soft-pedal",
+  "software",
+  "solo",
+  "sostenuto-pedal",
+  "sound",
+  "sounding-pitch",
+  "source",
+  "space-length",
+  "spiccato",
+  "spread",
+  "staccatissimo",
+  "staccato",
+  "stack-degrees",
+  "staff",
+  "staff-details",
+  "staff-distance",
+  "staff-divide",
+  "staff-layout",
+  "staff-lines",
+  "staff-size",
+  "staff-spacing",
+  "staff-tuning",
+  "staff-type",
+  "start-note",
+  "staves",
+  "steal-time-following",
+  "steal-time-previous",
+  "stem",
+  "step",
+  "stick",
+  "stick-location",
+  "stick-material",
+  "stick-type",
+  "stopped",
+  "stress",
+  "string",
+  "string-mute",
+  "strong-accent",
+  "substitution",
+  "suffix",
+  "supports",
+  "syllabic",
+  "symbol",
+  "system-distance",
+  "system-dividers",
+  "system-layout",
+  "system-margins",
+  "tap",
+  "technical",
+  "tempo",
+  "tenths",
+  "tenuto",
+  "text",
+  "text-x",
+  "text-y",
+  "thumb-position",
+  "tie",
+  "tied",
+  "time",
+  "time-modification",
+  "time-only",
+  "time-relation",
+  "times",
+  "timpani",
+  "tip",
+  "tocoda",
+  "toe",
+  "top-margin",
+  "top-staff",
+  "top-system-distance",
+  "touching-pitch",
+  "transpose",
+  "tremolo",
+  "trill-mark",
+  "trill-step",
+  "triple-tongue",
+  "tuning-alter",
+  "tuning-octave",
+  "tuning-step",
+  "tuplet",
+  "tuplet-actual",
+  "tuplet-dot",
+  "tuplet-normal",
+  "tuplet-number",
+  "tuplet-type",
+  "turn",
+  "two-note-turn",
+  "type",
+  "underline",
+  "unpitched",
+  "unplayed",
+  "unstress",
+  "up-bow",
+  "use-dots",
+  "use-stems",
+  "use-symbols",
+  "valign",
+  "value",
+  "version",
+  "vertical-turn",
+  "virtual-instrument",
+  "virtual-library",
+  "virtual-name",
+  "voice",
+  "volume",
+  "wavy-line",
+  "wedge",
+  "width",
+  "winged",
+  "with-bar",
+  "wood",
+  "word-font",
+  "words",
+  "work",
+  "work-number",
+  "work-title",
+  "xlink:actuate",
+  "xlink:href",
+  "xlink:role",
+  "xlink:show",
+  "xlink:title",
+  "xlink:type",
+  "xml:lang",
+  "xml:space",
+  "xmlns:xlink",
+  "xmnls:xlink",
+};
@@ -0,0 +1,145 @@
+/*
+  MusicXML Library
+  Copyright (C) Grame 2006-2013
+
+  This Source Code Form is subject to the terms of the Mozilla Public
+  License, v. 2.0. If a copy of the MPL was not distributed with this
+  file, You can obtain one at http://mozilla.org/MPL/2.0/.
+
+  Grame Research Laboratory, 11, cours de Verdun Gensoul 69002 Lyon - France
+  research@grame.fr
+*/
+
+#ifdef VC6
+# pragma warning (disable : 4786)
+#endif
+
+#include "conversionContext.h"
+
+#include "traceOptions.h"
+#include "generalOptions.h"
+#include "musicXMLOptions.h"
+#include "msrOptions.h"
+#include "lpsrOptions.h"
+#include "lilypondOptions.h"
+#include "extraOptions.h"
+#include "xml2lyOptionsHandling.h"
+
+using namespace std;
+
+namespace MusicXML2 {
+
+// code taken from:
+// http://comp.lang.cpp.moderated.narkive.com/fylLGJgp/redirect-output-to-dev-null
+template<typename Ch, typename Traits = std::char_traits<Ch> >
+struct basic_nullbuf : std::basic_streambuf<Ch, Traits>
+{
+  typedef std::basic_streambuf<Ch, Traits> base_type;
+  typedef typename base_type::int_type int_type;
+  typedef typename base_type::traits_type traits_type;
+
+  virtual int_type overflow (int_type c) {
+    return traits_type::not_eof (c);
+  }
+};
+
+// convenient typedefs
+typedef basic_nullbuf <char>    nullbuf;
+
+// the null buffer has no state, it is shared by the contexts
+static nullbuf cnull_obj;
+
+//______________________________________________________________________________
+// the current context of each thread, null until first used
+static thread_local conversionContext* gCurrentContext = nullptr;
+
+conversionContext& conversionContext::current ()
+{
+  if (! gCurrentContext) {
+    // the thread's own context, destroyed when the thread exits
+    static thread_local conversionContext threadContext;
+
+    gCurrentContext = &threadContext;
+  }
+
+  return *gCurrentContext;
+}
+
+void conversionContext::setCurrent (conversionContext* context)
+{
+  // a null context will be replaced by the thread's own one in current ()
+  gCurrentContext = context;
+}
+
+//______________________________________________________________________________
+conversionContext::conversionContext ()
+  : fOutputIndentedOstream (cout, fIndenter),
+    fLogIndentedOstream (cerr, fIndenter),
+    fNullOstream (& cnull_obj),
+    fNullIndentedOstream (fNullOstream, fIndenter)
+{
+  fErrorsThrowExceptions = false;
+
+  fSegmentsCounter = 0;
+  fPartsCounter    = 0;
+}
+
+conversionContext::~conversionContext ()
+{
+  if (gCurrentContext == this)
+    gCurrentContext = nullptr;
+}
+
+void conversionContext::reset ()
+{
+  // options
+  fTraceOptions = nullptr;
+  fTraceOptionsUserChoices = nullptr;
+  fTraceOptionsWithDetailedTrace = nullptr;
+
+  fGeneralOptions = nullptr;
+  fGeneralOptionsUserChoices = nullptr;
+
+  fMusicXMLOptions = nullptr;
+  fMusicXMLOptionsUserChoices = nullptr;
+  fMusicXMLOptionsWithDetailedTrace = nullptr;
+
+  fMsrOptions = nullptr;
+  fMsrOptionsUserChoices = nullptr;
+  fMsrOptionsWithDetailedTrace = nullptr;
+
+  fLpsrOptions = nullptr;
+  fLpsrOptionsUserChoices = nullptr;
+  fLpsrOptionsWithDetailedTrace = nullptr;
+
+  fLilypondOptions = nullptr;
+  fLilypondOptionsUserChoices = nullptr;
+  fLilypondOptionsWithDetailedTrace = nullptr;
+
+  fExtraOptions = nullptr;
+  fExtraOptionsUserChoices = nullptr;
+  fExtraOptionsWithDetailedTrace = nullptr;
+
+  fXml2lyOptions = nullptr;
+
+  // indentation and streams
+  fIndenter.resetToZero ();
+
+  fOutputIndentedOstream.flush ();
+  fLogIndentedOstream.flush ();
+
+  // messages
+  fWarningsInputLineNumbers.clear ();
+  fErrorsInputLineNumbers.clear ();
+
+  // timing and profiling
+  fTiming    = timing ();
+  fProfiling = profiling ();
+
+  // MSR numbering
+  fSegmentsCounter = 0;
+  fPartsCounter    = 0;
+}
+
+
+} // namespace MusicXML2
@@ -0,0 +1,249 @@
+/*
+  MusicXML Library
+  Copyright (C) Grame 2006-2013
+
+  This Source Code Form is subject to the terms of the Mozilla Public
+  License, v. 2.0. If a copy of the MPL was not distributed with this
+  file, You can obtain one at http://mozilla.org/MPL/2.0/.
+
+  Grame Research Laboratory, 11, cours de Verdun Gensoul 69002 Lyon - France
+  research@grame.fr
+*/
+
+#ifndef ___conversionContext___
+#define ___conversionContext___
+
+#include <set>
+#include <iostream>
+
+#include "exports.h"
+#include "smartpointer.h"
+
+#include "utilities.h"
+#include "profiling.h"
+
+
+namespace MusicXML2
+{
+
+class traceOptions;
+class generalOptions;
+class musicXMLOptions;
+class msrOptions;
+class lpsrOptions;
+class lilypondOptions;
+class extraOptions;
+class xml2lyOptions;
+
+/*!
+\brief the state of an xml2ly conversion
+
+  The options, the indentation, the log and output streams, the messages
+  input line numbers, the timing and profiling information and the MSR
+  numbering counters used to be process-wide globals, which prevented
+  two conversions from running at the same time in a process.
+  They now belong to a conversion context, and accessors named after
+  the former globals, such as gMsrOptions () or gLogIOstream (), give
+  those of the current context.
+
+  Each thread has its own context, created on first use, so that
+  concurrent conversions should simply run on different threads:
+  the options handler is created in the thread that does the conversion.
+  A context can also be created explicitly and made current with
+  setCurrent (), and reset () allows for reusing it for another
+  conversion, e.g. in the worker threads of a server.
+
+  initializeMSR () and initializeLPSR () build tables that are shared
+  by all contexts: they should be called once before the threads start.
+*/
+//______________________________________________________________________________
+class EXP conversionContext
+{
+  public:
+
+                          conversionContext ();
+    virtual               ~conversionContext ();
+
+    // the current context of the calling thread
+    static conversionContext&
+                          current ();
+
+    // make context the current context of the calling thread,
+    // a null context restores the thread's own context
+    static void           setCurrent (conversionContext* context);
+
+    // forget the options, messages and counts of the previous conversion
+    void                  reset ();
+
+  public:
+
+    // options
+    // ------------------------------------------------------
+
+    SMARTP<traceOptions>  fTraceOptions;
+    SMARTP<traceOptions>  fTraceOptionsUserChoices;
+    SMARTP<traceOptions>  fTraceOptionsWithDetailedTrace;
+
+    SMARTP<generalOptions>
+                          fGeneralOptions;
+    SMARTP<generalOptions>
+                          fGeneralOptionsUserChoices;
+
+    SMARTP<musicXMLOptions>
+                          fMusicXMLOptions;
+    SMARTP<musicXMLOptions>
+                          fMusicXMLOptionsUserChoices;
+    SMARTP<musicXMLOptions>
+                          fMusicXMLOptionsWithDetailedTrace;
+
+    SMARTP<msrOptions>    fMsrOptions;
+    SMARTP<msrOptions>    fMsrOptionsUserChoices;
+    SMARTP<msrOptions>    fMsrOptionsWithDetailedTrace;
+
+    SMARTP<lpsrOptions>   fLpsrOptions;
+    SMARTP<lpsrOptions>   fLpsrOptionsUserChoices;
+    SMARTP<lpsrOptions>   fLpsrOptionsWithDetailedTrace;
+
+    SMARTP<lilypondOptions>
+                          fLilypondOptions;
+    SMARTP<lilypondOptions>
+                          fLilypondOptionsUserChoices;
+    SMARTP<lilypondOptions>
+                          fLilypondOptionsWithDetailedTrace;
+
+    SMARTP<extraOptions>  fExtraOptions;
+    SMARTP<extraOptions>  fExtraOptionsUserChoices;
+    SMARTP<extraOptions>  fExtraOptionsWithDetailedTrace;
+
+    SMARTP<xml2lyOptions> fXml2lyOptions;
+
+    // indentation and streams
+    // ------------------------------------------------------
+
+    indenter              fIndenter;
+
+    indentedOstream       fOutputIndentedOstream;
+    indentedOstream       fLogIndentedOstream;
+
+  private:
+    // the null indented stream writes to it
+    std::ostream          fNullOstream;
+
+  public:
+    indentedOstream       fNullIndentedOstream;
+
+    // messages
+    // ------------------------------------------------------
+
+    std::set<int>         fWarningsInputLineNumbers;
+    std::set<int>         fErrorsInputLineNumbers;
+
+    // the errors throw an msrException instead of exiting or aborting,
+    // so that a batch can go on with the next file, not changed by reset ()
+    bool                  fErrorsThrowExceptions;
+
+    // timing and profiling
+    // ------------------------------------------------------
+
+    timing                fTiming;
+    profiling             fProfiling;
+
+    // MSR numbering
+    // ------------------------------------------------------
+
+    int                   fSegmentsCounter;
+    int                   fPartsCounter;
+
+  private:
+
+    // contexts are not copied
+                          conversionContext (const conversionContext&);
+    conversionContext&    operator= (const conversionContext&);
+};
+
+
+//______________________________________________________________________________
+// the accessors to the current context, named after the former globals
+
+// options
+inline SMARTP<traceOptions>&    gTraceOptions ()
+                                  { return conversionContext::current ().fTraceOptions; }
+inline SMARTP<traceOptions>&    gTraceOptionsUserChoices ()
+                                  { return conversionContext::current ().fTraceOptionsUserChoices; }
+inline SMARTP<traceOptions>&    gTraceOptionsWithDetailedTrace ()
+                                  { return conversionContext::current ().fTraceOptionsWithDetailedTrace; }
+
+inline SMARTP<generalOptions>&  gGeneralOptions ()
+                                  { return conversionContext::current ().fGeneralOptions; }
+inline SMARTP<generalOptions>&  gGeneralOptionsUserChoices ()
+                                  { return conversionContext::current ().fGeneralOptionsUserChoices; }
+
+inline SMARTP<musicXMLOptions>& gMusicXMLOptions ()
+                                  { return conversionContext::current ().fMusicXMLOptions; }
+inline SMARTP<musicXMLOptions>& gMusicXMLOptionsUserChoices ()
+                                  { return conversionContext::current ().fMusicXMLOptionsUserChoices; }
+inline SMARTP<musicXMLOptions>& gMusicXMLOptionsWithDetailedTrace ()
+                                  { return conversionContext::current ().fMusicXMLOptionsWithDetailedTrace; }
+
+inline SMARTP<msrOptions>&      gMsrOptions ()
+                                  { return conversionContext::current ().fMsrOptions; }
+inline SMARTP<msrOptions>&      gMsrOptionsUserChoices ()
+                                  { return conversionContext::current ().fMsrOptionsUserChoices; }
+inline SMARTP<msrOptions>&      gMsrOptionsWithDetailedTrace ()
+                                  { return conversionContext::current ().fMsrOptionsWithDetailedTrace; }
+
+inline SMARTP<lpsrOptions>&     gLpsrOptions ()
+                                  { return conversionContext::current ().fLpsrOptions; }
+inline SMARTP<lpsrOptions>&     gLpsrOptionsUserChoices ()
+                                  { return conversionContext::current ().fLpsrOptionsUserChoices; }
+inline SMARTP<lpsrOptions>&     gLpsrOptionsWithDetailedTrace ()
+                                  { return conversionContext::current ().fLpsrOptionsWithDetailedTrace; }
+
+inline SMARTP<lilypondOptions>& gLilypondOptions ()
+                                  { return conversionContext::current ().fLilypondOptions; }
+inline SMARTP<lilypondOptions>& gLilypondOptionsUserChoices ()
+                                  { return conversionContext::current ().fLilypondOptionsUserChoices; }
+inline SMARTP<lilypondOptions>& gLilypondOptionsWithDetailedTrace ()
+                                  { return conversionContext::current ().fLilypondOptionsWithDetailedTrace; }
+
+inline SMARTP<extraOptions>&    gExtraOptions ()
+                                  { return conversionContext::current ().fExtraOptions; }
+inline SMARTP<extraOptions>&    gExtraOptionsUserChoices ()
+                                  { return conversionContext::current ().fExtraOptionsUserChoices; }
+inline SMARTP<extraOptions>&    gExtraOptionsWithDetailedTrace ()
+                                  { return conversionContext::current ().fExtraOptionsWithDetailedTrace; }
+
+inline SMARTP<xml2lyOptions>&   gXml2lyOptions ()
+                                  { return conversionContext::current ().fXml2lyOptions; }
+
+// indentation and streams
+inline indenter&                gIndenter ()
+                                  { return conversionContext::current ().fIndenter; }
+// a spacer for adhoc uses, without increasing the indentation
+inline std::string              gTab ()
+                                  { return gIndenter ().getSpacer (); }
+
+inline indentedOstream&         gOutputIOstream ()
+                                  { return conversionContext::current ().fOutputIndentedOstream; }
+inline indentedOstream&         gLogIOstream ()
+                                  { return conversionContext::current ().fLogIndentedOstream; }
+inline indentedOstream&         gNullIOstream ()
+                                  { return conversionContext::current ().fNullIndentedOstream; }
+
+// messages
+inline std::set<int>&           gWarningsInputLineNumbers ()
+                                  { return conversionContext::current ().fWarningsInputLineNumbers; }
+inline std::set<int>&           gErrorsInputLineNumbers ()
+                                  { return conversionContext::current ().fErrorsInputLineNumbers; }
+
+// timing and profiling
+inline timing&                  gTiming ()
+                                  { return conversionContext::current ().fTiming; }
+inline profiling&               gProfiling ()
+                                  { return conversionContext::current ().fProfiling; }
+
+
+} // namespace MusicXML2
+
+
+#endif
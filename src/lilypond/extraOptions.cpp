@@ -68,19 +68,19 @@ void optionsShowAllChordsStructuresItem::print (ostream& os) const
     "OptionsShowAllChordsStructuresItem:" <<
     endl;
 
-  gIndenter++;
+  gIndenter ()++;
 
   optionsElement::printElementEssentials (
     os, fieldWidth);
 
-  gIndenter++;
+  gIndenter ()++;
   os <<
-    gIndenter.indentMultiLineString (
+    gIndenter ().indentMultiLineString (
       fOptionsElementDescription) <<
     endl;
-  gIndenter--;
+  gIndenter ()--;
 
-  gIndenter--;
+  gIndenter ()--;
 }
 
 void optionsShowAllChordsStructuresItem::printAllChordsStructures (ostream& os) const
@@ -151,19 +151,19 @@ void optionsShowAllChordsContentsItem::print (ostream& os) const
     "optionsShowAllChordsContentsItem:" <<
     endl;
 
-  gIndenter++;
+  gIndenter ()++;
 
   optionsElement::printElementEssentials (
     os, fieldWidth);
 
-  gIndenter++;
+  gIndenter ()++;
   os <<
-    gIndenter.indentMultiLineString (
+    gIndenter ().indentMultiLineString (
       fOptionsElementDescription) <<
     endl;
-  gIndenter--;
+  gIndenter ()--;
 
-  gIndenter--;
+  gIndenter ()--;
 }
 
 void optionsShowAllChordsContentsItem::printAllChordsContents (
@@ -238,19 +238,19 @@ void optionsShowChordDetailsItem::print (ostream& os) const
     "optionsShowChordDetailsItem:" <<
     endl;
 
-  gIndenter++;
+  gIndenter ()++;
 
   optionsElement::printElementEssentials (
     os, fieldWidth);
 
-  gIndenter++;
+  gIndenter ()++;
   os <<
-    gIndenter.indentMultiLineString (
+    gIndenter ().indentMultiLineString (
       fOptionsElementDescription) <<
     endl;
-  gIndenter--;
+  gIndenter ()--;
 
-  gIndenter--;
+  gIndenter ()--;
 }
 
 void optionsShowChordDetailsItem::printOptionsValues (
@@ -316,19 +316,19 @@ void optionsShowChordAnalysisItem::print (ostream& os) const
     "optionsShowChordAnalysisItem:" <<
     endl;
 
-  gIndenter++;
+  gIndenter ()++;
 
   optionsElement::printElementEssentials (
     os, fieldWidth);
 
-  gIndenter++;
+  gIndenter ()++;
   os <<
-    gIndenter.indentMultiLineString (
+    gIndenter ().indentMultiLineString (
       fOptionsElementDescription) <<
     endl;
-  gIndenter--;
+  gIndenter ()--;
 
-  gIndenter--;
+  gIndenter ()--;
 }
 
 void optionsShowChordAnalysisItem::printOptionsValues (
@@ -345,11 +345,6 @@ ostream& operator<< (ostream& os, const S_optionsShowChordAnalysisItem& elt)
 }
 
 //_______________________________________________________________________________
-
-S_extraOptions gExtraOptions;
-S_extraOptions gExtraOptionsUserChoices;
-S_extraOptions gExtraOptionsWithDetailedTrace;
-
 S_extraOptions extraOptions::create (
   S_optionsHandler optionsHandler)
 {
@@ -573,11 +568,11 @@ void extraOptions::checkOptionsConsistency ()
 //______________________________________________________________________________
 void extraOptions::printExtraOptionsValues (int fieldWidth)
 {  
-  gLogIOstream <<
+  gLogIOstream () <<
     "The extra options are:" << // JMI
     endl;
 
-  gIndenter++;
+  gIndenter ()++;
 
   // chord intervals
   // --------------------------------------
@@ -585,7 +580,7 @@ void extraOptions::printExtraOptionsValues (int fieldWidth)
   // chord notes
   // --------------------------------------
 
-  gIndenter--;
+  gIndenter ()--;
 }
 
 S_optionsItem extraOptions::handleOptionsItem (
@@ -601,7 +596,7 @@ S_optionsItem extraOptions::handleOptionsItem (
         dynamic_cast<optionsShowAllChordsStructuresItem*>(&(*item))
   ) {
 #ifdef TRACE_OPTIONS
-    if (gTraceOptions->fTraceOptions) {
+    if (gTraceOptions ()->fTraceOptions) {
       os <<
         "==> optionsItem is of type 'optionsShowAllChordsStructuresItem'" <<
         endl;
@@ -623,7 +618,7 @@ S_optionsItem extraOptions::handleOptionsItem (
         dynamic_cast<optionsShowAllChordsContentsItem*>(&(*item))
     ) {
 #ifdef TRACE_OPTIONS
-    if (gTraceOptions->fTraceOptions) {
+    if (gTraceOptions ()->fTraceOptions) {
       os <<
         "==> optionsItem is of type 'optionsShowAllChordsContentsItem'" <<
         endl;
@@ -641,7 +636,7 @@ S_optionsItem extraOptions::handleOptionsItem (
         dynamic_cast<optionsShowChordDetailsItem*>(&(*item))
     ) {
 #ifdef TRACE_OPTIONS
-    if (gTraceOptions->fTraceOptions) {
+    if (gTraceOptions ()->fTraceOptions) {
       os <<
         "==> optionsItem is of type 'optionsShowChordDetailsItem'" <<
         endl;
@@ -659,7 +654,7 @@ S_optionsItem extraOptions::handleOptionsItem (
         dynamic_cast<optionsShowChordAnalysisItem*>(&(*item))
     ) {
 #ifdef TRACE_OPTIONS
-    if (gTraceOptions->fTraceOptions) {
+    if (gTraceOptions ()->fTraceOptions) {
       os <<
         "==> optionsItem is of type 'optionsShowChordAnalysisItem'" <<
         endl;
@@ -688,7 +683,7 @@ void extraOptions::handleOptionsItemValue (
     // is it in the accidental styles map?
 
 #ifdef TRACE_OPTIONS
-    if (gTraceOptions->fTraceOptions) {
+    if (gTraceOptions ()->fTraceOptions) {
       os <<
         "==> optionsItem is of type 'optionsShowAllChordsContentsItem'" <<
         ", theString = \"" << theString << "\"" << 
@@ -713,7 +708,7 @@ void extraOptions::handleOptionsItemValue (
             "' is no diatonic (semitones) pitch" <<
             " in pitch language '" <<
             msrQuarterTonesPitchesLanguageKindAsString (
-              gLpsrOptions->
+              gLpsrOptions ()->
                 fLpsrQuarterTonesPitchesLanguageKind) <<
             "'" <<
             endl;
@@ -788,7 +783,7 @@ void extraOptions::handleOptionsItemValue (
     // is it in the accidental styles map?
 
 #ifdef TRACE_OPTIONS
-    if (gTraceOptions->fTraceOptions) {
+    if (gTraceOptions ()->fTraceOptions) {
       os <<
         "==> optionsItem is of type 'optionsShowChordDetailsItem'" <<
         ", theString = \"" << theString << "\"" << 
@@ -810,7 +805,7 @@ void extraOptions::handleOptionsItemValue (
     regex_match (theString, sm, e);
 
 #ifdef TRACE_OPTIONS
-    if (gTraceOptions->fTraceOptions) {
+    if (gTraceOptions ()->fTraceOptions) {
       os <<
         "There are " << sm.size () << " matches" <<
         " for chord details string '" << theString <<
@@ -822,7 +817,7 @@ void extraOptions::handleOptionsItemValue (
 
     if (sm.size ()) {
 #ifdef TRACE_OPTIONS
-      if (gTraceOptions->fTraceOptions) {
+      if (gTraceOptions ()->fTraceOptions) {
         os <<
           sm.size () << " elements: ";
         for (unsigned i = 0; i < sm.size (); ++i) {
@@ -857,7 +852,7 @@ void extraOptions::handleOptionsItemValue (
       harmonyName = sm [2];
       
 #ifdef TRACE_OPTIONS
-    if (gTraceOptions->fTraceOptions) {
+    if (gTraceOptions ()->fTraceOptions) {
       os <<
         "--> rootName = \"" << rootName << "\", " <<
         "--> harmonyName = \"" << harmonyName << "\"" <<
@@ -882,7 +877,7 @@ void extraOptions::handleOptionsItemValue (
             "' is no diatonic (semitones) root pitch" <<
             " in pitch language '" <<
             msrQuarterTonesPitchesLanguageKindAsString (
-              gLpsrOptions->
+              gLpsrOptions ()->
                 fLpsrQuarterTonesPitchesLanguageKind) <<
             "'" <<
             endl;
@@ -963,7 +958,7 @@ void extraOptions::handleOptionsItemValue (
     // is it in the accidental styles map?
 
 #ifdef TRACE_OPTIONS
-    if (gTraceOptions->fTraceOptions) {
+    if (gTraceOptions ()->fTraceOptions) {
       os <<
         "==> optionsItem is of type 'optionsShowChordAnalysisItem'" <<
         ", theString = \"" << theString << "\"" << 
@@ -987,7 +982,7 @@ void extraOptions::handleOptionsItemValue (
     regex_match (theString, sm, e);
 
 #ifdef TRACE_OPTIONS
-    if (gTraceOptions->fTraceOptions) {
+    if (gTraceOptions ()->fTraceOptions) {
       os <<
         "There are " << sm.size () << " matches" <<
         " for chord analysis string '" << theString <<
@@ -999,7 +994,7 @@ void extraOptions::handleOptionsItemValue (
 
     if (sm.size ()) {
 #ifdef TRACE_OPTIONS
-      if (gTraceOptions->fTraceOptions) {
+      if (gTraceOptions ()->fTraceOptions) {
         os <<
           sm.size () << " elements: ";
         for (unsigned i = 0; i < sm.size (); ++i) {
@@ -1044,7 +1039,7 @@ void extraOptions::handleOptionsItemValue (
     s >> inversion;
     
 #ifdef TRACE_OPTIONS
-    if (gTraceOptions->fTraceOptions) {
+    if (gTraceOptions ()->fTraceOptions) {
       os <<
         "--> rootName = \"" << rootName << "\", " <<
         "--> harmonyName = \"" << harmonyName << "\"" <<
@@ -1070,7 +1065,7 @@ void extraOptions::handleOptionsItemValue (
             "' is no diatonic (semitones) root pitch" <<
             " in pitch language '" <<
             msrQuarterTonesPitchesLanguageKindAsString (
-              gLpsrOptions->
+              gLpsrOptions ()->
                 fLpsrQuarterTonesPitchesLanguageKind) <<
             "'" <<
             endl;
@@ -1171,18 +1166,18 @@ void initializeExtraOptionsHandling (
   // create the extra options
   // ------------------------------------------------------
   
-  gExtraOptionsUserChoices = extraOptions::create (
+  gExtraOptionsUserChoices () = extraOptions::create (
     optionsHandler);
-  assert(gExtraOptionsUserChoices != 0);
+  assert(gExtraOptionsUserChoices () != 0);
 
-  gExtraOptions =
-    gExtraOptionsUserChoices;
+  gExtraOptions () =
+    gExtraOptionsUserChoices ();
 
   // prepare for measure detailed trace
   // ------------------------------------------------------
 
-  gExtraOptionsWithDetailedTrace =
-    gExtraOptions->
+  gExtraOptionsWithDetailedTrace () =
+    gExtraOptions ()->
       createCloneWithDetailedTrace ();
 }
 
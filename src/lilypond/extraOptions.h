@@ -368,9 +368,9 @@ class extraOptions : public optionsGroup
 typedef SMARTP<extraOptions> S_extraOptions;
 EXP ostream& operator<< (ostream& os, const S_extraOptions& elt);
 
-EXP extern S_extraOptions gExtraOptions;
-EXP extern S_extraOptions gExtraOptionsUserChoices;
-EXP extern S_extraOptions gExtraOptionsWithDetailedTrace;
+// gExtraOptions (), gExtraOptionsUserChoices () and
+// gExtraOptionsWithDetailedTrace () are those of the current conversion
+// context, see conversionContext.h
 
 //______________________________________________________________________________
 void initializeExtraOptionsHandling (
@@ -23,9 +23,6 @@ namespace MusicXML2
 {
 
 //_______________________________________________________________________________
-S_generalOptions gGeneralOptions;
-S_generalOptions gGeneralOptionsUserChoices;
-
 S_generalOptions generalOptions::create (
   S_optionsHandler optionsHandler)
 {
@@ -170,6 +167,8 @@ This is useful when debugging xml2ly.)",
     // variables  
   
     fDisplayCPUusage = boolOptionsInitialValue;
+
+    fProfilingJSONFileName = "";
       
     // options
   
@@ -191,6 +190,18 @@ R"()",
 R"(Write information about CPU usage to standard error.)",
           "displayCPUusage",
           fDisplayCPUusage));
+
+    CPUUsageSubGroup->
+      appendOptionsItem (
+        optionsStringItem::create (
+          "prof", "profile",
+R"(Write profiling information in JSON format to file FILENAME:
+CPU time, allocations and peak memory use for each pass,
+and visits count and time per element type in the visitors.
+This slows the conversion down somewhat.)",
+          "FILENAME",
+          "profilingJSONFileName",
+          fProfilingJSONFileName));
   }
 
 
@@ -200,6 +211,10 @@ R"(Write information about CPU usage to standard error.)",
   {
     // variables  
   
+    fExit2a = boolOptionsInitialValue;
+    fExit2b = boolOptionsInitialValue;
+    fExit3  = boolOptionsInitialValue;
+      
     // options
   
     S_optionsSubGroup
@@ -309,6 +324,8 @@ S_generalOptions generalOptions::createCloneWithTrueValues ()
   // --------------------------------------
 
   clone->fDisplayCPUusage = true;
+  clone->fProfilingJSONFileName =
+    fProfilingJSONFileName;
 
 
   return clone;
@@ -329,21 +346,21 @@ void generalOptions::checkOptionsConsistency ()
 //______________________________________________________________________________
 void generalOptions::printGeneralOptionsValues (int fieldWidth)
 {  
-  gLogIOstream <<
+  gLogIOstream () <<
     "The general options are:" <<
     endl;
 
-  gIndenter++;
+  gIndenter ()++;
 
 /*
   // command line
   // --------------------------------------
 
-  gLogIOstream << left <<
+  gLogIOstream () << left <<
 
-  gIndenter++;
+  gIndenter ()++;
 
-  gLogIOstream << left <<
+  gLogIOstream () << left <<
     setw (fieldWidth) << "input source name" << " : " <<
     fInputSourceName <<
     endl <<
@@ -352,18 +369,18 @@ void generalOptions::printGeneralOptionsValues (int fieldWidth)
     fTranslationDate <<
     endl;
 
-  gIndenter--;
+  gIndenter ()--;
 
   // output file
   // --------------------------------------
 
-  gLogIOstream << left <<
+  gLogIOstream () << left <<
     setw (fieldWidth) << "Output file:" <<
     endl;
 
-  gIndenter++;
+  gIndenter ()++;
 
-  gLogIOstream << left <<        
+  gLogIOstream () << left <<        
     setw (fieldWidth) << "inputSourceName" << " : \"" <<
     fInputSourceName <<
     "\"" <<
@@ -373,19 +390,19 @@ void generalOptions::printGeneralOptionsValues (int fieldWidth)
     "\"" <<
     endl;
 
-  gIndenter--;
+  gIndenter ()--;
 */
 
   // warning and error handling
   // --------------------------------------
   
-  gLogIOstream << left <<
+  gLogIOstream () << left <<
     setw (fieldWidth) << "Warning and error handling:" <<
     endl;
 
-  gIndenter++;
+  gIndenter ()++;
 
-  gLogIOstream <<
+  gLogIOstream () <<
     setw (fieldWidth) << "quiet" << " : " <<
     booleanAsString (fQuiet) <<
     endl <<
@@ -399,28 +416,32 @@ void generalOptions::printGeneralOptionsValues (int fieldWidth)
     booleanAsString (fDisplaySourceCodePosition) <<
     endl;
 
-  gIndenter--;
+  gIndenter ()--;
   
 
   // CPU usage
   // --------------------------------------
 
-  gLogIOstream << left <<
+  gLogIOstream () << left <<
     setw (fieldWidth) << "CPU usage:" <<
     endl;
 
-  gIndenter++;
+  gIndenter ()++;
 
-  gLogIOstream <<
+  gLogIOstream () <<
     setw (fieldWidth) << "displayCPUusage" << " : " <<
     booleanAsString (fDisplayCPUusage) <<
+    endl <<
+    setw (fieldWidth) << "profilingJSONFileName" << " : \"" <<
+    fProfilingJSONFileName <<
+    "\"" <<
     endl;
 
-  gIndenter--;
+  gIndenter ()--;
   
-  gIndenter--;
+  gIndenter ()--;
 
-  gIndenter--;
+  gIndenter ()--;
 }
 
 S_optionsItem generalOptions::handleOptionsItem (
@@ -445,14 +466,14 @@ void initializeGeneralOptionsHandling (
   // create the options variables
   // ------------------------------------------------------
   
-  gGeneralOptionsUserChoices = generalOptions::create (
+  gGeneralOptionsUserChoices () = generalOptions::create (
     optionsHandler);
-  assert(gGeneralOptionsUserChoices != 0);
+  assert(gGeneralOptionsUserChoices () != 0);
 
-  gGeneralOptions =
-    gGeneralOptionsUserChoices;
+  gGeneralOptions () =
+    gGeneralOptionsUserChoices ();
 
-  gGeneralOptions->
+  gGeneralOptions ()->
     checkOptionsConsistency ();
 }
 
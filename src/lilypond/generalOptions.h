@@ -100,6 +100,7 @@ class generalOptions : public optionsGroup
     // --------------------------------------
   
     bool                  fDisplayCPUusage;
+    std::string           fProfilingJSONFileName;
 
     // exit after some passes
     // --------------------------------------
@@ -111,9 +112,8 @@ class generalOptions : public optionsGroup
 typedef SMARTP<generalOptions> S_generalOptions;
 EXP ostream& operator<< (ostream& os, const S_generalOptions& elt);
 
-EXP extern S_generalOptions gGeneralOptions;
-EXP extern S_generalOptions gGeneralOptionsUserChoices;
-EXP extern S_generalOptions gGeneralOptionsWithDetailedTrace;
+// gGeneralOptions () and gGeneralOptionsUserChoices () are those of the
+// current conversion context, see conversionContext.h
 
 //______________________________________________________________________________
 void initializeGeneralOptionsHandling (
@@ -82,7 +82,7 @@ void optionsAccidentalStyleItem::print (ostream& os) const
     "OptionsAccidentalStyleItem:" <<
     endl;
 
-  gIndenter++;
+  gIndenter ()++;
 
   printValuedItemEssentials (
     os, fieldWidth);
@@ -172,7 +172,7 @@ void optionsMidiTempoItem::print (ostream& os) const
     "OptionsMidiTempoItem:" <<
     endl;
 
-  gIndenter++;
+  gIndenter ()++;
 
   printValuedItemEssentials (
     os, fieldWidth);
@@ -212,10 +212,6 @@ ostream& operator<< (ostream& os, const S_optionsMidiTempoItem& elt)
 }
 
 //_______________________________________________________________________________
-S_lilypondOptions gLilypondOptions;
-S_lilypondOptions gLilypondOptionsUserChoices;
-S_lilypondOptions gLilypondOptionsWithDetailedTrace;
-
 S_lilypondOptions lilypondOptions::create (
   S_optionsHandler optionsHandler)
 {
@@ -1118,7 +1114,7 @@ R"(Generate the '\midi' block as a comment instead of active code.)",
     set<string>::const_iterator i=fLilypondAccidentalStyles.begin ();
     i!=fLilypondAccidentalStyles.end ();
     i++) {
-      gLogIOstream << (*i) << endl;
+      gLogIOstream () << (*i) << endl;
   } // for
   */
 }
@@ -1379,22 +1375,22 @@ string lilypondOptions::scoreNotationKindAsString (
 
 void lilypondOptions::printLilypondOptionsValues (int fieldWidth)
 {
-  gLogIOstream <<
+  gLogIOstream () <<
     "The LilyPond options are:" <<
     endl;
 
-  gIndenter++;
+  gIndenter ()++;
   
   // identification
   // --------------------------------------
-  gLogIOstream <<
+  gLogIOstream () <<
     "Time:" <<
     endl;
 
-  gIndenter++;
+  gIndenter ()++;
 
   // MusicXML informations
-  gLogIOstream << left <<
+  gLogIOstream () << left <<
     setw (fieldWidth) << "rights" << " : " <<
       fRights <<
       endl <<
@@ -1453,34 +1449,34 @@ void lilypondOptions::printLilypondOptionsValues (int fieldWidth)
       fCopyright <<
       endl;
 
-  gIndenter--;
+  gIndenter ()--;
 
 
   // time
   // --------------------------------------
-  gLogIOstream <<
+  gLogIOstream () <<
     "Time:" <<
     endl;
 
-  gIndenter++;
+  gIndenter ()++;
 
-  gLogIOstream << left <<
+  gLogIOstream () << left <<
     setw (fieldWidth) << "numericalTime" << " : " <<
       booleanAsString (fNumericalTime) <<
       endl;
 
-  gIndenter--;
+  gIndenter ()--;
 
   
   // notes
   // --------------------------------------
-  gLogIOstream <<
+  gLogIOstream () <<
     "Notes:" <<
     endl;
 
-  gIndenter++;
+  gIndenter ()++;
 
-  gLogIOstream << left <<
+  gLogIOstream () << left <<
     setw (fieldWidth) << "absoluteOctaves" << " : " <<
       booleanAsString (fAbsoluteOctaves) <<
       endl <<
@@ -1517,34 +1513,34 @@ void lilypondOptions::printLilypondOptionsValues (int fieldWidth)
       booleanAsString (fNoteInputLineNumbers) <<
       endl;
 
-  gIndenter--;
+  gIndenter ()--;
 
   
   // bars
   // --------------------------------------
-  gLogIOstream <<
+  gLogIOstream () <<
     "Bars:" <<
     endl;
 
-  gIndenter++;
+  gIndenter ()++;
 
-  gLogIOstream << left <<
+  gLogIOstream () << left <<
     setw (fieldWidth) << "showAllBarNumbers" << " : " <<
     booleanAsString (fShowAllBarNumbers) <<
     endl;
 
-  gIndenter--;
+  gIndenter ()--;
 
 
   // line breaks
   // --------------------------------------
-  gLogIOstream <<
+  gLogIOstream () <<
     "Line breaks:" <<
     endl;
 
-  gIndenter++;
+  gIndenter ()++;
 
-  gLogIOstream << left <<
+  gLogIOstream () << left <<
     setw (fieldWidth) << "ignoreLineBreaks" << " : " <<
       booleanAsString (fIgnoreLineBreaks) <<
       endl <<
@@ -1557,85 +1553,85 @@ void lilypondOptions::printLilypondOptionsValues (int fieldWidth)
       booleanAsString (fSeparatorLineEveryNMeasures) <<
       endl;
 
-  gIndenter--;
+  gIndenter ()--;
 
   
   // page breaks
   // --------------------------------------
-  gLogIOstream <<
+  gLogIOstream () <<
     "Page breaks:" <<
     endl;
 
-  gIndenter++;
+  gIndenter ()++;
 
-  gLogIOstream << left <<
+  gLogIOstream () << left <<
     setw (fieldWidth) << "ignorePageBreaks" << " : " <<
     booleanAsString (fIgnorePageBreaks) <<
     endl;
 
-  gIndenter--;
+  gIndenter ()--;
 
   
   // staves
   // --------------------------------------
-  gLogIOstream <<
+  gLogIOstream () <<
     "Staves:" <<
     endl;
 
-  gIndenter++;
+  gIndenter ()++;
 
-  gLogIOstream << left <<
+  gLogIOstream () << left <<
     setw (fieldWidth) << "modernTab" << " : " <<
     booleanAsString (fModernTab) <<
     endl;
 
-  gIndenter--;
+  gIndenter ()--;
 
   
   // chords
   // --------------------------------------
 
-  gLogIOstream <<
+  gLogIOstream () <<
     "Chords:" <<
     endl;
 
-  gIndenter++;
+  gIndenter ()++;
 
-  gLogIOstream << left <<
+  gLogIOstream () << left <<
     setw (fieldWidth) << "connectArpeggios" << " : " <<
     booleanAsString (fConnectArpeggios) <<
     endl;
     
-  gIndenter--;
+  gIndenter ()--;
 
 
   // tuplets
   // --------------------------------------
 
-  gLogIOstream <<
+  gLogIOstream () <<
     "Tuplets:" <<
     endl;
 
-  gIndenter++;
+  gIndenter ()++;
 
-  gLogIOstream << left <<
+  gLogIOstream () << left <<
     setw (fieldWidth) << "indentTuplets" << " : " <<
     booleanAsString (fIndentTuplets) <<
     endl;
     
-  gIndenter--;
+  gIndenter ()--;
 
 
   // repeats
   // --------------------------------------
 
-  gLogIOstream <<
+  gLogIOstream () <<
     "Repeats:" <<
     endl;
 
-  gIndenter++;
+  gIndenter ()++;
 
-  gLogIOstream << left <<
+  gLogIOstream () << left <<
     setw (fieldWidth) << "ignoreRepeatNumbers" << " : " <<
     booleanAsString (fIgnoreRepeatNumbers) <<
     endl <<
@@ -1643,53 +1639,53 @@ void lilypondOptions::printLilypondOptionsValues (int fieldWidth)
     booleanAsString (fRepeatBrackets) <<
     endl;
     
-  gIndenter--;
+  gIndenter ()--;
 
 
   // ornaments
   // --------------------------------------
 
-  gLogIOstream <<
+  gLogIOstream () <<
     "Ornaments:" <<
     endl;
 
-  gIndenter++;
+  gIndenter ()++;
 
-  gLogIOstream << left <<
+  gLogIOstream () << left <<
     setw (fieldWidth) << "fDelayedOrnamentsFraction" << " : " <<
     fDelayedOrnamentsFraction <<
     endl;
 
-  gIndenter--;
+  gIndenter ()--;
 
 
   // fonts
   // --------------------------------------
 
-  gLogIOstream <<
+  gLogIOstream () <<
     "Fonts:" <<
     endl;
 
-  gIndenter++;
+  gIndenter ()++;
 
-  gLogIOstream << left <<
+  gLogIOstream () << left <<
     setw (fieldWidth) << "jazzFonts" << " : " <<
     booleanAsString (fJazzFonts) <<
     endl;
 
-  gIndenter--;
+  gIndenter ()--;
 
 
   // code generation
   // --------------------------------------
 
-  gLogIOstream <<
+  gLogIOstream () <<
     "LilyPond code generation:" <<
     endl;
 
-  gIndenter++;
+  gIndenter ()++;
 
-  gLogIOstream << left <<
+  gLogIOstream () << left <<
     setw (fieldWidth) << "comments" << " : " <<
       booleanAsString (fComments) <<
       endl <<
@@ -1722,37 +1718,37 @@ void lilypondOptions::printLilypondOptionsValues (int fieldWidth)
       booleanAsString (fWhiteNoteHeads) <<
       endl;
 
-  gIndenter--;
+  gIndenter ()--;
 
 
   // score notation
   // --------------------------------------
     
-  gLogIOstream <<
+  gLogIOstream () <<
     "Score notation:" <<
     endl;
 
-  gIndenter++;
+  gIndenter ()++;
 
 /*
-  gLogIOstream << left <<
+  gLogIOstream () << left <<
     setw (fieldWidth) << "scoreNotationKind" << " : " <<
       scoreNotationKindAsString (
         fScoreNotationKind) <<
       endl;
 */
-  gIndenter--;
+  gIndenter ()--;
 
   
   // midi
   // --------------------------------------
-  gLogIOstream <<
+  gLogIOstream () <<
     "Midi:" <<
     endl;
 
-  gIndenter++;
+  gIndenter ()++;
 
-  gLogIOstream << left <<
+  gLogIOstream () << left <<
     setw (fieldWidth) << "midiTempoDuration" << " : " <<
     //     fMidiTempoDuration <<
       endl <<
@@ -1765,10 +1761,10 @@ void lilypondOptions::printLilypondOptionsValues (int fieldWidth)
       booleanAsString (fNoMidi) <<
       endl;
 
-  gIndenter--;
+  gIndenter ()--;
   
 
-  gIndenter--;
+  gIndenter ()--;
 }
 
 S_optionsItem lilypondOptions::handleOptionsItem (
@@ -1784,7 +1780,7 @@ S_optionsItem lilypondOptions::handleOptionsItem (
         dynamic_cast<optionsAccidentalStyleItem*>(&(*item))
     ) {
 #ifdef TRACE_OPTIONS
-    if (gTraceOptions->fTraceOptions) {
+    if (gTraceOptions ()->fTraceOptions) {
       os <<
         "==> optionsItem is of type 'optionsAccidentalStyleItem'" <<
         endl;
@@ -1802,7 +1798,7 @@ S_optionsItem lilypondOptions::handleOptionsItem (
         dynamic_cast<optionsMidiTempoItem*>(&(*item))
     ) {
 #ifdef TRACE_OPTIONS
-    if (gTraceOptions->fTraceOptions) {
+    if (gTraceOptions ()->fTraceOptions) {
       os <<
         "==> optionsItem is of type 'optionsMidiTempoItem'" <<
         endl;
@@ -1831,7 +1827,7 @@ void lilypondOptions::handleOptionsItemValue (
     // is it in the accidental styles map?
     
 #ifdef TRACE_OPTIONS
-    if (gTraceOptions->fTraceOptions) {
+    if (gTraceOptions ()->fTraceOptions) {
       os <<
         "==> optionsItem is of type 'optionsAccidentalStyleItem'" <<
         endl;
@@ -1840,10 +1836,10 @@ void lilypondOptions::handleOptionsItemValue (
 
     map<string, lpsrAccidentalStyleKind>::const_iterator
       it =
-        gLpsrAccidentalStyleKindsMap.find (
+        lpsrAccidentalStyleKindsMap ().find (
           theString);
           
-    if (it == gLpsrAccidentalStyleKindsMap.end ()) {
+    if (it == lpsrAccidentalStyleKindsMap ().end ()) {
       // no, accidental style is unknown in the map
       stringstream s;
   
@@ -1852,16 +1848,16 @@ void lilypondOptions::handleOptionsItemValue (
         " is unknown" <<
         endl <<
         "The " <<
-        gLpsrAccidentalStyleKindsMap.size () - 1 <<
+        lpsrAccidentalStyleKindsMap ().size () - 1 <<
         " known LPSR accidental styles are:" <<
         endl;
   
-      gIndenter++;
+      gIndenter ()++;
     
       s <<
         existingLpsrAccidentalStyleKinds ();
   
-      gIndenter--;
+      gIndenter ()--;
   
       optionError (s.str ());
       
@@ -1885,7 +1881,7 @@ void lilypondOptions::handleOptionsItemValue (
     // decipher it to extract duration and perSecond values
 
 #ifdef TRACE_OPTIONS
-    if (gTraceOptions->fTraceOptions) {
+    if (gTraceOptions ()->fTraceOptions) {
       os <<
         "==> optionsItem is of type 'optionsMidiTempoItem'" <<
         endl;
@@ -1903,7 +1899,7 @@ void lilypondOptions::handleOptionsItemValue (
     regex_match (theString, sm, e);
 
 #ifdef TRACE_OPTIONS
-    if (gTraceOptions->fTraceOptions) {
+    if (gTraceOptions ()->fTraceOptions) {
       os <<
         "There are " << sm.size () << " matches" <<
         " for MIDI tempo string '" << theString <<
@@ -1949,7 +1945,7 @@ void lilypondOptions::handleOptionsItemValue (
     }
     
 #ifdef TRACE_OPTIONS
-    if (gTraceOptions->fTraceOptions) {
+    if (gTraceOptions ()->fTraceOptions) {
       os <<
         "midiTempoDuration  = " <<
         midiTempoDuration <<
@@ -1980,18 +1976,18 @@ void initializeLilypondOptionsHandling (
   // create the options variables
   // ------------------------------------------------------
   
-  gLilypondOptionsUserChoices = lilypondOptions::create (
+  gLilypondOptionsUserChoices () = lilypondOptions::create (
     optionsHandler);
-  assert(gLilypondOptionsUserChoices != 0);
+  assert(gLilypondOptionsUserChoices () != 0);
   
-  gLilypondOptions =
-    gLilypondOptionsUserChoices;
+  gLilypondOptions () =
+    gLilypondOptionsUserChoices ();
 
   // prepare for measure detailed trace
   // ------------------------------------------------------
 
-  gLilypondOptionsWithDetailedTrace =
-    gLilypondOptions->
+  gLilypondOptionsWithDetailedTrace () =
+    gLilypondOptions ()->
       createCloneWithDetailedTrace ();
 }
 
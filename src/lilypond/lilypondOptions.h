@@ -478,9 +478,9 @@ pickCopyright
 typedef SMARTP<lilypondOptions> S_lilypondOptions;
 EXP ostream& operator<< (ostream& os, const S_lilypondOptions& elt);
 
-EXP extern S_lilypondOptions gLilypondOptions;
-EXP extern S_lilypondOptions gLilypondOptionsUserChoices;
-EXP extern S_lilypondOptions gLilypondOptionsWithDetailedTrace;
+// gLilypondOptions (), gLilypondOptionsUserChoices () and
+// gLilypondOptionsWithDetailedTrace () are those of the current
+// conversion context, see conversionContext.h
 
 //______________________________________________________________________________
 void initializeLilypondOptionsHandling (
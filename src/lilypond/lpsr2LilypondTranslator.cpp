@@ -235,7 +235,7 @@ string lpsr2LilypondTranslator::absoluteOctaveAsLilypondString (
   string result;
 
 #ifdef TRACE_OPTIONS
-  if (gTraceOptions->fTraceNotes) {
+  if (gTraceOptions ()->fTraceNotes) {
     fLilypondCodeIOstream <<
       endl <<
       "%{ absoluteOctave = " << absoluteOctave << " %} " <<
@@ -390,7 +390,7 @@ string lpsr2LilypondTranslator::lilypondRelativeOctave (
       referenceDiatonicPitchKind - kC;
 
 #ifdef TRACE_OPTIONS
-  if (gTraceOptions->fTraceNotesDetails) {
+  if (gTraceOptions ()->fTraceNotesDetails) {
     const int fieldWidth = 28;
 
     fLilypondCodeIOstream << left <<
@@ -476,7 +476,7 @@ string lpsr2LilypondTranslator::stringTuningAsLilypondString (
         stringTuningAlterationKind);
 
 #ifdef TRACE_OPTIONS
-  if (gTraceOptions->fTraceScordaturas) {
+  if (gTraceOptions ()->fTraceScordaturas) {
     int
       getStringTuningNumber =
         stringTuning->
@@ -503,7 +503,7 @@ string lpsr2LilypondTranslator::stringTuningAsLilypondString (
       endl <<
       "%quarterTonesPitchKindAsString: " <<
       msrQuarterTonesPitchKindAsString (
-        gLpsrOptions->
+        gLpsrOptions ()->
           fLpsrQuarterTonesPitchesLanguageKind,
           quarterTonesPitchKind) <<
       endl <<
@@ -515,7 +515,7 @@ string lpsr2LilypondTranslator::stringTuningAsLilypondString (
 
   s <<
     msrQuarterTonesPitchKindAsString (
-      gLpsrOptions->
+      gLpsrOptions ()->
         fLpsrQuarterTonesPitchesLanguageKind,
         quarterTonesPitchKind) <<
     absoluteOctaveAsLilypondString (
@@ -550,7 +550,7 @@ string lpsr2LilypondTranslator::notePitchAsLilypondString (
   string
     quarterTonesPitchKindAsString =
       msrQuarterTonesPitchKindAsString (
-        gLpsrOptions->fLpsrQuarterTonesPitchesLanguageKind,
+        gLpsrOptions ()->fLpsrQuarterTonesPitchesLanguageKind,
         noteQuarterTonesPitchKind);
 
   // get the note quarter tones display pitch
@@ -563,7 +563,7 @@ string lpsr2LilypondTranslator::notePitchAsLilypondString (
   string
     quarterTonesDisplayPitchKindAsString =
       msrQuarterTonesPitchKindAsString (
-        gLpsrOptions->fLpsrQuarterTonesPitchesLanguageKind,
+        gLpsrOptions ()->fLpsrQuarterTonesPitchesLanguageKind,
         noteQuarterTonesDisplayPitchKind);
       
   // generate the pitch
@@ -576,12 +576,12 @@ string lpsr2LilypondTranslator::notePitchAsLilypondString (
     
   // should an absolute octave be generated?
   bool generateAbsoluteOctave =
-    gLilypondOptions->fAbsoluteOctaves
+    gLilypondOptions ()->fAbsoluteOctaves
       ||
     ! fRelativeOctaveReference;
 
 #ifdef TRACE_OPTIONS
-  if (gTraceOptions->fTraceNotesDetails) {
+  if (gTraceOptions ()->fTraceNotesDetails) {
     int noteAbsoluteDisplayOctave =
       note->getNoteDisplayOctave ();
   
@@ -669,7 +669,7 @@ string lpsr2LilypondTranslator::durationAsLilypondString (
   }
   else {
     generateExplicitDuration =
-      gLilypondOptions->fAllDurations;
+      gLilypondOptions ()->fAllDurations;
   }
   
   if (generateExplicitDuration) {
@@ -698,7 +698,7 @@ string lpsr2LilypondTranslator::pitchedRestAsLilypondString (
   string
     quarterTonesPitchKindAsString =
       msrQuarterTonesPitchKindAsString (
-        gLpsrOptions->fLpsrQuarterTonesPitchesLanguageKind,
+        gLpsrOptions ()->fLpsrQuarterTonesPitchesLanguageKind,
         noteQuarterTonesPitchKind);
 
   // get the note quarter tones display pitch
@@ -711,7 +711,7 @@ string lpsr2LilypondTranslator::pitchedRestAsLilypondString (
   string
     quarterTonesDisplayPitchKindAsString =
       msrQuarterTonesPitchKindAsString (
-        gLpsrOptions->fLpsrQuarterTonesPitchesLanguageKind,
+        gLpsrOptions ()->fLpsrQuarterTonesPitchesLanguageKind,
         noteQuarterTonesDisplayPitchKind);
       
   // generate the display pitch
@@ -721,13 +721,9 @@ string lpsr2LilypondTranslator::pitchedRestAsLilypondString (
 //    note->notePitchAsString (); JMI
 //    quarterTonesDisplayPitchAsString;
     
-  // in MusicXML, octave number is 4 for the octave starting with middle C
-  int noteAbsoluteOctave =
-    note->getNoteOctave ();
-    
   // should an absolute octave be generated?
   bool generateAbsoluteOctave =
-    gLilypondOptions->fAbsoluteOctaves
+    gLilypondOptions ()->fAbsoluteOctaves
       ||
     ! fRelativeOctaveReference;
 
@@ -735,7 +731,11 @@ string lpsr2LilypondTranslator::pitchedRestAsLilypondString (
     note->getNoteDisplayOctave ();
 
 #ifdef TRACE_OPTIONS
-  if (gTraceOptions->fTraceNotes) {
+  if (gTraceOptions ()->fTraceNotes) {
+    // in MusicXML, octave number is 4 for the octave starting with middle C
+    int noteAbsoluteOctave =
+      note->getNoteOctave ();
+    
     const int fieldWidth = 28;
 
     fLilypondCodeIOstream << left <<
@@ -852,7 +852,7 @@ void lpsr2LilypondTranslator::generateNote (
             } // switch
 
 #ifdef TRACE_OPTIONS
-            if (gTraceOptions->fTraceLigatures) {
+            if (gTraceOptions ()->fTraceLigatures) {
               fLogOutputStream <<
                 "Ligature vertical flipping factore for note '" <<
                 note->asString () <<
@@ -1071,7 +1071,7 @@ void lpsr2LilypondTranslator::generateNote (
             }
     
             // should stem direction be generated?
-            if (gLilypondOptions->fStems) {
+            if (gLilypondOptions ()->fStems) {
               if (noteStemKind != fCurrentStemKind) {
                 switch (noteStemKind) {
                   case msrStem::kStemNone:
@@ -1129,7 +1129,7 @@ void lpsr2LilypondTranslator::generateNote (
             }
     
             // should stem direction be generated?
-            if (gLilypondOptions->fStems) {
+            if (gLilypondOptions ()->fStems) {
               if (noteStemKind != fCurrentStemKind) {
                 switch (noteStemKind) {
                   case msrStem::kStemNone:
@@ -1163,7 +1163,7 @@ void lpsr2LilypondTranslator::generateNote (
         }
 
         // should stem direction be generated?
-        if (gLilypondOptions->fStems) {
+        if (gLilypondOptions ()->fStems) {
           if (noteStemKind != fCurrentStemKind) {
             switch (noteStemKind) {
               case msrStem::kStemNone:
@@ -1356,7 +1356,7 @@ void lpsr2LilypondTranslator::generateNote (
               if (noteSoundingWholeNotes != rational (1, 1)) {
                 / * JMI
                 // force the generation of the duration if needed
-                if (! gLilypondOptions->fAllDurations) {
+                if (! gLilypondOptions ()->fAllDurations) {
                   fLilypondCodeIOstream << // JMI
                     wholeNotesAsLilypondString (
                       inputLineNumber,
@@ -1416,13 +1416,13 @@ void lpsr2LilypondTranslator::generateNote (
         if (note->getNoteDelayedTurnOrnament ()) {
           // c2*2/3 ( s2*1/3\turn) JMI
           // we need the explicit duration in all cases,
-          // regardless of gGeneralOptions->fAllDurations
+          // regardless of gGeneralOptions ()->fAllDurations
           fLilypondCodeIOstream <<
             wholeNotesAsLilypondString (
               inputLineNumber,
               noteSoundingWholeNotes) <<
             "*" <<
-            gLilypondOptions->fDelayedOrnamentsFraction;
+            gLilypondOptions ()->fDelayedOrnamentsFraction;
         }
         
         // print the tie if any
@@ -1459,7 +1459,7 @@ void lpsr2LilypondTranslator::generateNote (
         if (note->getNoteDelayedTurnOrnament ()) {
           // c2*2/3 ( s2*1/3\turn) JMI
           // we need the explicit duration in all cases,
-          // regardless of gGeneralOptions->fAllDurations
+          // regardless of gGeneralOptions ()->fAllDurations
           fLilypondCodeIOstream <<
           /* JMI TOO MUCH
             wholeNotesAsLilypondString (
@@ -1467,7 +1467,7 @@ void lpsr2LilypondTranslator::generateNote (
               noteSoundingWholeNotes) <<
               */
             "*" <<
-            gLilypondOptions->fDelayedOrnamentsFraction;
+            gLilypondOptions ()->fDelayedOrnamentsFraction;
         }
         
         // print the tie if any
@@ -1502,7 +1502,7 @@ void lpsr2LilypondTranslator::generateNote (
         // c2*2/3 ( s2*1/3\turn JMI
         fLilypondCodeIOstream <<
           "*" <<
-          gLilypondOptions->fDelayedOrnamentsFraction;
+          gLilypondOptions ()->fDelayedOrnamentsFraction;
       }
       
       // print the tie if any
@@ -1628,7 +1628,7 @@ void lpsr2LilypondTranslator::generateNote (
       break;
       
     case msrNote::kTupletMemberNote:
-      if (gLilypondOptions->fIndentTuplets) {
+      if (gLilypondOptions ()->fIndentTuplets) {
         fLilypondCodeIOstream <<
           endl;
       }
@@ -1672,7 +1672,7 @@ void lpsr2LilypondTranslator::generateNote (
       break;
       
     case msrNote::kGraceTupletMemberNote:
-      if (gLilypondOptions->fIndentTuplets) {
+      if (gLilypondOptions ()->fIndentTuplets) {
         fLilypondCodeIOstream <<
           endl;
       }
@@ -1714,7 +1714,7 @@ void lpsr2LilypondTranslator::generateNote (
       break;
       
     case msrNote::kTupletMemberUnpitchedNote:
-      if (gLilypondOptions->fIndentTuplets) {
+      if (gLilypondOptions ()->fIndentTuplets) {
         fLilypondCodeIOstream <<
           endl;
       }
@@ -1943,7 +1943,7 @@ void lpsr2LilypondTranslator::generateNoteArticulation (
           ", line " << articulation->getInputLineNumber ();
           
         msrInternalError (
-          gXml2lyOptions->fInputSourceName,
+          gXml2lyOptions ()->fInputSourceName,
           articulation->getInputLineNumber (),
           __FILE__, __LINE__,
           s.str ());
@@ -2085,7 +2085,7 @@ void lpsr2LilypondTranslator::generateChordArticulation (
           ", line " << articulation->getInputLineNumber ();
           
         msrInternalError (
-          gXml2lyOptions->fInputSourceName,
+          gXml2lyOptions ()->fInputSourceName,
           articulation->getInputLineNumber (),
           __FILE__, __LINE__,
           s.str ());
@@ -2306,7 +2306,7 @@ void lpsr2LilypondTranslator::generateOrnament (
           remainingFraction =
             rational (1, 1)
               -
-            gLilypondOptions->fDelayedOrnamentsFraction;
+            gLilypondOptions ()->fDelayedOrnamentsFraction;
             
         int
           numerator =
@@ -2675,7 +2675,7 @@ void lpsr2LilypondTranslator::transposeDiatonicError (
     "'";
     
   msrMusicXMLError (
-    gXml2lyOptions->fInputSourceName,
+    gXml2lyOptions ()->fInputSourceName,
     inputLineNumber,
     __FILE__, __LINE__,
     s.str ());
@@ -2721,7 +2721,7 @@ string lpsr2LilypondTranslator::singleTremoloDurationAsLilypondString (
   }
   
 #ifdef TRACE_OPTIONS
-  if (gTraceOptions->fTraceTremolos) {
+  if (gTraceOptions ()->fTraceTremolos) {
     fLogOutputStream <<
       "singleTremoloDurationAsLilypondString()" <<
       ", line " << singleTremolo->getInputLineNumber () <<
@@ -2818,7 +2818,7 @@ string lpsr2LilypondTranslator::harmonyAsLilypondString (
   // print harmony pitch and duration
   s <<
     msrQuarterTonesPitchKindAsString (
-      gMsrOptions->
+      gMsrOptions ()->
         fMsrQuarterTonesPitchesLanguageKind,
       harmony->
         getHarmonyRootQuarterTonesPitchKind ()) <<
@@ -3001,7 +3001,7 @@ in all of them, the C and A# in theory want to fan out to B (the dominant).  Thi
     s <<
       "/" <<
       msrQuarterTonesPitchKindAsString (
-        gMsrOptions->
+        gMsrOptions ()->
           fMsrQuarterTonesPitchesLanguageKind,
         harmonyBassQuarterTonesPitchKind);
   }
@@ -3331,7 +3331,7 @@ string lpsr2LilypondTranslator::generateMultilineName (string theString)
 //________________________________________________________________________
 void lpsr2LilypondTranslator::visitStart (S_lpsrScore& elt)
 {
-  if (gLpsrOptions->fTraceLpsrVisitors) {
+  if (gLpsrOptions ()->fTraceLpsrVisitors) {
     fLilypondCodeIOstream <<
       "% --> Start visiting lpsrScore" <<
       ", line " << elt->getInputLineNumber () <<
@@ -3345,7 +3345,7 @@ void lpsr2LilypondTranslator::visitStart (S_lpsrScore& elt)
 
 void lpsr2LilypondTranslator::visitEnd (S_lpsrScore& elt)
 {
-  if (gLpsrOptions->fTraceLpsrVisitors) {
+  if (gLpsrOptions ()->fTraceLpsrVisitors) {
     fLilypondCodeIOstream <<
       "% --> End visiting lpsrScore" <<
       ", line " << elt->getInputLineNumber () <<
@@ -3545,13 +3545,13 @@ void lpsr2LilypondTranslator::generateLpsrVarValsListAssocValues (
         "\\markup {" <<
         endl;
 
-      gIndenter++;
+      gIndenter ()++;
       
       fLilypondCodeIOstream <<
         "\\column {" <<
         endl;
        
-      gIndenter++;
+      gIndenter ()++;
 
       list<string>::const_iterator
         iBegin = variableValuesList.begin (),
@@ -3568,13 +3568,13 @@ void lpsr2LilypondTranslator::generateLpsrVarValsListAssocValues (
       fLilypondCodeIOstream <<
         endl;
         
-      gIndenter--;
+      gIndenter ()--;
 
       fLilypondCodeIOstream <<
         "}" <<
         endl <<
 
-      gIndenter--;
+      gIndenter ()--;
 
       fLilypondCodeIOstream <<
         "}" <<
@@ -3585,7 +3585,7 @@ void lpsr2LilypondTranslator::generateLpsrVarValsListAssocValues (
 //________________________________________________________________________
 void lpsr2LilypondTranslator::visitStart (S_lpsrVarValAssoc& elt)
 {
-  if (gLpsrOptions->fTraceLpsrVisitors) {
+  if (gLpsrOptions ()->fTraceLpsrVisitors) {
     fLilypondCodeIOstream <<
       "% --> Start visiting lpsrVarValAssoc" <<
       ", line " << elt->getInputLineNumber () <<
@@ -3687,7 +3687,7 @@ void lpsr2LilypondTranslator::visitStart (S_lpsrVarValAssoc& elt)
 
 void lpsr2LilypondTranslator::visitEnd (S_lpsrVarValAssoc& elt)
 {
-  if (gLpsrOptions->fTraceLpsrVisitors) {
+  if (gLpsrOptions ()->fTraceLpsrVisitors) {
     fLilypondCodeIOstream <<
       "% --> End visiting lpsrVarValAssoc" <<
       ", line " << elt->getInputLineNumber () <<
@@ -3698,7 +3698,7 @@ void lpsr2LilypondTranslator::visitEnd (S_lpsrVarValAssoc& elt)
 //________________________________________________________________________
 void lpsr2LilypondTranslator::visitStart (S_lpsrVarValsListAssoc& elt)
 {
-  if (gLpsrOptions->fTraceLpsrVisitors) {
+  if (gLpsrOptions ()->fTraceLpsrVisitors) {
     fLilypondCodeIOstream <<
       "% --> Start visiting lpsrVarValsListAssoc" <<
       ", line " << elt->getInputLineNumber () <<
@@ -3735,7 +3735,7 @@ void lpsr2LilypondTranslator::visitStart (S_lpsrVarValsListAssoc& elt)
 
 void lpsr2LilypondTranslator::visitEnd (S_lpsrVarValsListAssoc& elt)
 {
-  if (gLpsrOptions->fTraceLpsrVisitors) {
+  if (gLpsrOptions ()->fTraceLpsrVisitors) {
     fLilypondCodeIOstream <<
       "% --> End visiting lpsrVarValsListAssoc" <<
       ", line " << elt->getInputLineNumber () <<
@@ -3746,7 +3746,7 @@ void lpsr2LilypondTranslator::visitEnd (S_lpsrVarValsListAssoc& elt)
 //________________________________________________________________________
 void lpsr2LilypondTranslator::visitStart (S_lpsrSchemeVariable& elt)
 {
-  if (gLpsrOptions->fTraceLpsrVisitors) {
+  if (gLpsrOptions ()->fTraceLpsrVisitors) {
     fLilypondCodeIOstream <<
       "% --> Start visiting lpsrSchemeVariable" <<
       ", line " << elt->getInputLineNumber () <<
@@ -3784,7 +3784,7 @@ void lpsr2LilypondTranslator::visitStart (S_lpsrSchemeVariable& elt)
 
 void lpsr2LilypondTranslator::visitEnd (S_lpsrSchemeVariable& elt)
 {
-  if (gLpsrOptions->fTraceLpsrVisitors) {
+  if (gLpsrOptions ()->fTraceLpsrVisitors) {
     fLilypondCodeIOstream <<
       "% --> End visiting lpsrSchemeVariable" <<
       ", line " << elt->getInputLineNumber () <<
@@ -3795,7 +3795,7 @@ void lpsr2LilypondTranslator::visitEnd (S_lpsrSchemeVariable& elt)
 //________________________________________________________________________
 void lpsr2LilypondTranslator::visitStart (S_lpsrHeader& elt)
 {
-  if (gLpsrOptions->fTraceLpsrVisitors) {
+  if (gLpsrOptions ()->fTraceLpsrVisitors) {
     fLilypondCodeIOstream <<
       "% --> Start visiting lpsrHeader" <<
       ", line " << elt->getInputLineNumber () <<
@@ -3806,7 +3806,7 @@ void lpsr2LilypondTranslator::visitStart (S_lpsrHeader& elt)
     "\\header" << " {" <<
     endl;
 
-  gIndenter++;
+  gIndenter ()++;
 
   // generate header elements
 
@@ -3956,9 +3956,9 @@ void lpsr2LilypondTranslator::visitEnd (S_lpsrHeader& elt)
 {
   fOnGoingHeader = false;
 
-  gIndenter--;
+  gIndenter ()--;
 
-  if (gLpsrOptions->fTraceLpsrVisitors) {
+  if (gLpsrOptions ()->fTraceLpsrVisitors) {
     fLilypondCodeIOstream <<
       "% --> End visiting lpsrHeader" <<
       ", line " << elt->getInputLineNumber () <<
@@ -3973,7 +3973,7 @@ void lpsr2LilypondTranslator::visitEnd (S_lpsrHeader& elt)
 //________________________________________________________________________
 void lpsr2LilypondTranslator::visitStart (S_lpsrPaper& elt)
 {
-  if (gLpsrOptions->fTraceLpsrVisitors) {
+  if (gLpsrOptions ()->fTraceLpsrVisitors) {
     fLilypondCodeIOstream <<
       "% --> Start visiting lpsrPaper" <<
       ", line " << elt->getInputLineNumber () <<
@@ -3984,7 +3984,7 @@ void lpsr2LilypondTranslator::visitStart (S_lpsrPaper& elt)
     "\\paper" << " {" <<
     endl;
 
-  gIndenter++;
+  gIndenter ()++;
   
   const int fieldWidth = 20;
 
@@ -4208,7 +4208,7 @@ void lpsr2LilypondTranslator::visitStart (S_lpsrPaper& elt)
     endl;
 
   // fonts
-  if (gLilypondOptions->fJazzFonts) {
+  if (gLilypondOptions ()->fJazzFonts) {
     fLilypondCodeIOstream <<
 R"(
   #(define fonts
@@ -4225,9 +4225,9 @@ R"(
 
 void lpsr2LilypondTranslator::visitEnd (S_lpsrPaper& elt)
 {
-  gIndenter--;
+  gIndenter ()--;
 
-  if (gLpsrOptions->fTraceLpsrVisitors) {
+  if (gLpsrOptions ()->fTraceLpsrVisitors) {
     fLilypondCodeIOstream <<
       "% --> End visiting lpsrPaper" <<
       ", line " << elt->getInputLineNumber () <<
@@ -4242,7 +4242,7 @@ void lpsr2LilypondTranslator::visitEnd (S_lpsrPaper& elt)
 //________________________________________________________________________
 void lpsr2LilypondTranslator::visitStart (S_lpsrLayout& elt)
 {
-  if (gLpsrOptions->fTraceLpsrVisitors) {
+  if (gLpsrOptions ()->fTraceLpsrVisitors) {
     fLilypondCodeIOstream <<
       "% --> Start visiting lpsrLayout" <<
       ", line " << elt->getInputLineNumber () <<
@@ -4253,22 +4253,22 @@ void lpsr2LilypondTranslator::visitStart (S_lpsrLayout& elt)
     "\\layout {" <<
     endl;
 
-  gIndenter++;
+  gIndenter ()++;
 
   fLilypondCodeIOstream <<
     "\\context {" <<
     endl <<
-    gTab << "\\Score" <<
+    gTab () << "\\Score" <<
     endl;
 
-  if (gLilypondOptions->fCompressMultiMeasureRests) { // JMI
+  if (gLilypondOptions ()->fCompressMultiMeasureRests) { // JMI
     fLilypondCodeIOstream <<
-      gTab << "skipBars = ##t % to compress multiple measure rests" <<
+      gTab () << "skipBars = ##t % to compress multiple measure rests" <<
       endl;
   }
 
   fLilypondCodeIOstream <<
-    gTab << "autoBeaming = ##f % to display tuplets brackets" <<
+    gTab () << "autoBeaming = ##f % to display tuplets brackets" <<
     endl <<
 
     "}" <<
@@ -4277,19 +4277,19 @@ void lpsr2LilypondTranslator::visitStart (S_lpsrLayout& elt)
 
 void lpsr2LilypondTranslator::visitEnd (S_lpsrLayout& elt)
 {
-  if (gLpsrOptions->fTraceLpsrVisitors) {
+  if (gLpsrOptions ()->fTraceLpsrVisitors) {
     fLilypondCodeIOstream <<
       "% --> End visiting lpsrLayout" <<
       ", line " << elt->getInputLineNumber () <<
       endl;
   }
 
-  if (gLilypondOptions->fRepeatBrackets) {
+  if (gLilypondOptions ()->fRepeatBrackets) {
     fLilypondCodeIOstream <<
       "\\context " "{" <<
       endl;
     
-    gIndenter++;
+    gIndenter ()++;
 
     fLilypondCodeIOstream <<
       "\\Score" <<
@@ -4303,7 +4303,7 @@ void lpsr2LilypondTranslator::visitEnd (S_lpsrLayout& elt)
       "doubleRepeatType = #\":|][|:\"" <<
       endl;
 
-    gIndenter--;
+    gIndenter ()--;
         
     fLilypondCodeIOstream <<
       "}" <<
@@ -4315,7 +4315,7 @@ void lpsr2LilypondTranslator::visitEnd (S_lpsrLayout& elt)
       "\\context {" <<
       endl;
   
-    gIndenter++;
+    gIndenter ()++;
   
     fLilypondCodeIOstream <<
       "\\Staff" <<
@@ -4323,14 +4323,14 @@ void lpsr2LilypondTranslator::visitEnd (S_lpsrLayout& elt)
       "\\consists \"Span_arpeggio_engraver\"" <<
       endl;
 
-    gIndenter--;
+    gIndenter ()--;
 
     fLilypondCodeIOstream <<
       "}" <<
       endl;
   }
     
-  gIndenter--;
+  gIndenter ()--;
 
   fLilypondCodeIOstream <<
     "}" <<
@@ -4341,7 +4341,7 @@ void lpsr2LilypondTranslator::visitEnd (S_lpsrLayout& elt)
 //________________________________________________________________________
 void lpsr2LilypondTranslator::visitStart (S_lpsrScoreBlock& elt)
 {
-  if (gLpsrOptions->fTraceLpsrVisitors) {
+  if (gLpsrOptions ()->fTraceLpsrVisitors) {
     fLilypondCodeIOstream <<
       "% --> Start visiting lpsrScoreBlock" <<
       ", line " << elt->getInputLineNumber () <<
@@ -4352,14 +4352,14 @@ void lpsr2LilypondTranslator::visitStart (S_lpsrScoreBlock& elt)
     "\\score {" <<
     endl;
 
-  gIndenter++;
+  gIndenter ()++;
 /* JMI
   if (elt->getScoreBlockElements ().size ()) {
     fLilypondCodeIOstream <<
       "<<" <<
       endl;
   
-    gIndenter++;
+    gIndenter ()++;
   }
 */
   fOnGoingScoreBlock = true;
@@ -4367,7 +4367,7 @@ void lpsr2LilypondTranslator::visitStart (S_lpsrScoreBlock& elt)
 
 void lpsr2LilypondTranslator::visitEnd (S_lpsrScoreBlock& elt)
 {
-  if (gLpsrOptions->fTraceLpsrVisitors) {
+  if (gLpsrOptions ()->fTraceLpsrVisitors) {
     fLilypondCodeIOstream <<
       "% --> End visiting lpsrScoreBlock" <<
       ", line " << elt->getInputLineNumber () <<
@@ -4376,7 +4376,7 @@ void lpsr2LilypondTranslator::visitEnd (S_lpsrScoreBlock& elt)
 
 /* JMI
   if (elt->getScoreBlockElements ().size ()) {
-    gIndenter--;
+    gIndenter ()--;
     
     fLilypondCodeIOstream <<
       ">>" <<
@@ -4384,7 +4384,7 @@ void lpsr2LilypondTranslator::visitEnd (S_lpsrScoreBlock& elt)
       * endl;
   }
 */
-  gIndenter--;
+  gIndenter ()--;
   
   fLilypondCodeIOstream <<
     "}" <<
@@ -4396,7 +4396,7 @@ void lpsr2LilypondTranslator::visitEnd (S_lpsrScoreBlock& elt)
 //________________________________________________________________________
 void lpsr2LilypondTranslator::visitStart (S_lpsrParallelMusicBLock& elt)
 {
-  if (gLpsrOptions->fTraceLpsrVisitors) {
+  if (gLpsrOptions ()->fTraceLpsrVisitors) {
     fLilypondCodeIOstream <<
       "% --> Start visiting lpsrParallelMusicBLock" <<
       ", line " << elt->getInputLineNumber () <<
@@ -4408,7 +4408,7 @@ void lpsr2LilypondTranslator::visitStart (S_lpsrParallelMusicBLock& elt)
       getParallelMusicBLockPartGroupBlocks ().size ();
     
   if (fNumberOfPartGroupBlocks) {
-    if (gLilypondOptions->fComments) {
+    if (gLilypondOptions ()->fComments) {
       fLilypondCodeIOstream << left <<
         setw (commentFieldWidth) <<
         "<<" <<
@@ -4423,7 +4423,7 @@ void lpsr2LilypondTranslator::visitStart (S_lpsrParallelMusicBLock& elt)
     fLilypondCodeIOstream <<
       endl;
   
-    gIndenter++;
+    gIndenter ()++;
   }
 
   fCurrentParallelMusicBLock = elt;
@@ -4431,7 +4431,7 @@ void lpsr2LilypondTranslator::visitStart (S_lpsrParallelMusicBLock& elt)
 
 void lpsr2LilypondTranslator::visitEnd (S_lpsrParallelMusicBLock& elt)
 {
-  if (gLpsrOptions->fTraceLpsrVisitors) {
+  if (gLpsrOptions ()->fTraceLpsrVisitors) {
     fLilypondCodeIOstream <<
       "% --> End visiting lpsrParallelMusicBLock" <<
       ", line " << elt->getInputLineNumber () <<
@@ -4442,9 +4442,9 @@ void lpsr2LilypondTranslator::visitEnd (S_lpsrParallelMusicBLock& elt)
     endl;
 
   if (fNumberOfPartGroupBlocks) {
-    gIndenter--;
+    gIndenter ()--;
     
-    if (gLilypondOptions->fComments) {
+    if (gLilypondOptions ()->fComments) {
       fLilypondCodeIOstream << left <<
         setw (commentFieldWidth) <<
         ">>" <<
@@ -4470,7 +4470,7 @@ void lpsr2LilypondTranslator::visitStart (S_lpsrPartGroupBlock& elt)
     partGroup =
       elt->getPartGroup ();
 
-  if (gLpsrOptions->fTraceLpsrVisitors) {
+  if (gLpsrOptions ()->fTraceLpsrVisitors) {
     fLilypondCodeIOstream <<
       "% --> Start visiting lpsrPartGroupBlock for '" <<
       partGroup->asShortString () <<
@@ -4522,7 +4522,7 @@ void lpsr2LilypondTranslator::visitStart (S_lpsrPartGroupBlock& elt)
       break;
       
     case msrPartGroup::kPartGroupImplicitNo:
-      if (gLilypondOptions->fComments) {
+      if (gLilypondOptions ()->fComments) {
         fLilypondCodeIOstream << left <<
           setw (commentFieldWidth);
       }
@@ -4585,7 +4585,7 @@ void lpsr2LilypondTranslator::visitStart (S_lpsrPartGroupBlock& elt)
           break;
       } // switch
 
-      gIndenter++;
+      gIndenter ()++;
 
       if (partGroupName.size ()) {
         fLilypondCodeIOstream <<
@@ -4638,7 +4638,7 @@ void lpsr2LilypondTranslator::visitStart (S_lpsrPartGroupBlock& elt)
           break;
       } // switch
 
-      gIndenter--;
+      gIndenter ()--;
 
       // generate the '\with' block ending      
       // if the part group is not implicit
@@ -4655,7 +4655,7 @@ void lpsr2LilypondTranslator::visitStart (S_lpsrPartGroupBlock& elt)
           break;
       } // switch
 
-      if (gLilypondOptions->fComments) {
+      if (gLilypondOptions ()->fComments) {
         fLilypondCodeIOstream << left <<
           setw (commentFieldWidth) <<
           " <<" << "% part group " <<
@@ -4679,7 +4679,7 @@ void lpsr2LilypondTranslator::visitStart (S_lpsrPartGroupBlock& elt)
       endl;
   }
   
-  if (gLilypondOptions->fConnectArpeggios) {
+  if (gLilypondOptions ()->fConnectArpeggios) {
     fLilypondCodeIOstream <<
       "\\set PianoStaff.connectArpeggios = ##t" <<
       endl;
@@ -4689,13 +4689,13 @@ void lpsr2LilypondTranslator::visitStart (S_lpsrPartGroupBlock& elt)
     endl;
 
   if (elt->getPartGroupBlockElements ().size () > 1) {
-    gIndenter++;
+    gIndenter ()++;
   }
 }
 
 void lpsr2LilypondTranslator::visitEnd (S_lpsrPartGroupBlock& elt)
 {
-  if (gLpsrOptions->fTraceLpsrVisitors) {
+  if (gLpsrOptions ()->fTraceLpsrVisitors) {
     fLilypondCodeIOstream <<
       "% --> End visiting lpsrPartGroupBlock" <<
       ", line " << elt->getInputLineNumber () <<
@@ -4708,7 +4708,7 @@ void lpsr2LilypondTranslator::visitEnd (S_lpsrPartGroupBlock& elt)
       elt->getPartGroup ();
       
   if (elt->getPartGroupBlockElements ().size () > 1) {
-    gIndenter--;
+    gIndenter ()--;
   }
 
   switch (partGroup->getPartGroupImplicitKind ()) {
@@ -4717,7 +4717,7 @@ void lpsr2LilypondTranslator::visitEnd (S_lpsrPartGroupBlock& elt)
       break;
       
     case msrPartGroup::kPartGroupImplicitNo:
-      if (gLilypondOptions->fComments) {
+      if (gLilypondOptions ()->fComments) {
         fLilypondCodeIOstream << left <<
           setw (commentFieldWidth) << ">>" <<      
           "% part group " <<
@@ -4747,7 +4747,7 @@ void lpsr2LilypondTranslator::visitStart (S_lpsrPartBlock& elt)
     part =
       elt->getPart ();
       
-  if (gLpsrOptions->fTraceLpsrVisitors) {
+  if (gLpsrOptions ()->fTraceLpsrVisitors) {
     fLilypondCodeIOstream <<
       "% --> Start visiting lpsrPartBlock for '" <<
       part->asShortString () <<
@@ -4775,7 +4775,7 @@ void lpsr2LilypondTranslator::visitStart (S_lpsrPartBlock& elt)
         part->getPartInstrumentAbbreviation ();
         */
   
-    if (gLilypondOptions->fComments) {
+    if (gLilypondOptions ()->fComments) {
       fLilypondCodeIOstream << left <<
         setw (commentFieldWidth) <<
         "\\new PianoStaff" <<
@@ -4793,7 +4793,7 @@ void lpsr2LilypondTranslator::visitStart (S_lpsrPartBlock& elt)
       "\\with {" <<  
       endl;
 
-    gIndenter++;
+    gIndenter ()++;
 
     if (partName.size ()) {
       fLilypondCodeIOstream <<
@@ -4810,13 +4810,13 @@ void lpsr2LilypondTranslator::visitStart (S_lpsrPartBlock& elt)
         endl;
     }
     
-    if (gLilypondOptions->fConnectArpeggios) {
+    if (gLilypondOptions ()->fConnectArpeggios) {
       fLilypondCodeIOstream <<
         "connectArpeggios = ##t" <<
         endl;
     }
        
-    gIndenter--;
+    gIndenter ()--;
   
     // generate the 'with' block ending
     fLilypondCodeIOstream <<
@@ -4836,7 +4836,7 @@ void lpsr2LilypondTranslator::visitEnd (S_lpsrPartBlock& elt)
     part =
       elt->getPart ();
       
-  if (gLpsrOptions->fTraceLpsrVisitors) {
+  if (gLpsrOptions ()->fTraceLpsrVisitors) {
     fLilypondCodeIOstream <<
       "% --> End visiting lpsrPartBlock" <<
       ", line " << elt->getInputLineNumber () <<
@@ -4846,9 +4846,9 @@ void lpsr2LilypondTranslator::visitEnd (S_lpsrPartBlock& elt)
   if (part->getPartStavesMap ().size () > 1) {
     // don't generate code for a part with only one stave
 
- // JMI ???   gIndenter--;
+ // JMI ???   gIndenter ()--;
   
-    if (gLilypondOptions->fComments) {
+    if (gLilypondOptions ()->fComments) {
       fLilypondCodeIOstream << left <<
         setw (commentFieldWidth) << ">>" <<    
         "% part " <<
@@ -4872,7 +4872,7 @@ void lpsr2LilypondTranslator::visitEnd (S_lpsrPartBlock& elt)
 //________________________________________________________________________
 void lpsr2LilypondTranslator::visitStart (S_lpsrStaffBlock& elt)
 {
-  if (gLpsrOptions->fTraceLpsrVisitors) {
+  if (gLpsrOptions ()->fTraceLpsrVisitors) {
     fLilypondCodeIOstream <<
       "% --> Start visiting lpsrStaffBlock" <<
       ", line " << elt->getInputLineNumber () <<
@@ -4888,7 +4888,7 @@ void lpsr2LilypondTranslator::visitStart (S_lpsrStaffBlock& elt)
   // generate the staff context command
   switch (staff->getStaffKind ()) {
     case msrStaff::kRegularStaff:
-      if (gLilypondOptions->fJianpu) {
+      if (gLilypondOptions ()->fJianpu) {
         fLilypondCodeIOstream << "\\new JianpuStaff";
       }
       else {
@@ -4930,7 +4930,7 @@ void lpsr2LilypondTranslator::visitStart (S_lpsrStaffBlock& elt)
     "\\with {" <<  
     endl;
 
-  gIndenter++;
+  gIndenter ()++;
   
   // fetch part uplink
   S_msrPart
@@ -5019,7 +5019,7 @@ void lpsr2LilypondTranslator::visitStart (S_lpsrStaffBlock& elt)
     }
   }
 
-  gIndenter--;
+  gIndenter ()--;
 
   // generate the string tunings if any
   S_msrStaffDetails
@@ -5042,7 +5042,7 @@ void lpsr2LilypondTranslator::visitStart (S_lpsrStaffBlock& elt)
         iEnd   = staffTuningsList.end (),
         i      = iBegin;
         
-      gIndenter++;
+      gIndenter ()++;
       
       for ( ; ; ) {
         S_msrStaffTuning
@@ -5050,7 +5050,7 @@ void lpsr2LilypondTranslator::visitStart (S_lpsrStaffBlock& elt)
           
         fLilypondCodeIOstream <<
           msrQuarterTonesPitchKindAsString (
-            gLpsrOptions->
+            gLpsrOptions ()->
               fLpsrQuarterTonesPitchesLanguageKind,
             staffTuning->
               getStaffTuningQuarterTonesPitchKind ()) <<
@@ -5066,7 +5066,7 @@ void lpsr2LilypondTranslator::visitStart (S_lpsrStaffBlock& elt)
         ">" <<
         endl;
 
-      gIndenter--;
+      gIndenter ()--;
 
       // should letters be used for frets?
       switch (staffDetails->getShowFretsKind ()) {
@@ -5087,7 +5087,7 @@ void lpsr2LilypondTranslator::visitStart (S_lpsrStaffBlock& elt)
     endl;
 
   // generate the comment if relevant
-  if (gLilypondOptions->fComments) {
+  if (gLilypondOptions ()->fComments) {
     fLilypondCodeIOstream << left <<
         setw (commentFieldWidth) <<
         "<<" <<
@@ -5101,27 +5101,27 @@ void lpsr2LilypondTranslator::visitStart (S_lpsrStaffBlock& elt)
   fLilypondCodeIOstream <<
     endl;
  
-  if (gLilypondOptions->fJianpu) {
+  if (gLilypondOptions ()->fJianpu) {
     fLilypondCodeIOstream <<
       " \\jianpuMusic" <<
       endl;
   }
 
-  gIndenter++;
+  gIndenter ()++;
 }
 
 void lpsr2LilypondTranslator::visitEnd (S_lpsrStaffBlock& elt)
 {
-  if (gLpsrOptions->fTraceLpsrVisitors) {
+  if (gLpsrOptions ()->fTraceLpsrVisitors) {
     fLilypondCodeIOstream <<
       "% --> End visiting lpsrStaffBlock" <<
       ", line " << elt->getInputLineNumber () <<
       endl;
   }
 
-  gIndenter--;
+  gIndenter ()--;
 
-  if (gLilypondOptions->fComments) {
+  if (gLilypondOptions ()->fComments) {
     fLilypondCodeIOstream << left <<
       setw (commentFieldWidth) << ">>" <<    
       "% staff " <<
@@ -5145,7 +5145,7 @@ void lpsr2LilypondTranslator::visitEnd (S_lpsrStaffBlock& elt)
 //________________________________________________________________________
 void lpsr2LilypondTranslator::visitStart (S_lpsrNewStaffgroupBlock& elt)
 {
-  if (gLpsrOptions->fTraceLpsrVisitors) {
+  if (gLpsrOptions ()->fTraceLpsrVisitors) {
     fLilypondCodeIOstream <<
       "% --> Start visiting lpsrNewStaffgroupBlock" <<
       ", line " << elt->getInputLineNumber () <<
@@ -5156,19 +5156,19 @@ void lpsr2LilypondTranslator::visitStart (S_lpsrNewStaffgroupBlock& elt)
      "\\new StaffGroup" << " " << "{" <<
       endl;
 
-  gIndenter++;
+  gIndenter ()++;
 }
 
 void lpsr2LilypondTranslator::visitEnd (S_lpsrNewStaffgroupBlock& elt)
 {
-  if (gLpsrOptions->fTraceLpsrVisitors) {
+  if (gLpsrOptions ()->fTraceLpsrVisitors) {
     fLilypondCodeIOstream <<
       "% --> End visiting lpsrNewStaffgroupBlock" <<
       ", line " << elt->getInputLineNumber () <<
       endl;
   }
 
-  gIndenter--;
+  gIndenter ()--;
 
   fLilypondCodeIOstream <<
     " }" <<
@@ -5178,33 +5178,33 @@ void lpsr2LilypondTranslator::visitEnd (S_lpsrNewStaffgroupBlock& elt)
 //________________________________________________________________________
 void lpsr2LilypondTranslator::visitStart (S_lpsrNewStaffBlock& elt)
 {
-  if (gLpsrOptions->fTraceLpsrVisitors) {
+  if (gLpsrOptions ()->fTraceLpsrVisitors) {
     fLilypondCodeIOstream <<
       "% --> Start visiting lpsrNewStaffBlock" <<
       ", line " << elt->getInputLineNumber () <<
       endl;
   }
 
-  gIndenter++;
+  gIndenter ()++;
 }
 
 void lpsr2LilypondTranslator::visitEnd (S_lpsrNewStaffBlock& elt)
 {
-  if (gLpsrOptions->fTraceLpsrVisitors) {
+  if (gLpsrOptions ()->fTraceLpsrVisitors) {
     fLilypondCodeIOstream <<
       "% --> End visiting lpsrNewStaffBlock" <<
       ", line " << elt->getInputLineNumber () <<
       endl;
   }
 
-  gIndenter--;
+  gIndenter ()--;
 }
 */
 
 //________________________________________________________________________
 void lpsr2LilypondTranslator::visitStart (S_lpsrUseVoiceCommand& elt)
 {
-  if (gLpsrOptions->fTraceLpsrVisitors) {
+  if (gLpsrOptions ()->fTraceLpsrVisitors) {
     fLilypondCodeIOstream <<
       "% --> Start visiting lpsrUseVoiceCommand" <<
       ", line " << elt->getInputLineNumber () <<
@@ -5264,9 +5264,9 @@ void lpsr2LilypondTranslator::visitStart (S_lpsrUseVoiceCommand& elt)
       voice->getVoiceName () << "\"" << " <<" <<
        endl;
   
-    gIndenter++;
+    gIndenter ()++;
   
-    if (gLilypondOptions->fNoAutoBeaming) {
+    if (gLilypondOptions ()->fNoAutoBeaming) {
       fLilypondCodeIOstream <<
         "\\set " << staffContextName << ".autoBeaming = ##f" <<
         endl;
@@ -5312,7 +5312,7 @@ void lpsr2LilypondTranslator::visitStart (S_lpsrUseVoiceCommand& elt)
     fLilypondCodeIOstream <<
       "\\" << voice->getVoiceName () << endl;
   
-    gIndenter--;
+    gIndenter ()--;
     
     fLilypondCodeIOstream <<
       ">>" <<
@@ -5322,7 +5322,7 @@ void lpsr2LilypondTranslator::visitStart (S_lpsrUseVoiceCommand& elt)
 
 void lpsr2LilypondTranslator::visitEnd (S_lpsrUseVoiceCommand& elt)
 {
-  if (gLpsrOptions->fTraceLpsrVisitors) {
+  if (gLpsrOptions ()->fTraceLpsrVisitors) {
     fLilypondCodeIOstream <<
       "% --> End visiting lpsrUseVoiceCommand" <<
       ", line " << elt->getInputLineNumber () <<
@@ -5333,32 +5333,32 @@ void lpsr2LilypondTranslator::visitEnd (S_lpsrUseVoiceCommand& elt)
 //________________________________________________________________________
 void lpsr2LilypondTranslator::visitStart (S_lpsrNewLyricsBlock& elt)
 {
-  if (gLpsrOptions->fTraceLpsrVisitors) {
+  if (gLpsrOptions ()->fTraceLpsrVisitors) {
     fLilypondCodeIOstream <<
       "% --> Start visiting lpsrNewLyricsBlock" <<
       ", line " << elt->getInputLineNumber () <<
       endl;
   }
 
-  if (! gLilypondOptions->fNoLilypondLyrics) {
+  if (! gLilypondOptions ()->fNoLilypondLyrics) {
     S_msrStanza stanza = elt->getStanza ();
     
     fLilypondCodeIOstream <<
       "\\new Lyrics" <<
       endl;
 
-    gIndenter++;
+    gIndenter ()++;
     
     fLilypondCodeIOstream <<
       "\\with {" <<
       endl <<
-      gTab << "associatedVoice = " <<
+      gTab () << "associatedVoice = " <<
       "\""  << elt->getVoice ()->getVoiceName () << "\"" <<
       endl;
 
-    if (gMsrOptions->fAddStanzasNumbers) {
+    if (gMsrOptions ()->fAddStanzasNumbers) {
       fLilypondCodeIOstream <<
-        gTab << "stanza = \"" <<
+        gTab () << "stanza = \"" <<
         stanza->getStanzaNumber () <<
         ".\"" <<
         endl;
@@ -5371,20 +5371,20 @@ void lpsr2LilypondTranslator::visitStart (S_lpsrNewLyricsBlock& elt)
       "\\" << stanza->getStanzaName () <<
       endl;
 
-    gIndenter--;
+    gIndenter ()--;
   }
 }
 
 void lpsr2LilypondTranslator::visitEnd (S_lpsrNewLyricsBlock& elt)
 {
-  if (gLpsrOptions->fTraceLpsrVisitors) {
+  if (gLpsrOptions ()->fTraceLpsrVisitors) {
     fLilypondCodeIOstream <<
       "% --> End visiting lpsrNewLyricsBlock" <<
       ", line " << elt->getInputLineNumber () <<
       endl;
   }
 
-  if (! gLilypondOptions->fNoLilypondLyrics) {
+  if (! gLilypondOptions ()->fNoLilypondLyrics) {
     // JMI
   }
 }
@@ -5392,32 +5392,32 @@ void lpsr2LilypondTranslator::visitEnd (S_lpsrNewLyricsBlock& elt)
 //________________________________________________________________________
 void lpsr2LilypondTranslator::visitStart (S_lpsrVariableUseCommand& elt)
 {
-  if (gLpsrOptions->fTraceLpsrVisitors) {
+  if (gLpsrOptions ()->fTraceLpsrVisitors) {
     fLilypondCodeIOstream <<
       "% --> Start visiting lpsrVariableUseCommand" <<
       ", line " << elt->getInputLineNumber () <<
       endl;
   }
 
-  gIndenter++;
+  gIndenter ()++;
 }
 
 void lpsr2LilypondTranslator::visitEnd (S_lpsrVariableUseCommand& elt)
 {
-  if (gLpsrOptions->fTraceLpsrVisitors) {
+  if (gLpsrOptions ()->fTraceLpsrVisitors) {
     fLilypondCodeIOstream <<
       "% --> End visiting lpsrVariableUseCommand" <<
       ", line " << elt->getInputLineNumber () <<
       endl;
   }
 
-  gIndenter--;
+  gIndenter ()--;
 }
 
 //________________________________________________________________________
 void lpsr2LilypondTranslator::visitStart (S_lpsrChordNamesContext& elt)
 {
-  if (gLpsrOptions->fTraceLpsrVisitors) {
+  if (gLpsrOptions ()->fTraceLpsrVisitors) {
     fLilypondCodeIOstream <<
       "% --> Start visiting lpsrChordNamesContext" <<
       ", line " << elt->getInputLineNumber () <<
@@ -5441,7 +5441,7 @@ void lpsr2LilypondTranslator::visitStart (S_lpsrChordNamesContext& elt)
       "\\with {" <<
       endl;
 
-    gIndenter++;
+    gIndenter ()++;
     
     fLilypondCodeIOstream <<
       "\\override BarLine.bar-extent = #'(-2 . 2)" <<
@@ -5449,7 +5449,7 @@ void lpsr2LilypondTranslator::visitStart (S_lpsrChordNamesContext& elt)
       "\\consists \"Bar_engraver\"" <<
       endl;
         
-    gIndenter--;
+    gIndenter ()--;
         
     fLilypondCodeIOstream <<
       "}" <<
@@ -5465,7 +5465,7 @@ void lpsr2LilypondTranslator::visitStart (S_lpsrChordNamesContext& elt)
 
 void lpsr2LilypondTranslator::visitEnd (S_lpsrChordNamesContext& elt)
 {
-  if (gLpsrOptions->fTraceLpsrVisitors) {
+  if (gLpsrOptions ()->fTraceLpsrVisitors) {
     fLilypondCodeIOstream <<
       "% --> End visiting lpsrChordNamesContext" <<
       ", line " << elt->getInputLineNumber () <<
@@ -5476,7 +5476,7 @@ void lpsr2LilypondTranslator::visitEnd (S_lpsrChordNamesContext& elt)
 //________________________________________________________________________
 void lpsr2LilypondTranslator::visitStart (S_lpsrFiguredBassContext& elt)
 {
-  if (gLpsrOptions->fTraceLpsrVisitors) {
+  if (gLpsrOptions ()->fTraceLpsrVisitors) {
     fLilypondCodeIOstream <<
       "% --> Start visiting lpsrFiguredBassContext" <<
       ", line " << elt->getInputLineNumber () <<
@@ -5500,7 +5500,7 @@ void lpsr2LilypondTranslator::visitStart (S_lpsrFiguredBassContext& elt)
       "\\with {" <<
       endl;
 
-    gIndenter++;
+    gIndenter ()++;
     
     fLilypondCodeIOstream <<
       "\\override BarLine.bar-extent = #'(-2 . 2)" <<
@@ -5508,7 +5508,7 @@ void lpsr2LilypondTranslator::visitStart (S_lpsrFiguredBassContext& elt)
       "\\consists \"Bar_engraver\"" <<
       endl;
         
-    gIndenter--;
+    gIndenter ()--;
         
     fLilypondCodeIOstream <<
       "}" <<
@@ -5524,7 +5524,7 @@ void lpsr2LilypondTranslator::visitStart (S_lpsrFiguredBassContext& elt)
 
 void lpsr2LilypondTranslator::visitEnd (S_lpsrFiguredBassContext& elt)
 {
-  if (gLpsrOptions->fTraceLpsrVisitors) {
+  if (gLpsrOptions ()->fTraceLpsrVisitors) {
     fLilypondCodeIOstream <<
       "% --> End visiting lpsrFiguredBassContext" <<
       ", line " << elt->getInputLineNumber () <<
@@ -5535,33 +5535,33 @@ void lpsr2LilypondTranslator::visitEnd (S_lpsrFiguredBassContext& elt)
 //________________________________________________________________________
 void lpsr2LilypondTranslator::visitStart (S_lpsrBarCommand& elt)
 {
-  if (gLpsrOptions->fTraceLpsrVisitors) {
+  if (gLpsrOptions ()->fTraceLpsrVisitors) {
     fLilypondCodeIOstream <<
       "% --> Start visiting lpsrBarCommand" <<
       ", line " << elt->getInputLineNumber () <<
       endl;
   }
 
-  gIndenter++;
+  gIndenter ()++;
 }
 
 void lpsr2LilypondTranslator::visitEnd (S_lpsrBarCommand& elt)
 {
-  if (gLpsrOptions->fTraceLpsrVisitors) {
+  if (gLpsrOptions ()->fTraceLpsrVisitors) {
     fLilypondCodeIOstream <<
       "% --> End visiting lpsrBarCommand" <<
       ", line " << elt->getInputLineNumber () <<
       endl;
   }
 
-  gIndenter--;
+  gIndenter ()--;
 }
 
 //________________________________________________________________________
 /* JMI
 void lpsr2LilypondTranslator::visitStart (S_lpsrMelismaCommand& elt)
 {
-  if (gLpsrOptions->fTraceLpsrVisitors) {
+  if (gLpsrOptions ()->fTraceLpsrVisitors) {
     fLilypondCodeIOstream <<
       "% --> Start visiting lpsrMelismaCommand" <<
       ", line " << elt->getInputLineNumber () <<
@@ -5580,7 +5580,7 @@ void lpsr2LilypondTranslator::visitStart (S_lpsrMelismaCommand& elt)
 
 void lpsr2LilypondTranslator::visitEnd (S_lpsrMelismaCommand& elt)
 {
-  if (gLpsrOptions->fTraceLpsrVisitors) {
+  if (gLpsrOptions ()->fTraceLpsrVisitors) {
     fLilypondCodeIOstream <<
       "% --> End visiting lpsrMelismaCommand" <<
       ", line " << elt->getInputLineNumber () <<
@@ -5592,7 +5592,7 @@ void lpsr2LilypondTranslator::visitEnd (S_lpsrMelismaCommand& elt)
 //________________________________________________________________________
 void lpsr2LilypondTranslator::visitStart (S_msrScore& elt)
 {
-  if (gLpsrOptions->fTraceLpsrVisitors) {
+  if (gLpsrOptions ()->fTraceLpsrVisitors) {
     fLilypondCodeIOstream <<
       "% --> Start visiting msrScore" <<
       ", line " << elt->getInputLineNumber () <<
@@ -5602,7 +5602,7 @@ void lpsr2LilypondTranslator::visitStart (S_msrScore& elt)
 
 void lpsr2LilypondTranslator::visitEnd (S_msrScore& elt)
 {
-  if (gLpsrOptions->fTraceLpsrVisitors) {
+  if (gLpsrOptions ()->fTraceLpsrVisitors) {
     fLilypondCodeIOstream <<
       "% --> End visiting msrScore" <<
       ", line " << elt->getInputLineNumber () <<
@@ -5613,7 +5613,7 @@ void lpsr2LilypondTranslator::visitEnd (S_msrScore& elt)
 //________________________________________________________________________
 void lpsr2LilypondTranslator::visitStart (S_msrCredit& elt)
 {
-  if (gLpsrOptions->fTraceLpsrVisitors) {
+  if (gLpsrOptions ()->fTraceLpsrVisitors) {
     fLilypondCodeIOstream <<
       "% --> Start visiting msrCredit" <<
       ", line " << elt->getInputLineNumber () <<
@@ -5623,7 +5623,7 @@ void lpsr2LilypondTranslator::visitStart (S_msrCredit& elt)
 
 void lpsr2LilypondTranslator::visitEnd (S_msrCredit& elt)
 {
-  if (gLpsrOptions->fTraceLpsrVisitors) {
+  if (gLpsrOptions ()->fTraceLpsrVisitors) {
     fLilypondCodeIOstream <<
       "% --> End visiting msrCredit" <<
       ", line " << elt->getInputLineNumber () <<
@@ -5633,7 +5633,7 @@ void lpsr2LilypondTranslator::visitEnd (S_msrCredit& elt)
 
 void lpsr2LilypondTranslator::visitStart (S_msrCreditWords& elt)
 {
-  if (gLpsrOptions->fTraceLpsrVisitors) {
+  if (gLpsrOptions ()->fTraceLpsrVisitors) {
     fLilypondCodeIOstream <<
       "% --> Start visiting msrCreditWords" <<
       ", line " << elt->getInputLineNumber () <<
@@ -5643,7 +5643,7 @@ void lpsr2LilypondTranslator::visitStart (S_msrCreditWords& elt)
 
 void lpsr2LilypondTranslator::visitEnd (S_msrCreditWords& elt)
 {
-  if (gLpsrOptions->fTraceLpsrVisitors) {
+  if (gLpsrOptions ()->fTraceLpsrVisitors) {
     fLilypondCodeIOstream <<
       "% --> End visiting msrCreditWords" <<
       ", line " << elt->getInputLineNumber () <<
@@ -5654,7 +5654,7 @@ void lpsr2LilypondTranslator::visitEnd (S_msrCreditWords& elt)
 //________________________________________________________________________
 void lpsr2LilypondTranslator::visitStart (S_msrPartGroup& elt)
 {
-  if (gLpsrOptions->fTraceLpsrVisitors) {
+  if (gLpsrOptions ()->fTraceLpsrVisitors) {
     fLilypondCodeIOstream <<
       "% --> Start visiting msrPartGroup" <<
       ", line " << elt->getInputLineNumber () <<
@@ -5665,7 +5665,7 @@ void lpsr2LilypondTranslator::visitStart (S_msrPartGroup& elt)
 
 void lpsr2LilypondTranslator::visitEnd (S_msrPartGroup& elt)
 {
-  if (gLpsrOptions->fTraceLpsrVisitors) {
+  if (gLpsrOptions ()->fTraceLpsrVisitors) {
     fLilypondCodeIOstream <<
       "% --> End visiting msrPartGroup" <<
       elt->getPartGroupCombinedName () <<
@@ -5681,7 +5681,7 @@ void lpsr2LilypondTranslator::visitStart (S_msrPart& elt)
     partCombinedName =
       elt->getPartCombinedName ();
       
-  if (gLpsrOptions->fTraceLpsrVisitors) {
+  if (gLpsrOptions ()->fTraceLpsrVisitors) {
     fLilypondCodeIOstream <<
       "% --> Start visiting msrPart" <<
       partCombinedName <<
@@ -5690,7 +5690,7 @@ void lpsr2LilypondTranslator::visitStart (S_msrPart& elt)
   }
 
 #ifdef TRACE_OPTIONS
-  if (gTraceOptions->fTraceParts) {
+  if (gTraceOptions ()->fTraceParts) {
     fLogOutputStream <<
       endl <<
       "<!--=== part \"" << partCombinedName << "\"" <<
@@ -5707,7 +5707,7 @@ void lpsr2LilypondTranslator::visitStart (S_msrPart& elt)
 
 void lpsr2LilypondTranslator::visitEnd (S_msrPart& elt)
 {
-  if (gLpsrOptions->fTraceLpsrVisitors) {
+  if (gLpsrOptions ()->fTraceLpsrVisitors) {
     fLilypondCodeIOstream <<
       "% --> End visiting msrPart" <<
       elt->getPartCombinedName () <<
@@ -5721,7 +5721,7 @@ void lpsr2LilypondTranslator::visitEnd (S_msrPart& elt)
 //________________________________________________________________________
 void lpsr2LilypondTranslator::visitStart (S_msrStaff& elt)
 {
-  if (gLpsrOptions->fTraceLpsrVisitors) {
+  if (gLpsrOptions ()->fTraceLpsrVisitors) {
     fLilypondCodeIOstream <<
       "% --> Start visiting msrStaff \"" <<
       elt->getStaffName () <<
@@ -5735,7 +5735,7 @@ void lpsr2LilypondTranslator::visitStart (S_msrStaff& elt)
 
 void lpsr2LilypondTranslator::visitEnd (S_msrStaff& elt)
 {
-  if (gLpsrOptions->fTraceLpsrVisitors) {
+  if (gLpsrOptions ()->fTraceLpsrVisitors) {
     fLilypondCodeIOstream <<
       "% --> End visiting msrStaff \"" <<
       elt->getStaffName () <<
@@ -5749,7 +5749,7 @@ void lpsr2LilypondTranslator::visitEnd (S_msrStaff& elt)
 
 void lpsr2LilypondTranslator::visitStart (S_msrStaffTuning& elt)
 {
-  if (gLpsrOptions->fTraceLpsrVisitors) {
+  if (gLpsrOptions ()->fTraceLpsrVisitors) {
     fLilypondCodeIOstream <<
       "%--> Start visiting msrStaffTuning" <<
       endl;
@@ -5774,7 +5774,7 @@ void lpsr2LilypondTranslator::visitStart (S_msrStaffTuning& elt)
     for ( ; ; ) {
       fLilypondCodeIOstream <<
         msrQuarterTonesPitchAsString (
-          gLpsrOptions->fLpsrQuarterTonesPitchesLanguage,
+          gLpsrOptions ()->fLpsrQuarterTonesPitchesLanguage,
  // JMI            elt->getInputLineNumber (),
           ((*i)->getStaffTuningQuarterTonesPitch ())) <<        
  // JMI       char (tolower ((*i)->getStaffTuningStep ())) <<
@@ -5793,7 +5793,7 @@ void lpsr2LilypondTranslator::visitStart (S_msrStaffTuning& elt)
 
 void lpsr2LilypondTranslator::visitStart (S_msrStaffDetails& elt)
 {
-  if (gLpsrOptions->fTraceLpsrVisitors) {
+  if (gLpsrOptions ()->fTraceLpsrVisitors) {
     fLilypondCodeIOstream <<
       "%--> Start visiting msrStaffDetails" <<
       endl;
@@ -5820,7 +5820,7 @@ void lpsr2LilypondTranslator::visitStart (S_msrStaffDetails& elt)
 //________________________________________________________________________
 void lpsr2LilypondTranslator::visitStart (S_msrVoice& elt)
 {
-  if (gLpsrOptions->fTraceLpsrVisitors) {
+  if (gLpsrOptions ()->fTraceLpsrVisitors) {
     fLilypondCodeIOstream <<
       "% --> Start visiting msrVoice \"" <<
       elt->getVoiceName () <<
@@ -5839,7 +5839,7 @@ void lpsr2LilypondTranslator::visitStart (S_msrVoice& elt)
   switch (fCurrentVoice->getVoiceKind ()) {
     
     case msrVoice::kRegularVoice:
-      if (gLilypondOptions->fAbsoluteOctaves) {
+      if (gLilypondOptions ()->fAbsoluteOctaves) {
         fLilypondCodeIOstream <<
           "{" <<
           endl;
@@ -5864,42 +5864,42 @@ void lpsr2LilypondTranslator::visitStart (S_msrVoice& elt)
       break;
   } // switch
 
-  gIndenter++;
+  gIndenter ()++;
 
-  if (gLilypondOptions->fGlobal) {
+  if (gLilypondOptions ()->fGlobal) {
     fLilypondCodeIOstream <<
       "\\global" <<
       endl <<
       endl;
   }
     
-  if (gLilypondOptions->fDisplayMusic) {
+  if (gLilypondOptions ()->fDisplayMusic) {
     fLilypondCodeIOstream <<
       "\\displayMusic {" <<
       endl;
 
-    gIndenter++;
+    gIndenter ()++;
   }
     
   fLilypondCodeIOstream <<
     "\\language \"" <<
     msrQuarterTonesPitchesLanguageKindAsString (
-      gLpsrOptions->
+      gLpsrOptions ()->
         fLpsrQuarterTonesPitchesLanguageKind) <<
     "\"" <<
     endl;
 
-  if (gLpsrOptions->fLpsrChordsLanguageKind != k_IgnatzekChords) {
+  if (gLpsrOptions ()->fLpsrChordsLanguageKind != k_IgnatzekChords) {
     fLilypondCodeIOstream <<
       "\\" <<
       lpsrChordsLanguageKindAsString (
-        gLpsrOptions->
+        gLpsrOptions ()->
           fLpsrChordsLanguageKind) <<
       "Chords" <<
       endl;
   }
 
-  if (gLilypondOptions->fShowAllBarNumbers) {
+  if (gLilypondOptions ()->fShowAllBarNumbers) {
     fLilypondCodeIOstream <<
       "\\set Score.barNumberVisibility = #all-bar-numbers-visible" <<
       endl <<
@@ -5911,22 +5911,24 @@ void lpsr2LilypondTranslator::visitStart (S_msrVoice& elt)
 // JMI   \set Score.alternativeNumberingStyle = #'numbers-with-letters
 
 
+  // only the voices that contain multiple rests are compressed,
+  // unless the user asks for all of them
   if (
     fCurrentVoice->getVoiceContainsMultipleRests ()
       ||
-    gLilypondOptions->fCompressMultiMeasureRests) {
+    gLilypondOptions ()->fCompressMultiMeasureRests) {
     fLilypondCodeIOstream <<
       "\\compressMMRests {" <<
       endl;
 
-    gIndenter++;
+    gIndenter ()++;
   }
 
-  if (gLilypondOptions->fAccidentalStyleKind != kDefaultStyle) {
+  if (gLilypondOptions ()->fAccidentalStyleKind != kDefaultStyle) {
     fLilypondCodeIOstream <<
       "\\accidentalStyle Score." <<
       lpsrAccidentalStyleKindAsString (
-        gLilypondOptions->fAccidentalStyleKind) <<
+        gLilypondOptions ()->fAccidentalStyleKind) <<
       endl <<
       endl;
   }
@@ -5960,9 +5962,9 @@ void lpsr2LilypondTranslator::visitStart (S_msrVoice& elt)
 
 void lpsr2LilypondTranslator::visitEnd (S_msrVoice& elt)
 {
-  gIndenter--;
+  gIndenter ()--;
 
-  if (gLpsrOptions->fTraceLpsrVisitors) {
+  if (gLpsrOptions ()->fTraceLpsrVisitors) {
     fLilypondCodeIOstream <<
       "% --> End visiting msrVoice \"" <<
       elt->getVoiceName () <<
@@ -5974,20 +5976,20 @@ void lpsr2LilypondTranslator::visitEnd (S_msrVoice& elt)
   if (
     fCurrentVoice->getVoiceContainsMultipleRests ()
       ||
-    gLilypondOptions->fCompressMultiMeasureRests) {
+    gLilypondOptions ()->fCompressMultiMeasureRests) {
     fLilypondCodeIOstream <<
       "}" <<
       endl;
 
-    gIndenter--;
+    gIndenter ()--;
   }
 
-  if (gLilypondOptions->fDisplayMusic) {
+  if (gLilypondOptions ()->fDisplayMusic) {
     fLilypondCodeIOstream <<
       "}" <<
       endl;
 
-    gIndenter--;
+    gIndenter ()--;
   }
     
   // generate the end of the voice definition
@@ -6034,7 +6036,7 @@ void lpsr2LilypondTranslator::visitEnd (S_msrVoice& elt)
 //________________________________________________________________________
 void lpsr2LilypondTranslator::visitStart (S_msrVoiceStaffChange& elt)
 {
-  if (gLpsrOptions->fTraceLpsrVisitors) {
+  if (gLpsrOptions ()->fTraceLpsrVisitors) {
     fLilypondCodeIOstream <<
       "% --> Start visiting msrVoiceStaffChange '" <<
       elt->asString () << "'" <<
@@ -6048,7 +6050,7 @@ void lpsr2LilypondTranslator::visitStart (S_msrVoiceStaffChange& elt)
     elt->getStaffToChangeTo ()->getStaffName () <<
     "\"";
 
-  if (gLilypondOptions->fNoteInputLineNumbers) { // JMI
+  if (gLilypondOptions ()->fNoteInputLineNumbers) { // JMI
     // print the staff change line number as a comment
     fLilypondCodeIOstream <<
       "%{ " << elt->getInputLineNumber () << " %} ";
@@ -6061,7 +6063,7 @@ void lpsr2LilypondTranslator::visitStart (S_msrVoiceStaffChange& elt)
 //________________________________________________________________________
 void lpsr2LilypondTranslator::visitStart (S_msrHarmony& elt)
 {
-  if (gLpsrOptions->fTraceLpsrVisitors) {
+  if (gLpsrOptions ()->fTraceLpsrVisitors) {
     fLilypondCodeIOstream <<
       "% --> Start visiting msrHarmony '" <<
       elt->asString () <<
@@ -6075,7 +6077,7 @@ void lpsr2LilypondTranslator::visitStart (S_msrHarmony& elt)
 
   if (fOnGoingNote) {
 #ifdef TRACE_OPTIONS
-    if (gTraceOptions->fTraceHarmonies) {
+    if (gTraceOptions ()->fTraceHarmonies) {
       fLilypondCodeIOstream <<
         "%{ " << elt->asString () << " %}" <<
         endl;
@@ -6096,7 +6098,7 @@ void lpsr2LilypondTranslator::visitStart (S_msrHarmony& elt)
       harmonyAsLilypondString (elt) <<
       " ";
       
-    if (gLilypondOptions->fNoteInputLineNumbers) {
+    if (gLilypondOptions ()->fNoteInputLineNumbers) {
       // print the harmony line number as a comment
       fLilypondCodeIOstream <<
         "%{ " << elt->getInputLineNumber () << " %} ";
@@ -6114,7 +6116,7 @@ void lpsr2LilypondTranslator::visitStart (S_msrHarmony& elt)
 //________________________________________________________________________
 void lpsr2LilypondTranslator::visitStart (S_msrFrame& elt)
 {
-  if (gLpsrOptions->fTraceLpsrVisitors) {
+  if (gLpsrOptions ()->fTraceLpsrVisitors) {
     fLilypondCodeIOstream <<
       "% --> Start visiting msrHarmony '" <<
       elt->asString () <<
@@ -6125,7 +6127,7 @@ void lpsr2LilypondTranslator::visitStart (S_msrFrame& elt)
   
   if (fOnGoingNote) {
 #ifdef TRACE_OPTIONS
-    if (gTraceOptions->fTraceFrames) {
+    if (gTraceOptions ()->fTraceFrames) {
       fLilypondCodeIOstream <<
         "%{ " << elt->asString () << " %}" <<
         endl;
@@ -6141,7 +6143,7 @@ void lpsr2LilypondTranslator::visitStart (S_msrFrame& elt)
 //________________________________________________________________________
 void lpsr2LilypondTranslator::visitStart (S_msrFiguredBass& elt)
 {
-  if (gLpsrOptions->fTraceLpsrVisitors) {
+  if (gLpsrOptions ()->fTraceLpsrVisitors) {
     fLilypondCodeIOstream <<
       "% --> Start visiting msrFiguredBass '" <<
       elt->asString () <<
@@ -6170,7 +6172,7 @@ void lpsr2LilypondTranslator::visitStart (S_msrFiguredBass& elt)
     fLilypondCodeIOstream <<
       "<";
       
-    if (gLilypondOptions->fNoteInputLineNumbers) {
+    if (gLilypondOptions ()->fNoteInputLineNumbers) {
       // print the figured bass line number as a comment
       fLilypondCodeIOstream <<
         " %{ " << fCurrentFiguredBass->getInputLineNumber () << " %} ";
@@ -6189,7 +6191,7 @@ void lpsr2LilypondTranslator::visitStart (S_msrFiguredBass& elt)
 
 void lpsr2LilypondTranslator::visitStart (S_msrFigure& elt)
 {
-  if (gLpsrOptions->fTraceLpsrVisitors) {
+  if (gLpsrOptions ()->fTraceLpsrVisitors) {
     fLilypondCodeIOstream <<
       "% --> Start visiting msrFigure '" <<
       elt->asString () <<
@@ -6294,7 +6296,7 @@ void lpsr2LilypondTranslator::visitStart (S_msrFigure& elt)
 
 void lpsr2LilypondTranslator::visitEnd (S_msrFiguredBass& elt)
 {
-  if (gLpsrOptions->fTraceLpsrVisitors) {
+  if (gLpsrOptions ()->fTraceLpsrVisitors) {
     fLilypondCodeIOstream <<
       "% --> End visiting msrFiguredBass '" <<
       elt->asString () <<
@@ -6315,20 +6317,20 @@ void lpsr2LilypondTranslator::visitEnd (S_msrFiguredBass& elt)
 //________________________________________________________________________
 void lpsr2LilypondTranslator::visitStart (S_msrSegment& elt)
 {
-  if (gLpsrOptions->fTraceLpsrVisitors) {
+  if (gLpsrOptions ()->fTraceLpsrVisitors) {
     fLilypondCodeIOstream <<
       "%--> Start visiting msrSegment '" <<
       elt->getSegmentAbsoluteNumber () << "'" <<
       endl;
   }
 
-  if (gLilypondOptions->fComments) {
+  if (gLilypondOptions ()->fComments) {
     fLilypondCodeIOstream << left <<
       setw (commentFieldWidth) <<
       "% start of segment" <<
       endl;
 
-    gIndenter++;
+    gIndenter ()++;
   }
 
   fSegmentNotesAndChordsCountersStack.push (0);
@@ -6336,15 +6338,15 @@ void lpsr2LilypondTranslator::visitStart (S_msrSegment& elt)
 
 void lpsr2LilypondTranslator::visitEnd (S_msrSegment& elt)
 {
-  if (gLpsrOptions->fTraceLpsrVisitors) {
+  if (gLpsrOptions ()->fTraceLpsrVisitors) {
     fLilypondCodeIOstream <<
       "%--> End visiting msrSegment '" <<
       elt->getSegmentAbsoluteNumber () << "'" <<
       endl;
   }
 
-  if (gLilypondOptions->fComments) {
-    gIndenter--;
+  if (gLilypondOptions ()->fComments) {
+    gIndenter ()--;
     
     fLilypondCodeIOstream << left <<
       setw (commentFieldWidth) <<
@@ -6372,7 +6374,7 @@ void lpsr2LilypondTranslator::visitStart (S_msrMeasure& elt)
       elt->getMeasureNumber ();
 
 #ifdef TRACE_OPTIONS
-  if (gTraceOptions->fTraceMeasures) {
+  if (gTraceOptions ()->fTraceMeasures) {
     fLogOutputStream <<
       endl <<
       "% <!--=== measure '" << measureNumber <<
@@ -6415,7 +6417,7 @@ void lpsr2LilypondTranslator::visitStart (S_msrMeasure& elt)
     measureKind =
       elt->getMeasureKind ();
       
-  if (gLpsrOptions->fTraceLpsrVisitors) {
+  if (gLpsrOptions ()->fTraceLpsrVisitors) {
     fLilypondCodeIOstream <<
       "% --> Start visiting msrMeasure " <<
       measureNumber <<
@@ -6425,14 +6427,14 @@ void lpsr2LilypondTranslator::visitStart (S_msrMeasure& elt)
       endl;
   }
 
-  if (gLilypondOptions->fComments) {
+  if (gLilypondOptions ()->fComments) {
     fLilypondCodeIOstream << left <<
       setw (commentFieldWidth) <<
       "% start of measure " << measureNumber <<
       ", line " << inputLineNumber <<
       endl;
 
-    gIndenter++;
+    gIndenter ()++;
   }
 
   // is this the end of a cadenza?
@@ -6447,7 +6449,7 @@ void lpsr2LilypondTranslator::visitStart (S_msrMeasure& elt)
       endl <<
       "\\bar \"|\" "; // JMI ???
 
-    if (gLilypondOptions->fComments) {
+    if (gLilypondOptions ()->fComments) {
       fLilypondCodeIOstream <<
         " % kOverfullMeasureKind End";
     }
@@ -6471,13 +6473,13 @@ void lpsr2LilypondTranslator::visitStart (S_msrMeasure& elt)
 
 if (false) // JMI
         msrInternalError (
-          gXml2lyOptions->fInputSourceName,
+          gXml2lyOptions ()->fInputSourceName,
           inputLineNumber,
           __FILE__, __LINE__,
           s.str ());
 else
         msrInternalWarning (
-          gXml2lyOptions->fInputSourceName,
+          gXml2lyOptions ()->fInputSourceName,
           inputLineNumber,
           s.str ());
       }
@@ -6528,7 +6530,7 @@ else
         ratioToFullLength.rationalise ();
   
 #ifdef TRACE_OPTIONS
-        if (gTraceOptions->fTraceMeasuresDetails) {
+        if (gTraceOptions ()->fTraceMeasuresDetails) {
           const int fieldWidth = 27;
           
           fLilypondCodeIOstream << left <<
@@ -6559,7 +6561,7 @@ else
             
      // JMI       msrInternalError (
           msrInternalWarning (
-            gXml2lyOptions->fInputSourceName,
+            gXml2lyOptions ()->fInputSourceName,
             inputLineNumber,
     // JMI        __FILE__, __LINE__,
             s.str ());
@@ -6575,7 +6577,7 @@ else
     */
     
           // should we generate a break?
-          if (gLilypondOptions->fBreakLinesAtIncompleteRightMeasures) {
+          if (gLilypondOptions ()->fBreakLinesAtIncompleteRightMeasures) {
             fLilypondCodeIOstream <<
               "\\break" <<
               endl;
@@ -6591,7 +6593,7 @@ else
           "\\cadenzaOn" <<
           " \\omit Staff.TimeSignature";
 
-        if (gLilypondOptions->fComments) {
+        if (gLilypondOptions ()->fComments) {
           fLilypondCodeIOstream << " % kOverfullMeasureKind Start";
         }
 
@@ -6608,7 +6610,7 @@ else
           endl <<
           "\\cadenzaOn";
 
-        if (gLilypondOptions->fComments) {
+        if (gLilypondOptions ()->fComments) {
           fLilypondCodeIOstream << " % kSenzaMisuraMeasureKind Start";
         }
 
@@ -6654,7 +6656,7 @@ void lpsr2LilypondTranslator::visitEnd (S_msrMeasure& elt)
       elt->getNextMeasureNumber ();
 
 #ifdef TRACE_OPTIONS
-  if (gTraceOptions->fTraceMeasures) {
+  if (gTraceOptions ()->fTraceMeasures) {
     fLogOutputStream <<
       endl <<
       "% <!--=== measure '" << measureNumber <<
@@ -6673,7 +6675,7 @@ void lpsr2LilypondTranslator::visitEnd (S_msrMeasure& elt)
     measureKind =
       elt->getMeasureKind ();
       
-  if (gLpsrOptions->fTraceLpsrVisitors) {
+  if (gLpsrOptions ()->fTraceLpsrVisitors) {
     fLilypondCodeIOstream <<
       "% --> End visiting msrMeasure " <<
       measureNumber <<
@@ -6766,8 +6768,8 @@ void lpsr2LilypondTranslator::visitEnd (S_msrMeasure& elt)
         break;
     } // switch
       
-    if (gLilypondOptions->fComments) {
-      gIndenter--;
+    if (gLilypondOptions ()->fComments) {
+      gIndenter ()--;
   
       fLilypondCodeIOstream << left <<
         setw (commentFieldWidth) <<
@@ -6778,11 +6780,11 @@ void lpsr2LilypondTranslator::visitEnd (S_msrMeasure& elt)
         endl;      
     }
   
-    if (gLilypondOptions->fSeparatorLineEveryNMeasures > 0) {
+    if (gLilypondOptions ()->fSeparatorLineEveryNMeasures > 0) {
       if (
         fCurrentVoiceMeasuresCounter
           %
-        gLilypondOptions->fSeparatorLineEveryNMeasures
+        gLilypondOptions ()->fSeparatorLineEveryNMeasures
           ==
         0)
         fLilypondCodeIOstream <<
@@ -6799,7 +6801,7 @@ void lpsr2LilypondTranslator::visitEnd (S_msrMeasure& elt)
 //________________________________________________________________________
 void lpsr2LilypondTranslator::visitStart (S_msrStanza& elt)
 {
-  if (gLpsrOptions->fTraceLpsrVisitors) {
+  if (gLpsrOptions ()->fTraceLpsrVisitors) {
     fLilypondCodeIOstream <<
       "% --> Start visiting msrStanza \"" <<
       elt->getStanzaName () <<
@@ -6808,7 +6810,7 @@ void lpsr2LilypondTranslator::visitStart (S_msrStanza& elt)
       endl;
   }
 
-  if (! gLilypondOptions->fNoLilypondLyrics) {
+  if (! gLilypondOptions ()->fNoLilypondLyrics) {
     // don't generate code for the stanza inside the code for the voice
     fGenerateCodeForOngoingNonEmptyStanza =
       ! fOnGoingVoice
@@ -6820,14 +6822,14 @@ void lpsr2LilypondTranslator::visitStart (S_msrStanza& elt)
         elt->getStanzaName () << " = " << "\\lyricmode {" <<
         endl;
         
-      gIndenter++;
+      gIndenter ()++;
     }
   }
 }
 
 void lpsr2LilypondTranslator::visitEnd (S_msrStanza& elt)
 {
-  if (gLpsrOptions->fTraceLpsrVisitors) {
+  if (gLpsrOptions ()->fTraceLpsrVisitors) {
     fLilypondCodeIOstream <<
       "% --> End visiting msrStanza \"" <<
       elt->getStanzaName () <<
@@ -6836,9 +6838,9 @@ void lpsr2LilypondTranslator::visitEnd (S_msrStanza& elt)
       endl;
   }
 
-  if (! gLilypondOptions->fNoLilypondLyrics) {
+  if (! gLilypondOptions ()->fNoLilypondLyrics) {
     if (fGenerateCodeForOngoingNonEmptyStanza) {
-      gIndenter--;
+      gIndenter ()--;
     
       fLilypondCodeIOstream <<
         endl <<
@@ -6854,7 +6856,7 @@ void lpsr2LilypondTranslator::visitEnd (S_msrStanza& elt)
 //________________________________________________________________________
 void lpsr2LilypondTranslator::visitStart (S_msrSyllable& elt)
 {
-  if (gLpsrOptions->fTraceLpsrVisitors) {
+  if (gLpsrOptions ()->fTraceLpsrVisitors) {
     fLilypondCodeIOstream <<
       "% --> Start visiting msrSyllable '" <<
       elt->asString () <<
@@ -6863,7 +6865,7 @@ void lpsr2LilypondTranslator::visitStart (S_msrSyllable& elt)
       endl;
   }
 
-  if (! gLilypondOptions->fNoLilypondLyrics) {
+  if (! gLilypondOptions ()->fNoLilypondLyrics) {
     if (fGenerateCodeForOngoingNonEmptyStanza) {
       switch (elt->getSyllableKind ()) {
         case msrSyllable::kSyllableSingle:
@@ -6875,7 +6877,7 @@ void lpsr2LilypondTranslator::visitStart (S_msrSyllable& elt)
             elt->syllableWholeNotesAsMsrString () <<
             " ";
 #ifdef TRACE_OPTIONS
-          if (gTraceOptions->fTraceLyrics) {
+          if (gTraceOptions ()->fTraceLyrics) {
             fLilypondCodeIOstream <<
               "%{ kSyllableSingle %} ";
           }
@@ -6891,7 +6893,7 @@ void lpsr2LilypondTranslator::visitStart (S_msrSyllable& elt)
             elt->syllableWholeNotesAsMsrString () <<
             " -- ";
 #ifdef TRACE_OPTIONS
-          if (gTraceOptions->fTraceLyrics) {
+          if (gTraceOptions ()->fTraceLyrics) {
             fLilypondCodeIOstream <<
               "%{ kSyllableBegin %} ";
           }
@@ -6907,7 +6909,7 @@ void lpsr2LilypondTranslator::visitStart (S_msrSyllable& elt)
             elt->syllableWholeNotesAsMsrString () <<
             " -- ";
 #ifdef TRACE_OPTIONS
-          if (gTraceOptions->fTraceLyrics) {
+          if (gTraceOptions ()->fTraceLyrics) {
             fLilypondCodeIOstream <<
               "%{ kSyllableMiddle %} ";
           }
@@ -6923,7 +6925,7 @@ void lpsr2LilypondTranslator::visitStart (S_msrSyllable& elt)
             elt->syllableWholeNotesAsMsrString () <<
             " ";
 #ifdef TRACE_OPTIONS
-          if (gTraceOptions->fTraceLyrics) {
+          if (gTraceOptions ()->fTraceLyrics) {
             fLilypondCodeIOstream <<
               "%{ kSyllableEnd %} ";
           }
@@ -6938,7 +6940,7 @@ void lpsr2LilypondTranslator::visitStart (S_msrSyllable& elt)
             elt->syllableWholeNotesAsMsrString () <<
             " ";
 #ifdef TRACE_OPTIONS
-          if (gTraceOptions->fTraceLyrics) {
+          if (gTraceOptions ()->fTraceLyrics) {
             fLilypondCodeIOstream <<
               "%{ kSyllableSkip %} ";
           }
@@ -6947,7 +6949,7 @@ void lpsr2LilypondTranslator::visitStart (S_msrSyllable& elt)
            
         case msrSyllable::kSyllableMeasureEnd:
       // JMI      "| " <<
-          if (gLilypondOptions->fNoteInputLineNumbers) {
+          if (gLilypondOptions ()->fNoteInputLineNumbers) {
             // print the measure end line number as a comment
             fLilypondCodeIOstream <<
               "%{ measure end, line " <<
@@ -6960,7 +6962,7 @@ void lpsr2LilypondTranslator::visitStart (S_msrSyllable& elt)
           break;
     
         case msrSyllable::kSyllableLineBreak:
-          if (gLilypondOptions->fNoteInputLineNumbers) {
+          if (gLilypondOptions ()->fNoteInputLineNumbers) {
             // print the measure end line number as a comment
             fLilypondCodeIOstream <<
               "%{ line break, line " <<
@@ -6973,7 +6975,7 @@ void lpsr2LilypondTranslator::visitStart (S_msrSyllable& elt)
           break;
     
         case msrSyllable::kSyllablePageBreak:
-          if (gLilypondOptions->fNoteInputLineNumbers) {
+          if (gLilypondOptions ()->fNoteInputLineNumbers) {
             // print the measure end line number as a comment
             fLilypondCodeIOstream <<
               "%{ page break, line " <<
@@ -6996,7 +6998,7 @@ void lpsr2LilypondTranslator::visitStart (S_msrSyllable& elt)
           fLilypondCodeIOstream <<
             "__ ";
 #ifdef TRACE_OPTIONS
-          if (gTraceOptions->fTraceLyrics) {
+          if (gTraceOptions ()->fTraceLyrics) {
             fLilypondCodeIOstream <<
               "%{ kSyllableExtendSingle %} ";
           }
@@ -7009,7 +7011,7 @@ void lpsr2LilypondTranslator::visitStart (S_msrSyllable& elt)
           fLilypondCodeIOstream <<
             "__ ";
 #ifdef TRACE_OPTIONS
-          if (gTraceOptions->fTraceLyrics) {
+          if (gTraceOptions ()->fTraceLyrics) {
             fLilypondCodeIOstream <<
               "%{ kSyllableExtendStart %} ";
           }
@@ -7018,7 +7020,7 @@ void lpsr2LilypondTranslator::visitStart (S_msrSyllable& elt)
           
         case msrSyllable::kSyllableExtendContinue:
 #ifdef TRACE_OPTIONS
-          if (gTraceOptions->fTraceLyrics) {
+          if (gTraceOptions ()->fTraceLyrics) {
             fLilypondCodeIOstream <<
               "%{ kSyllableExtendContinue %} ";
           }
@@ -7027,7 +7029,7 @@ void lpsr2LilypondTranslator::visitStart (S_msrSyllable& elt)
           
         case msrSyllable::kSyllableExtendStop:
 #ifdef TRACE_OPTIONS
-          if (gTraceOptions->fTraceLyrics) {
+          if (gTraceOptions ()->fTraceLyrics) {
             fLilypondCodeIOstream <<
               "%{ kSyllableExtendStop %} ";
           }
@@ -7038,7 +7040,7 @@ void lpsr2LilypondTranslator::visitStart (S_msrSyllable& elt)
           break;
       } // switch
       
-      if (gLilypondOptions->fNoteInputLineNumbers) {
+      if (gLilypondOptions ()->fNoteInputLineNumbers) {
         // print the note line number as a comment
         fLilypondCodeIOstream <<
           "%{ " << elt->getInputLineNumber () << " %} ";
@@ -7049,7 +7051,7 @@ void lpsr2LilypondTranslator::visitStart (S_msrSyllable& elt)
 
 void lpsr2LilypondTranslator::visitEnd (S_msrSyllable& elt)
 {
-  if (gLpsrOptions->fTraceLpsrVisitors) {
+  if (gLpsrOptions ()->fTraceLpsrVisitors) {
     fLilypondCodeIOstream <<
       "% --> End visiting msrSyllable '" <<
       elt->asString () <<
@@ -7062,7 +7064,7 @@ void lpsr2LilypondTranslator::visitEnd (S_msrSyllable& elt)
 //________________________________________________________________________
 void lpsr2LilypondTranslator::visitStart (S_msrClef& elt)
 {
-  if (gLpsrOptions->fTraceLpsrVisitors) {
+  if (gLpsrOptions ()->fTraceLpsrVisitors) {
     fLilypondCodeIOstream <<
       "% --> Start visiting msrClef '" <<
       elt->asString () <<
@@ -7139,7 +7141,7 @@ void lpsr2LilypondTranslator::visitStart (S_msrClef& elt)
       case msrClef::kTablature7Clef:
         fLilypondCodeIOstream << "tab";
         /* JMI ???
-        if (gLilypondOptions->fModernTab) {
+        if (gLilypondOptions ()->fModernTab) {
           fLilypondCodeIOstream <<
             "\"moderntab\"" <<
             endl <<
@@ -7169,7 +7171,7 @@ void lpsr2LilypondTranslator::visitStart (S_msrClef& elt)
 
 void lpsr2LilypondTranslator::visitEnd (S_msrClef& elt)
 {
-  if (gLpsrOptions->fTraceLpsrVisitors) {
+  if (gLpsrOptions ()->fTraceLpsrVisitors) {
     fLilypondCodeIOstream <<
       "% --> End visiting msrClef '" <<
       elt->asString () <<
@@ -7182,7 +7184,7 @@ void lpsr2LilypondTranslator::visitEnd (S_msrClef& elt)
 //________________________________________________________________________
 void lpsr2LilypondTranslator::visitStart (S_msrKey& elt)
 {
-  if (gLpsrOptions->fTraceLpsrVisitors) {
+  if (gLpsrOptions ()->fTraceLpsrVisitors) {
     fLilypondCodeIOstream <<
       "% --> Start visiting msrKey '" <<
       elt->asString () <<
@@ -7196,7 +7198,7 @@ void lpsr2LilypondTranslator::visitStart (S_msrKey& elt)
       fLilypondCodeIOstream <<
         "\\key " <<
         msrQuarterTonesPitchKindAsString (
-          gLpsrOptions->fLpsrQuarterTonesPitchesLanguageKind,
+          gLpsrOptions ()->fLpsrQuarterTonesPitchesLanguageKind,
           elt->getKeyTonicQuarterTonesPitchKind ()) <<
         " \\" <<
         msrKey::keyModeKindAsString (
@@ -7267,7 +7269,7 @@ void lpsr2LilypondTranslator::visitStart (S_msrKey& elt)
         
         else {
             msrInternalError (
-              gXml2lyOptions->fInputSourceName,
+              gXml2lyOptions ()->fInputSourceName,
               elt->getInputLineNumber (),
               __FILE__, __LINE__,
               "Humdrum/Scot key items vector is empty");
@@ -7279,7 +7281,7 @@ void lpsr2LilypondTranslator::visitStart (S_msrKey& elt)
 
 void lpsr2LilypondTranslator::visitEnd (S_msrKey& elt)
 {
-  if (gLpsrOptions->fTraceLpsrVisitors) {
+  if (gLpsrOptions ()->fTraceLpsrVisitors) {
     fLilypondCodeIOstream <<
       "% --> End visiting msrKey '" <<
       elt->asString () <<
@@ -7292,7 +7294,7 @@ void lpsr2LilypondTranslator::visitEnd (S_msrKey& elt)
 //________________________________________________________________________
 void lpsr2LilypondTranslator::visitStart (S_msrTime& elt)
 {
-  if (gLpsrOptions->fTraceLpsrVisitors) {
+  if (gLpsrOptions ()->fTraceLpsrVisitors) {
     fLilypondCodeIOstream <<
       "% --> Start visiting msrTime " <<
       elt->asString () <<
@@ -7382,7 +7384,7 @@ void lpsr2LilypondTranslator::visitStart (S_msrTime& elt)
         if (
           timeSymbolKind == msrTime::kTimeSymbolNone
             ||
-          gLilypondOptions->fNumericalTime) {
+          gLilypondOptions ()->fNumericalTime) {
           fLilypondCodeIOstream <<
             "\\numericTimeSignature ";
         }
@@ -7454,7 +7456,7 @@ void lpsr2LilypondTranslator::visitStart (S_msrTime& elt)
       // there are no time items
       if (timeSymbolKind != msrTime::kTimeSymbolSenzaMisura) {
         msrInternalError (
-          gXml2lyOptions->fInputSourceName,
+          gXml2lyOptions ()->fInputSourceName,
           elt->getInputLineNumber (),
           __FILE__, __LINE__,
           "time items vector is empty");
@@ -7465,7 +7467,7 @@ void lpsr2LilypondTranslator::visitStart (S_msrTime& elt)
 
 void lpsr2LilypondTranslator::visitEnd (S_msrTime& elt)
 {
-  if (gLpsrOptions->fTraceLpsrVisitors) {
+  if (gLpsrOptions ()->fTraceLpsrVisitors) {
     fLilypondCodeIOstream <<
       "% --> End visiting msrTime " <<
       elt->asString () <<
@@ -7477,7 +7479,7 @@ void lpsr2LilypondTranslator::visitEnd (S_msrTime& elt)
 //________________________________________________________________________
 void lpsr2LilypondTranslator::visitStart (S_msrTranspose& elt)
 {
-  if (gLpsrOptions->fTraceLpsrVisitors) {
+  if (gLpsrOptions ()->fTraceLpsrVisitors) {
     fLilypondCodeIOstream <<
       "% --> Start visiting msrTranspose" <<
       ", line " << elt->getInputLineNumber () <<
@@ -7881,7 +7883,7 @@ If the double element is present, it indicates that the music is doubled one oct
           "' is not between -12 and 12, ignored";
           
         msrMusicXMLError (
-          gXml2lyOptions->fInputSourceName,
+          gXml2lyOptions ()->fInputSourceName,
           elt->getInputLineNumber (),
           __FILE__, __LINE__,
           s.str ());
@@ -7909,7 +7911,7 @@ If the double element is present, it indicates that the music is doubled one oct
   string
     transpositionPitchKindAsString =
       msrQuarterTonesPitchKindAsString (
-        gLpsrOptions->
+        gLpsrOptions ()->
           fLpsrQuarterTonesPitchesLanguageKind,
         transpositionPitchKind);
 
@@ -7920,7 +7922,7 @@ If the double element is present, it indicates that the music is doubled one oct
 
 /* JMI
 #ifdef TRACE_OPTIONS
-  if (gTraceOptions->fTraceTranspositions) {
+  if (gTraceOptions ()->fTraceTranspositions) {
     fLilypondCodeIOstream << // JMI
       "Handlling transpose '" <<
       elt->transposeAsString () <<
@@ -7954,7 +7956,7 @@ If the double element is present, it indicates that the music is doubled one oct
 
 void lpsr2LilypondTranslator::visitEnd (S_msrTranspose& elt)
 {
-  if (gLpsrOptions->fTraceLpsrVisitors) {
+  if (gLpsrOptions ()->fTraceLpsrVisitors) {
     fLilypondCodeIOstream <<
       "% --> End visiting msrTranspose" <<
       ", line " << elt->getInputLineNumber () <<
@@ -7965,7 +7967,7 @@ void lpsr2LilypondTranslator::visitEnd (S_msrTranspose& elt)
 //________________________________________________________________________
 void lpsr2LilypondTranslator::visitStart (S_msrPartNameDisplay& elt)
 {
-  if (gLpsrOptions->fTraceLpsrVisitors) {
+  if (gLpsrOptions ()->fTraceLpsrVisitors) {
     fLilypondCodeIOstream <<
       "% --> Start visiting msrPartNameDisplay" <<
       ", line " << elt->getInputLineNumber () <<
@@ -7993,7 +7995,7 @@ void lpsr2LilypondTranslator::visitStart (S_msrPartNameDisplay& elt)
 //________________________________________________________________________
 void lpsr2LilypondTranslator::visitStart (S_msrPartAbbreviationDisplay& elt)
 {
-  if (gLpsrOptions->fTraceLpsrVisitors) {
+  if (gLpsrOptions ()->fTraceLpsrVisitors) {
     fLilypondCodeIOstream <<
       "% --> Start visiting msrPartAbbreviationDisplay" <<
       ", line " << elt->getInputLineNumber () <<
@@ -8012,7 +8014,7 @@ void lpsr2LilypondTranslator::visitStart (S_msrPartAbbreviationDisplay& elt)
 //________________________________________________________________________
 void lpsr2LilypondTranslator::visitStart (S_msrTempo& elt)
 {
-  if (gLpsrOptions->fTraceLpsrVisitors) {
+  if (gLpsrOptions ()->fTraceLpsrVisitors) {
     fLilypondCodeIOstream <<
       "% --> Start visiting msrTempo" <<
       ", line " << elt->getInputLineNumber () <<
@@ -8058,19 +8060,19 @@ void lpsr2LilypondTranslator::visitStart (S_msrTempo& elt)
             "\\markup {" <<
             endl;
     
-          gIndenter++;
+          gIndenter ()++;
     
           fLilypondCodeIOstream <<
             "\\concat {" <<
             endl;
     
-          gIndenter++;
+          gIndenter ()++;
     
           fLilypondCodeIOstream <<
             "(" <<
             endl;
             
-          gIndenter++;
+          gIndenter ()++;
   
           if (tempoWordsListSize) {
             list<S_msrWords>::const_iterator
@@ -8105,19 +8107,19 @@ void lpsr2LilypondTranslator::visitStart (S_msrTempo& elt)
             tempoPerMinute <<
             endl;
             
-          gIndenter--;
+          gIndenter ()--;
     
           fLilypondCodeIOstream <<
             ")" <<
             endl;
             
-          gIndenter--;
+          gIndenter ()--;
     
           fLilypondCodeIOstream <<
             "}" <<
             endl;
             
-          gIndenter--;
+          gIndenter ()--;
             
           fLilypondCodeIOstream <<
             "}" <<
@@ -8189,13 +8191,13 @@ void lpsr2LilypondTranslator::visitStart (S_msrTempo& elt)
         "\\markup {" <<
         endl;
 
-      gIndenter++;
+      gIndenter ()++;
 
       fLilypondCodeIOstream <<
         "\\concat {" <<
         endl;
 
-      gIndenter++;
+      gIndenter ()++;
 
       switch (tempoParenthesizedKind) {
         case msrTempo::kTempoParenthesizedYes:
@@ -8207,7 +8209,7 @@ void lpsr2LilypondTranslator::visitStart (S_msrTempo& elt)
           break;
       } // switch
         
-      gIndenter++;
+      gIndenter ()++;
       
       fLilypondCodeIOstream <<
         "\\smaller \\general-align #Y #DOWN \\note #\"" <<
@@ -8225,7 +8227,7 @@ void lpsr2LilypondTranslator::visitStart (S_msrTempo& elt)
         "\" #UP" <<
         endl;
         
-      gIndenter--;
+      gIndenter ()--;
 
       switch (tempoParenthesizedKind) {
         case msrTempo::kTempoParenthesizedYes:
@@ -8237,13 +8239,13 @@ void lpsr2LilypondTranslator::visitStart (S_msrTempo& elt)
           break;
       } // switch
         
-      gIndenter--;
+      gIndenter ()--;
 
       fLilypondCodeIOstream <<
         "}" <<
         endl;
         
-      gIndenter--;
+      gIndenter ()--;
         
       fLilypondCodeIOstream <<
         "}" <<
@@ -8295,7 +8297,7 @@ void lpsr2LilypondTranslator::visitStart (S_msrTempo& elt)
 
 void lpsr2LilypondTranslator::visitStart (S_msrTempoRelationshipElements& elt)
 {
-  if (gLpsrOptions->fTraceLpsrVisitors) {
+  if (gLpsrOptions ()->fTraceLpsrVisitors) {
     fLilypondCodeIOstream <<
       "% --> Start visiting msrTempoRelationshipElements" <<
       ", line " << elt->getInputLineNumber () <<
@@ -8306,19 +8308,19 @@ void lpsr2LilypondTranslator::visitStart (S_msrTempoRelationshipElements& elt)
     "\\fixed b' {" <<
     endl;
 
-  gIndenter++;
+  gIndenter ()++;
 }
 
 void lpsr2LilypondTranslator::visitEnd (S_msrTempoRelationshipElements& elt)
 {
-  if (gLpsrOptions->fTraceLpsrVisitors) {
+  if (gLpsrOptions ()->fTraceLpsrVisitors) {
     fLilypondCodeIOstream <<
       "% --> End visiting msrTempoRelationshipElements" <<
       ", line " << elt->getInputLineNumber () <<
       endl;
   }
 
-  gIndenter--;
+  gIndenter ()--;
 
   fLilypondCodeIOstream <<
     endl <<
@@ -8328,7 +8330,7 @@ void lpsr2LilypondTranslator::visitEnd (S_msrTempoRelationshipElements& elt)
 
 void lpsr2LilypondTranslator::visitStart (S_msrTempoNote& elt)
 {
-  if (gLpsrOptions->fTraceLpsrVisitors) {
+  if (gLpsrOptions ()->fTraceLpsrVisitors) {
     fLilypondCodeIOstream <<
       "% --> Start visiting msrTempoNote" <<
       ", line " << elt->getInputLineNumber () <<
@@ -8345,7 +8347,7 @@ void lpsr2LilypondTranslator::visitStart (S_msrTempoNote& elt)
 
 void lpsr2LilypondTranslator::visitStart (S_msrTempoTuplet& elt)
 {
-  if (gLpsrOptions->fTraceLpsrVisitors) {
+  if (gLpsrOptions ()->fTraceLpsrVisitors) {
     fLilypondCodeIOstream <<
       "% --> Start visiting msrTempoTuplet" <<
       ", line " << elt->getInputLineNumber () <<
@@ -8361,7 +8363,7 @@ void lpsr2LilypondTranslator::visitStart (S_msrTempoTuplet& elt)
 
 void lpsr2LilypondTranslator::visitEnd (S_msrTempoTuplet& elt)
 {
-  if (gLpsrOptions->fTraceLpsrVisitors) {
+  if (gLpsrOptions ()->fTraceLpsrVisitors) {
     fLilypondCodeIOstream <<
       "% --> End visiting msrTempoTuplet" <<
       ", line " << elt->getInputLineNumber () <<
@@ -8374,7 +8376,7 @@ void lpsr2LilypondTranslator::visitEnd (S_msrTempoTuplet& elt)
 
 void lpsr2LilypondTranslator::visitEnd (S_msrTempo& elt)
 {
-  if (gLpsrOptions->fTraceLpsrVisitors) {
+  if (gLpsrOptions ()->fTraceLpsrVisitors) {
     fLilypondCodeIOstream <<
       "% --> End visiting msrTempo" <<
       ", line " << elt->getInputLineNumber () <<
@@ -8385,7 +8387,7 @@ void lpsr2LilypondTranslator::visitEnd (S_msrTempo& elt)
 //________________________________________________________________________
 void lpsr2LilypondTranslator::visitStart (S_msrArticulation& elt)
 {
-  if (gLpsrOptions->fTraceLpsrVisitors) {
+  if (gLpsrOptions ()->fTraceLpsrVisitors) {
     fLilypondCodeIOstream <<
       "% --> Start visiting msrArticulation" <<
       ", line " << elt->getInputLineNumber () <<
@@ -8398,7 +8400,7 @@ void lpsr2LilypondTranslator::visitStart (S_msrArticulation& elt)
 
 void lpsr2LilypondTranslator::visitEnd (S_msrArticulation& elt)
 {
-  if (gLpsrOptions->fTraceLpsrVisitors) {
+  if (gLpsrOptions ()->fTraceLpsrVisitors) {
     fLilypondCodeIOstream <<
       "% --> End visiting msrArticulation" <<
       ", line " << elt->getInputLineNumber () <<
@@ -8409,7 +8411,7 @@ void lpsr2LilypondTranslator::visitEnd (S_msrArticulation& elt)
 //________________________________________________________________________
 void lpsr2LilypondTranslator::visitStart (S_msrFermata& elt)
 {
-  if (gLpsrOptions->fTraceLpsrVisitors) {
+  if (gLpsrOptions ()->fTraceLpsrVisitors) {
     fLilypondCodeIOstream <<
       "% --> Start visiting msrFermata" <<
       ", line " << elt->getInputLineNumber () <<
@@ -8464,7 +8466,7 @@ Articulations can be attached to rests as well as notes but they cannot be attac
 
 void lpsr2LilypondTranslator::visitEnd (S_msrFermata& elt)
 {
-  if (gLpsrOptions->fTraceLpsrVisitors) {
+  if (gLpsrOptions ()->fTraceLpsrVisitors) {
     fLilypondCodeIOstream <<
       "% --> End visiting msrFermata" <<
       ", line " << elt->getInputLineNumber () <<
@@ -8475,7 +8477,7 @@ void lpsr2LilypondTranslator::visitEnd (S_msrFermata& elt)
 //________________________________________________________________________
 void lpsr2LilypondTranslator::visitStart (S_msrArpeggiato& elt)
 {
-  if (gLpsrOptions->fTraceLpsrVisitors) {
+  if (gLpsrOptions ()->fTraceLpsrVisitors) {
     fLilypondCodeIOstream <<
       "% --> Start visiting msrArpeggiato" <<
       ", line " << elt->getInputLineNumber () <<
@@ -8488,7 +8490,7 @@ void lpsr2LilypondTranslator::visitStart (S_msrArpeggiato& elt)
 
 void lpsr2LilypondTranslator::visitEnd (S_msrArpeggiato& elt)
 {
-  if (gLpsrOptions->fTraceLpsrVisitors) {
+  if (gLpsrOptions ()->fTraceLpsrVisitors) {
     fLilypondCodeIOstream <<
       "% --> End visiting msrArpeggiato" <<
       ", line " << elt->getInputLineNumber () <<
@@ -8499,7 +8501,7 @@ void lpsr2LilypondTranslator::visitEnd (S_msrArpeggiato& elt)
 //________________________________________________________________________
 void lpsr2LilypondTranslator::visitStart (S_msrNonArpeggiato& elt)
 {
-  if (gLpsrOptions->fTraceLpsrVisitors) {
+  if (gLpsrOptions ()->fTraceLpsrVisitors) {
     fLilypondCodeIOstream <<
       "% --> Start visiting msrNonArpeggiato" <<
       ", line " << elt->getInputLineNumber () <<
@@ -8512,7 +8514,7 @@ void lpsr2LilypondTranslator::visitStart (S_msrNonArpeggiato& elt)
 
 void lpsr2LilypondTranslator::visitEnd (S_msrNonArpeggiato& elt)
 {
-  if (gLpsrOptions->fTraceLpsrVisitors) {
+  if (gLpsrOptions ()->fTraceLpsrVisitors) {
     fLilypondCodeIOstream <<
       "% --> End visiting msrNonArpeggiato" <<
       ", line " << elt->getInputLineNumber () <<
@@ -8523,7 +8525,7 @@ void lpsr2LilypondTranslator::visitEnd (S_msrNonArpeggiato& elt)
 //________________________________________________________________________
 void lpsr2LilypondTranslator::visitStart (S_msrTechnical& elt)
 {
-  if (gLpsrOptions->fTraceLpsrVisitors) {
+  if (gLpsrOptions ()->fTraceLpsrVisitors) {
     fLilypondCodeIOstream <<
       "% --> Start visiting msrTechnical" <<
       ", line " << elt->getInputLineNumber () <<
@@ -8536,7 +8538,7 @@ void lpsr2LilypondTranslator::visitStart (S_msrTechnical& elt)
 
 void lpsr2LilypondTranslator::visitEnd (S_msrTechnical& elt)
 {
-  if (gLpsrOptions->fTraceLpsrVisitors) {
+  if (gLpsrOptions ()->fTraceLpsrVisitors) {
     fLilypondCodeIOstream <<
       "% --> End visiting msrTechnical" <<
       ", line " << elt->getInputLineNumber () <<
@@ -8547,7 +8549,7 @@ void lpsr2LilypondTranslator::visitEnd (S_msrTechnical& elt)
 //________________________________________________________________________
 void lpsr2LilypondTranslator::visitStart (S_msrTechnicalWithInteger& elt)
 {
-  if (gLpsrOptions->fTraceLpsrVisitors) {
+  if (gLpsrOptions ()->fTraceLpsrVisitors) {
     fLilypondCodeIOstream <<
       "% --> Start visiting msrTechnicalWithInteger" <<
       ", fOnGoingChord = " <<
@@ -8562,7 +8564,7 @@ void lpsr2LilypondTranslator::visitStart (S_msrTechnicalWithInteger& elt)
 
 void lpsr2LilypondTranslator::visitEnd (S_msrTechnicalWithInteger& elt)
 {
-  if (gLpsrOptions->fTraceLpsrVisitors) {
+  if (gLpsrOptions ()->fTraceLpsrVisitors) {
     fLilypondCodeIOstream <<
       "% --> End visiting msrTechnicalWithInteger" <<
       ", line " << elt->getInputLineNumber () <<
@@ -8573,7 +8575,7 @@ void lpsr2LilypondTranslator::visitEnd (S_msrTechnicalWithInteger& elt)
 //________________________________________________________________________
 void lpsr2LilypondTranslator::visitStart (S_msrTechnicalWithFloat& elt)
 {
-  if (gLpsrOptions->fTraceLpsrVisitors) {
+  if (gLpsrOptions ()->fTraceLpsrVisitors) {
     fLilypondCodeIOstream <<
       "% --> Start visiting msrTechnicalWithFloat" <<
       ", fOnGoingChord = " <<
@@ -8588,7 +8590,7 @@ void lpsr2LilypondTranslator::visitStart (S_msrTechnicalWithFloat& elt)
 
 void lpsr2LilypondTranslator::visitEnd (S_msrTechnicalWithFloat& elt)
 {
-  if (gLpsrOptions->fTraceLpsrVisitors) {
+  if (gLpsrOptions ()->fTraceLpsrVisitors) {
     fLilypondCodeIOstream <<
       "% --> End visiting msrTechnicalWithFloat" <<
       ", line " << elt->getInputLineNumber () <<
@@ -8599,7 +8601,7 @@ void lpsr2LilypondTranslator::visitEnd (S_msrTechnicalWithFloat& elt)
 //________________________________________________________________________
 void lpsr2LilypondTranslator::visitStart (S_msrTechnicalWithString& elt)
 {
-  if (gLpsrOptions->fTraceLpsrVisitors) {
+  if (gLpsrOptions ()->fTraceLpsrVisitors) {
     fLilypondCodeIOstream <<
       "% --> Start visiting msrTechnicalWithString" <<
       ", line " << elt->getInputLineNumber () <<
@@ -8612,7 +8614,7 @@ void lpsr2LilypondTranslator::visitStart (S_msrTechnicalWithString& elt)
 
 void lpsr2LilypondTranslator::visitEnd (S_msrTechnicalWithString& elt)
 {
-  if (gLpsrOptions->fTraceLpsrVisitors) {
+  if (gLpsrOptions ()->fTraceLpsrVisitors) {
     fLilypondCodeIOstream <<
       "% --> End visiting msrTechnicalWithString" <<
       ", line " << elt->getInputLineNumber () <<
@@ -8623,7 +8625,7 @@ void lpsr2LilypondTranslator::visitEnd (S_msrTechnicalWithString& elt)
 //________________________________________________________________________
 void lpsr2LilypondTranslator::visitStart (S_msrOrnament& elt)
 {
-  if (gLpsrOptions->fTraceLpsrVisitors) {
+  if (gLpsrOptions ()->fTraceLpsrVisitors) {
     fLilypondCodeIOstream <<
       "% --> Start visiting msrOrnament" <<
       ", line " << elt->getInputLineNumber () <<
@@ -8636,7 +8638,7 @@ void lpsr2LilypondTranslator::visitStart (S_msrOrnament& elt)
 
 void lpsr2LilypondTranslator::visitEnd (S_msrOrnament& elt)
 {
-  if (gLpsrOptions->fTraceLpsrVisitors) {
+  if (gLpsrOptions ()->fTraceLpsrVisitors) {
     fLilypondCodeIOstream <<
       "% --> End visiting msrOrnament" <<
       ", line " << elt->getInputLineNumber () <<
@@ -8647,7 +8649,7 @@ void lpsr2LilypondTranslator::visitEnd (S_msrOrnament& elt)
 //________________________________________________________________________
 void lpsr2LilypondTranslator::visitStart (S_msrGlissando& elt)
 {
-  if (gLpsrOptions->fTraceLpsrVisitors) {
+  if (gLpsrOptions ()->fTraceLpsrVisitors) {
     fLilypondCodeIOstream <<
       "% --> Start visiting msrGlissando" <<
       ", line " << elt->getInputLineNumber () <<
@@ -8660,7 +8662,7 @@ void lpsr2LilypondTranslator::visitStart (S_msrGlissando& elt)
 
 void lpsr2LilypondTranslator::visitEnd (S_msrGlissando& elt)
 {
-  if (gLpsrOptions->fTraceLpsrVisitors) {
+  if (gLpsrOptions ()->fTraceLpsrVisitors) {
     fLilypondCodeIOstream <<
       "% --> End visiting msrGlissando" <<
       ", line " << elt->getInputLineNumber () <<
@@ -8671,7 +8673,7 @@ void lpsr2LilypondTranslator::visitEnd (S_msrGlissando& elt)
 //________________________________________________________________________
 void lpsr2LilypondTranslator::visitStart (S_msrSlide& elt)
 {
-  if (gLpsrOptions->fTraceLpsrVisitors) {
+  if (gLpsrOptions ()->fTraceLpsrVisitors) {
     fLilypondCodeIOstream <<
       "% --> Start visiting msrSlide" <<
       ", line " << elt->getInputLineNumber () <<
@@ -8684,7 +8686,7 @@ void lpsr2LilypondTranslator::visitStart (S_msrSlide& elt)
 
 void lpsr2LilypondTranslator::visitEnd (S_msrSlide& elt)
 {
-  if (gLpsrOptions->fTraceLpsrVisitors) {
+  if (gLpsrOptions ()->fTraceLpsrVisitors) {
     fLilypondCodeIOstream <<
       "% --> End visiting msrSlide" <<
       ", line " << elt->getInputLineNumber () <<
@@ -8695,7 +8697,7 @@ void lpsr2LilypondTranslator::visitEnd (S_msrSlide& elt)
 //________________________________________________________________________
 void lpsr2LilypondTranslator::visitStart (S_msrSingleTremolo& elt)
 {
-  if (gLpsrOptions->fTraceLpsrVisitors) {
+  if (gLpsrOptions ()->fTraceLpsrVisitors) {
     fLilypondCodeIOstream <<
       "% --> Start visiting msrSingleTremolo" <<
       ", line " << elt->getInputLineNumber () <<
@@ -8708,7 +8710,7 @@ void lpsr2LilypondTranslator::visitStart (S_msrSingleTremolo& elt)
 
 void lpsr2LilypondTranslator::visitEnd (S_msrSingleTremolo& elt)
 {
-  if (gLpsrOptions->fTraceLpsrVisitors) {
+  if (gLpsrOptions ()->fTraceLpsrVisitors) {
     fLilypondCodeIOstream <<
       "% --> End visiting msrSingleTremolo" <<
       ", line " << elt->getInputLineNumber () <<
@@ -8719,7 +8721,7 @@ void lpsr2LilypondTranslator::visitEnd (S_msrSingleTremolo& elt)
 //________________________________________________________________________
 void lpsr2LilypondTranslator::visitStart (S_msrDoubleTremolo& elt)
 {
-  if (gLpsrOptions->fTraceLpsrVisitors) {
+  if (gLpsrOptions ()->fTraceLpsrVisitors) {
     fLilypondCodeIOstream <<
       "% --> Start visiting msrDoubleTremolo" <<
       ", line " << elt->getInputLineNumber () <<
@@ -8731,12 +8733,12 @@ void lpsr2LilypondTranslator::visitStart (S_msrDoubleTremolo& elt)
     elt->getDoubleTremoloNumberOfRepeats ();
 
 #ifdef TRACE_OPTIONS
-  if (gTraceOptions->fTraceTremolos) {
+  if (gTraceOptions ()->fTraceTremolos) {
     fLilypondCodeIOstream <<
       "% visitStart (S_msrDoubleTremolo&)" <<
       endl;
 
-    gIndenter++;
+    gIndenter ()++;
     
     fLilypondCodeIOstream <<
       "% doubleTremoloSoundingWholeNotes = " <<
@@ -8755,26 +8757,26 @@ void lpsr2LilypondTranslator::visitStart (S_msrDoubleTremolo& elt)
       numberOfRepeats <<
       endl;
 
-    gIndenter++;
+    gIndenter ()++;
   }
 #endif
   
   fLilypondCodeIOstream <<
     "\\repeat tremolo " << numberOfRepeats << " {";
 
-  gIndenter++;
+  gIndenter ()++;
 }
 
 void lpsr2LilypondTranslator::visitEnd (S_msrDoubleTremolo& elt)
 {
-  if (gLpsrOptions->fTraceLpsrVisitors) {
+  if (gLpsrOptions ()->fTraceLpsrVisitors) {
     fLilypondCodeIOstream <<
       "% --> End visiting msrDoubleTremolo" <<
       ", line " << elt->getInputLineNumber () <<
       endl;
   }
 
-  gIndenter--;
+  gIndenter ()--;
   
   fLilypondCodeIOstream <<
     "}" <<
@@ -8784,7 +8786,7 @@ void lpsr2LilypondTranslator::visitEnd (S_msrDoubleTremolo& elt)
 //________________________________________________________________________
 void lpsr2LilypondTranslator::visitStart (S_msrDynamics& elt)
 {
-  if (gLpsrOptions->fTraceLpsrVisitors) {
+  if (gLpsrOptions ()->fTraceLpsrVisitors) {
     fLilypondCodeIOstream <<
       "% --> Start visiting msrDynamics" <<
       ", line " << elt->getInputLineNumber () <<
@@ -8794,7 +8796,7 @@ void lpsr2LilypondTranslator::visitStart (S_msrDynamics& elt)
 
 void lpsr2LilypondTranslator::visitEnd (S_msrDynamics& elt)
 {
-  if (gLpsrOptions->fTraceLpsrVisitors) {
+  if (gLpsrOptions ()->fTraceLpsrVisitors) {
     fLilypondCodeIOstream <<
       "% --> End visiting msrDynamics" <<
       ", line " << elt->getInputLineNumber () <<
@@ -8805,7 +8807,7 @@ void lpsr2LilypondTranslator::visitEnd (S_msrDynamics& elt)
 //________________________________________________________________________
 void lpsr2LilypondTranslator::visitStart (S_msrOtherDynamics& elt)
 {
-  if (gLpsrOptions->fTraceLpsrVisitors) {
+  if (gLpsrOptions ()->fTraceLpsrVisitors) {
     fLilypondCodeIOstream <<
       "% --> Start visiting msrOtherDynamics" <<
       ", line " << elt->getInputLineNumber () <<
@@ -8815,7 +8817,7 @@ void lpsr2LilypondTranslator::visitStart (S_msrOtherDynamics& elt)
 
 void lpsr2LilypondTranslator::visitEnd (S_msrOtherDynamics& elt)
 {
-  if (gLpsrOptions->fTraceLpsrVisitors) {
+  if (gLpsrOptions ()->fTraceLpsrVisitors) {
     fLilypondCodeIOstream <<
       "% --> End visiting msrOtherDynamics" <<
       ", line " << elt->getInputLineNumber () <<
@@ -8826,7 +8828,7 @@ void lpsr2LilypondTranslator::visitEnd (S_msrOtherDynamics& elt)
 //________________________________________________________________________
 void lpsr2LilypondTranslator::visitStart (S_msrWords& elt)
 {
-  if (gLpsrOptions->fTraceLpsrVisitors) {
+  if (gLpsrOptions ()->fTraceLpsrVisitors) {
     fLilypondCodeIOstream <<
       "% --> Start visiting msrWords" <<
       ", line " << elt->getInputLineNumber () <<
@@ -8836,7 +8838,7 @@ void lpsr2LilypondTranslator::visitStart (S_msrWords& elt)
 
 void lpsr2LilypondTranslator::visitEnd (S_msrWords& elt)
 {
-  if (gLpsrOptions->fTraceLpsrVisitors) {
+  if (gLpsrOptions ()->fTraceLpsrVisitors) {
     fLilypondCodeIOstream <<
       "% --> End visiting msrWords" <<
       ", line " << elt->getInputLineNumber () <<
@@ -8847,7 +8849,7 @@ void lpsr2LilypondTranslator::visitEnd (S_msrWords& elt)
 //________________________________________________________________________
 void lpsr2LilypondTranslator::visitStart (S_msrSlur& elt)
 {
-  if (gLpsrOptions->fTraceLpsrVisitors) {
+  if (gLpsrOptions ()->fTraceLpsrVisitors) {
     fLilypondCodeIOstream <<
       "% --> Start visiting msrSlur" <<
       ", line " << elt->getInputLineNumber () <<
@@ -8857,7 +8859,7 @@ void lpsr2LilypondTranslator::visitStart (S_msrSlur& elt)
 
 void lpsr2LilypondTranslator::visitEnd (S_msrSlur& elt)
 {
-  if (gLpsrOptions->fTraceLpsrVisitors) {
+  if (gLpsrOptions ()->fTraceLpsrVisitors) {
     fLilypondCodeIOstream <<
       "% --> End visiting msrSlur" <<
       ", line " << elt->getInputLineNumber () <<
@@ -8868,7 +8870,7 @@ void lpsr2LilypondTranslator::visitEnd (S_msrSlur& elt)
 //________________________________________________________________________
 void lpsr2LilypondTranslator::visitStart (S_msrLigature& elt)
 {
-  if (gLpsrOptions->fTraceLpsrVisitors) {
+  if (gLpsrOptions ()->fTraceLpsrVisitors) {
     fLilypondCodeIOstream <<
       "% --> Start visiting msrLigature" <<
       ", line " << elt->getInputLineNumber () <<
@@ -8878,7 +8880,7 @@ void lpsr2LilypondTranslator::visitStart (S_msrLigature& elt)
 
 void lpsr2LilypondTranslator::visitEnd (S_msrLigature& elt)
 {
-  if (gLpsrOptions->fTraceLpsrVisitors) {
+  if (gLpsrOptions ()->fTraceLpsrVisitors) {
     fLilypondCodeIOstream <<
       "% --> End visiting msrLigature" <<
       ", line " << elt->getInputLineNumber () <<
@@ -8889,7 +8891,7 @@ void lpsr2LilypondTranslator::visitEnd (S_msrLigature& elt)
 //________________________________________________________________________
 void lpsr2LilypondTranslator::visitStart (S_msrWedge& elt)
 {
-  if (gLpsrOptions->fTraceLpsrVisitors) {
+  if (gLpsrOptions ()->fTraceLpsrVisitors) {
     fLilypondCodeIOstream <<
       "% --> Start visiting msrWedge" <<
       ", line " << elt->getInputLineNumber () <<
@@ -8899,7 +8901,7 @@ void lpsr2LilypondTranslator::visitStart (S_msrWedge& elt)
 
 void lpsr2LilypondTranslator::visitEnd (S_msrWedge& elt)
 {
-  if (gLpsrOptions->fTraceLpsrVisitors) {
+  if (gLpsrOptions ()->fTraceLpsrVisitors) {
     fLilypondCodeIOstream <<
       "% --> End visiting msrWedge" <<
       ", line " << elt->getInputLineNumber () <<
@@ -9089,7 +9091,7 @@ void lpsr2LilypondTranslator::generateGraceNotesGroup (
           ", line " << graceNotesGroup->getInputLineNumber ();
           
         msrInternalError (
-          gXml2lyOptions->fInputSourceName,
+          gXml2lyOptions ()->fInputSourceName,
           graceNotesGroup->getInputLineNumber (),
           __FILE__, __LINE__,
           s.str ());
@@ -9113,7 +9115,7 @@ void lpsr2LilypondTranslator::generateGraceNotesGroup (
       ", line " << graceNotesGroup->getInputLineNumber ();
       
     msrInternalError (
-      gXml2lyOptions->fInputSourceName,
+      gXml2lyOptions ()->fInputSourceName,
       graceNotesGroup->getInputLineNumber (),
       __FILE__, __LINE__,
       s.str ());
@@ -9127,7 +9129,7 @@ void lpsr2LilypondTranslator::generateGraceNotesGroup (
 //________________________________________________________________________
 void lpsr2LilypondTranslator::visitStart (S_msrGraceNotesGroup& elt)
 {
-  if (gLpsrOptions->fTraceLpsrVisitors) {
+  if (gLpsrOptions ()->fTraceLpsrVisitors) {
     fLilypondCodeIOstream <<
       "% --> Start visiting msrGraceNotesGroup" <<
       ", line " << elt->getInputLineNumber () <<
@@ -9139,7 +9141,7 @@ void lpsr2LilypondTranslator::visitStart (S_msrGraceNotesGroup& elt)
 
 void lpsr2LilypondTranslator::visitEnd (S_msrGraceNotesGroup& elt)
 {
-  if (gLpsrOptions->fTraceLpsrVisitors) {
+  if (gLpsrOptions ()->fTraceLpsrVisitors) {
     fLilypondCodeIOstream <<
       "% --> End visiting msrGraceNotesGroup" <<
       ", line " << elt->getInputLineNumber () <<
@@ -9152,7 +9154,7 @@ void lpsr2LilypondTranslator::visitEnd (S_msrGraceNotesGroup& elt)
 //________________________________________________________________________
 void lpsr2LilypondTranslator::visitStart (S_msrAfterGraceNotesGroup& elt)
 {
-  if (gLpsrOptions->fTraceLpsrVisitors) {
+  if (gLpsrOptions ()->fTraceLpsrVisitors) {
     fLilypondCodeIOstream <<
       "% --> Start visiting msrAfterGraceNotesGroup" <<
       ", line " << elt->getInputLineNumber () <<
@@ -9166,7 +9168,7 @@ void lpsr2LilypondTranslator::visitStart (S_msrAfterGraceNotesGroup& elt)
 
 void lpsr2LilypondTranslator::visitStart (S_msrAfterGraceNotesGroupContents& elt)
 {
-  if (gLpsrOptions->fTraceLpsrVisitors) {
+  if (gLpsrOptions ()->fTraceLpsrVisitors) {
     fLilypondCodeIOstream <<
       "% --> Start visiting msrAfterGraceNotesGroupContents" <<
       ", line " << elt->getInputLineNumber () <<
@@ -9184,7 +9186,7 @@ void lpsr2LilypondTranslator::visitStart (S_msrAfterGraceNotesGroupContents& elt
 
 void lpsr2LilypondTranslator::visitEnd (S_msrAfterGraceNotesGroupContents& elt)
 {
-  if (gLpsrOptions->fTraceLpsrVisitors) {
+  if (gLpsrOptions ()->fTraceLpsrVisitors) {
     fLilypondCodeIOstream <<
       "% --> End visiting msrAfterGraceNotesGroupContents" <<
       ", line " << elt->getInputLineNumber () <<
@@ -9197,7 +9199,7 @@ void lpsr2LilypondTranslator::visitEnd (S_msrAfterGraceNotesGroupContents& elt)
 
 void lpsr2LilypondTranslator::visitEnd (S_msrAfterGraceNotesGroup& elt)
 {
-  if (gLpsrOptions->fTraceLpsrVisitors) {
+  if (gLpsrOptions ()->fTraceLpsrVisitors) {
     fLilypondCodeIOstream <<
       "% --> End visiting msrAfterGraceNotesGroup" <<
       ", line " << elt->getInputLineNumber () <<
@@ -9208,7 +9210,7 @@ void lpsr2LilypondTranslator::visitEnd (S_msrAfterGraceNotesGroup& elt)
 //________________________________________________________________________
 void lpsr2LilypondTranslator::visitStart (S_msrNote& elt)
 {
-  if (gLpsrOptions->fTraceLpsrVisitors) {
+  if (gLpsrOptions ()->fTraceLpsrVisitors) {
     fLilypondCodeIOstream <<
       "% --> Start visiting " <<
       msrNote::noteKindAsString (elt->getNoteKind ()) <<
@@ -9231,17 +9233,17 @@ void lpsr2LilypondTranslator::visitStart (S_msrNote& elt)
         
           if (inhibitMultipleRestMeasuresBrowsing) {
             if (
-              gMsrOptions->fTraceMsrVisitors
+              gMsrOptions ()->fTraceMsrVisitors
                 ||
-              gTraceOptions->fTraceRepeats) {
-              gLogIOstream <<
+              gTraceOptions ()->fTraceRepeats) {
+              gLogIOstream () <<
                 "% ==> visiting multiple rest measure is ignored" <<
                 endl;
             }
 
 #ifdef TRACE_OPTIONS
-  if (gTraceOptions->fTraceNotesDetails) {
-    gLogIOstream <<
+  if (gTraceOptions ()->fTraceNotesDetails) {
+    gLogIOstream () <<
       "% ==> returning from visitStart (S_msrNote&)" <<
     endl;
   }
@@ -9254,11 +9256,11 @@ void lpsr2LilypondTranslator::visitStart (S_msrNote& elt)
 
 #ifdef TRACE_OPTIONS
         if (
-          gMsrOptions->fTraceMsrVisitors
+          gMsrOptions ()->fTraceMsrVisitors
             ||
-          gTraceOptions->fTraceRepeats
+          gTraceOptions ()->fTraceRepeats
         ) {
-          gLogIOstream <<
+          gLogIOstream () <<
             "% ==> start visiting multiple rest measure is ignored" <<
             endl;
         }
@@ -9272,11 +9274,11 @@ void lpsr2LilypondTranslator::visitStart (S_msrNote& elt)
       if (elt->getNoteGraceNotesGroupUplink ()) {
 #ifdef TRACE_OPTIONS
         if (
-          gMsrOptions->fTraceMsrVisitors
+          gMsrOptions ()->fTraceMsrVisitors
             ||
-          gTraceOptions->fTraceNotes
+          gTraceOptions ()->fTraceNotes
         ) {
-          gLogIOstream <<
+          gLogIOstream () <<
             "% ==> start visiting skip notes is ignored" <<
             endl;
         }
@@ -9289,11 +9291,11 @@ void lpsr2LilypondTranslator::visitStart (S_msrNote& elt)
     case msrNote::kGraceNote:
 #ifdef TRACE_OPTIONS
         if (
-          gMsrOptions->fTraceMsrVisitors
+          gMsrOptions ()->fTraceMsrVisitors
             ||
-          gTraceOptions->fTraceGraceNotes
+          gTraceOptions ()->fTraceGraceNotes
         ) {
-          gLogIOstream <<
+          gLogIOstream () <<
             "% ==> start visiting grace notes is ignored" <<
             endl;
         }
@@ -9305,11 +9307,11 @@ void lpsr2LilypondTranslator::visitStart (S_msrNote& elt)
     case msrNote::kGraceChordMemberNote:
 #ifdef TRACE_OPTIONS
         if (
-          gMsrOptions->fTraceMsrVisitors
+          gMsrOptions ()->fTraceMsrVisitors
             ||
-          gTraceOptions->fTraceGraceNotes
+          gTraceOptions ()->fTraceGraceNotes
         ) {
-          gLogIOstream <<
+          gLogIOstream () <<
             "% ==> start visiting chord grace notes is ignored" <<
             endl;
         }
@@ -9354,7 +9356,7 @@ void lpsr2LilypondTranslator::visitStart (S_msrNote& elt)
       "<<" <<
       endl;
 
-    gIndenter++;
+    gIndenter ()++;
 
     list<S_msrScordatura>::const_iterator
       iBegin = noteScordaturas.begin (),
@@ -9369,7 +9371,7 @@ void lpsr2LilypondTranslator::visitStart (S_msrNote& elt)
           scordatura->
             getScordaturaStringTuningsList ();
       
-      gIndenter++;
+      gIndenter ()++;
         
       fLilypondCodeIOstream <<
         "\\new Staff \\with { alignAboveContext = \"" <<
@@ -9381,7 +9383,7 @@ void lpsr2LilypondTranslator::visitStart (S_msrNote& elt)
         "\" } {" <<
         endl;
     
-      gIndenter++;
+      gIndenter ()++;
     
       fLilypondCodeIOstream <<
         "\\hide Staff.Stem" <<
@@ -9420,19 +9422,19 @@ void lpsr2LilypondTranslator::visitStart (S_msrNote& elt)
         ">4" <<
         endl;
         
-      gIndenter--;
+      gIndenter ()--;
       
       fLilypondCodeIOstream <<
         "}" <<
         endl;
     
-      gIndenter--;
+      gIndenter ()--;
 
       fLilypondCodeIOstream <<
         "{" <<
         endl;
 
-      gIndenter++;
+      gIndenter ()++;
       
       if (++i == iEnd) break;
     } // for
@@ -10021,7 +10023,7 @@ void lpsr2LilypondTranslator::visitStart (S_msrNote& elt)
 
   generateNote (elt);
 
-  if (gLilypondOptions->fNoteInputLineNumbers) {
+  if (gLilypondOptions ()->fNoteInputLineNumbers) {
     // print the note line number as a comment
     fLilypondCodeIOstream <<
       "%{ " << elt->getInputLineNumber () << " %} " <<
@@ -10033,7 +10035,7 @@ void lpsr2LilypondTranslator::visitStart (S_msrNote& elt)
 
 void lpsr2LilypondTranslator::visitEnd (S_msrNote& elt)
 {
-  if (gLpsrOptions->fTraceLpsrVisitors) {
+  if (gLpsrOptions ()->fTraceLpsrVisitors) {
     fLilypondCodeIOstream <<
       "% --> End visiting " <<
       msrNote::noteKindAsString (elt->getNoteKind ()) <<
@@ -10056,19 +10058,19 @@ void lpsr2LilypondTranslator::visitEnd (S_msrNote& elt)
           if (inhibitMultipleRestMeasuresBrowsing) {
 #ifdef TRACE_OPTIONS
             if (
-              gTraceOptions->fTraceNotes
+              gTraceOptions ()->fTraceNotes
                 ||
-              gTraceOptions->fTraceRepeats
+              gTraceOptions ()->fTraceRepeats
             ) {
-              gLogIOstream <<
+              gLogIOstream () <<
                 "% ==> end visiting multiple rest measure is ignored" <<
                 endl;
             }
 #endif
   
 #ifdef TRACE_OPTIONS
-  if (gTraceOptions->fTraceNotesDetails) {
-    gLogIOstream <<
+  if (gTraceOptions ()->fTraceNotesDetails) {
+    gLogIOstream () <<
       "% ==> returning from visitEnd (S_msrNote&)" <<
       endl;
   }
@@ -10084,11 +10086,11 @@ void lpsr2LilypondTranslator::visitEnd (S_msrNote& elt)
       if (elt->getNoteGraceNotesGroupUplink ()) {
 #ifdef TRACE_OPTIONS
         if (
-          gMsrOptions->fTraceMsrVisitors
+          gMsrOptions ()->fTraceMsrVisitors
             ||
-          gTraceOptions->fTraceNotes
+          gTraceOptions ()->fTraceNotes
         ) {
-          gLogIOstream <<
+          gLogIOstream () <<
             "% ==> end visiting skip notes is ignored" <<
             endl;
         }
@@ -10101,10 +10103,10 @@ void lpsr2LilypondTranslator::visitEnd (S_msrNote& elt)
     case msrNote::kGraceNote:
 #ifdef TRACE_OPTIONS
         if (
-          gMsrOptions->fTraceMsrVisitors
+          gMsrOptions ()->fTraceMsrVisitors
             ||
-          gTraceOptions->fTraceGraceNotes) {
-          gLogIOstream <<
+          gTraceOptions ()->fTraceGraceNotes) {
+          gLogIOstream () <<
             "% ==> end visiting grace notes is ignored" <<
             endl;
         }
@@ -10319,7 +10321,7 @@ void lpsr2LilypondTranslator::visitEnd (S_msrNote& elt)
                 ", line " << articulation->getInputLineNumber ();
                 
               msrInternalError (
-                gXml2lyOptions->fInputSourceName,
+                gXml2lyOptions ()->fInputSourceName,
                 articulation->getInputLineNumber (),
                 __FILE__, __LINE__,
                 s.str ());
@@ -10708,7 +10710,7 @@ void lpsr2LilypondTranslator::visitEnd (S_msrNote& elt)
                 ", line " << articulation->getInputLineNumber ();
                 
               msrInternalError (
-                gXml2lyOptions->fInputSourceName,
+                gXml2lyOptions ()->fInputSourceName,
                 articulation->getInputLineNumber (),
                 __FILE__, __LINE__,
                 s.str ());
@@ -10835,14 +10837,14 @@ void lpsr2LilypondTranslator::visitEnd (S_msrNote& elt)
       elt->getNoteScordaturas ();
       
   if (noteScordaturas.size ()) {
-    gIndenter--;
+    gIndenter ()--;
     
     fLilypondCodeIOstream <<
       endl <<
       "}" <<
       endl;
 
-    gIndenter--;
+    gIndenter ()--;
     
     fLilypondCodeIOstream <<
       ">>" <<
@@ -10878,7 +10880,7 @@ void lpsr2LilypondTranslator::visitEnd (S_msrNote& elt)
 //________________________________________________________________________
 void lpsr2LilypondTranslator::visitStart (S_msrOctaveShift& elt)
 {
-  if (gLpsrOptions->fTraceLpsrVisitors) {
+  if (gLpsrOptions ()->fTraceLpsrVisitors) {
     fLilypondCodeIOstream <<
       "% --> Start visiting msrOctaveShift" <<
       ", line " << elt->getInputLineNumber () <<
@@ -10888,7 +10890,7 @@ void lpsr2LilypondTranslator::visitStart (S_msrOctaveShift& elt)
 
 void lpsr2LilypondTranslator::visitEnd (S_msrOctaveShift& elt)
 {
-  if (gLpsrOptions->fTraceLpsrVisitors) {
+  if (gLpsrOptions ()->fTraceLpsrVisitors) {
     fLilypondCodeIOstream <<
       "% --> End visiting msrOctaveShift" <<
       ", line " << elt->getInputLineNumber () <<
@@ -10899,7 +10901,7 @@ void lpsr2LilypondTranslator::visitEnd (S_msrOctaveShift& elt)
 //________________________________________________________________________
 void lpsr2LilypondTranslator::visitStart (S_msrAccordionRegistration& elt)
 {
-  if (gLpsrOptions->fTraceLpsrVisitors) {
+  if (gLpsrOptions ()->fTraceLpsrVisitors) {
     fLilypondCodeIOstream <<
       "% --> Start visiting msrAccordionRegistration" <<
       ", line " << elt->getInputLineNumber () <<
@@ -10948,7 +10950,7 @@ void lpsr2LilypondTranslator::visitStart (S_msrAccordionRegistration& elt)
 
 void lpsr2LilypondTranslator::visitStart (S_msrHarpPedalsTuning& elt)
 {
-  if (gLpsrOptions->fTraceLpsrVisitors) {
+  if (gLpsrOptions ()->fTraceLpsrVisitors) {
     fLilypondCodeIOstream <<
       "% --> Start visiting msrHarpPedalsTuning" <<
       ", line " << elt->getInputLineNumber () <<
@@ -10960,7 +10962,7 @@ void lpsr2LilypondTranslator::visitStart (S_msrHarpPedalsTuning& elt)
       elt->getHarpPedalsAlterationKindsMap ();
       
   if (harpPedalsAlterationKindsMap.size ()) {
-    gIndenter++;
+    gIndenter ()++;
 
     fLilypondCodeIOstream <<
       "_\\markup { \\harp-pedal #\"" <<
@@ -10991,7 +10993,7 @@ void lpsr2LilypondTranslator::visitStart (S_msrHarpPedalsTuning& elt)
 //________________________________________________________________________
 void lpsr2LilypondTranslator::visitStart (S_msrStem& elt)
 {
-  if (gLpsrOptions->fTraceLpsrVisitors) {
+  if (gLpsrOptions ()->fTraceLpsrVisitors) {
     fLilypondCodeIOstream <<
       "% --> Start visiting msrStem" <<
       ", line " << elt->getInputLineNumber () <<
@@ -11001,7 +11003,7 @@ void lpsr2LilypondTranslator::visitStart (S_msrStem& elt)
 
 void lpsr2LilypondTranslator::visitEnd (S_msrStem& elt)
 {
-  if (gLpsrOptions->fTraceLpsrVisitors) {
+  if (gLpsrOptions ()->fTraceLpsrVisitors) {
     fLilypondCodeIOstream <<
       "% --> End visiting msrStem" <<
       ", line " << elt->getInputLineNumber () <<
@@ -11012,7 +11014,7 @@ void lpsr2LilypondTranslator::visitEnd (S_msrStem& elt)
 //________________________________________________________________________
 void lpsr2LilypondTranslator::visitStart (S_msrBeam& elt)
 {
-  if (gLpsrOptions->fTraceLpsrVisitors) {
+  if (gLpsrOptions ()->fTraceLpsrVisitors) {
     fLilypondCodeIOstream <<
       "% --> Start visiting msrBeam" <<
       ", line " << elt->getInputLineNumber () <<
@@ -11022,7 +11024,7 @@ void lpsr2LilypondTranslator::visitStart (S_msrBeam& elt)
 
 void lpsr2LilypondTranslator::visitEnd (S_msrBeam& elt)
 {
-  if (gLpsrOptions->fTraceLpsrVisitors) {
+  if (gLpsrOptions ()->fTraceLpsrVisitors) {
     fLilypondCodeIOstream <<
       "% --> End visiting msrBeam" <<
       ", line " << elt->getInputLineNumber () <<
@@ -11793,26 +11795,23 @@ void lpsr2LilypondTranslator::generateChord (S_msrChord chord)
 //________________________________________________________________________
 void lpsr2LilypondTranslator::visitStart (S_msrChord& elt)
 {
-  if (gLpsrOptions->fTraceLpsrVisitors) {
+  if (gLpsrOptions ()->fTraceLpsrVisitors) {
     fLilypondCodeIOstream <<
       "% --> Start visiting msrChord" <<
       ", line " << elt->getInputLineNumber () <<
       endl;
   }
 
-  int chordInputLineNumber =
-    elt->getInputLineNumber ();
-    
-#ifdef TRACE_OPTIONS
   if (fOnGoingGraceNotesGroup) {
+#ifdef TRACE_OPTIONS
     msrInternalWarning (
-      gXml2lyOptions->fInputSourceName,
-      chordInputLineNumber,
+      gXml2lyOptions ()->fInputSourceName,
+      elt->getInputLineNumber (),
       "% ==> Start visiting grace chords is ignored");
+#endif
 
     return;
   }
-#endif
   
   // print the chord's grace notes before if any,
   // but not ??? JMI
@@ -11821,17 +11820,17 @@ void lpsr2LilypondTranslator::visitStart (S_msrChord& elt)
       elt->getChordGraceNotesGroupBefore ();
 
 /* JMI
-  gLogIOstream <<
+  gLogIOstream () <<
     "% chordGraceNotesGroupBefore = ";
   if (chordGraceNotesGroupBefore) {
-    gLogIOstream <<
+    gLogIOstream () <<
       chordGraceNotesGroupBefore;
   }
   else {
-    gLogIOstream <<
+    gLogIOstream () <<
       "nullptr";
   }
-  gLogIOstream <<
+  gLogIOstream () <<
     endl;
 */
 
@@ -12075,7 +12074,7 @@ void lpsr2LilypondTranslator::visitStart (S_msrChord& elt)
 
 void lpsr2LilypondTranslator::visitEnd (S_msrChord& elt)
 {
-  if (gLpsrOptions->fTraceLpsrVisitors) {
+  if (gLpsrOptions ()->fTraceLpsrVisitors) {
     fLilypondCodeIOstream <<
       "% --> End visiting msrChord" <<
       ", line " << elt->getInputLineNumber () <<
@@ -12085,16 +12084,16 @@ void lpsr2LilypondTranslator::visitEnd (S_msrChord& elt)
   int chordInputLineNumber =
     elt->getInputLineNumber ();
     
-#ifdef TRACE_OPTIONS
   if (fOnGoingGraceNotesGroup) {
+#ifdef TRACE_OPTIONS
     msrInternalWarning (
-      gXml2lyOptions->fInputSourceName,
+      gXml2lyOptions ()->fInputSourceName,
       chordInputLineNumber,
       "% ==> End visiting grace chords is ignored");
+#endif
 
     return;
   }
-#endif
   
   // generate the end of the chord
   fLilypondCodeIOstream <<
@@ -12606,7 +12605,7 @@ void lpsr2LilypondTranslator::visitEnd (S_msrChord& elt)
 //________________________________________________________________________
 void lpsr2LilypondTranslator::visitStart (S_msrTuplet& elt)
 {
-  if (gLpsrOptions->fTraceLpsrVisitors) {
+  if (gLpsrOptions ()->fTraceLpsrVisitors) {
     fLilypondCodeIOstream <<
       "% --> Start visiting msrTuplet" <<
       ", line " << elt->getInputLineNumber () <<
@@ -12637,7 +12636,7 @@ void lpsr2LilypondTranslator::visitStart (S_msrTuplet& elt)
           */
   }
 
-  if (gLilypondOptions->fIndentTuplets) {
+  if (gLilypondOptions ()->fIndentTuplets) {
     fLilypondCodeIOstream <<
       endl;
   }
@@ -12756,7 +12755,7 @@ void lpsr2LilypondTranslator::visitStart (S_msrTuplet& elt)
 
   fTupletsStack.push (elt);
 
-  gIndenter++;
+  gIndenter ()++;
 
   // force durations to be displayed explicitly
   // at the beginning of the tuplet
@@ -12765,16 +12764,16 @@ void lpsr2LilypondTranslator::visitStart (S_msrTuplet& elt)
 
 void lpsr2LilypondTranslator::visitEnd (S_msrTuplet& elt)
 {
-  if (gLpsrOptions->fTraceLpsrVisitors) {
+  if (gLpsrOptions ()->fTraceLpsrVisitors) {
     fLilypondCodeIOstream <<
       "% --> End visiting msrTuplet" <<
       ", line " << elt->getInputLineNumber () <<
       endl;
   }
 
-  gIndenter--;
+  gIndenter ()--;
 
-  if (gLilypondOptions->fIndentTuplets) {
+  if (gLilypondOptions ()->fIndentTuplets) {
     fLilypondCodeIOstream <<
       endl;
   }
@@ -12804,7 +12803,7 @@ void lpsr2LilypondTranslator::visitEnd (S_msrTuplet& elt)
 //________________________________________________________________________
 void lpsr2LilypondTranslator::visitStart (S_msrTie& elt)
 {
-  if (gLpsrOptions->fTraceLpsrVisitors) {
+  if (gLpsrOptions ()->fTraceLpsrVisitors) {
     fLilypondCodeIOstream <<
       "% --> Start visiting msrTie" <<
       ", line " << elt->getInputLineNumber () <<
@@ -12826,7 +12825,7 @@ void lpsr2LilypondTranslator::visitStart (S_msrTie& elt)
 
 void lpsr2LilypondTranslator::visitEnd (S_msrTie& elt)
 {
-  if (gLpsrOptions->fTraceLpsrVisitors) {
+  if (gLpsrOptions ()->fTraceLpsrVisitors) {
     fLilypondCodeIOstream <<
       "% --> End visiting msrTie" <<
       ", line " << elt->getInputLineNumber () <<
@@ -12837,7 +12836,7 @@ void lpsr2LilypondTranslator::visitEnd (S_msrTie& elt)
 //________________________________________________________________________
 void lpsr2LilypondTranslator::visitStart (S_msrSegno& elt)
 {
-  if (gLpsrOptions->fTraceLpsrVisitors) {
+  if (gLpsrOptions ()->fTraceLpsrVisitors) {
     fLilypondCodeIOstream <<
       "% --> Start visiting msrSegno" <<
       ", line " << elt->getInputLineNumber () <<
@@ -12851,7 +12850,7 @@ void lpsr2LilypondTranslator::visitStart (S_msrSegno& elt)
 
 void lpsr2LilypondTranslator::visitStart (S_msrCoda& elt)
 {
-  if (gLpsrOptions->fTraceLpsrVisitors) {
+  if (gLpsrOptions ()->fTraceLpsrVisitors) {
     fLilypondCodeIOstream <<
       "% --> Start visiting msrCoda" <<
       ", line " << elt->getInputLineNumber () <<
@@ -12866,7 +12865,7 @@ void lpsr2LilypondTranslator::visitStart (S_msrCoda& elt)
 //________________________________________________________________________
 void lpsr2LilypondTranslator::visitStart (S_msrEyeGlasses& elt)
 {
-  if (gLpsrOptions->fTraceLpsrVisitors) {
+  if (gLpsrOptions ()->fTraceLpsrVisitors) {
     fLilypondCodeIOstream <<
       "% --> Start visiting eyeGlasses" <<
       ", line " << elt->getInputLineNumber () <<
@@ -12879,7 +12878,7 @@ void lpsr2LilypondTranslator::visitStart (S_msrEyeGlasses& elt)
 
 void lpsr2LilypondTranslator::visitStart (S_msrScordatura& elt)
 {
-  if (gLpsrOptions->fTraceLpsrVisitors) {
+  if (gLpsrOptions ()->fTraceLpsrVisitors) {
     fLilypondCodeIOstream <<
       "% --> Start visiting scordatura" <<
       ", line " << elt->getInputLineNumber () <<
@@ -12891,13 +12890,13 @@ void lpsr2LilypondTranslator::visitStart (S_msrScordatura& elt)
     scordaturaStringTuningsList =
       elt->getScordaturaStringTuningsList ();
   
-  gIndenter++;
+  gIndenter ()++;
     
   fLilypondCodeIOstream <<
     "\\new Staff {" <<
     endl;
 
-  gIndenter++;
+  gIndenter ()++;
 
   fLilypondCodeIOstream <<
     "\\hide Staff.Stem" <<
@@ -12934,13 +12933,13 @@ void lpsr2LilypondTranslator::visitStart (S_msrScordatura& elt)
     "}" <<
     endl;
 
-  gIndenter--;
+  gIndenter ()--;
   
   fLilypondCodeIOstream <<
     "{ c'4 }" <<
     endl <<
 
-  gIndenter--;
+  gIndenter ()--;
   */
 }
 
@@ -12949,7 +12948,7 @@ void lpsr2LilypondTranslator::visitStart (S_msrPedal& elt)
   int inputLineNumber =
     elt->getInputLineNumber ();
     
-  if (gLpsrOptions->fTraceLpsrVisitors) {
+  if (gLpsrOptions ()->fTraceLpsrVisitors) {
     fLilypondCodeIOstream <<
       "% --> Start visiting pedal" <<
       ", line " << inputLineNumber <<
@@ -12988,7 +12987,7 @@ void lpsr2LilypondTranslator::visitStart (S_msrPedal& elt)
           "' has no pedal type";
           
         msrInternalError (
-          gXml2lyOptions->fInputSourceName,
+          gXml2lyOptions ()->fInputSourceName,
           inputLineNumber,
           __FILE__, __LINE__,
           s.str ());
@@ -13002,7 +13001,7 @@ void lpsr2LilypondTranslator::visitStart (S_msrPedal& elt)
 
 void lpsr2LilypondTranslator::visitStart (S_msrDamp& elt)
 {
-  if (gLpsrOptions->fTraceLpsrVisitors) {
+  if (gLpsrOptions ()->fTraceLpsrVisitors) {
     fLilypondCodeIOstream <<
       "% --> Start visiting damp" <<
       ", line " << elt->getInputLineNumber () <<
@@ -13015,7 +13014,7 @@ void lpsr2LilypondTranslator::visitStart (S_msrDamp& elt)
 
 void lpsr2LilypondTranslator::visitStart (S_msrDampAll& elt)
 {
-  if (gLpsrOptions->fTraceLpsrVisitors) {
+  if (gLpsrOptions ()->fTraceLpsrVisitors) {
     fLilypondCodeIOstream <<
       "% --> Start visiting dampAll" <<
       ", line " << elt->getInputLineNumber () <<
@@ -13029,7 +13028,7 @@ void lpsr2LilypondTranslator::visitStart (S_msrDampAll& elt)
 //________________________________________________________________________
 void lpsr2LilypondTranslator::visitStart (S_msrBarline& elt)
 {
-  if (gLpsrOptions->fTraceLpsrVisitors) {
+  if (gLpsrOptions ()->fTraceLpsrVisitors) {
     fLilypondCodeIOstream <<
       endl <<
       "% --> Start visiting msrBarline" <<
@@ -13086,7 +13085,7 @@ void lpsr2LilypondTranslator::visitStart (S_msrBarline& elt)
           */
       } // switch
 
-      if (gLilypondOptions->fNoteInputLineNumbers) {
+      if (gLilypondOptions ()->fNoteInputLineNumbers) {
         // print the barline line number as a comment
         fLilypondCodeIOstream <<
           "%{ " << inputLineNumber << " %} ";
@@ -13134,7 +13133,7 @@ void lpsr2LilypondTranslator::visitStart (S_msrBarline& elt)
           
   // JMI      msrInternalError (
         msrInternalWarning (
-          gXml2lyOptions->fInputSourceName,
+          gXml2lyOptions ()->fInputSourceName,
           inputLineNumber,
   // JMI        __FILE__, __LINE__,
           s.str ());
@@ -13142,7 +13141,7 @@ void lpsr2LilypondTranslator::visitStart (S_msrBarline& elt)
       break;
   } // switch
 
-  if (gLilypondOptions->fNoteInputLineNumbers) {
+  if (gLilypondOptions ()->fNoteInputLineNumbers) {
     fLilypondCodeIOstream <<
       " %{ " << inputLineNumber << " %}";
   }
@@ -13150,7 +13149,7 @@ void lpsr2LilypondTranslator::visitStart (S_msrBarline& elt)
 
 void lpsr2LilypondTranslator::visitEnd (S_msrBarline& elt)
 {
-  if (gLpsrOptions->fTraceLpsrVisitors) {
+  if (gLpsrOptions ()->fTraceLpsrVisitors) {
     fLilypondCodeIOstream <<
       endl <<
       "% --> End visiting msrBarline" <<
@@ -13162,7 +13161,7 @@ void lpsr2LilypondTranslator::visitEnd (S_msrBarline& elt)
 //________________________________________________________________________
 void lpsr2LilypondTranslator::visitStart (S_msrBarCheck& elt)
 {
-  if (gLpsrOptions->fTraceLpsrVisitors) {
+  if (gLpsrOptions ()->fTraceLpsrVisitors) {
     fLilypondCodeIOstream <<
       "% --> Start visiting msrBarCheck" <<
       ", line " << elt->getInputLineNumber () <<
@@ -13180,7 +13179,7 @@ void lpsr2LilypondTranslator::visitStart (S_msrBarCheck& elt)
 
 void lpsr2LilypondTranslator::visitEnd (S_msrBarCheck& elt)
 {
-  if (gLpsrOptions->fTraceLpsrVisitors) {
+  if (gLpsrOptions ()->fTraceLpsrVisitors) {
     fLilypondCodeIOstream <<
       "% --> End visiting msrBarCheck" <<
       ", line " << elt->getInputLineNumber () <<
@@ -13191,7 +13190,7 @@ void lpsr2LilypondTranslator::visitEnd (S_msrBarCheck& elt)
 //________________________________________________________________________
 void lpsr2LilypondTranslator::visitStart (S_msrBarNumberCheck& elt)
 {
-  if (gLpsrOptions->fTraceLpsrVisitors) {
+  if (gLpsrOptions ()->fTraceLpsrVisitors) {
     fLilypondCodeIOstream <<
       "% --> Start visiting msrBarNumberCheck" <<
       ", line " << elt->getInputLineNumber () <<
@@ -13208,7 +13207,7 @@ void lpsr2LilypondTranslator::visitStart (S_msrBarNumberCheck& elt)
 
 void lpsr2LilypondTranslator::visitEnd (S_msrBarNumberCheck& elt)
 {
-  if (gLpsrOptions->fTraceLpsrVisitors) {
+  if (gLpsrOptions ()->fTraceLpsrVisitors) {
     fLilypondCodeIOstream <<
       "% --> End visiting msrBarNumberCheck" <<
       ", line " << elt->getInputLineNumber () <<
@@ -13219,7 +13218,7 @@ void lpsr2LilypondTranslator::visitEnd (S_msrBarNumberCheck& elt)
 //________________________________________________________________________
 void lpsr2LilypondTranslator::visitStart (S_msrLineBreak& elt)
 {
-  if (gLpsrOptions->fTraceLpsrVisitors) {
+  if (gLpsrOptions ()->fTraceLpsrVisitors) {
     fLilypondCodeIOstream <<
       "% --> Start visiting msrLineBreak" <<
       ", line " << elt->getInputLineNumber () <<
@@ -13234,7 +13233,7 @@ void lpsr2LilypondTranslator::visitStart (S_msrLineBreak& elt)
 
 void lpsr2LilypondTranslator::visitEnd (S_msrLineBreak& elt)
 {
-  if (gLpsrOptions->fTraceLpsrVisitors) {
+  if (gLpsrOptions ()->fTraceLpsrVisitors) {
     fLilypondCodeIOstream <<
       "% --> End visiting msrLineBreak" <<
       ", line " << elt->getInputLineNumber () <<
@@ -13245,7 +13244,7 @@ void lpsr2LilypondTranslator::visitEnd (S_msrLineBreak& elt)
 //________________________________________________________________________
 void lpsr2LilypondTranslator::visitStart (S_msrPageBreak& elt)
 {
-  if (gLpsrOptions->fTraceLpsrVisitors) {
+  if (gLpsrOptions ()->fTraceLpsrVisitors) {
     fLilypondCodeIOstream <<
       "% --> Start visiting msrPageBreak" <<
       ", line " << elt->getInputLineNumber () <<
@@ -13260,7 +13259,7 @@ void lpsr2LilypondTranslator::visitStart (S_msrPageBreak& elt)
 
 void lpsr2LilypondTranslator::visitEnd (S_msrPageBreak& elt)
 {
-  if (gLpsrOptions->fTraceLpsrVisitors) {
+  if (gLpsrOptions ()->fTraceLpsrVisitors) {
     fLilypondCodeIOstream <<
       "% --> End visiting msrPageBreak" <<
       ", line " << elt->getInputLineNumber () <<
@@ -13271,7 +13270,7 @@ void lpsr2LilypondTranslator::visitEnd (S_msrPageBreak& elt)
 //________________________________________________________________________
 void lpsr2LilypondTranslator::visitStart (S_msrRepeat& elt)
 {
-  if (gLpsrOptions->fTraceLpsrVisitors) {
+  if (gLpsrOptions ()->fTraceLpsrVisitors) {
     fLilypondCodeIOstream <<
       "% --> Start visiting msrRepeat" <<
       ", line " << elt->getInputLineNumber () <<
@@ -13296,12 +13295,12 @@ void lpsr2LilypondTranslator::visitStart (S_msrRepeat& elt)
     fRepeatsDescrStack.back ()->getRepeatEndingsNumber () <<
     " {";
 
-  if (gLilypondOptions->fNoteInputLineNumbers) {
+  if (gLilypondOptions ()->fNoteInputLineNumbers) {
     s <<
       " %{ " << elt->getInputLineNumber () << " %}";
   }
   
-  if (gLilypondOptions->fComments) {
+  if (gLilypondOptions ()->fComments) {
     fLilypondCodeIOstream << left <<
       setw (commentFieldWidth) <<
       s.str () << "% start of repeat";
@@ -13314,7 +13313,7 @@ void lpsr2LilypondTranslator::visitStart (S_msrRepeat& elt)
   fLilypondCodeIOstream <<
     endl;
 
-  gIndenter++;
+  gIndenter ()++;
 
   int
     repeatTimes =
@@ -13329,7 +13328,7 @@ void lpsr2LilypondTranslator::visitStart (S_msrRepeat& elt)
 
 void lpsr2LilypondTranslator::visitEnd (S_msrRepeat& elt)
 {
-  if (gLpsrOptions->fTraceLpsrVisitors) {
+  if (gLpsrOptions ()->fTraceLpsrVisitors) {
     fLilypondCodeIOstream <<
       "% --> End visiting msrRepeat" <<
       ", line " << elt->getInputLineNumber () <<
@@ -13345,9 +13344,9 @@ void lpsr2LilypondTranslator::visitEnd (S_msrRepeat& elt)
   if (! fRepeatsDescrStack.back ()->getEndOfRepeatHasBeenGenerated ()) {
     // the end of the repeat has not been generated yet
 
-    gIndenter--;
+    gIndenter ()--;
 
-    if (gLilypondOptions->fComments) {      
+    if (gLilypondOptions ()->fComments) {      
       fLilypondCodeIOstream << left <<
         setw (commentFieldWidth) <<
         "}" << "% end of repeat" <<
@@ -13368,7 +13367,7 @@ void lpsr2LilypondTranslator::visitEnd (S_msrRepeat& elt)
 //________________________________________________________________________
 void lpsr2LilypondTranslator::visitStart (S_msrRepeatCommonPart& elt)
 {
-  if (gLpsrOptions->fTraceLpsrVisitors) {
+  if (gLpsrOptions ()->fTraceLpsrVisitors) {
     fLilypondCodeIOstream <<
       "% --> Start visiting msrRepeatCommonPart" <<
       ", line " << elt->getInputLineNumber () <<
@@ -13378,7 +13377,7 @@ void lpsr2LilypondTranslator::visitStart (S_msrRepeatCommonPart& elt)
 
 void lpsr2LilypondTranslator::visitEnd (S_msrRepeatCommonPart& elt)
 {
-  if (gLpsrOptions->fTraceLpsrVisitors) {
+  if (gLpsrOptions ()->fTraceLpsrVisitors) {
     fLilypondCodeIOstream <<
       "% --> Start visiting msrRepeatCommonPart" <<
       ", line " << elt->getInputLineNumber () <<
@@ -13389,7 +13388,7 @@ void lpsr2LilypondTranslator::visitEnd (S_msrRepeatCommonPart& elt)
 //________________________________________________________________________
 void lpsr2LilypondTranslator::visitStart (S_msrRepeatEnding& elt)
 {
-  if (gLpsrOptions->fTraceLpsrVisitors) {
+  if (gLpsrOptions ()->fTraceLpsrVisitors) {
     fLilypondCodeIOstream <<
       "% --> Start visiting msrRepeatEnding" <<
       ", line " << elt->getInputLineNumber () <<
@@ -13405,11 +13404,11 @@ void lpsr2LilypondTranslator::visitStart (S_msrRepeatEnding& elt)
       
   if (repeatEndingInternalNumber == 1) {
     
-    gIndenter--;
+    gIndenter ()--;
     
     // first repeat ending is in charge of
     // outputting the end of the repeat
-    if (gLilypondOptions->fComments) {      
+    if (gLilypondOptions ()->fComments) {      
       fLilypondCodeIOstream <<
         setw (commentFieldWidth) << left <<
         "}" << "% end of repeat" <<
@@ -13426,7 +13425,7 @@ void lpsr2LilypondTranslator::visitStart (S_msrRepeatEnding& elt)
 
     // first repeat ending is in charge of
     // outputting the start of the alternative
-    if (gLilypondOptions->fComments) {      
+    if (gLilypondOptions ()->fComments) {      
       fLilypondCodeIOstream << left <<
         endl <<
         setw (commentFieldWidth) <<
@@ -13441,13 +13440,13 @@ void lpsr2LilypondTranslator::visitStart (S_msrRepeatEnding& elt)
         endl;
     }
       
-    gIndenter++;
+    gIndenter ()++;
   }
 
   // output the start of the ending
   switch (elt->getRepeatEndingKind ()) {
     case msrRepeatEnding::kHookedEnding:
-      if (gLilypondOptions->fComments) {  
+      if (gLilypondOptions ()->fComments) {  
         fLilypondCodeIOstream << left <<
           setw (commentFieldWidth) <<
           "{" << "% start of repeat hooked ending" <<
@@ -13461,7 +13460,7 @@ void lpsr2LilypondTranslator::visitStart (S_msrRepeatEnding& elt)
       break;
       
     case msrRepeatEnding::kHooklessEnding:
-      if (gLilypondOptions->fComments) {
+      if (gLilypondOptions ()->fComments) {
         fLilypondCodeIOstream << left <<
           setw (commentFieldWidth) <<
           "{" << "% start of repeat hookless ending" <<
@@ -13475,7 +13474,7 @@ void lpsr2LilypondTranslator::visitStart (S_msrRepeatEnding& elt)
       break;
   } // switch
 
-  gIndenter++;
+  gIndenter ()++;
 
   // generate the repeat ending number if any
   string
@@ -13502,14 +13501,14 @@ void lpsr2LilypondTranslator::visitStart (S_msrRepeatEnding& elt)
 
 void lpsr2LilypondTranslator::visitEnd (S_msrRepeatEnding& elt)
 {
-  if (gLpsrOptions->fTraceLpsrVisitors) {
+  if (gLpsrOptions ()->fTraceLpsrVisitors) {
     fLilypondCodeIOstream <<
       "% --> End visiting msrRepeatEnding" <<
       ", line " << elt->getInputLineNumber () <<
       endl;
   }
 
-  gIndenter--;
+  gIndenter ()--;
 
   // output the end of the ending
   fLilypondCodeIOstream <<
@@ -13517,7 +13516,7 @@ void lpsr2LilypondTranslator::visitEnd (S_msrRepeatEnding& elt)
 
   switch (elt->getRepeatEndingKind ()) {
     case msrRepeatEnding::kHookedEnding:
-      if (gLilypondOptions->fComments) {
+      if (gLilypondOptions ()->fComments) {
         fLilypondCodeIOstream << left <<
           setw (commentFieldWidth) <<
           "}" << "% end of repeat hooked ending" <<
@@ -13531,7 +13530,7 @@ void lpsr2LilypondTranslator::visitEnd (S_msrRepeatEnding& elt)
       break;
       
     case msrRepeatEnding::kHooklessEnding:
-      if (gLilypondOptions->fComments)   { 
+      if (gLilypondOptions ()->fComments)   { 
         fLilypondCodeIOstream << left <<
           setw (commentFieldWidth) <<
           "}" << "% end of repeat hookless ending" <<
@@ -13546,7 +13545,7 @@ void lpsr2LilypondTranslator::visitEnd (S_msrRepeatEnding& elt)
   } // switch
 
 #ifdef TRACE_OPTIONS
-  if (gTraceOptions->fTraceRepeats) {
+  if (gTraceOptions ()->fTraceRepeats) {
     fLilypondCodeIOstream <<
       "% ===**** fRepeatsDescrStack.back () = '" <<
       fRepeatsDescrStack.back ()->repeatDescrAsString () <<
@@ -13560,11 +13559,11 @@ void lpsr2LilypondTranslator::visitEnd (S_msrRepeatEnding& elt)
       ==
     fRepeatsDescrStack.back ()->getRepeatEndingsNumber ()) {
       
-    gIndenter--;
+    gIndenter ()--;
     
     // last repeat ending is in charge of
     // outputting the end of the alternative
-    if (gLilypondOptions->fComments)   { 
+    if (gLilypondOptions ()->fComments)   { 
       fLilypondCodeIOstream << left <<
         setw (commentFieldWidth) <<
         "}" << "% end of alternative" <<
@@ -13582,7 +13581,7 @@ void lpsr2LilypondTranslator::visitEnd (S_msrRepeatEnding& elt)
 //________________________________________________________________________
 void lpsr2LilypondTranslator::visitStart (S_lpsrComment& elt)
 {
-  if (gLpsrOptions->fTraceLpsrVisitors) {
+  if (gLpsrOptions ()->fTraceLpsrVisitors) {
     fLilypondCodeIOstream <<
       "% --> Start visiting lpsrComment" <<
       ", line " << elt->getInputLineNumber () <<
@@ -13599,7 +13598,7 @@ void lpsr2LilypondTranslator::visitStart (S_lpsrComment& elt)
 
 void lpsr2LilypondTranslator::visitEnd (S_lpsrComment& elt)
 {
-  if (gLpsrOptions->fTraceLpsrVisitors) {
+  if (gLpsrOptions ()->fTraceLpsrVisitors) {
     fLilypondCodeIOstream <<
       "% --> End visiting lpsrComment" <<
       ", line " << elt->getInputLineNumber () <<
@@ -13610,7 +13609,7 @@ void lpsr2LilypondTranslator::visitEnd (S_lpsrComment& elt)
 //________________________________________________________________________
 void lpsr2LilypondTranslator::visitStart (S_lpsrSchemeFunction& elt)
 {
-  if (gLpsrOptions->fTraceLpsrVisitors) {
+  if (gLpsrOptions ()->fTraceLpsrVisitors) {
     fLilypondCodeIOstream <<
       "% --> Start visiting lpsrSchemeFunction" <<
       ", line " << elt->getInputLineNumber () <<
@@ -13630,7 +13629,7 @@ void lpsr2LilypondTranslator::visitStart (S_lpsrSchemeFunction& elt)
 
 void lpsr2LilypondTranslator::visitEnd (S_lpsrSchemeFunction& elt)
 {
-  if (gLpsrOptions->fTraceLpsrVisitors) {
+  if (gLpsrOptions ()->fTraceLpsrVisitors) {
     fLilypondCodeIOstream <<
       "% --> End visiting lpsrSchemeFunction" <<
       ", line " << elt->getInputLineNumber () <<
@@ -13641,7 +13640,7 @@ void lpsr2LilypondTranslator::visitEnd (S_lpsrSchemeFunction& elt)
 //________________________________________________________________________
 void lpsr2LilypondTranslator::visitStart (S_msrRehearsal& elt)
 {
-  if (gLpsrOptions->fTraceLpsrVisitors) {
+  if (gLpsrOptions ()->fTraceLpsrVisitors) {
     fLilypondCodeIOstream <<
       "% --> Start visiting msrRehearsal" <<
       ", line " << elt->getInputLineNumber () <<
@@ -13706,7 +13705,7 @@ void lpsr2LilypondTranslator::visitStart (S_msrRehearsal& elt)
 
 void lpsr2LilypondTranslator::visitEnd (S_msrRehearsal& elt)
 {
-  if (gLpsrOptions->fTraceLpsrVisitors) {
+  if (gLpsrOptions ()->fTraceLpsrVisitors) {
     fLilypondCodeIOstream <<
       "% --> End visiting msrRehearsal" <<
       ", line " << elt->getInputLineNumber () <<
@@ -13717,24 +13716,24 @@ void lpsr2LilypondTranslator::visitEnd (S_msrRehearsal& elt)
 //________________________________________________________________________
 void lpsr2LilypondTranslator::visitStart (S_msrMeasuresRepeat& elt)
 {
-  if (gLpsrOptions->fTraceLpsrVisitors) {
+  if (gLpsrOptions ()->fTraceLpsrVisitors) {
     fLilypondCodeIOstream <<
       "% --> Start visiting msrMeasuresRepeat" <<
       ", line " << elt->getInputLineNumber () <<
       endl;
   }
 
-  int repeatMeasuresNumber =
-    elt->measuresRepeatPatternMeasuresNumber ();
-
-  int replicasMeasuresNumber =
-    elt->measuresRepeatReplicasMeasuresNumber ();
-    
   int replicasNumber =
     elt->measuresRepeatReplicasNumber ();
 
 #ifdef TRACE_OPTIONS
-  if (gTraceOptions->fTraceMeasures || gTraceOptions->fTraceRepeats) {
+  if (gTraceOptions ()->fTraceMeasures || gTraceOptions ()->fTraceRepeats) {
+    int repeatMeasuresNumber =
+      elt->measuresRepeatPatternMeasuresNumber ();
+
+    int replicasMeasuresNumber =
+      elt->measuresRepeatReplicasMeasuresNumber ();
+    
     fLilypondCodeIOstream <<
       "% measure repeat, line " << elt->getInputLineNumber () << ":" <<
       endl;
@@ -13754,7 +13753,7 @@ void lpsr2LilypondTranslator::visitStart (S_msrMeasuresRepeat& elt)
   }
 #endif
   
-  if (gLilypondOptions->fComments) {
+  if (gLilypondOptions ()->fComments) {
     fLilypondCodeIOstream << left <<
       setw (commentFieldWidth) <<
       "% start of measure repeat" <<
@@ -13774,19 +13773,19 @@ void lpsr2LilypondTranslator::visitStart (S_msrMeasuresRepeat& elt)
      " { " <<
     endl;
 
-    gIndenter++;
+    gIndenter ()++;
 }
 
 void lpsr2LilypondTranslator::visitEnd (S_msrMeasuresRepeat& elt)
 {
-  if (gLpsrOptions->fTraceLpsrVisitors) {
+  if (gLpsrOptions ()->fTraceLpsrVisitors) {
     fLilypondCodeIOstream <<
       "% --> Start visiting msrMeasuresRepeat" <<
       ", line " << elt->getInputLineNumber () <<
       endl;
   }
 
-  gIndenter--;
+  gIndenter ()--;
   
   fLilypondCodeIOstream <<
     endl <<
@@ -13794,7 +13793,7 @@ void lpsr2LilypondTranslator::visitEnd (S_msrMeasuresRepeat& elt)
     " }" <<
     endl;
 
-  if (gLilypondOptions->fComments) {
+  if (gLilypondOptions ()->fComments) {
     fLilypondCodeIOstream <<
       setw (commentFieldWidth) << left <<
       "% end of measure repeat" <<
@@ -13810,38 +13809,38 @@ void lpsr2LilypondTranslator::visitEnd (S_msrMeasuresRepeat& elt)
 
 void lpsr2LilypondTranslator::visitStart (S_msrMeasuresRepeatPattern& elt)
 {
-  if (gLpsrOptions->fTraceLpsrVisitors) {
+  if (gLpsrOptions ()->fTraceLpsrVisitors) {
     fLilypondCodeIOstream <<
       "%--> Start visiting msrMeasuresRepeatPattern" <<
       endl;
   }
 
-  gIndenter++;
+  gIndenter ()++;
 
   // JMI
 }
 
 void lpsr2LilypondTranslator::visitEnd (S_msrMeasuresRepeatPattern& elt)
 {
-  if (gLpsrOptions->fTraceLpsrVisitors) {
+  if (gLpsrOptions ()->fTraceLpsrVisitors) {
     fLilypondCodeIOstream <<
       "%--> End visiting msrMeasuresRepeatPattern" <<
       endl;
   }
 
-  gIndenter--;
+  gIndenter ()--;
 }
   
 void lpsr2LilypondTranslator::visitStart (S_msrMeasuresRepeatReplicas& elt)
 {
-  if (gLpsrOptions->fTraceLpsrVisitors) {
+  if (gLpsrOptions ()->fTraceLpsrVisitors) {
     fLilypondCodeIOstream <<
       "%--> Start visiting msrMeasuresRepeatReplicas" <<
       endl;
   }
 
   // output the start of the ending
-  if (gLilypondOptions->fComments) {  
+  if (gLilypondOptions ()->fComments) {  
     fLilypondCodeIOstream << left <<
       setw (commentFieldWidth) <<
       "{" << "% start of measures repeat replicas" <<
@@ -13854,24 +13853,24 @@ void lpsr2LilypondTranslator::visitStart (S_msrMeasuresRepeatReplicas& elt)
       endl;
   }
 
-  gIndenter++;
+  gIndenter ()++;
 }
 
 void lpsr2LilypondTranslator::visitEnd (S_msrMeasuresRepeatReplicas& elt)
 {
-  if (gLpsrOptions->fTraceLpsrVisitors) {
+  if (gLpsrOptions ()->fTraceLpsrVisitors) {
     fLilypondCodeIOstream <<
       "%--> End visiting msrMeasuresRepeatReplicas" <<
       endl;
   }
 
-  gIndenter--;
+  gIndenter ()--;
 }
 
 //________________________________________________________________________
 void lpsr2LilypondTranslator::visitStart (S_msrMultipleRest& elt)
 {
-  if (gLpsrOptions->fTraceLpsrVisitors) {
+  if (gLpsrOptions ()->fTraceLpsrVisitors) {
     fLilypondCodeIOstream <<
       "% --> Start visiting msrMultipleRest" <<
       ", line " << elt->getInputLineNumber () <<
@@ -13888,7 +13887,7 @@ void lpsr2LilypondTranslator::visitStart (S_msrMultipleRest& elt)
   int restMeasuresNumber =
     elt->getMultipleRestMeasuresNumber ();
 
-  if (gLilypondOptions->fComments) {
+  if (gLilypondOptions ()->fComments) {
     fLilypondCodeIOstream << left <<
       setw (commentFieldWidth) <<
       "% start of multiple rest" <<
@@ -13900,14 +13899,14 @@ void lpsr2LilypondTranslator::visitStart (S_msrMultipleRest& elt)
       endl <<
       endl;      
 
-    gIndenter++;
+    gIndenter ()++;
   }
 
   // start counting measures
   fRemainingMultipleRestMeasuresNumber =
     elt->getMultipleRestMeasuresNumber ();
 
-  if (gLilypondOptions->fComments) {
+  if (gLilypondOptions ()->fComments) {
     fLilypondCodeIOstream << left <<
       setw (commentFieldWidth) <<
       "% start of multiple rest" <<
@@ -13937,7 +13936,7 @@ void lpsr2LilypondTranslator::visitStart (S_msrMultipleRest& elt)
       restMeasuresNumber;
   }
 
-  if (gLilypondOptions->fNoteInputLineNumbers) {
+  if (gLilypondOptions ()->fNoteInputLineNumbers) {
     // print the multiple rest line number as a comment
     fLilypondCodeIOstream <<
       " %{ " << inputLineNumber << " %} ";
@@ -13951,7 +13950,7 @@ void lpsr2LilypondTranslator::visitStart (S_msrMultipleRest& elt)
 
 void lpsr2LilypondTranslator::visitEnd (S_msrMultipleRest& elt)
 {
-  if (gLpsrOptions->fTraceLpsrVisitors) {
+  if (gLpsrOptions ()->fTraceLpsrVisitors) {
     fLilypondCodeIOstream <<
       "% --> End visiting msrMultipleRest" <<
       ", line " << elt->getInputLineNumber () <<
@@ -13965,8 +13964,8 @@ void lpsr2LilypondTranslator::visitEnd (S_msrMultipleRest& elt)
     endl;
 
   /* JMI
-  if (gLilypondOptions->fComments) {
-    gIndenter--;
+  if (gLilypondOptions ()->fComments) {
+    gIndenter ()--;
 
     fLilypondCodeIOstream << left <<
       setw (commentFieldWidth) <<
@@ -13990,7 +13989,7 @@ void lpsr2LilypondTranslator::visitEnd (S_msrMultipleRest& elt)
     elt->multipleRestContentsMeasuresNumber ();
     
 #ifdef TRACE_OPTIONS
-  if (gTraceOptions->fTraceMeasures || gTraceOptions->fTraceRepeats) {
+  if (gTraceOptions ()->fTraceMeasures || gTraceOptions ()->fTraceRepeats) {
     fLilypondCodeIOstream <<
       "% multiple rest, line " << inputLineNumber << ":" <<
       endl;
@@ -14008,7 +14007,7 @@ void lpsr2LilypondTranslator::visitEnd (S_msrMultipleRest& elt)
   }
 #endif
 
-  if (gLilypondOptions->fComments) {
+  if (gLilypondOptions ()->fComments) {
     fLilypondCodeIOstream << left <<
       setw (commentFieldWidth) <<
       "% start of multiple rest" <<
@@ -14038,7 +14037,7 @@ void lpsr2LilypondTranslator::visitEnd (S_msrMultipleRest& elt)
       restMeasuresNumber;
   }
 
-  if (gLilypondOptions->fNoteInputLineNumbers) {
+  if (gLilypondOptions ()->fNoteInputLineNumbers) {
     // print the multiple rest line number as a comment
     fLilypondCodeIOstream <<
       " %{ " << inputLineNumber << " %} ";
@@ -14055,7 +14054,7 @@ void lpsr2LilypondTranslator::visitEnd (S_msrMultipleRest& elt)
 
 void lpsr2LilypondTranslator::visitStart (S_msrMultipleRestContents& elt)
 {
-  if (gLpsrOptions->fTraceLpsrVisitors) {
+  if (gLpsrOptions ()->fTraceLpsrVisitors) {
     fLilypondCodeIOstream <<
       "%--> Start visiting msrMultipleRestContents" <<
       endl;
@@ -14064,7 +14063,7 @@ void lpsr2LilypondTranslator::visitStart (S_msrMultipleRestContents& elt)
 
 void lpsr2LilypondTranslator::visitEnd (S_msrMultipleRestContents& elt)
 {
-  if (gLpsrOptions->fTraceLpsrVisitors) {
+  if (gLpsrOptions ()->fTraceLpsrVisitors) {
     fLilypondCodeIOstream <<
       "%--> End visiting msrMultipleRestContents" <<
       endl;
@@ -14074,28 +14073,28 @@ void lpsr2LilypondTranslator::visitEnd (S_msrMultipleRestContents& elt)
 //________________________________________________________________________
 void lpsr2LilypondTranslator::visitStart (S_msrMidi& elt)
 {
-  if (gLpsrOptions->fTraceLpsrVisitors) {
+  if (gLpsrOptions ()->fTraceLpsrVisitors) {
     fLilypondCodeIOstream <<
       "% --> Start visiting msrMidi" <<
       ", line " << elt->getInputLineNumber () <<
       endl;
   }
 
-  if (gLilypondOptions->fNoMidi) {
+  if (gLilypondOptions ()->fNoMidi) {
     fLilypondCodeIOstream <<
       "%{" <<
       endl;
 
-     gIndenter++;
+     gIndenter ()++;
   }
 
   fLilypondCodeIOstream <<
     "\\midi" << " {" <<
     endl;
   
-  gIndenter++;
+  gIndenter ()++;
   
-  if (gLilypondOptions->fNoMidi) {
+  if (gLilypondOptions ()->fNoMidi) {
     fLilypondCodeIOstream <<
       "% ";
   }
@@ -14107,14 +14106,14 @@ void lpsr2LilypondTranslator::visitStart (S_msrMidi& elt)
     elt->getMidiTempoPerSecond () <<
     endl;
   
-  gIndenter--;
+  gIndenter ()--;
   
   fLilypondCodeIOstream <<
     "}" <<
     endl;
 
-  if (gLilypondOptions->fNoMidi) {
-    gIndenter--;
+  if (gLilypondOptions ()->fNoMidi) {
+    gIndenter ()--;
 
     fLilypondCodeIOstream <<
       "%}" <<
@@ -14124,7 +14123,7 @@ void lpsr2LilypondTranslator::visitStart (S_msrMidi& elt)
 
 void lpsr2LilypondTranslator::visitEnd (S_msrMidi& elt)
 {
-  if (gLpsrOptions->fTraceLpsrVisitors) {
+  if (gLpsrOptions ()->fTraceLpsrVisitors) {
     fLilypondCodeIOstream <<
       "% --> End visiting msrMidi" <<
       ", line " << elt->getInputLineNumber () <<
@@ -45,8 +45,8 @@ lpsrBarNumberCheck::~lpsrBarNumberCheck ()
 
 void lpsrBarNumberCheck::acceptIn (basevisitor* v)
 {
-  if (gLpsrOptions->fTraceLpsrVisitors) {
-    gLogIOstream <<
+  if (gLpsrOptions ()->fTraceLpsrVisitors) {
+    gLogIOstream () <<
       "% ==> lpsrBarNumberCheck::acceptIn ()" <<
       endl;
   }
@@ -56,8 +56,8 @@ void lpsrBarNumberCheck::acceptIn (basevisitor* v)
       dynamic_cast<visitor<S_lpsrBarNumberCheck>*> (v)) {
         S_lpsrBarNumberCheck elem = this;
         
-        if (gLpsrOptions->fTraceLpsrVisitors) {
-          gLogIOstream <<
+        if (gLpsrOptions ()->fTraceLpsrVisitors) {
+          gLogIOstream () <<
             "% ==> Launching lpsrBarNumberCheck::visitStart ()" <<
             endl;
         }
@@ -67,8 +67,8 @@ void lpsrBarNumberCheck::acceptIn (basevisitor* v)
 
 void lpsrBarNumberCheck::acceptOut (basevisitor* v)
 {
-  if (gLpsrOptions->fTraceLpsrVisitors) {
-    gLogIOstream <<
+  if (gLpsrOptions ()->fTraceLpsrVisitors) {
+    gLogIOstream () <<
       "% ==> lpsrBarNumberCheck::acceptOut ()" <<
       endl;
   }
@@ -78,8 +78,8 @@ void lpsrBarNumberCheck::acceptOut (basevisitor* v)
       dynamic_cast<visitor<S_lpsrBarNumberCheck>*> (v)) {
         S_lpsrBarNumberCheck elem = this;
       
-        if (gLpsrOptions->fTraceLpsrVisitors) {
-          gLogIOstream <<
+        if (gLpsrOptions ()->fTraceLpsrVisitors) {
+          gLogIOstream () <<
             "% ==> Launching lpsrBarNumberCheck::visitEnd ()" <<
             endl;
         }
@@ -124,8 +124,8 @@ lpsrBarCommand::~lpsrBarCommand ()
 
 void lpsrBarCommand::acceptIn (basevisitor* v)
 {
-  if (gLpsrOptions->fTraceLpsrVisitors) {
-    gLogIOstream <<
+  if (gLpsrOptions ()->fTraceLpsrVisitors) {
+    gLogIOstream () <<
       "% ==> lpsrBarCommand::acceptIn ()" <<
       endl;
   }
@@ -135,8 +135,8 @@ void lpsrBarCommand::acceptIn (basevisitor* v)
       dynamic_cast<visitor<S_lpsrBarCommand>*> (v)) {
         S_lpsrBarCommand elem = this;
         
-        if (gLpsrOptions->fTraceLpsrVisitors) {
-          gLogIOstream <<
+        if (gLpsrOptions ()->fTraceLpsrVisitors) {
+          gLogIOstream () <<
             "% ==> Launching lpsrBarCommand::visitStart ()" <<
             endl;
         }
@@ -146,8 +146,8 @@ void lpsrBarCommand::acceptIn (basevisitor* v)
 
 void lpsrBarCommand::acceptOut (basevisitor* v)
 {
-  if (gLpsrOptions->fTraceLpsrVisitors) {
-    gLogIOstream <<
+  if (gLpsrOptions ()->fTraceLpsrVisitors) {
+    gLogIOstream () <<
       "% ==> lpsrBarCommand::acceptOut ()" <<
       endl;
   }
@@ -157,8 +157,8 @@ void lpsrBarCommand::acceptOut (basevisitor* v)
       dynamic_cast<visitor<S_lpsrBarCommand>*> (v)) {
         S_lpsrBarCommand elem = this;
       
-        if (gLpsrOptions->fTraceLpsrVisitors) {
-          gLogIOstream <<
+        if (gLpsrOptions ()->fTraceLpsrVisitors) {
+          gLogIOstream () <<
             "% ==> Launching lpsrBarCommand::visitEnd ()" <<
             endl;
         }
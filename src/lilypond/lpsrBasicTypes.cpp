@@ -127,7 +127,7 @@ string wholeNotesAsLilypondString (
 #define DEBUG_WHOLE_NOTES 0
 
   if (DEBUG_WHOLE_NOTES) {
-    gLogIOstream <<
+    gLogIOstream () <<
       "--> -------------------------------------" <<
       endl <<
       "--> wholeNotes: " << wholeNotes <<
@@ -140,7 +140,7 @@ string wholeNotesAsLilypondString (
     denominator  = wholeNotes.getDenominator ();
 
   if (DEBUG_WHOLE_NOTES) {
-    gLogIOstream <<
+    gLogIOstream () <<
       "--> numerator:   " << numerator <<
       endl <<
       "--> denominator: " << denominator <<
@@ -155,7 +155,7 @@ string wholeNotesAsLilypondString (
   wholeNotes.rationalise ();
 
   if (DEBUG_WHOLE_NOTES) {
-    gLogIOstream <<
+    gLogIOstream () <<
       "--> wholeNotes rationalised: " << wholeNotes <<
       endl;
   }
@@ -173,7 +173,7 @@ string wholeNotesAsLilypondString (
     integralNumberOfWholeNotes = denominator == 1;
 
   if (DEBUG_WHOLE_NOTES) {
-    gLogIOstream <<
+    gLogIOstream () <<
       "--> rationalHasBeenSimplified: " <<
       booleanAsString (
         rationalHasBeenSimplified) <<
@@ -225,7 +225,7 @@ string wholeNotesAsLilypondString (
             " it will be represented using a multiplying factor";
     
           msrMusicXMLWarning (
-            gXml2lyOptions->fInputSourceName,
+            gXml2lyOptions ()->fInputSourceName,
             inputLineNumber,
             s.str ());
 
@@ -235,7 +235,7 @@ string wholeNotesAsLilypondString (
     */
 
   if (DEBUG_WHOLE_NOTES) {
-    gLogIOstream <<
+    gLogIOstream () <<
       "--> numeratorDots " << " : " <<
       numeratorDots <<
       endl <<
@@ -310,7 +310,7 @@ string wholeNotesAsLilypondString (
   
    //   msrMusicXMLError ( JMI
       msrMusicXMLWarning (
-        gXml2lyOptions->fInputSourceName,
+        gXml2lyOptions ()->fInputSourceName,
         inputLineNumber,
     //    __FILE__, __LINE__,
         s.str ());
@@ -320,7 +320,7 @@ string wholeNotesAsLilypondString (
   }
 
   if (DEBUG_WHOLE_NOTES) {
-    gLogIOstream <<
+    gLogIOstream () <<
       "--> durationLog" << " : " <<
       durationLog <<
       endl <<
@@ -349,7 +349,7 @@ string wholeNotesAsLilypondString (
     durationLog -= numeratorDots;
 
     if (DEBUG_WHOLE_NOTES) {
-      gLogIOstream <<
+      gLogIOstream () <<
         "--> durationLog" << " : " <<
         durationLog <<
         endl <<
@@ -364,7 +364,7 @@ string wholeNotesAsLilypondString (
     multiplyingFactor = numerator;
 
     if (DEBUG_WHOLE_NOTES) {
-      gLogIOstream <<
+      gLogIOstream () <<
         "--> durationLog" << " : " <<
         durationLog <<
         endl <<
@@ -382,7 +382,7 @@ string wholeNotesAsLilypondString (
       multiplyingFactor /= 2;
 
       if (DEBUG_WHOLE_NOTES) {
-        gLogIOstream <<
+        gLogIOstream () <<
           "--> durationLog" << " : " <<
           durationLog <<
           endl <<
@@ -395,7 +395,7 @@ string wholeNotesAsLilypondString (
   }
 
   if (DEBUG_WHOLE_NOTES) {
-    gLogIOstream <<
+    gLogIOstream () <<
       "--> numerator " << " : " <<
       numerator <<
       endl <<
@@ -449,7 +449,7 @@ string wholeNotesAsLilypondString (
   }
   
   if (DEBUG_WHOLE_NOTES) {
-    gLogIOstream <<
+    gLogIOstream () <<
       "--> return:" <<
       endl <<
       "  --> s.str ()     " << " : \"" << s.str () << "\"" <<
@@ -566,9 +566,6 @@ void writeTextsListAsLilypondString (
 // accidental styles
 //______________________________________________________________________________
 
-map<string, lpsrAccidentalStyleKind>
-  gLpsrAccidentalStyleKindsMap;
-
 string lpsrAccidentalStyleKindAsString (
   lpsrAccidentalStyleKind styleKind)
 {
@@ -699,42 +696,58 @@ string lpsrAccidentalStyleKindAsLilypondString (
   return result;
 }
 
-void initializeLpsrAccidentalStyleKindsMap ()
+static map<string, lpsrAccidentalStyleKind>
+  buildLpsrAccidentalStyleKindsMap ()
 {
+  map<string, lpsrAccidentalStyleKind> result;
+
   // register the LilyPond accidental styles
   // --------------------------------------
 
-  gLpsrAccidentalStyleKindsMap ["default"] = kDefaultStyle;
-  gLpsrAccidentalStyleKindsMap ["voice"] = kVoiceStyle;
-  gLpsrAccidentalStyleKindsMap ["modern"] = kModernStyle;
-  gLpsrAccidentalStyleKindsMap ["modern-cautionary"] = kModernCautionaryStyle;
-  gLpsrAccidentalStyleKindsMap ["modern-voice"] = kModernVoiceStyle;
-  gLpsrAccidentalStyleKindsMap ["modern-voice-cautionary"] = kModernVoiceCautionaryStyle;
-  gLpsrAccidentalStyleKindsMap ["piano"] = kPianoStyle;
-  gLpsrAccidentalStyleKindsMap ["piano-cautionary"] = kPianoCautionaryStyle;
-  gLpsrAccidentalStyleKindsMap ["neo-modern"] = kNeoModernStyle;
-  gLpsrAccidentalStyleKindsMap ["neo-modern-cautionary"] = kNeoModernCautionaryStyle;
-  gLpsrAccidentalStyleKindsMap ["neo-modern-voice"] = kNeoModernVoiceStyle;
-  gLpsrAccidentalStyleKindsMap ["neo-modern-voice-cautionary"] = kNeoModernVoiceCautionaryStyle;
-  gLpsrAccidentalStyleKindsMap ["dodecaphonic"] = kDodecaphonicStyle;
-  gLpsrAccidentalStyleKindsMap ["dodecaphonic-no-repeat"] = kDodecaphonicNoRepeatStyle;
-  gLpsrAccidentalStyleKindsMap ["dodecaphonic-first"] = kDodecaphonicFirstStyle;
-  gLpsrAccidentalStyleKindsMap ["teaching"] = kTeachingStyle;
-  gLpsrAccidentalStyleKindsMap ["no-reset"] = kNoResetStyle;
-  gLpsrAccidentalStyleKindsMap ["forget"] = kForgetStyle;
+  result ["default"]                      = kDefaultStyle;
+  result ["voice"]                        = kVoiceStyle;
+  result ["modern"]                       = kModernStyle;
+  result ["modern-cautionary"]            = kModernCautionaryStyle;
+  result ["modern-voice"]                 = kModernVoiceStyle;
+  result ["modern-voice-cautionary"]      = kModernVoiceCautionaryStyle;
+  result ["piano"]                        = kPianoStyle;
+  result ["piano-cautionary"]             = kPianoCautionaryStyle;
+  result ["neo-modern"]                   = kNeoModernStyle;
+  result ["neo-modern-cautionary"]        = kNeoModernCautionaryStyle;
+  result ["neo-modern-voice"]             = kNeoModernVoiceStyle;
+  result ["neo-modern-voice-cautionary"]  = kNeoModernVoiceCautionaryStyle;
+  result ["dodecaphonic"]                 = kDodecaphonicStyle;
+  result ["dodecaphonic-no-repeat"]       = kDodecaphonicNoRepeatStyle;
+  result ["dodecaphonic-first"]           = kDodecaphonicFirstStyle;
+  result ["teaching"]                     = kTeachingStyle;
+  result ["no-reset"]                     = kNoResetStyle;
+  result ["forget"]                       = kForgetStyle;
+
+  return result;
+}
+
+const map<string, lpsrAccidentalStyleKind>&
+  lpsrAccidentalStyleKindsMap ()
+{
+  // built on first use only, i.e. when the accidental style option is used
+  static const map<string, lpsrAccidentalStyleKind>
+    sLpsrAccidentalStyleKindsMap =
+      buildLpsrAccidentalStyleKindsMap ();
+
+  return sLpsrAccidentalStyleKindsMap;
 }
 
 string existingLpsrAccidentalStyleKinds ()
 {
   stringstream s;
 
-  if (gLpsrAccidentalStyleKindsMap.size ()) {
+  if (lpsrAccidentalStyleKindsMap ().size ()) {
     map<string, lpsrAccidentalStyleKind>::const_iterator
-      iBegin = gLpsrAccidentalStyleKindsMap.begin (),
-      iEnd   = gLpsrAccidentalStyleKindsMap.end (),
+      iBegin = lpsrAccidentalStyleKindsMap ().begin (),
+      iEnd   = lpsrAccidentalStyleKindsMap ().end (),
       i      = iBegin;
     for ( ; ; ) {
-      gLogIOstream <<
+      gLogIOstream () <<
         (*i).first <<
         endl;
       if ((*i).second != kDefaultStyle) {
@@ -753,16 +766,29 @@ string existingLpsrAccidentalStyleKinds ()
 // chords languages
 //______________________________________________________________________________
 
-map<string, lpsrChordsLanguageKind>
-  gLpsrChordsLanguageKindsMap;
+static map<string, lpsrChordsLanguageKind>
+  buildLpsrChordsLanguageKindsMap ()
+{
+  map<string, lpsrChordsLanguageKind> result;
 
-void initializeLpsrChordsLanguageKindsMap ()
+  result ["Ignatzek"]    = k_IgnatzekChords; // default
+  result ["german"]      = k_GermanChords;
+  result ["semiGerman"]  = k_SemiGermanChords;
+  result ["italian"]     = k_ItalianChords;
+  result ["french"]      = k_FrenchChords;
+
+  return result;
+}
+
+const map<string, lpsrChordsLanguageKind>&
+  lpsrChordsLanguageKindsMap ()
 {
-  gLpsrChordsLanguageKindsMap ["Ignatzek"]   = k_IgnatzekChords; // default
-  gLpsrChordsLanguageKindsMap ["german"]     = k_GermanChords;
-  gLpsrChordsLanguageKindsMap ["semiGerman"] = k_SemiGermanChords;
-  gLpsrChordsLanguageKindsMap ["italian"]    = k_ItalianChords;
-  gLpsrChordsLanguageKindsMap ["french"]     = k_FrenchChords;
+  // built on first use only, i.e. when the chords language option is used
+  static const map<string, lpsrChordsLanguageKind>
+    sLpsrChordsLanguageKindsMap =
+      buildLpsrChordsLanguageKindsMap ();
+
+  return sLpsrChordsLanguageKindsMap;
 }
 
 string lpsrChordsLanguageKindAsString (
@@ -795,10 +821,10 @@ string existingLpsrChordsLanguageKinds ()
 {
   stringstream s;
   
-  if (gLpsrChordsLanguageKindsMap.size ()) {
+  if (lpsrChordsLanguageKindsMap ().size ()) {
     map<string, lpsrChordsLanguageKind>::const_iterator
-      iBegin = gLpsrChordsLanguageKindsMap.begin (),
-      iEnd   = gLpsrChordsLanguageKindsMap.end (),
+      iBegin = lpsrChordsLanguageKindsMap ().begin (),
+      iEnd   = lpsrChordsLanguageKindsMap ().end (),
       i      = iBegin;
     for ( ; ; ) {
       if ((*i).second != k_IgnatzekChords) {
@@ -817,15 +843,9 @@ string existingLpsrChordsLanguageKinds ()
 //______________________________________________________________________________
 void initializeLPSRBasicTypes ()
 {
-  // LPSR accidental styles handling
-  // ------------------------------------------------------
-
-  initializeLpsrAccidentalStyleKindsMap ();
-
-  // LPSR chords languages handling
-  // ------------------------------------------------------
-
-  initializeLpsrChordsLanguageKindsMap ();
+  // the LPSR accidental styles and chords languages maps
+  // are built on first use, see lpsrAccidentalStyleKindsMap ()
+  // and lpsrChordsLanguageKindsMap ()
 }
 
 
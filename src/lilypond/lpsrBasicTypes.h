@@ -45,13 +45,12 @@ string lpsrAccidentalStyleKindAsString (
 string lpsrAccidentalStyleKindAsLilypondString (
   lpsrAccidentalStyleKind styleKind);
 
-extern map<string, lpsrAccidentalStyleKind>
-  gLpsrAccidentalStyleKindsMap;
+// built on first use
+const map<string, lpsrAccidentalStyleKind>&
+  lpsrAccidentalStyleKindsMap ();
 
 string existingLpsrAccidentalStyleKinds ();
 
-void initializeLpsrAccidentalStyleKindsMap ();
-
 // chords languages
 //______________________________________________________________________________
 enum lpsrChordsLanguageKind {
@@ -61,13 +60,12 @@ enum lpsrChordsLanguageKind {
 string lpsrChordsLanguageKindAsString (
   lpsrChordsLanguageKind languageKind);
 
-extern map<string, lpsrChordsLanguageKind>
-  gLpsrChordsLanguageKindsMap;
+// built on first use
+const map<string, lpsrChordsLanguageKind>&
+  lpsrChordsLanguageKindsMap ();
 
 string existingLpsrChordsLanguageKinds ();
 
-void initializeLpsrChordsLanguageKindsMap ();
-
 // whole notes
 //______________________________________________________________________________
 string wholeNotesAsLilypondString (
@@ -52,8 +52,8 @@ lpsrComment::~lpsrComment ()
 
 void lpsrComment::acceptIn (basevisitor* v)
 {
-  if (gLpsrOptions->fTraceLpsrVisitors) {
-    gLogIOstream <<
+  if (gLpsrOptions ()->fTraceLpsrVisitors) {
+    gLogIOstream () <<
       "% ==> lpsrComment::acceptIn ()" <<
       endl;
   }
@@ -63,8 +63,8 @@ void lpsrComment::acceptIn (basevisitor* v)
       dynamic_cast<visitor<S_lpsrComment>*> (v)) {
         S_lpsrComment elem = this;
         
-        if (gLpsrOptions->fTraceLpsrVisitors) {
-          gLogIOstream <<
+        if (gLpsrOptions ()->fTraceLpsrVisitors) {
+          gLogIOstream () <<
             "% ==> Launching lpsrComment::visitStart ()" <<
             endl;
         }
@@ -74,8 +74,8 @@ void lpsrComment::acceptIn (basevisitor* v)
 
 void lpsrComment::acceptOut (basevisitor* v)
 {
-  if (gLpsrOptions->fTraceLpsrVisitors) {
-    gLogIOstream <<
+  if (gLpsrOptions ()->fTraceLpsrVisitors) {
+    gLogIOstream () <<
       "% ==> lpsrComment::acceptOut ()" <<
       endl;
   }
@@ -85,8 +85,8 @@ void lpsrComment::acceptOut (basevisitor* v)
       dynamic_cast<visitor<S_lpsrComment>*> (v)) {
         S_lpsrComment elem = this;
       
-        if (gLpsrOptions->fTraceLpsrVisitors) {
-          gLogIOstream <<
+        if (gLpsrOptions ()->fTraceLpsrVisitors) {
+          gLogIOstream () <<
             "% ==> Launching lpsrComment::visitEnd ()" <<
             endl;
         }
@@ -103,7 +103,7 @@ void lpsrComment::print (ostream& os)
     "Comment" <<
     endl;
   
-  gIndenter++;
+  gIndenter ()++;
   
   os <<
     "% " << fContents <<
@@ -113,7 +113,7 @@ void lpsrComment::print (ostream& os)
     os <<
       endl;
   
-  gIndenter--;
+  gIndenter ()--;
 }
 
 ostream& operator<< (ostream& os, const S_lpsrComment& elt)
@@ -54,8 +54,8 @@ lpsrContext::~lpsrContext ()
 
 void lpsrContext::acceptIn (basevisitor* v)
 {
-  if (gLpsrOptions->fTraceLpsrVisitors) {
-    gLogIOstream <<
+  if (gLpsrOptions ()->fTraceLpsrVisitors) {
+    gLogIOstream () <<
       "% ==> lpsrContext::acceptIn ()" <<
       endl;
   }
@@ -65,8 +65,8 @@ void lpsrContext::acceptIn (basevisitor* v)
       dynamic_cast<visitor<S_lpsrContext>*> (v)) {
         S_lpsrContext elem = this;
         
-        if (gLpsrOptions->fTraceLpsrVisitors) {
-          gLogIOstream <<
+        if (gLpsrOptions ()->fTraceLpsrVisitors) {
+          gLogIOstream () <<
             "% ==> Launching lpsrContext::visitStart ()" <<
             endl;
         }
@@ -76,8 +76,8 @@ void lpsrContext::acceptIn (basevisitor* v)
 
 void lpsrContext::acceptOut (basevisitor* v)
 {
-  if (gLpsrOptions->fTraceLpsrVisitors) {
-    gLogIOstream <<
+  if (gLpsrOptions ()->fTraceLpsrVisitors) {
+    gLogIOstream () <<
       "% ==> lpsrContext::acceptOut ()" <<
       endl;
   }
@@ -87,8 +87,8 @@ void lpsrContext::acceptOut (basevisitor* v)
       dynamic_cast<visitor<S_lpsrContext>*> (v)) {
         S_lpsrContext elem = this;
       
-        if (gLpsrOptions->fTraceLpsrVisitors) {
-          gLogIOstream <<
+        if (gLpsrOptions ()->fTraceLpsrVisitors) {
+          gLogIOstream () <<
             "% ==> Launching lpsrContext::visitEnd ()" <<
             endl;
         }
@@ -150,7 +150,7 @@ void lpsrContext::print (ostream& os)
   os <<
     endl;
   
-  gIndenter++;
+  gIndenter ()++;
 
   os <<
     "ContextElements";
@@ -159,7 +159,7 @@ void lpsrContext::print (ostream& os)
     os <<
       endl;
       
-    gIndenter++;
+    gIndenter ()++;
   
     list<S_msrElement>::const_iterator
       iBegin = fContextElementsList.begin (),
@@ -171,14 +171,14 @@ void lpsrContext::print (ostream& os)
  // JMI     os << endl;
     } // for
     
-    gIndenter--;
+    gIndenter ()--;
   }
   else {
     os << "none" <<
     endl;
   }
 
-  gIndenter--;
+  gIndenter ()--;
 }
 
 //______________________________________________________________________________
@@ -221,8 +221,8 @@ lpsrChordNamesContext::~lpsrChordNamesContext ()
 
 void lpsrChordNamesContext::acceptIn (basevisitor* v)
 {
-  if (gLpsrOptions->fTraceLpsrVisitors) {
-    gLogIOstream <<
+  if (gLpsrOptions ()->fTraceLpsrVisitors) {
+    gLogIOstream () <<
       "% ==> lpsrChordNamesContext::acceptIn ()" <<
       endl;
   }
@@ -232,8 +232,8 @@ void lpsrChordNamesContext::acceptIn (basevisitor* v)
       dynamic_cast<visitor<S_lpsrChordNamesContext>*> (v)) {
         S_lpsrChordNamesContext elem = this;
         
-        if (gLpsrOptions->fTraceLpsrVisitors) {
-          gLogIOstream <<
+        if (gLpsrOptions ()->fTraceLpsrVisitors) {
+          gLogIOstream () <<
             "% ==> Launching lpsrChordNamesContext::visitStart ()" <<
             endl;
         }
@@ -243,8 +243,8 @@ void lpsrChordNamesContext::acceptIn (basevisitor* v)
 
 void lpsrChordNamesContext::acceptOut (basevisitor* v)
 {
-  if (gLpsrOptions->fTraceLpsrVisitors) {
-    gLogIOstream <<
+  if (gLpsrOptions ()->fTraceLpsrVisitors) {
+    gLogIOstream () <<
       "% ==> lpsrChordNamesContext::acceptOut ()" <<
       endl;
   }
@@ -254,8 +254,8 @@ void lpsrChordNamesContext::acceptOut (basevisitor* v)
       dynamic_cast<visitor<S_lpsrChordNamesContext>*> (v)) {
         S_lpsrChordNamesContext elem = this;
       
-        if (gLpsrOptions->fTraceLpsrVisitors) {
-          gLogIOstream <<
+        if (gLpsrOptions ()->fTraceLpsrVisitors) {
+          gLogIOstream () <<
             "% ==> Launching lpsrChordNamesContext::visitEnd ()" <<
             endl;
         }
@@ -278,7 +278,7 @@ void lpsrChordNamesContext::print (ostream& os)
     "ChordNamesContext" <<
     endl;
     
-  gIndenter++;
+  gIndenter ()++;
 
   const int fieldWidth = 20;
 
@@ -303,7 +303,7 @@ void lpsrChordNamesContext::print (ostream& os)
     os <<
       endl;
       
-    gIndenter++;
+    gIndenter ()++;
   
     list<S_msrElement>::const_iterator
       iBegin = fContextElementsList.begin (),
@@ -315,7 +315,7 @@ void lpsrChordNamesContext::print (ostream& os)
  // JMI     os << endl;
     } // for
     
-    gIndenter--;
+    gIndenter ()--;
   }
   else {
     os <<
@@ -323,7 +323,7 @@ void lpsrChordNamesContext::print (ostream& os)
     endl;
   }
   
-  gIndenter--;
+  gIndenter ()--;
 }
 
 ostream& operator<< (ostream& os, const S_lpsrChordNamesContext& elt)
@@ -372,8 +372,8 @@ lpsrFiguredBassContext::~lpsrFiguredBassContext ()
 
 void lpsrFiguredBassContext::acceptIn (basevisitor* v)
 {
-  if (gLpsrOptions->fTraceLpsrVisitors) {
-    gLogIOstream <<
+  if (gLpsrOptions ()->fTraceLpsrVisitors) {
+    gLogIOstream () <<
       "% ==> lpsrFiguredBassContext::acceptIn ()" <<
       endl;
   }
@@ -383,8 +383,8 @@ void lpsrFiguredBassContext::acceptIn (basevisitor* v)
       dynamic_cast<visitor<S_lpsrFiguredBassContext>*> (v)) {
         S_lpsrFiguredBassContext elem = this;
         
-        if (gLpsrOptions->fTraceLpsrVisitors) {
-          gLogIOstream <<
+        if (gLpsrOptions ()->fTraceLpsrVisitors) {
+          gLogIOstream () <<
             "% ==> Launching lpsrFiguredBassContext::visitStart ()" <<
             endl;
         }
@@ -394,8 +394,8 @@ void lpsrFiguredBassContext::acceptIn (basevisitor* v)
 
 void lpsrFiguredBassContext::acceptOut (basevisitor* v)
 {
-  if (gLpsrOptions->fTraceLpsrVisitors) {
-    gLogIOstream <<
+  if (gLpsrOptions ()->fTraceLpsrVisitors) {
+    gLogIOstream () <<
       "% ==> lpsrFiguredBassContext::acceptOut ()" <<
       endl;
   }
@@ -405,8 +405,8 @@ void lpsrFiguredBassContext::acceptOut (basevisitor* v)
       dynamic_cast<visitor<S_lpsrFiguredBassContext>*> (v)) {
         S_lpsrFiguredBassContext elem = this;
       
-        if (gLpsrOptions->fTraceLpsrVisitors) {
-          gLogIOstream <<
+        if (gLpsrOptions ()->fTraceLpsrVisitors) {
+          gLogIOstream () <<
             "% ==> Launching lpsrFiguredBassContext::visitEnd ()" <<
             endl;
         }
@@ -429,7 +429,7 @@ void lpsrFiguredBassContext::print (ostream& os)
     "FiguredBassContext" <<
     endl;
     
-  gIndenter++;
+  gIndenter ()++;
 
   const int fieldWidth = 20;
 
@@ -454,7 +454,7 @@ void lpsrFiguredBassContext::print (ostream& os)
     os <<
       endl;
       
-    gIndenter++;
+    gIndenter ()++;
   
     list<S_msrElement>::const_iterator
       iBegin = fContextElementsList.begin (),
@@ -466,7 +466,7 @@ void lpsrFiguredBassContext::print (ostream& os)
  // JMI     os << endl;
     } // for
     
-    gIndenter--;
+    gIndenter ()--;
   }
   else {
     os <<
@@ -474,7 +474,7 @@ void lpsrFiguredBassContext::print (ostream& os)
     endl;
   }
   
-  gIndenter--;
+  gIndenter ()--;
 }
 
 ostream& operator<< (ostream& os, const S_lpsrFiguredBassContext& elt)
@@ -41,8 +41,8 @@ lpsrElement::~lpsrElement ()
 
 void lpsrElement::acceptIn (basevisitor* v)
 {
-  if (gLpsrOptions->fTraceLpsrVisitors) {
-    gLogIOstream <<
+  if (gLpsrOptions ()->fTraceLpsrVisitors) {
+    gLogIOstream () <<
       "% ==> lpsrElement::acceptIn ()" <<
       endl;
   }
@@ -52,8 +52,8 @@ void lpsrElement::acceptIn (basevisitor* v)
       dynamic_cast<visitor<S_lpsrElement>*> (v)) {
         S_lpsrElement elem = this;
         
-        if (gLpsrOptions->fTraceLpsrVisitors) {
-          gLogIOstream <<
+        if (gLpsrOptions ()->fTraceLpsrVisitors) {
+          gLogIOstream () <<
             "% ==> Launching lpsrElement::visitStart ()" <<
             endl;
         }
@@ -63,8 +63,8 @@ void lpsrElement::acceptIn (basevisitor* v)
 
 void lpsrElement::acceptOut (basevisitor* v)
 {
-  if (gLpsrOptions->fTraceLpsrVisitors) {
-    gLogIOstream <<
+  if (gLpsrOptions ()->fTraceLpsrVisitors) {
+    gLogIOstream () <<
       "% ==> lpsrElement::acceptOut ()" <<
       endl;
   }
@@ -74,8 +74,8 @@ void lpsrElement::acceptOut (basevisitor* v)
       dynamic_cast<visitor<S_lpsrElement>*> (v)) {
         S_lpsrElement elem = this;
       
-        if (gLpsrOptions->fTraceLpsrVisitors) {
-          gLogIOstream <<
+        if (gLpsrOptions ()->fTraceLpsrVisitors) {
+          gLogIOstream () <<
             "% ==> Launching lpsrElement::visitEnd ()" <<
             endl;
         }
@@ -43,60 +43,60 @@ lpsrHeader::lpsrHeader (
     : lpsrElement (inputLineNumber)
 {
   // grab values from the LilyPond options if any
-  if (gLilypondOptions->fDedication.size ()) {
+  if (gLilypondOptions ()->fDedication.size ()) {
     setLilypondDedication (
       inputLineNumber,
-      gLilypondOptions->fDedication);
+      gLilypondOptions ()->fDedication);
   }
   
-  if (gLilypondOptions->fPiece.size ()) {
+  if (gLilypondOptions ()->fPiece.size ()) {
     setLilypondPiece (
       inputLineNumber,
-      gLilypondOptions->fPiece);
+      gLilypondOptions ()->fPiece);
   }
   
-  if (gLilypondOptions->fOpus.size ()) {
+  if (gLilypondOptions ()->fOpus.size ()) {
     setLilypondOpus (
       inputLineNumber,
-      gLilypondOptions->fOpus);
+      gLilypondOptions ()->fOpus);
   }
   
-  if (gLilypondOptions->fTitle.size ()) {
+  if (gLilypondOptions ()->fTitle.size ()) {
     setLilypondTitle (
       inputLineNumber,
-      gLilypondOptions->fTitle);
+      gLilypondOptions ()->fTitle);
   }
-  if (gLilypondOptions->fSubTitle.size ()) {
+  if (gLilypondOptions ()->fSubTitle.size ()) {
     setLilypondSubTitle (
       inputLineNumber,
-      gLilypondOptions->fSubTitle);
+      gLilypondOptions ()->fSubTitle);
   }
-  if (gLilypondOptions->fSubSubTitle.size ()) {
+  if (gLilypondOptions ()->fSubSubTitle.size ()) {
     setLilypondSubSubTitle (
       inputLineNumber,
-      gLilypondOptions->fSubSubTitle);
+      gLilypondOptions ()->fSubSubTitle);
   }
   
-  if (gLilypondOptions->fInstrument.size ()) {
+  if (gLilypondOptions ()->fInstrument.size ()) {
     setLilypondInstrument (
       inputLineNumber,
-      gLilypondOptions->fInstrument);
+      gLilypondOptions ()->fInstrument);
   }
-  if (gLilypondOptions->fMeter.size ()) {
+  if (gLilypondOptions ()->fMeter.size ()) {
     setLilypondMeter (
       inputLineNumber,
-      gLilypondOptions->fMeter);
+      gLilypondOptions ()->fMeter);
   }
   
-  if (gLilypondOptions->fCopyright.size ()) {
+  if (gLilypondOptions ()->fCopyright.size ()) {
     setLilypondCopyright (
       inputLineNumber,
-      gLilypondOptions->fCopyright);
+      gLilypondOptions ()->fCopyright);
   }
-  if (gLilypondOptions->fTagline.size ()) {
+  if (gLilypondOptions ()->fTagline.size ()) {
     setLilypondTagline (
       inputLineNumber,
-      gLilypondOptions->fTagline);
+      gLilypondOptions ()->fTagline);
   }
 }
 
@@ -414,8 +414,8 @@ void lpsrHeader::addRights (
   string value)
 {
 #ifdef TRACE_OPTIONS
-  if (gTraceOptions->fTraceVarValAssocs) {
-    gLogIOstream <<
+  if (gTraceOptions ()->fTraceVarValAssocs) {
+    gLogIOstream () <<
       "Adding right \"" <<
       value <<
       "\" to lpsrHeader" <<
@@ -440,8 +440,8 @@ void lpsrHeader::addComposer (
   string value)
 {
 #ifdef TRACE_OPTIONS
-  if (gTraceOptions->fTraceVarValAssocs) {
-    gLogIOstream <<
+  if (gTraceOptions ()->fTraceVarValAssocs) {
+    gLogIOstream () <<
       "Adding composer \"" <<
       value <<
       "\" to lpsrHeader" <<
@@ -466,8 +466,8 @@ void lpsrHeader::addArranger (
   string value)
 {
 #ifdef TRACE_OPTIONS
-  if (gTraceOptions->fTraceVarValAssocs) {
-    gLogIOstream <<
+  if (gTraceOptions ()->fTraceVarValAssocs) {
+    gLogIOstream () <<
       "Adding arranger \"" <<
       value <<
       "\" to lpsrHeader" <<
@@ -492,8 +492,8 @@ void lpsrHeader::addLyricist (
   string value)
 {
 #ifdef TRACE_OPTIONS
-  if (gTraceOptions->fTraceVarValAssocs) {
-    gLogIOstream <<
+  if (gTraceOptions ()->fTraceVarValAssocs) {
+    gLogIOstream () <<
       "Adding lyricist \"" <<
       value <<
       "\" to lpsrHeader" <<
@@ -518,8 +518,8 @@ void lpsrHeader::addPoet (
   string value)
 {
 #ifdef TRACE_OPTIONS
-  if (gTraceOptions->fTraceVarValAssocs) {
-    gLogIOstream <<
+  if (gTraceOptions ()->fTraceVarValAssocs) {
+    gLogIOstream () <<
       "Adding poet \"" <<
       value <<
       "\" to lpsrHeader" <<
@@ -544,8 +544,8 @@ void lpsrHeader::addTranslator (
   string value)
 {
 #ifdef TRACE_OPTIONS
-  if (gTraceOptions->fTraceVarValAssocs) {
-    gLogIOstream <<
+  if (gTraceOptions ()->fTraceVarValAssocs) {
+    gLogIOstream () <<
       "Adding translator \"" <<
       value <<
       "\" to lpsrHeader" <<
@@ -570,8 +570,8 @@ void lpsrHeader::addSoftware (
   string value)
 {
 #ifdef TRACE_OPTIONS
-  if (gTraceOptions->fTraceVarValAssocs) {
-    gLogIOstream <<
+  if (gTraceOptions ()->fTraceVarValAssocs) {
+    gLogIOstream () <<
       "Adding software \"" <<
       value <<
       "\" to lpsrHeader" <<
@@ -849,8 +849,8 @@ int lpsrHeader::maxLilypondVariablesNamesLength ()
 
 void lpsrHeader::acceptIn (basevisitor* v)
 {
-  if (gLpsrOptions->fTraceLpsrVisitors) {
-    gLogIOstream <<
+  if (gLpsrOptions ()->fTraceLpsrVisitors) {
+    gLogIOstream () <<
       "% ==> lpsrHeader::acceptIn ()" <<
       endl;
   }
@@ -860,8 +860,8 @@ void lpsrHeader::acceptIn (basevisitor* v)
       dynamic_cast<visitor<S_lpsrHeader>*> (v)) {
         S_lpsrHeader elem = this;
         
-        if (gLpsrOptions->fTraceLpsrVisitors) {
-          gLogIOstream <<
+        if (gLpsrOptions ()->fTraceLpsrVisitors) {
+          gLogIOstream () <<
             "% ==> Launching lpsrHeader::visitStart ()" <<
             endl;
         }
@@ -871,8 +871,8 @@ void lpsrHeader::acceptIn (basevisitor* v)
 
 void lpsrHeader::acceptOut (basevisitor* v)
 {
-  if (gLpsrOptions->fTraceLpsrVisitors) {
-    gLogIOstream <<
+  if (gLpsrOptions ()->fTraceLpsrVisitors) {
+    gLogIOstream () <<
       "% ==> lpsrHeader::acceptOut ()" <<
       endl;
   }
@@ -882,8 +882,8 @@ void lpsrHeader::acceptOut (basevisitor* v)
       dynamic_cast<visitor<S_lpsrHeader>*> (v)) {
         S_lpsrHeader elem = this;
       
-        if (gLpsrOptions->fTraceLpsrVisitors) {
-          gLogIOstream <<
+        if (gLpsrOptions ()->fTraceLpsrVisitors) {
+          gLogIOstream () <<
             "% ==> Launching lpsrHeader::visitEnd ()" <<
             endl;
         }
@@ -986,7 +986,7 @@ void lpsrHeader::print (ostream& os)
 
   bool emptyHeader = true;
   
-  gIndenter++;
+  gIndenter ()++;
 
   const int fieldWidth = 16;
   
@@ -1000,13 +1000,13 @@ void lpsrHeader::print (ostream& os)
       fLilypondTitle->lilyPondVarValAssocKindAsString () << " : " <<
       endl;
       
-    gIndenter++;
+    gIndenter ()++;
     
     os <<
       fLilypondTitle <<
       endl;
       
-    gIndenter--;
+    gIndenter ()--;
 
     emptyHeader = false;
   }
@@ -1017,13 +1017,13 @@ void lpsrHeader::print (ostream& os)
       fWorkNumber->lilyPondVarValAssocKindAsString () << " : " <<
       endl;
       
-    gIndenter++;
+    gIndenter ()++;
     
     os <<
       fWorkNumber <<
       endl;
       
-    gIndenter--;
+    gIndenter ()--;
 
     emptyHeader = false;
   }
@@ -1034,13 +1034,13 @@ void lpsrHeader::print (ostream& os)
       fWorkTitle->lilyPondVarValAssocKindAsString () << " : " <<
       endl;
       
-    gIndenter++;
+    gIndenter ()++;
     
     os <<
       fWorkTitle <<
       endl;
       
-    gIndenter--;
+    gIndenter ()--;
 
     emptyHeader = false;
   }
@@ -1051,13 +1051,13 @@ void lpsrHeader::print (ostream& os)
       fMovementNumber->lilyPondVarValAssocKindAsString () << " : " <<
       endl;
       
-    gIndenter++;
+    gIndenter ()++;
     
     os <<
       fMovementNumber <<
       endl;
       
-    gIndenter--;
+    gIndenter ()--;
 
     emptyHeader = false;
   }
@@ -1068,13 +1068,13 @@ void lpsrHeader::print (ostream& os)
       fMovementTitle->lilyPondVarValAssocKindAsString () << " : " <<
       endl;
       
-    gIndenter++;
+    gIndenter ()++;
     
     os <<
       fMovementTitle <<
       endl;
       
-    gIndenter--;
+    gIndenter ()--;
 
     emptyHeader = false;
   }
@@ -1085,13 +1085,13 @@ void lpsrHeader::print (ostream& os)
       fRights->lilyPondVarValsListAssocKindAsString () << " : " <<
       endl;
       
-    gIndenter++;
+    gIndenter ()++;
     
     os <<
       fRights <<
       endl;
       
-    gIndenter--;
+    gIndenter ()--;
         
     emptyHeader = false;
   }
@@ -1102,13 +1102,13 @@ void lpsrHeader::print (ostream& os)
       fComposers->lilyPondVarValsListAssocKindAsString () << " : " <<
       endl;
       
-    gIndenter++;
+    gIndenter ()++;
     
     os <<
       fComposers <<
       endl;
       
-    gIndenter--;
+    gIndenter ()--;
         
     emptyHeader = false;
   }
@@ -1119,13 +1119,13 @@ void lpsrHeader::print (ostream& os)
       fArrangers->lilyPondVarValsListAssocKindAsString () << " : " <<
       endl;
       
-    gIndenter++;
+    gIndenter ()++;
     
     os <<
       fArrangers <<
       endl;
       
-    gIndenter--;
+    gIndenter ()--;
         
     emptyHeader = false;
   }
@@ -1136,13 +1136,13 @@ void lpsrHeader::print (ostream& os)
       fLyricists->lilyPondVarValsListAssocKindAsString () << " : " <<
       endl;
       
-    gIndenter++;
+    gIndenter ()++;
     
     os <<
       fLyricists <<
       endl;
       
-    gIndenter--;
+    gIndenter ()--;
         
     emptyHeader = false;
   }
@@ -1153,13 +1153,13 @@ void lpsrHeader::print (ostream& os)
       fPoets->lilyPondVarValsListAssocKindAsString () << " : " <<
       endl;
       
-    gIndenter++;
+    gIndenter ()++;
     
     os <<
       fPoets <<
       endl;
       
-    gIndenter--;
+    gIndenter ()--;
         
     emptyHeader = false;
   }
@@ -1170,13 +1170,13 @@ void lpsrHeader::print (ostream& os)
       fTranslators->lilyPondVarValsListAssocKindAsString () << " : " <<
       endl;
       
-    gIndenter++;
+    gIndenter ()++;
     
     os <<
       fTranslators <<
       endl;
       
-    gIndenter--;
+    gIndenter ()--;
         
     emptyHeader = false;
   }
@@ -1187,13 +1187,13 @@ void lpsrHeader::print (ostream& os)
       fSoftwares->lilyPondVarValsListAssocKindAsString () << " : " <<
       endl;
       
-    gIndenter++;
+    gIndenter ()++;
     
     os <<
       fSoftwares <<
       endl;
       
-    gIndenter--;
+    gIndenter ()--;
         
     emptyHeader = false;
   }
@@ -1204,13 +1204,13 @@ void lpsrHeader::print (ostream& os)
       fScoreInstrument->lilyPondVarValAssocKindAsString () << " : " <<
       endl;
       
-    gIndenter++;
+    gIndenter ()++;
     
     os <<
       fScoreInstrument <<
       endl;
       
-    gIndenter--;
+    gIndenter ()--;
 
     emptyHeader = false;
   }
@@ -1221,13 +1221,13 @@ void lpsrHeader::print (ostream& os)
       fEncodingDate->lilyPondVarValAssocKindAsString () << " : " <<
       endl;
       
-    gIndenter++;
+    gIndenter ()++;
     
     os <<
       fEncodingDate <<
       endl;
       
-    gIndenter--;
+    gIndenter ()--;
 
     emptyHeader = false;
   }
@@ -1238,13 +1238,13 @@ void lpsrHeader::print (ostream& os)
       fMiscellaneousField->lilyPondVarValAssocKindAsString () << " : " <<
       endl;
       
-    gIndenter++;
+    gIndenter ()++;
     
     os <<
       fMiscellaneousField <<
       endl;
       
-    gIndenter--;
+    gIndenter ()--;
 
     emptyHeader = false;
   }
@@ -1256,7 +1256,7 @@ void lpsrHeader::print (ostream& os)
       endl; // JMI
   }
   
-  gIndenter--;
+  gIndenter ()--;
 }
 
 ostream& operator<< (ostream& os, const S_lpsrHeader& elt)
@@ -47,8 +47,8 @@ lpsrLayout::~lpsrLayout ()
 
 void lpsrLayout::acceptIn (basevisitor* v)
 {
-  if (gLpsrOptions->fTraceLpsrVisitors) {
-    gLogIOstream <<
+  if (gLpsrOptions ()->fTraceLpsrVisitors) {
+    gLogIOstream () <<
       "% ==> lpsrLayout::acceptIn ()" <<
       endl;
   }
@@ -58,8 +58,8 @@ void lpsrLayout::acceptIn (basevisitor* v)
       dynamic_cast<visitor<S_lpsrLayout>*> (v)) {
         S_lpsrLayout elem = this;
         
-        if (gLpsrOptions->fTraceLpsrVisitors) {
-          gLogIOstream <<
+        if (gLpsrOptions ()->fTraceLpsrVisitors) {
+          gLogIOstream () <<
             "% ==> Launching lpsrLayout::visitStart ()" <<
             endl;
         }
@@ -69,8 +69,8 @@ void lpsrLayout::acceptIn (basevisitor* v)
 
 void lpsrLayout::acceptOut (basevisitor* v)
 {
-  if (gLpsrOptions->fTraceLpsrVisitors) {
-    gLogIOstream <<
+  if (gLpsrOptions ()->fTraceLpsrVisitors) {
+    gLogIOstream () <<
       "% ==> lpsrLayout::acceptOut ()" <<
       endl;
   }
@@ -80,8 +80,8 @@ void lpsrLayout::acceptOut (basevisitor* v)
       dynamic_cast<visitor<S_lpsrLayout>*> (v)) {
         S_lpsrLayout elem = this;
       
-        if (gLpsrOptions->fTraceLpsrVisitors) {
-          gLogIOstream <<
+        if (gLpsrOptions ()->fTraceLpsrVisitors) {
+          gLogIOstream () <<
             "% ==> Launching lpsrLayout::visitEnd ()" <<
             endl;
         }
@@ -115,7 +115,7 @@ void lpsrLayout::print (ostream& os)
     "Layout" <<
     endl;
 
-  gIndenter++;
+  gIndenter ()++;
 
   const int fieldWidth = 9;
 
@@ -136,7 +136,7 @@ void lpsrLayout::print (ostream& os)
     os << fLpsrSchemeVariables[i];
   } // for
   
-  gIndenter--;
+  gIndenter ()--;
 }
 
 ostream& operator<< (ostream& os, const S_lpsrLayout& lay)
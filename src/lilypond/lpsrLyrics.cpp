@@ -49,8 +49,8 @@ lpsrNewLyricsBlock::~lpsrNewLyricsBlock ()
 
 void lpsrNewLyricsBlock::acceptIn (basevisitor* v)
 {
-  if (gLpsrOptions->fTraceLpsrVisitors) {
-    gLogIOstream <<
+  if (gLpsrOptions ()->fTraceLpsrVisitors) {
+    gLogIOstream () <<
       "% ==> lpsrNewLyricsBlock::acceptIn ()" <<
       endl;
   }
@@ -60,8 +60,8 @@ void lpsrNewLyricsBlock::acceptIn (basevisitor* v)
       dynamic_cast<visitor<S_lpsrNewLyricsBlock>*> (v)) {
         S_lpsrNewLyricsBlock elem = this;
         
-        if (gLpsrOptions->fTraceLpsrVisitors) {
-          gLogIOstream <<
+        if (gLpsrOptions ()->fTraceLpsrVisitors) {
+          gLogIOstream () <<
             "% ==> Launching lpsrNewLyricsBlock::visitStart ()" <<
             endl;
         }
@@ -71,8 +71,8 @@ void lpsrNewLyricsBlock::acceptIn (basevisitor* v)
 
 void lpsrNewLyricsBlock::acceptOut (basevisitor* v)
 {
-  if (gLpsrOptions->fTraceLpsrVisitors) {
-    gLogIOstream <<
+  if (gLpsrOptions ()->fTraceLpsrVisitors) {
+    gLogIOstream () <<
       "% ==> lpsrNewLyricsBlock::acceptOut ()" <<
       endl;
   }
@@ -82,8 +82,8 @@ void lpsrNewLyricsBlock::acceptOut (basevisitor* v)
       dynamic_cast<visitor<S_lpsrNewLyricsBlock>*> (v)) {
         S_lpsrNewLyricsBlock elem = this;
       
-        if (gLpsrOptions->fTraceLpsrVisitors) {
-          gLogIOstream <<
+        if (gLpsrOptions ()->fTraceLpsrVisitors) {
+          gLogIOstream () <<
             "% ==> Launching lpsrNewLyricsBlock::visitEnd ()" <<
             endl;
         }
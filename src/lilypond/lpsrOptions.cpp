@@ -80,7 +80,7 @@ void optionsLpsrPitchesLanguageItem::print (ostream& os) const
     "OptionsLpsrPitchesLanguageItem:" <<
     endl;
 
-  gIndenter++;
+  gIndenter ()++;
 
   printValuedItemEssentials (
     os, fieldWidth);
@@ -170,7 +170,7 @@ void optionsLpsrChordsLanguageItem::print (ostream& os) const
     "OptionsLpsrChordsLanguageItem:" <<
     endl;
 
-  gIndenter++;
+  gIndenter ()++;
 
   printValuedItemEssentials (
     os, fieldWidth);
@@ -208,10 +208,6 @@ ostream& operator<< (ostream& os, const S_optionsLpsrChordsLanguageItem& elt)
 }
 
 //_______________________________________________________________________________
-S_lpsrOptions gLpsrOptions;
-S_lpsrOptions gLpsrOptionsUserChoices;
-S_lpsrOptions gLpsrOptionsWithDetailedTrace;
-
 S_lpsrOptions lpsrOptions::create (
   S_optionsHandler optionsHandler)
 {
@@ -298,7 +294,15 @@ R"(Write a trace of the LPSR tree visiting activity to standard error.)",
 R"(Write the contents of the LPSR data to standard error.)",
           "displayLpsr",
           fDisplayLpsr,
-          gTraceOptions->fTracePasses));
+          gTraceOptions ()->fTracePasses));
+#else
+    traceAndDisplaySubGroup->
+      appendOptionsItem (
+        optionsBooleanItem::create (
+          "dlpsr", "display-lpsr",
+R"(Write the contents of the LPSR data to standard error.)",
+          "displayLpsr",
+          fDisplayLpsr));
 #endif
   
     traceAndDisplaySubGroup->
@@ -361,16 +365,19 @@ This may come in handy when MusicXML data has been obtained from scanned images.
         " known LPSR pitches languages are:" <<
         endl;
   
-      gIndenter++;
+      gIndenter ()++;
     
       s <<
         existingQuarterTonesPitchesLanguageKinds ();
   
-      gIndenter--;
+      gIndenter ()--;
   
       optionError (s.str ());
     }
   
+    fLpsrChordsLanguageKind =
+      k_IgnatzekChords; // LilyPond default
+      
     // options
     
     S_optionsSubGroup
@@ -483,9 +490,9 @@ bool lpsrOptions::setLpsrChordsLanguage (string language)
   // is language in the chords languages map?
   map<string, lpsrChordsLanguageKind>::const_iterator
     it =
-      gLpsrChordsLanguageKindsMap.find (language);
+      lpsrChordsLanguageKindsMap ().find (language);
         
-  if (it == gLpsrChordsLanguageKindsMap.end ()) {
+  if (it == lpsrChordsLanguageKindsMap ().end ()) {
     // no, language is unknown in the map    
     return false;
   }
@@ -513,21 +520,21 @@ void lpsrOptions::checkOptionsConsistency ()
 //______________________________________________________________________________
 void lpsrOptions::printLpsrOptionsValues (int fieldWidth)
 {
-  gLogIOstream <<
+  gLogIOstream () <<
     "The LPSR options are:" <<
     endl;
 
-  gIndenter++;
+  gIndenter ()++;
   
   // trace and display
   // --------------------------------------
-  gLogIOstream <<
+  gLogIOstream () <<
     "Trace and display:" <<
     endl;
 
-  gIndenter++;
+  gIndenter ()++;
   
-  gLogIOstream << left <<
+  gLogIOstream () << left <<
     setw (fieldWidth) << "traceLpsr" << " : " <<
     booleanAsString (fTraceLpsr) <<
     endl <<
@@ -544,34 +551,34 @@ void lpsrOptions::printLpsrOptionsValues (int fieldWidth)
     booleanAsString (fTraceSchemeFunctions) <<
     endl;
 
-  gIndenter--;
+  gIndenter ()--;
   
   // lyrics vs words
   // --------------------------------------
   
-  gLogIOstream <<
+  gLogIOstream () <<
     "Lyrics vs words:" <<
     endl;
 
-  gIndenter++;
+  gIndenter ()++;
   
-  gLogIOstream << left <<
+  gLogIOstream () << left <<
     setw (fieldWidth) << "addWordsFromTheLyrics" << " : " <<
     booleanAsString (fAddWordsFromTheLyrics) <<
     endl;
 
-  gIndenter--;
+  gIndenter ()--;
 
   // languages
   // --------------------------------------
   
-  gLogIOstream <<
+  gLogIOstream () <<
     "Languages:" <<
     endl;
 
-  gIndenter++;
+  gIndenter ()++;
 
-  gLogIOstream << left <<
+  gLogIOstream () << left <<
     setw (fieldWidth) << "lpsrQuarterTonesPitchesLanguage" << " : \"" <<
     msrQuarterTonesPitchesLanguageKindAsString (
       fLpsrQuarterTonesPitchesLanguageKind) <<
@@ -584,10 +591,10 @@ void lpsrOptions::printLpsrOptionsValues (int fieldWidth)
     "\"" <<
     endl;  
 
-  gIndenter--;
+  gIndenter ()--;
 
   
-  gIndenter--;
+  gIndenter ()--;
 }
 
 S_optionsItem lpsrOptions::handleOptionsItem (
@@ -603,7 +610,7 @@ S_optionsItem lpsrOptions::handleOptionsItem (
         dynamic_cast<optionsLpsrPitchesLanguageItem*>(&(*item))
     ) {
 #ifdef TRACE_OPTIONS
-    if (gTraceOptions->fTraceOptions) {
+    if (gTraceOptions ()->fTraceOptions) {
       os <<
         "==> optionsItem is of type 'optionsLpsrPitchesLanguageItem'" <<
         endl;
@@ -621,7 +628,7 @@ S_optionsItem lpsrOptions::handleOptionsItem (
         dynamic_cast<optionsLpsrChordsLanguageItem*>(&(*item))
     ) {
 #ifdef TRACE_OPTIONS
-    if (gTraceOptions->fTraceOptions) {
+    if (gTraceOptions ()->fTraceOptions) {
       os <<
         "==> optionsItem is of type 'optionsLpsrChordsLanguageItem'" <<
         endl;
@@ -650,7 +657,7 @@ void lpsrOptions::handleOptionsItemValue (
     // is it in the pitches languages map?
 
 #ifdef TRACE_OPTIONS
-    if (gTraceOptions->fTraceOptions) {
+    if (gTraceOptions ()->fTraceOptions) {
       os <<
         "==> optionsItem is of type 'optionsLpsrPitchesLanguageItem'" <<
         endl;
@@ -678,12 +685,12 @@ void lpsrOptions::handleOptionsItemValue (
         " known LPSR pitches languages are:" <<
         endl;
   
-      gIndenter++;
+      gIndenter ()++;
     
       s <<
         existingQuarterTonesPitchesLanguageKinds ();
   
-      gIndenter--;
+      gIndenter ()--;
   
       optionError (s.str ());
       
@@ -706,7 +713,7 @@ void lpsrOptions::handleOptionsItemValue (
     // is it in the chords languages map?
 
 #ifdef TRACE_OPTIONS
-    if (gTraceOptions->fTraceOptions) {
+    if (gTraceOptions ()->fTraceOptions) {
       os <<
         "==> optionsItem is of type 'optionsLpsrChordsLanguageItem'" <<
         endl;
@@ -715,9 +722,9 @@ void lpsrOptions::handleOptionsItemValue (
 
     map<string, lpsrChordsLanguageKind>::const_iterator
       it =
-        gLpsrChordsLanguageKindsMap.find (theString);
+        lpsrChordsLanguageKindsMap ().find (theString);
           
-    if (it == gLpsrChordsLanguageKindsMap.end ()) {
+    if (it == lpsrChordsLanguageKindsMap ().end ()) {
       // no, language is unknown in the map    
       stringstream s;
   
@@ -726,16 +733,16 @@ void lpsrOptions::handleOptionsItemValue (
         " is unknown" <<
         endl <<
         "The " <<
-        gLpsrChordsLanguageKindsMap.size () - 1 <<
+        lpsrChordsLanguageKindsMap ().size () - 1 <<
         " known LPSR chords languages apart from the default Ignatzek are:" <<
         endl;
   
-      gIndenter++;
+      gIndenter ()++;
     
       s <<
         existingLpsrChordsLanguageKinds ();
   
-      gIndenter--;
+      gIndenter ()--;
   
       optionError (s.str ());
       
@@ -763,17 +770,17 @@ void initializeLpsrOptionsHandling (
   // create the options variables
   // ------------------------------------------------------
 
-  gLpsrOptionsUserChoices = lpsrOptions::create (
+  gLpsrOptionsUserChoices () = lpsrOptions::create (
     optionsHandler);
-  assert(gLpsrOptionsUserChoices != 0);
+  assert(gLpsrOptionsUserChoices () != 0);
   
-  gLpsrOptions =
-    gLpsrOptionsUserChoices;
+  gLpsrOptions () =
+    gLpsrOptionsUserChoices ();
 
   // prepare for measure detailed trace
   // ------------------------------------------------------
-  gLpsrOptionsWithDetailedTrace =
-    gLpsrOptions->
+  gLpsrOptionsWithDetailedTrace () =
+    gLpsrOptions ()->
       createCloneWithDetailedTrace ();
 }
 
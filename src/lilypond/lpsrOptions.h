@@ -267,9 +267,9 @@ class lpsrOptions : public optionsGroup
 typedef SMARTP<lpsrOptions> S_lpsrOptions;
 EXP ostream& operator<< (ostream& os, const S_lpsrOptions& elt);
 
-EXP extern S_lpsrOptions gLpsrOptions;
-EXP extern S_lpsrOptions gLpsrOptionsUserChoices;
-EXP extern S_lpsrOptions gLpsrOptionsWithDetailedTrace;
+// gLpsrOptions (), gLpsrOptionsUserChoices () and
+// gLpsrOptionsWithDetailedTrace () are those of the current conversion
+// context, see conversionContext.h
 
 //______________________________________________________________________________
 EXP  void initializeLpsrOptionsHandling (
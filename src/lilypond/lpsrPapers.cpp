@@ -63,8 +63,8 @@ lpsrPaper::~lpsrPaper ()
 void lpsrPaper::setIndent (float val)
 {
 #ifdef TRACE_OPTIONS
-  if (gTraceOptions->fTraceGeometry) {
-    gLogIOstream <<
+  if (gTraceOptions ()->fTraceGeometry) {
+    gLogIOstream () <<
       "Setting paper indent to " << val <<
       endl;
   }
@@ -76,8 +76,8 @@ void lpsrPaper::setIndent (float val)
 void lpsrPaper::setShortIndent (float val)
 {
 #ifdef TRACE_OPTIONS
-  if (gTraceOptions->fTraceGeometry) {
-    gLogIOstream <<
+  if (gTraceOptions ()->fTraceGeometry) {
+    gLogIOstream () <<
       "Setting paper short indent to " << val <<
       endl;
   }
@@ -88,8 +88,8 @@ void lpsrPaper::setShortIndent (float val)
 
 void lpsrPaper::acceptIn (basevisitor* v)
 {
-  if (gLpsrOptions->fTraceLpsrVisitors) {
-    gLogIOstream <<
+  if (gLpsrOptions ()->fTraceLpsrVisitors) {
+    gLogIOstream () <<
       "% ==> lpsrPaper::acceptIn ()" <<
       endl;
   }
@@ -99,8 +99,8 @@ void lpsrPaper::acceptIn (basevisitor* v)
       dynamic_cast<visitor<S_lpsrPaper>*> (v)) {
         S_lpsrPaper elem = this;
         
-        if (gLpsrOptions->fTraceLpsrVisitors) {
-          gLogIOstream <<
+        if (gLpsrOptions ()->fTraceLpsrVisitors) {
+          gLogIOstream () <<
             "% ==> Launching lpsrPaper::visitStart ()" <<
             endl;
         }
@@ -110,8 +110,8 @@ void lpsrPaper::acceptIn (basevisitor* v)
 
 void lpsrPaper::acceptOut (basevisitor* v)
 {
-  if (gLpsrOptions->fTraceLpsrVisitors) {
-    gLogIOstream <<
+  if (gLpsrOptions ()->fTraceLpsrVisitors) {
+    gLogIOstream () <<
       "% ==> lpsrPaper::acceptOut ()" <<
       endl;
   }
@@ -121,8 +121,8 @@ void lpsrPaper::acceptOut (basevisitor* v)
       dynamic_cast<visitor<S_lpsrPaper>*> (v)) {
         S_lpsrPaper elem = this;
       
-        if (gLpsrOptions->fTraceLpsrVisitors) {
-          gLogIOstream <<
+        if (gLpsrOptions ()->fTraceLpsrVisitors) {
+          gLogIOstream () <<
             "% ==> Launching lpsrPaper::visitEnd ()" <<
             endl;
         }
@@ -140,7 +140,7 @@ void lpsrPaper::print (ostream& os) {
 
   bool emptyPaper = true;
 
-  gIndenter++;
+  gIndenter ()++;
 
   const int fieldWidth = 20;
   
@@ -299,7 +299,7 @@ void lpsrPaper::print (ostream& os) {
       endl;
   }
   
-  gIndenter--;
+  gIndenter ()--;
 }
 
 ostream& operator<< (ostream& os, const S_lpsrPaper& pap) {
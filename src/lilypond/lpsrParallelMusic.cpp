@@ -59,8 +59,8 @@ lpsrParallelMusicBLock::~lpsrParallelMusicBLock ()
 
 void lpsrParallelMusicBLock::acceptIn (basevisitor* v)
 {
-  if (gLpsrOptions->fTraceLpsrVisitors) {
-    gLogIOstream <<
+  if (gLpsrOptions ()->fTraceLpsrVisitors) {
+    gLogIOstream () <<
       "% ==> lpsrParallelMusicBLock::acceptIn ()" <<
       endl;
   }
@@ -70,8 +70,8 @@ void lpsrParallelMusicBLock::acceptIn (basevisitor* v)
       dynamic_cast<visitor<S_lpsrParallelMusicBLock>*> (v)) {
         S_lpsrParallelMusicBLock elem = this;
         
-        if (gLpsrOptions->fTraceLpsrVisitors) {
-          gLogIOstream <<
+        if (gLpsrOptions ()->fTraceLpsrVisitors) {
+          gLogIOstream () <<
             "% ==> Launching lpsrParallelMusicBLock::visitStart ()" <<
             endl;
         }
@@ -81,8 +81,8 @@ void lpsrParallelMusicBLock::acceptIn (basevisitor* v)
 
 void lpsrParallelMusicBLock::acceptOut (basevisitor* v)
 {
-  if (gLpsrOptions->fTraceLpsrVisitors) {
-    gLogIOstream <<
+  if (gLpsrOptions ()->fTraceLpsrVisitors) {
+    gLogIOstream () <<
       "% ==> lpsrParallelMusicBLock::acceptOut ()" <<
       endl;
   }
@@ -92,8 +92,8 @@ void lpsrParallelMusicBLock::acceptOut (basevisitor* v)
       dynamic_cast<visitor<S_lpsrParallelMusicBLock>*> (v)) {
         S_lpsrParallelMusicBLock elem = this;
       
-        if (gLpsrOptions->fTraceLpsrVisitors) {
-          gLogIOstream <<
+        if (gLpsrOptions ()->fTraceLpsrVisitors) {
+          gLogIOstream () <<
             "% ==> Launching lpsrParallelMusicBLock::visitEnd ()" <<
             endl;
         }
@@ -103,8 +103,8 @@ void lpsrParallelMusicBLock::acceptOut (basevisitor* v)
 
 void lpsrParallelMusicBLock::browseData (basevisitor* v)
 {
-  if (gLpsrOptions->fTraceLpsrVisitors) {
-    gLogIOstream <<
+  if (gLpsrOptions ()->fTraceLpsrVisitors) {
+    gLogIOstream () <<
       "% ==> lpsrParallelMusicBLock::browseData ()" <<
       endl;
   }
@@ -119,8 +119,8 @@ void lpsrParallelMusicBLock::browseData (basevisitor* v)
     browser.browse (*(*i));
   } // for
 
-  if (gLpsrOptions->fTraceLpsrVisitors) {
-    gLogIOstream <<
+  if (gLpsrOptions ()->fTraceLpsrVisitors) {
+    gLogIOstream () <<
       "% <== lpsrParallelMusicBLock::browseData ()" <<
       endl;
   }
@@ -135,7 +135,7 @@ void lpsrParallelMusicBLock::print (ostream& os)
       fParallelMusicBLockPartGroupBlocks.size (), "part group", "part groups") <<
     endl;
   
-  gIndenter++;
+  gIndenter ()++;
   
   for (
     list<S_lpsrPartGroupBlock>::const_iterator i =
@@ -145,7 +145,7 @@ void lpsrParallelMusicBLock::print (ostream& os)
     os << (*i);
   } // for
 
-  gIndenter--;
+  gIndenter ()--;
 }
 
 ostream& operator<< (ostream& os, const S_lpsrParallelMusicBLock& elt)
@@ -42,8 +42,8 @@ lpsrPartGroupBlock::~lpsrPartGroupBlock ()
 
 void lpsrPartGroupBlock::acceptIn (basevisitor* v)
 {
-  if (gLpsrOptions->fTraceLpsrVisitors) {
-    gLogIOstream <<
+  if (gLpsrOptions ()->fTraceLpsrVisitors) {
+    gLogIOstream () <<
       "% ==> lpsrPartGroupBlock::acceptIn ()" <<
       endl;
   }
@@ -53,8 +53,8 @@ void lpsrPartGroupBlock::acceptIn (basevisitor* v)
       dynamic_cast<visitor<S_lpsrPartGroupBlock>*> (v)) {
         S_lpsrPartGroupBlock elem = this;
         
-        if (gLpsrOptions->fTraceLpsrVisitors) {
-          gLogIOstream <<
+        if (gLpsrOptions ()->fTraceLpsrVisitors) {
+          gLogIOstream () <<
             "% ==> Launching lpsrPartGroupBlock::visitStart ()" <<
             endl;
         }
@@ -64,8 +64,8 @@ void lpsrPartGroupBlock::acceptIn (basevisitor* v)
 
 void lpsrPartGroupBlock::acceptOut (basevisitor* v)
 {
-  if (gLpsrOptions->fTraceLpsrVisitors) {
-    gLogIOstream <<
+  if (gLpsrOptions ()->fTraceLpsrVisitors) {
+    gLogIOstream () <<
       "% ==> lpsrPartGroupBlock::acceptOut ()" <<
       endl;
   }
@@ -75,8 +75,8 @@ void lpsrPartGroupBlock::acceptOut (basevisitor* v)
       dynamic_cast<visitor<S_lpsrPartGroupBlock>*> (v)) {
         S_lpsrPartGroupBlock elem = this;
       
-        if (gLpsrOptions->fTraceLpsrVisitors) {
-          gLogIOstream <<
+        if (gLpsrOptions ()->fTraceLpsrVisitors) {
+          gLogIOstream () <<
             "% ==> Launching lpsrPartGroupBlock::visitEnd ()" <<
             endl;
         }
@@ -86,8 +86,8 @@ void lpsrPartGroupBlock::acceptOut (basevisitor* v)
 
 void lpsrPartGroupBlock::browseData (basevisitor* v)
 {
-  if (gLpsrOptions->fTraceLpsrVisitors) {
-    gLogIOstream <<
+  if (gLpsrOptions ()->fTraceLpsrVisitors) {
+    gLogIOstream () <<
       "% ==> lpsrPartGroupBlock::browseData ()" <<
       endl;
   }
@@ -101,8 +101,8 @@ void lpsrPartGroupBlock::browseData (basevisitor* v)
     browser.browse (*(*i));
   } // for
 
-  if (gLpsrOptions->fTraceLpsrVisitors) {
-    gLogIOstream <<
+  if (gLpsrOptions ()->fTraceLpsrVisitors) {
+    gLogIOstream () <<
       "% <== lpsrPartGroupBlock::browseData ()" <<
       endl;
   }
@@ -127,7 +127,7 @@ void lpsrPartGroupBlock::print (ostream& os)
     endl <<
     endl;
 
-  gIndenter++;
+  gIndenter ()++;
 
   if (fPartGroupBlockElements.size ()) {  
     list<S_msrElement>::const_iterator
@@ -141,7 +141,7 @@ void lpsrPartGroupBlock::print (ostream& os)
     } // for
   }
 
-  gIndenter--;
+  gIndenter ()--;
 }
 
 
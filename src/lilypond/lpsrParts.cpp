@@ -107,14 +107,14 @@ bool lpsrPartBlock::compareStaffBlockWithOtherElement (
       " is not a staff nor a chord names or figured bass context";
 
     msrInternalError (
-      gXml2lyOptions->fInputSourceName,
+      gXml2lyOptions ()->fInputSourceName,
       otherElement->getInputLineNumber (),
       __FILE__, __LINE__,
       s.str ());
   }
 
 /* JMI
-  gLogIOstream <<
+  gLogIOstream () <<
     endl <<
     "!!!!!!!!!!!!!!!!!!!!!!!!!" <<
     endl <<
@@ -225,14 +225,14 @@ bool lpsrPartBlock::compareChordNamesContextWithOtherElement (
       " is not a staff nor a chord names or figured bass context";
 
     msrInternalError (
-      gXml2lyOptions->fInputSourceName,
+      gXml2lyOptions ()->fInputSourceName,
       otherElement->getInputLineNumber (),
       __FILE__, __LINE__,
       s.str ());
   }
 
 /* JMI
-  gLogIOstream <<
+  gLogIOstream () <<
     endl <<
     "!!!!!!!!!!!!!!!!!!!!!!!!!" <<
     endl <<
@@ -298,7 +298,7 @@ bool lpsrPartBlock::compareElementsToHaveHarmoniesAboveCorrespondingStaff (
       " is not a staff nor a chord names or figured bass context";
 
     msrInternalError (
-      gXml2lyOptions->fInputSourceName,
+      gXml2lyOptions ()->fInputSourceName,
       first->getInputLineNumber (),
       __FILE__, __LINE__,
       s.str ());
@@ -322,8 +322,8 @@ void lpsrPartBlock::appendChordNamesContextToPartBlock (
 
   // sort the list if necessary
 #ifdef TRACE_OPTIONS
-  if (gTraceOptions->fTraceParts || gTraceOptions->fTraceHarmonies) {
-    gLogIOstream <<
+  if (gTraceOptions ()->fTraceParts || gTraceOptions ()->fTraceHarmonies) {
+    gLogIOstream () <<
       "Sorting the voices in part block for part \"" <<
       fPart->getPartCombinedName () << "\"" <<
       ", line " << inputLineNumber <<
@@ -332,7 +332,7 @@ void lpsrPartBlock::appendChordNamesContextToPartBlock (
 #endif
 
 /* JMI
-  gLogIOstream <<
+  gLogIOstream () <<
     endl <<
     endl <<
     "@@@@@@@@@@@@@@@@ fPartBlockElementsList contains initially:" <<
@@ -346,11 +346,11 @@ void lpsrPartBlock::appendChordNamesContextToPartBlock (
     S_msrElement
       element = (*i);
       
-    gLogIOstream <<
+    gLogIOstream () <<
       element->asShortString () <<
       endl;
   } // for
-  gLogIOstream <<
+  gLogIOstream () <<
     endl <<
     endl;
 */
@@ -363,7 +363,7 @@ void lpsrPartBlock::appendChordNamesContextToPartBlock (
   }
 
 /* JMI
-  gLogIOstream <<
+  gLogIOstream () <<
     endl <<
     endl <<
     "@@@@@@@@@@@@@@@@ fPartBlockElementsList contains after sort:" <<
@@ -377,11 +377,11 @@ void lpsrPartBlock::appendChordNamesContextToPartBlock (
     S_msrElement
       element = (*i);
       
-    gLogIOstream <<
+    gLogIOstream () <<
       element->asShortString () <<
       endl;
   } // for
-  gLogIOstream <<
+  gLogIOstream () <<
     endl <<
     endl;
 */
@@ -395,8 +395,8 @@ void lpsrPartBlock::appendFiguredBassContextToPartBlock (
 
 void lpsrPartBlock::acceptIn (basevisitor* v)
 {
-  if (gLpsrOptions->fTraceLpsrVisitors) {
-    gLogIOstream <<
+  if (gLpsrOptions ()->fTraceLpsrVisitors) {
+    gLogIOstream () <<
       "% ==> lpsrPartBlock::acceptIn ()" <<
       endl;
   }
@@ -406,8 +406,8 @@ void lpsrPartBlock::acceptIn (basevisitor* v)
       dynamic_cast<visitor<S_lpsrPartBlock>*> (v)) {
         S_lpsrPartBlock elem = this;
         
-        if (gLpsrOptions->fTraceLpsrVisitors) {
-          gLogIOstream <<
+        if (gLpsrOptions ()->fTraceLpsrVisitors) {
+          gLogIOstream () <<
             "% ==> Launching lpsrPartBlock::visitStart ()" <<
             endl;
         }
@@ -417,8 +417,8 @@ void lpsrPartBlock::acceptIn (basevisitor* v)
 
 void lpsrPartBlock::acceptOut (basevisitor* v)
 {
-  if (gLpsrOptions->fTraceLpsrVisitors) {
-    gLogIOstream <<
+  if (gLpsrOptions ()->fTraceLpsrVisitors) {
+    gLogIOstream () <<
       "% ==> lpsrPartBlock::acceptOut ()" <<
       endl;
   }
@@ -428,8 +428,8 @@ void lpsrPartBlock::acceptOut (basevisitor* v)
       dynamic_cast<visitor<S_lpsrPartBlock>*> (v)) {
         S_lpsrPartBlock elem = this;
       
-        if (gLpsrOptions->fTraceLpsrVisitors) {
-          gLogIOstream <<
+        if (gLpsrOptions ()->fTraceLpsrVisitors) {
+          gLogIOstream () <<
             "% ==> Launching lpsrPartBlock::visitEnd ()" <<
             endl;
         }
@@ -439,8 +439,8 @@ void lpsrPartBlock::acceptOut (basevisitor* v)
 
 void lpsrPartBlock::browseData (basevisitor* v)
 {
-  if (gLpsrOptions->fTraceLpsrVisitors) {
-    gLogIOstream <<
+  if (gLpsrOptions ()->fTraceLpsrVisitors) {
+    gLogIOstream () <<
       "% ==> lpsrPartBlock::browseData ()" <<
       endl;
   }
@@ -454,8 +454,8 @@ void lpsrPartBlock::browseData (basevisitor* v)
     browser.browse (*(*i));
   } // for
 
-  if (gLpsrOptions->fTraceLpsrVisitors) {
-    gLogIOstream <<
+  if (gLpsrOptions ()->fTraceLpsrVisitors) {
+    gLogIOstream () <<
       "% <== lpsrPartBlock::browseData ()" <<
       endl;
   }
@@ -471,7 +471,7 @@ void lpsrPartBlock::print (ostream& os)
       fPartBlockElementsList.size (), "element", "elements") <<
     endl;
 
-  gIndenter++;
+  gIndenter ()++;
 
   const int fieldWidth = 28;
 
@@ -506,7 +506,7 @@ void lpsrPartBlock::print (ostream& os)
     } // for
   }
 
-  gIndenter--;
+  gIndenter ()--;
 }
 
 ostream& operator<< (ostream& os, const S_lpsrPartBlock& scr)
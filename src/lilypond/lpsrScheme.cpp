@@ -103,8 +103,8 @@ string lpsrSchemeVariable::endlKindAsString (
 
 void lpsrSchemeVariable::acceptIn (basevisitor* v)
 {
-  if (gLpsrOptions->fTraceLpsrVisitors) {
-    gLogIOstream <<
+  if (gLpsrOptions ()->fTraceLpsrVisitors) {
+    gLogIOstream () <<
       "% ==> lpsrSchemeVariable::acceptIn ()" <<
       endl;
   }
@@ -114,8 +114,8 @@ void lpsrSchemeVariable::acceptIn (basevisitor* v)
       dynamic_cast<visitor<S_lpsrSchemeVariable>*> (v)) {
         S_lpsrSchemeVariable elem = this;
         
-        if (gLpsrOptions->fTraceLpsrVisitors) {
-          gLogIOstream <<
+        if (gLpsrOptions ()->fTraceLpsrVisitors) {
+          gLogIOstream () <<
             "% ==> Launching lpsrSchemeVariable::visitStart ()" <<
             endl;
         }
@@ -125,8 +125,8 @@ void lpsrSchemeVariable::acceptIn (basevisitor* v)
 
 void lpsrSchemeVariable::acceptOut (basevisitor* v)
 {
-  if (gLpsrOptions->fTraceLpsrVisitors) {
-    gLogIOstream <<
+  if (gLpsrOptions ()->fTraceLpsrVisitors) {
+    gLogIOstream () <<
       "% ==> lpsrSchemeVariable::acceptOut ()" <<
       endl;
   }
@@ -136,8 +136,8 @@ void lpsrSchemeVariable::acceptOut (basevisitor* v)
       dynamic_cast<visitor<S_lpsrSchemeVariable>*> (v)) {
         S_lpsrSchemeVariable elem = this;
       
-        if (gLpsrOptions->fTraceLpsrVisitors) {
-          gLogIOstream <<
+        if (gLpsrOptions ()->fTraceLpsrVisitors) {
+          gLogIOstream () <<
             "% ==> Launching lpsrSchemeVariable::visitEnd ()" <<
             endl;
         }
@@ -154,7 +154,7 @@ void lpsrSchemeVariable::print (ostream& os)
     "SchemeVariable" <<
     endl;
 
-  gIndenter++;
+  gIndenter ()++;
 
   // escape quotes if any
   string variableName;
@@ -196,7 +196,7 @@ void lpsrSchemeVariable::print (ostream& os)
     endlKindAsString (fEndlKind) <<
     endl;
   
-  gIndenter--;
+  gIndenter ()--;
 }
 
 ostream& operator<< (ostream& os, const S_lpsrSchemeVariable& assoc)
@@ -237,8 +237,8 @@ lpsrSchemeFunction::~lpsrSchemeFunction ()
 
 void lpsrSchemeFunction::acceptIn (basevisitor* v)
 {
-  if (gLpsrOptions->fTraceLpsrVisitors) {
-    gLogIOstream <<
+  if (gLpsrOptions ()->fTraceLpsrVisitors) {
+    gLogIOstream () <<
       "% ==> lpsrSchemeFunction::acceptIn ()" <<
       endl;
   }
@@ -248,8 +248,8 @@ void lpsrSchemeFunction::acceptIn (basevisitor* v)
       dynamic_cast<visitor<S_lpsrSchemeFunction>*> (v)) {
         S_lpsrSchemeFunction elem = this;
         
-        if (gLpsrOptions->fTraceLpsrVisitors) {
-          gLogIOstream <<
+        if (gLpsrOptions ()->fTraceLpsrVisitors) {
+          gLogIOstream () <<
             "% ==> Launching lpsrSchemeFunction::visitStart ()" <<
             endl;
         }
@@ -259,8 +259,8 @@ void lpsrSchemeFunction::acceptIn (basevisitor* v)
 
 void lpsrSchemeFunction::acceptOut (basevisitor* v)
 {
-  if (gLpsrOptions->fTraceLpsrVisitors) {
-    gLogIOstream <<
+  if (gLpsrOptions ()->fTraceLpsrVisitors) {
+    gLogIOstream () <<
       "% ==> lpsrSchemeFunction::acceptOut ()" <<
       endl;
   }
@@ -270,8 +270,8 @@ void lpsrSchemeFunction::acceptOut (basevisitor* v)
       dynamic_cast<visitor<S_lpsrSchemeFunction>*> (v)) {
         S_lpsrSchemeFunction elem = this;
       
-        if (gLpsrOptions->fTraceLpsrVisitors) {
-          gLogIOstream <<
+        if (gLpsrOptions ()->fTraceLpsrVisitors) {
+          gLogIOstream () <<
             "% ==> Launching lpsrSchemeFunction::visitEnd ()" <<
             endl;
         }
@@ -288,7 +288,7 @@ void lpsrSchemeFunction::print (ostream& os)
     "SchemeFunction" <<
     endl;
 
-  gIndenter++;
+  gIndenter ()++;
 
   // print resulting strings
   os <<
@@ -299,7 +299,7 @@ void lpsrSchemeFunction::print (ostream& os)
     "function code: \"" << fFunctionCode << "\"" <<
     endl;
 
-  gIndenter--;
+  gIndenter ()--;
 }
 
 ostream& operator<< (ostream& os, const S_lpsrSchemeFunction& assoc)
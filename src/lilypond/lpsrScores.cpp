@@ -53,8 +53,8 @@ lpsrScoreBlock::lpsrScoreBlock (
       inputLineNumber);
   
   // create the score command midi
-  string midiTempoDuration  = gLilypondOptions->fMidiTempo.first;
-  int    midiTempoPerSecond = gLilypondOptions->fMidiTempo.second;
+  string midiTempoDuration  = gLilypondOptions ()->fMidiTempo.first;
+  int    midiTempoPerSecond = gLilypondOptions ()->fMidiTempo.second;
   
   fScoreBlockMidi =
     msrMidi::create (
@@ -70,8 +70,8 @@ void lpsrScoreBlock::appendPartGroupBlockToScoreBlock (
   S_lpsrPartGroupBlock partGroupBlock)
 {
 #ifdef TRACE_OPTIONS
-  if (gTraceOptions->fTracePartGroups) {
-    gLogIOstream <<
+  if (gTraceOptions ()->fTracePartGroups) {
+    gLogIOstream () <<
       "Appending part group block " <<
        partGroupBlock-> getPartGroup ()-> getPartGroupCombinedName () <<
        " to LPSR score" <<
@@ -91,8 +91,8 @@ void lpsrScoreBlock::appendVoiceUseToParallelMusicBLock (
   S_lpsrUseVoiceCommand voiceUse)
 {
 #ifdef TRACE_OPTIONS
-  if (gTraceOptions->fTraceVoices) {
-    gLogIOstream <<
+  if (gTraceOptions ()->fTraceVoices) {
+    gLogIOstream () <<
       "Appending the use of voice \"" <<
        voiceUse-> getVoice ()-> getVoiceName () <<
        "\" to LPSR score" <<
@@ -110,8 +110,8 @@ void lpsrScoreBlock::appendLyricsUseToParallelMusicBLock (
   S_lpsrNewLyricsBlock lyricsUse)
 {
 #ifdef TRACE_OPTIONS
-  if (gTraceOptions->fTraceLyrics) {
-    gLogIOstream <<
+  if (gTraceOptions ()->fTraceLyrics) {
+    gLogIOstream () <<
       "Appending the use of stanza " <<
        lyricsUse-> getStanza ()-> getStanzaName () <<
        " to LPSR score" <<
@@ -126,8 +126,8 @@ void lpsrScoreBlock::appendLyricsUseToParallelMusicBLock (
 
 void lpsrScoreBlock::acceptIn (basevisitor* v)
 {
-  if (gLpsrOptions->fTraceLpsrVisitors) {
-    gLogIOstream <<
+  if (gLpsrOptions ()->fTraceLpsrVisitors) {
+    gLogIOstream () <<
       "% ==> lpsrScoreBlock::acceptIn ()" <<
       endl;
   }
@@ -137,8 +137,8 @@ void lpsrScoreBlock::acceptIn (basevisitor* v)
       dynamic_cast<visitor<S_lpsrScoreBlock>*> (v)) {
         S_lpsrScoreBlock elem = this;
         
-        if (gLpsrOptions->fTraceLpsrVisitors) {
-          gLogIOstream <<
+        if (gLpsrOptions ()->fTraceLpsrVisitors) {
+          gLogIOstream () <<
             "% ==> Launching lpsrScoreBlock::visitStart ()" <<
             endl;
         }
@@ -148,8 +148,8 @@ void lpsrScoreBlock::acceptIn (basevisitor* v)
 
 void lpsrScoreBlock::acceptOut (basevisitor* v)
 {
-  if (gLpsrOptions->fTraceLpsrVisitors) {
-    gLogIOstream <<
+  if (gLpsrOptions ()->fTraceLpsrVisitors) {
+    gLogIOstream () <<
       "% ==> lpsrScoreBlock::acceptOut ()" <<
       endl;
   }
@@ -159,8 +159,8 @@ void lpsrScoreBlock::acceptOut (basevisitor* v)
       dynamic_cast<visitor<S_lpsrScoreBlock>*> (v)) {
         S_lpsrScoreBlock elem = this;
       
-        if (gLpsrOptions->fTraceLpsrVisitors) {
-          gLogIOstream <<
+        if (gLpsrOptions ()->fTraceLpsrVisitors) {
+          gLogIOstream () <<
             "% ==> Launching lpsrScoreBlock::visitEnd ()" <<
             endl;
         }
@@ -170,8 +170,8 @@ void lpsrScoreBlock::acceptOut (basevisitor* v)
 
 void lpsrScoreBlock::browseData (basevisitor* v)
 {
-  if (gLpsrOptions->fTraceLpsrVisitors) {
-    gLogIOstream <<
+  if (gLpsrOptions ()->fTraceLpsrVisitors) {
+    gLogIOstream () <<
       "% ==> lpsrScoreBlock::browseData ()" <<
       endl;
   }
@@ -204,8 +204,8 @@ void lpsrScoreBlock::browseData (basevisitor* v)
     browser.browse (*fScoreBlockMidi);
   }
 
-  if (gLpsrOptions->fTraceLpsrVisitors) {
-    gLogIOstream <<
+  if (gLpsrOptions ()->fTraceLpsrVisitors) {
+    gLogIOstream () <<
       "% <== lpsrScoreBlock::browseData ()" <<
       endl;
   }
@@ -215,7 +215,7 @@ void lpsrScoreBlock::print (ostream& os)
 {
   os << "ScoreBlock" << endl << endl;
 
-  gIndenter++;
+  gIndenter ()++;
 
   os <<
     fScoreBlockParallelMusicBLock <<
@@ -229,7 +229,7 @@ void lpsrScoreBlock::print (ostream& os)
     fScoreBlockMidi <<
     endl;
 
-  gIndenter--;
+  gIndenter ()--;
 }
 
 ostream& operator<< (ostream& os, const S_lpsrScoreBlock& scr)
@@ -272,7 +272,7 @@ lpsrScore::lpsrScore (
 
   // should the initial comments about xml2ly and the options used
   // be generated?
-  if (gLilypondOptions->fXml2lyInfos) {
+  if (gLilypondOptions ()->fXml2lyInfos) {
     // create the input source name comment
     {
       stringstream s;
@@ -281,16 +281,16 @@ lpsrScore::lpsrScore (
         "Generated by xml2ly " << currentVersionNumber () <<
         " from ";
     
-      if (gXml2lyOptions->fInputSourceName == "-") {
+      if (gXml2lyOptions ()->fInputSourceName == "-") {
         s << "standard input";
       }
       else {
-        s << "\"" << gXml2lyOptions->fInputSourceName << "\"";
+        s << "\"" << gXml2lyOptions ()->fInputSourceName << "\"";
       }
     
       s <<
         endl <<
-        "% on " << gXml2lyOptions->fTranslationDate <<
+        "% on " << gXml2lyOptions ()->fTranslationDate <<
         endl;
   
       fInputSourceNameComment =
@@ -317,9 +317,9 @@ lpsrScore::lpsrScore (
     // do the command line long and short options differ?
     bool
       longAndShortOptionsDiffer =
-      gGeneralOptions->fCommandLineWithShortOptions
+      gGeneralOptions ()->fCommandLineWithShortOptions
         !=
-      gGeneralOptions->fCommandLineWithLongOptions;
+      gGeneralOptions ()->fCommandLineWithLongOptions;
 
     
   // create the command line long options comment
@@ -327,8 +327,8 @@ lpsrScore::lpsrScore (
     stringstream s;
     
     s <<
-      gTab <<
-      gGeneralOptions->fCommandLineWithLongOptions;
+      gTab () <<
+      gGeneralOptions ()->fCommandLineWithLongOptions;
   
     if (longAndShortOptionsDiffer) {
       s <<
@@ -350,8 +350,8 @@ lpsrScore::lpsrScore (
     stringstream s;
     
     s <<
-      gTab <<
-      gGeneralOptions->fCommandLineWithShortOptions;
+      gTab () <<
+      gGeneralOptions ()->fCommandLineWithShortOptions;
     
     fCommandLineShortOptionsComment =
       lpsrComment::create (
@@ -372,27 +372,32 @@ lpsrScore::lpsrScore (
       lpsrSchemeVariable::kWithEndlTwice);
 
   // initialize Scheme functions informations
-  fTongueSchemeFunctionIsNeeded              = false;
-  fCustomShortBarLineSchemeFunctionIsNeeded  = false;
-  fEditorialAccidentalSchemeFunctionIsNeeded = false;
-
-  if (gLilypondOptions->fLilypondCompileDate) {
+  fTongueSchemeFunctionIsNeeded                = false;
+  fCustomShortBarLineSchemeFunctionIsNeeded    = false;
+  fEditorialAccidentalSchemeFunctionIsNeeded   = false;
+  fDynamicsSchemeFunctionIsNeeded              = false;
+  fTupletsCurvedBracketsSchemeFunctionIsNeeded = false;
+  fAfterSchemeFunctionIsNeeded                 = false;
+  fTempoRelationshipSchemeFunctionIsNeeded     = false;
+  fGlissandoWithTextSchemeFunctionIsNeeded     = false;
+
+  if (gLilypondOptions ()->fLilypondCompileDate) {
     // create the date and time functions
     addDateAndTimeSchemeFunctionsToScore ();
   }
 
-  if (gLilypondOptions->fPointAndClickOff) {
+  if (gLilypondOptions ()->fPointAndClickOff) {
     // create the pointAndClickOff command
     addPointAndClickOffSchemeFunctionsToScore ();
   }
 
-  if (gLilypondOptions->fPointAndClickOff) {
+  if (gLilypondOptions ()->fPointAndClickOff) {
     // create the glissandoWithText command
     addGlissandoWithTextSchemeFunctionsToScore ();
   }
 
 
-  if (gLilypondOptions->fJianpu) {
+  if (gLilypondOptions ()->fJianpu) {
     // create the Jianpu include command JMI
   }
 
@@ -407,7 +412,7 @@ lpsrScore::lpsrScore (
     lpsrPaper::create (
       inputLineNumber);
 
-  if (gLilypondOptions->fLilypondCompileDate) {
+  if (gLilypondOptions ()->fLilypondCompileDate) {
     // define headers and footers
     
     fPaper->
@@ -480,7 +485,7 @@ R"(
   {
     lpsrVarValAssoc::lpsrCommentedKind
       commentedKind =
-        gLilypondOptions->fIgnoreLineBreaks
+        gLilypondOptions ()->fIgnoreLineBreaks
           ? lpsrVarValAssoc::kCommented
           : lpsrVarValAssoc::kUncommented;
   
@@ -502,7 +507,7 @@ R"(
   {
     lpsrVarValAssoc::lpsrCommentedKind
       commentedKind =
-        gLilypondOptions->fIgnoreLineBreaks
+        gLilypondOptions ()->fIgnoreLineBreaks
           ? lpsrVarValAssoc::kUncommented
           : lpsrVarValAssoc::kCommented;
   
@@ -524,7 +529,7 @@ R"(
   {
     lpsrVarValAssoc::lpsrCommentedKind
       commentedKind =
-        gLilypondOptions->fIgnoreLineBreaks
+        gLilypondOptions ()->fIgnoreLineBreaks
           ? lpsrVarValAssoc::kCommented
           : lpsrVarValAssoc::kUncommented;
   
@@ -546,7 +551,7 @@ R"(
   {
     lpsrVarValAssoc::lpsrCommentedKind
       commentedKind =
-        gLilypondOptions->fIgnoreLineBreaks
+        gLilypondOptions ()->fIgnoreLineBreaks
           ? lpsrVarValAssoc::kUncommented
           : lpsrVarValAssoc::kCommented;
   
@@ -564,7 +569,7 @@ R"(
         lpsrVarValAssoc::kWithEndl);
   }
 
-  if (gLilypondOptions->fGlobal) {
+  if (gLilypondOptions ()->fGlobal) {
     // create the 'global' assoc
     fGlobalAssoc =
       lpsrVarValAssoc::create (
@@ -741,8 +746,8 @@ R"(
 #(define modTimeAsString (strftime "%d/%m/%Y - %H:%M:%S" (localtime modTime)))
 )";
 
-  if (gLpsrOptions->fTraceSchemeFunctions) {
-    gLogIOstream <<
+  if (gLpsrOptions ()->fTraceSchemeFunctions) {
+    gLogIOstream () <<
       "Creating Scheme functions for '" << schemeFunctionName << "'" <<
       endl;
   }
@@ -777,8 +782,8 @@ R"(
 \pointAndClickOff
 )";
 
-  if (gLpsrOptions->fTraceSchemeFunctions) {
-    gLogIOstream <<
+  if (gLpsrOptions ()->fTraceSchemeFunctions) {
+    gLogIOstream () <<
       "Creating Scheme functions for '" << schemeFunctionName << "'" <<
       endl;
   }
@@ -959,8 +964,8 @@ glissandoTextOn =
 glissandoTextOff = \revert Glissando.stencil
 )";
 
-  if (gLpsrOptions->fTraceSchemeFunctions) {
-    gLogIOstream <<
+  if (gLpsrOptions ()->fTraceSchemeFunctions) {
+    gLogIOstream () <<
       "Creating Scheme functions for '" << schemeFunctionName << "'" <<
       endl;
   }
@@ -1010,8 +1015,8 @@ R"(
 )";
 
 
-  if (gLpsrOptions->fTraceSchemeFunctions) {
-    gLogIOstream <<
+  if (gLpsrOptions ()->fTraceSchemeFunctions) {
+    gLogIOstream () <<
       "Including Jianpu definition file '" << schemeModulesName << "'" <<
       endl;
   }
@@ -1047,8 +1052,8 @@ R"(
 \include "jianpu10a.ly"
 )";
   
-  if (gLpsrOptions->fTraceSchemeFunctions) {
-    gLogIOstream <<
+  if (gLpsrOptions ()->fTraceSchemeFunctions) {
+    gLogIOstream () <<
       "Including Jianpu definition file '" << schemeModulesName << "'" <<
       endl;
   }
@@ -1083,8 +1088,8 @@ R"(
 #(use-modules (scm accreg))
 )";
 
-  if (gLpsrOptions->fTraceSchemeFunctions) {
-    gLogIOstream <<
+  if (gLpsrOptions ()->fTraceSchemeFunctions) {
+    gLogIOstream () <<
       "Using Scheme modules '" << schemeModulesName << "'" <<
       endl;
   }
@@ -1134,8 +1139,8 @@ tongue =
      script))
 )";
 
-  if (gLpsrOptions->fTraceSchemeFunctions) {
-    gLogIOstream <<
+  if (gLpsrOptions ()->fTraceSchemeFunctions) {
+    gLogIOstream () <<
       "Creating Scheme function '" << schemeFunctionName << "'" <<
       endl;
   }
@@ -1179,8 +1184,8 @@ editorialAccidental =
   #})
 )";
 
-  if (gLpsrOptions->fTraceSchemeFunctions) {
-    gLogIOstream <<
+  if (gLpsrOptions ()->fTraceSchemeFunctions) {
+    gLogIOstream () <<
       "Creating Scheme function '" << schemeFunctionName << "'" <<
       endl;
   }
@@ -1221,8 +1226,8 @@ fffff = #(make-dynamic-script "fffff")
 ffffff = #(make-dynamic-script "ffffff")
 )";
 
-  if (gLpsrOptions->fTraceSchemeFunctions) {
-    gLogIOstream <<
+  if (gLpsrOptions ()->fTraceSchemeFunctions) {
+    gLogIOstream () <<
       "Creating Scheme function '" << schemeFunctionName << "'" <<
       endl;
   }
@@ -1311,8 +1316,8 @@ tupletsCurvedBrackets = {
 }
 )";
 
-  if (gLpsrOptions->fTraceSchemeFunctions) {
-    gLogIOstream <<
+  if (gLpsrOptions ()->fTraceSchemeFunctions) {
+    gLogIOstream () <<
       "Creating Scheme function '" << schemeFunctionName << "'" <<
       endl;
   }
@@ -1355,8 +1360,8 @@ after =
    #})
 )";
 
-  if (gLpsrOptions->fTraceSchemeFunctions) {
-    gLogIOstream <<
+  if (gLpsrOptions ()->fTraceSchemeFunctions) {
+    gLogIOstream () <<
       "Creating Scheme function '" << schemeFunctionName << "'" <<
       endl;
   }
@@ -1457,8 +1462,8 @@ tempoRelationship =
      #}))
 )!";
 
-  if (gLpsrOptions->fTraceSchemeFunctions) {
-    gLogIOstream <<
+  if (gLpsrOptions ()->fTraceSchemeFunctions) {
+    gLogIOstream () <<
       "Creating Scheme function '" << schemeFunctionName << "'" <<
       endl;
   }
@@ -1509,8 +1514,8 @@ damp = \markup {
 }
 )!";
 
-  if (gLpsrOptions->fTraceSchemeFunctions) {
-    gLogIOstream <<
+  if (gLpsrOptions ()->fTraceSchemeFunctions) {
+    gLogIOstream () <<
       "Creating Scheme function '" << schemeFunctionName << "'" <<
       endl;
   }
@@ -1555,8 +1560,8 @@ dampAll = \markup
 }
 )!";
 
-  if (gLpsrOptions->fTraceSchemeFunctions) {
-    gLogIOstream <<
+  if (gLpsrOptions ()->fTraceSchemeFunctions) {
+    gLogIOstream () <<
       "Creating Scheme function '" << schemeFunctionName << "'" <<
       endl;
   }
@@ -1606,8 +1611,8 @@ whiteNoteHeads =
    )
 )!";
 
-  if (gLpsrOptions->fTraceSchemeFunctions) {
-    gLogIOstream <<
+  if (gLpsrOptions ()->fTraceSchemeFunctions) {
+    gLogIOstream () <<
       "Creating Scheme function '" << schemeFunctionName << "'" <<
       endl;
   }
@@ -1655,8 +1660,8 @@ void lpsrScore::appendLyricsUseToStoreCommand (S_msrStanza stanza)
 
 void lpsrScore::acceptIn (basevisitor* v)
 {
-  if (gLpsrOptions->fTraceLpsrVisitors) {
-    gLogIOstream <<
+  if (gLpsrOptions ()->fTraceLpsrVisitors) {
+    gLogIOstream () <<
       "% ==> lpsrScore::acceptIn ()" <<
       endl;
   }
@@ -1666,8 +1671,8 @@ void lpsrScore::acceptIn (basevisitor* v)
       dynamic_cast<visitor<S_lpsrScore>*> (v)) {
         S_lpsrScore elem = this;
         
-        if (gLpsrOptions->fTraceLpsrVisitors) {
-          gLogIOstream <<
+        if (gLpsrOptions ()->fTraceLpsrVisitors) {
+          gLogIOstream () <<
             "% ==> Launching lpsrScore::visitStart ()" <<
             endl;
         }
@@ -1677,8 +1682,8 @@ void lpsrScore::acceptIn (basevisitor* v)
 
 void lpsrScore::acceptOut (basevisitor* v)
 {
-  if (gLpsrOptions->fTraceLpsrVisitors) {
-    gLogIOstream <<
+  if (gLpsrOptions ()->fTraceLpsrVisitors) {
+    gLogIOstream () <<
       "% ==> lpsrScore::acceptOut ()" <<
       endl;
   }
@@ -1688,8 +1693,8 @@ void lpsrScore::acceptOut (basevisitor* v)
       dynamic_cast<visitor<S_lpsrScore>*> (v)) {
         S_lpsrScore elem = this;
       
-        if (gLpsrOptions->fTraceLpsrVisitors) {
-          gLogIOstream <<
+        if (gLpsrOptions ()->fTraceLpsrVisitors) {
+          gLogIOstream () <<
             "% ==> Launching lpsrScore::visitEnd ()" <<
             endl;
         }
@@ -1699,8 +1704,8 @@ void lpsrScore::acceptOut (basevisitor* v)
 
 void lpsrScore::browseData (basevisitor* v)
 {
-  if (gLpsrOptions->fTraceLpsrVisitors) {
-    gLogIOstream <<
+  if (gLpsrOptions ()->fTraceLpsrVisitors) {
+    gLogIOstream () <<
       "% ==> lpsrScore::browseData ()" <<
       endl;
   }
@@ -1818,8 +1823,8 @@ void lpsrScore::browseData (basevisitor* v)
     browser.browse (*fScoreBlock);
   }
 
-  if (gLpsrOptions->fTraceLpsrVisitors) {
-    gLogIOstream <<
+  if (gLpsrOptions ()->fTraceLpsrVisitors) {
+    gLogIOstream () <<
       "% <== lpsrScore::browseData ()" <<
       endl;
   }
@@ -1832,7 +1837,7 @@ void lpsrScore::print (ostream& os)
     endl <<
     endl;
 
-  gIndenter++;
+  gIndenter ()++;
 
   // print the MSR structure (without the voices)
   fMsrScore->
@@ -1895,7 +1900,7 @@ void lpsrScore::print (ostream& os)
   os <<
     fScoreBlock;
 
-  gIndenter--;
+  gIndenter ()--;
 }
 
 ostream& operator<< (ostream& os, const S_lpsrScore& scr)
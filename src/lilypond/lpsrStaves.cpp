@@ -44,8 +44,8 @@ lpsrNewStaffgroupBlock::~lpsrNewStaffgroupBlock ()
 
 void lpsrNewStaffgroupBlock::acceptIn (basevisitor* v)
 {
-  if (gLpsrOptions->fTraceLpsrVisitors) {
-    gLogIOstream <<
+  if (gLpsrOptions ()->fTraceLpsrVisitors) {
+    gLogIOstream () <<
       "% ==> lpsrNewStaffgroupBlock::acceptIn ()" <<
       endl;
   }
@@ -55,8 +55,8 @@ void lpsrNewStaffgroupBlock::acceptIn (basevisitor* v)
       dynamic_cast<visitor<S_lpsrNewStaffgroupBlock>*> (v)) {
         S_lpsrNewStaffgroupBlock elem = this;
         
-        if (gLpsrOptions->fTraceLpsrVisitors) {
-          gLogIOstream <<
+        if (gLpsrOptions ()->fTraceLpsrVisitors) {
+          gLogIOstream () <<
             "% ==> Launching lpsrNewStaffgroupBlock::visitStart ()" <<
             endl;
         }
@@ -66,8 +66,8 @@ void lpsrNewStaffgroupBlock::acceptIn (basevisitor* v)
 
 void lpsrNewStaffgroupBlock::acceptOut (basevisitor* v)
 {
-  if (gLpsrOptions->fTraceLpsrVisitors) {
-    gLogIOstream <<
+  if (gLpsrOptions ()->fTraceLpsrVisitors) {
+    gLogIOstream () <<
       "% ==> lpsrNewStaffgroupBlock::acceptOut ()" <<
       endl;
   }
@@ -77,8 +77,8 @@ void lpsrNewStaffgroupBlock::acceptOut (basevisitor* v)
       dynamic_cast<visitor<S_lpsrNewStaffgroupBlock>*> (v)) {
         S_lpsrNewStaffgroupBlock elem = this;
       
-        if (gLpsrOptions->fTraceLpsrVisitors) {
-          gLogIOstream <<
+        if (gLpsrOptions ()->fTraceLpsrVisitors) {
+          gLogIOstream () <<
             "% ==> Launching lpsrNewStaffgroupBlock::visitEnd ()" <<
             endl;
         }
@@ -93,7 +93,7 @@ void lpsrNewStaffgroupBlock::print (ostream& os)
 {
   os << "NewStaffgroupBlock" << endl;
 
-  gIndenter++;
+  gIndenter ()++;
   
   int size = fNewStaffgroupElements.size ();
 
@@ -101,7 +101,7 @@ void lpsrNewStaffgroupBlock::print (ostream& os)
     os << fNewStaffgroupElements[i];
   } // for
   
-  gIndenter--;
+  gIndenter ()--;
 }
 
 ostream& operator<< (ostream& os, const S_lpsrNewStaffgroupBlock& nstf)
@@ -135,8 +135,8 @@ lpsrNewStaffTuningBlock::~lpsrNewStaffTuningBlock ()
 
 void lpsrNewStaffTuningBlock::acceptIn (basevisitor* v)
 {
-  if (gLpsrOptions->fTraceLpsrVisitors) {
-    gLogIOstream <<
+  if (gLpsrOptions ()->fTraceLpsrVisitors) {
+    gLogIOstream () <<
       "% ==> lpsrNewStaffTuningBlock::acceptIn ()" <<
       endl;
   }
@@ -146,8 +146,8 @@ void lpsrNewStaffTuningBlock::acceptIn (basevisitor* v)
       dynamic_cast<visitor<S_lpsrNewStaffTuningBlock>*> (v)) {
         S_lpsrNewStaffTuningBlock elem = this;
         
-        if (gLpsrOptions->fTraceLpsrVisitors) {
-          gLogIOstream <<
+        if (gLpsrOptions ()->fTraceLpsrVisitors) {
+          gLogIOstream () <<
             "% ==> Launching lpsrNewStaffTuningBlock::visitStart ()" <<
             endl;
         }
@@ -157,8 +157,8 @@ void lpsrNewStaffTuningBlock::acceptIn (basevisitor* v)
 
 void lpsrNewStaffTuningBlock::acceptOut (basevisitor* v)
 {
-  if (gLpsrOptions->fTraceLpsrVisitors) {
-    gLogIOstream <<
+  if (gLpsrOptions ()->fTraceLpsrVisitors) {
+    gLogIOstream () <<
       "% ==> lpsrNewStaffTuningBlock::acceptOut ()" <<
       endl;
   }
@@ -168,8 +168,8 @@ void lpsrNewStaffTuningBlock::acceptOut (basevisitor* v)
       dynamic_cast<visitor<S_lpsrNewStaffTuningBlock>*> (v)) {
         S_lpsrNewStaffTuningBlock elem = this;
       
-        if (gLpsrOptions->fTraceLpsrVisitors) {
-          gLogIOstream <<
+        if (gLpsrOptions ()->fTraceLpsrVisitors) {
+          gLogIOstream () <<
             "% ==> Launching lpsrNewStaffTuningBlock::visitEnd ()" <<
             endl;
         }
@@ -184,12 +184,12 @@ void lpsrNewStaffTuningBlock::print (ostream& os)
 {
   os << "NewStaffTuningBlock" << endl;
 
-  gIndenter++;
+  gIndenter ()++;
   
   os <<
     fStaffTuning;
   
-  gIndenter--;
+  gIndenter ()--;
 }
 
 ostream& operator<< (ostream& os, const S_lpsrNewStaffTuningBlock& nstf)
@@ -219,8 +219,8 @@ lpsrNewStaffBlock::~lpsrNewStaffBlock ()
 
 void lpsrNewStaffBlock::acceptIn (basevisitor* v)
 {
-  if (gLpsrOptions->fTraceLpsrVisitors) {
-    gLogIOstream <<
+  if (gLpsrOptions ()->fTraceLpsrVisitors) {
+    gLogIOstream () <<
       "% ==> lpsrNewStaffBlock::acceptIn ()" <<
       endl;
   }
@@ -230,8 +230,8 @@ void lpsrNewStaffBlock::acceptIn (basevisitor* v)
       dynamic_cast<visitor<S_lpsrNewStaffBlock>*> (v)) {
         S_lpsrNewStaffBlock elem = this;
         
-        if (gLpsrOptions->fTraceLpsrVisitors) {
-          gLogIOstream <<
+        if (gLpsrOptions ()->fTraceLpsrVisitors) {
+          gLogIOstream () <<
             "% ==> Launching lpsrNewStaffBlock::visitStart ()" <<
             endl;
         }
@@ -241,8 +241,8 @@ void lpsrNewStaffBlock::acceptIn (basevisitor* v)
 
 void lpsrNewStaffBlock::acceptOut (basevisitor* v)
 {
-  if (gLpsrOptions->fTraceLpsrVisitors) {
-    gLogIOstream <<
+  if (gLpsrOptions ()->fTraceLpsrVisitors) {
+    gLogIOstream () <<
       "% ==> lpsrNewStaffBlock::acceptOut ()" <<
       endl;
   }
@@ -252,8 +252,8 @@ void lpsrNewStaffBlock::acceptOut (basevisitor* v)
       dynamic_cast<visitor<S_lpsrNewStaffBlock>*> (v)) {
         S_lpsrNewStaffBlock elem = this;
       
-        if (gLpsrOptions->fTraceLpsrVisitors) {
-          gLogIOstream <<
+        if (gLpsrOptions ()->fTraceLpsrVisitors) {
+          gLogIOstream () <<
             "% ==> Launching lpsrNewStaffBlock::visitEnd ()" <<
             endl;
         }
@@ -268,7 +268,7 @@ void lpsrNewStaffBlock::print (ostream& os)
 {
   os << "NewStaffBlock" << endl;
 
-  gIndenter++;
+  gIndenter ()++;
   
   int size = fNewStaffElements.size ();
 
@@ -276,7 +276,7 @@ void lpsrNewStaffBlock::print (ostream& os)
     os << fNewStaffElements[i];
   } // for
   
-  gIndenter--;
+  gIndenter ()--;
 }
 
 ostream& operator<< (ostream& os, const S_lpsrNewStaffBlock& nstf)
@@ -343,8 +343,8 @@ void lpsrStaffBlock::appendLyricsUseToStaffBlock (S_msrStanza stanza)
 
 void lpsrStaffBlock::acceptIn (basevisitor* v)
 {
-  if (gLpsrOptions->fTraceLpsrVisitors) {
-    gLogIOstream <<
+  if (gLpsrOptions ()->fTraceLpsrVisitors) {
+    gLogIOstream () <<
       "% ==> lpsrStaffBlock::acceptIn ()" <<
       endl;
   }
@@ -354,8 +354,8 @@ void lpsrStaffBlock::acceptIn (basevisitor* v)
       dynamic_cast<visitor<S_lpsrStaffBlock>*> (v)) {
         S_lpsrStaffBlock elem = this;
         
-        if (gLpsrOptions->fTraceLpsrVisitors) {
-          gLogIOstream <<
+        if (gLpsrOptions ()->fTraceLpsrVisitors) {
+          gLogIOstream () <<
             "% ==> Launching lpsrStaffBlock::visitStart ()" <<
             endl;
         }
@@ -365,8 +365,8 @@ void lpsrStaffBlock::acceptIn (basevisitor* v)
 
 void lpsrStaffBlock::acceptOut (basevisitor* v)
 {
-  if (gLpsrOptions->fTraceLpsrVisitors) {
-    gLogIOstream <<
+  if (gLpsrOptions ()->fTraceLpsrVisitors) {
+    gLogIOstream () <<
       "% ==> lpsrStaffBlock::acceptOut ()" <<
       endl;
   }
@@ -376,8 +376,8 @@ void lpsrStaffBlock::acceptOut (basevisitor* v)
       dynamic_cast<visitor<S_lpsrStaffBlock>*> (v)) {
         S_lpsrStaffBlock elem = this;
       
-        if (gLpsrOptions->fTraceLpsrVisitors) {
-          gLogIOstream <<
+        if (gLpsrOptions ()->fTraceLpsrVisitors) {
+          gLogIOstream () <<
             "% ==> Launching lpsrStaffBlock::visitEnd ()" <<
             endl;
         }
@@ -387,8 +387,8 @@ void lpsrStaffBlock::acceptOut (basevisitor* v)
 
 void lpsrStaffBlock::browseData (basevisitor* v)
 {
-  if (gLpsrOptions->fTraceLpsrVisitors) {
-    gLogIOstream <<
+  if (gLpsrOptions ()->fTraceLpsrVisitors) {
+    gLogIOstream () <<
       "% ==> lpsrStaffBlock::browseData ()" <<
       endl;
   }
@@ -402,8 +402,8 @@ void lpsrStaffBlock::browseData (basevisitor* v)
     browser.browse (*(*i));
   } // for
 
-  if (gLpsrOptions->fTraceLpsrVisitors) {
-    gLogIOstream <<
+  if (gLpsrOptions ()->fTraceLpsrVisitors) {
+    gLogIOstream () <<
       "% <== lpsrStaffBlock::browseData ()" <<
       endl;
   }
@@ -420,7 +420,7 @@ void lpsrStaffBlock::print (ostream& os)
       fStaffBlockElements.size (), "element", "elements") <<
     endl;
 
-  gIndenter++;
+  gIndenter ()++;
 
   const int fieldWidth = 31;
   
@@ -447,7 +447,7 @@ void lpsrStaffBlock::print (ostream& os)
     } // for
   }
 
-  gIndenter--;
+  gIndenter ()--;
 }
 
 ostream& operator<< (ostream& os, const S_lpsrStaffBlock& scr)
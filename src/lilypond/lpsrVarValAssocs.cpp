@@ -273,8 +273,8 @@ string lpsrVarValAssoc::endlKindAsString (
 
 void lpsrVarValAssoc::acceptIn (basevisitor* v)
 {
-  if (gLpsrOptions->fTraceLpsrVisitors) {
-    gLogIOstream <<
+  if (gLpsrOptions ()->fTraceLpsrVisitors) {
+    gLogIOstream () <<
       "% ==> lpsrVarValAssoc::acceptIn ()" <<
       endl;
   }
@@ -284,8 +284,8 @@ void lpsrVarValAssoc::acceptIn (basevisitor* v)
       dynamic_cast<visitor<S_lpsrVarValAssoc>*> (v)) {
         S_lpsrVarValAssoc elem = this;
         
-        if (gLpsrOptions->fTraceLpsrVisitors) {
-          gLogIOstream <<
+        if (gLpsrOptions ()->fTraceLpsrVisitors) {
+          gLogIOstream () <<
             "% ==> Launching lpsrVarValAssoc::visitStart ()" <<
             endl;
         }
@@ -295,8 +295,8 @@ void lpsrVarValAssoc::acceptIn (basevisitor* v)
 
 void lpsrVarValAssoc::acceptOut (basevisitor* v)
 {
-  if (gLpsrOptions->fTraceLpsrVisitors) {
-    gLogIOstream <<
+  if (gLpsrOptions ()->fTraceLpsrVisitors) {
+    gLogIOstream () <<
       "% ==> lpsrVarValAssoc::acceptOut ()" <<
       endl;
   }
@@ -306,8 +306,8 @@ void lpsrVarValAssoc::acceptOut (basevisitor* v)
       dynamic_cast<visitor<S_lpsrVarValAssoc>*> (v)) {
         S_lpsrVarValAssoc elem = this;
       
-        if (gLpsrOptions->fTraceLpsrVisitors) {
-          gLogIOstream <<
+        if (gLpsrOptions ()->fTraceLpsrVisitors) {
+          gLogIOstream () <<
             "% ==> Launching lpsrVarValAssoc::visitEnd ()" <<
             endl;
         }
@@ -324,7 +324,7 @@ void lpsrVarValAssoc::print (ostream& os)
     "LPSR VarValAssoc" <<
     endl;
   
-  gIndenter++;
+  gIndenter ()++;
 
   // escape quotes if any
   string variableValue;
@@ -404,7 +404,7 @@ void lpsrVarValAssoc::print (ostream& os)
       fEndlKind) <<
     endl;
   
-  gIndenter--;
+  gIndenter ()--;
 }
 
 ostream& operator<< (ostream& os, const S_lpsrVarValAssoc& assoc) {
@@ -494,8 +494,8 @@ string lpsrVarValsListAssoc::lilyPondVarValsListAssocValuesAsString () const
 
 void lpsrVarValsListAssoc::acceptIn (basevisitor* v)
 {
-  if (gLpsrOptions->fTraceLpsrVisitors) {
-    gLogIOstream <<
+  if (gLpsrOptions ()->fTraceLpsrVisitors) {
+    gLogIOstream () <<
       "% ==> lpsrVarValsListAssoc::acceptIn ()" <<
       endl;
   }
@@ -505,8 +505,8 @@ void lpsrVarValsListAssoc::acceptIn (basevisitor* v)
       dynamic_cast<visitor<S_lpsrVarValsListAssoc>*> (v)) {
         S_lpsrVarValsListAssoc elem = this;
         
-        if (gLpsrOptions->fTraceLpsrVisitors) {
-          gLogIOstream <<
+        if (gLpsrOptions ()->fTraceLpsrVisitors) {
+          gLogIOstream () <<
             "% ==> Launching lpsrVarValsListAssoc::visitStart ()" <<
             endl;
         }
@@ -516,8 +516,8 @@ void lpsrVarValsListAssoc::acceptIn (basevisitor* v)
 
 void lpsrVarValsListAssoc::acceptOut (basevisitor* v)
 {
-  if (gLpsrOptions->fTraceLpsrVisitors) {
-    gLogIOstream <<
+  if (gLpsrOptions ()->fTraceLpsrVisitors) {
+    gLogIOstream () <<
       "% ==> lpsrVarValsListAssoc::acceptOut ()" <<
       endl;
   }
@@ -527,8 +527,8 @@ void lpsrVarValsListAssoc::acceptOut (basevisitor* v)
       dynamic_cast<visitor<S_lpsrVarValsListAssoc>*> (v)) {
         S_lpsrVarValsListAssoc elem = this;
       
-        if (gLpsrOptions->fTraceLpsrVisitors) {
-          gLogIOstream <<
+        if (gLpsrOptions ()->fTraceLpsrVisitors) {
+          gLogIOstream () <<
             "% ==> Launching lpsrVarValsListAssoc::visitEnd ()" <<
             endl;
         }
@@ -545,7 +545,7 @@ void lpsrVarValsListAssoc::print (ostream& os)
     "LPSR VarValsListAssoc" <<
     endl;
   
-  gIndenter++;
+  gIndenter ()++;
 
   const int fieldWidth = 16;
 
@@ -558,7 +558,7 @@ void lpsrVarValsListAssoc::print (ostream& os)
     "variable values" << " : " <<
     endl;
 
-  gIndenter++;
+  gIndenter ()++;
   
   list<string>::const_iterator
     iBegin = fVariableValuesList.begin (),
@@ -574,9 +574,9 @@ void lpsrVarValsListAssoc::print (ostream& os)
   os <<
     endl;
 
-  gIndenter--;
+  gIndenter ()--;
   
-  gIndenter--;
+  gIndenter ()--;
 }
 
 ostream& operator<< (ostream& os, const S_lpsrVarValsListAssoc& assoc) {
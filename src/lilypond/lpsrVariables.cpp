@@ -45,8 +45,8 @@ lpsrVariableUseCommand::~lpsrVariableUseCommand()
 
 void lpsrVariableUseCommand::acceptIn (basevisitor* v)
 {
-  if (gLpsrOptions->fTraceLpsrVisitors) {
-    gLogIOstream <<
+  if (gLpsrOptions ()->fTraceLpsrVisitors) {
+    gLogIOstream () <<
       "% ==> lpsrVariableUseCommand::acceptIn()" <<
       endl;
   }
@@ -56,8 +56,8 @@ void lpsrVariableUseCommand::acceptIn (basevisitor* v)
       dynamic_cast<visitor<S_lpsrVariableUseCommand>*> (v)) {
         S_lpsrVariableUseCommand elem = this;
         
-        if (gLpsrOptions->fTraceLpsrVisitors) {
-          gLogIOstream <<
+        if (gLpsrOptions ()->fTraceLpsrVisitors) {
+          gLogIOstream () <<
             "% ==> Launching lpsrVariableUseCommand::visitStart()" <<
             endl;
         }
@@ -67,8 +67,8 @@ void lpsrVariableUseCommand::acceptIn (basevisitor* v)
 
 void lpsrVariableUseCommand::acceptOut (basevisitor* v)
 {
-  if (gLpsrOptions->fTraceLpsrVisitors) {
-    gLogIOstream <<
+  if (gLpsrOptions ()->fTraceLpsrVisitors) {
+    gLogIOstream () <<
       "% ==> lpsrVariableUseCommand::acceptOut()" <<
       endl;
   }
@@ -78,8 +78,8 @@ void lpsrVariableUseCommand::acceptOut (basevisitor* v)
       dynamic_cast<visitor<S_lpsrVariableUseCommand>*> (v)) {
         S_lpsrVariableUseCommand elem = this;
       
-        if (gLpsrOptions->fTraceLpsrVisitors) {
-          gLogIOstream <<
+        if (gLpsrOptions ()->fTraceLpsrVisitors) {
+          gLogIOstream () <<
             "% ==> Launching lpsrVariableUseCommand::visitEnd()" <<
             endl;
         }
@@ -93,9 +93,9 @@ void lpsrVariableUseCommand::browseData (basevisitor* v)
 void lpsrVariableUseCommand::print (ostream& os)
 {
   os << "VariableUseCommand" << endl;
-  gIndenter++;
+  gIndenter ()++;
   os << fVariableName << endl;
-  gIndenter--;
+  gIndenter ()--;
 }
 
 ostream& operator<< (ostream& os, const S_lpsrVariableUseCommand& nstf)
@@ -46,8 +46,8 @@ lpsrUseVoiceCommand::~lpsrUseVoiceCommand ()
 
 void lpsrUseVoiceCommand::acceptIn (basevisitor* v)
 {
-  if (gLpsrOptions->fTraceLpsrVisitors) {
-    gLogIOstream <<
+  if (gLpsrOptions ()->fTraceLpsrVisitors) {
+    gLogIOstream () <<
       "% ==> lpsrUseVoiceCommand::acceptIn ()" <<
       endl;
   }
@@ -57,8 +57,8 @@ void lpsrUseVoiceCommand::acceptIn (basevisitor* v)
       dynamic_cast<visitor<S_lpsrUseVoiceCommand>*> (v)) {
         S_lpsrUseVoiceCommand elem = this;
         
-        if (gLpsrOptions->fTraceLpsrVisitors) {
-          gLogIOstream <<
+        if (gLpsrOptions ()->fTraceLpsrVisitors) {
+          gLogIOstream () <<
             "% ==> Launching lpsrUseVoiceCommand::visitStart ()" <<
             endl;
         }
@@ -68,8 +68,8 @@ void lpsrUseVoiceCommand::acceptIn (basevisitor* v)
 
 void lpsrUseVoiceCommand::acceptOut (basevisitor* v)
 {
-  if (gLpsrOptions->fTraceLpsrVisitors) {
-    gLogIOstream <<
+  if (gLpsrOptions ()->fTraceLpsrVisitors) {
+    gLogIOstream () <<
       "% ==> lpsrUseVoiceCommand::acceptOut ()" <<
       endl;
   }
@@ -79,8 +79,8 @@ void lpsrUseVoiceCommand::acceptOut (basevisitor* v)
       dynamic_cast<visitor<S_lpsrUseVoiceCommand>*> (v)) {
         S_lpsrUseVoiceCommand elem = this;
       
-        if (gLpsrOptions->fTraceLpsrVisitors) {
-          gLogIOstream <<
+        if (gLpsrOptions ()->fTraceLpsrVisitors) {
+          gLogIOstream () <<
             "% ==> Launching lpsrUseVoiceCommand::visitEnd ()" <<
             endl;
         }
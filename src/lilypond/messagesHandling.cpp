@@ -10,6 +10,8 @@
   research@grame.fr
 */
 
+#include <sstream>
+
 #include "utilities.h"
 
 #include "messagesHandling.h"
@@ -23,18 +25,55 @@ using namespace std;
 namespace MusicXML2 
 {
 
+//______________________________________________________________________________
+void msrStopConversion (
+  int    exitCode,
+  string message)
+{
+  if (conversionContext::current ().fErrorsThrowExceptions) {
+    throw msrException (message);
+  }
+
+  if (exitCode) {
+    exit (exitCode);
+  }
+  else {
+    abort ();
+  }
+}
+
+//______________________________________________________________________________
+static string errorDescription (
+  string context,
+  string inputSourceName,
+  int    inputLineNumber,
+  string message)
+{
+  stringstream s;
+
+  s <<
+    context << " ERROR: " <<
+    inputSourceName << ":" << inputLineNumber << ": " << message;
+
+  return s.str ();
+}
+
 //______________________________________________________________________________
 void msrAssert (
   bool   condition,
   string messageIfFalse)
 {
   if (! condition) {
-    gLogIOstream <<
-      "#### msrAssert failure: " << messageIfFalse <<
-      ", aborting." <<
-      endl;
+    if (! conversionContext::current ().fErrorsThrowExceptions) {
+      gLogIOstream () <<
+        "#### msrAssert failure: " << messageIfFalse <<
+        ", aborting." <<
+        endl;
+    }
      
-    abort ();
+    msrStopConversion (
+      0,
+      "msrAssert failure: " + messageIfFalse);
   }
 }
 
@@ -45,13 +84,13 @@ void msrWarning (
   int    inputLineNumber,
   string message)
 {
-  if (! gGeneralOptions->fQuiet) {
-    gLogIOstream <<
+  if (! gGeneralOptions ()->fQuiet) {
+    gLogIOstream () <<
       "*** " << context << " warning *** " <<
       inputSourceName << ":" << inputLineNumber << ": " <<message <<
       endl;
 
-    gWarningsInputLineNumbers.insert (inputLineNumber);
+    gWarningsInputLineNumbers ().insert (inputLineNumber);
   }
 }
 
@@ -103,20 +142,20 @@ void msrError (
   int    sourceCodeLineNumber,
   string message)
 {
-  if (! gGeneralOptions->fQuiet) {
-    if (gGeneralOptions->fDisplaySourceCodePosition) {
-      gLogIOstream <<
+  if (! gGeneralOptions ()->fQuiet) {
+    if (gGeneralOptions ()->fDisplaySourceCodePosition) {
+      gLogIOstream () <<
         baseName (sourceCodeFileName) << ":" << sourceCodeLineNumber <<
         " ";
     }
 
-    if (! gGeneralOptions->fIgnoreErrors) {
-      gLogIOstream <<
+    if (! gGeneralOptions ()->fIgnoreErrors) {
+      gLogIOstream () <<
         "### " << context << " ERROR ### " <<
         inputSourceName << ":" << inputLineNumber << ": " << message <<
         endl;
   
-      gErrorsInputLineNumbers.insert (inputLineNumber);
+      gErrorsInputLineNumbers ().insert (inputLineNumber);
     }
   }
 }
@@ -137,13 +176,14 @@ void msrMusicXMLError (
     sourceCodeLineNumber,
     message);
 
-  if (! gGeneralOptions->fIgnoreErrors) {
-    if (gGeneralOptions->fAbortOnErrors) {
-      abort ();
-    }
-    else {
-      exit (15);
-    }
+  if (! gGeneralOptions ()->fIgnoreErrors) {
+    msrStopConversion (
+      gGeneralOptions ()->fAbortOnErrors ? 0 : 15,
+      errorDescription (
+        "MusicXML",
+        inputSourceName,
+        inputLineNumber,
+        message));
   }
 }
 
@@ -163,8 +203,14 @@ void lpsrMusicXMLError (
     sourceCodeLineNumber,
     message);
 
-  if (! gGeneralOptions->fIgnoreErrors) {
-    exit (16);
+  if (! gGeneralOptions ()->fIgnoreErrors) {
+    msrStopConversion (
+      16,
+      errorDescription (
+        "LPSR",
+        inputSourceName,
+        inputLineNumber,
+        message));
   }
 }
 
@@ -184,7 +230,13 @@ void msrInternalError (
     sourceCodeLineNumber,
     message);
 
-  abort ();
+  msrStopConversion (
+    0,
+    errorDescription (
+      "MSR INTERNAL",
+      inputSourceName,
+      inputLineNumber,
+      message));
 }
 
 void msrLimitation (
@@ -194,19 +246,22 @@ void msrLimitation (
   int    sourceCodeLineNumber,
   string message)
 {
-  if (! (gGeneralOptions->fQuiet && gGeneralOptions->fIgnoreErrors)) {  
-    if (gGeneralOptions->fDisplaySourceCodePosition) {
-      gLogIOstream <<
+  if (! (gGeneralOptions ()->fQuiet && gGeneralOptions ()->fIgnoreErrors)) {  
+    if (gGeneralOptions ()->fDisplaySourceCodePosition) {
+      gLogIOstream () <<
         baseName (sourceCodeFileName) << ":" << sourceCodeLineNumber <<
         " ";
     }
 
-    gLogIOstream <<
+    gLogIOstream () <<
       "### MSR LIMITATION ### " <<
       inputSourceName << ":" << inputLineNumber << ": " << message <<
       endl;
 
-    abort ();
+    msrStopConversion (
+      0,
+      "MSR LIMITATION: " +
+        inputSourceName + ":" + to_string (inputLineNumber) + ": " + message);
   }
 }
 
@@ -217,20 +272,26 @@ void msrStreamsError (
   int    sourceCodeLineNumber,
   string  message)
 {
-  if (! (gGeneralOptions->fQuiet && gGeneralOptions->fIgnoreErrors)) {  
-    if (gGeneralOptions->fDisplaySourceCodePosition) {
-      gLogIOstream <<
+  if (! (gGeneralOptions ()->fQuiet && gGeneralOptions ()->fIgnoreErrors)) {  
+    if (gGeneralOptions ()->fDisplaySourceCodePosition) {
+      gLogIOstream () <<
         baseName (sourceCodeFileName) << ":" << sourceCodeLineNumber <<
         " ";
     }
 
-    gLogIOstream <<
+    gLogIOstream () <<
       "### " << "MSR STREAMS" << " ERROR ### " <<
       "fake line number" << ":" << inputLineNumber << ": " << message <<
       endl;
   }
 
-  abort ();
+  msrStopConversion (
+    0,
+    errorDescription (
+      "MSR STREAMS",
+      "fake line number",
+      inputLineNumber,
+      message));
 }
 
 void msrStreamsWarning (
@@ -239,58 +300,61 @@ void msrStreamsWarning (
   int    sourceCodeLineNumber,
   string  message)
 {
-  if (! (gGeneralOptions->fQuiet && gGeneralOptions->fIgnoreErrors)) {  
-    if (gGeneralOptions->fDisplaySourceCodePosition) {
-      gLogIOstream <<
+  if (! (gGeneralOptions ()->fQuiet && gGeneralOptions ()->fIgnoreErrors)) {  
+    if (gGeneralOptions ()->fDisplaySourceCodePosition) {
+      gLogIOstream () <<
         baseName (sourceCodeFileName) << ":" << sourceCodeLineNumber <<
         " ";
     }
 
-    gLogIOstream <<
+    gLogIOstream () <<
       "*** " << "MSR STREAMS" << " warning *** " <<
       " ### " << "MSR STREAMS" << " ERROR ### " <<
       "fake line number" << ":" << inputLineNumber << ": " << message <<
       endl;
   }
 
-  abort ();
+  msrStopConversion (
+    0,
+    errorDescription (
+      "MSR STREAMS",
+      "fake line number",
+      inputLineNumber,
+      message));
 }
 
 //______________________________________________________________________________
-std::set<int> gWarningsInputLineNumbers;
-std::set<int> gErrorsInputLineNumbers;
-
 void displayWarningsAndErrorsInputLineNumbers ()
 {
   int warningsInputLineNumbersSize =
-    gWarningsInputLineNumbers.size ();
+    gWarningsInputLineNumbers ().size ();
     
-  if (warningsInputLineNumbersSize && ! gGeneralOptions->fQuiet) {
-    gLogIOstream <<
+  if (warningsInputLineNumbersSize && ! gGeneralOptions ()->fQuiet) {
+    gLogIOstream () <<
       "Warning message(s) were issued for input " <<
       singularOrPluralWithoutNumber (
         warningsInputLineNumbersSize, "line", "lines") <<
       " ";
       
     set<int>::const_iterator
-      iBegin = gWarningsInputLineNumbers.begin (),
-      iEnd   = gWarningsInputLineNumbers.end (),
+      iBegin = gWarningsInputLineNumbers ().begin (),
+      iEnd   = gWarningsInputLineNumbers ().end (),
       i      = iBegin;
     for ( ; ; ) {
-      gLogIOstream << (*i);
+      gLogIOstream () << (*i);
       if (++i == iEnd) break;
-      gLogIOstream << ", ";
+      gLogIOstream () << ", ";
     } // for
 
-    gLogIOstream <<
+    gLogIOstream () <<
       endl;
   }
   
   int errorsInputLineNumbersSize =
-    gErrorsInputLineNumbers.size ();
+    gErrorsInputLineNumbers ().size ();
 
   if (errorsInputLineNumbersSize) {
-    gLogIOstream <<
+    gLogIOstream () <<
       endl <<
       "Error message(s) were issued for input " <<
       singularOrPluralWithoutNumber (
@@ -298,16 +362,16 @@ void displayWarningsAndErrorsInputLineNumbers ()
       " ";
       
     set<int>::const_iterator
-      iBegin = gErrorsInputLineNumbers.begin (),
-      iEnd   = gErrorsInputLineNumbers.end (),
+      iBegin = gErrorsInputLineNumbers ().begin (),
+      iEnd   = gErrorsInputLineNumbers ().end (),
       i      = iBegin;
     for ( ; ; ) {
-      gLogIOstream << (*i);
+      gLogIOstream () << (*i);
       if (++i == iEnd) break;
-      gLogIOstream << ", ";
+      gLogIOstream () << ", ";
     } // for
 
-    gLogIOstream <<
+    gLogIOstream () <<
       endl;
   }
 }
@@ -15,13 +15,47 @@
 
 #include <iomanip> // for 'setw()'
 #include <set>     // for 'setw()'
+#include <string>
+#include <exception>
 
 #include "exports.h"
 
+#include "conversionContext.h"
+
 
 namespace MusicXML2 
 {
 
+//______________________________________________________________________________
+// thrown by the errors handling functions instead of exiting or aborting
+// when the current conversion context has fErrorsThrowExceptions set,
+// what () is the error message
+class EXP msrException : public std::exception
+{
+  public:
+
+                          msrException (std::string message)
+                              : fMessage (message)
+                              {}
+
+    virtual               ~msrException () throw ()
+                              {}
+
+    virtual const char*   what () const throw ()
+                              { return fMessage.c_str (); }
+
+  private:
+
+    std::string           fMessage;
+};
+
+//______________________________________________________________________________
+// the conversion cannot go further: throw an msrException if the current
+// context asks for it, otherwise exit with exitCode, or abort if it is 0
+EXP void msrStopConversion (
+  int         exitCode,
+  std::string message);
+
 //______________________________________________________________________________
 EXP void msrAssert (
   bool   condition,
@@ -107,8 +141,8 @@ EXP void msrStreamsWarning (
   std::string message);
 
 //______________________________________________________________________________
-EXP extern std::set<int> gWarningsInputLineNumbers;
-EXP extern std::set<int> gErrorsInputLineNumbers;
+// gWarningsInputLineNumbers () and gErrorsInputLineNumbers () are those
+// of the current conversion context, see conversionContext.h
 
 EXP void displayWarningsAndErrorsInputLineNumbers ();
 
@@ -154,19 +154,19 @@ void msr2LpsrTranslator::setPaperIndentsIfNeeded (
     maxShortValue = scoreInstrumentAbbreviationsMaxLength;
   }
 
-  // get the paper width
-  float paperWidth = pageGeometry->getPaperWidth ();
-  
   // heuristics to determine the number of characters per centimeter
   float charactersPerCemtimeter = 4.0;
 
 #ifdef TRACE_OPTIONS
-  if (gTraceOptions->fTraceGeometry) {
+  if (gTraceOptions ()->fTraceGeometry) {
+    // get the paper width
+    float paperWidth = pageGeometry->getPaperWidth ();
+
     fLogOutputStream <<
       "setPaperIndentsIfNeeded():" <<
       endl;
 
-    gIndenter++;
+    gIndenter ()++;
 
     const int fieldWidth = 40;
     
@@ -204,7 +204,7 @@ void msr2LpsrTranslator::setPaperIndentsIfNeeded (
       charactersPerCemtimeter <<
       endl;
 
-    gIndenter--;
+    gIndenter ()--;
   }
 #endif
 
@@ -231,7 +231,7 @@ void msr2LpsrTranslator::prependSkipGraceNotesGroupToPartOtherVoices (
   S_msrGraceNotesGroup skipGraceNotesGroup)
 {
 #ifdef TRACE_OPTIONS
-    if (gTraceOptions->fTraceGraceNotes) {
+    if (gTraceOptions ()->fTraceGraceNotes) {
       fLogOutputStream <<
         "--> prepending a skip graceNotesGroup clone " <<
         skipGraceNotesGroup->asShortString () <<
@@ -286,7 +286,7 @@ void msr2LpsrTranslator::visitStart (S_msrScore& elt)
   int inputLineNumber =
     elt->getInputLineNumber ();
     
-  if (gMsrOptions->fTraceMsrVisitors) {
+  if (gMsrOptions ()->fTraceMsrVisitors) {
     fLogOutputStream <<
       "--> Start visiting msrScore" <<
       ", line " << inputLineNumber <<
@@ -311,74 +311,74 @@ void msr2LpsrTranslator::visitStart (S_msrScore& elt)
     fLpsrScore-> getHeader();
 
   // is there a rights option?
-  if (gLilypondOptions->fRights.size ()) {
+  if (gLilypondOptions ()->fRights.size ()) {
     // define rights
     
     fLpsrScoreHeader->
       addRights (
         inputLineNumber,
-        gLilypondOptions->fRights);
+        gLilypondOptions ()->fRights);
   }
 
   // is there a composer option?
-  if (gLilypondOptions->fComposer.size ()) {
+  if (gLilypondOptions ()->fComposer.size ()) {
     // define composer
     
     fLpsrScoreHeader->
       addComposer (
         inputLineNumber,
-        gLilypondOptions->fComposer);
+        gLilypondOptions ()->fComposer);
   }
 
   // is there an arranger option?
-  if (gLilypondOptions->fArranger.size ()) {
+  if (gLilypondOptions ()->fArranger.size ()) {
     // define arranger
     
     fLpsrScoreHeader->
       addArranger (
         inputLineNumber,
-        gLilypondOptions->fArranger);
+        gLilypondOptions ()->fArranger);
   }
 
   // is there a poet option?
-  if (gLilypondOptions->fPoet.size ()) {
+  if (gLilypondOptions ()->fPoet.size ()) {
     // define poet
     
     fLpsrScoreHeader->
       addPoet (
         inputLineNumber,
-        gLilypondOptions->fPoet);
+        gLilypondOptions ()->fPoet);
   }
 
   // is there a lyricist option?
-  if (gLilypondOptions->fLyricist.size ()) {
+  if (gLilypondOptions ()->fLyricist.size ()) {
     // define lyricist
     
     fLpsrScoreHeader->
       addLyricist (
         inputLineNumber,
-        gLilypondOptions->fLyricist);
+        gLilypondOptions ()->fLyricist);
   }
 
   // is there a software option?
-  if (gLilypondOptions->fSoftware.size ()) {
+  if (gLilypondOptions ()->fSoftware.size ()) {
     // define software
     
     fLpsrScoreHeader->
       addSoftware (
         inputLineNumber,
-        gLilypondOptions->fSoftware);
+        gLilypondOptions ()->fSoftware);
   }
 
   // is the Scheme function 'whiteNoteHeads' to be generated?
-  if (gLilypondOptions->fWhiteNoteHeads) {
+  if (gLilypondOptions ()->fWhiteNoteHeads) {
     fLpsrScore->
       // this score needs the 'whiteNoteHeads' Scheme function
       setWhiteNoteHeadsIsNeeded ();
   }
 
   // is Jianpu notation to be generated?
-  if (gLilypondOptions->fJianpu) {
+  if (gLilypondOptions ()->fJianpu) {
     fLpsrScore->
       // this score needs the 'jianpu file include' Scheme function
       setJianpuFileIncludeIsNeeded ();
@@ -397,7 +397,7 @@ void msr2LpsrTranslator::visitEnd (S_msrScore& elt)
   int inputLineNumber =
     elt->getInputLineNumber ();
     
-  if (gMsrOptions->fTraceMsrVisitors) {
+  if (gMsrOptions ()->fTraceMsrVisitors) {
     fLogOutputStream <<
       "--> End visiting msrScore" <<
       ", line " << inputLineNumber <<
@@ -490,14 +490,14 @@ void msr2LpsrTranslator::visitEnd (S_msrScore& elt)
 //________________________________________________________________________
 void msr2LpsrTranslator::visitStart (S_msrIdentification& elt)
 {
-  if (gMsrOptions->fTraceMsrVisitors) {
+  if (gMsrOptions ()->fTraceMsrVisitors) {
     fLogOutputStream <<
       "--> Start visiting msrIdentification" <<
       ", line " << elt->getInputLineNumber () <<
       endl;
   }
 
-  gIndenter++;
+  gIndenter ()++;
 
   fCurrentIdentification =
     fLpsrScore->
@@ -511,9 +511,9 @@ void msr2LpsrTranslator::visitEnd (S_msrIdentification& elt)
 {
   fOnGoingIdentification = false;
   
-  gIndenter--;
+  gIndenter ()--;
 
-  if (gMsrOptions->fTraceMsrVisitors) {
+  if (gMsrOptions ()->fTraceMsrVisitors) {
     fLogOutputStream <<
       "--> End visiting msrIdentification" <<
       ", line " << elt->getInputLineNumber () <<
@@ -524,14 +524,14 @@ void msr2LpsrTranslator::visitEnd (S_msrIdentification& elt)
 //________________________________________________________________________
 void msr2LpsrTranslator::visitStart (S_msrPageGeometry& elt)
 {
-  if (gMsrOptions->fTraceMsrVisitors) {
+  if (gMsrOptions ()->fTraceMsrVisitors) {
     fLogOutputStream <<
       "--> Start visiting msrPageGeometry" <<
       ", line " << elt->getInputLineNumber () <<
       endl;
   }
 
-  gIndenter++;
+  gIndenter ()++;
 
   // create a page geometry clone
   S_msrPageGeometry
@@ -617,9 +617,9 @@ void msr2LpsrTranslator::visitStart (S_msrPageGeometry& elt)
 
 void msr2LpsrTranslator::visitEnd (S_msrPageGeometry& elt)
 {  
-  gIndenter--;
+  gIndenter ()--;
 
-  if (gMsrOptions->fTraceMsrVisitors) {
+  if (gMsrOptions ()->fTraceMsrVisitors) {
     fLogOutputStream <<
       "--> End visiting msrPageGeometry" <<
       ", line " << elt->getInputLineNumber () <<
@@ -631,7 +631,7 @@ void msr2LpsrTranslator::visitEnd (S_msrPageGeometry& elt)
 //________________________________________________________________________
 void msr2LpsrTranslator::visitStart (S_msrCredit& elt)
 {
-  if (gMsrOptions->fTraceMsrVisitors) {
+  if (gMsrOptions ()->fTraceMsrVisitors) {
     fLogOutputStream <<
       "--> Start visiting msrCredit" <<
       ", line " << elt->getInputLineNumber () <<
@@ -648,7 +648,7 @@ void msr2LpsrTranslator::visitStart (S_msrCredit& elt)
 
 void msr2LpsrTranslator::visitEnd (S_msrCredit& elt)
 {
-  if (gMsrOptions->fTraceMsrVisitors) {
+  if (gMsrOptions ()->fTraceMsrVisitors) {
     fLogOutputStream <<
       "--> End visiting msrCredit" <<
       ", line " << elt->getInputLineNumber () <<
@@ -660,7 +660,7 @@ void msr2LpsrTranslator::visitEnd (S_msrCredit& elt)
 
 void msr2LpsrTranslator::visitStart (S_msrCreditWords& elt)
 {
-  if (gMsrOptions->fTraceMsrVisitors) {
+  if (gMsrOptions ()->fTraceMsrVisitors) {
     fLogOutputStream <<
       "--> Start visiting msrCreditWords" <<
       ", line " << elt->getInputLineNumber () <<
@@ -677,7 +677,7 @@ void msr2LpsrTranslator::visitStart (S_msrCreditWords& elt)
 
 void msr2LpsrTranslator::visitEnd (S_msrCreditWords& elt)
 {
-  if (gMsrOptions->fTraceMsrVisitors) {
+  if (gMsrOptions ()->fTraceMsrVisitors) {
     fLogOutputStream <<
       "--> End visiting msrCreditWords" <<
       ", line " << elt->getInputLineNumber () <<
@@ -688,7 +688,7 @@ void msr2LpsrTranslator::visitEnd (S_msrCreditWords& elt)
 //________________________________________________________________________
 void msr2LpsrTranslator::visitStart (S_msrPartGroup& elt)
 {
-  if (gMsrOptions->fTraceMsrVisitors) {
+  if (gMsrOptions ()->fTraceMsrVisitors) {
     fLogOutputStream <<
       "--> Start visiting msrPartGroup " <<
       elt->getPartGroupCombinedName () <<
@@ -711,7 +711,7 @@ void msr2LpsrTranslator::visitStart (S_msrPartGroup& elt)
   // push it onto this visitors's stack,
   // making it the current partGroup block
 #ifdef TRACE_OPTIONS
-  if (gTraceOptions->fTracePartGroups) {
+  if (gTraceOptions ()->fTracePartGroups) {
     fLogOutputStream <<
       "Pushing part group clone " <<
       partGroupClone->getPartGroupCombinedName () <<
@@ -751,7 +751,7 @@ void msr2LpsrTranslator::visitStart (S_msrPartGroup& elt)
 
 void msr2LpsrTranslator::visitEnd (S_msrPartGroup& elt)
 {
-  if (gMsrOptions->fTraceMsrVisitors) {
+  if (gMsrOptions ()->fTraceMsrVisitors) {
     fLogOutputStream <<
       "--> End visiting msrPartGroup " <<
       elt->getPartGroupCombinedName () <<
@@ -768,7 +768,7 @@ void msr2LpsrTranslator::visitEnd (S_msrPartGroup& elt)
     // if it is the top-level one, i.e it's alone in the stack
     
 #ifdef TRACE_OPTIONS
-    if (gTraceOptions->fTracePartGroups) {
+    if (gTraceOptions ()->fTracePartGroups) {
       fLogOutputStream <<
         "Adding part group clone " <<
         currentPartGroup->getPartGroupCombinedName () <<
@@ -787,7 +787,7 @@ void msr2LpsrTranslator::visitEnd (S_msrPartGroup& elt)
 
     // pop current partGroup from this visitors's stack
 #ifdef TRACE_OPTIONS
-    if (gTraceOptions->fTracePartGroups) {
+    if (gTraceOptions ()->fTracePartGroups) {
       fLogOutputStream <<
         "Popping part group clone " <<
         fPartGroupsStack.top ()->getPartGroupCombinedName () <<
@@ -819,7 +819,7 @@ void msr2LpsrTranslator::visitEnd (S_msrPartGroup& elt)
     // if it is the top-level one, i.e it's alone in the stack
     
 #ifdef TRACE_OPTIONS
-    if (gTraceOptions->fTracePartGroups) {
+    if (gTraceOptions ()->fTracePartGroups) {
       fLogOutputStream <<
         "Adding part group block clone for part group " <<
         currentPartGroupBlock->
@@ -845,7 +845,7 @@ void msr2LpsrTranslator::visitEnd (S_msrPartGroup& elt)
   else {
     // pop current partGroup block from this visitors's stack
 #ifdef TRACE_OPTIONS
-    if (gTraceOptions->fTracePartGroups) {
+    if (gTraceOptions ()->fTracePartGroups) {
       fLogOutputStream <<
         "Popping part group block clone for part group " <<
         currentPartGroupBlock->
@@ -876,7 +876,7 @@ void msr2LpsrTranslator::visitStart (S_msrPart& elt)
     partCombinedName =
       elt->getPartCombinedName ();
       
-  if (gMsrOptions->fTraceMsrVisitors) {
+  if (gMsrOptions ()->fTraceMsrVisitors) {
     fLogOutputStream <<
       "--> Start visiting msrPart " <<
       partCombinedName <<
@@ -885,7 +885,7 @@ void msr2LpsrTranslator::visitStart (S_msrPart& elt)
   }
 
 #ifdef TRACE_OPTIONS
-  if (gTraceOptions->fTraceParts || gTraceOptions->fTracePasses) {
+  if (gTraceOptions ()->fTraceParts || gTraceOptions ()->fTracePasses) {
     fLogOutputStream <<
       endl <<
       "<!--=== part \"" << partCombinedName << "\"" <<
@@ -894,7 +894,7 @@ void msr2LpsrTranslator::visitStart (S_msrPart& elt)
   }
 #endif
 
-  gIndenter++;
+  gIndenter ()++;
 
   // create a part clone
   fCurrentPartClone =
@@ -903,7 +903,7 @@ void msr2LpsrTranslator::visitStart (S_msrPart& elt)
 
   // add it to the partGroup clone
 #ifdef TRACE_OPTIONS
-  if (gTraceOptions->fTraceParts) {
+  if (gTraceOptions ()->fTraceParts) {
     fLogOutputStream <<
       "Adding part clone " <<
       fCurrentPartClone->getPartCombinedName () <<
@@ -924,7 +924,7 @@ void msr2LpsrTranslator::visitStart (S_msrPart& elt)
 
   // append it to the current partGroup block
 #ifdef TRACE_OPTIONS
-  if (gTraceOptions->fTraceParts) {
+  if (gTraceOptions ()->fTraceParts) {
     fLogOutputStream <<
       "Appending part block " <<
       fPartGroupsStack.top ()->getPartGroupCombinedName () <<
@@ -943,9 +943,9 @@ void msr2LpsrTranslator::visitEnd (S_msrPart& elt)
   int inputLineNumber =
     elt->getInputLineNumber ();
     
-  gIndenter--;
+  gIndenter ()--;
 
-  if (gMsrOptions->fTraceMsrVisitors) {
+  if (gMsrOptions ()->fTraceMsrVisitors) {
     fLogOutputStream <<
       "--> End visiting msrPart " <<
       elt->getPartCombinedName () <<
@@ -989,7 +989,7 @@ void msr2LpsrTranslator::visitEnd (S_msrPart& elt)
 /* JMI
 void msr2LpsrTranslator::visitStart (S_msrStaffLinesNumber& elt)
 {
-  if (gMsrOptions->fTraceMsrVisitors) {
+  if (gMsrOptions ()->fTraceMsrVisitors) {
     fLogOutputStream <<
       "--> Start visiting msrStaffLinesNumber" <<
       ", line " << inputLineNumber <<
@@ -1006,7 +1006,7 @@ void msr2LpsrTranslator::visitStart (S_msrStaffLinesNumber& elt)
 //________________________________________________________________________
 void msr2LpsrTranslator::visitStart (S_msrStaffTuning& elt)
 {
-  if (gMsrOptions->fTraceMsrVisitors) {
+  if (gMsrOptions ()->fTraceMsrVisitors) {
     fLogOutputStream <<
       "--> Start visiting msrStaffTuning" <<
       ", line " << elt->getInputLineNumber () <<
@@ -1022,7 +1022,7 @@ void msr2LpsrTranslator::visitStart (S_msrStaffTuning& elt)
 //________________________________________________________________________
 void msr2LpsrTranslator::visitStart (S_msrStaffDetails& elt)
 {
-  if (gMsrOptions->fTraceMsrVisitors) {
+  if (gMsrOptions ()->fTraceMsrVisitors) {
     fLogOutputStream <<
       "--> Start visiting msrStaffDetails" <<
       ", line " << elt->getInputLineNumber () <<
@@ -1034,7 +1034,7 @@ void msr2LpsrTranslator::visitStart (S_msrStaffDetails& elt)
 
 void msr2LpsrTranslator::visitEnd (S_msrStaffDetails& elt)
 {
-  if (gMsrOptions->fTraceMsrVisitors) {
+  if (gMsrOptions ()->fTraceMsrVisitors) {
     fLogOutputStream <<
       "--> End visiting msrStaffDetails" <<
       ", line " << elt->getInputLineNumber () <<
@@ -1069,7 +1069,7 @@ void msr2LpsrTranslator::visitEnd (S_msrStaffDetails& elt)
 //________________________________________________________________________
 void msr2LpsrTranslator::visitStart (S_msrStaff& elt)
 {
-  if (gMsrOptions->fTraceMsrVisitors) {
+  if (gMsrOptions ()->fTraceMsrVisitors) {
     fLogOutputStream <<
       "--> Start visiting msrStaff \"" <<
       elt->getStaffName () << "\"" <<
@@ -1077,7 +1077,7 @@ void msr2LpsrTranslator::visitStart (S_msrStaff& elt)
       endl;
   }
 
-  gIndenter++;
+  gIndenter ()++;
 
   switch (elt->getStaffKind ()) {
     case msrStaff::kRegularStaff:
@@ -1177,9 +1177,9 @@ void msr2LpsrTranslator::visitStart (S_msrStaff& elt)
 
 void msr2LpsrTranslator::visitEnd (S_msrStaff& elt)
 {
-  gIndenter--;
+  gIndenter ()--;
 
-  if (gMsrOptions->fTraceMsrVisitors) {
+  if (gMsrOptions ()->fTraceMsrVisitors) {
     fLogOutputStream <<
       "--> End visiting S_msrStaff \"" <<
       elt->getStaffName () << "\"" <<
@@ -1216,7 +1216,7 @@ void msr2LpsrTranslator::visitStart (S_msrVoice& elt)
   int inputLineNumber =
     elt->getInputLineNumber ();
     
-  if (gMsrOptions->fTraceMsrVisitors) {
+  if (gMsrOptions ()->fTraceMsrVisitors) {
     fLogOutputStream <<
       "--> Start visiting msrVoice \"" <<
       elt->getVoiceName () << "\"" <<
@@ -1226,7 +1226,7 @@ void msr2LpsrTranslator::visitStart (S_msrVoice& elt)
 
   fCurrentVoiceOriginal = elt;
   
-  gIndenter++;
+  gIndenter ()++;
 
   switch (elt->getVoiceKind ()) {
     
@@ -1294,7 +1294,7 @@ void msr2LpsrTranslator::visitStart (S_msrVoice& elt)
               getPartCombinedName ();
                           
 #ifdef TRACE_OPTIONS
-          if (gTraceOptions->fTraceHarmonies) {
+          if (gTraceOptions ()->fTraceHarmonies) {
             fLogOutputStream <<
               "Creating a ChordNames context for \"" << voiceName <<
               "\" in part " << partCombinedName <<
@@ -1312,7 +1312,7 @@ void msr2LpsrTranslator::visitStart (S_msrVoice& elt)
   
           // append it to the current part block
 #ifdef TRACE_OPTIONS
-          if (gTraceOptions->fTraceHarmonies) {
+          if (gTraceOptions ()->fTraceHarmonies) {
             fLogOutputStream <<
               "Appending the ChordNames context for \"" << voiceName <<
               "\" in part " << partCombinedName <<
@@ -1376,7 +1376,7 @@ void msr2LpsrTranslator::visitStart (S_msrVoice& elt)
               getPartCombinedName ();
                           
 #ifdef TRACE_OPTIONS
-          if (gTraceOptions->fTraceHarmonies) {
+          if (gTraceOptions ()->fTraceHarmonies) {
             fLogOutputStream <<
               "Creating a FiguredBass context for \"" << voiceName <<
               "\" in part " << partCombinedName <<
@@ -1394,7 +1394,7 @@ void msr2LpsrTranslator::visitStart (S_msrVoice& elt)
   
           // append it to the current part block
 #ifdef TRACE_OPTIONS
-          if (gTraceOptions->fTraceHarmonies) {
+          if (gTraceOptions ()->fTraceHarmonies) {
             fLogOutputStream <<
               "Appending the FiguredBass context for \"" << voiceName <<
               "\" in part " << partCombinedName <<
@@ -1412,17 +1412,14 @@ void msr2LpsrTranslator::visitStart (S_msrVoice& elt)
       break;
   } // switch
 
-  // clear the voice notes map
-  fVoiceNotesMap.clear ();
-
   fFirstNoteCloneInVoice = nullptr;
 }
 
 void msr2LpsrTranslator::visitEnd (S_msrVoice& elt)
 {
-  gIndenter--;
+  gIndenter ()--;
 
-  if (gMsrOptions->fTraceMsrVisitors) {
+  if (gMsrOptions ()->fTraceMsrVisitors) {
     fLogOutputStream <<
       "--> End visiting msrVoice \"" <<
       elt->getVoiceName () << "\"" <<
@@ -1448,7 +1445,7 @@ void msr2LpsrTranslator::visitEnd (S_msrVoice& elt)
 //________________________________________________________________________
 void msr2LpsrTranslator::visitStart (S_msrVoiceStaffChange& elt)
 {
-  if (gMsrOptions->fTraceMsrVisitors) {
+  if (gMsrOptions ()->fTraceMsrVisitors) {
     fLogOutputStream <<
       "--> Start visiting msrVoiceStaffChange '" <<
       elt->asString () << "'" <<
@@ -1471,7 +1468,7 @@ void msr2LpsrTranslator::visitStart (S_msrVoiceStaffChange& elt)
 //________________________________________________________________________
 void msr2LpsrTranslator::visitStart (S_msrSegment& elt)
 {
-  if (gMsrOptions->fTraceMsrVisitors) {
+  if (gMsrOptions ()->fTraceMsrVisitors) {
     fLogOutputStream <<
       "--> Start visiting msrSegment '" <<
       elt->getSegmentAbsoluteNumber () << "'" <<
@@ -1505,7 +1502,7 @@ void msr2LpsrTranslator::visitStart (S_msrSegment& elt)
 
 void msr2LpsrTranslator::visitEnd (S_msrSegment& elt)
 {
-  if (gMsrOptions->fTraceMsrVisitors) {
+  if (gMsrOptions ()->fTraceMsrVisitors) {
     fLogOutputStream <<
       "--> End visiting msrSegment '" <<
       elt->getSegmentAbsoluteNumber () << "'" <<
@@ -1520,7 +1517,7 @@ void msr2LpsrTranslator::visitEnd (S_msrSegment& elt)
 //________________________________________________________________________
 void msr2LpsrTranslator::visitStart (S_msrHarmony& elt)
 {
-  if (gMsrOptions->fTraceMsrVisitors) {
+  if (gMsrOptions ()->fTraceMsrVisitors) {
     fLogOutputStream <<
       "--> Start visiting msrHarmony '" <<
       elt->asString () <<
@@ -1560,7 +1557,7 @@ void msr2LpsrTranslator::visitStart (S_msrHarmony& elt)
 
 void msr2LpsrTranslator::visitStart (S_msrHarmonyDegree& elt)
 {
-  if (gMsrOptions->fTraceMsrVisitors) {
+  if (gMsrOptions ()->fTraceMsrVisitors) {
     fLogOutputStream <<
       "--> Start visiting S_msrHarmonyDegree '" <<
       elt->asString () <<
@@ -1579,7 +1576,7 @@ void msr2LpsrTranslator::visitStart (S_msrHarmonyDegree& elt)
 
 void msr2LpsrTranslator::visitEnd (S_msrHarmony& elt)
 {
-  if (gMsrOptions->fTraceMsrVisitors) {
+  if (gMsrOptions ()->fTraceMsrVisitors) {
     fLogOutputStream <<
       "--> End visiting msrHarmony '" <<
       elt->asString () <<
@@ -1592,7 +1589,7 @@ void msr2LpsrTranslator::visitEnd (S_msrHarmony& elt)
 //________________________________________________________________________
 void msr2LpsrTranslator::visitStart (S_msrFrame& elt)
 {
-  if (gMsrOptions->fTraceMsrVisitors) {
+  if (gMsrOptions ()->fTraceMsrVisitors) {
     fLogOutputStream <<
       "--> Start visiting msrFrame '" <<
       elt->asString () <<
@@ -1611,7 +1608,7 @@ void msr2LpsrTranslator::visitStart (S_msrFrame& elt)
 //________________________________________________________________________
 void msr2LpsrTranslator::visitStart (S_msrFiguredBass& elt)
 {
-  if (gMsrOptions->fTraceMsrVisitors) {
+  if (gMsrOptions ()->fTraceMsrVisitors) {
     fLogOutputStream <<
       "--> Start visiting msrFiguredBass '" <<
       elt->asString () <<
@@ -1652,7 +1649,7 @@ void msr2LpsrTranslator::visitStart (S_msrFiguredBass& elt)
 
 void msr2LpsrTranslator::visitStart (S_msrFigure& elt)
 {
-  if (gMsrOptions->fTraceMsrVisitors) {
+  if (gMsrOptions ()->fTraceMsrVisitors) {
     fLogOutputStream <<
       "--> Start visiting msrFigure '" <<
       elt->asString () <<
@@ -1669,7 +1666,7 @@ void msr2LpsrTranslator::visitStart (S_msrFigure& elt)
 
 void msr2LpsrTranslator::visitEnd (S_msrFiguredBass& elt)
 {
-  if (gMsrOptions->fTraceMsrVisitors) {
+  if (gMsrOptions ()->fTraceMsrVisitors) {
     fLogOutputStream <<
       "--> End visiting msrFiguredBass '" <<
       elt->asString () <<
@@ -1692,7 +1689,7 @@ void msr2LpsrTranslator::visitStart (S_msrMeasure& elt)
     measureNumber =
       elt->getMeasureNumber ();
 
-  if (gMsrOptions->fTraceMsrVisitors) {
+  if (gMsrOptions ()->fTraceMsrVisitors) {
     fLogOutputStream <<
       "--> Start visiting msrMeasure '" <<
       measureNumber <<
@@ -1711,7 +1708,7 @@ void msr2LpsrTranslator::visitStart (S_msrMeasure& elt)
      */
       
 #ifdef TRACE_OPTIONS
-  if (gTraceOptions->fTraceMeasures || gTraceOptions->fTracePasses) {
+  if (gTraceOptions ()->fTraceMeasures || gTraceOptions ()->fTracePasses) {
     fLogOutputStream <<
       endl <<
       "<!--=== measure '" << measureNumber <<
@@ -1765,13 +1762,6 @@ void msr2LpsrTranslator::finalizeCurrentMeasureClone (
         getMeasureSegmentUplink ()->
           getSegmentVoiceUplink ();
     
-  // fetch the part measure position high tide
-  rational
-    partMeasureLengthHighTide = // JMI
-      fCurrentMeasureClone->
-        fetchMeasurePartUplink ()->
-          getPartMeasureLengthHighTide ();
-
   // get the measure number
   string
     measureNumber =
@@ -1791,7 +1781,14 @@ void msr2LpsrTranslator::finalizeCurrentMeasureClone (
         getMeasureFullLength ();
     
 #ifdef TRACE_OPTIONS
-  if (gTraceOptions->fTraceMeasures) {
+  if (gTraceOptions ()->fTraceMeasures) {
+    // fetch the part measure position high tide
+    rational
+      partMeasureLengthHighTide = // JMI
+        fCurrentMeasureClone->
+          fetchMeasurePartUplink ()->
+            getPartMeasureLengthHighTide ();
+
     fLogOutputStream <<
       "Finalizing measure " << measureNumber <<
       " in voice \"" << voice->getVoiceName () <<
@@ -1856,7 +1853,7 @@ void msr2LpsrTranslator::finalizeCurrentMeasureClone (
       originalMeasure;
 
     msrInternalError (
-      gXml2lyOptions->fInputSourceName,
+      gXml2lyOptions ()->fInputSourceName,
       inputLineNumber,
       __FILE__, __LINE__,
       s.str ());
@@ -1868,7 +1865,7 @@ void msr2LpsrTranslator::visitEnd (S_msrMeasure& elt)
   int inputLineNumber =
     elt->getInputLineNumber ();
     
-  if (gMsrOptions->fTraceMsrVisitors) {
+  if (gMsrOptions ()->fTraceMsrVisitors) {
     fLogOutputStream <<
       "--> End visiting msrMeasure '" <<
       elt->getMeasureNumber () <<
@@ -1903,7 +1900,7 @@ void msr2LpsrTranslator::visitEnd (S_msrMeasure& elt)
 
       // JMI  msrInternalError (
         msrInternalWarning (
-          gXml2lyOptions->fInputSourceName,
+          gXml2lyOptions ()->fInputSourceName,
           inputLineNumber,
   //        __FILE__, __LINE__,
           s.str ());
@@ -1966,7 +1963,7 @@ void msr2LpsrTranslator::visitEnd (S_msrMeasure& elt)
 //________________________________________________________________________
 void msr2LpsrTranslator::visitStart (S_msrStanza& elt)
 {
-  if (gMsrOptions->fTraceMsrVisitors) {
+  if (gMsrOptions ()->fTraceMsrVisitors) {
     fLogOutputStream <<
       "--> Start visiting msrStanza \"" <<
       elt->getStanzaName () <<
@@ -1975,7 +1972,7 @@ void msr2LpsrTranslator::visitStart (S_msrStanza& elt)
       endl;
   }
 
-  gIndenter++;
+  gIndenter ()++;
 
 //  if (elt->getStanzaTextPresent ()) { // JMI
     fCurrentStanzaClone =
@@ -2000,9 +1997,9 @@ void msr2LpsrTranslator::visitStart (S_msrStanza& elt)
 
 void msr2LpsrTranslator::visitEnd (S_msrStanza& elt)
 {
-  gIndenter--;
+  gIndenter ()--;
   
-  if (gMsrOptions->fTraceMsrVisitors) {
+  if (gMsrOptions ()->fTraceMsrVisitors) {
     fLogOutputStream <<
       "--> End visiting msrStanza \"" <<
       elt->getStanzaName () <<
@@ -2023,33 +2020,34 @@ void msr2LpsrTranslator::visitStart (S_msrSyllable& elt)
   int inputLineNumber =
     elt->getInputLineNumber ();
     
-  if (gMsrOptions->fTraceMsrVisitors) {
+  if (gMsrOptions ()->fTraceMsrVisitors) {
     fLogOutputStream <<
       "--> Start visiting msrSyllable" <<
       ", line " << inputLineNumber <<
       endl;
   }
 
-  // create the syllable clone
-  fCurrentSyllableClone =
-    elt->createSyllableNewbornClone (
-      fCurrentPartClone);
+  // the syllable is not modified in the LPSR: share it with the MSR.
+  // its uplinks remain the MSR note and stanza, as those of the clones
+  // used to: the LPSR clones of these have the same contents, and pass 4
+  // only reads the note kind and display whole notes through them
 
   // add it to the current stanza clone or current note clone
   if (fOnGoingStanza) { // fCurrentStanzaClone JM
     // visiting a syllable as a stanza member
     fCurrentStanzaClone->
       appendSyllableToStanza (
-        fCurrentSyllableClone);
+        elt);
   }
   
   else if (fOnGoingNote) { // JMI
-    // visiting a syllable as attached to the current non-grace note
-    fCurrentSyllableClone->
-      appendSyllableToNoteAndSetItsNoteUplink (
-        fCurrentNonGraceNoteClone);
+    // visiting a syllable as attached to the current non-grace note,
+    // its note uplink is left to the MSR note
+    fCurrentNonGraceNoteClone->
+      appendSyllableToNote (
+        elt);
 
-    if (gLpsrOptions->fAddWordsFromTheLyrics) {
+    if (gLpsrOptions ()->fAddWordsFromTheLyrics) {
       // get the syllable texts list
       const list<string>&
         syllableTextsList =
@@ -2063,14 +2061,14 @@ void msr2LpsrTranslator::visitStart (S_msrSyllable& elt)
   
         // create the words
 #ifdef TRACE_OPTIONS
-        if (gTraceOptions->fTraceLyrics || gTraceOptions->fTraceWords) {
+        if (gTraceOptions ()->fTraceLyrics || gTraceOptions ()->fTraceWords) {
           fLogOutputStream <<
             "Changing lyrics '" <<
             wordsValue <<
             "' into words for note '" <<
             fCurrentNonGraceNoteClone->asShortString () <<
             "'" <<
-      // JMI      fCurrentSyllableClone->asString () <<
+      // JMI      elt->asString () <<
             endl;
         }
 #endif
@@ -2091,7 +2089,7 @@ void msr2LpsrTranslator::visitStart (S_msrSyllable& elt)
   
         // append it to the current non-grace note
 #ifdef TRACE_OPTIONS
-        if (gTraceOptions->fTraceLyrics || gTraceOptions->fTraceWords) {
+        if (gTraceOptions ()->fTraceLyrics || gTraceOptions ()->fTraceWords) {
           fLogOutputStream <<
             "Appending words '" <<
             words->asShortString () <<
@@ -2129,7 +2127,7 @@ void msr2LpsrTranslator::visitStart (S_msrSyllable& elt)
 
 void msr2LpsrTranslator::visitEnd (S_msrSyllable& elt)
 {
-  if (gMsrOptions->fTraceMsrVisitors) {
+  if (gMsrOptions ()->fTraceMsrVisitors) {
     fLogOutputStream <<
       "--> End visiting msrSyllable" <<
       ", line " << elt->getInputLineNumber () <<
@@ -2140,7 +2138,7 @@ void msr2LpsrTranslator::visitEnd (S_msrSyllable& elt)
 //________________________________________________________________________
 void msr2LpsrTranslator::visitStart (S_msrClef& elt)
 {
-  if (gMsrOptions->fTraceMsrVisitors) {
+  if (gMsrOptions ()->fTraceMsrVisitors) {
     fLogOutputStream <<
       "--> Start visiting msrClef" <<
       ", line " << elt->getInputLineNumber () <<
@@ -2153,7 +2151,7 @@ void msr2LpsrTranslator::visitStart (S_msrClef& elt)
 
 void msr2LpsrTranslator::visitEnd (S_msrClef& elt)
 {
-  if (gMsrOptions->fTraceMsrVisitors) {
+  if (gMsrOptions ()->fTraceMsrVisitors) {
     fLogOutputStream <<
       "--> End visiting msrClef" <<
       ", line " << elt->getInputLineNumber () <<
@@ -2164,7 +2162,7 @@ void msr2LpsrTranslator::visitEnd (S_msrClef& elt)
 //________________________________________________________________________
 void msr2LpsrTranslator::visitStart (S_msrKey& elt)
 {
-  if (gMsrOptions->fTraceMsrVisitors) {
+  if (gMsrOptions ()->fTraceMsrVisitors) {
     fLogOutputStream <<
       "--> Start visiting msrKey" <<
       ", line " << elt->getInputLineNumber () <<
@@ -2177,7 +2175,7 @@ void msr2LpsrTranslator::visitStart (S_msrKey& elt)
 
 void msr2LpsrTranslator::visitEnd (S_msrKey& elt)
 {
-  if (gMsrOptions->fTraceMsrVisitors) {
+  if (gMsrOptions ()->fTraceMsrVisitors) {
     fLogOutputStream <<
       "--> End visiting msrKey" <<
       ", line " << elt->getInputLineNumber () <<
@@ -2188,7 +2186,7 @@ void msr2LpsrTranslator::visitEnd (S_msrKey& elt)
 //________________________________________________________________________
 void msr2LpsrTranslator::visitStart (S_msrTime& elt)
 {
-  if (gMsrOptions->fTraceMsrVisitors) {
+  if (gMsrOptions ()->fTraceMsrVisitors) {
     fLogOutputStream <<
       "--> Start visiting msrTime" <<
       ", line " << elt->getInputLineNumber () <<
@@ -2202,7 +2200,7 @@ void msr2LpsrTranslator::visitStart (S_msrTime& elt)
 
 void msr2LpsrTranslator::visitEnd (S_msrTime& elt)
 {
-  if (gMsrOptions->fTraceMsrVisitors) {
+  if (gMsrOptions ()->fTraceMsrVisitors) {
     fLogOutputStream <<
       "--> End visiting msrTime" <<
       ", line " << elt->getInputLineNumber () <<
@@ -2213,7 +2211,7 @@ void msr2LpsrTranslator::visitEnd (S_msrTime& elt)
 //________________________________________________________________________
 void msr2LpsrTranslator::visitStart (S_msrTranspose& elt)
 {
-  if (gMsrOptions->fTraceMsrVisitors) {
+  if (gMsrOptions ()->fTraceMsrVisitors) {
     fLogOutputStream <<
       "--> Start visiting msrTranspose" <<
       ", line " << elt->getInputLineNumber () <<
@@ -2227,7 +2225,7 @@ void msr2LpsrTranslator::visitStart (S_msrTranspose& elt)
 
 void msr2LpsrTranslator::visitEnd (S_msrTranspose& elt)
 {
-  if (gMsrOptions->fTraceMsrVisitors) {
+  if (gMsrOptions ()->fTraceMsrVisitors) {
     fLogOutputStream <<
       "--> End visiting msrTranspose" <<
       ", line " << elt->getInputLineNumber () <<
@@ -2238,7 +2236,7 @@ void msr2LpsrTranslator::visitEnd (S_msrTranspose& elt)
 //________________________________________________________________________
 void msr2LpsrTranslator::visitStart (S_msrPartNameDisplay& elt)
 {
-  if (gMsrOptions->fTraceMsrVisitors) {
+  if (gMsrOptions ()->fTraceMsrVisitors) {
     fLogOutputStream <<
       "--> Start visiting msrPartNameDisplay" <<
       ", line " << elt->getInputLineNumber () <<
@@ -2253,7 +2251,7 @@ void msr2LpsrTranslator::visitStart (S_msrPartNameDisplay& elt)
 //________________________________________________________________________
 void msr2LpsrTranslator::visitStart (S_msrPartAbbreviationDisplay& elt)
 {
-  if (gMsrOptions->fTraceMsrVisitors) {
+  if (gMsrOptions ()->fTraceMsrVisitors) {
     fLogOutputStream <<
       "--> Start visiting msrPartAbbreviationDisplay" <<
       ", line " << elt->getInputLineNumber () <<
@@ -2268,7 +2266,7 @@ void msr2LpsrTranslator::visitStart (S_msrPartAbbreviationDisplay& elt)
 //________________________________________________________________________
 void msr2LpsrTranslator::visitStart (S_msrTempo& elt)
 {
-  if (gMsrOptions->fTraceMsrVisitors) {
+  if (gMsrOptions ()->fTraceMsrVisitors) {
     fLogOutputStream <<
       "--> Start visiting msrTempo" <<
       ", line " << elt->getInputLineNumber () <<
@@ -2298,7 +2296,7 @@ void msr2LpsrTranslator::visitStart (S_msrTempo& elt)
 
 void msr2LpsrTranslator::visitEnd (S_msrTempo& elt)
 {
-  if (gMsrOptions->fTraceMsrVisitors) {
+  if (gMsrOptions ()->fTraceMsrVisitors) {
     fLogOutputStream <<
       "--> End visiting msrTempo" <<
       ", line " << elt->getInputLineNumber () <<
@@ -2309,7 +2307,7 @@ void msr2LpsrTranslator::visitEnd (S_msrTempo& elt)
 //________________________________________________________________________
 void msr2LpsrTranslator::visitStart (S_msrRehearsal& elt)
 {
-  if (gMsrOptions->fTraceMsrVisitors) {
+  if (gMsrOptions ()->fTraceMsrVisitors) {
     fLogOutputStream <<
       "--> Start visiting msrRehearsal" <<
       ", line " << elt->getInputLineNumber () <<
@@ -2322,7 +2320,7 @@ void msr2LpsrTranslator::visitStart (S_msrRehearsal& elt)
 
 void msr2LpsrTranslator::visitEnd (S_msrRehearsal& elt)
 {
-  if (gMsrOptions->fTraceMsrVisitors) {
+  if (gMsrOptions ()->fTraceMsrVisitors) {
     fLogOutputStream <<
       "--> End visiting msrRehearsal" <<
       ", line " << elt->getInputLineNumber () <<
@@ -2333,7 +2331,7 @@ void msr2LpsrTranslator::visitEnd (S_msrRehearsal& elt)
 //________________________________________________________________________
 void msr2LpsrTranslator::visitStart (S_msrArticulation& elt)
 {
-  if (gMsrOptions->fTraceMsrVisitors) {
+  if (gMsrOptions ()->fTraceMsrVisitors) {
     fLogOutputStream <<
       "--> Start visiting msrArticulation" <<
       ", line " << elt->getInputLineNumber () <<
@@ -2352,7 +2350,7 @@ void msr2LpsrTranslator::visitStart (S_msrArticulation& elt)
 
 void msr2LpsrTranslator::visitEnd (S_msrArticulation& elt)
 {
-  if (gMsrOptions->fTraceMsrVisitors) {
+  if (gMsrOptions ()->fTraceMsrVisitors) {
     fLogOutputStream <<
       "--> End visiting msrArticulation" <<
       ", line " << elt->getInputLineNumber () <<
@@ -2363,7 +2361,7 @@ void msr2LpsrTranslator::visitEnd (S_msrArticulation& elt)
 //________________________________________________________________________
 void msr2LpsrTranslator::visitStart (S_msrFermata& elt)
 {
-  if (gMsrOptions->fTraceMsrVisitors) {
+  if (gMsrOptions ()->fTraceMsrVisitors) {
     fLogOutputStream <<
       "--> Start visiting msrFermata" <<
       ", line " << elt->getInputLineNumber () <<
@@ -2385,7 +2383,7 @@ void msr2LpsrTranslator::visitStart (S_msrFermata& elt)
 //________________________________________________________________________
 void msr2LpsrTranslator::visitStart (S_msrArpeggiato& elt)
 {
-  if (gMsrOptions->fTraceMsrVisitors) {
+  if (gMsrOptions ()->fTraceMsrVisitors) {
     fLogOutputStream <<
       "--> Start visiting msrArpeggiato" <<
       ", line " << elt->getInputLineNumber () <<
@@ -2407,7 +2405,7 @@ void msr2LpsrTranslator::visitStart (S_msrArpeggiato& elt)
 //________________________________________________________________________
 void msr2LpsrTranslator::visitStart (S_msrNonArpeggiato& elt)
 {
-  if (gMsrOptions->fTraceMsrVisitors) {
+  if (gMsrOptions ()->fTraceMsrVisitors) {
     fLogOutputStream <<
       "--> Start visiting msrNonArpeggiato" <<
       ", line " << elt->getInputLineNumber () <<
@@ -2429,7 +2427,7 @@ void msr2LpsrTranslator::visitStart (S_msrNonArpeggiato& elt)
 //________________________________________________________________________
 void msr2LpsrTranslator::visitStart (S_msrTechnical& elt)
 {
-  if (gMsrOptions->fTraceMsrVisitors) {
+  if (gMsrOptions ()->fTraceMsrVisitors) {
     fLogOutputStream <<
       "--> Start visiting msrTechnical" <<
       ", line " << elt->getInputLineNumber () <<
@@ -2488,7 +2486,7 @@ void msr2LpsrTranslator::visitStart (S_msrTechnical& elt)
 
 void msr2LpsrTranslator::visitEnd (S_msrTechnical& elt)
 {
-  if (gMsrOptions->fTraceMsrVisitors) {
+  if (gMsrOptions ()->fTraceMsrVisitors) {
     fLogOutputStream <<
       "--> End visiting msrTechnical" <<
       ", line " << elt->getInputLineNumber () <<
@@ -2499,7 +2497,7 @@ void msr2LpsrTranslator::visitEnd (S_msrTechnical& elt)
 //________________________________________________________________________
 void msr2LpsrTranslator::visitStart (S_msrTechnicalWithInteger& elt)
 {
-  if (gMsrOptions->fTraceMsrVisitors) {
+  if (gMsrOptions ()->fTraceMsrVisitors) {
     fLogOutputStream <<
       "--> Start visiting msrTechnicalWithInteger" <<
       ", line " << elt->getInputLineNumber () <<
@@ -2518,7 +2516,7 @@ void msr2LpsrTranslator::visitStart (S_msrTechnicalWithInteger& elt)
 
 void msr2LpsrTranslator::visitEnd (S_msrTechnicalWithInteger& elt)
 {
-  if (gMsrOptions->fTraceMsrVisitors) {
+  if (gMsrOptions ()->fTraceMsrVisitors) {
     fLogOutputStream <<
       "--> End visiting msrTechnicalWithInteger" <<
       ", line " << elt->getInputLineNumber () <<
@@ -2529,7 +2527,7 @@ void msr2LpsrTranslator::visitEnd (S_msrTechnicalWithInteger& elt)
 //________________________________________________________________________
 void msr2LpsrTranslator::visitStart (S_msrTechnicalWithFloat& elt)
 {
-  if (gMsrOptions->fTraceMsrVisitors) {
+  if (gMsrOptions ()->fTraceMsrVisitors) {
     fLogOutputStream <<
       "--> Start visiting msrTechnicalWithFloat" <<
       ", line " << elt->getInputLineNumber () <<
@@ -2548,7 +2546,7 @@ void msr2LpsrTranslator::visitStart (S_msrTechnicalWithFloat& elt)
 
 void msr2LpsrTranslator::visitEnd (S_msrTechnicalWithFloat& elt)
 {
-  if (gMsrOptions->fTraceMsrVisitors) {
+  if (gMsrOptions ()->fTraceMsrVisitors) {
     fLogOutputStream <<
       "--> End visiting msrTechnicalWithFloat" <<
       ", line " << elt->getInputLineNumber () <<
@@ -2559,7 +2557,7 @@ void msr2LpsrTranslator::visitEnd (S_msrTechnicalWithFloat& elt)
 //________________________________________________________________________
 void msr2LpsrTranslator::visitStart (S_msrTechnicalWithString& elt)
 {
-  if (gMsrOptions->fTraceMsrVisitors) {
+  if (gMsrOptions ()->fTraceMsrVisitors) {
     fLogOutputStream <<
       "--> Start visiting msrTechnicalWithString" <<
       ", line " << elt->getInputLineNumber () <<
@@ -2589,7 +2587,7 @@ void msr2LpsrTranslator::visitStart (S_msrTechnicalWithString& elt)
 
 void msr2LpsrTranslator::visitEnd (S_msrTechnicalWithString& elt)
 {
-  if (gMsrOptions->fTraceMsrVisitors) {
+  if (gMsrOptions ()->fTraceMsrVisitors) {
     fLogOutputStream <<
       "--> End visiting msrTechnicalWithString" <<
       ", line " << elt->getInputLineNumber () <<
@@ -2600,7 +2598,7 @@ void msr2LpsrTranslator::visitEnd (S_msrTechnicalWithString& elt)
 //________________________________________________________________________
 void msr2LpsrTranslator::visitStart (S_msrOrnament& elt)
 {
-  if (gMsrOptions->fTraceMsrVisitors) {
+  if (gMsrOptions ()->fTraceMsrVisitors) {
     fLogOutputStream <<
       "--> Start visiting msrOrnament" <<
       ", line " << elt->getInputLineNumber () <<
@@ -2619,7 +2617,7 @@ void msr2LpsrTranslator::visitStart (S_msrOrnament& elt)
 
 void msr2LpsrTranslator::visitEnd (S_msrOrnament& elt)
 {
-  if (gMsrOptions->fTraceMsrVisitors) {
+  if (gMsrOptions ()->fTraceMsrVisitors) {
     fLogOutputStream <<
       "--> End visiting msrOrnament" <<
       ", line " << elt->getInputLineNumber () <<
@@ -2630,7 +2628,7 @@ void msr2LpsrTranslator::visitEnd (S_msrOrnament& elt)
 //________________________________________________________________________
 void msr2LpsrTranslator::visitStart (S_msrSpanner& elt)
 {
-  if (gMsrOptions->fTraceMsrVisitors) {
+  if (gMsrOptions ()->fTraceMsrVisitors) {
     fLogOutputStream <<
       "--> Start visiting msrSpanner" <<
       ", line " << elt->getInputLineNumber () <<
@@ -2661,7 +2659,7 @@ void msr2LpsrTranslator::visitStart (S_msrSpanner& elt)
 
 void msr2LpsrTranslator::visitEnd (S_msrSpanner& elt)
 {
-  if (gMsrOptions->fTraceMsrVisitors) {
+  if (gMsrOptions ()->fTraceMsrVisitors) {
     fLogOutputStream <<
       "--> End visiting msrSpanner" <<
       ", line " << elt->getInputLineNumber () <<
@@ -2672,7 +2670,7 @@ void msr2LpsrTranslator::visitEnd (S_msrSpanner& elt)
 //________________________________________________________________________
 void msr2LpsrTranslator::visitStart (S_msrGlissando& elt)
 {
-  if (gMsrOptions->fTraceMsrVisitors) {
+  if (gMsrOptions ()->fTraceMsrVisitors) {
     fLogOutputStream <<
       "--> Start visiting msrGlissando" <<
       ", line " << elt->getInputLineNumber () <<
@@ -2697,7 +2695,7 @@ void msr2LpsrTranslator::visitStart (S_msrGlissando& elt)
 
 void msr2LpsrTranslator::visitEnd (S_msrGlissando& elt)
 {
-  if (gMsrOptions->fTraceMsrVisitors) {
+  if (gMsrOptions ()->fTraceMsrVisitors) {
     fLogOutputStream <<
       "--> End visiting msrGlissando" <<
       ", line " << elt->getInputLineNumber () <<
@@ -2708,7 +2706,7 @@ void msr2LpsrTranslator::visitEnd (S_msrGlissando& elt)
 //________________________________________________________________________
 void msr2LpsrTranslator::visitStart (S_msrSlide& elt)
 {
-  if (gMsrOptions->fTraceMsrVisitors) {
+  if (gMsrOptions ()->fTraceMsrVisitors) {
     fLogOutputStream <<
       "--> Start visiting msrSlide" <<
       ", line " << elt->getInputLineNumber () <<
@@ -2727,7 +2725,7 @@ void msr2LpsrTranslator::visitStart (S_msrSlide& elt)
 
 void msr2LpsrTranslator::visitEnd (S_msrSlide& elt)
 {
-  if (gMsrOptions->fTraceMsrVisitors) {
+  if (gMsrOptions ()->fTraceMsrVisitors) {
     fLogOutputStream <<
       "--> End visiting msrSlide" <<
       ", line " << elt->getInputLineNumber () <<
@@ -2738,7 +2736,7 @@ void msr2LpsrTranslator::visitEnd (S_msrSlide& elt)
 //________________________________________________________________________
 void msr2LpsrTranslator::visitStart (S_msrSingleTremolo& elt)
 {
-  if (gMsrOptions->fTraceMsrVisitors) {
+  if (gMsrOptions ()->fTraceMsrVisitors) {
     fLogOutputStream <<
       "--> Start visiting msrSingleTremolo" <<
       ", line " << elt->getInputLineNumber () <<
@@ -2757,7 +2755,7 @@ void msr2LpsrTranslator::visitStart (S_msrSingleTremolo& elt)
 
 void msr2LpsrTranslator::visitEnd (S_msrSingleTremolo& elt)
 {
-  if (gMsrOptions->fTraceMsrVisitors) {
+  if (gMsrOptions ()->fTraceMsrVisitors) {
     fLogOutputStream <<
       "--> End visiting msrSingleTremolo" <<
       ", line " << elt->getInputLineNumber () <<
@@ -2768,7 +2766,7 @@ void msr2LpsrTranslator::visitEnd (S_msrSingleTremolo& elt)
 //________________________________________________________________________
 void msr2LpsrTranslator::visitStart (S_msrDoubleTremolo& elt)
 {
-  if (gMsrOptions->fTraceMsrVisitors) {
+  if (gMsrOptions ()->fTraceMsrVisitors) {
     fLogOutputStream <<
       "--> Start visiting msrDoubleTremolo" <<
       ", line " << elt->getInputLineNumber () <<
@@ -2790,7 +2788,7 @@ void msr2LpsrTranslator::visitStart (S_msrDoubleTremolo& elt)
 
 void msr2LpsrTranslator::visitEnd (S_msrDoubleTremolo& elt)
 {
-  if (gMsrOptions->fTraceMsrVisitors) {
+  if (gMsrOptions ()->fTraceMsrVisitors) {
     fLogOutputStream <<
       "--> End visiting msrSingleTremolo" <<
       ", line " << elt->getInputLineNumber () <<
@@ -2811,7 +2809,7 @@ void msr2LpsrTranslator::visitEnd (S_msrDoubleTremolo& elt)
 //________________________________________________________________________
 void msr2LpsrTranslator::visitStart (S_msrDynamics& elt)
 {
-  if (gMsrOptions->fTraceMsrVisitors) {
+  if (gMsrOptions ()->fTraceMsrVisitors) {
     fLogOutputStream <<
       "--> Start visiting msrDynamics" <<
       ", line " << elt->getInputLineNumber () <<
@@ -2855,7 +2853,7 @@ void msr2LpsrTranslator::visitStart (S_msrDynamics& elt)
 
 void msr2LpsrTranslator::visitEnd (S_msrDynamics& elt)
 {
-  if (gMsrOptions->fTraceMsrVisitors) {
+  if (gMsrOptions ()->fTraceMsrVisitors) {
     fLogOutputStream <<
       "--> End visiting msrDynamics" <<
       ", line " << elt->getInputLineNumber () <<
@@ -2866,7 +2864,7 @@ void msr2LpsrTranslator::visitEnd (S_msrDynamics& elt)
 //________________________________________________________________________
 void msr2LpsrTranslator::visitStart (S_msrOtherDynamics& elt)
 {
-  if (gMsrOptions->fTraceMsrVisitors) {
+  if (gMsrOptions ()->fTraceMsrVisitors) {
     fLogOutputStream <<
       "--> Start visiting msrOtherDynamics" <<
       ", line " << elt->getInputLineNumber () <<
@@ -2885,7 +2883,7 @@ void msr2LpsrTranslator::visitStart (S_msrOtherDynamics& elt)
 
 void msr2LpsrTranslator::visitEnd (S_msrOtherDynamics& elt)
 {
-  if (gMsrOptions->fTraceMsrVisitors) {
+  if (gMsrOptions ()->fTraceMsrVisitors) {
     fLogOutputStream <<
       "--> End visiting msrOtherDynamics" <<
       ", line " << elt->getInputLineNumber () <<
@@ -2896,7 +2894,7 @@ void msr2LpsrTranslator::visitEnd (S_msrOtherDynamics& elt)
 //________________________________________________________________________
 void msr2LpsrTranslator::visitStart (S_msrWords& elt)
 {
-  if (gMsrOptions->fTraceMsrVisitors) {
+  if (gMsrOptions ()->fTraceMsrVisitors) {
     fLogOutputStream <<
       "--> Start visiting msrWords" <<
       ", line " << elt->getInputLineNumber () <<
@@ -2915,7 +2913,7 @@ void msr2LpsrTranslator::visitStart (S_msrWords& elt)
 
 void msr2LpsrTranslator::visitEnd (S_msrWords& elt)
 {
-  if (gMsrOptions->fTraceMsrVisitors) {
+  if (gMsrOptions ()->fTraceMsrVisitors) {
     fLogOutputStream <<
       "--> End visiting msrWords" <<
       ", line " << elt->getInputLineNumber () <<
@@ -2926,7 +2924,7 @@ void msr2LpsrTranslator::visitEnd (S_msrWords& elt)
 //________________________________________________________________________
 void msr2LpsrTranslator::visitStart (S_msrSlur& elt)
 {
-  if (gMsrOptions->fTraceMsrVisitors) {
+  if (gMsrOptions ()->fTraceMsrVisitors) {
     fLogOutputStream <<
       "--> Start visiting msrSlur" <<
       ", line " << elt->getInputLineNumber () <<
@@ -2964,7 +2962,7 @@ void msr2LpsrTranslator::visitStart (S_msrSlur& elt)
 
 void msr2LpsrTranslator::visitEnd (S_msrSlur& elt)
 {
-  if (gMsrOptions->fTraceMsrVisitors) {
+  if (gMsrOptions ()->fTraceMsrVisitors) {
     fLogOutputStream <<
       "--> End visiting msrSlur" <<
       ", line " << elt->getInputLineNumber () <<
@@ -2975,7 +2973,7 @@ void msr2LpsrTranslator::visitEnd (S_msrSlur& elt)
 //________________________________________________________________________
 void msr2LpsrTranslator::visitStart (S_msrLigature& elt)
 {
-  if (gMsrOptions->fTraceMsrVisitors) {
+  if (gMsrOptions ()->fTraceMsrVisitors) {
     fLogOutputStream <<
       "--> Start visiting msrLigature" <<
       ", line " << elt->getInputLineNumber () <<
@@ -2994,7 +2992,7 @@ void msr2LpsrTranslator::visitStart (S_msrLigature& elt)
 
 void msr2LpsrTranslator::visitEnd (S_msrLigature& elt)
 {
-  if (gMsrOptions->fTraceMsrVisitors) {
+  if (gMsrOptions ()->fTraceMsrVisitors) {
     fLogOutputStream <<
       "--> End visiting msrLigature" <<
       ", line " << elt->getInputLineNumber () <<
@@ -3005,7 +3003,7 @@ void msr2LpsrTranslator::visitEnd (S_msrLigature& elt)
 //________________________________________________________________________
 void msr2LpsrTranslator::visitStart (S_msrSlash& elt)
 {
-  if (gMsrOptions->fTraceMsrVisitors) {
+  if (gMsrOptions ()->fTraceMsrVisitors) {
     fLogOutputStream <<
       "--> Start visiting msrSlash" <<
       ", line " << elt->getInputLineNumber () <<
@@ -3026,7 +3024,7 @@ void msr2LpsrTranslator::visitStart (S_msrSlash& elt)
 //________________________________________________________________________
 void msr2LpsrTranslator::visitStart (S_msrWedge& elt)
 {
-  if (gMsrOptions->fTraceMsrVisitors) {
+  if (gMsrOptions ()->fTraceMsrVisitors) {
     fLogOutputStream <<
       "--> Start visiting msrWedge" <<
       ", line " << elt->getInputLineNumber () <<
@@ -3046,7 +3044,7 @@ void msr2LpsrTranslator::visitStart (S_msrWedge& elt)
 
 void msr2LpsrTranslator::visitEnd (S_msrWedge& elt)
 {
-  if (gMsrOptions->fTraceMsrVisitors) {
+  if (gMsrOptions ()->fTraceMsrVisitors) {
     fLogOutputStream <<
       "--> End visiting msrWedge" <<
       ", line " << elt->getInputLineNumber () <<
@@ -3060,7 +3058,7 @@ void msr2LpsrTranslator::visitStart (S_msrGraceNotesGroup& elt)
   int inputLineNumber =
     elt->getInputLineNumber () ;
     
-  if (gMsrOptions->fTraceMsrVisitors) {
+  if (gMsrOptions ()->fTraceMsrVisitors) {
     fLogOutputStream <<
       "--> Start visiting msrGraceNotesGroup" <<
       ", line " << inputLineNumber <<
@@ -3072,7 +3070,7 @@ void msr2LpsrTranslator::visitStart (S_msrGraceNotesGroup& elt)
   if (doCreateAGraceNoteClone) {
     // create a clone of this graceNotesGroup
 #ifdef TRACE_OPTIONS
-    if (gTraceOptions->fTraceNotes || gTraceOptions->fTraceGraceNotes) {
+    if (gTraceOptions ()->fTraceNotes || gTraceOptions ()->fTraceGraceNotes) {
       fLogOutputStream <<
         "Creating a clone of grace notes group '" << 
         elt->asShortString () <<
@@ -3108,7 +3106,7 @@ void msr2LpsrTranslator::visitStart (S_msrGraceNotesGroup& elt)
   }
 
 #ifdef TRACE_OPTIONS
-  if (gTraceOptions->fTraceNotes || gTraceOptions->fTraceGraceNotes) {
+  if (gTraceOptions ()->fTraceNotes || gTraceOptions ()->fTraceGraceNotes) {
     fLogOutputStream <<
       "+++++++++++++++++++++++++ 1" <<
       endl <<
@@ -3141,7 +3139,7 @@ void msr2LpsrTranslator::visitStart (S_msrGraceNotesGroup& elt)
       "' has an empty note uplink";
 
     msrInternalError (
-      gXml2lyOptions->fInputSourceName,
+      gXml2lyOptions ()->fInputSourceName,
       inputLineNumber,
       __FILE__, __LINE__,
       s.str ());
@@ -3152,11 +3150,11 @@ void msr2LpsrTranslator::visitStart (S_msrGraceNotesGroup& elt)
   // is noteNotesGroupIsAttachedTo the first one in its voice?
 #ifdef TRACE_OPTIONS
   if (
-    gTraceOptions->fTraceGraceNotes
+    gTraceOptions ()->fTraceGraceNotes
       ||
-    gTraceOptions->fTraceNotes
+    gTraceOptions ()->fTraceNotes
       ||
-    gTraceOptions->fTraceVoices
+    gTraceOptions ()->fTraceVoices
   ) {
     fLogOutputStream <<
       "The noteNotesGroupIsAttachedTo voice clone PEOJIOFEIOJEF '" <<
@@ -3179,11 +3177,11 @@ void msr2LpsrTranslator::visitStart (S_msrGraceNotesGroup& elt)
 
 #ifdef TRACE_OPTIONS
   if (
-    gTraceOptions->fTraceGraceNotes
+    gTraceOptions ()->fTraceGraceNotes
       ||
-    gTraceOptions->fTraceNotes
+    gTraceOptions ()->fTraceNotes
       ||
-    gTraceOptions->fTraceVoices
+    gTraceOptions ()->fTraceVoices
   ) {
     fLogOutputStream <<
       "The first note of voice clone KLJWLPOEF '" <<
@@ -3218,11 +3216,11 @@ void msr2LpsrTranslator::visitStart (S_msrGraceNotesGroup& elt)
       // create the skip grace notes group
   #ifdef TRACE_OPTIONS
         if (
-            gTraceOptions->fTraceGraceNotes
+            gTraceOptions ()->fTraceGraceNotes
               ||
-            gTraceOptions->fTraceNotes
+            gTraceOptions ()->fTraceNotes
               ||
-            gTraceOptions->fTraceVoices
+            gTraceOptions ()->fTraceVoices
         ) {
           fLogOutputStream <<
             "Creating a skip clone of grace notes group '" <<
@@ -3256,7 +3254,7 @@ void msr2LpsrTranslator::visitStart (S_msrGraceNotesGroup& elt)
       // the afterGraceNotesGroup to use
       
 #ifdef TRACE_OPTIONS
-      if (gTraceOptions->fTraceGraceNotesGroup) {
+      if (gTraceOptions ()->fTraceGraceNotesGroup) {
         fLogOutputStream <<
           "Optimising grace notes '" << 
           elt->asShortString () <<
@@ -3304,7 +3302,7 @@ void msr2LpsrTranslator::visitStart (S_msrGraceNotesGroup& elt)
   
       // create skip graceNotesGroup clone
 #ifdef TRACE_OPTIONS
-      if (gTraceOptions->fTraceGraceNotesGroup) {
+      if (gTraceOptions ()->fTraceGraceNotesGroup) {
         fLogOutputStream <<
           "Creating a skip clone of grace notes '" <<
           elt->asShortString () <<
@@ -3337,19 +3335,19 @@ void msr2LpsrTranslator::visitStart (S_msrGraceNotesGroup& elt)
 
       // create the after grace notes
 #ifdef TRACE_OPTIONS
-      if (gTraceOptions->fTraceGraceNotesGroup) {
+      if (gTraceOptions ()->fTraceGraceNotesGroup) {
         fLogOutputStream <<
           "Converting grace notes '" <<
           elt->asShortString () <<
           "' into after grace notes attached to:"<<
           endl;
 
-        gIndenter++;
+        gIndenter ()++;
         
         fCurrentAfterGraceNotesGroupElement->
           print (fLogOutputStream);
 
-        gIndenter--;
+        gIndenter ()--;
       }
 #endif
 
@@ -3362,7 +3360,7 @@ void msr2LpsrTranslator::visitStart (S_msrGraceNotesGroup& elt)
 
       // append it to the current note clone
 #ifdef TRACE_OPTIONS
-      if (gTraceOptions->fTraceGraceNotesGroup) {
+      if (gTraceOptions ()->fTraceGraceNotesGroup) {
         fLogOutputStream <<
           "Appending the after grace notes to current note clone" <<
           endl;
@@ -3381,7 +3379,7 @@ void msr2LpsrTranslator::visitStart (S_msrGraceNotesGroup& elt)
 
 void msr2LpsrTranslator::visitEnd (S_msrGraceNotesGroup& elt)
 {
-  if (gMsrOptions->fTraceMsrVisitors) {
+  if (gMsrOptions ()->fTraceMsrVisitors) {
     fLogOutputStream <<
       "--> End visiting msrGraceNotesGroup" <<
       ", line " << elt->getInputLineNumber () <<
@@ -3389,7 +3387,7 @@ void msr2LpsrTranslator::visitEnd (S_msrGraceNotesGroup& elt)
   }
 
 #ifdef TRACE_OPTIONS
-    if (gTraceOptions->fTraceNotes || gTraceOptions->fTraceGraceNotes) {
+    if (gTraceOptions ()->fTraceNotes || gTraceOptions ()->fTraceGraceNotes) {
     fLogOutputStream <<
       "+++++++++++++++++++++++++ 2" <<
       endl <<
@@ -3418,7 +3416,7 @@ void msr2LpsrTranslator::visitEnd (S_msrGraceNotesGroup& elt)
     // remove the current afterGraceNotesGroup note clone
     // from the current voice clone
 #ifdef TRACE_OPTIONS
-    if (gTraceOptions->fTraceGraceNotesGroup) {
+    if (gTraceOptions ()->fTraceGraceNotesGroup) {
       fLogOutputStream <<
         "Removing the after grace notes element from the current voice clone" <<
         endl;
@@ -3442,7 +3440,7 @@ void msr2LpsrTranslator::visitEnd (S_msrGraceNotesGroup& elt)
 //________________________________________________________________________
 void msr2LpsrTranslator::visitStart (S_msrNote& elt)
 {
-  if (gMsrOptions->fTraceMsrVisitors) {
+  if (gMsrOptions ()->fTraceMsrVisitors) {
     fLogOutputStream <<
       "--> Start visiting msrNote '" <<
       elt->asString () <<
@@ -3457,14 +3455,11 @@ void msr2LpsrTranslator::visitStart (S_msrNote& elt)
       elt->createNoteNewbornClone (
         fCurrentPartClone);
 
-  // register clone in this tranlastors' voice notes map
-  fVoiceNotesMap [elt] = noteClone; // JMI XXL
-  
   // don't register grace notes as the current note clone,
   // but as the current grace note clone instead
 /* JMI
 #ifdef TRACE_OPTIONS
-        if (gTraceOptions->fTraceNotes || gTraceOptions->fTraceVoices) {
+        if (gTraceOptions ()->fTraceNotes || gTraceOptions ()->fTraceVoices) {
           fLogOutputStream <<
             "The first note of voice clone GFFF '" <<
             fCurrentVoiceClone->getVoiceName () <<
@@ -3501,7 +3496,7 @@ void msr2LpsrTranslator::visitStart (S_msrNote& elt)
           fCurrentNonGraceNoteClone;
 
 #ifdef TRACE_OPTIONS
-        if (gTraceOptions->fTraceNotes || gTraceOptions->fTraceVoices) {
+        if (gTraceOptions ()->fTraceNotes || gTraceOptions ()->fTraceVoices) {
           fLogOutputStream <<
             "The first note of voice clone RJIRWR '" <<
             fCurrentVoiceClone->getVoiceName () <<
@@ -3524,7 +3519,7 @@ void msr2LpsrTranslator::visitStart (S_msrNote& elt)
     elt->getNoteTrillOrnament ()) {
     // yes, create the after grace notes
 #ifdef TRACE_OPTIONS
-    if (gTraceOptions->fTraceNotesGroup) {
+    if (gTraceOptions ()->fTraceNotesGroup) {
       fLogOutputStream <<
         "Optimizing grace notes on trilled note '" <<
         elt->asShortString () <<
@@ -3553,7 +3548,7 @@ void msr2LpsrTranslator::visitEnd (S_msrNote& elt)
   int inputLineNumber =
     elt->getInputLineNumber ();
     
-  if (gMsrOptions->fTraceMsrVisitors) {
+  if (gMsrOptions ()->fTraceMsrVisitors) {
     fLogOutputStream <<
       "--> End visiting msrNote " <<
       elt->asString () <<
@@ -3562,7 +3557,7 @@ void msr2LpsrTranslator::visitEnd (S_msrNote& elt)
   }
 
 #ifdef TRACE_OPTIONS
-  if (gTraceOptions->fTraceNotesDetails) {
+  if (gTraceOptions ()->fTraceNotesDetails) {
     fLogOutputStream <<
       "FAA fCurrentNonGraceNoteClone = " <<
       endl;
@@ -3598,7 +3593,7 @@ void msr2LpsrTranslator::visitEnd (S_msrNote& elt)
       
     case msrNote::kRestNote:
 #ifdef TRACE_OPTIONS
-      if (gTraceOptions->fTraceNotes) {
+      if (gTraceOptions ()->fTraceNotes) {
         fLogOutputStream <<
           "Appending rest note clone '" <<
           fCurrentNonGraceNoteClone->asShortString () << "' to voice clone " <<
@@ -3614,7 +3609,7 @@ void msr2LpsrTranslator::visitEnd (S_msrNote& elt)
       
     case msrNote::kSkipNote: // JMI
 #ifdef TRACE_OPTIONS
-      if (gTraceOptions->fTraceNotes) {
+      if (gTraceOptions ()->fTraceNotes) {
         fLogOutputStream <<
           "Appending skip note clone '" <<
           fCurrentNonGraceNoteClone->asShortString () << "' to voice clone " <<
@@ -3630,7 +3625,7 @@ void msr2LpsrTranslator::visitEnd (S_msrNote& elt)
       
     case msrNote::kUnpitchedNote:
 #ifdef TRACE_OPTIONS
-      if (gTraceOptions->fTraceNotes) {
+      if (gTraceOptions ()->fTraceNotes) {
         fLogOutputStream <<
           "Appending unpitched note clone '" <<
           fCurrentNonGraceNoteClone->asShortString () << "' to voice clone " <<
@@ -3646,7 +3641,7 @@ void msr2LpsrTranslator::visitEnd (S_msrNote& elt)
       
     case msrNote::kStandaloneNote:
 #ifdef TRACE_OPTIONS
-      if (gTraceOptions->fTraceNotes) {
+      if (gTraceOptions ()->fTraceNotes) {
         fLogOutputStream <<
           "Appending standalone note clone '" <<
           fCurrentNonGraceNoteClone->asShortString () << "' to voice clone " <<
@@ -3665,7 +3660,7 @@ void msr2LpsrTranslator::visitEnd (S_msrNote& elt)
         
         if (fCurrentNonGraceNoteClone->getNoteIsFirstNoteInADoubleTremolo ()) {
 #ifdef TRACE_OPTIONS
-          if (gTraceOptions->fTraceNotes) {
+          if (gTraceOptions ()->fTraceNotes) {
             fLogOutputStream <<
               "Setting note '" <<
               fCurrentNonGraceNoteClone->asString () <<
@@ -3685,7 +3680,7 @@ void msr2LpsrTranslator::visitEnd (S_msrNote& elt)
         
         else if (fCurrentNonGraceNoteClone->getNoteIsSecondNoteInADoubleTremolo ()) {
 #ifdef TRACE_OPTIONS
-          if (gTraceOptions->fTraceNotes) {
+          if (gTraceOptions ()->fTraceNotes) {
             fLogOutputStream <<
               "Setting note '" <<
               fCurrentNonGraceNoteClone->asString () <<
@@ -3711,7 +3706,7 @@ void msr2LpsrTranslator::visitEnd (S_msrNote& elt)
             "' belongs to a double tremolo, but is not marked as such";
 
           msrInternalError (
-            gXml2lyOptions->fInputSourceName,
+            gXml2lyOptions ()->fInputSourceName,
             inputLineNumber,
             __FILE__, __LINE__,
             s.str ());
@@ -3726,7 +3721,7 @@ void msr2LpsrTranslator::visitEnd (S_msrNote& elt)
           "' found outside of a double tremolo";
 
         msrInternalError (
-          gXml2lyOptions->fInputSourceName,
+          gXml2lyOptions ()->fInputSourceName,
           inputLineNumber,
           __FILE__, __LINE__,
           s.str ());
@@ -3750,14 +3745,14 @@ void msr2LpsrTranslator::visitEnd (S_msrNote& elt)
           "' found outside of grace notes";
 
         msrInternalError (
-          gXml2lyOptions->fInputSourceName,
+          gXml2lyOptions ()->fInputSourceName,
           inputLineNumber,
           __FILE__, __LINE__,
           s.str ());
       }
       else {
 #ifdef TRACE_OPTIONS
-        if (gTraceOptions->fTraceGraceNotes || gTraceOptions->fTraceNotes) {
+        if (gTraceOptions ()->fTraceGraceNotes || gTraceOptions ()->fTraceNotes) {
           fLogOutputStream <<
             "Appending grace note '" <<
             fCurrentGraceNoteClone->asShortString () <<
@@ -3777,7 +3772,7 @@ void msr2LpsrTranslator::visitEnd (S_msrNote& elt)
     /* JMI ???
       if (fCurrentGraceNotesGroupClone) {
 #ifdef TRACE_OPTIONS
-        if (gTraceOptions->fTraceGraceNotes || gTraceOptions->fTraceNotes) {
+        if (gTraceOptions ()->fTraceGraceNotes || gTraceOptions ()->fTraceNotes) {
           fLogOutputStream <<
             "Appending note '" <<
             fCurrentNonGraceNoteClone->asShortString () <<
@@ -3794,7 +3789,7 @@ void msr2LpsrTranslator::visitEnd (S_msrNote& elt)
 
       else if (fPendingAfterGraceNotes) {
 #ifdef TRACE_OPTIONS
-        if (gTraceOptions->fTraceGraceNotes || gTraceOptions->fTraceNotes) {
+        if (gTraceOptions ()->fTraceGraceNotes || gTraceOptions ()->fTraceNotes) {
           fLogOutputStream <<
             "Appending note '" <<
             fCurrentNonGraceNoteClone->asShortString () <<
@@ -3820,7 +3815,7 @@ void msr2LpsrTranslator::visitEnd (S_msrNote& elt)
           "'";
 
         msrInternalError (
-          gXml2lyOptions->fInputSourceName,
+          gXml2lyOptions ()->fInputSourceName,
           inputLineNumber,
           __FILE__, __LINE__,
           s.str ());
@@ -3845,7 +3840,7 @@ void msr2LpsrTranslator::visitEnd (S_msrNote& elt)
           " appears outside of a chord";
 
         msrInternalError (
-          gXml2lyOptions->fInputSourceName,
+          gXml2lyOptions ()->fInputSourceName,
           inputLineNumber,
           __FILE__, __LINE__,
           s.str ());
@@ -3869,7 +3864,7 @@ void msr2LpsrTranslator::visitEnd (S_msrNote& elt)
           " appears outside of a chord";
 
         msrInternalError (
-          gXml2lyOptions->fInputSourceName,
+          gXml2lyOptions ()->fInputSourceName,
           inputLineNumber,
           __FILE__, __LINE__,
           s.str ());
@@ -3880,7 +3875,7 @@ void msr2LpsrTranslator::visitEnd (S_msrNote& elt)
     case msrNote::kGraceTupletMemberNote:
     case msrNote::kTupletMemberUnpitchedNote:
 #ifdef TRACE_OPTIONS
-      if (gTraceOptions->fTraceNotes) {
+      if (gTraceOptions ()->fTraceNotes) {
         fLogOutputStream <<
           "Appending note clone '" <<
           fCurrentNonGraceNoteClone->asShortString () << "'' to voice clone " <<
@@ -3959,7 +3954,7 @@ void msr2LpsrTranslator::visitEnd (S_msrNote& elt)
 //________________________________________________________________________
 void msr2LpsrTranslator::visitStart (S_msrOctaveShift& elt)
 {
-  if (gMsrOptions->fTraceMsrVisitors) {
+  if (gMsrOptions ()->fTraceMsrVisitors) {
     fLogOutputStream <<
       "--> Start visiting msrOctaveShift" <<
       ", line " << elt->getInputLineNumber () <<
@@ -3972,7 +3967,7 @@ void msr2LpsrTranslator::visitStart (S_msrOctaveShift& elt)
 
 void msr2LpsrTranslator::visitEnd (S_msrOctaveShift& elt)
 {
-  if (gMsrOptions->fTraceMsrVisitors) {
+  if (gMsrOptions ()->fTraceMsrVisitors) {
     fLogOutputStream <<
       "--> End visiting msrOctaveShift" <<
       ", line " << elt->getInputLineNumber () <<
@@ -3983,7 +3978,7 @@ void msr2LpsrTranslator::visitEnd (S_msrOctaveShift& elt)
 //________________________________________________________________________
 void msr2LpsrTranslator::visitStart (S_msrAccordionRegistration& elt)
 {
-  if (gMsrOptions->fTraceMsrVisitors) {
+  if (gMsrOptions ()->fTraceMsrVisitors) {
     fLogOutputStream <<
       "--> Start visiting msrAccordionRegistration" <<
       ", line " << elt->getInputLineNumber () <<
@@ -4002,7 +3997,7 @@ void msr2LpsrTranslator::visitStart (S_msrAccordionRegistration& elt)
 //________________________________________________________________________
 void msr2LpsrTranslator::visitStart (S_msrHarpPedalsTuning& elt)
 {
-  if (gMsrOptions->fTraceMsrVisitors) {
+  if (gMsrOptions ()->fTraceMsrVisitors) {
     fLogOutputStream <<
       "--> Start visiting msrHarpPedalsTuning" <<
       ", line " << elt->getInputLineNumber () <<
@@ -4017,7 +4012,7 @@ void msr2LpsrTranslator::visitStart (S_msrHarpPedalsTuning& elt)
 //________________________________________________________________________
 void msr2LpsrTranslator::visitStart (S_msrStem& elt)
 {
-  if (gMsrOptions->fTraceMsrVisitors) {
+  if (gMsrOptions ()->fTraceMsrVisitors) {
     fLogOutputStream <<
       "--> Start visiting msrStem" <<
       ", line " << elt->getInputLineNumber () <<
@@ -4036,7 +4031,7 @@ void msr2LpsrTranslator::visitStart (S_msrStem& elt)
 
 void msr2LpsrTranslator::visitEnd (S_msrStem& elt)
 {
-  if (gMsrOptions->fTraceMsrVisitors) {
+  if (gMsrOptions ()->fTraceMsrVisitors) {
     fLogOutputStream <<
       "--> End visiting msrStem" <<
       ", line " << elt->getInputLineNumber () <<
@@ -4047,7 +4042,7 @@ void msr2LpsrTranslator::visitEnd (S_msrStem& elt)
 //________________________________________________________________________
 void msr2LpsrTranslator::visitStart (S_msrBeam& elt)
 {
-  if (gMsrOptions->fTraceMsrVisitors) {
+  if (gMsrOptions ()->fTraceMsrVisitors) {
     fLogOutputStream <<
       "--> Start visiting msrBeam" <<
       ", line " << elt->getInputLineNumber () <<
@@ -4076,7 +4071,7 @@ void msr2LpsrTranslator::visitStart (S_msrBeam& elt)
 
 void msr2LpsrTranslator::visitEnd (S_msrBeam& elt)
 {
-  if (gMsrOptions->fTraceMsrVisitors) {
+  if (gMsrOptions ()->fTraceMsrVisitors) {
     fLogOutputStream <<
       "--> End visiting msrBeam" <<
       ", line " << elt->getInputLineNumber () <<
@@ -4090,7 +4085,7 @@ void msr2LpsrTranslator::visitStart (S_msrChord& elt)
   int inputLineNumber =
     elt->getInputLineNumber ();
     
-  if (gMsrOptions->fTraceMsrVisitors) {
+  if (gMsrOptions ()->fTraceMsrVisitors) {
     fLogOutputStream <<
       "--> Start visiting msrChord" <<
       ", line " << inputLineNumber <<
@@ -4131,7 +4126,7 @@ void msr2LpsrTranslator::visitStart (S_msrChord& elt)
         "' belongs to a double tremolo, but is not marked as such";
 
       msrInternalError (
-        gXml2lyOptions->fInputSourceName,
+        gXml2lyOptions ()->fInputSourceName,
         inputLineNumber,
         __FILE__, __LINE__,
         s.str ());
@@ -4157,7 +4152,7 @@ void msr2LpsrTranslator::visitStart (S_msrChord& elt)
 
 void msr2LpsrTranslator::visitEnd (S_msrChord& elt)
 {
-  if (gMsrOptions->fTraceMsrVisitors) {
+  if (gMsrOptions ()->fTraceMsrVisitors) {
     fLogOutputStream <<
       "--> End visiting msrChord" <<
       ", line " << elt->getInputLineNumber () <<
@@ -4170,7 +4165,7 @@ void msr2LpsrTranslator::visitEnd (S_msrChord& elt)
 //________________________________________________________________________
 void msr2LpsrTranslator::visitStart (S_msrTuplet& elt)
 {
-  if (gMsrOptions->fTraceMsrVisitors) {
+  if (gMsrOptions ()->fTraceMsrVisitors) {
     fLogOutputStream <<
       "--> Start visiting msrTuplet" <<
       ", line " << elt->getInputLineNumber () <<
@@ -4184,7 +4179,7 @@ void msr2LpsrTranslator::visitStart (S_msrTuplet& elt)
 
   // register it in this visitor
 #ifdef TRACE_OPTIONS
-  if (gTraceOptions->fTraceTuplets) {
+  if (gTraceOptions ()->fTraceTuplets) {
     fLogOutputStream <<
       "++> pushing tuplet '" <<
       tupletClone->asString () <<
@@ -4197,6 +4192,7 @@ void msr2LpsrTranslator::visitStart (S_msrTuplet& elt)
 
   switch (elt->getTupletLineShapeKind ()) {
     case msrTuplet::kTupletLineShapeStraight:
+      break;
     case msrTuplet::kTupletLineShapeCurved:
       fLpsrScore->
         // this score needs the 'tuplets curved brackets' Scheme function
@@ -4207,7 +4203,7 @@ void msr2LpsrTranslator::visitStart (S_msrTuplet& elt)
 
 void msr2LpsrTranslator::visitEnd (S_msrTuplet& elt)
 {
-  if (gMsrOptions->fTraceMsrVisitors) {
+  if (gMsrOptions ()->fTraceMsrVisitors) {
     fLogOutputStream <<
       "--> End visiting msrTuplet" <<
       ", line " << elt->getInputLineNumber () <<
@@ -4215,7 +4211,7 @@ void msr2LpsrTranslator::visitEnd (S_msrTuplet& elt)
   }
 
 #ifdef TRACE_OPTIONS
-  if (gTraceOptions->fTraceTuplets) {
+  if (gTraceOptions ()->fTraceTuplets) {
     fLogOutputStream <<
       "Popping tuplet '" <<
       elt->asString () <<
@@ -4229,7 +4225,7 @@ void msr2LpsrTranslator::visitEnd (S_msrTuplet& elt)
   if (fTupletClonesStack.size ()) {
     // tuplet is a nested tuplet
 #ifdef TRACE_OPTIONS
-    if (gTraceOptions->fTraceTuplets) {
+    if (gTraceOptions ()->fTraceTuplets) {
       fLogOutputStream <<
         "Adding nested tuplet '" <<
       elt->asString () <<
@@ -4248,7 +4244,7 @@ void msr2LpsrTranslator::visitEnd (S_msrTuplet& elt)
     // tuplet is a top level tuplet
     
 #ifdef TRACE_OPTIONS
-    if (gTraceOptions->fTraceTuplets) {
+    if (gTraceOptions ()->fTraceTuplets) {
       fLogOutputStream <<
         "Adding top level tuplet '" <<
       elt->asString () <<
@@ -4266,7 +4262,7 @@ void msr2LpsrTranslator::visitEnd (S_msrTuplet& elt)
 //________________________________________________________________________
 void msr2LpsrTranslator::visitStart (S_msrTie& elt)
 {
-  if (gMsrOptions->fTraceMsrVisitors) {
+  if (gMsrOptions ()->fTraceMsrVisitors) {
     fLogOutputStream <<
       "--> Start visiting msrTie" <<
       ", line " << elt->getInputLineNumber () <<
@@ -4279,7 +4275,7 @@ void msr2LpsrTranslator::visitStart (S_msrTie& elt)
 
 void msr2LpsrTranslator::visitEnd (S_msrTie& elt)
 {
-  if (gMsrOptions->fTraceMsrVisitors) {
+  if (gMsrOptions ()->fTraceMsrVisitors) {
     fLogOutputStream <<
       "--> End visiting msrTie" <<
       ", line " << elt->getInputLineNumber () <<
@@ -4290,7 +4286,7 @@ void msr2LpsrTranslator::visitEnd (S_msrTie& elt)
 //________________________________________________________________________
 void msr2LpsrTranslator::visitStart (S_msrSegno& elt)
 {
-  if (gMsrOptions->fTraceMsrVisitors) {
+  if (gMsrOptions ()->fTraceMsrVisitors) {
     fLogOutputStream <<
       "--> Start visiting msrSegno" <<
       ", line " << elt->getInputLineNumber () <<
@@ -4303,7 +4299,7 @@ void msr2LpsrTranslator::visitStart (S_msrSegno& elt)
 
 void msr2LpsrTranslator::visitStart (S_msrCoda& elt)
 {
-  if (gMsrOptions->fTraceMsrVisitors) {
+  if (gMsrOptions ()->fTraceMsrVisitors) {
     fLogOutputStream <<
       "--> Start visiting msrCoda" <<
       ", line " << elt->getInputLineNumber () <<
@@ -4317,7 +4313,7 @@ void msr2LpsrTranslator::visitStart (S_msrCoda& elt)
 //________________________________________________________________________
 void msr2LpsrTranslator::visitStart (S_msrEyeGlasses& elt)
 {
-  if (gMsrOptions->fTraceMsrVisitors) {
+  if (gMsrOptions ()->fTraceMsrVisitors) {
     fLogOutputStream <<
       "--> Start visiting eyeGlasses" <<
       ", line " << elt->getInputLineNumber () <<
@@ -4330,7 +4326,7 @@ void msr2LpsrTranslator::visitStart (S_msrEyeGlasses& elt)
 
 void msr2LpsrTranslator::visitStart (S_msrScordatura& elt)
 {
-  if (gMsrOptions->fTraceMsrVisitors) {
+  if (gMsrOptions ()->fTraceMsrVisitors) {
     fLogOutputStream <<
       "--> Start visiting scordatura" <<
       ", line " << elt->getInputLineNumber () <<
@@ -4343,7 +4339,7 @@ void msr2LpsrTranslator::visitStart (S_msrScordatura& elt)
 
 void msr2LpsrTranslator::visitStart (S_msrPedal& elt)
 {
-  if (gMsrOptions->fTraceMsrVisitors) {
+  if (gMsrOptions ()->fTraceMsrVisitors) {
     fLogOutputStream <<
       "--> Start visiting pedal" <<
       ", line " << elt->getInputLineNumber () <<
@@ -4356,7 +4352,7 @@ void msr2LpsrTranslator::visitStart (S_msrPedal& elt)
 
 void msr2LpsrTranslator::visitStart (S_msrDamp& elt)
 {
-  if (gMsrOptions->fTraceMsrVisitors) {
+  if (gMsrOptions ()->fTraceMsrVisitors) {
     fLogOutputStream <<
       "--> Start visiting damp" <<
       ", line " << elt->getInputLineNumber () <<
@@ -4373,7 +4369,7 @@ void msr2LpsrTranslator::visitStart (S_msrDamp& elt)
 
 void msr2LpsrTranslator::visitStart (S_msrDampAll& elt)
 {
-  if (gMsrOptions->fTraceMsrVisitors) {
+  if (gMsrOptions ()->fTraceMsrVisitors) {
     fLogOutputStream <<
       "--> Start visiting dampAll" <<
       ", line " << elt->getInputLineNumber () <<
@@ -4391,7 +4387,7 @@ void msr2LpsrTranslator::visitStart (S_msrDampAll& elt)
 //________________________________________________________________________
 void msr2LpsrTranslator::visitStart (S_msrBarCheck& elt)
 {
-  if (gMsrOptions->fTraceMsrVisitors) {
+  if (gMsrOptions ()->fTraceMsrVisitors) {
     fLogOutputStream <<
       "--> Start visiting msrBarCheck" <<
       ", line " << elt->getInputLineNumber () <<
@@ -4404,7 +4400,7 @@ void msr2LpsrTranslator::visitStart (S_msrBarCheck& elt)
 
 void msr2LpsrTranslator::visitEnd (S_msrBarCheck& elt)
 {
-  if (gMsrOptions->fTraceMsrVisitors) {
+  if (gMsrOptions ()->fTraceMsrVisitors) {
     fLogOutputStream <<
       "--> End visiting msrBarCheck" <<
       ", line " << elt->getInputLineNumber () <<
@@ -4415,7 +4411,7 @@ void msr2LpsrTranslator::visitEnd (S_msrBarCheck& elt)
 //________________________________________________________________________
 void msr2LpsrTranslator::visitStart (S_msrBarNumberCheck& elt)
 {
-  if (gMsrOptions->fTraceMsrVisitors) {
+  if (gMsrOptions ()->fTraceMsrVisitors) {
     fLogOutputStream <<
       "--> Start visiting msrBarNumberCheck" <<
       ", line " << elt->getInputLineNumber () <<
@@ -4428,7 +4424,7 @@ void msr2LpsrTranslator::visitStart (S_msrBarNumberCheck& elt)
 
 void msr2LpsrTranslator::visitEnd (S_msrBarNumberCheck& elt)
 {
-  if (gMsrOptions->fTraceMsrVisitors) {
+  if (gMsrOptions ()->fTraceMsrVisitors) {
     fLogOutputStream <<
       "--> End visiting msrBarNumberCheck" <<
       ", line " << elt->getInputLineNumber () <<
@@ -4439,7 +4435,7 @@ void msr2LpsrTranslator::visitEnd (S_msrBarNumberCheck& elt)
 //________________________________________________________________________
 void msr2LpsrTranslator::visitStart (S_msrLineBreak& elt)
 {
-  if (gMsrOptions->fTraceMsrVisitors) {
+  if (gMsrOptions ()->fTraceMsrVisitors) {
     fLogOutputStream <<
       "--> Start visiting msrLineBreak" <<
       ", line " << elt->getInputLineNumber () <<
@@ -4452,7 +4448,7 @@ void msr2LpsrTranslator::visitStart (S_msrLineBreak& elt)
 
 void msr2LpsrTranslator::visitEnd (S_msrLineBreak& elt)
 {
-  if (gMsrOptions->fTraceMsrVisitors) {
+  if (gMsrOptions ()->fTraceMsrVisitors) {
     fLogOutputStream <<
       "--> End visiting msrLineBreak" <<
       ", line " << elt->getInputLineNumber () <<
@@ -4463,7 +4459,7 @@ void msr2LpsrTranslator::visitEnd (S_msrLineBreak& elt)
 //________________________________________________________________________
 void msr2LpsrTranslator::visitStart (S_msrPageBreak& elt)
 {
-  if (gMsrOptions->fTraceMsrVisitors) {
+  if (gMsrOptions ()->fTraceMsrVisitors) {
     fLogOutputStream <<
       "--> Start visiting msrPageBreak" <<
       ", line " << elt->getInputLineNumber () <<
@@ -4476,7 +4472,7 @@ void msr2LpsrTranslator::visitStart (S_msrPageBreak& elt)
 
 void msr2LpsrTranslator::visitEnd (S_msrPageBreak& elt)
 {
-  if (gMsrOptions->fTraceMsrVisitors) {
+  if (gMsrOptions ()->fTraceMsrVisitors) {
     fLogOutputStream <<
       "--> End visiting msrPageBreak" <<
       ", line " << elt->getInputLineNumber () <<
@@ -4490,7 +4486,7 @@ void msr2LpsrTranslator::visitStart (S_msrRepeat& elt)
   int inputLineNumber =
     elt->getInputLineNumber ();
     
-  if (gMsrOptions->fTraceMsrVisitors) {
+  if (gMsrOptions ()->fTraceMsrVisitors) {
     fLogOutputStream <<
       "--> Start visiting msrRepeat" <<
       ", line " << inputLineNumber <<
@@ -4511,7 +4507,7 @@ void msr2LpsrTranslator::visitStart (S_msrRepeat& elt)
     */
 
 #ifdef TRACE_OPTIONS
-  if (gTraceOptions->fTraceRepeats) {
+  if (gTraceOptions ()->fTraceRepeats) {
     fLogOutputStream <<
       "Preparing for repeat in part clone" <<
       fCurrentPartClone->getPartCombinedName () <<
@@ -4532,7 +4528,7 @@ void msr2LpsrTranslator::visitStart (S_msrRepeat& elt)
 /* JMI
   // create a repeat clone
 #ifdef TRACE_OPTIONS
-  if (gTraceOptions->fTraceRepeats) {
+  if (gTraceOptions ()->fTraceRepeats) {
     fLogOutputStream <<
       "Creating a repeat newborn clone" <<
       ", line " << inputLineNumber <<
@@ -4559,7 +4555,7 @@ void msr2LpsrTranslator::visitEnd (S_msrRepeat& elt)
   int inputLineNumber =
     elt->getInputLineNumber ();
     
-  if (gMsrOptions->fTraceMsrVisitors) {
+  if (gMsrOptions ()->fTraceMsrVisitors) {
     fLogOutputStream <<
       "--> End visiting msrRepeat" <<
       ", line " << inputLineNumber <<
@@ -4569,7 +4565,7 @@ void msr2LpsrTranslator::visitEnd (S_msrRepeat& elt)
 /* JMI
   // append the repeat clone to the current part clone
 #ifdef TRACE_OPTIONS
-  if (gTraceOptions->fTraceRepeats) {
+  if (gTraceOptions ()->fTraceRepeats) {
     fLogOutputStream <<
       "Appending a repeat to part clone " <<
       fCurrentPartClone->getPartCombinedName () << "\"" <<
@@ -4592,7 +4588,7 @@ void msr2LpsrTranslator::visitEnd (S_msrRepeat& elt)
 //________________________________________________________________________
 void msr2LpsrTranslator::visitStart (S_msrRepeatCommonPart& elt)
 {
-  if (gMsrOptions->fTraceMsrVisitors) {
+  if (gMsrOptions ()->fTraceMsrVisitors) {
     fLogOutputStream <<
       "--> Start visiting msrRepeatCommonPart" <<
       ", line " << elt->getInputLineNumber () <<
@@ -4605,7 +4601,7 @@ void msr2LpsrTranslator::visitEnd (S_msrRepeatCommonPart& elt)
   int inputLineNumber =
     elt->getInputLineNumber ();
     
-  if (gMsrOptions->fTraceMsrVisitors) {
+  if (gMsrOptions ()->fTraceMsrVisitors) {
     fLogOutputStream <<
       "--> End visiting msrRepeatCommonPart" <<
       ", line " << inputLineNumber <<
@@ -4614,7 +4610,7 @@ void msr2LpsrTranslator::visitEnd (S_msrRepeatCommonPart& elt)
 
   // create a repeat and append it to voice clone
 #ifdef TRACE_OPTIONS
-  if (gTraceOptions->fTraceRepeats) {
+  if (gTraceOptions ()->fTraceRepeats) {
     fLogOutputStream <<
       "Appending a repeat to voice clone \"" <<
       fCurrentVoiceClone->getVoiceName () <<
@@ -4622,8 +4618,8 @@ void msr2LpsrTranslator::visitEnd (S_msrRepeatCommonPart& elt)
       endl;
   }
 
-  if (gTraceOptions->fTraceRepeats || gTraceOptions->fTraceVoices) {
-    gLogIOstream <<
+  if (gTraceOptions ()->fTraceRepeats || gTraceOptions ()->fTraceVoices) {
+    gLogIOstream () <<
       endl <<
       "*********>> msrRepeatCommonPart GGG " <<
       ", line " << inputLineNumber <<
@@ -4649,7 +4645,7 @@ void msr2LpsrTranslator::visitEnd (S_msrRepeatCommonPart& elt)
 //________________________________________________________________________
 void msr2LpsrTranslator::visitStart (S_msrRepeatEnding& elt)
 {
-  if (gMsrOptions->fTraceMsrVisitors) {
+  if (gMsrOptions ()->fTraceMsrVisitors) {
     fLogOutputStream <<
       "--> Start visiting msrRepeatEnding" <<
       ", line " << elt->getInputLineNumber () <<
@@ -4662,7 +4658,7 @@ void msr2LpsrTranslator::visitEnd (S_msrRepeatEnding& elt)
   int inputLineNumber =
     elt->getInputLineNumber ();
     
-  if (gMsrOptions->fTraceMsrVisitors) {
+  if (gMsrOptions ()->fTraceMsrVisitors) {
     fLogOutputStream <<
       "--> End visiting msrRepeatEnding" <<
       ", line " << inputLineNumber <<
@@ -4671,7 +4667,7 @@ void msr2LpsrTranslator::visitEnd (S_msrRepeatEnding& elt)
 
   // create a repeat ending clone and append it to voice clone
 #ifdef TRACE_OPTIONS
-  if (gTraceOptions->fTraceRepeats) {
+  if (gTraceOptions ()->fTraceRepeats) {
     fLogOutputStream <<
       "Appending a repeat ending clone to voice clone \"" <<
       fCurrentVoiceClone->getVoiceName () <<
@@ -4679,8 +4675,8 @@ void msr2LpsrTranslator::visitEnd (S_msrRepeatEnding& elt)
       endl;
   }
 
-  if (gTraceOptions->fTraceRepeats || gTraceOptions->fTraceVoices) {
-    gLogIOstream <<
+  if (gTraceOptions ()->fTraceRepeats || gTraceOptions ()->fTraceVoices) {
+    gLogIOstream () <<
       endl <<
       "*********>> msrRepeatEnding HHH " <<
       ", line " << inputLineNumber <<
@@ -4704,30 +4700,30 @@ void msr2LpsrTranslator::visitEnd (S_msrRepeatEnding& elt)
 //________________________________________________________________________
 void msr2LpsrTranslator::visitStart (S_msrMeasuresRepeat& elt)
 {
-  if (gMsrOptions->fTraceMsrVisitors) {
+  if (gMsrOptions ()->fTraceMsrVisitors) {
     fLogOutputStream <<
       "--> Start visiting msrMeasuresRepeat" <<
       ", line " << elt->getInputLineNumber () <<
       endl;
   }
 
-  gIndenter++;
+  gIndenter ()++;
 }
 
 void msr2LpsrTranslator::visitEnd (S_msrMeasuresRepeat& elt)
 {
-  if (gMsrOptions->fTraceMsrVisitors) {
+  if (gMsrOptions ()->fTraceMsrVisitors) {
     fLogOutputStream <<
       "--> End visiting msrMeasuresRepeat" <<
       ", line " << elt->getInputLineNumber () <<
       endl;
   }
 
-  gIndenter--;
+  gIndenter ()--;
 
   // set last segment as the measure repeat pattern segment
 #ifdef TRACE_OPTIONS
-  if (gTraceOptions->fTraceMultipleRests) {
+  if (gTraceOptions ()->fTraceMultipleRests) {
     fLogOutputStream <<
       "Setting current last segment as measure repeat pattern segment in voice \"" <<
       fCurrentVoiceClone->getVoiceName () <<
@@ -4740,14 +4736,14 @@ void msr2LpsrTranslator::visitEnd (S_msrMeasuresRepeat& elt)
 //________________________________________________________________________
 void msr2LpsrTranslator::visitStart (S_msrMeasuresRepeatPattern& elt)
 {
-  if (gMsrOptions->fTraceMsrVisitors) {
+  if (gMsrOptions ()->fTraceMsrVisitors) {
     fLogOutputStream <<
       "--> Start visiting msrMeasuresRepeatPattern" <<
       ", line " << elt->getInputLineNumber () <<
       endl;
   }
 
-  gIndenter++;
+  gIndenter ()++;
 }
 
 void msr2LpsrTranslator::visitEnd (S_msrMeasuresRepeatPattern& elt)
@@ -4755,14 +4751,14 @@ void msr2LpsrTranslator::visitEnd (S_msrMeasuresRepeatPattern& elt)
   int inputLineNumber =
     elt->getInputLineNumber ();
     
-  if (gMsrOptions->fTraceMsrVisitors) {
+  if (gMsrOptions ()->fTraceMsrVisitors) {
     fLogOutputStream <<
       "--> End visiting msrMeasuresRepeatPattern" <<
       ", line " << elt->getInputLineNumber () <<
       endl;
   }
 
-  gIndenter--;
+  gIndenter ()--;
 
   // get the measures repeat uplink
   S_msrMeasuresRepeat
@@ -4771,7 +4767,7 @@ void msr2LpsrTranslator::visitEnd (S_msrMeasuresRepeatPattern& elt)
 
   // create a measures repeat and append it to voice clone
 #ifdef TRACE_OPTIONS
-  if (gTraceOptions->fTraceMeasureRepeats) {
+  if (gTraceOptions ()->fTraceMeasureRepeats) {
     fLogOutputStream <<
       "Appending a measures repeat to voice clone \"" <<
       fCurrentVoiceClone->getVoiceName () <<
@@ -4795,14 +4791,14 @@ void msr2LpsrTranslator::visitEnd (S_msrMeasuresRepeatPattern& elt)
 //________________________________________________________________________
 void msr2LpsrTranslator::visitStart (S_msrMeasuresRepeatReplicas& elt)
 {
-  if (gMsrOptions->fTraceMsrVisitors) {
+  if (gMsrOptions ()->fTraceMsrVisitors) {
     fLogOutputStream <<
       "--> Start visiting msrMeasuresRepeatReplicas" <<
       ", line " << elt->getInputLineNumber () <<
       endl;
   }
 
-  gIndenter++;
+  gIndenter ()++;
 }
 
 void msr2LpsrTranslator::visitEnd (S_msrMeasuresRepeatReplicas& elt)
@@ -4810,18 +4806,18 @@ void msr2LpsrTranslator::visitEnd (S_msrMeasuresRepeatReplicas& elt)
   int inputLineNumber =
     elt->getInputLineNumber ();
     
-  if (gMsrOptions->fTraceMsrVisitors) {
+  if (gMsrOptions ()->fTraceMsrVisitors) {
     fLogOutputStream <<
       "--> End visiting msrMeasuresRepeatReplicas" <<
       ", line " << inputLineNumber <<
       endl;
   }
 
-  gIndenter--;
+  gIndenter ()--;
 
   // create a measures repeat replica clone and append it to voice clone
 #ifdef TRACE_OPTIONS
-  if (gTraceOptions->fTraceRepeats) {
+  if (gTraceOptions ()->fTraceRepeats) {
     fLogOutputStream <<
       "Appending a repeat replica clone to voice clone \"" <<
       fCurrentVoiceClone->getVoiceName () <<
@@ -4844,7 +4840,7 @@ void msr2LpsrTranslator::visitStart (S_msrMultipleRest& elt)
   int inputLineNumber =
     elt->getInputLineNumber ();
     
-  if (gMsrOptions->fTraceMsrVisitors) {
+  if (gMsrOptions ()->fTraceMsrVisitors) {
     fLogOutputStream <<
       "--> Start visiting msrMultipleRest" <<
       ", line " << inputLineNumber <<
@@ -4852,7 +4848,7 @@ void msr2LpsrTranslator::visitStart (S_msrMultipleRest& elt)
   }
 
 #ifdef TRACE_OPTIONS
-  if (gTraceOptions->fTraceMultipleRests) {
+  if (gTraceOptions ()->fTraceMultipleRests) {
     fLogOutputStream <<
       "Preparing for multiple rest in voice clone \"" <<
       fCurrentVoiceClone->getVoiceName () <<
@@ -4871,7 +4867,7 @@ void msr2LpsrTranslator::visitEnd (S_msrMultipleRest& elt)
   int inputLineNumber =
     elt->getInputLineNumber ();
     
-  if (gMsrOptions->fTraceMsrVisitors) {
+  if (gMsrOptions ()->fTraceMsrVisitors) {
     fLogOutputStream <<
       "--> End visiting msrMultipleRest" <<
       ", line " << inputLineNumber <<
@@ -4893,11 +4889,11 @@ void msr2LpsrTranslator::visitEnd (S_msrMultipleRest& elt)
   // containing the next, yet incomplete, measure
 #ifdef TRACE_OPTIONS
   if (
-    gTraceOptions->fTraceMultipleRests
+    gTraceOptions ()->fTraceMultipleRests
       ||
-    gTraceOptions->fTraceSegments
+    gTraceOptions ()->fTraceSegments
       ||
-    gTraceOptions->fTraceVoices) {
+    gTraceOptions ()->fTraceVoices) {
     fLogOutputStream <<
       "Creating a new last segment for the remainder of voice \"" <<
       fCurrentVoiceClone->getVoiceName () << "\"" <<
@@ -4929,18 +4925,18 @@ void msr2LpsrTranslator::visitEnd (S_msrMultipleRest& elt)
 //________________________________________________________________________
 void msr2LpsrTranslator::visitStart (S_msrMultipleRestContents& elt)
 {
-  if (gMsrOptions->fTraceMsrVisitors) {
+  if (gMsrOptions ()->fTraceMsrVisitors) {
     fLogOutputStream <<
       "--> Start visiting msrMultipleRestContents" <<
       ", line " << elt->getInputLineNumber () <<
       endl;
   }
 
-  gIndenter++;
+  gIndenter ()++;
 
 /* JMI
 #ifdef TRACE_OPTIONS
-  if (gTraceOptions->fTraceMultipleRests) {
+  if (gTraceOptions ()->fTraceMultipleRests) {
     fLogOutputStream <<
       "Preparing for multiple rest in voice clone \"" <<
       fCurrentVoiceClone->getVoiceName () <<
@@ -4957,7 +4953,7 @@ void msr2LpsrTranslator::visitStart (S_msrMultipleRestContents& elt)
       /* JMI
   // create a new last segment to collect the multiple rest contents
 #ifdef TRACE_OPTIONS
-  if (fTraceMultipleRests || gTraceOptions->fTraceSegments || gTraceOptions->fTraceVoices) {
+  if (fTraceMultipleRests || gTraceOptions ()->fTraceSegments || gTraceOptions ()->fTraceVoices) {
     fLogOutputStream <<
       "Creating a new last segment for a multiple rest contents for voice \"" <<
       fCurrentVoiceClone->getVoiceName () << "\"" <<
@@ -4973,14 +4969,14 @@ void msr2LpsrTranslator::visitStart (S_msrMultipleRestContents& elt)
 
 void msr2LpsrTranslator::visitEnd (S_msrMultipleRestContents& elt)
 {
-  if (gMsrOptions->fTraceMsrVisitors) {
+  if (gMsrOptions ()->fTraceMsrVisitors) {
     fLogOutputStream <<
       "--> End visiting msrMultipleRestContents" <<
       ", line " << elt->getInputLineNumber () <<
       endl;
   }
 
-  gIndenter--;
+  gIndenter ()--;
 
   // create a multiple rest contents clone
   fCurrentMultipleRestContentsClone =
@@ -4989,7 +4985,7 @@ void msr2LpsrTranslator::visitEnd (S_msrMultipleRestContents& elt)
 
   // set last segment as the multiple rest contents segment
 #ifdef TRACE_OPTIONS
-  if (gTraceOptions->fTraceMultipleRests) {
+  if (gTraceOptions ()->fTraceMultipleRests) {
     fLogOutputStream <<
       "Setting current last segment as multiple rest contents segment in voice \"" <<
       fCurrentVoiceClone->getVoiceName () <<
@@ -5010,7 +5006,7 @@ void msr2LpsrTranslator::visitStart (S_msrBarline& elt)
   int inputLineNumber =
     elt->getInputLineNumber ();
     
-  if (gMsrOptions->fTraceMsrVisitors) {
+  if (gMsrOptions ()->fTraceMsrVisitors) {
     fLogOutputStream <<
       "--> Start visiting msrBarline" <<
       ", line " << inputLineNumber <<
@@ -5018,7 +5014,7 @@ void msr2LpsrTranslator::visitStart (S_msrBarline& elt)
   }
 
 #ifdef TRACE_OPTIONS
-  if (gTraceOptions->fTraceBarlines) {
+  if (gTraceOptions ()->fTraceBarlines) {
     fLogOutputStream <<
       "Handling '" <<
       msrBarline::barlineCategoryKindAsString (
@@ -5068,7 +5064,7 @@ void msr2LpsrTranslator::visitStart (S_msrBarline& elt)
 
 void msr2LpsrTranslator::visitEnd (S_msrBarline& elt)
 {
-  if (gMsrOptions->fTraceMsrVisitors) {
+  if (gMsrOptions ()->fTraceMsrVisitors) {
     fLogOutputStream <<
       "--> End visiting msrBarline" <<
       ", line " << elt->getInputLineNumber () <<
@@ -5082,7 +5078,7 @@ void msr2LpsrTranslator::visitStart (S_msrVarValAssoc& elt)
   int inputLineNumber =
     elt->getInputLineNumber ();
     
-  if (gMsrOptions->fTraceMsrVisitors) {
+  if (gMsrOptions ()->fTraceMsrVisitors) {
     fLogOutputStream <<
       "--> Start visiting msrVarValAssoc" <<
       ", line " << inputLineNumber <<
@@ -5191,7 +5187,7 @@ void msr2LpsrTranslator::visitStart (S_msrVarValAssoc& elt)
         "' is not handled";
     
       msrMusicXMLWarning (
-        gXml2lyOptions->fInputSourceName,
+        gXml2lyOptions ()->fInputSourceName,
         inputLineNumber,
         s.str ());
       }
@@ -5200,7 +5196,7 @@ void msr2LpsrTranslator::visitStart (S_msrVarValAssoc& elt)
 
 void msr2LpsrTranslator::visitEnd (S_msrVarValAssoc& elt)
 {
-  if (gMsrOptions->fTraceMsrVisitors) {
+  if (gMsrOptions ()->fTraceMsrVisitors) {
     fLogOutputStream <<
       "--> End visiting msrVarValAssoc" <<
       ", line " << elt->getInputLineNumber () <<
@@ -5214,7 +5210,7 @@ void msr2LpsrTranslator::visitStart (S_msrVarValsListAssoc& elt)
   int inputLineNumber =
     elt->getInputLineNumber ();
     
-  if (gMsrOptions->fTraceMsrVisitors) {
+  if (gMsrOptions ()->fTraceMsrVisitors) {
     fLogOutputStream <<
       "--> Start visiting msrVarValsListAssoc" <<
       ", line " << inputLineNumber <<
@@ -5311,7 +5307,7 @@ void msr2LpsrTranslator::visitStart (S_msrVarValsListAssoc& elt)
         "' is not handled";
    
       msrMusicXMLWarning (
-        gXml2lyOptions->fInputSourceName,
+        gXml2lyOptions ()->fInputSourceName,
         inputLineNumber,
         s.str ());
       }
@@ -5321,7 +5317,7 @@ void msr2LpsrTranslator::visitStart (S_msrVarValsListAssoc& elt)
 
 void msr2LpsrTranslator::visitEnd (S_msrVarValsListAssoc& elt)
 {
-  if (gMsrOptions->fTraceMsrVisitors) {
+  if (gMsrOptions ()->fTraceMsrVisitors) {
     fLogOutputStream <<
       "--> End visiting msrVarValsListAssoc" <<
       ", line " << elt->getInputLineNumber () <<
@@ -5332,21 +5328,21 @@ void msr2LpsrTranslator::visitEnd (S_msrVarValsListAssoc& elt)
 //________________________________________________________________________
 void msr2LpsrTranslator::visitStart (S_msrLayout& elt)
 {
-  if (gMsrOptions->fTraceMsrVisitors) {
+  if (gMsrOptions ()->fTraceMsrVisitors) {
     fLogOutputStream <<
       "--> Start visiting msrLayout" <<
       ", line " << elt->getInputLineNumber () <<
       endl;
   }
 
-  gIndenter++;
+  gIndenter ()++;
 }
 
 void msr2LpsrTranslator::visitEnd (S_msrLayout& elt)
 {
-  gIndenter--;
+  gIndenter ()--;
 
-  if (gMsrOptions->fTraceMsrVisitors) {
+  if (gMsrOptions ()->fTraceMsrVisitors) {
     fLogOutputStream <<
       "--> End visiting msrLayout" <<
       ", line " << elt->getInputLineNumber () <<
@@ -5357,7 +5353,7 @@ void msr2LpsrTranslator::visitEnd (S_msrLayout& elt)
 //________________________________________________________________________
 void msr2LpsrTranslator::visitStart (S_msrMidi& elt)
 {
-  if (gMsrOptions->fTraceMsrVisitors) {
+  if (gMsrOptions ()->fTraceMsrVisitors) {
     fLogOutputStream <<
       "--> Start visiting msrMidi" <<
       ", line " << elt->getInputLineNumber () <<
@@ -5367,7 +5363,7 @@ void msr2LpsrTranslator::visitStart (S_msrMidi& elt)
 
 void msr2LpsrTranslator::visitEnd (S_msrMidi& elt)
 {
-  if (gMsrOptions->fTraceMsrVisitors) {
+  if (gMsrOptions ()->fTraceMsrVisitors) {
     fLogOutputStream <<
       "--> End visiting msrMidi" <<
       ", line " << elt->getInputLineNumber () <<
@@ -555,7 +555,6 @@ class msr2LpsrTranslator :
     // ------------------------------------------------------    
     S_msrVoice                fCurrentVoiceClone;
     S_msrVoice                fCurrentVoiceOriginal;
-    map<S_msrNote, S_msrNote> fVoiceNotesMap;
 
 
     // harmonies
@@ -700,7 +699,6 @@ class msr2LpsrTranslator :
 
     // syllables
     // ------------------------------------------------------
-    S_msrSyllable             fCurrentSyllableClone;
     bool                      fOnGoingSyllableExtend;
 
 
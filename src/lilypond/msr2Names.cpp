@@ -67,7 +67,7 @@ void msr2NamesVisitor::printNamesFromMsrScore (
 //________________________________________________________________________
 void msr2NamesVisitor::visitStart (S_msrScore& elt)
 {
-  if (gMsrOptions->fTraceMsrVisitors) {
+  if (gMsrOptions ()->fTraceMsrVisitors) {
     fMsrNamesOutputStream <<
       "--> Start visiting msrScore" <<
       endl;
@@ -85,14 +85,14 @@ void msr2NamesVisitor::visitStart (S_msrScore& elt)
     endl <<
     endl;
 
-  gIndenter++;
+  gIndenter ()++;
 }
 
 void msr2NamesVisitor::visitEnd (S_msrScore& elt)
 {
-  gIndenter--;
+  gIndenter ()--;
 
-  if (gMsrOptions->fTraceMsrVisitors) {
+  if (gMsrOptions ()->fTraceMsrVisitors) {
     fMsrNamesOutputStream <<
       "--> End visiting msrScore" <<
       endl;
@@ -102,7 +102,7 @@ void msr2NamesVisitor::visitEnd (S_msrScore& elt)
     "The score contains:" <<
     endl;
 
-  gIndenter++;
+  gIndenter ()++;
   
   const int fieldWidth = 3;
 
@@ -135,13 +135,13 @@ void msr2NamesVisitor::visitEnd (S_msrScore& elt)
       "voices") <<
     endl;
 
-  gIndenter--;
+  gIndenter ()--;
 }
 
 //________________________________________________________________________
 void msr2NamesVisitor::visitStart (S_msrPartGroup& elt)
 {
-  if (gMsrOptions->fTraceMsrVisitors) {
+  if (gMsrOptions ()->fTraceMsrVisitors) {
     fMsrNamesOutputStream <<
       "--> Start visiting msrPartGroup" <<
       endl;
@@ -160,7 +160,7 @@ void msr2NamesVisitor::visitStart (S_msrPartGroup& elt)
       " parts or sub part groups") <<
     endl;
 
-  gIndenter++;
+  gIndenter ()++;
 
   const int fieldWidth = 25;
   
@@ -189,9 +189,9 @@ void msr2NamesVisitor::visitStart (S_msrPartGroup& elt)
 
 void msr2NamesVisitor::visitEnd (S_msrPartGroup& elt)
 {
-  gIndenter--;
+  gIndenter ()--;
 
-  if (gMsrOptions->fTraceMsrVisitors) {
+  if (gMsrOptions ()->fTraceMsrVisitors) {
     fMsrNamesOutputStream <<
       "--> End visiting msrPartGroup" <<
       endl;
@@ -201,7 +201,7 @@ void msr2NamesVisitor::visitEnd (S_msrPartGroup& elt)
 //________________________________________________________________________
 void msr2NamesVisitor::visitStart (S_msrPart& elt)
 {
-  if (gMsrOptions->fTraceMsrVisitors) {
+  if (gMsrOptions ()->fTraceMsrVisitors) {
     fMsrNamesOutputStream <<
       "--> Start visiting msrPart" <<
       endl;
@@ -219,7 +219,7 @@ void msr2NamesVisitor::visitStart (S_msrPart& elt)
       "staff", "staves") <<
     endl;
     
-  gIndenter++;
+  gIndenter ()++;
   
   const int fieldWidth = 27;
   
@@ -255,9 +255,9 @@ void msr2NamesVisitor::visitStart (S_msrPart& elt)
 
 void msr2NamesVisitor::visitEnd (S_msrPart& elt)
 {
-  gIndenter--;
+  gIndenter ()--;
 
-  if (gMsrOptions->fTraceMsrVisitors) {
+  if (gMsrOptions ()->fTraceMsrVisitors) {
     fMsrNamesOutputStream <<
       "--> End visiting msrPart" <<
       endl;
@@ -267,7 +267,7 @@ void msr2NamesVisitor::visitEnd (S_msrPart& elt)
 //________________________________________________________________________
 void msr2NamesVisitor::visitStart (S_msrStaff& elt)
 {
-  if (gMsrOptions->fTraceMsrVisitors) {
+  if (gMsrOptions ()->fTraceMsrVisitors) {
     fMsrNamesOutputStream <<
       "--> Start visiting msrStaff" <<
       endl;
@@ -285,7 +285,7 @@ void msr2NamesVisitor::visitStart (S_msrStaff& elt)
       "voice", "voices") <<
     endl;
 
-  gIndenter++;
+  gIndenter ()++;
 
   
   const int fieldWidth = 28;
@@ -314,9 +314,9 @@ void msr2NamesVisitor::visitStart (S_msrStaff& elt)
 
 void msr2NamesVisitor::visitEnd (S_msrStaff& elt)
 {
-  gIndenter--;
+  gIndenter ()--;
 
-  if (gMsrOptions->fTraceMsrVisitors) {
+  if (gMsrOptions ()->fTraceMsrVisitors) {
     fMsrNamesOutputStream <<
       "--> End visiting msrStaff" <<
       endl;
@@ -328,7 +328,7 @@ void msr2NamesVisitor::visitEnd (S_msrStaff& elt)
 //________________________________________________________________________
 void msr2NamesVisitor::visitStart (S_msrVoice& elt)
 {
-  if (gMsrOptions->fTraceMsrVisitors) {
+  if (gMsrOptions ()->fTraceMsrVisitors) {
     fMsrNamesOutputStream <<
       "--> Start visiting msrVoice" <<
       endl;
@@ -346,7 +346,7 @@ void msr2NamesVisitor::visitStart (S_msrVoice& elt)
       "stanza", "stanzas") <<
     endl;
 
-  gIndenter++;
+  gIndenter ()++;
 
   const int fieldWidth = 28;
   
@@ -367,9 +367,9 @@ void msr2NamesVisitor::visitStart (S_msrVoice& elt)
 
 void msr2NamesVisitor::visitEnd (S_msrVoice& elt)
 {
-  gIndenter--;
+  gIndenter ()--;
 
-  if (gMsrOptions->fTraceMsrVisitors) {
+  if (gMsrOptions ()->fTraceMsrVisitors) {
     fMsrNamesOutputStream <<
       "--> End visiting msrVoice" <<
       endl;
@@ -379,7 +379,7 @@ void msr2NamesVisitor::visitEnd (S_msrVoice& elt)
 //________________________________________________________________________
 void msr2NamesVisitor::visitStart (S_msrVarValAssoc& elt)
 {
-  if (gMsrOptions->fTraceMsrVisitors) {
+  if (gMsrOptions ()->fTraceMsrVisitors) {
     fMsrNamesOutputStream <<
       "--> Start visiting msrVarValAssoc" <<
       endl;
@@ -389,7 +389,7 @@ void msr2NamesVisitor::visitStart (S_msrVarValAssoc& elt)
     "VarValAssoc" <<
     endl;
   
-  gIndenter++;
+  gIndenter ()++;
   
   const int fieldWidth = 16;
   
@@ -407,12 +407,12 @@ void msr2NamesVisitor::visitStart (S_msrVarValAssoc& elt)
     endl <<
     endl;
   
-  gIndenter--;
+  gIndenter ()--;
 }
 
 void msr2NamesVisitor::visitEnd (S_msrVarValAssoc& elt)
 {
-  if (gMsrOptions->fTraceMsrVisitors) {
+  if (gMsrOptions ()->fTraceMsrVisitors) {
     fMsrNamesOutputStream <<
       "--> End visiting msrVarValAssoc" <<
       endl;
@@ -422,7 +422,7 @@ void msr2NamesVisitor::visitEnd (S_msrVarValAssoc& elt)
 //________________________________________________________________________
 void msr2NamesVisitor::visitStart (S_msrVarValsListAssoc& elt)
 {
-  if (gMsrOptions->fTraceMsrVisitors) {
+  if (gMsrOptions ()->fTraceMsrVisitors) {
     fMsrNamesOutputStream <<
       "--> Start visiting msrVarValsListAssoc" <<
       endl;
@@ -432,7 +432,7 @@ void msr2NamesVisitor::visitStart (S_msrVarValsListAssoc& elt)
     "VarValsListAssoc" <<
     endl;
   
-  gIndenter++;
+  gIndenter ()++;
 
   const int fieldWidth = 23;
   
@@ -450,12 +450,12 @@ void msr2NamesVisitor::visitStart (S_msrVarValsListAssoc& elt)
     endl <<
     endl;
   
-  gIndenter--;
+  gIndenter ()--;
 }
 
 void msr2NamesVisitor::visitEnd (S_msrVarValsListAssoc& elt)
 {
-  if (gMsrOptions->fTraceMsrVisitors) {
+  if (gMsrOptions ()->fTraceMsrVisitors) {
     fMsrNamesOutputStream <<
       "--> End visiting msrVarValsListAssoc" <<
       endl;
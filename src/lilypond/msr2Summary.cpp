@@ -86,7 +86,7 @@ void msr2SummaryVisitor::printSummaryFromMsrScore (
 //________________________________________________________________________
 void msr2SummaryVisitor::visitStart (S_msrScore& elt)
 {
-  if (gMsrOptions->fTraceMsrVisitors) {
+  if (gMsrOptions ()->fTraceMsrVisitors) {
     fMsrSummaryOutputStream <<
       "--> Start visiting msrScore" <<
       endl;
@@ -104,14 +104,14 @@ void msr2SummaryVisitor::visitStart (S_msrScore& elt)
     endl <<
     endl;
 
-  gIndenter++;
+  gIndenter ()++;
 }
 
 void msr2SummaryVisitor::visitEnd (S_msrScore& elt)
 {
-  gIndenter--;
+  gIndenter ()--;
 
-  if (gMsrOptions->fTraceMsrVisitors) {
+  if (gMsrOptions ()->fTraceMsrVisitors) {
     fMsrSummaryOutputStream <<
       "--> End visiting msrScore" <<
       endl;
@@ -121,7 +121,7 @@ void msr2SummaryVisitor::visitEnd (S_msrScore& elt)
     "The score contains:" <<
     endl;
 
-  gIndenter++;
+  gIndenter ()++;
   
   const int fieldWidth = 3;
 
@@ -247,13 +247,13 @@ void msr2SummaryVisitor::visitEnd (S_msrScore& elt)
     endl <<
     endl;
 
-  gIndenter--;
+  gIndenter ()--;
 }
 
 //________________________________________________________________________
 void msr2SummaryVisitor::visitStart (S_msrPartGroup& elt)
 {
-  if (gMsrOptions->fTraceMsrVisitors) {
+  if (gMsrOptions ()->fTraceMsrVisitors) {
     fMsrSummaryOutputStream <<
       "--> Start visiting msrPartGroup" <<
       endl;
@@ -272,7 +272,7 @@ void msr2SummaryVisitor::visitStart (S_msrPartGroup& elt)
       " parts or sub part groups") <<
     endl;
 
-  gIndenter++;
+  gIndenter ()++;
 
   const int fieldWidth = 24;
   
@@ -329,9 +329,9 @@ void msr2SummaryVisitor::visitStart (S_msrPartGroup& elt)
 
 void msr2SummaryVisitor::visitEnd (S_msrPartGroup& elt)
 {
-  gIndenter--;
+  gIndenter ()--;
 
-  if (gMsrOptions->fTraceMsrVisitors) {
+  if (gMsrOptions ()->fTraceMsrVisitors) {
     fMsrSummaryOutputStream <<
       "--> End visiting msrPartGroup" <<
       endl;
@@ -341,7 +341,7 @@ void msr2SummaryVisitor::visitEnd (S_msrPartGroup& elt)
 //________________________________________________________________________
 void msr2SummaryVisitor::visitStart (S_msrPart& elt)
 {
-  if (gMsrOptions->fTraceMsrVisitors) {
+  if (gMsrOptions ()->fTraceMsrVisitors) {
     fMsrSummaryOutputStream <<
       "--> Start visiting msrPart" <<
       endl;
@@ -359,7 +359,7 @@ void msr2SummaryVisitor::visitStart (S_msrPart& elt)
       "staff", "staves") <<
     endl;
     
-  gIndenter++;
+  gIndenter ()++;
   
   const int fieldWidth = 28;
   
@@ -403,9 +403,9 @@ void msr2SummaryVisitor::visitStart (S_msrPart& elt)
 
 void msr2SummaryVisitor::visitEnd (S_msrPart& elt)
 {
-  gIndenter--;
+  gIndenter ()--;
 
-  if (gMsrOptions->fTraceMsrVisitors) {
+  if (gMsrOptions ()->fTraceMsrVisitors) {
     fMsrSummaryOutputStream <<
       "--> End visiting msrPart" <<
       endl;
@@ -415,7 +415,7 @@ void msr2SummaryVisitor::visitEnd (S_msrPart& elt)
 //________________________________________________________________________
 void msr2SummaryVisitor::visitStart (S_msrStaff& elt)
 {
-  if (gMsrOptions->fTraceMsrVisitors) {
+  if (gMsrOptions ()->fTraceMsrVisitors) {
     fMsrSummaryOutputStream <<
       "--> Start visiting msrStaff" <<
       endl;
@@ -433,7 +433,7 @@ void msr2SummaryVisitor::visitStart (S_msrStaff& elt)
       "voice", "voices") <<
     endl;
 
-  gIndenter++;
+  gIndenter ()++;
 
   
   const int fieldWidth = 27;
@@ -463,9 +463,9 @@ void msr2SummaryVisitor::visitStart (S_msrStaff& elt)
 
 void msr2SummaryVisitor::visitEnd (S_msrStaff& elt)
 {
-  gIndenter--;
+  gIndenter ()--;
 
-  if (gMsrOptions->fTraceMsrVisitors) {
+  if (gMsrOptions ()->fTraceMsrVisitors) {
     fMsrSummaryOutputStream <<
       "--> End visiting msrStaff" <<
       endl;
@@ -477,7 +477,7 @@ void msr2SummaryVisitor::visitEnd (S_msrStaff& elt)
 //________________________________________________________________________
 void msr2SummaryVisitor::visitStart (S_msrVoice& elt)
 {
-  if (gMsrOptions->fTraceMsrVisitors) {
+  if (gMsrOptions ()->fTraceMsrVisitors) {
     fMsrSummaryOutputStream <<
       "--> Start visiting msrVoice" <<
       endl;
@@ -495,7 +495,7 @@ void msr2SummaryVisitor::visitStart (S_msrVoice& elt)
       "stanza", "stanzas") <<
     endl;
 
-  gIndenter++;
+  gIndenter ()++;
 
   const int fieldWidth = 34;
   
@@ -530,9 +530,9 @@ void msr2SummaryVisitor::visitStart (S_msrVoice& elt)
 
 void msr2SummaryVisitor::visitEnd (S_msrVoice& elt)
 {
-  gIndenter--;
+  gIndenter ()--;
 
-  if (gMsrOptions->fTraceMsrVisitors) {
+  if (gMsrOptions ()->fTraceMsrVisitors) {
     fMsrSummaryOutputStream <<
       "--> End visiting msrVoice" <<
       endl;
@@ -542,7 +542,7 @@ void msr2SummaryVisitor::visitEnd (S_msrVoice& elt)
 //________________________________________________________________________
 void msr2SummaryVisitor::visitStart (S_msrStanza& elt)
 {
-  if (gMsrOptions->fTraceMsrVisitors) {
+  if (gMsrOptions ()->fTraceMsrVisitors) {
     fMsrSummaryOutputStream <<
       "--> Start visiting msrStanza" <<
       endl;
@@ -571,7 +571,7 @@ void msr2SummaryVisitor::visitStart (S_msrStanza& elt)
 
 void msr2SummaryVisitor::visitEnd (S_msrStanza& elt)
 {
-  if (gMsrOptions->fTraceMsrVisitors) {
+  if (gMsrOptions ()->fTraceMsrVisitors) {
     fMsrSummaryOutputStream <<
       "--> End visiting msrStanza" <<
       endl;
@@ -581,7 +581,7 @@ void msr2SummaryVisitor::visitEnd (S_msrStanza& elt)
 //________________________________________________________________________
 void msr2SummaryVisitor::visitStart (S_msrSyllable& elt)
 {
-  if (gMsrOptions->fTraceMsrVisitors) {
+  if (gMsrOptions ()->fTraceMsrVisitors) {
     fMsrSummaryOutputStream <<
       "--> Start visiting msrSyllable" <<
       endl;
@@ -590,7 +590,7 @@ void msr2SummaryVisitor::visitStart (S_msrSyllable& elt)
 
 void msr2SummaryVisitor::visitEnd (S_msrSyllable& elt)
 {
-  if (gMsrOptions->fTraceMsrVisitors) {
+  if (gMsrOptions ()->fTraceMsrVisitors) {
     fMsrSummaryOutputStream <<
       "--> End visiting msrSyllable" <<
       endl;
@@ -600,7 +600,7 @@ void msr2SummaryVisitor::visitEnd (S_msrSyllable& elt)
 //________________________________________________________________________
 void msr2SummaryVisitor::visitStart (S_msrClef& elt)
 {
-  if (gMsrOptions->fTraceMsrVisitors) {
+  if (gMsrOptions ()->fTraceMsrVisitors) {
     fMsrSummaryOutputStream <<
       "--> Start visiting msrClef" <<
       endl;
@@ -615,7 +615,7 @@ void msr2SummaryVisitor::visitStart (S_msrClef& elt)
 
 void msr2SummaryVisitor::visitEnd (S_msrClef& elt)
 {
-  if (gMsrOptions->fTraceMsrVisitors) {
+  if (gMsrOptions ()->fTraceMsrVisitors) {
     fMsrSummaryOutputStream <<
       "--> End visiting msrClef" <<
       endl;
@@ -625,7 +625,7 @@ void msr2SummaryVisitor::visitEnd (S_msrClef& elt)
 //________________________________________________________________________
 void msr2SummaryVisitor::visitStart (S_msrKey& elt)
 {
-  if (gMsrOptions->fTraceMsrVisitors) {
+  if (gMsrOptions ()->fTraceMsrVisitors) {
     fMsrSummaryOutputStream <<
       "--> Start visiting msrKey" <<
       endl;
@@ -640,7 +640,7 @@ void msr2SummaryVisitor::visitStart (S_msrKey& elt)
 
 void msr2SummaryVisitor::visitEnd (S_msrKey& elt)
 {
-  if (gMsrOptions->fTraceMsrVisitors) {
+  if (gMsrOptions ()->fTraceMsrVisitors) {
     fMsrSummaryOutputStream <<
       "--> End visiting msrKey" <<
       endl;
@@ -650,7 +650,7 @@ void msr2SummaryVisitor::visitEnd (S_msrKey& elt)
 //________________________________________________________________________
 void msr2SummaryVisitor::visitStart (S_msrTime& elt)
 {
-  if (gMsrOptions->fTraceMsrVisitors) {
+  if (gMsrOptions ()->fTraceMsrVisitors) {
     fMsrSummaryOutputStream <<
       "--> Start visiting msrTime" <<
       endl;
@@ -665,7 +665,7 @@ void msr2SummaryVisitor::visitStart (S_msrTime& elt)
 
 void msr2SummaryVisitor::visitEnd (S_msrTime& elt)
 {
-  if (gMsrOptions->fTraceMsrVisitors) {
+  if (gMsrOptions ()->fTraceMsrVisitors) {
     fMsrSummaryOutputStream <<
       "--> End visiting msrTime" <<
     endl;
@@ -675,7 +675,7 @@ void msr2SummaryVisitor::visitEnd (S_msrTime& elt)
 //________________________________________________________________________
 void msr2SummaryVisitor::visitStart (S_msrTempo& elt)
 {
-  if (gMsrOptions->fTraceMsrVisitors) {
+  if (gMsrOptions ()->fTraceMsrVisitors) {
     fMsrSummaryOutputStream <<
       "--> Start visiting msrTempo" <<
        endl;
@@ -689,7 +689,7 @@ void msr2SummaryVisitor::visitStart (S_msrTempo& elt)
 
 void msr2SummaryVisitor::visitEnd (S_msrTempo& elt)
 {
-  if (gMsrOptions->fTraceMsrVisitors) {
+  if (gMsrOptions ()->fTraceMsrVisitors) {
     fMsrSummaryOutputStream <<
       "--> End visiting msrTempo" <<
     endl;
@@ -699,7 +699,7 @@ void msr2SummaryVisitor::visitEnd (S_msrTempo& elt)
 //________________________________________________________________________
 void msr2SummaryVisitor::visitStart (S_msrSegment& elt)
 {
-  if (gMsrOptions->fTraceMsrVisitors) {
+  if (gMsrOptions ()->fTraceMsrVisitors) {
     fMsrSummaryOutputStream <<
       "--> Start visiting msrSegment" <<
       endl;
@@ -708,7 +708,7 @@ void msr2SummaryVisitor::visitStart (S_msrSegment& elt)
 
 void msr2SummaryVisitor::visitEnd (S_msrSegment& elt)
 {
-  if (gMsrOptions->fTraceMsrVisitors) {
+  if (gMsrOptions ()->fTraceMsrVisitors) {
     fMsrSummaryOutputStream <<
       "--> End visiting msrSegment" <<
       endl;
@@ -718,7 +718,7 @@ void msr2SummaryVisitor::visitEnd (S_msrSegment& elt)
 //________________________________________________________________________
 void msr2SummaryVisitor::visitStart (S_msrArticulation& elt)
 {
-  if (gMsrOptions->fTraceMsrVisitors) {
+  if (gMsrOptions ()->fTraceMsrVisitors) {
     fMsrSummaryOutputStream <<
       "--> Start visiting msrArticulation" <<
       endl;
@@ -727,7 +727,7 @@ void msr2SummaryVisitor::visitStart (S_msrArticulation& elt)
 
 void msr2SummaryVisitor::visitEnd (S_msrArticulation& elt)
 {
-  if (gMsrOptions->fTraceMsrVisitors) {
+  if (gMsrOptions ()->fTraceMsrVisitors) {
     fMsrSummaryOutputStream <<
       "--> End visiting msrArticulation" <<
       endl;
@@ -737,7 +737,7 @@ void msr2SummaryVisitor::visitEnd (S_msrArticulation& elt)
 //________________________________________________________________________
 void msr2SummaryVisitor::visitStart (S_msrDynamics& elt)
 {
-  if (gMsrOptions->fTraceMsrVisitors) {
+  if (gMsrOptions ()->fTraceMsrVisitors) {
     fMsrSummaryOutputStream <<
       "--> Start visiting msrDynamics" <<
       endl;
@@ -746,7 +746,7 @@ void msr2SummaryVisitor::visitStart (S_msrDynamics& elt)
 
 void msr2SummaryVisitor::visitEnd (S_msrDynamics& elt)
 {
-  if (gMsrOptions->fTraceMsrVisitors) {
+  if (gMsrOptions ()->fTraceMsrVisitors) {
     fMsrSummaryOutputStream <<
       "--> End visiting msrDynamics" <<
       endl;
@@ -756,7 +756,7 @@ void msr2SummaryVisitor::visitEnd (S_msrDynamics& elt)
 //________________________________________________________________________
 void msr2SummaryVisitor::visitStart (S_msrWedge& elt)
 {
-  if (gMsrOptions->fTraceMsrVisitors) {
+  if (gMsrOptions ()->fTraceMsrVisitors) {
     fMsrSummaryOutputStream <<
       "--> Start visiting msrWedge" << endl;
   }
@@ -764,7 +764,7 @@ void msr2SummaryVisitor::visitStart (S_msrWedge& elt)
 
 void msr2SummaryVisitor::visitEnd (S_msrWedge& elt)
 {
-  if (gMsrOptions->fTraceMsrVisitors) {
+  if (gMsrOptions ()->fTraceMsrVisitors) {
     fMsrSummaryOutputStream <<
       "--> End visiting msrWedge" << endl;
   }
@@ -773,7 +773,7 @@ void msr2SummaryVisitor::visitEnd (S_msrWedge& elt)
 //________________________________________________________________________
 void msr2SummaryVisitor::visitStart (S_msrGraceNotesGroup& elt)
 {
-  if (gMsrOptions->fTraceMsrVisitors) {
+  if (gMsrOptions ()->fTraceMsrVisitors) {
     fMsrSummaryOutputStream <<
       "--> Start visiting msrGraceNotesGroup" << endl;
   }
@@ -781,7 +781,7 @@ void msr2SummaryVisitor::visitStart (S_msrGraceNotesGroup& elt)
 
 void msr2SummaryVisitor::visitEnd (S_msrGraceNotesGroup& elt)
 {
-  if (gMsrOptions->fTraceMsrVisitors) {
+  if (gMsrOptions ()->fTraceMsrVisitors) {
     fMsrSummaryOutputStream <<
       "--> End visiting msrGraceNotesGroup" << endl;
   }
@@ -790,7 +790,7 @@ void msr2SummaryVisitor::visitEnd (S_msrGraceNotesGroup& elt)
 //________________________________________________________________________
 void msr2SummaryVisitor::visitStart (S_msrNote& elt)
 {
-  if (gMsrOptions->fTraceMsrVisitors) {
+  if (gMsrOptions ()->fTraceMsrVisitors) {
     fMsrSummaryOutputStream <<
       "--> Start visiting " <<
       msrNote::noteKindAsString (
@@ -834,7 +834,7 @@ void msr2SummaryVisitor::visitStart (S_msrNote& elt)
 
 void msr2SummaryVisitor::visitEnd (S_msrNote& elt)
 {
-  if (gMsrOptions->fTraceMsrVisitors) {
+  if (gMsrOptions ()->fTraceMsrVisitors) {
     fMsrSummaryOutputStream <<
       "--> End visiting " <<
       msrNote::noteKindAsString (
@@ -871,7 +871,7 @@ void msr2SummaryVisitor::visitEnd (S_msrNote& elt)
 //________________________________________________________________________
 void msr2SummaryVisitor::visitStart (S_msrStem& elt)
 {
-  if (gMsrOptions->fTraceMsrVisitors) {
+  if (gMsrOptions ()->fTraceMsrVisitors) {
     fMsrSummaryOutputStream <<
       "--> Start visiting msrStem" << endl;
   }
@@ -879,7 +879,7 @@ void msr2SummaryVisitor::visitStart (S_msrStem& elt)
 
 void msr2SummaryVisitor::visitEnd (S_msrStem& elt)
 {
-  if (gMsrOptions->fTraceMsrVisitors) {
+  if (gMsrOptions ()->fTraceMsrVisitors) {
     fMsrSummaryOutputStream <<
       "--> End visiting msrStem" <<
       endl;
@@ -889,7 +889,7 @@ void msr2SummaryVisitor::visitEnd (S_msrStem& elt)
 //________________________________________________________________________
 void msr2SummaryVisitor::visitStart (S_msrBeam& elt)
 {
-  if (gMsrOptions->fTraceMsrVisitors) {
+  if (gMsrOptions ()->fTraceMsrVisitors) {
     fMsrSummaryOutputStream <<
       "--> Start visiting msrBeam" << endl;
   }
@@ -897,7 +897,7 @@ void msr2SummaryVisitor::visitStart (S_msrBeam& elt)
 
 void msr2SummaryVisitor::visitEnd (S_msrBeam& elt)
 {
-  if (gMsrOptions->fTraceMsrVisitors) {
+  if (gMsrOptions ()->fTraceMsrVisitors) {
     fMsrSummaryOutputStream <<
       "--> End visiting msrBeam" <<
       endl;
@@ -907,7 +907,7 @@ void msr2SummaryVisitor::visitEnd (S_msrBeam& elt)
 //________________________________________________________________________
 void msr2SummaryVisitor::visitStart (S_msrChord& elt)
 {
-  if (gMsrOptions->fTraceMsrVisitors) {
+  if (gMsrOptions ()->fTraceMsrVisitors) {
     fMsrSummaryOutputStream <<
       "--> Start visiting msrChord" <<
       endl;
@@ -918,7 +918,7 @@ void msr2SummaryVisitor::visitStart (S_msrChord& elt)
 
 void msr2SummaryVisitor::visitEnd (S_msrChord& elt)
 {
-  if (gMsrOptions->fTraceMsrVisitors) {
+  if (gMsrOptions ()->fTraceMsrVisitors) {
     fMsrSummaryOutputStream <<
       "--> End visiting msrChord" <<
       endl;
@@ -928,7 +928,7 @@ void msr2SummaryVisitor::visitEnd (S_msrChord& elt)
 //________________________________________________________________________
 void msr2SummaryVisitor::visitStart (S_msrTuplet& elt)
 {
-  if (gMsrOptions->fTraceMsrVisitors) {
+  if (gMsrOptions ()->fTraceMsrVisitors) {
     fMsrSummaryOutputStream <<
       "--> Start visiting msrTuplet" <<
       endl;
@@ -939,7 +939,7 @@ void msr2SummaryVisitor::visitStart (S_msrTuplet& elt)
 
 void msr2SummaryVisitor::visitEnd (S_msrTuplet& elt)
 {
-  if (gMsrOptions->fTraceMsrVisitors) {
+  if (gMsrOptions ()->fTraceMsrVisitors) {
     fMsrSummaryOutputStream <<
       "--> End visiting msrTuplet" <<
       endl;
@@ -949,7 +949,7 @@ void msr2SummaryVisitor::visitEnd (S_msrTuplet& elt)
 //________________________________________________________________________
 void msr2SummaryVisitor::visitStart (S_msrSlur& elt)
 {
-  if (gMsrOptions->fTraceMsrVisitors) {
+  if (gMsrOptions ()->fTraceMsrVisitors) {
     fMsrSummaryOutputStream <<
       "--> Start visiting msrSlur" <<
       endl;
@@ -958,7 +958,7 @@ void msr2SummaryVisitor::visitStart (S_msrSlur& elt)
 
 void msr2SummaryVisitor::visitEnd (S_msrSlur& elt)
 {
-  if (gMsrOptions->fTraceMsrVisitors) {
+  if (gMsrOptions ()->fTraceMsrVisitors) {
     fMsrSummaryOutputStream <<
       "--> End visiting msrSlur" <<
       endl;
@@ -968,7 +968,7 @@ void msr2SummaryVisitor::visitEnd (S_msrSlur& elt)
 //________________________________________________________________________
 void msr2SummaryVisitor::visitStart (S_msrBarline& elt)
 {
-  if (gMsrOptions->fTraceMsrVisitors) {
+  if (gMsrOptions ()->fTraceMsrVisitors) {
     fMsrSummaryOutputStream <<
       "--> Start visiting msrBarline" <<
       endl;
@@ -977,7 +977,7 @@ void msr2SummaryVisitor::visitStart (S_msrBarline& elt)
 
 void msr2SummaryVisitor::visitEnd (S_msrBarline& elt)
 {
-  if (gMsrOptions->fTraceMsrVisitors) {
+  if (gMsrOptions ()->fTraceMsrVisitors) {
     fMsrSummaryOutputStream <<
       "--> End visiting msrBarline" <<
       endl;
@@ -987,7 +987,7 @@ void msr2SummaryVisitor::visitEnd (S_msrBarline& elt)
 //________________________________________________________________________
 void msr2SummaryVisitor::visitStart (S_msrBarNumberCheck& elt)
 {
-  if (gMsrOptions->fTraceMsrVisitors) {
+  if (gMsrOptions ()->fTraceMsrVisitors) {
     fMsrSummaryOutputStream <<
       "--> Start visiting msrBarNumberCheck" <<
       endl;
@@ -996,7 +996,7 @@ void msr2SummaryVisitor::visitStart (S_msrBarNumberCheck& elt)
 
 void msr2SummaryVisitor::visitEnd (S_msrBarNumberCheck& elt)
 {
-  if (gMsrOptions->fTraceMsrVisitors) {
+  if (gMsrOptions ()->fTraceMsrVisitors) {
     fMsrSummaryOutputStream <<
       "--> End visiting msrBarNumberCheck" <<
       endl;
@@ -1006,7 +1006,7 @@ void msr2SummaryVisitor::visitEnd (S_msrBarNumberCheck& elt)
 //________________________________________________________________________
 void msr2SummaryVisitor::visitStart (S_msrLineBreak& elt)
 {
-  if (gMsrOptions->fTraceMsrVisitors) {
+  if (gMsrOptions ()->fTraceMsrVisitors) {
     fMsrSummaryOutputStream <<
       "--> Start visiting msrLineBreak" <<
       endl;
@@ -1015,7 +1015,7 @@ void msr2SummaryVisitor::visitStart (S_msrLineBreak& elt)
 
 void msr2SummaryVisitor::visitEnd (S_msrLineBreak& elt)
 {
-  if (gMsrOptions->fTraceMsrVisitors) {
+  if (gMsrOptions ()->fTraceMsrVisitors) {
     fMsrSummaryOutputStream <<
       "--> End visiting msrLineBreak" <<
       endl;
@@ -1025,7 +1025,7 @@ void msr2SummaryVisitor::visitEnd (S_msrLineBreak& elt)
 //________________________________________________________________________
 void msr2SummaryVisitor::visitStart (S_msrRepeat& elt)
 {
-  if (gMsrOptions->fTraceMsrVisitors) {
+  if (gMsrOptions ()->fTraceMsrVisitors) {
     fMsrSummaryOutputStream <<
       "--> Start visiting msrRepeat" <<
       endl;
@@ -1034,7 +1034,7 @@ void msr2SummaryVisitor::visitStart (S_msrRepeat& elt)
 
 void msr2SummaryVisitor::visitEnd (S_msrRepeat& elt)
 {
-  if (gMsrOptions->fTraceMsrVisitors) {
+  if (gMsrOptions ()->fTraceMsrVisitors) {
     fMsrSummaryOutputStream <<
       "--> End visiting msrRepeat" <<
       endl;
@@ -1044,7 +1044,7 @@ void msr2SummaryVisitor::visitEnd (S_msrRepeat& elt)
 //________________________________________________________________________
 void msr2SummaryVisitor::visitStart (S_msrVarValAssoc& elt)
 {
-  if (gMsrOptions->fTraceMsrVisitors) {
+  if (gMsrOptions ()->fTraceMsrVisitors) {
     fMsrSummaryOutputStream <<
       "--> Start visiting msrVarValAssoc" <<
       endl;
@@ -1054,7 +1054,7 @@ void msr2SummaryVisitor::visitStart (S_msrVarValAssoc& elt)
     "VarValAssoc" <<
     endl;
   
-  gIndenter++;
+  gIndenter ()++;
   
   const int fieldWidth = 16;
 
@@ -1072,12 +1072,12 @@ void msr2SummaryVisitor::visitStart (S_msrVarValAssoc& elt)
     endl <<
     endl;
   
-  gIndenter--;
+  gIndenter ()--;
 }
 
 void msr2SummaryVisitor::visitEnd (S_msrVarValAssoc& elt)
 {
-  if (gMsrOptions->fTraceMsrVisitors) {
+  if (gMsrOptions ()->fTraceMsrVisitors) {
     fMsrSummaryOutputStream <<
       "--> End visiting msrVarValAssoc" <<
       endl;
@@ -1087,7 +1087,7 @@ void msr2SummaryVisitor::visitEnd (S_msrVarValAssoc& elt)
 //________________________________________________________________________
 void msr2SummaryVisitor::visitStart (S_msrVarValsListAssoc& elt)
 {
-  if (gMsrOptions->fTraceMsrVisitors) {
+  if (gMsrOptions ()->fTraceMsrVisitors) {
     fMsrSummaryOutputStream <<
       "--> Start visiting msrVarValsListAssoc" <<
       endl;
@@ -1097,7 +1097,7 @@ void msr2SummaryVisitor::visitStart (S_msrVarValsListAssoc& elt)
     "VarValsListAssoc" <<
     endl;
   
-  gIndenter++;
+  gIndenter ()++;
 
   const int fieldWidth = 21;
   
@@ -1115,12 +1115,12 @@ void msr2SummaryVisitor::visitStart (S_msrVarValsListAssoc& elt)
     endl <<
     endl;
   
-  gIndenter--;
+  gIndenter ()--;
 }
 
 void msr2SummaryVisitor::visitEnd (S_msrVarValsListAssoc& elt)
 {
-  if (gMsrOptions->fTraceMsrVisitors) {
+  if (gMsrOptions ()->fTraceMsrVisitors) {
     fMsrSummaryOutputStream <<
       "--> End visiting msrVarValsListAssoc" <<
       endl;
@@ -1130,7 +1130,7 @@ void msr2SummaryVisitor::visitEnd (S_msrVarValsListAssoc& elt)
 //________________________________________________________________________
 void msr2SummaryVisitor::visitStart (S_msrPageGeometry& elt)
 {
-  if (gMsrOptions->fTraceMsrVisitors) {
+  if (gMsrOptions ()->fTraceMsrVisitors) {
     fMsrSummaryOutputStream <<
       "--> Start visiting msrPageGeometry" <<
       endl;
@@ -1142,7 +1142,7 @@ void msr2SummaryVisitor::visitStart (S_msrPageGeometry& elt)
 
 void msr2SummaryVisitor::visitEnd (S_msrPageGeometry& elt)
 {
-  if (gMsrOptions->fTraceMsrVisitors) {
+  if (gMsrOptions ()->fTraceMsrVisitors) {
     fMsrSummaryOutputStream <<
       "--> End visiting msrPageGeometry" <<
       endl;
@@ -1152,7 +1152,7 @@ void msr2SummaryVisitor::visitEnd (S_msrPageGeometry& elt)
 //________________________________________________________________________
 void msr2SummaryVisitor::visitStart (S_msrLayout& elt)
 {
-  if (gMsrOptions->fTraceMsrVisitors) {
+  if (gMsrOptions ()->fTraceMsrVisitors) {
     fMsrSummaryOutputStream <<
       "--> Start visiting msrLayout" <<
       endl;
@@ -1160,14 +1160,14 @@ void msr2SummaryVisitor::visitStart (S_msrLayout& elt)
 
   fMsrSummaryOutputStream << "Layout" << endl;
 
-  gIndenter++;
+  gIndenter ()++;
 }
 
 void msr2SummaryVisitor::visitEnd (S_msrLayout& elt)
 {
-  gIndenter--;
+  gIndenter ()--;
 
-  if (gMsrOptions->fTraceMsrVisitors) {
+  if (gMsrOptions ()->fTraceMsrVisitors) {
     fMsrSummaryOutputStream <<
       "--> End visiting msrLayout" <<
       endl;
@@ -1177,7 +1177,7 @@ void msr2SummaryVisitor::visitEnd (S_msrLayout& elt)
 //________________________________________________________________________
 void msr2SummaryVisitor::visitStart (S_msrMidi& elt)
 {
-  if (gMsrOptions->fTraceMsrVisitors) {
+  if (gMsrOptions ()->fTraceMsrVisitors) {
     fMsrSummaryOutputStream <<
       "--> Start visiting msrMidi" <<
       endl;
@@ -1186,7 +1186,7 @@ void msr2SummaryVisitor::visitStart (S_msrMidi& elt)
 
 void msr2SummaryVisitor::visitEnd (S_msrMidi& elt)
 {
-  if (gMsrOptions->fTraceMsrVisitors) {
+  if (gMsrOptions ()->fTraceMsrVisitors) {
     fMsrSummaryOutputStream <<
       "--> End visiting msrMidi" <<
       endl;
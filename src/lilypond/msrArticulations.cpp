@@ -136,8 +136,8 @@ string msrArticulation::articulationPlacementKindAsString () const
 
 void msrArticulation::acceptIn (basevisitor* v)
 {
-  if (gMsrOptions->fTraceMsrVisitors) {
-    gLogIOstream <<
+  if (gMsrOptions ()->fTraceMsrVisitors) {
+    gLogIOstream () <<
       "% ==> msrArticulation::acceptIn ()" <<
       endl;
   }
@@ -147,8 +147,8 @@ void msrArticulation::acceptIn (basevisitor* v)
       dynamic_cast<visitor<S_msrArticulation>*> (v)) {
         S_msrArticulation elem = this;
         
-        if (gMsrOptions->fTraceMsrVisitors) {
-          gLogIOstream <<
+        if (gMsrOptions ()->fTraceMsrVisitors) {
+          gLogIOstream () <<
             "% ==> Launching msrArticulation::visitStart ()" <<
             endl;
         }
@@ -158,8 +158,8 @@ void msrArticulation::acceptIn (basevisitor* v)
 
 void msrArticulation::acceptOut (basevisitor* v)
 {
-  if (gMsrOptions->fTraceMsrVisitors) {
-    gLogIOstream <<
+  if (gMsrOptions ()->fTraceMsrVisitors) {
+    gLogIOstream () <<
       "% ==> msrArticulation::acceptOut ()" <<
       endl;
   }
@@ -169,8 +169,8 @@ void msrArticulation::acceptOut (basevisitor* v)
       dynamic_cast<visitor<S_msrArticulation>*> (v)) {
         S_msrArticulation elem = this;
       
-        if (gMsrOptions->fTraceMsrVisitors) {
-          gLogIOstream <<
+        if (gMsrOptions ()->fTraceMsrVisitors) {
+          gLogIOstream () <<
             "% ==> Launching msrArticulation::visitEnd ()" <<
             endl;
         }
@@ -231,8 +231,8 @@ msrFermata::~msrFermata ()
 
 void msrFermata::acceptIn (basevisitor* v)
 {
-  if (gMsrOptions->fTraceMsrVisitors) {
-    gLogIOstream <<
+  if (gMsrOptions ()->fTraceMsrVisitors) {
+    gLogIOstream () <<
       "% ==> msrFermata::acceptIn ()" <<
       endl;
   }
@@ -242,8 +242,8 @@ void msrFermata::acceptIn (basevisitor* v)
       dynamic_cast<visitor<S_msrFermata>*> (v)) {
         S_msrFermata elem = this;
         
-        if (gMsrOptions->fTraceMsrVisitors) {
-          gLogIOstream <<
+        if (gMsrOptions ()->fTraceMsrVisitors) {
+          gLogIOstream () <<
             "% ==> Launching msrFermata::visitStart ()" <<
             endl;
         }
@@ -253,8 +253,8 @@ void msrFermata::acceptIn (basevisitor* v)
 
 void msrFermata::acceptOut (basevisitor* v)
 {
-  if (gMsrOptions->fTraceMsrVisitors) {
-    gLogIOstream <<
+  if (gMsrOptions ()->fTraceMsrVisitors) {
+    gLogIOstream () <<
       "% ==> msrFermata::acceptOut ()" <<
       endl;
   }
@@ -264,8 +264,8 @@ void msrFermata::acceptOut (basevisitor* v)
       dynamic_cast<visitor<S_msrFermata>*> (v)) {
         S_msrFermata elem = this;
       
-        if (gMsrOptions->fTraceMsrVisitors) {
-          gLogIOstream <<
+        if (gMsrOptions ()->fTraceMsrVisitors) {
+          gLogIOstream () <<
             "% ==> Launching msrFermata::visitEnd ()" <<
             endl;
         }
@@ -387,8 +387,8 @@ string msrArpeggiato::arpeggiatoDirectionKindAsString () const
 
 void msrArpeggiato::acceptIn (basevisitor* v)
 {
-  if (gMsrOptions->fTraceMsrVisitors) {
-    gLogIOstream <<
+  if (gMsrOptions ()->fTraceMsrVisitors) {
+    gLogIOstream () <<
       "% ==> msrArpeggiato::acceptIn ()" <<
       endl;
   }
@@ -398,8 +398,8 @@ void msrArpeggiato::acceptIn (basevisitor* v)
       dynamic_cast<visitor<S_msrArpeggiato>*> (v)) {
         S_msrArpeggiato elem = this;
         
-        if (gMsrOptions->fTraceMsrVisitors) {
-          gLogIOstream <<
+        if (gMsrOptions ()->fTraceMsrVisitors) {
+          gLogIOstream () <<
             "% ==> Launching msrArpeggiato::visitStart ()" <<
             endl;
         }
@@ -409,8 +409,8 @@ void msrArpeggiato::acceptIn (basevisitor* v)
 
 void msrArpeggiato::acceptOut (basevisitor* v)
 {
-  if (gMsrOptions->fTraceMsrVisitors) {
-    gLogIOstream <<
+  if (gMsrOptions ()->fTraceMsrVisitors) {
+    gLogIOstream () <<
       "% ==> msrArpeggiato::acceptOut ()" <<
       endl;
   }
@@ -420,8 +420,8 @@ void msrArpeggiato::acceptOut (basevisitor* v)
       dynamic_cast<visitor<S_msrArpeggiato>*> (v)) {
         S_msrArpeggiato elem = this;
       
-        if (gMsrOptions->fTraceMsrVisitors) {
-          gLogIOstream <<
+        if (gMsrOptions ()->fTraceMsrVisitors) {
+          gLogIOstream () <<
             "% ==> Launching msrArpeggiato::visitEnd ()" <<
             endl;
         }
@@ -516,8 +516,8 @@ string msrNonArpeggiato::nonArpeggiatoTypeKindAsString () const
 
 void msrNonArpeggiato::acceptIn (basevisitor* v)
 {
-  if (gMsrOptions->fTraceMsrVisitors) {
-    gLogIOstream <<
+  if (gMsrOptions ()->fTraceMsrVisitors) {
+    gLogIOstream () <<
       "% ==> msrNonArpeggiato::acceptIn ()" <<
       endl;
   }
@@ -527,8 +527,8 @@ void msrNonArpeggiato::acceptIn (basevisitor* v)
       dynamic_cast<visitor<S_msrNonArpeggiato>*> (v)) {
         S_msrNonArpeggiato elem = this;
         
-        if (gMsrOptions->fTraceMsrVisitors) {
-          gLogIOstream <<
+        if (gMsrOptions ()->fTraceMsrVisitors) {
+          gLogIOstream () <<
             "% ==> Launching msrNonArpeggiato::visitStart ()" <<
             endl;
         }
@@ -538,8 +538,8 @@ void msrNonArpeggiato::acceptIn (basevisitor* v)
 
 void msrNonArpeggiato::acceptOut (basevisitor* v)
 {
-  if (gMsrOptions->fTraceMsrVisitors) {
-    gLogIOstream <<
+  if (gMsrOptions ()->fTraceMsrVisitors) {
+    gLogIOstream () <<
       "% ==> msrNonArpeggiato::acceptOut ()" <<
       endl;
   }
@@ -549,8 +549,8 @@ void msrNonArpeggiato::acceptOut (basevisitor* v)
       dynamic_cast<visitor<S_msrNonArpeggiato>*> (v)) {
         S_msrNonArpeggiato elem = this;
       
-        if (gMsrOptions->fTraceMsrVisitors) {
-          gLogIOstream <<
+        if (gMsrOptions ()->fTraceMsrVisitors) {
+          gLogIOstream () <<
             "% ==> Launching msrNonArpeggiato::visitEnd ()" <<
             endl;
         }
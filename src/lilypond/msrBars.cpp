@@ -59,8 +59,8 @@ msrBarCheck::msrBarCheck (
     : msrElement (inputLineNumber)
 {
 #ifdef TRACE_OPTIONS
-  if (gTraceOptions->fTraceMeasures) {
-    gLogIOstream <<
+  if (gTraceOptions ()->fTraceMeasures) {
+    gLogIOstream () <<
       "Creating a bar check without next bar number" <<
       endl;
   }
@@ -75,8 +75,8 @@ msrBarCheck::msrBarCheck (
   fNextBarNumber = nextBarNumber; 
 
 #ifdef TRACE_OPTIONS
-  if (gTraceOptions->fTraceMeasures) {
-    gLogIOstream <<
+  if (gTraceOptions ()->fTraceMeasures) {
+    gLogIOstream () <<
       "Creating a bar check with next bar number '" <<
       fNextBarNumber <<
       "'" <<
@@ -91,8 +91,8 @@ msrBarCheck::~msrBarCheck ()
 void msrBarCheck::setNextBarNumber (string number)
 {
 #ifdef TRACE_OPTIONS
-  if (gTraceOptions->fTraceMeasures) {
-    gLogIOstream <<
+  if (gTraceOptions ()->fTraceMeasures) {
+    gLogIOstream () <<
       "Setting bar check next bar number to '" <<
       number <<
       "'" <<
@@ -105,8 +105,8 @@ void msrBarCheck::setNextBarNumber (string number)
 
 void msrBarCheck::acceptIn (basevisitor* v)
 {
-  if (gMsrOptions->fTraceMsrVisitors) {
-    gLogIOstream <<
+  if (gMsrOptions ()->fTraceMsrVisitors) {
+    gLogIOstream () <<
       "% ==> msrBarCheck::acceptIn ()" <<
       endl;
   }
@@ -116,8 +116,8 @@ void msrBarCheck::acceptIn (basevisitor* v)
       dynamic_cast<visitor<S_msrBarCheck>*> (v)) {
         S_msrBarCheck elem = this;
         
-        if (gMsrOptions->fTraceMsrVisitors) {
-          gLogIOstream <<
+        if (gMsrOptions ()->fTraceMsrVisitors) {
+          gLogIOstream () <<
             "% ==> Launching msrBarCheck::visitStart ()" <<
             endl;
         }
@@ -127,8 +127,8 @@ void msrBarCheck::acceptIn (basevisitor* v)
 
 void msrBarCheck::acceptOut (basevisitor* v)
 {
-  if (gMsrOptions->fTraceMsrVisitors) {
-    gLogIOstream <<
+  if (gMsrOptions ()->fTraceMsrVisitors) {
+    gLogIOstream () <<
       "% ==> msrBarCheck::acceptOut ()" <<
       endl;
   }
@@ -138,8 +138,8 @@ void msrBarCheck::acceptOut (basevisitor* v)
       dynamic_cast<visitor<S_msrBarCheck>*> (v)) {
         S_msrBarCheck elem = this;
       
-        if (gMsrOptions->fTraceMsrVisitors) {
-          gLogIOstream <<
+        if (gMsrOptions ()->fTraceMsrVisitors) {
+          gLogIOstream () <<
             "% ==> Launching msrBarCheck::visitEnd ()" <<
             endl;
         }
@@ -200,8 +200,8 @@ msrBarNumberCheck::~msrBarNumberCheck ()
 
 void msrBarNumberCheck::acceptIn (basevisitor* v)
 {
-  if (gMsrOptions->fTraceMsrVisitors) {
-    gLogIOstream <<
+  if (gMsrOptions ()->fTraceMsrVisitors) {
+    gLogIOstream () <<
       "% ==> msrBarNumberCheck::acceptIn ()" <<
       endl;
   }
@@ -211,8 +211,8 @@ void msrBarNumberCheck::acceptIn (basevisitor* v)
       dynamic_cast<visitor<S_msrBarNumberCheck>*> (v)) {
         S_msrBarNumberCheck elem = this;
         
-        if (gMsrOptions->fTraceMsrVisitors) {
-          gLogIOstream <<
+        if (gMsrOptions ()->fTraceMsrVisitors) {
+          gLogIOstream () <<
             "% ==> Launching msrBarNumberCheck::visitStart ()" <<
             endl;
         }
@@ -222,8 +222,8 @@ void msrBarNumberCheck::acceptIn (basevisitor* v)
 
 void msrBarNumberCheck::acceptOut (basevisitor* v)
 {
-  if (gMsrOptions->fTraceMsrVisitors) {
-    gLogIOstream <<
+  if (gMsrOptions ()->fTraceMsrVisitors) {
+    gLogIOstream () <<
       "% ==> msrBarNumberCheck::acceptOut ()" <<
       endl;
   }
@@ -233,8 +233,8 @@ void msrBarNumberCheck::acceptOut (basevisitor* v)
       dynamic_cast<visitor<S_msrBarNumberCheck>*> (v)) {
         S_msrBarNumberCheck elem = this;
       
-        if (gMsrOptions->fTraceMsrVisitors) {
-          gLogIOstream <<
+        if (gMsrOptions ()->fTraceMsrVisitors) {
+          gLogIOstream () <<
             "% ==> Launching msrBarNumberCheck::visitEnd ()" <<
             endl;
         }
@@ -324,7 +324,7 @@ msrBarline::msrBarline (
 
   fBarlineTimes = barlineTimes;
   
-  // JMI gLogIOstream << "fEndingNumber = " << fEndingNumber << endl;
+  // JMI gLogIOstream () << "fEndingNumber = " << fEndingNumber << endl;
   
   // extract individual numbers from fEndingNumber
   // that may contain "1, 2"
@@ -338,8 +338,8 @@ msrBarline::~msrBarline ()
 
 void msrBarline::acceptIn (basevisitor* v)
 {
-  if (gMsrOptions->fTraceMsrVisitors) {
-    gLogIOstream <<
+  if (gMsrOptions ()->fTraceMsrVisitors) {
+    gLogIOstream () <<
       "% ==> msrBarline::acceptIn ()" <<
       endl;
   }
@@ -349,8 +349,8 @@ void msrBarline::acceptIn (basevisitor* v)
       dynamic_cast<visitor<S_msrBarline>*> (v)) {
         S_msrBarline elem = this;
         
-        if (gMsrOptions->fTraceMsrVisitors) {
-          gLogIOstream <<
+        if (gMsrOptions ()->fTraceMsrVisitors) {
+          gLogIOstream () <<
             "% ==> Launching msrBarline::visitStart ()" <<
             endl;
         }
@@ -360,8 +360,8 @@ void msrBarline::acceptIn (basevisitor* v)
 
 void msrBarline::acceptOut (basevisitor* v)
 {
-  if (gMsrOptions->fTraceMsrVisitors) {
-    gLogIOstream <<
+  if (gMsrOptions ()->fTraceMsrVisitors) {
+    gLogIOstream () <<
       "% ==> msrBarline::acceptOut ()" <<
       endl;
   }
@@ -371,8 +371,8 @@ void msrBarline::acceptOut (basevisitor* v)
       dynamic_cast<visitor<S_msrBarline>*> (v)) {
         S_msrBarline elem = this;
       
-        if (gMsrOptions->fTraceMsrVisitors) {
-          gLogIOstream <<
+        if (gMsrOptions ()->fTraceMsrVisitors) {
+          gLogIOstream () <<
             "% ==> Launching msrBarline::visitEnd ()" <<
             endl;
         }
@@ -652,7 +652,7 @@ void msrBarline::print (ostream& os)
     ", line " << fInputLineNumber <<
     endl;
 
-  gIndenter++;
+  gIndenter ()++;
 
   const int fieldWidth = 24;
 
@@ -720,7 +720,7 @@ void msrBarline::print (ostream& os)
     fBarlinePositionInMeasure <<
     endl;
      
-  gIndenter--;
+  gIndenter ()--;
 }
 
 ostream& operator<< (ostream& os, const S_msrBarline& elt)
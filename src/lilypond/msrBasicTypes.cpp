@@ -84,7 +84,6 @@ rational msrDottedDuration::dottedDurationAsWholeNotes (
     while (dots > 0) {
       result *=
         rational (3, 2);
-      result.rationalise ();
 
       dots--;
     } // while
@@ -4559,7 +4558,7 @@ msrSemiTonesPitchKind noteAtIntervalFromSemiTonesPitch (
           ", line = " << inputLineNumber;
 
         msrLimitation (
-          gXml2lyOptions->fInputSourceName,
+          gXml2lyOptions ()->fInputSourceName,
           inputLineNumber,
           __FILE__, __LINE__,
           s.str ());
@@ -7443,14 +7442,14 @@ msrQuarterTonesPitchKind noteAtIntervalFromQuarterTonesPitch (
         s <<
           "Sorry, computing intervals from quartertones pitch '" <<
           msrQuarterTonesPitchKindAsString (
-            gMsrOptions->fMsrQuarterTonesPitchesLanguageKind,
+            gMsrOptions ()->fMsrQuarterTonesPitchesLanguageKind,
             quarterTonesPitchKind) <<
           "(" << quarterTonesPitchKind << ")" <<
           "' is not supported"
           ", line = " << inputLineNumber;
 
         msrLimitation (
-          gXml2lyOptions->fInputSourceName,
+          gXml2lyOptions ()->fInputSourceName,
           inputLineNumber,
           __FILE__, __LINE__,
           s.str ());
@@ -8621,8 +8620,10 @@ msrHarmonyKind msrHarmonyKindFromString (
   return result;
 }
 
-void initializeChordStructuresMap ()
+static map<msrHarmonyKind, S_msrChordStructure> buildChordStructuresMap ()
 {
+  map<msrHarmonyKind, S_msrChordStructure> result;
+  
   for (int i = k_NoHarmony; i <= kNoneHarmony; i++) {
     msrHarmonyKind
       harmonyKind =
@@ -8635,56 +8636,75 @@ void initializeChordStructuresMap ()
           harmonyKind);
 
     // register it in the map
-    gChordStructuresMap [harmonyKind] =
+    result [harmonyKind] =
       chordStructure;
   } // for
+
+  return result;
+}
+
+const map<msrHarmonyKind, S_msrChordStructure>& chordStructuresMap ()
+{
+  // built on first use only, most scores contain no harmonies,
+  // and the initialization of a local static is thread safe
+  static const map<msrHarmonyKind, S_msrChordStructure>
+    sChordStructuresMap =
+      buildChordStructuresMap ();
+
+  return sChordStructuresMap;
 }
 
 void printChordStructuresMap ()
 {
-  gLogIOstream <<
+  gLogIOstream () <<
     "Harmonies chords structures:" <<
-    " (" << gChordStructuresMap.size () << ")" <<
+    " (" << chordStructuresMap ().size () << ")" <<
     endl;
 
-  gIndenter++;
+  gIndenter ()++;
 
   for (int i = k_NoHarmony; i <= kNoneHarmony; i++) {
     msrHarmonyKind
       harmonyKind =
         msrHarmonyKind (i);
 
-    gLogIOstream <<
+    gLogIOstream () <<
 // JMI      "i:" << i << " " <<
       msrHarmonyKindAsString (harmonyKind) << ":" <<
       endl;
 
-    gIndenter++;
+    gIndenter ()++;
     
+    map<msrHarmonyKind, S_msrChordStructure>::const_iterator
+      it =
+        chordStructuresMap ().find (harmonyKind);
+
     S_msrChordStructure
-      chordStructure =
-        gChordStructuresMap [harmonyKind];
+      chordStructure;
+
+    if (it != chordStructuresMap ().end ())
+      chordStructure = (*it).second;
 
     if (chordStructure) {
-      gLogIOstream <<
+      gLogIOstream () <<
         chordStructure <<
         endl;
     }
     else {
-      gLogIOstream <<
+      gLogIOstream () <<
         "no intervals" <<
         endl;
     }
 
-    gIndenter--;
+    gIndenter ()--;
     
-    gLogIOstream <<
+    gLogIOstream () <<
       endl;
   } // for
 
-  gIndenter--;
+  gIndenter ()--;
 
-  gLogIOstream <<
+  gLogIOstream () <<
     endl;
 }
 
@@ -8694,921 +8714,422 @@ void printChordStructuresMap ()
 map<string, msrQuarterTonesPitchesLanguageKind>
   gQuarterTonesPitchesLanguageKindsMap;
 
-map<msrQuarterTonesPitchKind, string> gNederlandsPitchNamesMap;
-map<msrQuarterTonesPitchKind, string> gCatalanPitchNamesMap;
-map<msrQuarterTonesPitchKind, string> gDeutschPitchNamesMap;
-map<msrQuarterTonesPitchKind, string> gEnglishPitchNamesMap;
-map<msrQuarterTonesPitchKind, string> gEspanolPitchNamesMap;
-map<msrQuarterTonesPitchKind, string> gFrancaisPitchNamesMap;
-map<msrQuarterTonesPitchKind, string> gItalianoPitchNamesMap;
-map<msrQuarterTonesPitchKind, string> gNorskPitchNamesMap;
-map<msrQuarterTonesPitchKind, string> gPortuguesPitchNamesMap;
-map<msrQuarterTonesPitchKind, string> gSuomiPitchNamesMap;
-map<msrQuarterTonesPitchKind, string> gSvenskaPitchNamesMap;
-map<msrQuarterTonesPitchKind, string> gVlaamsPitchNamesMap;
+// the pitch names in the languages, indexed by
+// msrQuarterTonesPitchesLanguageKind and msrQuarterTonesPitchKind,
+// empty for the triple flats and sharps, that have no name
+static const char* const
+  gQuarterTonesPitchNames [kVlaams + 1] [kG_TripleSharp_QTP + 1] = {
+  // nederlands
+  {
+    "", "r",
 
-void initializeQuarterTonesPitchesLanguageKinds ()
-{
-  gQuarterTonesPitchesLanguageKindsMap ["nederlands"] = kNederlands;
-  gQuarterTonesPitchesLanguageKindsMap ["catalan"]    = kCatalan;
-  gQuarterTonesPitchesLanguageKindsMap ["deutsch"]    = kDeutsch;
-  gQuarterTonesPitchesLanguageKindsMap ["english"]    = kEnglish;
-  gQuarterTonesPitchesLanguageKindsMap ["espanol"]    = kEspanol;
-  gQuarterTonesPitchesLanguageKindsMap ["italiano"]   = kItaliano;
-  gQuarterTonesPitchesLanguageKindsMap ["francais"]   = kFrancais;
-  gQuarterTonesPitchesLanguageKindsMap ["norsk"]      = kNorsk;
-  gQuarterTonesPitchesLanguageKindsMap ["portugues"]  = kPortugues;
-  gQuarterTonesPitchesLanguageKindsMap ["suomi"]      = kSuomi;
-  gQuarterTonesPitchesLanguageKindsMap ["svenska"]    = kSvenska;
-  gQuarterTonesPitchesLanguageKindsMap ["vlaams"]     = kVlaams;
+    "",       "aeses",  "aeseh",  "aes",    "aeh",
+    "a",
+    "aih",    "ais",    "aisih",  "aisis",  "",
 
-  // nederlands
-  gNederlandsPitchNamesMap [k_NoQuarterTonesPitch_QTP]  = "";
-  gNederlandsPitchNamesMap [k_Rest_QTP]                 = "r";
-  
-  gNederlandsPitchNamesMap [kA_DoubleFlat_QTP]  = "aeses";
-  gNederlandsPitchNamesMap [kA_SesquiFlat_QTP]  = "aeseh";
-  gNederlandsPitchNamesMap [kA_Flat_QTP]        = "aes";
-  gNederlandsPitchNamesMap [kA_SemiFlat_QTP]    = "aeh";
-  gNederlandsPitchNamesMap [kA_Natural_QTP]     = "a";
-  gNederlandsPitchNamesMap [kA_SemiSharp_QTP]   = "aih";
-  gNederlandsPitchNamesMap [kA_Sharp_QTP]       = "ais";
-  gNederlandsPitchNamesMap [kA_SesquiSharp_QTP] = "aisih";
-  gNederlandsPitchNamesMap [kA_DoubleSharp_QTP] = "aisis";
-    
-  gNederlandsPitchNamesMap [kB_DoubleFlat_QTP]  = "beses";
-  gNederlandsPitchNamesMap [kB_SesquiFlat_QTP]  = "beseh";
-  gNederlandsPitchNamesMap [kB_Flat_QTP]        = "bes";
-  gNederlandsPitchNamesMap [kB_SemiFlat_QTP]    = "beh";
-  gNederlandsPitchNamesMap [kB_Natural_QTP]     = "b";
-  gNederlandsPitchNamesMap [kB_SemiSharp_QTP]   = "bih";
-  gNederlandsPitchNamesMap [kB_Sharp_QTP]       = "bis";
-  gNederlandsPitchNamesMap [kB_SesquiSharp_QTP] = "bisih";
-  gNederlandsPitchNamesMap [kB_DoubleSharp_QTP] = "bisis";
-    
-  gNederlandsPitchNamesMap [kC_DoubleFlat_QTP]  = "ceses";
-  gNederlandsPitchNamesMap [kC_SesquiFlat_QTP]  = "ceseh";
-  gNederlandsPitchNamesMap [kC_Flat_QTP]        = "ces";
-  gNederlandsPitchNamesMap [kC_SemiFlat_QTP]    = "ceh";
-  gNederlandsPitchNamesMap [kC_Natural_QTP]     = "c";
-  gNederlandsPitchNamesMap [kC_SemiSharp_QTP]   = "cih";
-  gNederlandsPitchNamesMap [kC_Sharp_QTP]       = "cis";
-  gNederlandsPitchNamesMap [kC_SesquiSharp_QTP] = "cisih";
-  gNederlandsPitchNamesMap [kC_DoubleSharp_QTP] = "cisis";
-    
-  gNederlandsPitchNamesMap [kD_DoubleFlat_QTP]  = "deses";
-  gNederlandsPitchNamesMap [kD_SesquiFlat_QTP]  = "deseh";
-  gNederlandsPitchNamesMap [kD_Flat_QTP]        = "des";
-  gNederlandsPitchNamesMap [kD_SemiFlat_QTP]    = "deh";
-  gNederlandsPitchNamesMap [kD_Natural_QTP]     = "d";
-  gNederlandsPitchNamesMap [kD_SemiSharp_QTP]   = "dih";
-  gNederlandsPitchNamesMap [kD_Sharp_QTP]       = "dis";
-  gNederlandsPitchNamesMap [kD_SesquiSharp_QTP] = "disih";
-  gNederlandsPitchNamesMap [kD_DoubleSharp_QTP] = "disis";
-
-  gNederlandsPitchNamesMap [kE_DoubleFlat_QTP]  = "eeses";
-  gNederlandsPitchNamesMap [kE_SesquiFlat_QTP]  = "eeseh";
-  gNederlandsPitchNamesMap [kE_Flat_QTP]        = "ees";
-  gNederlandsPitchNamesMap [kE_SemiFlat_QTP]    = "eeh";
-  gNederlandsPitchNamesMap [kE_Natural_QTP]     = "e";
-  gNederlandsPitchNamesMap [kE_SemiSharp_QTP]   = "eih";
-  gNederlandsPitchNamesMap [kE_Sharp_QTP]       = "eis";
-  gNederlandsPitchNamesMap [kE_SesquiSharp_QTP] = "eisih";
-  gNederlandsPitchNamesMap [kE_DoubleSharp_QTP] = "eisis";
-    
-  gNederlandsPitchNamesMap [kF_DoubleFlat_QTP]  = "feses";
-  gNederlandsPitchNamesMap [kF_SesquiFlat_QTP]  = "feseh";
-  gNederlandsPitchNamesMap [kF_Flat_QTP]        = "fes";
-  gNederlandsPitchNamesMap [kF_SemiFlat_QTP]    = "feh";
-  gNederlandsPitchNamesMap [kF_Natural_QTP]     = "f";
-  gNederlandsPitchNamesMap [kF_SemiSharp_QTP]   = "fih";
-  gNederlandsPitchNamesMap [kF_Sharp_QTP]       = "fis";
-  gNederlandsPitchNamesMap [kF_SesquiSharp_QTP] = "fisih";
-  gNederlandsPitchNamesMap [kF_DoubleSharp_QTP] = "fisis";
-    
-  gNederlandsPitchNamesMap [kG_DoubleFlat_QTP]  = "geses";
-  gNederlandsPitchNamesMap [kG_SesquiFlat_QTP]  = "geseh";
-  gNederlandsPitchNamesMap [kG_Flat_QTP]        = "ges";
-  gNederlandsPitchNamesMap [kG_SemiFlat_QTP]    = "geh";
-  gNederlandsPitchNamesMap [kG_Natural_QTP]     = "g";
-  gNederlandsPitchNamesMap [kG_SemiSharp_QTP]   = "gih";
-  gNederlandsPitchNamesMap [kG_Sharp_QTP]       = "gis";
-  gNederlandsPitchNamesMap [kG_SesquiSharp_QTP] = "gisih";
-  gNederlandsPitchNamesMap [kG_DoubleSharp_QTP] = "gisis";
+    "",       "beses",  "beseh",  "bes",    "beh",
+    "b",
+    "bih",    "bis",    "bisih",  "bisis",  "",
+
+    "",       "ceses",  "ceseh",  "ces",    "ceh",
+    "c",
+    "cih",    "cis",    "cisih",  "cisis",  "",
+
+    "",       "deses",  "deseh",  "des",    "deh",
+    "d",
+    "dih",    "dis",    "disih",  "disis",  "",
+
+    "",       "eeses",  "eeseh",  "ees",    "eeh",
+    "e",
+    "eih",    "eis",    "eisih",  "eisis",  "",
+
+    "",       "feses",  "feseh",  "fes",    "feh",
+    "f",
+    "fih",    "fis",    "fisih",  "fisis",  "",
+
+    "",       "geses",  "geseh",  "ges",    "geh",
+    "g",
+    "gih",    "gis",    "gisih",  "gisis",  ""
+  },
 
   // catalan
-  gCatalanPitchNamesMap [k_NoQuarterTonesPitch_QTP]  = "";
-  gCatalanPitchNamesMap [k_Rest_QTP]                 = "r";
-  
-  gCatalanPitchNamesMap [kA_DoubleFlat_QTP]  = "labb";
-  gCatalanPitchNamesMap [kA_SesquiFlat_QTP]  = "labSesquiFlat???";
-  gCatalanPitchNamesMap [kA_Flat_QTP]        = "lab";
-  gCatalanPitchNamesMap [kA_SemiFlat_QTP]    = "aSemiFlat???";
-  gCatalanPitchNamesMap [kA_Natural_QTP]     = "la";
-  gCatalanPitchNamesMap [kA_SemiSharp_QTP]   = "aSemiSharp???";
-  gCatalanPitchNamesMap [kA_Sharp_QTP]       = "lad";
-  gCatalanPitchNamesMap [kA_SesquiSharp_QTP] = "laSesquiSharp???";
-  gCatalanPitchNamesMap [kA_DoubleSharp_QTP] = "ladd";
-    
-  gCatalanPitchNamesMap [kB_DoubleFlat_QTP]  = "sibb";
-  gCatalanPitchNamesMap [kB_SesquiFlat_QTP]  = "sibSesquiFlat???";
-  gCatalanPitchNamesMap [kB_Flat_QTP]        = "sib";
-  gCatalanPitchNamesMap [kB_SemiFlat_QTP]    = "bSemiFlat???";
-  gCatalanPitchNamesMap [kB_Natural_QTP]     = "b";
-  gCatalanPitchNamesMap [kB_SemiSharp_QTP]   = "bSemiSharp???";
-  gCatalanPitchNamesMap [kB_Sharp_QTP]       = "sid";
-  gCatalanPitchNamesMap [kB_SesquiSharp_QTP] = "siSesquiSharp???";
-  gCatalanPitchNamesMap [kB_DoubleSharp_QTP] = "sidd";
-    
-  gCatalanPitchNamesMap [kC_DoubleFlat_QTP]  = "dobb";
-  gCatalanPitchNamesMap [kC_SesquiFlat_QTP]  = "doSesquiFlat???";
-  gCatalanPitchNamesMap [kC_Flat_QTP]        = "dob";
-  gCatalanPitchNamesMap [kC_SemiFlat_QTP]    = "cSemiFlat???";
-  gCatalanPitchNamesMap [kC_Natural_QTP]     = "do";
-  gCatalanPitchNamesMap [kC_SemiSharp_QTP]   = "cSemiSharp???";
-  gCatalanPitchNamesMap [kC_Sharp_QTP]       = "dod";
-  gCatalanPitchNamesMap [kC_SesquiSharp_QTP] = "doSesquiSharp???";
-  gCatalanPitchNamesMap [kC_DoubleSharp_QTP] = "dodd";
-    
-  gCatalanPitchNamesMap [kD_DoubleFlat_QTP]  = "rebb";
-  gCatalanPitchNamesMap [kD_SesquiFlat_QTP]  = "reSesquiFlat???";
-  gCatalanPitchNamesMap [kD_Flat_QTP]        = "reb";
-  gCatalanPitchNamesMap [kD_SemiFlat_QTP]    = "dSemiFlat???";
-  gCatalanPitchNamesMap [kD_Natural_QTP]     = "re";
-  gCatalanPitchNamesMap [kD_SemiSharp_QTP]   = "dSemiSharp???";
-  gCatalanPitchNamesMap [kD_Sharp_QTP]       = "red";
-  gCatalanPitchNamesMap [kD_SesquiSharp_QTP] = "reSesquiSharp???";
-  gCatalanPitchNamesMap [kD_DoubleSharp_QTP] = "redd";
-
-  gCatalanPitchNamesMap [kE_DoubleFlat_QTP]  = "mibb";
-  gCatalanPitchNamesMap [kE_SesquiFlat_QTP]  = "miSesquiFlat???";
-  gCatalanPitchNamesMap [kE_Flat_QTP]        = "mib";
-  gCatalanPitchNamesMap [kE_SemiFlat_QTP]    = "eSemiFlat???";
-  gCatalanPitchNamesMap [kE_Natural_QTP]     = "mi";
-  gCatalanPitchNamesMap [kE_SemiSharp_QTP]   = "eSemiSharp???";
-  gCatalanPitchNamesMap [kE_Sharp_QTP]       = "mid";
-  gCatalanPitchNamesMap [kE_SesquiSharp_QTP] = "miSesquiSharp???";
-  gCatalanPitchNamesMap [kE_DoubleSharp_QTP] = "midd";
-    
-  gCatalanPitchNamesMap [kF_DoubleFlat_QTP]  = "fabb";
-  gCatalanPitchNamesMap [kF_SesquiFlat_QTP]  = "faSesquiFlat???";
-  gCatalanPitchNamesMap [kF_Flat_QTP]        = "fab";
-  gCatalanPitchNamesMap [kF_SemiFlat_QTP]    = "fSemiFlat???";
-  gCatalanPitchNamesMap [kF_Natural_QTP]     = "fa";
-  gCatalanPitchNamesMap [kF_SemiSharp_QTP]   = "fSemiSharp???";
-  gCatalanPitchNamesMap [kF_Sharp_QTP]       = "fad";
-  gCatalanPitchNamesMap [kF_SesquiSharp_QTP] = "faSesquiSharp???";
-  gCatalanPitchNamesMap [kF_DoubleSharp_QTP] = "fadd";
-    
-  gCatalanPitchNamesMap [kG_DoubleFlat_QTP]  = "solbb";
-  gCatalanPitchNamesMap [kG_SesquiFlat_QTP]  = "solSesquiFlat???";
-  gCatalanPitchNamesMap [kG_Flat_QTP]        = "solb";
-  gCatalanPitchNamesMap [kG_SemiFlat_QTP]    = "gSemiFlat???";
-  gCatalanPitchNamesMap [kG_Natural_QTP]     = "sol";
-  gCatalanPitchNamesMap [kG_SemiSharp_QTP]   = "gSemiSharp???";
-  gCatalanPitchNamesMap [kG_Sharp_QTP]       = "sold";
-  gCatalanPitchNamesMap [kG_SesquiSharp_QTP] = "solSesquiSharp???";
-  gCatalanPitchNamesMap [kG_DoubleSharp_QTP] = "soldd";
+  {
+    "", "r",
+
+    "",                  "labb",              "labSesquiFlat???",  "lab",               "aSemiFlat???",
+    "la",
+    "aSemiSharp???",     "lad",               "laSesquiSharp???",  "ladd",              "",
+
+    "",                  "sibb",              "sibSesquiFlat???",  "sib",               "bSemiFlat???",
+    "b",
+    "bSemiSharp???",     "sid",               "siSesquiSharp???",  "sidd",              "",
+
+    "",                  "dobb",              "doSesquiFlat???",   "dob",               "cSemiFlat???",
+    "do",
+    "cSemiSharp???",     "dod",               "doSesquiSharp???",  "dodd",              "",
+
+    "",                  "rebb",              "reSesquiFlat???",   "reb",               "dSemiFlat???",
+    "re",
+    "dSemiSharp???",     "red",               "reSesquiSharp???",  "redd",              "",
+
+    "",                  "mibb",              "miSesquiFlat???",   "mib",               "eSemiFlat???",
+    "mi",
+    "eSemiSharp???",     "mid",               "miSesquiSharp???",  "midd",              "",
+
+    "",                  "fabb",              "faSesquiFlat???",   "fab",               "fSemiFlat???",
+    "fa",
+    "fSemiSharp???",     "fad",               "faSesquiSharp???",  "fadd",              "",
+
+    "",                   "solbb",              "solSesquiFlat???",   "solb",               "gSemiFlat???",
+    "sol",
+    "gSemiSharp???",      "sold",               "solSesquiSharp???",  "soldd",              ""
+  },
 
   // deutsch
-  gDeutschPitchNamesMap [k_NoQuarterTonesPitch_QTP]  = "";
-  gDeutschPitchNamesMap [k_Rest_QTP]                 = "r";
-  
-  gDeutschPitchNamesMap [kA_DoubleFlat_QTP]  = "asas";
-  gDeutschPitchNamesMap [kA_SesquiFlat_QTP]  = "asah";
-  gDeutschPitchNamesMap [kA_Flat_QTP]        = "as";
-  gDeutschPitchNamesMap [kA_SemiFlat_QTP]    = "aeh";
-  gDeutschPitchNamesMap [kA_Natural_QTP]     = "a";
-  gDeutschPitchNamesMap [kA_SemiSharp_QTP]   = "aih";
-  gDeutschPitchNamesMap [kA_Sharp_QTP]       = "ais";
-  gDeutschPitchNamesMap [kA_SesquiSharp_QTP] = "aisih";
-  gDeutschPitchNamesMap [kA_DoubleSharp_QTP] = "aisis";
-    
-  gDeutschPitchNamesMap [kB_DoubleFlat_QTP]  = "heses";
-  gDeutschPitchNamesMap [kB_SesquiFlat_QTP]  = "heseh";
-  gDeutschPitchNamesMap [kB_Flat_QTP]        = "b";
-  gDeutschPitchNamesMap [kB_SemiFlat_QTP]    = "beh";
-  gDeutschPitchNamesMap [kB_Natural_QTP]     = "h";
-  gDeutschPitchNamesMap [kB_SemiSharp_QTP]   = "hih";
-  gDeutschPitchNamesMap [kB_Sharp_QTP]       = "his";
-  gDeutschPitchNamesMap [kB_SesquiSharp_QTP] = "hisih";
-  gDeutschPitchNamesMap [kB_DoubleSharp_QTP] = "hisis";
-    
-  gDeutschPitchNamesMap [kC_DoubleFlat_QTP]  = "ceses";
-  gDeutschPitchNamesMap [kC_SesquiFlat_QTP]  = "ceseh";
-  gDeutschPitchNamesMap [kC_Flat_QTP]        = "ces";
-  gDeutschPitchNamesMap [kC_SemiFlat_QTP]    = "ceh";
-  gDeutschPitchNamesMap [kC_Natural_QTP]     = "c";
-  gDeutschPitchNamesMap [kC_SemiSharp_QTP]   = "cih";
-  gDeutschPitchNamesMap [kC_Sharp_QTP]       = "cis";
-  gDeutschPitchNamesMap [kC_SesquiSharp_QTP] = "cisih";
-  gDeutschPitchNamesMap [kC_DoubleSharp_QTP] = "cisis";
-    
-  gDeutschPitchNamesMap [kD_DoubleFlat_QTP]  = "deses";
-  gDeutschPitchNamesMap [kD_SesquiFlat_QTP]  = "deseh";
-  gDeutschPitchNamesMap [kD_Flat_QTP]        = "des";
-  gDeutschPitchNamesMap [kD_SemiFlat_QTP]    = "deh";
-  gDeutschPitchNamesMap [kD_Natural_QTP]     = "d";
-  gDeutschPitchNamesMap [kD_SemiSharp_QTP]   = "dih";
-  gDeutschPitchNamesMap [kD_Sharp_QTP]       = "dis";
-  gDeutschPitchNamesMap [kD_SesquiSharp_QTP] = "disih";
-  gDeutschPitchNamesMap [kD_DoubleSharp_QTP] = "disis";
-
-  gDeutschPitchNamesMap [kE_DoubleFlat_QTP]  = "eses";
-  gDeutschPitchNamesMap [kE_SesquiFlat_QTP]  = "esseh";
-  gDeutschPitchNamesMap [kE_Flat_QTP]        = "es";
-  gDeutschPitchNamesMap [kE_SemiFlat_QTP]    = "eeh";
-  gDeutschPitchNamesMap [kE_Natural_QTP]     = "e";
-  gDeutschPitchNamesMap [kE_SemiSharp_QTP]   = "eih";
-  gDeutschPitchNamesMap [kE_Sharp_QTP]       = "eis";
-  gDeutschPitchNamesMap [kE_SesquiSharp_QTP] = "eisih";
-  gDeutschPitchNamesMap [kE_DoubleSharp_QTP] = "eisis";
-    
-  gDeutschPitchNamesMap [kF_DoubleFlat_QTP]  = "feses";
-  gDeutschPitchNamesMap [kF_SesquiFlat_QTP]  = "feseh";
-  gDeutschPitchNamesMap [kF_Flat_QTP]        = "fes";
-  gDeutschPitchNamesMap [kF_SemiFlat_QTP]    = "feh";
-  gDeutschPitchNamesMap [kF_Natural_QTP]     = "f";
-  gDeutschPitchNamesMap [kF_SemiSharp_QTP]   = "fih";
-  gDeutschPitchNamesMap [kF_Sharp_QTP]       = "fis";
-  gDeutschPitchNamesMap [kF_SesquiSharp_QTP] = "fisih";
-  gDeutschPitchNamesMap [kF_DoubleSharp_QTP] = "fisis";
-    
-  gDeutschPitchNamesMap [kG_DoubleFlat_QTP]  = "geses";
-  gDeutschPitchNamesMap [kG_SesquiFlat_QTP]  = "geseh";
-  gDeutschPitchNamesMap [kG_Flat_QTP]        = "ges";
-  gDeutschPitchNamesMap [kG_SemiFlat_QTP]    = "geh";
-  gDeutschPitchNamesMap [kG_Natural_QTP]     = "g";
-  gDeutschPitchNamesMap [kG_SemiSharp_QTP]   = "gih";
-  gDeutschPitchNamesMap [kG_Sharp_QTP]       = "gis";
-  gDeutschPitchNamesMap [kG_SesquiSharp_QTP] = "gisih";
-  gDeutschPitchNamesMap [kG_DoubleSharp_QTP] = "gisis";
+  {
+    "", "r",
+
+    "",       "asas",   "asah",   "as",     "aeh",
+    "a",
+    "aih",    "ais",    "aisih",  "aisis",  "",
+
+    "",       "heses",  "heseh",  "b",      "beh",
+    "h",
+    "hih",    "his",    "hisih",  "hisis",  "",
+
+    "",       "ceses",  "ceseh",  "ces",    "ceh",
+    "c",
+    "cih",    "cis",    "cisih",  "cisis",  "",
+
+    "",       "deses",  "deseh",  "des",    "deh",
+    "d",
+    "dih",    "dis",    "disih",  "disis",  "",
+
+    "",       "eses",   "esseh",  "es",     "eeh",
+    "e",
+    "eih",    "eis",    "eisih",  "eisis",  "",
+
+    "",       "feses",  "feseh",  "fes",    "feh",
+    "f",
+    "fih",    "fis",    "fisih",  "fisis",  "",
+
+    "",       "geses",  "geseh",  "ges",    "geh",
+    "g",
+    "gih",    "gis",    "gisih",  "gisis",  ""
+  },
 
   // english
-  gEnglishPitchNamesMap [k_NoQuarterTonesPitch_QTP]  = "";
-  gEnglishPitchNamesMap [k_Rest_QTP]                 = "r";
-  
-  gEnglishPitchNamesMap [kA_DoubleFlat_QTP]  = "aff";
-  gEnglishPitchNamesMap [kA_SesquiFlat_QTP]  = "atqf";
-  gEnglishPitchNamesMap [kA_Flat_QTP]        = "af";
-  gEnglishPitchNamesMap [kA_SemiFlat_QTP]    = "aqf";
-  gEnglishPitchNamesMap [kA_Natural_QTP]     = "a";
-  gEnglishPitchNamesMap [kA_SemiSharp_QTP]   = "aqs";
-  gEnglishPitchNamesMap [kA_Sharp_QTP]       = "as";
-  gEnglishPitchNamesMap [kA_SesquiSharp_QTP] = "atqs";
-  gEnglishPitchNamesMap [kA_DoubleSharp_QTP] = "a";
-    
-  gEnglishPitchNamesMap [kB_DoubleFlat_QTP]  = "bfqf";
-  gEnglishPitchNamesMap [kB_SesquiFlat_QTP]  = "btqf";
-  gEnglishPitchNamesMap [kB_Flat_QTP]        = "bf";
-  gEnglishPitchNamesMap [kB_SemiFlat_QTP]    = "bqf";
-  gEnglishPitchNamesMap [kB_Natural_QTP]     = "b";
-  gEnglishPitchNamesMap [kB_SemiSharp_QTP]   = "bqs";
-  gEnglishPitchNamesMap [kB_Sharp_QTP]       = "bs";
-  gEnglishPitchNamesMap [kB_SesquiSharp_QTP] = "btqs";
-  gEnglishPitchNamesMap [kB_DoubleSharp_QTP] = "bx";
-    
-  gEnglishPitchNamesMap [kC_DoubleFlat_QTP]  = "cff";
-  gEnglishPitchNamesMap [kC_SesquiFlat_QTP]  = "ctqf";
-  gEnglishPitchNamesMap [kC_Flat_QTP]        = "cf";
-  gEnglishPitchNamesMap [kC_SemiFlat_QTP]    = "cqf";
-  gEnglishPitchNamesMap [kC_Natural_QTP]     = "c";
-  gEnglishPitchNamesMap [kC_SemiSharp_QTP]   = "cqs";
-  gEnglishPitchNamesMap [kC_Sharp_QTP]       = "cs";
-  gEnglishPitchNamesMap [kC_SesquiSharp_QTP] = "ctqs";
-  gEnglishPitchNamesMap [kC_DoubleSharp_QTP] = "cx";
-    
-  gEnglishPitchNamesMap [kD_DoubleFlat_QTP]  = "dff";
-  gEnglishPitchNamesMap [kD_SesquiFlat_QTP]  = "dtqf";
-  gEnglishPitchNamesMap [kD_Flat_QTP]        = "df";
-  gEnglishPitchNamesMap [kD_SemiFlat_QTP]    = "dqf";
-  gEnglishPitchNamesMap [kD_Natural_QTP]     = "d";
-  gEnglishPitchNamesMap [kD_SemiSharp_QTP]   = "dqs";
-  gEnglishPitchNamesMap [kD_Sharp_QTP]       = "ds";
-  gEnglishPitchNamesMap [kD_SesquiSharp_QTP] = "dtqs";
-  gEnglishPitchNamesMap [kD_DoubleSharp_QTP] = "dx";
-
-  gEnglishPitchNamesMap [kE_DoubleFlat_QTP]  = "eff";
-  gEnglishPitchNamesMap [kE_SesquiFlat_QTP]  = "etqf";
-  gEnglishPitchNamesMap [kE_Flat_QTP]        = "ef";
-  gEnglishPitchNamesMap [kE_SemiFlat_QTP]    = "eqf";
-  gEnglishPitchNamesMap [kE_Natural_QTP]     = "e";
-  gEnglishPitchNamesMap [kE_SemiSharp_QTP]   = "eqs";
-  gEnglishPitchNamesMap [kE_Sharp_QTP]       = "es";
-  gEnglishPitchNamesMap [kE_SesquiSharp_QTP] = "etqs";
-  gEnglishPitchNamesMap [kE_DoubleSharp_QTP] = "ex";
-    
-  gEnglishPitchNamesMap [kF_DoubleFlat_QTP]  = "fff";
-  gEnglishPitchNamesMap [kF_SesquiFlat_QTP]  = "ftqf";
-  gEnglishPitchNamesMap [kF_Flat_QTP]        = "ff";
-  gEnglishPitchNamesMap [kF_SemiFlat_QTP]    = "fqf";
-  gEnglishPitchNamesMap [kF_Natural_QTP]     = "f";
-  gEnglishPitchNamesMap [kF_SemiSharp_QTP]   = "fqs";
-  gEnglishPitchNamesMap [kF_Sharp_QTP]       = "fs";
-  gEnglishPitchNamesMap [kF_SesquiSharp_QTP] = "ftqs";
-  gEnglishPitchNamesMap [kF_DoubleSharp_QTP] = "fx";
-    
-  gEnglishPitchNamesMap [kG_DoubleFlat_QTP]  = "gff";
-  gEnglishPitchNamesMap [kG_SesquiFlat_QTP]  = "gtqf";
-  gEnglishPitchNamesMap [kG_Flat_QTP]        = "gf";
-  gEnglishPitchNamesMap [kG_SemiFlat_QTP]    = "gqf";
-  gEnglishPitchNamesMap [kG_Natural_QTP]     = "g";
-  gEnglishPitchNamesMap [kG_SemiSharp_QTP]   = "gqs";
-  gEnglishPitchNamesMap [kG_Sharp_QTP]       = "gs";
-  gEnglishPitchNamesMap [kG_SesquiSharp_QTP] = "gtqs";
-  gEnglishPitchNamesMap [kG_DoubleSharp_QTP] = "gx";
+  {
+    "", "r",
+
+    "",      "aff",   "atqf",  "af",    "aqf",
+    "a",
+    "aqs",   "as",    "atqs",  "a",     "",
+
+    "",      "bfqf",  "btqf",  "bf",    "bqf",
+    "b",
+    "bqs",   "bs",    "btqs",  "bx",    "",
+
+    "",      "cff",   "ctqf",  "cf",    "cqf",
+    "c",
+    "cqs",   "cs",    "ctqs",  "cx",    "",
+
+    "",      "dff",   "dtqf",  "df",    "dqf",
+    "d",
+    "dqs",   "ds",    "dtqs",  "dx",    "",
+
+    "",      "eff",   "etqf",  "ef",    "eqf",
+    "e",
+    "eqs",   "es",    "etqs",  "ex",    "",
+
+    "",      "fff",   "ftqf",  "ff",    "fqf",
+    "f",
+    "fqs",   "fs",    "ftqs",  "fx",    "",
+
+    "",      "gff",   "gtqf",  "gf",    "gqf",
+    "g",
+    "gqs",   "gs",    "gtqs",  "gx",    ""
+  },
 
   // espanol
-  gEspanolPitchNamesMap [k_NoQuarterTonesPitch_QTP]  = "";
-  gEspanolPitchNamesMap [k_Rest_QTP]                 = "r";
-  
-  gEspanolPitchNamesMap [kA_DoubleFlat_QTP]  = "labb";
-  gEspanolPitchNamesMap [kA_SesquiFlat_QTP]  = "latcb";
-  gEspanolPitchNamesMap [kA_Flat_QTP]        = "lab";
-  gEspanolPitchNamesMap [kA_SemiFlat_QTP]    = "lacb";
-  gEspanolPitchNamesMap [kA_Natural_QTP]     = "la";
-  gEspanolPitchNamesMap [kA_SemiSharp_QTP]   = "lacs";
-  gEspanolPitchNamesMap [kA_Sharp_QTP]       = "las";
-  gEspanolPitchNamesMap [kA_SesquiSharp_QTP] = "latcs";
-  gEspanolPitchNamesMap [kA_DoubleSharp_QTP] = "lax";
-    
-  gEspanolPitchNamesMap [kB_DoubleFlat_QTP]  = "sibb";
-  gEspanolPitchNamesMap [kB_SesquiFlat_QTP]  = "sitcb";
-  gEspanolPitchNamesMap [kB_Flat_QTP]        = "sib";
-  gEspanolPitchNamesMap [kB_SemiFlat_QTP]    = "sicb";
-  gEspanolPitchNamesMap [kB_Natural_QTP]     = "si";
-  gEspanolPitchNamesMap [kB_SemiSharp_QTP]   = "sics";
-  gEspanolPitchNamesMap [kB_Sharp_QTP]       = "sis";
-  gEspanolPitchNamesMap [kB_SesquiSharp_QTP] = "sitcs";
-  gEspanolPitchNamesMap [kB_DoubleSharp_QTP] = "six";
-    
-  gEspanolPitchNamesMap [kC_DoubleFlat_QTP]  = "dobb";
-  gEspanolPitchNamesMap [kC_SesquiFlat_QTP]  = "dotcb";
-  gEspanolPitchNamesMap [kC_Flat_QTP]        = "dob";
-  gEspanolPitchNamesMap [kC_SemiFlat_QTP]    = "docb";
-  gEspanolPitchNamesMap [kC_Natural_QTP]     = "do";
-  gEspanolPitchNamesMap [kC_SemiSharp_QTP]   = "docs";
-  gEspanolPitchNamesMap [kC_Sharp_QTP]       = "dos";
-  gEspanolPitchNamesMap [kC_SesquiSharp_QTP] = "dotcs";
-  gEspanolPitchNamesMap [kC_DoubleSharp_QTP] = "dox";
-    
-  gEspanolPitchNamesMap [kD_DoubleFlat_QTP]  = "rebb";
-  gEspanolPitchNamesMap [kD_SesquiFlat_QTP]  = "retcb";
-  gEspanolPitchNamesMap [kD_Flat_QTP]        = "reb";
-  gEspanolPitchNamesMap [kD_SemiFlat_QTP]    = "recb";
-  gEspanolPitchNamesMap [kD_Natural_QTP]     = "re";
-  gEspanolPitchNamesMap [kD_SemiSharp_QTP]   = "recs";
-  gEspanolPitchNamesMap [kD_Sharp_QTP]       = "res";
-  gEspanolPitchNamesMap [kD_SesquiSharp_QTP] = "retcs";
-  gEspanolPitchNamesMap [kD_DoubleSharp_QTP] = "rex";
-
-  gEspanolPitchNamesMap [kE_DoubleFlat_QTP]  = "mibb";
-  gEspanolPitchNamesMap [kE_SesquiFlat_QTP]  = "mitcb";
-  gEspanolPitchNamesMap [kE_Flat_QTP]        = "mib";
-  gEspanolPitchNamesMap [kE_SemiFlat_QTP]    = "micb";
-  gEspanolPitchNamesMap [kE_Natural_QTP]     = "mi";
-  gEspanolPitchNamesMap [kE_SemiSharp_QTP]   = "mics";
-  gEspanolPitchNamesMap [kE_Sharp_QTP]       = "mis";
-  gEspanolPitchNamesMap [kE_SesquiSharp_QTP] = "mitcs";
-  gEspanolPitchNamesMap [kE_DoubleSharp_QTP] = "mix";
-    
-  gEspanolPitchNamesMap [kF_DoubleFlat_QTP]  = "fabb";
-  gEspanolPitchNamesMap [kF_SesquiFlat_QTP]  = "fatcb";
-  gEspanolPitchNamesMap [kF_Flat_QTP]        = "fab";
-  gEspanolPitchNamesMap [kF_SemiFlat_QTP]    = "facb";
-  gEspanolPitchNamesMap [kF_Natural_QTP]     = "fa";
-  gEspanolPitchNamesMap [kF_SemiSharp_QTP]   = "facs";
-  gEspanolPitchNamesMap [kF_Sharp_QTP]       = "fas";
-  gEspanolPitchNamesMap [kF_SesquiSharp_QTP] = "fatcs";
-  gEspanolPitchNamesMap [kF_DoubleSharp_QTP] = "fax";
-    
-  gEspanolPitchNamesMap [kG_DoubleFlat_QTP]  = "solbb";
-  gEspanolPitchNamesMap [kG_SesquiFlat_QTP]  = "soltcb";
-  gEspanolPitchNamesMap [kG_Flat_QTP]        = "solb";
-  gEspanolPitchNamesMap [kG_SemiFlat_QTP]    = "solcb";
-  gEspanolPitchNamesMap [kG_Natural_QTP]     = "sol";
-  gEspanolPitchNamesMap [kG_SemiSharp_QTP]   = "solcs";
-  gEspanolPitchNamesMap [kG_Sharp_QTP]       = "sols";
-  gEspanolPitchNamesMap [kG_SesquiSharp_QTP] = "soltcs";
-  gEspanolPitchNamesMap [kG_DoubleSharp_QTP] = "solx";
+  {
+    "", "r",
+
+    "",       "labb",   "latcb",  "lab",    "lacb",
+    "la",
+    "lacs",   "las",    "latcs",  "lax",    "",
+
+    "",       "sibb",   "sitcb",  "sib",    "sicb",
+    "si",
+    "sics",   "sis",    "sitcs",  "six",    "",
+
+    "",       "dobb",   "dotcb",  "dob",    "docb",
+    "do",
+    "docs",   "dos",    "dotcs",  "dox",    "",
+
+    "",       "rebb",   "retcb",  "reb",    "recb",
+    "re",
+    "recs",   "res",    "retcs",  "rex",    "",
+
+    "",       "mibb",   "mitcb",  "mib",    "micb",
+    "mi",
+    "mics",   "mis",    "mitcs",  "mix",    "",
+
+    "",       "fabb",   "fatcb",  "fab",    "facb",
+    "fa",
+    "facs",   "fas",    "fatcs",  "fax",    "",
+
+    "",        "solbb",   "soltcb",  "solb",    "solcb",
+    "sol",
+    "solcs",   "sols",    "soltcs",  "solx",    ""
+  },
 
   // francais
-  gFrancaisPitchNamesMap [k_NoQuarterTonesPitch_QTP]  = "";
-  gFrancaisPitchNamesMap [k_Rest_QTP]                 = "r";
-  
-  gFrancaisPitchNamesMap [kA_DoubleFlat_QTP]  = "labb";
-  gFrancaisPitchNamesMap [kA_SesquiFlat_QTP]  = "labtqt";
-  gFrancaisPitchNamesMap [kA_Flat_QTP]        = "lab";
-  gFrancaisPitchNamesMap [kA_SemiFlat_QTP]    = "labqt";
-  gFrancaisPitchNamesMap [kA_Natural_QTP]     = "la";
-  gFrancaisPitchNamesMap [kA_SemiSharp_QTP]   = "lasqt";
-  gFrancaisPitchNamesMap [kA_Sharp_QTP]       = "lad";
-  gFrancaisPitchNamesMap [kA_SesquiSharp_QTP] = "lastqt";
-  gFrancaisPitchNamesMap [kA_DoubleSharp_QTP] = "lass";
-    
-  gFrancaisPitchNamesMap [kB_DoubleFlat_QTP]  = "sibb";
-  gFrancaisPitchNamesMap [kB_SesquiFlat_QTP]  = "sibtqt";
-  gFrancaisPitchNamesMap [kB_Flat_QTP]        = "sib";
-  gFrancaisPitchNamesMap [kB_SemiFlat_QTP]    = "sibqt";
-  gFrancaisPitchNamesMap [kB_Natural_QTP]     = "si";
-  gFrancaisPitchNamesMap [kB_SemiSharp_QTP]   = "sisqt";
-  gFrancaisPitchNamesMap [kB_Sharp_QTP]       = "sid";
-  gFrancaisPitchNamesMap [kB_SesquiSharp_QTP] = "sistqt";
-  gFrancaisPitchNamesMap [kB_DoubleSharp_QTP] = "siss";
-    
-  gFrancaisPitchNamesMap [kC_DoubleFlat_QTP]  = "dobb";
-  gFrancaisPitchNamesMap [kC_SesquiFlat_QTP]  = "dobtqt";
-  gFrancaisPitchNamesMap [kC_Flat_QTP]        = "dob";
-  gFrancaisPitchNamesMap [kC_SemiFlat_QTP]    = "dobqt";
-  gFrancaisPitchNamesMap [kC_Natural_QTP]     = "do";
-  gFrancaisPitchNamesMap [kC_SemiSharp_QTP]   = "dosqt";
-  gFrancaisPitchNamesMap [kC_Sharp_QTP]       = "dod";
-  gFrancaisPitchNamesMap [kC_SesquiSharp_QTP] = "dostqt";
-  gFrancaisPitchNamesMap [kC_DoubleSharp_QTP] = "doss";
-    
-  gFrancaisPitchNamesMap [kD_DoubleFlat_QTP]  = "rebb";
-  gFrancaisPitchNamesMap [kD_SesquiFlat_QTP]  = "rebtqt";
-  gFrancaisPitchNamesMap [kD_Flat_QTP]        = "reb";
-  gFrancaisPitchNamesMap [kD_SemiFlat_QTP]    = "rebqt";
-  gFrancaisPitchNamesMap [kD_Natural_QTP]     = "re";
-  gFrancaisPitchNamesMap [kD_SemiSharp_QTP]   = "resqt";
-  gFrancaisPitchNamesMap [kD_Sharp_QTP]       = "red";
-  gFrancaisPitchNamesMap [kD_SesquiSharp_QTP] = "restqt";
-  gFrancaisPitchNamesMap [kD_DoubleSharp_QTP] = "ress";
-
-  gFrancaisPitchNamesMap [kE_DoubleFlat_QTP]  = "mibb";
-  gFrancaisPitchNamesMap [kE_SesquiFlat_QTP]  = "mibtqt";
-  gFrancaisPitchNamesMap [kE_Flat_QTP]        = "mib";
-  gFrancaisPitchNamesMap [kE_SemiFlat_QTP]    = "mibqt";
-  gFrancaisPitchNamesMap [kE_Natural_QTP]     = "mi";
-  gFrancaisPitchNamesMap [kE_SemiSharp_QTP]   = "misqt";
-  gFrancaisPitchNamesMap [kE_Sharp_QTP]       = "mid";
-  gFrancaisPitchNamesMap [kE_SesquiSharp_QTP] = "mistqt";
-  gFrancaisPitchNamesMap [kE_DoubleSharp_QTP] = "miss";
-    
-  gFrancaisPitchNamesMap [kF_DoubleFlat_QTP]  = "fabb";
-  gFrancaisPitchNamesMap [kF_SesquiFlat_QTP]  = "fabtqt";
-  gFrancaisPitchNamesMap [kF_Flat_QTP]        = "fab";
-  gFrancaisPitchNamesMap [kF_SemiFlat_QTP]    = "fabqt";
-  gFrancaisPitchNamesMap [kF_Natural_QTP]     = "fa";
-  gFrancaisPitchNamesMap [kF_SemiSharp_QTP]   = "fasqt";
-  gFrancaisPitchNamesMap [kF_Sharp_QTP]       = "fad";
-  gFrancaisPitchNamesMap [kF_SesquiSharp_QTP] = "fastqt";
-  gFrancaisPitchNamesMap [kF_DoubleSharp_QTP] = "fass";
-    
-  gFrancaisPitchNamesMap [kG_DoubleFlat_QTP]  = "solbb";
-  gFrancaisPitchNamesMap [kG_SesquiFlat_QTP]  = "solbtqt";
-  gFrancaisPitchNamesMap [kG_Flat_QTP]        = "solb";
-  gFrancaisPitchNamesMap [kG_SemiFlat_QTP]    = "solbqt";
-  gFrancaisPitchNamesMap [kG_Natural_QTP]     = "sol";
-  gFrancaisPitchNamesMap [kG_SemiSharp_QTP]   = "solsqt";
-  gFrancaisPitchNamesMap [kG_Sharp_QTP]       = "sold";
-  gFrancaisPitchNamesMap [kG_SesquiSharp_QTP] = "solstqt";
-  gFrancaisPitchNamesMap [kG_DoubleSharp_QTP] = "solss";
+  {
+    "", "r",
+
+    "",        "labb",    "labtqt",  "lab",     "labqt",
+    "la",
+    "lasqt",   "lad",     "lastqt",  "lass",    "",
+
+    "",        "sibb",    "sibtqt",  "sib",     "sibqt",
+    "si",
+    "sisqt",   "sid",     "sistqt",  "siss",    "",
+
+    "",        "dobb",    "dobtqt",  "dob",     "dobqt",
+    "do",
+    "dosqt",   "dod",     "dostqt",  "doss",    "",
+
+    "",        "rebb",    "rebtqt",  "reb",     "rebqt",
+    "re",
+    "resqt",   "red",     "restqt",  "ress",    "",
+
+    "",        "mibb",    "mibtqt",  "mib",     "mibqt",
+    "mi",
+    "misqt",   "mid",     "mistqt",  "miss",    "",
+
+    "",        "fabb",    "fabtqt",  "fab",     "fabqt",
+    "fa",
+    "fasqt",   "fad",     "fastqt",  "fass",    "",
+
+    "",         "solbb",    "solbtqt",  "solb",     "solbqt",
+    "sol",
+    "solsqt",   "sold",     "solstqt",  "solss",    ""
+  },
 
   // italiano
-  gItalianoPitchNamesMap [k_NoQuarterTonesPitch_QTP]  = "";
-  gItalianoPitchNamesMap [k_Rest_QTP]                 = "r";
-  
-  gItalianoPitchNamesMap [kA_DoubleFlat_QTP]  = "labb";
-  gItalianoPitchNamesMap [kA_SesquiFlat_QTP]  = "labsb";
-  gItalianoPitchNamesMap [kA_Flat_QTP]        = "lab";
-  gItalianoPitchNamesMap [kA_SemiFlat_QTP]    = "lasb";
-  gItalianoPitchNamesMap [kA_Natural_QTP]     = "la";
-  gItalianoPitchNamesMap [kA_SemiSharp_QTP]   = "lasd";
-  gItalianoPitchNamesMap [kA_Sharp_QTP]       = "lad";
-  gItalianoPitchNamesMap [kA_SesquiSharp_QTP] = "ladsd";
-  gItalianoPitchNamesMap [kA_DoubleSharp_QTP] = "ladd";
-    
-  gItalianoPitchNamesMap [kB_DoubleFlat_QTP]  = "sibb";
-  gItalianoPitchNamesMap [kB_SesquiFlat_QTP]  = "sibsb";
-  gItalianoPitchNamesMap [kB_Flat_QTP]        = "sib";
-  gItalianoPitchNamesMap [kB_SemiFlat_QTP]    = "sisb";
-  gItalianoPitchNamesMap [kB_Natural_QTP]     = "si";
-  gItalianoPitchNamesMap [kB_SemiSharp_QTP]   = "sisd";
-  gItalianoPitchNamesMap [kB_Sharp_QTP]       = "sid";
-  gItalianoPitchNamesMap [kB_SesquiSharp_QTP] = "sidsd";
-  gItalianoPitchNamesMap [kB_DoubleSharp_QTP] = "sidd";
-    
-  gItalianoPitchNamesMap [kC_DoubleFlat_QTP]  = "dobb";
-  gItalianoPitchNamesMap [kC_SesquiFlat_QTP]  = "dobsb";
-  gItalianoPitchNamesMap [kC_Flat_QTP]        = "dob";
-  gItalianoPitchNamesMap [kC_SemiFlat_QTP]    = "dosb";
-  gItalianoPitchNamesMap [kC_Natural_QTP]     = "do";
-  gItalianoPitchNamesMap [kC_SemiSharp_QTP]   = "dosd";
-  gItalianoPitchNamesMap [kC_Sharp_QTP]       = "dod";
-  gItalianoPitchNamesMap [kC_SesquiSharp_QTP] = "dodsd";
-  gItalianoPitchNamesMap [kC_DoubleSharp_QTP] = "dodd";
-    
-  gItalianoPitchNamesMap [kD_DoubleFlat_QTP]  = "rebb";
-  gItalianoPitchNamesMap [kD_SesquiFlat_QTP]  = "rebsb";
-  gItalianoPitchNamesMap [kD_Flat_QTP]        = "reb";
-  gItalianoPitchNamesMap [kD_SemiFlat_QTP]    = "resb";
-  gItalianoPitchNamesMap [kD_Natural_QTP]     = "re";
-  gItalianoPitchNamesMap [kD_SemiSharp_QTP]   = "resd";
-  gItalianoPitchNamesMap [kD_Sharp_QTP]       = "red";
-  gItalianoPitchNamesMap [kD_SesquiSharp_QTP] = "redsd";
-  gItalianoPitchNamesMap [kD_DoubleSharp_QTP] = "redd";
-
-  gItalianoPitchNamesMap [kE_DoubleFlat_QTP]  = "mibb";
-  gItalianoPitchNamesMap [kE_SesquiFlat_QTP]  = "mibsb";
-  gItalianoPitchNamesMap [kE_Flat_QTP]        = "mib";
-  gItalianoPitchNamesMap [kE_SemiFlat_QTP]    = "misb";
-  gItalianoPitchNamesMap [kE_Natural_QTP]     = "mi";
-  gItalianoPitchNamesMap [kE_SemiSharp_QTP]   = "misd";
-  gItalianoPitchNamesMap [kE_Sharp_QTP]       = "mid";
-  gItalianoPitchNamesMap [kE_SesquiSharp_QTP] = "midsd";
-  gItalianoPitchNamesMap [kE_DoubleSharp_QTP] = "midd";
-    
-  gItalianoPitchNamesMap [kF_DoubleFlat_QTP]  = "fabb";
-  gItalianoPitchNamesMap [kF_SesquiFlat_QTP]  = "fabsb";
-  gItalianoPitchNamesMap [kF_Flat_QTP]        = "fab";
-  gItalianoPitchNamesMap [kF_SemiFlat_QTP]    = "fasb";
-  gItalianoPitchNamesMap [kF_Natural_QTP]     = "fa";
-  gItalianoPitchNamesMap [kF_SemiSharp_QTP]   = "fasd";
-  gItalianoPitchNamesMap [kF_Sharp_QTP]       = "fad";
-  gItalianoPitchNamesMap [kF_SesquiSharp_QTP] = "fadsd";
-  gItalianoPitchNamesMap [kF_DoubleSharp_QTP] = "fadd";
-    
-  gItalianoPitchNamesMap [kG_DoubleFlat_QTP]  = "solbb";
-  gItalianoPitchNamesMap [kG_SesquiFlat_QTP]  = "solbsb";
-  gItalianoPitchNamesMap [kG_Flat_QTP]        = "solb";
-  gItalianoPitchNamesMap [kG_SemiFlat_QTP]    = "solsb";
-  gItalianoPitchNamesMap [kG_Natural_QTP]     = "sol";
-  gItalianoPitchNamesMap [kG_SemiSharp_QTP]   = "solsd";
-  gItalianoPitchNamesMap [kG_Sharp_QTP]       = "sold";
-  gItalianoPitchNamesMap [kG_SesquiSharp_QTP] = "soldsd";
-  gItalianoPitchNamesMap [kG_DoubleSharp_QTP] = "soldd";
+  {
+    "", "r",
+
+    "",       "labb",   "labsb",  "lab",    "lasb",
+    "la",
+    "lasd",   "lad",    "ladsd",  "ladd",   "",
+
+    "",       "sibb",   "sibsb",  "sib",    "sisb",
+    "si",
+    "sisd",   "sid",    "sidsd",  "sidd",   "",
+
+    "",       "dobb",   "dobsb",  "dob",    "dosb",
+    "do",
+    "dosd",   "dod",    "dodsd",  "dodd",   "",
+
+    "",       "rebb",   "rebsb",  "reb",    "resb",
+    "re",
+    "resd",   "red",    "redsd",  "redd",   "",
+
+    "",       "mibb",   "mibsb",  "mib",    "misb",
+    "mi",
+    "misd",   "mid",    "midsd",  "midd",   "",
+
+    "",       "fabb",   "fabsb",  "fab",    "fasb",
+    "fa",
+    "fasd",   "fad",    "fadsd",  "fadd",   "",
+
+    "",        "solbb",   "solbsb",  "solb",    "solsb",
+    "sol",
+    "solsd",   "sold",    "soldsd",  "soldd",   ""
+  },
 
   // norsk
-  gNorskPitchNamesMap [k_NoQuarterTonesPitch_QTP]  = "";
-  gNorskPitchNamesMap [k_Rest_QTP]                 = "r";
-  
-  gNorskPitchNamesMap [kA_DoubleFlat_QTP]  = "aeses";
-  gNorskPitchNamesMap [kA_SesquiFlat_QTP]  = "aSesquiFlat???";
-  gNorskPitchNamesMap [kA_Flat_QTP]        = "aes";
-  gNorskPitchNamesMap [kA_SemiFlat_QTP]    = "aSemiFlat???";
-  gNorskPitchNamesMap [kA_Natural_QTP]     = "a";
-  gNorskPitchNamesMap [kA_SemiSharp_QTP]   = "aSemiSharp???";
-  gNorskPitchNamesMap [kA_Sharp_QTP]       = "ais";
-  gNorskPitchNamesMap [kA_SesquiSharp_QTP] = "aSesquiSharp???";
-  gNorskPitchNamesMap [kA_DoubleSharp_QTP] = "aisis";
-    
-  gNorskPitchNamesMap [kB_DoubleFlat_QTP]  = "beses";
-  gNorskPitchNamesMap [kB_SesquiFlat_QTP]  = "bSesquiFlat???";
-  gNorskPitchNamesMap [kB_Flat_QTP]        = "bes";
-  gNorskPitchNamesMap [kB_SemiFlat_QTP]    = "bSemiFlat???";
-  gNorskPitchNamesMap [kB_Natural_QTP]     = "b";
-  gNorskPitchNamesMap [kB_SemiSharp_QTP]   = "bSemiSharp???";
-  gNorskPitchNamesMap [kB_Sharp_QTP]       = "bis";
-  gNorskPitchNamesMap [kB_SesquiSharp_QTP] = "bSesquiSharp???";
-  gNorskPitchNamesMap [kB_DoubleSharp_QTP] = "bisis";
-    
-  gNorskPitchNamesMap [kC_DoubleFlat_QTP]  = "ceses";
-  gNorskPitchNamesMap [kC_SesquiFlat_QTP]  = "cSesquiFlat???";
-  gNorskPitchNamesMap [kC_Flat_QTP]        = "ces";
-  gNorskPitchNamesMap [kC_SemiFlat_QTP]    = "cSemiFlat???";
-  gNorskPitchNamesMap [kC_Natural_QTP]     = "c";
-  gNorskPitchNamesMap [kC_SemiSharp_QTP]   = "cSemiSharp???";
-  gNorskPitchNamesMap [kC_Sharp_QTP]       = "cis";
-  gNorskPitchNamesMap [kC_SesquiSharp_QTP] = "cSesquiSharp???";
-  gNorskPitchNamesMap [kC_DoubleSharp_QTP] = "cisis";
-    
-  gNorskPitchNamesMap [kD_DoubleFlat_QTP]  = "deses";
-  gNorskPitchNamesMap [kD_SesquiFlat_QTP]  = "dSesquiFlat???";
-  gNorskPitchNamesMap [kD_Flat_QTP]        = "des";
-  gNorskPitchNamesMap [kD_SemiFlat_QTP]    = "dSemiFlat???";
-  gNorskPitchNamesMap [kD_Natural_QTP]     = "d";
-  gNorskPitchNamesMap [kD_SemiSharp_QTP]   = "dSemiSharp???";
-  gNorskPitchNamesMap [kD_Sharp_QTP]       = "dis";
-  gNorskPitchNamesMap [kD_SesquiSharp_QTP] = "dSesquiSharp???";
-  gNorskPitchNamesMap [kD_DoubleSharp_QTP] = "disis";
-
-  gNorskPitchNamesMap [kE_DoubleFlat_QTP]  = "eeses";
-  gNorskPitchNamesMap [kE_SesquiFlat_QTP]  = "eSesquiFlat???";
-  gNorskPitchNamesMap [kE_Flat_QTP]        = "ees";
-  gNorskPitchNamesMap [kE_SemiFlat_QTP]    = "eSemiFlat???";
-  gNorskPitchNamesMap [kE_Natural_QTP]     = "e";
-  gNorskPitchNamesMap [kE_SemiSharp_QTP]   = "eSemiSharp???";
-  gNorskPitchNamesMap [kE_Sharp_QTP]       = "eis";
-  gNorskPitchNamesMap [kE_SesquiSharp_QTP] = "eSesquiSharp???";
-  gNorskPitchNamesMap [kE_DoubleSharp_QTP] = "eisis";
-    
-  gNorskPitchNamesMap [kF_DoubleFlat_QTP]  = "feses";
-  gNorskPitchNamesMap [kF_SesquiFlat_QTP]  = "fSesquiFlat???";
-  gNorskPitchNamesMap [kF_Flat_QTP]        = "fes";
-  gNorskPitchNamesMap [kF_SemiFlat_QTP]    = "fSemiFlat???";
-  gNorskPitchNamesMap [kF_Natural_QTP]     = "f";
-  gNorskPitchNamesMap [kF_SemiSharp_QTP]   = "fSemiSharp???";
-  gNorskPitchNamesMap [kF_Sharp_QTP]       = "fis";
-  gNorskPitchNamesMap [kF_SesquiSharp_QTP] = "fSesquiSharp???";
-  gNorskPitchNamesMap [kF_DoubleSharp_QTP] = "fisis";
-    
-  gNorskPitchNamesMap [kG_DoubleFlat_QTP]  = "geses";
-  gNorskPitchNamesMap [kG_SesquiFlat_QTP]  = "gSesquiFlat???";
-  gNorskPitchNamesMap [kG_Flat_QTP]        = "ges";
-  gNorskPitchNamesMap [kG_SemiFlat_QTP]    = "gSemiFlat???";
-  gNorskPitchNamesMap [kG_Natural_QTP]     = "g";
-  gNorskPitchNamesMap [kG_SemiSharp_QTP]   = "gSemiSharp???";
-  gNorskPitchNamesMap [kG_Sharp_QTP]       = "gis";
-  gNorskPitchNamesMap [kG_SesquiSharp_QTP] = "gSesquiSharp???";
-  gNorskPitchNamesMap [kG_DoubleSharp_QTP] = "gisis";
+  {
+    "", "r",
+
+    "",                 "aeses",            "aSesquiFlat???",   "aes",              "aSemiFlat???",
+    "a",
+    "aSemiSharp???",    "ais",              "aSesquiSharp???",  "aisis",            "",
+
+    "",                 "beses",            "bSesquiFlat???",   "bes",              "bSemiFlat???",
+    "b",
+    "bSemiSharp???",    "bis",              "bSesquiSharp???",  "bisis",            "",
+
+    "",                 "ceses",            "cSesquiFlat???",   "ces",              "cSemiFlat???",
+    "c",
+    "cSemiSharp???",    "cis",              "cSesquiSharp???",  "cisis",            "",
+
+    "",                 "deses",            "dSesquiFlat???",   "des",              "dSemiFlat???",
+    "d",
+    "dSemiSharp???",    "dis",              "dSesquiSharp???",  "disis",            "",
+
+    "",                 "eeses",            "eSesquiFlat???",   "ees",              "eSemiFlat???",
+    "e",
+    "eSemiSharp???",    "eis",              "eSesquiSharp???",  "eisis",            "",
+
+    "",                 "feses",            "fSesquiFlat???",   "fes",              "fSemiFlat???",
+    "f",
+    "fSemiSharp???",    "fis",              "fSesquiSharp???",  "fisis",            "",
+
+    "",                 "geses",            "gSesquiFlat???",   "ges",              "gSemiFlat???",
+    "g",
+    "gSemiSharp???",    "gis",              "gSesquiSharp???",  "gisis",            ""
+  },
 
   // portugues
-  gPortuguesPitchNamesMap [k_NoQuarterTonesPitch_QTP]  = "";
-  gPortuguesPitchNamesMap [k_Rest_QTP]                 = "r";
-  
-  gPortuguesPitchNamesMap [kA_DoubleFlat_QTP]  = "labb";
-  gPortuguesPitchNamesMap [kA_SesquiFlat_QTP]  = "labtqt";
-  gPortuguesPitchNamesMap [kA_Flat_QTP]        = "lab";
-  gPortuguesPitchNamesMap [kA_SemiFlat_QTP]    = "lasb";
-  gPortuguesPitchNamesMap [kA_Natural_QTP]     = "la";
-  gPortuguesPitchNamesMap [kA_SemiSharp_QTP]   = "lasd";
-  gPortuguesPitchNamesMap [kA_Sharp_QTP]       = "lad";
-  gPortuguesPitchNamesMap [kA_SesquiSharp_QTP] = "ladsd";
-  gPortuguesPitchNamesMap [kA_DoubleSharp_QTP] = "ladd";
-    
-  gPortuguesPitchNamesMap [kB_DoubleFlat_QTP]  = "sibb";
-  gPortuguesPitchNamesMap [kB_SesquiFlat_QTP]  = "sibtqt";
-  gPortuguesPitchNamesMap [kB_Flat_QTP]        = "sib";
-  gPortuguesPitchNamesMap [kB_SemiFlat_QTP]    = "sisb";
-  gPortuguesPitchNamesMap [kB_Natural_QTP]     = "si";
-  gPortuguesPitchNamesMap [kB_SemiSharp_QTP]   = "sisd";
-  gPortuguesPitchNamesMap [kB_Sharp_QTP]       = "sid";
-  gPortuguesPitchNamesMap [kB_SesquiSharp_QTP] = "sidsd";
-  gPortuguesPitchNamesMap [kB_DoubleSharp_QTP] = "sidd";
-    
-  gPortuguesPitchNamesMap [kC_DoubleFlat_QTP]  = "dobb";
-  gPortuguesPitchNamesMap [kC_SesquiFlat_QTP]  = "dobtqt";
-  gPortuguesPitchNamesMap [kC_Flat_QTP]        = "dob";
-  gPortuguesPitchNamesMap [kC_SemiFlat_QTP]    = "dosb";
-  gPortuguesPitchNamesMap [kC_Natural_QTP]     = "do";
-  gPortuguesPitchNamesMap [kC_SemiSharp_QTP]   = "dosd";
-  gPortuguesPitchNamesMap [kC_Sharp_QTP]       = "dod";
-  gPortuguesPitchNamesMap [kC_SesquiSharp_QTP] = "dodsd";
-  gPortuguesPitchNamesMap [kC_DoubleSharp_QTP] = "dodd";
-    
-  gPortuguesPitchNamesMap [kD_DoubleFlat_QTP]  = "rebb";
-  gPortuguesPitchNamesMap [kD_SesquiFlat_QTP]  = "rebtqt";
-  gPortuguesPitchNamesMap [kD_Flat_QTP]        = "reb";
-  gPortuguesPitchNamesMap [kD_SemiFlat_QTP]    = "resb";
-  gPortuguesPitchNamesMap [kD_Natural_QTP]     = "re";
-  gPortuguesPitchNamesMap [kD_SemiSharp_QTP]   = "resd";
-  gPortuguesPitchNamesMap [kD_Sharp_QTP]       = "red";
-  gPortuguesPitchNamesMap [kD_SesquiSharp_QTP] = "redsd";
-  gPortuguesPitchNamesMap [kD_DoubleSharp_QTP] = "redd";
-
-  gPortuguesPitchNamesMap [kE_DoubleFlat_QTP]  = "mibb";
-  gPortuguesPitchNamesMap [kE_SesquiFlat_QTP]  = "mibtqt";
-  gPortuguesPitchNamesMap [kE_Flat_QTP]        = "mib";
-  gPortuguesPitchNamesMap [kE_SemiFlat_QTP]    = "misb";
-  gPortuguesPitchNamesMap [kE_Natural_QTP]     = "mi";
-  gPortuguesPitchNamesMap [kE_SemiSharp_QTP]   = "misd";
-  gPortuguesPitchNamesMap [kE_Sharp_QTP]       = "mid";
-  gPortuguesPitchNamesMap [kE_SesquiSharp_QTP] = "midsd";
-  gPortuguesPitchNamesMap [kE_DoubleSharp_QTP] = "midd";
-    
-  gPortuguesPitchNamesMap [kF_DoubleFlat_QTP]  = "fabb";
-  gPortuguesPitchNamesMap [kF_SesquiFlat_QTP]  = "fabtqt";
-  gPortuguesPitchNamesMap [kF_Flat_QTP]        = "fab";
-  gPortuguesPitchNamesMap [kF_SemiFlat_QTP]    = "fasb";
-  gPortuguesPitchNamesMap [kF_Natural_QTP]     = "fa";
-  gPortuguesPitchNamesMap [kF_SemiSharp_QTP]   = "fasd";
-  gPortuguesPitchNamesMap [kF_Sharp_QTP]       = "fad";
-  gPortuguesPitchNamesMap [kF_SesquiSharp_QTP] = "fadsd";
-  gPortuguesPitchNamesMap [kF_DoubleSharp_QTP] = "fadd";
-    
-  gPortuguesPitchNamesMap [kG_DoubleFlat_QTP]  = "solbb";
-  gPortuguesPitchNamesMap [kG_SesquiFlat_QTP]  = "solbtqt";
-  gPortuguesPitchNamesMap [kG_Flat_QTP]        = "solb";
-  gPortuguesPitchNamesMap [kG_SemiFlat_QTP]    = "solsb";
-  gPortuguesPitchNamesMap [kG_Natural_QTP]     = "sol";
-  gPortuguesPitchNamesMap [kG_SemiSharp_QTP]   = "solsd";
-  gPortuguesPitchNamesMap [kG_Sharp_QTP]       = "sold";
-  gPortuguesPitchNamesMap [kG_SesquiSharp_QTP] = "soldsd";
-  gPortuguesPitchNamesMap [kG_DoubleSharp_QTP] = "soldd";
+  {
+    "", "r",
+
+    "",        "labb",    "labtqt",  "lab",     "lasb",
+    "la",
+    "lasd",    "lad",     "ladsd",   "ladd",    "",
+
+    "",        "sibb",    "sibtqt",  "sib",     "sisb",
+    "si",
+    "sisd",    "sid",     "sidsd",   "sidd",    "",
+
+    "",        "dobb",    "dobtqt",  "dob",     "dosb",
+    "do",
+    "dosd",    "dod",     "dodsd",   "dodd",    "",
+
+    "",        "rebb",    "rebtqt",  "reb",     "resb",
+    "re",
+    "resd",    "red",     "redsd",   "redd",    "",
+
+    "",        "mibb",    "mibtqt",  "mib",     "misb",
+    "mi",
+    "misd",    "mid",     "midsd",   "midd",    "",
+
+    "",        "fabb",    "fabtqt",  "fab",     "fasb",
+    "fa",
+    "fasd",    "fad",     "fadsd",   "fadd",    "",
+
+    "",         "solbb",    "solbtqt",  "solb",     "solsb",
+    "sol",
+    "solsd",    "sold",     "soldsd",   "soldd",    ""
+  },
 
   // suomi
-  gSuomiPitchNamesMap [k_NoQuarterTonesPitch_QTP]  = "";
-  gSuomiPitchNamesMap [k_Rest_QTP]                 = "r";
-  
-  gSuomiPitchNamesMap [kA_DoubleFlat_QTP]  = "asas";
-  gSuomiPitchNamesMap [kA_SesquiFlat_QTP]  = "aSesquiFlat???";
-  gSuomiPitchNamesMap [kA_Flat_QTP]        = "as";
-  gSuomiPitchNamesMap [kA_SemiFlat_QTP]    = "aSemiFlat???";
-  gSuomiPitchNamesMap [kA_Natural_QTP]     = "a";
-  gSuomiPitchNamesMap [kA_SemiSharp_QTP]   = "aSemiSharp???";
-  gSuomiPitchNamesMap [kA_Sharp_QTP]       = "ais";
-  gSuomiPitchNamesMap [kA_SesquiSharp_QTP] = "aSesquiSharp???";
-  gSuomiPitchNamesMap [kA_DoubleSharp_QTP] = "aisis";
-    
-  gSuomiPitchNamesMap [kB_DoubleFlat_QTP]  = "bes";
-  gSuomiPitchNamesMap [kB_SesquiFlat_QTP]  = "bSesquiFlat???";
-  gSuomiPitchNamesMap [kB_Flat_QTP]        = "b";
-  gSuomiPitchNamesMap [kB_SemiFlat_QTP]    = "bSemiFlat???";
-  gSuomiPitchNamesMap [kB_Natural_QTP]     = "h";
-  gSuomiPitchNamesMap [kB_SemiSharp_QTP]   = "bSemiSharp???";
-  gSuomiPitchNamesMap [kB_Sharp_QTP]       = "his";
-  gSuomiPitchNamesMap [kB_SesquiSharp_QTP] = "bSesquiSharp???";
-  gSuomiPitchNamesMap [kB_DoubleSharp_QTP] = "hisis";
-    
-  gSuomiPitchNamesMap [kC_DoubleFlat_QTP]  = "ceses";
-  gSuomiPitchNamesMap [kC_SesquiFlat_QTP]  = "cSesquiFlat???";
-  gSuomiPitchNamesMap [kC_Flat_QTP]        = "ces";
-  gSuomiPitchNamesMap [kC_SemiFlat_QTP]    = "cSemiFlat???";
-  gSuomiPitchNamesMap [kC_Natural_QTP]     = "c";
-  gSuomiPitchNamesMap [kC_SemiSharp_QTP]   = "cSemiSharp???";
-  gSuomiPitchNamesMap [kC_Sharp_QTP]       = "cis";
-  gSuomiPitchNamesMap [kC_SesquiSharp_QTP] = "cSesquiSharp???";
-  gSuomiPitchNamesMap [kC_DoubleSharp_QTP] = "cisis";
-    
-  gSuomiPitchNamesMap [kD_DoubleFlat_QTP]  = "deses";
-  gSuomiPitchNamesMap [kD_SesquiFlat_QTP]  = "dSesquiFlat???";
-  gSuomiPitchNamesMap [kD_Flat_QTP]        = "des";
-  gSuomiPitchNamesMap [kD_SemiFlat_QTP]    = "dSemiFlat???";
-  gSuomiPitchNamesMap [kD_Natural_QTP]     = "d";
-  gSuomiPitchNamesMap [kD_SemiSharp_QTP]   = "dSemiSharp???";
-  gSuomiPitchNamesMap [kD_Sharp_QTP]       = "dis";
-  gSuomiPitchNamesMap [kD_SesquiSharp_QTP] = "dSesquiSharp???";
-  gSuomiPitchNamesMap [kD_DoubleSharp_QTP] = "disis";
-
-  gSuomiPitchNamesMap [kE_DoubleFlat_QTP]  = "eses";
-  gSuomiPitchNamesMap [kE_SesquiFlat_QTP]  = "eSesquiFlat???";
-  gSuomiPitchNamesMap [kE_Flat_QTP]        = "es";
-  gSuomiPitchNamesMap [kE_SemiFlat_QTP]    = "eSemiFlat???";
-  gSuomiPitchNamesMap [kE_Natural_QTP]     = "e";
-  gSuomiPitchNamesMap [kE_SemiSharp_QTP]   = "eSemiSharp???";
-  gSuomiPitchNamesMap [kE_Sharp_QTP]       = "eis";
-  gSuomiPitchNamesMap [kE_SesquiSharp_QTP] = "eSesquiSharp???";
-  gSuomiPitchNamesMap [kE_DoubleSharp_QTP] = "eisis";
-    
-  gSuomiPitchNamesMap [kF_DoubleFlat_QTP]  = "feses";
-  gSuomiPitchNamesMap [kF_SesquiFlat_QTP]  = "fSesquiFlat???";
-  gSuomiPitchNamesMap [kF_Flat_QTP]        = "fes";
-  gSuomiPitchNamesMap [kF_SemiFlat_QTP]    = "fSemiFlat???";
-  gSuomiPitchNamesMap [kF_Natural_QTP]     = "f";
-  gSuomiPitchNamesMap [kF_SemiSharp_QTP]   = "fSemiSharp???";
-  gSuomiPitchNamesMap [kF_Sharp_QTP]       = "fis";
-  gSuomiPitchNamesMap [kF_SesquiSharp_QTP] = "fSesquiSharp???";
-  gSuomiPitchNamesMap [kF_DoubleSharp_QTP] = "fisis";
-    
-  gSuomiPitchNamesMap [kG_DoubleFlat_QTP]  = "geses";
-  gSuomiPitchNamesMap [kG_SesquiFlat_QTP]  = "gSesquiFlat???";
-  gSuomiPitchNamesMap [kG_Flat_QTP]        = "ges";
-  gSuomiPitchNamesMap [kG_SemiFlat_QTP]    = "gSemiFlat???";
-  gSuomiPitchNamesMap [kG_Natural_QTP]     = "g";
-  gSuomiPitchNamesMap [kG_SemiSharp_QTP]   = "gSemiSharp???";
-  gSuomiPitchNamesMap [kG_Sharp_QTP]       = "gis";
-  gSuomiPitchNamesMap [kG_SesquiSharp_QTP] = "gSesquiSharp???";
-  gSuomiPitchNamesMap [kG_DoubleSharp_QTP] = "gisis";
+  {
+    "", "r",
+
+    "",                 "asas",             "aSesquiFlat???",   "as",               "aSemiFlat???",
+    "a",
+    "aSemiSharp???",    "ais",              "aSesquiSharp???",  "aisis",            "",
+
+    "",                 "bes",              "bSesquiFlat???",   "b",                "bSemiFlat???",
+    "h",
+    "bSemiSharp???",    "his",              "bSesquiSharp???",  "hisis",            "",
+
+    "",                 "ceses",            "cSesquiFlat???",   "ces",              "cSemiFlat???",
+    "c",
+    "cSemiSharp???",    "cis",              "cSesquiSharp???",  "cisis",            "",
+
+    "",                 "deses",            "dSesquiFlat???",   "des",              "dSemiFlat???",
+    "d",
+    "dSemiSharp???",    "dis",              "dSesquiSharp???",  "disis",            "",
+
+    "",                 "eses",             "eSesquiFlat???",   "es",               "eSemiFlat???",
+    "e",
+    "eSemiSharp???",    "eis",              "eSesquiSharp???",  "eisis",            "",
+
+    "",                 "feses",            "fSesquiFlat???",   "fes",              "fSemiFlat???",
+    "f",
+    "fSemiSharp???",    "fis",              "fSesquiSharp???",  "fisis",            "",
+
+    "",                 "geses",            "gSesquiFlat???",   "ges",              "gSemiFlat???",
+    "g",
+    "gSemiSharp???",    "gis",              "gSesquiSharp???",  "gisis",            ""
+  },
 
   // svenska
-  gSvenskaPitchNamesMap [k_NoQuarterTonesPitch_QTP]  = "";
-  gSvenskaPitchNamesMap [k_Rest_QTP]                 = "r";
-  
-  gSvenskaPitchNamesMap [kA_DoubleFlat_QTP]  = "assess";
-  gSvenskaPitchNamesMap [kA_SesquiFlat_QTP]  = "aSesquiFlat???";
-  gSvenskaPitchNamesMap [kA_Flat_QTP]        = "ass";
-  gSvenskaPitchNamesMap [kA_SemiFlat_QTP]    = "aSemiFlat???";
-  gSvenskaPitchNamesMap [kA_Natural_QTP]     = "a";
-  gSvenskaPitchNamesMap [kA_SemiSharp_QTP]   = "aSemiSharp???";
-  gSvenskaPitchNamesMap [kA_Sharp_QTP]       = "aiss";
-  gSvenskaPitchNamesMap [kA_SesquiSharp_QTP] = "aSesquiSharp???";
-  gSvenskaPitchNamesMap [kA_DoubleSharp_QTP] = "aississ";
-    
-  gSvenskaPitchNamesMap [kB_DoubleFlat_QTP]  = "hessess";
-  gSvenskaPitchNamesMap [kB_SesquiFlat_QTP]  = "bSesquiFlat???";
-  gSvenskaPitchNamesMap [kB_Flat_QTP]        = "b";
-  gSvenskaPitchNamesMap [kB_SemiFlat_QTP]    = "bSemiFlat???";
-  gSvenskaPitchNamesMap [kB_Natural_QTP]     = "h";
-  gSvenskaPitchNamesMap [kB_SemiSharp_QTP]   = "bSemiSharp???";
-  gSvenskaPitchNamesMap [kB_Sharp_QTP]       = "hiss";
-  gSvenskaPitchNamesMap [kB_SesquiSharp_QTP] = "bSesquiSharp???";
-  gSvenskaPitchNamesMap [kB_DoubleSharp_QTP] = "hississ";
-    
-  gSvenskaPitchNamesMap [kC_DoubleFlat_QTP]  = "cessess";
-  gSvenskaPitchNamesMap [kC_SesquiFlat_QTP]  = "cSesquiFlat???";
-  gSvenskaPitchNamesMap [kC_Flat_QTP]        = "cess";
-  gSvenskaPitchNamesMap [kC_SemiFlat_QTP]    = "cSemiFlat???";
-  gSvenskaPitchNamesMap [kC_Natural_QTP]     = "c";
-  gSvenskaPitchNamesMap [kC_SemiSharp_QTP]   = "cSemiSharp???";
-  gSvenskaPitchNamesMap [kC_Sharp_QTP]       = "ciss";
-  gSvenskaPitchNamesMap [kC_SesquiSharp_QTP] = "cSesquiSharp???";
-  gSvenskaPitchNamesMap [kC_DoubleSharp_QTP] = "cississ";
-    
-  gSvenskaPitchNamesMap [kD_DoubleFlat_QTP]  = "dessess";
-  gSvenskaPitchNamesMap [kD_SesquiFlat_QTP]  = "dSesquiFlat???";
-  gSvenskaPitchNamesMap [kD_Flat_QTP]        = "dess";
-  gSvenskaPitchNamesMap [kD_SemiFlat_QTP]    = "dSemiFlat???";
-  gSvenskaPitchNamesMap [kD_Natural_QTP]     = "d";
-  gSvenskaPitchNamesMap [kD_SemiSharp_QTP]   = "dSemiSharp???";
-  gSvenskaPitchNamesMap [kD_Sharp_QTP]       = "diss";
-  gSvenskaPitchNamesMap [kD_SesquiSharp_QTP] = "dSesquiSharp???";
-  gSvenskaPitchNamesMap [kD_DoubleSharp_QTP] = "dississ";
-
-  gSvenskaPitchNamesMap [kE_DoubleFlat_QTP]  = "essess";
-  gSvenskaPitchNamesMap [kE_SesquiFlat_QTP]  = "eSesquiFlat???";
-  gSvenskaPitchNamesMap [kE_Flat_QTP]        = "ess";
-  gSvenskaPitchNamesMap [kE_SemiFlat_QTP]    = "eSemiFlat???";
-  gSvenskaPitchNamesMap [kE_Natural_QTP]     = "e";
-  gSvenskaPitchNamesMap [kE_SemiSharp_QTP]   = "eSemiSharp???";
-  gSvenskaPitchNamesMap [kE_Sharp_QTP]       = "eiss";
-  gSvenskaPitchNamesMap [kE_SesquiSharp_QTP] = "eSesquiSharp???";
-  gSvenskaPitchNamesMap [kE_DoubleSharp_QTP] = "eississ";
-    
-  gSvenskaPitchNamesMap [kF_DoubleFlat_QTP]  = "fessess";
-  gSvenskaPitchNamesMap [kF_SesquiFlat_QTP]  = "fSesquiFlat???";
-  gSvenskaPitchNamesMap [kF_Flat_QTP]        = "fess";
-  gSvenskaPitchNamesMap [kF_SemiFlat_QTP]    = "fSemiFlat???";
-  gSvenskaPitchNamesMap [kF_Natural_QTP]     = "f";
-  gSvenskaPitchNamesMap [kF_SemiSharp_QTP]   = "fSemiSharp???";
-  gSvenskaPitchNamesMap [kF_Sharp_QTP]       = "fiss";
-  gSvenskaPitchNamesMap [kF_SesquiSharp_QTP] = "fSesquiSharp???";
-  gSvenskaPitchNamesMap [kF_DoubleSharp_QTP] = "fississ";
-    
-  gSvenskaPitchNamesMap [kG_DoubleFlat_QTP]  = "gessess";
-  gSvenskaPitchNamesMap [kG_SesquiFlat_QTP]  = "gSesquiFlat???";
-  gSvenskaPitchNamesMap [kG_Flat_QTP]        = "gess";
-  gSvenskaPitchNamesMap [kG_SemiFlat_QTP]    = "gSemiFlat???";
-  gSvenskaPitchNamesMap [kG_Natural_QTP]     = "g";
-  gSvenskaPitchNamesMap [kG_SemiSharp_QTP]   = "gSemiSharp???";
-  gSvenskaPitchNamesMap [kG_Sharp_QTP]       = "giss";
-  gSvenskaPitchNamesMap [kG_SesquiSharp_QTP] = "gSesquiSharp???";
-  gSvenskaPitchNamesMap [kG_DoubleSharp_QTP] = "gississ";
+  {
+    "", "r",
+
+    "",                 "assess",           "aSesquiFlat???",   "ass",              "aSemiFlat???",
+    "a",
+    "aSemiSharp???",    "aiss",             "aSesquiSharp???",  "aississ",          "",
+
+    "",                 "hessess",          "bSesquiFlat???",   "b",                "bSemiFlat???",
+    "h",
+    "bSemiSharp???",    "hiss",             "bSesquiSharp???",  "hississ",          "",
+
+    "",                 "cessess",          "cSesquiFlat???",   "cess",             "cSemiFlat???",
+    "c",
+    "cSemiSharp???",    "ciss",             "cSesquiSharp???",  "cississ",          "",
+
+    "",                 "dessess",          "dSesquiFlat???",   "dess",             "dSemiFlat???",
+    "d",
+    "dSemiSharp???",    "diss",             "dSesquiSharp???",  "dississ",          "",
+
+    "",                 "essess",           "eSesquiFlat???",   "ess",              "eSemiFlat???",
+    "e",
+    "eSemiSharp???",    "eiss",             "eSesquiSharp???",  "eississ",          "",
+
+    "",                 "fessess",          "fSesquiFlat???",   "fess",             "fSemiFlat???",
+    "f",
+    "fSemiSharp???",    "fiss",             "fSesquiSharp???",  "fississ",          "",
+
+    "",                 "gessess",          "gSesquiFlat???",   "gess",             "gSemiFlat???",
+    "g",
+    "gSemiSharp???",    "giss",             "gSesquiSharp???",  "gississ",          ""
+  },
 
   // vlaams
-  gVlaamsPitchNamesMap [k_NoQuarterTonesPitch_QTP]  = "none";
-  gVlaamsPitchNamesMap [k_Rest_QTP]                 = "r";
-  
-  gVlaamsPitchNamesMap [kA_DoubleFlat_QTP]  = "labb";
-  gVlaamsPitchNamesMap [kA_SesquiFlat_QTP]  = "laSesquiFlat???";
-  gVlaamsPitchNamesMap [kA_Flat_QTP]        = "lab";
-  gVlaamsPitchNamesMap [kA_SemiFlat_QTP]    = "laSemiFlat???";
-  gVlaamsPitchNamesMap [kA_Natural_QTP]     = "la";
-  gVlaamsPitchNamesMap [kA_SemiSharp_QTP]   = "laSemiSharp???";
-  gVlaamsPitchNamesMap [kA_Sharp_QTP]       = "lak";
-  gVlaamsPitchNamesMap [kA_SesquiSharp_QTP] = "laSesquiSharp???";
-  gVlaamsPitchNamesMap [kA_DoubleSharp_QTP] = "lakk";
-    
-  gVlaamsPitchNamesMap [kB_DoubleFlat_QTP]  = "sibb";
-  gVlaamsPitchNamesMap [kB_SesquiFlat_QTP]  = "siSesquiFlat???";
-  gVlaamsPitchNamesMap [kB_Flat_QTP]        = "sib";
-  gVlaamsPitchNamesMap [kB_SemiFlat_QTP]    = "siSemiFlat???";
-  gVlaamsPitchNamesMap [kB_Natural_QTP]     = "si";
-  gVlaamsPitchNamesMap [kB_SemiSharp_QTP]   = "siSemiSharp???";
-  gVlaamsPitchNamesMap [kB_Sharp_QTP]       = "sik";
-  gVlaamsPitchNamesMap [kB_SesquiSharp_QTP] = "siSesquiSharp???";
-  gVlaamsPitchNamesMap [kB_DoubleSharp_QTP] = "sikk";
-    
-  gVlaamsPitchNamesMap [kC_DoubleFlat_QTP]  = "dobb";
-  gVlaamsPitchNamesMap [kC_SesquiFlat_QTP]  = "doSesquiFlat???";
-  gVlaamsPitchNamesMap [kC_Flat_QTP]        = "dob";
-  gVlaamsPitchNamesMap [kC_SemiFlat_QTP]    = "doSemiFlat???";
-  gVlaamsPitchNamesMap [kC_Natural_QTP]     = "do";
-  gVlaamsPitchNamesMap [kC_SemiSharp_QTP]   = "doSemiSharp???";
-  gVlaamsPitchNamesMap [kC_Sharp_QTP]       = "dok";
-  gVlaamsPitchNamesMap [kC_SesquiSharp_QTP] = "doSesquiSharp???";
-  gVlaamsPitchNamesMap [kC_DoubleSharp_QTP] = "dokk";
-    
-  gVlaamsPitchNamesMap [kD_DoubleFlat_QTP]  = "rebb";
-  gVlaamsPitchNamesMap [kD_SesquiFlat_QTP]  = "reSesquiFlat???";
-  gVlaamsPitchNamesMap [kD_Flat_QTP]        = "reb";
-  gVlaamsPitchNamesMap [kD_SemiFlat_QTP]    = "reSemiFlat???";
-  gVlaamsPitchNamesMap [kD_Natural_QTP]     = "re";
-  gVlaamsPitchNamesMap [kD_SemiSharp_QTP]   = "reSemiSharp???";
-  gVlaamsPitchNamesMap [kD_Sharp_QTP]       = "rek";
-  gVlaamsPitchNamesMap [kD_SesquiSharp_QTP] = "reSesquiSharp???";
-  gVlaamsPitchNamesMap [kD_DoubleSharp_QTP] = "rekk";
-
-  gVlaamsPitchNamesMap [kE_DoubleFlat_QTP]  = "mibb";
-  gVlaamsPitchNamesMap [kE_SesquiFlat_QTP]  = "miSesquiFlat???";
-  gVlaamsPitchNamesMap [kE_Flat_QTP]        = "mib";
-  gVlaamsPitchNamesMap [kE_SemiFlat_QTP]    = "miSemiFlat???";
-  gVlaamsPitchNamesMap [kE_Natural_QTP]     = "mi";
-  gVlaamsPitchNamesMap [kE_SemiSharp_QTP]   = "miSemiSharp???";
-  gVlaamsPitchNamesMap [kE_Sharp_QTP]       = "mik";
-  gVlaamsPitchNamesMap [kE_SesquiSharp_QTP] = "miSesquiSharp???";
-  gVlaamsPitchNamesMap [kE_DoubleSharp_QTP] = "mikk";
-    
-  gVlaamsPitchNamesMap [kF_DoubleFlat_QTP]  = "fabb";
-  gVlaamsPitchNamesMap [kF_SesquiFlat_QTP]  = "faSesquiFlat???";
-  gVlaamsPitchNamesMap [kF_Flat_QTP]        = "fab";
-  gVlaamsPitchNamesMap [kF_SemiFlat_QTP]    = "faSemiFlat???";
-  gVlaamsPitchNamesMap [kF_Natural_QTP]     = "fa";
-  gVlaamsPitchNamesMap [kF_SemiSharp_QTP]   = "faSemiSharp???";
-  gVlaamsPitchNamesMap [kF_Sharp_QTP]       = "fak";
-  gVlaamsPitchNamesMap [kF_SesquiSharp_QTP] = "faSesquiSharp???";
-  gVlaamsPitchNamesMap [kF_DoubleSharp_QTP] = "fakk";
-    
-  gVlaamsPitchNamesMap [kG_DoubleFlat_QTP]  = "solbb";
-  gVlaamsPitchNamesMap [kG_SesquiFlat_QTP]  = "solSesquiFlat???";
-  gVlaamsPitchNamesMap [kG_Flat_QTP]        = "solb";
-  gVlaamsPitchNamesMap [kG_SemiFlat_QTP]    = "solSemiFlat???";
-  gVlaamsPitchNamesMap [kG_Natural_QTP]     = "sol";
-  gVlaamsPitchNamesMap [kG_SemiSharp_QTP]   = "solSemiSharp???";
-  gVlaamsPitchNamesMap [kG_Sharp_QTP]       = "solk";
-  gVlaamsPitchNamesMap [kG_SesquiSharp_QTP] = "solSesquiSharp???";
-  gVlaamsPitchNamesMap [kG_DoubleSharp_QTP] = "solkk";
+  {
+    "none", "r",
+
+    "",                  "labb",              "laSesquiFlat???",   "lab",               "laSemiFlat???",
+    "la",
+    "laSemiSharp???",    "lak",               "laSesquiSharp???",  "lakk",              "",
+
+    "",                  "sibb",              "siSesquiFlat???",   "sib",               "siSemiFlat???",
+    "si",
+    "siSemiSharp???",    "sik",               "siSesquiSharp???",  "sikk",              "",
+
+    "",                  "dobb",              "doSesquiFlat???",   "dob",               "doSemiFlat???",
+    "do",
+    "doSemiSharp???",    "dok",               "doSesquiSharp???",  "dokk",              "",
+
+    "",                  "rebb",              "reSesquiFlat???",   "reb",               "reSemiFlat???",
+    "re",
+    "reSemiSharp???",    "rek",               "reSesquiSharp???",  "rekk",              "",
+
+    "",                  "mibb",              "miSesquiFlat???",   "mib",               "miSemiFlat???",
+    "mi",
+    "miSemiSharp???",    "mik",               "miSesquiSharp???",  "mikk",              "",
+
+    "",                  "fabb",              "faSesquiFlat???",   "fab",               "faSemiFlat???",
+    "fa",
+    "faSemiSharp???",    "fak",               "faSesquiSharp???",  "fakk",              "",
+
+    "",                   "solbb",              "solSesquiFlat???",   "solb",               "solSemiFlat???",
+    "sol",
+    "solSemiSharp???",    "solk",               "solSesquiSharp???",  "solkk",              ""
+  }
+};
+
+void initializeQuarterTonesPitchesLanguageKinds ()
+{
+  gQuarterTonesPitchesLanguageKindsMap ["nederlands"] = kNederlands;
+  gQuarterTonesPitchesLanguageKindsMap ["catalan"]    = kCatalan;
+  gQuarterTonesPitchesLanguageKindsMap ["deutsch"]    = kDeutsch;
+  gQuarterTonesPitchesLanguageKindsMap ["english"]    = kEnglish;
+  gQuarterTonesPitchesLanguageKindsMap ["espanol"]    = kEspanol;
+  gQuarterTonesPitchesLanguageKindsMap ["italiano"]   = kItaliano;
+  gQuarterTonesPitchesLanguageKindsMap ["francais"]   = kFrancais;
+  gQuarterTonesPitchesLanguageKindsMap ["norsk"]      = kNorsk;
+  gQuarterTonesPitchesLanguageKindsMap ["portugues"]  = kPortugues;
+  gQuarterTonesPitchesLanguageKindsMap ["suomi"]      = kSuomi;
+  gQuarterTonesPitchesLanguageKindsMap ["svenska"]    = kSvenska;
+  gQuarterTonesPitchesLanguageKindsMap ["vlaams"]     = kVlaams;
 }
 
 string msrDiatonicPitchKindAsString (
@@ -10270,7 +9791,7 @@ msrQuarterTonesPitchKind quarterTonesPitchKindFromDiatonicPitchAndAlteration (
               ", line = " << inputLineNumber;
 
             msrInternalError (
-              gXml2lyOptions->fInputSourceName,
+              gXml2lyOptions ()->fInputSourceName,
               inputLineNumber,
               __FILE__, __LINE__,
               s.str ());
@@ -10323,7 +9844,7 @@ msrQuarterTonesPitchKind quarterTonesPitchKindFromDiatonicPitchAndAlteration (
               ", line = " << inputLineNumber;
 
             msrInternalError (
-              gXml2lyOptions->fInputSourceName,
+              gXml2lyOptions ()->fInputSourceName,
               inputLineNumber,
               __FILE__, __LINE__,
               s.str ());
@@ -10378,7 +9899,7 @@ msrQuarterTonesPitchKind quarterTonesPitchKindFromDiatonicPitchAndAlteration (
               ", line = " << inputLineNumber;
 
             msrInternalError (
-              gXml2lyOptions->fInputSourceName,
+              gXml2lyOptions ()->fInputSourceName,
               inputLineNumber,
               __FILE__, __LINE__,
               s.str ());
@@ -10431,7 +9952,7 @@ msrQuarterTonesPitchKind quarterTonesPitchKindFromDiatonicPitchAndAlteration (
               ", line = " << inputLineNumber;
 
             msrInternalError (
-              gXml2lyOptions->fInputSourceName,
+              gXml2lyOptions ()->fInputSourceName,
               inputLineNumber,
               __FILE__, __LINE__,
               s.str ());
@@ -10484,7 +10005,7 @@ msrQuarterTonesPitchKind quarterTonesPitchKindFromDiatonicPitchAndAlteration (
               ", line = " << inputLineNumber;
 
             msrInternalError (
-              gXml2lyOptions->fInputSourceName,
+              gXml2lyOptions ()->fInputSourceName,
               inputLineNumber,
               __FILE__, __LINE__,
               s.str ());
@@ -10537,7 +10058,7 @@ msrQuarterTonesPitchKind quarterTonesPitchKindFromDiatonicPitchAndAlteration (
               ", line = " << inputLineNumber;
 
             msrInternalError (
-              gXml2lyOptions->fInputSourceName,
+              gXml2lyOptions ()->fInputSourceName,
               inputLineNumber,
               __FILE__, __LINE__,
               s.str ());
@@ -10590,7 +10111,7 @@ msrQuarterTonesPitchKind quarterTonesPitchKindFromDiatonicPitchAndAlteration (
               ", line = " << inputLineNumber;
 
             msrInternalError (
-              gXml2lyOptions->fInputSourceName,
+              gXml2lyOptions ()->fInputSourceName,
               inputLineNumber,
               __FILE__, __LINE__,
               s.str ());
@@ -10610,7 +10131,7 @@ msrQuarterTonesPitchKind quarterTonesPitchKindFromDiatonicPitchAndAlteration (
           ", line = " << inputLineNumber;
 
         msrInternalError (
-          gXml2lyOptions->fInputSourceName,
+          gXml2lyOptions ()->fInputSourceName,
           inputLineNumber,
           __FILE__, __LINE__,
           s.str ());
@@ -10736,7 +10257,7 @@ msrDiatonicPitchKind diatonicPitchKindFromQuarterTonesPitchKind (
           ", line = " << inputLineNumber;
 
         msrInternalError (
-          gXml2lyOptions->fInputSourceName,
+          gXml2lyOptions ()->fInputSourceName,
           inputLineNumber,
           __FILE__, __LINE__,
           s.str ());
@@ -10754,7 +10275,7 @@ msrDiatonicPitchKind diatonicPitchKindFromQuarterTonesPitchKind (
           ", line = " << inputLineNumber;
 
         msrInternalError (
-          gXml2lyOptions->fInputSourceName,
+          gXml2lyOptions ()->fInputSourceName,
           inputLineNumber,
           __FILE__, __LINE__,
           s.str ());
@@ -11025,48 +10546,8 @@ string msrQuarterTonesPitchKindAsString (
   msrQuarterTonesPitchesLanguageKind languageKind,
   msrQuarterTonesPitchKind           quarterTonesPitchKind)
 {
-  string result;
-  
-  switch (languageKind) {
-    case kNederlands:
-      result = gNederlandsPitchNamesMap [quarterTonesPitchKind];
-      break;
-    case kCatalan:
-      result = gCatalanPitchNamesMap [quarterTonesPitchKind];
-      break;
-    case kDeutsch:
-      result = gDeutschPitchNamesMap [quarterTonesPitchKind];
-      break;
-    case kEnglish:
-      result = gEnglishPitchNamesMap [quarterTonesPitchKind];
-      break;
-    case kEspanol:
-      result = gEspanolPitchNamesMap [quarterTonesPitchKind];
-      break;
-    case kFrancais:
-      result = gFrancaisPitchNamesMap [quarterTonesPitchKind];
-      break;
-    case kItaliano:
-      result = gItalianoPitchNamesMap [quarterTonesPitchKind];
-      break;
-    case kNorsk:
-      result = gNorskPitchNamesMap [quarterTonesPitchKind];
-      break;
-    case kPortugues:
-      result = gPortuguesPitchNamesMap [quarterTonesPitchKind];
-      break;
-    case kSuomi:
-      result = gSuomiPitchNamesMap [quarterTonesPitchKind];
-      break;
-    case kSvenska:
-      result = gSvenskaPitchNamesMap [quarterTonesPitchKind];
-      break;
-    case kVlaams:
-      result = gVlaamsPitchNamesMap [quarterTonesPitchKind];
-      break;
-  } // switch
-
-  return result;
+  return
+    gQuarterTonesPitchNames [languageKind] [quarterTonesPitchKind];
 }
 
 msrQuarterTonesPitchKind msrQuarterTonesPitchKindFromString (
@@ -11075,62 +10556,17 @@ msrQuarterTonesPitchKind msrQuarterTonesPitchKindFromString (
 {
   msrQuarterTonesPitchKind result = k_NoQuarterTonesPitch_QTP;
 
-  map<msrQuarterTonesPitchKind, string> *pitchNamesMapPTR;
-
-  // is quarterTonesPitchName in the part renaming map?
-  switch (languageKind) {
-    case kNederlands:
-      pitchNamesMapPTR = &gNederlandsPitchNamesMap;
-      break;
-    case kCatalan:
-      pitchNamesMapPTR = &gCatalanPitchNamesMap;
-      break;
-    case kDeutsch:
-      pitchNamesMapPTR = &gDeutschPitchNamesMap;
+  // is quarterTonesPitchName known in this language?
+  for (int i = k_NoQuarterTonesPitch_QTP; i <= kG_TripleSharp_QTP; i++) {
+    if (
+      quarterTonesPitchName
+        ==
+      gQuarterTonesPitchNames [languageKind] [i]
+    ) {
+      result = msrQuarterTonesPitchKind (i);
       break;
-    case kEnglish:
-      pitchNamesMapPTR = &gEnglishPitchNamesMap;
-      break;
-    case kEspanol:
-      pitchNamesMapPTR = &gEspanolPitchNamesMap;
-      break;
-    case kFrancais:
-      pitchNamesMapPTR = &gFrancaisPitchNamesMap;
-      break;
-    case kItaliano:
-      pitchNamesMapPTR = &gItalianoPitchNamesMap;
-      break;
-    case kNorsk:
-      pitchNamesMapPTR = &gNorskPitchNamesMap;
-      break;
-    case kPortugues:
-      pitchNamesMapPTR = &gPortuguesPitchNamesMap;
-      break;
-    case kSuomi:
-      pitchNamesMapPTR = &gSuomiPitchNamesMap;
-      break;
-    case kSvenska:
-      pitchNamesMapPTR = &gSvenskaPitchNamesMap;
-      break;
-    case kVlaams:
-      pitchNamesMapPTR = &gVlaamsPitchNamesMap;
-      break;
-  } // switch
-
-  // is quarterTonesPitchName present in the map?
-  if (gQuarterTonesPitchesLanguageKindsMap.size ()) {
-    map<msrQuarterTonesPitchKind, string>::const_iterator
-      iBegin = (*pitchNamesMapPTR).begin (),
-      iEnd   = (*pitchNamesMapPTR).end (),
-      i      = iBegin;
-    for ( ; ; ) {
-      if ((*i).second == quarterTonesPitchName) {
-        result = (*i).first;
-        break;
-      }
-      if (++i == iEnd) break;
-    } // for
-  }
+    }
+  } // for
   
   return result;
 }
@@ -11144,7 +10580,7 @@ msrSemiTonesPitchKind semiTonesPitchKindFromString (
   msrQuarterTonesPitchKind
     quarterTonesPitchKindFromString =
       msrQuarterTonesPitchKindFromString (
-        gLpsrOptions->
+        gLpsrOptions ()->
           fLpsrQuarterTonesPitchesLanguageKind,
         theString);
 
@@ -11750,7 +11186,7 @@ float msrFontSize::getFontNumericSize ()
           fontSizeKindAsString (fFontSizeKind);
 
         msrInternalError (
-          gXml2lyOptions->fInputSourceName,
+          gXml2lyOptions ()->fInputSourceName,
           NO_INPUT_LINE_NUMBER, // JMI
           __FILE__, __LINE__,
           s.str ());
@@ -11983,7 +11419,7 @@ msrDurationKind msrDurationKindFromString (
       "\" is unknown";
 
     msrMusicXMLError (
-      gXml2lyOptions->fInputSourceName,
+      gXml2lyOptions ()->fInputSourceName,
       inputLineNumber,
       __FILE__, __LINE__,
       s.str ());
@@ -12272,7 +11708,7 @@ string wholeNotesAsMsrString (
 #define DEBUG_WHOLE_NOTES 0
 
   if (DEBUG_WHOLE_NOTES) {
-    gLogIOstream <<
+    gLogIOstream () <<
       "--> wholeNotes: " << wholeNotes <<
       ", line " << inputLineNumber <<
       endl;
@@ -12283,7 +11719,7 @@ string wholeNotesAsMsrString (
     denominator  = wholeNotes.getDenominator ();
 
   if (DEBUG_WHOLE_NOTES) {
-    gLogIOstream <<
+    gLogIOstream () <<
       "--> numerator:   " << numerator <<
       endl <<
       "--> denominator: " << denominator <<
@@ -12303,7 +11739,7 @@ string wholeNotesAsMsrString (
   wholeNotes.rationalise ();
 
   if (DEBUG_WHOLE_NOTES) {
-    gLogIOstream <<
+    gLogIOstream () <<
       "--> wholeNotes rationalised: " << wholeNotes <<
       endl;
   }
@@ -12321,7 +11757,7 @@ string wholeNotesAsMsrString (
     integralNumberOfWholeNotes = denominator == 1;
 
   if (DEBUG_WHOLE_NOTES) {
-    gLogIOstream <<
+    gLogIOstream () <<
       "--> rationalHasBeenSimplified: " <<
       booleanAsString (
         rationalHasBeenSimplified) <<
@@ -12347,7 +11783,7 @@ string wholeNotesAsMsrString (
   int  numeratorDots = msrNumberOfDots (numerator);
 
   if (DEBUG_WHOLE_NOTES) {
-    gLogIOstream <<
+    gLogIOstream () <<
       "--> numeratorDots " << " : " << numeratorDots <<
       endl <<
       endl;
@@ -12421,7 +11857,7 @@ string wholeNotesAsMsrString (
   
    //   msrMusicXMLError ( JMI
       msrMusicXMLWarning (
-        gXml2lyOptions->fInputSourceName,
+        gXml2lyOptions ()->fInputSourceName,
         inputLineNumber,
     //    __FILE__, __LINE__,
         s.str ());
@@ -12431,7 +11867,7 @@ string wholeNotesAsMsrString (
   }
 
   if (DEBUG_WHOLE_NOTES) {
-    gLogIOstream <<
+    gLogIOstream () <<
       "--> durationLog" << " : " <<
       durationLog <<
       endl <<
@@ -12448,7 +11884,7 @@ string wholeNotesAsMsrString (
       durationLog -= 1;
 
       if (DEBUG_WHOLE_NOTES) {
-        gLogIOstream <<
+        gLogIOstream () <<
           "--> numerator" << " : " <<
           numerator <<
           endl <<
@@ -12471,7 +11907,7 @@ string wholeNotesAsMsrString (
     durationLog -= numeratorDots;
 
     if (DEBUG_WHOLE_NOTES) {
-      gLogIOstream <<
+      gLogIOstream () <<
         "--> durationLog" << " : " <<
         durationLog <<
         endl <<
@@ -12486,7 +11922,7 @@ string wholeNotesAsMsrString (
     multiplyingFactor = numerator;
 
     if (DEBUG_WHOLE_NOTES) {
-      gLogIOstream <<
+      gLogIOstream () <<
         "--> durationLog" << " : " <<
         durationLog <<
         endl <<
@@ -12504,7 +11940,7 @@ string wholeNotesAsMsrString (
       multiplyingFactor /= 2;
 
       if (DEBUG_WHOLE_NOTES) {
-        gLogIOstream <<
+        gLogIOstream () <<
           "--> durationLog" << " : " <<
           durationLog <<
           endl <<
@@ -12517,7 +11953,7 @@ string wholeNotesAsMsrString (
   }
 
   if (DEBUG_WHOLE_NOTES) {
-    gLogIOstream <<
+    gLogIOstream () <<
       "--> numerator " << " : " <<
       numerator <<
       endl <<
@@ -12571,7 +12007,7 @@ string wholeNotesAsMsrString (
   }
   
   if (DEBUG_WHOLE_NOTES) {
-    gLogIOstream <<
+    gLogIOstream () <<
       "--> return:" <<
       endl <<
       "  --> s.str ()     " << " : \"" << s.str () << "\"" <<
@@ -12812,7 +12248,7 @@ msrChordInterval::msrChordInterval (
   fChordIntervalRelativeOctave = chordIntervalRelativeOctave;
 
   if (TRACE_MSR_BASIC_TYPES) {
-    gLogIOstream <<
+    gLogIOstream () <<
       "==> Creating chord item '" <<
       chordIntervalAsString () <<
       "'" <<
@@ -12888,8 +12324,8 @@ S_msrChordInterval msrChordInterval::intervalDifference (
   S_msrChordInterval otherChordInterval)
 {
 #ifdef TRACE_OPTIONS
-  if (gTraceOptions->fTraceExtraChords) {
-    gLogIOstream <<
+  if (gTraceOptions ()->fTraceExtraChords) {
+    gLogIOstream () <<
       endl <<
       "--> computing intervalDifference betwwen '" <<
       asShortString () <<
@@ -12915,8 +12351,8 @@ S_msrChordInterval msrChordInterval::intervalDifference (
     normalizeInterval ();
   
 #ifdef TRACE_OPTIONS
-  if (gTraceOptions->fTraceExtraChords) {
-    gLogIOstream <<
+  if (gTraceOptions ()->fTraceExtraChords) {
+    gLogIOstream () <<
       "--> normalized operands are '" <<
       operand1->asShortString () <<
       "' and '" <<
@@ -12974,8 +12410,8 @@ S_msrChordInterval msrChordInterval::intervalDifference (
   }
 
 #ifdef TRACE_OPTIONS
-  if (gTraceOptions->fTraceExtraChords) {
-    gLogIOstream <<
+  if (gTraceOptions ()->fTraceExtraChords) {
+    gLogIOstream () <<
       "--> permuteRelativeOctaves = " <<
       booleanAsString (permuteRelativeOctaves) <<
       ", invertInterval = " <<
@@ -14152,8 +13588,8 @@ S_msrChordInterval msrChordInterval::intervalDifference (
   } // switch
 
 #ifdef TRACE_OPTIONS
-  if (gTraceOptions->fTraceExtraChords) {
-    gLogIOstream <<
+  if (gTraceOptions ()->fTraceExtraChords) {
+    gLogIOstream () <<
       "--> base resultIntervalKind = '" <<
       msrIntervalKindAsString (resultIntervalKind) <<
       "'" <<
@@ -14185,8 +13621,8 @@ S_msrChordInterval msrChordInterval::intervalDifference (
   result->deNormalizeInterval ();
 
 #ifdef TRACE_OPTIONS
-  if (gTraceOptions->fTraceExtraChords) {
-    gLogIOstream <<
+  if (gTraceOptions ()->fTraceExtraChords) {
+    gLogIOstream () <<
       "--> result = '" <<
       result->asShortString () <<
       "'" <<
@@ -15336,8 +14772,8 @@ S_msrChordInterval msrChordInterval::intervalSum (
 
 /* JMI
 void msrChordInterval::acceptIn (basevisitor* v) {
-  if (gMsrOptions->fTraceMsrVisitors) {
-    gLogIOstream <<
+  if (gMsrOptions ()->fTraceMsrVisitors) {
+    gLogIOstream () <<
       "% ==> msrChordInterval::acceptIn ()" <<
       endl;
   }
@@ -15347,8 +14783,8 @@ void msrChordInterval::acceptIn (basevisitor* v) {
       dynamic_cast<visitor<S_msrChordInterval>*> (v)) {
         S_msrChordInterval elem = this;
         
-        if (gMsrOptions->fTraceMsrVisitors) {
-          gLogIOstream <<
+        if (gMsrOptions ()->fTraceMsrVisitors) {
+          gLogIOstream () <<
             "% ==> Launching msrChordInterval::visitStart ()" <<
              endl;
         p->visitStart (elem);
@@ -15356,8 +14792,8 @@ void msrChordInterval::acceptIn (basevisitor* v) {
 }
 
 void msrChordInterval::acceptOut (basevisitor* v) {
-  if (gMsrOptions->fTraceMsrVisitors) {
-    gLogIOstream <<
+  if (gMsrOptions ()->fTraceMsrVisitors) {
+    gLogIOstream () <<
       "% ==> msrChordInterval::acceptOut ()" <<
       endl;
   }
@@ -15367,8 +14803,8 @@ void msrChordInterval::acceptOut (basevisitor* v) {
       dynamic_cast<visitor<S_msrChordInterval>*> (v)) {
         S_msrChordInterval elem = this;
       
-        if (gMsrOptions->fTraceMsrVisitors) {
-          gLogIOstream <<
+        if (gMsrOptions ()->fTraceMsrVisitors) {
+          gLogIOstream () <<
             "% ==> Launching msrChordInterval::visitEnd ()" <<
             endl;
         p->visitEnd (elem);
@@ -15419,7 +14855,7 @@ void msrChordInterval::print (ostream& os)
     "ChordInterval" <<
     endl;
 
-  gIndenter++;
+  gIndenter ()++;
 
   const int fieldWidth = 22;
   
@@ -15440,13 +14876,10 @@ void msrChordInterval::print (ostream& os)
     */
     endl;
 
-  gIndenter--;
+  gIndenter ()--;
 }
 
 //______________________________________________________________________________
-map<msrHarmonyKind, S_msrChordStructure>
-  gChordStructuresMap;
-
 S_msrChordStructure msrChordStructure::createBare (
   msrHarmonyKind chordStructureHarmonyKind)
 {
@@ -15477,7 +14910,7 @@ msrChordStructure::msrChordStructure (
   fChordStructureHarmonyKind = chordStructureHarmonyKind;
 
   if (TRACE_MSR_BASIC_TYPES) {
-    gLogIOstream <<
+    gLogIOstream () <<
       "==> Creating chord intervals '" <<
       chordStructureAsString () <<
       "'" <<
@@ -16388,8 +15821,8 @@ string msrChordStructure::chordStructureAsString () const
 
 /* JMI
 void msrChordStructure::acceptIn (basevisitor* v) {
-  if (gMsrOptions->fTraceMsrVisitors) {
-    gLogIOstream <<
+  if (gMsrOptions ()->fTraceMsrVisitors) {
+    gLogIOstream () <<
       "% ==> msrChordStructure::acceptIn ()" <<
       endl;
   }
@@ -16399,8 +15832,8 @@ void msrChordStructure::acceptIn (basevisitor* v) {
       dynamic_cast<visitor<S_msrChordStructure>*> (v)) {
         S_msrChordStructure elem = this;
         
-        if (gMsrOptions->fTraceMsrVisitors) {
-          gLogIOstream <<
+        if (gMsrOptions ()->fTraceMsrVisitors) {
+          gLogIOstream () <<
             "% ==> Launching msrChordStructure::visitStart ()" <<
              endl;
         p->visitStart (elem);
@@ -16408,8 +15841,8 @@ void msrChordStructure::acceptIn (basevisitor* v) {
 }
 
 void msrChordStructure::acceptOut (basevisitor* v) {
-  if (gMsrOptions->fTraceMsrVisitors) {
-    gLogIOstream <<
+  if (gMsrOptions ()->fTraceMsrVisitors) {
+    gLogIOstream () <<
       "% ==> msrChordStructure::acceptOut ()" <<
       endl;
   }
@@ -16419,8 +15852,8 @@ void msrChordStructure::acceptOut (basevisitor* v) {
       dynamic_cast<visitor<S_msrChordStructure>*> (v)) {
         S_msrChordStructure elem = this;
       
-        if (gMsrOptions->fTraceMsrVisitors) {
-          gLogIOstream <<
+        if (gMsrOptions ()->fTraceMsrVisitors) {
+          gLogIOstream () <<
             "% ==> Launching msrChordStructure::visitEnd ()" <<
             endl;
         p->visitEnd (elem);
@@ -16451,7 +15884,7 @@ void msrChordStructure::print (ostream& os)
     */
     endl;
 
-  gIndenter++;
+  gIndenter ()++;
     
   if (fChordStructureIntervals.size ()) {
     vector<S_msrChordInterval>::const_reverse_iterator
@@ -16463,7 +15896,7 @@ void msrChordStructure::print (ostream& os)
       S_msrChordInterval
         chordInterval = (*i);
 
-      gLogIOstream <<
+      gLogIOstream () <<
         chordInterval->chordIntervalAsShortString () <<
         endl;
 
@@ -16471,12 +15904,12 @@ void msrChordStructure::print (ostream& os)
     } // for
   }
   else {
-    gLogIOstream <<
+    gLogIOstream () <<
       "no intervals" <<
       endl;
   }
 
-  gIndenter--;
+  gIndenter ()--;
 }
 
 S_msrChordInterval msrChordStructure::bassChordIntervalForChordInversion (
@@ -16504,7 +15937,7 @@ S_msrChordInterval msrChordStructure::bassChordIntervalForChordInversion (
       "', line " << inputLineNumber;
 
     msrLimitation (
-      gXml2lyOptions->fInputSourceName,
+      gXml2lyOptions ()->fInputSourceName,
       inputLineNumber,
       __FILE__, __LINE__,
       s.str ());
@@ -16530,7 +15963,7 @@ S_msrChordStructure msrChordStructure::invertChordStructure (int inversion)
       fChordStructureIntervals.size ();
 
   if (TRACE_MSR_BASIC_TYPES) {
-    gLogIOstream <<
+    gLogIOstream () <<
       "==> invertChordStructure (), inversion = " << inversion <<
       ", original chordStructureIntervalsSize = " << chordStructureIntervalsSize <<
       endl;
@@ -16545,14 +15978,14 @@ S_msrChordStructure msrChordStructure::invertChordStructure (int inversion)
             createChordIntervalNewbornClone ();
 
       if (TRACE_MSR_BASIC_TYPES) {
-        gLogIOstream <<
+        gLogIOstream () <<
           "--> adding first item to result:" <<
           endl;
-        gIndenter++;
-        gLogIOstream <<
+        gIndenter ()++;
+        gLogIOstream () <<
           chordIntervalClone <<
           endl;
-        gIndenter--;
+        gIndenter ()--;
       }
 
       result->
@@ -16560,15 +15993,15 @@ S_msrChordStructure msrChordStructure::invertChordStructure (int inversion)
           chordIntervalClone);
 
       if (TRACE_MSR_BASIC_TYPES) {
-        gLogIOstream <<
+        gLogIOstream () <<
           "==> result chord structure after adding first item :" <<
           endl;
   
-        gIndenter++;
-        gLogIOstream <<
+        gIndenter ()++;
+        gLogIOstream () <<
           result <<
           endl;
-        gIndenter--;
+        gIndenter ()--;
       }
     } // while
     
@@ -16583,14 +16016,14 @@ S_msrChordStructure msrChordStructure::invertChordStructure (int inversion)
         incrementChordIntervalRelativeOctave ();
         
       if (TRACE_MSR_BASIC_TYPES) {
-        gLogIOstream <<
+        gLogIOstream () <<
           "--> adding last item to resultlast item :" <<
           endl;
-        gIndenter++;
-        gLogIOstream <<
+        gIndenter ()++;
+        gLogIOstream () <<
           chordIntervalClone <<
           endl;
-        gIndenter--;
+        gIndenter ()--;
       }
         
       result->
@@ -16598,15 +16031,15 @@ S_msrChordStructure msrChordStructure::invertChordStructure (int inversion)
           chordIntervalClone);
 
       if (TRACE_MSR_BASIC_TYPES) {
-        gLogIOstream <<
+        gLogIOstream () <<
           "==> result chord structure after  after adding last item:" <<
           endl;
   
-        gIndenter++;
-        gLogIOstream <<
+        gIndenter ()++;
+        gLogIOstream () <<
           result <<
           endl;
-        gIndenter--;
+        gIndenter ()--;
       }
     } // for
   }
@@ -16621,7 +16054,7 @@ void msrChordStructure::printAllChordsStructures (ostream& os)
     endl <<
     endl;
 
-  gIndenter++;
+  gIndenter ()++;
   
   for (
     msrHarmonyKind harmonyKind = kMajorHarmony;
@@ -16639,7 +16072,7 @@ void msrChordStructure::printAllChordsStructures (ostream& os)
       endl;
   } // for
 
-  gIndenter--;
+  gIndenter ()--;
 }
 
 list<msrSemiTonesPitchKind> buildSemiTonesChord (
@@ -16702,7 +16135,7 @@ msrChordPitch::msrChordPitch (
   fChordPitchRelativeOctave = chordPitchRelativeOctave;
 
   if (TRACE_MSR_BASIC_TYPES) {
-    gLogIOstream <<
+    gLogIOstream () <<
       "==> Creating chord item '" <<
       chordPitchAsString () <<
       "'" <<
@@ -16745,8 +16178,8 @@ string msrChordPitch::chordPitchAsString () const
 
 /* JMI
 void msrChordPitch::acceptIn (basevisitor* v) {
-  if (gMsrOptions->fTraceMsrVisitors) {
-    gLogIOstream <<
+  if (gMsrOptions ()->fTraceMsrVisitors) {
+    gLogIOstream () <<
       "% ==> msrChordPitch::acceptIn ()" <<
       endl;
   }
@@ -16756,8 +16189,8 @@ void msrChordPitch::acceptIn (basevisitor* v) {
       dynamic_cast<visitor<S_msrChordPitch>*> (v)) {
         S_msrChordPitch elem = this;
         
-        if (gMsrOptions->fTraceMsrVisitors) {
-          gLogIOstream <<
+        if (gMsrOptions ()->fTraceMsrVisitors) {
+          gLogIOstream () <<
             "% ==> Launching msrChordPitch::visitStart ()" <<
              endl;
         p->visitStart (elem);
@@ -16765,8 +16198,8 @@ void msrChordPitch::acceptIn (basevisitor* v) {
 }
 
 void msrChordPitch::acceptOut (basevisitor* v) {
-  if (gMsrOptions->fTraceMsrVisitors) {
-    gLogIOstream <<
+  if (gMsrOptions ()->fTraceMsrVisitors) {
+    gLogIOstream () <<
       "% ==> msrChordPitch::acceptOut ()" <<
       endl;
   }
@@ -16776,8 +16209,8 @@ void msrChordPitch::acceptOut (basevisitor* v) {
       dynamic_cast<visitor<S_msrChordPitch>*> (v)) {
         S_msrChordPitch elem = this;
       
-        if (gMsrOptions->fTraceMsrVisitors) {
-          gLogIOstream <<
+        if (gMsrOptions ()->fTraceMsrVisitors) {
+          gLogIOstream () <<
             "% ==> Launching msrChordPitch::visitEnd ()" <<
             endl;
         p->visitEnd (elem);
@@ -16800,7 +16233,7 @@ void msrChordPitch::print (ostream& os)
     "ChordPitch" <<
     endl;
 
-  gIndenter++;
+  gIndenter ()++;
 
   const int fieldWidth = 22;
   
@@ -16821,7 +16254,7 @@ void msrChordPitch::print (ostream& os)
     */
     endl;
 
-  gIndenter--;
+  gIndenter ()--;
 }
 
 //______________________________________________________________________________
@@ -16849,7 +16282,7 @@ msrChordContents::msrChordContents (
   fChordContentsHarmonyKind = chordContentsHarmonyKind;
 
   if (TRACE_MSR_BASIC_TYPES) {
-    gLogIOstream <<
+    gLogIOstream () <<
       "==> Creating chordContents '" <<
       chordContentsAsString () <<
       "'" <<
@@ -16945,7 +16378,7 @@ msrSemiTonesPitchKind msrChordContents::bassSemiTonesPitchKindForChordInversion
       "', line " << inputLineNumber;
 
     msrLimitation (
-      gXml2lyOptions->fInputSourceName,
+      gXml2lyOptions ()->fInputSourceName,
       inputLineNumber,
       __FILE__, __LINE__,
       s.str ());
@@ -16969,7 +16402,7 @@ void msrChordContents::printAllChordsContents (
   os <<
     "All the known chords contents with diatonic root '" <<
     msrQuarterTonesPitchKindAsString (
-      gLpsrOptions->
+      gLpsrOptions ()->
         fLpsrQuarterTonesPitchesLanguageKind,
       rootQuarterTonesPitchKind) <<
       /* JMI
@@ -16980,13 +16413,13 @@ void msrChordContents::printAllChordsContents (
     */
     " in language '" <<
     msrQuarterTonesPitchesLanguageKindAsString (
-      gLpsrOptions->
+      gLpsrOptions ()->
         fLpsrQuarterTonesPitchesLanguageKind) <<
     "' 'are:" <<
     endl <<
     endl;
 
-  gIndenter++;
+  gIndenter ()++;
   
   for (
     msrHarmonyKind harmonyKind = kMajorHarmony;
@@ -16998,7 +16431,7 @@ void msrChordContents::printAllChordsContents (
       ":" <<
       endl;
 
-    gIndenter++;
+    gIndenter ()++;
 
     // create the chord intervals
     S_msrChordStructure
@@ -17049,7 +16482,7 @@ void msrChordContents::printAllChordsContents (
         os << left <<
           setw (fieldWidth2) <<
           msrQuarterTonesPitchKindAsString (
-            gLpsrOptions->
+            gLpsrOptions ()->
               fLpsrQuarterTonesPitchesLanguageKind,
             noteQuarterTonesPitchKind) <<
           " : " <<
@@ -17065,16 +16498,16 @@ void msrChordContents::printAllChordsContents (
   os <<
     endl;
     
-  gIndenter--;
+  gIndenter ()--;
   } // for
 
-  gIndenter--;
+  gIndenter ()--;
 }
 
 /* JMI
 void msrChordContents::acceptIn (basevisitor* v) {
-  if (gMsrOptions->fTraceMsrVisitors) {
-    gLogIOstream <<
+  if (gMsrOptions ()->fTraceMsrVisitors) {
+    gLogIOstream () <<
       "% ==> msrChordContents::acceptIn ()" <<
       endl;
   }
@@ -17084,8 +16517,8 @@ void msrChordContents::acceptIn (basevisitor* v) {
       dynamic_cast<visitor<S_msrChordContents>*> (v)) {
         S_msrChordContents elem = this;
         
-        if (gMsrOptions->fTraceMsrVisitors) {
-          gLogIOstream <<
+        if (gMsrOptions ()->fTraceMsrVisitors) {
+          gLogIOstream () <<
             "% ==> Launching msrChordContents::visitStart ()" <<
              endl;
         p->visitStart (elem);
@@ -17093,8 +16526,8 @@ void msrChordContents::acceptIn (basevisitor* v) {
 }
 
 void msrChordContents::acceptOut (basevisitor* v) {
-  if (gMsrOptions->fTraceMsrVisitors) {
-    gLogIOstream <<
+  if (gMsrOptions ()->fTraceMsrVisitors) {
+    gLogIOstream () <<
       "% ==> msrChordContents::acceptOut ()" <<
       endl;
   }
@@ -17104,8 +16537,8 @@ void msrChordContents::acceptOut (basevisitor* v) {
       dynamic_cast<visitor<S_msrChordContents>*> (v)) {
         S_msrChordContents elem = this;
       
-        if (gMsrOptions->fTraceMsrVisitors) {
-          gLogIOstream <<
+        if (gMsrOptions ()->fTraceMsrVisitors) {
+          gLogIOstream () <<
             "% ==> Launching msrChordContents::visitEnd ()" <<
             endl;
         p->visitEnd (elem);
@@ -17131,7 +16564,7 @@ void msrChordContents::print (ostream& os)
     */
     endl;
 
-  gIndenter++;
+  gIndenter ()++;
 
   const int fieldWidth = 17;
   
@@ -17152,7 +16585,7 @@ void msrChordContents::print (ostream& os)
     ":" <<
     endl;
 
-    gIndenter++;
+    gIndenter ()++;
 
     for (unsigned int i = 0; i < fChordContentsChordPitches.size (); i++) {
       S_msrChordPitch
@@ -17164,7 +16597,7 @@ void msrChordContents::print (ostream& os)
         endl;
     } // for
     
-    gIndenter--;
+    gIndenter ()--;
   }
   else {
     os <<
@@ -17172,7 +16605,7 @@ void msrChordContents::print (ostream& os)
       endl;
   }
 
-  gIndenter--;
+  gIndenter ()--;
 }
 
 //______________________________________________________________________________
@@ -17190,7 +16623,7 @@ void printChordDetails (
   string
     rootQuarterTonesPitchKindAsString =
       msrQuarterTonesPitchKindAsString (
-        gLpsrOptions->
+        gLpsrOptions ()->
           fLpsrQuarterTonesPitchesLanguageKind,
         rootQuarterTonesPitchKind);
 
@@ -17209,7 +16642,7 @@ void printChordDetails (
     endl <<
     endl;
 
-  gIndenter++;
+  gIndenter ()++;
 
   // create the chord intervals
   S_msrChordStructure
@@ -17242,11 +16675,11 @@ void printChordDetails (
           ", initial invertedChordStructure:" <<
           endl;
 
-        gIndenter++;
+        gIndenter ()++;
         os <<
           invertedChordStructure <<
           endl;
-        gIndenter--;
+        gIndenter ()--;
       }
 
       // get the inverted chord structure intervals
@@ -17289,7 +16722,7 @@ void printChordDetails (
         " intervals:" <<
         endl;
         
-      gIndenter++;
+      gIndenter ()++;
 
       for ( ; ; ) {
         S_msrChordInterval
@@ -17327,7 +16760,7 @@ void printChordDetails (
         os << left <<
           setw (fieldWidth2) <<
           msrQuarterTonesPitchKindAsString (
-            gLpsrOptions->
+            gLpsrOptions ()->
               fLpsrQuarterTonesPitchesLanguageKind,
             noteQuarterTonesPitchKind) <<
             /* JMI
@@ -17344,14 +16777,14 @@ void printChordDetails (
         // no endl here
       } // for
 
-      gIndenter--;
+      gIndenter ()--;
   
       os <<
         endl;
     } // for
   }
 
-  gIndenter--;
+  gIndenter ()--;
 }
 
 //______________________________________________________________________________
@@ -17370,7 +16803,7 @@ void printChordAnalysis (
   string
     rootQuarterTonesPitchKindAsString =
       msrQuarterTonesPitchKindAsString (
-        gLpsrOptions->
+        gLpsrOptions ()->
           fLpsrQuarterTonesPitchesLanguageKind,
         rootQuarterTonesPitchKind);
 
@@ -17391,7 +16824,7 @@ void printChordAnalysis (
     endl <<
     endl;
 
-  gIndenter++;
+  gIndenter ()++;
 
   // create the chord intervals
   S_msrChordStructure
@@ -17424,11 +16857,11 @@ void printChordAnalysis (
           ", initial invertedChordStructure:" <<
           endl;
 
-        gIndenter++;
+        gIndenter ()++;
         os <<
           invertedChordStructure <<
           endl;
-        gIndenter--;
+        gIndenter ()--;
       }
 
       // get the inverted chord structure intervals
@@ -17461,7 +16894,7 @@ void printChordAnalysis (
           " intervals:" <<
           endl;
           
-        gIndenter++;
+        gIndenter ()++;
   
         vector<S_msrChordInterval>::const_reverse_iterator
           iBegin = invertedChordStructureIntervals.crbegin (),
@@ -17497,7 +16930,7 @@ void printChordAnalysis (
           os << left <<
             setw (fieldWidth2) <<
             msrQuarterTonesPitchKindAsString (
-              gLpsrOptions->
+              gLpsrOptions ()->
                 fLpsrQuarterTonesPitchesLanguageKind,
               noteQuarterTonesPitchKind) <<
             " : " <<
@@ -17509,7 +16942,7 @@ void printChordAnalysis (
           // no endl here
         } // for
   
-        gIndenter--;
+        gIndenter ()--;
     
         os <<
           endl;
@@ -17537,7 +16970,7 @@ void printChordAnalysis (
           " inner intervals:" <<
           endl;
         
-        gIndenter++;
+        gIndenter ()++;
 
         int tritonsCounter = 0;
         
@@ -17623,14 +17056,14 @@ void printChordAnalysis (
             } // switch
                 
             // print it
-            gIndenter++;
+            gIndenter ()++;
 
             const int fieldWidth2 = 20;
 
             os << left <<
               setw (fieldWidth1) <<
               msrQuarterTonesPitchKindAsString (
-                gLpsrOptions->
+                gLpsrOptions ()->
                   fLpsrQuarterTonesPitchesLanguageKind,
                 noteQuarterTonesPitchKind1) <<
               
@@ -17638,7 +17071,7 @@ void printChordAnalysis (
               
               setw (fieldWidth1) <<
               msrQuarterTonesPitchKindAsString (
-                gLpsrOptions->
+                gLpsrOptions ()->
                   fLpsrQuarterTonesPitchesLanguageKind,
                 noteQuarterTonesPitchKind2) <<
 
@@ -17656,7 +17089,7 @@ void printChordAnalysis (
 
               endl;
 
-            gIndenter--;
+            gIndenter ()--;
                   
             if (++i2 == iEnd2) break;
           } // for
@@ -17667,7 +17100,7 @@ void printChordAnalysis (
             endl;
         } // for
   
-        gIndenter--;
+        gIndenter ()--;
     
 
         if (tritonsCounter > 0) {
@@ -17699,7 +17132,7 @@ void printChordAnalysis (
     }
   }
 
-  gIndenter--;
+  gIndenter ()--;
 }
 
 //______________________________________________________________________________
@@ -17728,11 +17161,9 @@ void initializeMSRBasicTypes ()
   // ------------------------------------------------------
 
   initializeQuarterTonesPitchesLanguageKinds ();
-  
-  // chord structures handling
-  // ------------------------------------------------------
 
-  initializeChordStructuresMap ();
+  // the chord structures are built on first use,
+  // see chordStructuresMap ()
 }
 
 
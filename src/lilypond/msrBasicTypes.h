@@ -1103,29 +1103,15 @@ string msrScoreNotationKindAsString (
 //______________________________________________________________________________
 // global variables
 
-extern map<msrHarmonyKind, S_msrChordStructure>
-  gChordStructuresMap;
-
-void initializeChordStructuresMap ();
+// the chord structures of all the harmony kinds, built on first use
+const map<msrHarmonyKind, S_msrChordStructure>&
+  chordStructuresMap ();
 
 void printChordStructuresMap ();
 
 extern map<string, msrQuarterTonesPitchesLanguageKind>
   gQuarterTonesPitchesLanguageKindsMap;
 
-extern map<msrQuarterTonesPitchKind, string> gNederlandsPitchNamesMap;
-extern map<msrQuarterTonesPitchKind, string> gCatalanPitchNamesMap;
-extern map<msrQuarterTonesPitchKind, string> gDeutschPitchNamesMap;
-extern map<msrQuarterTonesPitchKind, string> gEnglishPitchNamesMap;
-extern map<msrQuarterTonesPitchKind, string> gEspanolPitchNamesMap;
-extern map<msrQuarterTonesPitchKind, string> gFrancaisPitchNamesMap;
-extern map<msrQuarterTonesPitchKind, string> gItalianoPitchNamesMap;
-extern map<msrQuarterTonesPitchKind, string> gNorskPitchNamesMap;
-extern map<msrQuarterTonesPitchKind, string> gPortuguesPitchNamesMap;
-extern map<msrQuarterTonesPitchKind, string> gSuomiPitchNamesMap;
-extern map<msrQuarterTonesPitchKind, string> gSvenskaPitchNamesMap;
-extern map<msrQuarterTonesPitchKind, string> gVlaamsPitchNamesMap;
-
 void initializeQuarterTonesPitchesLanguageKinds ();
 
 string existingQuarterTonesPitchesLanguageKinds ();
@@ -54,8 +54,8 @@ msrBeam::msrBeam (
   fBeamKind   = beamKind; 
 
 #ifdef TRACE_OPTIONS
-  if (gTraceOptions->fTraceBeams) {
-    gLogIOstream <<
+  if (gTraceOptions ()->fTraceBeams) {
+    gLogIOstream () <<
       "Creating beam '" <<
       this->asString () <<
       "'" <<
@@ -69,8 +69,8 @@ msrBeam::~msrBeam ()
 
 void msrBeam::acceptIn (basevisitor* v)
 {
-  if (gMsrOptions->fTraceMsrVisitors) {
-    gLogIOstream <<
+  if (gMsrOptions ()->fTraceMsrVisitors) {
+    gLogIOstream () <<
       "% ==> msrBeam::acceptIn ()" <<
       endl;
   }
@@ -80,8 +80,8 @@ void msrBeam::acceptIn (basevisitor* v)
       dynamic_cast<visitor<S_msrBeam>*> (v)) {
         S_msrBeam elem = this;
         
-        if (gMsrOptions->fTraceMsrVisitors) {
-          gLogIOstream <<
+        if (gMsrOptions ()->fTraceMsrVisitors) {
+          gLogIOstream () <<
             "% ==> Launching msrBeam::visitStart ()" <<
             endl;
         }
@@ -91,8 +91,8 @@ void msrBeam::acceptIn (basevisitor* v)
 
 void msrBeam::acceptOut (basevisitor* v)
 {
-  if (gMsrOptions->fTraceMsrVisitors) {
-    gLogIOstream <<
+  if (gMsrOptions ()->fTraceMsrVisitors) {
+    gLogIOstream () <<
       "% ==> msrBeam::acceptOut ()" <<
       endl;
   }
@@ -102,8 +102,8 @@ void msrBeam::acceptOut (basevisitor* v)
       dynamic_cast<visitor<S_msrBeam>*> (v)) {
         S_msrBeam elem = this;
       
-        if (gMsrOptions->fTraceMsrVisitors) {
-          gLogIOstream <<
+        if (gMsrOptions ()->fTraceMsrVisitors) {
+          gLogIOstream () <<
             "% ==> Launching msrBeam::visitEnd ()" <<
             endl;
         }
@@ -51,8 +51,8 @@ msrLineBreak::msrLineBreak (
   fNextBarNumber = nextBarNumber; 
 
 #ifdef TRACE_OPTIONS
-  if (gTraceOptions->fTraceMeasures) {
-    gLogIOstream <<
+  if (gTraceOptions ()->fTraceMeasures) {
+    gLogIOstream () <<
       "Creating a break before measure " << fNextBarNumber <<
       endl;
   }
@@ -75,8 +75,8 @@ string msrLineBreak::asString () const
 
 void msrLineBreak::acceptIn (basevisitor* v)
 {
-  if (gMsrOptions->fTraceMsrVisitors) {
-    gLogIOstream <<
+  if (gMsrOptions ()->fTraceMsrVisitors) {
+    gLogIOstream () <<
       "% ==> msrLineBreak::acceptIn ()" <<
       endl;
   }
@@ -86,8 +86,8 @@ void msrLineBreak::acceptIn (basevisitor* v)
       dynamic_cast<visitor<S_msrLineBreak>*> (v)) {
         S_msrLineBreak elem = this;
         
-        if (gMsrOptions->fTraceMsrVisitors) {
-          gLogIOstream <<
+        if (gMsrOptions ()->fTraceMsrVisitors) {
+          gLogIOstream () <<
             "% ==> Launching msrLineBreak::visitStart ()" <<
             endl;
         }
@@ -97,8 +97,8 @@ void msrLineBreak::acceptIn (basevisitor* v)
 
 void msrLineBreak::acceptOut (basevisitor* v)
 {
-  if (gMsrOptions->fTraceMsrVisitors) {
-    gLogIOstream <<
+  if (gMsrOptions ()->fTraceMsrVisitors) {
+    gLogIOstream () <<
       "% ==> msrLineBreak::acceptOut ()" <<
       endl;
   }
@@ -108,8 +108,8 @@ void msrLineBreak::acceptOut (basevisitor* v)
       dynamic_cast<visitor<S_msrLineBreak>*> (v)) {
         S_msrLineBreak elem = this;
       
-        if (gMsrOptions->fTraceMsrVisitors) {
-          gLogIOstream <<
+        if (gMsrOptions ()->fTraceMsrVisitors) {
+          gLogIOstream () <<
             "% ==> Launching msrLineBreak::visitEnd ()" <<
             endl;
         }
@@ -149,8 +149,8 @@ msrPageBreak::msrPageBreak (
     : msrElement (inputLineNumber)
 {
 #ifdef TRACE_OPTIONS
-  if (gTraceOptions->fTraceMeasures) {
-    gLogIOstream <<
+  if (gTraceOptions ()->fTraceMeasures) {
+    gLogIOstream () <<
       "Creating a page break" <<
       endl;
   }
@@ -172,8 +172,8 @@ string msrPageBreak::asString () const
 
 void msrPageBreak::acceptIn (basevisitor* v)
 {
-  if (gMsrOptions->fTraceMsrVisitors) {
-    gLogIOstream <<
+  if (gMsrOptions ()->fTraceMsrVisitors) {
+    gLogIOstream () <<
       "% ==> msrPageBreak::acceptIn ()" <<
       endl;
   }
@@ -183,8 +183,8 @@ void msrPageBreak::acceptIn (basevisitor* v)
       dynamic_cast<visitor<S_msrPageBreak>*> (v)) {
         S_msrPageBreak elem = this;
         
-        if (gMsrOptions->fTraceMsrVisitors) {
-          gLogIOstream <<
+        if (gMsrOptions ()->fTraceMsrVisitors) {
+          gLogIOstream () <<
             "% ==> Launching msrPageBreak::visitStart ()" <<
             endl;
         }
@@ -194,8 +194,8 @@ void msrPageBreak::acceptIn (basevisitor* v)
 
 void msrPageBreak::acceptOut (basevisitor* v)
 {
-  if (gMsrOptions->fTraceMsrVisitors) {
-    gLogIOstream <<
+  if (gMsrOptions ()->fTraceMsrVisitors) {
+    gLogIOstream () <<
       "% ==> msrPageBreak::acceptOut ()" <<
       endl;
   }
@@ -205,8 +205,8 @@ void msrPageBreak::acceptOut (basevisitor* v)
       dynamic_cast<visitor<S_msrPageBreak>*> (v)) {
         S_msrPageBreak elem = this;
       
-        if (gMsrOptions->fTraceMsrVisitors) {
-          gLogIOstream <<
+        if (gMsrOptions ()->fTraceMsrVisitors) {
+          gLogIOstream () <<
             "% ==> Launching msrPageBreak::visitEnd ()" <<
             endl;
         }
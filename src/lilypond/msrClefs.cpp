@@ -85,8 +85,8 @@ bool msrClef::isEqualTo (S_msrClef otherClef) const
 
 void msrClef::acceptIn (basevisitor* v)
 {
-  if (gMsrOptions->fTraceMsrVisitors) {
-    gLogIOstream <<
+  if (gMsrOptions ()->fTraceMsrVisitors) {
+    gLogIOstream () <<
       "% ==> msrClef::acceptIn ()" <<
       endl;
   }
@@ -96,8 +96,8 @@ void msrClef::acceptIn (basevisitor* v)
       dynamic_cast<visitor<S_msrClef>*> (v)) {
         S_msrClef elem = this;
         
-        if (gMsrOptions->fTraceMsrVisitors) {
-          gLogIOstream <<
+        if (gMsrOptions ()->fTraceMsrVisitors) {
+          gLogIOstream () <<
             "% ==> Launching msrClef::visitStart ()" <<
             endl;
         }
@@ -107,8 +107,8 @@ void msrClef::acceptIn (basevisitor* v)
 
 void msrClef::acceptOut (basevisitor* v)
 {
-  if (gMsrOptions->fTraceMsrVisitors) {
-    gLogIOstream <<
+  if (gMsrOptions ()->fTraceMsrVisitors) {
+    gLogIOstream () <<
       "% ==> msrClef::acceptOut ()" <<
       endl;
   }
@@ -118,8 +118,8 @@ void msrClef::acceptOut (basevisitor* v)
       dynamic_cast<visitor<S_msrClef>*> (v)) {
         S_msrClef elem = this;
       
-        if (gMsrOptions->fTraceMsrVisitors) {
-          gLogIOstream <<
+        if (gMsrOptions ()->fTraceMsrVisitors) {
+          gLogIOstream () <<
             "% ==> Launching msrClef::visitEnd ()" <<
             endl;
         }
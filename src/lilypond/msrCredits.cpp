@@ -82,8 +82,8 @@ msrCreditWords::~msrCreditWords ()
 
 void msrCreditWords::acceptIn (basevisitor* v)
 {
-  if (gMsrOptions->fTraceMsrVisitors) {
-    gLogIOstream <<
+  if (gMsrOptions ()->fTraceMsrVisitors) {
+    gLogIOstream () <<
       "% ==> msrCreditWords::acceptIn ()" <<
       endl;
   }
@@ -93,8 +93,8 @@ void msrCreditWords::acceptIn (basevisitor* v)
       dynamic_cast<visitor<S_msrCreditWords>*> (v)) {
         S_msrCreditWords elem = this;
         
-        if (gMsrOptions->fTraceMsrVisitors) {
-          gLogIOstream <<
+        if (gMsrOptions ()->fTraceMsrVisitors) {
+          gLogIOstream () <<
             "% ==> Launching msrCreditWords::visitStart ()" <<
             endl;
         }
@@ -104,8 +104,8 @@ void msrCreditWords::acceptIn (basevisitor* v)
 
 void msrCreditWords::acceptOut (basevisitor* v)
 {
-  if (gMsrOptions->fTraceMsrVisitors) {
-    gLogIOstream <<
+  if (gMsrOptions ()->fTraceMsrVisitors) {
+    gLogIOstream () <<
       "% ==> msrCreditWords::acceptOut ()" <<
       endl;
   }
@@ -115,8 +115,8 @@ void msrCreditWords::acceptOut (basevisitor* v)
       dynamic_cast<visitor<S_msrCreditWords>*> (v)) {
         S_msrCreditWords elem = this;
       
-        if (gMsrOptions->fTraceMsrVisitors) {
-          gLogIOstream <<
+        if (gMsrOptions ()->fTraceMsrVisitors) {
+          gLogIOstream () <<
             "% ==> Launching msrCreditWords::visitEnd ()" <<
             endl;
         }
@@ -133,7 +133,7 @@ void msrCreditWords::print (ostream& os)
     "CreditWords" <<
     endl;
 
-  gIndenter++;
+  gIndenter ()++;
 
   const int fieldWidth = 27;
   
@@ -178,7 +178,7 @@ void msrCreditWords::print (ostream& os)
     "\"" <<
     endl;
 
-  gIndenter--;
+  gIndenter ()--;
 }
 
 ostream& operator<< (ostream& os, const S_msrCreditWords& elt)
@@ -218,8 +218,8 @@ void msrCredit::appendCreditWordsToCredit (
 
 void msrCredit::acceptIn (basevisitor* v)
 {
-  if (gMsrOptions->fTraceMsrVisitors) {
-    gLogIOstream <<
+  if (gMsrOptions ()->fTraceMsrVisitors) {
+    gLogIOstream () <<
       "% ==> msrCredit::acceptIn ()" <<
       endl;
   }
@@ -229,8 +229,8 @@ void msrCredit::acceptIn (basevisitor* v)
       dynamic_cast<visitor<S_msrCredit>*> (v)) {
         S_msrCredit elem = this;
         
-        if (gMsrOptions->fTraceMsrVisitors) {
-          gLogIOstream <<
+        if (gMsrOptions ()->fTraceMsrVisitors) {
+          gLogIOstream () <<
             "% ==> Launching msrCredit::visitStart ()" <<
             endl;
         }
@@ -240,8 +240,8 @@ void msrCredit::acceptIn (basevisitor* v)
 
 void msrCredit::acceptOut (basevisitor* v)
 {
-  if (gMsrOptions->fTraceMsrVisitors) {
-    gLogIOstream <<
+  if (gMsrOptions ()->fTraceMsrVisitors) {
+    gLogIOstream () <<
       "% ==> msrCredit::acceptOut ()" <<
       endl;
   }
@@ -251,8 +251,8 @@ void msrCredit::acceptOut (basevisitor* v)
       dynamic_cast<visitor<S_msrCredit>*> (v)) {
         S_msrCredit elem = this;
       
-        if (gMsrOptions->fTraceMsrVisitors) {
-          gLogIOstream <<
+        if (gMsrOptions ()->fTraceMsrVisitors) {
+          gLogIOstream () <<
             "% ==> Launching msrCredit::visitEnd ()" <<
             endl;
         }
@@ -308,7 +308,7 @@ void msrCredit::print (ostream& os)
     "Credit" <<
     endl;
 
-  gIndenter++;
+  gIndenter ()++;
   
   os <<
     "fCreditPageNumber" << " : " << fCreditPageNumber <<
@@ -327,7 +327,7 @@ void msrCredit::print (ostream& os)
     } // for
   }
   
-  gIndenter--;
+  gIndenter ()--;
 }
 
 ostream& operator<< (ostream& os, const S_msrCredit& elt)
@@ -50,8 +50,8 @@ S_msrDivisions msrDivisions::create (
 S_msrDivisions msrDivisions::createDivisionsNewbornClone ()
 {
 #ifdef TRACE_OPTIONS
- if (gTraceOptions->fTraceDivisions) {
-    gLogIOstream <<
+ if (gTraceOptions ()->fTraceDivisions) {
+    gLogIOstream () <<
       "Creating a newborn clone of divisions '" <<
       divisionsAsString () <<
       "'" <<
@@ -83,8 +83,8 @@ msrDivisions::msrDivisions (
 void msrDivisions::initializeDivisions ()
 {
 #ifdef TRACE_OPTIONS
-  if (gTraceOptions->fTraceDivisions) {
-  gLogIOstream <<
+  if (gTraceOptions ()->fTraceDivisions) {
+  gLogIOstream () <<
     "Initializing divisions" <<
     ", divisionsPerQuarterNote = " << fDivisionsPerQuarterNote <<
     ", line " << fInputLineNumber <<
@@ -92,7 +92,7 @@ void msrDivisions::initializeDivisions ()
   }
 #endif
 
-  gIndenter++;
+  gIndenter ()++;
   
   // forget fDurationsToDivisions's contents
   fDurationKindsToDivisions.clear ();
@@ -102,7 +102,7 @@ void msrDivisions::initializeDivisions ()
   
   for (int i = kQuarter; i >= kMaxima; i--) {
     /*
-    gLogIOstream <<
+    gLogIOstream () <<
       msrDurationAsString (msrDuration (i)) <<
       " -> " <<
       bigDivisions <<
@@ -127,7 +127,7 @@ void msrDivisions::initializeDivisions ()
     
     while (smallDivisions >= 1) {
       /*
-      gLogIOstream <<
+      gLogIOstream () <<
         msrDurationAsString (currentDuration) <<
         " % --> " <<
         smallDivisions <<
@@ -146,12 +146,12 @@ void msrDivisions::initializeDivisions ()
 
   // print the durations divisions if needed
 #ifdef TRACE_OPTIONS
-  if (gTraceOptions->fTraceDivisions) {
-    printDurationKindsDivisions (gLogIOstream);
+  if (gTraceOptions ()->fTraceDivisions) {
+    printDurationKindsDivisions (gLogIOstream ());
   }
 #endif
 
-  gIndenter--;
+  gIndenter ()--;
 }
 
 int msrDivisions::durationKindAsDivisions (
@@ -179,7 +179,7 @@ int msrDivisions::durationKindAsDivisions (
   printDurationKindsDivisions (s);
   
   msrInternalError (
-    gXml2lyOptions->fInputSourceName,
+    gXml2lyOptions ()->fInputSourceName,
     inputLineNumber,
     __FILE__, __LINE__,
     s.str ());
@@ -195,7 +195,7 @@ void msrDivisions::printDurationKindsDivisions (ostream& os)
     " is:" <<
     endl;
 
-  gIndenter++;
+  gIndenter ()++;
   
   if (fDurationKindsToDivisions.size ()) {
     list<pair<msrDurationKind, int> >::const_iterator
@@ -241,7 +241,7 @@ void msrDivisions::printDurationKindsDivisions (ostream& os)
 
   os << endl;
 
-  gIndenter--;
+  gIndenter ()--;
 }
 
 string msrDivisions::divisionsAsMsrString (
@@ -257,14 +257,14 @@ string msrDivisions::divisionsAsMsrString (
   const int fieldWidth = 22;
   
 #ifdef TRACE_OPTIONS
-  if (gTraceOptions->fTraceDivisions) {
-    gLogIOstream <<
+  if (gTraceOptions ()->fTraceDivisions) {
+    gLogIOstream () <<
      "--> divisionsAsMsrString ():" <<
       endl <<
-      gTab << setw (fieldWidth) <<
+      gTab () << setw (fieldWidth) <<
       "inputLineNumber" << " = " << inputLineNumber <<
       endl <<
-      gTab << setw (fieldWidth) <<
+      gTab () << setw (fieldWidth) <<
       "divisions" << " = " << divisions <<
       endl;
   }
@@ -288,10 +288,10 @@ string msrDivisions::divisionsAsMsrString (
         " could not be handled by divisionsAsMsrString () with:" <<
         endl;
 
-      printDurationKindsDivisions (gLogIOstream);
+      printDurationKindsDivisions (gLogIOstream ());
 
       msrInternalError (
-        gXml2lyOptions->fInputSourceName,
+        gXml2lyOptions ()->fInputSourceName,
         inputLineNumber,
         __FILE__, __LINE__,
         s.str ());
@@ -307,16 +307,16 @@ string msrDivisions::divisionsAsMsrString (
         msrDurationKindAsString (baseDurationKind);
       
 #ifdef TRACE_OPTIONS
-      if (gTraceOptions->fTraceDivisions) {
-        gLogIOstream <<
-            gTab << setw (fieldWidth) <<
+      if (gTraceOptions ()->fTraceDivisions) {
+        gLogIOstream () <<
+            gTab () << setw (fieldWidth) <<
           "divisions" << " = " << divisions <<
           endl <<
           endl <<
-            gTab << setw (fieldWidth) <<
+            gTab () << setw (fieldWidth) <<
           "baseDurationDivisions" << " = " << baseDurationDivisions <<
           endl <<
-            gTab << setw (fieldWidth) <<
+            gTab () << setw (fieldWidth) <<
           "result" << " = " << result <<
           endl <<
           endl;
@@ -342,18 +342,18 @@ string msrDivisions::divisionsAsMsrString (
       baseDurationDivisions / 2;
 
 #ifdef TRACE_OPTIONS
-    if (gTraceOptions->fTraceDivisions) {
-      gLogIOstream <<
-        gTab << setw (fieldWidth) <<
+    if (gTraceOptions ()->fTraceDivisions) {
+      gLogIOstream () <<
+        gTab () << setw (fieldWidth) <<
         "divisions" << " = " << divisions <<
         endl <<
-        gTab << setw (fieldWidth) <<
+        gTab () << setw (fieldWidth) <<
       "baseDurationDivisions" << " = " << baseDurationDivisions <<
         endl <<
-        gTab << setw (fieldWidth) <<
+        gTab () << setw (fieldWidth) <<
       "nextDivisionsInList" << " = " << nextDivisionsInList <<
         endl <<
-        gTab << setw (fieldWidth) <<
+        gTab () << setw (fieldWidth) <<
       "remainingDivisions" << " = " << remainingDivisions <<
         endl <<
         endl;
@@ -368,15 +368,15 @@ string msrDivisions::divisionsAsMsrString (
       r.rationalise ();
 
 #ifdef TRACE_OPTIONS
-      if (gTraceOptions->fTraceDivisions) { // JMI
-        gLogIOstream <<
-          gTab << setw (fieldWidth) <<
+      if (gTraceOptions ()->fTraceDivisions) { // JMI
+        gLogIOstream () <<
+          gTab () << setw (fieldWidth) <<
           "divisions" << " = " << divisions <<
           endl <<
-          gTab << setw (fieldWidth) <<
+          gTab () << setw (fieldWidth) <<
           "baseDurationDivisions" << " = " << baseDurationDivisions <<
           endl <<
-          gTab << setw (fieldWidth) <<
+          gTab () << setw (fieldWidth) <<
           "r" << " = " << r <<
           endl <<
           endl;
@@ -396,21 +396,21 @@ string msrDivisions::divisionsAsMsrString (
         nextDivisionsInList /= 2;
   
 #ifdef TRACE_OPTIONS
-        if (gTraceOptions->fTraceDivisions) {
-          gLogIOstream <<
-            gTab << setw (fieldWidth) <<
+        if (gTraceOptions ()->fTraceDivisions) {
+          gLogIOstream () <<
+            gTab () << setw (fieldWidth) <<
             "divisions" << " = " << divisions <<
             endl <<
-            gTab << setw (fieldWidth) <<
+            gTab () << setw (fieldWidth) <<
             "baseDurationDivisions" << " = " << baseDurationDivisions <<
             endl <<
-            gTab << setw (fieldWidth) <<
+            gTab () << setw (fieldWidth) <<
             "nextDivisionsInList" << " = " << nextDivisionsInList <<
             endl <<
-            gTab << setw (fieldWidth) <<
+            gTab () << setw (fieldWidth) <<
             "remainingDivisions" << " = " << remainingDivisions <<
             endl <<
-            gTab << setw (fieldWidth) <<
+            gTab () << setw (fieldWidth) <<
             "dotsNumber" << " = " << dotsNumber <<
             endl <<
             endl;
@@ -423,21 +423,21 @@ string msrDivisions::divisionsAsMsrString (
       } // while
   
 #ifdef TRACE_OPTIONS
-      if (gTraceOptions->fTraceDivisions) {
-        gLogIOstream <<
-          gTab << setw (fieldWidth) <<
+      if (gTraceOptions ()->fTraceDivisions) {
+        gLogIOstream () <<
+          gTab () << setw (fieldWidth) <<
           "divisions" << " = " << divisions <<
           endl <<
-          gTab << setw (fieldWidth) <<
+          gTab () << setw (fieldWidth) <<
           "baseDurationDivisions" << " = " << baseDurationDivisions <<
           endl <<
-          gTab << setw (fieldWidth) <<
+          gTab () << setw (fieldWidth) <<
           "nextDivisionsInList" << " = " << nextDivisionsInList <<
           endl <<
-          gTab << setw (fieldWidth) <<
+          gTab () << setw (fieldWidth) <<
           "remainingDivisions" << " = " << remainingDivisions <<
           endl <<
-          gTab << setw (fieldWidth) <<
+          gTab () << setw (fieldWidth) <<
           "dotsNumber" << " = " << dotsNumber <<
           endl <<
           endl;
@@ -455,8 +455,8 @@ string msrDivisions::divisionsAsMsrString (
   numberOfDotsNeeded = dotsNumber;
 
 #ifdef TRACE_OPTIONS
-  if (gTraceOptions->fTraceDivisions) {
-    gLogIOstream <<
+  if (gTraceOptions ()->fTraceDivisions) {
+    gLogIOstream () <<
       "<-- divisionsAsMsrString (): returns " << result <<
       endl <<
       endl;
@@ -480,15 +480,15 @@ string msrDivisions::wholeNotesAsMsrString (
   const int fieldWidth = 22;
   
 #ifdef TRACE_OPTIONS
-  if (gTraceOptions->fTraceDivisions) {
-    gLogIOstream << left <<
+  if (gTraceOptions ()->fTraceDivisions) {
+    gLogIOstream () << left <<
       endl <<
       "--> wholeNotesAsMsrString ():" <<
       endl <<
-      gTab << setw (fieldWidth) <<
+      gTab () << setw (fieldWidth) <<
       "inputLineNumber" << " = " << inputLineNumber <<
       endl <<
-      gTab << setw (fieldWidth) <<
+      gTab () << setw (fieldWidth) <<
       "wholeNotes" << " = " << wholeNotes <<
       endl <<
       endl;
@@ -508,9 +508,9 @@ string msrDivisions::wholeNotesAsMsrString (
     wholeNotes.getDenominator ();      
   
 #ifdef TRACE_OPTIONS
-  if (gTraceOptions->fTraceDivisions) {
-    gLogIOstream << left <<
-      gTab << "divisions" << " = " << divisions <<
+  if (gTraceOptions ()->fTraceDivisions) {
+    gLogIOstream () << left <<
+      gTab () << "divisions" << " = " << divisions <<
       endl;
   }
 #endif
@@ -533,10 +533,10 @@ string msrDivisions::wholeNotesAsMsrString (
         " could not be handled by wholeNotesAsMsrString () with:" <<
         endl;
 
-      printDurationKindsDivisions (gLogIOstream);
+      printDurationKindsDivisions (gLogIOstream ());
 
       msrInternalError (
-        gXml2lyOptions->fInputSourceName,
+        gXml2lyOptions ()->fInputSourceName,
         inputLineNumber,
         __FILE__, __LINE__,
         s.str ());
@@ -552,20 +552,20 @@ string msrDivisions::wholeNotesAsMsrString (
         msrDurationKindAsString (baseDurationKind);
       
 #ifdef TRACE_OPTIONS
-      if (gTraceOptions->fTraceDivisions) {
-        gLogIOstream << left <<
-          gTab << setw (fieldWidth) <<
+      if (gTraceOptions ()->fTraceDivisions) {
+        gLogIOstream () << left <<
+          gTab () << setw (fieldWidth) <<
           "divisions" << " = " << divisions <<
           endl <<
-          gTab << setw (fieldWidth) <<
+          gTab () << setw (fieldWidth) <<
           "baseDuration" << " = " <<
           msrDurationKindAsString (baseDurationKind) <<
           endl <<
-          gTab << setw (fieldWidth) <<
+          gTab () << setw (fieldWidth) <<
           "baseDurationDivisions" << " = " <<
           baseDurationDivisions <<
           endl <<
-          gTab << setw (fieldWidth) <<
+          gTab () << setw (fieldWidth) <<
           "result" << " = " << result <<
           endl <<
           endl;
@@ -590,18 +590,18 @@ string msrDivisions::wholeNotesAsMsrString (
       baseDurationDivisions / 2;
 
 #ifdef TRACE_OPTIONS
-    if (gTraceOptions->fTraceDivisions) {
-      gLogIOstream << left <<
-        gTab << setw (fieldWidth) <<
+    if (gTraceOptions ()->fTraceDivisions) {
+      gLogIOstream () << left <<
+        gTab () << setw (fieldWidth) <<
         "divisions" << " = " << divisions <<
         endl <<
-        gTab << setw (fieldWidth) <<
+        gTab () << setw (fieldWidth) <<
         "baseDurationDivisions" << " = " << baseDurationDivisions <<
         endl <<
-        gTab << setw (fieldWidth) <<
+        gTab () << setw (fieldWidth) <<
         "nextDivisionsInList" << " = " << nextDivisionsInList <<
         endl <<
-        gTab << setw (fieldWidth) <<
+        gTab () << setw (fieldWidth) <<
         "remainingDivisions" << " = " << remainingDivisions <<
         endl <<
         endl;
@@ -616,15 +616,15 @@ string msrDivisions::wholeNotesAsMsrString (
       r.rationalise ();
 
 #ifdef TRACE_OPTIONS
-      if (gTraceOptions->fTraceDivisions) {
-        gLogIOstream << left <<
-          gTab << setw (fieldWidth) <<
+      if (gTraceOptions ()->fTraceDivisions) {
+        gLogIOstream () << left <<
+          gTab () << setw (fieldWidth) <<
           "divisions" << " = " << divisions <<
           endl <<
-          gTab << setw (fieldWidth) <<
+          gTab () << setw (fieldWidth) <<
           "baseDurationDivisions" << " = " << baseDurationDivisions <<
           endl <<
-          gTab << setw (fieldWidth) <<
+          gTab () << setw (fieldWidth) <<
           "r" << " = " << r <<
           endl <<
         endl;
@@ -644,21 +644,21 @@ string msrDivisions::wholeNotesAsMsrString (
         nextDivisionsInList /= 2;
   
 #ifdef TRACE_OPTIONS
-        if (gTraceOptions->fTraceDivisions) {
-          gLogIOstream << left <<
-            gTab << setw (fieldWidth) <<
+        if (gTraceOptions ()->fTraceDivisions) {
+          gLogIOstream () << left <<
+            gTab () << setw (fieldWidth) <<
             "divisions" << " = " << divisions <<
             endl <<
-            gTab << setw (fieldWidth) <<
+            gTab () << setw (fieldWidth) <<
             "baseDurationDivisions" << " = " << baseDurationDivisions <<
             endl <<
-            gTab << setw (fieldWidth) <<
+            gTab () << setw (fieldWidth) <<
             "nextDivisionsInList" << " = " << nextDivisionsInList <<
             endl <<
-            gTab << setw (fieldWidth) <<
+            gTab () << setw (fieldWidth) <<
             "remainingDivisions" << " = " << remainingDivisions <<
             endl <<
-            gTab << setw (fieldWidth) <<
+            gTab () << setw (fieldWidth) <<
             "dotsNumber" << " = " << dotsNumber <<
             endl <<
             endl;
@@ -671,21 +671,21 @@ string msrDivisions::wholeNotesAsMsrString (
       } // while
   
 #ifdef TRACE_OPTIONS
-      if (gTraceOptions->fTraceDivisions) {
-        gLogIOstream << left <<
-          gTab << setw (fieldWidth) <<
+      if (gTraceOptions ()->fTraceDivisions) {
+        gLogIOstream () << left <<
+          gTab () << setw (fieldWidth) <<
           "divisions" << " = " << divisions <<
           endl <<
-          gTab << setw (fieldWidth) <<
+          gTab () << setw (fieldWidth) <<
           "baseDurationDivisions" << " = " << baseDurationDivisions <<
           endl <<
-          gTab << setw (fieldWidth) <<
+          gTab () << setw (fieldWidth) <<
           "nextDivisionsInList" << " = " << nextDivisionsInList <<
           endl <<
-          gTab << setw (fieldWidth) <<
+          gTab () << setw (fieldWidth) <<
           "remainingDivisions" << " = " << remainingDivisions <<
           endl <<
-          gTab << setw (fieldWidth) <<
+          gTab () << setw (fieldWidth) <<
           "dotsNumber" << " = " << dotsNumber <<
           endl <<
           endl;
@@ -703,8 +703,8 @@ string msrDivisions::wholeNotesAsMsrString (
   numberOfDotsNeeded = dotsNumber;
 
 #ifdef TRACE_OPTIONS
-  if (gTraceOptions->fTraceDivisions) {
-    gLogIOstream <<
+  if (gTraceOptions ()->fTraceDivisions) {
+    gLogIOstream () <<
       "<-- wholeNotesAsMsrString (): returns " << result <<
       endl <<
       endl;
@@ -772,8 +772,8 @@ msrDivisions::~msrDivisions ()
 
 void msrDivisions::acceptIn (basevisitor* v)
 {
-  if (gMsrOptions->fTraceMsrVisitors) {
-    gLogIOstream <<
+  if (gMsrOptions ()->fTraceMsrVisitors) {
+    gLogIOstream () <<
       "% ==> msrDivisions::acceptIn ()" <<
       endl;
   }
@@ -783,8 +783,8 @@ void msrDivisions::acceptIn (basevisitor* v)
       dynamic_cast<visitor<S_msrDivisions>*> (v)) {
         S_msrDivisions elem = this;
         
-        if (gMsrOptions->fTraceMsrVisitors) {
-          gLogIOstream <<
+        if (gMsrOptions ()->fTraceMsrVisitors) {
+          gLogIOstream () <<
             "% ==> Launching msrDivisions::visitStart ()" <<
             endl;
         }
@@ -794,8 +794,8 @@ void msrDivisions::acceptIn (basevisitor* v)
 
 void msrDivisions::acceptOut (basevisitor* v)
 {
-  if (gMsrOptions->fTraceMsrVisitors) {
-    gLogIOstream <<
+  if (gMsrOptions ()->fTraceMsrVisitors) {
+    gLogIOstream () <<
       "% ==> msrDivisions::acceptOut ()" <<
       endl;
   }
@@ -805,8 +805,8 @@ void msrDivisions::acceptOut (basevisitor* v)
       dynamic_cast<visitor<S_msrDivisions>*> (v)) {
         S_msrDivisions elem = this;
       
-        if (gMsrOptions->fTraceMsrVisitors) {
-          gLogIOstream <<
+        if (gMsrOptions ()->fTraceMsrVisitors) {
+          gLogIOstream () <<
             "% ==> Launching msrDivisions::visitEnd ()" <<
             endl;
         }
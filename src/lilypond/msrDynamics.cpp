@@ -156,8 +156,8 @@ string msrDynamics::dynamicsPlacementKindAsString () const
 
 void msrDynamics::acceptIn (basevisitor* v)
 {
-  if (gMsrOptions->fTraceMsrVisitors) {
-    gLogIOstream <<
+  if (gMsrOptions ()->fTraceMsrVisitors) {
+    gLogIOstream () <<
       "% ==> msrDynamics::acceptIn ()" <<
       endl;
   }
@@ -167,8 +167,8 @@ void msrDynamics::acceptIn (basevisitor* v)
       dynamic_cast<visitor<S_msrDynamics>*> (v)) {
         S_msrDynamics elem = this;
         
-        if (gMsrOptions->fTraceMsrVisitors) {
-          gLogIOstream <<
+        if (gMsrOptions ()->fTraceMsrVisitors) {
+          gLogIOstream () <<
             "% ==> Launching msrDynamics::visitStart ()" <<
             endl;
         }
@@ -178,8 +178,8 @@ void msrDynamics::acceptIn (basevisitor* v)
 
 void msrDynamics::acceptOut (basevisitor* v)
 {
-  if (gMsrOptions->fTraceMsrVisitors) {
-    gLogIOstream <<
+  if (gMsrOptions ()->fTraceMsrVisitors) {
+    gLogIOstream () <<
       "% ==> msrDynamics::acceptOut ()" <<
       endl;
   }
@@ -189,8 +189,8 @@ void msrDynamics::acceptOut (basevisitor* v)
       dynamic_cast<visitor<S_msrDynamics>*> (v)) {
         S_msrDynamics elem = this;
       
-        if (gMsrOptions->fTraceMsrVisitors) {
-          gLogIOstream <<
+        if (gMsrOptions ()->fTraceMsrVisitors) {
+          gLogIOstream () <<
             "% ==> Launching msrDynamics::visitEnd ()" <<
             endl;
         }
@@ -257,8 +257,8 @@ string msrOtherDynamics::otherDynamicsPlacementKindAsString () const
 
 void msrOtherDynamics::acceptIn (basevisitor* v)
 {
-  if (gMsrOptions->fTraceMsrVisitors) {
-    gLogIOstream <<
+  if (gMsrOptions ()->fTraceMsrVisitors) {
+    gLogIOstream () <<
       "% ==> msrOtherDynamics::acceptIn ()" <<
       endl;
   }
@@ -268,8 +268,8 @@ void msrOtherDynamics::acceptIn (basevisitor* v)
       dynamic_cast<visitor<S_msrOtherDynamics>*> (v)) {
         S_msrOtherDynamics elem = this;
         
-        if (gMsrOptions->fTraceMsrVisitors) {
-          gLogIOstream <<
+        if (gMsrOptions ()->fTraceMsrVisitors) {
+          gLogIOstream () <<
             "% ==> Launching msrOtherDynamics::visitStart ()" <<
             endl;
         }
@@ -279,8 +279,8 @@ void msrOtherDynamics::acceptIn (basevisitor* v)
 
 void msrOtherDynamics::acceptOut (basevisitor* v)
 {
-  if (gMsrOptions->fTraceMsrVisitors) {
-    gLogIOstream <<
+  if (gMsrOptions ()->fTraceMsrVisitors) {
+    gLogIOstream () <<
       "% ==> msrOtherDynamics::acceptOut ()" <<
       endl;
   }
@@ -290,8 +290,8 @@ void msrOtherDynamics::acceptOut (basevisitor* v)
       dynamic_cast<visitor<S_msrOtherDynamics>*> (v)) {
         S_msrOtherDynamics elem = this;
       
-        if (gMsrOptions->fTraceMsrVisitors) {
-          gLogIOstream <<
+        if (gMsrOptions ()->fTraceMsrVisitors) {
+          gLogIOstream () <<
             "% ==> Launching msrOtherDynamics::visitEnd ()" <<
             endl;
         }
@@ -408,8 +408,8 @@ string msrWedge::wedgeNienteKindAsString (
 
 void msrWedge::acceptIn (basevisitor* v)
 {
-  if (gMsrOptions->fTraceMsrVisitors) {
-    gLogIOstream <<
+  if (gMsrOptions ()->fTraceMsrVisitors) {
+    gLogIOstream () <<
       "% ==> msrWedge::acceptIn ()" <<
       endl;
   }
@@ -419,8 +419,8 @@ void msrWedge::acceptIn (basevisitor* v)
       dynamic_cast<visitor<S_msrWedge>*> (v)) {
         S_msrWedge elem = this;
         
-        if (gMsrOptions->fTraceMsrVisitors) {
-          gLogIOstream <<
+        if (gMsrOptions ()->fTraceMsrVisitors) {
+          gLogIOstream () <<
             "% ==> Launching msrWedge::visitStart ()" <<
             endl;
         }
@@ -430,8 +430,8 @@ void msrWedge::acceptIn (basevisitor* v)
 
 void msrWedge::acceptOut (basevisitor* v)
 {
-  if (gMsrOptions->fTraceMsrVisitors) {
-    gLogIOstream <<
+  if (gMsrOptions ()->fTraceMsrVisitors) {
+    gLogIOstream () <<
       "% ==> msrWedge::acceptOut ()" <<
       endl;
   }
@@ -441,8 +441,8 @@ void msrWedge::acceptOut (basevisitor* v)
       dynamic_cast<visitor<S_msrWedge>*> (v)) {
         S_msrWedge elem = this;
       
-        if (gMsrOptions->fTraceMsrVisitors) {
-          gLogIOstream <<
+        if (gMsrOptions ()->fTraceMsrVisitors) {
+          gLogIOstream () <<
             "% ==> Launching msrWedge::visitEnd ()" <<
             endl;
         }
@@ -466,7 +466,7 @@ void msrWedge::print (ostream& os)
     ", line " << fInputLineNumber <<
     endl;
 
-  gIndenter++;
+  gIndenter ()++;
 
   const int fieldWidth = 19;
 
@@ -487,7 +487,7 @@ void msrWedge::print (ostream& os)
       fWedgePlacementKind) << 
     endl;
 
-  gIndenter--;
+  gIndenter ()--;
 }
 
 
@@ -43,8 +43,8 @@ msrElement::~msrElement ()
 
 void msrElement::acceptIn (basevisitor* v)
 {
-  if (gMsrOptions->fTraceMsrVisitors) {
-    gLogIOstream <<
+  if (gMsrOptions ()->fTraceMsrVisitors) {
+    gLogIOstream () <<
       "% ==> msrElement::acceptIn ()" <<
       endl;
   }
@@ -54,8 +54,8 @@ void msrElement::acceptIn (basevisitor* v)
       dynamic_cast<visitor<S_msrElement>*> (v)) {
         S_msrElement elem = this;
         
-        if (gMsrOptions->fTraceMsrVisitors) {
-          gLogIOstream <<
+        if (gMsrOptions ()->fTraceMsrVisitors) {
+          gLogIOstream () <<
             "% ==> Launching msrElement::visitStart ()" <<
             endl;
         }
@@ -65,8 +65,8 @@ void msrElement::acceptIn (basevisitor* v)
 
 void msrElement::acceptOut (basevisitor* v)
 {
-  if (gMsrOptions->fTraceMsrVisitors) {
-    gLogIOstream <<
+  if (gMsrOptions ()->fTraceMsrVisitors) {
+    gLogIOstream () <<
       "% ==> msrElement::acceptOut ()" <<
       endl;
   }
@@ -76,8 +76,8 @@ void msrElement::acceptOut (basevisitor* v)
       dynamic_cast<visitor<S_msrElement>*> (v)) {
         S_msrElement elem = this;
       
-        if (gMsrOptions->fTraceMsrVisitors) {
-          gLogIOstream <<
+        if (gMsrOptions ()->fTraceMsrVisitors) {
+          gLogIOstream () <<
             "% ==> Launching msrElement::visitEnd ()" <<
             endl;
         }
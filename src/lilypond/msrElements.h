@@ -16,6 +16,8 @@
 #include "typedefs.h"
 #include "tree_browser.h"
 
+#include "conversionContext.h"
+
 
 namespace MusicXML2 
 {
@@ -107,8 +109,40 @@ template <typename T> class msrBrowser : public browser <T>
   
     basevisitor*  fVisitor;
 
-    virtual void enter (T& t) { t.acceptIn  (fVisitor); }
-    virtual void leave (T& t) { t.acceptOut (fVisitor); }
+    virtual void enter (T& t) {
+      if (gProfiling ().isActive ())
+        profiledVisit (t, true);
+      else
+        t.acceptIn (fVisitor);
+    }
+    
+    virtual void leave (T& t) {
+      if (gProfiling ().isActive ())
+        profiledVisit (t, false);
+      else
+        t.acceptOut (fVisitor);
+    }
+
+    void profiledVisit (T& t, bool entered) {
+      profiling::visitsClock::time_point
+        startTime =
+          profiling::visitsClock::now ();
+      
+      if (entered)
+        t.acceptIn (fVisitor);
+      else
+        t.acceptOut (fVisitor);
+
+      std::chrono::duration<double>
+        visitDuration =
+          profiling::visitsClock::now () - startTime;
+
+      // typeid (t) is the dynamic type of t
+      gProfiling ().registerMsrVisit (
+        typeid (t),
+        entered,
+        visitDuration.count ());
+    }
 };
 
 
@@ -57,8 +57,8 @@ void msrIdentification::setWorkNumber (
   string val)
   {
 #ifdef TRACE_OPTIONS
-  if (gTraceOptions->fTraceVarValAssocs) {
-    gLogIOstream <<
+  if (gTraceOptions ()->fTraceVarValAssocs) {
+    gLogIOstream () <<
       "Setting workNumber to \"" << val << "\"" <<
       endl;
   }
@@ -75,8 +75,8 @@ void msrIdentification::setWorkTitle (
   string val)
   {
 #ifdef TRACE_OPTIONS
-  if (gTraceOptions->fTraceVarValAssocs) {
-    gLogIOstream <<
+  if (gTraceOptions ()->fTraceVarValAssocs) {
+    gLogIOstream () <<
       "Setting workTitle to \"" << val << "\"" <<
       endl;
   }
@@ -93,8 +93,8 @@ void msrIdentification::setMovementNumber (
   string val)
   {
 #ifdef TRACE_OPTIONS
-  if (gTraceOptions->fTraceVarValAssocs) {
-    gLogIOstream <<
+  if (gTraceOptions ()->fTraceVarValAssocs) {
+    gLogIOstream () <<
       "Setting movementNumber to \"" << val << "\"" <<
       endl;
   }
@@ -111,8 +111,8 @@ void msrIdentification::setMovementTitle (
   string val)
 {
 #ifdef TRACE_OPTIONS
-  if (gTraceOptions->fTraceVarValAssocs) {
-    gLogIOstream <<
+  if (gTraceOptions ()->fTraceVarValAssocs) {
+    gLogIOstream () <<
       "Setting movementTitle to \"" << val << "\"" <<
       endl;
   }
@@ -129,8 +129,8 @@ void msrIdentification::setEncodingDate (
   string val)
 {
 #ifdef TRACE_OPTIONS
-  if (gTraceOptions->fTraceVarValAssocs) {
-    gLogIOstream <<
+  if (gTraceOptions ()->fTraceVarValAssocs) {
+    gLogIOstream () <<
       "Setting encodingDate to \"" << val << "\"" <<
       endl;
   }
@@ -147,8 +147,8 @@ void msrIdentification::setScoreInstrument (
   string val)
 {
  #ifdef TRACE_OPTIONS
-  if (gTraceOptions->fTraceVarValAssocs) {
-    gLogIOstream <<
+  if (gTraceOptions ()->fTraceVarValAssocs) {
+    gLogIOstream () <<
       "Setting scoreInstrument to \"" << val << "\"" <<
       endl;
   }
@@ -165,8 +165,8 @@ void msrIdentification::setMiscellaneousField (
   string val)
 {
  #ifdef TRACE_OPTIONS
-  if (gTraceOptions->fTraceVarValAssocs) {
-    gLogIOstream <<
+  if (gTraceOptions ()->fTraceVarValAssocs) {
+    gLogIOstream () <<
       "Setting workTitle to \"" << val << "\"" <<
       endl;
   }
@@ -183,8 +183,8 @@ void msrIdentification::addRights (
   string value)
 {
 #ifdef TRACE_OPTIONS
-  if (gTraceOptions->fTraceVarValAssocs) {
-    gLogIOstream <<
+  if (gTraceOptions ()->fTraceVarValAssocs) {
+    gLogIOstream () <<
       "Adding right \"" << value << "\"" <<
       endl;
   }
@@ -206,8 +206,8 @@ void msrIdentification::addComposer (
   string value)
 {
 #ifdef TRACE_OPTIONS
-  if (gTraceOptions->fTraceVarValAssocs) {
-    gLogIOstream <<
+  if (gTraceOptions ()->fTraceVarValAssocs) {
+    gLogIOstream () <<
       "Adding composer \"" << value << "\"" <<
       endl;
   }
@@ -229,8 +229,8 @@ void msrIdentification::addArranger (
   string value)
 {
 #ifdef TRACE_OPTIONS
-  if (gTraceOptions->fTraceVarValAssocs) {
-    gLogIOstream <<
+  if (gTraceOptions ()->fTraceVarValAssocs) {
+    gLogIOstream () <<
       "Adding arranger \"" << value << "\"" <<
       endl;
   }
@@ -252,8 +252,8 @@ void msrIdentification::addLyricist (
   string value)
 {
 #ifdef TRACE_OPTIONS
-  if (gTraceOptions->fTraceVarValAssocs) {
-    gLogIOstream <<
+  if (gTraceOptions ()->fTraceVarValAssocs) {
+    gLogIOstream () <<
       "Adding lyricist \"" << value << "\"" <<
       endl;
   }
@@ -275,8 +275,8 @@ void msrIdentification::addPoet (
   string value)
 {
 #ifdef TRACE_OPTIONS
-  if (gTraceOptions->fTraceVarValAssocs) {
-    gLogIOstream <<
+  if (gTraceOptions ()->fTraceVarValAssocs) {
+    gLogIOstream () <<
       "Adding poet \"" << value << "\"" <<
       endl;
   }
@@ -298,8 +298,8 @@ void msrIdentification::addTranslator (
   string value)
 {
 #ifdef TRACE_OPTIONS
-  if (gTraceOptions->fTraceVarValAssocs) {
-    gLogIOstream <<
+  if (gTraceOptions ()->fTraceVarValAssocs) {
+    gLogIOstream () <<
       "Adding translator \"" << value << "\"" <<
       endl;
   }
@@ -321,8 +321,8 @@ void msrIdentification::addSoftware (
   string value)
 {
 #ifdef TRACE_OPTIONS
-  if (gTraceOptions->fTraceVarValAssocs) {
-    gLogIOstream <<
+  if (gTraceOptions ()->fTraceVarValAssocs) {
+    gLogIOstream () <<
       "Adding software \"" << value << "\"" <<
       endl;
   }
@@ -341,8 +341,8 @@ void msrIdentification::addSoftware (
 
 void msrIdentification::acceptIn (basevisitor* v)
 {
-  if (gMsrOptions->fTraceMsrVisitors) {
-    gLogIOstream <<
+  if (gMsrOptions ()->fTraceMsrVisitors) {
+    gLogIOstream () <<
       "% ==> msrIdentification::acceptIn ()" <<
       endl;
   }
@@ -352,8 +352,8 @@ void msrIdentification::acceptIn (basevisitor* v)
       dynamic_cast<visitor<S_msrIdentification>*> (v)) {
         S_msrIdentification elem = this;
         
-        if (gMsrOptions->fTraceMsrVisitors) {
-          gLogIOstream <<
+        if (gMsrOptions ()->fTraceMsrVisitors) {
+          gLogIOstream () <<
             "% ==> Launching msrIdentification::visitStart ()" <<
             endl;
         }
@@ -363,8 +363,8 @@ void msrIdentification::acceptIn (basevisitor* v)
 
 void msrIdentification::acceptOut (basevisitor* v)
 {
-  if (gMsrOptions->fTraceMsrVisitors) {
-    gLogIOstream <<
+  if (gMsrOptions ()->fTraceMsrVisitors) {
+    gLogIOstream () <<
       "% ==> msrIdentification::acceptOut ()" <<
       endl;
   }
@@ -374,8 +374,8 @@ void msrIdentification::acceptOut (basevisitor* v)
       dynamic_cast<visitor<S_msrIdentification>*> (v)) {
         S_msrIdentification elem = this;
       
-        if (gMsrOptions->fTraceMsrVisitors) {
-          gLogIOstream <<
+        if (gMsrOptions ()->fTraceMsrVisitors) {
+          gLogIOstream () <<
             "% ==> Launching msrIdentification::visitEnd ()" <<
             endl;
         }
@@ -478,7 +478,7 @@ void msrIdentification::print (ostream& os)
 
   bool emptyIdentification = true;
 
-  gIndenter++;
+  gIndenter ()++;
   
   if (fWorkNumber) {
     os <<
@@ -582,7 +582,7 @@ void msrIdentification::print (ostream& os)
       endl;
   }
   
-  gIndenter--;
+  gIndenter ()--;
 }
 
 
@@ -74,8 +74,8 @@ msrStringTuning::~msrStringTuning ()
 
 void msrStringTuning::acceptIn (basevisitor* v)
 {
-  if (gMsrOptions->fTraceMsrVisitors) {
-    gLogIOstream <<
+  if (gMsrOptions ()->fTraceMsrVisitors) {
+    gLogIOstream () <<
       "% ==> msrStringTuning::acceptIn ()" <<
       endl;
   }
@@ -85,8 +85,8 @@ void msrStringTuning::acceptIn (basevisitor* v)
       dynamic_cast<visitor<S_msrStringTuning>*> (v)) {
         S_msrStringTuning elem = this;
         
-        if (gMsrOptions->fTraceMsrVisitors) {
-          gLogIOstream <<
+        if (gMsrOptions ()->fTraceMsrVisitors) {
+          gLogIOstream () <<
             "% ==> Launching msrStringTuning::visitStart ()" <<
             endl;
         }
@@ -96,8 +96,8 @@ void msrStringTuning::acceptIn (basevisitor* v)
 
 void msrStringTuning::acceptOut (basevisitor* v)
 {
-  if (gMsrOptions->fTraceMsrVisitors) {
-    gLogIOstream <<
+  if (gMsrOptions ()->fTraceMsrVisitors) {
+    gLogIOstream () <<
       "% ==> msrStringTuning::acceptOut ()" <<
       endl;
   }
@@ -107,8 +107,8 @@ void msrStringTuning::acceptOut (basevisitor* v)
       dynamic_cast<visitor<S_msrStringTuning>*> (v)) {
         S_msrStringTuning elem = this;
       
-        if (gMsrOptions->fTraceMsrVisitors) {
-          gLogIOstream <<
+        if (gMsrOptions ()->fTraceMsrVisitors) {
+          gLogIOstream () <<
             "% ==> Launching msrStringTuning::visitEnd ()" <<
             endl;
         }
@@ -127,7 +127,7 @@ ostream& operator<< (ostream& os, const S_msrStringTuning& elt)
 
 void msrStringTuning::print (ostream& os)
 {
-  gIndenter++;
+  gIndenter ()++;
 
   const int fieldWidth = 30;
   
@@ -150,7 +150,7 @@ void msrStringTuning::print (ostream& os)
     endl <<
     endl;
 
-  gIndenter--;
+  gIndenter ()--;
 }
 
 //______________________________________________________________________________
@@ -181,8 +181,8 @@ void msrScordatura::addStringTuningToScordatura (
 
 void msrScordatura::acceptIn (basevisitor* v)
 {
-  if (gMsrOptions->fTraceMsrVisitors) {
-    gLogIOstream <<
+  if (gMsrOptions ()->fTraceMsrVisitors) {
+    gLogIOstream () <<
       "% ==> msrScordatura::acceptIn ()" <<
       endl;
   }
@@ -192,8 +192,8 @@ void msrScordatura::acceptIn (basevisitor* v)
       dynamic_cast<visitor<S_msrScordatura>*> (v)) {
         S_msrScordatura elem = this;
         
-        if (gMsrOptions->fTraceMsrVisitors) {
-          gLogIOstream <<
+        if (gMsrOptions ()->fTraceMsrVisitors) {
+          gLogIOstream () <<
             "% ==> Launching msrScordatura::visitStart ()" <<
             endl;
         }
@@ -203,8 +203,8 @@ void msrScordatura::acceptIn (basevisitor* v)
 
 void msrScordatura::acceptOut (basevisitor* v)
 {
-  if (gMsrOptions->fTraceMsrVisitors) {
-    gLogIOstream <<
+  if (gMsrOptions ()->fTraceMsrVisitors) {
+    gLogIOstream () <<
       "% ==> msrScordatura::acceptOut ()" <<
       endl;
   }
@@ -214,8 +214,8 @@ void msrScordatura::acceptOut (basevisitor* v)
       dynamic_cast<visitor<S_msrScordatura>*> (v)) {
         S_msrScordatura elem = this;
       
-        if (gMsrOptions->fTraceMsrVisitors) {
-          gLogIOstream <<
+        if (gMsrOptions ()->fTraceMsrVisitors) {
+          gLogIOstream () <<
             "% ==> Launching msrScordatura::visitEnd ()" <<
             endl;
         }
@@ -235,7 +235,7 @@ ostream& operator<< (ostream& os, const S_msrScordatura& elt)
 
 void msrScordatura::print (ostream& os)
 {
-  gIndenter++;
+  gIndenter ()++;
   
   os <<
     "Scordatura";
@@ -244,7 +244,7 @@ void msrScordatura::print (ostream& os)
     os <<
       endl;
 
-    gIndenter++;
+    gIndenter ()++;
 
     list<S_msrStringTuning>::const_iterator
       iBegin = fScordaturaStringTuningsList.begin (),
@@ -256,7 +256,7 @@ void msrScordatura::print (ostream& os)
       os << endl;
     } // for
 
-    gIndenter--;
+    gIndenter ()--;
   }
   else {
     os <<
@@ -297,8 +297,8 @@ msrAccordionRegistration::~msrAccordionRegistration ()
 
 void msrAccordionRegistration::acceptIn (basevisitor* v)
 {
-  if (gMsrOptions->fTraceMsrVisitors) {
-    gLogIOstream <<
+  if (gMsrOptions ()->fTraceMsrVisitors) {
+    gLogIOstream () <<
       "% ==> msrAccordionRegistration::acceptIn ()" <<
       endl;
   }
@@ -308,8 +308,8 @@ void msrAccordionRegistration::acceptIn (basevisitor* v)
       dynamic_cast<visitor<S_msrAccordionRegistration>*> (v)) {
         S_msrAccordionRegistration elem = this;
         
-        if (gMsrOptions->fTraceMsrVisitors) {
-          gLogIOstream <<
+        if (gMsrOptions ()->fTraceMsrVisitors) {
+          gLogIOstream () <<
             "% ==> Launching msrAccordionRegistration::visitStart ()" <<
             endl;
         }
@@ -319,8 +319,8 @@ void msrAccordionRegistration::acceptIn (basevisitor* v)
 
 void msrAccordionRegistration::acceptOut (basevisitor* v)
 {
-  if (gMsrOptions->fTraceMsrVisitors) {
-    gLogIOstream <<
+  if (gMsrOptions ()->fTraceMsrVisitors) {
+    gLogIOstream () <<
       "% ==> msrAccordionRegistration::acceptOut ()" <<
       endl;
   }
@@ -330,8 +330,8 @@ void msrAccordionRegistration::acceptOut (basevisitor* v)
       dynamic_cast<visitor<S_msrAccordionRegistration>*> (v)) {
         S_msrAccordionRegistration elem = this;
       
-        if (gMsrOptions->fTraceMsrVisitors) {
-          gLogIOstream <<
+        if (gMsrOptions ()->fTraceMsrVisitors) {
+          gLogIOstream () <<
             "% ==> Launching msrAccordionRegistration::visitEnd ()" <<
             endl;
         }
@@ -364,13 +364,13 @@ string msrAccordionRegistration::asString () const
 
 void msrAccordionRegistration::print (ostream& os)
 {
-  gIndenter++;
+  gIndenter ()++;
   
   os <<
     asString () <<
     endl;
 
-  gIndenter--;
+  gIndenter ()--;
 }
 
 //______________________________________________________________________________
@@ -396,8 +396,8 @@ msrHarpPedalsTuning::~msrHarpPedalsTuning ()
 S_msrHarpPedalsTuning msrHarpPedalsTuning::createHarpPedalsTuningNewbornClone ()
 {
 #ifdef TRACE_OPTIONS
-  if (gTraceOptions->fTraceRepeats) {
-    gLogIOstream <<
+  if (gTraceOptions ()->fTraceRepeats) {
+    gLogIOstream () <<
       "Creating a newborn clone of a " <<
       asString () <<
       endl;
@@ -413,8 +413,8 @@ S_msrHarpPedalsTuning msrHarpPedalsTuning::createHarpPedalsTuningNewbornClone ()
 S_msrHarpPedalsTuning msrHarpPedalsTuning::createHarpPedalsTuningDeepCopy ()
 {
 #ifdef TRACE_OPTIONS
-  if (gTraceOptions->fTraceRepeats) {
-    gLogIOstream <<
+  if (gTraceOptions ()->fTraceRepeats) {
+    gLogIOstream () <<
       "Creating a newborn clone of a " <<
       asString () <<
       endl;
@@ -449,7 +449,7 @@ void msrHarpPedalsTuning::addPedalTuning (
       "' has already been specified";
       
     msrMusicXMLError (
-      gXml2lyOptions->fInputSourceName,
+      gXml2lyOptions ()->fInputSourceName,
       inputLineNumber,
       __FILE__, __LINE__,
       s.str ());
@@ -460,8 +460,8 @@ void msrHarpPedalsTuning::addPedalTuning (
 
 void msrHarpPedalsTuning::acceptIn (basevisitor* v)
 {
-  if (gMsrOptions->fTraceMsrVisitors) {
-    gLogIOstream <<
+  if (gMsrOptions ()->fTraceMsrVisitors) {
+    gLogIOstream () <<
       "% ==> msrHarpPedalsTuning::acceptIn ()" <<
       endl;
   }
@@ -471,8 +471,8 @@ void msrHarpPedalsTuning::acceptIn (basevisitor* v)
       dynamic_cast<visitor<S_msrHarpPedalsTuning>*> (v)) {
         S_msrHarpPedalsTuning elem = this;
         
-        if (gMsrOptions->fTraceMsrVisitors) {
-          gLogIOstream <<
+        if (gMsrOptions ()->fTraceMsrVisitors) {
+          gLogIOstream () <<
             "% ==> Launching msrHarpPedalsTuning::visitStart ()" <<
             endl;
         }
@@ -482,8 +482,8 @@ void msrHarpPedalsTuning::acceptIn (basevisitor* v)
 
 void msrHarpPedalsTuning::acceptOut (basevisitor* v)
 {
-  if (gMsrOptions->fTraceMsrVisitors) {
-    gLogIOstream <<
+  if (gMsrOptions ()->fTraceMsrVisitors) {
+    gLogIOstream () <<
       "% ==> msrHarpPedalsTuning::acceptOut ()" <<
       endl;
   }
@@ -493,8 +493,8 @@ void msrHarpPedalsTuning::acceptOut (basevisitor* v)
       dynamic_cast<visitor<S_msrHarpPedalsTuning>*> (v)) {
         S_msrHarpPedalsTuning elem = this;
       
-        if (gMsrOptions->fTraceMsrVisitors) {
-          gLogIOstream <<
+        if (gMsrOptions ()->fTraceMsrVisitors) {
+          gLogIOstream () <<
             "% ==> Launching msrHarpPedalsTuning::visitEnd ()" <<
             endl;
         }
@@ -521,7 +521,7 @@ string msrHarpPedalsTuning::asString () const
     ", ";
     
   if (fHarpPedalsAlterationKindsMap.size ()) {
-    gIndenter++;
+    gIndenter ()++;
 
     map<msrDiatonicPitchKind, msrAlterationKind>::const_iterator
       iBegin = fHarpPedalsAlterationKindsMap.begin (),
@@ -540,7 +540,7 @@ string msrHarpPedalsTuning::asString () const
       s << ", ";
     } // for
 
-    gIndenter--;
+    gIndenter ()--;
   }
 
   else {
@@ -558,7 +558,7 @@ void msrHarpPedalsTuning::print (ostream& os)
     ", line " << fInputLineNumber;
     
   if (fHarpPedalsAlterationKindsMap.size ()) {
-    gIndenter++;
+    gIndenter ()++;
 
     os <<
       endl;
@@ -580,7 +580,7 @@ void msrHarpPedalsTuning::print (ostream& os)
       os << ", ";
     } // for
 
-    gIndenter--;
+    gIndenter ()--;
   }
 
   else {
@@ -682,8 +682,8 @@ string msrPedal::pedalSignAsString ()
 
 void msrPedal::acceptIn (basevisitor* v)
 {
-  if (gMsrOptions->fTraceMsrVisitors) {
-    gLogIOstream <<
+  if (gMsrOptions ()->fTraceMsrVisitors) {
+    gLogIOstream () <<
       "% ==> msrPedal::acceptIn ()" <<
       endl;
   }
@@ -693,8 +693,8 @@ void msrPedal::acceptIn (basevisitor* v)
       dynamic_cast<visitor<S_msrPedal>*> (v)) {
         S_msrPedal elem = this;
         
-        if (gMsrOptions->fTraceMsrVisitors) {
-          gLogIOstream <<
+        if (gMsrOptions ()->fTraceMsrVisitors) {
+          gLogIOstream () <<
             "% ==> Launching msrPedal::visitStart ()" <<
             endl;
         }
@@ -704,8 +704,8 @@ void msrPedal::acceptIn (basevisitor* v)
 
 void msrPedal::acceptOut (basevisitor* v)
 {
-  if (gMsrOptions->fTraceMsrVisitors) {
-    gLogIOstream <<
+  if (gMsrOptions ()->fTraceMsrVisitors) {
+    gLogIOstream () <<
       "% ==> msrPedal::acceptOut ()" <<
       endl;
   }
@@ -715,8 +715,8 @@ void msrPedal::acceptOut (basevisitor* v)
       dynamic_cast<visitor<S_msrPedal>*> (v)) {
         S_msrPedal elem = this;
       
-        if (gMsrOptions->fTraceMsrVisitors) {
-          gLogIOstream <<
+        if (gMsrOptions ()->fTraceMsrVisitors) {
+          gLogIOstream () <<
             "% ==> Launching msrPedal::visitEnd ()" <<
             endl;
         }
@@ -768,8 +768,8 @@ msrDamp::~msrDamp ()
 
 void msrDamp::acceptIn (basevisitor* v)
 {
-  if (gMsrOptions->fTraceMsrVisitors) {
-    gLogIOstream <<
+  if (gMsrOptions ()->fTraceMsrVisitors) {
+    gLogIOstream () <<
       "% ==> msrDamp::acceptIn ()" <<
       endl;
   }
@@ -779,8 +779,8 @@ void msrDamp::acceptIn (basevisitor* v)
       dynamic_cast<visitor<S_msrDamp>*> (v)) {
         S_msrDamp elem = this;
         
-        if (gMsrOptions->fTraceMsrVisitors) {
-          gLogIOstream <<
+        if (gMsrOptions ()->fTraceMsrVisitors) {
+          gLogIOstream () <<
             "% ==> Launching msrDamp::visitStart ()" <<
             endl;
         }
@@ -790,8 +790,8 @@ void msrDamp::acceptIn (basevisitor* v)
 
 void msrDamp::acceptOut (basevisitor* v)
 {
-  if (gMsrOptions->fTraceMsrVisitors) {
-    gLogIOstream <<
+  if (gMsrOptions ()->fTraceMsrVisitors) {
+    gLogIOstream () <<
       "% ==> msrDamp::acceptOut ()" <<
       endl;
   }
@@ -801,8 +801,8 @@ void msrDamp::acceptOut (basevisitor* v)
       dynamic_cast<visitor<S_msrDamp>*> (v)) {
         S_msrDamp elem = this;
       
-        if (gMsrOptions->fTraceMsrVisitors) {
-          gLogIOstream <<
+        if (gMsrOptions ()->fTraceMsrVisitors) {
+          gLogIOstream () <<
             "% ==> Launching msrDamp::visitEnd ()" <<
             endl;
         }
@@ -848,8 +848,8 @@ msrDampAll::~msrDampAll ()
 
 void msrDampAll::acceptIn (basevisitor* v)
 {
-  if (gMsrOptions->fTraceMsrVisitors) {
-    gLogIOstream <<
+  if (gMsrOptions ()->fTraceMsrVisitors) {
+    gLogIOstream () <<
       "% ==> msrDampAll::acceptIn ()" <<
       endl;
   }
@@ -859,8 +859,8 @@ void msrDampAll::acceptIn (basevisitor* v)
       dynamic_cast<visitor<S_msrDampAll>*> (v)) {
         S_msrDampAll elem = this;
         
-        if (gMsrOptions->fTraceMsrVisitors) {
-          gLogIOstream <<
+        if (gMsrOptions ()->fTraceMsrVisitors) {
+          gLogIOstream () <<
             "% ==> Launching msrDampAll::visitStart ()" <<
             endl;
         }
@@ -870,8 +870,8 @@ void msrDampAll::acceptIn (basevisitor* v)
 
 void msrDampAll::acceptOut (basevisitor* v)
 {
-  if (gMsrOptions->fTraceMsrVisitors) {
-    gLogIOstream <<
+  if (gMsrOptions ()->fTraceMsrVisitors) {
+    gLogIOstream () <<
       "% ==> msrDampAll::acceptOut ()" <<
       endl;
   }
@@ -881,8 +881,8 @@ void msrDampAll::acceptOut (basevisitor* v)
       dynamic_cast<visitor<S_msrDampAll>*> (v)) {
         S_msrDampAll elem = this;
       
-        if (gMsrOptions->fTraceMsrVisitors) {
-          gLogIOstream <<
+        if (gMsrOptions ()->fTraceMsrVisitors) {
+          gLogIOstream () <<
             "% ==> Launching msrDampAll::visitEnd ()" <<
             endl;
         }
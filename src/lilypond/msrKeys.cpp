@@ -50,8 +50,8 @@ msrHumdrumScotKeyItem::msrHumdrumScotKeyItem (
     : msrElement (inputLineNumber)
 {
 #ifdef TRACE_OPTIONS
-  if (gTraceOptions->fTraceKeys) {
-    gLogIOstream <<
+  if (gTraceOptions ()->fTraceKeys) {
+    gLogIOstream () <<
       "Creating Humdrum/Scot key item" <<
       ", line = " << inputLineNumber <<
       endl;
@@ -86,8 +86,8 @@ void msrHumdrumScotKeyItem::setKeyItemDiatonicPitchKind (
   msrDiatonicPitchKind diatonicPitchKind)
 {
 #ifdef TRACE_OPTIONS
-  if (gTraceOptions->fTraceKeys) {
-    gLogIOstream <<
+  if (gTraceOptions ()->fTraceKeys) {
+    gLogIOstream () <<
       "Setting Humdrum/Scot key item diatonic pitch to '" <<
       msrDiatonicPitchKindAsString (diatonicPitchKind) <<
       "'" <<
@@ -102,8 +102,8 @@ void msrHumdrumScotKeyItem::setKeyItemAlterationKind (
   msrAlterationKind alterationKind)
 {
 #ifdef TRACE_OPTIONS
-  if (gTraceOptions->fTraceKeys) {
-    gLogIOstream <<
+  if (gTraceOptions ()->fTraceKeys) {
+    gLogIOstream () <<
       "Setting Humdrum/Scot key item alteration to '" <<
       msrAlterationKindAsString (alterationKind) <<
       "'" <<
@@ -117,8 +117,8 @@ void msrHumdrumScotKeyItem::setKeyItemAlterationKind (
 void msrHumdrumScotKeyItem::setKeyItemOctave (int keyOctave)
 {
 #ifdef TRACE_OPTIONS
-  if (gTraceOptions->fTraceKeys) {
-    gLogIOstream <<
+  if (gTraceOptions ()->fTraceKeys) {
+    gLogIOstream () <<
       "Setting Humdrum/Scot key item octave to '" <<
       keyOctave <<
       "'" <<
@@ -131,8 +131,8 @@ void msrHumdrumScotKeyItem::setKeyItemOctave (int keyOctave)
 
 void msrHumdrumScotKeyItem::acceptIn (basevisitor* v)
 {
-  if (gMsrOptions->fTraceMsrVisitors) {
-    gLogIOstream <<
+  if (gMsrOptions ()->fTraceMsrVisitors) {
+    gLogIOstream () <<
       "% ==> msrHumdrumScotKeyItem::acceptIn ()" <<
       endl;
   }
@@ -142,8 +142,8 @@ void msrHumdrumScotKeyItem::acceptIn (basevisitor* v)
       dynamic_cast<visitor<S_msrHumdrumScotKeyItem>*> (v)) {
         S_msrHumdrumScotKeyItem elem = this;
         
-        if (gMsrOptions->fTraceMsrVisitors) {
-          gLogIOstream <<
+        if (gMsrOptions ()->fTraceMsrVisitors) {
+          gLogIOstream () <<
             "% ==> Launching msrHumdrumScotKeyItem::visitStart ()" <<
             endl;
         }
@@ -153,8 +153,8 @@ void msrHumdrumScotKeyItem::acceptIn (basevisitor* v)
 
 void msrHumdrumScotKeyItem::acceptOut (basevisitor* v)
 {
-  if (gMsrOptions->fTraceMsrVisitors) {
-    gLogIOstream <<
+  if (gMsrOptions ()->fTraceMsrVisitors) {
+    gLogIOstream () <<
       "% ==> msrHumdrumScotKeyItem::acceptOut ()" <<
       endl;
   }
@@ -164,8 +164,8 @@ void msrHumdrumScotKeyItem::acceptOut (basevisitor* v)
       dynamic_cast<visitor<S_msrHumdrumScotKeyItem>*> (v)) {
         S_msrHumdrumScotKeyItem elem = this;
       
-        if (gMsrOptions->fTraceMsrVisitors) {
-          gLogIOstream <<
+        if (gMsrOptions ()->fTraceMsrVisitors) {
+          gLogIOstream () <<
             "% ==> Launching msrHumdrumScotKeyItem::visitEnd ()" <<
             endl;
         }
@@ -328,8 +328,8 @@ void msrKey::appendHumdrumScotKeyItem (
   S_msrHumdrumScotKeyItem item)
 {
 #ifdef TRACE_OPTIONS
-  if (gTraceOptions->fTraceKeys) {
-    gLogIOstream <<
+  if (gTraceOptions ()->fTraceKeys) {
+    gLogIOstream () <<
       "Append item '" <<
       item->asString () <<
       "' to key '" <<
@@ -350,8 +350,8 @@ void msrKey::appendHumdrumScotKeyItem (
 
 void msrKey::acceptIn (basevisitor* v)
 {
-  if (gMsrOptions->fTraceMsrVisitors) {
-    gLogIOstream <<
+  if (gMsrOptions ()->fTraceMsrVisitors) {
+    gLogIOstream () <<
       "% ==> msrKey::acceptIn ()" <<
       endl;
   }
@@ -361,8 +361,8 @@ void msrKey::acceptIn (basevisitor* v)
       dynamic_cast<visitor<S_msrKey>*> (v)) {
         S_msrKey elem = this;
         
-        if (gMsrOptions->fTraceMsrVisitors) {
-          gLogIOstream <<
+        if (gMsrOptions ()->fTraceMsrVisitors) {
+          gLogIOstream () <<
             "% ==> Launching msrKey::visitStart ()" <<
             endl;
         }
@@ -372,8 +372,8 @@ void msrKey::acceptIn (basevisitor* v)
 
 void msrKey::acceptOut (basevisitor* v)
 {
-  if (gMsrOptions->fTraceMsrVisitors) {
-    gLogIOstream <<
+  if (gMsrOptions ()->fTraceMsrVisitors) {
+    gLogIOstream () <<
       "% ==> msrKey::acceptOut ()" <<
       endl;
   }
@@ -383,8 +383,8 @@ void msrKey::acceptOut (basevisitor* v)
       dynamic_cast<visitor<S_msrKey>*> (v)) {
         S_msrKey elem = this;
       
-        if (gMsrOptions->fTraceMsrVisitors) {
-          gLogIOstream <<
+        if (gMsrOptions ()->fTraceMsrVisitors) {
+          gLogIOstream () <<
             "% ==> Launching msrKey::visitEnd ()" <<
             endl;
         }
@@ -469,7 +469,7 @@ string msrKey::asString () const
     case msrKey::kTraditionalKind:
       s <<
         msrQuarterTonesPitchKindAsString (
-          gMsrOptions->fMsrQuarterTonesPitchesLanguageKind,
+          gMsrOptions ()->fMsrQuarterTonesPitchesLanguageKind,
           fKeyTonicQuarterTonesPitchKind) <<
         " " <<
         keyModeKindAsString (fKeyModeKind);
@@ -502,7 +502,7 @@ void msrKey::print (ostream& os)
       os <<
         " " <<
         msrQuarterTonesPitchKindAsString (
-          gMsrOptions->fMsrQuarterTonesPitchesLanguageKind,
+          gMsrOptions ()->fMsrQuarterTonesPitchesLanguageKind,
           fKeyTonicQuarterTonesPitchKind) <<
         " " <<
         keyModeKindAsString (fKeyModeKind) <<
@@ -525,7 +525,7 @@ void msrKey::print (ostream& os)
         os <<
           endl;
           
-        gIndenter++;
+        gIndenter ()++;
         
         vector<S_msrHumdrumScotKeyItem>::const_iterator
           iBegin = fHumdrumScotKeyItemsVector.begin (),
@@ -538,7 +538,7 @@ void msrKey::print (ostream& os)
     // JMI     os << endl;
         } // for
         
-        gIndenter--;
+        gIndenter ()--;
       }
       
       else
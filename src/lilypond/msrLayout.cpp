@@ -47,8 +47,8 @@ msrLayout::~msrLayout ()
 
 void msrLayout::acceptIn (basevisitor* v)
 {
-  if (gMsrOptions->fTraceMsrVisitors) {
-    gLogIOstream <<
+  if (gMsrOptions ()->fTraceMsrVisitors) {
+    gLogIOstream () <<
       "% ==> msrLayout::acceptIn ()" <<
       endl;
   }
@@ -58,8 +58,8 @@ void msrLayout::acceptIn (basevisitor* v)
       dynamic_cast<visitor<S_msrLayout>*> (v)) {
         S_msrLayout elem = this;
         
-        if (gMsrOptions->fTraceMsrVisitors) {
-          gLogIOstream <<
+        if (gMsrOptions ()->fTraceMsrVisitors) {
+          gLogIOstream () <<
             "% ==> Launching msrLayout::visitStart ()" <<
             endl;
         }
@@ -69,8 +69,8 @@ void msrLayout::acceptIn (basevisitor* v)
 
 void msrLayout::acceptOut (basevisitor* v)
 {
-  if (gMsrOptions->fTraceMsrVisitors) {
-    gLogIOstream <<
+  if (gMsrOptions ()->fTraceMsrVisitors) {
+    gLogIOstream () <<
       "% ==> msrLayout::acceptOut ()" <<
       endl;
   }
@@ -80,8 +80,8 @@ void msrLayout::acceptOut (basevisitor* v)
       dynamic_cast<visitor<S_msrLayout>*> (v)) {
         S_msrLayout elem = this;
       
-        if (gMsrOptions->fTraceMsrVisitors) {
-          gLogIOstream <<
+        if (gMsrOptions ()->fTraceMsrVisitors) {
+          gLogIOstream () <<
             "% ==> Launching msrLayout::visitEnd ()" <<
             endl;
         }
@@ -110,7 +110,7 @@ void msrLayout::print (ostream& os)
 {
   os << "Layout" << endl;
 
-  gIndenter++;
+  gIndenter ()++;
 
   int n1 = fVarValAssocs.size ();
   
@@ -125,7 +125,7 @@ void msrLayout::print (ostream& os)
   } // for
   */
   
-  gIndenter--;
+  gIndenter ()--;
 }
 
 
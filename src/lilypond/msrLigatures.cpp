@@ -87,8 +87,8 @@ void msrLigature::setLigatureOtherEndSidelink (
 
 void msrLigature::acceptIn (basevisitor* v)
 {
-  if (gMsrOptions->fTraceMsrVisitors) {
-    gLogIOstream <<
+  if (gMsrOptions ()->fTraceMsrVisitors) {
+    gLogIOstream () <<
       "% ==> msrLigature::acceptIn ()" <<
       endl;
   }
@@ -98,8 +98,8 @@ void msrLigature::acceptIn (basevisitor* v)
       dynamic_cast<visitor<S_msrLigature>*> (v)) {
         S_msrLigature elem = this;
         
-        if (gMsrOptions->fTraceMsrVisitors) {
-          gLogIOstream <<
+        if (gMsrOptions ()->fTraceMsrVisitors) {
+          gLogIOstream () <<
             "% ==> Launching msrLigature::visitStart ()" <<
             endl;
         }
@@ -109,8 +109,8 @@ void msrLigature::acceptIn (basevisitor* v)
 
 void msrLigature::acceptOut (basevisitor* v)
 {
-  if (gMsrOptions->fTraceMsrVisitors) {
-    gLogIOstream <<
+  if (gMsrOptions ()->fTraceMsrVisitors) {
+    gLogIOstream () <<
       "% ==> msrLigature::acceptOut ()" <<
       endl;
   }
@@ -120,8 +120,8 @@ void msrLigature::acceptOut (basevisitor* v)
       dynamic_cast<visitor<S_msrLigature>*> (v)) {
         S_msrLigature elem = this;
       
-        if (gMsrOptions->fTraceMsrVisitors) {
-          gLogIOstream <<
+        if (gMsrOptions ()->fTraceMsrVisitors) {
+          gLogIOstream () <<
             "% ==> Launching msrLigature::visitEnd ()" <<
             endl;
         }
@@ -195,7 +195,7 @@ void msrLigature::print (ostream& os)
     ", line " << fInputLineNumber <<
     endl;
 
-  gIndenter++;
+  gIndenter ()++;
 
   const int fieldWidth = 22;
 
@@ -216,7 +216,7 @@ void msrLigature::print (ostream& os)
       fLigaturePlacementKind) << 
     endl;
 
-  gIndenter--;
+  gIndenter ()--;
 }
 
 ostream& operator<< (ostream& os, const S_msrLigature& elt)
@@ -57,8 +57,8 @@ msrMidi::~msrMidi ()
 
 void msrMidi::acceptIn (basevisitor* v)
 {
-  if (gMsrOptions->fTraceMsrVisitors) {
-    gLogIOstream <<
+  if (gMsrOptions ()->fTraceMsrVisitors) {
+    gLogIOstream () <<
       "% ==> msrMidi::acceptIn ()" <<
       endl;
   }
@@ -68,8 +68,8 @@ void msrMidi::acceptIn (basevisitor* v)
       dynamic_cast<visitor<S_msrMidi>*> (v)) {
         S_msrMidi elem = this;
         
-        if (gMsrOptions->fTraceMsrVisitors) {
-          gLogIOstream <<
+        if (gMsrOptions ()->fTraceMsrVisitors) {
+          gLogIOstream () <<
             "% ==> Launching msrMidi::visitStart ()" <<
             endl;
         }
@@ -79,8 +79,8 @@ void msrMidi::acceptIn (basevisitor* v)
 
 void msrMidi::acceptOut (basevisitor* v)
 {
-  if (gMsrOptions->fTraceMsrVisitors) {
-    gLogIOstream <<
+  if (gMsrOptions ()->fTraceMsrVisitors) {
+    gLogIOstream () <<
       "% ==> msrMidi::acceptOut ()" <<
       endl;
   }
@@ -90,8 +90,8 @@ void msrMidi::acceptOut (basevisitor* v)
       dynamic_cast<visitor<S_msrMidi>*> (v)) {
         S_msrMidi elem = this;
       
-        if (gMsrOptions->fTraceMsrVisitors) {
-          gLogIOstream <<
+        if (gMsrOptions ()->fTraceMsrVisitors) {
+          gLogIOstream () <<
             "% ==> Launching msrMidi::visitEnd ()" <<
             endl;
         }
@@ -112,7 +112,7 @@ void msrMidi::print (ostream& os)
 {
   os << "Midi" << endl;
 
-  gIndenter++;
+  gIndenter ()++;
 
   const int fieldWidth = 18;
 
@@ -125,7 +125,7 @@ void msrMidi::print (ostream& os)
     endl <<
     endl;
       
-  gIndenter--;
+  gIndenter ()--;
 }    
 
 
@@ -166,8 +166,8 @@ string msrOrnament::ornamentAccidentalMarkAsString () const
 
 void msrOrnament::acceptIn (basevisitor* v)
 {
-  if (gMsrOptions->fTraceMsrVisitors) {
-    gLogIOstream <<
+  if (gMsrOptions ()->fTraceMsrVisitors) {
+    gLogIOstream () <<
       "% ==> msrOrnament::acceptIn ()" <<
       endl;
   }
@@ -177,8 +177,8 @@ void msrOrnament::acceptIn (basevisitor* v)
       dynamic_cast<visitor<S_msrOrnament>*> (v)) {
         S_msrOrnament elem = this;
         
-        if (gMsrOptions->fTraceMsrVisitors) {
-          gLogIOstream <<
+        if (gMsrOptions ()->fTraceMsrVisitors) {
+          gLogIOstream () <<
             "% ==> Launching msrOrnament::visitStart ()" <<
             endl;
         }
@@ -188,8 +188,8 @@ void msrOrnament::acceptIn (basevisitor* v)
 
 void msrOrnament::acceptOut (basevisitor* v)
 {
-  if (gMsrOptions->fTraceMsrVisitors) {
-    gLogIOstream <<
+  if (gMsrOptions ()->fTraceMsrVisitors) {
+    gLogIOstream () <<
       "% ==> msrOrnament::acceptOut ()" <<
       endl;
   }
@@ -199,8 +199,8 @@ void msrOrnament::acceptOut (basevisitor* v)
       dynamic_cast<visitor<S_msrOrnament>*> (v)) {
         S_msrOrnament elem = this;
       
-        if (gMsrOptions->fTraceMsrVisitors) {
-          gLogIOstream <<
+        if (gMsrOptions ()->fTraceMsrVisitors) {
+          gLogIOstream () <<
             "% ==> Launching msrOrnament::visitEnd ()" <<
             endl;
         }
@@ -219,7 +219,7 @@ void msrOrnament::print (ostream& os)
     ", line " << fInputLineNumber <<
     endl;
 
-  gIndenter++;
+  gIndenter ()++;
 
   const int fieldWidth = 16;
   
@@ -237,7 +237,7 @@ void msrOrnament::print (ostream& os)
     fOrnamentNoteUplink->asShortString () <<
     endl;
 
-  gIndenter--;
+  gIndenter ()--;
 }
 
 ostream& operator<< (ostream& os, const S_msrOrnament& elt)
@@ -289,8 +289,8 @@ S_msrDoubleTremolo msrDoubleTremolo::createDoubleTremoloNewbornClone (
   S_msrElement doubleTremoloSecondElement)
 {
 #ifdef TRACE_OPTIONS
-  if (gTraceOptions->fTraceTremolos) {
-    gLogIOstream <<
+  if (gTraceOptions ()->fTraceTremolos) {
+    gLogIOstream () <<
       "Creating a newborn clone of a double tremolo" <<
       endl;
   }
@@ -339,8 +339,8 @@ msrDoubleTremolo::~msrDoubleTremolo ()
 void msrDoubleTremolo::setDoubleTremoloNoteFirstElement (S_msrNote note)
 {
 #ifdef TRACE_OPTIONS
-  if (gTraceOptions->fTraceTremolos) {
-    gLogIOstream <<
+  if (gTraceOptions ()->fTraceTremolos) {
+    gLogIOstream () <<
       "Setting note " << note->asShortString () <<
       " as first element of double tremolo " <<
       asShortString () <<
@@ -398,7 +398,6 @@ void msrDoubleTremolo::setDoubleTremoloNoteFirstElement (S_msrNote note)
       fDoubleTremoloElementsDuration
         /
       2; // there are two repeated notes
-  numberOfRepeatsAsRational.rationalise ();
       
   if (numberOfRepeatsAsRational.getDenominator () != 1) {
     stringstream s;
@@ -418,7 +417,7 @@ void msrDoubleTremolo::setDoubleTremoloNoteFirstElement (S_msrNote note)
       "line " << inputLineNumber;
 
     msrInternalError (
-      gXml2lyOptions->fInputSourceName,
+      gXml2lyOptions ()->fInputSourceName,
       inputLineNumber,
       __FILE__, __LINE__,
       s.str ());
@@ -428,8 +427,8 @@ void msrDoubleTremolo::setDoubleTremoloNoteFirstElement (S_msrNote note)
     numberOfRepeatsAsRational.getNumerator ();
   
 #ifdef TRACE_OPTIONS
-  if (gTraceOptions->fTraceTremolos) {
-    gLogIOstream <<
+  if (gTraceOptions ()->fTraceTremolos) {
+    gLogIOstream () <<
       "Setting notes double tremolo number of repeats to '" <<
       fDoubleTremoloNumberOfRepeats <<
       "', fDoubleTremoloSoundingWholeNotes = '" <<
@@ -446,8 +445,8 @@ void msrDoubleTremolo::setDoubleTremoloNoteSecondElement (
   S_msrNote note)
 {
 #ifdef TRACE_OPTIONS
-  if (gTraceOptions->fTraceTremolos) {
-    gLogIOstream <<
+  if (gTraceOptions ()->fTraceTremolos) {
+    gLogIOstream () <<
       "Setting note " << note->asShortString () <<
       " as second element of double tremolo " <<
       asShortString () <<
@@ -480,8 +479,8 @@ void msrDoubleTremolo::setDoubleTremoloNoteSecondElement (
   // check that expected double tremolo sounding whole notes
   // match the known double tremolo sounding whole notes
 #ifdef TRACE_OPTIONS
-  if (gTraceOptions->fTraceTremolos) {
-    gLogIOstream <<
+  if (gTraceOptions ()->fTraceTremolos) {
+    gLogIOstream () <<
       "Checking notes double tremolo second note duration"<<
       ", doubleTremoloNumberOfRepeats = '" <<
       fDoubleTremoloNumberOfRepeats <<
@@ -508,16 +507,16 @@ void msrDoubleTremolo::setDoubleTremoloNoteSecondElement (
       " on note second element:" <<
       endl;
 
-    gIndenter++;
+    gIndenter ()++;
 
     s <<
       note <<
       endl;
     
-    gIndenter--;
+    gIndenter ()--;
       
     msrInternalError (
-      gXml2lyOptions->fInputSourceName,
+      gXml2lyOptions ()->fInputSourceName,
       inputLineNumber,
       __FILE__, __LINE__,
       s.str ());
@@ -533,8 +532,8 @@ void msrDoubleTremolo::setDoubleTremoloChordFirstElement (
   S_msrChord chord)
 {
 #ifdef TRACE_OPTIONS
-  if (gTraceOptions->fTraceTremolos || gTraceOptions->fTraceChords) {
-    gLogIOstream <<
+  if (gTraceOptions ()->fTraceTremolos || gTraceOptions ()->fTraceChords) {
+    gLogIOstream () <<
       "Setting chord " << chord->asString () <<
       " as first element of double tremolo " <<
       asShortString () <<
@@ -559,7 +558,6 @@ void msrDoubleTremolo::setDoubleTremoloChordFirstElement (
   rational
     expectedDoubleTremoloSoundingWholeNotes =
       chordDisplayWholeNotes * 2;
-  expectedDoubleTremoloSoundingWholeNotes.rationalise ();
     
   // set double tremolo whole notes to the chords's displayed whole notes
   if (fDoubleTremoloSoundingWholeNotes.getNumerator () != 0) {
@@ -577,16 +575,16 @@ void msrDoubleTremolo::setDoubleTremoloChordFirstElement (
         " on chord first element:" <<
         endl;
 
-      gIndenter++;
+      gIndenter ()++;
 
       s <<
         chord <<
         endl;
       
-      gIndenter--;
+      gIndenter ()--;
                 
       msrInternalError (
-        gXml2lyOptions->fInputSourceName,
+        gXml2lyOptions ()->fInputSourceName,
         chord->getInputLineNumber (),
         __FILE__, __LINE__,
         s.str ());
@@ -595,14 +593,13 @@ void msrDoubleTremolo::setDoubleTremoloChordFirstElement (
 
   fDoubleTremoloSoundingWholeNotes =
     chordDisplayWholeNotes * 2; // taking the second note into account
-  fDoubleTremoloSoundingWholeNotes.rationalise ();
 }
 
 void msrDoubleTremolo::setDoubleTremoloChordSecondElement (S_msrChord chord)
 {
 #ifdef TRACE_OPTIONS
-  if (gTraceOptions->fTraceTremolos || gTraceOptions->fTraceChords) {
-    gLogIOstream <<
+  if (gTraceOptions ()->fTraceTremolos || gTraceOptions ()->fTraceChords) {
+    gLogIOstream () <<
       "Setting chord " << chord->asString () <<
       " as second element of double tremolo " <<
       asShortString () <<
@@ -636,16 +633,16 @@ void msrDoubleTremolo::setDoubleTremoloChordSecondElement (S_msrChord chord)
         " on chord second element:" << " (chord)" <<
         endl;
 
-      gIndenter++;
+      gIndenter ()++;
 
       s <<
         chord <<
         endl;
       
-      gIndenter--;
+      gIndenter ()--;
         
       msrInternalError (
-        gXml2lyOptions->fInputSourceName,
+        gXml2lyOptions ()->fInputSourceName,
         chord->getInputLineNumber (),
         __FILE__, __LINE__,
         s.str ());
@@ -684,8 +681,8 @@ string msrDoubleTremolo::doubleTremoloPlacementKindAsString () const
 
 void msrDoubleTremolo::acceptIn (basevisitor* v)
 {
-  if (gMsrOptions->fTraceMsrVisitors) {
-    gLogIOstream <<
+  if (gMsrOptions ()->fTraceMsrVisitors) {
+    gLogIOstream () <<
       "% ==> msrDoubleTremolo::acceptIn ()" <<
       endl;
   }
@@ -695,8 +692,8 @@ void msrDoubleTremolo::acceptIn (basevisitor* v)
       dynamic_cast<visitor<S_msrDoubleTremolo>*> (v)) {
         S_msrDoubleTremolo elem = this;
         
-        if (gMsrOptions->fTraceMsrVisitors) {
-          gLogIOstream <<
+        if (gMsrOptions ()->fTraceMsrVisitors) {
+          gLogIOstream () <<
             "% ==> Launching msrDoubleTremolo::visitStart ()" <<
             endl;
         }
@@ -706,8 +703,8 @@ void msrDoubleTremolo::acceptIn (basevisitor* v)
 
 void msrDoubleTremolo::acceptOut (basevisitor* v)
 {
-  if (gMsrOptions->fTraceMsrVisitors) {
-    gLogIOstream <<
+  if (gMsrOptions ()->fTraceMsrVisitors) {
+    gLogIOstream () <<
       "% ==> msrDoubleTremolo::acceptOut ()" <<
       endl;
   }
@@ -717,8 +714,8 @@ void msrDoubleTremolo::acceptOut (basevisitor* v)
       dynamic_cast<visitor<S_msrDoubleTremolo>*> (v)) {
         S_msrDoubleTremolo elem = this;
       
-        if (gMsrOptions->fTraceMsrVisitors) {
-          gLogIOstream <<
+        if (gMsrOptions ()->fTraceMsrVisitors) {
+          gLogIOstream () <<
             "% ==> Launching msrDoubleTremolo::visitEnd ()" <<
             endl;
         }
@@ -784,7 +781,7 @@ string msrDoubleTremolo::asString () const
         }
         else {
           msrInternalError (
-            gXml2lyOptions->fInputSourceName,
+            gXml2lyOptions ()->fInputSourceName,
             fInputLineNumber,
             __FILE__, __LINE__,
             "notes double tremolo first element should be a note");
@@ -801,7 +798,7 @@ string msrDoubleTremolo::asString () const
         }
         else {
           msrInternalError (
-            gXml2lyOptions->fInputSourceName,
+            gXml2lyOptions ()->fInputSourceName,
             fInputLineNumber,
             __FILE__, __LINE__,
             "chords double tremolo first element should be a chord");
@@ -825,7 +822,7 @@ string msrDoubleTremolo::asString () const
         }
         else {
           msrInternalError (
-            gXml2lyOptions->fInputSourceName,
+            gXml2lyOptions ()->fInputSourceName,
             fInputLineNumber,
             __FILE__, __LINE__,
             "notes double tremolo second element should be a note");
@@ -842,7 +839,7 @@ string msrDoubleTremolo::asString () const
         }
         else {
           msrInternalError (
-            gXml2lyOptions->fInputSourceName,
+            gXml2lyOptions ()->fInputSourceName,
             fInputLineNumber,
             __FILE__, __LINE__,
             "chords double tremolo second element should be a chord");
@@ -865,7 +862,7 @@ void msrDoubleTremolo::print (ostream& os)
 
   const int fieldWidth = 32;
 
-  gIndenter++;
+  gIndenter ()++;
   
   os << left <<
     setw (fieldWidth) <<
@@ -899,10 +896,10 @@ void msrDoubleTremolo::print (ostream& os)
     os <<
       endl;
       
-    gIndenter++;
+    gIndenter ()++;
     os <<
       fDoubleTremoloFirstElement;
-    gIndenter--;
+    gIndenter ()--;
   }
   else {
     os <<
@@ -916,10 +913,10 @@ void msrDoubleTremolo::print (ostream& os)
     os <<
       endl;
 
-    gIndenter++;
+    gIndenter ()++;
     os <<
       fDoubleTremoloSecondElement;
-    gIndenter--;
+    gIndenter ()--;
   }
   else {
     os <<
@@ -927,7 +924,7 @@ void msrDoubleTremolo::print (ostream& os)
       endl;
   }
 
-  gIndenter--;
+  gIndenter ()--;
 }
 
 ostream& operator<< (ostream& os, const S_msrDoubleTremolo& elt)
@@ -1036,8 +1033,8 @@ string msrSpanner::spannerPlacementKindAsString () const
 
 void msrSpanner::acceptIn (basevisitor* v)
 {
-  if (gMsrOptions->fTraceMsrVisitors) {
-    gLogIOstream <<
+  if (gMsrOptions ()->fTraceMsrVisitors) {
+    gLogIOstream () <<
       "% ==> msrSpanner::acceptIn ()" <<
       endl;
   }
@@ -1047,8 +1044,8 @@ void msrSpanner::acceptIn (basevisitor* v)
       dynamic_cast<visitor<S_msrSpanner>*> (v)) {
         S_msrSpanner elem = this;
         
-        if (gMsrOptions->fTraceMsrVisitors) {
-          gLogIOstream <<
+        if (gMsrOptions ()->fTraceMsrVisitors) {
+          gLogIOstream () <<
             "% ==> Launching msrSpanner::visitStart ()" <<
             endl;
         }
@@ -1058,8 +1055,8 @@ void msrSpanner::acceptIn (basevisitor* v)
 
 void msrSpanner::acceptOut (basevisitor* v)
 {
-  if (gMsrOptions->fTraceMsrVisitors) {
-    gLogIOstream <<
+  if (gMsrOptions ()->fTraceMsrVisitors) {
+    gLogIOstream () <<
       "% ==> msrSpanner::acceptOut ()" <<
       endl;
   }
@@ -1069,8 +1066,8 @@ void msrSpanner::acceptOut (basevisitor* v)
       dynamic_cast<visitor<S_msrSpanner>*> (v)) {
         S_msrSpanner elem = this;
       
-        if (gMsrOptions->fTraceMsrVisitors) {
-          gLogIOstream <<
+        if (gMsrOptions ()->fTraceMsrVisitors) {
+          gLogIOstream () <<
             "% ==> Launching msrSpanner::visitEnd ()" <<
             endl;
         }
@@ -1090,7 +1087,7 @@ void msrSpanner::print (ostream& os)
     ", line " << fInputLineNumber <<
     endl;
 
-  gIndenter++;
+  gIndenter ()++;
 
   const int fieldWidth = 21;
   
@@ -1107,13 +1104,13 @@ void msrSpanner::print (ostream& os)
     "spannerNoteUplink" << " : " <<
     endl;
 
-  gIndenter++;
+  gIndenter ()++;
     os <<
       fSpannerNoteUplink->asString () <<
       endl;
-  gIndenter--;
+  gIndenter ()--;
     
-  gIndenter--;
+  gIndenter ()--;
 }
 
 ostream& operator<< (ostream& os, const S_msrSpanner& elt)
@@ -1173,8 +1170,8 @@ S_msrGraceNotesGroup msrGraceNotesGroup::createGraceNotesGroupNewbornClone (
   S_msrVoice containingVoice)
 {
 #ifdef TRACE_OPTIONS
-  if (gTraceOptions->fTraceGraceNotes) {
-    gLogIOstream <<
+  if (gTraceOptions ()->fTraceGraceNotes) {
+    gLogIOstream () <<
       "Creating a newborn clone of grace notes group '" <<
       asShortString () <<
       "'" <<
@@ -1232,8 +1229,8 @@ S_msrGraceNotesGroup msrGraceNotesGroup::createSkipGraceNotesGroupClone (
   S_msrVoice containingVoice)
 {
 #ifdef TRACE_OPTIONS
-  if (gTraceOptions->fTraceGraceNotes) {
-    gLogIOstream <<
+  if (gTraceOptions ()->fTraceGraceNotes) {
+    gLogIOstream () <<
       "Creating a skip clone of grace notes group '" <<
       asShortString () <<
       "'" <<
@@ -1313,7 +1310,7 @@ S_msrGraceNotesGroup msrGraceNotesGroup::createSkipGraceNotesGroupClone (
     
     else {
       msrInternalError (
-        gXml2lyOptions->fInputSourceName,
+        gXml2lyOptions ()->fInputSourceName,
         fInputLineNumber,
         __FILE__, __LINE__,
         "grace notes element should be a note or a chord");
@@ -1326,8 +1323,8 @@ S_msrGraceNotesGroup msrGraceNotesGroup::createSkipGraceNotesGroupClone (
 void msrGraceNotesGroup::appendNoteToGraceNotesGroup (S_msrNote note)
 {
 #ifdef TRACE_OPTIONS
-  if (gTraceOptions->fTraceGraceNotes || gTraceOptions->fTraceGraceNotes) {
-    gLogIOstream <<
+  if (gTraceOptions ()->fTraceGraceNotes || gTraceOptions ()->fTraceGraceNotes) {
+    gLogIOstream () <<
       "Appending note '" <<
       note->asShortString () <<
       "' to grace notes group" <<
@@ -1354,8 +1351,8 @@ void msrGraceNotesGroup::appendNoteToGraceNotesGroup (S_msrNote note)
 void msrGraceNotesGroup::appendChordToGraceNotesGroup (S_msrChord chord)
 {
 #ifdef TRACE_OPTIONS
-  if (gTraceOptions->fTraceChords || gTraceOptions->fTraceGraceNotes) {
-    gLogIOstream <<
+  if (gTraceOptions ()->fTraceChords || gTraceOptions ()->fTraceGraceNotes) {
+    gLogIOstream () <<
       "Appending chord '" <<
       chord->asShortString () <<
       "' to grace notes group '" <<
@@ -1374,8 +1371,8 @@ S_msrNote msrGraceNotesGroup::removeLastNoteFromGraceNotesGroup (
   int inputLineNumber)
 {
 #ifdef TRACE_OPTIONS
-  if (gTraceOptions->fTraceGraceNotes || gTraceOptions->fTraceGraceNotes) {
-    gLogIOstream <<
+  if (gTraceOptions ()->fTraceGraceNotes || gTraceOptions ()->fTraceGraceNotes) {
+    gLogIOstream () <<
       "Removing last note from grace notes group '" <<
       asShortString () <<
       "' in voice \"" <<
@@ -1391,8 +1388,8 @@ S_msrNote msrGraceNotesGroup::removeLastNoteFromGraceNotesGroup (
     "fGraceNotesGroupElementsList.size () == 0");
 
 #ifdef TRACE_OPTIONS
-  if (gTraceOptions->fTraceNotes || gTraceOptions->fTraceGraceNotes) {
-    gLogIOstream <<
+  if (gTraceOptions ()->fTraceNotes || gTraceOptions ()->fTraceGraceNotes) {
+    gLogIOstream () <<
       "Removing last note from grace notes '" <<
       asString () <<
       "'" <<
@@ -1410,15 +1407,15 @@ S_msrNote msrGraceNotesGroup::removeLastNoteFromGraceNotesGroup (
 
   else {
     msrInternalError (
-      gXml2lyOptions->fInputSourceName,
+      gXml2lyOptions ()->fInputSourceName,
       fInputLineNumber,
       __FILE__, __LINE__,
       "removeLastNoteFromGraceNotesGroup (): grace notes group element should be a note");
   }   
 
 #ifdef TRACE_OPTIONS
-  if (gTraceOptions->fTraceNotes || gTraceOptions->fTraceGraceNotes) {
-    gLogIOstream <<
+  if (gTraceOptions ()->fTraceNotes || gTraceOptions ()->fTraceGraceNotes) {
+    gLogIOstream () <<
       "This last note from grace notes '" <<
       asString () <<
       "' turns out to be '" <<
@@ -1435,8 +1432,8 @@ S_msrNote msrGraceNotesGroup::removeLastNoteFromGraceNotesGroup (
 
 void msrGraceNotesGroup::acceptIn (basevisitor* v)
 {
-  if (gMsrOptions->fTraceMsrVisitors) {
-    gLogIOstream <<
+  if (gMsrOptions ()->fTraceMsrVisitors) {
+    gLogIOstream () <<
       "% ==> msrGraceNotesGroup::acceptIn ()" <<
       endl;
   }
@@ -1446,8 +1443,8 @@ void msrGraceNotesGroup::acceptIn (basevisitor* v)
       dynamic_cast<visitor<S_msrGraceNotesGroup>*> (v)) {
         S_msrGraceNotesGroup elem = this;
         
-        if (gMsrOptions->fTraceMsrVisitors) {
-          gLogIOstream <<
+        if (gMsrOptions ()->fTraceMsrVisitors) {
+          gLogIOstream () <<
             "% ==> Launching msrGraceNotesGroup::visitStart ()" <<
             endl;
         }
@@ -1457,8 +1454,8 @@ void msrGraceNotesGroup::acceptIn (basevisitor* v)
 
 void msrGraceNotesGroup::acceptOut (basevisitor* v)
 {
-  if (gMsrOptions->fTraceMsrVisitors) {
-    gLogIOstream <<
+  if (gMsrOptions ()->fTraceMsrVisitors) {
+    gLogIOstream () <<
       "% ==> msrGraceNotesGroup::acceptOut ()" <<
       endl;
   }
@@ -1468,8 +1465,8 @@ void msrGraceNotesGroup::acceptOut (basevisitor* v)
       dynamic_cast<visitor<S_msrGraceNotesGroup>*> (v)) {
         S_msrGraceNotesGroup elem = this;
       
-        if (gMsrOptions->fTraceMsrVisitors) {
-          gLogIOstream <<
+        if (gMsrOptions ()->fTraceMsrVisitors) {
+          gLogIOstream () <<
             "% ==> Launching msrGraceNotesGroup::visitEnd ()" <<
             endl;
         }
@@ -1553,7 +1550,7 @@ void msrGraceNotesGroup::print (ostream& os)
       fGraceNotesGroupElementsList.size (), "element", "elements") <<
     endl;
 
-  gIndenter++;
+  gIndenter ()++;
 
   const int fieldWidth = 33;
   
@@ -1618,7 +1615,7 @@ void msrGraceNotesGroup::print (ostream& os)
     os <<
       endl;
       
-    gIndenter++;
+    gIndenter ()++;
   
     list<S_msrElement>::const_iterator
       iBegin = fGraceNotesGroupElementsList.begin (),
@@ -1631,7 +1628,7 @@ void msrGraceNotesGroup::print (ostream& os)
       os << endl;
     } // for
   
-    gIndenter--;
+    gIndenter ()--;
   }
   else {
     os <<
@@ -1640,7 +1637,7 @@ void msrGraceNotesGroup::print (ostream& os)
       endl;
   }
 
-  gIndenter--;
+  gIndenter ()--;
 }
 
 ostream& operator<< (ostream& os, const S_msrGraceNotesGroup& elt)
@@ -1692,8 +1689,8 @@ S_msrAfterGraceNotesGroupContents msrAfterGraceNotesGroupContents::createAfterGr
   S_msrVoice containingVoice)
 {
 #ifdef TRACE_OPTIONS
-  if (gTraceOptions->fTraceGraceNotes) {
-    gLogIOstream <<
+  if (gTraceOptions ()->fTraceGraceNotes) {
+    gLogIOstream () <<
       "Creating a newborn clone of after grace notes group" <<
       endl;
   }
@@ -1721,8 +1718,8 @@ void msrAfterGraceNotesGroupContents::appendNoteToAfterGraceNotesGroupContents (
 
 void msrAfterGraceNotesGroupContents::acceptIn (basevisitor* v)
 {
-  if (gMsrOptions->fTraceMsrVisitors) {
-    gLogIOstream <<
+  if (gMsrOptions ()->fTraceMsrVisitors) {
+    gLogIOstream () <<
       "% ==> msrAfterGraceNotesGroupContents::acceptIn ()" <<
       endl;
   }
@@ -1732,8 +1729,8 @@ void msrAfterGraceNotesGroupContents::acceptIn (basevisitor* v)
       dynamic_cast<visitor<S_msrAfterGraceNotesGroupContents>*> (v)) {
         S_msrAfterGraceNotesGroupContents elem = this;
         
-        if (gMsrOptions->fTraceMsrVisitors) {
-          gLogIOstream <<
+        if (gMsrOptions ()->fTraceMsrVisitors) {
+          gLogIOstream () <<
             "% ==> Launching msrAfterGraceNotesGroupContents::visitStart ()" <<
             endl;
         }
@@ -1743,8 +1740,8 @@ void msrAfterGraceNotesGroupContents::acceptIn (basevisitor* v)
 
 void msrAfterGraceNotesGroupContents::acceptOut (basevisitor* v)
 {
-  if (gMsrOptions->fTraceMsrVisitors) {
-    gLogIOstream <<
+  if (gMsrOptions ()->fTraceMsrVisitors) {
+    gLogIOstream () <<
       "% ==> msrAfterGraceNotesGroupContents::acceptOut ()" <<
       endl;
   }
@@ -1754,8 +1751,8 @@ void msrAfterGraceNotesGroupContents::acceptOut (basevisitor* v)
       dynamic_cast<visitor<S_msrAfterGraceNotesGroupContents>*> (v)) {
         S_msrAfterGraceNotesGroupContents elem = this;
       
-        if (gMsrOptions->fTraceMsrVisitors) {
-          gLogIOstream <<
+        if (gMsrOptions ()->fTraceMsrVisitors) {
+          gLogIOstream () <<
             "% ==> Launching msrAfterGraceNotesGroupContents::visitEnd ()" <<
             endl;
         }
@@ -1814,7 +1811,7 @@ void msrAfterGraceNotesGroupContents::print (ostream& os)
     ", line " << fInputLineNumber <<
     endl;
   
-  gIndenter++;
+  gIndenter ()++;
 
   if (fAfterGraceNotesGroupContentsNotesList.size ()) {
     list<S_msrNote>::const_iterator
@@ -1829,7 +1826,7 @@ void msrAfterGraceNotesGroupContents::print (ostream& os)
     } // for
   }
   
-  gIndenter--;
+  gIndenter ()--;
 }
 
 ostream& operator<< (ostream& os, const S_msrAfterGraceNotesGroupContents& elt)
@@ -1901,8 +1898,8 @@ S_msrAfterGraceNotesGroup msrAfterGraceNotesGroup::createAfterGraceNotesGroupNew
   S_msrVoice containingVoice)
 {
 #ifdef TRACE_OPTIONS
-  if (gTraceOptions->fTraceGraceNotes) {
-    gLogIOstream <<
+  if (gTraceOptions ()->fTraceGraceNotes) {
+    gLogIOstream () <<
       "Creating a newborn clone of after grace notes group '" <<
       asShortString () <<
       "'" <<
@@ -1941,8 +1938,8 @@ void msrAfterGraceNotesGroup::appendNoteToAfterGraceNotesGroupContents (
 
 void msrAfterGraceNotesGroup::acceptIn (basevisitor* v)
 {
-  if (gMsrOptions->fTraceMsrVisitors) {
-    gLogIOstream <<
+  if (gMsrOptions ()->fTraceMsrVisitors) {
+    gLogIOstream () <<
       "% ==> msrAfterGraceNotesGroup::acceptIn ()" <<
       endl;
   }
@@ -1952,8 +1949,8 @@ void msrAfterGraceNotesGroup::acceptIn (basevisitor* v)
       dynamic_cast<visitor<S_msrAfterGraceNotesGroup>*> (v)) {
         S_msrAfterGraceNotesGroup elem = this;
         
-        if (gMsrOptions->fTraceMsrVisitors) {
-          gLogIOstream <<
+        if (gMsrOptions ()->fTraceMsrVisitors) {
+          gLogIOstream () <<
             "% ==> Launching msrAfterGraceNotesGroup::visitStart ()" <<
             endl;
         }
@@ -1963,8 +1960,8 @@ void msrAfterGraceNotesGroup::acceptIn (basevisitor* v)
 
 void msrAfterGraceNotesGroup::acceptOut (basevisitor* v)
 {
-  if (gMsrOptions->fTraceMsrVisitors) {
-    gLogIOstream <<
+  if (gMsrOptions ()->fTraceMsrVisitors) {
+    gLogIOstream () <<
       "% ==> msrAfterGraceNotesGroup::acceptOut ()" <<
       endl;
   }
@@ -1974,8 +1971,8 @@ void msrAfterGraceNotesGroup::acceptOut (basevisitor* v)
       dynamic_cast<visitor<S_msrAfterGraceNotesGroup>*> (v)) {
         S_msrAfterGraceNotesGroup elem = this;
       
-        if (gMsrOptions->fTraceMsrVisitors) {
-          gLogIOstream <<
+        if (gMsrOptions ()->fTraceMsrVisitors) {
+          gLogIOstream () <<
             "% ==> Launching msrAfterGraceNotesGroup::visitEnd ()" <<
             endl;
         }
@@ -2019,16 +2016,16 @@ void msrAfterGraceNotesGroup::print (ostream& os)
     ", line " << fInputLineNumber <<
     endl;
   
-  gIndenter++;
+  gIndenter ()++;
 
   // print the afterGraceNotesGroup element
   os <<
     "Element:" <<
     endl;
-  gIndenter++;
+  gIndenter ()++;
   os <<
     fAfterGraceNotesGroupElement;
-  gIndenter--;
+  gIndenter ()--;
 
   os <<
     "afterGraceNotesGroupIsSlashed: " <<
@@ -2039,7 +2036,7 @@ void msrAfterGraceNotesGroup::print (ostream& os)
   os <<
     fAfterGraceNotesGroupContents;
 
-  gIndenter--;
+  gIndenter ()--;
 }
 
 ostream& operator<< (ostream& os, const S_msrAfterGraceNotesGroup& elt)
@@ -2224,49 +2221,49 @@ void msrNote::initializeNote ()
   // ------------------------------------------------------
   
 #ifdef TRACE_OPTIONS
-  if (gTraceOptions->fTraceNotesDetails) {
-    gLogIOstream <<
+  if (gTraceOptions ()->fTraceNotesDetails) {
+    gLogIOstream () <<
       endl <<
       "Initializing a note" <<
       ", kind: ";
     if (fNoteKind == k_NoNoteKind)
-      gLogIOstream <<
+      gLogIOstream () <<
         "not yet known";
     else
-      gLogIOstream <<
+      gLogIOstream () <<
         noteKindAsString (fNoteKind);
-    gLogIOstream <<
+    gLogIOstream () <<
       ", line " << fInputLineNumber << ":" <<
       endl;
 
-    gIndenter++;
+    gIndenter ()++;
     
     const int fieldWidth = 30;
     
-    gLogIOstream <<
+    gLogIOstream () <<
       left <<
         setw (fieldWidth) <<
         "fNoteQuarterTonesPitch" << " = " <<
         msrQuarterTonesPitchKindAsString (
-          gMsrOptions->fMsrQuarterTonesPitchesLanguageKind,
+          gMsrOptions ()->fMsrQuarterTonesPitchesLanguageKind,
           fNoteQuarterTonesPitchKind) <<
         endl;
 
-    gLogIOstream <<
+    gLogIOstream () <<
       left <<
         setw (fieldWidth) <<
         "fNoteSoundingWholeNotes" << " = " <<
         fNoteSoundingWholeNotes <<
         endl;
       
-    gLogIOstream <<
+    gLogIOstream () <<
       left <<
         setw (fieldWidth) <<
         "fNoteDisplayWholeNotes" << " = " <<
         fNoteDisplayWholeNotes <<
         endl;
       
-    gLogIOstream <<
+    gLogIOstream () <<
       left <<
         setw (fieldWidth) <<
         "fNoteDotsNumber" << " = " <<
@@ -2277,15 +2274,15 @@ void msrNote::initializeNote ()
         setw (fieldWidth) <<
         "fNoteGraphicDuration" << " = ";
       if (fNoteGraphicDurationKind != k_NoDuration) {
-        gLogIOstream <<
+        gLogIOstream () <<
           msrDurationKindAsString (
             fNoteGraphicDurationKind);
       }
       else {
-        gLogIOstream << "none";
+        gLogIOstream () << "none";
       }
 
-    gLogIOstream <<
+    gLogIOstream () <<
       endl <<
 
       left <<
@@ -2387,7 +2384,7 @@ void msrNote::initializeNote ()
         endl <<
       endl;
           
-    gIndenter--;
+    gIndenter ()--;
   }
 #endif
 
@@ -2398,6 +2395,9 @@ void msrNote::initializeNote ()
   
   fNoteOccupiesAFullMeasure = false;
 
+  fNoteBelongsToAMultipleRest = false;
+  fNoteMultipleRestSequenceNumber = 0;
+
   // note redundant information (for speed)
   // ------------------------------------------------------
 
@@ -2420,15 +2420,15 @@ void msrNote::setNoteKind (msrNoteKind noteKind)
 {
 #ifdef TRACE_OPTIONS
   if (
-    gTraceOptions->fTraceNotes
+    gTraceOptions ()->fTraceNotes
       ||
-    gTraceOptions->fTraceChords
+    gTraceOptions ()->fTraceChords
       ||
-    gTraceOptions->fTraceTuplets
+    gTraceOptions ()->fTraceTuplets
       ||
-    gTraceOptions->fTraceGraceNotes
+    gTraceOptions ()->fTraceGraceNotes
   ) {
-    gLogIOstream <<
+    gLogIOstream () <<
       "Setting the kind of note '" <<
       asString () <<
       "' to '" <<
@@ -2471,8 +2471,8 @@ S_msrNote msrNote::createNoteNewbornClone (
   S_msrPart containingPart)
 {
 #ifdef TRACE_OPTIONS
-  if (gTraceOptions->fTraceNotes) {
-    gLogIOstream <<
+  if (gTraceOptions ()->fTraceNotes) {
+    gLogIOstream () <<
       "Creating a newborn clone of note '" <<
       asString () <<
       "' in part " <<
@@ -2713,8 +2713,8 @@ S_msrNote msrNote::createNoteDeepCopy (
   S_msrVoice containingVoice)
 {
 #ifdef TRACE_OPTIONS
-  if (gTraceOptions->fTraceNotes) {
-    gLogIOstream <<
+  if (gTraceOptions ()->fTraceNotes) {
+    gLogIOstream () <<
       "Creating a deep copy of note " <<
       asString () <<
       /* JMI
@@ -3782,8 +3782,8 @@ void msrNote::setNoteStem (S_msrStem stem)
 void msrNote::setNoteBelongsToAChord ()
 {
 #ifdef TRACE_OPTIONS
-  if (gTraceOptions->fTraceChords) {
-    gLogIOstream <<
+  if (gTraceOptions ()->fTraceChords) {
+    gLogIOstream () <<
       "Setting note '" <<
       asShortString () <<
       "' to belong to a chord"
@@ -3821,8 +3821,8 @@ void msrNote::determineTupletMemberSoundingFromDisplayWholeNotes (
   */
 
 #ifdef TRACE_OPTIONS
-  if (gTraceOptions->fTraceTuplets || gTraceOptions->fTraceNotes) {
-    gLogIOstream <<
+  if (gTraceOptions ()->fTraceTuplets || gTraceOptions ()->fTraceNotes) {
+    gLogIOstream () <<
       "Determining tuplet sounding from display whole notes" <<
       " for note '" <<
       asShortString () <<
@@ -3844,8 +3844,8 @@ void msrNote::determineTupletMemberSoundingFromDisplayWholeNotes (
   fNoteSoundingWholeNotes.rationalise ();
 
 #ifdef TRACE_OPTIONS
-  if (gTraceOptions->fTraceTuplets || gTraceOptions->fTraceNotes) {
-    gLogIOstream <<
+  if (gTraceOptions ()->fTraceTuplets || gTraceOptions ()->fTraceNotes) {
+    gLogIOstream () <<
       "The result is: '" <<
       asShortString () <<
       endl;
@@ -3856,8 +3856,8 @@ void msrNote::determineTupletMemberSoundingFromDisplayWholeNotes (
 void msrNote::appendBeamToNote (S_msrBeam beam)
 {
 #ifdef TRACE_OPTIONS
-  if (gTraceOptions->fTraceBeams || gTraceOptions->fTraceNotes) {
-    gLogIOstream <<
+  if (gTraceOptions ()->fTraceBeams || gTraceOptions ()->fTraceNotes) {
+    gLogIOstream () <<
       "Adding beam '" <<
       beam->asShortString () <<
       "' to note '" <<
@@ -3873,8 +3873,8 @@ void msrNote::appendBeamToNote (S_msrBeam beam)
 void msrNote::appendArticulationToNote (S_msrArticulation art)
 {
 #ifdef TRACE_OPTIONS
-  if (gTraceOptions->fTraceArticulations || gTraceOptions->fTraceNotes) {
-    gLogIOstream <<
+  if (gTraceOptions ()->fTraceArticulations || gTraceOptions ()->fTraceNotes) {
+    gLogIOstream () <<
       "Adding articulation '" <<
       art->asShortString () <<
       "' to note '" <<
@@ -3890,8 +3890,8 @@ void msrNote::appendArticulationToNote (S_msrArticulation art)
 void msrNote::appendSpannerToNote (S_msrSpanner spanner)
 {
 #ifdef TRACE_OPTIONS
-  if (gTraceOptions->fTraceSpanners || gTraceOptions->fTraceNotes) {
-    gLogIOstream <<
+  if (gTraceOptions ()->fTraceSpanners || gTraceOptions ()->fTraceNotes) {
+    gLogIOstream () <<
       "Adding spanner '" <<
       spanner->spannerKindAsString () <<
       "' to note '" <<
@@ -3930,8 +3930,8 @@ void msrNote::appendSpannerToNote (S_msrSpanner spanner)
 void msrNote::appendTechnicalToNote (S_msrTechnical technical)
 {
 #ifdef TRACE_OPTIONS
-  if (gTraceOptions->fTraceNotes || gTraceOptions->fTraceTechnicals) {
-    gLogIOstream <<
+  if (gTraceOptions ()->fTraceNotes || gTraceOptions ()->fTraceTechnicals) {
+    gLogIOstream () <<
       "Adding technical '" <<
       technical->asString () <<
       "' to note '" << asShortString () <<
@@ -3948,8 +3948,8 @@ void msrNote::appendTechnicalWithIntegerToNote (
   S_msrTechnicalWithInteger technicalWithInteger)
 {
 #ifdef TRACE_OPTIONS
-  if (gTraceOptions->fTraceNotes || gTraceOptions->fTraceTechnicals) {
-    gLogIOstream <<
+  if (gTraceOptions ()->fTraceNotes || gTraceOptions ()->fTraceTechnicals) {
+    gLogIOstream () <<
       "Adding technical with integer '" <<
       technicalWithInteger->asString () <<
       "' to note '" << asShortString () <<
@@ -3967,8 +3967,8 @@ void msrNote::appendTechnicalWithFloatToNote (
   S_msrTechnicalWithFloat technicalWithFloat)
 {
 #ifdef TRACE_OPTIONS
-  if (gTraceOptions->fTraceNotes || gTraceOptions->fTraceTechnicals) {
-    gLogIOstream <<
+  if (gTraceOptions ()->fTraceNotes || gTraceOptions ()->fTraceTechnicals) {
+    gLogIOstream () <<
       "Adding technical with float '" <<
       technicalWithFloat->asString () <<
       "' to note '" << asShortString () <<
@@ -3986,8 +3986,8 @@ void msrNote::appendTechnicalWithStringToNote (
   S_msrTechnicalWithString technicalWithString)
 {
 #ifdef TRACE_OPTIONS
-  if (gTraceOptions->fTraceNotes || gTraceOptions->fTraceTechnicals) {
-    gLogIOstream <<
+  if (gTraceOptions ()->fTraceNotes || gTraceOptions ()->fTraceTechnicals) {
+    gLogIOstream () <<
       "Adding technical with string'" <<
       technicalWithString->asString () <<
       "' to note '" << asShortString () <<
@@ -4004,8 +4004,8 @@ void msrNote::appendTechnicalWithStringToNote (
 void msrNote::appendOrnamentToNote (S_msrOrnament ornament)
 {
 #ifdef TRACE_OPTIONS
-  if (gTraceOptions->fTraceOrnaments || gTraceOptions->fTraceNotes) {
-    gLogIOstream <<
+  if (gTraceOptions ()->fTraceOrnaments || gTraceOptions ()->fTraceNotes) {
+    gLogIOstream () <<
       "Adding ornament '" <<
       ornament->asShortString () <<
       "' to note '" <<
@@ -4047,8 +4047,8 @@ void msrNote::appendOrnamentToNote (S_msrOrnament ornament)
 void msrNote::appendGlissandoToNote (S_msrGlissando glissando)
 {
 #ifdef TRACE_OPTIONS
-  if (gTraceOptions->fTraceGlissandos || gTraceOptions->fTraceNotes) {
-    gLogIOstream <<
+  if (gTraceOptions ()->fTraceGlissandos || gTraceOptions ()->fTraceNotes) {
+    gLogIOstream () <<
       "Adding glissando '" <<
       glissando->asShortString () <<
       "' to note '" <<
@@ -4065,8 +4065,8 @@ void msrNote::appendGlissandoToNote (S_msrGlissando glissando)
 void msrNote::appendSlideToNote (S_msrSlide slide)
 {
 #ifdef TRACE_OPTIONS
-  if (gTraceOptions->fTraceSlides || gTraceOptions->fTraceNotes) {
-    gLogIOstream <<
+  if (gTraceOptions ()->fTraceSlides || gTraceOptions ()->fTraceNotes) {
+    gLogIOstream () <<
       "Adding slide '" <<
       slide->asShortString () <<
       "' to note '" <<
@@ -4084,8 +4084,8 @@ void msrNote::setNoteGraceNotesGroupBefore (
   S_msrGraceNotesGroup graceNotesGroupBefore)
 {
 #ifdef TRACE_OPTIONS
-  if (gTraceOptions->fTraceGraceNotes || gTraceOptions->fTraceNotes) {
-    gLogIOstream <<
+  if (gTraceOptions ()->fTraceGraceNotes || gTraceOptions ()->fTraceNotes) {
+    gLogIOstream () <<
       "Attaching grace notes group '" <<
       graceNotesGroupBefore->asString () <<
       "' before note '" <<
@@ -4108,8 +4108,8 @@ void msrNote::setNoteGraceNotesGroupAfter (
   S_msrGraceNotesGroup graceNotesGroupAfter)
 {
 #ifdef TRACE_OPTIONS
-  if (gTraceOptions->fTraceGraceNotes || gTraceOptions->fTraceNotes) {
-    gLogIOstream <<
+  if (gTraceOptions ()->fTraceGraceNotes || gTraceOptions ()->fTraceNotes) {
+    gLogIOstream () <<
       "Attaching grace notes group '" <<
       graceNotesGroupAfter->asString () <<
       "' after note '" <<
@@ -4132,8 +4132,8 @@ void msrNote::setNoteGraceNotesGroupAfter (
 void msrNote::setNoteAfterGraceNotesGroup (S_msrGraceNotesGroup afterGraceNotesGroup)
 {
 #ifdef TRACE_OPTIONS
-  if (gTraceOptions->fTraceGraceNotes || gTraceOptions->fTraceNotes) {
-    gLogIOstream <<
+  if (gTraceOptions ()->fTraceGraceNotes || gTraceOptions ()->fTraceNotes) {
+    gLogIOstream () <<
       "Attaching afterGraceNotesGroup '" << afterGraceNotesGroup->asString () <<
       "' to note '" << asShortString () <<
       "', line " << afterGraceNotesGroup->getInputLineNumber () <<
@@ -4149,8 +4149,8 @@ void msrNote::setNoteAfterGraceNotesGroup (S_msrGraceNotesGroup afterGraceNotesG
 void msrNote::setNoteSingleTremolo (S_msrSingleTremolo trem)
 {
 #ifdef TRACE_OPTIONS
-  if (gTraceOptions->fTraceTremolos || gTraceOptions->fTraceNotes) {
-    gLogIOstream <<
+  if (gTraceOptions ()->fTraceTremolos || gTraceOptions ()->fTraceNotes) {
+    gLogIOstream () <<
       "Adding singleTremolo '" << trem->asString () <<
       "' to note '" << asShortString () <<
       "', line " << trem->getInputLineNumber () <<
@@ -4165,8 +4165,8 @@ void msrNote::setNoteSingleTremolo (S_msrSingleTremolo trem)
 void msrNote::appendDynamicsToNote (S_msrDynamics dynamics)
 {
 #ifdef TRACE_OPTIONS
-  if (gTraceOptions->fTraceGraceDynamics || gTraceOptions->fTraceNotes) {
-    gLogIOstream <<
+  if (gTraceOptions ()->fTraceGraceDynamics || gTraceOptions ()->fTraceNotes) {
+    gLogIOstream () <<
       "Attaching dynamics '" <<
       dynamics->asString () <<
       "' to note '" <<
@@ -4191,8 +4191,8 @@ void msrNote::appendWordsToNote (S_msrWords words)
 void msrNote::appendSlurToNote (S_msrSlur slur)
 {
 #ifdef TRACE_OPTIONS
-  if (gTraceOptions->fTraceSlurs || gTraceOptions->fTraceNotes) {
-    gLogIOstream <<
+  if (gTraceOptions ()->fTraceSlurs || gTraceOptions ()->fTraceNotes) {
+    gLogIOstream () <<
       "Adding slur '" << slur <<
       "' to note '" << asString () << "'" <<
       endl;
@@ -4205,8 +4205,8 @@ void msrNote::appendSlurToNote (S_msrSlur slur)
 void msrNote::appendLigatureToNote (S_msrLigature ligature)
 {
 #ifdef TRACE_OPTIONS
-  if (gTraceOptions->fTraceLigatures || gTraceOptions->fTraceNotes) {
-    gLogIOstream <<
+  if (gTraceOptions ()->fTraceLigatures || gTraceOptions ()->fTraceNotes) {
+    gLogIOstream () <<
       "Appending ligature " << ligature << " to note " << asString () <<
        endl;
   }
@@ -4232,14 +4232,14 @@ void msrNote::appendLigatureToNote (S_msrLigature ligature)
         ligature->getInputLineNumber ();
         
       msrMusicXMLWarning (
-        gXml2lyOptions->fInputSourceName,
+        gXml2lyOptions ()->fInputSourceName,
         ligature->getInputLineNumber (),
         s.str ());
         
       // remove 'ligature start'
 #ifdef TRACE_OPTIONS
-      if (gTraceOptions->fTraceLigatures) {
-        gLogIOstream <<
+      if (gTraceOptions ()->fTraceLigatures) {
+        gLogIOstream () <<
           "Removing last ligature (start) for note '" <<
           asShortString () <<
           "'" <<
@@ -4263,8 +4263,8 @@ void msrNote::appendLigatureToNote (S_msrLigature ligature)
 void msrNote::appendPedalToNote (S_msrPedal pedal)
 {
 #ifdef TRACE_OPTIONS
-  if (gTraceOptions->fTracePedals || gTraceOptions->fTraceNotes) {
-    gLogIOstream <<
+  if (gTraceOptions ()->fTracePedals || gTraceOptions ()->fTraceNotes) {
+    gLogIOstream () <<
       "Appending pedal " << pedal << " to note " << asString () <<
        endl;
   }
@@ -4288,14 +4288,14 @@ void msrNote::appendPedalToNote (S_msrPedal pedal)
         pedal->getInputLineNumber ();
         
       msrMusicXMLWarning (
-        gXml2lyOptions->fInputSourceName,
+        gXml2lyOptions ()->fInputSourceName,
         pedal->getInputLineNumber (),
         s.str ());
         
       // rmeove 'pedal start'
 #ifdef TRACE_OPTIONS
-      if (gTraceOptions->fTracePedals) {
-        gLogIOstream <<
+      if (gTraceOptions ()->fTracePedals) {
+        gLogIOstream () <<
           "Removing last pedal (start) for note '" <<
           asShortString () <<
           "'" <<
@@ -4318,8 +4318,8 @@ void msrNote::appendPedalToNote (S_msrPedal pedal)
 void msrNote::appendSlashToNote (S_msrSlash slash)
 {
 #ifdef TRACE_OPTIONS
-  if (gTraceOptions->fTraceSlashes || gTraceOptions->fTraceNotes) {
-    gLogIOstream <<
+  if (gTraceOptions ()->fTraceSlashes || gTraceOptions ()->fTraceNotes) {
+    gLogIOstream () <<
       "Appending slash '" <<
       slash <<
       "' to note '" <<
@@ -4360,8 +4360,8 @@ void msrNote::appendScordaturaToNote (S_msrScordatura scordatura)
 S_msrDynamics msrNote::removeFirstDynamics () // JMI
 {
 #ifdef TRACE_OPTIONS
-  if (gTraceOptions->fTraceDynamics || gTraceOptions->fTraceNotes) {
-    gLogIOstream <<
+  if (gTraceOptions ()->fTraceDynamics || gTraceOptions ()->fTraceNotes) {
+    gLogIOstream () <<
       "Removing first dynamics from note '" <<
       asShortString () <<
       "'" <<
@@ -4383,8 +4383,8 @@ S_msrDynamics msrNote::removeFirstDynamics () // JMI
 S_msrWedge msrNote::removeFirstWedge () // JMI
 {
 #ifdef TRACE_OPTIONS
-  if (gTraceOptions->fTraceDynamics || gTraceOptions->fTraceNotes) {
-    gLogIOstream <<
+  if (gTraceOptions ()->fTraceDynamics || gTraceOptions ()->fTraceNotes) {
+    gLogIOstream () <<
       "Removing first wedge from note '" <<
       asShortString () <<
       endl;
@@ -4404,8 +4404,8 @@ S_msrWedge msrNote::removeFirstWedge () // JMI
 void msrNote::appendSyllableToNote (S_msrSyllable syllable)
 {
 #ifdef TRACE_OPTIONS
-  if (gTraceOptions->fTraceLyrics || gTraceOptions->fTraceNotes) {
-    gLogIOstream <<
+  if (gTraceOptions ()->fTraceLyrics || gTraceOptions ()->fTraceNotes) {
+    gLogIOstream () <<
       "Appending syllable '" <<
       syllable->asString () <<
       "' to note '" << asString () <<
@@ -4420,8 +4420,8 @@ void msrNote::appendSyllableToNote (S_msrSyllable syllable)
 void msrNote::setNoteHarmony (S_msrHarmony harmony)
 {
 #ifdef TRACE_OPTIONS
-  if (gTraceOptions->fTraceNotes || gTraceOptions->fTraceHarmonies) {
-    gLogIOstream <<
+  if (gTraceOptions ()->fTraceNotes || gTraceOptions ()->fTraceHarmonies) {
+    gLogIOstream () <<
       "Setting note '" << asShortString ()  << "'" <<
       " harmony to '" << harmony->asString () << "'" <<
       ", line " << fInputLineNumber <<
@@ -4439,8 +4439,8 @@ void msrNote::setNoteHarmony (S_msrHarmony harmony)
 void msrNote::setNoteFrame (S_msrFrame frame)
 {
 #ifdef TRACE_OPTIONS
-  if (gTraceOptions->fTraceNotes || gTraceOptions->fTraceHarmonies) {
-    gLogIOstream <<
+  if (gTraceOptions ()->fTraceNotes || gTraceOptions ()->fTraceHarmonies) {
+    gLogIOstream () <<
       "Setting note '" << asShortString ()  << "'" <<
       " frame to '" << frame->asString () << "'" <<
       endl;
@@ -4453,8 +4453,8 @@ void msrNote::setNoteFrame (S_msrFrame frame)
 void msrNote::setNoteFiguredBass (S_msrFiguredBass figuredBass)
 {
 #ifdef TRACE_OPTIONS
-  if (gTraceOptions->fTraceNotes || gTraceOptions->fTraceHarmonies) {
-    gLogIOstream <<
+  if (gTraceOptions ()->fTraceNotes || gTraceOptions ()->fTraceHarmonies) {
+    gLogIOstream () <<
       "Setting note '" << asShortString ()  << "'" <<
       " figured bass to '" << figuredBass->asString () << "'" <<
       endl;
@@ -4466,8 +4466,8 @@ void msrNote::setNoteFiguredBass (S_msrFiguredBass figuredBass)
 
 void msrNote::acceptIn (basevisitor* v)
 {
-  if (gMsrOptions->fTraceMsrVisitors) {
-    gLogIOstream <<
+  if (gMsrOptions ()->fTraceMsrVisitors) {
+    gLogIOstream () <<
       "% ==> msrNote::acceptIn ()" <<
       endl;
   }
@@ -4477,8 +4477,8 @@ void msrNote::acceptIn (basevisitor* v)
       dynamic_cast<visitor<S_msrNote>*> (v)) {
         S_msrNote elem = this;
         
-        if (gMsrOptions->fTraceMsrVisitors) {
-          gLogIOstream <<
+        if (gMsrOptions ()->fTraceMsrVisitors) {
+          gLogIOstream () <<
             "% ==> Launching msrNote::visitStart ()" <<
             endl;
         }
@@ -4488,8 +4488,8 @@ void msrNote::acceptIn (basevisitor* v)
 
 void msrNote::acceptOut (basevisitor* v)
 {
-  if (gMsrOptions->fTraceMsrVisitors) {
-    gLogIOstream <<
+  if (gMsrOptions ()->fTraceMsrVisitors) {
+    gLogIOstream () <<
       "% ==> msrNote::acceptOut ()" <<
       endl;
   }
@@ -4499,8 +4499,8 @@ void msrNote::acceptOut (basevisitor* v)
       dynamic_cast<visitor<S_msrNote>*> (v)) {
         S_msrNote elem = this;
       
-        if (gMsrOptions->fTraceMsrVisitors) {
-          gLogIOstream <<
+        if (gMsrOptions ()->fTraceMsrVisitors) {
+          gLogIOstream () <<
             "% ==> Launching msrNote::visitEnd ()" <<
             endl;
         }
@@ -4524,43 +4524,43 @@ void msrNote::browseData (basevisitor* v)
 
   // browse the beams if any
   if (fNoteBeams.size ()) {
-    gIndenter++;
+    gIndenter ()++;
     list<S_msrBeam>::const_iterator i;
     for (i=fNoteBeams.begin (); i!=fNoteBeams.end (); i++) {
       // browse the beam
       msrBrowser<msrBeam> browser (v);
       browser.browse (*(*i));
     } // for
-    gIndenter--;
+    gIndenter ()--;
   }
   
   // browse the articulations if any
   if (fNoteArticulations.size ()) {
-    gIndenter++;
+    gIndenter ()++;
     list<S_msrArticulation>::const_iterator i;
     for (i=fNoteArticulations.begin (); i!=fNoteArticulations.end (); i++) {
       // browse the articulation
       msrBrowser<msrArticulation> browser (v);
       browser.browse (*(*i));
     } // for
-    gIndenter--;
+    gIndenter ()--;
   }
   
   // browse the spanners if any
   if (fNoteSpanners.size ()) {
-    gIndenter++;
+    gIndenter ()++;
     list<S_msrSpanner>::const_iterator i;
     for (i=fNoteSpanners.begin (); i!=fNoteSpanners.end (); i++) {
       // browse the spanner
       msrBrowser<msrSpanner> browser (v);
       browser.browse (*(*i));
     } // for
-    gIndenter--;
+    gIndenter ()--;
   }
   
   // browse the technicals if any
   if (fNoteTechnicals.size ()) {
-    gIndenter++;
+    gIndenter ()++;
     list<S_msrTechnical>::const_iterator i;
     for (
       i=fNoteTechnicals.begin ();
@@ -4570,12 +4570,12 @@ void msrNote::browseData (basevisitor* v)
       msrBrowser<msrTechnical> browser (v);
       browser.browse (*(*i));
     } // for
-    gIndenter--;
+    gIndenter ()--;
   }
   
   // browse the technicals with integer if any
   if (fNoteTechnicalWithIntegers.size ()) {
-    gIndenter++;
+    gIndenter ()++;
     list<S_msrTechnicalWithInteger>::const_iterator i;
     for (
       i=fNoteTechnicalWithIntegers.begin ();
@@ -4585,12 +4585,12 @@ void msrNote::browseData (basevisitor* v)
       msrBrowser<msrTechnicalWithInteger> browser (v);
       browser.browse (*(*i));
     } // for
-    gIndenter--;
+    gIndenter ()--;
   }
   
   // browse the technicals with float if any
   if (fNoteTechnicalWithFloats.size ()) {
-    gIndenter++;
+    gIndenter ()++;
     list<S_msrTechnicalWithFloat>::const_iterator i;
     for (
       i=fNoteTechnicalWithFloats.begin ();
@@ -4600,12 +4600,12 @@ void msrNote::browseData (basevisitor* v)
       msrBrowser<msrTechnicalWithFloat> browser (v);
       browser.browse (*(*i));
     } // for
-    gIndenter--;
+    gIndenter ()--;
   }
   
   // browse the technicals with string if any
   if (fNoteTechnicalWithStrings.size ()) {
-    gIndenter++;
+    gIndenter ()++;
     list<S_msrTechnicalWithString>::const_iterator i;
     for (
       i=fNoteTechnicalWithStrings.begin ();
@@ -4615,43 +4615,43 @@ void msrNote::browseData (basevisitor* v)
       msrBrowser<msrTechnicalWithString> browser (v);
       browser.browse (*(*i));
     } // for
-    gIndenter--;
+    gIndenter ()--;
   }
   
   // browse the ornaments if any
   if (fNoteOrnaments.size ()) {
-    gIndenter++;
+    gIndenter ()++;
     list<S_msrOrnament>::const_iterator i;
     for (i=fNoteOrnaments.begin (); i!=fNoteOrnaments.end (); i++) {
       // browse the ornament
       msrBrowser<msrOrnament> browser (v);
       browser.browse (*(*i));
     } // for
-    gIndenter--;
+    gIndenter ()--;
   }
   
   // browse the glissandos if any
   if (fNoteGlissandos.size ()) {
-    gIndenter++;
+    gIndenter ()++;
     list<S_msrGlissando>::const_iterator i;
     for (i=fNoteGlissandos.begin (); i!=fNoteGlissandos.end (); i++) {
       // browse the glissando
       msrBrowser<msrGlissando> browser (v);
       browser.browse (*(*i));
     } // for
-    gIndenter--;
+    gIndenter ()--;
   }
   
   // browse the slides if any
   if (fNoteSlides.size ()) {
-    gIndenter++;
+    gIndenter ()++;
     list<S_msrSlide>::const_iterator i;
     for (i=fNoteSlides.begin (); i!=fNoteSlides.end (); i++) {
       // browse the glissando
       msrBrowser<msrSlide> browser (v);
       browser.browse (*(*i));
     } // for
-    gIndenter--;
+    gIndenter ()--;
   }
   
   // browse the grace notes group before if any
@@ -4683,158 +4683,158 @@ void msrNote::browseData (basevisitor* v)
 
   // browse the dynamics if any
   if (fNoteDynamics.size ()) {
-    gIndenter++;
+    gIndenter ()++;
     list<S_msrDynamics>::const_iterator i;
     for (i=fNoteDynamics.begin (); i!=fNoteDynamics.end (); i++) {
       // browse the dynamics
       msrBrowser<msrDynamics> browser (v);
       browser.browse (*(*i));
     } // for
-    gIndenter--;
+    gIndenter ()--;
   }
 
   // browse the other dynamics if any
   if (fNoteOtherDynamics.size ()) {
-    gIndenter++;
+    gIndenter ()++;
     list<S_msrOtherDynamics>::const_iterator i;
     for (i=fNoteOtherDynamics.begin (); i!=fNoteOtherDynamics.end (); i++) {
       // browse the other dynamics
       msrBrowser<msrOtherDynamics> browser (v);
       browser.browse (*(*i));
     } // for
-    gIndenter--;
+    gIndenter ()--;
   }
 
   // browse the words if any
   if (fNoteWords.size ()) {
-    gIndenter++;
+    gIndenter ()++;
     list<S_msrWords>::const_iterator i;
     for (i=fNoteWords.begin (); i!=fNoteWords.end (); i++) {
       // browse the words
       msrBrowser<msrWords> browser (v);
       browser.browse (*(*i));
     } // for
-    gIndenter--;
+    gIndenter ()--;
   }
   
   // browse the slurs if any
   if (fNoteSlurs.size ()) {
-    gIndenter++;
+    gIndenter ()++;
     list<S_msrSlur>::const_iterator i;
     for (i=fNoteSlurs.begin (); i!=fNoteSlurs.end (); i++) {
       // browse the slur
       msrBrowser<msrSlur> browser (v);
       browser.browse (*(*i));
     } // for
-    gIndenter--;
+    gIndenter ()--;
   }
 
   // browse the ligatures if any
   if (fNoteLigatures.size ()) {
-    gIndenter++;
+    gIndenter ()++;
     list<S_msrLigature>::const_iterator i;
     for (i=fNoteLigatures.begin (); i!=fNoteLigatures.end (); i++) {
       // browse the ligature
       msrBrowser<msrLigature> browser (v);
       browser.browse (*(*i));
     } // for
-    gIndenter--;
+    gIndenter ()--;
   }
 
   // browse the pedals if any
   if (fNotePedals.size ()) {
-    gIndenter++;
+    gIndenter ()++;
     list<S_msrPedal>::const_iterator i;
     for (i=fNotePedals.begin (); i!=fNotePedals.end (); i++) {
       // browse the pedal
       msrBrowser<msrPedal> browser (v);
       browser.browse (*(*i));
     } // for
-    gIndenter--;
+    gIndenter ()--;
   }
 
   // browse the wedges if any
   if (fNoteSlashes.size ()) {
-    gIndenter++;
+    gIndenter ()++;
     list<S_msrSlash>::const_iterator i;
     for (i=fNoteSlashes.begin (); i!=fNoteSlashes.end (); i++) {
       // browse the wedge
       msrBrowser<msrSlash> browser (v);
       browser.browse (*(*i));
     } // for
-    gIndenter--;
+    gIndenter ()--;
   }
 
   // browse the wedges if any
   if (fNoteWedges.size ()) {
-    gIndenter++;
+    gIndenter ()++;
     list<S_msrWedge>::const_iterator i;
     for (i=fNoteWedges.begin (); i!=fNoteWedges.end (); i++) {
       // browse the wedge
       msrBrowser<msrWedge> browser (v);
       browser.browse (*(*i));
     } // for
-    gIndenter--;
+    gIndenter ()--;
   }
 
   // browse the eyeglasses if any
   if (fNoteEyeGlasses.size ()) {
-    gIndenter++;
+    gIndenter ()++;
     list<S_msrEyeGlasses>::const_iterator i;
     for (i=fNoteEyeGlasses.begin (); i!=fNoteEyeGlasses.end (); i++) {
       // browse the eyeglasses
       msrBrowser<msrEyeGlasses> browser (v);
       browser.browse (*(*i));
     } // for
-    gIndenter--;
+    gIndenter ()--;
   }
 
   // browse the damps if any
   if (fNoteDamps.size ()) {
-    gIndenter++;
+    gIndenter ()++;
     list<S_msrDamp>::const_iterator i;
     for (i=fNoteDamps.begin (); i!=fNoteDamps.end (); i++) {
       // browse the damp
       msrBrowser<msrDamp> browser (v);
       browser.browse (*(*i));
     } // for
-    gIndenter--;
+    gIndenter ()--;
   }
 
   // browse the damp alls if any
   if (fNoteDampAlls.size ()) {
-    gIndenter++;
+    gIndenter ()++;
     list<S_msrDampAll>::const_iterator i;
     for (i=fNoteDampAlls.begin (); i!=fNoteDampAlls.end (); i++) {
       // browse the damp all
       msrBrowser<msrDampAll> browser (v);
       browser.browse (*(*i));
     } // for
-    gIndenter--;
+    gIndenter ()--;
   }
 
   // browse the scordaturas if any
   if (fNoteScordaturas.size ()) {
-    gIndenter++;
+    gIndenter ()++;
     list<S_msrScordatura>::const_iterator i;
     for (i=fNoteScordaturas.begin (); i!=fNoteScordaturas.end (); i++) {
       // browse the scordatura
       msrBrowser<msrScordatura> browser (v);
       browser.browse (*(*i));
     } // for
-    gIndenter--;
+    gIndenter ()--;
   }
 
   // browse the syllables if any
   if (fNoteSyllables.size ()) {
-    gIndenter++;
+    gIndenter ()++;
     list<S_msrSyllable>::const_iterator i;
     for (i=fNoteSyllables.begin (); i!=fNoteSyllables.end (); i++) {
       // browse the syllable
       msrBrowser<msrSyllable> browser (v);
       browser.browse (*(*i));
     } // for
-    gIndenter--;
+    gIndenter ()--;
   }
 
   if (fNoteHarmony) {
@@ -4866,7 +4866,7 @@ string msrNote::notePitchAsString () const
   else {
     s <<
       msrQuarterTonesPitchKindAsString (
-        gMsrOptions->fMsrQuarterTonesPitchesLanguageKind,
+        gMsrOptions ()->fMsrQuarterTonesPitchesLanguageKind,
         fNoteQuarterTonesPitchKind);
   }
   
@@ -4879,7 +4879,7 @@ string msrNote::noteDisplayPitchKindAsString () const
   
   s <<
     msrQuarterTonesPitchKindAsString (
-      gMsrOptions->fMsrQuarterTonesPitchesLanguageKind,
+      gMsrOptions ()->fMsrQuarterTonesPitchesLanguageKind,
       fNoteQuarterTonesDisplayPitchKind);  
   
   return s.str ();
@@ -4911,7 +4911,7 @@ string msrNote::noteDiatonicPitchKindAsString (
 {
   return
     msrDiatonicPitchKindAsString (
-      gMsrOptions->fMsrQuarterTonesPitchesLanguageKind,
+      gMsrOptions ()->fMsrQuarterTonesPitchesLanguageKind,
       noteDiatonicPitchKind (
         fInputLineNumber));
 }
@@ -5481,11 +5481,11 @@ void msrNote::print (ostream& os)
     asString () <<
     endl;
 
-  gIndenter++;
+  gIndenter ()++;
 
   const int fieldWidth = 34;
 
-  if (fNoteMeasureUplink || gMsrOptions->fDisplayMsrDetails) {
+  if (fNoteMeasureUplink || gMsrOptions ()->fDisplayMsrDetails) {
     os <<
       setw (fieldWidth) <<
       "noteMeasureUplink";
@@ -5493,12 +5493,12 @@ void msrNote::print (ostream& os)
     if (fNoteMeasureUplink) {
       os <<
         endl;
-      gIndenter++;
+      gIndenter ()++;
       
       os <<
         fNoteMeasureUplink->asShortString ();
 
-      gIndenter--;
+      gIndenter ()--;
     }
     else {
       os <<
@@ -5509,7 +5509,7 @@ void msrNote::print (ostream& os)
       endl;
   }
   
-  if (fNoteChordUplink || gMsrOptions->fDisplayMsrDetails) {
+  if (fNoteChordUplink || gMsrOptions ()->fDisplayMsrDetails) {
     os <<
       setw (fieldWidth) <<
       "noteChordUplink";
@@ -5517,12 +5517,12 @@ void msrNote::print (ostream& os)
     if (fNoteChordUplink) {
       os <<
         endl;
-      gIndenter++;
+      gIndenter ()++;
 
       os <<
         fNoteChordUplink->asShortString ();
 
-      gIndenter--;
+      gIndenter ()--;
     }
     else {
       os <<
@@ -5533,7 +5533,7 @@ void msrNote::print (ostream& os)
       endl;
   }
 
-  if (fNoteGraceNotesGroupUplink || gMsrOptions->fDisplayMsrDetails) {
+  if (fNoteGraceNotesGroupUplink || gMsrOptions ()->fDisplayMsrDetails) {
     os <<
       setw (fieldWidth) <<
       "noteGraceNoteGroupUplink";
@@ -5541,12 +5541,12 @@ void msrNote::print (ostream& os)
     if (fNoteGraceNotesGroupUplink) {
       os <<
         endl;
-      gIndenter++;
+      gIndenter ()++;
 
       os <<
         fNoteGraceNotesGroupUplink->asShortString ();
 
-      gIndenter--;
+      gIndenter ()--;
     }
     else {
       os <<
@@ -5557,7 +5557,7 @@ void msrNote::print (ostream& os)
       endl;
   }
 
-  if (fNoteTupletUplink || gMsrOptions->fDisplayMsrDetails) {
+  if (fNoteTupletUplink || gMsrOptions ()->fDisplayMsrDetails) {
     os <<
       setw (fieldWidth) <<
       "noteTupletUplink";
@@ -5565,12 +5565,12 @@ void msrNote::print (ostream& os)
     if (fNoteTupletUplink) {
       os <<
         endl;
-      gIndenter++;
+      gIndenter ()++;
 
       os <<
         fNoteTupletUplink->asShortString ();
 
-      gIndenter--;
+      gIndenter ()--;
     }
     else {
       os <<
@@ -5767,7 +5767,7 @@ void msrNote::print (ostream& os)
       
  // JMI     msrInternalError (
       msrInternalWarning (
-        gXml2lyOptions->fInputSourceName,
+        gXml2lyOptions ()->fInputSourceName,
         fInputLineNumber,
         s.str ());
     }
@@ -5809,7 +5809,7 @@ void msrNote::print (ostream& os)
 
     stringstream s;
     
-    if (fNoteIsStemless || gMsrOptions->fDisplayMsrDetails) {
+    if (fNoteIsStemless || gMsrOptions ()->fDisplayMsrDetails) {
       os <<
         setw (fieldWidth) <<
         "noteIsStemless" <<
@@ -5819,7 +5819,7 @@ void msrNote::print (ostream& os)
         endl;
     }
   
-    if (fNoteIsFirstNoteInADoubleTremolo || gMsrOptions->fDisplayMsrDetails) {
+    if (fNoteIsFirstNoteInADoubleTremolo || gMsrOptions ()->fDisplayMsrDetails) {
       os <<
         setw (fieldWidth) <<
         "noteIsFirstNoteInADoubleTremolo" <<
@@ -5828,7 +5828,7 @@ void msrNote::print (ostream& os)
           fNoteIsFirstNoteInADoubleTremolo) <<
         endl;
     }
-    if (fNoteIsSecondNoteInADoubleTremolo || gMsrOptions->fDisplayMsrDetails) {
+    if (fNoteIsSecondNoteInADoubleTremolo || gMsrOptions ()->fDisplayMsrDetails) {
       os <<
         setw (fieldWidth) <<
         "noteIsSecondNoteInADoubleTremolo" <<
@@ -5838,7 +5838,7 @@ void msrNote::print (ostream& os)
         endl;
     }
   
-    if (fNoteTrillOrnament || gMsrOptions->fDisplayMsrDetails) {
+    if (fNoteTrillOrnament || gMsrOptions ()->fDisplayMsrDetails) {
       os <<
         setw (fieldWidth) <<
         "noteTrillOrnament" <<
@@ -5848,7 +5848,7 @@ void msrNote::print (ostream& os)
         endl;
     }
         
-    if (fNoteDashesOrnament || gMsrOptions->fDisplayMsrDetails) {
+    if (fNoteDashesOrnament || gMsrOptions ()->fDisplayMsrDetails) {
       os <<
         setw (fieldWidth) <<
         "noteDashesOrnament" <<
@@ -5858,7 +5858,7 @@ void msrNote::print (ostream& os)
         endl;
     }
           
-    if (fNoteDelayedTurnOrnament || gMsrOptions->fDisplayMsrDetails) {
+    if (fNoteDelayedTurnOrnament || gMsrOptions ()->fDisplayMsrDetails) {
       os <<
         setw (fieldWidth) <<
         "noteDelayedTurnOrnament" <<
@@ -5867,7 +5867,7 @@ void msrNote::print (ostream& os)
           fNoteDelayedTurnOrnament) <<
         endl;
     }
-    if (fNoteDelayedInvertedTurnOrnament || gMsrOptions->fDisplayMsrDetails) {
+    if (fNoteDelayedInvertedTurnOrnament || gMsrOptions ()->fDisplayMsrDetails) {
       os <<
         setw (fieldWidth) <<
         "noteDelayedInvertedTurnOrnament" <<
@@ -5877,7 +5877,7 @@ void msrNote::print (ostream& os)
         endl;
     }
 
-    if (fNoteWavyLineSpannerStart || gMsrOptions->fDisplayMsrDetails) {
+    if (fNoteWavyLineSpannerStart || gMsrOptions ()->fDisplayMsrDetails) {
       os <<
         setw (fieldWidth) <<
         "noteWavyLineSpannerStart" <<
@@ -5886,7 +5886,7 @@ void msrNote::print (ostream& os)
           fNoteWavyLineSpannerStart) <<
         endl;
     }
-    if (fNoteWavyLineSpannerStop || gMsrOptions->fDisplayMsrDetails) {
+    if (fNoteWavyLineSpannerStop || gMsrOptions ()->fDisplayMsrDetails) {
       os <<
         setw (fieldWidth) <<
         "noteWavyLineSpannerStop" <<
@@ -5896,7 +5896,7 @@ void msrNote::print (ostream& os)
         endl;
     }
         
-    if (fNoteIsFollowedByGraceNotesGroup || gMsrOptions->fDisplayMsrDetails) {
+    if (fNoteIsFollowedByGraceNotesGroup || gMsrOptions ()->fDisplayMsrDetails) {
       os <<
         setw (fieldWidth) <<
         "noteIsFollowedByGraceNotesGroup" <<
@@ -6048,7 +6048,7 @@ void msrNote::print (ostream& os)
   // print the syllables associated to this note if any
   int noteSyllablesSize = fNoteSyllables.size ();
 
-  if (noteSyllablesSize > 0 || gMsrOptions->fDisplayMsrDetails) {
+  if (noteSyllablesSize > 0 || gMsrOptions ()->fDisplayMsrDetails) {
     os <<
       setw (fieldWidth) <<
       "noteSyllables";
@@ -6056,7 +6056,7 @@ void msrNote::print (ostream& os)
       os <<
         endl;
 
-      gIndenter++;
+      gIndenter ()++;
             
       list<S_msrSyllable>::const_iterator
         iBegin = fNoteSyllables.begin (),
@@ -6096,7 +6096,7 @@ void msrNote::print (ostream& os)
         // no endl here
       } // for
     
-      gIndenter--;
+      gIndenter ()--;
     }
     else {
       os << " : " <<
@@ -6106,7 +6106,7 @@ void msrNote::print (ostream& os)
   }
 
   // print the octave shift if any
-  if (fNoteOctaveShift || gMsrOptions->fDisplayMsrDetails) {
+  if (fNoteOctaveShift || gMsrOptions ()->fDisplayMsrDetails) {
     os <<
       setw (fieldWidth) <<
       "noteOctaveShift";
@@ -6114,12 +6114,12 @@ void msrNote::print (ostream& os)
       os <<
         endl;
 
-      gIndenter++;
+      gIndenter ()++;
         
       os <<
         fNoteOctaveShift;
         
-      gIndenter--;
+      gIndenter ()--;
     }
     else {
       os << " : " <<
@@ -6129,19 +6129,19 @@ void msrNote::print (ostream& os)
   }
 
   // print the stem if any
-  if (fNoteStem || gMsrOptions->fDisplayMsrDetails) {
+  if (fNoteStem || gMsrOptions ()->fDisplayMsrDetails) {
     os <<
       setw (fieldWidth) <<
       "noteStem";
     if (fNoteStem) {
       os <<
         endl;
-      gIndenter++;
+      gIndenter ()++;
         
       os <<
         fNoteStem;
 
-      gIndenter--;
+      gIndenter ()--;
     }
     else {
       os << " : " <<
@@ -6153,7 +6153,7 @@ void msrNote::print (ostream& os)
   // print the beams if any
   int noteBeamsSize = fNoteBeams.size ();
 
-  if (noteBeamsSize > 0 || gMsrOptions->fDisplayMsrDetails) {
+  if (noteBeamsSize > 0 || gMsrOptions ()->fDisplayMsrDetails) {
     os <<
       setw (fieldWidth) <<
       "noteBeams";
@@ -6161,7 +6161,7 @@ void msrNote::print (ostream& os)
       os <<
         endl;
 
-      gIndenter++;
+      gIndenter ()++;
         
       list<S_msrBeam>::const_iterator
         iBegin = fNoteBeams.begin (),
@@ -6173,7 +6173,7 @@ void msrNote::print (ostream& os)
         // no endl here;
       } // for
               
-      gIndenter--;
+      gIndenter ()--;
     }
     else {
       os << " : " <<
@@ -6185,7 +6185,7 @@ void msrNote::print (ostream& os)
   // print the articulations if any
   int noteArticulationsSize = fNoteArticulations.size ();
 
-  if (noteArticulationsSize > 0 || gMsrOptions->fDisplayMsrDetails) {
+  if (noteArticulationsSize > 0 || gMsrOptions ()->fDisplayMsrDetails) {
     os <<
       setw (fieldWidth) <<
       "noteArticulations";
@@ -6193,7 +6193,7 @@ void msrNote::print (ostream& os)
       os <<
         endl;
 
-      gIndenter++;
+      gIndenter ()++;
         
       list<S_msrArticulation>::const_iterator
         iBegin = fNoteArticulations.begin (),
@@ -6205,7 +6205,7 @@ void msrNote::print (ostream& os)
         // no endl here;
       } // for
               
-      gIndenter--;
+      gIndenter ()--;
     }
     else {
       os << " : " <<
@@ -6217,7 +6217,7 @@ void msrNote::print (ostream& os)
   // print the spanners if any
   int noteSpannersSize = fNoteSpanners.size ();
 
-  if (noteSpannersSize > 0 || gMsrOptions->fDisplayMsrDetails) {
+  if (noteSpannersSize > 0 || gMsrOptions ()->fDisplayMsrDetails) {
     os <<
       setw (fieldWidth) <<
       "noteSpanners";
@@ -6225,7 +6225,7 @@ void msrNote::print (ostream& os)
       os <<
         endl;
 
-      gIndenter++;
+      gIndenter ()++;
           
       list<S_msrSpanner>::const_iterator
         iBegin = fNoteSpanners.begin (),
@@ -6237,7 +6237,7 @@ void msrNote::print (ostream& os)
         // no endl here;
       } // for
                 
-      gIndenter--;
+      gIndenter ()--;
     }
     else {
       os << " : " <<
@@ -6249,7 +6249,7 @@ void msrNote::print (ostream& os)
   // print the technicals if any
   int noteTechnicalsSize = fNoteTechnicals.size ();
 
-  if (noteTechnicalsSize > 0 || gMsrOptions->fDisplayMsrDetails) {
+  if (noteTechnicalsSize > 0 || gMsrOptions ()->fDisplayMsrDetails) {
     os <<
       setw (fieldWidth) <<
       "noteTechnicals";
@@ -6257,7 +6257,7 @@ void msrNote::print (ostream& os)
       os <<
         endl;
 
-      gIndenter++;
+      gIndenter ()++;
           
       list<S_msrTechnical>::const_iterator
         iBegin = fNoteTechnicals.begin (),
@@ -6269,7 +6269,7 @@ void msrNote::print (ostream& os)
         // no endl here;
       } // for
                 
-      gIndenter--;
+      gIndenter ()--;
     }
     else {
       os << " : " <<
@@ -6281,7 +6281,7 @@ void msrNote::print (ostream& os)
   // print the technicals with integer if any
   int noteTechnicalWithIntegersSize = fNoteTechnicalWithIntegers.size ();
 
-  if (noteTechnicalWithIntegersSize > 0 || gMsrOptions->fDisplayMsrDetails) {
+  if (noteTechnicalWithIntegersSize > 0 || gMsrOptions ()->fDisplayMsrDetails) {
     os <<
       setw (fieldWidth) <<
       "noteTechnicalWithIntegers";
@@ -6289,7 +6289,7 @@ void msrNote::print (ostream& os)
       os <<
         endl;
 
-      gIndenter++;
+      gIndenter ()++;
           
       list<S_msrTechnicalWithInteger>::const_iterator
         iBegin = fNoteTechnicalWithIntegers.begin (),
@@ -6301,7 +6301,7 @@ void msrNote::print (ostream& os)
         // no endl here;
       } // for
                 
-      gIndenter--;
+      gIndenter ()--;
     }
     else {
       os << " : " <<
@@ -6313,7 +6313,7 @@ void msrNote::print (ostream& os)
   // print the technicals with float if any
   int noteTechnicalWithFloatsSize = fNoteTechnicalWithFloats.size ();
 
-  if (noteTechnicalWithFloatsSize > 0 || gMsrOptions->fDisplayMsrDetails) {
+  if (noteTechnicalWithFloatsSize > 0 || gMsrOptions ()->fDisplayMsrDetails) {
     os <<
       setw (fieldWidth) <<
       "noteTechnicalWithFloats";
@@ -6321,7 +6321,7 @@ void msrNote::print (ostream& os)
       os <<
         endl;
 
-      gIndenter++;
+      gIndenter ()++;
           
       list<S_msrTechnicalWithFloat>::const_iterator
         iBegin = fNoteTechnicalWithFloats.begin (),
@@ -6333,7 +6333,7 @@ void msrNote::print (ostream& os)
         // no endl here;
       } // for
                 
-      gIndenter--;
+      gIndenter ()--;
     }
     else {
       os << " : " <<
@@ -6345,7 +6345,7 @@ void msrNote::print (ostream& os)
   // print the technicals with string if any
   int noteTechnicalWithStringsSize = fNoteTechnicalWithStrings.size ();
 
-  if (noteTechnicalWithStringsSize > 0 || gMsrOptions->fDisplayMsrDetails) {
+  if (noteTechnicalWithStringsSize > 0 || gMsrOptions ()->fDisplayMsrDetails) {
     os <<
       setw (fieldWidth) <<
       "noteTechnicalWithStrings";
@@ -6353,7 +6353,7 @@ void msrNote::print (ostream& os)
       os <<
         endl;
 
-      gIndenter++;
+      gIndenter ()++;
           
       list<S_msrTechnicalWithString>::const_iterator
         iBegin = fNoteTechnicalWithStrings.begin (),
@@ -6365,7 +6365,7 @@ void msrNote::print (ostream& os)
         // no endl here;
       } // for
                 
-      gIndenter--;
+      gIndenter ()--;
     }
     else {
       os << " : " <<
@@ -6377,7 +6377,7 @@ void msrNote::print (ostream& os)
   // print the ornaments if any
   int noteOrnamentsSize = fNoteOrnaments.size ();
 
-  if (noteOrnamentsSize > 0 || gMsrOptions->fDisplayMsrDetails) {
+  if (noteOrnamentsSize > 0 || gMsrOptions ()->fDisplayMsrDetails) {
     os <<
       setw (fieldWidth) <<
       "noteOrnaments";
@@ -6385,7 +6385,7 @@ void msrNote::print (ostream& os)
       os <<
         endl;
 
-      gIndenter++;
+      gIndenter ()++;
           
       list<S_msrOrnament>::const_iterator
         iBegin = fNoteOrnaments.begin (),
@@ -6397,7 +6397,7 @@ void msrNote::print (ostream& os)
         // no endl here;
       } // for
                 
-      gIndenter--;
+      gIndenter ()--;
     }
     else {
       os << " : " <<
@@ -6409,7 +6409,7 @@ void msrNote::print (ostream& os)
   // print the glissandos if any
   int noteGlissandosSize = fNoteGlissandos.size ();
 
-  if (noteGlissandosSize > 0 || gMsrOptions->fDisplayMsrDetails) {
+  if (noteGlissandosSize > 0 || gMsrOptions ()->fDisplayMsrDetails) {
     os <<
       setw (fieldWidth) <<
       "noteGlissandos";
@@ -6417,7 +6417,7 @@ void msrNote::print (ostream& os)
       os <<
         endl;
 
-      gIndenter++;
+      gIndenter ()++;
           
       list<S_msrGlissando>::const_iterator
         iBegin = fNoteGlissandos.begin (),
@@ -6429,7 +6429,7 @@ void msrNote::print (ostream& os)
         // no endl here;
       } // for
                 
-      gIndenter--;
+      gIndenter ()--;
     }
     else {
       os << " : " <<
@@ -6441,7 +6441,7 @@ void msrNote::print (ostream& os)
   // print the slides if any
   int noteSlidesSize = fNoteSlides.size ();
 
-  if (noteSlidesSize > 0 || gMsrOptions->fDisplayMsrDetails) {
+  if (noteSlidesSize > 0 || gMsrOptions ()->fDisplayMsrDetails) {
     os <<
       setw (fieldWidth) <<
       "noteSlides";
@@ -6449,7 +6449,7 @@ void msrNote::print (ostream& os)
       os <<
         endl;
 
-      gIndenter++;
+      gIndenter ()++;
           
       list<S_msrSlide>::const_iterator
         iBegin = fNoteSlides.begin (),
@@ -6461,7 +6461,7 @@ void msrNote::print (ostream& os)
         // no endl here;
       } // for
                 
-      gIndenter--;
+      gIndenter ()--;
     }
     else {
       os << " : " <<
@@ -6471,7 +6471,7 @@ void msrNote::print (ostream& os)
   }
   
   // print the grace notes group before if any
-  if (fNoteGraceNotesGroupBefore || gMsrOptions->fDisplayMsrDetails) {
+  if (fNoteGraceNotesGroupBefore || gMsrOptions ()->fDisplayMsrDetails) {
     os <<
       setw (fieldWidth) <<
       "noteGraceNotesGroupBefore";
@@ -6479,11 +6479,11 @@ void msrNote::print (ostream& os)
       os <<
         endl;
 
-      gIndenter++;
+      gIndenter ()++;
         
       os << fNoteGraceNotesGroupBefore;
       
-      gIndenter--;
+      gIndenter ()--;
     }
     else {
       os << " : " <<
@@ -6493,7 +6493,7 @@ void msrNote::print (ostream& os)
   }
     
   // print the after grace group notes after if any
-  if (fNoteGraceNotesGroupAfter || gMsrOptions->fDisplayMsrDetails) {
+  if (fNoteGraceNotesGroupAfter || gMsrOptions ()->fDisplayMsrDetails) {
     os <<
       setw (fieldWidth) <<
       "noteGraceNotesGroupAfter";
@@ -6501,11 +6501,11 @@ void msrNote::print (ostream& os)
       os <<
         endl;
 
-      gIndenter++;
+      gIndenter ()++;
         
       os << fNoteGraceNotesGroupAfter;
       
-      gIndenter--;
+      gIndenter ()--;
     }
     else {
       os << " : " <<
@@ -6515,7 +6515,7 @@ void msrNote::print (ostream& os)
   }
     
   // print the singleTremolo if any
-  if (fNoteSingleTremolo || gMsrOptions->fDisplayMsrDetails) {
+  if (fNoteSingleTremolo || gMsrOptions ()->fDisplayMsrDetails) {
     os <<
       setw (fieldWidth) <<
       "noteSingleTremolo";
@@ -6523,11 +6523,11 @@ void msrNote::print (ostream& os)
       os <<
         endl;
 
-      gIndenter++;
+      gIndenter ()++;
         
       os << fNoteSingleTremolo;
       
-      gIndenter--;
+      gIndenter ()--;
     }
     else {
       os << " : " <<
@@ -6537,7 +6537,7 @@ void msrNote::print (ostream& os)
   }
     
   // print the tie if any
-  if (fNoteTie || gMsrOptions->fDisplayMsrDetails) {
+  if (fNoteTie || gMsrOptions ()->fDisplayMsrDetails) {
     os <<
       setw (fieldWidth) <<
       "noteTie";
@@ -6545,12 +6545,12 @@ void msrNote::print (ostream& os)
       os <<
         endl;
 
-      gIndenter++;
+      gIndenter ()++;
         
       os <<
         fNoteTie;
       
-      gIndenter--;
+      gIndenter ()--;
     }
     else {
       os << " : " <<
@@ -6562,7 +6562,7 @@ void msrNote::print (ostream& os)
   // print the dynamics if any
   int noteDynamicsSize = fNoteDynamics.size ();
 
-  if (noteDynamicsSize > 0 || gMsrOptions->fDisplayMsrDetails) {
+  if (noteDynamicsSize > 0 || gMsrOptions ()->fDisplayMsrDetails) {
     os <<
       setw (fieldWidth) <<
       "noteDynamics";
@@ -6570,7 +6570,7 @@ void msrNote::print (ostream& os)
       os <<
         endl;
 
-      gIndenter++;
+      gIndenter ()++;
               
       list<S_msrDynamics>::const_iterator
         iBegin = fNoteDynamics.begin (),
@@ -6582,7 +6582,7 @@ void msrNote::print (ostream& os)
         // no endl here;
       } // for
       
-      gIndenter--;
+      gIndenter ()--;
     }
     else {
       os << " : " <<
@@ -6594,7 +6594,7 @@ void msrNote::print (ostream& os)
   // print the other dynamics if any
   int noteOtherDynamicsSize = fNoteOtherDynamics.size ();
 
-  if (noteOtherDynamicsSize > 0 || gMsrOptions->fDisplayMsrDetails) {
+  if (noteOtherDynamicsSize > 0 || gMsrOptions ()->fDisplayMsrDetails) {
     os <<
       setw (fieldWidth) <<
       "noteOtherDynamics";
@@ -6602,7 +6602,7 @@ void msrNote::print (ostream& os)
       os <<
         endl;
 
-      gIndenter++;
+      gIndenter ()++;
               
       list<S_msrOtherDynamics>::const_iterator
         iBegin = fNoteOtherDynamics.begin (),
@@ -6614,7 +6614,7 @@ void msrNote::print (ostream& os)
         // no endl here;
       } // for
         
-      gIndenter--;
+      gIndenter ()--;
     }
     else {
       os << " : " <<
@@ -6626,12 +6626,12 @@ void msrNote::print (ostream& os)
   // print the words if any
   int noteWordsSize = fNoteWords.size ();
 
-  if (noteWordsSize > 0 || gMsrOptions->fDisplayMsrDetails) {
+  if (noteWordsSize > 0 || gMsrOptions ()->fDisplayMsrDetails) {
     os <<
       setw (fieldWidth) <<
       "noteWords";
     if (fNoteWords.size ()) {
-      gIndenter++;
+      gIndenter ()++;
             os <<
         endl;
 
@@ -6645,7 +6645,7 @@ void msrNote::print (ostream& os)
         // no endl here;
       } // for
         
-      gIndenter--;
+      gIndenter ()--;
     }
     else {
       os << " : " <<
@@ -6657,7 +6657,7 @@ void msrNote::print (ostream& os)
   // print the slurs if any
   int noteSlursSize = fNoteSlurs.size ();
 
-  if (noteSlursSize > 0 || gMsrOptions->fDisplayMsrDetails) {
+  if (noteSlursSize > 0 || gMsrOptions ()->fDisplayMsrDetails) {
     os <<
       setw (fieldWidth) <<
       "noteSlurs";
@@ -6665,7 +6665,7 @@ void msrNote::print (ostream& os)
       os <<
         endl;
 
-      gIndenter++;
+      gIndenter ()++;
         
       list<S_msrSlur>::const_iterator
         iBegin = fNoteSlurs.begin (),
@@ -6677,7 +6677,7 @@ void msrNote::print (ostream& os)
         // no endl here;
       } // for
       
-      gIndenter--;
+      gIndenter ()--;
     }
     else {
       os << " : " <<
@@ -6689,7 +6689,7 @@ void msrNote::print (ostream& os)
   // print the ligatures if any
   int noteLigaturesSize = fNoteLigatures.size ();
 
-  if (noteLigaturesSize > 0 || gMsrOptions->fDisplayMsrDetails) {
+  if (noteLigaturesSize > 0 || gMsrOptions ()->fDisplayMsrDetails) {
     os <<
       setw (fieldWidth) <<
       "noteLigatures";
@@ -6697,7 +6697,7 @@ void msrNote::print (ostream& os)
       os <<
         endl;
 
-      gIndenter++;
+      gIndenter ()++;
               
       list<S_msrLigature>::const_iterator
         iBegin = fNoteLigatures.begin (),
@@ -6709,7 +6709,7 @@ void msrNote::print (ostream& os)
         // no endl here;
       } // for
             
-      gIndenter--;
+      gIndenter ()--;
     }
     else {
       os << " : " <<
@@ -6721,7 +6721,7 @@ void msrNote::print (ostream& os)
   // print the pedals if any
   int notePedalsSize = fNotePedals.size ();
 
-  if (notePedalsSize > 0 || gMsrOptions->fDisplayMsrDetails) {
+  if (notePedalsSize > 0 || gMsrOptions ()->fDisplayMsrDetails) {
     os <<
       setw (fieldWidth) <<
       "notePedals";
@@ -6729,7 +6729,7 @@ void msrNote::print (ostream& os)
       os <<
         endl;
 
-      gIndenter++;
+      gIndenter ()++;
               
       list<S_msrPedal>::const_iterator
         iBegin = fNotePedals.begin (),
@@ -6741,7 +6741,7 @@ void msrNote::print (ostream& os)
         // no endl here;
       } // for
       
-      gIndenter--;
+      gIndenter ()--;
     }
     else {
       os << " : " <<
@@ -6753,7 +6753,7 @@ void msrNote::print (ostream& os)
   // print the slashes if any
   int noteSlashesSize = fNoteSlashes.size ();
 
-  if (noteSlashesSize > 0 || gMsrOptions->fDisplayMsrDetails) {
+  if (noteSlashesSize > 0 || gMsrOptions ()->fDisplayMsrDetails) {
     os <<
       setw (fieldWidth) <<
       "noteSlashes";
@@ -6761,7 +6761,7 @@ void msrNote::print (ostream& os)
       os <<
         endl;
 
-      gIndenter++;
+      gIndenter ()++;
         
       list<S_msrSlash>::const_iterator
         iBegin = fNoteSlashes.begin (),
@@ -6773,7 +6773,7 @@ void msrNote::print (ostream& os)
         // no endl here;
       } // for
             
-      gIndenter--;
+      gIndenter ()--;
     }
     else {
       os << " : " <<
@@ -6785,7 +6785,7 @@ void msrNote::print (ostream& os)
   // print the wedges if any
   int noteWedgesSize = fNoteWedges.size ();
 
-  if (noteWedgesSize > 0 || gMsrOptions->fDisplayMsrDetails) {
+  if (noteWedgesSize > 0 || gMsrOptions ()->fDisplayMsrDetails) {
     os <<
       setw (fieldWidth) <<
       "noteWedges";
@@ -6793,7 +6793,7 @@ void msrNote::print (ostream& os)
       os <<
         endl;
 
-      gIndenter++;
+      gIndenter ()++;
               
       list<S_msrWedge>::const_iterator
         iBegin = fNoteWedges.begin (),
@@ -6805,7 +6805,7 @@ void msrNote::print (ostream& os)
         // no endl here;
       } // for
             
-      gIndenter--;
+      gIndenter ()--;
     }
     else {
       os << " : " <<
@@ -6817,7 +6817,7 @@ void msrNote::print (ostream& os)
   // print the eyeglasses if any
   int noteEyeGlassesSize = fNoteEyeGlasses.size ();
 
-  if (noteEyeGlassesSize > 0 || gMsrOptions->fDisplayMsrDetails) {
+  if (noteEyeGlassesSize > 0 || gMsrOptions ()->fDisplayMsrDetails) {
     os <<
       setw (fieldWidth) <<
       "noteEyeGlasses";
@@ -6825,7 +6825,7 @@ void msrNote::print (ostream& os)
       os <<
         endl;
 
-      gIndenter++;
+      gIndenter ()++;
               
       list<S_msrEyeGlasses>::const_iterator
         iBegin = fNoteEyeGlasses.begin (),
@@ -6837,7 +6837,7 @@ void msrNote::print (ostream& os)
         // no endl here;
       } // for
             
-      gIndenter--;
+      gIndenter ()--;
     }
     else {
       os << " : " <<
@@ -6849,7 +6849,7 @@ void msrNote::print (ostream& os)
   // print the damps if any
   int noteDampsSize = fNoteDamps.size ();
 
-  if (noteDampsSize > 0 || gMsrOptions->fDisplayMsrDetails) {
+  if (noteDampsSize > 0 || gMsrOptions ()->fDisplayMsrDetails) {
     os <<
       setw (fieldWidth) <<
       "noteDamps";
@@ -6857,7 +6857,7 @@ void msrNote::print (ostream& os)
       os <<
         endl;
 
-      gIndenter++;
+      gIndenter ()++;
               
       list<S_msrDamp>::const_iterator
         iBegin = fNoteDamps.begin (),
@@ -6869,7 +6869,7 @@ void msrNote::print (ostream& os)
         // no endl here;
       } // for
             
-      gIndenter--;
+      gIndenter ()--;
     }
     else {
       os << " : " <<
@@ -6881,7 +6881,7 @@ void msrNote::print (ostream& os)
   // print the dampAlls if any
   int noteDampAllsSize = fNoteDampAlls.size ();
 
-  if (noteDampAllsSize > 0 || gMsrOptions->fDisplayMsrDetails) {
+  if (noteDampAllsSize > 0 || gMsrOptions ()->fDisplayMsrDetails) {
     os <<
       setw (fieldWidth) <<
       "noteDampAlls";
@@ -6889,7 +6889,7 @@ void msrNote::print (ostream& os)
       os <<
         endl;
 
-      gIndenter++;
+      gIndenter ()++;
               
       list<S_msrDampAll>::const_iterator
         iBegin = fNoteDampAlls.begin (),
@@ -6901,7 +6901,7 @@ void msrNote::print (ostream& os)
         // no endl here;
       } // for
             
-      gIndenter--;
+      gIndenter ()--;
     }
     else {
       os << " : " <<
@@ -6913,7 +6913,7 @@ void msrNote::print (ostream& os)
   // print the scordaturas if any
   int noteScordaturasSize = fNoteScordaturas.size ();
 
-  if (noteScordaturasSize > 0 || gMsrOptions->fDisplayMsrDetails) {
+  if (noteScordaturasSize > 0 || gMsrOptions ()->fDisplayMsrDetails) {
     os <<
       setw (fieldWidth) <<
       "noteScordaturas";
@@ -6921,7 +6921,7 @@ void msrNote::print (ostream& os)
       os <<
         endl;
 
-      gIndenter++;
+      gIndenter ()++;
               
       list<S_msrScordatura>::const_iterator
         iBegin = fNoteScordaturas.begin (),
@@ -6933,7 +6933,7 @@ void msrNote::print (ostream& os)
         // no endl here;
       } // for
             
-      gIndenter--;
+      gIndenter ()--;
     }
     else {
       os << " : " <<
@@ -6943,12 +6943,12 @@ void msrNote::print (ostream& os)
   }
 
   // print the harmony if any
-  if (fNoteHarmony || gMsrOptions->fDisplayMsrDetails) {
+  if (fNoteHarmony || gMsrOptions ()->fDisplayMsrDetails) {
     os <<
       setw (fieldWidth) <<
       "noteHarmony";
     if (fNoteHarmony) {
-      gIndenter++;
+      gIndenter ()++;
       
       os <<
         endl;
@@ -6957,7 +6957,7 @@ void msrNote::print (ostream& os)
         fNoteHarmony <<
         endl;
         
-      gIndenter--;
+      gIndenter ()--;
     }
     else {
       os << " : " <<
@@ -6967,7 +6967,7 @@ void msrNote::print (ostream& os)
   }
 
   // print the frame if any
-  if (fNoteFrame || gMsrOptions->fDisplayMsrDetails) {
+  if (fNoteFrame || gMsrOptions ()->fDisplayMsrDetails) {
     os <<
       setw (fieldWidth) <<
       "noteFrame";
@@ -6975,13 +6975,13 @@ void msrNote::print (ostream& os)
       os <<
         endl;
 
-      gIndenter++;
+      gIndenter ()++;
         
       os <<
         fNoteFrame <<
         endl;
       
-      gIndenter--;
+      gIndenter ()--;
     }
     else {
       os << " : " <<
@@ -6991,7 +6991,7 @@ void msrNote::print (ostream& os)
   }
 
   // print the figured bass if any
-  if (fNoteFiguredBass || gMsrOptions->fDisplayMsrDetails) {
+  if (fNoteFiguredBass || gMsrOptions ()->fDisplayMsrDetails) {
     os <<
       setw (fieldWidth) <<
       "noteFiguredBass";
@@ -6999,13 +6999,13 @@ void msrNote::print (ostream& os)
       os <<
         endl;
 
-      gIndenter++;
+      gIndenter ()++;
         
       os <<
         fNoteFiguredBass <<
         endl;
       
-      gIndenter--;
+      gIndenter ()--;
     }
     else {
       os << " : " <<
@@ -7014,7 +7014,7 @@ void msrNote::print (ostream& os)
     }
   }
 
-  gIndenter--;
+  gIndenter ()--;
 }
 
 ostream& operator<< (ostream& os, const S_msrNote& elt)
@@ -7031,8 +7031,8 @@ S_msrChord msrChord::create (
   msrDurationKind chordGraphicDurationKind)
 {
 #ifdef TRACE_OPTIONS
-  if (gTraceOptions->fTraceChords) {
-    gLogIOstream <<
+  if (gTraceOptions ()->fTraceChords) {
+    gLogIOstream () <<
       "Creating a chord" <<
       ", chordSoundingWholeNotes = " << chordSoundingWholeNotes <<
       ", chordDisplayWholeNotes = " << chordDisplayWholeNotes <<
@@ -7075,8 +7075,8 @@ S_msrChord msrChord::createChordNewbornClone (
   S_msrPart containingPart)
 {
 #ifdef TRACE_OPTIONS
-  if (gTraceOptions->fTraceChords) {
-    gLogIOstream <<
+  if (gTraceOptions ()->fTraceChords) {
+    gLogIOstream () <<
       "Creating a newborn clone of chord '" <<
       asString () <<
       "'" <<
@@ -7119,8 +7119,8 @@ void msrChord::setChordSoundingWholeNotes (
   rational wholeNotes)
 {
 #ifdef TRACE_OPTIONS
-  if (gTraceOptions->fTraceChords) {
-    gLogIOstream <<
+  if (gTraceOptions ()->fTraceChords) {
+    gLogIOstream () <<
       "Setting chord sounding whole notes to '" <<
       wholeNotes <<
       "' for chord '" <<
@@ -7137,8 +7137,8 @@ void msrChord::setChordDisplayWholeNotes (
   rational wholeNotes)
 {
 #ifdef TRACE_OPTIONS
-  if (gTraceOptions->fTraceChords) {
-    gLogIOstream <<
+  if (gTraceOptions ()->fTraceChords) {
+    gLogIOstream () <<
       "Setting chord displayed whole notes to '" <<
       wholeNotes <<
       "' for chord '" <<
@@ -7156,8 +7156,8 @@ void msrChord::addFirstNoteToChord (
   S_msrVoice voice)
 {
 #ifdef TRACE_OPTIONS
-  if (gTraceOptions->fTraceChords) {
-    gLogIOstream <<
+  if (gTraceOptions ()->fTraceChords) {
+    gLogIOstream () <<
       "Adding first note '" <<
       note->asString () <<
       "' to chord '" <<
@@ -7201,8 +7201,8 @@ void msrChord::addAnotherNoteToChord (
   S_msrVoice voice)
 {
 #ifdef TRACE_OPTIONS
-  if (gTraceOptions->fTraceChords) {
-    gLogIOstream <<
+  if (gTraceOptions ()->fTraceChords) {
+    gLogIOstream () <<
       "Adding another note '" <<
       note->asShortString () <<
       "' to chord '" <<
@@ -7254,7 +7254,7 @@ S_msrNote msrChord::fetchChordFirstNonGraceNote () const
   
   else {
     msrInternalError (
-      gXml2lyOptions->fInputSourceName,
+      gXml2lyOptions ()->fInputSourceName,
       fInputLineNumber,
       __FILE__, __LINE__,
       "cannot access the first note of an empty chord");
@@ -7280,8 +7280,8 @@ void msrChord::appendArticulationToChord (S_msrArticulation art)
   } // for
 
 #ifdef TRACE_OPTIONS
-  if (gTraceOptions->fTraceArticulations || gTraceOptions->fTraceChords) {
-    gLogIOstream <<
+  if (gTraceOptions ()->fTraceArticulations || gTraceOptions ()->fTraceChords) {
+    gLogIOstream () <<
       "Appending articulation '" <<
       art->articulationKindAsString () <<
       "' to chord" <<
@@ -7309,8 +7309,8 @@ void msrChord::appendSpannerToChord (S_msrSpanner span)
   } // for
 
 #ifdef TRACE_OPTIONS
-  if (gTraceOptions->fTraceSpanners || gTraceOptions->fTraceChords) {
-    gLogIOstream <<
+  if (gTraceOptions ()->fTraceSpanners || gTraceOptions ()->fTraceChords) {
+    gLogIOstream () <<
       "Appending spanner '" <<
       span->spannerKindAsString () <<
       "' to chord '" <<
@@ -7326,8 +7326,8 @@ void msrChord::appendSpannerToChord (S_msrSpanner span)
 void msrChord::setChordSingleTremolo (S_msrSingleTremolo trem)
 {
 #ifdef TRACE_OPTIONS
-  if (gTraceOptions->fTraceTremolos || gTraceOptions->fTraceChords) {
-    gLogIOstream <<
+  if (gTraceOptions ()->fTraceTremolos || gTraceOptions ()->fTraceChords) {
+    gLogIOstream () <<
       "Adding singleTremolo '" <<
       trem->asString () <<
       "' to chord" <<
@@ -7356,8 +7356,8 @@ void msrChord::appendTechnicalToChord (S_msrTechnical tech)
   } // for
 
 #ifdef TRACE_OPTIONS
-  if (gTraceOptions->fTraceChords) {
-    gLogIOstream <<
+  if (gTraceOptions ()->fTraceChords) {
+    gLogIOstream () <<
       "Appending technical '" <<
       tech->asString () <<
       "' to chord" <<
@@ -7387,8 +7387,8 @@ void msrChord::appendTechnicalWithIntegerToChord (
   } // for
 
 #ifdef TRACE_OPTIONS
-  if (gTraceOptions->fTraceChords) {
-    gLogIOstream <<
+  if (gTraceOptions ()->fTraceChords) {
+    gLogIOstream () <<
       "Appending technical with integer '" <<
       tech->asString () <<
       "' to chord" <<
@@ -7418,8 +7418,8 @@ void msrChord::appendTechnicalWithFloatToChord (
   } // for
 
 #ifdef TRACE_OPTIONS
-  if (gTraceOptions->fTraceChords) {
-    gLogIOstream <<
+  if (gTraceOptions ()->fTraceChords) {
+    gLogIOstream () <<
       "Appending technical with integer '" <<
       tech->asString () <<
       "' to chord" <<
@@ -7449,8 +7449,8 @@ void msrChord::appendTechnicalWithStringToChord (
   } // for
 
 #ifdef TRACE_OPTIONS
-  if (gTraceOptions->fTraceChords) {
-    gLogIOstream <<
+  if (gTraceOptions ()->fTraceChords) {
+    gLogIOstream () <<
       "Appending technical with string '" <<
       tech->asString () <<
       "' to chord" <<
@@ -7478,8 +7478,8 @@ void msrChord::appendOrnamentToChord (S_msrOrnament orn)
   } // for
 
 #ifdef TRACE_OPTIONS
-  if (gTraceOptions->fTraceChords) {
-    gLogIOstream <<
+  if (gTraceOptions ()->fTraceChords) {
+    gLogIOstream () <<
       "Appending ornament '" <<
       orn->ornamentKindAsString () <<
       "' to chord" <<
@@ -7507,8 +7507,8 @@ void msrChord::appendGlissandoToChord (S_msrGlissando gliss)
   } // for
 
 #ifdef TRACE_OPTIONS
-  if (gTraceOptions->fTraceChords) {
-    gLogIOstream <<
+  if (gTraceOptions ()->fTraceChords) {
+    gLogIOstream () <<
       "Appending glissando '" <<
       gliss->asString () <<
       "' to chord" <<
@@ -7536,8 +7536,8 @@ void msrChord::appendSlideToChord (S_msrSlide slide)
   } // for
 
 #ifdef TRACE_OPTIONS
-  if (gTraceOptions->fTraceChords) {
-    gLogIOstream <<
+  if (gTraceOptions ()->fTraceChords) {
+    gLogIOstream () <<
       "Appending slide '" <<
       slide->asString () <<
       "' to chord" <<
@@ -7551,8 +7551,8 @@ void msrChord::appendSlideToChord (S_msrSlide slide)
 void msrChord::appendBeamToChord (S_msrBeam beam)
 {
 #ifdef TRACE_OPTIONS
-  if (gTraceOptions->fTraceBeams || gTraceOptions->fTraceChords) {
-    gLogIOstream <<
+  if (gTraceOptions ()->fTraceBeams || gTraceOptions ()->fTraceChords) {
+    gLogIOstream () <<
       "Appending beam '" <<
       beam->asString () <<
       "' to chord" <<
@@ -7565,8 +7565,8 @@ void msrChord::appendBeamToChord (S_msrBeam beam)
 
 void msrChord::acceptIn (basevisitor* v)
 {
-  if (gMsrOptions->fTraceMsrVisitors) {
-    gLogIOstream <<
+  if (gMsrOptions ()->fTraceMsrVisitors) {
+    gLogIOstream () <<
       "% ==> msrChord::acceptIn ()" <<
       endl;
   }
@@ -7576,8 +7576,8 @@ void msrChord::acceptIn (basevisitor* v)
       dynamic_cast<visitor<S_msrChord>*> (v)) {
         S_msrChord elem = this;
         
-        if (gMsrOptions->fTraceMsrVisitors) {
-          gLogIOstream <<
+        if (gMsrOptions ()->fTraceMsrVisitors) {
+          gLogIOstream () <<
             "% ==> Launching msrChord::visitStart ()" <<
             endl;
         }
@@ -7587,8 +7587,8 @@ void msrChord::acceptIn (basevisitor* v)
 
 void msrChord::acceptOut (basevisitor* v)
 {
-  if (gMsrOptions->fTraceMsrVisitors) {
-    gLogIOstream <<
+  if (gMsrOptions ()->fTraceMsrVisitors) {
+    gLogIOstream () <<
       "% ==> msrChord::acceptOut ()" <<
       endl;
   }
@@ -7598,8 +7598,8 @@ void msrChord::acceptOut (basevisitor* v)
       dynamic_cast<visitor<S_msrChord>*> (v)) {
         S_msrChord elem = this;
       
-        if (gMsrOptions->fTraceMsrVisitors) {
-          gLogIOstream <<
+        if (gMsrOptions ()->fTraceMsrVisitors) {
+          gLogIOstream () <<
             "% ==> Launching msrChord::visitEnd ()" <<
             endl;
         }
@@ -7773,8 +7773,8 @@ void msrChord::applyTupletMemberDisplayFactorToChordMembers (
   int actualNotes, int normalNotes)
 {
 #ifdef TRACE_OPTIONS
-  if (gTraceOptions->fTraceTuplets || gTraceOptions->fTraceChords) {
-    gLogIOstream <<
+  if (gTraceOptions ()->fTraceTuplets || gTraceOptions ()->fTraceChords) {
+    gLogIOstream () <<
       "Applying tuplet member sounding factor '" <<
       actualNotes << "/" << normalNotes <<
       "' to the members of chord '" << asStringwithRawDivisions () <<
@@ -7942,7 +7942,7 @@ void msrChord::print (ostream& os)
     ", line " << fInputLineNumber <<
     endl;
     
-  gIndenter++;
+  gIndenter ()++;
 
   const int fieldWidth = 35;
   
@@ -7998,14 +7998,14 @@ void msrChord::print (ostream& os)
   // print the member notes if any
   int chordNotesVectorSize = fChordNotesVector.size ();
   
-  if (chordNotesVectorSize || gMsrOptions->fDisplayMsrDetails) {
+  if (chordNotesVectorSize || gMsrOptions ()->fDisplayMsrDetails) {
     os <<
       setw (fieldWidth) <<
       "chordNotes";
     if (chordNotesVectorSize) {
       os <<
         endl;
-      gIndenter++;
+      gIndenter ()++;
       
       vector<S_msrNote>::const_iterator
         iBegin = fChordNotesVector.begin (),
@@ -8018,7 +8018,7 @@ void msrChord::print (ostream& os)
         os << endl;
       } // for
 
-      gIndenter--;
+      gIndenter ()--;
     }
     else {
       os << ":" << "none" <<
@@ -8101,21 +8101,21 @@ void msrChord::print (ostream& os)
   // print the beams if any
   int chordBeamsSize = fChordBeams.size ();
   
-  if (chordBeamsSize || gMsrOptions->fDisplayMsrDetails) {
+  if (chordBeamsSize || gMsrOptions ()->fDisplayMsrDetails) {
     os <<
       setw (fieldWidth) <<
       "chordBeams";
     if (chordBeamsSize) {
       os <<
         endl;
-      gIndenter++;
+      gIndenter ()++;
   
       list<S_msrBeam>::const_iterator i;
       for (i=fChordBeams.begin (); i!=fChordBeams.end (); i++) {
         os << (*i);
       } // for
       
-    gIndenter--;
+    gIndenter ()--;
     }
     else {
       os <<
@@ -8173,71 +8173,71 @@ void msrChord::print (ostream& os)
   }
 
   // print the grace notes groups if any
-  if (fChordGraceNotesGroupBefore || gMsrOptions->fDisplayMsrDetails) {
+  if (fChordGraceNotesGroupBefore || gMsrOptions ()->fDisplayMsrDetails) {
     os <<
       setw (fieldWidth) <<
       "chordGraceNotesGroupBefore" << " : " <<
       endl;
         
-    gIndenter++;
+    gIndenter ()++;
 
     os <<
       fChordGraceNotesGroupBefore->asString () <<
       endl;
       
-    gIndenter--;
+    gIndenter ()--;
   }
-  if (fChordGraceNotesGroupAfter || gMsrOptions->fDisplayMsrDetails) {
+  if (fChordGraceNotesGroupAfter || gMsrOptions ()->fDisplayMsrDetails) {
     os <<
       setw (fieldWidth) <<
       "chordGraceNotesGroupAfter" << " : " <<
       endl;
         
-    gIndenter++;
+    gIndenter ()++;
 
     os <<
       fChordGraceNotesGroupAfter->asString () <<
       endl;
       
-    gIndenter--;
+    gIndenter ()--;
   }
 
   // print the harmony if any
-  if (fChordHarmony || gMsrOptions->fDisplayMsrDetails) {
+  if (fChordHarmony || gMsrOptions ()->fDisplayMsrDetails) {
     os <<
       setw (fieldWidth) <<
       "chordHarmony" << " : " <<
       endl;
         
-    gIndenter++;
+    gIndenter ()++;
 
     os <<
       fChordHarmony->asString () <<
       endl;
       
-    gIndenter--;
+    gIndenter ()--;
   }
 
   // print the figured bass if any
-  if (fChordFiguredBass || gMsrOptions->fDisplayMsrDetails) {
+  if (fChordFiguredBass || gMsrOptions ()->fDisplayMsrDetails) {
     os <<
       setw (fieldWidth) <<
       "chordFiguredBass" << " : " <<
       endl;
         
-    gIndenter++;
+    gIndenter ()++;
 
     os <<
       fChordFiguredBass->asString () <<
       endl;
       
-    gIndenter--;
+    gIndenter ()--;
   }
 
   os <<
     endl;
 
-  gIndenter--;
+  gIndenter ()--;
 }
 
 ostream& operator<< (ostream& os, const S_msrChord& elt)
@@ -8331,8 +8331,8 @@ msrTuplet::~msrTuplet ()
 S_msrTuplet msrTuplet::createTupletNewbornClone ()
 {
 #ifdef TRACE_OPTIONS
-  if (gTraceOptions->fTraceTuplets) {
-    gLogIOstream <<
+  if (gTraceOptions ()->fTraceTuplets) {
+    gLogIOstream () <<
       "Creating a newborn clone of tuplet '" <<
       asString () <<
       "'" <<
@@ -8474,8 +8474,8 @@ void msrTuplet::addNoteToTuplet (
   S_msrVoice voice)
 {
 #ifdef TRACE_OPTIONS
-  if (gTraceOptions->fTraceTuplets) {
-    gLogIOstream <<
+  if (gTraceOptions ()->fTraceTuplets) {
+    gLogIOstream () <<
       "Adding note '" <<
       note->asShortString () <<
       // the information is missing to display it the normal way
@@ -8495,7 +8495,6 @@ void msrTuplet::addNoteToTuplet (
   // account for note duration
   fTupletSoundingWholeNotes +=
     note->getNoteSoundingWholeNotes ();
-  fTupletSoundingWholeNotes.rationalise ();
   
   fTupletDisplayWholeNotes += // JMI
     note->getNoteDisplayWholeNotes ();  
@@ -8509,8 +8508,8 @@ void msrTuplet::addNoteToTuplet (
 void msrTuplet::addChordToTuplet (S_msrChord chord)
 {
 #ifdef TRACE_OPTIONS
-  if (gTraceOptions->fTraceChords || gTraceOptions->fTraceTuplets) {
-    gLogIOstream <<
+  if (gTraceOptions ()->fTraceChords || gTraceOptions ()->fTraceTuplets) {
+    gLogIOstream () <<
       "Adding chord '" <<
       chord->asString () <<
       "' to tuplet '" <<
@@ -8525,7 +8524,6 @@ void msrTuplet::addChordToTuplet (S_msrChord chord)
   // account for chord duration
   fTupletSoundingWholeNotes +=
     chord->getChordSoundingWholeNotes ();
-  fTupletSoundingWholeNotes.rationalise ();
 
   fTupletDisplayWholeNotes += // JMI
     chord->getChordDisplayWholeNotes ();  
@@ -8543,8 +8541,8 @@ void msrTuplet::addChordToTuplet (S_msrChord chord)
 void msrTuplet::addTupletToTuplet (S_msrTuplet tuplet)
 {
 #ifdef TRACE_OPTIONS
-  if (gTraceOptions->fTraceTuplets) {
-    gLogIOstream <<
+  if (gTraceOptions ()->fTraceTuplets) {
+    gLogIOstream () <<
       "Adding tuplet '" <<
       tuplet->asString () <<
       "' to tuplet '" <<
@@ -8569,11 +8567,9 @@ void msrTuplet::addTupletToTuplet (S_msrTuplet tuplet)
   // account for tuplet duration
   fTupletSoundingWholeNotes +=
     tuplet->getTupletSoundingWholeNotes ();
-  fTupletSoundingWholeNotes.rationalise ();
 
   fTupletDisplayWholeNotes += // JMI
     tuplet->getTupletDisplayWholeNotes ();
-  fTupletDisplayWholeNotes.rationalise ();
     
     /*
   fTupletDisplayWholeNotes += // JMI
@@ -8592,8 +8588,8 @@ void msrTuplet::addTupletToTuplet (S_msrTuplet tuplet)
 void msrTuplet::addTupletToTupletClone (S_msrTuplet tuplet)
 {
 #ifdef TRACE_OPTIONS
-  if (gTraceOptions->fTraceTuplets) {
-    gLogIOstream <<
+  if (gTraceOptions ()->fTraceTuplets) {
+    gLogIOstream () <<
       "Adding tuplet '" <<
       tuplet->asString () <<
       "' to tuplet '" <<
@@ -8612,11 +8608,9 @@ void msrTuplet::addTupletToTupletClone (S_msrTuplet tuplet)
   // account for tuplet duration
   fTupletSoundingWholeNotes +=
     tuplet->getTupletSoundingWholeNotes ();
-  fTupletSoundingWholeNotes.rationalise ();
 
   fTupletDisplayWholeNotes +=
     tuplet->getTupletDisplayWholeNotes ();
-  fTupletDisplayWholeNotes.rationalise ();
 }
 
 S_msrNote msrTuplet::fetchTupletFirstNonGraceNote () const
@@ -8645,7 +8639,7 @@ S_msrNote msrTuplet::fetchTupletFirstNonGraceNote () const
   
   else {
     msrInternalError (
-      gXml2lyOptions->fInputSourceName,
+      gXml2lyOptions ()->fInputSourceName,
       fInputLineNumber,
       __FILE__, __LINE__,
       "cannot access the first note of an empty tuplet");
@@ -8660,8 +8654,8 @@ S_msrNote msrTuplet::removeFirstNoteFromTuplet (
   S_msrNote result;
   
 #ifdef TRACE_OPTIONS
-  if (gTraceOptions->fTraceTuplets) {
-    gLogIOstream <<
+  if (gTraceOptions ()->fTraceTuplets) {
+    gLogIOstream () <<
       "Removing first note from tuplet '" <<
       asString () <<
       "'" <<
@@ -8683,11 +8677,11 @@ S_msrNote msrTuplet::removeFirstNoteFromTuplet (
     
     else {
       if (true) {
-        this->print (gLogIOstream);
+        this->print (gLogIOstream ());
       }
       
       msrInternalError (
-        gXml2lyOptions->fInputSourceName,
+        gXml2lyOptions ()->fInputSourceName,
         fInputLineNumber,
         __FILE__, __LINE__,
         "removeFirstNoteFromTuplet () expects a note as the first tuplet element");
@@ -8705,7 +8699,6 @@ S_msrNote msrTuplet::removeFirstNoteFromTuplet (
         // account for note duration
         fTupletSoundingWholeNotes -=
           note->getNoteSoundingWholeNotes ();
-        fTupletSoundingWholeNotes.rationalise ();
 
         fTupletDisplayWholeNotes -= // JMI
           note->getNoteDisplayWholeNotes ();  
@@ -8734,7 +8727,7 @@ S_msrNote msrTuplet::removeFirstNoteFromTuplet (
       " since it has not been found";
 
     msrInternalError (
-      gXml2lyOptions->fInputSourceName,
+      gXml2lyOptions ()->fInputSourceName,
       inputLineNumber,
       __FILE__, __LINE__,
       s.str ());
@@ -8754,7 +8747,7 @@ S_msrNote msrTuplet::removeFirstNoteFromTuplet (
       "\"";
 
     msrInternalError (
-      gXml2lyOptions->fInputSourceName,
+      gXml2lyOptions ()->fInputSourceName,
       inputLineNumber,
       __FILE__, __LINE__,
       s.str ());
@@ -8769,8 +8762,8 @@ S_msrNote msrTuplet::removeLastNoteFromTuplet (
   S_msrNote result;
   
 #ifdef TRACE_OPTIONS
-  if (gTraceOptions->fTraceTuplets) {
-    gLogIOstream <<
+  if (gTraceOptions ()->fTraceTuplets) {
+    gLogIOstream () <<
       "Removing last note from tuplet '" <<
       asString () <<
       "'" <<
@@ -8792,11 +8785,11 @@ S_msrNote msrTuplet::removeLastNoteFromTuplet (
     
     else {
       if (true) {
-        this->print (gLogIOstream);
+        this->print (gLogIOstream ());
       }
       
       msrInternalError (
-        gXml2lyOptions->fInputSourceName,
+        gXml2lyOptions ()->fInputSourceName,
         fInputLineNumber,
         __FILE__, __LINE__,
         "removeLastNoteFromTuplet () expects a note as the last tuplet element");
@@ -8816,15 +8809,15 @@ S_msrNote msrTuplet::removeLastNoteFromTuplet (
       "\"";
 
     msrInternalError (
-      gXml2lyOptions->fInputSourceName,
+      gXml2lyOptions ()->fInputSourceName,
       inputLineNumber,
       __FILE__, __LINE__,
       s.str ());
   }
 
 #ifdef TRACE_OPTIONS
-  if (gTraceOptions->fTraceNotes || gTraceOptions->fTraceGraceNotes) {
-    gLogIOstream <<
+  if (gTraceOptions ()->fTraceNotes || gTraceOptions ()->fTraceGraceNotes) {
+    gLogIOstream () <<
       "This last note from grace notes '" <<
       asString () <<
       "' turns out to be '" <<
@@ -8889,7 +8882,7 @@ rational msrTuplet::setTupletPositionInMeasure (
     
     else {
       msrInternalError (
-        gXml2lyOptions->fInputSourceName,
+        gXml2lyOptions ()->fInputSourceName,
         fInputLineNumber,
         __FILE__, __LINE__,
         "tuplet member should be a note, a chord or another tuplet");
@@ -8908,14 +8901,14 @@ void msrTuplet::unapplySoundingFactorToTupletMembers (
   */
 {
 #ifdef TRACE_OPTIONS
-  if (gTraceOptions->fTraceTuplets) {
-    gLogIOstream <<
+  if (gTraceOptions ()->fTraceTuplets) {
+    gLogIOstream () <<
       "unapplySoundingFactorToTupletMembers ()" <<
       endl;
 
-    gIndenter++;
+    gIndenter ()++;
     
-    gLogIOstream <<
+    gLogIOstream () <<
       "% fTupletFactor = " << fTupletFactor.asString () <<
       /*
       "% fTupletActualNotes = " <<
@@ -8934,7 +8927,7 @@ void msrTuplet::unapplySoundingFactorToTupletMembers (
       endl <<
       endl;
 
-    gIndenter--;
+    gIndenter ()--;
   }
 #endif
 
@@ -8953,8 +8946,8 @@ void msrTuplet::unapplySoundingFactorToTupletMembers (
 
 void msrTuplet::acceptIn (basevisitor* v)
 {
-  if (gMsrOptions->fTraceMsrVisitors) {
-    gLogIOstream <<
+  if (gMsrOptions ()->fTraceMsrVisitors) {
+    gLogIOstream () <<
       "% ==> msrTuplet::acceptIn ()" <<
       endl;
   }
@@ -8964,8 +8957,8 @@ void msrTuplet::acceptIn (basevisitor* v)
       dynamic_cast<visitor<S_msrTuplet>*> (v)) {
         S_msrTuplet elem = this;
         
-        if (gMsrOptions->fTraceMsrVisitors) {
-          gLogIOstream <<
+        if (gMsrOptions ()->fTraceMsrVisitors) {
+          gLogIOstream () <<
             "% ==> Launching msrTuplet::visitStart ()" <<
             endl;
         }
@@ -8975,8 +8968,8 @@ void msrTuplet::acceptIn (basevisitor* v)
 
 void msrTuplet::acceptOut (basevisitor* v)
 {
-  if (gMsrOptions->fTraceMsrVisitors) {
-    gLogIOstream <<
+  if (gMsrOptions ()->fTraceMsrVisitors) {
+    gLogIOstream () <<
       "% ==> msrTuplet::acceptOut ()" <<
       endl;
   }
@@ -8986,8 +8979,8 @@ void msrTuplet::acceptOut (basevisitor* v)
       dynamic_cast<visitor<S_msrTuplet>*> (v)) {
         S_msrTuplet elem = this;
       
-        if (gMsrOptions->fTraceMsrVisitors) {
-          gLogIOstream <<
+        if (gMsrOptions ()->fTraceMsrVisitors) {
+          gLogIOstream () <<
             "% ==> Launching msrTuplet::visitEnd ()" <<
             endl;
         }
@@ -9058,7 +9051,7 @@ string msrTuplet::asString () const
       
       else {
         msrInternalError (
-          gXml2lyOptions->fInputSourceName,
+          gXml2lyOptions ()->fInputSourceName,
           fInputLineNumber,
           __FILE__, __LINE__,
           "tuplet member should be a note, a chord or another tuplet");
@@ -9091,7 +9084,7 @@ void msrTuplet::print (ostream& os)
     ", line " << fInputLineNumber <<
     endl;
 
-  gIndenter++;
+  gIndenter ()++;
   
   const int fieldWidth = 30;
 
@@ -9140,10 +9133,10 @@ void msrTuplet::print (ostream& os)
     endl;
     */
 
-  gIndenter--;
+  gIndenter ()--;
 
   if (fTupletElementsList.size ()) {
-    gIndenter++;
+    gIndenter ()++;
 
     list<S_msrElement>::const_iterator
       iBegin = fTupletElementsList.begin (),
@@ -9155,7 +9148,7 @@ void msrTuplet::print (ostream& os)
       os << endl;
     } // for
     
-    gIndenter--;
+    gIndenter ()--;
     
   // JMI  os << endl;
   }
@@ -9177,7 +9170,7 @@ void msrTuplet::printShort (ostream& os)
     ", line " << fInputLineNumber <<
     endl;
 
-  gIndenter++;
+  gIndenter ()++;
   
   const int fieldWidth = 30;
 
@@ -9226,14 +9219,14 @@ void msrTuplet::printShort (ostream& os)
     endl;
     */
 
-  gIndenter--;
+  gIndenter ()--;
 
   if (fTupletElementsList.size ()) {
     os <<
       "TupletElements:" <<
       endl;
       
-    gIndenter++;
+    gIndenter ()++;
 
     list<S_msrElement>::const_iterator
       iBegin = fTupletElementsList.begin (),
@@ -9247,7 +9240,7 @@ void msrTuplet::printShort (ostream& os)
       os << endl;
     } // for
     
-    gIndenter--;
+    gIndenter ()--;
     
   // JMI  os << endl;
   }
@@ -9300,8 +9293,8 @@ msrGlissando::~msrGlissando ()
 S_msrGlissando msrGlissando::createGlissandoNewbornClone ()
 {
 #ifdef TRACE_OPTIONS
-  if (gTraceOptions->fTraceGlissandos) {
-    gLogIOstream <<
+  if (gTraceOptions ()->fTraceGlissandos) {
+    gLogIOstream () <<
       "Creating a newborn clone of glissando '" <<
       asString () <<
       "'" <<
@@ -9343,8 +9336,8 @@ string msrGlissando::glissandoTypeKindAsString (
 
 void msrGlissando::acceptIn (basevisitor* v)
 {
-  if (gMsrOptions->fTraceMsrVisitors) {
-    gLogIOstream <<
+  if (gMsrOptions ()->fTraceMsrVisitors) {
+    gLogIOstream () <<
       "% ==> msrGlissando::acceptIn ()" <<
       endl;
   }
@@ -9354,8 +9347,8 @@ void msrGlissando::acceptIn (basevisitor* v)
       dynamic_cast<visitor<S_msrGlissando>*> (v)) {
         S_msrGlissando elem = this;
         
-        if (gMsrOptions->fTraceMsrVisitors) {
-          gLogIOstream <<
+        if (gMsrOptions ()->fTraceMsrVisitors) {
+          gLogIOstream () <<
             "% ==> Launching msrGlissando::visitStart ()" <<
             endl;
         }
@@ -9365,8 +9358,8 @@ void msrGlissando::acceptIn (basevisitor* v)
 
 void msrGlissando::acceptOut (basevisitor* v)
 {
-  if (gMsrOptions->fTraceMsrVisitors) {
-    gLogIOstream <<
+  if (gMsrOptions ()->fTraceMsrVisitors) {
+    gLogIOstream () <<
       "% ==> msrGlissando::acceptOut ()" <<
       endl;
   }
@@ -9376,8 +9369,8 @@ void msrGlissando::acceptOut (basevisitor* v)
       dynamic_cast<visitor<S_msrGlissando>*> (v)) {
         S_msrGlissando elem = this;
       
-        if (gMsrOptions->fTraceMsrVisitors) {
-          gLogIOstream <<
+        if (gMsrOptions ()->fTraceMsrVisitors) {
+          gLogIOstream () <<
             "% ==> Launching msrGlissando::visitEnd ()" <<
             endl;
         }
@@ -9412,7 +9405,7 @@ void msrGlissando::print (ostream& os)
     ", line " << fInputLineNumber <<
     endl;
 
-  gIndenter++;
+  gIndenter ()++;
 
   const int fieldWidth = 22;
   
@@ -9437,7 +9430,7 @@ void msrGlissando::print (ostream& os)
      "\"" <<
     endl;
 
-  gIndenter--;
+  gIndenter ()--;
 }
 
 ostream& operator<< (ostream& os, const S_msrGlissando& elt)
@@ -9487,8 +9480,8 @@ msrSlide::~msrSlide ()
 S_msrSlide msrSlide::createSlideNewbornClone ()
 {
 #ifdef TRACE_OPTIONS
-  if (gTraceOptions->fTraceSlides) {
-    gLogIOstream <<
+  if (gTraceOptions ()->fTraceSlides) {
+    gLogIOstream () <<
       "Creating a newborn clone of slide '" <<
       asString () <<
       "'" <<
@@ -9530,8 +9523,8 @@ string msrSlide::slideTypeKindAsString (
 
 void msrSlide::acceptIn (basevisitor* v)
 {
-  if (gMsrOptions->fTraceMsrVisitors) {
-    gLogIOstream <<
+  if (gMsrOptions ()->fTraceMsrVisitors) {
+    gLogIOstream () <<
       "% ==> msrSlide::acceptIn ()" <<
       endl;
   }
@@ -9541,8 +9534,8 @@ void msrSlide::acceptIn (basevisitor* v)
       dynamic_cast<visitor<S_msrSlide>*> (v)) {
         S_msrSlide elem = this;
         
-        if (gMsrOptions->fTraceMsrVisitors) {
-          gLogIOstream <<
+        if (gMsrOptions ()->fTraceMsrVisitors) {
+          gLogIOstream () <<
             "% ==> Launching msrSlide::visitStart ()" <<
             endl;
         }
@@ -9552,8 +9545,8 @@ void msrSlide::acceptIn (basevisitor* v)
 
 void msrSlide::acceptOut (basevisitor* v)
 {
-  if (gMsrOptions->fTraceMsrVisitors) {
-    gLogIOstream <<
+  if (gMsrOptions ()->fTraceMsrVisitors) {
+    gLogIOstream () <<
       "% ==> msrSlide::acceptOut ()" <<
       endl;
   }
@@ -9563,8 +9556,8 @@ void msrSlide::acceptOut (basevisitor* v)
       dynamic_cast<visitor<S_msrSlide>*> (v)) {
         S_msrSlide elem = this;
       
-        if (gMsrOptions->fTraceMsrVisitors) {
-          gLogIOstream <<
+        if (gMsrOptions ()->fTraceMsrVisitors) {
+          gLogIOstream () <<
             "% ==> Launching msrSlide::visitEnd ()" <<
             endl;
         }
@@ -9599,7 +9592,7 @@ void msrSlide::print (ostream& os)
     ", line " << fInputLineNumber <<
     endl;
 
-  gIndenter++;
+  gIndenter ()++;
 
   const int fieldWidth = 22;
   
@@ -9624,7 +9617,7 @@ void msrSlide::print (ostream& os)
      "\"" <<
     endl;
 
-  gIndenter--;
+  gIndenter ()--;
 }
 
 ostream& operator<< (ostream& os, const S_msrSlide& elt)
@@ -9685,16 +9678,16 @@ msrSyllable::msrSyllable (
   fSyllableTupletFactor = syllableTupletFactor;
 
 #ifdef TRACE_OPTIONS
-  if (gTraceOptions->fTraceLyrics) {
-    gLogIOstream <<
+  if (gTraceOptions ()->fTraceLyrics) {
+    gLogIOstream () <<
       "Creating a syllable containing:" <<
       endl;
 
-    gIndenter++;
+    gIndenter ()++;
 
-    print (gLogIOstream);
+    print (gLogIOstream ());
 
-    gIndenter--;
+    gIndenter ()--;
   }
 #endif
 }
@@ -9706,8 +9699,8 @@ S_msrSyllable msrSyllable::createSyllableNewbornClone (
   S_msrPart containingPart)
 {
 #ifdef TRACE_OPTIONS
-  if (gTraceOptions->fTraceLyrics) {
-    gLogIOstream <<
+  if (gTraceOptions ()->fTraceLyrics) {
+    gLogIOstream () <<
       "Creating a newborn clone of syllable '" <<
       asString () <<
       "'" <<
@@ -9753,8 +9746,8 @@ S_msrSyllable msrSyllable::createSyllableDeepCopy (
   S_msrPart containingPart)
 {
 #ifdef TRACE_OPTIONS
-  if (gTraceOptions->fTraceLyrics) {
-    gLogIOstream <<
+  if (gTraceOptions ()->fTraceLyrics) {
+    gLogIOstream () <<
       "Creating a newborn clone of syllable '" <<
       asString () <<
       "'" <<
@@ -9799,8 +9792,8 @@ S_msrSyllable msrSyllable::createSyllableDeepCopy (
 void msrSyllable::appendLyricTextToSyllable (string text)
 {
 #ifdef TRACE_OPTIONS
-  if (gTraceOptions->fTraceLyrics) {
-    gLogIOstream <<
+  if (gTraceOptions ()->fTraceLyrics) {
+    gLogIOstream () <<
       "Appending text \"" <<
       text <<
       "\" to the texts list of syllable '" <<
@@ -9837,28 +9830,28 @@ void msrSyllable::appendSyllableToNoteAndSetItsNoteUplink (
 
   // set it uplink to note
 #ifdef TRACE_OPTIONS
-  if (gTraceOptions->fTraceLyrics) {
-    gLogIOstream <<
+  if (gTraceOptions ()->fTraceLyrics) {
+    gLogIOstream () <<
       "Setting syllable note uplink for:" <<
       endl;
 
-    gIndenter++;
+    gIndenter ()++;
     
-    gLogIOstream <<
+    gLogIOstream () <<
       asString () <<
     // JMI    "to '" << note->asString () <<
       ", line " << note->getInputLineNumber () <<
       endl;
 
-    gIndenter--;
+    gIndenter ()--;
   }
 #endif
 }
 
 void msrSyllable::acceptIn (basevisitor* v)
 {
-  if (gMsrOptions->fTraceMsrVisitors) {
-    gLogIOstream <<
+  if (gMsrOptions ()->fTraceMsrVisitors) {
+    gLogIOstream () <<
       "% ==> msrSyllable::acceptIn ()" <<
       endl;
   }
@@ -9868,8 +9861,8 @@ void msrSyllable::acceptIn (basevisitor* v)
       dynamic_cast<visitor<S_msrSyllable>*> (v)) {
         S_msrSyllable elem = this;
         
-        if (gMsrOptions->fTraceMsrVisitors) {
-          gLogIOstream <<
+        if (gMsrOptions ()->fTraceMsrVisitors) {
+          gLogIOstream () <<
             "% ==> Launching msrSyllable::visitStart ()" <<
             endl;
         }
@@ -9879,8 +9872,8 @@ void msrSyllable::acceptIn (basevisitor* v)
 
 void msrSyllable::acceptOut (basevisitor* v)
 {
-  if (gMsrOptions->fTraceMsrVisitors) {
-    gLogIOstream <<
+  if (gMsrOptions ()->fTraceMsrVisitors) {
+    gLogIOstream () <<
       "% ==> msrSyllable::acceptOut ()" <<
       endl;
   }
@@ -9890,8 +9883,8 @@ void msrSyllable::acceptOut (basevisitor* v)
       dynamic_cast<visitor<S_msrSyllable>*> (v)) {
         S_msrSyllable elem = this;
       
-        if (gMsrOptions->fTraceMsrVisitors) {
-          gLogIOstream <<
+        if (gMsrOptions ()->fTraceMsrVisitors) {
+          gLogIOstream () <<
             "% ==> Launching msrSyllable::visitEnd ()" <<
             endl;
         }
@@ -10153,7 +10146,7 @@ string msrSyllable::asString () const
       
     case msrSyllable::kSyllableNone:
       msrInternalError (
-        gXml2lyOptions->fInputSourceName,
+        gXml2lyOptions ()->fInputSourceName,
         fInputLineNumber,
         __FILE__, __LINE__,
         "syllable type has not been set");
@@ -10176,7 +10169,7 @@ void msrSyllable::print (ostream& os)
     ", line " << fInputLineNumber <<
     endl;
 
-  gIndenter++;
+  gIndenter ()++;
 
   const int fieldWidth = 21;
   os << left <<
@@ -10257,7 +10250,7 @@ void msrSyllable::print (ostream& os)
       
     case kSyllableNone:
       msrInternalError (
-        gXml2lyOptions->fInputSourceName,
+        gXml2lyOptions ()->fInputSourceName,
         fInputLineNumber,
         __FILE__, __LINE__,
         "syllable type has not been set");
@@ -10266,7 +10259,7 @@ void msrSyllable::print (ostream& os)
   os <<
     endl;
 
-  gIndenter--;
+  gIndenter ()--;
 }
 
 ostream& operator<< (ostream& os, const S_msrSyllable& elt)
@@ -10323,8 +10316,8 @@ void msrStanza::initializeStanza ()
           fStanzaNumber));
  
 #ifdef TRACE_OPTIONS
-  if (gTraceOptions->fTraceLyrics) {
-    gLogIOstream <<
+  if (gTraceOptions ()->fTraceLyrics) {
+    gLogIOstream () <<
       "Initializing stanza " << getStanzaName () <<
       endl;
   }
@@ -10342,8 +10335,8 @@ S_msrStanza msrStanza::createStanzaNewbornClone (
   S_msrVoice containingVoice)
 {
 #ifdef TRACE_OPTIONS
-  if (gTraceOptions->fTraceLyrics) {
-    gLogIOstream <<
+  if (gTraceOptions ()->fTraceLyrics) {
+    gLogIOstream () <<
       "Creating a newborn clone of stanza \"" <<
       getStanzaName () <<
       "\" in voice \"" <<
@@ -10388,8 +10381,8 @@ S_msrStanza msrStanza::createStanzaDeepCopy (
   S_msrVoice containingVoice)
 {
 #ifdef TRACE_OPTIONS
-  if (gTraceOptions->fTraceLyrics) {
-    gLogIOstream <<
+  if (gTraceOptions ()->fTraceLyrics) {
+    gLogIOstream () <<
       "Creating a deep copy of stanza \"" <<
       getStanzaName () <<
       "\" in voice \"" <<
@@ -10443,8 +10436,8 @@ void msrStanza::appendSyllableToStanza (
   S_msrSyllable syllable)
 {
 #ifdef TRACE_OPTIONS
-  if (gTraceOptions->fTraceLyrics) {
-    gLogIOstream <<
+  if (gTraceOptions ()->fTraceLyrics) {
+    gLogIOstream () <<
       "Appending syllable '" << syllable->asString () <<
       "' to stanza " << getStanzaName () <<
       endl;
@@ -10474,7 +10467,7 @@ void msrStanza::appendSyllableToStanza (
       
     case msrSyllable::kSyllableNone:
       msrInternalError (
-        gXml2lyOptions->fInputSourceName,
+        gXml2lyOptions ()->fInputSourceName,
         fInputLineNumber,
         __FILE__, __LINE__,
         "syllable type has not been set");
@@ -10499,8 +10492,8 @@ S_msrSyllable msrStanza::appendRestSyllableToStanza (
   rational wholeNotes)
 {
 #ifdef TRACE_OPTIONS
-  if (gTraceOptions->fTraceLyrics) {
-    gLogIOstream <<
+  if (gTraceOptions ()->fTraceLyrics) {
+    gLogIOstream () <<
       "Appending 'Rest' syllable" <<
       " to stanza " << getStanzaName () <<
       ", whole notes = " << wholeNotes <<
@@ -10509,7 +10502,7 @@ S_msrSyllable msrStanza::appendRestSyllableToStanza (
   }
 #endif
 
-  gIndenter++;
+  gIndenter ()++;
   
   // create stanza rest syllable
   S_msrSyllable
@@ -10525,7 +10518,7 @@ S_msrSyllable msrStanza::appendRestSyllableToStanza (
   // append syllable to this stanza
   appendSyllableToStanza (syllable);
 
-  gIndenter--;
+  gIndenter ()--;
   
   // and return it
   return syllable;
@@ -10536,8 +10529,8 @@ S_msrSyllable msrStanza::appendSkipSyllableToStanza (
   rational wholeNotes)
 {
 #ifdef TRACE_OPTIONS
-  if (gTraceOptions->fTraceLyrics) {
-    gLogIOstream <<
+  if (gTraceOptions ()->fTraceLyrics) {
+    gLogIOstream () <<
       "Appending 'Skip' syllable " <<
       " to stanza " << getStanzaName () <<
       ", whole notes = " << wholeNotes <<
@@ -10546,7 +10539,7 @@ S_msrSyllable msrStanza::appendSkipSyllableToStanza (
   }
 #endif
 
-  gIndenter++;
+  gIndenter ()++;
   
   // create stanza skip syllable
   S_msrSyllable
@@ -10562,7 +10555,7 @@ S_msrSyllable msrStanza::appendSkipSyllableToStanza (
   // append syllable to this stanza
   appendSyllableToStanza (syllable);
 
-  gIndenter--;
+  gIndenter ()--;
   
   // and return it
   return syllable;
@@ -10572,8 +10565,8 @@ S_msrSyllable msrStanza::appendMeasureEndSyllableToStanza (
   int inputLineNumber)
 {
 #ifdef TRACE_OPTIONS
-  if (gTraceOptions->fTraceLyrics) {
-    gLogIOstream <<
+  if (gTraceOptions ()->fTraceLyrics) {
+    gLogIOstream () <<
       "Appending 'Measure end' syllable " <<
       " to stanza " << getStanzaName () <<
       ", line " << inputLineNumber <<
@@ -10581,7 +10574,7 @@ S_msrSyllable msrStanza::appendMeasureEndSyllableToStanza (
   }
 #endif
 
-  gIndenter++;
+  gIndenter ()++;
   
   // create stanza skip syllable
   S_msrSyllable
@@ -10600,7 +10593,7 @@ S_msrSyllable msrStanza::appendMeasureEndSyllableToStanza (
   // reset current measure length
   fStanzaCurrentMeasureLength = rational (0, 1);
 
-  gIndenter--;
+  gIndenter ()--;
   
   // and return it
   return syllable;
@@ -10613,8 +10606,8 @@ S_msrSyllable msrStanza::appendMelismaSyllableToStanza (
   rational        wholeNotes)
 {
 #ifdef TRACE_OPTIONS
-  if (gTraceOptions->fTraceLyrics) {
-    gLogIOstream <<
+  if (gTraceOptions ()->fTraceLyrics) {
+    gLogIOstream () <<
       "Appending '" <<
       msrSyllable::syllableKindAsString (syllableKind) <<
       "' syllable" <<
@@ -10625,7 +10618,7 @@ S_msrSyllable msrStanza::appendMelismaSyllableToStanza (
   }
 #endif
 
-  gIndenter++;
+  gIndenter ()++;
   
   // create stanza melisma syllable
   S_msrSyllable
@@ -10641,7 +10634,7 @@ S_msrSyllable msrStanza::appendMelismaSyllableToStanza (
   // append syllable to this stanza
   appendSyllableToStanza (syllable);
 
-  gIndenter--;
+  gIndenter ()--;
   
   // and return it
   return syllable;
@@ -10651,8 +10644,8 @@ S_msrSyllable msrStanza::appendLineBreakSyllableToStanza (
   int inputLineNumber)
 {
 #ifdef TRACE_OPTIONS
-  if (gTraceOptions->fTraceLyrics) {
-    gLogIOstream <<
+  if (gTraceOptions ()->fTraceLyrics) {
+    gLogIOstream () <<
       "Appending 'line break' syllable" <<
       " to stanza " << getStanzaName () <<
       ", line " << inputLineNumber <<
@@ -10660,7 +10653,7 @@ S_msrSyllable msrStanza::appendLineBreakSyllableToStanza (
   }
 #endif
 
-  gIndenter++;
+  gIndenter ()++;
   
   // create stanza line break syllable
   S_msrSyllable
@@ -10676,7 +10669,7 @@ S_msrSyllable msrStanza::appendLineBreakSyllableToStanza (
   // append syllable to this stanza
   appendSyllableToStanza (syllable);
 
-  gIndenter--;
+  gIndenter ()--;
   
   // and return it
   return syllable;
@@ -10687,8 +10680,8 @@ S_msrSyllable msrStanza::appendLineBreakSyllableToStanza (
   string nextMeasureNumber)
 {
 #ifdef TRACE_OPTIONS
-  if (gTraceOptions->fTraceLyrics) {
-    gLogIOstream <<
+  if (gTraceOptions ()->fTraceLyrics) {
+    gLogIOstream () <<
       "Appending a 'LineBreak' syllable" <<
       " to stanza " << getStanzaName () <<
       ", line " << inputLineNumber <<
@@ -10696,7 +10689,7 @@ S_msrSyllable msrStanza::appendLineBreakSyllableToStanza (
   }
 #endif
 
-  gIndenter++;
+  gIndenter ()++;
   
   // create stanza break syllable
   S_msrSyllable
@@ -10713,7 +10706,7 @@ S_msrSyllable msrStanza::appendLineBreakSyllableToStanza (
   // append syllable to this stanza
   appendSyllableToStanza (syllable);
 
-  gIndenter--;
+  gIndenter ()--;
   
   // and return it
   return syllable;
@@ -10724,8 +10717,8 @@ S_msrSyllable msrStanza::appendPageBreakSyllableToStanza (
   string nextMeasureNumber)
 {
 #ifdef TRACE_OPTIONS
-  if (gTraceOptions->fTraceLyrics) {
-    gLogIOstream <<
+  if (gTraceOptions ()->fTraceLyrics) {
+    gLogIOstream () <<
       "Appending a 'PageBreak' syllable" <<
       " to stanza " << getStanzaName () <<
       ", line " << inputLineNumber <<
@@ -10733,7 +10726,7 @@ S_msrSyllable msrStanza::appendPageBreakSyllableToStanza (
   }
 #endif
 
-  gIndenter++;
+  gIndenter ()++;
   
   // create stanza break syllable
   S_msrSyllable
@@ -10750,7 +10743,7 @@ S_msrSyllable msrStanza::appendPageBreakSyllableToStanza (
   // append syllable to this stanza
   appendSyllableToStanza (syllable);
 
-  gIndenter--;
+  gIndenter ()--;
   
   // and return it
   return syllable;
@@ -10769,8 +10762,8 @@ void msrStanza::appendPaddingNoteToStanza (
   int divisionsPerQuarterNote)
 {
 #ifdef TRACE_OPTIONS
-  if (gTraceOptions->fTraceLyrics || gTraceOptions->fTraceMeasures) {
-    gLogIOstream <<
+  if (gTraceOptions ()->fTraceLyrics || gTraceOptions ()->fTraceMeasures) {
+    gLogIOstream () <<
       "Apending padding note of " << divisions <<
       " divisions in stanza \"" <<
       fStanzaName <<
@@ -10781,17 +10774,17 @@ void msrStanza::appendPaddingNoteToStanza (
   }
 #endif
 
-  gIndenter++;
+  gIndenter ()++;
 
   // JMI TO DO ???
   
-  gIndenter--;
+  gIndenter ()--;
 }
 
 void msrStanza::acceptIn (basevisitor* v)
 {
-  if (gMsrOptions->fTraceMsrVisitors) {
-    gLogIOstream <<
+  if (gMsrOptions ()->fTraceMsrVisitors) {
+    gLogIOstream () <<
       "% ==> msrStanza::acceptIn ()" <<
       endl;
   }
@@ -10801,8 +10794,8 @@ void msrStanza::acceptIn (basevisitor* v)
       dynamic_cast<visitor<S_msrStanza>*> (v)) {
         S_msrStanza elem = this;
         
-        if (gMsrOptions->fTraceMsrVisitors) {
-          gLogIOstream <<
+        if (gMsrOptions ()->fTraceMsrVisitors) {
+          gLogIOstream () <<
             "% ==> Launching msrStanza::visitStart ()" <<
             endl;
         }
@@ -10812,8 +10805,8 @@ void msrStanza::acceptIn (basevisitor* v)
 
 void msrStanza::acceptOut (basevisitor* v)
 {
-  if (gMsrOptions->fTraceMsrVisitors) {
-    gLogIOstream <<
+  if (gMsrOptions ()->fTraceMsrVisitors) {
+    gLogIOstream () <<
       "% ==> msrStanza::acceptOut ()" <<
       endl;
   }
@@ -10823,8 +10816,8 @@ void msrStanza::acceptOut (basevisitor* v)
       dynamic_cast<visitor<S_msrStanza>*> (v)) {
         S_msrStanza elem = this;
       
-        if (gMsrOptions->fTraceMsrVisitors) {
-          gLogIOstream <<
+        if (gMsrOptions ()->fTraceMsrVisitors) {
+          gLogIOstream () <<
             "% ==> Launching msrStanza::visitEnd ()" <<
             endl;
         }
@@ -10834,13 +10827,13 @@ void msrStanza::acceptOut (basevisitor* v)
 
 void msrStanza::browseData (basevisitor* v)
 {
-  if (gMsrOptions->fTraceMsrVisitors) {
-    gLogIOstream <<
+  if (gMsrOptions ()->fTraceMsrVisitors) {
+    gLogIOstream () <<
       "% ==> msrStanza::browseData ()" <<
       endl;
   }
 
-  gIndenter++;
+  gIndenter ()++;
   
   // browse the syllables
   int n = fSyllables.size ();
@@ -10850,10 +10843,10 @@ void msrStanza::browseData (basevisitor* v)
     browser.browse (*fSyllables [i]);
   } // for
 
-  gIndenter--;
+  gIndenter ()--;
 
-  if (gMsrOptions->fTraceMsrVisitors) {
-    gLogIOstream <<
+  if (gMsrOptions ()->fTraceMsrVisitors) {
+    gLogIOstream () <<
       "% <== msrStanza::browseData ()" <<
       endl;
   }
@@ -10869,7 +10862,7 @@ void msrStanza::print (ostream& os)
     fSyllables.size () << " syllables)" <<
     endl;
     
-  gIndenter++;
+  gIndenter ()++;
 
   if (! fStanzaTextPresent) {
     os <<
@@ -10892,7 +10885,7 @@ void msrStanza::print (ostream& os)
     }
   }
 
-  gIndenter--;
+  gIndenter ()--;
 }
 
 ostream& operator<< (ostream& os, const S_msrStanza& elt)
@@ -10931,8 +10924,8 @@ msrHarmonyDegree::msrHarmonyDegree (
   fHarmonyDegreeTypeKind       = harmonyDegreeTypeKind;
 
 #ifdef TRACE_OPTIONS
-  if (gTraceOptions->fTraceHarmonies) {
-    gLogIOstream <<
+  if (gTraceOptions ()->fTraceHarmonies) {
+    gLogIOstream () <<
       "Creating harmony degree '" <<
       asString () <<
       "', line " << inputLineNumber <<
@@ -11017,8 +11010,8 @@ int msrHarmonyDegree::harmonyDegreeAsSemitones () const
 
 void msrHarmonyDegree::acceptIn (basevisitor* v)
 {
-  if (gMsrOptions->fTraceMsrVisitors) {
-    gLogIOstream <<
+  if (gMsrOptions ()->fTraceMsrVisitors) {
+    gLogIOstream () <<
       "% ==> msrHarmonyDegree::acceptIn ()" <<
       endl;
   }
@@ -11028,8 +11021,8 @@ void msrHarmonyDegree::acceptIn (basevisitor* v)
       dynamic_cast<visitor<S_msrHarmonyDegree>*> (v)) {
         S_msrHarmonyDegree elem = this;
         
-        if (gMsrOptions->fTraceMsrVisitors) {
-          gLogIOstream <<
+        if (gMsrOptions ()->fTraceMsrVisitors) {
+          gLogIOstream () <<
             "% ==> Launching msrHarmonyDegree::visitStart ()" <<
             endl;
         }
@@ -11039,8 +11032,8 @@ void msrHarmonyDegree::acceptIn (basevisitor* v)
 
 void msrHarmonyDegree::acceptOut (basevisitor* v)
 {
-  if (gMsrOptions->fTraceMsrVisitors) {
-    gLogIOstream <<
+  if (gMsrOptions ()->fTraceMsrVisitors) {
+    gLogIOstream () <<
       "% ==> msrHarmonyDegree::acceptOut ()" <<
       endl;
   }
@@ -11050,8 +11043,8 @@ void msrHarmonyDegree::acceptOut (basevisitor* v)
       dynamic_cast<visitor<S_msrHarmonyDegree>*> (v)) {
         S_msrHarmonyDegree elem = this;
       
-        if (gMsrOptions->fTraceMsrVisitors) {
-          gLogIOstream <<
+        if (gMsrOptions ()->fTraceMsrVisitors) {
+          gLogIOstream () <<
             "% ==> Launching msrHarmonyDegree::visitEnd ()" <<
             endl;
         }
@@ -11218,8 +11211,8 @@ msrHarmony::msrHarmony (
     harmonySoundingWholeNotes;
 
 #ifdef TRACE_OPTIONS
-  if (gTraceOptions->fTraceHarmonies) {
-    gLogIOstream <<
+  if (gTraceOptions ()->fTraceHarmonies) {
+    gLogIOstream () <<
       "Creating harmony '" <<
       asString () <<
       "'" <<
@@ -11270,12 +11263,12 @@ msrHarmony::msrHarmony (
           fHarmonyInversion <<
           "' is not compatible with bass quaternotes pitch '" <<
           msrQuarterTonesPitchKindAsString (
-            gMsrOptions->fMsrQuarterTonesPitchesLanguageKind,
+            gMsrOptions ()->fMsrQuarterTonesPitchesLanguageKind,
             fHarmonyBassQuarterTonesPitchKind) <<
           "'";
           
         msrMusicXMLError (
-          gXml2lyOptions->fInputSourceName,
+          gXml2lyOptions ()->fInputSourceName,
           inputLineNumber,
           __FILE__, __LINE__,
           s.str ());        
@@ -11295,8 +11288,8 @@ S_msrHarmony msrHarmony::createHarmonyNewbornClone (
   S_msrVoice containingVoice)
 {
 #ifdef TRACE_OPTIONS
-  if (gTraceOptions->fTraceHarmonies) {
-    gLogIOstream <<
+  if (gTraceOptions ()->fTraceHarmonies) {
+    gLogIOstream () <<
       "Creating a newborn clone of harmony '" <<
       msrHarmonyKindAsShortString (fHarmonyKind) <<
       "', line " << fInputLineNumber <<
@@ -11328,8 +11321,8 @@ S_msrHarmony msrHarmony::createHarmonyDeepCopy (
   S_msrVoice containingVoice)
 {
 #ifdef TRACE_OPTIONS
-  if (gTraceOptions->fTraceHarmonies) {
-    gLogIOstream <<
+  if (gTraceOptions ()->fTraceHarmonies) {
+    gLogIOstream () <<
       "Creating a deep copy of harmony '" <<
       msrHarmonyKindAsShortString (fHarmonyKind) <<
       "', line " << fInputLineNumber <<
@@ -11365,7 +11358,7 @@ string msrHarmony::asString () const
     ", line " << fInputLineNumber <<
     ":" <<
     msrQuarterTonesPitchKindAsString ( // JMI XXL
-      gMsrOptions->fMsrQuarterTonesPitchesLanguageKind,
+      gMsrOptions ()->fMsrQuarterTonesPitchesLanguageKind,
       fHarmonyRootQuarterTonesPitchKind) <<          
     msrHarmonyKindAsShortString (fHarmonyKind) <<
     ", duration: " <<
@@ -11390,7 +11383,7 @@ string msrHarmony::asString () const
     s <<
       "/" <<
     msrQuarterTonesPitchKindAsString (
-      gMsrOptions->fMsrQuarterTonesPitchesLanguageKind,
+      gMsrOptions ()->fMsrQuarterTonesPitchesLanguageKind,
       fHarmonyBassQuarterTonesPitchKind);
   }  
 
@@ -11412,8 +11405,8 @@ string msrHarmony::asString () const
 
 void msrHarmony::acceptIn (basevisitor* v)
 {
-  if (gMsrOptions->fTraceMsrVisitors) {
-    gLogIOstream <<
+  if (gMsrOptions ()->fTraceMsrVisitors) {
+    gLogIOstream () <<
       "% ==> msrHarmony::acceptIn ()" <<
       endl;
   }
@@ -11423,8 +11416,8 @@ void msrHarmony::acceptIn (basevisitor* v)
       dynamic_cast<visitor<S_msrHarmony>*> (v)) {
         S_msrHarmony elem = this;
         
-        if (gMsrOptions->fTraceMsrVisitors) {
-          gLogIOstream <<
+        if (gMsrOptions ()->fTraceMsrVisitors) {
+          gLogIOstream () <<
             "% ==> Launching msrHarmony::visitStart ()" <<
             endl;
         }
@@ -11434,8 +11427,8 @@ void msrHarmony::acceptIn (basevisitor* v)
 
 void msrHarmony::acceptOut (basevisitor* v)
 {
-  if (gMsrOptions->fTraceMsrVisitors) {
-    gLogIOstream <<
+  if (gMsrOptions ()->fTraceMsrVisitors) {
+    gLogIOstream () <<
       "% ==> msrHarmony::acceptOut ()" <<
       endl;
   }
@@ -11445,8 +11438,8 @@ void msrHarmony::acceptOut (basevisitor* v)
       dynamic_cast<visitor<S_msrHarmony>*> (v)) {
         S_msrHarmony elem = this;
       
-        if (gMsrOptions->fTraceMsrVisitors) {
-          gLogIOstream <<
+        if (gMsrOptions ()->fTraceMsrVisitors) {
+          gLogIOstream () <<
             "% ==> Launching msrHarmony::visitEnd ()" <<
             endl;
         }
@@ -11481,7 +11474,7 @@ void msrHarmony::print (ostream& os)
      ", line " << fInputLineNumber <<
     endl;
     
-  gIndenter++;
+  gIndenter ()++;
 
   const int fieldWidth = 15;
 
@@ -11489,7 +11482,7 @@ void msrHarmony::print (ostream& os)
     setw (fieldWidth) <<
     "HarmonyRoot" << " = " <<
     msrQuarterTonesPitchKindAsString (
-      gMsrOptions->fMsrQuarterTonesPitchesLanguageKind,
+      gMsrOptions ()->fMsrQuarterTonesPitchesLanguageKind,
       fHarmonyRootQuarterTonesPitchKind) <<
     endl <<
     setw (fieldWidth) <<
@@ -11504,7 +11497,7 @@ void msrHarmony::print (ostream& os)
     setw (fieldWidth) <<
     "HarmonyBass" << " = " <<
     msrQuarterTonesPitchKindAsString (
-      gMsrOptions->fMsrQuarterTonesPitchesLanguageKind,
+      gMsrOptions ()->fMsrQuarterTonesPitchesLanguageKind,
       fHarmonyBassQuarterTonesPitchKind) <<
     endl;
 
@@ -11523,7 +11516,7 @@ void msrHarmony::print (ostream& os)
       "Harmony degrees:" <<
       endl;
 
-    gIndenter++;
+    gIndenter ()++;
     
     list<S_msrHarmonyDegree>::const_iterator
       iBegin = fHarmonyDegreesList.begin (),
@@ -11538,10 +11531,10 @@ void msrHarmony::print (ostream& os)
     } // for
  // JMI ???   os << endl;
     
-    gIndenter--;
+    gIndenter ()--;
   }
 
-  gIndenter--;
+  gIndenter ()--;
 }
 
 ostream& operator<< (ostream& os, const S_msrHarmony& elt)
@@ -11592,8 +11585,8 @@ msrFigure::msrFigure (
   fFigureSuffixKind = figureSuffixKind;
  
 #ifdef TRACE_OPTIONS
-  if (gTraceOptions->fTraceFiguredBass) {
-    gLogIOstream <<
+  if (gTraceOptions ()->fTraceFiguredBass) {
+    gLogIOstream () <<
       "Creating figure '" <<
       asString () <<
       "'" <<
@@ -11609,8 +11602,8 @@ S_msrFigure msrFigure::createFigureNewbornClone (
   S_msrPart containingPart)
 {
 #ifdef TRACE_OPTIONS
-  if (gTraceOptions->fTraceFiguredBass) {
-    gLogIOstream <<
+  if (gTraceOptions ()->fTraceFiguredBass) {
+    gLogIOstream () <<
       "Creating a newborn clone of figure '" <<
       asString () <<
       "'" <<
@@ -11639,8 +11632,8 @@ S_msrFigure msrFigure::createFigureDeepCopy (
   S_msrPart containingPart)
 {
 #ifdef TRACE_OPTIONS
-  if (gTraceOptions->fTraceFiguredBass) {
-    gLogIOstream <<
+  if (gTraceOptions ()->fTraceFiguredBass) {
+    gLogIOstream () <<
       "Creating a deep copy of figure '" <<
       asString () <<
       "'" <<
@@ -11767,8 +11760,8 @@ string msrFigure::asString () const
 
 void msrFigure::acceptIn (basevisitor* v)
 {
-  if (gMsrOptions->fTraceMsrVisitors) {
-    gLogIOstream <<
+  if (gMsrOptions ()->fTraceMsrVisitors) {
+    gLogIOstream () <<
       "% ==> msrFigure::acceptIn ()" <<
       endl;
   }
@@ -11778,8 +11771,8 @@ void msrFigure::acceptIn (basevisitor* v)
       dynamic_cast<visitor<S_msrFigure>*> (v)) {
         S_msrFigure elem = this;
         
-        if (gMsrOptions->fTraceMsrVisitors) {
-          gLogIOstream <<
+        if (gMsrOptions ()->fTraceMsrVisitors) {
+          gLogIOstream () <<
             "% ==> Launching msrFigure::visitStart ()" <<
             endl;
         }
@@ -11789,8 +11782,8 @@ void msrFigure::acceptIn (basevisitor* v)
 
 void msrFigure::acceptOut (basevisitor* v)
 {
-  if (gMsrOptions->fTraceMsrVisitors) {
-    gLogIOstream <<
+  if (gMsrOptions ()->fTraceMsrVisitors) {
+    gLogIOstream () <<
       "% ==> msrFigure::acceptOut ()" <<
       endl;
   }
@@ -11800,8 +11793,8 @@ void msrFigure::acceptOut (basevisitor* v)
       dynamic_cast<visitor<S_msrFigure>*> (v)) {
         S_msrFigure elem = this;
       
-        if (gMsrOptions->fTraceMsrVisitors) {
-          gLogIOstream <<
+        if (gMsrOptions ()->fTraceMsrVisitors) {
+          gLogIOstream () <<
             "% ==> Launching msrFigure::visitEnd ()" <<
             endl;
         }
@@ -11891,8 +11884,8 @@ msrFiguredBass::msrFiguredBass (
     figuredBassParenthesesKind;
     
 #ifdef TRACE_OPTIONS
-  if (gTraceOptions->fTraceFiguredBass) {
-    gLogIOstream <<
+  if (gTraceOptions ()->fTraceFiguredBass) {
+    gLogIOstream () <<
       "Creating figuredBass '" <<
       asString () <<
       "'" <<
@@ -11908,8 +11901,8 @@ S_msrFiguredBass msrFiguredBass::createFiguredBassNewbornClone (
   S_msrPart containingPart)
 {
 #ifdef TRACE_OPTIONS
-  if (gTraceOptions->fTraceFiguredBass) {
-    gLogIOstream <<
+  if (gTraceOptions ()->fTraceFiguredBass) {
+    gLogIOstream () <<
       "Creating a newborn clone of figuredBass '" <<
       asString () <<
       "'" <<
@@ -11937,8 +11930,8 @@ S_msrFiguredBass msrFiguredBass::createFiguredBassDeepCopy (
   S_msrPart containingPart)
 {
 #ifdef TRACE_OPTIONS
-  if (gTraceOptions->fTraceFiguredBass) {
-    gLogIOstream <<
+  if (gTraceOptions ()->fTraceFiguredBass) {
+    gLogIOstream () <<
       "Creating a deep copy of figuredBass '" <<
       asString () <<
       "'" <<
@@ -11966,8 +11959,8 @@ void msrFiguredBass::appendFiguredFigureToFiguredBass (
   S_msrFigure figure)
 {
 #ifdef TRACE_OPTIONS
-  if (gTraceOptions->fTraceFiguredBass) {
-    gLogIOstream <<
+  if (gTraceOptions ()->fTraceFiguredBass) {
+    gLogIOstream () <<
       "Appending figure'" << figure->asString () <<
       "' to figuredBass '" <<
       asString () <<
@@ -12042,8 +12035,8 @@ string msrFiguredBass::asString () const
 
 void msrFiguredBass::acceptIn (basevisitor* v)
 {
-  if (gMsrOptions->fTraceMsrVisitors) {
-    gLogIOstream <<
+  if (gMsrOptions ()->fTraceMsrVisitors) {
+    gLogIOstream () <<
       "% ==> msrFiguredBass::acceptIn ()" <<
       endl;
   }
@@ -12053,8 +12046,8 @@ void msrFiguredBass::acceptIn (basevisitor* v)
       dynamic_cast<visitor<S_msrFiguredBass>*> (v)) {
         S_msrFiguredBass elem = this;
         
-        if (gMsrOptions->fTraceMsrVisitors) {
-          gLogIOstream <<
+        if (gMsrOptions ()->fTraceMsrVisitors) {
+          gLogIOstream () <<
             "% ==> Launching msrFiguredBass::visitStart ()" <<
             endl;
         }
@@ -12064,8 +12057,8 @@ void msrFiguredBass::acceptIn (basevisitor* v)
 
 void msrFiguredBass::acceptOut (basevisitor* v)
 {
-  if (gMsrOptions->fTraceMsrVisitors) {
-    gLogIOstream <<
+  if (gMsrOptions ()->fTraceMsrVisitors) {
+    gLogIOstream () <<
       "% ==> msrFiguredBass::acceptOut ()" <<
       endl;
   }
@@ -12075,8 +12068,8 @@ void msrFiguredBass::acceptOut (basevisitor* v)
       dynamic_cast<visitor<S_msrFiguredBass>*> (v)) {
         S_msrFiguredBass elem = this;
       
-        if (gMsrOptions->fTraceMsrVisitors) {
-          gLogIOstream <<
+        if (gMsrOptions ()->fTraceMsrVisitors) {
+          gLogIOstream () <<
             "% ==> Launching msrFiguredBass::visitEnd ()" <<
             endl;
         }
@@ -12112,7 +12105,7 @@ void msrFiguredBass::print (ostream& os)
     endl;
 
   if (fFiguredBassFiguresList.size ()) {
-    gIndenter++;
+    gIndenter ()++;
 
     list<S_msrFigure>::const_iterator
       iBegin = fFiguredBassFiguresList.begin (),
@@ -12125,7 +12118,7 @@ void msrFiguredBass::print (ostream& os)
  // JMI     os << endl;
     } // for
 
-    gIndenter--;
+    gIndenter ()--;
   }
 }
 
@@ -12178,8 +12171,8 @@ msrMeasure::msrMeasure (
 void msrMeasure::initializeMeasure ()
 {
 #ifdef TRACE_OPTIONS
-  if (gTraceOptions->fTraceMeasures) {
-    gLogIOstream <<
+  if (gTraceOptions ()->fTraceMeasures) {
+    gLogIOstream () <<
       "Initializing measure '" << fMeasureNumber <<
       "' in segment '" <<
       fMeasureSegmentUplink->getSegmentAbsoluteNumber () <<
@@ -12193,7 +12186,7 @@ void msrMeasure::initializeMeasure ()
   }
 #endif
 
-  static int counter = 0;
+  static thread_local int counter = 0;
   
   counter++;
       
@@ -12205,7 +12198,7 @@ void msrMeasure::initializeMeasure ()
       &&
     counter == 1
     ) {
-    gLogIOstream <<
+    gLogIOstream () <<
       endl <<
       "======================= initializeMeasure()" <<
       endl <<
@@ -12282,8 +12275,8 @@ S_msrMeasure msrMeasure::createMeasureNewbornClone (
   S_msrSegment containingSegment)
 {
 #ifdef TRACE_OPTIONS
-  if (gTraceOptions->fTraceMeasures) {
-    gLogIOstream <<
+  if (gTraceOptions ()->fTraceMeasures) {
+    gLogIOstream () <<
       "Creating a newborn clone of measure '" <<
       fMeasureNumber <<
       "'" <<
@@ -12352,8 +12345,8 @@ S_msrMeasure msrMeasure::createMeasureDeepCopy (
   S_msrSegment containingSegment)
 {
 #ifdef TRACE_OPTIONS
-  if (gTraceOptions->fTraceMeasures) {
-    gLogIOstream <<
+  if (gTraceOptions ()->fTraceMeasures) {
+    gLogIOstream () <<
       "Creating a deep copy of measure '" <<
       fMeasureNumber <<
       "'" <<
@@ -12411,8 +12404,8 @@ S_msrMeasure msrMeasure::createMeasureDeepCopy (
 
   if (numberOfMeasureElements) {
 #ifdef TRACE_OPTIONS
-    if (gTraceOptions->fTraceMeasures) {
-      gLogIOstream <<
+    if (gTraceOptions ()->fTraceMeasures) {
+      gLogIOstream () <<
         singularOrPluralWithoutNumber (
           numberOfMeasureElements, "There is", "There are") <<
         " " <<
@@ -12462,8 +12455,8 @@ S_msrMeasure msrMeasure::createMeasureDeepCopy (
         S_msrTime time = dynamic_cast<msrTime*>(&(*element))
         ) {
 #ifdef TRACE_OPTIONS
-  if (gTraceOptions->fTraceTimes || gTraceOptions->fTraceMeasures) {
-          gLogIOstream <<
+  if (gTraceOptions ()->fTraceTimes || gTraceOptions ()->fTraceMeasures) {
+          gLogIOstream () <<
             "Sharing time '" <<
             time->asShortString () <<
             "' in measure '" <<
@@ -12492,8 +12485,8 @@ S_msrMeasure msrMeasure::createMeasureDeepCopy (
   
   else {
 #ifdef TRACE_OPTIONS
-    if (gTraceOptions->fTraceMeasures) {
-      gLogIOstream <<
+    if (gTraceOptions ()->fTraceMeasures) {
+      gLogIOstream () <<
         "There are no elements in measure to be deep copied" <<
         " in segment " <<
         containingSegment->asString () <<
@@ -12519,8 +12512,8 @@ void msrMeasure::setMeasureCreatedForARepeatKind (
     measureCreatedForARepeatKind)
 {
 #ifdef TRACE_OPTIONS
-  if (gTraceOptions->fTraceMeasures) {
-    gLogIOstream <<
+  if (gTraceOptions ()->fTraceMeasures) {
+    gLogIOstream () <<
       "Setting measureCreatedForARepeatKind in measure '" <<
       fMeasureNumber <<
       "' in segment '" <<
@@ -12545,8 +12538,8 @@ void msrMeasure::setMeasureCreatedForARepeatKind (
 void msrMeasure::setNextMeasureNumber (string nextMeasureNumber)
 {
 #ifdef TRACE_OPTIONS
-  if (gTraceOptions->fTraceMeasures) {
-    gLogIOstream <<
+  if (gTraceOptions ()->fTraceMeasures) {
+    gLogIOstream () <<
       "Setting next measure number to '" << nextMeasureNumber <<
       "' in measure '" <<
       fMeasureNumber <<
@@ -12582,8 +12575,8 @@ void msrMeasure::setMeasureLength (
   rationalisedMeasureLength.rationalise ();
   
 #ifdef TRACE_OPTIONS
-  if (gTraceOptions->fTraceMeasures || gTraceOptions->fTraceDivisions) {
-    gLogIOstream <<
+  if (gTraceOptions ()->fTraceMeasures || gTraceOptions ()->fTraceDivisions) {
+    gLogIOstream () <<
       "Setting measure '" << fMeasureNumber <<
       "' measure length to '"  << rationalisedMeasureLength << "'";
 
@@ -12591,11 +12584,11 @@ void msrMeasure::setMeasureLength (
       rationalisedMeasureLength.getDenominator ()
         !=
       measureLength.getDenominator ()) {
-      gLogIOstream <<
+      gLogIOstream () <<
         " (was '" << measureLength << "')";
     }
 
-    gLogIOstream <<
+    gLogIOstream () <<
       " in voice \"" <<
       fMeasureSegmentUplink->
         getSegmentVoiceUplink ()->
@@ -12621,8 +12614,8 @@ string msrMeasure::measureLengthAsMSRString ()
 void msrMeasure::appendClefToMeasure (S_msrClef clef)
 {
 #ifdef TRACE_OPTIONS
-  if (gTraceOptions->fTraceClefs || gTraceOptions->fTraceMeasures) {
-    gLogIOstream <<
+  if (gTraceOptions ()->fTraceClefs || gTraceOptions ()->fTraceMeasures) {
+    gLogIOstream () <<
       "Appending clef '" << clef->asString () <<
       "' to measure " << fMeasureNumber <<
       ", in voice \"" <<
@@ -12639,8 +12632,8 @@ void msrMeasure::appendClefToMeasure (S_msrClef clef)
 void msrMeasure::appendKeyToMeasure (S_msrKey key)
 {
 #ifdef TRACE_OPTIONS
-  if (gTraceOptions->fTraceKeys || gTraceOptions->fTraceMeasures) {
-    gLogIOstream <<
+  if (gTraceOptions ()->fTraceKeys || gTraceOptions ()->fTraceMeasures) {
+    gLogIOstream () <<
       "Appending key '" << key->asString () <<
       "' to measure " << fMeasureNumber <<
       ", in voice \"" <<
@@ -12662,19 +12655,19 @@ void msrMeasure::appendTimeToMeasure (S_msrTime time)
     "time is null");
 
 #ifdef TRACE_OPTIONS
-  if (gTraceOptions->fTraceTimes || gTraceOptions->fTraceMeasures) {
-    gLogIOstream <<
+  if (gTraceOptions ()->fTraceTimes || gTraceOptions ()->fTraceMeasures) {
+    gLogIOstream () <<
       "Appending time '" <<
       endl;
 
-    gIndenter++;
+    gIndenter ()++;
 
-    gLogIOstream <<
+    gLogIOstream () <<
       time;
 
-    gIndenter--;
+    gIndenter ()--;
 
-    gLogIOstream <<
+    gLogIOstream () <<
       "' to measure '" << fMeasureNumber <<
       "' in voice \"" <<
       fMeasureSegmentUplink->
@@ -12685,7 +12678,7 @@ void msrMeasure::appendTimeToMeasure (S_msrTime time)
   }
 #endif
 
-  gIndenter++;
+  gIndenter ()++;
   
   // append time to the measure elements list
   fMeasureElementsList.push_back (time);
@@ -12694,7 +12687,7 @@ void msrMeasure::appendTimeToMeasure (S_msrTime time)
   setMeasureFullLengthFromTime (
     time);
   
-  gIndenter--;
+  gIndenter ()--;
 }
 
 void msrMeasure::appendTimeToMeasureClone (S_msrTime time)
@@ -12705,19 +12698,19 @@ void msrMeasure::appendTimeToMeasureClone (S_msrTime time)
     "time is null");
 
 #ifdef TRACE_OPTIONS
-  if (gTraceOptions->fTraceTimes || gTraceOptions->fTraceMeasures) {
-    gLogIOstream <<
+  if (gTraceOptions ()->fTraceTimes || gTraceOptions ()->fTraceMeasures) {
+    gLogIOstream () <<
       "Appending time:" <<
       endl;
 
-    gIndenter++;
+    gIndenter ()++;
 
-    gLogIOstream <<
+    gLogIOstream () <<
       time;
 
-    gIndenter--;
+    gIndenter ()--;
 
-    gLogIOstream <<
+    gLogIOstream () <<
       "to measure clone '" << fMeasureNumber <<
       "' in voice \"" <<
       fMeasureSegmentUplink->
@@ -12742,23 +12735,23 @@ void msrMeasure::setMeasureFullLengthFromTime (
 
 #ifdef TRACE_OPTIONS
   if (
-    gTraceOptions->fTraceDivisions
+    gTraceOptions ()->fTraceDivisions
       ||
-    gTraceOptions->fTraceTimes
+    gTraceOptions ()->fTraceTimes
       ||
-    gTraceOptions->fTraceMeasures) {
-    gLogIOstream <<
+    gTraceOptions ()->fTraceMeasures) {
+    gLogIOstream () <<
       "Setting measure full measure length from time:" <<
       endl;
 
-    gIndenter++;
+    gIndenter ()++;
 
-    gLogIOstream <<
+    gLogIOstream () <<
       time;
 
-    gIndenter--;
+    gIndenter ()--;
 
-    gLogIOstream <<
+    gLogIOstream () <<
       "for measure '" << fMeasureNumber <<
       "' in voice \"" <<
       fMeasureSegmentUplink->
@@ -12787,25 +12780,25 @@ void msrMeasure::setMeasureFullLengthFromTime (
             
 #ifdef TRACE_OPTIONS
         if (
-          gTraceOptions->fTraceDivisions
+          gTraceOptions ()->fTraceDivisions
             ||
-          gTraceOptions->fTraceTimes
+          gTraceOptions ()->fTraceTimes
             ||
-          gTraceOptions->fTraceMeasures) {
-          gLogIOstream <<
+          gTraceOptions ()->fTraceMeasures) {
+          gLogIOstream () <<
             "There are " <<
             wholeNotesPerMeasure <<
             " whole note(s) per measure in time:" <<
             endl;
     
-          gIndenter++;
+          gIndenter ()++;
           
-          gLogIOstream <<
+          gLogIOstream () <<
             time;
                       
-          gIndenter--;
+          gIndenter ()--;
     
-          gLogIOstream <<
+          gLogIOstream () <<
             "in measure '" << fMeasureNumber << "'" <<
             ", line " << fInputLineNumber <<
             "' in voice \"" <<
@@ -12823,12 +12816,12 @@ void msrMeasure::setMeasureFullLengthFromTime (
     
 #ifdef TRACE_OPTIONS
         if (
-          gTraceOptions->fTraceDivisions
+          gTraceOptions ()->fTraceDivisions
             ||
-          gTraceOptions->fTraceTimes
+          gTraceOptions ()->fTraceTimes
             ||
-          gTraceOptions->fTraceMeasures) {
-          gLogIOstream <<
+          gTraceOptions ()->fTraceMeasures) {
+          gLogIOstream () <<
             "Measure '" << fMeasureNumber <<
             "' in voice \"" <<
             fMeasureSegmentUplink->
@@ -12850,12 +12843,12 @@ void msrMeasure::setMeasureFullLengthFromTime (
       
 #ifdef TRACE_OPTIONS
       if (
-        gTraceOptions->fTraceDivisions
+        gTraceOptions ()->fTraceDivisions
           ||
-        gTraceOptions->fTraceTimes
+        gTraceOptions ()->fTraceTimes
           ||
-        gTraceOptions->fTraceMeasures) {
-        gLogIOstream <<
+        gTraceOptions ()->fTraceMeasures) {
+        gLogIOstream () <<
           "Measure '" << fMeasureNumber <<
           "' in voice \"" <<
           fMeasureSegmentUplink->
@@ -12970,8 +12963,8 @@ void msrMeasure::appendNoteToMeasure (S_msrNote note)
     note->getInputLineNumber ();
 
 #ifdef TRACE_OPTIONS
-  if (gTraceOptions->fTraceNotes || gTraceOptions->fTraceMeasures) {
-    gLogIOstream <<
+  if (gTraceOptions ()->fTraceNotes || gTraceOptions ()->fTraceMeasures) {
+    gLogIOstream () <<
       "Appending note '" << note->asShortString () <<
       "' to measure '" << fMeasureNumber <<
       "' in voice \"" <<
@@ -12983,7 +12976,7 @@ void msrMeasure::appendNoteToMeasure (S_msrNote note)
   }
 #endif
 
-  gIndenter++;
+  gIndenter ()++;
   
   // populate measure uplink
   note->
@@ -13002,9 +12995,6 @@ void msrMeasure::appendNoteToMeasure (S_msrNote note)
   rational noteSoundingWholeNotes =
     note->getNoteSoundingWholeNotes ();
     
-  string noteSoundingWholeNotesAsMsrString =
-    note->noteSoundingWholeNotesAsMsrString ();
-    
   // account for note duration in measure length
   setMeasureLength (
     inputLineNumber,
@@ -13056,7 +13046,7 @@ void msrMeasure::appendNoteToMeasure (S_msrNote note)
   // this measure contains music
   fMeasureContainsMusic = true;
 
-  gIndenter--;
+  gIndenter ()--;
 }
 
 void msrMeasure::appendNoteToMeasureClone (S_msrNote note)
@@ -13065,8 +13055,8 @@ void msrMeasure::appendNoteToMeasureClone (S_msrNote note)
     note->getInputLineNumber ();
 
 #ifdef TRACE_OPTIONS
-  if (gTraceOptions->fTraceNotes || gTraceOptions->fTraceMeasures) {
-    gLogIOstream <<
+  if (gTraceOptions ()->fTraceNotes || gTraceOptions ()->fTraceMeasures) {
+    gLogIOstream () <<
       "Appending note '" << note->asShortString () <<
       "' to measure clone '" << fMeasureNumber <<
       "' in voice clone \"" <<
@@ -13078,7 +13068,7 @@ void msrMeasure::appendNoteToMeasureClone (S_msrNote note)
   }
 #endif
 
-  gIndenter++;
+  gIndenter ()++;
   
     /* JMI
   if (appendMeasureIfOverflow (inputLineNumber)) {
@@ -13140,7 +13130,7 @@ void msrMeasure::appendNoteToMeasureClone (S_msrNote note)
   fMeasureContainsMusic = true;
  // JMI }
 
-  gIndenter--;
+  gIndenter ()--;
 }
 
 void msrMeasure::appendDoubleTremoloToMeasure (
@@ -13150,8 +13140,8 @@ void msrMeasure::appendDoubleTremoloToMeasure (
     doubleTremolo->getInputLineNumber ();
   
 #ifdef TRACE_OPTIONS
-  if (gTraceOptions->fTraceTremolos || gTraceOptions->fTraceMeasures) {
-    gLogIOstream <<
+  if (gTraceOptions ()->fTraceTremolos || gTraceOptions ()->fTraceMeasures) {
+    gLogIOstream () <<
       "Appending double tremolo '" <<
       doubleTremolo->asShortString () <<
       "' to measure '" << fMeasureNumber <<
@@ -13164,7 +13154,7 @@ void msrMeasure::appendDoubleTremoloToMeasure (
   }
 #endif
 
-  gIndenter++;
+  gIndenter ()++;
   
   // register doubleTremolo measure number
   doubleTremolo->
@@ -13213,15 +13203,15 @@ void msrMeasure::appendDoubleTremoloToMeasure (
   // this measure contains music
   fMeasureContainsMusic = true;
 
-  gIndenter--;
+  gIndenter ()--;
 }
 
 void msrMeasure::appendMeasuresRepeatToMeasure (
   S_msrMeasuresRepeat measuresRepeat)
 {
 #ifdef TRACE_OPTIONS
-  if (gTraceOptions->fTraceRepeats || gTraceOptions->fTraceMeasures) {
-    gLogIOstream <<
+  if (gTraceOptions ()->fTraceRepeats || gTraceOptions ()->fTraceMeasures) {
+    gLogIOstream () <<
       "Appending multiple rest '" <<
       measuresRepeat->asString () <<
       "' to measure '" << fMeasureNumber <<
@@ -13255,8 +13245,8 @@ void msrMeasure::appendMultipleRestToMeasure (
 */
 
 #ifdef TRACE_OPTIONS
-  if (gTraceOptions->fTraceRepeats || gTraceOptions->fTraceMeasures) {
-    gLogIOstream <<
+  if (gTraceOptions ()->fTraceRepeats || gTraceOptions ()->fTraceMeasures) {
+    gLogIOstream () <<
       "Appending multiple rest '" <<
       multipleRest->asString () <<
       "' to measure '" << fMeasureNumber <<
@@ -13325,8 +13315,8 @@ void msrMeasure::appendChordToMeasure (S_msrChord chord) // JMI XXL
   chord->setChordMeasureUplink (this);
 
 #ifdef TRACE_OPTIONS
-  if (gTraceOptions->fTraceChords || gTraceOptions->fTraceMeasures) {
-    gLogIOstream <<
+  if (gTraceOptions ()->fTraceChords || gTraceOptions ()->fTraceMeasures) {
+    gLogIOstream () <<
       "Appending chord '" << chord->asString () <<
       "' to measure '" << fMeasureNumber <<
       "' in voice \"" <<
@@ -13386,8 +13376,8 @@ void msrMeasure::appendTupletToMeasure (S_msrTuplet tuplet)
     tuplet->getInputLineNumber ();
     
 #ifdef TRACE_OPTIONS
-  if (gTraceOptions->fTraceTuplets || gTraceOptions->fTraceMeasures) {
-    gLogIOstream <<
+  if (gTraceOptions ()->fTraceTuplets || gTraceOptions ()->fTraceMeasures) {
+    gLogIOstream () <<
       "Appending tuplet '" << tuplet->asString () <<
       "' to measure '" << fMeasureNumber <<
       "' in voice \"" <<
@@ -13399,7 +13389,7 @@ void msrMeasure::appendTupletToMeasure (S_msrTuplet tuplet)
   }
 #endif
 
-  gIndenter++;
+  gIndenter ()++;
 
   // populate measure uplink
   tuplet->setTupletMeasureUplink (this);
@@ -13427,7 +13417,7 @@ void msrMeasure::appendTupletToMeasure (S_msrTuplet tuplet)
   // this measure contains music
   fMeasureContainsMusic = true;
 
-  gIndenter--;
+  gIndenter ()--;
 }
 
 void msrMeasure::appendHarmonyToMeasure (S_msrHarmony harmony)
@@ -13436,8 +13426,8 @@ void msrMeasure::appendHarmonyToMeasure (S_msrHarmony harmony)
     harmony->getInputLineNumber ();
     
 #ifdef TRACE_OPTIONS
-  if (gTraceOptions->fTraceHarmonies || gTraceOptions->fTraceMeasures) {
-    gLogIOstream <<
+  if (gTraceOptions ()->fTraceHarmonies || gTraceOptions ()->fTraceMeasures) {
+    gLogIOstream () <<
       "Appending harmony '" << harmony->asString () <<
       "' to measure '" << fMeasureNumber <<
       "' in voice \"" <<
@@ -13482,8 +13472,8 @@ void msrMeasure::appendHarmonyToMeasureClone (S_msrHarmony harmony)
   // regular insertion in current measure
   
 #ifdef TRACE_OPTIONS
-  if (gTraceOptions->fTraceHarmonies || gTraceOptions->fTraceMeasures) {
-    gLogIOstream <<
+  if (gTraceOptions ()->fTraceHarmonies || gTraceOptions ()->fTraceMeasures) {
+    gLogIOstream () <<
       "Appending harmony '" << harmony->asString () <<
       "' to measure clone '" << fMeasureNumber <<
       "' in voice clone \"" <<
@@ -13527,8 +13517,8 @@ void msrMeasure::appendFiguredBassToMeasure (
     figuredBass->getInputLineNumber ();
     
 #ifdef TRACE_OPTIONS
-  if (gTraceOptions->fTraceHarmonies || gTraceOptions->fTraceMeasures) {
-    gLogIOstream <<
+  if (gTraceOptions ()->fTraceHarmonies || gTraceOptions ()->fTraceMeasures) {
+    gLogIOstream () <<
       "Appending figured bass '" << figuredBass->asString () <<
       "' to measure '" << fMeasureNumber <<
       "' in voice \"" <<
@@ -13574,8 +13564,8 @@ void msrMeasure::appendFiguredBassToMeasureClone (
   // regular insertion in current measure
   
 #ifdef TRACE_OPTIONS
-  if (gTraceOptions->fTraceHarmonies || gTraceOptions->fTraceMeasures) {
-    gLogIOstream <<
+  if (gTraceOptions ()->fTraceHarmonies || gTraceOptions ()->fTraceMeasures) {
+    gLogIOstream () <<
       "Appending figured bass '" << figuredBass->asString () <<
       "' to measure clone '" << fMeasureNumber <<
       "' in voice clone \"" <<
@@ -13618,8 +13608,8 @@ S_msrNote msrMeasure::createPaddingNoteForVoice (
   S_msrVoice voice)
 {
 #ifdef TRACE_OPTIONS
-  if (gTraceOptions->fTraceMeasures) {
-    gLogIOstream <<
+  if (gTraceOptions ()->fTraceMeasures) {
+    gLogIOstream () <<
       "Creating a padding note for voice \"" <<
       voice->getVoiceName () <<
       "\" in measure '" <<
@@ -13675,8 +13665,8 @@ void msrMeasure::padUpToMeasureLengthInMeasure (
   rational measureLength)
 {
 #ifdef TRACE_OPTIONS
-  if (gTraceOptions->fTraceMeasures) {
-    gLogIOstream <<
+  if (gTraceOptions ()->fTraceMeasures) {
+    gLogIOstream () <<
       "Padding from measure length '" << fMeasureLength <<
       "' to '" << measureLength <<
       "' in measure " <<
@@ -13688,7 +13678,7 @@ void msrMeasure::padUpToMeasureLengthInMeasure (
   }
 #endif
 
-  gIndenter++;
+  gIndenter ()++;
   
   if (fMeasureLength < measureLength) {
     // appending a padding rest or skip to this measure to reach measureLength
@@ -13716,8 +13706,8 @@ void msrMeasure::padUpToMeasureLengthInMeasure (
         fMeasureLength);
            
 #ifdef TRACE_OPTIONS
-    if (gTraceOptions->fTraceMeasures || gTraceOptions->fTraceDivisions) {
-      gLogIOstream <<
+    if (gTraceOptions ()->fTraceMeasures || gTraceOptions ()->fTraceDivisions) {
+      gLogIOstream () <<
        "Appending rest" << paddingNote->asString () <<
        " (missingDuration " << missingDuration <<
        " whole notes) to skip from length '" << fMeasureLength <<
@@ -13742,7 +13732,7 @@ void msrMeasure::padUpToMeasureLengthInMeasure (
     fMeasureContainsMusic = true;
   }
 
-  gIndenter--;
+  gIndenter ()--;
 }
 
 void msrMeasure::appendPaddingNoteToMeasure (
@@ -13751,8 +13741,8 @@ void msrMeasure::appendPaddingNoteToMeasure (
   int divisionsPerQuarterNote)
 {
 #ifdef TRACE_OPTIONS
-  if (gTraceOptions->fTraceMeasures) {
-    gLogIOstream <<
+  if (gTraceOptions ()->fTraceMeasures) {
+    gLogIOstream () <<
       "Appending padding note of " << divisions <<
       " divisions to measure " <<
       fMeasureNumber <<
@@ -13763,7 +13753,7 @@ void msrMeasure::appendPaddingNoteToMeasure (
   }
 #endif
 
-  gIndenter++;
+  gIndenter ()++;
   
   // fetch the measure voice
   S_msrVoice
@@ -13796,7 +13786,7 @@ void msrMeasure::appendPaddingNoteToMeasure (
   // if it happens to be the first note of a chord
   appendNoteToMeasure (paddingNote);
     
-  gIndenter--;
+  gIndenter ()--;
 }
 
 
@@ -13852,8 +13842,8 @@ void msrMeasure::appendStaffDetailsToMeasure (
   S_msrStaffDetails staffDetails)
 {
 #ifdef TRACE_OPTIONS
-  if (gTraceOptions->fTraceStaves || gTraceOptions->fTraceMeasures) { 
-    gLogIOstream <<
+  if (gTraceOptions ()->fTraceStaves || gTraceOptions ()->fTraceMeasures) { 
+    gLogIOstream () <<
       "Appending staff details '" << staffDetails->asShortString () <<
       "' to measure '" << fMeasureNumber <<
       "' in voice \"" <<
@@ -13895,8 +13885,8 @@ void msrMeasure::removeNoteFromMeasure (
   S_msrNote note)
 {  
 #ifdef TRACE_OPTIONS
-  if (gTraceOptions->fTraceChords || gTraceOptions->fTraceMeasures) {
-    gLogIOstream <<
+  if (gTraceOptions ()->fTraceChords || gTraceOptions ()->fTraceMeasures) {
+    gLogIOstream () <<
       "Removing note '" <<
       note->asShortString () <<
       "' from measure '" << fMeasureNumber <<
@@ -13943,7 +13933,7 @@ void msrMeasure::removeNoteFromMeasure (
         getVoiceStaffUplink ()->
         getStaffPartUplink ();
       
-  gLogIOstream <<
+  gLogIOstream () <<
     endl <<
     endl <<
     "@@@@@@@@@@@@@@@@@ segmentVoicePart" <<
@@ -13954,7 +13944,7 @@ void msrMeasure::removeNoteFromMeasure (
     endl <<
     endl;
     
-  gLogIOstream <<
+  gLogIOstream () <<
     endl <<
     endl <<
     "@@@@@@@@@@@@@@@@@ segmentVoiceUplink" <<
@@ -13977,7 +13967,7 @@ void msrMeasure::removeNoteFromMeasure (
     " since it has not been found";
 
   msrInternalError (
-    gXml2lyOptions->fInputSourceName,
+    gXml2lyOptions ()->fInputSourceName,
     inputLineNumber,
     __FILE__, __LINE__,
     s.str ());
@@ -13988,17 +13978,17 @@ void msrMeasure::removeElementFromMeasure (
   S_msrElement element)
 {  
 #ifdef TRACE_OPTIONS
-  if (gTraceOptions->fTraceChords || gTraceOptions->fTraceMeasures) {
-    gLogIOstream <<
+  if (gTraceOptions ()->fTraceChords || gTraceOptions ()->fTraceMeasures) {
+    gLogIOstream () <<
       "Removing element:" <<
       endl;
 
-    gIndenter++;
-    gLogIOstream <<
+    gIndenter ()++;
+    gLogIOstream () <<
       " JMI ??? element->elementAsString ()" << endl;
-    gIndenter--;
+    gIndenter ()--;
     
-    gLogIOstream <<
+    gLogIOstream () <<
       endl <<
       " from measure '" << fMeasureNumber <<
       "' in voice \"" <<
@@ -14008,13 +13998,13 @@ void msrMeasure::removeElementFromMeasure (
       "\"," <<
       endl;
 
-    gIndenter++;
-    gLogIOstream <<
+    gIndenter ()++;
+    gLogIOstream () <<
       "fMeasureLastHandledNote:" <<
       endl <<
       fMeasureLastHandledNote <<
       endl;
-    gIndenter--;
+    gIndenter ()--;
   }
 #endif
   
@@ -14052,7 +14042,7 @@ void msrMeasure::removeElementFromMeasure (
     " since it has not been found";
 
   msrInternalError (
-    gXml2lyOptions->fInputSourceName,
+    gXml2lyOptions ()->fInputSourceName,
     inputLineNumber,
     __FILE__, __LINE__,
     s.str ());
@@ -14068,8 +14058,8 @@ void msrMeasure::determineMeasureKind (
         getSegmentVoiceUplink ();
     
 #ifdef TRACE_OPTIONS
-  if (gTraceOptions->fTraceMeasures) {
-    gLogIOstream <<
+  if (gTraceOptions ()->fTraceMeasures) {
+    gLogIOstream () <<
     "Determining the measure kind of measure '" <<
     fMeasureNumber <<
     "' in voice \"" << voice->getVoiceName () <<
@@ -14078,14 +14068,14 @@ void msrMeasure::determineMeasureKind (
   }
 #endif
 
-  gIndenter++;
+  gIndenter ()++;
 
   // determine the measure kind
   if (fMeasureLength.getNumerator () == 0) { // JMI
     // empty measure
 #ifdef TRACE_OPTIONS
-    if (gTraceOptions->fTraceMeasures) {
-      gLogIOstream <<
+    if (gTraceOptions ()->fTraceMeasures) {
+      gLogIOstream () <<
       "Measure '" << fMeasureNumber <<
       "' in voice \"" << voice->getVoiceName () <<
       "\", is of kind '" <<
@@ -14101,8 +14091,8 @@ void msrMeasure::determineMeasureKind (
   else if (fMeasureLength == fMeasureFullLength) {
     // full measure
 #ifdef TRACE_OPTIONS
-    if (gTraceOptions->fTraceMeasures) {
-      gLogIOstream <<
+    if (gTraceOptions ()->fTraceMeasures) {
+      gLogIOstream () <<
       "Measure '" << fMeasureNumber <<
       "' in voice \"" << voice->getVoiceName () <<
       "\", is of kind '" <<
@@ -14120,8 +14110,8 @@ void msrMeasure::determineMeasureKind (
     switch (fMeasureFirstInSegmentKind) {
       case msrMeasure::kMeasureFirstInSegmentUnknown:
 #ifdef TRACE_OPTIONS
-        if (gTraceOptions->fTraceMeasures) {
-          gLogIOstream <<
+        if (gTraceOptions ()->fTraceMeasures) {
+          gLogIOstream () <<
           "Measure '" << fMeasureNumber <<
           "' in voice \"" << voice->getVoiceName () <<
           "\", is of kind '" <<
@@ -14136,8 +14126,8 @@ void msrMeasure::determineMeasureKind (
         
       case msrMeasure::kMeasureFirstInSegmentYes:
 #ifdef TRACE_OPTIONS
-        if (gTraceOptions->fTraceMeasures) {
-          gLogIOstream <<
+        if (gTraceOptions ()->fTraceMeasures) {
+          gLogIOstream () <<
           "Measure '" << fMeasureNumber <<
           "' in voice \"" << voice->getVoiceName () <<
           "\", is of kind '" <<
@@ -14152,8 +14142,8 @@ void msrMeasure::determineMeasureKind (
         
       case msrMeasure::kMeasureFirstInSegmentNo:
 #ifdef TRACE_OPTIONS
-        if (gTraceOptions->fTraceMeasures) {
-          gLogIOstream <<
+        if (gTraceOptions ()->fTraceMeasures) {
+          gLogIOstream () <<
           "Measure '" << fMeasureNumber <<
           "' in voice \"" << voice->getVoiceName () <<
           "\", is of kind '" <<
@@ -14171,8 +14161,8 @@ void msrMeasure::determineMeasureKind (
   else if (fMeasureLength > fMeasureFullLength) {
     // overfull measure
 #ifdef TRACE_OPTIONS
-    if (gTraceOptions->fTraceMeasures) {
-      gLogIOstream <<
+    if (gTraceOptions ()->fTraceMeasures) {
+      gLogIOstream () <<
       "Measure '" << fMeasureNumber <<
       "' in voice \"" << voice->getVoiceName () <<
       "\", is **overfull**" <<
@@ -14187,8 +14177,8 @@ void msrMeasure::determineMeasureKind (
   else {
     // strange measure...
 #ifdef TRACE_OPTIONS
-    if (gTraceOptions->fTraceMeasures) {
-      gLogIOstream <<
+    if (gTraceOptions ()->fTraceMeasures) {
+      gLogIOstream () <<
       "Measure '" << fMeasureNumber <<
       "' in voice \"" << voice->getVoiceName () <<
       "\", is in a **STRANGE** state" <<
@@ -14200,13 +14190,13 @@ void msrMeasure::determineMeasureKind (
 #endif
   }
 
-  gIndenter--;
+  gIndenter ()--;
 }
 
 void msrMeasure::padUpToPartMeasureLengthHighTide (
   int inputLineNumber)
 {
-  gIndenter++;
+  gIndenter ()++;
   
   // fetch the part measure length high tide
   rational
@@ -14243,8 +14233,8 @@ void msrMeasure::padUpToPartMeasureLengthHighTide (
       setNotePositionInMeasure (fMeasureLength);
            
 #ifdef TRACE_OPTIONS
-    if (gTraceOptions->fTraceMeasures) {
-      gLogIOstream <<
+    if (gTraceOptions ()->fTraceMeasures) {
+      gLogIOstream () <<
        "Appending '" << paddingNote->asString () <<
        " (" << missingDuration << " whole notes)'" <<
        " to finalize \"" << measureVoice->getVoiceName () <<
@@ -14265,7 +14255,7 @@ void msrMeasure::padUpToPartMeasureLengthHighTide (
     fMeasureContainsMusic = true;
   }
 
-  gIndenter--;
+  gIndenter ()--;
 }
 
 void msrMeasure::finalizeMeasure (
@@ -14277,15 +14267,15 @@ void msrMeasure::finalizeMeasure (
       fMeasureSegmentUplink->
         getSegmentVoiceUplink ();
     
-  // fetch the part measure length high tide
-  rational
-    partMeasureLengthHighTide =
-      fetchMeasurePartUplink ()->
-        getPartMeasureLengthHighTide ();
-    
 #ifdef TRACE_OPTIONS
-  if (gTraceOptions->fTraceMeasures) {
-    gLogIOstream <<
+  if (gTraceOptions ()->fTraceMeasures) {
+    // fetch the part measure length high tide
+    rational
+      partMeasureLengthHighTide =
+        fetchMeasurePartUplink ()->
+          getPartMeasureLengthHighTide ();
+    
+    gLogIOstream () <<
       "Finalizing measure '" <<
       fMeasureNumber <<
       "' in segment '" <<
@@ -14295,11 +14285,11 @@ void msrMeasure::finalizeMeasure (
       "\", line " << inputLineNumber <<
       endl;
 
-    gIndenter++;
+    gIndenter ()++;
 
     const int fieldWidth = 26;
     
-    gLogIOstream << left <<
+    gLogIOstream () << left <<
       setw (fieldWidth) <<
       "measureLength" << " = " << fMeasureLength <<
       endl <<
@@ -14311,11 +14301,11 @@ void msrMeasure::finalizeMeasure (
       partMeasureLengthHighTide <<
       endl;
         
-    gIndenter--;
+    gIndenter ()--;
   }
 #endif
 
-  gIndenter++;
+  gIndenter ()++;
 
   // pad measure up to part measure length high tide
   // and determine its measure kind if relevant
@@ -14360,8 +14350,8 @@ void msrMeasure::finalizeMeasure (
       fMeasureFullLength
     ) {
 #ifdef TRACE_OPTIONS
-      if (gTraceOptions->fTraceMeasures) {
-        gLogIOstream <<
+      if (gTraceOptions ()->fTraceMeasures) {
+        gLogIOstream () <<
           "Note '" <<
           fMeasureLongestNote->asShortString () <<
           "' occupies measure '" <<
@@ -14380,10 +14370,10 @@ void msrMeasure::finalizeMeasure (
     }
   }
 
-  gIndenter--;
+  gIndenter ()--;
 
   if (false && fMeasureNumber == "16") { // JMI
-    gLogIOstream <<
+    gLogIOstream () <<
       endl <<
       endl <<
       endl <<
@@ -14410,8 +14400,8 @@ void msrMeasure::finalizeMeasure (
 
 void msrMeasure::acceptIn (basevisitor* v)
 {
-  if (gMsrOptions->fTraceMsrVisitors) {
-    gLogIOstream <<
+  if (gMsrOptions ()->fTraceMsrVisitors) {
+    gLogIOstream () <<
       "% ==> msrMeasure::acceptIn ()" <<
       endl;
   }
@@ -14421,8 +14411,8 @@ void msrMeasure::acceptIn (basevisitor* v)
       dynamic_cast<visitor<S_msrMeasure>*> (v)) {
         S_msrMeasure elem = this;
         
-        if (gMsrOptions->fTraceMsrVisitors) {
-          gLogIOstream <<
+        if (gMsrOptions ()->fTraceMsrVisitors) {
+          gLogIOstream () <<
             "% ==> Launching msrMeasure::visitStart ()" <<
             endl;
         }
@@ -14432,8 +14422,8 @@ void msrMeasure::acceptIn (basevisitor* v)
 
 void msrMeasure::acceptOut (basevisitor* v)
 {
-  if (gMsrOptions->fTraceMsrVisitors) {
-    gLogIOstream <<
+  if (gMsrOptions ()->fTraceMsrVisitors) {
+    gLogIOstream () <<
       "% ==> msrMeasure::acceptOut ()" <<
       endl;
   }
@@ -14443,8 +14433,8 @@ void msrMeasure::acceptOut (basevisitor* v)
       dynamic_cast<visitor<S_msrMeasure>*> (v)) {
         S_msrMeasure elem = this;
       
-        if (gMsrOptions->fTraceMsrVisitors) {
-          gLogIOstream <<
+        if (gMsrOptions ()->fTraceMsrVisitors) {
+          gLogIOstream () <<
             "% ==> Launching msrMeasure::visitEnd ()" <<
             endl;
         }
@@ -14454,8 +14444,8 @@ void msrMeasure::acceptOut (basevisitor* v)
 
 void msrMeasure::browseData (basevisitor* v)
 {
-  if (gMsrOptions->fTraceMsrVisitors) {
-    gLogIOstream <<
+  if (gMsrOptions ()->fTraceMsrVisitors) {
+    gLogIOstream () <<
       "% ==> msrMeasure::browseData ()" <<
       endl;
   }
@@ -14469,8 +14459,8 @@ void msrMeasure::browseData (basevisitor* v)
     browser.browse (*(*i));
   } // for
 
-  if (gMsrOptions->fTraceMsrVisitors) {
-    gLogIOstream <<
+  if (gMsrOptions ()->fTraceMsrVisitors) {
+    gLogIOstream () <<
       "% <== msrMeasure::browseData ()" <<
       endl;
   }
@@ -14616,7 +14606,7 @@ void msrMeasure::print (ostream& os)
     ", line " << fInputLineNumber <<
     endl;
 
-  gIndenter++;
+  gIndenter ()++;
 
   const int fieldWidth = 28;
   
@@ -14717,7 +14707,7 @@ void msrMeasure::print (ostream& os)
     os <<
       endl;
     
-    gIndenter++;
+    gIndenter ()++;
     
     list<S_msrElement>::const_iterator
       iBegin = fMeasureElementsList.begin (),
@@ -14729,10 +14719,10 @@ void msrMeasure::print (ostream& os)
       os << endl;
     } // for
     
-    gIndenter--;
+    gIndenter ()--;
   }
 
-  gIndenter--;
+  gIndenter ()--;
 } 
 
 ostream& operator<< (ostream& os, const S_msrMeasure& elt)
@@ -14742,8 +14732,6 @@ ostream& operator<< (ostream& os, const S_msrMeasure& elt)
 }
 
 //______________________________________________________________________________
-int msrSegment::gSegmentsCounter = 0;
-
 S_msrSegment msrSegment::create (
   int        inputLineNumber,
   S_msrVoice segmentVoicekUplink)
@@ -14780,11 +14768,11 @@ msrSegment::~msrSegment ()
 
 void msrSegment::initializeSegment ()
 {
-  fSegmentAbsoluteNumber = ++gSegmentsCounter;
+  fSegmentAbsoluteNumber = ++conversionContext::current ().fSegmentsCounter;
   
 #ifdef TRACE_OPTIONS
-  if (gTraceOptions->fTraceSegments) {
-    gLogIOstream <<
+  if (gTraceOptions ()->fTraceSegments) {
+    gLogIOstream () <<
       "% ==> Initializing new segment, gets absolute number '" <<
       fSegmentAbsoluteNumber <<
       "'" <<
@@ -14823,8 +14811,8 @@ S_msrSegment msrSegment::createSegmentNewbornClone (
   S_msrVoice containingVoice)
 {
 #ifdef TRACE_OPTIONS
-  if (gTraceOptions->fTraceSegments) {
-    gLogIOstream <<
+  if (gTraceOptions ()->fTraceSegments) {
+    gLogIOstream () <<
       "Creating a newborn clone of segment " <<
       asString () <<
       endl;
@@ -14863,8 +14851,8 @@ S_msrSegment msrSegment::createSegmentDeepCopy (
   S_msrVoice containingVoice)
 {
 #ifdef TRACE_OPTIONS
-  if (gTraceOptions->fTraceSegments) {
-    gLogIOstream <<
+  if (gTraceOptions ()->fTraceSegments) {
+    gLogIOstream () <<
       "Creating a deep copy of segment " <<
       asString () <<
       endl;
@@ -14898,8 +14886,8 @@ S_msrSegment msrSegment::createSegmentDeepCopy (
 
   if (numberOfSegmentMeasures) {
 #ifdef TRACE_OPTIONS
-    if (gTraceOptions->fTraceVoices) {
-      gLogIOstream <<
+    if (gTraceOptions ()->fTraceVoices) {
+      gLogIOstream () <<
         "There are " <<
         numberOfSegmentMeasures <<
         " measures in segment to be deep copied" <<
@@ -14922,8 +14910,8 @@ S_msrSegment msrSegment::createSegmentDeepCopy (
   
   else {
 #ifdef TRACE_OPTIONS
-    if (gTraceOptions->fTraceSegments) {
-      gLogIOstream <<
+    if (gTraceOptions ()->fTraceSegments) {
+      gLogIOstream () <<
         "There are no measures in segment to be deep copied" <<
         endl;
     }
@@ -14945,8 +14933,8 @@ void msrSegment::createMeasureAndAppendItToSegment (
          measureImplicitKind)
 {
 #ifdef TRACE_OPTIONS
-  if (gTraceOptions->fTraceMeasures || gTraceOptions->fTraceSegments) {
-    gLogIOstream <<
+  if (gTraceOptions ()->fTraceMeasures || gTraceOptions ()->fTraceSegments) {
+    gLogIOstream () <<
       "Creating and appending a measure '" << measureNumber <<
       "', to segment '" << asString () <<
       "' in voice \"" <<
@@ -14957,7 +14945,7 @@ void msrSegment::createMeasureAndAppendItToSegment (
   }
 #endif
 
-  gIndenter++;
+  gIndenter ()++;
   
   fSegmentMeasureNumber = measureNumber; // JMI
 
@@ -14978,8 +14966,8 @@ void msrSegment::createMeasureAndAppendItToSegment (
       
   // create a measure
 #ifdef TRACE_OPTIONS
-  if (gTraceOptions->fTraceMeasures || gTraceOptions->fTraceSegments) {
-    gLogIOstream <<
+  if (gTraceOptions ()->fTraceMeasures || gTraceOptions ()->fTraceSegments) {
+    gLogIOstream () <<
       "Creating measure '" << measureNumber <<
       "' in segment " << asString () <<
       ", in voice \"" <<
@@ -15011,7 +14999,7 @@ void msrSegment::createMeasureAndAppendItToSegment (
   
   fMeasureNumberHasBeenSetInSegment = true;
 
-  gIndenter--;
+  gIndenter ()--;
 }
 
 void msrSegment::setNextMeasureNumberInSegment (
@@ -15019,8 +15007,8 @@ void msrSegment::setNextMeasureNumberInSegment (
   string nextMeasureNumber)
 {
 #ifdef TRACE_OPTIONS
-  if (gTraceOptions->fTraceMeasures || gTraceOptions->fTraceSegments) {
-    gLogIOstream <<
+  if (gTraceOptions ()->fTraceMeasures || gTraceOptions ()->fTraceSegments) {
+    gLogIOstream () <<
       "Setting next measure number to '" << nextMeasureNumber <<
       "' in segment '" << asString () <<
       "' in voice \"" <<
@@ -15031,12 +15019,12 @@ void msrSegment::setNextMeasureNumberInSegment (
   }
 #endif
 
-  gIndenter++;
+  gIndenter ()++;
   
   if (fSegmentMeasuresList.size ()) { // JMI ???
 #ifdef TRACE_OPTIONS
-    if (gTraceOptions->fTraceMeasures || gTraceOptions->fTraceSegments) {
-      gLogIOstream <<
+    if (gTraceOptions ()->fTraceMeasures || gTraceOptions ()->fTraceSegments) {
+      gLogIOstream () <<
         "Setting next measure number to '" << nextMeasureNumber <<
         "' in segment '" << asString () <<
         "'s last measure " <<
@@ -15053,7 +15041,7 @@ void msrSegment::setNextMeasureNumberInSegment (
         nextMeasureNumber);
   }
 
-  gIndenter--;   
+  gIndenter ()--;   
 }
 
 void msrSegment::finalizeCurrentMeasureInSegment (
@@ -15065,8 +15053,8 @@ void msrSegment::finalizeCurrentMeasureInSegment (
         getPartCurrentMeasureNumber ();
       
 #ifdef TRACE_OPTIONS
-  if (gTraceOptions->fTraceMeasures || gTraceOptions->fTraceSegments) {
-    gLogIOstream <<
+  if (gTraceOptions ()->fTraceMeasures || gTraceOptions ()->fTraceSegments) {
+    gLogIOstream () <<
       "Finalizing current measure '" <<
       currentMeasureNumber <<
       "' in segment " <<
@@ -15079,7 +15067,7 @@ void msrSegment::finalizeCurrentMeasureInSegment (
   }
 #endif
 
-  gIndenter++;
+  gIndenter ()++;
   
   // don't finalize it it ain't been created
   if (fSegmentMeasuresList.size ()) {
@@ -15102,14 +15090,14 @@ void msrSegment::finalizeCurrentMeasureInSegment (
           // yes, remove it
 #ifdef TRACE_OPTIONS
           if (
-            gTraceOptions->fTraceMeasures
+            gTraceOptions ()->fTraceMeasures
               ||
-            gTraceOptions->fTraceSegments
+            gTraceOptions ()->fTraceSegments
               ||
-            gTraceOptions->fTraceRepeats) {
+            gTraceOptions ()->fTraceRepeats) {
             stringstream s;
         
-            gLogIOstream <<
+            gLogIOstream () <<
               "Removing empty measure '" <<
               lastMeasure->getMeasureNumber () <<
               ") in segment '" <<
@@ -15134,14 +15122,14 @@ void msrSegment::finalizeCurrentMeasureInSegment (
           // yes, remove it
 #ifdef TRACE_OPTIONS
           if (
-            gTraceOptions->fTraceMeasures
+            gTraceOptions ()->fTraceMeasures
               ||
-            gTraceOptions->fTraceSegments
+            gTraceOptions ()->fTraceSegments
               ||
-            gTraceOptions->fTraceRepeats) {
+            gTraceOptions ()->fTraceRepeats) {
             stringstream s;
         
-            gLogIOstream <<
+            gLogIOstream () <<
               "Removing empty measure '" <<
               lastMeasure->getMeasureNumber () <<
               "' that was created for a repeat (" <<
@@ -15180,10 +15168,10 @@ void msrSegment::finalizeCurrentMeasureInSegment (
   
 #ifdef TRACE_OPTIONS
     if (
-      gTraceOptions->fTraceMeasuresDetails
+      gTraceOptions ()->fTraceMeasuresDetails
         ||
-      gTraceOptions->fTraceSegmentsDetails) {
-      gLogIOstream <<
+      gTraceOptions ()->fTraceSegmentsDetails) {
+      gLogIOstream () <<
         endl <<
         "*********>> Current voice \"" <<
         fSegmentVoiceUplink->getVoiceName () <<
@@ -15203,10 +15191,10 @@ void msrSegment::finalizeCurrentMeasureInSegment (
     /* JMI
 #ifdef TRACE_OPTIONS
     if (
-      gTraceOptions->fTraceMeasuresDetails
+      gTraceOptions ()->fTraceMeasuresDetails
         ||
-      gTraceOptions->fTraceSegmentsDetails) {
-      gLogIOstream <<
+      gTraceOptions ()->fTraceSegmentsDetails) {
+      gLogIOstream () <<
         endl <<
         "*********>> HOUHOU Current voice \"" <<
         fSegmentVoiceUplink->getVoiceName () <<
@@ -15224,8 +15212,8 @@ void msrSegment::finalizeCurrentMeasureInSegment (
   }
 
 #ifdef TRACE_OPTIONS
-  if (gTraceOptions->fTraceMeasures || gTraceOptions->fTraceSegments) {
-    gLogIOstream <<
+  if (gTraceOptions ()->fTraceMeasures || gTraceOptions ()->fTraceSegments) {
+    gLogIOstream () <<
       "Segment '" <<
       fSegmentAbsoluteNumber <<
       "' has no measures to finalize" <<
@@ -15233,14 +15221,14 @@ void msrSegment::finalizeCurrentMeasureInSegment (
   }
 #endif
 
-  gIndenter--;
+  gIndenter ()--;
 }
 
 void msrSegment::appendClefToSegment (S_msrClef clef)
 {
 #ifdef TRACE_OPTIONS
-  if (gTraceOptions->fTraceClefs || gTraceOptions->fTraceSegments) {
-    gLogIOstream <<
+  if (gTraceOptions ()->fTraceClefs || gTraceOptions ()->fTraceSegments) {
+    gLogIOstream () <<
       "Appending clef '" << clef->asString () <<
       "' to segment " << asString () <<
       ", in voice \"" <<
@@ -15250,7 +15238,7 @@ void msrSegment::appendClefToSegment (S_msrClef clef)
   }
 #endif
 
-  gIndenter++;
+  gIndenter ()++;
   
   // sanity check
   if (fSegmentMeasuresList.size () == 0) {
@@ -15264,17 +15252,17 @@ void msrSegment::appendClefToSegment (S_msrClef clef)
       fSegmentVoiceUplink->getVoiceName () <<
       "\"";
 
-    gLogIOstream <<
+    gLogIOstream () <<
       "SegmentVoiceUplink:" <<
       endl;
-    gIndenter++;
-    gLogIOstream <<
+    gIndenter ()++;
+    gLogIOstream () <<
       fSegmentVoiceUplink <<
       endl;
-    gIndenter--;
+    gIndenter ()--;
     
     msrInternalError (
-      gXml2lyOptions->fInputSourceName,
+      gXml2lyOptions ()->fInputSourceName,
       clef->getInputLineNumber (),
       __FILE__, __LINE__,
       s.str ());
@@ -15284,14 +15272,14 @@ void msrSegment::appendClefToSegment (S_msrClef clef)
   fSegmentMeasuresList.back ()->
     appendClefToMeasure (clef);
 
-  gIndenter--;
+  gIndenter ()--;
 }
 
 void msrSegment::prependClefToSegment (S_msrClef clef) // JMI
 {
 #ifdef TRACE_OPTIONS
-  if (gTraceOptions->fTraceClefs || gTraceOptions->fTraceSegments) {
-    gLogIOstream <<
+  if (gTraceOptions ()->fTraceClefs || gTraceOptions ()->fTraceSegments) {
+    gLogIOstream () <<
       "Prepending clef '" << clef->asString () <<
       "' to segment " << asString () <<
       ", in voice \"" <<
@@ -15301,7 +15289,7 @@ void msrSegment::prependClefToSegment (S_msrClef clef) // JMI
   }
 #endif
 
-  gIndenter++;
+  gIndenter ()++;
   
   // sanity check
   if (fSegmentMeasuresList.size () == 0) {
@@ -15315,17 +15303,17 @@ void msrSegment::prependClefToSegment (S_msrClef clef) // JMI
       fSegmentVoiceUplink->getVoiceName () <<
       "\"";
 
-    gLogIOstream <<
+    gLogIOstream () <<
       "SegmentVoiceUplink:" <<
       endl;
-    gIndenter++;
-    gLogIOstream <<
+    gIndenter ()++;
+    gLogIOstream () <<
       fSegmentVoiceUplink <<
       endl;
-    gIndenter--;
+    gIndenter ()--;
     
     msrInternalError (
-      gXml2lyOptions->fInputSourceName,
+      gXml2lyOptions ()->fInputSourceName,
       clef->getInputLineNumber (),
       __FILE__, __LINE__,
       s.str ());
@@ -15335,14 +15323,14 @@ void msrSegment::prependClefToSegment (S_msrClef clef) // JMI
   fSegmentMeasuresList.front ()->
     appendClefToMeasure (clef);
 
-  gIndenter--;
+  gIndenter ()--;
 }
 
 void msrSegment::appendKeyToSegment (S_msrKey key)
 {
 #ifdef TRACE_OPTIONS
-  if (gTraceOptions->fTraceKeys || gTraceOptions->fTraceSegments) {
-    gLogIOstream <<
+  if (gTraceOptions ()->fTraceKeys || gTraceOptions ()->fTraceSegments) {
+    gLogIOstream () <<
       "Appending key '" << key->asString () <<
       "' to segment " << asString () <<
     ", in voice \"" <<
@@ -15357,31 +15345,31 @@ void msrSegment::appendKeyToSegment (S_msrKey key)
     fSegmentMeasuresList.size () > 0,
     "fSegmentMeasuresList is empty");
 
-  gIndenter++;
+  gIndenter ()++;
   
   // register key in segments's current measure
   fSegmentMeasuresList.back ()->
     appendKeyToMeasure (key);
 
-  gIndenter--;
+  gIndenter ()--;
 }
     
 void msrSegment::appendTimeToSegment (S_msrTime time)
 {
 #ifdef TRACE_OPTIONS
-  if (gTraceOptions->fTraceTimes || gTraceOptions->fTraceSegments) {
-    gLogIOstream <<
+  if (gTraceOptions ()->fTraceTimes || gTraceOptions ()->fTraceSegments) {
+    gLogIOstream () <<
       "Appending time:" <<
       endl;
 
-    gIndenter++;
+    gIndenter ()++;
 
-    gLogIOstream <<
+    gLogIOstream () <<
       time;
 
-    gIndenter--;
+    gIndenter ()--;
 
-    gLogIOstream <<
+    gLogIOstream () <<
       "to segment " << asString () <<
       ", in voice \"" <<
       fSegmentVoiceUplink->getVoiceName () <<
@@ -15395,31 +15383,31 @@ void msrSegment::appendTimeToSegment (S_msrTime time)
     fSegmentMeasuresList.size () > 0,
     "fSegmentMeasuresList is empty");
 
-  gIndenter++;
+  gIndenter ()++;
   
   // append time to segments's current measure
   fSegmentMeasuresList.back ()->
     appendTimeToMeasure (time);
 
-  gIndenter--;
+  gIndenter ()--;
 }
 
 void msrSegment::appendTimeToSegmentClone (S_msrTime time)
 {
 #ifdef TRACE_OPTIONS
-  if (gTraceOptions->fTraceTimes || gTraceOptions->fTraceSegments) {
-    gLogIOstream <<
+  if (gTraceOptions ()->fTraceTimes || gTraceOptions ()->fTraceSegments) {
+    gLogIOstream () <<
       "Appending time:" <<
       endl;
 
-    gIndenter++;
+    gIndenter ()++;
 
-    gLogIOstream <<
+    gLogIOstream () <<
       time;
 
-    gIndenter--;
+    gIndenter ()--;
 
-    gLogIOstream <<
+    gLogIOstream () <<
       "to segment clone " << asString () <<
       ", in voice \"" <<
       fSegmentVoiceUplink->getVoiceName () <<
@@ -15428,7 +15416,7 @@ void msrSegment::appendTimeToSegmentClone (S_msrTime time)
   }
 #endif
 
-  gIndenter++;
+  gIndenter ()++;
   
   // sanity check
   msrAssert (
@@ -15439,14 +15427,14 @@ void msrSegment::appendTimeToSegmentClone (S_msrTime time)
   fSegmentMeasuresList.back ()->
     appendTimeToMeasureClone (time);
 
-  gIndenter--;
+  gIndenter ()--;
 }
 
 void msrSegment::appendHarmonyToSegment (S_msrHarmony harmony)
 {
 #ifdef TRACE_OPTIONS
-  if (gTraceOptions->fTraceHarmonies || gTraceOptions->fTraceSegments) {
-    gLogIOstream <<
+  if (gTraceOptions ()->fTraceHarmonies || gTraceOptions ()->fTraceSegments) {
+    gLogIOstream () <<
       "Appending harmony " << harmony->asString () <<
       " to segment " << asString () <<
       "' in voice \"" <<
@@ -15456,7 +15444,7 @@ void msrSegment::appendHarmonyToSegment (S_msrHarmony harmony)
   }
 #endif
 
-  gIndenter++;
+  gIndenter ()++;
   
   // sanity check
   msrAssert (
@@ -15467,14 +15455,14 @@ void msrSegment::appendHarmonyToSegment (S_msrHarmony harmony)
   fSegmentMeasuresList.back ()-> // JMI ???
     appendHarmonyToMeasure (harmony);
 
-  gIndenter--;
+  gIndenter ()--;
 }
 
 void msrSegment::appendHarmonyToSegmentClone (S_msrHarmony harmony)
 {
 #ifdef TRACE_OPTIONS
-  if (gTraceOptions->fTraceHarmonies || gTraceOptions->fTraceSegments) {
-    gLogIOstream <<
+  if (gTraceOptions ()->fTraceHarmonies || gTraceOptions ()->fTraceSegments) {
+    gLogIOstream () <<
       "Appending harmony " << harmony->asString () <<
       " to segment clone " << asString () <<
       "' in voice clone \"" <<
@@ -15489,21 +15477,21 @@ void msrSegment::appendHarmonyToSegmentClone (S_msrHarmony harmony)
     fSegmentMeasuresList.size () > 0,
     "fSegmentMeasuresList is empty");
 
-  gIndenter++;
+  gIndenter ()++;
   
   // append it to this segment
   fSegmentMeasuresList.back ()->
     appendHarmonyToMeasureClone (harmony);
 
-  gIndenter--;
+  gIndenter ()--;
 }
 
 void msrSegment::appendFiguredBassToSegment (
   S_msrFiguredBass figuredBass)
 {
 #ifdef TRACE_OPTIONS
-  if (gTraceOptions->fTraceFiguredBass || gTraceOptions->fTraceSegments) {
-    gLogIOstream <<
+  if (gTraceOptions ()->fTraceFiguredBass || gTraceOptions ()->fTraceSegments) {
+    gLogIOstream () <<
       "Appending figured bass " << figuredBass->asString () <<
       " to segment " << asString () <<
       "' in voice \"" <<
@@ -15518,21 +15506,21 @@ void msrSegment::appendFiguredBassToSegment (
     fSegmentMeasuresList.size () > 0,
     "fSegmentMeasuresList is empty");
 
-  gIndenter++;
+  gIndenter ()++;
   
   // append it to this segment
   fSegmentMeasuresList.back ()-> // JMI ???
     appendFiguredBassToMeasure (figuredBass);
 
-  gIndenter--;
+  gIndenter ()--;
 }
 
 void msrSegment::appendFiguredBassToSegmentClone (
   S_msrFiguredBass figuredBass)
 {
 #ifdef TRACE_OPTIONS
-  if (gTraceOptions->fTraceFiguredBass || gTraceOptions->fTraceSegments) {
-    gLogIOstream <<
+  if (gTraceOptions ()->fTraceFiguredBass || gTraceOptions ()->fTraceSegments) {
+    gLogIOstream () <<
       "Appending figured bass " << figuredBass->asString () <<
       " to segment clone " << asString () <<
       "' in voice clone \"" <<
@@ -15547,20 +15535,20 @@ void msrSegment::appendFiguredBassToSegmentClone (
     fSegmentMeasuresList.size () > 0,
     "fSegmentMeasuresList is empty");
 
-  gIndenter++;
+  gIndenter ()++;
   
   // append it to this segment
   fSegmentMeasuresList.back ()->
     appendFiguredBassToMeasure (figuredBass);
 
-  gIndenter--;
+  gIndenter ()--;
 }
 
 void msrSegment::appendSegnoToSegment (S_msrSegno segno)
 {
 #ifdef TRACE_OPTIONS
-  if (gTraceOptions->fTraceHarmonies || gTraceOptions->fTraceSegments) {
-    gLogIOstream <<
+  if (gTraceOptions ()->fTraceHarmonies || gTraceOptions ()->fTraceSegments) {
+    gLogIOstream () <<
       "Appending segno " <<
       " to segment " << asString () <<
       "' in voice \"" <<
@@ -15575,20 +15563,20 @@ void msrSegment::appendSegnoToSegment (S_msrSegno segno)
     fSegmentMeasuresList.size () > 0,
     "fSegmentMeasuresList is empty");
 
-  gIndenter++;
+  gIndenter ()++;
   
   // append it to this segment
   fSegmentMeasuresList.back ()->
     appendSegnoToMeasure (segno);
 
-  gIndenter--;
+  gIndenter ()--;
 }
 
 void msrSegment::appendCodaToSegment (S_msrCoda coda)
 {
 #ifdef TRACE_OPTIONS
-  if (gTraceOptions->fTraceHarmonies || gTraceOptions->fTraceSegments) {
-    gLogIOstream <<
+  if (gTraceOptions ()->fTraceHarmonies || gTraceOptions ()->fTraceSegments) {
+    gLogIOstream () <<
       "Appending coda " <<
       " to segment " << asString () <<
       "' in voice \"" <<
@@ -15603,21 +15591,21 @@ void msrSegment::appendCodaToSegment (S_msrCoda coda)
     fSegmentMeasuresList.size () > 0,
     "fSegmentMeasuresList is empty");
 
-  gIndenter++;
+  gIndenter ()++;
   
   // append it to this segment
   fSegmentMeasuresList.back ()->
     appendCodaToMeasure (coda);
 
-  gIndenter--;
+  gIndenter ()--;
 }
 
 void msrSegment::appendEyeGlassesToSegment (
   S_msrEyeGlasses eyeGlasses)
 {
 #ifdef TRACE_OPTIONS
-  if (gTraceOptions->fTraceHarmonies || gTraceOptions->fTraceSegments) {
-    gLogIOstream <<
+  if (gTraceOptions ()->fTraceHarmonies || gTraceOptions ()->fTraceSegments) {
+    gLogIOstream () <<
       "Appending eyeGlasses " <<
       " to segment " << asString () <<
       "' in voice \"" <<
@@ -15632,20 +15620,20 @@ void msrSegment::appendEyeGlassesToSegment (
     fSegmentMeasuresList.size () > 0,
     "fSegmentMeasuresList is empty");
 
-  gIndenter++;
+  gIndenter ()++;
   
   // append it to this segment
   fSegmentMeasuresList.back ()->
     appendEyeGlassesToMeasure (eyeGlasses);
 
-  gIndenter--;
+  gIndenter ()--;
 }
 
 void msrSegment::appendPedalToSegment (S_msrPedal pedal)
 {
 #ifdef TRACE_OPTIONS
-  if (gTraceOptions->fTraceHarmonies || gTraceOptions->fTraceSegments) {
-    gLogIOstream <<
+  if (gTraceOptions ()->fTraceHarmonies || gTraceOptions ()->fTraceSegments) {
+    gLogIOstream () <<
       "Appending pedal " <<
       " to segment " << asString () <<
       "' in voice \"" <<
@@ -15660,20 +15648,20 @@ void msrSegment::appendPedalToSegment (S_msrPedal pedal)
     fSegmentMeasuresList.size () > 0,
     "fSegmentMeasuresList is empty");
 
-  gIndenter++;
+  gIndenter ()++;
   
   // append it to this segment
   fSegmentMeasuresList.back ()->
     appendPedalToMeasure (pedal);
 
-  gIndenter--;
+  gIndenter ()--;
 }
 
 void msrSegment::appendDampToSegment (S_msrDamp damp)
 {
 #ifdef TRACE_OPTIONS
-  if (gTraceOptions->fTraceHarmonies || gTraceOptions->fTraceSegments) {
-    gLogIOstream <<
+  if (gTraceOptions ()->fTraceHarmonies || gTraceOptions ()->fTraceSegments) {
+    gLogIOstream () <<
       "Appending damp " <<
       " to segment " << asString () <<
       "' in voice \"" <<
@@ -15688,20 +15676,20 @@ void msrSegment::appendDampToSegment (S_msrDamp damp)
     fSegmentMeasuresList.size () > 0,
     "fSegmentMeasuresList is empty");
 
-  gIndenter++;
+  gIndenter ()++;
   
   // append it to this segment
   fSegmentMeasuresList.back ()->
     appendDampToMeasure (damp);
 
-  gIndenter--;
+  gIndenter ()--;
 }
 
 void msrSegment::appendDampAllToSegment (S_msrDampAll dampAll)
 {
 #ifdef TRACE_OPTIONS
-  if (gTraceOptions->fTraceHarmonies || gTraceOptions->fTraceSegments) {
-    gLogIOstream <<
+  if (gTraceOptions ()->fTraceHarmonies || gTraceOptions ()->fTraceSegments) {
+    gLogIOstream () <<
       "Appending damp all " <<
       " to segment " << asString () <<
       "' in voice \"" <<
@@ -15716,21 +15704,21 @@ void msrSegment::appendDampAllToSegment (S_msrDampAll dampAll)
     fSegmentMeasuresList.size () > 0,
     "fSegmentMeasuresList is empty");
 
-  gIndenter++;
+  gIndenter ()++;
   
   // append it to this segment
   fSegmentMeasuresList.back ()->
     appendDampAllToMeasure (dampAll);
 
-  gIndenter--;
+  gIndenter ()--;
 }
 
 void msrSegment::appendTransposeToSegment (
   S_msrTranspose transpose)
 {
 #ifdef TRACE_OPTIONS
-  if (gTraceOptions->fTraceTranspositions || gTraceOptions->fTraceSegments) {
-    gLogIOstream <<
+  if (gTraceOptions ()->fTraceTranspositions || gTraceOptions ()->fTraceSegments) {
+    gLogIOstream () <<
       "Appending transpose " <<
       " to segment " << asString () <<
       "' in voice \"" <<
@@ -15745,21 +15733,21 @@ void msrSegment::appendTransposeToSegment (
     fSegmentMeasuresList.size () > 0,
     "fSegmentMeasuresList is empty");
 
-  gIndenter++;
+  gIndenter ()++;
   
   // append it to this segment
   fSegmentMeasuresList.back ()->
     appendTransposeToMeasure (transpose);
 
-  gIndenter--;
+  gIndenter ()--;
 }
 
 void msrSegment::appendPartNameDisplayToSegment (
   S_msrPartNameDisplay partNameDisplay)
 {
 #ifdef TRACE_OPTIONS
-  if (gTraceOptions->fTraceTranspositions || gTraceOptions->fTraceSegments) {
-    gLogIOstream <<
+  if (gTraceOptions ()->fTraceTranspositions || gTraceOptions ()->fTraceSegments) {
+    gLogIOstream () <<
       "Appending part name display " <<
       " to segment " << asString () <<
       "' in voice \"" <<
@@ -15774,21 +15762,21 @@ void msrSegment::appendPartNameDisplayToSegment (
     fSegmentMeasuresList.size () > 0,
     "fSegmentMeasuresList is empty");
 
-  gIndenter++;
+  gIndenter ()++;
   
   // append it to this segment
   fSegmentMeasuresList.back ()->
     appendPartNameDisplayToMeasure (partNameDisplay);
 
-  gIndenter--;
+  gIndenter ()--;
 }
 
 void msrSegment::appendPartAbbreviationDisplayToSegment (
   S_msrPartAbbreviationDisplay partAbbreviationDisplay)
 {
 #ifdef TRACE_OPTIONS
-  if (gTraceOptions->fTraceTranspositions || gTraceOptions->fTraceSegments) {
-    gLogIOstream <<
+  if (gTraceOptions ()->fTraceTranspositions || gTraceOptions ()->fTraceSegments) {
+    gLogIOstream () <<
       "Appending part abbreviation display " <<
       
       " to segment " << asString () <<
@@ -15804,22 +15792,22 @@ void msrSegment::appendPartAbbreviationDisplayToSegment (
     fSegmentMeasuresList.size () > 0,
     "fSegmentMeasuresList is empty");
 
-  gIndenter++;
+  gIndenter ()++;
   
   // append it to this segment
   fSegmentMeasuresList.back ()->
     appendPartAbbreviationDisplayToMeasure (
       partAbbreviationDisplay);
 
-  gIndenter--;
+  gIndenter ()--;
 }
 
 void msrSegment::appendStaffDetailsToSegment (
   S_msrStaffDetails staffDetails)
 {
 #ifdef TRACE_OPTIONS
-  if (gTraceOptions->fTraceHarmonies || gTraceOptions->fTraceSegments) {
-    gLogIOstream <<
+  if (gTraceOptions ()->fTraceHarmonies || gTraceOptions ()->fTraceSegments) {
+    gLogIOstream () <<
       "Appending staff details " <<
       " to segment " << asString () <<
       "' in voice \"" <<
@@ -15829,7 +15817,7 @@ void msrSegment::appendStaffDetailsToSegment (
   }
 #endif
 
-  gIndenter++;
+  gIndenter ()++;
   
   // sanity check
   if (fSegmentMeasuresList.size () == 0) { // JMI
@@ -15857,14 +15845,14 @@ void msrSegment::appendStaffDetailsToSegment (
   fSegmentMeasuresList.back ()->
     appendStaffDetailsToMeasure (staffDetails);
 
-  gIndenter--;
+  gIndenter ()--;
 }
 
 void msrSegment::appendLineBreakToSegment (S_msrLineBreak lineBreak)
 {
 #ifdef TRACE_OPTIONS
-  if (gTraceOptions->fTraceHarmonies || gTraceOptions->fTraceSegments) {
-    gLogIOstream <<
+  if (gTraceOptions ()->fTraceHarmonies || gTraceOptions ()->fTraceSegments) {
+    gLogIOstream () <<
       "Appending break " <<
       " to segment " << asString () <<
       "' in voice \"" <<
@@ -15879,20 +15867,20 @@ void msrSegment::appendLineBreakToSegment (S_msrLineBreak lineBreak)
     fSegmentMeasuresList.size () > 0,
     "fSegmentMeasuresList is empty");
 
-  gIndenter++;
+  gIndenter ()++;
   
   // append it to this segment
   fSegmentMeasuresList.back ()->
     appendLineBreakToMeasure (lineBreak);
 
-  gIndenter--;
+  gIndenter ()--;
 }
 
 void msrSegment::appendPageBreakToSegment (S_msrPageBreak pageBreak)
 {
 #ifdef TRACE_OPTIONS
-  if (gTraceOptions->fTraceHarmonies || gTraceOptions->fTraceSegments) {
-    gLogIOstream <<
+  if (gTraceOptions ()->fTraceHarmonies || gTraceOptions ()->fTraceSegments) {
+    gLogIOstream () <<
       "Appending break " <<
       " to segment " << asString () <<
       "' in voice \"" <<
@@ -15907,21 +15895,21 @@ void msrSegment::appendPageBreakToSegment (S_msrPageBreak pageBreak)
     fSegmentMeasuresList.size () > 0,
     "fSegmentMeasuresList is empty");
 
-  gIndenter++;
+  gIndenter ()++;
   
   // append it to this segment
   fSegmentMeasuresList.back ()->
     appendPageBreakToMeasure (pageBreak);
 
-  gIndenter--;
+  gIndenter ()--;
 }
 
 void msrSegment::appendBarNumberCheckToSegment (
   S_msrBarNumberCheck barNumberCheck)
 {
 #ifdef TRACE_OPTIONS
-  if (gTraceOptions->fTraceHarmonies || gTraceOptions->fTraceSegments) {
-    gLogIOstream <<
+  if (gTraceOptions ()->fTraceHarmonies || gTraceOptions ()->fTraceSegments) {
+    gLogIOstream () <<
       "Appending bar number check " <<
       " to segment " << asString () <<
       "' in voice \"" <<
@@ -15936,21 +15924,21 @@ void msrSegment::appendBarNumberCheckToSegment (
     fSegmentMeasuresList.size () > 0,
     "fSegmentMeasuresList is empty");
 
-  gIndenter++;
+  gIndenter ()++;
   
   // append it to this segment
   fSegmentMeasuresList.back ()->
     appendBarNumberCheckToMeasure (barNumberCheck);
 
-  gIndenter--;
+  gIndenter ()--;
 }
 
 void msrSegment::appendTempoToSegment (
   S_msrTempo tempo)
 {
 #ifdef TRACE_OPTIONS
-  if (gTraceOptions->fTraceHarmonies || gTraceOptions->fTraceSegments) {
-    gLogIOstream <<
+  if (gTraceOptions ()->fTraceHarmonies || gTraceOptions ()->fTraceSegments) {
+    gLogIOstream () <<
       "Appending tempo " <<
       " to segment " << asString () <<
       "' in voice \"" <<
@@ -15965,21 +15953,21 @@ void msrSegment::appendTempoToSegment (
     fSegmentMeasuresList.size () > 0,
     "fSegmentMeasuresList is empty");
 
-  gIndenter++;
+  gIndenter ()++;
   
   // append it to this segment
   fSegmentMeasuresList.back ()->
     appendTempoToMeasure (tempo);
 
-  gIndenter--;
+  gIndenter ()--;
 }
 
 void msrSegment::appendRehearsalToSegment (
   S_msrRehearsal rehearsal)
 {
 #ifdef TRACE_OPTIONS
-  if (gTraceOptions->fTraceHarmonies || gTraceOptions->fTraceSegments) {
-    gLogIOstream <<
+  if (gTraceOptions ()->fTraceHarmonies || gTraceOptions ()->fTraceSegments) {
+    gLogIOstream () <<
       "Appending rehearsal " <<
       " to segment " << asString () <<
       "' in voice \"" <<
@@ -15994,21 +15982,21 @@ void msrSegment::appendRehearsalToSegment (
     fSegmentMeasuresList.size () > 0,
     "fSegmentMeasuresList is empty");
 
-  gIndenter++;
+  gIndenter ()++;
   
   // append it to this segment
   fSegmentMeasuresList.back ()->
     appendRehearsalToMeasure (rehearsal);
 
-  gIndenter--;
+  gIndenter ()--;
 }
 
 void msrSegment::appendOctaveShiftToSegment (
   S_msrOctaveShift octaveShift)
 {
 #ifdef TRACE_OPTIONS
-  if (gTraceOptions->fTraceHarmonies || gTraceOptions->fTraceSegments) {
-    gLogIOstream <<
+  if (gTraceOptions ()->fTraceHarmonies || gTraceOptions ()->fTraceSegments) {
+    gLogIOstream () <<
       "Appending octave shift '" <<
       octaveShift->octaveShiftKindAsString () <<
       "' to segment " << asString () <<
@@ -16024,21 +16012,21 @@ void msrSegment::appendOctaveShiftToSegment (
     fSegmentMeasuresList.size () > 0,
     "fSegmentMeasuresList is empty");
 
-  gIndenter++;
+  gIndenter ()++;
   
   // append it to this segment
   fSegmentMeasuresList.back ()->
     appendOctaveShiftToMeasure (octaveShift);
 
-  gIndenter--;
+  gIndenter ()--;
 }
 
 void msrSegment::appendScordaturaToSegment (
   S_msrScordatura scordatura)
 {
 #ifdef TRACE_OPTIONS
-  if (gTraceOptions->fTraceHarmonies || gTraceOptions->fTraceSegments) {
-    gLogIOstream <<
+  if (gTraceOptions ()->fTraceHarmonies || gTraceOptions ()->fTraceSegments) {
+    gLogIOstream () <<
       "Appending scordatura '" <<
   // JMI ???    scordatura->octaveShiftKindAsString () <<
       "' to segment " << asString () <<
@@ -16054,13 +16042,13 @@ void msrSegment::appendScordaturaToSegment (
     fSegmentMeasuresList.size () > 0,
     "fSegmentMeasuresList is empty");
 
-  gIndenter++;
+  gIndenter ()++;
   
   // append it to this segment
   fSegmentMeasuresList.back ()->
     appendScordaturaToMeasure (scordatura);
 
-  gIndenter--;
+  gIndenter ()--;
 }
 
 void msrSegment::appendAccordionRegistrationToSegment (
@@ -16068,8 +16056,8 @@ void msrSegment::appendAccordionRegistrationToSegment (
     accordionRegistration)
 {
 #ifdef TRACE_OPTIONS
-  if (gTraceOptions->fTracePasses || gTraceOptions->fTraceSegments) {
-    gLogIOstream <<
+  if (gTraceOptions ()->fTracePasses || gTraceOptions ()->fTraceSegments) {
+    gLogIOstream () <<
       "Appending accordion registration '" <<
       accordionRegistration->asString () <<
       "' to segment " << asString () <<
@@ -16085,14 +16073,14 @@ void msrSegment::appendAccordionRegistrationToSegment (
     fSegmentMeasuresList.size () > 0,
     "fSegmentMeasuresList is empty");
 
-  gIndenter++;
+  gIndenter ()++;
   
   // append it to this segment
   fSegmentMeasuresList.back ()->
     appendAccordionRegistrationToMeasure (
       accordionRegistration);
 
-  gIndenter--;
+  gIndenter ()--;
 }
 
 void msrSegment::appendHarpPedalsTuningToSegment (
@@ -16100,8 +16088,8 @@ void msrSegment::appendHarpPedalsTuningToSegment (
     harpPedalsTuning)
 {
 #ifdef TRACE_OPTIONS
-  if (gTraceOptions->fTracePasses || gTraceOptions->fTraceSegments) {
-    gLogIOstream <<
+  if (gTraceOptions ()->fTracePasses || gTraceOptions ()->fTraceSegments) {
+    gLogIOstream () <<
       "Appending staff pedals tuning '" <<
       harpPedalsTuning->asString () <<
       "' to segment " << asString () <<
@@ -16117,14 +16105,14 @@ void msrSegment::appendHarpPedalsTuningToSegment (
     fSegmentMeasuresList.size () > 0,
     "fSegmentMeasuresList is empty");
 
-  gIndenter++;
+  gIndenter ()++;
   
   // append it to this segment
   fSegmentMeasuresList.back ()->
     appendHarpPedalsTuningToMeasure (
       harpPedalsTuning);
 
-  gIndenter--;
+  gIndenter ()--;
 }
 
 void msrSegment::padUpToMeasureLengthInSegment (
@@ -16132,8 +16120,8 @@ void msrSegment::padUpToMeasureLengthInSegment (
   rational measureLength)
 {
 #ifdef TRACE_OPTIONS
-  if (gTraceOptions->fTraceSegments || gTraceOptions->fTraceMeasures) {
-    gLogIOstream <<
+  if (gTraceOptions ()->fTraceSegments || gTraceOptions ()->fTraceMeasures) {
+    gLogIOstream () <<
       "Padding up to measure length '" << measureLength <<
       "' in segment '" <<
       fSegmentAbsoluteNumber <<
@@ -16155,26 +16143,26 @@ void msrSegment::padUpToMeasureLengthInSegment (
       fSegmentVoiceUplink->getVoiceName () <<
       "\"";
 
-    gLogIOstream <<
+    gLogIOstream () <<
       "SegmentVoiceUplink:" <<
       endl;
-    gIndenter++;
-    gLogIOstream <<
+    gIndenter ()++;
+    gLogIOstream () <<
       fSegmentVoiceUplink <<
       endl;
-    gIndenter--;
+    gIndenter ()--;
     
-    gLogIOstream <<
+    gLogIOstream () <<
       "Part:" <<
       endl;
-    gIndenter++;
-    gLogIOstream <<
+    gIndenter ()++;
+    gLogIOstream () <<
       fSegmentVoiceUplink->fetchVoicePartUplink () <<
       endl;
-    gIndenter--;
+    gIndenter ()--;
     
     msrInternalError (
-      gXml2lyOptions->fInputSourceName,
+      gXml2lyOptions ()->fInputSourceName,
       inputLineNumber,
       __FILE__, __LINE__,
       s.str ());
@@ -16194,8 +16182,8 @@ void msrSegment::appendPaddingNoteToSegment (
   int divisionsPerQuarterNote)
 {
 #ifdef TRACE_OPTIONS
-  if (gTraceOptions->fTraceSegments || gTraceOptions->fTraceMeasures) {
-    gLogIOstream <<
+  if (gTraceOptions ()->fTraceSegments || gTraceOptions ()->fTraceMeasures) {
+    gLogIOstream () <<
       "Appendding padding tote of " << divisions <<
       " divisions to segment '" <<
       fSegmentAbsoluteNumber <<
@@ -16206,7 +16194,7 @@ void msrSegment::appendPaddingNoteToSegment (
   }
 #endif
 
-  gIndenter++;
+  gIndenter ()++;
 
   if (fSegmentMeasuresList.size ()) { // JMI BOFBOF
     // append a padding note to the segment's last measure
@@ -16217,7 +16205,7 @@ void msrSegment::appendPaddingNoteToSegment (
         divisionsPerQuarterNote);
   }
   
-  gIndenter--;
+  gIndenter ()--;
 }
 
 void msrSegment::appendMeasureToSegment (S_msrMeasure measure)
@@ -16234,19 +16222,19 @@ void msrSegment::appendMeasureToSegment (S_msrMeasure measure)
       : fSegmentMeasuresList.back ()->getMeasureNumber ();
     
 #ifdef TRACE_OPTIONS
-  if (gTraceOptions->fTraceMeasures || gTraceOptions->fTraceSegments) {
-    gLogIOstream <<
+  if (gTraceOptions ()->fTraceMeasures || gTraceOptions ()->fTraceSegments) {
+    gLogIOstream () <<
       "Appending measure '" << measureNumber <<
       "' to segment " << asString ();
 
     if (fSegmentMeasuresList.size () == 0)
-      gLogIOstream <<
+      gLogIOstream () <<
         ", as first measure FII"; // JMI
     else
-      gLogIOstream <<
+      gLogIOstream () <<
       ", after measure number '" << currentMeasureNumber << "'";
 
-    gLogIOstream <<
+    gLogIOstream () <<
       "' in voice \"" <<
       fSegmentVoiceUplink->getVoiceName () <<
       "\"" <<
@@ -16264,7 +16252,7 @@ void msrSegment::appendMeasureToSegment (S_msrMeasure measure)
 
     // JMI  msrInternalError (
     msrInternalWarning (
-      gXml2lyOptions->fInputSourceName,
+      gXml2lyOptions ()->fInputSourceName,
       inputLineNumber,
       s.str ());
   }
@@ -16289,23 +16277,23 @@ void msrSegment::prependMeasureToSegment (S_msrMeasure measure)
       : fSegmentMeasuresList.back ()->getMeasureNumber ();
     
 #ifdef TRACE_OPTIONS
-  if (gTraceOptions->fTraceMeasures || gTraceOptions->fTraceSegments) {
-    gLogIOstream <<
+  if (gTraceOptions ()->fTraceMeasures || gTraceOptions ()->fTraceSegments) {
+    gLogIOstream () <<
       "Prepending measure " << measureNumber <<
       " to segment " << asString ();
 
     if (fSegmentMeasuresList.size () == 0) {
-      gLogIOstream <<
+      gLogIOstream () <<
         ", as first measure FOO"; // JMI
     }
     
 /* JMI
     else
-      gLogIOstream <<
+      gLogIOstream () <<
       ", after measure number '" << currentMeasureNumber << "'";
 */
 
-    gLogIOstream <<
+    gLogIOstream () <<
       " in voice \"" <<
       fSegmentVoiceUplink->getVoiceName () <<
       "\"," <<
@@ -16323,7 +16311,7 @@ void msrSegment::prependMeasureToSegment (S_msrMeasure measure)
 
   // JMI  msrInternalError (
     msrInternalWarning (
-      gXml2lyOptions->fInputSourceName,
+      gXml2lyOptions ()->fInputSourceName,
       inputLineNumber,
       s.str ());
   }
@@ -16342,8 +16330,8 @@ void msrSegment::appendMeasureToSegmentIfNotYetDone ( // JMI
   if (! fSegmentMeasuresList.size ()) {
     // create a new measure
 #ifdef TRACE_OPTIONS
-    if (gTraceOptions->fTraceMeasures || gTraceOptions->fTraceSegments) {
-      gLogIOstream <<
+    if (gTraceOptions ()->fTraceMeasures || gTraceOptions ()->fTraceSegments) {
+      gLogIOstream () <<
         "Appending a new measure '" << measureNumber <<
         "' to segment '" << asString () << "'" <<
         "' in voice \"" <<
@@ -16372,8 +16360,8 @@ void msrSegment::appendMeasureToSegmentIfNotYetDone ( // JMI
 void msrSegment::prependBarlineToSegment (S_msrBarline barline)
 {
 #ifdef TRACE_OPTIONS
-  if (gTraceOptions->fTraceMeasures || gTraceOptions->fTraceSegments) {
-    gLogIOstream <<
+  if (gTraceOptions ()->fTraceMeasures || gTraceOptions ()->fTraceSegments) {
+    gLogIOstream () <<
       "Prepending barline '" << barline->asString () <<
       "' to segment '" << asString () << "'" <<
       "' in voice \"" <<
@@ -16389,19 +16377,19 @@ void msrSegment::prependBarlineToSegment (S_msrBarline barline)
     "fSegmentMeasuresList is empty");
 
   // prepend barline to this segment
-  gIndenter++;
+  gIndenter ()++;
   
   fSegmentMeasuresList.front ()->
     prependBarlineToMeasure (barline);
 
-  gIndenter--;
+  gIndenter ()--;
 }
 
 void msrSegment::appendBarlineToSegment (S_msrBarline barline)
 {
 #ifdef TRACE_OPTIONS
-  if (gTraceOptions->fTraceMeasures || gTraceOptions->fTraceSegments) {
-    gLogIOstream <<
+  if (gTraceOptions ()->fTraceMeasures || gTraceOptions ()->fTraceSegments) {
+    gLogIOstream () <<
       "Appending barline '" << barline->asString () <<
       "' to segment '" << asString () << "'" <<
       "' in voice \"" <<
@@ -16414,10 +16402,10 @@ void msrSegment::appendBarlineToSegment (S_msrBarline barline)
   if (! fSegmentMeasuresList.size ()) { // JMI
 #ifdef TRACE_OPTIONS
     if (
-      gTraceOptions->fTraceBarlinesDetails
+      gTraceOptions ()->fTraceBarlinesDetails
         ||
-      gTraceOptions->fTraceSegmentsDetails) { // JMI
-      gLogIOstream <<
+      gTraceOptions ()->fTraceSegmentsDetails) { // JMI
+      gLogIOstream () <<
         endl <<
         "*********>> Current voice \"" <<
         fSegmentVoiceUplink->getVoiceName () <<
@@ -16438,20 +16426,20 @@ void msrSegment::appendBarlineToSegment (S_msrBarline barline)
     fSegmentMeasuresList.size () > 0,
     "fSegmentMeasuresList is empty");
 
-  gIndenter++;
+  gIndenter ()++;
   
   // append barline to this segment
   fSegmentMeasuresList.back ()->
     appendBarlineToMeasure (barline);
 
-  gIndenter--;
+  gIndenter ()--;
 }
 
 void msrSegment::appendBarCheckToSegment (S_msrBarCheck barCheck)
 {
 #ifdef TRACE_OPTIONS
-  if (gTraceOptions->fTraceMeasures || gTraceOptions->fTraceSegments) {
-    gLogIOstream <<
+  if (gTraceOptions ()->fTraceMeasures || gTraceOptions ()->fTraceSegments) {
+    gLogIOstream () <<
       "Appending bar check " << barCheck->asString () <<
       " to segment '" << asString () << "'" <<
       "' in voice \"" <<
@@ -16475,12 +16463,12 @@ void msrSegment::appendVoiceStaffChangeToSegment (
 {
 #ifdef TRACE_OPTIONS
   if (
-    gTraceOptions->fTraceVoices
+    gTraceOptions ()->fTraceVoices
       ||
-    gTraceOptions->fTraceStaves
+    gTraceOptions ()->fTraceStaves
       ||
-    gTraceOptions->fTraceSegments) {
-    gLogIOstream <<
+    gTraceOptions ()->fTraceSegments) {
+    gLogIOstream () <<
       "Appending voice staff change '" <<
       voiceStaffChange->asString () <<
       "' to segment \"" << asString () << "\"" <<
@@ -16494,13 +16482,13 @@ void msrSegment::appendVoiceStaffChangeToSegment (
     fSegmentMeasuresList.size () > 0,
     "fSegmentMeasuresList is empty");
 
-  gIndenter++;
+  gIndenter ()++;
   
   fSegmentMeasuresList.back ()->
     appendVoiceStaffChangeToMeasure (
       voiceStaffChange);
 
-  gIndenter--;
+  gIndenter ()--;
 }
 
 void msrSegment::appendNoteToSegment (S_msrNote note)
@@ -16511,7 +16499,7 @@ void msrSegment::appendNoteToSegment (S_msrNote note)
 
 
   if (! fSegmentMeasuresList.size ()) { // JMI
-    gLogIOstream <<
+    gLogIOstream () <<
       endl <<
       endl <<
       endl <<
@@ -16553,8 +16541,8 @@ void msrSegment::appendDoubleTremoloToSegment ( // JMI
   S_msrDoubleTremolo doubleTremolo)
 {
 #ifdef TRACE_OPTIONS
-  if (gTraceOptions->fTraceTremolos || gTraceOptions->fTraceSegments) {
-    gLogIOstream <<
+  if (gTraceOptions ()->fTraceTremolos || gTraceOptions ()->fTraceSegments) {
+    gLogIOstream () <<
       "Appending double tremolo " <<
       doubleTremolo->asShortString () <<
       " to segment '" << asString () << "'" <<
@@ -16578,8 +16566,8 @@ void msrSegment::appendMeasuresRepeatToSegment (
   S_msrMeasuresRepeat measuresRepeat)
 {
 #ifdef TRACE_OPTIONS
-  if (gTraceOptions->fTraceRepeats || gTraceOptions->fTraceSegments) {
-    gLogIOstream <<
+  if (gTraceOptions ()->fTraceRepeats || gTraceOptions ()->fTraceSegments) {
+    gLogIOstream () <<
       "Appending measure repeat '" <<
       measuresRepeat->asString () <<
       "' to segment '" << asString () << "'" <<
@@ -16603,8 +16591,8 @@ void msrSegment::appendMultipleRestToSegment (
   S_msrMultipleRest multipleRest)
 {
 #ifdef TRACE_OPTIONS
-  if (gTraceOptions->fTraceRepeats || gTraceOptions->fTraceSegments) {
-    gLogIOstream <<
+  if (gTraceOptions ()->fTraceRepeats || gTraceOptions ()->fTraceSegments) {
+    gLogIOstream () <<
       "Appending multiple rest '" <<
       multipleRest->asString () <<
       "' to segment '" << asString () << "'" <<
@@ -16757,8 +16745,8 @@ void msrSegment::removeNoteFromSegment (
   S_msrNote note)
 {  
 #ifdef TRACE_OPTIONS
-  if (gTraceOptions->fTraceNotes || gTraceOptions->fTraceSegments) {
-    gLogIOstream <<
+  if (gTraceOptions ()->fTraceNotes || gTraceOptions ()->fTraceSegments) {
+    gLogIOstream () <<
       "Removing note '" <<
       note->asString () <<
       "'from segment '" <<
@@ -16768,7 +16756,7 @@ void msrSegment::removeNoteFromSegment (
   }
 #endif
 
-  gIndenter++;
+  gIndenter ()++;
   
   if (fSegmentMeasuresList.size ()) {
     fSegmentMeasuresList.back ()->
@@ -16789,13 +16777,13 @@ void msrSegment::removeNoteFromSegment (
       " since it is empty";
 
     msrInternalError (
-      gXml2lyOptions->fInputSourceName,
+      gXml2lyOptions ()->fInputSourceName,
       inputLineNumber,
       __FILE__, __LINE__,
       s.str ());
   }
 
-  gIndenter--;
+  gIndenter ()--;
 }
 
 void msrSegment::removeElementFromSegment (
@@ -16803,8 +16791,8 @@ void msrSegment::removeElementFromSegment (
   S_msrElement element)
 {  
 #ifdef TRACE_OPTIONS
-  if (gTraceOptions->fTraceSegments) {
-    gLogIOstream <<
+  if (gTraceOptions ()->fTraceSegments) {
+    gLogIOstream () <<
       "Removing element '" <<
       element->asString () <<
       "'from segment '" <<
@@ -16833,7 +16821,7 @@ void msrSegment::removeElementFromSegment (
       " since it is empty";
 
     msrInternalError (
-      gXml2lyOptions->fInputSourceName,
+      gXml2lyOptions ()->fInputSourceName,
       inputLineNumber,
       __FILE__, __LINE__,
       s.str ());
@@ -16844,8 +16832,8 @@ S_msrMeasure msrSegment::removeLastMeasureFromSegment (
   int inputLineNumber)
 {
 #ifdef TRACE_OPTIONS
-  if (gTraceOptions->fTraceMeasures || gTraceOptions->fTraceSegments) {
-    gLogIOstream <<
+  if (gTraceOptions ()->fTraceMeasures || gTraceOptions ()->fTraceSegments) {
+    gLogIOstream () <<
       "Removing last measure from segment '" <<
       fSegmentAbsoluteNumber <<
       "', line " << inputLineNumber <<
@@ -16865,7 +16853,7 @@ S_msrMeasure msrSegment::removeLastMeasureFromSegment (
       "' since it is empty";
 
     msrInternalError (
-      gXml2lyOptions->fInputSourceName,
+      gXml2lyOptions ()->fInputSourceName,
       inputLineNumber,
       __FILE__, __LINE__,
       s.str ());
@@ -16876,24 +16864,24 @@ S_msrMeasure msrSegment::removeLastMeasureFromSegment (
       fSegmentMeasuresList.back ();
 
 #ifdef TRACE_OPTIONS
-  if (gTraceOptions->fTraceMeasures || gTraceOptions->fTraceSegments) {
-    gLogIOstream <<
+  if (gTraceOptions ()->fTraceMeasures || gTraceOptions ()->fTraceSegments) {
+    gLogIOstream () <<
       endl <<
       "This measure contains:" <<
       endl;
 
-    gIndenter++;
+    gIndenter ()++;
 
-    gLogIOstream <<
+    gLogIOstream () <<
       result <<
       endl;
 
-    gIndenter--;
+    gIndenter ()--;
   }
 #endif
 
   if (false) { // JMI
-    gLogIOstream <<
+    gLogIOstream () <<
       endl <<
       endl <<
       endl <<
@@ -16926,8 +16914,8 @@ S_msrMeasure msrSegment::removeLastMeasureFromSegment (
 
 void msrSegment::acceptIn (basevisitor* v)
 {
-  if (gMsrOptions->fTraceMsrVisitors) {
-    gLogIOstream <<
+  if (gMsrOptions ()->fTraceMsrVisitors) {
+    gLogIOstream () <<
       "% ==> msrSegment::acceptIn ()" <<
       endl;
   }
@@ -16937,8 +16925,8 @@ void msrSegment::acceptIn (basevisitor* v)
       dynamic_cast<visitor<S_msrSegment>*> (v)) {
         S_msrSegment elem = this;
         
-        if (gMsrOptions->fTraceMsrVisitors) {
-          gLogIOstream <<
+        if (gMsrOptions ()->fTraceMsrVisitors) {
+          gLogIOstream () <<
             "% ==> Launching msrSegment::visitStart ()" <<
             endl;
         }
@@ -16948,8 +16936,8 @@ void msrSegment::acceptIn (basevisitor* v)
 
 void msrSegment::acceptOut (basevisitor* v)
 {
-  if (gMsrOptions->fTraceMsrVisitors) {
-    gLogIOstream <<
+  if (gMsrOptions ()->fTraceMsrVisitors) {
+    gLogIOstream () <<
       "% ==> msrSegment::acceptOut ()" <<
       endl;
   }
@@ -16959,8 +16947,8 @@ void msrSegment::acceptOut (basevisitor* v)
       dynamic_cast<visitor<S_msrSegment>*> (v)) {
         S_msrSegment elem = this;
       
-        if (gMsrOptions->fTraceMsrVisitors) {
-          gLogIOstream <<
+        if (gMsrOptions ()->fTraceMsrVisitors) {
+          gLogIOstream () <<
             "% ==> Launching msrSegment::visitEnd ()" <<
             endl;
         }
@@ -16970,15 +16958,15 @@ void msrSegment::acceptOut (basevisitor* v)
 
 void msrSegment::browseData (basevisitor* v)
 {
-  if (gMsrOptions->fTraceMsrVisitors) {
-    gLogIOstream <<
+  if (gMsrOptions ()->fTraceMsrVisitors) {
+    gLogIOstream () <<
       "% ==> msrSegment::browseData ()" <<
       endl;
   }
 
 /* JMI
-  gLogIOstream <<
-    gTab <<
+  gLogIOstream () <<
+    gTab () <<
     "==========>>> " <<
     fSegmentMeasuresList.size () << " measures" << endl;
     */
@@ -16992,8 +16980,8 @@ void msrSegment::browseData (basevisitor* v)
     browser.browse (*(*i));
   } // for
 
-  if (gMsrOptions->fTraceMsrVisitors) {
-    gLogIOstream <<
+  if (gMsrOptions ()->fTraceMsrVisitors) {
+    gLogIOstream () <<
       "% <== msrSegment::browseData ()" <<
       endl;
   }
@@ -17050,7 +17038,7 @@ void msrSegment::print (ostream& os)
       fSegmentMeasuresList.size (), "measure", "measures") <<
     endl;
 
-  gIndenter++;
+  gIndenter ()++;
 
   const int fieldWidth = 20;
   
@@ -17080,7 +17068,7 @@ void msrSegment::print (ostream& os)
     } // for
   }
     
-  gIndenter--;
+  gIndenter ()--;
 }
 
 ostream& operator<< (ostream& os, const S_msrSegment& elt)
@@ -17131,8 +17119,8 @@ void msrRepeatCommonPart::appendElementToRepeatCommonPart (
   S_msrElement elem)
 {
 #ifdef TRACE_OPTIONS
-  if (gTraceOptions->fTraceVoices) {
-    gLogIOstream <<
+  if (gTraceOptions ()->fTraceVoices) {
+    gLogIOstream () <<
       "Appending element '" << elem <<
       "' to repeat common part '" << asString () << "'" <<
       endl;
@@ -17215,7 +17203,7 @@ S_msrNote msrRepeatCommonPart::fetchRepeatCommonPartFirstNonGraceNote () const
           "'";
           
         msrInternalError (
-          gXml2lyOptions->fInputSourceName,
+          gXml2lyOptions ()->fInputSourceName,
           fInputLineNumber,
           __FILE__, __LINE__,
           s.str ());
@@ -17230,8 +17218,8 @@ S_msrNote msrRepeatCommonPart::fetchRepeatCommonPartFirstNonGraceNote () const
 
 void msrRepeatCommonPart::acceptIn (basevisitor* v)
 {
-  if (gMsrOptions->fTraceMsrVisitors) {
-    gLogIOstream <<
+  if (gMsrOptions ()->fTraceMsrVisitors) {
+    gLogIOstream () <<
       "% ==> msrRepeatCommonPart::acceptIn ()" <<
       endl;
   }
@@ -17241,8 +17229,8 @@ void msrRepeatCommonPart::acceptIn (basevisitor* v)
       dynamic_cast<visitor<S_msrRepeatCommonPart>*> (v)) {
         S_msrRepeatCommonPart elem = this;
         
-        if (gMsrOptions->fTraceMsrVisitors) {
-          gLogIOstream <<
+        if (gMsrOptions ()->fTraceMsrVisitors) {
+          gLogIOstream () <<
             "% ==> Launching msrRepeatCommonPart::visitStart ()" <<
             endl;
         }
@@ -17252,8 +17240,8 @@ void msrRepeatCommonPart::acceptIn (basevisitor* v)
 
 void msrRepeatCommonPart::acceptOut (basevisitor* v)
 {
-  if (gMsrOptions->fTraceMsrVisitors) {
-    gLogIOstream <<
+  if (gMsrOptions ()->fTraceMsrVisitors) {
+    gLogIOstream () <<
       "% ==> msrRepeatCommonPart::acceptOut ()" <<
       endl;
   }
@@ -17263,8 +17251,8 @@ void msrRepeatCommonPart::acceptOut (basevisitor* v)
       dynamic_cast<visitor<S_msrRepeatCommonPart>*> (v)) {
         S_msrRepeatCommonPart elem = this;
       
-        if (gMsrOptions->fTraceMsrVisitors) {
-          gLogIOstream <<
+        if (gMsrOptions ()->fTraceMsrVisitors) {
+          gLogIOstream () <<
             "% ==> Launching msrRepeatCommonPart::visitEnd ()" <<
             endl;
         }
@@ -17310,7 +17298,7 @@ void msrRepeatCommonPart::print (ostream& os)
     ", line " << fInputLineNumber <<
     endl;
  
-  gIndenter++;
+  gIndenter ()++;
 
   os <<
     "Repeat uplink: '" <<
@@ -17337,7 +17325,7 @@ void msrRepeatCommonPart::print (ostream& os)
     endl;
     
   if (elementsNumber) {
-    gIndenter++;
+    gIndenter ()++;
 
     list<S_msrElement>::const_iterator
       iBegin = fRepeatCommonPartElementsList.begin (),
@@ -17351,10 +17339,10 @@ void msrRepeatCommonPart::print (ostream& os)
       os << endl;
     } // for
 
-    gIndenter--;
+    gIndenter ()--;
   }
   
-  gIndenter--;
+  gIndenter ()--;
 }
 
 ostream& operator<< (ostream& os, const S_msrRepeatCommonPart& elt)
@@ -17416,8 +17404,8 @@ void msrRepeatEnding::appendElementToRepeatEnding (
 
 void msrRepeatEnding::acceptIn (basevisitor* v)
 {
-  if (gMsrOptions->fTraceMsrVisitors) {
-    gLogIOstream <<
+  if (gMsrOptions ()->fTraceMsrVisitors) {
+    gLogIOstream () <<
       "% ==> msrRepeatEnding::acceptIn ()" <<
       endl;
   }
@@ -17427,8 +17415,8 @@ void msrRepeatEnding::acceptIn (basevisitor* v)
       dynamic_cast<visitor<S_msrRepeatEnding>*> (v)) {
         S_msrRepeatEnding elem = this;
         
-        if (gMsrOptions->fTraceMsrVisitors) {
-          gLogIOstream <<
+        if (gMsrOptions ()->fTraceMsrVisitors) {
+          gLogIOstream () <<
             "% ==> Launching msrRepeatEnding::visitStart ()" <<
             endl;
         }
@@ -17438,8 +17426,8 @@ void msrRepeatEnding::acceptIn (basevisitor* v)
 
 void msrRepeatEnding::acceptOut (basevisitor* v)
 {
-  if (gMsrOptions->fTraceMsrVisitors) {
-    gLogIOstream <<
+  if (gMsrOptions ()->fTraceMsrVisitors) {
+    gLogIOstream () <<
       "% ==> msrRepeatEnding::acceptOut ()" <<
       endl;
   }
@@ -17449,8 +17437,8 @@ void msrRepeatEnding::acceptOut (basevisitor* v)
       dynamic_cast<visitor<S_msrRepeatEnding>*> (v)) {
         S_msrRepeatEnding elem = this;
       
-        if (gMsrOptions->fTraceMsrVisitors) {
-          gLogIOstream <<
+        if (gMsrOptions ()->fTraceMsrVisitors) {
+          gLogIOstream () <<
             "% ==> Launching msrRepeatEnding::visitEnd ()" <<
             endl;
         }
@@ -17510,7 +17498,7 @@ void msrRepeatEnding::print (ostream& os)
     ", line " << fInputLineNumber <<
     endl;
 
-  gIndenter++;
+  gIndenter ()++;
 
   const int fieldWidth = 27;
 
@@ -17537,12 +17525,12 @@ void msrRepeatEnding::print (ostream& os)
   os <<
     "RepeatEndingSegment:" <<
     endl;
-  gIndenter++;
+  gIndenter ()++;
   os <<
     fRepeatEndingSegment;
-  gIndenter--;
+  gIndenter ()--;
   
-  gIndenter--;
+  gIndenter ()--;
 }
 
 ostream& operator<< (ostream& os, const S_msrRepeatEnding& elt)
@@ -17596,8 +17584,8 @@ void msrRepeat::setRepeatCommonPart (
     "repeatCommonPart is null");
     
 #ifdef TRACE_OPTIONS
-  if (gTraceOptions->fTraceRepeats) {
-    gLogIOstream <<
+  if (gTraceOptions ()->fTraceRepeats) {
+    gLogIOstream () <<
       "Setting repeat common part containing " <<
       singularOrPlural (
         repeatCommonPart->
@@ -17615,8 +17603,8 @@ void msrRepeat::setRepeatCommonSegment (
   S_msrSegment repeatCommonSegment)
 {
 #ifdef TRACE_OPTIONS
-  if (gTraceOptions->fTraceRepeats) {
-    gLogIOstream <<
+  if (gTraceOptions ()->fTraceRepeats) {
+    gLogIOstream () <<
       "Setting repeat common segment containing " <<
       singularOrPlural (
         repeatCommonSegment->
@@ -17645,8 +17633,8 @@ void msrRepeat::addRepeatEnding (
     "repeatEnding is null");
     
 #ifdef TRACE_OPTIONS
-  if (gTraceOptions->fTraceRepeats) {
-    gLogIOstream <<
+  if (gTraceOptions ()->fTraceRepeats) {
+    gLogIOstream () <<
       "Adding ending '" <<
       repeatEnding->asString () <<
       "' to repeat" <<
@@ -17676,8 +17664,8 @@ S_msrNote msrRepeat::fetchRepeatFirstNonGraceNote () const
 
 void msrRepeat::acceptIn (basevisitor* v)
 {
-  if (gMsrOptions->fTraceMsrVisitors) {
-    gLogIOstream <<
+  if (gMsrOptions ()->fTraceMsrVisitors) {
+    gLogIOstream () <<
       "% ==> msrRepeat::acceptIn ()" <<
       endl;
   }
@@ -17687,8 +17675,8 @@ void msrRepeat::acceptIn (basevisitor* v)
       dynamic_cast<visitor<S_msrRepeat>*> (v)) {
         S_msrRepeat elem = this;
         
-        if (gMsrOptions->fTraceMsrVisitors) {
-          gLogIOstream <<
+        if (gMsrOptions ()->fTraceMsrVisitors) {
+          gLogIOstream () <<
             "% ==> Launching msrRepeat::visitStart ()" <<
             endl;
         }
@@ -17698,8 +17686,8 @@ void msrRepeat::acceptIn (basevisitor* v)
 
 void msrRepeat::acceptOut (basevisitor* v)
 {
-  if (gMsrOptions->fTraceMsrVisitors) {
-    gLogIOstream <<
+  if (gMsrOptions ()->fTraceMsrVisitors) {
+    gLogIOstream () <<
       "% ==> msrRepeat::acceptOut ()" <<
       endl;
   }
@@ -17709,8 +17697,8 @@ void msrRepeat::acceptOut (basevisitor* v)
       dynamic_cast<visitor<S_msrRepeat>*> (v)) {
         S_msrRepeat elem = this;
       
-        if (gMsrOptions->fTraceMsrVisitors) {
-          gLogIOstream <<
+        if (gMsrOptions ()->fTraceMsrVisitors) {
+          gLogIOstream () <<
             "% ==> Launching msrRepeat::visitEnd ()" <<
             endl;
         }
@@ -17765,7 +17753,7 @@ void msrRepeat::print (ostream& os)
     ", line " << fInputLineNumber <<
     endl;
   
-  gIndenter++;
+  gIndenter ()++;
   
   // print the repeat common part
   if (! fRepeatCommonPart) {
@@ -17795,7 +17783,7 @@ void msrRepeat::print (ostream& os)
     endl;
     
   if (endingsNumber) {
-    gIndenter++;
+    gIndenter ()++;
     
     vector<S_msrRepeatEnding>::const_iterator
       iBegin = fRepeatEndings.begin (),
@@ -17809,12 +17797,12 @@ void msrRepeat::print (ostream& os)
   // JMI    os << endl;
     } // for
 
-    gIndenter--;
+    gIndenter ()--;
   }
 
  // JMI os << endl;
       
-  gIndenter--;
+  gIndenter ()--;
 }
 
 ostream& operator<< (ostream& os, const S_msrRepeat& elt)
@@ -17856,8 +17844,8 @@ void msrMeasuresRepeatPattern::setMeasuresRepeatPatternSegment (
     S_msrSegment measuresRepeatPatternSegment)
 {
 #ifdef TRACE_OPTIONS
-  if (gTraceOptions->fTraceRepeats) {
-    gLogIOstream <<
+  if (gTraceOptions ()->fTraceRepeats) {
+    gLogIOstream () <<
       "Setting measure repeat pattern segment containing " <<
       singularOrPlural (
           measuresRepeatPatternMeasuresNumber (),
@@ -17894,8 +17882,8 @@ int msrMeasuresRepeatPattern::measuresRepeatPatternMeasuresNumber () const
 
 void msrMeasuresRepeatPattern::acceptIn (basevisitor* v)
 {
-  if (gMsrOptions->fTraceMsrVisitors) {
-    gLogIOstream <<
+  if (gMsrOptions ()->fTraceMsrVisitors) {
+    gLogIOstream () <<
       "% ==> msrMeasuresRepeatPattern::acceptIn ()" <<
       endl;
   }
@@ -17905,8 +17893,8 @@ void msrMeasuresRepeatPattern::acceptIn (basevisitor* v)
       dynamic_cast<visitor<S_msrMeasuresRepeatPattern>*> (v)) {
         S_msrMeasuresRepeatPattern elem = this;
         
-        if (gMsrOptions->fTraceMsrVisitors) {
-          gLogIOstream <<
+        if (gMsrOptions ()->fTraceMsrVisitors) {
+          gLogIOstream () <<
             "% ==> Launching msrMeasuresRepeatPattern::visitStart ()" <<
             endl;
         }
@@ -17916,8 +17904,8 @@ void msrMeasuresRepeatPattern::acceptIn (basevisitor* v)
 
 void msrMeasuresRepeatPattern::acceptOut (basevisitor* v)
 {
-  if (gMsrOptions->fTraceMsrVisitors) {
-    gLogIOstream <<
+  if (gMsrOptions ()->fTraceMsrVisitors) {
+    gLogIOstream () <<
       "% ==> msrMeasuresRepeatPattern::acceptOut ()" <<
       endl;
   }
@@ -17927,8 +17915,8 @@ void msrMeasuresRepeatPattern::acceptOut (basevisitor* v)
       dynamic_cast<visitor<S_msrMeasuresRepeatPattern>*> (v)) {
         S_msrMeasuresRepeatPattern elem = this;
       
-        if (gMsrOptions->fTraceMsrVisitors) {
-          gLogIOstream <<
+        if (gMsrOptions ()->fTraceMsrVisitors) {
+          gLogIOstream () <<
             "% ==> Launching msrMeasuresRepeatPattern::visitEnd ()" <<
             endl;
         }
@@ -17938,8 +17926,8 @@ void msrMeasuresRepeatPattern::acceptOut (basevisitor* v)
 
 void msrMeasuresRepeatPattern::browseData (basevisitor* v)
 {
-  if (gMsrOptions->fTraceMsrVisitors) {
-    gLogIOstream <<
+  if (gMsrOptions ()->fTraceMsrVisitors) {
+    gLogIOstream () <<
       "% ==> msrMeasuresRepeatPattern::browseData ()" <<
       endl;
   }
@@ -17977,7 +17965,7 @@ void msrMeasuresRepeatPattern::print (ostream& os)
     endl <<
     endl;
   
-  gIndenter++;
+  gIndenter ()++;
   
   // print the pattern segment
   os <<
@@ -17992,15 +17980,15 @@ void msrMeasuresRepeatPattern::print (ostream& os)
     os <<
       endl;
       
-    gIndenter++;
+    gIndenter ()++;
     
     os <<
       fMeasuresRepeatPatternSegment;
 
-    gIndenter--;
+    gIndenter ()--;
   }
       
-  gIndenter--;
+  gIndenter ()--;
 }
 
 ostream& operator<< (ostream& os, const S_msrMeasuresRepeatPattern& elt)
@@ -18042,8 +18030,8 @@ void msrMeasuresRepeatReplicas::setMeasuresRepeatReplicasSegment (
     S_msrSegment measuresRepeatReplicasSegment)
 {
 #ifdef TRACE_OPTIONS
-  if (gTraceOptions->fTraceRepeats) {
-    gLogIOstream <<
+  if (gTraceOptions ()->fTraceRepeats) {
+    gLogIOstream () <<
       "Setting measure repeat replicas segment containing " <<
       singularOrPlural (
           measuresRepeatReplicasMeasuresNumber (),
@@ -18080,8 +18068,8 @@ int msrMeasuresRepeatReplicas::measuresRepeatReplicasMeasuresNumber () const
 
 void msrMeasuresRepeatReplicas::acceptIn (basevisitor* v)
 {
-  if (gMsrOptions->fTraceMsrVisitors) {
-    gLogIOstream <<
+  if (gMsrOptions ()->fTraceMsrVisitors) {
+    gLogIOstream () <<
       "% ==> msrMeasuresRepeatReplicas::acceptIn ()" <<
       endl;
   }
@@ -18091,8 +18079,8 @@ void msrMeasuresRepeatReplicas::acceptIn (basevisitor* v)
       dynamic_cast<visitor<S_msrMeasuresRepeatReplicas>*> (v)) {
         S_msrMeasuresRepeatReplicas elem = this;
         
-        if (gMsrOptions->fTraceMsrVisitors) {
-          gLogIOstream <<
+        if (gMsrOptions ()->fTraceMsrVisitors) {
+          gLogIOstream () <<
             "% ==> Launching msrMeasuresRepeatReplicas::visitStart ()" <<
             endl;
         }
@@ -18102,8 +18090,8 @@ void msrMeasuresRepeatReplicas::acceptIn (basevisitor* v)
 
 void msrMeasuresRepeatReplicas::acceptOut (basevisitor* v)
 {
-  if (gMsrOptions->fTraceMsrVisitors) {
-    gLogIOstream <<
+  if (gMsrOptions ()->fTraceMsrVisitors) {
+    gLogIOstream () <<
       "% ==> msrMeasuresRepeatReplicas::acceptOut ()" <<
       endl;
   }
@@ -18113,8 +18101,8 @@ void msrMeasuresRepeatReplicas::acceptOut (basevisitor* v)
       dynamic_cast<visitor<S_msrMeasuresRepeatReplicas>*> (v)) {
         S_msrMeasuresRepeatReplicas elem = this;
       
-        if (gMsrOptions->fTraceMsrVisitors) {
-          gLogIOstream <<
+        if (gMsrOptions ()->fTraceMsrVisitors) {
+          gLogIOstream () <<
             "% ==> Launching msrMeasuresRepeatReplicas::visitEnd ()" <<
             endl;
         }
@@ -18124,8 +18112,8 @@ void msrMeasuresRepeatReplicas::acceptOut (basevisitor* v)
 
 void msrMeasuresRepeatReplicas::browseData (basevisitor* v)
 {
-  if (gMsrOptions->fTraceMsrVisitors) {
-    gLogIOstream <<
+  if (gMsrOptions ()->fTraceMsrVisitors) {
+    gLogIOstream () <<
       "% ==> msrMeasuresRepeatReplicas::browseData ()" <<
       endl;
   }
@@ -18163,7 +18151,7 @@ void msrMeasuresRepeatReplicas::print (ostream& os)
     endl <<
     endl;
   
-  gIndenter++;
+  gIndenter ()++;
   
   // print the replicas segment
   os <<
@@ -18178,15 +18166,15 @@ void msrMeasuresRepeatReplicas::print (ostream& os)
     os <<
       endl;
       
-    gIndenter++;
+    gIndenter ()++;
     
     os <<
       fMeasuresRepeatReplicasSegment;
 
-    gIndenter--;
+    gIndenter ()--;
   }
 
-  gIndenter--;
+  gIndenter ()--;
 }
 
 ostream& operator<< (ostream& os, const S_msrMeasuresRepeatReplicas& elt)
@@ -18243,8 +18231,8 @@ void msrMeasuresRepeat::setMeasuresRepeatPattern (
   S_msrMeasuresRepeatPattern measuresRepeatPattern)
 {
 #ifdef TRACE_OPTIONS
-  if (gTraceOptions->fTraceRepeats) {
-    gLogIOstream <<
+  if (gTraceOptions ()->fTraceRepeats) {
+    gLogIOstream () <<
       "Setting measure repeat pattern containing " <<
       singularOrPlural (
         measuresRepeatPattern->
@@ -18267,8 +18255,8 @@ void msrMeasuresRepeat::setMeasuresRepeatReplicas (
   S_msrMeasuresRepeatReplicas measuresRepeatReplicas)
 {
 #ifdef TRACE_OPTIONS
-  if (gTraceOptions->fTraceRepeats) {
-    gLogIOstream <<
+  if (gTraceOptions ()->fTraceRepeats) {
+    gLogIOstream () <<
       "Setting measure repeat replicas containing " <<
       singularOrPlural (
         measuresRepeatReplicas->
@@ -18305,8 +18293,8 @@ int msrMeasuresRepeat::measuresRepeatReplicasNumber () const
 
 void msrMeasuresRepeat::acceptIn (basevisitor* v)
 {
-  if (gMsrOptions->fTraceMsrVisitors) {
-    gLogIOstream <<
+  if (gMsrOptions ()->fTraceMsrVisitors) {
+    gLogIOstream () <<
       "% ==> msrMeasuresRepeat::acceptIn ()" <<
       endl;
   }
@@ -18316,8 +18304,8 @@ void msrMeasuresRepeat::acceptIn (basevisitor* v)
       dynamic_cast<visitor<S_msrMeasuresRepeat>*> (v)) {
         S_msrMeasuresRepeat elem = this;
         
-        if (gMsrOptions->fTraceMsrVisitors) {
-          gLogIOstream <<
+        if (gMsrOptions ()->fTraceMsrVisitors) {
+          gLogIOstream () <<
             "% ==> Launching msrMeasuresRepeat::visitStart ()" <<
             endl;
         }
@@ -18327,8 +18315,8 @@ void msrMeasuresRepeat::acceptIn (basevisitor* v)
 
 void msrMeasuresRepeat::acceptOut (basevisitor* v)
 {
-  if (gMsrOptions->fTraceMsrVisitors) {
-    gLogIOstream <<
+  if (gMsrOptions ()->fTraceMsrVisitors) {
+    gLogIOstream () <<
       "% ==> msrMeasuresRepeat::acceptOut ()" <<
       endl;
   }
@@ -18338,8 +18326,8 @@ void msrMeasuresRepeat::acceptOut (basevisitor* v)
       dynamic_cast<visitor<S_msrMeasuresRepeat>*> (v)) {
         S_msrMeasuresRepeat elem = this;
       
-        if (gMsrOptions->fTraceMsrVisitors) {
-          gLogIOstream <<
+        if (gMsrOptions ()->fTraceMsrVisitors) {
+          gLogIOstream () <<
             "% ==> Launching msrMeasuresRepeat::visitEnd ()" <<
             endl;
         }
@@ -18349,8 +18337,8 @@ void msrMeasuresRepeat::acceptOut (basevisitor* v)
 
 void msrMeasuresRepeat::browseData (basevisitor* v)
 {
-  if (gMsrOptions->fTraceMsrVisitors) {
-    gLogIOstream <<
+  if (gMsrOptions ()->fTraceMsrVisitors) {
+    gLogIOstream () <<
       "% ==> msrMeasuresRepeat::browseData ()" <<
       endl;
   }
@@ -18374,13 +18362,13 @@ void msrMeasuresRepeat::browseData (basevisitor* v)
 
   if (inhibitMeasuresRepeatReplicasBrowsing) {
     if (
-      gMsrOptions->fTraceMsrVisitors
+      gMsrOptions ()->fTraceMsrVisitors
 #ifdef TRACE_OPTIONS
         ||
-      gTraceOptions->fTraceRepeats
+      gTraceOptions ()->fTraceRepeats
 #endif
     ) {
-      gLogIOstream <<
+      gLogIOstream () <<
         "% ==> visiting measure repeat replicas is inhibited" <<
         endl;
     }
@@ -18441,7 +18429,7 @@ void msrMeasuresRepeat::print (ostream& os)
     ")" <<
     endl;
   
-  gIndenter++;
+  gIndenter ()++;
   
   // print the measure repeat pattern
   if (! fMeasuresRepeatPattern) {
@@ -18468,7 +18456,7 @@ void msrMeasuresRepeat::print (ostream& os)
       fMeasuresRepeatReplicas;
   }
       
-  gIndenter--;
+  gIndenter ()--;
 }
 
 ostream& operator<< (ostream& os, const S_msrMeasuresRepeat& elt)
@@ -18505,8 +18493,8 @@ S_msrMultipleRestContents msrMultipleRestContents::createMultipleRestContentsNew
   S_msrVoice containingVoice)
 {
 #ifdef TRACE_OPTIONS
-  if (gTraceOptions->fTraceRepeats) {
-    gLogIOstream <<
+  if (gTraceOptions ()->fTraceRepeats) {
+    gLogIOstream () <<
       "Creating a newborn clone of a multiple rest contents" <<
       endl;
   }
@@ -18530,8 +18518,8 @@ void msrMultipleRestContents::setMultipleRestContentsSegment (
     S_msrSegment multipleRestContentsSegment)
 {
 #ifdef TRACE_OPTIONS
-  if (gTraceOptions->fTraceRepeats) {
-    gLogIOstream <<
+  if (gTraceOptions ()->fTraceRepeats) {
+    gLogIOstream () <<
       "Setting multiple rest contents segment containing " <<
       singularOrPlural (
           multipleRestContentsMeasuresNumber (),
@@ -18568,8 +18556,8 @@ int msrMultipleRestContents::multipleRestContentsMeasuresNumber () const
 
 void msrMultipleRestContents::acceptIn (basevisitor* v)
 {
-  if (gMsrOptions->fTraceMsrVisitors) {
-    gLogIOstream <<
+  if (gMsrOptions ()->fTraceMsrVisitors) {
+    gLogIOstream () <<
       "% ==> msrMultipleRestContents::acceptIn ()" <<
       endl;
   }
@@ -18579,8 +18567,8 @@ void msrMultipleRestContents::acceptIn (basevisitor* v)
       dynamic_cast<visitor<S_msrMultipleRestContents>*> (v)) {
         S_msrMultipleRestContents elem = this;
         
-        if (gMsrOptions->fTraceMsrVisitors) {
-          gLogIOstream <<
+        if (gMsrOptions ()->fTraceMsrVisitors) {
+          gLogIOstream () <<
             "% ==> Launching msrMultipleRestContents::visitStart ()" <<
             endl;
         }
@@ -18590,8 +18578,8 @@ void msrMultipleRestContents::acceptIn (basevisitor* v)
 
 void msrMultipleRestContents::acceptOut (basevisitor* v)
 {
-  if (gMsrOptions->fTraceMsrVisitors) {
-    gLogIOstream <<
+  if (gMsrOptions ()->fTraceMsrVisitors) {
+    gLogIOstream () <<
       "% ==> msrMultipleRestContents::acceptOut ()" <<
       endl;
   }
@@ -18601,8 +18589,8 @@ void msrMultipleRestContents::acceptOut (basevisitor* v)
       dynamic_cast<visitor<S_msrMultipleRestContents>*> (v)) {
         S_msrMultipleRestContents elem = this;
       
-        if (gMsrOptions->fTraceMsrVisitors) {
-          gLogIOstream <<
+        if (gMsrOptions ()->fTraceMsrVisitors) {
+          gLogIOstream () <<
             "% ==> Launching msrMultipleRestContents::visitEnd ()" <<
             endl;
         }
@@ -18612,8 +18600,8 @@ void msrMultipleRestContents::acceptOut (basevisitor* v)
 
 void msrMultipleRestContents::browseData (basevisitor* v)
 {
-  if (gMsrOptions->fTraceMsrVisitors) {
-    gLogIOstream <<
+  if (gMsrOptions ()->fTraceMsrVisitors) {
+    gLogIOstream () <<
       "% ==> msrMultipleRestContents::browseData ()" <<
       endl;
   }
@@ -18651,7 +18639,7 @@ void msrMultipleRestContents::print (ostream& os)
     endl <<
     endl;
   
-  gIndenter++;
+  gIndenter ()++;
   
   // print the pattern segment
   os <<
@@ -18666,15 +18654,15 @@ void msrMultipleRestContents::print (ostream& os)
     os <<
       endl;
       
-    gIndenter++;
+    gIndenter ()++;
     
     os <<
       fMultipleRestContentsSegment;
 
-    gIndenter--;
+    gIndenter ()--;
   }
       
-  gIndenter--;
+  gIndenter ()--;
 }
 
 ostream& operator<< (ostream& os, const S_msrMultipleRestContents& elt)
@@ -18720,8 +18708,8 @@ S_msrMultipleRest msrMultipleRest::createMultipleRestNewbornClone (
   S_msrVoice containingVoice)
 {
 #ifdef TRACE_OPTIONS
-  if (gTraceOptions->fTraceRepeats) {
-    gLogIOstream <<
+  if (gTraceOptions ()->fTraceRepeats) {
+    gLogIOstream () <<
       "Creating a newborn clone of multiple rest " <<
       asString () <<
       endl;
@@ -18751,8 +18739,8 @@ void msrMultipleRest::setMultipleRestContents (
   S_msrMultipleRestContents multipleRestContents)
 {
 #ifdef TRACE_OPTIONS
-  if (gTraceOptions->fTraceRepeats) {
-    gLogIOstream <<
+  if (gTraceOptions ()->fTraceRepeats) {
+    gLogIOstream () <<
       "Setting multiple rest segment containing " <<
       singularOrPlural (
         multipleRestContents->
@@ -18775,8 +18763,8 @@ void msrMultipleRest::setMultipleRestNextMeasureNumber (
   string measureNumber)
 {
 #ifdef TRACE_OPTIONS
-  if (gTraceOptions->fTraceRepeats) {
-    gLogIOstream <<
+  if (gTraceOptions ()->fTraceRepeats) {
+    gLogIOstream () <<
       "Setting multiple rest next measure number to'" <<
       "' " <<
       measureNumber <<
@@ -18790,8 +18778,8 @@ void msrMultipleRest::setMultipleRestNextMeasureNumber (
 
 void msrMultipleRest::acceptIn (basevisitor* v)
 {
-  if (gMsrOptions->fTraceMsrVisitors) {
-    gLogIOstream <<
+  if (gMsrOptions ()->fTraceMsrVisitors) {
+    gLogIOstream () <<
       "% ==> msrMultipleRest::acceptIn ()" <<
       endl;
   }
@@ -18801,8 +18789,8 @@ void msrMultipleRest::acceptIn (basevisitor* v)
       dynamic_cast<visitor<S_msrMultipleRest>*> (v)) {
         S_msrMultipleRest elem = this;
         
-        if (gMsrOptions->fTraceMsrVisitors) {
-          gLogIOstream <<
+        if (gMsrOptions ()->fTraceMsrVisitors) {
+          gLogIOstream () <<
             "% ==> Launching msrMultipleRest::visitStart ()" <<
             endl;
         }
@@ -18812,8 +18800,8 @@ void msrMultipleRest::acceptIn (basevisitor* v)
 
 void msrMultipleRest::acceptOut (basevisitor* v)
 {
-  if (gMsrOptions->fTraceMsrVisitors) {
-    gLogIOstream <<
+  if (gMsrOptions ()->fTraceMsrVisitors) {
+    gLogIOstream () <<
       "% ==> msrMultipleRest::acceptOut ()" <<
       endl;
   }
@@ -18823,8 +18811,8 @@ void msrMultipleRest::acceptOut (basevisitor* v)
       dynamic_cast<visitor<S_msrMultipleRest>*> (v)) {
         S_msrMultipleRest elem = this;
       
-        if (gMsrOptions->fTraceMsrVisitors) {
-          gLogIOstream <<
+        if (gMsrOptions ()->fTraceMsrVisitors) {
+          gLogIOstream () <<
             "% ==> Launching msrMultipleRest::visitEnd ()" <<
             endl;
         }
@@ -18834,8 +18822,8 @@ void msrMultipleRest::acceptOut (basevisitor* v)
 
 void msrMultipleRest::browseData (basevisitor* v)
 {
-  if (gMsrOptions->fTraceMsrVisitors) {
-    gLogIOstream <<
+  if (gMsrOptions ()->fTraceMsrVisitors) {
+    gLogIOstream () <<
       "% ==> msrMultipleRest::browseData ()" <<
       endl;
   }
@@ -18864,8 +18852,8 @@ void msrMultipleRest::browseData (basevisitor* v)
       getInhibitMultipleRestMeasuresBrowsing ();
 
   if (inhibitMultipleRestMeasuresBrowsing) {
-    if (gMsrOptions->fTraceMsrVisitors || gTraceOptions->fTraceRepeats) {
-      gLogIOstream <<
+    if (gMsrOptions ()->fTraceMsrVisitors || gTraceOptions ()->fTraceRepeats) {
+      gLogIOstream () <<
         "% ==> visiting multiple rest measures is inhibited" <<
         endl;
     }
@@ -18909,7 +18897,7 @@ void msrMultipleRest::print (ostream& os)
     ", line " << fInputLineNumber <<
     endl;
 
-  gIndenter++;
+  gIndenter ()++;
 
   const int fieldWidth = 33;
 
@@ -18950,7 +18938,7 @@ void msrMultipleRest::print (ostream& os)
       fMultipleRestContents;
   }
       
-  gIndenter--;
+  gIndenter ()--;
 }
 
 ostream& operator<< (ostream& os, const S_msrMultipleRest& elt)
@@ -19002,8 +18990,8 @@ S_msrRepeatCoda msrRepeatCoda::createRepeatCodaNewbornClone (
   S_msrRepeat containingRepeat)
 {
 #ifdef TRACE_OPTIONS
-  if (gTraceOptions->fTraceRepeats) {
-    gLogIOstream <<
+  if (gTraceOptions ()->fTraceRepeats) {
+    gLogIOstream () <<
       "Creating a newborn clone of a " <<
       asString () <<
       endl;
@@ -19037,8 +19025,8 @@ S_msrRepeatCoda msrRepeatCoda::createRepeatCodaDeepCopy (
   S_msrRepeat containingRepeat)
 {
 #ifdef TRACE_OPTIONS
-  if (gTraceOptions->fTraceRepeats) {
-    gLogIOstream <<
+  if (gTraceOptions ()->fTraceRepeats) {
+    gLogIOstream () <<
       "Creating a newborn clone of a " <<
       asString () <<
       endl;
@@ -19086,8 +19074,8 @@ void msrRepeatCoda::appendElementToRepeatCoda (
 
 void msrRepeatCoda::acceptIn (basevisitor* v)
 {
-  if (gMsrOptions->fTraceMsrVisitors) {
-    gLogIOstream <<
+  if (gMsrOptions ()->fTraceMsrVisitors) {
+    gLogIOstream () <<
       "% ==> msrRepeatCoda::acceptIn ()" <<
       endl;
   }
@@ -19097,8 +19085,8 @@ void msrRepeatCoda::acceptIn (basevisitor* v)
       dynamic_cast<visitor<S_msrRepeatCoda>*> (v)) {
         S_msrRepeatCoda elem = this;
         
-        if (gMsrOptions->fTraceMsrVisitors) {
-          gLogIOstream <<
+        if (gMsrOptions ()->fTraceMsrVisitors) {
+          gLogIOstream () <<
             "% ==> Launching msrRepeatCoda::visitStart ()" <<
             endl;
         }
@@ -19108,8 +19096,8 @@ void msrRepeatCoda::acceptIn (basevisitor* v)
 
 void msrRepeatCoda::acceptOut (basevisitor* v)
 {
-  if (gMsrOptions->fTraceMsrVisitors) {
-    gLogIOstream <<
+  if (gMsrOptions ()->fTraceMsrVisitors) {
+    gLogIOstream () <<
       "% ==> msrRepeatCoda::acceptOut ()" <<
       endl;
   }
@@ -19119,8 +19107,8 @@ void msrRepeatCoda::acceptOut (basevisitor* v)
       dynamic_cast<visitor<S_msrRepeatCoda>*> (v)) {
         S_msrRepeatCoda elem = this;
       
-        if (gMsrOptions->fTraceMsrVisitors) {
-          gLogIOstream <<
+        if (gMsrOptions ()->fTraceMsrVisitors) {
+          gLogIOstream () <<
             "% ==> Launching msrRepeatCoda::visitEnd ()" <<
             endl;
         }
@@ -19154,12 +19142,12 @@ void msrRepeatCoda::print (ostream& os)
     asString () <<
     endl;
  
-  gIndenter++;
+  gIndenter ()++;
 
   os <<
     fRepeatCodaSegment;
 
-  gIndenter--;
+  gIndenter ()--;
 }
 
 ostream& operator<< (ostream& os, const S_msrRepeatCoda& elt)
@@ -19169,9 +19157,6 @@ ostream& operator<< (ostream& os, const S_msrRepeatCoda& elt)
 }
 
 //______________________________________________________________________________ 
-// global variable
-int msrVoice::gVoicesCounter = 0;
-
 S_msrVoice msrVoice::create (
   int          inputLineNumber,
   msrVoiceKind voiceKind,
@@ -19235,8 +19220,8 @@ void msrVoice::setVoiceNameFromNumber (
   int voiceNumber)
 {
 #ifdef TRACE_OPTIONS
-  if (gTraceOptions->fTraceVoices) {
-    gLogIOstream <<
+  if (gTraceOptions ()->fTraceVoices) {
+    gLogIOstream () <<
       "Setting the name of '" <<
       voiceKindAsString () <<
       "' voice \"" <<
@@ -19273,7 +19258,7 @@ void msrVoice::setVoiceNameFromNumber (
           "' voice cannot get its name from its number";
 
         msrInternalError (
-          gXml2lyOptions->fInputSourceName,
+          gXml2lyOptions ()->fInputSourceName,
           inputLineNumber,
           __FILE__, __LINE__,
           s.str ());
@@ -19301,11 +19286,11 @@ void msrVoice::initializeVoice (
   // in registerVoiceInRegularVoicesMap ()
   fRegularVoiceStaffSequentialNumber = -1;
 
-  gIndenter++;
+  gIndenter ()++;
   
   // compute voice number
   int voiceNumber =
-    gMsrOptions->
+    gMsrOptions ()->
       fCreateVoicesStaffRelativeNumbers // JMI use it
         ? fRegularVoiceStaffSequentialNumber
         : fVoiceNumber;
@@ -19332,8 +19317,8 @@ void msrVoice::initializeVoice (
   } // switch
   
 #ifdef TRACE_OPTIONS
-  if (gTraceOptions->fTraceVoices) {
-    gLogIOstream <<
+  if (gTraceOptions ()->fTraceVoices) {
+    gLogIOstream () <<
       "Initializing voice \"" << fVoiceName <<
       "\" in staff \"" <<
       fVoiceStaffUplink->getStaffName () <<
@@ -19355,7 +19340,7 @@ void msrVoice::initializeVoice (
 
           /* JMI ???
         msrMusicXMLError (
-          gXml2lyOptions->fInputSourceName,
+          gXml2lyOptions ()->fInputSourceName,
           fInputLineNumber,
           __FILE__, __LINE__,
           s.str ());
@@ -19375,7 +19360,7 @@ void msrVoice::initializeVoice (
           " is not equal to " << K_PART_FIGURED_BASS_VOICE_NUMBER;
           
         msrInternalError (
-          gXml2lyOptions->fInputSourceName,
+          gXml2lyOptions ()->fInputSourceName,
           fInputLineNumber,
           __FILE__, __LINE__,
           s.str ());
@@ -19393,8 +19378,8 @@ void msrVoice::initializeVoice (
   switch (voiceCreateInitialLastSegmentKind) {
     case msrVoice::kCreateInitialLastSegmentYes:
 #ifdef TRACE_OPTIONS
-      if (gTraceOptions->fTraceVoices || gTraceOptions->fTraceSegments) {
-        gLogIOstream <<
+      if (gTraceOptions ()->fTraceVoices || gTraceOptions ()->fTraceSegments) {
+        gLogIOstream () <<
           "Creating an initial voice last segment for voice \"" <<
           fVoiceName <<
           "\" in staff \"" <<
@@ -19410,8 +19395,8 @@ void msrVoice::initializeVoice (
       
     case msrVoice::kCreateInitialLastSegmentNo:
 #ifdef TRACE_OPTIONS
-      if (gTraceOptions->fTraceVoices || gTraceOptions->fTraceSegments) {
-        gLogIOstream <<
+      if (gTraceOptions ()->fTraceVoices || gTraceOptions ()->fTraceSegments) {
+        gLogIOstream () <<
           "NO initial voice last segment is created for voice \"" <<
           fVoiceName <<
           "\" in staff \"" <<
@@ -19438,6 +19423,7 @@ void msrVoice::initializeVoice (
   fVoiceActualHarmoniesCounter = 0;
 
   // multiple rests
+  fVoiceContainsMultipleRests = false;
   fVoiceRemainingRestMeasures = 0;
 
   // get the initial staff details from the staff if any
@@ -19453,31 +19439,31 @@ void msrVoice::initializeVoice (
   }
 
 #ifdef TRACE_OPTIONS
-  if (gTraceOptions->fTraceVoices) {
-    gLogIOstream <<
+  if (gTraceOptions ()->fTraceVoices) {
+    gLogIOstream () <<
       "Initial contents of voice \"" << fVoiceName <<
       "\" in staff \"" <<
       fVoiceStaffUplink->getStaffName () <<
       "\":" <<
       endl;
 
-    gIndenter++;
+    gIndenter ()++;
 
-    this->print (gLogIOstream);
+    this->print (gLogIOstream ());
 
-    gIndenter--;
+    gIndenter ()--;
   }
 #endif
 
-  gIndenter--;
+  gIndenter ()--;
 }
 
 void msrVoice::changeVoiceIdentity ( // after a deep copy
   int voiceNumber)
 {
 #ifdef TRACE_OPTIONS
-  if (gTraceOptions->fTraceVoices) {
-    gLogIOstream <<
+  if (gTraceOptions ()->fTraceVoices) {
+    gLogIOstream () <<
       "Changing identity of voice \"" <<
       getVoiceName () <<
       "\"" <<
@@ -19504,8 +19490,8 @@ S_msrVoice msrVoice::createVoiceNewbornClone (
   S_msrStaff staffClone)
 {
 #ifdef TRACE_OPTIONS
-  if (gTraceOptions->fTraceVoices) {
-    gLogIOstream <<
+  if (gTraceOptions ()->fTraceVoices) {
+    gLogIOstream () <<
       "Creating a newborn clone of voice \"" <<
       getVoiceName () <<
       "\"" <<
@@ -19581,8 +19567,8 @@ S_msrVoice msrVoice::createVoiceDeepCopy (
   S_msrStaff   containingStaff)
 {
 #ifdef TRACE_OPTIONS
-  if (gTraceOptions->fTraceVoices) {
-    gLogIOstream <<
+  if (gTraceOptions ()->fTraceVoices) {
+    gLogIOstream () <<
       "Creating a deep copy of voice \"" <<
       getVoiceName () <<
       "\"" <<
@@ -19599,15 +19585,15 @@ S_msrVoice msrVoice::createVoiceDeepCopy (
     "containingStaff is null");
     
 #ifdef TRACE_OPTIONS
-  if (gTraceOptions->fTraceVoicesDetails) {
-    gLogIOstream <<
+  if (gTraceOptions ()->fTraceVoicesDetails) {
+    gLogIOstream () <<
       "****" <<
       " BEFORE voiceDeepCopy = " <<
       endl;
   
-    print (gLogIOstream);
+    print (gLogIOstream ());
     
-    gLogIOstream <<
+    gLogIOstream () <<
       endl <<
       "****" <<
       endl;
@@ -19670,8 +19656,8 @@ S_msrVoice msrVoice::createVoiceDeepCopy (
     
   if (numberOfInitialElements) {
 #ifdef TRACE_OPTIONS
-    if (gTraceOptions->fTraceVoices) {
-      gLogIOstream <<
+    if (gTraceOptions ()->fTraceVoices) {
+      gLogIOstream () <<
         "There are " <<
         numberOfInitialElements <<
         " initial elements in voice \"" <<
@@ -19720,7 +19706,7 @@ S_msrVoice msrVoice::createVoiceDeepCopy (
           "\" initial elements element should be a repeat or a segment";
 
         msrInternalError (
-          gXml2lyOptions->fInputSourceName,
+          gXml2lyOptions ()->fInputSourceName,
           fInputLineNumber,
           __FILE__, __LINE__,
           s.str ());
@@ -19737,8 +19723,8 @@ S_msrVoice msrVoice::createVoiceDeepCopy (
 
   else {    
 #ifdef TRACE_OPTIONS
-    if (gTraceOptions->fTraceVoices) {
-      gLogIOstream <<
+    if (gTraceOptions ()->fTraceVoices) {
+      gLogIOstream () <<
         "There are no initial elements in voice \"" <<
         getVoiceName () <<
         "\" to be deep copied" <<
@@ -19761,8 +19747,8 @@ S_msrVoice msrVoice::createVoiceDeepCopy (
   }
   else {    
 #ifdef TRACE_OPTIONS
-    if (gTraceOptions->fTraceVoices) {
-      gLogIOstream <<
+    if (gTraceOptions ()->fTraceVoices) {
+      gLogIOstream () <<
         "There is no last segment in voice \"" <<
         getVoiceName () <<
         "\" to be deep copied" <<
@@ -19793,8 +19779,8 @@ S_msrVoice msrVoice::createVoiceDeepCopy (
     containingStaff;
 
 #ifdef TRACE_OPTIONS
-  if (gTraceOptions->fTraceVoicesDetails) {
-    gLogIOstream <<
+  if (gTraceOptions ()->fTraceVoicesDetails) {
+    gLogIOstream () <<
       "****" <<
       " AFTER voiceDeepCopy = " <<
       endl <<
@@ -19823,8 +19809,8 @@ void msrVoice::createMeasureAndAppendItToVoice (
   fVoiceCurrentMeasureNumber = measureNumber;
 
 #ifdef TRACE_OPTIONS
-  if (gTraceOptions->fTraceMeasures || gTraceOptions->fTraceVoices) {
-    gLogIOstream <<
+  if (gTraceOptions ()->fTraceMeasures || gTraceOptions ()->fTraceVoices) {
+    gLogIOstream () <<
       "Creating measure '" <<
       measureNumber <<
       "' and appending it to voice \"" << getVoiceName () << "\"" <<
@@ -19833,7 +19819,7 @@ void msrVoice::createMeasureAndAppendItToVoice (
   }
 #endif
 
-  gIndenter++;
+  gIndenter ()++;
   
   if (! fVoiceLastSegment) {
     // create the voice last segment if not yet done // JMI
@@ -19878,7 +19864,7 @@ void msrVoice::createMeasureAndAppendItToVoice (
       break;
   } // switch
 
-  gIndenter--;
+  gIndenter ()--;
 }
 
 void msrVoice::setNextMeasureNumberInVoice (
@@ -19886,8 +19872,8 @@ void msrVoice::setNextMeasureNumberInVoice (
   string nextMeasureNumber)
 {
 #ifdef TRACE_OPTIONS
-  if (gTraceOptions->fTraceMeasures || gTraceOptions->fTraceVoices) {
-    gLogIOstream <<
+  if (gTraceOptions ()->fTraceMeasures || gTraceOptions ()->fTraceVoices) {
+    gLogIOstream () <<
       "Setting next measure number to '" <<
       nextMeasureNumber <<
       ", in voice \"" << getVoiceName () << "\"" <<
@@ -19896,7 +19882,7 @@ void msrVoice::setNextMeasureNumberInVoice (
   }
 #endif
 
-  gIndenter++;
+  gIndenter ()++;
   
   fVoiceLastSegment->
     setNextMeasureNumberInSegment (
@@ -19907,8 +19893,8 @@ void msrVoice::setNextMeasureNumberInVoice (
   if (fVoiceMultipleRestWaitingForItsNextMeasureNumber) {      
     // yes
 #ifdef TRACE_OPTIONS
-    if (gTraceOptions->fTraceRepeats) {
-      gLogIOstream <<
+    if (gTraceOptions ()->fTraceRepeats) {
+      gLogIOstream () <<
         "There is a multiple rest waiting for its next measure number" <<
         ", fVoiceRemainingRestMeasures = " <<
         fVoiceRemainingRestMeasures <<
@@ -19924,8 +19910,8 @@ void msrVoice::setNextMeasureNumberInVoice (
     if (fVoiceRemainingRestMeasures == 0) {
       // yes, set waiting multiple rest's next measure number
 #ifdef TRACE_OPTIONS
-      if (gTraceOptions->fTraceRepeats) {
-        gLogIOstream <<
+      if (gTraceOptions ()->fTraceRepeats) {
+        gLogIOstream () <<
           "Setting multiple rest next measure number to '" <<
           nextMeasureNumber <<
           "' in voice \"" <<
@@ -19943,7 +19929,7 @@ void msrVoice::setNextMeasureNumberInVoice (
     }
   }
 
-  gIndenter--;
+  gIndenter ()--;
 }
 
 void msrVoice::createNewLastSegmentForVoice (
@@ -19951,8 +19937,8 @@ void msrVoice::createNewLastSegmentForVoice (
 {
   // create the segment
 #ifdef TRACE_OPTIONS
-  if (gTraceOptions->fTraceSegments || gTraceOptions->fTraceVoices) {
-    gLogIOstream <<
+  if (gTraceOptions ()->fTraceSegments || gTraceOptions ()->fTraceVoices) {
+    gLogIOstream () <<
       "Creating a new segment for voice \"" <<
       getVoiceName () << "\"" <<
       ", line " << inputLineNumber <<
@@ -19976,8 +19962,8 @@ void msrVoice::createNewLastSegmentFromFirstMeasureForVoice (
 {
   // create the segment
 #ifdef TRACE_OPTIONS
-  if (gTraceOptions->fTraceVoices) {
-    gLogIOstream <<
+  if (gTraceOptions ()->fTraceVoices) {
+    gLogIOstream () <<
       "Creating a new segment with first measure '" <<
       firstMeasure->getMeasureNumber () <<
       "' for voice \"" <<
@@ -20020,15 +20006,15 @@ void msrVoice::createNewLastSegmentAndANewMeasureBeforeARepeat (
   // create the new voice last segment
 #ifdef TRACE_OPTIONS
   if (
-    gTraceOptions->fTraceVoices
+    gTraceOptions ()->fTraceVoices
       ||
-    gTraceOptions->fTraceSegments
+    gTraceOptions ()->fTraceSegments
       ||
-    gTraceOptions->fTraceMeasures
+    gTraceOptions ()->fTraceMeasures
       ||
-    gTraceOptions->fTraceRepeats
+    gTraceOptions ()->fTraceRepeats
   ) {
-    gLogIOstream <<
+    gLogIOstream () <<
       "Creating a new last segment containing a new measure '" <<
       fVoiceCurrentMeasureNumber <<
       "' before a repeat for voice \"" <<
@@ -20049,8 +20035,8 @@ void msrVoice::createNewLastSegmentAndANewMeasureBeforeARepeat (
 
   // create a measure
 #ifdef TRACE_OPTIONS
-  if (gTraceOptions->fTraceMeasures || gTraceOptions->fTraceSegments) {
-    gLogIOstream <<
+  if (gTraceOptions ()->fTraceMeasures || gTraceOptions ()->fTraceSegments) {
+    gLogIOstream () <<
       "Creating measure '" << fVoiceCurrentMeasureNumber <<
       "' in segment " << asString () <<
       ", in voice \"" <<
@@ -20106,8 +20092,8 @@ void msrVoice::createNewLastSegmentAndANewMeasureAfterARepeat (
 
   // create the segment
 #ifdef TRACE_OPTIONS
-  if (gTraceOptions->fTraceVoices) {
-    gLogIOstream <<
+  if (gTraceOptions ()->fTraceVoices) {
+    gLogIOstream () <<
       "Creating a new last segment containing a new measure '" <<
       fVoiceCurrentMeasureNumber <<
       "' after a repeat for voice \"" <<
@@ -20130,15 +20116,15 @@ void msrVoice::createNewLastSegmentAndANewMeasureAfterARepeat (
   // create the new measure with number newMeasureMeasureNumber
 #ifdef TRACE_OPTIONS
   if (
-    gTraceOptions->fTraceVoices
+    gTraceOptions ()->fTraceVoices
       ||
-    gTraceOptions->fTraceSegments
+    gTraceOptions ()->fTraceSegments
       ||
-    gTraceOptions->fTraceMeasures
+    gTraceOptions ()->fTraceMeasures
       ||
-    gTraceOptions->fTraceRepeats
+    gTraceOptions ()->fTraceRepeats
   ) {
-    gLogIOstream <<
+    gLogIOstream () <<
       "Creating a new last segment containing a new measure '" <<
       fVoiceCurrentMeasureNumber <<
       "' after a repeat for voice \"" <<
@@ -20187,7 +20173,7 @@ S_msrVoice msrVoice::createHarmonyVoiceForRegularVoice (
       "\" already has a harmony voice";
 
     msrInternalError (
-      gXml2lyOptions->fInputSourceName,
+      gXml2lyOptions ()->fInputSourceName,
       inputLineNumber,
       __FILE__, __LINE__,
       s.str ());
@@ -20199,12 +20185,12 @@ S_msrVoice msrVoice::createHarmonyVoiceForRegularVoice (
     
 #ifdef TRACE_OPTIONS
   if (
-    gTraceOptions->fTraceHarmonies
+    gTraceOptions ()->fTraceHarmonies
       ||
-    gTraceOptions->fTraceVoices
+    gTraceOptions ()->fTraceVoices
       ||
-    gTraceOptions->fTraceStaves) {
-    gLogIOstream <<
+    gTraceOptions ()->fTraceStaves) {
+    gLogIOstream () <<
       "Creating harmony voice for regular voice \"" << getVoiceName () << "\"" <<
       " with voice number " << harmonyVoiceForRegularVoiceNumber <<
       ", line " << inputLineNumber <<
@@ -20248,7 +20234,7 @@ S_msrStanza msrVoice::addStanzaToVoiceByItsNumber (
       endl;
 
     msrInternalError (
-      gXml2lyOptions->fInputSourceName,
+      gXml2lyOptions ()->fInputSourceName,
       inputLineNumber,
       __FILE__, __LINE__,
       s.str ());
@@ -20277,8 +20263,8 @@ void msrVoice::addStanzaToVoice (S_msrStanza stanza)
     
   // register stanza in this voice
 #ifdef TRACE_OPTIONS
-  if (gTraceOptions->fTraceLyrics) {
-    gLogIOstream <<
+  if (gTraceOptions ()->fTraceLyrics) {
+    gLogIOstream () <<
       "Adding stanza " << stanza->getStanzaName () <<
       " (" << stanzaNumber <<
       ") to voice \"" << getVoiceName () << "\"" <<
@@ -20298,8 +20284,8 @@ void msrVoice::addStanzaToVoiceWithoutCatchUp (S_msrStanza stanza)
     
   // register stanza in this voice
 #ifdef TRACE_OPTIONS
-  if (gTraceOptions->fTraceLyrics) {
-    gLogIOstream <<
+  if (gTraceOptions ()->fTraceLyrics) {
+    gLogIOstream () <<
       "Adding stanza " << stanza->getStanzaName () <<
       " (" << stanzaNumber <<
       ") to voice \"" << getVoiceName () << "\"" <<
@@ -20328,8 +20314,8 @@ S_msrStanza msrVoice::createStanzaInVoiceIfNotYetDone (
   else {
     // no, create it and add it to the voice
 #ifdef TRACE_OPTIONS
-    if (gTraceOptions->fTraceVoices || gTraceOptions->fTraceLyrics) {
-      gLogIOstream <<
+    if (gTraceOptions ()->fTraceVoices || gTraceOptions ()->fTraceLyrics) {
+      gLogIOstream () <<
         "Creating stanza" <<
         " number " << stanzaNumber <<
         ", name \"" << stanzaName << "\"" <<
@@ -20365,14 +20351,14 @@ S_msrStanza msrVoice::fetchStanzaInVoice (
   else {
     stringstream s;
     
-    gLogIOstream <<
+    gLogIOstream () <<
       endl << endl << endl <<
       "VOICEVOICEVOICEVOICEVOICEVOICEVOICEVOICE" <<
       endl;
 
-    print (gLogIOstream);
+    print (gLogIOstream ());
       
-    gLogIOstream <<
+    gLogIOstream () <<
       "VOICEVOICEVOICEVOICEVOICEVOICEVOICEVOICE" <<
       endl << endl << endl <<
       endl;
@@ -20388,7 +20374,7 @@ S_msrStanza msrVoice::fetchStanzaInVoice (
       endl;
 
     msrInternalError (
-      gXml2lyOptions->fInputSourceName,
+      gXml2lyOptions ()->fInputSourceName,
       inputLineNumber,
       __FILE__, __LINE__,
       s.str ());
@@ -20400,15 +20386,15 @@ S_msrStanza msrVoice::fetchStanzaInVoice (
 void msrVoice::appendClefToVoice (S_msrClef clef)
 {
 #ifdef TRACE_OPTIONS
-  if (gTraceOptions->fTraceClefs || gTraceOptions->fTraceVoices) {
-    gLogIOstream <<
+  if (gTraceOptions ()->fTraceClefs || gTraceOptions ()->fTraceVoices) {
+    gLogIOstream () <<
       "Appending clef '" << clef->asString () <<
       "' to voice \"" << getVoiceName () << "\"" <<
       endl;
   }
 #endif
 
-  gIndenter++;
+  gIndenter ()++;
   
   // create the voice last segment and first measure if needed
   appendAFirstMeasureToVoiceIfNotYetDone (
@@ -20426,21 +20412,21 @@ void msrVoice::appendClefToVoice (S_msrClef clef)
       prependClefToSegment (clef);
   }
 
-  gIndenter--;
+  gIndenter ()--;
 }
 
 void msrVoice::appendKeyToVoice (S_msrKey key)
 {
 #ifdef TRACE_OPTIONS
-  if (gTraceOptions->fTraceKeys || gTraceOptions->fTraceVoices) {
-    gLogIOstream <<
+  if (gTraceOptions ()->fTraceKeys || gTraceOptions ()->fTraceVoices) {
+    gLogIOstream () <<
       "Appending key '" << key->asString () <<
       "' to voice \"" << getVoiceName () << "\"" <<
       endl;
   }
 #endif
 
-  gIndenter++;
+  gIndenter ()++;
   
   // create the voice last segment and first measure if needed
   appendAFirstMeasureToVoiceIfNotYetDone (
@@ -20450,21 +20436,21 @@ void msrVoice::appendKeyToVoice (S_msrKey key)
   fVoiceLastSegment->
     appendKeyToSegment (key);
 
-  gIndenter--;
+  gIndenter ()--;
 }
 
 void msrVoice::appendTimeToVoice (S_msrTime time)
 {
 #ifdef TRACE_OPTIONS
-  if (gTraceOptions->fTraceTimes || gTraceOptions->fTraceVoices) {
-    gLogIOstream <<
+  if (gTraceOptions ()->fTraceTimes || gTraceOptions ()->fTraceVoices) {
+    gLogIOstream () <<
       "Appending time '" << time->asString () <<
       "' to voice \"" << getVoiceName () << "\"" <<
       endl;
   }
 #endif
 
-  gIndenter++;
+  gIndenter ()++;
   
   // create the voice last segment and first measure if needed
   appendAFirstMeasureToVoiceIfNotYetDone (
@@ -20474,21 +20460,21 @@ void msrVoice::appendTimeToVoice (S_msrTime time)
   fVoiceLastSegment->
     appendTimeToSegment (time);
 
-  gIndenter--;
+  gIndenter ()--;
 }
 
 void msrVoice::appendTimeToVoiceClone (S_msrTime time)
 {
 #ifdef TRACE_OPTIONS
-  if (gTraceOptions->fTraceTimes || gTraceOptions->fTraceVoices) {
-    gLogIOstream <<
+  if (gTraceOptions ()->fTraceTimes || gTraceOptions ()->fTraceVoices) {
+    gLogIOstream () <<
       "Appending time '" << time->asString () <<
       "' to voice clone \"" << getVoiceName () << "\"" <<
       endl;
   }
 #endif
 
-  gIndenter++;
+  gIndenter ()++;
   
   // create the voice last segment and first measure if needed
   appendAFirstMeasureToVoiceIfNotYetDone (
@@ -20498,7 +20484,7 @@ void msrVoice::appendTimeToVoiceClone (S_msrTime time)
   fVoiceLastSegment->
     appendTimeToSegmentClone (time);
 
-  gIndenter--;
+  gIndenter ()--;
 }
 
 S_msrNote msrVoice::fetchVoiceFirstNonGraceNote () const
@@ -20597,7 +20583,7 @@ S_msrNote msrVoice::fetchVoiceFirstNonGraceNote () const
               "'";
               
             msrInternalError (
-              gXml2lyOptions->fInputSourceName,
+              gXml2lyOptions ()->fInputSourceName,
               fInputLineNumber,
               __FILE__, __LINE__,
               s.str ());
@@ -20652,8 +20638,8 @@ void msrVoice::registerNoteAsVoiceLastAppendedNote (S_msrNote note)
 void msrVoice::appendHarmonyToVoice (S_msrHarmony harmony)
 {
 #ifdef TRACE_OPTIONS
-  if (gTraceOptions->fTraceHarmonies || gTraceOptions->fTraceVoices) {
-    gLogIOstream <<
+  if (gTraceOptions ()->fTraceHarmonies || gTraceOptions ()->fTraceVoices) {
+    gLogIOstream () <<
       "Appending harmony '" << harmony->asString () <<
       "' to voice \"" << getVoiceName () << "\"" <<
       endl;
@@ -20699,7 +20685,7 @@ void msrVoice::appendHarmonyToVoice (S_msrHarmony harmony)
           "\"";
 
         msrInternalError (
-          gXml2lyOptions->fInputSourceName,
+          gXml2lyOptions ()->fInputSourceName,
           inputLineNumber,
           __FILE__, __LINE__,
           s.str ());
@@ -20711,8 +20697,8 @@ void msrVoice::appendHarmonyToVoice (S_msrHarmony harmony)
 void msrVoice::appendHarmonyToVoiceClone (S_msrHarmony harmony)
 {
 #ifdef TRACE_OPTIONS
-  if (gTraceOptions->fTraceHarmonies || gTraceOptions->fTraceVoices) {
-    gLogIOstream <<
+  if (gTraceOptions ()->fTraceHarmonies || gTraceOptions ()->fTraceVoices) {
+    gLogIOstream () <<
       "Appending harmony '" << harmony->asString () <<
       "' to voice clone \"" << getVoiceName () << "\"" <<
       endl;
@@ -20751,7 +20737,7 @@ void msrVoice::appendHarmonyToVoiceClone (S_msrHarmony harmony)
           "\"";
 
         msrInternalError (
-          gXml2lyOptions->fInputSourceName,
+          gXml2lyOptions ()->fInputSourceName,
           inputLineNumber,
           __FILE__, __LINE__,
           s.str ());
@@ -20764,8 +20750,8 @@ void msrVoice::appendFiguredBassToVoice (
   S_msrFiguredBass figuredBass)
 {
 #ifdef TRACE_OPTIONS
-  if (gTraceOptions->fTraceFiguredBass || gTraceOptions->fTraceVoices) {
-    gLogIOstream <<
+  if (gTraceOptions ()->fTraceFiguredBass || gTraceOptions ()->fTraceVoices) {
+    gLogIOstream () <<
       "Appending figured bass '" << figuredBass->asString () <<
       "' to voice \"" << getVoiceName () << "\"" <<
       endl;
@@ -20799,7 +20785,7 @@ void msrVoice::appendFiguredBassToVoice (
           "\"";
 
         msrInternalError (
-          gXml2lyOptions->fInputSourceName,
+          gXml2lyOptions ()->fInputSourceName,
           figuredBass->getInputLineNumber (),
           __FILE__, __LINE__,
           s.str ());
@@ -20812,8 +20798,8 @@ void msrVoice::appendFiguredBassToVoiceClone (
   S_msrFiguredBass figuredBass)
 {
 #ifdef TRACE_OPTIONS
-  if (gTraceOptions->fTraceFiguredBass || gTraceOptions->fTraceVoices) {
-    gLogIOstream <<
+  if (gTraceOptions ()->fTraceFiguredBass || gTraceOptions ()->fTraceVoices) {
+    gLogIOstream () <<
       "Appending figured bass '" << figuredBass->asString () <<
       "' to voice clone \"" << getVoiceName () << "\"" <<
       endl;
@@ -20849,7 +20835,7 @@ void msrVoice::appendFiguredBassToVoiceClone (
           "\"";
 
         msrInternalError (
-          gXml2lyOptions->fInputSourceName,
+          gXml2lyOptions ()->fInputSourceName,
           figuredBass->getInputLineNumber (),
           __FILE__, __LINE__,
           s.str ());
@@ -20863,8 +20849,8 @@ void msrVoice::padUpToMeasureLengthInVoice (
   rational measureLength)
 {
 #ifdef TRACE_OPTIONS
-  if (gTraceOptions->fTraceVoices || gTraceOptions->fTraceMeasures) {
-    gLogIOstream <<
+  if (gTraceOptions ()->fTraceVoices || gTraceOptions ()->fTraceMeasures) {
+    gLogIOstream () <<
       "Padding up to measure length '" << measureLength <<
       "' in voice \"" <<
       getVoiceName () <<
@@ -20873,7 +20859,7 @@ void msrVoice::padUpToMeasureLengthInVoice (
   }
 #endif
 
-  gIndenter++;
+  gIndenter ()++;
   
   // pad up the voice's last segment
   fVoiceLastSegment->
@@ -20893,7 +20879,7 @@ void msrVoice::padUpToMeasureLengthInVoice (
     } // for
   }
 
-  gIndenter--;
+  gIndenter ()--;
 }
 
 void msrVoice::appendPaddingNoteToVoice (
@@ -20902,8 +20888,8 @@ void msrVoice::appendPaddingNoteToVoice (
   int divisionsPerQuarterNote)
 {
 #ifdef TRACE_OPTIONS
-  if (gTraceOptions->fTraceVoices || gTraceOptions->fTraceMeasures) {
-    gLogIOstream <<
+  if (gTraceOptions ()->fTraceVoices || gTraceOptions ()->fTraceMeasures) {
+    gLogIOstream () <<
       "Appending padding note of " << divisions <<
       " divisions to voice \"" <<
       getVoiceName () <<
@@ -20913,7 +20899,7 @@ void msrVoice::appendPaddingNoteToVoice (
   }
 #endif
 
-  gIndenter++;
+  gIndenter ()++;
   
   // pad up the voice's last segment
   fVoiceLastSegment->
@@ -20937,15 +20923,15 @@ void msrVoice::appendPaddingNoteToVoice (
     } // for
   }
 
-  gIndenter--;
+  gIndenter ()--;
 }
 
 void msrVoice::appendTransposeToVoice (
   S_msrTranspose transpose)
 {
 #ifdef TRACE_OPTIONS
-  if (gTraceOptions->fTraceTranspositions || gTraceOptions->fTraceVoices) {
-    gLogIOstream <<
+  if (gTraceOptions ()->fTraceTranspositions || gTraceOptions ()->fTraceVoices) {
+    gLogIOstream () <<
       "Appending transpose '" <<
       transpose->asString () <<
       "' to voice \"" << getVoiceName () << "\"" <<
@@ -20965,8 +20951,8 @@ void msrVoice::appendPartNameDisplayToVoice (
   S_msrPartNameDisplay partNameDisplay)
 {
 #ifdef TRACE_OPTIONS
-  if (gTraceOptions->fTraceTranspositions || gTraceOptions->fTraceVoices) {
-    gLogIOstream <<
+  if (gTraceOptions ()->fTraceTranspositions || gTraceOptions ()->fTraceVoices) {
+    gLogIOstream () <<
       "Appending part name display '" <<
       partNameDisplay->asString () <<
       "' to voice \"" << getVoiceName () << "\"" <<
@@ -20986,8 +20972,8 @@ void msrVoice::appendPartAbbreviationDisplayToVoice (
   S_msrPartAbbreviationDisplay partAbbreviationDisplay)
 {
 #ifdef TRACE_OPTIONS
-  if (gTraceOptions->fTraceTranspositions || gTraceOptions->fTraceVoices) {
-    gLogIOstream <<
+  if (gTraceOptions ()->fTraceTranspositions || gTraceOptions ()->fTraceVoices) {
+    gLogIOstream () <<
       "Appending part abbreviation display '" <<
       partAbbreviationDisplay->asString () <<
       "' to voice \"" << getVoiceName () << "\"" <<
@@ -21008,8 +20994,8 @@ void msrVoice::appendStaffDetailsToVoice (
   S_msrStaffDetails staffDetails)
 {
 #ifdef TRACE_OPTIONS
-  if (gTraceOptions->fTraceStaves || gTraceOptions->fTraceVoices) {
-    gLogIOstream <<
+  if (gTraceOptions ()->fTraceStaves || gTraceOptions ()->fTraceVoices) {
+    gLogIOstream () <<
       "Appending staff details '" <<
       staffDetails->asShortString () <<
       "' to voice \"" << getVoiceName () << "\"" <<
@@ -21036,8 +21022,8 @@ void msrVoice::appendStaffDetailsToVoice (
 void msrVoice::appendWordsToVoice (S_msrWords words)
 {
 #ifdef TRACE_OPTIONS
-  if (gTraceOptions->fTraceWords) {
-    gLogIOstream <<
+  if (gTraceOptions ()->fTraceWords) {
+    gLogIOstream () <<
       "Appending words '" << words->asString () <<
       "' to voice " << getVoiceName () << endl;
   }
@@ -21051,8 +21037,8 @@ void msrVoice::appendWordsToVoice (S_msrWords words)
 
 void msrVoice::appendTempoToVoice (S_msrTempo tempo)
 {
-  if (gMsrOptions->fTraceMsr) {
-    gLogIOstream <<
+  if (gMsrOptions ()->fTraceMsr) {
+    gLogIOstream () <<
       "Appending tempo '" << tempo->asString () <<
       "' to voice \"" << getVoiceName () << "\"" <<
       endl;
@@ -21069,8 +21055,8 @@ void msrVoice::appendTempoToVoice (S_msrTempo tempo)
 void msrVoice::appendOctaveShiftToVoice (
   S_msrOctaveShift octaveShift)
 {
-  if (gMsrOptions->fTraceMsr) {
-    gLogIOstream <<
+  if (gMsrOptions ()->fTraceMsr) {
+    gLogIOstream () <<
       "Appending octave shift '" <<
       octaveShift->octaveShiftKindAsString () <<
       "', size: " << octaveShift->getOctaveShiftSize () <<
@@ -21089,8 +21075,8 @@ void msrVoice::appendOctaveShiftToVoice (
 void msrVoice::appendScordaturaToVoice (
   S_msrScordatura scordatura)
 {
-  if (gMsrOptions->fTraceMsr) {
-    gLogIOstream <<
+  if (gMsrOptions ()->fTraceMsr) {
+    gLogIOstream () <<
       "Appending scordatura '" <<
       scordatura->asString () <<
       "' to voice \"" << getVoiceName () << "\"" <<
@@ -21110,8 +21096,8 @@ void msrVoice::appendAccordionRegistrationToVoice (
     accordionRegistration)
 {
 #ifdef TRACE_OPTIONS
-  if (gTraceOptions->fTracePasses || gTraceOptions->fTraceVoices) {
-    gLogIOstream <<
+  if (gTraceOptions ()->fTracePasses || gTraceOptions ()->fTraceVoices) {
+    gLogIOstream () <<
       "Appending accordion registration '" <<
       accordionRegistration->asString () <<
       "' to voice \"" << getVoiceName () << "\"" <<
@@ -21133,8 +21119,8 @@ void msrVoice::appendHarpPedalsTuningToVoice (
     harpPedalsTuning)
 {
 #ifdef TRACE_OPTIONS
-  if (gTraceOptions->fTracePasses || gTraceOptions->fTraceVoices) {
-    gLogIOstream <<
+  if (gTraceOptions ()->fTracePasses || gTraceOptions ()->fTraceVoices) {
+    gLogIOstream () <<
       "Appending harp pedals tuning '" <<
       harpPedalsTuning->asString () <<
       "' to voice \"" << getVoiceName () << "\"" <<
@@ -21154,8 +21140,8 @@ void msrVoice::appendHarpPedalsTuningToVoice (
 void msrVoice::appendRehearsalToVoice (S_msrRehearsal rehearsal)
 {
 #ifdef TRACE_OPTIONS
-  if (gTraceOptions->fTraceRepeats) {
-    gLogIOstream <<
+  if (gTraceOptions ()->fTraceRepeats) {
+    gLogIOstream () <<
       "Appending rehearsal '" << rehearsal->getRehearsalText () <<
       "' to voice \"" << getVoiceName () << "\"" <<
       endl;
@@ -21177,8 +21163,8 @@ void msrVoice::appendVoiceStaffChangeToVoice (
     voiceStaffChange->getInputLineNumber ();
     
 #ifdef TRACE_OPTIONS
-  if (gTraceOptions->fTraceVoices || gTraceOptions->fTraceStaves) {
-    gLogIOstream <<
+  if (gTraceOptions ()->fTraceVoices || gTraceOptions ()->fTraceStaves) {
+    gLogIOstream () <<
       "Appending voice staff change '" <<
       voiceStaffChange->asString () <<
       "' to voice " <<
@@ -21192,14 +21178,14 @@ void msrVoice::appendVoiceStaffChangeToVoice (
   appendAFirstMeasureToVoiceIfNotYetDone (
     inputLineNumber);
 
-  gIndenter++;
+  gIndenter ()++;
 
   // append voice staff change to voice's last segment
   fVoiceLastSegment->
     appendVoiceStaffChangeToSegment (
       voiceStaffChange);
 
-  gIndenter--;
+  gIndenter ()--;
 }
 
 void msrVoice::appendNoteToVoice (S_msrNote note) {
@@ -21207,20 +21193,20 @@ void msrVoice::appendNoteToVoice (S_msrNote note) {
     note->getInputLineNumber ();
     
 #ifdef TRACE_OPTIONS
-  if (gTraceOptions->fTraceNotes || gTraceOptions->fTraceVoices) {
-    gLogIOstream <<
+  if (gTraceOptions ()->fTraceNotes || gTraceOptions ()->fTraceVoices) {
+    gLogIOstream () <<
       "Appending note '" <<
       endl;
 
-    gIndenter++;
+    gIndenter ()++;
     
-    gLogIOstream <<
+    gLogIOstream () <<
       note <<
         "' to voice \"" << getVoiceName () << "\"" <<
         ", line " << inputLineNumber <<
         endl;
 
-    gIndenter--;
+    gIndenter ()--;
   }
 #endif
 
@@ -21298,16 +21284,13 @@ void msrVoice::appendNoteToVoice (S_msrNote note) {
 }
 
 void msrVoice::appendNoteToVoiceClone (S_msrNote note) {
-  int inputLineNumber =
-    note->getInputLineNumber ();
-    
 #ifdef TRACE_OPTIONS
-  if (gTraceOptions->fTraceNotes || gTraceOptions->fTraceVoices) {
-    gLogIOstream <<
+  if (gTraceOptions ()->fTraceNotes || gTraceOptions ()->fTraceVoices) {
+    gLogIOstream () <<
       "Appending note '" <<
       note->asShortString () <<
       "' to voice clone \"" << getVoiceName () << "\"" <<
-      ", line " << inputLineNumber <<
+      ", line " << note->getInputLineNumber () <<
       endl;
   }
 #endif
@@ -21386,8 +21369,8 @@ void msrVoice::appendDoubleTremoloToVoice (
 
 {
 #ifdef TRACE_OPTIONS
-  if (gTraceOptions->fTraceTremolos) {
-    gLogIOstream <<
+  if (gTraceOptions ()->fTraceTremolos) {
+    gLogIOstream () <<
       "Appending double tremolo '" <<
       doubleTremolo->asShortString () <<
       "' to voice \"" << getVoiceName () << "\"" <<
@@ -21408,8 +21391,8 @@ void msrVoice::appendDoubleTremoloToVoice (
 void msrVoice::appendChordToVoice (S_msrChord chord)
 {
 #ifdef TRACE_OPTIONS
-  if (gTraceOptions->fTraceChords) {
-    gLogIOstream <<
+  if (gTraceOptions ()->fTraceChords) {
+    gLogIOstream () <<
       "Appending chord '" << chord->asString () <<
       "' to voice \"" << getVoiceName () << "\"" <<
       endl;
@@ -21464,15 +21447,15 @@ void msrVoice::appendChordToVoice (S_msrChord chord)
 void msrVoice::appendTupletToVoice (S_msrTuplet tuplet)
 {
 #ifdef TRACE_OPTIONS
-  if (gTraceOptions->fTraceTuplets) {
-    gLogIOstream <<
+  if (gTraceOptions ()->fTraceTuplets) {
+    gLogIOstream () <<
       "Appending tuplet '" << tuplet->asString () <<
       "' to voice \"" << getVoiceName () << "\"" <<
       endl;
   }
 #endif
 
-  gIndenter++;
+  gIndenter ()++;
   
   // create the voice last segment and first measure if needed
   appendAFirstMeasureToVoiceIfNotYetDone (
@@ -21481,7 +21464,7 @@ void msrVoice::appendTupletToVoice (S_msrTuplet tuplet)
   fVoiceLastSegment->
     appendTupletToSegment (tuplet);
 
-  gIndenter--;
+  gIndenter ()--;
 
   fMusicHasBeenInsertedInVoice = true;
 }
@@ -21493,8 +21476,8 @@ void msrVoice::addGraceNotesGroupBeforeAheadOfVoiceIfNeeded (
     graceNotesGroup->getInputLineNumber ();
   
 #ifdef TRACE_OPTIONS
-  if (gTraceOptions->fTraceGraceNotes) {
-    gLogIOstream <<
+  if (gTraceOptions ()->fTraceGraceNotes) {
+    gLogIOstream () <<
       "Adding grace notes '" <<
       graceNotesGroup->asString () <<
       "' ahead of voice \"" << getVoiceName () << "\"" <<
@@ -21503,12 +21486,12 @@ void msrVoice::addGraceNotesGroupBeforeAheadOfVoiceIfNeeded (
 #endif
 
 /* JMI
-  gLogIOstream <<
+  gLogIOstream () <<
     endl <<
     "======================= prependGraceNotesToVoice" <<
     endl;
-  this->print (gLogIOstream);
-  gLogIOstream <<
+  this->print (gLogIOstream ());
+  gLogIOstream () <<
     "=======================" <<
     endl <<
     endl;
@@ -21550,8 +21533,8 @@ void msrVoice::addGraceNotesGroupBeforeAheadOfVoiceIfNeeded (
       
   if (firstNoteChordUplink) {
 #ifdef TRACE_OPTIONS
-    if (gTraceOptions->fTraceGraceNotes || gTraceOptions->fTraceChords) {
-      gLogIOstream <<
+    if (gTraceOptions ()->fTraceGraceNotes || gTraceOptions ()->fTraceChords) {
+      gLogIOstream () <<
         "Attaching grace notes before '" <<
         graceNotesGroup->asString () <<
         "' to the first chord of voice \"" << getVoiceName () <<
@@ -21569,8 +21552,8 @@ void msrVoice::addGraceNotesGroupBeforeAheadOfVoiceIfNeeded (
   
   else {
 #ifdef TRACE_OPTIONS
-    if (gTraceOptions->fTraceGraceNotes || gTraceOptions->fTraceChords) {
-      gLogIOstream <<
+    if (gTraceOptions ()->fTraceGraceNotes || gTraceOptions ()->fTraceChords) {
+      gLogIOstream () <<
         "Attaching grace notes before '" <<
         graceNotesGroup->asString () <<
         "' to the first note of voice \"" << getVoiceName () <<
@@ -21594,8 +21577,8 @@ void msrVoice::appendAfterGraceNotesToVoice (
   S_msrAfterGraceNotes afterGraceNotes)
 {
 #ifdef TRACE_OPTIONS
-  if (gTraceOptions->fTraceGraceNotes) {
-    gLogIOstream <<
+  if (gTraceOptions ()->fTraceGraceNotes) {
+    gLogIOstream () <<
       "Appending after grace notes " << // JMI AfterGraceNotes <<
       " to voice \"" << getVoiceName () << "\"" <<
       endl;
@@ -21616,8 +21599,8 @@ void msrVoice::prependAfterGraceNotesToVoice (
   S_msrAfterGraceNotes afterGraceNotes)
 {
 #ifdef TRACE_OPTIONS
-  if (gTraceOptions->fTraceGraceNotes) {
-    gLogIOstream <<
+  if (gTraceOptions ()->fTraceGraceNotes) {
+    gLogIOstream () <<
       "Prepending after grace notes " << // JMI AfterGraceNotes <<
       " to voice \"" << getVoiceName () << "\"" <<
       endl;
@@ -21643,8 +21626,8 @@ void msrVoice::appendSyllableToVoice (
 {
   // append syllable to this voice
 #ifdef TRACE_OPTIONS
-  if (gTraceOptions->fTraceLyrics) {
-    gLogIOstream <<
+  if (gTraceOptions ()->fTraceLyrics) {
+    gLogIOstream () <<
       "Appending syllable '" <<
       syllable->asString () <<
       "' to voice \"" << fVoiceName << "\"" <<
@@ -21669,8 +21652,8 @@ void msrVoice::appendSyllableToVoice (
 void msrVoice::appendBarCheckToVoice (S_msrBarCheck barCheck)
 {
 #ifdef TRACE_OPTIONS
-  if (gTraceOptions->fTraceMeasures) {
-    gLogIOstream <<
+  if (gTraceOptions ()->fTraceMeasures) {
+    gLogIOstream () <<
       "Appending bar check '" << barCheck->asString () <<
       "' to voice \"" << getVoiceName () <<  "\"" <<
       endl;
@@ -21689,8 +21672,8 @@ void msrVoice::appendBarNumberCheckToVoice (
   S_msrBarNumberCheck barNumberCheck)
 {
 #ifdef TRACE_OPTIONS
-  if (gTraceOptions->fTraceMeasures) {
-    gLogIOstream <<
+  if (gTraceOptions ()->fTraceMeasures) {
+    gLogIOstream () <<
       "Appending barnumber check '" <<
       barNumberCheck->asString () <<
       "' to voice \"" << getVoiceName () <<  "\"" <<
@@ -21709,8 +21692,8 @@ void msrVoice::appendBarNumberCheckToVoice (
 void msrVoice::appendLineBreakToVoice (S_msrLineBreak lineBreak)
 {
 #ifdef TRACE_OPTIONS
-  if (gTraceOptions->fTraceMeasures) {
-    gLogIOstream <<
+  if (gTraceOptions ()->fTraceMeasures) {
+    gLogIOstream () <<
       "Appending line break '" << lineBreak->asString () <<
       "' to voice \"" << getVoiceName () << "\"" <<
       endl;
@@ -21741,8 +21724,8 @@ void msrVoice::appendLineBreakToVoice (S_msrLineBreak lineBreak)
 void msrVoice::appendPageBreakToVoice (S_msrPageBreak pageBreak)
 {
 #ifdef TRACE_OPTIONS
-  if (gTraceOptions->fTraceMeasures) {
-    gLogIOstream <<
+  if (gTraceOptions ()->fTraceMeasures) {
+    gLogIOstream () <<
       "Appending page break '" << pageBreak->asString () <<
       "' to voice \"" << getVoiceName () << "\"" <<
       endl;
@@ -21759,8 +21742,8 @@ void msrVoice::appendPageBreakToVoice (S_msrPageBreak pageBreak)
 
 void msrVoice::prependOtherElementToVoice (S_msrElement elem) {
 #ifdef TRACE_OPTIONS
-  if (gTraceOptions->fTraceVoices) {
-    gLogIOstream <<
+  if (gTraceOptions ()->fTraceVoices) {
+    gLogIOstream () <<
       "Prepending other element '" << elem <<
       "' to voice \"" << getVoiceName () << "\"" <<
       endl;
@@ -21777,8 +21760,8 @@ void msrVoice::prependOtherElementToVoice (S_msrElement elem) {
 
 void msrVoice::appendOtherElementToVoice (S_msrElement elem) {
 #ifdef TRACE_OPTIONS
-  if (gTraceOptions->fTraceVoices) {
-    gLogIOstream <<
+  if (gTraceOptions ()->fTraceVoices) {
+    gLogIOstream () <<
       "Appending other element '" << elem <<
       "' to voice \"" << getVoiceName () << "\"" <<
       endl;
@@ -21816,7 +21799,7 @@ S_msrMeasure msrVoice::fetchVoiceLastMeasure (
       "attempting to fetch voice last measure in an empty measures list";
 
     msrInternalError (
-      gXml2lyOptions->fInputSourceName,
+      gXml2lyOptions ()->fInputSourceName,
       inputLineNumber,
       __FILE__, __LINE__,
       s.str ());
@@ -21849,7 +21832,7 @@ S_msrElement msrVoice::fetchVoiceLastElement (
       "attempting to fetch voice last element in an empty elements list";
 
     msrInternalError (
-      gXml2lyOptions->fInputSourceName,
+      gXml2lyOptions ()->fInputSourceName,
       inputLineNumber,
       __FILE__, __LINE__,
       s.str ());
@@ -21862,8 +21845,8 @@ void msrVoice::prepareForRepeatInVoice (
   int inputLineNumber)
 {
 #ifdef TRACE_OPTIONS
-  if (gTraceOptions->fTraceRepeats) {
-    gLogIOstream <<
+  if (gTraceOptions ()->fTraceRepeats) {
+    gLogIOstream () <<
       "Preparing for repeat in voice \"" <<
       getVoiceName () <<
       "\" in staff \"" <<
@@ -21917,10 +21900,10 @@ void msrVoice::prepareForRepeatInVoice (
   
 #ifdef TRACE_OPTIONS
           if (
-            gTraceOptions->fTraceRepeatsDetails
+            gTraceOptions ()->fTraceRepeatsDetails
               ||
-            gTraceOptions->fTraceVoicesDetails) {
-            gLogIOstream <<
+            gTraceOptions ()->fTraceVoicesDetails) {
+            gLogIOstream () <<
               endl <<
               "*********>> Current voice ZZZ \"" <<
               getVoiceName () <<
@@ -21929,9 +21912,9 @@ void msrVoice::prepareForRepeatInVoice (
               " contains:" <<
               endl;
   
-            print (gLogIOstream);
+            print (gLogIOstream ());
   
-            gLogIOstream <<
+            gLogIOstream () <<
               "<<*********" <<
               endl <<
               endl;
@@ -21941,14 +21924,14 @@ void msrVoice::prepareForRepeatInVoice (
           // remove last measure in last segment
 #ifdef TRACE_OPTIONS
           if (
-            gTraceOptions->fTraceMeasures
+            gTraceOptions ()->fTraceMeasures
               ||
-            gTraceOptions->fTraceSegments
+            gTraceOptions ()->fTraceSegments
               ||
-            gTraceOptions->fTraceRepeats) {
+            gTraceOptions ()->fTraceRepeats) {
             stringstream s;
         
-            gLogIOstream <<
+            gLogIOstream () <<
               "Removing last measure '" <<
               lastMeasureInLastSegment->getMeasureNumber () <<
               ") in last segment '" <<
@@ -21970,7 +21953,7 @@ void msrVoice::prepareForRepeatInVoice (
               " since fVoiceInitialElementsList is empty";
         
             msrInternalError (
-              gXml2lyOptions->fInputSourceName,
+              gXml2lyOptions ()->fInputSourceName,
               inputLineNumber,
               __FILE__, __LINE__,
               s.str ());
@@ -21978,8 +21961,8 @@ void msrVoice::prepareForRepeatInVoice (
 
           // move current last segment to the list of initial elements
 #ifdef TRACE_OPTIONS
-          if (gTraceOptions->fTraceRepeats) {
-            gLogIOstream <<
+          if (gTraceOptions ()->fTraceRepeats) {
+            gLogIOstream () <<
               "Appending voice last segment to the initial elements in voice \"" <<
               getVoiceName () <<
               "\"" <<
@@ -21993,8 +21976,8 @@ void msrVoice::prepareForRepeatInVoice (
   
           // create a new last segment containing lastMeasureInLastSegment for the voice
 #ifdef TRACE_OPTIONS
-          if (gTraceOptions->fTraceSegments || gTraceOptions->fTraceVoices) {
-            gLogIOstream <<
+          if (gTraceOptions ()->fTraceSegments || gTraceOptions ()->fTraceVoices) {
+            gLogIOstream () <<
               "Creating a new last segment containing  measure '" <<
               lastMeasureInLastSegment->getMeasureNumber () <<
               "' for voice \"" <<
@@ -22019,10 +22002,10 @@ else {
 
 #ifdef TRACE_OPTIONS
           if (
-            gTraceOptions->fTraceRepeatsDetails
+            gTraceOptions ()->fTraceRepeatsDetails
               ||
-            gTraceOptions->fTraceVoicesDetails) {
-            gLogIOstream <<
+            gTraceOptions ()->fTraceVoicesDetails) {
+            gLogIOstream () <<
               endl <<
               "*********>> Current voice TTT \"" <<
               getVoiceName () <<
@@ -22031,9 +22014,9 @@ else {
               " contains:" <<
               endl;
   
-            print (gLogIOstream);
+            print (gLogIOstream ());
   
-            gLogIOstream <<
+            gLogIOstream () <<
               "<<*********" <<
               endl <<
               endl;
@@ -22050,8 +22033,8 @@ void msrVoice::prepareForRepeatInVoiceClone (
   int repeatTimes)
 {
 #ifdef TRACE_OPTIONS
-  if (gTraceOptions->fTraceRepeats) {
-    gLogIOstream <<
+  if (gTraceOptions ()->fTraceRepeats) {
+    gLogIOstream () <<
       "Preparing for repeat in voice clone \"" <<
       getVoiceName () <<
       "\" in staff \"" <<
@@ -22105,10 +22088,10 @@ void msrVoice::prepareForRepeatInVoiceClone (
   
 #ifdef TRACE_OPTIONS
           if (
-            gTraceOptions->fTraceRepeatsDetails
+            gTraceOptions ()->fTraceRepeatsDetails
               ||
-            gTraceOptions->fTraceVoicesDetails) {
-            gLogIOstream <<
+            gTraceOptions ()->fTraceVoicesDetails) {
+            gLogIOstream () <<
               endl <<
               "*********>> Current voice ZZZ \"" <<
               getVoiceName () <<
@@ -22117,9 +22100,9 @@ void msrVoice::prepareForRepeatInVoiceClone (
               " contains:" <<
               endl;
   
-            print (gLogIOstream);
+            print (gLogIOstream ());
   
-            gLogIOstream <<
+            gLogIOstream () <<
               "<<*********" <<
               endl <<
               endl;
@@ -22129,14 +22112,14 @@ void msrVoice::prepareForRepeatInVoiceClone (
           // remove last measure in last segment
 #ifdef TRACE_OPTIONS
           if (
-            gTraceOptions->fTraceMeasures
+            gTraceOptions ()->fTraceMeasures
               ||
-            gTraceOptions->fTraceSegments
+            gTraceOptions ()->fTraceSegments
               ||
-            gTraceOptions->fTraceRepeats) {
+            gTraceOptions ()->fTraceRepeats) {
             stringstream s;
         
-            gLogIOstream <<
+            gLogIOstream () <<
               "Removing last measure '" <<
               lastMeasureInLastSegment->getMeasureNumber () <<
               ") in last segment '" <<
@@ -22158,7 +22141,7 @@ void msrVoice::prepareForRepeatInVoiceClone (
               " since fVoiceInitialElementsList is empty";
         
             msrInternalError (
-              gXml2lyOptions->fInputSourceName,
+              gXml2lyOptions ()->fInputSourceName,
               inputLineNumber,
               __FILE__, __LINE__,
               s.str ());
@@ -22166,8 +22149,8 @@ void msrVoice::prepareForRepeatInVoiceClone (
 
           // move current last segment to the list of initial elements
 #ifdef TRACE_OPTIONS
-          if (gTraceOptions->fTraceRepeats) {
-            gLogIOstream <<
+          if (gTraceOptions ()->fTraceRepeats) {
+            gLogIOstream () <<
               "Appending voice last segment to the initial elements in voice \"" <<
               getVoiceName () <<
               "\"" <<
@@ -22181,8 +22164,8 @@ void msrVoice::prepareForRepeatInVoiceClone (
   
           // create a new last segment containing lastMeasureInLastSegment for the voice
 #ifdef TRACE_OPTIONS
-          if (gTraceOptions->fTraceSegments || gTraceOptions->fTraceVoices) {
-            gLogIOstream <<
+          if (gTraceOptions ()->fTraceSegments || gTraceOptions ()->fTraceVoices) {
+            gLogIOstream () <<
               "Creating a new last segment containing  measure '" <<
               lastMeasureInLastSegment->getMeasureNumber () <<
               "' for voice \"" <<
@@ -22207,10 +22190,10 @@ else {
 
 #ifdef TRACE_OPTIONS
           if (
-            gTraceOptions->fTraceRepeatsDetails
+            gTraceOptions ()->fTraceRepeatsDetails
               ||
-            gTraceOptions->fTraceVoicesDetails) {
-            gLogIOstream <<
+            gTraceOptions ()->fTraceVoicesDetails) {
+            gLogIOstream () <<
               endl <<
               "*********>> Current voice TTT \"" <<
               getVoiceName () <<
@@ -22219,9 +22202,9 @@ else {
               " contains:" <<
               endl;
   
-            print (gLogIOstream);
+            print (gLogIOstream ());
   
-            gLogIOstream <<
+            gLogIOstream () <<
               "<<*********" <<
               endl <<
               endl;
@@ -22239,8 +22222,8 @@ else {
 
       // create a repeat common part
 #ifdef TRACE_OPTIONS
-      if (gTraceOptions->fTraceRepeats) {
-        gLogIOstream <<
+      if (gTraceOptions ()->fTraceRepeats) {
+        gLogIOstream () <<
           "Creating a repeat common part from current last segment in voice \"" <<
           getVoiceName () <<
           "\"" <<
@@ -22288,10 +22271,10 @@ void msrVoice::nestContentsIntoNewRepeatInVoice (
   
 #ifdef TRACE_OPTIONS
           if (
-            gTraceOptions->fTraceRepeatsDetails
+            gTraceOptions ()->fTraceRepeatsDetails
               ||
-            gTraceOptions->fTraceVoicesDetails) {
-            gLogIOstream <<
+            gTraceOptions ()->fTraceVoicesDetails) {
+            gLogIOstream () <<
               endl <<
               "*********>> Current voice BBB \"" <<
               getVoiceName () <<
@@ -22300,9 +22283,9 @@ void msrVoice::nestContentsIntoNewRepeatInVoice (
               " contains:" <<
               endl;
   
-            print (gLogIOstream);
+            print (gLogIOstream ());
   
-            gLogIOstream <<
+            gLogIOstream () <<
               "<<*********" <<
               endl <<
               endl;
@@ -22311,8 +22294,8 @@ void msrVoice::nestContentsIntoNewRepeatInVoice (
   
           // move current last segment to the list of initial elements
 #ifdef TRACE_OPTIONS
-          if (gTraceOptions->fTraceRepeats) {
-            gLogIOstream <<
+          if (gTraceOptions ()->fTraceRepeats) {
+            gLogIOstream () <<
               "Appending voice last segment to the initial elements in voice \"" <<
               getVoiceName () <<
               "\"" <<
@@ -22326,8 +22309,8 @@ void msrVoice::nestContentsIntoNewRepeatInVoice (
   
           // create a new last segment containing a new measure for the voice
 #ifdef TRACE_OPTIONS
-          if (gTraceOptions->fTraceSegments || gTraceOptions->fTraceVoices) {
-            gLogIOstream <<
+          if (gTraceOptions ()->fTraceSegments || gTraceOptions ()->fTraceVoices) {
+            gLogIOstream () <<
               "Creating a new last segment containing a new measure for voice \"" <<
               fVoiceName << "\"" <<
               ", line " << inputLineNumber <<
@@ -22341,10 +22324,10 @@ void msrVoice::nestContentsIntoNewRepeatInVoice (
   
 #ifdef TRACE_OPTIONS
           if (
-            gTraceOptions->fTraceRepeatsDetails
+            gTraceOptions ()->fTraceRepeatsDetails
               ||
-            gTraceOptions->fTraceVoicesDetails) {
-            gLogIOstream <<
+            gTraceOptions ()->fTraceVoicesDetails) {
+            gLogIOstream () <<
               endl <<
               "*********>> Current voice QQQ \"" <<
               getVoiceName () <<
@@ -22353,9 +22336,9 @@ void msrVoice::nestContentsIntoNewRepeatInVoice (
               " contains:" <<
               endl;
   
-            print (gLogIOstream);
+            print (gLogIOstream ());
   
-            gLogIOstream <<
+            gLogIOstream () <<
               "<<*********" <<
               endl <<
               endl;
@@ -22383,10 +22366,10 @@ void msrVoice::createRepeatUponItsEndAndAppendItToVoice (
           
 #ifdef TRACE_OPTIONS
         if (
-          gTraceOptions->fTraceRepeatsDetails
+          gTraceOptions ()->fTraceRepeatsDetails
             ||
-          gTraceOptions->fTraceVoicesDetails) {
-          gLogIOstream <<
+          gTraceOptions ()->fTraceVoicesDetails) {
+          gLogIOstream () <<
             endl <<
             "*********>> Current voice III \"" <<
             getVoiceName () <<
@@ -22395,9 +22378,9 @@ void msrVoice::createRepeatUponItsEndAndAppendItToVoice (
             " contains:" <<
             endl;
 
-          print (gLogIOstream);
+          print (gLogIOstream ());
 
-          gLogIOstream <<
+          gLogIOstream () <<
             "<<*********" <<
             endl <<
             endl;
@@ -22406,8 +22389,8 @@ void msrVoice::createRepeatUponItsEndAndAppendItToVoice (
 
         // create the repeat
 #ifdef TRACE_OPTIONS
-        if (gTraceOptions->fTraceRepeats) {
-          gLogIOstream <<
+        if (gTraceOptions ()->fTraceRepeats) {
+          gLogIOstream () <<
             "Creating and appending a repeat in voice \"" <<
             getVoiceName () <<
             "\"" <<
@@ -22425,8 +22408,8 @@ void msrVoice::createRepeatUponItsEndAndAppendItToVoice (
 
         // create a repeat common part from the new segment
 #ifdef TRACE_OPTIONS
-        if (gTraceOptions->fTraceRepeats) {
-          gLogIOstream <<
+        if (gTraceOptions ()->fTraceRepeats) {
+          gLogIOstream () <<
             "Creating a repeat common part in voice \"" <<
             getVoiceName () <<
             "\"" <<
@@ -22447,8 +22430,8 @@ void msrVoice::createRepeatUponItsEndAndAppendItToVoice (
           
           // move the voice initial elements to the new repeat common part
 #ifdef TRACE_OPTIONS
-          if (gTraceOptions->fTraceRepeats) {
-            gLogIOstream <<
+          if (gTraceOptions ()->fTraceRepeats) {
+            gLogIOstream () <<
               "Moving the initial elements in voice \"" <<
               getVoiceName () <<
               "\" to the new repeat common part" <<
@@ -22476,8 +22459,8 @@ void msrVoice::createRepeatUponItsEndAndAppendItToVoice (
   
           // move voice last segment into the repeat common part
 #ifdef TRACE_OPTIONS
-          if (gTraceOptions->fTraceRepeats) {
-            gLogIOstream <<
+          if (gTraceOptions ()->fTraceRepeats) {
+            gLogIOstream () <<
               "Append the voice last segment to the repeat common part in voice \"" <<
               getVoiceName () <<
               "\"" <<
@@ -22496,8 +22479,8 @@ void msrVoice::createRepeatUponItsEndAndAppendItToVoice (
 
           // move the voice initial elements to the new repeat common part
 #ifdef TRACE_OPTIONS
-          if (gTraceOptions->fTraceRepeats) {
-            gLogIOstream <<
+          if (gTraceOptions ()->fTraceRepeats) {
+            gLogIOstream () <<
               "Moving the initial elements in voice \"" <<
               getVoiceName () <<
               "\" to the new repeat common part" <<
@@ -22525,8 +22508,8 @@ void msrVoice::createRepeatUponItsEndAndAppendItToVoice (
   
           // append the voice last segment to the new repeat common part
 #ifdef TRACE_OPTIONS
-          if (gTraceOptions->fTraceRepeats) {
-            gLogIOstream <<
+          if (gTraceOptions ()->fTraceRepeats) {
+            gLogIOstream () <<
               "Appending the voice last segment in voice \"" <<
               getVoiceName () <<
               "\" to the new repeat common part" <<
@@ -22535,19 +22518,19 @@ void msrVoice::createRepeatUponItsEndAndAppendItToVoice (
           }
 #endif
 
-          gIndenter++;
+          gIndenter ()++;
           
           repeatCommonPart->
             appendElementToRepeatCommonPart (
             fVoiceLastSegment);
 
-          gIndenter--;
+          gIndenter ()--;
         }
 
         // set newRepeat's common part
 #ifdef TRACE_OPTIONS
-        if (gTraceOptions->fTraceRepeats) {
-          gLogIOstream <<
+        if (gTraceOptions ()->fTraceRepeats) {
+          gLogIOstream () <<
             "Setting repeat common part in voice \"" <<
             getVoiceName () <<
             "\"" <<
@@ -22562,8 +22545,8 @@ void msrVoice::createRepeatUponItsEndAndAppendItToVoice (
 
         // append newRepeat to the list of initial elements
 #ifdef TRACE_OPTIONS
-        if (gTraceOptions->fTraceRepeats) {
-          gLogIOstream <<
+        if (gTraceOptions ()->fTraceRepeats) {
+          gLogIOstream () <<
             "Appending new repeat to the initial elements in voice \"" <<
             getVoiceName () <<
             "\"" <<
@@ -22581,8 +22564,8 @@ void msrVoice::createRepeatUponItsEndAndAppendItToVoice (
 
         // create a new last segment containing a new measure for the voice
 #ifdef TRACE_OPTIONS
-        if (gTraceOptions->fTraceSegments || gTraceOptions->fTraceVoices) {
-          gLogIOstream <<
+        if (gTraceOptions ()->fTraceSegments || gTraceOptions ()->fTraceVoices) {
+          gLogIOstream () <<
     // JMI        "Creating a new last segment containing a new measure for voice \"" <<
             "Creating a new last segment for voice \"" <<
             fVoiceName << "\"" <<
@@ -22591,7 +22574,7 @@ void msrVoice::createRepeatUponItsEndAndAppendItToVoice (
         }
 #endif
 
-        gIndenter++;
+        gIndenter ()++;
 
 /* JMI
         createNewLastSegmentAndANewMeasureAfterARepeat (
@@ -22624,10 +22607,10 @@ void msrVoice::createRepeatUponItsEndAndAppendItToVoice (
 
 #ifdef TRACE_OPTIONS
         if (
-          gTraceOptions->fTraceRepeatsDetails
+          gTraceOptions ()->fTraceRepeatsDetails
             ||
-          gTraceOptions->fTraceVoicesDetails) {
-          gLogIOstream <<
+          gTraceOptions ()->fTraceVoicesDetails) {
+          gLogIOstream () <<
             endl <<
             "*********>> Current voice EEE \"" <<
             getVoiceName () <<
@@ -22636,16 +22619,16 @@ void msrVoice::createRepeatUponItsEndAndAppendItToVoice (
             " contains:" <<
             endl;
 
-          print (gLogIOstream);
+          print (gLogIOstream ());
 
-          gLogIOstream <<
+          gLogIOstream () <<
             "<<*********" <<
             endl <<
             endl;
         }
 #endif
 
-        gIndenter--;
+        gIndenter ()--;
       }
       break;
   } // switch
@@ -22674,10 +22657,10 @@ void msrVoice::createRepeatUponItsEndAndAppendItToVoiceClone (
           
 #ifdef TRACE_OPTIONS
         if (
-          gTraceOptions->fTraceRepeatsDetails
+          gTraceOptions ()->fTraceRepeatsDetails
             ||
-          gTraceOptions->fTraceVoicesDetails) {
-          gLogIOstream <<
+          gTraceOptions ()->fTraceVoicesDetails) {
+          gLogIOstream () <<
             endl <<
             "*********>> Current voice III \"" <<
             getVoiceName () <<
@@ -22686,9 +22669,9 @@ void msrVoice::createRepeatUponItsEndAndAppendItToVoiceClone (
             " contains:" <<
             endl;
 
-          print (gLogIOstream);
+          print (gLogIOstream ());
 
-          gLogIOstream <<
+          gLogIOstream () <<
             "<<*********" <<
             endl <<
             endl;
@@ -22697,8 +22680,8 @@ void msrVoice::createRepeatUponItsEndAndAppendItToVoiceClone (
 
         // create the repeat
 #ifdef TRACE_OPTIONS
-        if (gTraceOptions->fTraceRepeats) {
-          gLogIOstream <<
+        if (gTraceOptions ()->fTraceRepeats) {
+          gLogIOstream () <<
             "Creating and appending a repeat in voice \"" <<
             getVoiceName () <<
             "\"" <<
@@ -22716,8 +22699,8 @@ void msrVoice::createRepeatUponItsEndAndAppendItToVoiceClone (
 
         // create a repeat common part from the new segment
 #ifdef TRACE_OPTIONS
-        if (gTraceOptions->fTraceRepeats) {
-          gLogIOstream <<
+        if (gTraceOptions ()->fTraceRepeats) {
+          gLogIOstream () <<
             "Creating a repeat common part in voice \"" <<
             getVoiceName () <<
             "\"" <<
@@ -22738,8 +22721,8 @@ void msrVoice::createRepeatUponItsEndAndAppendItToVoiceClone (
           
           // move the voice initial elements to the new repeat common part
 #ifdef TRACE_OPTIONS
-          if (gTraceOptions->fTraceRepeats) {
-            gLogIOstream <<
+          if (gTraceOptions ()->fTraceRepeats) {
+            gLogIOstream () <<
               "Moving the initial elements in voice \"" <<
               getVoiceName () <<
               "\" to the new repeat common part" <<
@@ -22767,8 +22750,8 @@ void msrVoice::createRepeatUponItsEndAndAppendItToVoiceClone (
   
           // move voice last segment into the repeat common part
 #ifdef TRACE_OPTIONS
-          if (gTraceOptions->fTraceRepeats) {
-            gLogIOstream <<
+          if (gTraceOptions ()->fTraceRepeats) {
+            gLogIOstream () <<
               "Append the voice last segment to the repeat common part in voice \"" <<
               getVoiceName () <<
               "\"" <<
@@ -22787,8 +22770,8 @@ void msrVoice::createRepeatUponItsEndAndAppendItToVoiceClone (
           
           // append the voice last segment to the new repeat common part
 #ifdef TRACE_OPTIONS
-          if (gTraceOptions->fTraceRepeats) {
-            gLogIOstream <<
+          if (gTraceOptions ()->fTraceRepeats) {
+            gLogIOstream () <<
               "Appending the voice last segment in voice \"" <<
               getVoiceName () <<
               "\" to the new repeat common part" <<
@@ -22797,19 +22780,19 @@ void msrVoice::createRepeatUponItsEndAndAppendItToVoiceClone (
           }
 #endif
 
-          gIndenter++;
+          gIndenter ()++;
           
           repeatCommonPart->
             appendElementToRepeatCommonPart (
             fVoiceLastSegment);
 
-          gIndenter--;
+          gIndenter ()--;
         }
 
         // set newRepeat's common part
 #ifdef TRACE_OPTIONS
-        if (gTraceOptions->fTraceRepeats) {
-          gLogIOstream <<
+        if (gTraceOptions ()->fTraceRepeats) {
+          gLogIOstream () <<
             "Setting repeat common part in voice \"" <<
             getVoiceName () <<
             "\"" <<
@@ -22824,8 +22807,8 @@ void msrVoice::createRepeatUponItsEndAndAppendItToVoiceClone (
 
         // append newRepeat to the list of initial elements
 #ifdef TRACE_OPTIONS
-        if (gTraceOptions->fTraceRepeats) {
-          gLogIOstream <<
+        if (gTraceOptions ()->fTraceRepeats) {
+          gLogIOstream () <<
             "Appending new repeat to the initial elements in voice \"" <<
             getVoiceName () <<
             "\"" <<
@@ -22843,8 +22826,8 @@ void msrVoice::createRepeatUponItsEndAndAppendItToVoiceClone (
 
         // create a new last segment containing a new measure for the voice
 #ifdef TRACE_OPTIONS
-        if (gTraceOptions->fTraceSegments || gTraceOptions->fTraceVoices) {
-          gLogIOstream <<
+        if (gTraceOptions ()->fTraceSegments || gTraceOptions ()->fTraceVoices) {
+          gLogIOstream () <<
     // JMI        "Creating a new last segment containing a new measure for voice \"" <<
             "Creating a new last segment for voice \"" <<
             fVoiceName << "\"" <<
@@ -22853,7 +22836,7 @@ void msrVoice::createRepeatUponItsEndAndAppendItToVoiceClone (
         }
 #endif
 
-        gIndenter++;
+        gIndenter ()++;
 
 /* JMI
         createNewLastSegmentAndANewMeasureAfterARepeat (
@@ -22865,10 +22848,10 @@ void msrVoice::createRepeatUponItsEndAndAppendItToVoiceClone (
 
 #ifdef TRACE_OPTIONS
         if (
-          gTraceOptions->fTraceRepeatsDetails
+          gTraceOptions ()->fTraceRepeatsDetails
             ||
-          gTraceOptions->fTraceVoicesDetails) {
-          gLogIOstream <<
+          gTraceOptions ()->fTraceVoicesDetails) {
+          gLogIOstream () <<
             endl <<
             "*********>> Current voice EEE \"" <<
             getVoiceName () <<
@@ -22877,16 +22860,16 @@ void msrVoice::createRepeatUponItsEndAndAppendItToVoiceClone (
             " contains:" <<
             endl;
 
-          print (gLogIOstream);
+          print (gLogIOstream ());
 
-          gLogIOstream <<
+          gLogIOstream () <<
             "<<*********" <<
             endl <<
             endl;
         }
 #endif
 
-        gIndenter--;
+        gIndenter ()--;
       }
       break;
   } // switch
@@ -22929,8 +22912,8 @@ void msrVoice::createRegularRepeatUponItsFirstEndingInVoice (
           
         // create the repeat
 #ifdef TRACE_OPTIONS
-        if (gTraceOptions->fTraceRepeats) {
-          gLogIOstream <<
+        if (gTraceOptions ()->fTraceRepeats) {
+          gLogIOstream () <<
             "Creating and appending a repeat in voice \"" <<
             getVoiceName () <<
             "\"" <<
@@ -22939,7 +22922,7 @@ void msrVoice::createRegularRepeatUponItsFirstEndingInVoice (
         }
 #endif
 
-        gIndenter++;
+        gIndenter ()++;
         
         fVoiceCurrentRepeat =
           msrRepeat::create (
@@ -22949,8 +22932,8 @@ void msrVoice::createRegularRepeatUponItsFirstEndingInVoice (
 
         // create a repeat common part
 #ifdef TRACE_OPTIONS
-        if (gTraceOptions->fTraceRepeats) {
-          gLogIOstream <<
+        if (gTraceOptions ()->fTraceRepeats) {
+          gLogIOstream () <<
             "Creating a repeat common part from current last segment in voice \"" <<
             getVoiceName () <<
             "\"" <<
@@ -22967,8 +22950,8 @@ void msrVoice::createRegularRepeatUponItsFirstEndingInVoice (
 
         // move voice last segment into the repeat common part
 #ifdef TRACE_OPTIONS
-        if (gTraceOptions->fTraceRepeats) {
-          gLogIOstream <<
+        if (gTraceOptions ()->fTraceRepeats) {
+          gLogIOstream () <<
             "Append the voice last segment to the repeat common part in voice \"" <<
             getVoiceName () <<
             "\"" <<
@@ -22983,8 +22966,8 @@ void msrVoice::createRegularRepeatUponItsFirstEndingInVoice (
 
         // set fVoiceCurrentRepeat's common part
 #ifdef TRACE_OPTIONS
-        if (gTraceOptions->fTraceRepeats) {
-          gLogIOstream <<
+        if (gTraceOptions ()->fTraceRepeats) {
+          gLogIOstream () <<
             "Setting repeat common part in voice \"" <<
             getVoiceName () <<
             "\"" <<
@@ -22999,8 +22982,8 @@ void msrVoice::createRegularRepeatUponItsFirstEndingInVoice (
           
         // append the repeat to the list of initial elements
 #ifdef TRACE_OPTIONS
-        if (gTraceOptions->fTraceRepeats) {
-          gLogIOstream <<
+        if (gTraceOptions ()->fTraceRepeats) {
+          gLogIOstream () <<
             "Appending repeat to the initial elements in voice \"" <<
             getVoiceName () <<
             "\"" <<
@@ -23014,8 +22997,8 @@ void msrVoice::createRegularRepeatUponItsFirstEndingInVoice (
       
         // create a new last segment containing a new measure for the voice
 #ifdef TRACE_OPTIONS
-        if (gTraceOptions->fTraceSegments || gTraceOptions->fTraceVoices) {
-          gLogIOstream <<
+        if (gTraceOptions ()->fTraceSegments || gTraceOptions ()->fTraceVoices) {
+          gLogIOstream () <<
             "Creating a new last segment with the first ending measure for voice \"" <<
             fVoiceName << "\"" <<
             ", line " << inputLineNumber <<
@@ -23029,10 +23012,10 @@ void msrVoice::createRegularRepeatUponItsFirstEndingInVoice (
 
 #ifdef TRACE_OPTIONS
         if (
-          gTraceOptions->fTraceRepeatsDetails
+          gTraceOptions ()->fTraceRepeatsDetails
             ||
-          gTraceOptions->fTraceVoicesDetails) {
-          gLogIOstream <<
+          gTraceOptions ()->fTraceVoicesDetails) {
+          gLogIOstream () <<
             endl <<
             "*********>> Current voice \"" <<
             getVoiceName () <<
@@ -23041,16 +23024,16 @@ void msrVoice::createRegularRepeatUponItsFirstEndingInVoice (
             " contains:" <<
             endl;
 
-          print (gLogIOstream);
+          print (gLogIOstream ());
 
-          gLogIOstream <<
+          gLogIOstream () <<
             "<<*********" <<
             endl <<
             endl;
         }
 #endif
 
-        gIndenter--;
+        gIndenter ()--;
       }
       break;
   } // switch
@@ -23093,8 +23076,8 @@ void msrVoice::createEnclosingRepeatUponItsFirstEndingInVoice (
           
         // create the repeat
 #ifdef TRACE_OPTIONS
-        if (gTraceOptions->fTraceRepeats) {
-          gLogIOstream <<
+        if (gTraceOptions ()->fTraceRepeats) {
+          gLogIOstream () <<
             "Creating and appending a repeat in voice \"" <<
             getVoiceName () <<
             "\"" <<
@@ -23103,7 +23086,7 @@ void msrVoice::createEnclosingRepeatUponItsFirstEndingInVoice (
         }
 #endif
 
-        gIndenter++;
+        gIndenter ()++;
       
         fVoiceCurrentRepeat =
           msrRepeat::create (
@@ -23113,8 +23096,8 @@ void msrVoice::createEnclosingRepeatUponItsFirstEndingInVoice (
 
         // create a repeat common part
 #ifdef TRACE_OPTIONS
-        if (gTraceOptions->fTraceRepeats) {
-          gLogIOstream <<
+        if (gTraceOptions ()->fTraceRepeats) {
+          gLogIOstream () <<
             "Creating a repeat common part from current last segment in voice \"" <<
             getVoiceName () <<
             "\"" <<
@@ -23131,8 +23114,8 @@ void msrVoice::createEnclosingRepeatUponItsFirstEndingInVoice (
 
         // move voice initial elements into the repeat common part
 #ifdef TRACE_OPTIONS
-        if (gTraceOptions->fTraceRepeats) {
-          gLogIOstream <<
+        if (gTraceOptions ()->fTraceRepeats) {
+          gLogIOstream () <<
             "Moving the voice initial elements to the repeat common part in voice \"" <<
             getVoiceName () <<
             "\"" <<
@@ -23141,7 +23124,7 @@ void msrVoice::createEnclosingRepeatUponItsFirstEndingInVoice (
         }
 #endif
 
-        gIndenter++;
+        gIndenter ()++;
         
         for (
           list<S_msrElement>::const_iterator i = fVoiceInitialElementsList.begin ();
@@ -23151,7 +23134,7 @@ void msrVoice::createEnclosingRepeatUponItsFirstEndingInVoice (
             appendElementToRepeatCommonPart ((*i));
         } // for
 
-        gIndenter--;
+        gIndenter ()--;
         
         // empty the initial elements list
         fVoiceInitialElementsList.resize (0);
@@ -23165,8 +23148,8 @@ void msrVoice::createEnclosingRepeatUponItsFirstEndingInVoice (
         
         // move voice last segment into the repeat common part
 #ifdef TRACE_OPTIONS
-        if (gTraceOptions->fTraceRepeats) {
-          gLogIOstream <<
+        if (gTraceOptions ()->fTraceRepeats) {
+          gLogIOstream () <<
             "Append the voice last segment to the repeat common part in voice \"" <<
             getVoiceName () <<
             "\"" <<
@@ -23175,18 +23158,18 @@ void msrVoice::createEnclosingRepeatUponItsFirstEndingInVoice (
         }
 #endif
 
-        gIndenter++;
+        gIndenter ()++;
         
         repeatCommonPart->
           appendElementToRepeatCommonPart (
             fVoiceLastSegment);
 
-        gIndenter--;
+        gIndenter ()--;
         
         // set fVoiceCurrentRepeat's common part
 #ifdef TRACE_OPTIONS
-        if (gTraceOptions->fTraceRepeats) {
-          gLogIOstream <<
+        if (gTraceOptions ()->fTraceRepeats) {
+          gLogIOstream () <<
             "Setting repeat common part in voice \"" <<
             getVoiceName () <<
             "\"" <<
@@ -23195,18 +23178,18 @@ void msrVoice::createEnclosingRepeatUponItsFirstEndingInVoice (
         }
 #endif
 
-        gIndenter++;
+        gIndenter ()++;
         
         fVoiceCurrentRepeat->
           setRepeatCommonPart (
             repeatCommonPart);
 
-        gIndenter--;
+        gIndenter ()--;
           
         // append the repeat to the list of initial elements
 #ifdef TRACE_OPTIONS
-        if (gTraceOptions->fTraceRepeats) {
-          gLogIOstream <<
+        if (gTraceOptions ()->fTraceRepeats) {
+          gLogIOstream () <<
             "Appending repeat to the initial elements in voice \"" <<
             getVoiceName () <<
             "\"" <<
@@ -23220,8 +23203,8 @@ void msrVoice::createEnclosingRepeatUponItsFirstEndingInVoice (
       
         // create a new last segment containing a new measure for the voice
 #ifdef TRACE_OPTIONS
-        if (gTraceOptions->fTraceSegments || gTraceOptions->fTraceVoices) {
-          gLogIOstream <<
+        if (gTraceOptions ()->fTraceSegments || gTraceOptions ()->fTraceVoices) {
+          gLogIOstream () <<
             "Creating a new last segment with the first ending measure for voice \"" <<
             fVoiceName << "\"" <<
             ", line " << inputLineNumber <<
@@ -23229,20 +23212,20 @@ void msrVoice::createEnclosingRepeatUponItsFirstEndingInVoice (
         }
 #endif
 
-        gIndenter++;
+        gIndenter ()++;
         
         createNewLastSegmentFromFirstMeasureForVoice (
           inputLineNumber,
           firstEndingMeasure);
 
-        gIndenter--;
+        gIndenter ()--;
 
 #ifdef TRACE_OPTIONS
         if (
-          gTraceOptions->fTraceRepeatsDetails
+          gTraceOptions ()->fTraceRepeatsDetails
             ||
-          gTraceOptions->fTraceVoicesDetails) {
-          gLogIOstream <<
+          gTraceOptions ()->fTraceVoicesDetails) {
+          gLogIOstream () <<
             endl <<
             "*********>> Current voice \"" <<
             getVoiceName () <<
@@ -23251,16 +23234,16 @@ void msrVoice::createEnclosingRepeatUponItsFirstEndingInVoice (
             " contains:" <<
             endl;
 
-          print (gLogIOstream);
+          print (gLogIOstream ());
 
-          gLogIOstream <<
+          gLogIOstream () <<
             "<<*********" <<
             endl <<
             endl;
         }
 #endif
 
-        gIndenter--;
+        gIndenter ()--;
       }
       break;
   } // switch
@@ -23279,13 +23262,13 @@ void msrVoice::createMeasuresRepeatFromItsFirstMeasuresInVoice (
         // create a measure repeat
 #ifdef TRACE_OPTIONS
         if (
-          gTraceOptions->fTraceMeasures
+          gTraceOptions ()->fTraceMeasures
             ||
-          gTraceOptions->fTraceRepeats
+          gTraceOptions ()->fTraceRepeats
             ||
-          gTraceOptions->fTraceVoices
+          gTraceOptions ()->fTraceVoices
           ) {
-          gLogIOstream <<
+          gLogIOstream () <<
             "Creating a " <<
             measuresRepeatMeasuresNumber <<
             " measure, " <<
@@ -23301,23 +23284,23 @@ void msrVoice::createMeasuresRepeatFromItsFirstMeasuresInVoice (
         // print current voice contents
 #ifdef TRACE_OPTIONS
         if (
-          gTraceOptions->fTraceMeasures
+          gTraceOptions ()->fTraceMeasures
             ||
-          gTraceOptions->fTraceRepeats
+          gTraceOptions ()->fTraceRepeats
             ||
-          gTraceOptions->fTraceSegments
+          gTraceOptions ()->fTraceSegments
             ||
-          gTraceOptions->fTraceVoices
+          gTraceOptions ()->fTraceVoices
           ) {
-          gLogIOstream <<
+          gLogIOstream () <<
             endl <<
             "The current contents of voice \"" <<
             fVoiceName << "\" is:" <<
             endl;
 
-          gIndenter++;
-          print (gLogIOstream);
-          gIndenter--;
+          gIndenter ()++;
+          print (gLogIOstream ());
+          gIndenter ()--;
         }
 #endif
   
@@ -23344,7 +23327,7 @@ void msrVoice::createMeasuresRepeatFromItsFirstMeasuresInVoice (
             " available";
 
           msrInternalError (
-            gXml2lyOptions->fInputSourceName,
+            gXml2lyOptions ()->fInputSourceName,
             inputLineNumber,
             __FILE__, __LINE__,
             s.str ());
@@ -23374,15 +23357,15 @@ void msrVoice::createMeasuresRepeatFromItsFirstMeasuresInVoice (
         // and prepend them to the repeated segment
 #ifdef TRACE_OPTIONS
         if (
-          gTraceOptions->fTraceMeasures
+          gTraceOptions ()->fTraceMeasures
             ||
-          gTraceOptions->fTraceRepeats
+          gTraceOptions ()->fTraceRepeats
             ||
-          gTraceOptions->fTraceSegments
+          gTraceOptions ()->fTraceSegments
             ||
-          gTraceOptions->fTraceVoices
+          gTraceOptions ()->fTraceVoices
           ) {
-          gLogIOstream <<
+          gLogIOstream () <<
             "Removing the last " <<
             measuresRepeatMeasuresNumber <<
             " measures (to be repeated) from voice \"" <<
@@ -23410,7 +23393,7 @@ void msrVoice::createMeasuresRepeatFromItsFirstMeasuresInVoice (
             "attempting to create a measure repeat while another one is pending";
 
           msrInternalError (
-            gXml2lyOptions->fInputSourceName,
+            gXml2lyOptions ()->fInputSourceName,
             inputLineNumber,
             __FILE__, __LINE__,
             s.str ());
@@ -23426,15 +23409,15 @@ void msrVoice::createMeasuresRepeatFromItsFirstMeasuresInVoice (
         // create the measures repeat pattern
 #ifdef TRACE_OPTIONS
         if (
-          gTraceOptions->fTraceMeasures
+          gTraceOptions ()->fTraceMeasures
             ||
-          gTraceOptions->fTraceRepeats
+          gTraceOptions ()->fTraceRepeats
             ||
-          gTraceOptions->fTraceSegments
+          gTraceOptions ()->fTraceSegments
             ||
-          gTraceOptions->fTraceVoices
+          gTraceOptions ()->fTraceVoices
           ) {
-          gLogIOstream <<
+          gLogIOstream () <<
             "Creating a measure repeat pattern for voice \"" <<
             fVoiceName << "\" is:" <<
             endl;
@@ -23461,15 +23444,15 @@ void msrVoice::createMeasuresRepeatFromItsFirstMeasuresInVoice (
         // containing the first, yet incomplete, replica
 #ifdef TRACE_OPTIONS
         if (
-          gTraceOptions->fTraceMeasures
+          gTraceOptions ()->fTraceMeasures
             ||
-          gTraceOptions->fTraceRepeats
+          gTraceOptions ()->fTraceRepeats
             ||
-          gTraceOptions->fTraceSegments
+          gTraceOptions ()->fTraceSegments
             ||
-          gTraceOptions->fTraceVoices
+          gTraceOptions ()->fTraceVoices
           ) {
-          gLogIOstream <<
+          gLogIOstream () <<
             "Creating a new last segment with the first replica measure for voice \"" <<
             fVoiceName << "\"" <<
             ", line " << inputLineNumber <<
@@ -23484,22 +23467,22 @@ void msrVoice::createMeasuresRepeatFromItsFirstMeasuresInVoice (
         // print resulting voice contents
 #ifdef TRACE_OPTIONS
         if (
-          gTraceOptions->fTraceMeasures
+          gTraceOptions ()->fTraceMeasures
             ||
-          gTraceOptions->fTraceRepeats
+          gTraceOptions ()->fTraceRepeats
             ||
-          gTraceOptions->fTraceSegments
+          gTraceOptions ()->fTraceSegments
             ||
-          gTraceOptions->fTraceVoices
+          gTraceOptions ()->fTraceVoices
           ) {
-          gLogIOstream <<
+          gLogIOstream () <<
             "The resulting voice contents of voice \"" <<
             fVoiceName << "\" is:" <<
             endl;
 
-          gIndenter++;
-          print (gLogIOstream);
-          gIndenter--;
+          gIndenter ()++;
+          print (gLogIOstream ());
+          gIndenter ()--;
         }
 #endif
 
@@ -23525,7 +23508,7 @@ void msrVoice::appendPendingMeasuresRepeatToVoice (
             "attempting to append a pending measure repeat which doesn't exist";
 
           msrInternalError (
-            gXml2lyOptions->fInputSourceName,
+            gXml2lyOptions ()->fInputSourceName,
             inputLineNumber,
             __FILE__, __LINE__,
             s.str ());
@@ -23548,7 +23531,7 @@ void msrVoice::appendPendingMeasuresRepeatToVoice (
             "attempting to grab first measure of voice last segment, that contains none";
 
           msrInternalError (
-            gXml2lyOptions->fInputSourceName,
+            gXml2lyOptions ()->fInputSourceName,
             inputLineNumber,
             __FILE__, __LINE__,
             s.str ());
@@ -23562,15 +23545,15 @@ void msrVoice::appendPendingMeasuresRepeatToVoice (
         // remove the next measure from the last segment's measure list
 #ifdef TRACE_OPTIONS
         if (
-          gTraceOptions->fTraceMeasures
+          gTraceOptions ()->fTraceMeasures
             ||
-          gTraceOptions->fTraceRepeats
+          gTraceOptions ()->fTraceRepeats
             ||
-          gTraceOptions->fTraceSegments
+          gTraceOptions ()->fTraceSegments
             ||
-          gTraceOptions->fTraceVoices
+          gTraceOptions ()->fTraceVoices
           ) {
-          gLogIOstream <<
+          gLogIOstream () <<
             "Removing last measure in last segment in voice \"" <<
             fVoiceName << "\" is:" <<
             endl;
@@ -23582,15 +23565,15 @@ void msrVoice::appendPendingMeasuresRepeatToVoice (
         // create the measure repeat replicas contents
 #ifdef TRACE_OPTIONS
         if (
-          gTraceOptions->fTraceMeasures
+          gTraceOptions ()->fTraceMeasures
             ||
-          gTraceOptions->fTraceRepeats
+          gTraceOptions ()->fTraceRepeats
             ||
-          gTraceOptions->fTraceSegments
+          gTraceOptions ()->fTraceSegments
             ||
-          gTraceOptions->fTraceVoices
+          gTraceOptions ()->fTraceVoices
           ) {
-          gLogIOstream <<
+          gLogIOstream () <<
             "Creating a measure repeat replicas FAA contents for voice \"" <<
             fVoiceName << "\" is:" <<
             endl;
@@ -23614,15 +23597,15 @@ void msrVoice::appendPendingMeasuresRepeatToVoice (
 
 #ifdef TRACE_OPTIONS
         if (
-          gTraceOptions->fTraceMeasures
+          gTraceOptions ()->fTraceMeasures
             ||
-          gTraceOptions->fTraceRepeats
+          gTraceOptions ()->fTraceRepeats
             ||
-          gTraceOptions->fTraceSegments
+          gTraceOptions ()->fTraceSegments
             ||
-          gTraceOptions->fTraceVoices
+          gTraceOptions ()->fTraceVoices
           ) {
-          gLogIOstream <<
+          gLogIOstream () <<
             "Setting pending measure repeat replicas segment in voice \"" <<
             getVoiceName () <<
             "\"" <<
@@ -23636,15 +23619,15 @@ void msrVoice::appendPendingMeasuresRepeatToVoice (
 
 #ifdef TRACE_OPTIONS
         if (
-          gTraceOptions->fTraceMeasures
+          gTraceOptions ()->fTraceMeasures
             ||
-          gTraceOptions->fTraceRepeats
+          gTraceOptions ()->fTraceRepeats
             ||
-          gTraceOptions->fTraceSegments
+          gTraceOptions ()->fTraceSegments
             ||
-          gTraceOptions->fTraceVoices
+          gTraceOptions ()->fTraceVoices
           ) {
-          gLogIOstream <<
+          gLogIOstream () <<
             "Setting measures repeat segment to voice last segment CCC for voice \"" <<
             fVoiceName << "\"" <<
             endl;
@@ -23664,15 +23647,15 @@ void msrVoice::appendPendingMeasuresRepeatToVoice (
         // containing the next, yet incomplete, measure
 #ifdef TRACE_OPTIONS
         if (
-          gTraceOptions->fTraceMeasures
+          gTraceOptions ()->fTraceMeasures
             ||
-          gTraceOptions->fTraceRepeats
+          gTraceOptions ()->fTraceRepeats
             ||
-          gTraceOptions->fTraceSegments
+          gTraceOptions ()->fTraceSegments
             ||
-          gTraceOptions->fTraceVoices
+          gTraceOptions ()->fTraceVoices
           ) {
-          gLogIOstream <<
+          gLogIOstream () <<
             "Creating a new last segment with the AAA measures repeat next measure for voice \"" <<
             fVoiceName << "\"" <<
             ", line " << inputLineNumber <<
@@ -23712,7 +23695,7 @@ void msrVoice::createMeasuresRepeatAndAppendItToVoiceClone (
             "attempting to create a measures repeat while another one is pending";
 
           msrInternalError (
-            gXml2lyOptions->fInputSourceName,
+            gXml2lyOptions ()->fInputSourceName,
             inputLineNumber,
             __FILE__, __LINE__,
             s.str ());
@@ -23720,8 +23703,8 @@ void msrVoice::createMeasuresRepeatAndAppendItToVoiceClone (
 
         // create the measures repeat
 #ifdef TRACE_OPTIONS
-        if (gTraceOptions->fTraceRepeats) {
-          gLogIOstream <<
+        if (gTraceOptions ()->fTraceRepeats) {
+          gLogIOstream () <<
             "Creating and appending a measures repeat in voice \"" <<
             getVoiceName () <<
             "\"" <<
@@ -23739,8 +23722,8 @@ void msrVoice::createMeasuresRepeatAndAppendItToVoiceClone (
 
         // create a measures repeat pattern from current last segment
 #ifdef TRACE_OPTIONS
-        if (gTraceOptions->fTraceRepeats) {
-          gLogIOstream <<
+        if (gTraceOptions ()->fTraceRepeats) {
+          gLogIOstream () <<
             "Creating a measures repeat pattern from current last segment in voice \"" <<
             getVoiceName () <<
             "\"" <<
@@ -23763,8 +23746,8 @@ void msrVoice::createMeasuresRepeatAndAppendItToVoiceClone (
 
         // set the measures repeat pattern
 #ifdef TRACE_OPTIONS
-        if (gTraceOptions->fTraceRepeats) {
-          gLogIOstream <<
+        if (gTraceOptions ()->fTraceRepeats) {
+          gLogIOstream () <<
             "Setting repeat common part in voice \"" <<
             getVoiceName () <<
             "\"" <<
@@ -23778,8 +23761,8 @@ void msrVoice::createMeasuresRepeatAndAppendItToVoiceClone (
 
         // create a new last segment containing a new measure for the voice
 #ifdef TRACE_OPTIONS
-        if (gTraceOptions->fTraceSegments || gTraceOptions->fTraceVoices) {
-          gLogIOstream <<
+        if (gTraceOptions ()->fTraceSegments || gTraceOptions ()->fTraceVoices) {
+          gLogIOstream () <<
             "Creating a new last segment containing a new measure for voice \"" <<
             fVoiceName << "\"" <<
             ", line " << inputLineNumber <<
@@ -23793,8 +23776,8 @@ void msrVoice::createMeasuresRepeatAndAppendItToVoiceClone (
 
         // append the measures repeat to the list of initial elements
 #ifdef TRACE_OPTIONS
-        if (gTraceOptions->fTraceRepeats) {
-          gLogIOstream <<
+        if (gTraceOptions ()->fTraceRepeats) {
+          gLogIOstream () <<
             "Appending measures repeat to the list of initial elements in voice \"" <<
             getVoiceName () <<
             "\"" <<
@@ -23809,15 +23792,15 @@ void msrVoice::createMeasuresRepeatAndAppendItToVoiceClone (
         // containing the next, yet incomplete, measure
 #ifdef TRACE_OPTIONS
         if (
-          gTraceOptions->fTraceMeasures
+          gTraceOptions ()->fTraceMeasures
             ||
-          gTraceOptions->fTraceRepeats
+          gTraceOptions ()->fTraceRepeats
             ||
-          gTraceOptions->fTraceSegments
+          gTraceOptions ()->fTraceSegments
             ||
-          gTraceOptions->fTraceVoices
+          gTraceOptions ()->fTraceVoices
           ) {
-          gLogIOstream <<
+          gLogIOstream () <<
             "Creating a new last segment for voice \"" <<
             fVoiceName << "\"" <<
             ", line " << inputLineNumber <<
@@ -23836,8 +23819,8 @@ void msrVoice::setVoiceContainsMultipleRests (
   int inputLineNumber)
 {
 #ifdef TRACE_OPTIONS
-  if (gTraceOptions->fTraceRepeats) {
-    gLogIOstream <<
+  if (gTraceOptions ()->fTraceRepeats) {
+    gLogIOstream () <<
       "Voice \"" <<
       getVoiceName () <<
       "\"" <<
@@ -23861,8 +23844,8 @@ void msrVoice::createMultipleRestInVoice (
       {
         // create a multiple rest
 #ifdef TRACE_OPTIONS
-        if (gTraceOptions->fTraceRepeats) {
-          gLogIOstream <<
+        if (gTraceOptions ()->fTraceRepeats) {
+          gLogIOstream () <<
             "Creating a multiple rest in voice \"" <<
             getVoiceName () <<
             "\"" <<
@@ -23908,7 +23891,7 @@ void msrVoice::createMultipleRestInVoice (
             "attempting to create a multiple rest while another one is pending";
 
           msrInternalError (
-            gXml2lyOptions->fInputSourceName,
+            gXml2lyOptions ()->fInputSourceName,
             inputLineNumber,
             __FILE__, __LINE__,
             s.str ());
@@ -23923,8 +23906,8 @@ void msrVoice::createMultipleRestInVoice (
 
          // remember fVoicePendingMultipleRest for later next measure number setting
 #ifdef TRACE_OPTIONS
-        if (gTraceOptions->fTraceRepeats) {
-          gLogIOstream <<
+        if (gTraceOptions ()->fTraceRepeats) {
+          gLogIOstream () <<
             "Registering multiple rest as waiting for its next measure number" <<
             ", multipleRestMeasuresNumber = " <<
             multipleRestMeasuresNumber <<
@@ -23941,8 +23924,8 @@ void msrVoice::createMultipleRestInVoice (
           multipleRestMeasuresNumber;
 
 #ifdef TRACE_OPTIONS
-        if (gTraceOptions->fTraceRepeats) {
-          gLogIOstream <<
+        if (gTraceOptions ()->fTraceRepeats) {
+          gLogIOstream () <<
             "Setting fVoiceRemainingRestMeasures to '" <<
             fVoiceRemainingRestMeasures <<
             "' in voice \"" <<
@@ -23954,8 +23937,8 @@ void msrVoice::createMultipleRestInVoice (
         // create a new segment to collect the multiple rest measures,
         // containing the first, rest measure
 #ifdef TRACE_OPTIONS
-        if (gTraceOptions->fTraceSegments || gTraceOptions->fTraceVoices) {
-          gLogIOstream <<
+        if (gTraceOptions ()->fTraceSegments || gTraceOptions ()->fTraceVoices) {
+          gLogIOstream () <<
             "Creating a new last segment containing the first rest measure in voice \"" <<
             fVoiceName << "\"" <<
             ", line " << inputLineNumber <<
@@ -23980,15 +23963,15 @@ void msrVoice::createMultipleRestInVoice (
             
         // print resulting voice contents
 #ifdef TRACE_OPTIONS
-        if (gTraceOptions->fTraceSegments || gTraceOptions->fTraceVoices) {
-          gLogIOstream <<
+        if (gTraceOptions ()->fTraceSegments || gTraceOptions ()->fTraceVoices) {
+          gLogIOstream () <<
             "The resulting voice contents of voice \"" <<
             fVoiceName << "\" is:" <<
             endl;
   
-          gIndenter++;
-          print (gLogIOstream);
-          gIndenter--;
+          gIndenter ()++;
+          print (gLogIOstream ());
+          gIndenter ()--;
         }
 #endif
 
@@ -24007,8 +23990,8 @@ void msrVoice::appendPendingMultipleRestToVoice (
     case msrVoice::kFiguredBassVoice:
       {
 #ifdef TRACE_OPTIONS
-        if (gTraceOptions->fTraceRepeats) {
-          gLogIOstream <<
+        if (gTraceOptions ()->fTraceRepeats) {
+          gLogIOstream () <<
             "Appending the pending multiple rest to voice \"" <<
             getVoiceName () <<
             "\"" <<
@@ -24025,7 +24008,7 @@ void msrVoice::appendPendingMultipleRestToVoice (
             "attempting to append a pending multiple rest which doesn't exist";
 
           msrInternalError (
-            gXml2lyOptions->fInputSourceName,
+            gXml2lyOptions ()->fInputSourceName,
             inputLineNumber,
             __FILE__, __LINE__,
             s.str ());
@@ -24047,7 +24030,7 @@ void msrVoice::appendPendingMultipleRestToVoice (
             "attempting to grab first measure of voice last segment, that contains none";
 
           msrInternalError (
-            gXml2lyOptions->fInputSourceName,
+            gXml2lyOptions ()->fInputSourceName,
             inputLineNumber,
             __FILE__, __LINE__,
             s.str ());
@@ -24057,17 +24040,17 @@ void msrVoice::appendPendingMultipleRestToVoice (
           nextMeasureAfterMultipleRest =
             voiceLastSegmentMeasureList.back ();
 
-        if (gTraceOptions->fTraceSegments || gTraceOptions->fTraceVoices) {
-          gLogIOstream <<
+        if (gTraceOptions ()->fTraceSegments || gTraceOptions ()->fTraceVoices) {
+          gLogIOstream () <<
             endl <<
             "==========> nextMeasureAfterMultipleRest:" <<
             endl;
   
             
           nextMeasureAfterMultipleRest->
-            print (gLogIOstream);
+            print (gLogIOstream ());
             
-          gLogIOstream <<
+          gLogIOstream () <<
             endl;
         }
         */
@@ -24077,8 +24060,8 @@ void msrVoice::appendPendingMultipleRestToVoice (
 
         // create the multiple rest contents
 #ifdef TRACE_OPTIONS
-        if (gTraceOptions->fTraceSegments || gTraceOptions->fTraceVoices) {
-          gLogIOstream <<
+        if (gTraceOptions ()->fTraceSegments || gTraceOptions ()->fTraceVoices) {
+          gLogIOstream () <<
             "Creating a measure pattern for voice \"" <<
             fVoiceName << "\" is:" <<
             endl;
@@ -24093,8 +24076,8 @@ void msrVoice::appendPendingMultipleRestToVoice (
 
         // set voice last segment as the multiple rest segment
 #ifdef TRACE_OPTIONS
-        if (gTraceOptions->fTraceRepeats) {
-          gLogIOstream <<
+        if (gTraceOptions ()->fTraceRepeats) {
+          gLogIOstream () <<
             "Setting current last segment as multiple rest segment in voice \"" <<
             getVoiceName () <<
             "\"" <<
@@ -24108,8 +24091,8 @@ void msrVoice::appendPendingMultipleRestToVoice (
 
         // set multipleRestContents as the multiple rest contents
 #ifdef TRACE_OPTIONS
-        if (gTraceOptions->fTraceRepeats) {
-          gLogIOstream <<
+        if (gTraceOptions ()->fTraceRepeats) {
+          gLogIOstream () <<
             "Setting multiple rest contents in voice \"" <<
             getVoiceName () <<
             "\"" <<
@@ -24128,8 +24111,8 @@ void msrVoice::appendPendingMultipleRestToVoice (
         // create a new segment to collect the remainder of the voice,
         // containing the next, yet incomplete, measure
 #ifdef TRACE_OPTIONS
-        if (gTraceOptions->fTraceSegments || gTraceOptions->fTraceVoices) {
-          gLogIOstream <<
+        if (gTraceOptions ()->fTraceSegments || gTraceOptions ()->fTraceVoices) {
+          gLogIOstream () <<
             "Creating a new last segment with the measure after the multiple rests for voice \"" <<
             fVoiceName << "\"" <<
             ", line " << inputLineNumber <<
@@ -24149,15 +24132,15 @@ void msrVoice::appendPendingMultipleRestToVoice (
 */
         // print resulting voice contents
 #ifdef TRACE_OPTIONS
-        if (gTraceOptions->fTraceSegments || gTraceOptions->fTraceVoices) {
-          gLogIOstream <<
+        if (gTraceOptions ()->fTraceSegments || gTraceOptions ()->fTraceVoices) {
+          gLogIOstream () <<
             "The resulting voice contents of voice \"" <<
             fVoiceName << "\" is:" <<
             endl;
 
-          gIndenter++;
-          print (gLogIOstream);
-          gIndenter--;
+          gIndenter ()++;
+          print (gLogIOstream ());
+          gIndenter ()--;
         }
 #endif
 
@@ -24193,10 +24176,10 @@ void msrVoice::prepareForMultipleRestInVoiceClone (
   
 #ifdef TRACE_OPTIONS
           if (
-            gTraceOptions->fTraceRepeatsDetails
+            gTraceOptions ()->fTraceRepeatsDetails
               ||
-            gTraceOptions->fTraceVoicesDetails) {
-            gLogIOstream <<
+            gTraceOptions ()->fTraceVoicesDetails) {
+            gLogIOstream () <<
               endl <<
               "*********>> Current voice HHH \"" <<
               getVoiceName () <<
@@ -24205,9 +24188,9 @@ void msrVoice::prepareForMultipleRestInVoiceClone (
               " contains:" <<
               endl;
   
-            print (gLogIOstream);
+            print (gLogIOstream ());
   
-            gLogIOstream <<
+            gLogIOstream () <<
               "<<*********" <<
               endl <<
               endl;
@@ -24224,8 +24207,8 @@ void msrVoice::prepareForMultipleRestInVoiceClone (
 
             // create a new last segment containing a new measure for the voice
 #ifdef TRACE_OPTIONS
-            if (gTraceOptions->fTraceSegments || gTraceOptions->fTraceVoices) {
-              gLogIOstream <<
+            if (gTraceOptions ()->fTraceSegments || gTraceOptions ()->fTraceVoices) {
+              gLogIOstream () <<
                 "Creating a new last segment containing a new measure for multiple rest in voice \"" <<
                 fVoiceName << "\"" <<
                 ", line " << inputLineNumber <<
@@ -24238,10 +24221,10 @@ void msrVoice::prepareForMultipleRestInVoiceClone (
   
 #ifdef TRACE_OPTIONS
             if (
-              gTraceOptions->fTraceRepeatsDetails
+              gTraceOptions ()->fTraceRepeatsDetails
                 ||
-              gTraceOptions->fTraceVoicesDetails) {
-              gLogIOstream <<
+              gTraceOptions ()->fTraceVoicesDetails) {
+              gLogIOstream () <<
                 endl <<
                 "*********>> Current voice KKK \"" <<
                 getVoiceName () <<
@@ -24250,9 +24233,9 @@ void msrVoice::prepareForMultipleRestInVoiceClone (
                 " contains:" <<
                 endl;
     
-              print (gLogIOstream);
+              print (gLogIOstream ());
     
-              gLogIOstream <<
+              gLogIOstream () <<
                 "<<*********" <<
                 endl <<
                 endl;
@@ -24265,8 +24248,8 @@ void msrVoice::prepareForMultipleRestInVoiceClone (
           
             // move current last segment to the list of initial elements
 #ifdef TRACE_OPTIONS
-            if (gTraceOptions->fTraceRepeats) {
-              gLogIOstream <<
+            if (gTraceOptions ()->fTraceRepeats) {
+              gLogIOstream () <<
                 "Appending voice last segment to the initial elements in voice \"" <<
                 getVoiceName () <<
                 "\"" <<
@@ -24280,8 +24263,8 @@ void msrVoice::prepareForMultipleRestInVoiceClone (
   
             // create a new last segment containing a new measure for the voice
 #ifdef TRACE_OPTIONS
-            if (gTraceOptions->fTraceSegments || gTraceOptions->fTraceVoices) {
-              gLogIOstream <<
+            if (gTraceOptions ()->fTraceSegments || gTraceOptions ()->fTraceVoices) {
+              gLogIOstream () <<
                 "Creating a new last segment containing a new measure for voice \"" <<
                 fVoiceName << "\"" <<
                 ", line " << inputLineNumber <<
@@ -24295,10 +24278,10 @@ void msrVoice::prepareForMultipleRestInVoiceClone (
   
 #ifdef TRACE_OPTIONS
             if (
-              gTraceOptions->fTraceRepeatsDetails
+              gTraceOptions ()->fTraceRepeatsDetails
                 ||
-              gTraceOptions->fTraceVoicesDetails) {
-              gLogIOstream <<
+              gTraceOptions ()->fTraceVoicesDetails) {
+              gLogIOstream () <<
                 endl <<
                 "*********>> Current voice PPP \"" <<
                 getVoiceName () <<
@@ -24307,9 +24290,9 @@ void msrVoice::prepareForMultipleRestInVoiceClone (
                 " contains:" <<
                 endl;
     
-              print (gLogIOstream);
+              print (gLogIOstream ());
     
-              gLogIOstream <<
+              gLogIOstream () <<
                 "<<*********" <<
                 endl <<
                 endl;
@@ -24332,8 +24315,8 @@ void msrVoice::appendMultipleRestCloneToVoice (
     case msrVoice::kFiguredBassVoice:
       {
 #ifdef TRACE_OPTIONS
-        if (gTraceOptions->fTraceRepeats) {
-          gLogIOstream <<
+        if (gTraceOptions ()->fTraceRepeats) {
+          gLogIOstream () <<
             "Appending multiple rest clone '" <<
             multipleRestClone->asString () <<
             " to voice clone \"" <<
@@ -24383,15 +24366,15 @@ void msrVoice::appendMultipleRestCloneToVoice (
 
         // print resulting voice contents
 #ifdef TRACE_OPTIONS
-        if (gTraceOptions->fTraceSegments || gTraceOptions->fTraceVoices) {
-          gLogIOstream <<
+        if (gTraceOptions ()->fTraceSegments || gTraceOptions ()->fTraceVoices) {
+          gLogIOstream () <<
             "The resulting voice contents of voice \"" <<
             fVoiceName << "\" is:" <<
             endl;
 
-          gIndenter++;
-          print (gLogIOstream);
-          gIndenter--;
+          gIndenter ()++;
+          print (gLogIOstream ());
+          gIndenter ()--;
         }
 #endif
       }
@@ -24414,8 +24397,8 @@ void msrVoice::appendRepeatCloneToVoice (
     case msrVoice::kFiguredBassVoice:
       {
 #ifdef TRACE_OPTIONS
-        if (gTraceOptions->fTraceRepeats) {
-          gLogIOstream <<
+        if (gTraceOptions ()->fTraceRepeats) {
+          gLogIOstream () <<
             "Appending repeat clone to voice clone \"" <<
             getVoiceName () <<  "\"" <<
             endl;
@@ -24424,8 +24407,8 @@ void msrVoice::appendRepeatCloneToVoice (
       
         // create a repeat common part from current last segment
 #ifdef TRACE_OPTIONS
-        if (gTraceOptions->fTraceRepeats) {
-          gLogIOstream <<
+        if (gTraceOptions ()->fTraceRepeats) {
+          gLogIOstream () <<
             "Creating a repeat clone common part from current last segment in voice \"" <<
             getVoiceName () <<
             "\"" <<
@@ -24441,8 +24424,8 @@ void msrVoice::appendRepeatCloneToVoice (
 
         // move voice last segment into the repeat common part
 #ifdef TRACE_OPTIONS
-        if (gTraceOptions->fTraceRepeats) {
-          gLogIOstream <<
+        if (gTraceOptions ()->fTraceRepeats) {
+          gLogIOstream () <<
             "Append the segment to use to the repeat common part in voice \"" <<
             getVoiceName () <<
             "\"" <<
@@ -24457,8 +24440,8 @@ void msrVoice::appendRepeatCloneToVoice (
 
         // set repeatCLone's common part
 #ifdef TRACE_OPTIONS
-        if (gTraceOptions->fTraceRepeats) {
-          gLogIOstream <<
+        if (gTraceOptions ()->fTraceRepeats) {
+          gLogIOstream () <<
             "Setting repeat clone common part in voice \"" <<
             getVoiceName () <<
             "\"" <<
@@ -24473,8 +24456,8 @@ void msrVoice::appendRepeatCloneToVoice (
 /* JMI
         // set current last segment as the repeat common segment
 #ifdef TRACE_OPTIONS
-        if (gTraceOptions->fTraceRepeats) {
-          gLogIOstream <<
+        if (gTraceOptions ()->fTraceRepeats) {
+          gLogIOstream () <<
             "Segging current last segment as repeat common segment in voice \"" <<
             getVoiceName () <<
             "\"" <<
@@ -24488,8 +24471,8 @@ void msrVoice::appendRepeatCloneToVoice (
  */         
         // register repeat clone as the (new) current repeat
 #ifdef TRACE_OPTIONS
-        if (gTraceOptions->fTraceRepeats) {
-          gLogIOstream <<
+        if (gTraceOptions ()->fTraceRepeats) {
+          gLogIOstream () <<
             "Registering repeat clone as the new current repeat in voice \"" <<
             getVoiceName () <<
             "\"" <<
@@ -24506,8 +24489,8 @@ void msrVoice::appendRepeatCloneToVoice (
       
         // create a new segment for the voice
 #ifdef TRACE_OPTIONS
-        if (gTraceOptions->fTraceSegments || gTraceOptions->fTraceVoices) {
-          gLogIOstream <<
+        if (gTraceOptions ()->fTraceSegments || gTraceOptions ()->fTraceVoices) {
+          gLogIOstream () <<
             "Creating a new last segment for voice BOF JMI \"" <<
             fVoiceName << "\"" <<
              ", line " << inputLineNumber <<
@@ -24534,8 +24517,8 @@ void msrVoice::appendRepeatEndingToVoice (
     case msrVoice::kFiguredBassVoice:
       {
 #ifdef TRACE_OPTIONS
-        if (gTraceOptions->fTraceRepeats) {
-          gLogIOstream <<
+        if (gTraceOptions ()->fTraceRepeats) {
+          gLogIOstream () <<
             "Appending a repeat ending to voice \"" <<
             getVoiceName () <<  "\"" <<
             ", line " << inputLineNumber <<
@@ -24543,7 +24526,7 @@ void msrVoice::appendRepeatEndingToVoice (
         }
 #endif
 
-        gIndenter++;
+        gIndenter ()++;
 
         // sanity check
         msrAssert (
@@ -24562,8 +24545,8 @@ void msrVoice::appendRepeatEndingToVoice (
       
         // add the repeat ending it to the voice current repeat
 #ifdef TRACE_OPTIONS
-        if (gTraceOptions->fTraceRepeats) {
-          gLogIOstream <<
+        if (gTraceOptions ()->fTraceRepeats) {
+          gLogIOstream () <<
             "Appending a " <<
             msrRepeatEnding::repeatEndingKindAsString (
               repeatEndingKind) <<
@@ -24580,12 +24563,12 @@ void msrVoice::appendRepeatEndingToVoice (
         // create a new last segment containing a new measure for the voice
 #ifdef TRACE_OPTIONS
         if (
-          gTraceOptions->fTraceRepeats
+          gTraceOptions ()->fTraceRepeats
             ||
-          gTraceOptions->fTraceVoices
+          gTraceOptions ()->fTraceVoices
             ||
-          gTraceOptions->fTraceSegments) {
-          gLogIOstream <<
+          gTraceOptions ()->fTraceSegments) {
+          gLogIOstream () <<
      // JMI       "Creating a new last segment containing a new measure for voice \"" <<
             "Creating a new last segment for voice \"" <<
             fVoiceName << "\"" <<
@@ -24615,7 +24598,7 @@ void msrVoice::appendRepeatEndingToVoice (
             break;
         } // switch
 
-        gIndenter--;
+        gIndenter ()--;
       }
       break;
   } // switch
@@ -24630,8 +24613,8 @@ void msrVoice::appendMeasuresRepeatReplicaToVoice (
     case msrVoice::kFiguredBassVoice:
       {
 #ifdef TRACE_OPTIONS
-        if (gTraceOptions->fTraceRepeats) {
-          gLogIOstream <<
+        if (gTraceOptions ()->fTraceRepeats) {
+          gLogIOstream () <<
             "Appending a measures repeat replica to voice \"" <<
             getVoiceName () <<  "\"" <<
             ", line " << inputLineNumber <<
@@ -24646,14 +24629,14 @@ void msrVoice::appendMeasuresRepeatReplicaToVoice (
               getMeasureFullLength ();
 
 #ifdef TRACE_OPTIONS
-        if (gTraceOptions->fTraceRepeats) { // JMI
-          gLogIOstream <<
+        if (gTraceOptions ()->fTraceRepeats) { // JMI
+          gLogIOstream () <<
             endl <<
             "***********" <<
             endl <<
             endl;
-          print (gLogIOstream);
-          gLogIOstream <<
+          print (gLogIOstream ());
+          gLogIOstream () <<
             "***********" <<
             endl <<
             endl;
@@ -24679,8 +24662,8 @@ void msrVoice::appendMeasuresRepeatReplicaToVoice (
         
         // set the measures repeat replicas in the voice current measures repeat
 #ifdef TRACE_OPTIONS
-        if (gTraceOptions->fTraceRepeats) {
-          gLogIOstream <<
+        if (gTraceOptions ()->fTraceRepeats) {
+          gLogIOstream () <<
             "Setting the measures repeat replica to current measures repeat BBB in voice \"" <<
             fVoiceName <<
             "\"" <<
@@ -24694,8 +24677,8 @@ void msrVoice::appendMeasuresRepeatReplicaToVoice (
 
         // create a new last segment containing a new measure for the voice
 #ifdef TRACE_OPTIONS
-        if (gTraceOptions->fTraceSegments || gTraceOptions->fTraceVoices) {
-          gLogIOstream <<
+        if (gTraceOptions ()->fTraceSegments || gTraceOptions ()->fTraceVoices) {
+          gLogIOstream () <<
             "Creating a new last segment containing a new measure for voice \"" <<
             fVoiceName << "\"" <<
             ", line " << inputLineNumber <<
@@ -24714,7 +24697,7 @@ void msrVoice::appendMeasuresRepeatReplicaToVoice (
 void msrVoice:: appendRepeatEndingCloneToVoice ( // JMI
   S_msrRepeatEnding repeatEndingClone)
 {
-  gIndenter++;
+  gIndenter ()++;
   
   switch (fVoiceKind) {
     case msrVoice::kRegularVoice:
@@ -24723,8 +24706,8 @@ void msrVoice:: appendRepeatEndingCloneToVoice ( // JMI
       {
         // add the repeat ending it to the voice current repeat
 #ifdef TRACE_OPTIONS
-        if (gTraceOptions->fTraceRepeats) {
-          gLogIOstream <<
+        if (gTraceOptions ()->fTraceRepeats) {
+          gLogIOstream () <<
             "Appending repeat ending clone to current repeat in voice \"" <<
             fVoiceName <<
             "\"" <<
@@ -24742,8 +24725,8 @@ void msrVoice:: appendRepeatEndingCloneToVoice ( // JMI
       
         // create a new segment for the voice
 #ifdef TRACE_OPTIONS
-        if (gTraceOptions->fTraceSegments || gTraceOptions->fTraceVoices) {
-          gLogIOstream <<
+        if (gTraceOptions ()->fTraceSegments || gTraceOptions ()->fTraceVoices) {
+          gLogIOstream () <<
             "Creating a new last segment for voice \"" <<
             fVoiceName <<
             "\"" <<
@@ -24758,14 +24741,14 @@ void msrVoice:: appendRepeatEndingCloneToVoice ( // JMI
       break;
   } // switch
 
-  gIndenter--;
+  gIndenter ()--;
 }
 
 void msrVoice::prependBarlineToVoice (S_msrBarline barline)
 {
 #ifdef TRACE_OPTIONS
-  if (gTraceOptions->fTraceRepeats) {
-    gLogIOstream <<
+  if (gTraceOptions ()->fTraceRepeats) {
+    gLogIOstream () <<
       "Prepending barline '" <<
       barline->asString () <<
       "' to voice \"" << getVoiceName () << "\"" <<
@@ -24778,19 +24761,19 @@ void msrVoice::prependBarlineToVoice (S_msrBarline barline)
   appendAFirstMeasureToVoiceIfNotYetDone (
     barline->getInputLineNumber ());
 
-  gIndenter++;
+  gIndenter ()++;
   
   fVoiceLastSegment->
     prependBarlineToSegment (barline);
 
-  gIndenter--;
+  gIndenter ()--;
 }
 
 void msrVoice::appendBarlineToVoice (S_msrBarline barline)
 {
 #ifdef TRACE_OPTIONS
-  if (gTraceOptions->fTraceRepeats) {
-    gLogIOstream <<
+  if (gTraceOptions ()->fTraceRepeats) {
+    gLogIOstream () <<
       "Appending barline '" <<
       barline->asString () <<
       "' to voice \"" << getVoiceName () << "\"" <<
@@ -24803,19 +24786,19 @@ void msrVoice::appendBarlineToVoice (S_msrBarline barline)
  // appendAFirstMeasureToVoiceIfNotYetDone (
  //JMI   barline->getInputLineNumber ());
 
-  gIndenter++;
+  gIndenter ()++;
   
   fVoiceLastSegment->
     appendBarlineToSegment (barline);
 
-  gIndenter--;
+  gIndenter ()--;
 }
 
 void msrVoice::appendSegnoToVoice (S_msrSegno segno)
 {
 #ifdef TRACE_OPTIONS
-  if (gTraceOptions->fTraceRepeats) {
-    gLogIOstream <<
+  if (gTraceOptions ()->fTraceRepeats) {
+    gLogIOstream () <<
       "Appending a segno to voice \"" << getVoiceName () << "\"" <<
       endl;
   }
@@ -24832,8 +24815,8 @@ void msrVoice::appendSegnoToVoice (S_msrSegno segno)
 void msrVoice::appendCodaToVoice (S_msrCoda coda)
 {
 #ifdef TRACE_OPTIONS
-  if (gTraceOptions->fTraceRepeats) {
-    gLogIOstream <<
+  if (gTraceOptions ()->fTraceRepeats) {
+    gLogIOstream () <<
       "Appending a coda to voice \"" << getVoiceName () << "\"" <<
       ":" <<
       endl;
@@ -24851,8 +24834,8 @@ void msrVoice::appendCodaToVoice (S_msrCoda coda)
 void msrVoice::appendEyeGlassesToVoice (S_msrEyeGlasses eyeGlasses)
 {
 #ifdef TRACE_OPTIONS
-  if (gTraceOptions->fTraceNotes) {
-    gLogIOstream <<
+  if (gTraceOptions ()->fTraceNotes) {
+    gLogIOstream () <<
       "Appending a eyeGlasses to voice \"" << getVoiceName () << "\"" <<
       endl;
   }
@@ -24869,8 +24852,8 @@ void msrVoice::appendEyeGlassesToVoice (S_msrEyeGlasses eyeGlasses)
 void msrVoice::appendPedalToVoice (S_msrPedal pedal)
 {
 #ifdef TRACE_OPTIONS
-  if (gTraceOptions->fTraceNotes) {
-    gLogIOstream <<
+  if (gTraceOptions ()->fTraceNotes) {
+    gLogIOstream () <<
       "Appending a pedal to voice \"" << getVoiceName () << "\"" <<
       endl;
   }
@@ -24887,8 +24870,8 @@ void msrVoice::appendPedalToVoice (S_msrPedal pedal)
 void msrVoice::appendDampToVoice (S_msrDamp damp)
 {
 #ifdef TRACE_OPTIONS
-  if (gTraceOptions->fTraceNotes) {
-    gLogIOstream <<
+  if (gTraceOptions ()->fTraceNotes) {
+    gLogIOstream () <<
       "Appending a damp to voice \"" << getVoiceName () << "\"" <<
       endl;
   }
@@ -24905,8 +24888,8 @@ void msrVoice::appendDampToVoice (S_msrDamp damp)
 void msrVoice::appendDampAllToVoice (S_msrDampAll dampAll)
 {
 #ifdef TRACE_OPTIONS
-  if (gTraceOptions->fTraceNotes) {
-    gLogIOstream <<
+  if (gTraceOptions ()->fTraceNotes) {
+    gLogIOstream () <<
       "Appending a damp all to voice \"" << getVoiceName () << "\"" <<
       endl;
   }
@@ -24925,8 +24908,8 @@ S_msrElement msrVoice::removeLastElementFromVoice (  // JMI
   int inputLineNumber)
 {
 #ifdef TRACE_OPTIONS
-  if (gTraceOptions->fTraceVoices) {
-    gLogIOstream <<
+  if (gTraceOptions ()->fTraceVoices) {
+    gLogIOstream () <<
       "Removing last note" <<
       " from voice " << getVoiceName () <<
       endl;
@@ -24944,8 +24927,8 @@ void msrVoice::removeNoteFromVoice (
   S_msrNote note)
 {
 #ifdef TRACE_OPTIONS
-  if (gTraceOptions->fTraceChords) {
-    gLogIOstream <<
+  if (gTraceOptions ()->fTraceChords) {
+    gLogIOstream () <<
       "Removing note '" <<
       note->asShortString () <<
       "' from voice \"" << getVoiceName () << "\"" <<
@@ -24953,14 +24936,14 @@ void msrVoice::removeNoteFromVoice (
   }
 #endif
 
-  gIndenter++;
+  gIndenter ()++;
   
   fVoiceLastSegment->
     removeNoteFromSegment (
       inputLineNumber,
       note);
 
-  gIndenter--;
+  gIndenter ()--;
 }
 
 void msrVoice::removeElementFromVoice (
@@ -24968,8 +24951,8 @@ void msrVoice::removeElementFromVoice (
   S_msrElement element)
 {
 #ifdef TRACE_OPTIONS
-  if (gTraceOptions->fTraceChords || gTraceOptions->fTraceGraceNotes) {
-    gLogIOstream <<
+  if (gTraceOptions ()->fTraceChords || gTraceOptions ()->fTraceGraceNotes) {
+    gLogIOstream () <<
       "Removing element '" <<
       element->asShortString () <<
       "' from voice \"" << getVoiceName () << "\"" <<
@@ -24977,22 +24960,22 @@ void msrVoice::removeElementFromVoice (
   }
 #endif
 
-  gIndenter++;
+  gIndenter ()++;
   
   fVoiceLastSegment->
     removeElementFromSegment (
       inputLineNumber,
       element);
 
-  gIndenter--;
+  gIndenter ()--;
 }
 
 S_msrMeasure msrVoice::removeLastMeasureFromVoice (
   int inputLineNumber)
 {
 #ifdef TRACE_OPTIONS
-  if (gTraceOptions->fTraceMeasures || gTraceOptions->fTraceVoices) {
-    gLogIOstream <<
+  if (gTraceOptions ()->fTraceMeasures || gTraceOptions ()->fTraceVoices) {
+    gLogIOstream () <<
       "Removing last measure from voice \"" <<
       getVoiceName () <<
       "\"" <<
@@ -25000,7 +24983,7 @@ S_msrMeasure msrVoice::removeLastMeasureFromVoice (
   }
 #endif
 
-  gIndenter++;
+  gIndenter ()++;
 
   // remove (new) last measure
   S_msrMeasure result =
@@ -25008,7 +24991,7 @@ S_msrMeasure msrVoice::removeLastMeasureFromVoice (
       removeLastMeasureFromSegment (
         inputLineNumber);
 
-  gIndenter--;
+  gIndenter ()--;
 
   // return it
   return result;
@@ -25018,30 +25001,30 @@ void msrVoice::finalizeCurrentMeasureInVoice (
   int inputLineNumber)
 {
 #ifdef TRACE_OPTIONS
-  if (gTraceOptions->fTraceMeasures || gTraceOptions->fTraceVoices) {
-    gLogIOstream <<
+  if (gTraceOptions ()->fTraceMeasures || gTraceOptions ()->fTraceVoices) {
+    gLogIOstream () <<
       "Finalizing current measure in voice \"" <<
       getVoiceName () <<
       "\"" <<
       ", line " << inputLineNumber <<
       endl;
       
-    gIndenter++;
+    gIndenter ()++;
 
     const int fieldWidth = 26;
     
-    gLogIOstream << left <<
+    gLogIOstream () << left <<
       setw (fieldWidth) <<
       "partMeasureLengthHighTide" << " = " <<
       fetchVoicePartUplink ()->
         getPartMeasureLengthHighTide () <<
       endl;
         
-    gIndenter--;
+    gIndenter ()--;
   }
 #endif
 
-  gIndenter++;
+  gIndenter ()++;
   
   // make sure the voice's last segment exists
   appendAFirstMeasureToVoiceIfNotYetDone (
@@ -25071,7 +25054,7 @@ void msrVoice::finalizeCurrentMeasureInVoice (
     } // for
   }
 
-  gIndenter--;
+  gIndenter ()--;
 }
 
 
@@ -25081,8 +25064,8 @@ void msrVoice:: collectVoiceMeasuresIntoFlatList (
   // collect measures from the initial elements if any
   if (fVoiceInitialElementsList.size ()) {
 #ifdef TRACE_OPTIONS
-    if (gTraceOptions->fTraceVoices) {
-      gLogIOstream <<
+    if (gTraceOptions ()->fTraceVoices) {
+      gLogIOstream () <<
         "Collecting measures from the initial elements into voice \"" <<
         getVoiceName () <<
         "s measures flat list" <<
@@ -25096,8 +25079,8 @@ void msrVoice:: collectVoiceMeasuresIntoFlatList (
   // collect measures from the last segment if any
   if (fVoiceLastSegment) {
 #ifdef TRACE_OPTIONS
-    if (gTraceOptions->fTraceVoices) {
-      gLogIOstream <<
+    if (gTraceOptions ()->fTraceVoices) {
+      gLogIOstream () <<
         "Collecting measures from the last segment into voice \"" <<
         getVoiceName () <<
         "s measures flat list" <<
@@ -25131,8 +25114,8 @@ void msrVoice::finalizeVoice ( // JMI ???
   int inputLineNumber)
 {
 #ifdef TRACE_OPTIONS
-  if (gTraceOptions->fTraceVoices) {
-    gLogIOstream <<
+  if (gTraceOptions ()->fTraceVoices) {
+    gLogIOstream () <<
       "Finalizing voice \"" <<
       getVoiceName () <<
       "\", line " << inputLineNumber <<
@@ -25155,7 +25138,7 @@ void msrVoice::finalizeVoice ( // JMI ???
       endl;
 
     msrMusicXMLWarning (
-      gXml2lyOptions->fInputSourceName,
+      gXml2lyOptions ()->fInputSourceName,
       inputLineNumber,
       s.str ());
   }
@@ -25167,8 +25150,8 @@ void msrVoice::finalizeVoice ( // JMI ???
 
 void msrVoice::acceptIn (basevisitor* v)
 {
-  if (gMsrOptions->fTraceMsrVisitors) {
-    gLogIOstream <<
+  if (gMsrOptions ()->fTraceMsrVisitors) {
+    gLogIOstream () <<
       "% ==> msrVoice::acceptIn ()" <<
       endl;
   }
@@ -25178,8 +25161,8 @@ void msrVoice::acceptIn (basevisitor* v)
       dynamic_cast<visitor<S_msrVoice>*> (v)) {
         S_msrVoice elem = this;
         
-        if (gMsrOptions->fTraceMsrVisitors) {
-          gLogIOstream <<
+        if (gMsrOptions ()->fTraceMsrVisitors) {
+          gLogIOstream () <<
             "% ==> Launching msrVoice::visitStart ()" <<
             endl;
         }
@@ -25189,8 +25172,8 @@ void msrVoice::acceptIn (basevisitor* v)
 
 void msrVoice::acceptOut (basevisitor* v)
 {
-  if (gMsrOptions->fTraceMsrVisitors) {
-    gLogIOstream <<
+  if (gMsrOptions ()->fTraceMsrVisitors) {
+    gLogIOstream () <<
       "% ==> msrVoice::acceptOut ()" <<
       endl;
   }
@@ -25200,8 +25183,8 @@ void msrVoice::acceptOut (basevisitor* v)
       dynamic_cast<visitor<S_msrVoice>*> (v)) {
         S_msrVoice elem = this;
       
-        if (gMsrOptions->fTraceMsrVisitors) {
-          gLogIOstream <<
+        if (gMsrOptions ()->fTraceMsrVisitors) {
+          gLogIOstream () <<
             "% ==> Launching msrVoice::visitEnd ()" <<
             endl;
         }
@@ -25211,8 +25194,8 @@ void msrVoice::acceptOut (basevisitor* v)
 
 void msrVoice::browseData (basevisitor* v)
 {
-  if (gMsrOptions->fTraceMsrVisitors) {
-    gLogIOstream <<
+  if (gMsrOptions ()->fTraceMsrVisitors) {
+    gLogIOstream () <<
       "% ==> msrVoice::browseData ()" <<
       endl;
   }
@@ -25249,8 +25232,8 @@ void msrVoice::browseData (basevisitor* v)
     } // for
   }
 
-  if (gMsrOptions->fTraceMsrVisitors) {
-    gLogIOstream <<
+  if (gMsrOptions ()->fTraceMsrVisitors) {
+    gLogIOstream () <<
       "% <== msrVoice::browseData ()" <<
       endl;
   }
@@ -25346,7 +25329,7 @@ void msrVoice::print (ostream& os)
  // JMI   ", this: " << this <<
     endl;
 
-  gIndenter++;
+  gIndenter ()++;
 
   os << left <<
     "(" <<
@@ -25441,12 +25424,12 @@ void msrVoice::print (ostream& os)
       os <<
         endl;
   
-      gIndenter++;
+      gIndenter ()++;
   
-      os << gTab <<
+      os << gTab () <<
         voiceFirstNote->asString ();
   
-      gIndenter--;
+      gIndenter ()--;
     }
     else {
       os <<
@@ -25466,12 +25449,12 @@ void msrVoice::print (ostream& os)
     os <<
       endl;
 
-    gIndenter++;
+    gIndenter ()++;
 
-    os << gTab <<
+    os << gTab () <<
       fVoiceLastAppendedNote->asString ();
 
-    gIndenter--;
+    gIndenter ()--;
   }
   else {
     os <<
@@ -25499,7 +25482,7 @@ void msrVoice::print (ostream& os)
     endl;
     
   if (voiceMeasuresFlatListSize) {
-    gIndenter++;
+    gIndenter ()++;
 
     list<S_msrMeasure>::const_iterator
       iBegin = fVoiceMeasuresFlatList.begin (),
@@ -25515,7 +25498,7 @@ void msrVoice::print (ostream& os)
    //   os << endl;
     } // for
 
-    gIndenter--;
+    gIndenter ()--;
   }
   
   // print the voice initial elements
@@ -25539,7 +25522,7 @@ void msrVoice::print (ostream& os)
     os <<
       endl;
       
-    gIndenter++;
+    gIndenter ()++;
 
     list<S_msrElement>::const_iterator
       iBegin = fVoiceInitialElementsList.begin (),
@@ -25553,7 +25536,7 @@ void msrVoice::print (ostream& os)
       os << endl;
     } // for
 
-    gIndenter--;
+    gIndenter ()--;
   }
   
   /* JMI
@@ -25571,11 +25554,11 @@ void msrVoice::print (ostream& os)
       "voiceLastSegment" <<
       endl;
       
-    gIndenter++;
+    gIndenter ()++;
     os <<
       fVoiceLastSegment <<
       endl;
-    gIndenter--;
+    gIndenter ()--;
   }
   
   else {
@@ -25590,7 +25573,7 @@ void msrVoice::print (ostream& os)
       "Stanzas:" <<
       endl;
       
-    gIndenter++;
+    gIndenter ()++;
     
     map<string, S_msrStanza>::const_iterator
       iBegin = fVoiceStanzasMap.begin (),
@@ -25603,10 +25586,10 @@ void msrVoice::print (ostream& os)
       // no endl here
     } // for
 
-    gIndenter--;
+    gIndenter ()--;
   }
   
-  gIndenter--;
+  gIndenter ()--;
 }
 
 ostream& operator<< (ostream& os, const S_msrVoice& elt)
@@ -25704,8 +25687,8 @@ void msrStaff::initializeStaff ()
   } // switch
 
 #ifdef TRACE_OPTIONS
-  if (gTraceOptions->fTraceStaves) {
-    gLogIOstream <<
+  if (gTraceOptions ()->fTraceStaves) {
+    gLogIOstream () <<
       "Initializing staff \"" << fStaffName <<
       "\" in part " <<
       fStaffPartUplink->getPartCombinedName () <<
@@ -25713,7 +25696,7 @@ void msrStaff::initializeStaff ()
   }
 #endif
 
-  gIndenter++;
+  gIndenter ()++;
   
   // check the staff number
   switch (fStaffKind) {
@@ -25747,7 +25730,7 @@ void msrStaff::initializeStaff ()
           " is not equal to " << K_PART_FIGURED_BASS_STAFF_NUMBER;
           
         msrInternalError (
-          gXml2lyOptions->fInputSourceName,
+          gXml2lyOptions ()->fInputSourceName,
           fInputLineNumber,
           __FILE__, __LINE__,
           s.str ());
@@ -25781,8 +25764,8 @@ void msrStaff::initializeStaff ()
   
     if (clef) {
 #ifdef TRACE_OPTIONS
-      if (gTraceOptions->fTraceClefs || gTraceOptions->fTraceStaves) {
-        gLogIOstream <<
+      if (gTraceOptions ()->fTraceClefs || gTraceOptions ()->fTraceStaves) {
+        gLogIOstream () <<
           "Appending part clef '" << clef->asString () <<
           "' as initial clef to staff \"" <<
           getStaffName () <<
@@ -25806,8 +25789,8 @@ void msrStaff::initializeStaff ()
   
     if (key) {
 #ifdef TRACE_OPTIONS
-      if (gTraceOptions->fTraceStaves || gTraceOptions->fTraceKeys) {
-        gLogIOstream <<
+      if (gTraceOptions ()->fTraceStaves || gTraceOptions ()->fTraceKeys) {
+        gLogIOstream () <<
           "Appending part key '" << key->asString () <<
           "' as initial key to staff \"" <<
           getStaffName () <<
@@ -25830,8 +25813,8 @@ void msrStaff::initializeStaff ()
         
     if (transpose) {
 #ifdef TRACE_OPTIONS
-      if (gTraceOptions->fTraceStaves /* JMI ||       gTraceOptions->fTraceTransposes */) {
-        gLogIOstream <<
+      if (gTraceOptions ()->fTraceStaves /* JMI ||       gTraceOptions ()->fTraceTransposes */) {
+        gLogIOstream () <<
           "Appending part transpose '" << transpose->asString () <<
           "' as initial transpose to staff \"" <<
           getStaffName () <<
@@ -25855,7 +25838,7 @@ void msrStaff::initializeStaff ()
     fStaffPartUplink->
       getPartInstrumentAbbreviation ();
 
-  gIndenter--;
+  gIndenter ()--;
 }
 
 msrStaff::~msrStaff ()
@@ -25865,8 +25848,8 @@ S_msrStaff msrStaff::createStaffNewbornClone (
   S_msrPart containingPart)
 {
 #ifdef TRACE_OPTIONS
-  if (gTraceOptions->fTraceStaves) {
-    gLogIOstream <<
+  if (gTraceOptions ()->fTraceStaves) {
+    gLogIOstream () <<
       "Creating a newborn clone of staff \"" <<
       fStaffName <<
       "\"" <<
@@ -25969,8 +25952,8 @@ void msrStaff::createMeasureAndAppendItToStaff (
          measureImplicitKind)
 {
 #ifdef TRACE_OPTIONS
-  if (gTraceOptions->fTraceMeasures || gTraceOptions->fTraceStaves) {
-    gLogIOstream <<
+  if (gTraceOptions ()->fTraceMeasures || gTraceOptions ()->fTraceStaves) {
+    gLogIOstream () <<
       "Creating and appending measure '" <<
       measureNumber <<
       ", in staff \"" << getStaffName () << "\"" <<
@@ -25996,8 +25979,8 @@ void msrStaff::createMeasureAndAppendItToStaff (
     switch (voice->getVoiceKind ()) {
       case msrVoice::kRegularVoice:
 #ifdef TRACE_OPTIONS
-        if (gTraceOptions->fTraceMeasures || gTraceOptions->fTraceStaves) {
-          gLogIOstream <<
+        if (gTraceOptions ()->fTraceMeasures || gTraceOptions ()->fTraceStaves) {
+          gLogIOstream () <<
             "Propagating the creation and appending of measure '" <<
             measureNumber <<
             "', line " << inputLineNumber <<
@@ -26028,8 +26011,8 @@ void msrStaff::setNextMeasureNumberInStaff (
   string nextMeasureNumber)
 {
 #ifdef TRACE_OPTIONS
-  if (gTraceOptions->fTraceMeasures || gTraceOptions->fTraceStaves) {
-    gLogIOstream <<
+  if (gTraceOptions ()->fTraceMeasures || gTraceOptions ()->fTraceStaves) {
+    gLogIOstream () <<
       "Setting next measure number to '" <<
       nextMeasureNumber <<
       ", in staff \"" << getStaffName () << "\"" <<
@@ -26038,7 +26021,7 @@ void msrStaff::setNextMeasureNumberInStaff (
   }
 #endif
 
-  gIndenter++;
+  gIndenter ()++;
   
   // propagate it to all staves
   for (
@@ -26053,8 +26036,8 @@ void msrStaff::setNextMeasureNumberInStaff (
       "voice is null");
     
 #ifdef TRACE_OPTIONS
-    if (gTraceOptions->fTraceMeasures || gTraceOptions->fTraceStaves) {
-      gLogIOstream <<
+    if (gTraceOptions ()->fTraceMeasures || gTraceOptions ()->fTraceStaves) {
+      gLogIOstream () <<
         "Propagating the setting of next measure number '" <<
         nextMeasureNumber <<
         "', line " << inputLineNumber <<
@@ -26069,7 +26052,7 @@ void msrStaff::setNextMeasureNumberInStaff (
         nextMeasureNumber);
   } // for
 
-  gIndenter--;
+  gIndenter ()--;
 }
 
 S_msrVoice msrStaff::createVoiceInStaffByItsNumber (
@@ -26084,8 +26067,8 @@ S_msrVoice msrStaff::createVoiceInStaffByItsNumber (
       fStaffRegularVoicesCounter++;
 
 #ifdef TRACE_OPTIONS
-      if (gTraceOptions->fTraceStaves || gTraceOptions->fTraceVoices) {
-        gLogIOstream <<
+      if (gTraceOptions ()->fTraceStaves || gTraceOptions ()->fTraceVoices) {
+        gLogIOstream () <<
           "Creating regular voice number '" <<
           voiceNumber <<
           "', voiceKind '" <<
@@ -26104,8 +26087,8 @@ S_msrVoice msrStaff::createVoiceInStaffByItsNumber (
       
     case msrVoice::kHarmonyVoice:
 #ifdef TRACE_OPTIONS
-      if (gTraceOptions->fTraceStaves || gTraceOptions->fTraceVoices) {
-        gLogIOstream <<
+      if (gTraceOptions ()->fTraceStaves || gTraceOptions ()->fTraceVoices) {
+        gLogIOstream () <<
           "Creating harmony voice number '" <<
           voiceNumber <<
           "', voiceKind '" <<
@@ -26122,8 +26105,8 @@ S_msrVoice msrStaff::createVoiceInStaffByItsNumber (
       
     case msrVoice::kFiguredBassVoice:
 #ifdef TRACE_OPTIONS
-      if (gTraceOptions->fTraceStaves || gTraceOptions->fTraceVoices) {
-        gLogIOstream <<
+      if (gTraceOptions ()->fTraceStaves || gTraceOptions ()->fTraceVoices) {
+        gLogIOstream () <<
           "Creating figured bass voice number '" <<
           voiceNumber <<
           "', voiceKind '" <<
@@ -26162,7 +26145,7 @@ S_msrVoice msrStaff::createVoiceInStaffByItsNumber (
       /* JMI ???
     msrMusicXMLError (
 // JMI    msrMusicXMLWarning ( JMI
-      gXml2lyOptions->fInputSourceName,
+      gXml2lyOptions ()->fInputSourceName,
       inputLineNumber,
       __FILE__, __LINE__,
       s.str ());
@@ -26184,8 +26167,8 @@ S_msrVoice msrStaff::createVoiceInStaffByItsNumber (
     case msrVoice::kRegularVoice:
       // register the voice by its relative number
 #ifdef TRACE_OPTIONS
-      if (gTraceOptions->fTraceVoices) {
-        gLogIOstream <<
+      if (gTraceOptions ()->fTraceVoices) {
+        gLogIOstream () <<
           "Voice " << voiceNumber <<
           " in staff " << getStaffName () <<
           " gets staff regular voice number " <<
@@ -26221,8 +26204,8 @@ void msrStaff::registerVoiceByItsNumber (
   S_msrVoice voice)
 {
 #ifdef TRACE_OPTIONS
-  if (gTraceOptions->fTraceVoices || gTraceOptions->fTraceStaves) {
-    gLogIOstream <<
+  if (gTraceOptions ()->fTraceVoices || gTraceOptions ()->fTraceStaves) {
+    gLogIOstream () <<
       "Registering voice number '" << voiceNumber <<
       "', named \"" << voice->getVoiceName () <<
       "\" in staff " << getStaffName () <<
@@ -26244,8 +26227,8 @@ void msrStaff::registerVoiceByItsNumber (
 
     case msrVoice::kHarmonyVoice:
 #ifdef TRACE_OPTIONS
-      if (gTraceOptions->fTraceStaves || gTraceOptions->fTraceVoices) {
-        gLogIOstream <<
+      if (gTraceOptions ()->fTraceStaves || gTraceOptions ()->fTraceVoices) {
+        gLogIOstream () <<
           "Sorting the voices in staff \"" <<
           getStaffName () << "\"" <<
           ", line " << inputLineNumber <<
@@ -26254,7 +26237,7 @@ void msrStaff::registerVoiceByItsNumber (
 #endif
 
     /* JMI
-      gLogIOstream <<
+      gLogIOstream () <<
         endl <<
         endl <<
         "@@@@@@@@@@@@@@@@ fStaffAllVoicesList contains initially:" <<
@@ -26268,11 +26251,11 @@ void msrStaff::registerVoiceByItsNumber (
         S_msrVoice
           voice = (*i);
           
-        gLogIOstream <<
+        gLogIOstream () <<
           voice->getVoiceName () <<
           endl;
       } // for
-      gLogIOstream <<
+      gLogIOstream () <<
         endl <<
         endl;
       */
@@ -26285,7 +26268,7 @@ void msrStaff::registerVoiceByItsNumber (
       }
 
     /* JMI
-      gLogIOstream <<
+      gLogIOstream () <<
         endl <<
         endl <<
         "@@@@@@@@@@@@@@@@ fStaffAllVoicesList contains after sort:" <<
@@ -26299,11 +26282,11 @@ void msrStaff::registerVoiceByItsNumber (
         S_msrVoice
           voice = (*i);
           
-        gLogIOstream <<
+        gLogIOstream () <<
           voice->getVoiceName () <<
           endl;
       } // for
-      gLogIOstream <<
+      gLogIOstream () <<
         endl <<
         endl;
         */
@@ -26319,8 +26302,8 @@ void msrStaff::registerVoiceInRegularVoicesMap (
   S_msrVoice voice)
 {
 #ifdef TRACE_OPTIONS
-  if (gTraceOptions->fTraceVoices || gTraceOptions->fTraceStaves) {
-    gLogIOstream <<
+  if (gTraceOptions ()->fTraceVoices || gTraceOptions ()->fTraceStaves) {
+    gLogIOstream () <<
       "Registering regular voice number '" << voiceNumber <<
       "', named \"" << voice->getVoiceName () <<
       "\" in staff " << getStaffName () <<
@@ -26344,8 +26327,8 @@ void msrStaff::registerVoiceInAllVoicesList (
   S_msrVoice voice)
 {
 #ifdef TRACE_OPTIONS
-  if (gTraceOptions->fTraceVoices || gTraceOptions->fTraceStaves) {
-    gLogIOstream <<
+  if (gTraceOptions ()->fTraceVoices || gTraceOptions ()->fTraceStaves) {
+    gLogIOstream () <<
       "Registering voice number '" << voiceNumber <<
       "', named \"" << voice->getVoiceName () <<
       "\" in staff " << getStaffName () <<
@@ -26364,8 +26347,8 @@ S_msrVoice msrStaff::fetchVoiceFromStaffByItsNumber (
   S_msrVoice result; // JMI avoid repetitive messages!
 
 #ifdef TRACE_OPTIONS
-  if (gTraceOptions->fTraceVoices || gTraceOptions->fTraceStaves) {
-    gLogIOstream <<
+  if (gTraceOptions ()->fTraceVoices || gTraceOptions ()->fTraceStaves) {
+    gLogIOstream () <<
       "Fetching voice number " <<
       voiceNumber <<
      " in staff \"" << getStaffName () <<
@@ -26386,8 +26369,8 @@ S_msrVoice msrStaff::fetchVoiceFromStaffByItsNumber (
         ==
       voiceNumber) {
 #ifdef TRACE_OPTIONS
-        if (gTraceOptions->fTraceVoices || gTraceOptions->fTraceStaves) {
-          gLogIOstream <<
+        if (gTraceOptions ()->fTraceVoices || gTraceOptions ()->fTraceStaves) {
+          gLogIOstream () <<
             "Voice " << voiceNumber <<
             " in staff \"" << getStaffName () << "\"" <<
             " has staff relative number " << (*i).first <<
@@ -26408,8 +26391,8 @@ void msrStaff::addAVoiceToStaffIfItHasNone (
 {
   if (fStaffAllVoicesMap.size () == 0) {
 #ifdef TRACE_OPTIONS
-    if (gTraceOptions->fTraceStaves || gTraceOptions->fTraceVoices) {
-      gLogIOstream <<
+    if (gTraceOptions ()->fTraceStaves || gTraceOptions ()->fTraceVoices) {
+      gLogIOstream () <<
         "Staff \"" <<
         getStaffName () <<
         "\" doesn't contain any voice, adding one" <<
@@ -26466,7 +26449,7 @@ void msrStaff::registerVoiceInStaff (
           /* JMI ???
         msrMusicXMLError (
     // JMI    msrMusicXMLWarning ( JMI
-          gXml2lyOptions->fInputSourceName,
+          gXml2lyOptions ()->fInputSourceName,
           inputLineNumber,
           __FILE__, __LINE__,
           s.str ());
@@ -26482,8 +26465,8 @@ void msrStaff::registerVoiceInStaff (
 
   // register voice in this staff
 #ifdef TRACE_OPTIONS
-  if (gTraceOptions->fTraceStaves || gTraceOptions->fTraceVoices) {
-    gLogIOstream <<
+  if (gTraceOptions ()->fTraceStaves || gTraceOptions ()->fTraceVoices) {
+    gLogIOstream () <<
       "Registering voice \"" << voice->getVoiceName () <<
       "\" as relative voice " <<
       fStaffRegularVoicesCounter <<
@@ -26508,8 +26491,8 @@ void msrStaff::registerVoiceInStaff (
         
         // register the voice by its number
 #ifdef TRACE_OPTIONS
-        if (gTraceOptions->fTraceVoices) {
-          gLogIOstream <<
+        if (gTraceOptions ()->fTraceVoices) {
+          gLogIOstream () <<
             "Registering regular voice '" << voiceNumber <<
             "' " << voice->getVoiceName () <<
             " with staff regular voice number " <<
@@ -26538,8 +26521,8 @@ void msrStaff::padUpToMeasureLengthInStaff (
   rational measureLength)
 {
 #ifdef TRACE_OPTIONS
-  if (gTraceOptions->fTraceStaves || gTraceOptions->fTraceMeasures) {
-    gLogIOstream <<
+  if (gTraceOptions ()->fTraceStaves || gTraceOptions ()->fTraceMeasures) {
+    gLogIOstream () <<
       "Padding up to measure length '" << measureLength <<
       "' in staff \"" <<
       getStaffName () <<
@@ -26562,8 +26545,8 @@ void msrStaff::padUpToMeasureLengthInStaff (
 void msrStaff::appendClefToStaff (S_msrClef clef)
 {
 #ifdef TRACE_OPTIONS
-  if (gTraceOptions->fTraceClefs || gTraceOptions->fTraceStaves) {
-    gLogIOstream <<
+  if (gTraceOptions ()->fTraceClefs || gTraceOptions ()->fTraceStaves) {
+    gLogIOstream () <<
       "Appending clef '" << clef->asString () <<
       "' to staff \"" <<
       getStaffName () <<
@@ -26573,7 +26556,7 @@ void msrStaff::appendClefToStaff (S_msrClef clef)
   }
 #endif
 
-  gIndenter++;
+  gIndenter ()++;
   
   // append clef to the staff,
   // unless we should ignore redundant clefs
@@ -26582,7 +26565,7 @@ void msrStaff::appendClefToStaff (S_msrClef clef)
     
   if (fStaffCurrentClef) {
     if (
-      gMusicXMLOptions->fIgnoreRedundantClefs
+      gMusicXMLOptions ()->fIgnoreRedundantClefs
         &&
       clef->isEqualTo (fStaffCurrentClef)) {
       doAppendClefToStaff = false;
@@ -26622,8 +26605,8 @@ void msrStaff::appendClefToStaff (S_msrClef clef)
 
   else {
 #ifdef TRACE_OPTIONS
-    if (gTraceOptions->fTraceClefs || gTraceOptions->fTraceStaves) {
-      gLogIOstream <<
+    if (gTraceOptions ()->fTraceClefs || gTraceOptions ()->fTraceStaves) {
+      gLogIOstream () <<
         "Clef '" <<
         clef->asString () <<
         "' ignored because it is already present in staff " <<
@@ -26635,14 +26618,14 @@ void msrStaff::appendClefToStaff (S_msrClef clef)
 #endif
   }
 
-  gIndenter--;
+  gIndenter ()--;
 }
 
 void msrStaff::appendKeyToStaff (S_msrKey  key)
 {
 #ifdef TRACE_OPTIONS
-  if (gTraceOptions->fTraceKeys || gTraceOptions->fTraceStaves) {
-    gLogIOstream <<
+  if (gTraceOptions ()->fTraceKeys || gTraceOptions ()->fTraceStaves) {
+    gLogIOstream () <<
       "Appending key '" << key->asString () <<
       "' to staff \"" <<
       getStaffName () <<
@@ -26652,14 +26635,14 @@ void msrStaff::appendKeyToStaff (S_msrKey  key)
   }
 #endif
 
-  gIndenter++;
+  gIndenter ()++;
   
   // append key to staff?
   bool doAppendKeyToStaff = true;
     
   if (fStaffCurrentKey) {
     if (
-      gMusicXMLOptions->fIgnoreRedundantKeys
+      gMusicXMLOptions ()->fIgnoreRedundantKeys
         &&
       fStaffCurrentKey->isEqualTo (key)) {
       doAppendKeyToStaff = false;
@@ -26668,8 +26651,8 @@ void msrStaff::appendKeyToStaff (S_msrKey  key)
     else {
       if (key->isEqualTo (fStaffCurrentKey)) {
 #ifdef TRACE_OPTIONS
-        if (gTraceOptions->fTraceKeys || gTraceOptions->fTraceStaves) {
-          gLogIOstream <<
+        if (gTraceOptions ()->fTraceKeys || gTraceOptions ()->fTraceStaves) {
+          gLogIOstream () <<
             "Key '" <<
             key->asString () <<
             "' ignored because it is already present in staff " <<
@@ -26699,14 +26682,14 @@ void msrStaff::appendKeyToStaff (S_msrKey  key)
     } // for
   }
 
-  gIndenter--;
+  gIndenter ()--;
 }
 
 void msrStaff::appendTimeToStaff (S_msrTime time)
 {
 #ifdef TRACE_OPTIONS
-  if (gTraceOptions->fTraceTimes || gTraceOptions->fTraceStaves) {
-    gLogIOstream <<
+  if (gTraceOptions ()->fTraceTimes || gTraceOptions ()->fTraceStaves) {
+    gLogIOstream () <<
       "Appending time '" << time->asString () <<
       "' to staff \"" <<
       getStaffName () <<
@@ -26716,14 +26699,14 @@ void msrStaff::appendTimeToStaff (S_msrTime time)
   }
 #endif
 
-  gIndenter++;
+  gIndenter ()++;
   
   // append time to staff?
   bool doAppendTimeToStaff = true;
 
   if (fStaffCurrentTime) {
     if (
-      gMusicXMLOptions->fIgnoreRedundantTimes
+      gMusicXMLOptions ()->fIgnoreRedundantTimes
         &&
       fStaffCurrentTime->isEqualTo (time)) {
       doAppendTimeToStaff = false;
@@ -26732,8 +26715,8 @@ void msrStaff::appendTimeToStaff (S_msrTime time)
     else {
       if (time->isEqualTo (fStaffCurrentTime)) {
 #ifdef TRACE_OPTIONS
-        if (gTraceOptions->fTraceTimes || gTraceOptions->fTraceStaves) {
-          gLogIOstream <<
+        if (gTraceOptions ()->fTraceTimes || gTraceOptions ()->fTraceStaves) {
+          gLogIOstream () <<
             "Time '" <<
             time->asString () <<
             "' ignored because it is already present in staff " <<
@@ -26763,14 +26746,14 @@ void msrStaff::appendTimeToStaff (S_msrTime time)
     } // for
   }
 
-  gIndenter--;
+  gIndenter ()--;
 }    
 
 void msrStaff::appendTimeToStaffClone (S_msrTime time)
 {
 #ifdef TRACE_OPTIONS
-  if (gTraceOptions->fTraceTimes || gTraceOptions->fTraceStaves) {
-    gLogIOstream <<
+  if (gTraceOptions ()->fTraceTimes || gTraceOptions ()->fTraceStaves) {
+    gLogIOstream () <<
       "Appending time '" << time->asString () <<
       "' to staff clone \"" <<
       getStaffName () <<
@@ -26780,7 +26763,7 @@ void msrStaff::appendTimeToStaffClone (S_msrTime time)
   }
 #endif
 
-  gIndenter++;
+  gIndenter ()++;
   
   // set staff time
   fStaffCurrentTime = time;
@@ -26794,15 +26777,15 @@ void msrStaff::appendTimeToStaffClone (S_msrTime time)
       appendTimeToVoiceClone (time);
   } // for
 
-  gIndenter--;
+  gIndenter ()--;
 }    
 
 void msrStaff::prepareForRepeatInStaff (
   int inputLineNumber)
 {
 #ifdef TRACE_OPTIONS
-  if (gTraceOptions->fTraceRepeats) {
-    gLogIOstream <<
+  if (gTraceOptions ()->fTraceRepeats) {
+    gLogIOstream () <<
       "Preparing for repeat in staff \"" <<
       getStaffName () <<
       "\" in part " <<
@@ -26812,7 +26795,7 @@ void msrStaff::prepareForRepeatInStaff (
   }
 #endif
 
-  gIndenter++;
+  gIndenter ()++;
   
   for (
     map<int, S_msrVoice>::const_iterator i = fStaffAllVoicesMap.begin ();
@@ -26823,15 +26806,15 @@ void msrStaff::prepareForRepeatInStaff (
         inputLineNumber);
   } // for
 
-  gIndenter--;
+  gIndenter ()--;
 }
 
 void msrStaff::nestContentsIntoNewRepeatInStaff (
   int inputLineNumber)
 {
 #ifdef TRACE_OPTIONS
-  if (gTraceOptions->fTraceRepeats) {
-    gLogIOstream <<
+  if (gTraceOptions ()->fTraceRepeats) {
+    gLogIOstream () <<
       "Nesting contents into new repeat in staff \"" <<
       getStaffName () <<
       "\" in part " <<
@@ -26856,8 +26839,8 @@ void msrStaff::createRepeatUponItsEndAndAppendItToStaff (
   int    repeatTimes)
 {
 #ifdef TRACE_OPTIONS
-  if (gTraceOptions->fTraceRepeats) {
-    gLogIOstream <<
+  if (gTraceOptions ()->fTraceRepeats) {
+    gLogIOstream () <<
       "Creating and appending a repeat to staff \"" <<
       getStaffName () <<
       "\" in part " <<
@@ -26867,7 +26850,7 @@ void msrStaff::createRepeatUponItsEndAndAppendItToStaff (
   }
 #endif
 
-  gIndenter++;
+  gIndenter ()++;
   
   for (
     map<int, S_msrVoice>::const_iterator i = fStaffAllVoicesMap.begin ();
@@ -26880,7 +26863,7 @@ void msrStaff::createRepeatUponItsEndAndAppendItToStaff (
         repeatTimes);
   } // for
 
-  gIndenter--;
+  gIndenter ()--;
 }
 
 void msrStaff::createRegularRepeatUponItsFirstEndingInStaff (
@@ -26888,8 +26871,8 @@ void msrStaff::createRegularRepeatUponItsFirstEndingInStaff (
   int repeatTimes)
 {
 #ifdef TRACE_OPTIONS
-  if (gTraceOptions->fTraceRepeats) {
-    gLogIOstream <<
+  if (gTraceOptions ()->fTraceRepeats) {
+    gLogIOstream () <<
       "Creating and appending a repeat to staff \"" <<
       getStaffName () <<
       "\" in part " <<
@@ -26899,7 +26882,7 @@ void msrStaff::createRegularRepeatUponItsFirstEndingInStaff (
   }
 #endif
 
-  gIndenter++;
+  gIndenter ()++;
   
   for (
     map<int, S_msrVoice>::const_iterator i = fStaffAllVoicesMap.begin ();
@@ -26911,7 +26894,7 @@ void msrStaff::createRegularRepeatUponItsFirstEndingInStaff (
         repeatTimes);
   } // for
 
-  gIndenter--;
+  gIndenter ()--;
 }
 
 void msrStaff::createEnclosingRepeatUponItsFirstEndingInStaff (
@@ -26919,8 +26902,8 @@ void msrStaff::createEnclosingRepeatUponItsFirstEndingInStaff (
   int repeatTimes)
 {
 #ifdef TRACE_OPTIONS
-  if (gTraceOptions->fTraceRepeats) {
-    gLogIOstream <<
+  if (gTraceOptions ()->fTraceRepeats) {
+    gLogIOstream () <<
       "Creating and appending a repeat to staff \"" <<
       getStaffName () <<
       "\" in part " <<
@@ -26930,7 +26913,7 @@ void msrStaff::createEnclosingRepeatUponItsFirstEndingInStaff (
   }
 #endif
 
-  gIndenter++;
+  gIndenter ()++;
   
   for (
     map<int, S_msrVoice>::const_iterator i = fStaffAllVoicesMap.begin ();
@@ -26942,7 +26925,7 @@ void msrStaff::createEnclosingRepeatUponItsFirstEndingInStaff (
         repeatTimes);
   } // for
 
-  gIndenter--;
+  gIndenter ()--;
 }
 
 void msrStaff::appendRepeatEndingToStaff (
@@ -26952,8 +26935,8 @@ void msrStaff::appendRepeatEndingToStaff (
             repeatEndingKind)
 {
 #ifdef TRACE_OPTIONS
-  if (gTraceOptions->fTraceRepeats) {
-    gLogIOstream <<
+  if (gTraceOptions ()->fTraceRepeats) {
+    gLogIOstream () <<
       "Appending a repeat ending to staff \"" <<
       getStaffName () <<
       "\" in part " <<
@@ -26963,7 +26946,7 @@ void msrStaff::appendRepeatEndingToStaff (
   }
 #endif
 
-  gIndenter++;
+  gIndenter ()++;
   
   for (
     map<int, S_msrVoice>::const_iterator i = fStaffAllVoicesMap.begin ();
@@ -26976,7 +26959,7 @@ void msrStaff::appendRepeatEndingToStaff (
         repeatEndingKind);
   } // for
 
-  gIndenter--;
+  gIndenter ()--;
 }
 
 void msrStaff::createMeasuresRepeatFromItsFirstMeasuresInStaff (
@@ -26985,8 +26968,8 @@ void msrStaff::createMeasuresRepeatFromItsFirstMeasuresInStaff (
   int measuresRepeatSlashes)
 {
 #ifdef TRACE_OPTIONS
-  if (gTraceOptions->fTraceRepeats) {
-    gLogIOstream <<
+  if (gTraceOptions ()->fTraceRepeats) {
+    gLogIOstream () <<
       "Creating a measure repeat from it's first measure in staff \"" <<
       getStaffName () <<
       "\" in part " <<
@@ -27011,8 +26994,8 @@ void msrStaff::appendPendingMeasuresRepeatToStaff (
   int inputLineNumber)
 {
 #ifdef TRACE_OPTIONS
-  if (gTraceOptions->fTraceRepeats) {
-    gLogIOstream <<
+  if (gTraceOptions ()->fTraceRepeats) {
+    gLogIOstream () <<
       "Appending the pending measure repeat to staff \"" <<
       getStaffName () <<
       "\" in part " <<
@@ -27036,8 +27019,8 @@ void msrStaff::createMultipleRestInStaff (
   int multipleRestMeasuresNumber)
 {
 #ifdef TRACE_OPTIONS
-  if (gTraceOptions->fTraceRepeats) {
-    gLogIOstream <<
+  if (gTraceOptions ()->fTraceRepeats) {
+    gLogIOstream () <<
       "Creating a multiple rest in staff \"" <<
       getStaffName () <<
       "\" in part " <<
@@ -27064,8 +27047,8 @@ void msrStaff::appendPendingMultipleRestToStaff (
   int inputLineNumber)
 {
 #ifdef TRACE_OPTIONS
-  if (gTraceOptions->fTraceRepeats) {
-    gLogIOstream <<
+  if (gTraceOptions ()->fTraceRepeats) {
+    gLogIOstream () <<
       "Appending the pending multiple rest to staff \"" <<
       getStaffName () <<
       "\" in part " <<
@@ -27089,8 +27072,8 @@ void msrStaff::appendMultipleRestCloneToStaff (
   S_msrMultipleRest multipleRest)
 {
 #ifdef TRACE_OPTIONS
-  if (gTraceOptions->fTraceRepeats) {
-    gLogIOstream <<
+  if (gTraceOptions ()->fTraceRepeats) {
+    gLogIOstream () <<
       "Appending multiple rest '" <<
       multipleRest->asString () <<
       "' to staff clone \"" <<
@@ -27116,8 +27099,8 @@ void msrStaff::appendRepeatCloneToStaff (
   S_msrRepeat repeatCLone)
 {
 #ifdef TRACE_OPTIONS
-  if (gTraceOptions->fTraceRepeats) {
-    gLogIOstream <<
+  if (gTraceOptions ()->fTraceRepeats) {
+    gLogIOstream () <<
       "Appending repeat clone to staff \"" <<
       getStaffName () <<
       "\" in part " <<
@@ -27140,8 +27123,8 @@ void msrStaff::appendRepeatEndingCloneToStaff (
   S_msrRepeatEnding repeatEndingClone)
 {
 #ifdef TRACE_OPTIONS
-  if (gTraceOptions->fTraceRepeats) {
-    gLogIOstream <<
+  if (gTraceOptions ()->fTraceRepeats) {
+    gLogIOstream () <<
       "Appending a repeat ending clone to staff \"" <<
       getStaffName () <<
       "\" in part " <<
@@ -27151,7 +27134,7 @@ void msrStaff::appendRepeatEndingCloneToStaff (
   }
 #endif
 
-  gIndenter++;
+  gIndenter ()++;
   
   for (
     map<int, S_msrVoice>::const_iterator i = fStaffAllVoicesMap.begin ();
@@ -27162,14 +27145,14 @@ void msrStaff::appendRepeatEndingCloneToStaff (
         repeatEndingClone);
   } // for
 
-  gIndenter--;
+  gIndenter ()--;
 }
 
 void msrStaff::appendBarlineToStaff (S_msrBarline barline)
 {
 #ifdef TRACE_OPTIONS
-  if (gTraceOptions->fTraceMeasures) {
-    gLogIOstream <<
+  if (gTraceOptions ()->fTraceMeasures) {
+    gLogIOstream () <<
       "Appending barline '" << barline->asString () <<
       "' to staff " <<
       getStaffName () <<
@@ -27179,7 +27162,7 @@ void msrStaff::appendBarlineToStaff (S_msrBarline barline)
   }
 #endif
 
-  gIndenter++;
+  gIndenter ()++;
   
   for (
     map<int, S_msrVoice>::const_iterator i = fStaffAllVoicesMap.begin ();
@@ -27189,15 +27172,15 @@ void msrStaff::appendBarlineToStaff (S_msrBarline barline)
       appendBarlineToVoice (barline);
   } // for
 
-  gIndenter--;
+  gIndenter ()--;
 }
 
 void msrStaff::appendTransposeToStaff (
   S_msrTranspose transpose)
 {
 #ifdef TRACE_OPTIONS
-  if (gTraceOptions->fTraceTranspositions || gTraceOptions->fTraceStaves) {
-    gLogIOstream <<
+  if (gTraceOptions ()->fTraceTranspositions || gTraceOptions ()->fTraceStaves) {
+    gLogIOstream () <<
       "Setting transpose '" <<
       transpose->asString () <<
       "' in staff " <<
@@ -27218,8 +27201,8 @@ void msrStaff::appendTransposeToStaff (
   else {
     if (transpose->isEqualTo (fStaffCurrentTranspose)) {
 #ifdef TRACE_OPTIONS
-      if (gTraceOptions->fTraceTranspositions || gTraceOptions->fTraceStaves) {
-        gLogIOstream <<
+      if (gTraceOptions ()->fTraceTranspositions || gTraceOptions ()->fTraceStaves) {
+        gLogIOstream () <<
           "Transpose '" <<
           transpose->asString () <<
           "' ignored because it is already present in staff " <<
@@ -27247,8 +27230,8 @@ void msrStaff::appendPartNameDisplayToStaff (
   S_msrPartNameDisplay partNameDisplay)
 {
 #ifdef TRACE_OPTIONS
-  if (gTraceOptions->fTraceTranspositions || gTraceOptions->fTraceStaves) {
-    gLogIOstream <<
+  if (gTraceOptions ()->fTraceTranspositions || gTraceOptions ()->fTraceStaves) {
+    gLogIOstream () <<
       "Setting part name display '" <<
       partNameDisplay->asString () <<
       "' in staff " <<
@@ -27270,8 +27253,8 @@ void msrStaff::appendPartNameDisplayToStaff (
   else {
     if (partNameDisplay->isEqualTo (fStaffCurrentTranspose)) {
 #ifdef TRACE_OPTIONS
-      if (gTraceOptions->fTraceTranspositions || gTraceOptions->fTraceStaves) {
-        gLogIOstream <<
+      if (gTraceOptions ()->fTraceTranspositions || gTraceOptions ()->fTraceStaves) {
+        gLogIOstream () <<
           "Transpose '" <<
           partNameDisplay->asString () <<
           "' ignored because it is already present in staff " <<
@@ -27300,8 +27283,8 @@ void msrStaff::appendPartAbbreviationDisplayToStaff (
   S_msrPartAbbreviationDisplay partAbbreviationDisplay)
 {
 #ifdef TRACE_OPTIONS
-  if (gTraceOptions->fTraceTranspositions || gTraceOptions->fTraceStaves) {
-    gLogIOstream <<
+  if (gTraceOptions ()->fTraceTranspositions || gTraceOptions ()->fTraceStaves) {
+    gLogIOstream () <<
       "Setting part abbreviation display '" <<
       partAbbreviationDisplay->asString () <<
       "' in staff " <<
@@ -27323,8 +27306,8 @@ void msrStaff::appendPartAbbreviationDisplayToStaff (
   else {
     if (partAbbreviationDisplay->isEqualTo (fStaffCurrentTranspose)) {
 #ifdef TRACE_OPTIONS
-      if (gTraceOptions->fTraceTranspositions || gTraceOptions->fTraceStaves) {
-        gLogIOstream <<
+      if (gTraceOptions ()->fTraceTranspositions || gTraceOptions ()->fTraceStaves) {
+        gLogIOstream () <<
           "Transpose '" <<
           transpose->asString () <<
           "' ignored because it is already present in staff " <<
@@ -27353,8 +27336,8 @@ void msrStaff::appendStaffDetailsToStaff (
   S_msrStaffDetails staffDetails)
 {
 #ifdef TRACE_OPTIONS
-  if (gTraceOptions->fTraceStaves) {
-    gLogIOstream <<
+  if (gTraceOptions ()->fTraceStaves) {
+    gLogIOstream () <<
       "Appending staff details '" <<
       staffDetails->asShortString () <<
       "' to staff \"" <<
@@ -27383,8 +27366,8 @@ void msrStaff::appendStaffDetailsToStaff (
   } // switch
   
 #ifdef TRACE_OPTIONS
-  if (gTraceOptions->fTraceStaves) {
-    gLogIOstream <<
+  if (gTraceOptions ()->fTraceStaves) {
+    gLogIOstream () <<
       "Setting staff kind to '" <<
       staffKindAsString (fStaffKind) <<
       "' in staff \"" <<
@@ -27484,14 +27467,14 @@ void msrStaff::appendHarpPedalsTuningToStaff (
 void msrStaff::finalizeCurrentMeasureInStaff (
   int inputLineNumber)
 {
-  rational
-    partMeasureLengthHighTide =
-      fStaffPartUplink->
-        getPartMeasureLengthHighTide ();
-      
 #ifdef TRACE_OPTIONS
-  if (gTraceOptions->fTraceMeasures || gTraceOptions->fTraceStaves) {
-    gLogIOstream <<
+  if (gTraceOptions ()->fTraceMeasures || gTraceOptions ()->fTraceStaves) {
+    rational
+      partMeasureLengthHighTide =
+        fStaffPartUplink->
+          getPartMeasureLengthHighTide ();
+      
+    gLogIOstream () <<
       "Finalizing current measure in staff \"" <<
       getStaffName () <<
       "\", line " << inputLineNumber <<
@@ -27502,7 +27485,7 @@ void msrStaff::finalizeCurrentMeasureInStaff (
   }
 #endif
 
-  gIndenter++;
+  gIndenter ()++;
   
   // finalize all the registered voices
   for (
@@ -27524,7 +27507,7 @@ void msrStaff::finalizeCurrentMeasureInStaff (
     } // switch
   } // for
 
-  gIndenter--;
+  gIndenter ()--;
 }
 
 bool msrStaff::compareVoicesToHaveHarmoniesAboveCorrespondingVoice (
@@ -27606,8 +27589,8 @@ bool msrStaff::compareVoicesToHaveHarmoniesAboveCorrespondingVoice (
 void msrStaff::finalizeStaff (int inputLineNumber)
 {  
 #ifdef TRACE_OPTIONS
-  if (gTraceOptions->fTraceStaves) {
-    gLogIOstream <<
+  if (gTraceOptions ()->fTraceStaves) {
+    gLogIOstream () <<
       "Finalizing staff \"" <<
       getStaffName () << "\"" <<
       ", line " << inputLineNumber <<
@@ -27615,12 +27598,12 @@ void msrStaff::finalizeStaff (int inputLineNumber)
   }
 #endif
 
-  gIndenter++;
+  gIndenter ()++;
   
   // finalize the voices
 #ifdef TRACE_OPTIONS
-  if (gTraceOptions->fTraceStaves || gTraceOptions->fTraceVoices) {
-    gLogIOstream <<
+  if (gTraceOptions ()->fTraceStaves || gTraceOptions ()->fTraceVoices) {
+    gLogIOstream () <<
       "Finalizing the voices in staff \"" <<
       getStaffName () << "\"" <<
       ", line " << inputLineNumber <<
@@ -27640,13 +27623,13 @@ void msrStaff::finalizeStaff (int inputLineNumber)
         inputLineNumber);
   } // for
 
-  gIndenter--;
+  gIndenter ()--;
 }
 
 void msrStaff::acceptIn (basevisitor* v)
 {
-  if (gMsrOptions->fTraceMsrVisitors) {
-    gLogIOstream <<
+  if (gMsrOptions ()->fTraceMsrVisitors) {
+    gLogIOstream () <<
       "% ==> msrStaff::acceptIn ()" <<
       endl;
   }
@@ -27656,8 +27639,8 @@ void msrStaff::acceptIn (basevisitor* v)
       dynamic_cast<visitor<S_msrStaff>*> (v)) {
         S_msrStaff elem = this;
         
-        if (gMsrOptions->fTraceMsrVisitors) {
-          gLogIOstream <<
+        if (gMsrOptions ()->fTraceMsrVisitors) {
+          gLogIOstream () <<
             "% ==> Launching msrStaff::visitStart ()" <<
             endl;
         }
@@ -27667,8 +27650,8 @@ void msrStaff::acceptIn (basevisitor* v)
 
 void msrStaff::acceptOut (basevisitor* v)
 {
-  if (gMsrOptions->fTraceMsrVisitors) {
-    gLogIOstream <<
+  if (gMsrOptions ()->fTraceMsrVisitors) {
+    gLogIOstream () <<
       "% ==> msrStaff::acceptOut ()" <<
       endl;
   }
@@ -27678,8 +27661,8 @@ void msrStaff::acceptOut (basevisitor* v)
       dynamic_cast<visitor<S_msrStaff>*> (v)) {
         S_msrStaff elem = this;
       
-        if (gMsrOptions->fTraceMsrVisitors) {
-          gLogIOstream <<
+        if (gMsrOptions ()->fTraceMsrVisitors) {
+          gLogIOstream () <<
             "% ==> Launching msrStaff::visitEnd ()" <<
             endl;
         }
@@ -27689,8 +27672,8 @@ void msrStaff::acceptOut (basevisitor* v)
 
 void msrStaff::browseData (basevisitor* v)
 {
-  if (gMsrOptions->fTraceMsrVisitors) {
-    gLogIOstream <<
+  if (gMsrOptions ()->fTraceMsrVisitors) {
+    gLogIOstream () <<
       "% ==> msrStaff::browseData ()" <<
       endl;
   }
@@ -27743,8 +27726,8 @@ void msrStaff::browseData (basevisitor* v)
     } // for
   }
 
-  if (gMsrOptions->fTraceMsrVisitors) {
-    gLogIOstream <<
+  if (gMsrOptions ()->fTraceMsrVisitors) {
+    gLogIOstream () <<
       "% <== msrStaff::browseData ()" <<
       endl;
   }
@@ -27800,7 +27783,7 @@ void msrStaff::print (ostream& os)
     ")" <<
     endl;
 
-  gIndenter++;
+  gIndenter ()++;
 
   const int fieldwidth = 28;
   
@@ -27849,7 +27832,7 @@ void msrStaff::print (ostream& os)
       iEnd   = fStaffTuningsList.end (),
       i      = iBegin;
       
-    gIndenter++;
+    gIndenter ()++;
     for ( ; ; ) {
       os <<
         (*i)->asString ();
@@ -27857,7 +27840,7 @@ void msrStaff::print (ostream& os)
       os << endl;
     } // for
     os << endl;
-    gIndenter--;
+    gIndenter ()--;
   }
   os <<
     endl;
@@ -27869,7 +27852,7 @@ void msrStaff::print (ostream& os)
       "staffAllVoicesMap" <<
       endl;
       
-    gIndenter++;
+    gIndenter ()++;
 
     map<int, S_msrVoice>::const_iterator
       iBegin = fStaffAllVoicesMap.begin (),
@@ -27892,7 +27875,7 @@ void msrStaff::print (ostream& os)
     os <<
       endl;
     
-    gIndenter--;
+    gIndenter ()--;
   }
 
   // print the regular voices map
@@ -27901,7 +27884,7 @@ void msrStaff::print (ostream& os)
       "staffRegularVoicesMap" <<
       endl;
       
-    gIndenter++;
+    gIndenter ()++;
 
     map<int, S_msrVoice>::const_iterator
       iBegin = fStaffRegularVoicesMap.begin (),
@@ -27924,7 +27907,7 @@ void msrStaff::print (ostream& os)
     os <<
       endl;
     
-    gIndenter--;
+    gIndenter ()--;
   }
 
   // print the  voices
@@ -27962,7 +27945,7 @@ os <<
 
         case msrVoice::kHarmonyVoice:
           if (
-            gMsrOptions->fShowHarmonyVoices
+            gMsrOptions ()->fShowHarmonyVoices
               ||
             voice->getMusicHasBeenInsertedInVoice ())
             os <<
@@ -27971,7 +27954,7 @@ os <<
           
         case msrVoice::kFiguredBassVoice:
           if (
-            gMsrOptions->fShowFiguredBassVoices
+            gMsrOptions ()->fShowFiguredBassVoices
               ||
             voice->getMusicHasBeenInsertedInVoice ())
             os <<
@@ -27987,7 +27970,7 @@ os <<
     } // for
   }
 
-  gIndenter--;
+  gIndenter ()--;
 }
 
 void msrStaff::printSummary (ostream& os)
@@ -28001,7 +27984,7 @@ void msrStaff::printSummary (ostream& os)
     ")" <<
     endl;
 
-  gIndenter++;
+  gIndenter ()++;
 
   os <<
     "StaffInstrumentName: \"" <<
@@ -28019,14 +28002,14 @@ void msrStaff::printSummary (ostream& os)
       iEnd   = fStaffTuningsList.end (),
       i      = iBegin;
       
-    gIndenter++;
+    gIndenter ()++;
     for ( ; ; ) {
       os << (*i)->asString ();
       if (++i == iEnd) break;
       os << endl;
     } // for
     os << endl;
-    gIndenter--;
+    gIndenter ()--;
   }
 */
 
@@ -28036,7 +28019,7 @@ void msrStaff::printSummary (ostream& os)
       "Voices:" <<
       endl;
   
-    gIndenter++;
+    gIndenter ()++;
     
     map<int, S_msrVoice>::const_iterator
       iBegin = fStaffAllVoicesMap.begin (),
@@ -28066,10 +28049,10 @@ void msrStaff::printSummary (ostream& os)
       os << endl;
     } // for
 
-    gIndenter --;
+    gIndenter () --;
   }
 
-  gIndenter--;
+  gIndenter ()--;
 
   os <<
     endl;
@@ -28107,8 +28090,8 @@ msrVoiceStaffChange::~msrVoiceStaffChange ()
 S_msrVoiceStaffChange msrVoiceStaffChange::createStaffChangeNewbornClone ()
 {
 #ifdef TRACE_OPTIONS
-  if (gTraceOptions->fTraceStaffTuning) {
-    gLogIOstream <<
+  if (gTraceOptions ()->fTraceStaffTuning) {
+    gLogIOstream () <<
       "Creating a newborn clone of staff change '" <<
       asString () <<
       "'" <<
@@ -28127,8 +28110,8 @@ S_msrVoiceStaffChange msrVoiceStaffChange::createStaffChangeNewbornClone ()
 
 void msrVoiceStaffChange::acceptIn (basevisitor* v)
 {
-  if (gMsrOptions->fTraceMsrVisitors) {
-    gLogIOstream <<
+  if (gMsrOptions ()->fTraceMsrVisitors) {
+    gLogIOstream () <<
       "% ==> msrVoiceStaffChange::acceptIn ()" <<
       endl;
   }
@@ -28138,8 +28121,8 @@ void msrVoiceStaffChange::acceptIn (basevisitor* v)
       dynamic_cast<visitor<S_msrVoiceStaffChange>*> (v)) {
         S_msrVoiceStaffChange elem = this;
         
-        if (gMsrOptions->fTraceMsrVisitors) {
-          gLogIOstream <<
+        if (gMsrOptions ()->fTraceMsrVisitors) {
+          gLogIOstream () <<
             "% ==> Launching msrVoiceStaffChange::visitStart ()" <<
             endl;
         }
@@ -28149,8 +28132,8 @@ void msrVoiceStaffChange::acceptIn (basevisitor* v)
 
 void msrVoiceStaffChange::acceptOut (basevisitor* v)
 {
-  if (gMsrOptions->fTraceMsrVisitors) {
-    gLogIOstream <<
+  if (gMsrOptions ()->fTraceMsrVisitors) {
+    gLogIOstream () <<
       "% ==> msrVoiceStaffChange::acceptOut ()" <<
       endl;
   }
@@ -28160,8 +28143,8 @@ void msrVoiceStaffChange::acceptOut (basevisitor* v)
       dynamic_cast<visitor<S_msrVoiceStaffChange>*> (v)) {
         S_msrVoiceStaffChange elem = this;
       
-        if (gMsrOptions->fTraceMsrVisitors) {
-          gLogIOstream <<
+        if (gMsrOptions ()->fTraceMsrVisitors) {
+          gLogIOstream () <<
             "% ==> Launching msrVoiceStaffChange::visitEnd ()" <<
             endl;
         }
@@ -28199,8 +28182,6 @@ ostream& operator<< (ostream& os, const S_msrVoiceStaffChange& elt)
 }
 
 //______________________________________________________________________________ 
-int msrPart::gPartsCounter = 0;
-
 S_msrPart msrPart::create (
   int            inputLineNumber,
   string         partID,
@@ -28235,7 +28216,7 @@ msrPart::msrPart (
     */
 
   // set part number
-  fPartAbsoluteNumber = ++gPartsCounter;
+  fPartAbsoluteNumber = ++conversionContext::current ().fPartsCounter;
   
   // set part's part group uplink
   fPartPartGroupUplink = partPartGroupUplink;
@@ -28247,8 +28228,8 @@ msrPart::msrPart (
 void msrPart::initializePart ()
 {
 #ifdef TRACE_OPTIONS
-  if (gTraceOptions->fTraceParts) {
-    gLogIOstream <<
+  if (gTraceOptions ()->fTraceParts) {
+    gLogIOstream () <<
       "Creating part \"" << getPartCombinedName () << "\"" <<
       endl;
   }
@@ -28257,9 +28238,9 @@ void msrPart::initializePart ()
   // is this part name in the part renaming map?
   map<string, string>::const_iterator
     it =
-      gMsrOptions->fPartsRenamingMap.find (fPartID);
+      gMsrOptions ()->fPartsRenamingMap.find (fPartID);
         
-  if (it != gMsrOptions->fPartsRenamingMap.end ()) {
+  if (it != gMsrOptions ()->fPartsRenamingMap.end ()) {
     // yes, rename the part accordinglingly
     fPartMsrName = (*it).second;
   }
@@ -28284,8 +28265,8 @@ msrPart::~msrPart ()
 S_msrPart msrPart::createPartNewbornClone (S_msrPartGroup partGroupClone)
 {
 #ifdef TRACE_OPTIONS
-  if (gTraceOptions->fTraceParts) {
-    gLogIOstream <<
+  if (gTraceOptions ()->fTraceParts) {
+    gLogIOstream () <<
       "Creating a newborn clone of part " <<
       getPartCombinedName () <<
       endl;
@@ -28341,14 +28322,14 @@ void msrPart::createPartFiguredBassStaffAndVoiceIfNotYetDone (
     // create the part figured bass staff
 #ifdef TRACE_OPTIONS
     if (
-      gTraceOptions->fTraceParts
+      gTraceOptions ()->fTraceParts
         ||
-      gTraceOptions->fTraceFiguredBass
+      gTraceOptions ()->fTraceFiguredBass
         ||
-      gTraceOptions->fTraceStaves
+      gTraceOptions ()->fTraceStaves
         ||
-      gTraceOptions->fTraceVoices) {
-      gLogIOstream <<
+      gTraceOptions ()->fTraceVoices) {
+      gLogIOstream () <<
         "Creating the figured bass staff" <<
         " with number " << K_PART_FIGURED_BASS_STAFF_NUMBER <<
         " for part " <<
@@ -28358,7 +28339,7 @@ void msrPart::createPartFiguredBassStaffAndVoiceIfNotYetDone (
     }
 #endif
 
-    gIndenter++;
+    gIndenter ()++;
 
     fPartFiguredBassStaff =
       addStaffToPartByItsNumber (
@@ -28368,8 +28349,8 @@ void msrPart::createPartFiguredBassStaffAndVoiceIfNotYetDone (
       
     // create the part figured bass voice  
 #ifdef TRACE_OPTIONS
-    if (gTraceOptions->fTraceHarmonies || gTraceOptions->fTraceVoices) {
-      gLogIOstream <<
+    if (gTraceOptions ()->fTraceHarmonies || gTraceOptions ()->fTraceVoices) {
+      gLogIOstream () <<
         "Creating figured bass voice " <<
         " number " << K_PART_FIGURED_BASS_VOICE_NUMBER <<
         " for part " <<
@@ -28401,17 +28382,17 @@ void msrPart::createPartFiguredBassStaffAndVoiceIfNotYetDone (
           fPartCurrentTime);
     }
 
-    gIndenter--;
+    gIndenter ()--;
   }
 
 /* JMI
-  gLogIOstream <<
+  gLogIOstream () <<
     endl <<
     "***********" <<
     endl <<
     endl;
-  print (gLogIOstream);
-  gLogIOstream <<
+  print (gLogIOstream ());
+  gLogIOstream () <<
     "***********" <<
     endl <<
     endl;
@@ -28436,8 +28417,8 @@ void msrPart::setPartMeasureLengthHighTide (
   rational measureLength)
 {
 #ifdef TRACE_OPTIONS
-  if (gTraceOptions->fTraceDivisions || gTraceOptions->fTraceMeasures) {
-    gLogIOstream <<
+  if (gTraceOptions ()->fTraceDivisions || gTraceOptions ()->fTraceMeasures) {
+    gLogIOstream () <<
       "Setting measure length high tide for part \"" <<
       getPartCombinedName () <<
       "\" to " << measureLength <<
@@ -28455,8 +28436,8 @@ void msrPart::updatePartMeasureLengthHighTide (
 {
   if (measureLength > fPartMeasureLengthHighTide) {
 #ifdef TRACE_OPTIONS
-    if (gTraceOptions->fTraceDivisions || gTraceOptions->fTraceMeasures) {
-      gLogIOstream <<
+    if (gTraceOptions ()->fTraceDivisions || gTraceOptions ()->fTraceMeasures) {
+      gLogIOstream () <<
         "Updating measure length high tide for part \"" <<
         getPartCombinedName () <<
         "\" to " << measureLength <<
@@ -28474,8 +28455,8 @@ void msrPart::padUpToMeasureLengthInPart (
   rational measureLength)
 {
 #ifdef TRACE_OPTIONS
-  if (gTraceOptions->fTraceParts || gTraceOptions->fTraceMeasures) {
-    gLogIOstream <<
+  if (gTraceOptions ()->fTraceParts || gTraceOptions ()->fTraceMeasures) {
+    gLogIOstream () <<
       "Padding up to measure length '" << measureLength <<
       "' in part \"" <<
       getPartCombinedName () <<
@@ -28484,7 +28465,7 @@ void msrPart::padUpToMeasureLengthInPart (
   }
 #endif
 
-  gIndenter++;
+  gIndenter ()++;
   
   // pad the registered staves up to measure length  
   for (
@@ -28497,7 +28478,7 @@ void msrPart::padUpToMeasureLengthInPart (
         measureLength);
   } // for
 
-  gIndenter--;
+  gIndenter ()--;
 }
 
 void msrPart::setPartMsrName (string partMsrName)
@@ -28505,15 +28486,15 @@ void msrPart::setPartMsrName (string partMsrName)
   // is this part name in the part renaming map?
   map<string, string>::const_iterator
     it =
-      gMsrOptions->fPartsRenamingMap.find (fPartMsrName);
+      gMsrOptions ()->fPartsRenamingMap.find (fPartMsrName);
         
-  if (it != gMsrOptions->fPartsRenamingMap.end ()) {
+  if (it != gMsrOptions ()->fPartsRenamingMap.end ()) {
     // yes, rename the part accordinglingly
     fPartMsrName = (*it).second;
 
 #ifdef TRACE_OPTIONS
-    if (gTraceOptions->fTraceParts) {
-      gLogIOstream <<
+    if (gTraceOptions ()->fTraceParts) {
+      gLogIOstream () <<
         "Setting part name of " << getPartCombinedName () <<
         " to \"" << fPartMsrName << "\"" <<
          endl;
@@ -28525,8 +28506,8 @@ void msrPart::setPartMsrName (string partMsrName)
     fPartMsrName = partMsrName;
 
 #ifdef TRACE_OPTIONS
-    if (gTraceOptions->fTraceParts) {
-      gLogIOstream <<
+    if (gTraceOptions ()->fTraceParts) {
+      gLogIOstream () <<
         "Keeping partID \"" << partMsrName <<
         "\" as part name  for " << getPartCombinedName () <<
       endl;
@@ -28570,8 +28551,8 @@ void msrPart::createMeasureAndAppendItToPart (
          measureImplicitKind)
 {
 #ifdef TRACE_OPTIONS
-  if (gTraceOptions->fTraceMeasures) {
-    gLogIOstream <<
+  if (gTraceOptions ()->fTraceMeasures) {
+    gLogIOstream () <<
       "Creating and appending measure '" <<
       measureNumber <<
       "' to part " <<
@@ -28581,7 +28562,7 @@ void msrPart::createMeasureAndAppendItToPart (
   }
 #endif
 
-  gIndenter++;
+  gIndenter ()++;
   
   // set part current measure number
   fPartCurrentMeasureNumber = measureNumber;
@@ -28602,7 +28583,7 @@ void msrPart::createMeasureAndAppendItToPart (
         measureImplicitKind);
   } // for
 
-  gIndenter--;
+  gIndenter ()--;
 }
 
 void msrPart::setNextMeasureNumberInPart (
@@ -28610,8 +28591,8 @@ void msrPart::setNextMeasureNumberInPart (
   string nextMeasureNumber)
 {
 #ifdef TRACE_OPTIONS
-  if (gTraceOptions->fTraceMeasures) {
-    gLogIOstream <<
+  if (gTraceOptions ()->fTraceMeasures) {
+    gLogIOstream () <<
       "Setting next measure number to '" <<
       nextMeasureNumber <<
       "' in part " <<
@@ -28621,7 +28602,7 @@ void msrPart::setNextMeasureNumberInPart (
   }
 #endif
 
-  gIndenter++;
+  gIndenter ()++;
   
   // set next measure number in registered staves
   for (
@@ -28637,7 +28618,7 @@ void msrPart::setNextMeasureNumberInPart (
         nextMeasureNumber);
   } // for
 
-  gIndenter--;
+  gIndenter ()--;
 }
 
 /* JMI
@@ -28646,8 +28627,8 @@ void msrPart::complementPartVoicesUpToMeasure (
   string measureNumber)
 {
 #ifdef TRACE_OPTIONS
-  if (gTraceOptions->fTraceMeasures) {
-    gLogIOstream <<
+  if (gTraceOptions ()->fTraceMeasures) {
+    gLogIOstream () <<
       "Complement part voices up to measure number " << measureNumber <<
       ", line " << inputLineNumber <<
       ", in part " << getPartCombinedName () <<
@@ -28677,8 +28658,8 @@ void msrPart::appendStaffDetailsToPart (
   S_msrStaffDetails staffDetails)
 {
 #ifdef TRACE_OPTIONS
-  if (gTraceOptions->fTraceStaves || gTraceOptions->fTraceParts) {
-    gLogIOstream <<
+  if (gTraceOptions ()->fTraceStaves || gTraceOptions ()->fTraceParts) {
+    gLogIOstream () <<
       "Appending staff details\"" <<
       staffDetails->asShortString () <<
       "\" to part " << getPartCombinedName () <<
@@ -28706,8 +28687,8 @@ void msrPart::appendStaffDetailsToPart (
 void msrPart::appendClefToPart (S_msrClef clef)
 {
 #ifdef TRACE_OPTIONS
-  if (gTraceOptions->fTraceParts || gTraceOptions->fTraceClefs) {
-    gLogIOstream <<
+  if (gTraceOptions ()->fTraceParts || gTraceOptions ()->fTraceClefs) {
+    gLogIOstream () <<
       "Appending clef '" <<
       clef->asString () <<
       "' to part " << getPartCombinedName () <<
@@ -28715,7 +28696,7 @@ void msrPart::appendClefToPart (S_msrClef clef)
   }
 #endif
 
-  gIndenter++;
+  gIndenter ()++;
   
   // append clef to registered staves
   for (
@@ -28727,14 +28708,14 @@ void msrPart::appendClefToPart (S_msrClef clef)
         clef);
   } // for
 
-  gIndenter--;
+  gIndenter ()--;
 }
 
 void msrPart::appendKeyToPart  (S_msrKey  key)
 {
 #ifdef TRACE_OPTIONS
-  if (gTraceOptions->fTraceKeys || gTraceOptions->fTraceParts) {
-    gLogIOstream <<
+  if (gTraceOptions ()->fTraceKeys || gTraceOptions ()->fTraceParts) {
+    gLogIOstream () <<
       "Appending key '" <<
       key->asString () <<
       "' to part " << getPartCombinedName () <<
@@ -28745,7 +28726,7 @@ void msrPart::appendKeyToPart  (S_msrKey  key)
   // set part key
   fPartCurrentKey = key;
 
-  gIndenter++;
+  gIndenter ()++;
   
   // append key to registered staves
   for (
@@ -28760,14 +28741,14 @@ void msrPart::appendKeyToPart  (S_msrKey  key)
         key);
   } // for
 
-  gIndenter--;
+  gIndenter ()--;
 }
 
 void msrPart::appendTimeToPart (S_msrTime time)
 {
 #ifdef TRACE_OPTIONS
-  if (gTraceOptions->fTraceTimes || gTraceOptions->fTraceParts) {
-    gLogIOstream <<
+  if (gTraceOptions ()->fTraceTimes || gTraceOptions ()->fTraceParts) {
+    gLogIOstream () <<
       "Appending time '" <<
       time->asString () <<
       "' to part " << getPartCombinedName () <<
@@ -28778,7 +28759,7 @@ void msrPart::appendTimeToPart (S_msrTime time)
   // set part time
   fPartCurrentTime = time;
 
-  gIndenter++;
+  gIndenter ()++;
   
   // append time to registered staves
   for (
@@ -28793,14 +28774,14 @@ void msrPart::appendTimeToPart (S_msrTime time)
         time);
   } // for
 
-  gIndenter--;
+  gIndenter ()--;
 }
 
 void msrPart::appendTimeToPartClone (S_msrTime time)
 {
 #ifdef TRACE_OPTIONS
-  if (gTraceOptions->fTraceTimes || gTraceOptions->fTraceParts) {
-    gLogIOstream <<
+  if (gTraceOptions ()->fTraceTimes || gTraceOptions ()->fTraceParts) {
+    gLogIOstream () <<
       "Appending time '" <<
       time->asString () <<
       "' to part clone " << getPartCombinedName () <<
@@ -28811,7 +28792,7 @@ void msrPart::appendTimeToPartClone (S_msrTime time)
   // set part time
   fPartCurrentTime = time;
 
-  gIndenter++;
+  gIndenter ()++;
   
   // propagate it to all staves
   for (
@@ -28825,15 +28806,15 @@ void msrPart::appendTimeToPartClone (S_msrTime time)
       appendTimeToStaffClone (time);
   } // for
 
-  gIndenter--;
+  gIndenter ()--;
 }
 
 void msrPart::appendTransposeToPart (
   S_msrTranspose transpose)
 {
 #ifdef TRACE_OPTIONS
-  if (gTraceOptions->fTraceTranspositions || gTraceOptions->fTraceParts) {
-    gLogIOstream <<
+  if (gTraceOptions ()->fTraceTranspositions || gTraceOptions ()->fTraceParts) {
+    gLogIOstream () <<
       "Appending transpose \"" <<
       transpose->asString () <<
       "\" to part " << getPartCombinedName () <<
@@ -28861,8 +28842,8 @@ void msrPart::appendPartNameDisplayToPart (
   S_msrPartNameDisplay partNameDisplay)
 {
 #ifdef TRACE_OPTIONS
-  if (gTraceOptions->fTraceTranspositions || gTraceOptions->fTraceParts) {
-    gLogIOstream <<
+  if (gTraceOptions ()->fTraceTranspositions || gTraceOptions ()->fTraceParts) {
+    gLogIOstream () <<
       "Appending part name display \"" <<
       partNameDisplay->asString () <<
       "\" to part " << getPartCombinedName () <<
@@ -28890,8 +28871,8 @@ void msrPart::appendPartAbbreviationDisplayToPart (
   S_msrPartAbbreviationDisplay partAbbreviationDisplay)
 {
 #ifdef TRACE_OPTIONS
-  if (gTraceOptions->fTraceTranspositions || gTraceOptions->fTraceParts) {
-    gLogIOstream <<
+  if (gTraceOptions ()->fTraceTranspositions || gTraceOptions ()->fTraceParts) {
+    gLogIOstream () <<
       "Appending part abbreviation display \"" <<
       partAbbreviationDisplay->asString () <<
       "\" to part " << getPartCombinedName () <<
@@ -28919,8 +28900,8 @@ void msrPart::prepareForRepeatInPart (
   int inputLineNumber)
 {
 #ifdef TRACE_OPTIONS
-  if (gTraceOptions->fTraceRepeats) {
-    gLogIOstream <<
+  if (gTraceOptions ()->fTraceRepeats) {
+    gLogIOstream () <<
       "Preparing for repeat in part " <<
       getPartCombinedName () <<
       ", line " << inputLineNumber <<
@@ -28928,7 +28909,7 @@ void msrPart::prepareForRepeatInPart (
   }
 #endif
 
-  gIndenter++;
+  gIndenter ()++;
   
   for (
     map<int, S_msrStaff>::const_iterator i = fPartStavesMap.begin ();
@@ -28939,7 +28920,7 @@ void msrPart::prepareForRepeatInPart (
         inputLineNumber);
   } // for
 
-  gIndenter--;
+  gIndenter ()--;
 }
 
 void msrPart::nestContentsIntoNewRepeatInPart (
@@ -28961,8 +28942,8 @@ void msrPart::createRepeatUponItsEndAndAppendItToPart (
   int    repeatTimes)
 {
 #ifdef TRACE_OPTIONS
-  if (gTraceOptions->fTraceRepeats) {
-    gLogIOstream <<
+  if (gTraceOptions ()->fTraceRepeats) {
+    gLogIOstream () <<
       "Creating and appending a repeat to part \"" <<
       getPartCombinedName () <<
       "\"" <<
@@ -28971,7 +28952,7 @@ void msrPart::createRepeatUponItsEndAndAppendItToPart (
   }
 #endif
 
-  gIndenter++;
+  gIndenter ()++;
   
   // create repeat and append it to registered staves
   for (
@@ -28985,7 +28966,7 @@ void msrPart::createRepeatUponItsEndAndAppendItToPart (
         repeatTimes);
   } // for
 
-  gIndenter--;
+  gIndenter ()--;
 }
 
 void msrPart::createRegularRepeatUponItsFirstEndingInPart (
@@ -29027,8 +29008,8 @@ void msrPart::appendRepeatEndingToPart (
             repeatEndingKind)
 {
 #ifdef TRACE_OPTIONS
-  if (gTraceOptions->fTraceRepeats) {
-    gLogIOstream <<
+  if (gTraceOptions ()->fTraceRepeats) {
+    gLogIOstream () <<
       "Appending a repeat ending to part \"" <<
       getPartCombinedName () <<
       "\"" <<
@@ -29037,7 +29018,7 @@ void msrPart::appendRepeatEndingToPart (
   }
 #endif
 
-  gIndenter++;
+  gIndenter ()++;
   
   // append repeat ending to registered staves
   for (
@@ -29051,7 +29032,7 @@ void msrPart::appendRepeatEndingToPart (
         repeatEndingKind);
   } // for
 
-  gIndenter--;
+  gIndenter ()--;
 }
 
 void msrPart::appendRepeatCloneToPart (
@@ -29143,8 +29124,8 @@ void msrPart::createMultipleRestInPart (
   int multipleRestMeasuresNumber)
 {
 #ifdef TRACE_OPTIONS
-  if (gTraceOptions->fTraceRepeats || gTraceOptions->fTraceParts) {
-    gLogIOstream <<
+  if (gTraceOptions ()->fTraceRepeats || gTraceOptions ()->fTraceParts) {
+    gLogIOstream () <<
       "Creating a multiple rest in part " <<
       getPartCombinedName () <<
       ", " <<
@@ -29170,8 +29151,8 @@ void msrPart::appendPendingMultipleRestToPart (
   int inputLineNumber)
 {
 #ifdef TRACE_OPTIONS
-  if (gTraceOptions->fTraceRepeats || gTraceOptions->fTraceParts) {
-    gLogIOstream <<
+  if (gTraceOptions ()->fTraceRepeats || gTraceOptions ()->fTraceParts) {
+    gLogIOstream () <<
       "Appending the pending multiple rest to part " <<
       getPartCombinedName () <<
       endl;
@@ -29194,8 +29175,8 @@ void msrPart::appendMultipleRestCloneToPart (
   S_msrMultipleRest multipleRest)
 {
 #ifdef TRACE_OPTIONS
-  if (gTraceOptions->fTraceStaves || gTraceOptions->fTraceParts) {
-    gLogIOstream <<
+  if (gTraceOptions ()->fTraceStaves || gTraceOptions ()->fTraceParts) {
+    gLogIOstream () <<
       "Appending multiple rest '" <<
       multipleRest->asString () <<
       "' to part clone " <<
@@ -29241,7 +29222,7 @@ S_msrStaff msrPart::addStaffToPartByItsNumber (
       ", line " << inputLineNumber;
 
     msrInternalError ( // JMI ???
-      gXml2lyOptions->fInputSourceName,
+      gXml2lyOptions ()->fInputSourceName,
       inputLineNumber,
       __FILE__, __LINE__,
       s.str ());
@@ -29250,8 +29231,8 @@ S_msrStaff msrPart::addStaffToPartByItsNumber (
   }
 
 #ifdef TRACE_OPTIONS
-  if (gTraceOptions->fTraceStaves || gTraceOptions->fTraceParts) {
-    gLogIOstream <<
+  if (gTraceOptions ()->fTraceStaves || gTraceOptions ()->fTraceParts) {
+    gLogIOstream () <<
       "Adding " <<
       msrStaff::staffKindAsString (staffKind) <<
       " staff " << staffNumber <<
@@ -29302,8 +29283,8 @@ S_msrStaff msrPart::addStaffToPartByItsNumber (
 void msrPart::addStaffToPartCloneByItsNumber (S_msrStaff staff)
 {
 #ifdef TRACE_OPTIONS
-  if (gTraceOptions->fTraceStaves || gTraceOptions->fTraceParts) {
-    gLogIOstream <<
+  if (gTraceOptions ()->fTraceStaves || gTraceOptions ()->fTraceParts) {
+    gLogIOstream () <<
       "Adding staff \"" << staff->getStaffName () <<
       "\" to part clone " << getPartCombinedName () <<
       endl;
@@ -29348,8 +29329,8 @@ void msrPart::appendFiguredBassToPart (
     
       // append the figured bass to the part figured bass voice
 #ifdef TRACE_OPTIONS
-      if (gTraceOptions->fTraceHarmonies || gTraceOptions->fTraceParts) {
-        gLogIOstream <<
+      if (gTraceOptions ()->fTraceHarmonies || gTraceOptions ()->fTraceParts) {
+        gLogIOstream () <<
           "Appending figured bass '" <<
           figuredBass->asString () <<
           "' to part " <<
@@ -29377,7 +29358,7 @@ void msrPart::appendFiguredBassToPart (
           "\"";
     
         msrInternalError (
-          gXml2lyOptions->fInputSourceName,
+          gXml2lyOptions ()->fInputSourceName,
           inputLineNumber,
           __FILE__, __LINE__,
           s.str ());
@@ -29408,8 +29389,8 @@ void msrPart::appendFiguredBassToPartClone (
     
       // append the figured bass to the part figured bass voice
 #ifdef TRACE_OPTIONS
-      if (gTraceOptions->fTraceFiguredBass || gTraceOptions->fTraceParts) {
-        gLogIOstream <<
+      if (gTraceOptions ()->fTraceFiguredBass || gTraceOptions ()->fTraceParts) {
+        gLogIOstream () <<
           "Appending figured bass '" <<
           figuredBass->asString () <<
           "' to part clone " <<
@@ -29437,7 +29418,7 @@ void msrPart::appendFiguredBassToPartClone (
           "\"";
     
         msrInternalError (
-          gXml2lyOptions->fInputSourceName,
+          gXml2lyOptions ()->fInputSourceName,
           inputLineNumber,
           __FILE__, __LINE__,
           s.str ());
@@ -29450,8 +29431,8 @@ void msrPart::appendScordaturaToPart (
   S_msrScordatura scordatura)
 {
 #ifdef TRACE_OPTIONS
-  if (gTraceOptions->fTracePasses || gTraceOptions->fTraceParts) {
-    gLogIOstream <<
+  if (gTraceOptions ()->fTracePasses || gTraceOptions ()->fTraceParts) {
+    gLogIOstream () <<
       "Appending scordatura '" <<
       scordatura->asString () <<
       "' to part " <<
@@ -29475,8 +29456,8 @@ void msrPart::appendAccordionRegistrationToPart (
     accordionRegistration)
 {
 #ifdef TRACE_OPTIONS
-  if (gTraceOptions->fTracePasses || gTraceOptions->fTraceParts) {
-    gLogIOstream <<
+  if (gTraceOptions ()->fTracePasses || gTraceOptions ()->fTraceParts) {
+    gLogIOstream () <<
       "Appending accordion registration '" <<
       accordionRegistration->asString () <<
       "' to part " <<
@@ -29500,8 +29481,8 @@ void msrPart::appendHarpPedalsTuningToPart (
     harpPedalsTuning)
 {
 #ifdef TRACE_OPTIONS
-  if (gTraceOptions->fTracePasses || gTraceOptions->fTraceParts) {
-    gLogIOstream <<
+  if (gTraceOptions ()->fTracePasses || gTraceOptions ()->fTraceParts) {
+    gLogIOstream () <<
       "Appending harp pedals tuning '" <<
       harpPedalsTuning->asString () <<
       "' to part " <<
@@ -29527,12 +29508,12 @@ void msrPart:: handleBackup (
 {
 #ifdef TRACE_OPTIONS
   if (
-    gTraceOptions->fTraceParts
+    gTraceOptions ()->fTraceParts
       ||
-    gTraceOptions->fTraceDivisions
+    gTraceOptions ()->fTraceDivisions
       ||
-    gTraceOptions->fTraceMeasures) {
-    gLogIOstream <<
+    gTraceOptions ()->fTraceMeasures) {
+    gLogIOstream () <<
       "Handling backup, divisions = '" <<
       divisions <<
       "' in part " <<
@@ -29569,6 +29550,7 @@ void msrPart::addSkipGraceNotesGroupBeforeAheadOfVoicesClonesIfNeeded (
   int inputLineNumber =
     skipGraceNotesGroup->getInputLineNumber ();
 
+#ifdef TRACE_OPTIONS
   rational
     graceNotesGroupOriginVoiceMeasureLength =
       graceNotesGroupOriginVoice->
@@ -29576,15 +29558,14 @@ void msrPart::addSkipGraceNotesGroupBeforeAheadOfVoicesClonesIfNeeded (
           getSegmentMeasuresList ().back ()->
             getMeasureLength ();
         
-#ifdef TRACE_OPTIONS
   if (
-    gTraceOptions->fTraceMeasures
+    gTraceOptions ()->fTraceMeasures
       ||
-    gTraceOptions->fTraceGraceNotes
+    gTraceOptions ()->fTraceGraceNotes
       ||
-    gTraceOptions->fTraceParts
+    gTraceOptions ()->fTraceParts
     ) {
-    gLogIOstream <<
+    gLogIOstream () <<
       "addSkipGraceNotesGroupBeforeAheadOfVoicesClonesIfNeeded () in " <<
       getPartCombinedName () <<
       ", graceNotesGroupOriginVoiceMeasureLength = " <<
@@ -29638,8 +29619,8 @@ void msrPart::finalizeCurrentMeasureInPart (
   int    inputLineNumber)
 {
 #ifdef TRACE_OPTIONS
-  if (gTraceOptions->fTraceMeasures || gTraceOptions->fTraceParts) {
-    gLogIOstream <<
+  if (gTraceOptions ()->fTraceMeasures || gTraceOptions ()->fTraceParts) {
+    gLogIOstream () <<
       "Finalizing current measure in part " <<
       getPartCombinedName () <<
       ", line " << inputLineNumber <<
@@ -29647,7 +29628,7 @@ void msrPart::finalizeCurrentMeasureInPart (
   }
 #endif
 
-  gIndenter++;
+  gIndenter ()++;
   
   // finalize current measure in registered staves
   for (
@@ -29664,7 +29645,7 @@ void msrPart::finalizeCurrentMeasureInPart (
     fInputLineNumber,
     rational (0, 1));
 
-  gIndenter--;
+  gIndenter ()--;
 }
 
 void msrPart::setPartInstrumentNamesMaxLengthes ()
@@ -29715,8 +29696,8 @@ void msrPart::finalizePart (
   int inputLineNumber)
 {
 #ifdef TRACE_OPTIONS
-  if (gTraceOptions->fTraceParts) {
-    gLogIOstream <<
+  if (gTraceOptions ()->fTraceParts) {
+    gLogIOstream () <<
       "Finalizing part " <<
       getPartCombinedName () <<
       ", line " << inputLineNumber <<
@@ -29724,7 +29705,7 @@ void msrPart::finalizePart (
   }
 #endif
 
-  gIndenter++;
+  gIndenter ()++;
   
   if (! fPartStavesMap.size ()) {
     stringstream s;
@@ -29735,7 +29716,7 @@ void msrPart::finalizePart (
       " appears in the part list, but doesn't contain any stave";
 
     msrMusicXMLWarning (
-      gXml2lyOptions->fInputSourceName,
+      gXml2lyOptions ()->fInputSourceName,
       inputLineNumber,
       s.str ());
   }
@@ -29755,15 +29736,15 @@ void msrPart::finalizePart (
   // set score instrument names max lengthes if relevant
   setPartInstrumentNamesMaxLengthes ();
 
-  gIndenter--;
+  gIndenter ()--;
 }
 
 void msrPart::finalizePartClone (
   int inputLineNumber)
 {
 #ifdef TRACE_OPTIONS
-  if (gTraceOptions->fTraceParts) {
-    gLogIOstream <<
+  if (gTraceOptions ()->fTraceParts) {
+    gLogIOstream () <<
       "Finalizing part clone " <<
       getPartCombinedName () <<
       ", line " << inputLineNumber <<
@@ -29777,8 +29758,8 @@ void msrPart::finalizePartClone (
 
 void msrPart::acceptIn (basevisitor* v)
 {
-  if (gMsrOptions->fTraceMsrVisitors) {
-    gLogIOstream <<
+  if (gMsrOptions ()->fTraceMsrVisitors) {
+    gLogIOstream () <<
       "% ==> msrPart::acceptIn ()" <<
       endl;
   }
@@ -29788,8 +29769,8 @@ void msrPart::acceptIn (basevisitor* v)
       dynamic_cast<visitor<S_msrPart>*> (v)) {
         S_msrPart elem = this;
         
-        if (gMsrOptions->fTraceMsrVisitors) {
-          gLogIOstream <<
+        if (gMsrOptions ()->fTraceMsrVisitors) {
+          gLogIOstream () <<
             "% ==> Launching msrPart::visitStart ()" <<
             endl;
         }
@@ -29799,8 +29780,8 @@ void msrPart::acceptIn (basevisitor* v)
 
 void msrPart::acceptOut (basevisitor* v)
 {
-  if (gMsrOptions->fTraceMsrVisitors) {
-    gLogIOstream <<
+  if (gMsrOptions ()->fTraceMsrVisitors) {
+    gLogIOstream () <<
       "% ==> msrPart::acceptOut ()" <<
       endl;
   }
@@ -29810,8 +29791,8 @@ void msrPart::acceptOut (basevisitor* v)
       dynamic_cast<visitor<S_msrPart>*> (v)) {
         S_msrPart elem = this;
       
-        if (gMsrOptions->fTraceMsrVisitors) {
-          gLogIOstream <<
+        if (gMsrOptions ()->fTraceMsrVisitors) {
+          gLogIOstream () <<
             "% ==> Launching msrPart::visitEnd ()" <<
             endl;
         }
@@ -29821,8 +29802,8 @@ void msrPart::acceptOut (basevisitor* v)
 
 void msrPart::browseData (basevisitor* v)
 {
-  if (gMsrOptions->fTraceMsrVisitors) {
-    gLogIOstream <<
+  if (gMsrOptions ()->fTraceMsrVisitors) {
+    gLogIOstream () <<
       "% ==> msrPart::browseData ()" <<
       endl;
   }
@@ -29863,7 +29844,7 @@ void msrPart::print (ostream& os)
     ", line " << fInputLineNumber <<
     endl;
     
-  gIndenter++;
+  gIndenter ()++;
   
   const int fieldWidth = 27;
 
@@ -29932,7 +29913,7 @@ void msrPart::print (ostream& os)
 
   // print the registered staves
   if (fPartStavesMap.size ()) {
-    gIndenter++;
+    gIndenter ()++;
     
     map<int, S_msrStaff>::const_iterator
       iBegin = fPartStavesMap.begin (),
@@ -29960,13 +29941,13 @@ void msrPart::print (ostream& os)
           break;
           
         case msrStaff::kHarmonyStaff:
-    // JMI      if (gMsrOptions->fShowHarmonyVoices) {}
+    // JMI      if (gMsrOptions ()->fShowHarmonyVoices) {}
           os <<
             staff;
           break;
           
         case msrStaff::kFiguredBassStaff:
-    // JMI      if (gMsrOptions->fShowFiguredBassVoices) {}
+    // JMI      if (gMsrOptions ()->fShowFiguredBassVoices) {}
           os <<
             staff;
           break;
@@ -29988,10 +29969,10 @@ void msrPart::print (ostream& os)
         endl;
     } // for
 
-    gIndenter--;
+    gIndenter ()--;
   }
 
-  gIndenter--;
+  gIndenter ()--;
 }
 
 void msrPart::printSummary (ostream& os)
@@ -30008,7 +29989,7 @@ void msrPart::printSummary (ostream& os)
     ")" <<
     endl;
     
-  gIndenter++;
+  gIndenter ()++;
   
   const int fieldWidth = 27;
 
@@ -30068,7 +30049,7 @@ void msrPart::printSummary (ostream& os)
       "partStavesMap" <<
       endl;
               
-    gIndenter++;
+    gIndenter ()++;
   
     map<int, S_msrStaff>::const_iterator
       iBegin = fPartStavesMap.begin (),
@@ -30081,7 +30062,7 @@ void msrPart::printSummary (ostream& os)
       os << endl;
     } // for
 
-    gIndenter--;
+    gIndenter ()--;
   }
 
   // print the figured bass staff if any // JMI
@@ -30090,13 +30071,13 @@ void msrPart::printSummary (ostream& os)
       "partFiguredBassStaff" <<
       endl;
             
-    gIndenter++;
+    gIndenter ()++;
     os <<
       fPartFiguredBassStaff;
-    gIndenter--;
+    gIndenter ()--;
   }
 
-  gIndenter--;
+  gIndenter ()--;
 }
 
 ostream& operator<< (ostream& os, const S_msrPart& elt)
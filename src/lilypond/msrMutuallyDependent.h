@@ -1497,9 +1497,6 @@ class msrSegment : public msrElement
     // uplinks
     S_msrVoice            fSegmentVoiceUplink;
 
-    // counter
-    static int            gSegmentsCounter;
-
     // absolute number
     int                   fSegmentAbsoluteNumber;
         
@@ -6364,8 +6361,6 @@ class msrVoice : public msrElement
 
     // counters
     
-    static int            gVoicesCounter;
-
     int                   fVoiceActualNotesCounter;
     int                   fVoiceRestsCounter;
     int                   fVoiceSkipsCounter;
@@ -7443,10 +7438,6 @@ class msrPart : public msrElement
     // the registered staves map
     
     map<int, S_msrStaff>  fPartStavesMap;
-
-    // counter
-    
-    static int            gPartsCounter;
 };
 typedef SMARTP<msrPart> S_msrPart;
 EXP ostream& operator<< (ostream& os, const S_msrPart& elt);
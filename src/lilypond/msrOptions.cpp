@@ -83,7 +83,7 @@ void optionsPartRenameItem::print (ostream& os) const
     "OptionsPartRenameItem:" <<
     endl;
 
-  gIndenter++;
+  gIndenter ()++;
 
   printValuedItemEssentials (
     os, fieldWidth);
@@ -128,7 +128,7 @@ void optionsPartRenameItem::printOptionsValues (
     os << "none";
   }
   else {
-    gIndenter++;
+    gIndenter ()++;
     
     os <<
       endl;
@@ -150,7 +150,7 @@ void optionsPartRenameItem::printOptionsValues (
       os << endl;
     } // for
 
-    gIndenter--;
+    gIndenter ()--;
   }
   
   os <<
@@ -215,7 +215,7 @@ void optionsMsrPitchesLanguageItem::print (ostream& os) const
     "OptionsMsrPitchesLanguageItem:" <<
     endl;
 
-  gIndenter++;
+  gIndenter ()++;
 
   printValuedItemEssentials (
     os, fieldWidth);
@@ -254,10 +254,6 @@ ostream& operator<< (ostream& os, const S_optionsMsrPitchesLanguageItem& elt)
 }
 
 //_______________________________________________________________________________
-S_msrOptions gMsrOptions;
-S_msrOptions gMsrOptionsUserChoices;
-S_msrOptions gMsrOptionsWithDetailedTrace;
-
 S_msrOptions msrOptions::create (
   S_optionsHandler optionsHandler)
 {
@@ -354,7 +350,15 @@ R"(Write the structure of the part groups to standard error.)",
 R"(Write the contents of the MSR data to standard error.)",
           "displayMsr",
           fDisplayMsr,
-          gTraceOptions->fTracePasses));
+          gTraceOptions ()->fTracePasses));
+#else
+    traceAndDisplaySubGroup->
+      appendOptionsItem (
+        optionsBooleanItem::create (
+          "dmsr", "display-msr",
+R"(Write the contents of the MSR data to standard error.)",
+          "displayMsr",
+          fDisplayMsr));
 #endif
           
 #ifdef TRACE_OPTIONS
@@ -366,7 +370,16 @@ R"(Write the contents of the MSR data with more details to standard error.)",
           "displayMsrDetails",
           fDisplayMsrDetails,
           fDisplayMsr,
-          gTraceOptions->fTracePasses));
+          gTraceOptions ()->fTracePasses));
+#else
+    traceAndDisplaySubGroup->
+      appendOptionsItem (
+        optionsTwoBooleansItem::create (
+          "dmsrd", "display-msr-details",
+R"(Write the contents of the MSR data with more details to standard error.)",
+          "displayMsrDetails",
+          fDisplayMsrDetails,
+          fDisplayMsr));
 #endif
           
     traceAndDisplaySubGroup->
@@ -407,12 +420,12 @@ This implies that no LilyPond code is generated.)",
         " known MSR pitches languages are:" <<
         endl;
   
-      gIndenter++;
+      gIndenter ()++;
     
       s <<
         existingQuarterTonesPitchesLanguageKinds ();
   
-      gIndenter--;
+      gIndenter ()--;
   
       optionError (s.str ());
     }
@@ -875,23 +888,23 @@ void msrOptions::checkOptionsConsistency ()
 //______________________________________________________________________________
 void msrOptions::printMsrOptionsValues (int fieldWidth)
 {
-  gLogIOstream <<
+  gLogIOstream () <<
     "The MSR options are:" <<
     endl;
 
-  gIndenter++;
+  gIndenter ()++;
 
   
   // trace and display
   // --------------------------------------
   
-  gLogIOstream <<
+  gLogIOstream () <<
     "Trace and display:" <<
     endl;
 
-  gIndenter++;
+  gIndenter ()++;
   
-  gLogIOstream << left <<
+  gLogIOstream () << left <<
     setw (fieldWidth) << "traceMsr" << " : " <<
     booleanAsString (fTraceMsr) <<
     endl <<
@@ -919,42 +932,42 @@ void msrOptions::printMsrOptionsValues (int fieldWidth)
     booleanAsString (fDisplayMsrNames) <<
     endl;    
 
-  gIndenter--;
+  gIndenter ()--;
 
 
   // languages
   // --------------------------------------
   
-  gLogIOstream <<
+  gLogIOstream () <<
      "Languages:" <<
     endl;
 
-  gIndenter++;
+  gIndenter ()++;
 
-  gLogIOstream << left <<
+  gLogIOstream () << left <<
     setw (fieldWidth) << "msrPitchesLanguage" << " : \"" <<
     msrQuarterTonesPitchesLanguageKindAsString (
       fMsrQuarterTonesPitchesLanguageKind) <<
       "\"" <<
     endl;
 
-  gIndenter--;
+  gIndenter ()--;
 
 
   // parts
   // --------------------------------------
   
-  gLogIOstream <<
+  gLogIOstream () <<
      "Parts:" <<
     endl;
 
-  gIndenter++;
+  gIndenter ()++;
 
-  gLogIOstream << left <<
+  gLogIOstream () << left <<
     setw (fieldWidth) << "parts renaming" << " : ";
 
   if (! fPartsRenamingMap.size ()) {
-    gLogIOstream <<
+    gLogIOstream () <<
       "none";
   }
   
@@ -964,63 +977,63 @@ void msrOptions::printMsrOptionsValues (int fieldWidth)
         fPartsRenamingMap.begin ();
       i != fPartsRenamingMap.end ();
       i++) {
-        gLogIOstream <<
+        gLogIOstream () <<
           "\"" << ((*i).first) << " = " << ((*i).second) << "\" ";
     } // for
   }
 
-  gLogIOstream <<
+  gLogIOstream () <<
     endl;
 
-  gIndenter--;
+  gIndenter ()--;
 
 
   // voices
   // --------------------------------------
   
-  gLogIOstream <<
+  gLogIOstream () <<
     "Voices:" <<
     endl;
 
-  gIndenter++;
+  gIndenter ()++;
 
-  gLogIOstream << left <<
+  gLogIOstream () << left <<
     setw (fieldWidth) <<
     "createVoicesStaffRelativeNumbers" << " : " <<
     booleanAsString (fCreateVoicesStaffRelativeNumbers) <<
     endl;
 
-  gIndenter--;
+  gIndenter ()--;
 
 
   // repeats
   // --------------------------------------
   
-  gLogIOstream <<
+  gLogIOstream () <<
     "Repeats:" <<
     endl;
 
-  gIndenter++;
+  gIndenter ()++;
 
-  gLogIOstream << left <<
+  gLogIOstream () << left <<
     setw (fieldWidth) <<
     "createImplicitInitialRepeatBarline" << " : " <<
     booleanAsString (fCreateImplicitInitialRepeatBarline) <<
     endl;
 
-  gIndenter--;
+  gIndenter ()--;
 
 
   // notes
   // --------------------------------------
   
-  gLogIOstream <<
+  gLogIOstream () <<
      "Notes:" <<
     endl;
 
-  gIndenter++;
+  gIndenter ()++;
 
-  gLogIOstream << left << 
+  gLogIOstream () << left << 
     setw (fieldWidth) << "delayRestsDynamics" << " : " <<
     booleanAsString (fDelayRestsDynamics) <<
     endl <<
@@ -1049,60 +1062,60 @@ void msrOptions::printMsrOptionsValues (int fieldWidth)
     booleanAsString (fDelayRestsWedges) <<
     endl;
 
-  gIndenter--;
+  gIndenter ()--;
 
    
   // lyrics
   // --------------------------------------
 
-  gLogIOstream <<
+  gLogIOstream () <<
     "Lyrics:" <<
     endl;
 
-  gIndenter++;
+  gIndenter ()++;
 
-  gLogIOstream <<
+  gLogIOstream () <<
     setw (fieldWidth) << "addStanzasNumbers" << " : " <<
     booleanAsString (fAddStanzasNumbers) <<
     endl;
 
-  gIndenter--;
+  gIndenter ()--;
 
 
   // harmonies
   // --------------------------------------
   
-  gLogIOstream <<
+  gLogIOstream () <<
     "Harmonies:" <<
     endl;
 
-  gIndenter++;    
+  gIndenter ()++;    
 
-  gLogIOstream << left <<
+  gLogIOstream () << left <<
     setw (fieldWidth) << "showHarmonyVoices" << " : " <<
     booleanAsString (fShowHarmonyVoices) <<
     endl;
   
-  gIndenter--;
+  gIndenter ()--;
 
   
   // figured bass
   // --------------------------------------
   
-  gLogIOstream <<
+  gLogIOstream () <<
     "Figured bass:" <<
     endl;
 
-  gIndenter++;    
+  gIndenter ()++;    
 
-  gLogIOstream << left <<
+  gLogIOstream () << left <<
     setw (fieldWidth) << "showFiguredBassVoices" << " : " <<
     booleanAsString (fShowFiguredBassVoices) <<
     endl;
   
-  gIndenter--;
+  gIndenter ()--;
   
-  gIndenter--;
+  gIndenter ()--;
 }
 
 S_optionsItem msrOptions::handleOptionsItem (
@@ -1118,7 +1131,7 @@ S_optionsItem msrOptions::handleOptionsItem (
         dynamic_cast<optionsPartRenameItem*>(&(*item))
     ) {
 #ifdef TRACE_OPTIONS
-    if (gTraceOptions->fTraceOptions) {
+    if (gTraceOptions ()->fTraceOptions) {
       os <<
         "==> optionsItem is of type 'optionsPartRenameItem'" <<
         endl;
@@ -1136,7 +1149,7 @@ S_optionsItem msrOptions::handleOptionsItem (
         dynamic_cast<optionsMsrPitchesLanguageItem*>(&(*item))
     ) {
 #ifdef TRACE_OPTIONS
-    if (gTraceOptions->fTraceOptions) {
+    if (gTraceOptions ()->fTraceOptions) {
       os <<
         "==> optionsItem is of type 'optionsMsrPitchesLanguageItem'" <<
         endl;
@@ -1165,7 +1178,7 @@ void msrOptions::handleOptionsItemValue (
     // decipher it to extract the old and new part names
 
 #ifdef TRACE_OPTIONS
-    if (gTraceOptions->fTraceOptions) {
+    if (gTraceOptions ()->fTraceOptions) {
       os <<
         "==> optionsItem is of type 'optionsPartRenameItem'" <<
         endl;
@@ -1183,7 +1196,7 @@ void msrOptions::handleOptionsItemValue (
     regex_match (theString, sm, e);
 
 #ifdef TRACE_OPTIONS
-    if (gTraceOptions->fTraceOptions) {
+    if (gTraceOptions ()->fTraceOptions) {
       os <<
         "There are " << sm.size () << " matches" <<
         " for part rename string '" << theString <<
@@ -1195,7 +1208,7 @@ void msrOptions::handleOptionsItemValue (
   
     if (sm.size ()) {
 #ifdef TRACE_OPTIONS
-      if (gTraceOptions->fTraceOptions) {
+      if (gTraceOptions ()->fTraceOptions) {
         for (unsigned i = 0; i < sm.size (); ++i) {
           os <<
             "[" << sm [i] << "] ";
@@ -1228,7 +1241,7 @@ void msrOptions::handleOptionsItemValue (
       newPartName = sm [2];
       
 #ifdef TRACE_OPTIONS
-    if (gTraceOptions->fTraceOptions) {
+    if (gTraceOptions ()->fTraceOptions) {
       os <<
         "--> oldPartName = \"" << oldPartName << "\", " <<
         "--> newPartName = \"" << newPartName << "\"" <<
@@ -1275,7 +1288,7 @@ void msrOptions::handleOptionsItemValue (
     // is it in the pitches languages map?
 
 #ifdef TRACE_OPTIONS
-    if (gTraceOptions->fTraceOptions) {
+    if (gTraceOptions ()->fTraceOptions) {
       os <<
         "==> optionsItem is of type 'optionsMsrPitchesLanguageItem'" <<
         endl;
@@ -1303,12 +1316,12 @@ void msrOptions::handleOptionsItemValue (
         " known MSR pitches languages are:" <<
         endl;
   
-      gIndenter++;
+      gIndenter ()++;
     
       s <<
         existingQuarterTonesPitchesLanguageKinds ();
   
-      gIndenter--;
+      gIndenter ()--;
   
       optionError (s.str ());
       
@@ -1335,18 +1348,18 @@ void initializeMsrOptionsHandling (
   // MSR options
   // ------------------------------------------------------
  
-  gMsrOptionsUserChoices = msrOptions::create (
+  gMsrOptionsUserChoices () = msrOptions::create (
     optionsHandler);
-  assert(gMsrOptionsUserChoices != 0);
+  assert(gMsrOptionsUserChoices () != 0);
 
-  gMsrOptions =
-    gMsrOptionsUserChoices;
+  gMsrOptions () =
+    gMsrOptionsUserChoices ();
 
   // prepare for measure detailed trace
   // ------------------------------------------------------
 
-  gMsrOptionsWithDetailedTrace =
-    gMsrOptions->
+  gMsrOptionsWithDetailedTrace () =
+    gMsrOptions ()->
       createCloneWithDetailedTrace ();
 }
 
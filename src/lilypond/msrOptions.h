@@ -319,9 +319,9 @@ class msrOptions : public optionsGroup
 typedef SMARTP<msrOptions> S_msrOptions;
 EXP ostream& operator<< (ostream& os, const S_msrOptions& elt);
 
-EXP extern S_msrOptions gMsrOptions;
-EXP extern S_msrOptions gMsrOptionsUserChoices;
-EXP extern S_msrOptions gMsrOptionsWithDetailedTrace;
+// gMsrOptions (), gMsrOptionsUserChoices () and
+// gMsrOptionsWithDetailedTrace () are those of the current conversion
+// context, see conversionContext.h
 
 //______________________________________________________________________________
 void initializeMsrOptionsHandling (
@@ -47,8 +47,8 @@ msrSegno::~msrSegno ()
 
 void msrSegno::acceptIn (basevisitor* v)
 {
-  if (gMsrOptions->fTraceMsrVisitors) {
-    gLogIOstream <<
+  if (gMsrOptions ()->fTraceMsrVisitors) {
+    gLogIOstream () <<
       "% ==> msrSegno::acceptIn ()" <<
       endl;
   }
@@ -58,8 +58,8 @@ void msrSegno::acceptIn (basevisitor* v)
       dynamic_cast<visitor<S_msrSegno>*> (v)) {
         S_msrSegno elem = this;
         
-        if (gMsrOptions->fTraceMsrVisitors) {
-          gLogIOstream <<
+        if (gMsrOptions ()->fTraceMsrVisitors) {
+          gLogIOstream () <<
             "% ==> Launching msrSegno::visitStart ()" <<
             endl;
         }
@@ -69,8 +69,8 @@ void msrSegno::acceptIn (basevisitor* v)
 
 void msrSegno::acceptOut (basevisitor* v)
 {
-  if (gMsrOptions->fTraceMsrVisitors) {
-    gLogIOstream <<
+  if (gMsrOptions ()->fTraceMsrVisitors) {
+    gLogIOstream () <<
       "% ==> msrSegno::acceptOut ()" <<
       endl;
   }
@@ -80,8 +80,8 @@ void msrSegno::acceptOut (basevisitor* v)
       dynamic_cast<visitor<S_msrSegno>*> (v)) {
         S_msrSegno elem = this;
       
-        if (gMsrOptions->fTraceMsrVisitors) {
-          gLogIOstream <<
+        if (gMsrOptions ()->fTraceMsrVisitors) {
+          gLogIOstream () <<
             "% ==> Launching msrSegno::visitEnd ()" <<
             endl;
         }
@@ -127,8 +127,8 @@ msrCoda::~msrCoda ()
 
 void msrCoda::acceptIn (basevisitor* v)
 {
-  if (gMsrOptions->fTraceMsrVisitors) {
-    gLogIOstream <<
+  if (gMsrOptions ()->fTraceMsrVisitors) {
+    gLogIOstream () <<
       "% ==> msrCoda::acceptIn ()" <<
       endl;
   }
@@ -138,8 +138,8 @@ void msrCoda::acceptIn (basevisitor* v)
       dynamic_cast<visitor<S_msrCoda>*> (v)) {
         S_msrCoda elem = this;
         
-        if (gMsrOptions->fTraceMsrVisitors) {
-          gLogIOstream <<
+        if (gMsrOptions ()->fTraceMsrVisitors) {
+          gLogIOstream () <<
             "% ==> Launching msrCoda::visitStart ()" <<
             endl;
         }
@@ -149,8 +149,8 @@ void msrCoda::acceptIn (basevisitor* v)
 
 void msrCoda::acceptOut (basevisitor* v)
 {
-  if (gMsrOptions->fTraceMsrVisitors) {
-    gLogIOstream <<
+  if (gMsrOptions ()->fTraceMsrVisitors) {
+    gLogIOstream () <<
       "% ==> msrCoda::acceptOut ()" <<
       endl;
   }
@@ -160,8 +160,8 @@ void msrCoda::acceptOut (basevisitor* v)
       dynamic_cast<visitor<S_msrCoda>*> (v)) {
         S_msrCoda elem = this;
       
-        if (gMsrOptions->fTraceMsrVisitors) {
-          gLogIOstream <<
+        if (gMsrOptions ()->fTraceMsrVisitors) {
+          gLogIOstream () <<
             "% ==> Launching msrCoda::visitEnd ()" <<
             endl;
         }
@@ -207,8 +207,8 @@ msrEyeGlasses::~msrEyeGlasses ()
 
 void msrEyeGlasses::acceptIn (basevisitor* v)
 {
-  if (gMsrOptions->fTraceMsrVisitors) {
-    gLogIOstream <<
+  if (gMsrOptions ()->fTraceMsrVisitors) {
+    gLogIOstream () <<
       "% ==> msrEyeGlasses::acceptIn ()" <<
       endl;
   }
@@ -218,8 +218,8 @@ void msrEyeGlasses::acceptIn (basevisitor* v)
       dynamic_cast<visitor<S_msrEyeGlasses>*> (v)) {
         S_msrEyeGlasses elem = this;
         
-        if (gMsrOptions->fTraceMsrVisitors) {
-          gLogIOstream <<
+        if (gMsrOptions ()->fTraceMsrVisitors) {
+          gLogIOstream () <<
             "% ==> Launching msrEyeGlasses::visitStart ()" <<
             endl;
         }
@@ -229,8 +229,8 @@ void msrEyeGlasses::acceptIn (basevisitor* v)
 
 void msrEyeGlasses::acceptOut (basevisitor* v)
 {
-  if (gMsrOptions->fTraceMsrVisitors) {
-    gLogIOstream <<
+  if (gMsrOptions ()->fTraceMsrVisitors) {
+    gLogIOstream () <<
       "% ==> msrEyeGlasses::acceptOut ()" <<
       endl;
   }
@@ -240,8 +240,8 @@ void msrEyeGlasses::acceptOut (basevisitor* v)
       dynamic_cast<visitor<S_msrEyeGlasses>*> (v)) {
         S_msrEyeGlasses elem = this;
       
-        if (gMsrOptions->fTraceMsrVisitors) {
-          gLogIOstream <<
+        if (gMsrOptions ()->fTraceMsrVisitors) {
+          gLogIOstream () <<
             "% ==> Launching msrEyeGlasses::visitEnd ()" <<
             endl;
         }
@@ -132,14 +132,14 @@ float msrPageGeometry::globalStaffSize () const
   float staffSize = lilyPondDefaultStaffSize * ratio;
 
 #ifdef TRACE_OPTIONS
-  if (gTraceOptions->fTraceGeometry) {
-    gLogIOstream <<
+  if (gTraceOptions ()->fTraceGeometry) {
+    gLogIOstream () <<
       "globalStaffSize ():" <<
       endl;
 
-    gIndenter++;
+    gIndenter ()++;
 
-    gLogIOstream <<
+    gLogIOstream () <<
       "lilyPondDefaultStaffSize" << " : " <<
       lilyPondDefaultStaffSize <<
       endl <<
@@ -156,13 +156,13 @@ float msrPageGeometry::globalStaffSize () const
       staffSize <<
       endl;
     
-    gIndenter--;
+    gIndenter ()--;
   }
 #endif
   
   if (staffSize < 1.0 || staffSize > 100.0) {
 #ifdef TRACE_OPTIONS
-    if (gTraceOptions->fTraceGeometry) {
+    if (gTraceOptions ()->fTraceGeometry) {
       stringstream s;
 
       s <<
@@ -171,7 +171,7 @@ float msrPageGeometry::globalStaffSize () const
         endl;
 
       msrMusicXMLWarning (
-        gXml2lyOptions->fInputSourceName,
+        gXml2lyOptions ()->fInputSourceName,
         fInputLineNumber,
         s.str ());
     }
@@ -185,8 +185,8 @@ float msrPageGeometry::globalStaffSize () const
 
 void msrPageGeometry::acceptIn (basevisitor* v)
 {
-  if (gMsrOptions->fTraceMsrVisitors) {
-    gLogIOstream <<
+  if (gMsrOptions ()->fTraceMsrVisitors) {
+    gLogIOstream () <<
       "% ==> msrPageGeometry::acceptIn ()" <<
       endl;
   }
@@ -196,8 +196,8 @@ void msrPageGeometry::acceptIn (basevisitor* v)
       dynamic_cast<visitor<S_msrPageGeometry>*> (v)) {
         S_msrPageGeometry elem = this;
         
-        if (gMsrOptions->fTraceMsrVisitors) {
-          gLogIOstream <<
+        if (gMsrOptions ()->fTraceMsrVisitors) {
+          gLogIOstream () <<
             "% ==> Launching msrPageGeometry::visitStart ()" <<
             endl;
         }
@@ -207,8 +207,8 @@ void msrPageGeometry::acceptIn (basevisitor* v)
 
 void msrPageGeometry::acceptOut (basevisitor* v)
 {
-  if (gMsrOptions->fTraceMsrVisitors) {
-    gLogIOstream <<
+  if (gMsrOptions ()->fTraceMsrVisitors) {
+    gLogIOstream () <<
       "% ==> msrPageGeometry::acceptOut ()" <<
       endl;
   }
@@ -218,8 +218,8 @@ void msrPageGeometry::acceptOut (basevisitor* v)
       dynamic_cast<visitor<S_msrPageGeometry>*> (v)) {
         S_msrPageGeometry elem = this;
       
-        if (gMsrOptions->fTraceMsrVisitors) {
-          gLogIOstream <<
+        if (gMsrOptions ()->fTraceMsrVisitors) {
+          gLogIOstream () <<
             "% ==> Launching msrPageGeometry::visitEnd ()" <<
             endl;
         }
@@ -242,7 +242,7 @@ void msrPageGeometry::print (ostream& os) {
 
   bool emptyGeometry = true;
   
-  gIndenter++;
+  gIndenter ()++;
   
   const int fieldWidth = 13;
 
@@ -338,7 +338,7 @@ void msrPageGeometry::print (ostream& os) {
       endl;
   }
   
-  gIndenter--;
+  gIndenter ()--;
 }
 
 /* JMI
@@ -158,8 +158,8 @@ msrPartGroup::msrPartGroup (
   fPartGroupBarlineKind     = partGroupBarlineKind;
 
 #ifdef TRACE_OPTIONS
-  if (gTraceOptions->fTracePartGroups) {
-    gLogIOstream <<
+  if (gTraceOptions ()->fTracePartGroups) {
+    gLogIOstream () <<
       "--------------------------------------------" <<
       endl <<
       "Creating part group '" << fPartGroupNumber << "'" <<
@@ -178,8 +178,8 @@ S_msrPartGroup msrPartGroup::createPartGroupNewbornClone (
   S_msrScore     scoreClone)
 {
 #ifdef TRACE_OPTIONS
-  if (gTraceOptions->fTracePartGroups) {
-    gLogIOstream <<
+  if (gTraceOptions ()->fTracePartGroups) {
+    gLogIOstream () <<
       "--------------------------------------------" <<
       endl <<
       "Creating a newborn clone part group " <<
@@ -278,7 +278,7 @@ S_msrPart msrPartGroup::appendPartToPartGroupByItsPartID (
       getPartGroupCombinedName ();
 
     msrMusicXMLWarning ( // JMI
-      gXml2lyOptions->fInputSourceName,
+      gXml2lyOptions ()->fInputSourceName,
       inputLineNumber,
       s.str ());
 
@@ -295,8 +295,8 @@ S_msrPart msrPartGroup::appendPartToPartGroupByItsPartID (
 
   // register it in this part group
 #ifdef TRACE_OPTIONS
-  if (gTraceOptions->fTracePartGroups) {
-    gLogIOstream <<
+  if (gTraceOptions ()->fTracePartGroups) {
+    gLogIOstream () <<
       "Adding part " <<
       part->getPartCombinedName () <<
       " to part group '" <<
@@ -310,32 +310,32 @@ S_msrPart msrPartGroup::appendPartToPartGroupByItsPartID (
   fPartGroupElements.push_back (part);
 
 #ifdef TRACE_OPTIONS
-  if (gTraceOptions->fTracePartGroupsDetails) {
-    gLogIOstream <<
+  if (gTraceOptions ()->fTracePartGroupsDetails) {
+    gLogIOstream () <<
       endl <<
       "After appendPartToPartGroupByItsID, fPartGroupPartsMap contains:" <<
       endl;
         
-    gIndenter++;
+    gIndenter ()++;
     
     for (
         map<string, S_msrPart>::const_iterator i = fPartGroupPartsMap.begin ();
         i != fPartGroupPartsMap.end ();
         i++) {
-      gLogIOstream <<
+      gLogIOstream () <<
         "\"" << (*i).first << "\" --% --> " <<
         (*i).second->
           getPartCombinedName () <<
         endl;
     } // for
     
-    gIndenter--;
+    gIndenter ()--;
     
-    gLogIOstream <<
+    gLogIOstream () <<
       "After appendPartToPartGroupByItsID, fPartGroupElements contains:" <<
       endl;
       
-    gIndenter++;
+    gIndenter ()++;
 
     if (fPartGroupElements.size ()) {
       list<S_msrElement>::const_iterator
@@ -344,15 +344,15 @@ S_msrPart msrPartGroup::appendPartToPartGroupByItsPartID (
         i      = iBegin;
         
       for ( ; ; ) {
-        gLogIOstream <<
+        gLogIOstream () <<
           (*i);
         if (++i == iEnd) break;
-        gLogIOstream <<
+        gLogIOstream () <<
           endl;
       } // for
     }
     
-    gIndenter--;
+    gIndenter ()--;
   }
 #endif
   
@@ -364,8 +364,8 @@ void msrPartGroup::appendPartToPartGroup (S_msrPart part)
 {
   // register part in this part group
 #ifdef TRACE_OPTIONS
-  if (gTraceOptions->fTracePartGroups) {
-    gLogIOstream <<
+  if (gTraceOptions ()->fTracePartGroups) {
+    gLogIOstream () <<
       "Adding part " <<
       part->getPartCombinedName () <<
       " to part group " << fPartGroupNumber <<
@@ -387,8 +387,8 @@ void msrPartGroup::removePartFromPartGroup (
 {
   // register part in this part group
 #ifdef TRACE_OPTIONS
-  if (gTraceOptions->fTracePartGroups) {
-    gLogIOstream <<
+  if (gTraceOptions ()->fTracePartGroups) {
+    gLogIOstream () <<
       "Removing part " <<
       partToBeRemoved->getPartCombinedName () <<
       " from part group " << fPartGroupNumber <<
@@ -396,7 +396,7 @@ void msrPartGroup::removePartFromPartGroup (
   }
 #endif
 
-  gIndenter++;
+  gIndenter ()++;
   
   for (
     list<S_msrElement>::iterator i = fPartGroupElements.begin ();
@@ -434,22 +434,22 @@ void msrPartGroup::removePartFromPartGroup (
         " is not a part group nor a part";
 
       msrInternalError (
-        gXml2lyOptions->fInputSourceName,
+        gXml2lyOptions ()->fInputSourceName,
         inputLineNumber,
         __FILE__, __LINE__,
         s.str ());
     }
   } // for
 
-  gIndenter--;
+  gIndenter ()--;
 }
 
 void msrPartGroup::prependSubPartGroupToPartGroup (
   S_msrPartGroup partGroup)
 {
 #ifdef TRACE_OPTIONS
-  if (gTraceOptions->fTracePartGroups) {
-    gLogIOstream <<
+  if (gTraceOptions ()->fTracePartGroups) {
+    gLogIOstream () <<
       "Prepending (sub-)part group " << partGroup->getPartGroupNumber () <<
       " to part group " << getPartGroupNumber ()  << endl;
   }
@@ -463,8 +463,8 @@ void msrPartGroup::appendSubPartGroupToPartGroup (
   S_msrPartGroup partGroup)
 {
 #ifdef TRACE_OPTIONS
-  if (gTraceOptions->fTracePartGroups) {
-    gLogIOstream <<
+  if (gTraceOptions ()->fTracePartGroups) {
+    gLogIOstream () <<
       "Appending (sub-)part group " << partGroup->getPartGroupNumber () <<
       " to part group " << getPartGroupNumber ()  << endl;
   }
@@ -492,19 +492,19 @@ void msrPartGroup::printPartGroupParts (
           dynamic_cast<msrPartGroup*>(&(*element))
       ) {
       // this is a part group          
-      gLogIOstream <<
+      gLogIOstream () <<
         nestedPartGroup->
           getPartGroupCombinedName () <<
         endl;
 
-      gIndenter++;
+      gIndenter ()++;
 
       nestedPartGroup->
         printPartGroupParts (
           inputLineNumber,
           os);
       
-      gIndenter--;
+      gIndenter ()--;
     }
 
     else if (
@@ -513,7 +513,7 @@ void msrPartGroup::printPartGroupParts (
           dynamic_cast<msrPart*>(&(*element))
       ) {
       // this is a part
-      gLogIOstream <<
+      gLogIOstream () <<
         part->
           getPartCombinedName () <<
         endl;
@@ -528,7 +528,7 @@ void msrPartGroup::printPartGroupParts (
         " is not a part group nor a part";
 
       msrInternalError (
-        gXml2lyOptions->fInputSourceName,
+        gXml2lyOptions ()->fInputSourceName,
         inputLineNumber,
         __FILE__, __LINE__,
         s.str ());
@@ -543,20 +543,20 @@ S_msrPart msrPartGroup::fetchPartFromPartGroupByItsPartID (
   S_msrPart result;
   
 #ifdef TRACE_OPTIONS
-  if (gTraceOptions->fTracePartGroupsDetails) {    
-    gLogIOstream <<
+  if (gTraceOptions ()->fTracePartGroupsDetails) {    
+    gLogIOstream () <<
       "fetchPartFromPartGroupByItsPartID(" << partID << "), fPartGroupElements contains:" <<
       endl;
 
-    gIndenter++;
+    gIndenter ()++;
 
     printPartGroupParts (
       inputLineNumber,
-      gLogIOstream);
+      gLogIOstream ());
     
-    gIndenter--;
+    gIndenter ()--;
 
-    gLogIOstream <<
+    gLogIOstream () <<
       "<=- fetchPartFromPartGroupByItsPartID(" << partID << ")" <<
       endl <<
       endl;
@@ -617,7 +617,7 @@ S_msrPart msrPartGroup::fetchPartFromPartGroupByItsPartID (
         " is not a part group nor a part";
 
       msrInternalError (
-        gXml2lyOptions->fInputSourceName,
+        gXml2lyOptions ()->fInputSourceName,
         inputLineNumber,
         __FILE__, __LINE__,
         s.str ());
@@ -668,7 +668,7 @@ void msrPartGroup::collectPartGroupPartsList (
         " is not a part group nor a part";
 
       msrInternalError (
-        gXml2lyOptions->fInputSourceName,
+        gXml2lyOptions ()->fInputSourceName,
         inputLineNumber,
         __FILE__, __LINE__,
         s.str ());
@@ -678,8 +678,8 @@ void msrPartGroup::collectPartGroupPartsList (
 
 void msrPartGroup::acceptIn (basevisitor* v)
 {
-  if (gMsrOptions->fTraceMsrVisitors) {
-    gLogIOstream <<
+  if (gMsrOptions ()->fTraceMsrVisitors) {
+    gLogIOstream () <<
       "% ==> msrPartGroup::acceptIn ()" <<
       endl;
   }
@@ -689,8 +689,8 @@ void msrPartGroup::acceptIn (basevisitor* v)
       dynamic_cast<visitor<S_msrPartGroup>*> (v)) {
         S_msrPartGroup elem = this;
         
-        if (gMsrOptions->fTraceMsrVisitors) {
-          gLogIOstream <<
+        if (gMsrOptions ()->fTraceMsrVisitors) {
+          gLogIOstream () <<
             "% ==> Launching msrPartGroup::visitStart ()" <<
             endl;
         }
@@ -700,8 +700,8 @@ void msrPartGroup::acceptIn (basevisitor* v)
 
 void msrPartGroup::acceptOut (basevisitor* v)
 {
-  if (gMsrOptions->fTraceMsrVisitors) {
-    gLogIOstream <<
+  if (gMsrOptions ()->fTraceMsrVisitors) {
+    gLogIOstream () <<
       "% ==> msrPartGroup::acceptOut ()" <<
       endl;
   }
@@ -711,8 +711,8 @@ void msrPartGroup::acceptOut (basevisitor* v)
       dynamic_cast<visitor<S_msrPartGroup>*> (v)) {
         S_msrPartGroup elem = this;
       
-        if (gMsrOptions->fTraceMsrVisitors) {
-          gLogIOstream <<
+        if (gMsrOptions ()->fTraceMsrVisitors) {
+          gLogIOstream () <<
             "% ==> Launching msrPartGroup::visitEnd ()" <<
             endl;
         }
@@ -722,8 +722,8 @@ void msrPartGroup::acceptOut (basevisitor* v)
 
 void msrPartGroup::browseData (basevisitor* v)
 {
-  if (gMsrOptions->fTraceMsrVisitors) {
-    gLogIOstream <<
+  if (gMsrOptions ()->fTraceMsrVisitors) {
+    gLogIOstream () <<
       "% ==> msrPartGroup::browseData ()" <<
       endl;
   }
@@ -737,8 +737,8 @@ void msrPartGroup::browseData (basevisitor* v)
     browser.browse (*(*i));
   } // for
 
-  if (gMsrOptions->fTraceMsrVisitors) {
-    gLogIOstream <<
+  if (gMsrOptions ()->fTraceMsrVisitors) {
+    gLogIOstream () <<
       "% <== msrPartGroup::browseData ()" <<
       endl;
   }
@@ -861,7 +861,7 @@ void msrPartGroup::print (ostream& os)
     ", line " << fInputLineNumber <<
     endl;
     
-  gIndenter++;
+  gIndenter ()++;
 
   const int fieldWidth = 25;
   
@@ -960,7 +960,7 @@ void msrPartGroup::print (ostream& os)
     } // for
   }
   
-  gIndenter--;
+  gIndenter ()--;
 }
 
 void msrPartGroup::printSummary (ostream& os)
@@ -973,7 +973,7 @@ void msrPartGroup::printSummary (ostream& os)
     ")" <<
     endl;
     
-  gIndenter++;
+  gIndenter ()++;
 
   const int fieldWidth = 24;
   
@@ -1018,16 +1018,16 @@ void msrPartGroup::printSummary (ostream& os)
       iEnd   = fPartGroupElements.end (),
       i      = iBegin;
       
-    gIndenter++;
+    gIndenter ()++;
     for ( ; ; ) {
       (*i)->printSummary (os);
       if (++i == iEnd) break;
       os << endl;
     } // for
-    gIndenter--;
+    gIndenter ()--;
   }
   
-  gIndenter--;
+  gIndenter ()--;
 }
 
 ostream& operator<< (ostream& os, const S_msrPartGroup& elt)
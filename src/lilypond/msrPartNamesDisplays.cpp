@@ -51,8 +51,8 @@ msrPartNameDisplay::~msrPartNameDisplay ()
 
 void msrPartNameDisplay::acceptIn (basevisitor* v)
 {
-  if (gMsrOptions->fTraceMsrVisitors) {
-    gLogIOstream <<
+  if (gMsrOptions ()->fTraceMsrVisitors) {
+    gLogIOstream () <<
       "% ==> msrPartNameDisplay::acceptIn ()" <<
       endl;
   }
@@ -62,8 +62,8 @@ void msrPartNameDisplay::acceptIn (basevisitor* v)
       dynamic_cast<visitor<S_msrPartNameDisplay>*> (v)) {
         S_msrPartNameDisplay elem = this;
         
-        if (gMsrOptions->fTraceMsrVisitors) {
-          gLogIOstream <<
+        if (gMsrOptions ()->fTraceMsrVisitors) {
+          gLogIOstream () <<
             "% ==> Launching msrPartNameDisplay::visitStart ()" <<
             endl;
         }
@@ -73,8 +73,8 @@ void msrPartNameDisplay::acceptIn (basevisitor* v)
 
 void msrPartNameDisplay::acceptOut (basevisitor* v)
 {
-  if (gMsrOptions->fTraceMsrVisitors) {
-    gLogIOstream <<
+  if (gMsrOptions ()->fTraceMsrVisitors) {
+    gLogIOstream () <<
       "% ==> msrPartNameDisplay::acceptOut ()" <<
       endl;
   }
@@ -84,8 +84,8 @@ void msrPartNameDisplay::acceptOut (basevisitor* v)
       dynamic_cast<visitor<S_msrPartNameDisplay>*> (v)) {
         S_msrPartNameDisplay elem = this;
       
-        if (gMsrOptions->fTraceMsrVisitors) {
-          gLogIOstream <<
+        if (gMsrOptions ()->fTraceMsrVisitors) {
+          gLogIOstream () <<
             "% ==> Launching msrPartNameDisplay::visitEnd ()" <<
             endl;
         }
@@ -146,8 +146,8 @@ msrPartAbbreviationDisplay::~msrPartAbbreviationDisplay ()
 
 void msrPartAbbreviationDisplay::acceptIn (basevisitor* v)
 {
-  if (gMsrOptions->fTraceMsrVisitors) {
-    gLogIOstream <<
+  if (gMsrOptions ()->fTraceMsrVisitors) {
+    gLogIOstream () <<
       "% ==> msrPartAbbreviationDisplay::acceptIn ()" <<
       endl;
   }
@@ -157,8 +157,8 @@ void msrPartAbbreviationDisplay::acceptIn (basevisitor* v)
       dynamic_cast<visitor<S_msrPartAbbreviationDisplay>*> (v)) {
         S_msrPartAbbreviationDisplay elem = this;
         
-        if (gMsrOptions->fTraceMsrVisitors) {
-          gLogIOstream <<
+        if (gMsrOptions ()->fTraceMsrVisitors) {
+          gLogIOstream () <<
             "% ==> Launching msrPartAbbreviationDisplay::visitStart ()" <<
             endl;
         }
@@ -168,8 +168,8 @@ void msrPartAbbreviationDisplay::acceptIn (basevisitor* v)
 
 void msrPartAbbreviationDisplay::acceptOut (basevisitor* v)
 {
-  if (gMsrOptions->fTraceMsrVisitors) {
-    gLogIOstream <<
+  if (gMsrOptions ()->fTraceMsrVisitors) {
+    gLogIOstream () <<
       "% ==> msrPartAbbreviationDisplay::acceptOut ()" <<
       endl;
   }
@@ -179,8 +179,8 @@ void msrPartAbbreviationDisplay::acceptOut (basevisitor* v)
       dynamic_cast<visitor<S_msrPartAbbreviationDisplay>*> (v)) {
         S_msrPartAbbreviationDisplay elem = this;
       
-        if (gMsrOptions->fTraceMsrVisitors) {
-          gLogIOstream <<
+        if (gMsrOptions ()->fTraceMsrVisitors) {
+          gLogIOstream () <<
             "% ==> Launching msrPartAbbreviationDisplay::visitEnd ()" <<
             endl;
         }
@@ -62,8 +62,8 @@ msrRehearsal::~msrRehearsal ()
 
 void msrRehearsal::acceptIn (basevisitor* v)
 {
-  if (gMsrOptions->fTraceMsrVisitors) {
-    gLogIOstream <<
+  if (gMsrOptions ()->fTraceMsrVisitors) {
+    gLogIOstream () <<
       "% ==> msrRehearsal::acceptIn ()" <<
       endl;
   }
@@ -73,8 +73,8 @@ void msrRehearsal::acceptIn (basevisitor* v)
       dynamic_cast<visitor<S_msrRehearsal>*> (v)) {
         S_msrRehearsal elem = this;
         
-        if (gMsrOptions->fTraceMsrVisitors) {
-          gLogIOstream <<
+        if (gMsrOptions ()->fTraceMsrVisitors) {
+          gLogIOstream () <<
             "% ==> Launching msrRehearsal::visitStart ()" <<
             endl;
         }
@@ -84,8 +84,8 @@ void msrRehearsal::acceptIn (basevisitor* v)
 
 void msrRehearsal::acceptOut (basevisitor* v)
 {
-  if (gMsrOptions->fTraceMsrVisitors) {
-    gLogIOstream <<
+  if (gMsrOptions ()->fTraceMsrVisitors) {
+    gLogIOstream () <<
       "% ==> msrRehearsal::acceptOut ()" <<
       endl;
   }
@@ -95,8 +95,8 @@ void msrRehearsal::acceptOut (basevisitor* v)
       dynamic_cast<visitor<S_msrRehearsal>*> (v)) {
         S_msrRehearsal elem = this;
       
-        if (gMsrOptions->fTraceMsrVisitors) {
-          gLogIOstream <<
+        if (gMsrOptions ()->fTraceMsrVisitors) {
+          gLogIOstream () <<
             "% ==> Launching msrRehearsal::visitEnd ()" <<
             endl;
         }
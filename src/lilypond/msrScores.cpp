@@ -79,8 +79,8 @@ msrScore::~msrScore ()
 S_msrScore msrScore::createScoreNewbornClone ()
 {
 #ifdef TRACE_OPTIONS
-  if (gTraceOptions->fTraceScore) {
-    gLogIOstream <<
+  if (gTraceOptions ()->fTraceScore) {
+    gLogIOstream () <<
       "Creating a newborn clone of a score" <<
       endl;
   }
@@ -135,7 +135,7 @@ void msrScore::addPartGroupToScore (S_msrPartGroup partGroup)
       "' already exists in this score";
 
     msrInternalError (
-      gXml2lyOptions->fInputSourceName,
+      gXml2lyOptions ()->fInputSourceName,
       partGroup->getInputLineNumber (),
       __FILE__, __LINE__,
       s.str ());
@@ -149,8 +149,8 @@ void msrScore::addPartGroupToScore (S_msrPartGroup partGroup)
 void msrScore::appendCreditToScore (S_msrCredit credit)
 {
 #ifdef TRACE_OPTIONS
-  if (gTraceOptions->fTraceCredits) {
-    gLogIOstream <<
+  if (gTraceOptions ()->fTraceCredits) {
+    gLogIOstream () <<
       "Appending credit '" <<
       credit->asString () <<
       "' to score" <<
@@ -168,27 +168,27 @@ S_msrPart msrScore::fetchPartFromScoreByItsPartID (
   S_msrPart result;
   
 #ifdef TRACE_OPTIONS
-  if (gTraceOptions->fTracePartGroupsDetails) {
-    gLogIOstream <<
+  if (gTraceOptions ()->fTracePartGroupsDetails) {
+    gLogIOstream () <<
       "fetchPartFromScoreByItsPartID(" << partID << "), fPartGroupsList contains:" <<
       endl;
       
-    gIndenter++;
+    gIndenter ()++;
 
     for (
       list<S_msrPartGroup>::const_iterator i = fPartGroupsList.begin ();
         i != fPartGroupsList.end ();
         i++) {
-      gLogIOstream <<
+      gLogIOstream () <<
         (*i)->getPartGroupCombinedName () <<
         ", " <<
         (*i)->getPartGroupName () <<
         endl;
     } // for
   
-    gIndenter--;
+    gIndenter ()--;
 
-    gLogIOstream <<
+    gLogIOstream () <<
       "<=- fetchPartFromScoreByItsPartID(" << partID << ")" <<
       endl <<
       endl;
@@ -250,8 +250,8 @@ S_msrPartGroup msrScore::fetchScorePartGroup (
 
 void msrScore::acceptIn (basevisitor* v)
 {
-  if (gMsrOptions->fTraceMsrVisitors) {
-    gLogIOstream <<
+  if (gMsrOptions ()->fTraceMsrVisitors) {
+    gLogIOstream () <<
       "% ==> msrScore::acceptIn ()" <<
       endl;
   }
@@ -261,8 +261,8 @@ void msrScore::acceptIn (basevisitor* v)
       dynamic_cast<visitor<S_msrScore>*> (v)) {
         S_msrScore elem = this;
         
-        if (gMsrOptions->fTraceMsrVisitors) {
-          gLogIOstream <<
+        if (gMsrOptions ()->fTraceMsrVisitors) {
+          gLogIOstream () <<
             "% ==> Launching msrScore::visitStart ()" <<
             endl;
         }
@@ -272,8 +272,8 @@ void msrScore::acceptIn (basevisitor* v)
 
 void msrScore::acceptOut (basevisitor* v)
 {
-  if (gMsrOptions->fTraceMsrVisitors) {
-    gLogIOstream <<
+  if (gMsrOptions ()->fTraceMsrVisitors) {
+    gLogIOstream () <<
       "% ==> msrScore::acceptOut ()" <<
       endl;
   }
@@ -283,8 +283,8 @@ void msrScore::acceptOut (basevisitor* v)
       dynamic_cast<visitor<S_msrScore>*> (v)) {
         S_msrScore elem = this;
       
-        if (gMsrOptions->fTraceMsrVisitors) {
-          gLogIOstream <<
+        if (gMsrOptions ()->fTraceMsrVisitors) {
+          gLogIOstream () <<
             "% ==> Launching msrScore::visitEnd ()" <<
             endl;
         }
@@ -294,8 +294,8 @@ void msrScore::acceptOut (basevisitor* v)
 
 void msrScore::browseData (basevisitor* v)
 {
-  if (gMsrOptions->fTraceMsrVisitors) {
-    gLogIOstream <<
+  if (gMsrOptions ()->fTraceMsrVisitors) {
+    gLogIOstream () <<
       "% ==> msrScore::browseData ()" <<
       endl;
   }
@@ -330,8 +330,8 @@ void msrScore::browseData (basevisitor* v)
     browser.browse (*(*i));
   } // for
 
-  if (gMsrOptions->fTraceMsrVisitors) {
-    gLogIOstream <<
+  if (gMsrOptions ()->fTraceMsrVisitors) {
+    gLogIOstream () <<
       "% <== msrScore::browseData ()" <<
       endl;
   }
@@ -343,7 +343,7 @@ void msrScore::print (ostream& os)
     "MSR Score" <<
     endl;
 
-  gIndenter++;
+  gIndenter ()++;
 
   const int fieldWidth = 38;
 
@@ -415,7 +415,7 @@ void msrScore::print (ostream& os)
   if (creditsListSize) {
     os <<
       endl;
-    gIndenter++;
+    gIndenter ()++;
 
     list<S_msrCredit>::const_iterator
       iBegin = fCreditsList.begin (),
@@ -427,7 +427,7 @@ void msrScore::print (ostream& os)
       os << endl;
     } // for
 
-    gIndenter--;
+    gIndenter ()--;
   }
   else {
     os <<
@@ -455,7 +455,7 @@ void msrScore::print (ostream& os)
       endl;
   }
   
-  gIndenter--;
+  gIndenter ()--;
 }
 
 void msrScore::printSummary (ostream& os)
@@ -464,7 +464,7 @@ void msrScore::printSummary (ostream& os)
     "MSR component" <<
     endl;
 
-  gIndenter++;
+  gIndenter ()++;
 
   const int fieldWidth = 38;
 
@@ -513,14 +513,14 @@ void msrScore::printSummary (ostream& os)
       "Parts and part groups structure:" <<
       endl;
   
-    gIndenter++;
+    gIndenter ()++;
     
     fPartGroupsList.front () ->
       printPartGroupParts (
         fInputLineNumber,
         os);
   
-    gIndenter--;
+    gIndenter ()--;
 
     os <<
       endl;
@@ -566,7 +566,7 @@ void msrScore::printSummary (ostream& os)
     } // for
   }
   
-  gIndenter--;
+  gIndenter ()--;
 }
 
 ostream& operator<< (ostream& os, const S_msrScore& elt)
@@ -61,8 +61,8 @@ msrSlash::~msrSlash ()
 
 void msrSlash::acceptIn (basevisitor* v)
 {
-  if (gMsrOptions->fTraceMsrVisitors) {
-    gLogIOstream <<
+  if (gMsrOptions ()->fTraceMsrVisitors) {
+    gLogIOstream () <<
       "% ==> msrSlash::acceptIn ()" <<
       endl;
   }
@@ -72,8 +72,8 @@ void msrSlash::acceptIn (basevisitor* v)
       dynamic_cast<visitor<S_msrSlash>*> (v)) {
         S_msrSlash elem = this;
         
-        if (gMsrOptions->fTraceMsrVisitors) {
-          gLogIOstream <<
+        if (gMsrOptions ()->fTraceMsrVisitors) {
+          gLogIOstream () <<
             "% ==> Launching msrSlash::visitStart ()" <<
             endl;
         }
@@ -83,8 +83,8 @@ void msrSlash::acceptIn (basevisitor* v)
 
 void msrSlash::acceptOut (basevisitor* v)
 {
-  if (gMsrOptions->fTraceMsrVisitors) {
-    gLogIOstream <<
+  if (gMsrOptions ()->fTraceMsrVisitors) {
+    gLogIOstream () <<
       "% ==> msrSlash::acceptOut ()" <<
       endl;
   }
@@ -94,8 +94,8 @@ void msrSlash::acceptOut (basevisitor* v)
       dynamic_cast<visitor<S_msrSlash>*> (v)) {
         S_msrSlash elem = this;
       
-        if (gMsrOptions->fTraceMsrVisitors) {
-          gLogIOstream <<
+        if (gMsrOptions ()->fTraceMsrVisitors) {
+          gLogIOstream () <<
             "% ==> Launching msrSlash::visitEnd ()" <<
             endl;
         }
@@ -139,7 +139,7 @@ void msrSlash::print (ostream& os)
     ", line " << fInputLineNumber <<
     endl;
   
-  gIndenter++;
+  gIndenter ()++;
 
   const int fieldWidth = 18;
 
@@ -161,7 +161,7 @@ void msrSlash::print (ostream& os)
       fSlashUseStemsKind) <<
     endl;
       
-  gIndenter--;
+  gIndenter ()--;
 }
 
 
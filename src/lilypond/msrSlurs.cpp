@@ -57,8 +57,8 @@ msrSlur::~msrSlur ()
 
 void msrSlur::acceptIn (basevisitor* v)
 {
-  if (gMsrOptions->fTraceMsrVisitors) {
-    gLogIOstream <<
+  if (gMsrOptions ()->fTraceMsrVisitors) {
+    gLogIOstream () <<
       "% ==> msrSlur::acceptIn ()" <<
       endl;
   }
@@ -68,8 +68,8 @@ void msrSlur::acceptIn (basevisitor* v)
       dynamic_cast<visitor<S_msrSlur>*> (v)) {
         S_msrSlur elem = this;
         
-        if (gMsrOptions->fTraceMsrVisitors) {
-          gLogIOstream <<
+        if (gMsrOptions ()->fTraceMsrVisitors) {
+          gLogIOstream () <<
             "% ==> Launching msrSlur::visitStart ()" <<
             endl;
         }
@@ -79,8 +79,8 @@ void msrSlur::acceptIn (basevisitor* v)
 
 void msrSlur::acceptOut (basevisitor* v)
 {
-  if (gMsrOptions->fTraceMsrVisitors) {
-    gLogIOstream <<
+  if (gMsrOptions ()->fTraceMsrVisitors) {
+    gLogIOstream () <<
       "% ==> msrSlur::acceptOut ()" <<
       endl;
   }
@@ -90,8 +90,8 @@ void msrSlur::acceptOut (basevisitor* v)
       dynamic_cast<visitor<S_msrSlur>*> (v)) {
         S_msrSlur elem = this;
       
-        if (gMsrOptions->fTraceMsrVisitors) {
-          gLogIOstream <<
+        if (gMsrOptions ()->fTraceMsrVisitors) {
+          gLogIOstream () <<
             "% ==> Launching msrSlur::visitEnd ()" <<
             endl;
         }
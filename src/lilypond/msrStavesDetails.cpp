@@ -67,8 +67,8 @@ msrStaffTuning::~ msrStaffTuning ()
 S_msrStaffTuning msrStaffTuning::createStaffTuningNewbornClone ()
 {
 #ifdef TRACE_OPTIONS
-  if (gTraceOptions->fTraceStaffTuning) {
-    gLogIOstream <<
+  if (gTraceOptions ()->fTraceStaffTuning) {
+    gLogIOstream () <<
       "Creating a newborn clone of staff tuning '" <<
       asString () <<
       "'" <<
@@ -89,8 +89,8 @@ S_msrStaffTuning msrStaffTuning::createStaffTuningNewbornClone ()
 
 void msrStaffTuning::acceptIn (basevisitor* v)
 {
-  if (gMsrOptions->fTraceMsrVisitors) {
-    gLogIOstream <<
+  if (gMsrOptions ()->fTraceMsrVisitors) {
+    gLogIOstream () <<
       "% ==> msrStaffTuning::acceptIn ()" <<
       endl;
   }
@@ -100,8 +100,8 @@ void msrStaffTuning::acceptIn (basevisitor* v)
       dynamic_cast<visitor<S_msrStaffTuning>*> (v)) {
         S_msrStaffTuning elem = this;
         
-        if (gMsrOptions->fTraceMsrVisitors) {
-          gLogIOstream <<
+        if (gMsrOptions ()->fTraceMsrVisitors) {
+          gLogIOstream () <<
             "% ==> Launching msrStaffTuning::visitStart ()" <<
             endl;
         }
@@ -111,8 +111,8 @@ void msrStaffTuning::acceptIn (basevisitor* v)
 
 void msrStaffTuning::acceptOut (basevisitor* v)
 {
-  if (gMsrOptions->fTraceMsrVisitors) {
-    gLogIOstream <<
+  if (gMsrOptions ()->fTraceMsrVisitors) {
+    gLogIOstream () <<
       "% ==> msrStaffTuning::acceptOut ()" <<
       endl;
   }
@@ -122,8 +122,8 @@ void msrStaffTuning::acceptOut (basevisitor* v)
       dynamic_cast<visitor<S_msrStaffTuning>*> (v)) {
         S_msrStaffTuning elem = this;
       
-        if (gMsrOptions->fTraceMsrVisitors) {
-          gLogIOstream <<
+        if (gMsrOptions ()->fTraceMsrVisitors) {
+          gLogIOstream () <<
             "% ==> Launching msrStaffTuning::visitEnd ()" <<
             endl;
         }
@@ -149,7 +149,7 @@ string msrStaffTuning::asString () const
     ", line " << fStaffTuningLineNumber <<
     ", " <<
     msrQuarterTonesPitchKindAsString (
-      gMsrOptions->fMsrQuarterTonesPitchesLanguageKind,
+      gMsrOptions ()->fMsrQuarterTonesPitchesLanguageKind,
       fStaffTuningQuarterTonesPitchKind) <<
     ", octave " << fStaffTuningOctave;
     
@@ -163,7 +163,7 @@ void msrStaffTuning::print (ostream& os)
     ", line " << fInputLineNumber <<
     endl;
 
-  gIndenter++;
+  gIndenter ()++;
 
   const int fieldWidth = 29;
 
@@ -175,7 +175,7 @@ void msrStaffTuning::print (ostream& os)
     setw (fieldWidth) <<
     "staffTuningQuarterTonesPitch" << " : " <<
     msrQuarterTonesPitchKindAsString (
-      gMsrOptions->fMsrQuarterTonesPitchesLanguageKind,
+      gMsrOptions ()->fMsrQuarterTonesPitchesLanguageKind,
       fStaffTuningQuarterTonesPitchKind) <<
     endl <<
     setw (fieldWidth) <<
@@ -183,7 +183,7 @@ void msrStaffTuning::print (ostream& os)
     fStaffTuningOctave <<
     endl;
 
-  gIndenter--;
+  gIndenter ()--;
 }
 
 //______________________________________________________________________________
@@ -228,8 +228,8 @@ msrStaffDetails::~msrStaffDetails ()
 
 void msrStaffDetails::acceptIn (basevisitor* v)
 {
-  if (gMsrOptions->fTraceMsrVisitors) {
-    gLogIOstream <<
+  if (gMsrOptions ()->fTraceMsrVisitors) {
+    gLogIOstream () <<
       "% ==> msrStaffDetails::acceptIn ()" <<
       endl;
   }
@@ -239,8 +239,8 @@ void msrStaffDetails::acceptIn (basevisitor* v)
       dynamic_cast<visitor<S_msrStaffDetails>*> (v)) {
         S_msrStaffDetails elem = this;
         
-        if (gMsrOptions->fTraceMsrVisitors) {
-          gLogIOstream <<
+        if (gMsrOptions ()->fTraceMsrVisitors) {
+          gLogIOstream () <<
             "% ==> Launching msrStaffDetails::visitStart ()" <<
             endl;
         }
@@ -250,8 +250,8 @@ void msrStaffDetails::acceptIn (basevisitor* v)
 
 void msrStaffDetails::acceptOut (basevisitor* v)
 {
-  if (gMsrOptions->fTraceMsrVisitors) {
-    gLogIOstream <<
+  if (gMsrOptions ()->fTraceMsrVisitors) {
+    gLogIOstream () <<
       "% ==> msrStaffDetails::acceptOut ()" <<
       endl;
   }
@@ -261,8 +261,8 @@ void msrStaffDetails::acceptOut (basevisitor* v)
       dynamic_cast<visitor<S_msrStaffDetails>*> (v)) {
         S_msrStaffDetails elem = this;
       
-        if (gMsrOptions->fTraceMsrVisitors) {
-          gLogIOstream <<
+        if (gMsrOptions ()->fTraceMsrVisitors) {
+          gLogIOstream () <<
             "% ==> Launching msrStaffDetails::visitEnd ()" <<
             endl;
         }
@@ -403,7 +403,7 @@ void msrStaffDetails::print (ostream& os)
     ", line " << fInputLineNumber <<
     endl;
 
-  gIndenter++;
+  gIndenter ()++;
 
   const int fieldWidth = 17;
   
@@ -426,7 +426,7 @@ void msrStaffDetails::print (ostream& os)
       iEnd   = fStaffTuningsList.end (),
       i      = iBegin;
       
-    gIndenter++;
+    gIndenter ()++;
     
     for ( ; ; ) {
       os << (*i);
@@ -436,7 +436,7 @@ void msrStaffDetails::print (ostream& os)
     os <<
       endl;
     
-    gIndenter--;
+    gIndenter ()--;
   }
   else {
     os << left <<
@@ -459,7 +459,7 @@ void msrStaffDetails::print (ostream& os)
     printSpacingKindAsString (fPrintSpacingKind) <<
     endl;
 
-  gIndenter--;
+  gIndenter ()--;
 }
 
 
@@ -51,8 +51,8 @@ msrStem::~msrStem ()
 
 void msrStem::acceptIn (basevisitor* v)
 {
-  if (gMsrOptions->fTraceMsrVisitors) {
-    gLogIOstream <<
+  if (gMsrOptions ()->fTraceMsrVisitors) {
+    gLogIOstream () <<
       "% ==> msrStem::acceptIn ()" <<
       endl;
   }
@@ -62,8 +62,8 @@ void msrStem::acceptIn (basevisitor* v)
       dynamic_cast<visitor<S_msrStem>*> (v)) {
         S_msrStem elem = this;
         
-        if (gMsrOptions->fTraceMsrVisitors) {
-          gLogIOstream <<
+        if (gMsrOptions ()->fTraceMsrVisitors) {
+          gLogIOstream () <<
             "% ==> Launching msrStem::visitStart ()" <<
             endl;
         }
@@ -73,8 +73,8 @@ void msrStem::acceptIn (basevisitor* v)
 
 void msrStem::acceptOut (basevisitor* v)
 {
-  if (gMsrOptions->fTraceMsrVisitors) {
-    gLogIOstream <<
+  if (gMsrOptions ()->fTraceMsrVisitors) {
+    gLogIOstream () <<
       "% ==> msrStem::acceptOut ()" <<
       endl;
   }
@@ -84,8 +84,8 @@ void msrStem::acceptOut (basevisitor* v)
       dynamic_cast<visitor<S_msrStem>*> (v)) {
         S_msrStem elem = this;
       
-        if (gMsrOptions->fTraceMsrVisitors) {
-          gLogIOstream <<
+        if (gMsrOptions ()->fTraceMsrVisitors) {
+          gLogIOstream () <<
             "% ==> Launching msrStem::visitEnd ()" <<
             endl;
         }
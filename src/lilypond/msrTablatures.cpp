@@ -71,8 +71,8 @@ msrFrameNote::msrFrameNote (
   fFrameNoteBarreTypeKind = frameNoteBarreTypeKind;
 
 #ifdef TRACE_OPTIONS
-  if (gTraceOptions->fTraceHarmonies) {
-    gLogIOstream <<
+  if (gTraceOptions ()->fTraceHarmonies) {
+    gLogIOstream () <<
       "Creating frame note '" <<
       asString () <<
       "'" <<
@@ -123,8 +123,8 @@ string msrFrameNote::asString () const
 
 void msrFrameNote::acceptIn (basevisitor* v)
 {
-  if (gMsrOptions->fTraceMsrVisitors) {
-    gLogIOstream <<
+  if (gMsrOptions ()->fTraceMsrVisitors) {
+    gLogIOstream () <<
       "% ==> msrFrameNote::acceptIn ()" <<
       endl;
   }
@@ -134,8 +134,8 @@ void msrFrameNote::acceptIn (basevisitor* v)
       dynamic_cast<visitor<S_msrFrameNote>*> (v)) {
         S_msrFrameNote elem = this;
         
-        if (gMsrOptions->fTraceMsrVisitors) {
-          gLogIOstream <<
+        if (gMsrOptions ()->fTraceMsrVisitors) {
+          gLogIOstream () <<
             "% ==> Launching msrFrameNote::visitStart ()" <<
             endl;
         }
@@ -145,8 +145,8 @@ void msrFrameNote::acceptIn (basevisitor* v)
 
 void msrFrameNote::acceptOut (basevisitor* v)
 {
-  if (gMsrOptions->fTraceMsrVisitors) {
-    gLogIOstream <<
+  if (gMsrOptions ()->fTraceMsrVisitors) {
+    gLogIOstream () <<
       "% ==> msrFrameNote::acceptOut ()" <<
       endl;
   }
@@ -156,8 +156,8 @@ void msrFrameNote::acceptOut (basevisitor* v)
       dynamic_cast<visitor<S_msrFrameNote>*> (v)) {
         S_msrFrameNote elem = this;
       
-        if (gMsrOptions->fTraceMsrVisitors) {
-          gLogIOstream <<
+        if (gMsrOptions ()->fTraceMsrVisitors) {
+          gLogIOstream () <<
             "% ==> Launching msrFrameNote::visitEnd ()" <<
             endl;
         }
@@ -181,7 +181,7 @@ void msrFrameNote::print (ostream& os)
     ", line: " << fInputLineNumber <<
     endl;
 
-  gIndenter++;
+  gIndenter ()++;
 
   const int fieldWidth = 23;
   
@@ -201,7 +201,7 @@ void msrFrameNote::print (ostream& os)
       fFrameNoteBarreTypeKind) <<
     endl;
 
-  gIndenter--;
+  gIndenter ()--;
 }
 
 //______________________________________________________________________________
@@ -236,8 +236,8 @@ msrFrame::msrFrame (
   fFrameContainsFingerings = false;
   
 #ifdef TRACE_OPTIONS
-  if (gTraceOptions->fTraceHarmonies) {
-    gLogIOstream <<
+  if (gTraceOptions ()->fTraceHarmonies) {
+    gLogIOstream () <<
       "Creating frame '" <<
       asString () <<
       "'" <<
@@ -278,7 +278,7 @@ void msrFrame::appendFrameNoteToFrame (
             frameNote;
             
           msrMusicXMLError (
-            gXml2lyOptions->fInputSourceName,
+            gXml2lyOptions ()->fInputSourceName,
             inputLineNumber,
             __FILE__, __LINE__,
             s.str ());
@@ -307,7 +307,7 @@ void msrFrame::appendFrameNoteToFrame (
               barreStartFretNumber;
               
             msrMusicXMLError (
-              gXml2lyOptions->fInputSourceName,
+              gXml2lyOptions ()->fInputSourceName,
               inputLineNumber,
               __FILE__, __LINE__,
               s.str ());
@@ -355,8 +355,8 @@ string msrFrame::asString () const
 
 void msrFrame::acceptIn (basevisitor* v)
 {
-  if (gMsrOptions->fTraceMsrVisitors) {
-    gLogIOstream <<
+  if (gMsrOptions ()->fTraceMsrVisitors) {
+    gLogIOstream () <<
       "% ==> msrFrame::acceptIn ()" <<
       endl;
   }
@@ -366,8 +366,8 @@ void msrFrame::acceptIn (basevisitor* v)
       dynamic_cast<visitor<S_msrFrame>*> (v)) {
         S_msrFrame elem = this;
         
-        if (gMsrOptions->fTraceMsrVisitors) {
-          gLogIOstream <<
+        if (gMsrOptions ()->fTraceMsrVisitors) {
+          gLogIOstream () <<
             "% ==> Launching msrFrame::visitStart ()" <<
             endl;
         }
@@ -377,8 +377,8 @@ void msrFrame::acceptIn (basevisitor* v)
 
 void msrFrame::acceptOut (basevisitor* v)
 {
-  if (gMsrOptions->fTraceMsrVisitors) {
-    gLogIOstream <<
+  if (gMsrOptions ()->fTraceMsrVisitors) {
+    gLogIOstream () <<
       "% ==> msrFrame::acceptOut ()" <<
       endl;
   }
@@ -388,8 +388,8 @@ void msrFrame::acceptOut (basevisitor* v)
       dynamic_cast<visitor<S_msrFrame>*> (v)) {
         S_msrFrame elem = this;
       
-        if (gMsrOptions->fTraceMsrVisitors) {
-          gLogIOstream <<
+        if (gMsrOptions ()->fTraceMsrVisitors) {
+          gLogIOstream () <<
             "% ==> Launching msrFrame::visitEnd ()" <<
             endl;
         }
@@ -425,7 +425,7 @@ void msrFrame::print (ostream& os)
      ", line " << fInputLineNumber <<
     endl;
     
-  gIndenter++;
+  gIndenter ()++;
 
   const int fieldWidth = 15;
 
@@ -450,7 +450,7 @@ void msrFrame::print (ostream& os)
     os <<
       endl;
 
-    gIndenter++;
+    gIndenter ()++;
     
     list<S_msrFrameNote>::const_iterator
       iBegin = fFrameFrameNotesList.begin (),
@@ -463,7 +463,7 @@ void msrFrame::print (ostream& os)
       // no endl here;
     } // for
     
-    gIndenter--;
+    gIndenter ()--;
   }
   else {
     os <<
@@ -478,7 +478,7 @@ void msrFrame::print (ostream& os)
     os <<
       endl;
 
-    gIndenter++;
+    gIndenter ()++;
     
     list<msrBarre>::const_iterator
       iBegin = fFrameBarresList.begin (),
@@ -492,7 +492,7 @@ void msrFrame::print (ostream& os)
         "Barre" <<
         endl;
 
-      gIndenter++;
+      gIndenter ()++;
 
       const int fieldWidth = 21;
       
@@ -507,13 +507,13 @@ void msrFrame::print (ostream& os)
         "barreFretNumber" << " : " << barre.fBarreFretNumber <<
         endl;
 
-      gIndenter--;
+      gIndenter ()--;
       
       if (++i == iEnd) break;
       // no endl here;
     } // for
     
-    gIndenter--;
+    gIndenter ()--;
   }
   else {
     os <<
@@ -521,7 +521,7 @@ void msrFrame::print (ostream& os)
       endl;
   }
 
-  gIndenter--;
+  gIndenter ()--;
 }
 
 
@@ -141,8 +141,8 @@ string msrTechnical::technicalAccidentalMarkKindAsString () const
 
 void msrTechnical::acceptIn (basevisitor* v)
 {
-  if (gMsrOptions->fTraceMsrVisitors) {
-    gLogIOstream <<
+  if (gMsrOptions ()->fTraceMsrVisitors) {
+    gLogIOstream () <<
       "% ==> msrTechnical::acceptIn ()" <<
       endl;
   }
@@ -152,8 +152,8 @@ void msrTechnical::acceptIn (basevisitor* v)
       dynamic_cast<visitor<S_msrTechnical>*> (v)) {
         S_msrTechnical elem = this;
         
-        if (gMsrOptions->fTraceMsrVisitors) {
-          gLogIOstream <<
+        if (gMsrOptions ()->fTraceMsrVisitors) {
+          gLogIOstream () <<
             "% ==> Launching msrTechnical::visitStart ()" <<
             endl;
         }
@@ -163,8 +163,8 @@ void msrTechnical::acceptIn (basevisitor* v)
 
 void msrTechnical::acceptOut (basevisitor* v)
 {
-  if (gMsrOptions->fTraceMsrVisitors) {
-    gLogIOstream <<
+  if (gMsrOptions ()->fTraceMsrVisitors) {
+    gLogIOstream () <<
       "% ==> msrTechnical::acceptOut ()" <<
       endl;
   }
@@ -174,8 +174,8 @@ void msrTechnical::acceptOut (basevisitor* v)
       dynamic_cast<visitor<S_msrTechnical>*> (v)) {
         S_msrTechnical elem = this;
       
-        if (gMsrOptions->fTraceMsrVisitors) {
-          gLogIOstream <<
+        if (gMsrOptions ()->fTraceMsrVisitors) {
+          gLogIOstream () <<
             "% ==> Launching msrTechnical::visitEnd ()" <<
             endl;
         }
@@ -271,8 +271,8 @@ string msrTechnicalWithInteger::technicalWithIntegerPlacementKindAsString () con
 
 void msrTechnicalWithInteger::acceptIn (basevisitor* v)
 {
-  if (gMsrOptions->fTraceMsrVisitors) {
-    gLogIOstream <<
+  if (gMsrOptions ()->fTraceMsrVisitors) {
+    gLogIOstream () <<
       "% ==> msrTechnicalWithInteger::acceptIn ()" <<
       endl;
   }
@@ -282,8 +282,8 @@ void msrTechnicalWithInteger::acceptIn (basevisitor* v)
       dynamic_cast<visitor<S_msrTechnicalWithInteger>*> (v)) {
         S_msrTechnicalWithInteger elem = this;
         
-        if (gMsrOptions->fTraceMsrVisitors) {
-          gLogIOstream <<
+        if (gMsrOptions ()->fTraceMsrVisitors) {
+          gLogIOstream () <<
             "% ==> Launching msrTechnicalWithInteger::visitStart ()" <<
             endl;
         }
@@ -293,8 +293,8 @@ void msrTechnicalWithInteger::acceptIn (basevisitor* v)
 
 void msrTechnicalWithInteger::acceptOut (basevisitor* v)
 {
-  if (gMsrOptions->fTraceMsrVisitors) {
-    gLogIOstream <<
+  if (gMsrOptions ()->fTraceMsrVisitors) {
+    gLogIOstream () <<
       "% ==> msrTechnicalWithInteger::acceptOut ()" <<
       endl;
   }
@@ -304,8 +304,8 @@ void msrTechnicalWithInteger::acceptOut (basevisitor* v)
       dynamic_cast<visitor<S_msrTechnicalWithInteger>*> (v)) {
         S_msrTechnicalWithInteger elem = this;
       
-        if (gMsrOptions->fTraceMsrVisitors) {
-          gLogIOstream <<
+        if (gMsrOptions ()->fTraceMsrVisitors) {
+          gLogIOstream () <<
             "% ==> Launching msrTechnicalWithInteger::visitEnd ()" <<
             endl;
         }
@@ -344,7 +344,7 @@ void msrTechnicalWithInteger::print (ostream& os)
     ", line " << fInputLineNumber <<
     endl;
 
-  gIndenter++;
+  gIndenter ()++;
   
   const int fieldWidth = 14;
   
@@ -362,7 +362,7 @@ void msrTechnicalWithInteger::print (ostream& os)
     setw (fieldWidth) <<
     endl;
 
-  gIndenter--;
+  gIndenter ()--;
 }
 
 //______________________________________________________________________________
@@ -421,8 +421,8 @@ string msrTechnicalWithFloat::technicalWithFloatPlacementKindAsString () const
 
 void msrTechnicalWithFloat::acceptIn (basevisitor* v)
 {
-  if (gMsrOptions->fTraceMsrVisitors) {
-    gLogIOstream <<
+  if (gMsrOptions ()->fTraceMsrVisitors) {
+    gLogIOstream () <<
       "% ==> msrTechnicalWithFloat::acceptIn ()" <<
       endl;
   }
@@ -432,8 +432,8 @@ void msrTechnicalWithFloat::acceptIn (basevisitor* v)
       dynamic_cast<visitor<S_msrTechnicalWithFloat>*> (v)) {
         S_msrTechnicalWithFloat elem = this;
         
-        if (gMsrOptions->fTraceMsrVisitors) {
-          gLogIOstream <<
+        if (gMsrOptions ()->fTraceMsrVisitors) {
+          gLogIOstream () <<
             "% ==> Launching msrTechnicalWithFloat::visitStart ()" <<
             endl;
         }
@@ -443,8 +443,8 @@ void msrTechnicalWithFloat::acceptIn (basevisitor* v)
 
 void msrTechnicalWithFloat::acceptOut (basevisitor* v)
 {
-  if (gMsrOptions->fTraceMsrVisitors) {
-    gLogIOstream <<
+  if (gMsrOptions ()->fTraceMsrVisitors) {
+    gLogIOstream () <<
       "% ==> msrTechnicalWithFloat::acceptOut ()" <<
       endl;
   }
@@ -454,8 +454,8 @@ void msrTechnicalWithFloat::acceptOut (basevisitor* v)
       dynamic_cast<visitor<S_msrTechnicalWithFloat>*> (v)) {
         S_msrTechnicalWithFloat elem = this;
       
-        if (gMsrOptions->fTraceMsrVisitors) {
-          gLogIOstream <<
+        if (gMsrOptions ()->fTraceMsrVisitors) {
+          gLogIOstream () <<
             "% ==> Launching msrTechnicalWithFloat::visitEnd ()" <<
             endl;
         }
@@ -494,7 +494,7 @@ void msrTechnicalWithFloat::print (ostream& os)
     ", line " << fInputLineNumber <<
     endl;
 
-  gIndenter++;
+  gIndenter ()++;
   
   const int fieldWidth = 14;
   
@@ -512,7 +512,7 @@ void msrTechnicalWithFloat::print (ostream& os)
     setw (fieldWidth) <<
     endl;
 
-  gIndenter--;
+  gIndenter ()--;
 }
 
 //______________________________________________________________________________
@@ -598,8 +598,8 @@ string msrTechnicalWithString::technicalWithStringPlacementKindAsString () const
 
 void msrTechnicalWithString::acceptIn (basevisitor* v)
 {
-  if (gMsrOptions->fTraceMsrVisitors) {
-    gLogIOstream <<
+  if (gMsrOptions ()->fTraceMsrVisitors) {
+    gLogIOstream () <<
       "% ==> msrTechnicalWithString::acceptIn ()" <<
       endl;
   }
@@ -609,8 +609,8 @@ void msrTechnicalWithString::acceptIn (basevisitor* v)
       dynamic_cast<visitor<S_msrTechnicalWithString>*> (v)) {
         S_msrTechnicalWithString elem = this;
         
-        if (gMsrOptions->fTraceMsrVisitors) {
-          gLogIOstream <<
+        if (gMsrOptions ()->fTraceMsrVisitors) {
+          gLogIOstream () <<
             "% ==> Launching msrTechnicalWithString::visitStart ()" <<
             endl;
         }
@@ -620,8 +620,8 @@ void msrTechnicalWithString::acceptIn (basevisitor* v)
 
 void msrTechnicalWithString::acceptOut (basevisitor* v)
 {
-  if (gMsrOptions->fTraceMsrVisitors) {
-    gLogIOstream <<
+  if (gMsrOptions ()->fTraceMsrVisitors) {
+    gLogIOstream () <<
       "% ==> msrTechnicalWithString::acceptOut ()" <<
       endl;
   }
@@ -631,8 +631,8 @@ void msrTechnicalWithString::acceptOut (basevisitor* v)
       dynamic_cast<visitor<S_msrTechnicalWithString>*> (v)) {
         S_msrTechnicalWithString elem = this;
       
-        if (gMsrOptions->fTraceMsrVisitors) {
-          gLogIOstream <<
+        if (gMsrOptions ()->fTraceMsrVisitors) {
+          gLogIOstream () <<
             "% ==> Launching msrTechnicalWithString::visitEnd ()" <<
             endl;
         }
@@ -673,7 +673,7 @@ void msrTechnicalWithString::print (ostream& os)
     ", line " << fInputLineNumber <<
     endl;
 
-  gIndenter++;
+  gIndenter ()++;
   
   const int fieldWidth = 14;
   
@@ -692,7 +692,7 @@ void msrTechnicalWithString::print (ostream& os)
     setw (fieldWidth) <<
     endl;
 
-  gIndenter--;
+  gIndenter ()--;
 }
 
 
@@ -72,8 +72,8 @@ void msrTempoNote::appendBeamToTempoNote (S_msrBeam beam)
 
 void msrTempoNote::acceptIn (basevisitor* v)
 {
-  if (gMsrOptions->fTraceMsrVisitors) {
-    gLogIOstream <<
+  if (gMsrOptions ()->fTraceMsrVisitors) {
+    gLogIOstream () <<
       "% ==> msrTempoNote::acceptIn ()" <<
       endl;
   }
@@ -83,8 +83,8 @@ void msrTempoNote::acceptIn (basevisitor* v)
       dynamic_cast<visitor<S_msrTempoNote>*> (v)) {
         S_msrTempoNote elem = this;
         
-        if (gMsrOptions->fTraceMsrVisitors) {
-          gLogIOstream <<
+        if (gMsrOptions ()->fTraceMsrVisitors) {
+          gLogIOstream () <<
             "% ==> Launching msrTempoNote::visitStart ()" <<
             endl;
         }
@@ -94,8 +94,8 @@ void msrTempoNote::acceptIn (basevisitor* v)
 
 void msrTempoNote::acceptOut (basevisitor* v)
 {
-  if (gMsrOptions->fTraceMsrVisitors) {
-    gLogIOstream <<
+  if (gMsrOptions ()->fTraceMsrVisitors) {
+    gLogIOstream () <<
       "% ==> msrTempoNote::acceptOut ()" <<
       endl;
   }
@@ -105,8 +105,8 @@ void msrTempoNote::acceptOut (basevisitor* v)
       dynamic_cast<visitor<S_msrTempoNote>*> (v)) {
         S_msrTempoNote elem = this;
       
-        if (gMsrOptions->fTraceMsrVisitors) {
-          gLogIOstream <<
+        if (gMsrOptions ()->fTraceMsrVisitors) {
+          gLogIOstream () <<
             "% ==> Launching msrTempoNote::visitEnd ()" <<
             endl;
         }
@@ -146,7 +146,7 @@ void msrTempoNote::print (ostream& os)
     ", line " << fInputLineNumber <<
     endl;
 
-  gIndenter++;
+  gIndenter ()++;
 
   const int fieldWidth = 26;
   
@@ -165,7 +165,7 @@ void msrTempoNote::print (ostream& os)
       os <<
         endl;
 
-      gIndenter++;
+      gIndenter ()++;
       
       list<S_msrBeam>::const_iterator
         iBegin = fTempoNoteBeams.begin (),
@@ -177,7 +177,7 @@ void msrTempoNote::print (ostream& os)
         os << endl;
       } // for
 
-      gIndenter--;
+      gIndenter ()--;
     }
     else {
       os <<
@@ -186,7 +186,7 @@ void msrTempoNote::print (ostream& os)
         endl;
     }
 
-  gIndenter--;
+  gIndenter ()--;
 }
 
 ostream& operator<< (ostream& os, const S_msrTempoNote& elt)
@@ -241,8 +241,8 @@ msrTempoTuplet::msrTempoTuplet (
   fTempoTupletDisplayWholeNotes  = rational (0, 1);
 
 #ifdef TRACE_OPTIONS
-  if (gTraceOptions->fTraceTempos){
-    gLogIOstream <<
+  if (gTraceOptions ()->fTraceTempos){
+    gLogIOstream () <<
       "Creating tempo tuplet '" <<
       this->asString () <<
       "'" <<
@@ -314,8 +314,8 @@ string msrTempoTuplet::tempoTupletShowNumberKindAsString (
 void msrTempoTuplet::addTempoNoteToTempoTuplet (S_msrTempoNote tempoNote)
 {
 #ifdef TRACE_OPTIONS
-  if (gTraceOptions->fTraceTempos) {
-    gLogIOstream <<
+  if (gTraceOptions ()->fTraceTempos) {
+    gLogIOstream () <<
       "Adding tempoNote '" <<
       tempoNote->asShortString () <<
       // the information is missing to display it the normal way JMI ???
@@ -344,8 +344,8 @@ void msrTempoTuplet::addTempoNoteToTempoTuplet (S_msrTempoNote tempoNote)
 void msrTempoTuplet::addTempoTupletToTempoTuplet (S_msrTempoTuplet tempoTuplet)
 {
 #ifdef TRACE_OPTIONS
-  if (gTraceOptions->fTraceTempos) {
-    gLogIOstream <<
+  if (gTraceOptions ()->fTraceTempos) {
+    gLogIOstream () <<
       "Adding tempoTuplet '" <<
       tempoTuplet->asString () <<
       "' to tempoTuplet '" <<
@@ -385,8 +385,8 @@ void msrTempoTuplet::removeFirstNoteFromTempoTuplet (
   S_msrTempoNote tempoNote)
 {
 #ifdef TRACE_OPTIONS
-  if (gTraceOptions->fTraceTempos) {
-    gLogIOstream <<
+  if (gTraceOptions ()->fTraceTempos) {
+    gLogIOstream () <<
       "Removing first tempoNote '" <<
       tempoNote->asShortString () <<
       "' from tempoTuplet '" <<
@@ -431,7 +431,7 @@ void msrTempoTuplet::removeFirstNoteFromTempoTuplet (
       " since it has not been found";
 
     msrInternalError (
-      gXml2lyOptions->fInputSourceName,
+      gXml2lyOptions ()->fInputSourceName,
       inputLineNumber,
       __FILE__, __LINE__,
       s.str ());
@@ -447,7 +447,7 @@ void msrTempoTuplet::removeFirstNoteFromTempoTuplet (
       " since it has not been found";
 
     msrInternalError (
-      gXml2lyOptions->fInputSourceName,
+      gXml2lyOptions ()->fInputSourceName,
       inputLineNumber,
       __FILE__, __LINE__,
       s.str ());
@@ -459,14 +459,14 @@ void msrTempoTuplet::removeFirstNoteFromTempoTuplet (
 void msrTempoTuplet::applyDisplayFactorToTempoTupletMembers ()
 {
 #ifdef TRACE_OPTIONS
-  if (gTraceOptions->fTraceTempos) {
-    gLogIOstream <<
+  if (gTraceOptions ()->fTraceTempos) {
+    gLogIOstream () <<
       "% ==> applyDisplayFactorToTempoTupletMembers ()" <<
       endl;
 
-    gIndenter++;
+    gIndenter ()++;
     
-    gLogIOstream <<
+    gLogIOstream () <<
       "% fTempoTupletActualNotes = " <<
       fTempoTupletActualNotes <<
       ", fTempoTupletNormalNotes = " <<
@@ -474,7 +474,7 @@ void msrTempoTuplet::applyDisplayFactorToTempoTupletMembers ()
       endl <<
       endl;
 
-    gIndenter--;
+    gIndenter ()--;
   }
 #endif
 }
@@ -484,14 +484,14 @@ void msrTempoTuplet::unapplySoundingFactorToTempoTupletMembers (
   int containingTempoTupletNormalNotes)
 {
 #ifdef TRACE_OPTIONS
-  if (gTraceOptions->fTraceTempos) {
-    gLogIOstream <<
+  if (gTraceOptions ()->fTraceTempos) {
+    gLogIOstream () <<
       "unapplySoundingFactorToTempoTupletMembers ()" <<
       endl;
 
-    gIndenter++;
+    gIndenter ()++;
     
-    gLogIOstream <<
+    gLogIOstream () <<
       "% fTempoTupletActualNotes = " <<
       fTempoTupletActualNotes <<
       ", fTempoTupletNormalNotes = " <<
@@ -504,7 +504,7 @@ void msrTempoTuplet::unapplySoundingFactorToTempoTupletMembers (
       endl <<
       endl;
 
-    gIndenter--;
+    gIndenter ()--;
   }
 #endif
 
@@ -517,8 +517,8 @@ void msrTempoTuplet::unapplySoundingFactorToTempoTupletMembers (
 
 void msrTempoTuplet::acceptIn (basevisitor* v)
 {
-  if (gMsrOptions->fTraceMsrVisitors) {
-    gLogIOstream <<
+  if (gMsrOptions ()->fTraceMsrVisitors) {
+    gLogIOstream () <<
       "% ==> msrTempoTuplet::acceptIn ()" <<
       endl;
   }
@@ -528,8 +528,8 @@ void msrTempoTuplet::acceptIn (basevisitor* v)
       dynamic_cast<visitor<S_msrTempoTuplet>*> (v)) {
         S_msrTempoTuplet elem = this;
         
-        if (gMsrOptions->fTraceMsrVisitors) {
-          gLogIOstream <<
+        if (gMsrOptions ()->fTraceMsrVisitors) {
+          gLogIOstream () <<
             "% ==> Launching msrTempoTuplet::visitStart ()" <<
             endl;
         }
@@ -539,8 +539,8 @@ void msrTempoTuplet::acceptIn (basevisitor* v)
 
 void msrTempoTuplet::acceptOut (basevisitor* v)
 {
-  if (gMsrOptions->fTraceMsrVisitors) {
-    gLogIOstream <<
+  if (gMsrOptions ()->fTraceMsrVisitors) {
+    gLogIOstream () <<
       "% ==> msrTempoTuplet::acceptOut ()" <<
       endl;
   }
@@ -550,8 +550,8 @@ void msrTempoTuplet::acceptOut (basevisitor* v)
       dynamic_cast<visitor<S_msrTempoTuplet>*> (v)) {
         S_msrTempoTuplet elem = this;
       
-        if (gMsrOptions->fTraceMsrVisitors) {
-          gLogIOstream <<
+        if (gMsrOptions ()->fTraceMsrVisitors) {
+          gLogIOstream () <<
             "% ==> Launching msrTempoTuplet::visitEnd ()" <<
             endl;
         }
@@ -606,7 +606,7 @@ string msrTempoTuplet::asString () const
       
       else {
         msrInternalError (
-          gXml2lyOptions->fInputSourceName,
+          gXml2lyOptions ()->fInputSourceName,
           fInputLineNumber,
           __FILE__, __LINE__,
           "tempoTuplet member should be a note, a chord or another tempoTuplet");
@@ -675,7 +675,7 @@ string msrTempoTuplet::asString () const
       
       else {
         msrInternalError (
-          gXml2lyOptions->fInputSourceName,
+          gXml2lyOptions ()->fInputSourceName,
           fInputLineNumber,
           __FILE__, __LINE__,
           "tempoTuplet member should be a note, a chord or another tempoTuplet");
@@ -705,7 +705,7 @@ void msrTempoTuplet::print (ostream& os)
     ", line " << fInputLineNumber <<
     endl;
 
-  gIndenter++;
+  gIndenter ()++;
   
   const int fieldWidth = 30;
 
@@ -744,7 +744,7 @@ void msrTempoTuplet::print (ostream& os)
     "TempoTupletsElements";
     
   if (fTempoTupletElements.size ()) {
-    gIndenter++;
+    gIndenter ()++;
 
     list<S_msrElement>::const_iterator
       iBegin = fTempoTupletElements.begin (),
@@ -756,7 +756,7 @@ void msrTempoTuplet::print (ostream& os)
       // no endl here
     } // for
     
-    gIndenter--;
+    gIndenter ()--;
     }
   else {
     os << left <<
@@ -764,7 +764,7 @@ void msrTempoTuplet::print (ostream& os)
       endl;
   }
 
-  gIndenter--;
+  gIndenter ()--;
 }
 
 ostream& operator<< (ostream& os, const S_msrTempoTuplet& elt)
@@ -804,8 +804,8 @@ void msrTempoRelationshipElements::addElementToTempoRelationshipElements (
   S_msrElement element)
 {
 #ifdef TRACE_OPTIONS
-  if (gTraceOptions->fTraceTempos){
-    gLogIOstream <<
+  if (gTraceOptions ()->fTraceTempos){
+    gLogIOstream () <<
       "Adding element '" <<
       element->asString () <<
       "' to tempo relationship" <<
@@ -818,8 +818,8 @@ void msrTempoRelationshipElements::addElementToTempoRelationshipElements (
 
 void msrTempoRelationshipElements::acceptIn (basevisitor* v)
 {
-  if (gMsrOptions->fTraceMsrVisitors) {
-    gLogIOstream <<
+  if (gMsrOptions ()->fTraceMsrVisitors) {
+    gLogIOstream () <<
       "% ==> msrTempoRelationshipElements::acceptIn ()" <<
       endl;
   }
@@ -829,8 +829,8 @@ void msrTempoRelationshipElements::acceptIn (basevisitor* v)
       dynamic_cast<visitor<S_msrTempoRelationshipElements>*> (v)) {
         S_msrTempoRelationshipElements elem = this;
         
-        if (gMsrOptions->fTraceMsrVisitors) {
-          gLogIOstream <<
+        if (gMsrOptions ()->fTraceMsrVisitors) {
+          gLogIOstream () <<
             "% ==> Launching msrTempoRelationshipElements::visitStart ()" <<
             endl;
         }
@@ -840,8 +840,8 @@ void msrTempoRelationshipElements::acceptIn (basevisitor* v)
 
 void msrTempoRelationshipElements::acceptOut (basevisitor* v)
 {
-  if (gMsrOptions->fTraceMsrVisitors) {
-    gLogIOstream <<
+  if (gMsrOptions ()->fTraceMsrVisitors) {
+    gLogIOstream () <<
       "% ==> msrTempoRelationshipElements::acceptOut ()" <<
       endl;
   }
@@ -851,8 +851,8 @@ void msrTempoRelationshipElements::acceptOut (basevisitor* v)
       dynamic_cast<visitor<S_msrTempoRelationshipElements>*> (v)) {
         S_msrTempoRelationshipElements elem = this;
       
-        if (gMsrOptions->fTraceMsrVisitors) {
-          gLogIOstream <<
+        if (gMsrOptions ()->fTraceMsrVisitors) {
+          gLogIOstream () <<
             "% ==> Launching msrTempoRelationshipElements::visitEnd ()" <<
             endl;
         }
@@ -911,7 +911,7 @@ void msrTempoRelationshipElements::print (ostream& os)
     ", line " << fInputLineNumber <<
     endl;
     
-  gIndenter++;
+  gIndenter ()++;
 
   os <<
     "tempoRelationshipElementsKindAsString : " <<
@@ -926,7 +926,7 @@ void msrTempoRelationshipElements::print (ostream& os)
     "tempoRelationshipElementsList";
 
     if (fTempoRelationshipElementsList.size ()) {
-      gIndenter++;
+      gIndenter ()++;
 
       os <<
         endl;
@@ -942,7 +942,7 @@ void msrTempoRelationshipElements::print (ostream& os)
         // os << endl;
       } // for
   
-      gIndenter--;
+      gIndenter ()--;
   }
   else {
     os <<
@@ -950,7 +950,7 @@ void msrTempoRelationshipElements::print (ostream& os)
       endl;
   }
   
-  gIndenter--;
+  gIndenter ()--;
 }
 
 ostream& operator<< (ostream& os, const S_msrTempoRelationshipElements& elt)
@@ -1089,8 +1089,8 @@ msrTempo::~msrTempo ()
 
 void msrTempo::acceptIn (basevisitor* v)
 {
-  if (gMsrOptions->fTraceMsrVisitors) {
-    gLogIOstream <<
+  if (gMsrOptions ()->fTraceMsrVisitors) {
+    gLogIOstream () <<
       "% ==> msrTempo::acceptIn ()" <<
       endl;
   }
@@ -1100,8 +1100,8 @@ void msrTempo::acceptIn (basevisitor* v)
       dynamic_cast<visitor<S_msrTempo>*> (v)) {
         S_msrTempo elem = this;
         
-        if (gMsrOptions->fTraceMsrVisitors) {
-          gLogIOstream <<
+        if (gMsrOptions ()->fTraceMsrVisitors) {
+          gLogIOstream () <<
             "% ==> Launching msrTempo::visitStart ()" <<
             endl;
         }
@@ -1111,8 +1111,8 @@ void msrTempo::acceptIn (basevisitor* v)
 
 void msrTempo::acceptOut (basevisitor* v)
 {
-  if (gMsrOptions->fTraceMsrVisitors) {
-    gLogIOstream <<
+  if (gMsrOptions ()->fTraceMsrVisitors) {
+    gLogIOstream () <<
       "% ==> msrTempo::acceptOut ()" <<
       endl;
   }
@@ -1122,8 +1122,8 @@ void msrTempo::acceptOut (basevisitor* v)
       dynamic_cast<visitor<S_msrTempo>*> (v)) {
         S_msrTempo elem = this;
       
-        if (gMsrOptions->fTraceMsrVisitors) {
-          gLogIOstream <<
+        if (gMsrOptions ()->fTraceMsrVisitors) {
+          gLogIOstream () <<
             "% ==> Launching msrTempo::visitEnd ()" <<
             endl;
         }
@@ -1240,7 +1240,7 @@ void msrTempo::print (ostream& os)
     ", line " << fInputLineNumber <<
     endl;
 
-  gIndenter++;
+  gIndenter ()++;
 
   const int fieldWidth = 27;
 
@@ -1257,7 +1257,7 @@ void msrTempo::print (ostream& os)
     os <<
       endl;
       
-    gIndenter++;
+    gIndenter ()++;
           
     list<S_msrWords>::const_iterator
       iBegin = fPendingWordsList.begin (),
@@ -1269,7 +1269,7 @@ void msrTempo::print (ostream& os)
       os << endl;
     } // for
 
-    gIndenter--;
+    gIndenter ()--;
   }
   else {
     os <<
@@ -1282,12 +1282,12 @@ void msrTempo::print (ostream& os)
     "tempoBeatUnit:" <<
     endl;
 
-  gIndenter++;
+  gIndenter ()++;
 
   os <<
     fTempoBeatUnit;
 
-  gIndenter--;
+  gIndenter ()--;
   
   os << left <<
     setw (fieldWidth) <<
@@ -1306,12 +1306,12 @@ void msrTempo::print (ostream& os)
       " : " <<
       endl;
 
-    gIndenter++;
+    gIndenter ()++;
 
     os <<
       fTempoRelationLeftElements;
 
-    gIndenter--;
+    gIndenter ()--;
   }
   else {
     os << " : " << "none" <<
@@ -1326,19 +1326,19 @@ void msrTempo::print (ostream& os)
       ":" <<
       endl;
 
-    gIndenter++;
+    gIndenter ()++;
 
     os <<
       fTempoRelationRightElements;
 
-    gIndenter--;
+    gIndenter ()--;
   }
   else {
     os << " : " << "none" <<
     endl;
   }
 
-  gIndenter--;
+  gIndenter ()--;
 }
 
 ostream& operator<< (ostream& os, const S_msrTempo& elt)
@@ -51,8 +51,8 @@ msrTie::~msrTie ()
 
 void msrTie::acceptIn (basevisitor* v)
 {
-  if (gMsrOptions->fTraceMsrVisitors) {
-    gLogIOstream <<
+  if (gMsrOptions ()->fTraceMsrVisitors) {
+    gLogIOstream () <<
       "% ==> msrTie::acceptIn ()" <<
       endl;
   }
@@ -62,8 +62,8 @@ void msrTie::acceptIn (basevisitor* v)
       dynamic_cast<visitor<S_msrTie>*> (v)) {
         S_msrTie elem = this;
         
-        if (gMsrOptions->fTraceMsrVisitors) {
-          gLogIOstream <<
+        if (gMsrOptions ()->fTraceMsrVisitors) {
+          gLogIOstream () <<
             "% ==> Launching msrTie::visitStart ()" <<
             endl;
         }
@@ -73,8 +73,8 @@ void msrTie::acceptIn (basevisitor* v)
 
 void msrTie::acceptOut (basevisitor* v)
 {
-  if (gMsrOptions->fTraceMsrVisitors) {
-    gLogIOstream <<
+  if (gMsrOptions ()->fTraceMsrVisitors) {
+    gLogIOstream () <<
       "% ==> msrTie::acceptOut ()" <<
       endl;
   }
@@ -84,8 +84,8 @@ void msrTie::acceptOut (basevisitor* v)
       dynamic_cast<visitor<S_msrTie>*> (v)) {
         S_msrTie elem = this;
       
-        if (gMsrOptions->fTraceMsrVisitors) {
-          gLogIOstream <<
+        if (gMsrOptions ()->fTraceMsrVisitors) {
+          gLogIOstream () <<
             "% ==> Launching msrTie::visitEnd ()" <<
             endl;
         }
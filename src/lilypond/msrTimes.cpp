@@ -53,8 +53,8 @@ msrTimeItem::msrTimeItem (
   fTimeBeatValue = -1;
   
 #ifdef TRACE_OPTIONS
-  if (gTraceOptions->fTraceTimes) {
-    gLogIOstream <<
+  if (gTraceOptions ()->fTraceTimes) {
+    gLogIOstream () <<
       "Creating time item" <<
       ", line = " << inputLineNumber <<
       endl;
@@ -101,8 +101,8 @@ bool msrTimeItem::isEqualTo (S_msrTimeItem otherTimeItem) const
 void msrTimeItem::appendBeatsNumber (int beatsNumber)
 {
 #ifdef TRACE_OPTIONS
-  if (gTraceOptions->fTraceTimes) {
-    gLogIOstream <<
+  if (gTraceOptions ()->fTraceTimes) {
+    gLogIOstream () <<
       "Append beat number '" <<
       beatsNumber <<
       "' to time '" << // JMI
@@ -130,8 +130,8 @@ int msrTimeItem::getTimeBeatsNumber () const
 
 void msrTimeItem::acceptIn (basevisitor* v)
 {
-  if (gMsrOptions->fTraceMsrVisitors) {
-    gLogIOstream <<
+  if (gMsrOptions ()->fTraceMsrVisitors) {
+    gLogIOstream () <<
       "% ==> msrTimeItem::acceptIn ()" <<
       endl;
   }
@@ -141,8 +141,8 @@ void msrTimeItem::acceptIn (basevisitor* v)
       dynamic_cast<visitor<S_msrTimeItem>*> (v)) {
         S_msrTimeItem elem = this;
         
-        if (gMsrOptions->fTraceMsrVisitors) {
-          gLogIOstream <<
+        if (gMsrOptions ()->fTraceMsrVisitors) {
+          gLogIOstream () <<
             "% ==> Launching msrTimeItem::visitStart ()" <<
             endl;
         }
@@ -152,8 +152,8 @@ void msrTimeItem::acceptIn (basevisitor* v)
 
 void msrTimeItem::acceptOut (basevisitor* v)
 {
-  if (gMsrOptions->fTraceMsrVisitors) {
-    gLogIOstream <<
+  if (gMsrOptions ()->fTraceMsrVisitors) {
+    gLogIOstream () <<
       "% ==> msrTimeItem::acceptOut ()" <<
       endl;
   }
@@ -163,8 +163,8 @@ void msrTimeItem::acceptOut (basevisitor* v)
       dynamic_cast<visitor<S_msrTimeItem>*> (v)) {
         S_msrTimeItem elem = this;
       
-        if (gMsrOptions->fTraceMsrVisitors) {
-          gLogIOstream <<
+        if (gMsrOptions ()->fTraceMsrVisitors) {
+          gLogIOstream () <<
             "% ==> Launching msrTimeItem::visitEnd ()" <<
             endl;
         }
@@ -194,7 +194,7 @@ string msrTimeItem::asString () const
   switch (vectorSize) {
     case 0:
       msrInternalError (
-        gXml2lyOptions->fInputSourceName,
+        gXml2lyOptions ()->fInputSourceName,
         fInputLineNumber,
         __FILE__, __LINE__,
         "time item beats numbers vector is empty");
@@ -326,8 +326,8 @@ void msrTime::appendTimeItem (
   S_msrTimeItem timeItem)
 {
 #ifdef TRACE_OPTIONS
-  if (gTraceOptions->fTraceTimes) {
-    gLogIOstream <<
+  if (gTraceOptions ()->fTraceTimes) {
+    gLogIOstream () <<
       "Append item '" <<
       timeItem->asString () <<
       "' to time '" <<
@@ -375,7 +375,7 @@ rational msrTime::wholeNotesPerMeasure () const
 */
 
 /* JMI
-    gLogIOstream <<
+    gLogIOstream () <<
       endl <<
       endl <<
       "result1 = " <<
@@ -394,7 +394,7 @@ rational msrTime::wholeNotesPerMeasure () const
           fTimeItemsVector [i]->getTimeBeatValue ());
 
 /* JMI
-      gLogIOstream <<
+      gLogIOstream () <<
         endl <<
         endl <<
         "result2 = " <<
@@ -410,7 +410,7 @@ rational msrTime::wholeNotesPerMeasure () const
 
   else {
     msrInternalError (
-      gXml2lyOptions->fInputSourceName,
+      gXml2lyOptions ()->fInputSourceName,
       fInputLineNumber,
       __FILE__, __LINE__,
       "time items vector is empty");
@@ -425,8 +425,8 @@ rational msrTime::wholeNotesPerMeasure () const
 
 void msrTime::acceptIn (basevisitor* v)
 {
-  if (gMsrOptions->fTraceMsrVisitors) {
-    gLogIOstream <<
+  if (gMsrOptions ()->fTraceMsrVisitors) {
+    gLogIOstream () <<
       "% ==> msrTime::acceptIn ()" <<
       endl;
   }
@@ -436,8 +436,8 @@ void msrTime::acceptIn (basevisitor* v)
       dynamic_cast<visitor<S_msrTime>*> (v)) {
         S_msrTime elem = this;
         
-        if (gMsrOptions->fTraceMsrVisitors) {
-          gLogIOstream <<
+        if (gMsrOptions ()->fTraceMsrVisitors) {
+          gLogIOstream () <<
             "% ==> Launching msrTime::visitStart ()" <<
             endl;
         }
@@ -447,8 +447,8 @@ void msrTime::acceptIn (basevisitor* v)
 
 void msrTime::acceptOut (basevisitor* v)
 {
-  if (gMsrOptions->fTraceMsrVisitors) {
-    gLogIOstream <<
+  if (gMsrOptions ()->fTraceMsrVisitors) {
+    gLogIOstream () <<
       "% ==> msrTime::acceptOut ()" <<
       endl;
   }
@@ -458,8 +458,8 @@ void msrTime::acceptOut (basevisitor* v)
       dynamic_cast<visitor<S_msrTime>*> (v)) {
         S_msrTime elem = this;
       
-        if (gMsrOptions->fTraceMsrVisitors) {
-          gLogIOstream <<
+        if (gMsrOptions ()->fTraceMsrVisitors) {
+          gLogIOstream () <<
             "% ==> Launching msrTime::visitEnd ()" <<
             endl;
         }
@@ -594,7 +594,7 @@ string msrTime::asString () const
   else {
     if (fTimeSymbolKind != msrTime::kTimeSymbolSenzaMisura) {
       msrInternalError (
-        gXml2lyOptions->fInputSourceName,
+        gXml2lyOptions ()->fInputSourceName,
         fInputLineNumber,
         __FILE__, __LINE__,
         "time  items vector is empty");
@@ -646,7 +646,7 @@ void msrTime::print (ostream& os)
     os <<
       endl;
       
-    gIndenter++;
+    gIndenter ()++;
     
     vector<S_msrTimeItem>::const_iterator
       iBegin = fTimeItemsVector.begin (),
@@ -659,7 +659,7 @@ void msrTime::print (ostream& os)
  // JMI     os << endl;
     } // for
     
-    gIndenter--;
+    gIndenter ()--;
   }
   
   else
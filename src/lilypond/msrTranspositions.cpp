@@ -61,8 +61,8 @@ msrOctaveShift::~msrOctaveShift ()
 
 void msrOctaveShift::acceptIn (basevisitor* v)
 {
-  if (gMsrOptions->fTraceMsrVisitors) {
-    gLogIOstream <<
+  if (gMsrOptions ()->fTraceMsrVisitors) {
+    gLogIOstream () <<
       "% ==> msrOctaveShift::acceptIn ()" <<
       endl;
   }
@@ -72,8 +72,8 @@ void msrOctaveShift::acceptIn (basevisitor* v)
       dynamic_cast<visitor<S_msrOctaveShift>*> (v)) {
         S_msrOctaveShift elem = this;
         
-        if (gMsrOptions->fTraceMsrVisitors) {
-          gLogIOstream <<
+        if (gMsrOptions ()->fTraceMsrVisitors) {
+          gLogIOstream () <<
             "% ==> Launching msrOctaveShift::visitStart ()" <<
             endl;
         }
@@ -83,8 +83,8 @@ void msrOctaveShift::acceptIn (basevisitor* v)
 
 void msrOctaveShift::acceptOut (basevisitor* v)
 {
-  if (gMsrOptions->fTraceMsrVisitors) {
-    gLogIOstream <<
+  if (gMsrOptions ()->fTraceMsrVisitors) {
+    gLogIOstream () <<
       "% ==> msrOctaveShift::acceptOut ()" <<
       endl;
   }
@@ -94,8 +94,8 @@ void msrOctaveShift::acceptOut (basevisitor* v)
       dynamic_cast<visitor<S_msrOctaveShift>*> (v)) {
         S_msrOctaveShift elem = this;
       
-        if (gMsrOptions->fTraceMsrVisitors) {
-          gLogIOstream <<
+        if (gMsrOptions ()->fTraceMsrVisitors) {
+          gLogIOstream () <<
             "% ==> Launching msrOctaveShift::visitEnd ()" <<
             endl;
         }
@@ -139,7 +139,7 @@ string msrOctaveShift::octaveShiftKindAsString () const
 
 void msrOctaveShift::print (ostream& os)
 {
-  gIndenter++;
+  gIndenter ()++;
   
   os <<
     "OctaveShift" <<
@@ -147,7 +147,7 @@ void msrOctaveShift::print (ostream& os)
     ", size: " << fOctaveShiftSize <<
     endl;
 
-  gIndenter--;
+  gIndenter ()--;
 }
 
 //______________________________________________________________________________
@@ -183,8 +183,8 @@ msrTranspose::msrTranspose (
   fTransposeDouble       = transposeDouble;
 
 #ifdef TRACE_OPTIONS
-  if (gTraceOptions->fTraceTranspositions) {
-    gLogIOstream <<
+  if (gTraceOptions ()->fTraceTranspositions) {
+    gLogIOstream () <<
       "Creating transpose '" <<
       asString () <<
       "'" <<
@@ -218,8 +218,8 @@ bool msrTranspose::isEqualTo (S_msrTranspose otherTranspose) const
 
 void msrTranspose::acceptIn (basevisitor* v)
 {
-  if (gMsrOptions->fTraceMsrVisitors) {
-    gLogIOstream <<
+  if (gMsrOptions ()->fTraceMsrVisitors) {
+    gLogIOstream () <<
       "% ==> msrTranspose::acceptIn ()" <<
       endl;
   }
@@ -229,8 +229,8 @@ void msrTranspose::acceptIn (basevisitor* v)
       dynamic_cast<visitor<S_msrTranspose>*> (v)) {
         S_msrTranspose elem = this;
         
-        if (gMsrOptions->fTraceMsrVisitors) {
-          gLogIOstream <<
+        if (gMsrOptions ()->fTraceMsrVisitors) {
+          gLogIOstream () <<
             "% ==> Launching msrTranspose::visitStart ()" <<
             endl;
         }
@@ -240,8 +240,8 @@ void msrTranspose::acceptIn (basevisitor* v)
 
 void msrTranspose::acceptOut (basevisitor* v)
 {
-  if (gMsrOptions->fTraceMsrVisitors) {
-    gLogIOstream <<
+  if (gMsrOptions ()->fTraceMsrVisitors) {
+    gLogIOstream () <<
       "% ==> msrTranspose::acceptOut ()" <<
       endl;
   }
@@ -251,8 +251,8 @@ void msrTranspose::acceptOut (basevisitor* v)
       dynamic_cast<visitor<S_msrTranspose>*> (v)) {
         S_msrTranspose elem = this;
       
-        if (gMsrOptions->fTraceMsrVisitors) {
-          gLogIOstream <<
+        if (gMsrOptions ()->fTraceMsrVisitors) {
+          gLogIOstream () <<
             "% ==> Launching msrTranspose::visitEnd ()" <<
             endl;
         }
@@ -293,7 +293,7 @@ void msrTranspose::print (ostream& os)
     ", line " << fInputLineNumber <<
     endl;
 
-  gIndenter++;
+  gIndenter ()++;
   
   os << left <<
     setw (fieldWidth) <<
@@ -310,7 +310,7 @@ void msrTranspose::print (ostream& os)
     endl <<
     endl;
     
-  gIndenter--;
+  gIndenter ()--;
 }
 
 
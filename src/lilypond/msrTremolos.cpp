@@ -62,8 +62,8 @@ string msrSingleTremolo::singleTremoloPlacementKindAsString () const
 
 void msrSingleTremolo::acceptIn (basevisitor* v)
 {
-  if (gMsrOptions->fTraceMsrVisitors) {
-    gLogIOstream <<
+  if (gMsrOptions ()->fTraceMsrVisitors) {
+    gLogIOstream () <<
       "% ==> msrSingleTremolo::acceptIn ()" <<
       endl;
   }
@@ -73,8 +73,8 @@ void msrSingleTremolo::acceptIn (basevisitor* v)
       dynamic_cast<visitor<S_msrSingleTremolo>*> (v)) {
         S_msrSingleTremolo elem = this;
         
-        if (gMsrOptions->fTraceMsrVisitors) {
-          gLogIOstream <<
+        if (gMsrOptions ()->fTraceMsrVisitors) {
+          gLogIOstream () <<
             "% ==> Launching msrSingleTremolo::visitStart ()" <<
             endl;
         }
@@ -84,8 +84,8 @@ void msrSingleTremolo::acceptIn (basevisitor* v)
 
 void msrSingleTremolo::acceptOut (basevisitor* v)
 {
-  if (gMsrOptions->fTraceMsrVisitors) {
-    gLogIOstream <<
+  if (gMsrOptions ()->fTraceMsrVisitors) {
+    gLogIOstream () <<
       "% ==> msrSingleTremolo::acceptOut ()" <<
       endl;
   }
@@ -95,8 +95,8 @@ void msrSingleTremolo::acceptOut (basevisitor* v)
       dynamic_cast<visitor<S_msrSingleTremolo>*> (v)) {
         S_msrSingleTremolo elem = this;
       
-        if (gMsrOptions->fTraceMsrVisitors) {
-          gLogIOstream <<
+        if (gMsrOptions ()->fTraceMsrVisitors) {
+          gLogIOstream () <<
             "% ==> Launching msrSingleTremolo::visitEnd ()" <<
             endl;
         }
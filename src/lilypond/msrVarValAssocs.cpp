@@ -62,8 +62,8 @@ msrVarValAssoc::~msrVarValAssoc ()
 void msrVarValAssoc::setVariableValue (string value)
 {
 #ifdef TRACE_OPTIONS
-  if (gTraceOptions->fTraceVarValAssocs) {
-    gLogIOstream <<
+  if (gTraceOptions ()->fTraceVarValAssocs) {
+    gLogIOstream () <<
       "Setting the value of marVarValAssoc \"" <<
       varValAssocKindAsString (fVarValAssocKind) <<
       "\" to '" <<
@@ -78,8 +78,8 @@ void msrVarValAssoc::setVariableValue (string value)
 
 void msrVarValAssoc::acceptIn (basevisitor* v)
 {
-  if (gMsrOptions->fTraceMsrVisitors) {
-    gLogIOstream <<
+  if (gMsrOptions ()->fTraceMsrVisitors) {
+    gLogIOstream () <<
       "% ==> msrVarValAssoc::acceptIn ()" <<
       endl;
   }
@@ -89,8 +89,8 @@ void msrVarValAssoc::acceptIn (basevisitor* v)
       dynamic_cast<visitor<S_msrVarValAssoc>*> (v)) {
         S_msrVarValAssoc elem = this;
         
-        if (gMsrOptions->fTraceMsrVisitors) {
-          gLogIOstream <<
+        if (gMsrOptions ()->fTraceMsrVisitors) {
+          gLogIOstream () <<
             "% ==> Launching msrVarValAssoc::visitStart ()" <<
             endl;
         }
@@ -100,8 +100,8 @@ void msrVarValAssoc::acceptIn (basevisitor* v)
 
 void msrVarValAssoc::acceptOut (basevisitor* v)
 {
-  if (gMsrOptions->fTraceMsrVisitors) {
-    gLogIOstream <<
+  if (gMsrOptions ()->fTraceMsrVisitors) {
+    gLogIOstream () <<
       "% ==> msrVarValAssoc::acceptOut ()" <<
       endl;
   }
@@ -111,8 +111,8 @@ void msrVarValAssoc::acceptOut (basevisitor* v)
       dynamic_cast<visitor<S_msrVarValAssoc>*> (v)) {
         S_msrVarValAssoc elem = this;
       
-        if (gMsrOptions->fTraceMsrVisitors) {
-          gLogIOstream <<
+        if (gMsrOptions ()->fTraceMsrVisitors) {
+          gLogIOstream () <<
             "% ==> Launching msrVarValAssoc::visitEnd ()" <<
             endl;
         }
@@ -161,7 +161,7 @@ void msrVarValAssoc::print (ostream& os)
     "MSR VarValAssoc" <<
     endl;
   
-  gIndenter++;
+  gIndenter ()++;
 
   string variableValue;
 
@@ -183,7 +183,7 @@ void msrVarValAssoc::print (ostream& os)
     "\"" << variableValue << "\"" <<
     endl;
   
-  gIndenter--;
+  gIndenter ()--;
 }
 
 ostream& operator<< (ostream& os, const S_msrVarValAssoc& elt) {
@@ -217,8 +217,8 @@ msrVarValsListAssoc::~msrVarValsListAssoc ()
 
 void msrVarValsListAssoc::acceptIn (basevisitor* v)
 {
-  if (gMsrOptions->fTraceMsrVisitors) {
-    gLogIOstream <<
+  if (gMsrOptions ()->fTraceMsrVisitors) {
+    gLogIOstream () <<
       "% ==> msrVarValsListAssoc::acceptIn ()" <<
       endl;
   }
@@ -228,8 +228,8 @@ void msrVarValsListAssoc::acceptIn (basevisitor* v)
       dynamic_cast<visitor<S_msrVarValsListAssoc>*> (v)) {
         S_msrVarValsListAssoc elem = this;
         
-        if (gMsrOptions->fTraceMsrVisitors) {
-          gLogIOstream <<
+        if (gMsrOptions ()->fTraceMsrVisitors) {
+          gLogIOstream () <<
             "% ==> Launching msrVarValsListAssoc::visitStart ()" <<
             endl;
         }
@@ -239,8 +239,8 @@ void msrVarValsListAssoc::acceptIn (basevisitor* v)
 
 void msrVarValsListAssoc::acceptOut (basevisitor* v)
 {
-  if (gMsrOptions->fTraceMsrVisitors) {
-    gLogIOstream <<
+  if (gMsrOptions ()->fTraceMsrVisitors) {
+    gLogIOstream () <<
       "% ==> msrVarValsListAssoc::acceptOut ()" <<
       endl;
   }
@@ -250,8 +250,8 @@ void msrVarValsListAssoc::acceptOut (basevisitor* v)
       dynamic_cast<visitor<S_msrVarValsListAssoc>*> (v)) {
         S_msrVarValsListAssoc elem = this;
       
-        if (gMsrOptions->fTraceMsrVisitors) {
-          gLogIOstream <<
+        if (gMsrOptions ()->fTraceMsrVisitors) {
+          gLogIOstream () <<
             "% ==> Launching msrVarValsListAssoc::visitEnd ()" <<
             endl;
         }
@@ -322,7 +322,7 @@ void msrVarValsListAssoc::print (ostream& os)
     "MSR VarValsListAssoc" <<
     endl;
   
-  gIndenter++;
+  gIndenter ()++;
 
   const int fieldWidth = 16;
 
@@ -336,7 +336,7 @@ void msrVarValsListAssoc::print (ostream& os)
     "variable values" << " : " <<
     endl;
     
-  gIndenter++;
+  gIndenter ()++;
 
   if (fVariableValuesList.size ()) {
     list<string>::const_iterator
@@ -354,9 +354,9 @@ void msrVarValsListAssoc::print (ostream& os)
   os <<
     endl;
   
-  gIndenter--;
+  gIndenter ()--;
 
-  gIndenter--;
+  gIndenter ()--;
 }
 
 ostream& operator<< (ostream& os, const S_msrVarValsListAssoc& elt) {
@@ -85,8 +85,8 @@ msrWords::~msrWords ()
 
 void msrWords::acceptIn (basevisitor* v)
 {
-  if (gMsrOptions->fTraceMsrVisitors) {
-    gLogIOstream <<
+  if (gMsrOptions ()->fTraceMsrVisitors) {
+    gLogIOstream () <<
       "% ==> msrWords::acceptIn ()" <<
       endl;
   }
@@ -96,8 +96,8 @@ void msrWords::acceptIn (basevisitor* v)
       dynamic_cast<visitor<S_msrWords>*> (v)) {
         S_msrWords elem = this;
         
-        if (gMsrOptions->fTraceMsrVisitors) {
-          gLogIOstream <<
+        if (gMsrOptions ()->fTraceMsrVisitors) {
+          gLogIOstream () <<
             "% ==> Launching msrWords::visitStart ()" <<
             endl;
         }
@@ -107,8 +107,8 @@ void msrWords::acceptIn (basevisitor* v)
 
 void msrWords::acceptOut (basevisitor* v)
 {
-  if (gMsrOptions->fTraceMsrVisitors) {
-    gLogIOstream <<
+  if (gMsrOptions ()->fTraceMsrVisitors) {
+    gLogIOstream () <<
       "% ==> msrWords::acceptOut ()" <<
       endl;
   }
@@ -118,8 +118,8 @@ void msrWords::acceptOut (basevisitor* v)
       dynamic_cast<visitor<S_msrWords>*> (v)) {
         S_msrWords elem = this;
       
-        if (gMsrOptions->fTraceMsrVisitors) {
-          gLogIOstream <<
+        if (gMsrOptions ()->fTraceMsrVisitors) {
+          gLogIOstream () <<
             "% ==> Launching msrWords::visitEnd ()" <<
             endl;
         }
@@ -218,7 +218,7 @@ void msrWords::print (ostream& os)
     "Words" <<
     endl;
 
-  gIndenter++;
+  gIndenter ()++;
 
   const int fieldWidth = 27;
 
@@ -255,7 +255,7 @@ void msrWords::print (ostream& os)
     msrWordsXMLLangKindAsString (fWordsXMLLangKind) <<
     endl;
   
-  gIndenter--;
+  gIndenter ()--;
 }
 
 
@@ -24,11 +24,6 @@ namespace MusicXML2
 {
 
 //_______________________________________________________________________________
-
-S_musicXMLOptions gMusicXMLOptions;
-S_musicXMLOptions gMusicXMLOptionsUserChoices;
-S_musicXMLOptions gMusicXMLOptionsWithDetailedTrace;
-
 S_musicXMLOptions musicXMLOptions::create (
   S_optionsHandler optionsHandler)
 {
@@ -327,39 +322,39 @@ void musicXMLOptions::checkOptionsConsistency ()
 //______________________________________________________________________________
 void musicXMLOptions::printMusicXMLOptionsValues (int fieldWidth)
 {  
-  gLogIOstream <<
+  gLogIOstream () <<
     "The MusicXML options are:" <<
     endl;
 
-  gIndenter++;
+  gIndenter ()++;
 
   // trace and display
   // --------------------------------------
   
-  gLogIOstream <<
+  gLogIOstream () <<
     "Trace and display:" <<
     endl;
 
-  gIndenter++;
+  gIndenter ()++;
 
-  gLogIOstream << left <<
+  gLogIOstream () << left <<
     setw (fieldWidth) << "traceMusicXMLTreeVisitors" << " : " <<
     booleanAsString (fTraceMusicXMLTreeVisitors) <<
     endl;
 
-  gIndenter--;
+  gIndenter ()--;
       
 
   // clefs, keys, times
   // --------------------------------------
 
-  gLogIOstream <<
+  gLogIOstream () <<
     "Clefs, keys, times:" <<
     endl;
 
-  gIndenter++;
+  gIndenter ()++;
 
-  gLogIOstream << left <<
+  gLogIOstream () << left <<
     setw (fieldWidth) << "ignoreRedundantClefs" << " : " <<
     booleanAsString (fIgnoreRedundantClefs) <<
     endl <<
@@ -376,10 +371,10 @@ void musicXMLOptions::printMusicXMLOptionsValues (int fieldWidth)
     booleanAsString (fLoopToMusicXML) <<
     endl;
 
-  gIndenter--;
+  gIndenter ()--;
 
 
-  gIndenter--;
+  gIndenter ()--;
 }
 
 S_optionsItem musicXMLOptions::handleOptionsItem (
@@ -404,18 +399,18 @@ void initializeMusicXMLOptionsHandling (
   // create the MusicXML options
   // ------------------------------------------------------
   
-  gMusicXMLOptionsUserChoices = musicXMLOptions::create (
+  gMusicXMLOptionsUserChoices () = musicXMLOptions::create (
     optionsHandler);
-  assert(gMusicXMLOptionsUserChoices != 0);
+  assert(gMusicXMLOptionsUserChoices () != 0);
 
-  gMusicXMLOptions =
-    gMusicXMLOptionsUserChoices;
+  gMusicXMLOptions () =
+    gMusicXMLOptionsUserChoices ();
 
   // prepare for measure detailed trace
   // ------------------------------------------------------
 
-  gMusicXMLOptionsWithDetailedTrace =
-    gMusicXMLOptions->
+  gMusicXMLOptionsWithDetailedTrace () =
+    gMusicXMLOptions ()->
       createCloneWithDetailedTrace ();
 }
 
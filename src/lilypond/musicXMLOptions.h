@@ -118,9 +118,9 @@ class musicXMLOptions : public optionsGroup
 typedef SMARTP<musicXMLOptions> S_musicXMLOptions;
 EXP ostream& operator<< (ostream& os, const S_musicXMLOptions& elt);
 
-EXP extern S_musicXMLOptions gMusicXMLOptions;
-EXP extern S_musicXMLOptions gMusicXMLOptionsUserChoices;
-EXP extern S_musicXMLOptions gMusicXMLOptionsWithDetailedTrace;
+// gMusicXMLOptions (), gMusicXMLOptionsUserChoices () and
+// gMusicXMLOptionsWithDetailedTrace () are those of the current
+// conversion context, see conversionContext.h
 
 //______________________________________________________________________________
 void initializeMusicXMLOptionsHandling (
@@ -18,6 +18,7 @@
 #include <regex>
 
 #include "messagesHandling.h"
+#include "profiling.h"
 
 #include "msr2Summary.h"
 
@@ -86,7 +87,7 @@ string mxmlPartGroupDescr::partGroupDescrAsString () const
     fPartGroup->getPartGroupCombinedName ();
 
 #ifdef TRACE_OPTIONS
-  if (gTraceOptions->fTracePartGroups) {
+  if (gTraceOptions ()->fTracePartGroups) {
     s <<
       ", positions " <<
       fStartPosition << ".." << fStopPosition;
@@ -213,7 +214,7 @@ void mxmlTree2MsrSkeletonBuilder::browseMxmlTree (
 {  
   if (mxmlTree) {
     // create a tree browser on this visitor
-    tree_browser<xmlelement> browser (this);
+    mxmlTreeBrowser browser (this);
     
     // browse the xmlelement tree
     browser.browse (*mxmlTree);
@@ -243,7 +244,7 @@ void mxmlTree2MsrSkeletonBuilder::showAllPartGroupDescrsMap (
     endl;
     
   if (fAllPartGroupDescrsMap.size ()) {
-    gIndenter++;
+    gIndenter ()++;
     
     map<int, S_mxmlPartGroupDescr>::const_iterator
       iBegin = fAllPartGroupDescrsMap.begin (),
@@ -262,25 +263,25 @@ void mxmlTree2MsrSkeletonBuilder::showAllPartGroupDescrsMap (
         partGroupDescr->partGroupDescrAsString () <<
         endl;
 
-        gIndenter++;
+        gIndenter ()++;
         
         partGroup->
           printPartGroupParts (
             inputLineNumber,
             fLogOutputStream);
 
-        gIndenter--;
+        gIndenter ()--;
           
       if (++i == iEnd) break;
       // no endl here
     } // for
     
-    gIndenter--;
+    gIndenter ()--;
   }
   
   else {
     fLogOutputStream <<
-      gTab << "empty map" <<
+      gTab () << "empty map" <<
       endl;
   }
       
@@ -298,7 +299,7 @@ void mxmlTree2MsrSkeletonBuilder::showStartedPartGroupDescrsMap (
     endl;
     
   if (fStartedPartGroupDescrsMap.size ()) {
-    gIndenter++;
+    gIndenter ()++;
     
     map<int, S_mxmlPartGroupDescr>::const_iterator
       iBegin = fStartedPartGroupDescrsMap.begin (),
@@ -317,25 +318,25 @@ void mxmlTree2MsrSkeletonBuilder::showStartedPartGroupDescrsMap (
         partGroupDescr->partGroupDescrAsString () <<
         endl;
 
-        gIndenter++;
+        gIndenter ()++;
         
         partGroup->
           printPartGroupParts (
             inputLineNumber,
             fLogOutputStream);
 
-        gIndenter--;
+        gIndenter ()--;
           
       if (++i == iEnd) break;
       // no endl here
     } // for
     
-    gIndenter--;
+    gIndenter ()--;
   }
   
   else {
     fLogOutputStream <<
-      gTab << "empty map" <<
+      gTab () << "empty map" <<
       endl;
   }
       
@@ -353,7 +354,7 @@ void mxmlTree2MsrSkeletonBuilder::showPartGroupsStack (
     endl;
 
   if (fPartGroupsDescrStack.size ()) {
-    gIndenter++;
+    gIndenter ()++;
 
     list<S_mxmlPartGroupDescr>::const_iterator
       iBegin = fPartGroupsDescrStack.begin (),
@@ -369,12 +370,12 @@ void mxmlTree2MsrSkeletonBuilder::showPartGroupsStack (
       // no endl here
     } // for
     
-    gIndenter--;
+    gIndenter ()--;
   }
   
   else {
     fLogOutputStream <<
-      gTab << "empty stack" <<
+      gTab () << "empty stack" <<
       endl;
   }
       
@@ -391,7 +392,7 @@ void mxmlTree2MsrSkeletonBuilder::showPartGroupDescrsVector (
     "PartGroupDescrsVector:" <<
     endl;
     
-  gIndenter++;
+  gIndenter ()++;
   
   for (unsigned int i = 0; i < fPartGroupDescsVector.size (); i++) {
     S_mxmlPartGroupDescr
@@ -412,7 +413,7 @@ void mxmlTree2MsrSkeletonBuilder::showPartGroupDescrsVector (
     "------------------" <<
     endl;
     
-  gIndenter--;
+  gIndenter ()--;
 }
 
 //________________________________________________________________________
@@ -424,7 +425,7 @@ void mxmlTree2MsrSkeletonBuilder::showPositionStartingPartGroupDescrsVector (
     endl;
     
   if (fPositionStartingPartGroupDescrsVector.size ()) {
-    gIndenter++;
+    gIndenter ()++;
     
     for (unsigned int k = 0; k < fPositionStartingPartGroupDescrsVector.size (); k++) {
       fLogOutputStream <<
@@ -436,7 +437,7 @@ void mxmlTree2MsrSkeletonBuilder::showPositionStartingPartGroupDescrsVector (
           fPositionStartingPartGroupDescrsVector [k];
   
       if (startingPartGroupDescrsList.size ()) {
-        gIndenter++;
+        gIndenter ()++;
   
         list<S_mxmlPartGroupDescr>::const_iterator
           iBegin = startingPartGroupDescrsList.begin (),
@@ -460,17 +461,17 @@ void mxmlTree2MsrSkeletonBuilder::showPositionStartingPartGroupDescrsVector (
           // no endl here
         } // for
 
-        gIndenter--;
+        gIndenter ()--;
       }
 
       else {
         fLogOutputStream <<
-          gTab << "empty list" <<
+          gTab () << "empty list" <<
           endl;
       }
     }
       
-    gIndenter--;
+    gIndenter ()--;
   }
   
   fLogOutputStream <<
@@ -487,7 +488,7 @@ void mxmlTree2MsrSkeletonBuilder::showPositionStoppingPartGroupDescrsVector (
     endl;
     
   if (fPositionStoppingPartGroupDescrsVector.size ()) {
-    gIndenter++;
+    gIndenter ()++;
     
     for (unsigned int k = 0; k < fPositionStoppingPartGroupDescrsVector.size (); k++) {
       fLogOutputStream <<
@@ -499,7 +500,7 @@ void mxmlTree2MsrSkeletonBuilder::showPositionStoppingPartGroupDescrsVector (
           fPositionStoppingPartGroupDescrsVector [k];
   
       if (theList.size ()) {
-        gIndenter++;
+        gIndenter ()++;
   
         list<S_mxmlPartGroupDescr>::const_iterator
           iBegin = theList.begin (),
@@ -523,17 +524,17 @@ void mxmlTree2MsrSkeletonBuilder::showPositionStoppingPartGroupDescrsVector (
           // no endl here
         } // for
 
-        gIndenter--;
+        gIndenter ()--;
       }
 
       else {
         fLogOutputStream <<
-          gTab << "empty list" <<
+          gTab () << "empty list" <<
           endl;
       }
     }
       
-    gIndenter--;
+    gIndenter ()--;
   }
   
   fLogOutputStream <<
@@ -550,7 +551,7 @@ void mxmlTree2MsrSkeletonBuilder::showPartsVector (
     endl;
     
   if (fPartsVector.size ()) {
-    gIndenter++;
+    gIndenter ()++;
     
     for (unsigned int i = 0; i < fPartsVector.size (); i++) {
       S_msrPart
@@ -581,12 +582,12 @@ void mxmlTree2MsrSkeletonBuilder::showPartsVector (
         endl;
     } // for
       
-    gIndenter--;
+    gIndenter ()--;
   }
   
   else {
     fLogOutputStream <<
-      gTab << "empty vector" <<
+      gTab () << "empty vector" <<
       endl;
   }
   
@@ -672,7 +673,7 @@ void mxmlTree2MsrSkeletonBuilder::registerPartGroupDescrAsStarted (
   S_mxmlPartGroupDescr partGroupDescr)
 {
 #ifdef TRACE_OPTIONS
-  if (gTraceOptions->fTracePartGroups) {
+  if (gTraceOptions ()->fTracePartGroups) {
     fLogOutputStream <<
       "Registering part group descr '" <<
       partGroupDescr->getPartGroupCombinedName () <<
@@ -681,7 +682,7 @@ void mxmlTree2MsrSkeletonBuilder::registerPartGroupDescrAsStarted (
       endl;
   }
 
-  if (gTraceOptions->fTracePartGroupsDetails) {
+  if (gTraceOptions ()->fTracePartGroupsDetails) {
     showPartGroupsData (
       inputLineNumber,
       "BEFORE registering part group " +
@@ -718,7 +719,7 @@ void mxmlTree2MsrSkeletonBuilder::registerPartGroupDescrAsStarted (
 */
 
 #ifdef TRACE_OPTIONS
-  if (gTraceOptions->fTracePartGroupsDetails) {
+  if (gTraceOptions ()->fTracePartGroupsDetails) {
     showPartGroupsData (
       inputLineNumber,
       "AFTER registering part group " +
@@ -763,7 +764,7 @@ void mxmlTree2MsrSkeletonBuilder::registerPartGroupDescrAsStartingAtCurrentPosit
       if (i == iEnd) {
         // append partGroupDescr to the list 
 #ifdef TRACE_OPTIONS
-        if (gTraceOptions->fTracePartGroups) {
+        if (gTraceOptions ()->fTracePartGroups) {
           fLogOutputStream <<
             "Appending part group descr " <<
             partGroupDescr->
@@ -785,7 +786,7 @@ void mxmlTree2MsrSkeletonBuilder::registerPartGroupDescrAsStartingAtCurrentPosit
           " could not be inserted in part groups to be stopped list";
           
         msrInternalError (
-          gXml2lyOptions->fInputSourceName,
+          gXml2lyOptions ()->fInputSourceName,
           inputLineNumber,
           __FILE__, __LINE__,
           s.str ());
@@ -804,7 +805,7 @@ void mxmlTree2MsrSkeletonBuilder::registerPartGroupDescrAsStartingAtCurrentPosit
 
         // insert partGroupDescr before currentPartGroupDescr
 #ifdef TRACE_OPTIONS
-        if (gTraceOptions->fTracePartGroups) {
+        if (gTraceOptions ()->fTracePartGroups) {
           fLogOutputStream <<
             "Inserting part group descr " <<
             currentPartGroupDescr->
@@ -846,7 +847,7 @@ void mxmlTree2MsrSkeletonBuilder::insertPartGroupDescInStartingList (
     if (i == iEnd) {
       // append partGroupDescr to the list 
 #ifdef TRACE_OPTIONS
-      if (gTraceOptions->fTracePartGroups) {
+      if (gTraceOptions ()->fTracePartGroups) {
         fLogOutputStream <<
           "Appending part group descr " <<
           partGroupDescr->
@@ -868,7 +869,7 @@ void mxmlTree2MsrSkeletonBuilder::insertPartGroupDescInStartingList (
         " could not be inserted in part groups to be stopped list";
         
       msrInternalError (
-        gXml2lyOptions->fInputSourceName,
+        gXml2lyOptions ()->fInputSourceName,
         inputLineNumber,
         __FILE__, __LINE__,
         s.str ());
@@ -886,7 +887,7 @@ void mxmlTree2MsrSkeletonBuilder::insertPartGroupDescInStartingList (
       currentPartGroupDescr->getStopPosition ()) {
       // insert partGroupDescr before currentPartGroupDescr
 #ifdef TRACE_OPTIONS
-      if (gTraceOptions->fTracePartGroups) {
+      if (gTraceOptions ()->fTracePartGroups) {
         fLogOutputStream <<
           "Inserting part group descr " <<
           currentPartGroupDescr->
@@ -926,7 +927,7 @@ void mxmlTree2MsrSkeletonBuilder::insertPartGroupDescInStoppingList (
     if (i == iEnd) {
       // append partGroupDescr to the list 
 #ifdef TRACE_OPTIONS
-      if (gTraceOptions->fTracePartGroups) {
+      if (gTraceOptions ()->fTracePartGroups) {
         fLogOutputStream <<
           "Appending part group descr " <<
           partGroupDescr->
@@ -948,7 +949,7 @@ void mxmlTree2MsrSkeletonBuilder::insertPartGroupDescInStoppingList (
         " could not be inserted in part groups to be stopped list";
         
       msrInternalError (
-        gXml2lyOptions->fInputSourceName,
+        gXml2lyOptions ()->fInputSourceName,
         inputLineNumber,
         __FILE__, __LINE__,
         s.str ());
@@ -966,7 +967,7 @@ void mxmlTree2MsrSkeletonBuilder::insertPartGroupDescInStoppingList (
       currentPartGroupDescr->getStartPosition ()) {
       // insert partGroupDescr before currentPartGroupDescr
 #ifdef TRACE_OPTIONS
-      if (gTraceOptions->fTracePartGroups) {
+      if (gTraceOptions ()->fTracePartGroups) {
         fLogOutputStream <<
           "Inserting part group descr " <<
           currentPartGroupDescr->
@@ -1043,7 +1044,7 @@ void mxmlTree2MsrSkeletonBuilder::registerPartGroupDescrAsStopped (
   S_mxmlPartGroupDescr partGroupDescr)
 {
 #ifdef TRACE_OPTIONS
-  if (gTraceOptions->fTracePartGroups) {
+  if (gTraceOptions ()->fTracePartGroups) {
     fLogOutputStream <<
       "Registering part group descr '" <<
       partGroupDescr->getPartGroupCombinedName () <<
@@ -1066,7 +1067,7 @@ void mxmlTree2MsrSkeletonBuilder::registerPartGroupDescrAsStopped (
         getPartGroupNumber ());
     
 #ifdef TRACE_OPTIONS
-  if (gTraceOptions->fTracePartGroupsDetails) {
+  if (gTraceOptions ()->fTracePartGroupsDetails) {
     showPartGroupsData (
       inputLineNumber,
       "AFTER forgetting part group descr " +
@@ -1082,7 +1083,7 @@ void mxmlTree2MsrSkeletonBuilder::handlePartGroupStart (
   int inputLineNumber)
 {
 #ifdef TRACE_OPTIONS
-  if (gTraceOptions->fTracePartGroups) {
+  if (gTraceOptions ()->fTracePartGroups) {
     fLogOutputStream <<
       "Creating part group with number '" <<
       fCurrentPartGroupNumber <<
@@ -1125,7 +1126,7 @@ void mxmlTree2MsrSkeletonBuilder::handlePartGroupStart (
              
   // register it in the part groups data
 #ifdef TRACE_OPTIONS
-  if (gTraceOptions->fTracePartGroups) {
+  if (gTraceOptions ()->fTracePartGroups) {
     fLogOutputStream <<
       "Adding part group descr for '" << fCurrentPartGroupNumber <<
       "' to visitor's part groups data" <<
@@ -1140,7 +1141,7 @@ void mxmlTree2MsrSkeletonBuilder::handlePartGroupStart (
     partGroupDescr);
 
 #ifdef TRACE_OPTIONS
-  if (gTraceOptions->fTracePartGroupsDetails) {
+  if (gTraceOptions ()->fTracePartGroupsDetails) {
     showPartGroupsData (
       inputLineNumber,
       "AFTER handlePartGroupStart()");
@@ -1167,7 +1168,7 @@ void mxmlTree2MsrSkeletonBuilder::handlePartGroupStop (
       "' has not been started, it cannot be stopped";
       
     msrMusicXMLError (
-      gXml2lyOptions->fInputSourceName,
+      gXml2lyOptions ()->fInputSourceName,
       inputLineNumber,
       __FILE__, __LINE__,
       s.str ());
@@ -1185,7 +1186,7 @@ void mxmlTree2MsrSkeletonBuilder::handlePartGroupStop (
     partGroupDescrToBeStopped);
 
 #ifdef TRACE_OPTIONS
-  if (gTraceOptions->fTracePartGroupsDetails) {
+  if (gTraceOptions ()->fTracePartGroupsDetails) {
     showPartGroupsData (
       inputLineNumber,
       "AFTER handlePartGroupStop()");
@@ -1210,7 +1211,7 @@ void mxmlTree2MsrSkeletonBuilder::doNestPartGroupDescrInItsContainer (
         
   // set currentPartGroup's uplink to containingPartGroupDescr
 #ifdef TRACE_OPTIONS
-  if (gTraceOptions->fTracePartGroups) {
+  if (gTraceOptions ()->fTracePartGroups) {
     fLogOutputStream <<
       "Setting the uplink of part group " <<
       partGroupToBeStopped->
@@ -1229,7 +1230,7 @@ void mxmlTree2MsrSkeletonBuilder::doNestPartGroupDescrInItsContainer (
 
   // appending currentPartGroup to containingPartGroupDescr
 #ifdef TRACE_OPTIONS
-  if (gTraceOptions->fTracePartGroups) {
+  if (gTraceOptions ()->fTracePartGroups) {
     fLogOutputStream <<
       "Appending sub part group " <<
       partGroupToBeStopped->
@@ -1265,7 +1266,7 @@ void mxmlTree2MsrSkeletonBuilder::createImplicitPartGroup ()
   fCurrentPartGroupNumber = 0;
   
 #ifdef TRACE_OPTIONS
-  if (gTraceOptions->fTracePartGroups) {
+  if (gTraceOptions ()->fTracePartGroups) {
     fLogOutputStream <<
       "Creating an implicit part group with number '" <<
       fCurrentPartGroupNumber <<
@@ -1289,7 +1290,7 @@ void mxmlTree2MsrSkeletonBuilder::createImplicitPartGroup ()
 
   // append it to the MSR score
 #ifdef TRACE_OPTIONS
-  if (gTraceOptions->fTracePartGroups) {
+  if (gTraceOptions ()->fTracePartGroups) {
     fLogOutputStream <<
       "Appending implicit part group '" <<
       fImplicitPartGroup->getPartGroupNumber () <<
@@ -1314,7 +1315,7 @@ void mxmlTree2MsrSkeletonBuilder::createImplicitPartGroup ()
       
   // register it in the part groups data
 #ifdef TRACE_OPTIONS
-  if (gTraceOptions->fTracePartGroups) {
+  if (gTraceOptions ()->fTracePartGroups) {
     fLogOutputStream <<
       "Adding implicit part group descr for '" <<
       fCurrentPartGroupNumber <<
@@ -1330,7 +1331,7 @@ void mxmlTree2MsrSkeletonBuilder::createImplicitPartGroup ()
     fImplicitPartGroupDescr);
 
 #ifdef TRACE_OPTIONS
-  if (gTraceOptions->fTracePartGroupsDetails) {
+  if (gTraceOptions ()->fTracePartGroupsDetails) {
     showPartGroupsData (
       inputLineNumber,
       "AFTER creating fImplicitPartGroup");
@@ -1343,7 +1344,7 @@ void mxmlTree2MsrSkeletonBuilder::doPartGroupsNestingAndPartsAllocation (
   int inputLineNumber)
 {
 #ifdef TRACE_OPTIONS
-  if (gTraceOptions->fTracePartGroups) {
+  if (gTraceOptions ()->fTracePartGroups) {
     fLogOutputStream <<
       "doPartGroupsNestingAndPartsAllocation:" <<
       endl;
@@ -1355,7 +1356,7 @@ void mxmlTree2MsrSkeletonBuilder::doPartGroupsNestingAndPartsAllocation (
   // stored in the data we've built, a second time
   
 #ifdef TRACE_OPTIONS
-  if (gTraceOptions->fTracePartGroupsDetails) {
+  if (gTraceOptions ()->fTracePartGroupsDetails) {
     showPartGroupsData (
       inputLineNumber,
       "BEFORE doPartGroupsNestingAndPartsAllocation");
@@ -1388,7 +1389,7 @@ void mxmlTree2MsrSkeletonBuilder::doPartGroupsNestingAndPartsAllocation (
           ", since the stack is empty";
           
         msrMusicXMLError (
-          gXml2lyOptions->fInputSourceName,
+          gXml2lyOptions ()->fInputSourceName,
           inputLineNumber,
           __FILE__, __LINE__,
           s.str ());            
@@ -1412,7 +1413,7 @@ void mxmlTree2MsrSkeletonBuilder::doPartGroupsNestingAndPartsAllocation (
           fPositionStoppingPartGroupDescrsVector [k];
   
       if (stoppingPartGroupDescrsList.size ()) {
-        gIndenter++;
+        gIndenter ()++;
   
         list<S_mxmlPartGroupDescr>::const_iterator
           iBegin = stoppingPartGroupDescrsList.begin (),
@@ -1445,7 +1446,7 @@ void mxmlTree2MsrSkeletonBuilder::doPartGroupsNestingAndPartsAllocation (
               ", since the stack is empty";
               
             msrMusicXMLError (
-              gXml2lyOptions->fInputSourceName,
+              gXml2lyOptions ()->fInputSourceName,
               stopInputLineNumber,
               __FILE__, __LINE__,
               s.str ());            
@@ -1458,7 +1459,7 @@ void mxmlTree2MsrSkeletonBuilder::doPartGroupsNestingAndPartsAllocation (
                 fPartGroupsDescrStack.front ();
 
 #ifdef TRACE_OPTIONS
-            if (gTraceOptions->fTracePartGroups) {
+            if (gTraceOptions ()->fTracePartGroups) {
               fLogOutputStream <<
                 "Popping part group " <<
                 partGroupDescr->
@@ -1488,7 +1489,7 @@ void mxmlTree2MsrSkeletonBuilder::doPartGroupsNestingAndPartsAllocation (
                   " into";
                   
                 msrInternalError (
-                  gXml2lyOptions->fInputSourceName,
+                  gXml2lyOptions ()->fInputSourceName,
                   stopInputLineNumber,
                   __FILE__, __LINE__,
                   s.str ());
@@ -1505,7 +1506,7 @@ void mxmlTree2MsrSkeletonBuilder::doPartGroupsNestingAndPartsAllocation (
 
           else {
 #ifdef TRACE_OPTIONS
-            if (gTraceOptions->fTracePartGroupsDetails) {
+            if (gTraceOptions ()->fTracePartGroupsDetails) {
               showPartGroupsData (
                 stopInputLineNumber,
                 "UPON overlapping part groups");
@@ -1537,11 +1538,11 @@ void mxmlTree2MsrSkeletonBuilder::doPartGroupsNestingAndPartsAllocation (
                 endl <<
                 "There are overlapping part groups, namely: " <<
                 endl <<
-                gTab << partGroupDescr->partGroupDescrAsString () <<
+                gTab () << partGroupDescr->partGroupDescrAsString () <<
                 endl <<
                 "and" <<
                 endl <<
-                gTab << partGroupsDescrStackTop->partGroupDescrAsString () <<
+                gTab () << partGroupsDescrStackTop->partGroupDescrAsString () <<
                 endl <<
                 endl <<
                 "The parts they share are:" <<
@@ -1559,7 +1560,7 @@ void mxmlTree2MsrSkeletonBuilder::doPartGroupsNestingAndPartsAllocation (
                     fPartsVector [m];
                   
                 s <<
-                  gTab <<
+                  gTab () <<
                   part->getPartCombinedName () <<
                   ", line " << part->getInputLineNumber () <<
                   endl;
@@ -1573,19 +1574,19 @@ R"(Please contact the maintainers of xml2ly (see '-c, -contact'):
   of a score exhibiting overlapping part groups)";
               
               msrMusicXMLError (
-                gXml2lyOptions->fInputSourceName,
+                gXml2lyOptions ()->fInputSourceName,
                 stopInputLineNumber,
                 __FILE__, __LINE__,
                 s.str ());
             }
-          }
 #endif
+          }
     
           if (++i == iEnd) break;
           // no endl here
         } // for
 
-        gIndenter--;
+        gIndenter ()--;
       }
     }
         
@@ -1596,7 +1597,7 @@ R"(Please contact the maintainers of xml2ly (see '-c, -contact'):
           fPositionStartingPartGroupDescrsVector [k];
   
       if (startingPartGroupDescrsList.size ()) {
-        gIndenter++;
+        gIndenter ()++;
   
         list<S_mxmlPartGroupDescr>::const_iterator
           iBegin = startingPartGroupDescrsList.begin (),
@@ -1613,7 +1614,7 @@ R"(Please contact the maintainers of xml2ly (see '-c, -contact'):
       
           // make it the new current part group
 #ifdef TRACE_OPTIONS
-          if (gTraceOptions->fTracePartGroups) {
+          if (gTraceOptions ()->fTracePartGroups) {
             fLogOutputStream <<
               "Pushing part group descr '" <<
               partGroupDescr->partGroupDescrAsString () <<
@@ -1630,12 +1631,12 @@ R"(Please contact the maintainers of xml2ly (see '-c, -contact'):
           // no endl here
         } // for
 
-        gIndenter--;
+        gIndenter ()--;
       }
     }
         
 #ifdef TRACE_OPTIONS
-    if (gTraceOptions->fTracePartGroupsDetails) {
+    if (gTraceOptions ()->fTracePartGroupsDetails) {
       stringstream s;
 
       s <<
@@ -1650,7 +1651,7 @@ R"(Please contact the maintainers of xml2ly (see '-c, -contact'):
   } // for
       
 #ifdef TRACE_OPTIONS
-  if (gTraceOptions->fTracePartGroupsDetails) {
+  if (gTraceOptions ()->fTracePartGroupsDetails) {
     showPartGroupsData (
       inputLineNumber,
       "AFTER doPartGroupsNestingAndPartsAllocation");
@@ -1746,7 +1747,7 @@ S_msrVoice mxmlTree2MsrSkeletonBuilder::createHarmonyVoiceForVoiceIfNotYetDone (
 //________________________________________________________________________
 void mxmlTree2MsrSkeletonBuilder::visitStart (S_encoding& elt)
 {
-  if (gMusicXMLOptions->fTraceMusicXMLTreeVisitors) {
+  if (gMusicXMLOptions ()->fTraceMusicXMLTreeVisitors) {
     fLogOutputStream <<
       "--> Start visiting S_encoding" <<
       ", line " << elt->getInputLineNumber () <<
@@ -1754,7 +1755,7 @@ void mxmlTree2MsrSkeletonBuilder::visitStart (S_encoding& elt)
   }
 
 #ifdef TRACE_OPTIONS
-  if (gTraceOptions->fTraceParts) {
+  if (gTraceOptions ()->fTraceParts) {
     fLogOutputStream <<
       "*** Analysing S_encoding ***" <<
       ", " << elt->getValue () <<
@@ -1768,7 +1769,7 @@ void mxmlTree2MsrSkeletonBuilder::visitStart (S_encoding& elt)
 //________________________________________________________________________
 void mxmlTree2MsrSkeletonBuilder::visitStart (S_score_partwise& elt)
 {
-  if (gMusicXMLOptions->fTraceMusicXMLTreeVisitors) {
+  if (gMusicXMLOptions ()->fTraceMusicXMLTreeVisitors) {
     fLogOutputStream <<
       "--> Start visiting S_score_partwise" <<
       ", line " << elt->getInputLineNumber () <<
@@ -1776,7 +1777,7 @@ void mxmlTree2MsrSkeletonBuilder::visitStart (S_score_partwise& elt)
   }
 
 #ifdef TRACE_OPTIONS
-  if (gTraceOptions->fTraceParts) {
+  if (gTraceOptions ()->fTraceParts) {
     fLogOutputStream <<
       "Analysing the score partwise" <<
       endl;
@@ -1788,7 +1789,7 @@ void mxmlTree2MsrSkeletonBuilder::visitStart (S_score_partwise& elt)
 
 void mxmlTree2MsrSkeletonBuilder::visitEnd (S_score_partwise& elt)
 {
-  if (gMusicXMLOptions->fTraceMusicXMLTreeVisitors) {
+  if (gMusicXMLOptions ()->fTraceMusicXMLTreeVisitors) {
     fLogOutputStream <<
       "--> End visiting S_score_partwise" <<
       ", line " << elt->getInputLineNumber () <<
@@ -1804,10 +1805,10 @@ void mxmlTree2MsrSkeletonBuilder::visitEnd (S_score_partwise& elt)
   if (
     ! identification->getWorkTitle ()
       &&
-    gMusicXMLOptions->fUseFilenameAsWorkTitle
+    gMusicXMLOptions ()->fUseFilenameAsWorkTitle
   ) {
     inputSourceName =
-      gXml2lyOptions->fInputSourceName;
+      gXml2lyOptions ()->fInputSourceName;
 
     if (inputSourceName == "-") {
       inputSourceName = "Standard input";
@@ -1826,7 +1827,7 @@ void mxmlTree2MsrSkeletonBuilder::visitStart ( S_work_number& elt )
   int inputLineNumber =
     elt->getInputLineNumber ();
     
-  if (gMusicXMLOptions->fTraceMusicXMLTreeVisitors) {
+  if (gMusicXMLOptions ()->fTraceMusicXMLTreeVisitors) {
     fLogOutputStream <<
       "--> Start visiting S_work_number" <<
       ", line " << inputLineNumber <<
@@ -1844,7 +1845,7 @@ void mxmlTree2MsrSkeletonBuilder::visitStart ( S_work_title& elt )
   int inputLineNumber =
     elt->getInputLineNumber ();
     
-  if (gMusicXMLOptions->fTraceMusicXMLTreeVisitors) {
+  if (gMusicXMLOptions ()->fTraceMusicXMLTreeVisitors) {
     fLogOutputStream <<
       "--> Start visiting S_work_title" <<
       ", line " << inputLineNumber <<
@@ -1862,7 +1863,7 @@ void mxmlTree2MsrSkeletonBuilder::visitStart ( S_movement_number& elt )
   int inputLineNumber =
     elt->getInputLineNumber ();
     
-  if (gMusicXMLOptions->fTraceMusicXMLTreeVisitors) {
+  if (gMusicXMLOptions ()->fTraceMusicXMLTreeVisitors) {
     fLogOutputStream <<
       "--> Start visiting S_movement_number" <<
       ", line " << inputLineNumber <<
@@ -1880,7 +1881,7 @@ void mxmlTree2MsrSkeletonBuilder::visitStart ( S_movement_title& elt )
   int inputLineNumber =
     elt->getInputLineNumber ();
     
-  if (gMusicXMLOptions->fTraceMusicXMLTreeVisitors) {
+  if (gMusicXMLOptions ()->fTraceMusicXMLTreeVisitors) {
     fLogOutputStream <<
       "--> Start visiting S_movement_title" <<
       ", line " << inputLineNumber <<
@@ -1904,14 +1905,14 @@ void mxmlTree2MsrSkeletonBuilder::visitStart ( S_creator& elt )
   int inputLineNumber =
     elt->getInputLineNumber ();
     
-  if (gMusicXMLOptions->fTraceMusicXMLTreeVisitors) {
+  if (gMusicXMLOptions ()->fTraceMusicXMLTreeVisitors) {
     fLogOutputStream <<
       "--> Start visiting S_creator" <<
       ", line " << inputLineNumber <<
       endl;
   }
 
-  string creatorType = elt->getAttributeValue ("type");
+  string creatorType = elt->getAttributeValue (attributeNames::type);
   string creatorValue = elt->getValue ();
 
   if      (creatorType == "composer") {
@@ -1957,7 +1958,7 @@ void mxmlTree2MsrSkeletonBuilder::visitStart ( S_creator& elt )
       "\" is unknown";
 
     msrMusicXMLError (
-      gXml2lyOptions->fInputSourceName,
+      gXml2lyOptions ()->fInputSourceName,
       inputLineNumber,
       __FILE__, __LINE__,
       s.str ());
@@ -1970,7 +1971,7 @@ void mxmlTree2MsrSkeletonBuilder::visitStart ( S_rights& elt )
   int inputLineNumber =
     elt->getInputLineNumber ();
     
-  if (gMusicXMLOptions->fTraceMusicXMLTreeVisitors) {
+  if (gMusicXMLOptions ()->fTraceMusicXMLTreeVisitors) {
     fLogOutputStream <<
       "--> Start visiting S_rights" <<
       ", line " << inputLineNumber <<
@@ -1992,7 +1993,7 @@ void mxmlTree2MsrSkeletonBuilder::visitStart ( S_software& elt )
   int inputLineNumber =
     elt->getInputLineNumber ();
     
-  if (gMusicXMLOptions->fTraceMusicXMLTreeVisitors) {
+  if (gMusicXMLOptions ()->fTraceMusicXMLTreeVisitors) {
     fLogOutputStream <<
       "--> Start visiting S_software" <<
       ", line " << inputLineNumber <<
@@ -2012,18 +2013,18 @@ void mxmlTree2MsrSkeletonBuilder::visitStart ( S_software& elt )
 
   if (softwareValueToLower.find ("cubase") != string::npos) {
     msrMusicXMLWarning (
-      gXml2lyOptions->fInputSourceName,
+      gXml2lyOptions ()->fInputSourceName,
       inputLineNumber,
       "<software /> contains 'Cubase'");
 
     // the '-cubase' option is set by default,
     // unless '-noCubase' is explicitly set
     
-    if (! gMusicXMLOptions->fNoCubase) {
+    if (! gMusicXMLOptions ()->fNoCubase) {
       // set the '-cubase' option
       S_optionsElement
         cubaseOptionsElement =
-          gXml2lyOptions->
+          gXml2lyOptions ()->
             getOptionsHandlerUplink ()->
               fetchOptionsElementFromMap ("cubase");
           
@@ -2035,7 +2036,7 @@ void mxmlTree2MsrSkeletonBuilder::visitStart ( S_software& elt )
         ) {
         // handle it at once
 #ifdef TRACE_OPTIONS
-        if (gTraceOptions->fTraceOptions) {
+        if (gTraceOptions ()->fTraceOptions) {
           fLogOutputStream <<
             "Setting '-cubase' option" <<
             endl;
@@ -2046,7 +2047,7 @@ void mxmlTree2MsrSkeletonBuilder::visitStart ( S_software& elt )
           setCombinedItemsVariablesValue (true);
       }
 
-      gMusicXMLOptions->fCubase = true;
+      gMusicXMLOptions ()->fCubase = true;
     }
   }
 
@@ -2061,7 +2062,7 @@ void mxmlTree2MsrSkeletonBuilder::visitStart ( S_encoding_date& elt )
   int inputLineNumber =
     elt->getInputLineNumber ();
     
-  if (gMusicXMLOptions->fTraceMusicXMLTreeVisitors) {
+  if (gMusicXMLOptions ()->fTraceMusicXMLTreeVisitors) {
     fLogOutputStream <<
       "--> Start visiting S_encoding_date" <<
       ", line " << inputLineNumber <<
@@ -2079,7 +2080,7 @@ void mxmlTree2MsrSkeletonBuilder::visitStart ( S_miscellaneous_field& elt )
   int inputLineNumber =
     elt->getInputLineNumber ();
     
-  if (gMusicXMLOptions->fTraceMusicXMLTreeVisitors) {
+  if (gMusicXMLOptions ()->fTraceMusicXMLTreeVisitors) {
     fLogOutputStream <<
       "--> Start visiting S_miscellaneous_field" <<
       ", line " << inputLineNumber <<
@@ -2100,7 +2101,7 @@ void mxmlTree2MsrSkeletonBuilder::visitStart ( S_miscellaneous_field& elt )
 //______________________________________________________________________________
 void mxmlTree2MsrSkeletonBuilder::visitStart ( S_millimeters& elt )
 { 
-  if (gMusicXMLOptions->fTraceMusicXMLTreeVisitors) {
+  if (gMusicXMLOptions ()->fTraceMusicXMLTreeVisitors) {
     fLogOutputStream <<
       "--> Start visiting S_millimeters" <<
       ", line " << elt->getInputLineNumber () <<
@@ -2115,7 +2116,7 @@ void mxmlTree2MsrSkeletonBuilder::visitStart ( S_millimeters& elt )
 
 void mxmlTree2MsrSkeletonBuilder::visitStart ( S_tenths& elt )
 {
-  if (gMusicXMLOptions->fTraceMusicXMLTreeVisitors) {
+  if (gMusicXMLOptions ()->fTraceMusicXMLTreeVisitors) {
     fLogOutputStream <<
       "--> Start visiting S_tenths" <<
       ", line " << elt->getInputLineNumber () <<
@@ -2130,7 +2131,7 @@ void mxmlTree2MsrSkeletonBuilder::visitStart ( S_tenths& elt )
 
 void mxmlTree2MsrSkeletonBuilder::visitEnd ( S_scaling& elt)
 {
-  if (gMusicXMLOptions->fTraceMusicXMLTreeVisitors) {
+  if (gMusicXMLOptions ()->fTraceMusicXMLTreeVisitors) {
     fLogOutputStream <<
       "--> End visiting S_scaling" <<
       ", line " << elt->getInputLineNumber () <<
@@ -2138,7 +2139,7 @@ void mxmlTree2MsrSkeletonBuilder::visitEnd ( S_scaling& elt)
   }
 
 #ifdef TRACE_OPTIONS
-  if (gTraceOptions->fTraceGeometry) {
+  if (gTraceOptions ()->fTraceGeometry) {
     fLogOutputStream <<
       "There are " << fCurrentTenths <<
       " tenths for " <<  fCurrentMillimeters <<
@@ -2152,7 +2153,7 @@ void mxmlTree2MsrSkeletonBuilder::visitEnd ( S_scaling& elt)
 //______________________________________________________________________________
 void mxmlTree2MsrSkeletonBuilder::visitStart ( S_system_margins& elt )
 {
-  if (gMusicXMLOptions->fTraceMusicXMLTreeVisitors) {
+  if (gMusicXMLOptions ()->fTraceMusicXMLTreeVisitors) {
     fLogOutputStream <<
       "--> Start visiting S_system_margins" <<
       ", line " << elt->getInputLineNumber () <<
@@ -2168,7 +2169,7 @@ void mxmlTree2MsrSkeletonBuilder::visitStart ( S_system_margins& elt )
 
 void mxmlTree2MsrSkeletonBuilder::visitStart ( S_system_distance& elt )
 {
-  if (gMusicXMLOptions->fTraceMusicXMLTreeVisitors) {
+  if (gMusicXMLOptions ()->fTraceMusicXMLTreeVisitors) {
     fLogOutputStream <<
       "--> Start visiting S_system_distance" <<
       ", line " << elt->getInputLineNumber () <<
@@ -2184,7 +2185,7 @@ void mxmlTree2MsrSkeletonBuilder::visitStart ( S_system_distance& elt )
 
 void mxmlTree2MsrSkeletonBuilder::visitStart ( S_top_system_distance& elt )
 {
-  if (gMusicXMLOptions->fTraceMusicXMLTreeVisitors) {
+  if (gMusicXMLOptions ()->fTraceMusicXMLTreeVisitors) {
     fLogOutputStream <<
       "--> Start visiting S_top_system_distance" <<
       ", line " << elt->getInputLineNumber () <<
@@ -2200,7 +2201,7 @@ void mxmlTree2MsrSkeletonBuilder::visitStart ( S_top_system_distance& elt )
 
 void mxmlTree2MsrSkeletonBuilder::visitStart ( S_system_dividers& elt )
 {
-  if (gMusicXMLOptions->fTraceMusicXMLTreeVisitors) {
+  if (gMusicXMLOptions ()->fTraceMusicXMLTreeVisitors) {
     fLogOutputStream <<
       "--> Start visiting S_system_dividers" <<
       ", line " << elt->getInputLineNumber () <<
@@ -2217,7 +2218,7 @@ void mxmlTree2MsrSkeletonBuilder::visitStart ( S_system_dividers& elt )
 //______________________________________________________________________________
 void mxmlTree2MsrSkeletonBuilder::visitStart ( S_page_layout& elt )
 {
-  if (gMusicXMLOptions->fTraceMusicXMLTreeVisitors) {
+  if (gMusicXMLOptions ()->fTraceMusicXMLTreeVisitors) {
     fLogOutputStream <<
       "--> Start visiting S_page_layout" <<
       ", line " << elt->getInputLineNumber () <<
@@ -2228,7 +2229,7 @@ void mxmlTree2MsrSkeletonBuilder::visitStart ( S_page_layout& elt )
 }
 void mxmlTree2MsrSkeletonBuilder::visitEnd ( S_page_layout& elt )
 {
-  if (gMusicXMLOptions->fTraceMusicXMLTreeVisitors) {
+  if (gMusicXMLOptions ()->fTraceMusicXMLTreeVisitors) {
     fLogOutputStream <<
       "--> End visiting S_page_layout" <<
       ", line " << elt->getInputLineNumber () <<
@@ -2240,7 +2241,7 @@ void mxmlTree2MsrSkeletonBuilder::visitEnd ( S_page_layout& elt )
 
 void mxmlTree2MsrSkeletonBuilder::visitStart ( S_page_height& elt )
 {
-  if (gMusicXMLOptions->fTraceMusicXMLTreeVisitors) {
+  if (gMusicXMLOptions ()->fTraceMusicXMLTreeVisitors) {
     fLogOutputStream <<
       "--> Start visiting S_page_height" <<
       ", line " << elt->getInputLineNumber () <<
@@ -2258,7 +2259,7 @@ void mxmlTree2MsrSkeletonBuilder::visitStart ( S_page_height& elt )
 
 void mxmlTree2MsrSkeletonBuilder::visitStart ( S_page_width& elt )
 {
-  if (gMusicXMLOptions->fTraceMusicXMLTreeVisitors) {
+  if (gMusicXMLOptions ()->fTraceMusicXMLTreeVisitors) {
     fLogOutputStream <<
       "--> Start visiting S_page_width" <<
       ", line " << elt->getInputLineNumber () <<
@@ -2276,7 +2277,7 @@ void mxmlTree2MsrSkeletonBuilder::visitStart ( S_page_width& elt )
 
 void mxmlTree2MsrSkeletonBuilder::visitStart ( S_left_margin& elt )
 {
-  if (gMusicXMLOptions->fTraceMusicXMLTreeVisitors) {
+  if (gMusicXMLOptions ()->fTraceMusicXMLTreeVisitors) {
     fLogOutputStream <<
       "--> Start visiting S_left_margin" <<
       ", line " << elt->getInputLineNumber () <<
@@ -2294,7 +2295,7 @@ void mxmlTree2MsrSkeletonBuilder::visitStart ( S_left_margin& elt )
 
 void mxmlTree2MsrSkeletonBuilder::visitStart ( S_right_margin& elt )
 {
-  if (gMusicXMLOptions->fTraceMusicXMLTreeVisitors) {
+  if (gMusicXMLOptions ()->fTraceMusicXMLTreeVisitors) {
     fLogOutputStream <<
       "--> Start visiting S_right_margin" <<
        ", line " << elt->getInputLineNumber () <<
@@ -2312,7 +2313,7 @@ void mxmlTree2MsrSkeletonBuilder::visitStart ( S_right_margin& elt )
 
 void mxmlTree2MsrSkeletonBuilder::visitStart ( S_top_margin& elt )
 {
-  if (gMusicXMLOptions->fTraceMusicXMLTreeVisitors) {
+  if (gMusicXMLOptions ()->fTraceMusicXMLTreeVisitors) {
     fLogOutputStream <<
       "--> Start visiting S_top_margin" <<
       ", line " << elt->getInputLineNumber () <<
@@ -2330,7 +2331,7 @@ void mxmlTree2MsrSkeletonBuilder::visitStart ( S_top_margin& elt )
 
 void mxmlTree2MsrSkeletonBuilder::visitStart ( S_bottom_margin& elt )
 {
-  if (gMusicXMLOptions->fTraceMusicXMLTreeVisitors) {
+  if (gMusicXMLOptions ()->fTraceMusicXMLTreeVisitors) {
     fLogOutputStream <<
       "--> Start visiting S_bottom_margin" <<
       ", line " << elt->getInputLineNumber () <<
@@ -2352,7 +2353,7 @@ void mxmlTree2MsrSkeletonBuilder::visitStart ( S_credit& elt )
   int inputLineNumber =
     elt->getInputLineNumber ();
     
-  if (gMusicXMLOptions->fTraceMusicXMLTreeVisitors) {
+  if (gMusicXMLOptions ()->fTraceMusicXMLTreeVisitors) {
     fLogOutputStream <<
       "--> Start visiting S_credit" <<
       ", line " << inputLineNumber <<
@@ -2373,7 +2374,7 @@ void mxmlTree2MsrSkeletonBuilder::visitStart ( S_credit_words& elt )
   int inputLineNumber =
     elt->getInputLineNumber ();
     
-  if (gMusicXMLOptions->fTraceMusicXMLTreeVisitors) {
+  if (gMusicXMLOptions ()->fTraceMusicXMLTreeVisitors) {
     fLogOutputStream <<
       "--> Start visiting S_credit_words" <<
       ", line " << inputLineNumber <<
@@ -2426,7 +2427,7 @@ void mxmlTree2MsrSkeletonBuilder::visitStart ( S_credit_words& elt )
 
 void mxmlTree2MsrSkeletonBuilder::visitEnd ( S_credit& elt )
 {
-  if (gMusicXMLOptions->fTraceMusicXMLTreeVisitors) {
+  if (gMusicXMLOptions ()->fTraceMusicXMLTreeVisitors) {
     fLogOutputStream <<
       "--> End visiting S_credit" <<
       ", line " << elt->getInputLineNumber () <<
@@ -2442,7 +2443,7 @@ void mxmlTree2MsrSkeletonBuilder::visitEnd ( S_credit& elt )
 //________________________________________________________________________
 void mxmlTree2MsrSkeletonBuilder::visitStart (S_part_list& elt)
 {
-  if (gMusicXMLOptions->fTraceMusicXMLTreeVisitors) {
+  if (gMusicXMLOptions ()->fTraceMusicXMLTreeVisitors) {
     fLogOutputStream <<
       "--> Start visiting S_part_list" <<
       ", line " << elt->getInputLineNumber () <<
@@ -2450,14 +2451,14 @@ void mxmlTree2MsrSkeletonBuilder::visitStart (S_part_list& elt)
   }
 
 #ifdef TRACE_OPTIONS
-  if (gTraceOptions->fTraceParts) {
+  if (gTraceOptions ()->fTraceParts) {
     fLogOutputStream <<
       "Analysing part list" <<
       endl;
   }
 #endif
   
-  gIndenter++;
+  gIndenter ()++;
 }
 
 void mxmlTree2MsrSkeletonBuilder::visitEnd (S_part_list& elt)
@@ -2465,14 +2466,14 @@ void mxmlTree2MsrSkeletonBuilder::visitEnd (S_part_list& elt)
   int inputLineNumber =
     elt->getInputLineNumber ();
     
-  if (gMusicXMLOptions->fTraceMusicXMLTreeVisitors) {
+  if (gMusicXMLOptions ()->fTraceMusicXMLTreeVisitors) {
     fLogOutputStream <<
       "--> End visiting S_part_list" <<
       ", line " << inputLineNumber <<
       endl;
   }
 
-  gIndenter--;
+  gIndenter ()--;
 
   // set implicit part group descr end position
   fImplicitPartGroupDescr->
@@ -2490,27 +2491,27 @@ void mxmlTree2MsrSkeletonBuilder::visitEnd (S_part_list& elt)
     inputLineNumber);
 
 #ifdef TRACE_OPTIONS
-  if (gTraceOptions->fTracePartGroups) {
+  if (gTraceOptions ()->fTracePartGroups) {
     showPartGroupsData (
       inputLineNumber,
       "Part groups data gathered for score skeleton");
   }
 #endif
 
-  if (gMsrOptions->fDisplayPartGroups) {
+  if (gMsrOptions ()->fDisplayPartGroups) {
     fLogOutputStream <<
       endl <<
       "The implicit part group contains:" <<
       endl;
 
-    gIndenter++;
+    gIndenter ()++;
     
     fImplicitPartGroup->
       printPartGroupParts (
         inputLineNumber,
         fLogOutputStream);
 
-    gIndenter--;
+    gIndenter ()--;
   }
 }
 
@@ -2520,7 +2521,7 @@ void mxmlTree2MsrSkeletonBuilder::visitStart (S_part_group& elt)
   int inputLineNumber =
     elt->getInputLineNumber ();
     
-  if (gMusicXMLOptions->fTraceMusicXMLTreeVisitors) {
+  if (gMusicXMLOptions ()->fTraceMusicXMLTreeVisitors) {
     fLogOutputStream <<
       "--> Start visiting S_part_group" <<
       ", line " << inputLineNumber <<
@@ -2530,11 +2531,11 @@ void mxmlTree2MsrSkeletonBuilder::visitStart (S_part_group& elt)
   // part group number
   
   fCurrentPartGroupNumber =
-    elt->getAttributeIntValue ("number", 0);
+    elt->getAttributeIntValue (attributeNames::number, 0);
     
   // part group type
   
-  string partGroupType = elt->getAttributeValue ("type");
+  string partGroupType = elt->getAttributeValue (attributeNames::type);
 
   fCurrentPartGroupTypeKind = msrPartGroup::kPartGroupTypeNone;
     
@@ -2551,7 +2552,7 @@ void mxmlTree2MsrSkeletonBuilder::visitStart (S_part_group& elt)
         "\"";
 
     msrMusicXMLError (
-      gXml2lyOptions->fInputSourceName,
+      gXml2lyOptions ()->fInputSourceName,
       inputLineNumber,
       __FILE__, __LINE__,
       s.str ());
@@ -2563,7 +2564,7 @@ void mxmlTree2MsrSkeletonBuilder::visitStart (S_part_group& elt)
   
   // part group print object
 
-  string printObject = elt->getAttributeValue ("print-object"); // JMI
+  string printObject = elt->getAttributeValue (attributeNames::print_object); // JMI
 
   // handle part group type
   switch (fCurrentPartGroupTypeKind) {
@@ -2589,7 +2590,7 @@ void mxmlTree2MsrSkeletonBuilder::visitStart (S_part_group& elt)
 
 void mxmlTree2MsrSkeletonBuilder::visitStart (S_group_name& elt)
 {
-  if (gMusicXMLOptions->fTraceMusicXMLTreeVisitors) {
+  if (gMusicXMLOptions ()->fTraceMusicXMLTreeVisitors) {
     fLogOutputStream <<
       "--> Start visiting S_group_name" <<
       ", line " << elt->getInputLineNumber () <<
@@ -2601,7 +2602,7 @@ void mxmlTree2MsrSkeletonBuilder::visitStart (S_group_name& elt)
 
 void mxmlTree2MsrSkeletonBuilder::visitStart (S_group_name_display& elt)
 {
-  if (gMusicXMLOptions->fTraceMusicXMLTreeVisitors) {
+  if (gMusicXMLOptions ()->fTraceMusicXMLTreeVisitors) {
     fLogOutputStream <<
       "--> Start visiting S_group_name_display" <<
       ", line " << elt->getInputLineNumber () <<
@@ -2613,7 +2614,7 @@ void mxmlTree2MsrSkeletonBuilder::visitStart (S_group_name_display& elt)
 
 void mxmlTree2MsrSkeletonBuilder::visitEnd (S_group_name_display& elt)
 {
-  if (gMusicXMLOptions->fTraceMusicXMLTreeVisitors) {
+  if (gMusicXMLOptions ()->fTraceMusicXMLTreeVisitors) {
     fLogOutputStream <<
       "--> End visiting S_group_name_display" <<
       ", line " << elt->getInputLineNumber () <<
@@ -2628,7 +2629,7 @@ void mxmlTree2MsrSkeletonBuilder::visitStart (S_display_text& elt)
   int inputLineNumber =
     elt->getInputLineNumber ();
     
-  if (gMusicXMLOptions->fTraceMusicXMLTreeVisitors) {
+  if (gMusicXMLOptions ()->fTraceMusicXMLTreeVisitors) {
     fLogOutputStream <<
       "--> Start visiting S_display_text" <<
       ", line " << inputLineNumber <<
@@ -2649,7 +2650,7 @@ void mxmlTree2MsrSkeletonBuilder::visitStart (S_display_text& elt)
   }
   else {
     msrMusicXMLError (
-      gXml2lyOptions->fInputSourceName,
+      gXml2lyOptions ()->fInputSourceName,
       inputLineNumber,
       __FILE__, __LINE__,
       "<display-text /> is out of context");
@@ -2658,7 +2659,7 @@ void mxmlTree2MsrSkeletonBuilder::visitStart (S_display_text& elt)
 
 void mxmlTree2MsrSkeletonBuilder::visitStart (S_accidental_text& elt)
 {
-  if (gMusicXMLOptions->fTraceMusicXMLTreeVisitors) {
+  if (gMusicXMLOptions ()->fTraceMusicXMLTreeVisitors) {
     fLogOutputStream <<
       "--> Start visiting S_accidental_text" <<
       ", line " << elt->getInputLineNumber () <<
@@ -2670,7 +2671,7 @@ void mxmlTree2MsrSkeletonBuilder::visitStart (S_accidental_text& elt)
 
 void mxmlTree2MsrSkeletonBuilder::visitStart (S_group_abbreviation& elt)
 {
-  if (gMusicXMLOptions->fTraceMusicXMLTreeVisitors) {
+  if (gMusicXMLOptions ()->fTraceMusicXMLTreeVisitors) {
     fLogOutputStream <<
       "--> Start visiting S_group_abbreviation" <<
       ", line " << elt->getInputLineNumber () <<
@@ -2685,7 +2686,7 @@ void mxmlTree2MsrSkeletonBuilder::visitStart (S_group_symbol& elt)
   int inputLineNumber =
     elt->getInputLineNumber ();
     
-  if (gMusicXMLOptions->fTraceMusicXMLTreeVisitors) {
+  if (gMusicXMLOptions ()->fTraceMusicXMLTreeVisitors) {
     fLogOutputStream <<
       "--> Start visiting S_group_symbol" <<
       ", line " << inputLineNumber <<
@@ -2721,7 +2722,7 @@ void mxmlTree2MsrSkeletonBuilder::visitStart (S_group_symbol& elt)
         "unknown part group symbol \"" + groupSymbol + "\"";
         
       msrMusicXMLError (
-        gXml2lyOptions->fInputSourceName,
+        gXml2lyOptions ()->fInputSourceName,
         inputLineNumber,
         __FILE__, __LINE__,
         s.str ());
@@ -2729,7 +2730,7 @@ void mxmlTree2MsrSkeletonBuilder::visitStart (S_group_symbol& elt)
   }
 
   fCurrentPartGroupSymbolDefaultX =
-    elt->getAttributeIntValue ("default-x", 0);
+    elt->getAttributeIntValue (attributeNames::default_x, 0);
 }
 
 void mxmlTree2MsrSkeletonBuilder::visitStart ( S_group_barline& elt)
@@ -2737,7 +2738,7 @@ void mxmlTree2MsrSkeletonBuilder::visitStart ( S_group_barline& elt)
   int inputLineNumber =
     elt->getInputLineNumber ();
     
-  if (gMusicXMLOptions->fTraceMusicXMLTreeVisitors) {
+  if (gMusicXMLOptions ()->fTraceMusicXMLTreeVisitors) {
     fLogOutputStream <<
       "--> Start visiting S_group_barline" <<
       ", line " << inputLineNumber <<
@@ -2758,7 +2759,7 @@ void mxmlTree2MsrSkeletonBuilder::visitStart ( S_group_barline& elt)
       "unknown part group barline \"" + groupBarline + "\"";
       
     msrMusicXMLError (
-      gXml2lyOptions->fInputSourceName,
+      gXml2lyOptions ()->fInputSourceName,
       inputLineNumber,
       __FILE__, __LINE__,
       s.str ());
@@ -2771,7 +2772,7 @@ void mxmlTree2MsrSkeletonBuilder::visitEnd (S_part_group& elt)
   int inputLineNumber =
     elt->getInputLineNumber ();
     
-  if (gMusicXMLOptions->fTraceMusicXMLTreeVisitors) {
+  if (gMusicXMLOptions ()->fTraceMusicXMLTreeVisitors) {
     fLogOutputStream <<
       "--> End visiting S_part_group" <<
       ", line " << inputLineNumber <<
@@ -2779,7 +2780,7 @@ void mxmlTree2MsrSkeletonBuilder::visitEnd (S_part_group& elt)
   }
 
 #ifdef TRACE_OPTIONS
-  if (gTraceOptions->fTracePartGroups) {
+  if (gTraceOptions ()->fTracePartGroups) {
     fLogOutputStream <<
       "Handling part group '" <<
       fCurrentPartGroupNumber <<
@@ -2792,7 +2793,7 @@ void mxmlTree2MsrSkeletonBuilder::visitEnd (S_part_group& elt)
   }
 #endif
 
-  gIndenter++;
+  gIndenter ()++;
   
   // handle part group type
   switch (fCurrentPartGroupTypeKind) {
@@ -2814,7 +2815,7 @@ void mxmlTree2MsrSkeletonBuilder::visitEnd (S_part_group& elt)
       break;
   } // switch
 
-  gIndenter--;
+  gIndenter ()--;
 }
 
 //________________________________________________________________________
@@ -2823,17 +2824,17 @@ void mxmlTree2MsrSkeletonBuilder::visitStart (S_score_part& elt)
   int inputLineNumber =
     elt->getInputLineNumber ();
     
-  if (gMusicXMLOptions->fTraceMusicXMLTreeVisitors) {
+  if (gMusicXMLOptions ()->fTraceMusicXMLTreeVisitors) {
     fLogOutputStream <<
       "--> Start visiting S_score_part" <<
       ", line " << inputLineNumber <<
       endl;
   }
 
-  fCurrentPartID = elt->getAttributeValue ("id");
+  fCurrentPartID = elt->getAttributeValue (attributeNames::id);
 
 #ifdef TRACE_OPTIONS
-  if (gTraceOptions->fTraceParts) {
+  if (gTraceOptions ()->fTraceParts) {
     fLogOutputStream <<
       "Found part name \"" << fCurrentPartID << "\"" <<
       " in part list" <<
@@ -2863,7 +2864,7 @@ void mxmlTree2MsrSkeletonBuilder::visitStart (S_score_part& elt)
       ", line " << inputLineNumber;
       
     msrMusicXMLWarning (
-      gXml2lyOptions->fInputSourceName,
+      gXml2lyOptions ()->fInputSourceName,
       inputLineNumber,
       s.str ());
   }    
@@ -2882,7 +2883,7 @@ void mxmlTree2MsrSkeletonBuilder::visitStart (S_score_part& elt)
 //________________________________________________________________________
 void mxmlTree2MsrSkeletonBuilder::visitStart (S_part_name& elt)
 {
-  if (gMusicXMLOptions->fTraceMusicXMLTreeVisitors) {
+  if (gMusicXMLOptions ()->fTraceMusicXMLTreeVisitors) {
     fLogOutputStream <<
       "--> Start visiting S_part_name" <<
       ", line " << elt->getInputLineNumber () <<
@@ -2895,14 +2896,14 @@ void mxmlTree2MsrSkeletonBuilder::visitStart (S_part_name& elt)
   if (printStyle == "JMI") {
   }
   
-  string printObject = elt->getAttributeValue ("print-object"); // JMI
+  string printObject = elt->getAttributeValue (attributeNames::print_object); // JMI
   if (printObject == "JMI") {
   }
 }
 
 void mxmlTree2MsrSkeletonBuilder::visitStart (S_part_name_display& elt)
 {
-  if (gMusicXMLOptions->fTraceMusicXMLTreeVisitors) {
+  if (gMusicXMLOptions ()->fTraceMusicXMLTreeVisitors) {
     fLogOutputStream <<
       "--> Start visiting S_part_name_display" <<
       ", line " << elt->getInputLineNumber () <<
@@ -2914,7 +2915,7 @@ void mxmlTree2MsrSkeletonBuilder::visitStart (S_part_name_display& elt)
 
 void mxmlTree2MsrSkeletonBuilder::visitEnd (S_part_name_display& elt)
 {
-  if (gMusicXMLOptions->fTraceMusicXMLTreeVisitors) {
+  if (gMusicXMLOptions ()->fTraceMusicXMLTreeVisitors) {
     fLogOutputStream <<
       "--> End visiting S_part_name_display" <<
       ", line " << elt->getInputLineNumber () <<
@@ -2926,7 +2927,7 @@ void mxmlTree2MsrSkeletonBuilder::visitEnd (S_part_name_display& elt)
 
 void mxmlTree2MsrSkeletonBuilder::visitStart (S_part_abbreviation& elt)
 {
-  if (gMusicXMLOptions->fTraceMusicXMLTreeVisitors) {
+  if (gMusicXMLOptions ()->fTraceMusicXMLTreeVisitors) {
     fLogOutputStream <<
       "--> Start visiting S_part_abbreviation" <<
       ", line " << elt->getInputLineNumber () <<
@@ -2938,7 +2939,7 @@ void mxmlTree2MsrSkeletonBuilder::visitStart (S_part_abbreviation& elt)
 
 void mxmlTree2MsrSkeletonBuilder::visitStart (S_part_abbreviation_display& elt)
 {
-  if (gMusicXMLOptions->fTraceMusicXMLTreeVisitors) {
+  if (gMusicXMLOptions ()->fTraceMusicXMLTreeVisitors) {
     fLogOutputStream <<
       "--> Start visiting S_part_abbreviation_display" <<
       ", line " << elt->getInputLineNumber () <<
@@ -2950,7 +2951,7 @@ void mxmlTree2MsrSkeletonBuilder::visitStart (S_part_abbreviation_display& elt)
 
 void mxmlTree2MsrSkeletonBuilder::visitEnd (S_part_abbreviation_display& elt)
 {
-  if (gMusicXMLOptions->fTraceMusicXMLTreeVisitors) {
+  if (gMusicXMLOptions ()->fTraceMusicXMLTreeVisitors) {
     fLogOutputStream <<
       "--> End visiting S_part_abbreviation_display" <<
       ", line " << elt->getInputLineNumber () <<
@@ -2962,7 +2963,7 @@ void mxmlTree2MsrSkeletonBuilder::visitEnd (S_part_abbreviation_display& elt)
 
 void mxmlTree2MsrSkeletonBuilder::visitStart (S_instrument_name& elt)
 {
-  if (gMusicXMLOptions->fTraceMusicXMLTreeVisitors) {
+  if (gMusicXMLOptions ()->fTraceMusicXMLTreeVisitors) {
     fLogOutputStream <<
       "--> Start visiting S_instrument_name" <<
       ", line " << elt->getInputLineNumber () <<
@@ -2974,7 +2975,7 @@ void mxmlTree2MsrSkeletonBuilder::visitStart (S_instrument_name& elt)
 
 void mxmlTree2MsrSkeletonBuilder::visitStart (S_instrument_abbreviation& elt)
 {
-  if (gMusicXMLOptions->fTraceMusicXMLTreeVisitors) {
+  if (gMusicXMLOptions ()->fTraceMusicXMLTreeVisitors) {
     fLogOutputStream <<
       "--> Start visiting S_instrument_abbreviation" <<
       ", line " << elt->getInputLineNumber () <<
@@ -2989,7 +2990,7 @@ void mxmlTree2MsrSkeletonBuilder::visitEnd (S_score_part& elt)
   int inputLineNumber =
     elt->getInputLineNumber ();
     
-  if (gMusicXMLOptions->fTraceMusicXMLTreeVisitors) {
+  if (gMusicXMLOptions ()->fTraceMusicXMLTreeVisitors) {
     fLogOutputStream <<
       "--> End visiting S_score_part" <<
       ", line " << inputLineNumber <<
@@ -2998,10 +2999,10 @@ void mxmlTree2MsrSkeletonBuilder::visitEnd (S_score_part& elt)
 
   fCurrentPartsPosition++;
 
-  string partID = elt->getAttributeValue ("id");
+  string partID = elt->getAttributeValue (attributeNames::id);
 
 #ifdef TRACE_OPTIONS
-  if (gTraceOptions->fTraceParts) {
+  if (gTraceOptions ()->fTraceParts) {
    fLogOutputStream <<
     "--------------------------------------------" <<
     endl <<
@@ -3012,11 +3013,11 @@ void mxmlTree2MsrSkeletonBuilder::visitEnd (S_score_part& elt)
   }
 #endif
 
-  gIndenter++;
+  gIndenter ()++;
 
   // create the part
 #ifdef TRACE_OPTIONS
-  if (gTraceOptions->fTraceParts) {
+  if (gTraceOptions ()->fTraceParts) {
    fLogOutputStream <<
     "--------------------------------------------" <<
     endl <<
@@ -3062,14 +3063,14 @@ void mxmlTree2MsrSkeletonBuilder::visitEnd (S_score_part& elt)
     part);
 
 #ifdef TRACE_OPTIONS
-  if (gTraceOptions->fTracePartGroupsDetails) {
+  if (gTraceOptions ()->fTracePartGroupsDetails) {
     showPartGroupsData (
       inputLineNumber,
       "AFTER handling score part \"" + partID + "\"");
   }
 #endif
   
-  gIndenter--;
+  gIndenter ()--;
 }
 
 //________________________________________________________________________
@@ -3079,7 +3080,7 @@ void mxmlTree2MsrSkeletonBuilder::registerPart (
   S_msrPart part)
 {
 #ifdef TRACE_OPTIONS
-  if (gTraceOptions->fTracePartGroups) {
+  if (gTraceOptions ()->fTracePartGroups) {
     fLogOutputStream <<
       "Resitering part " <<
       part->getPartCombinedName () <<
@@ -3111,7 +3112,7 @@ void mxmlTree2MsrSkeletonBuilder::visitStart (S_part& elt)
   int inputLineNumber =
     elt->getInputLineNumber ();
     
-  if (gMusicXMLOptions->fTraceMusicXMLTreeVisitors) {
+  if (gMusicXMLOptions ()->fTraceMusicXMLTreeVisitors) {
     fLogOutputStream <<
       "--> Start visiting S_part" <<
       ", line " << inputLineNumber <<
@@ -3119,10 +3120,10 @@ void mxmlTree2MsrSkeletonBuilder::visitStart (S_part& elt)
   }
 
   // fCurrentPartID is used throughout
-  fCurrentPartID = elt->getAttributeValue ("id");
+  fCurrentPartID = elt->getAttributeValue (attributeNames::id);
 
 #ifdef TRACE_OPTIONS
-  if (gTraceOptions->fTraceParts || gTraceOptions->fTracePasses) {
+  if (gTraceOptions ()->fTraceParts || gTraceOptions ()->fTracePasses) {
     fLogOutputStream <<
       endl <<
       "<!--=== part \"" << fCurrentPartID << "\"" <<
@@ -3147,7 +3148,7 @@ void mxmlTree2MsrSkeletonBuilder::visitStart (S_part& elt)
         "' since it is the only part in the <part-list />";
 
       msrMusicXMLWarning (
-        gXml2lyOptions->fInputSourceName,
+        gXml2lyOptions ()->fInputSourceName,
         inputLineNumber,
         s.str ());
     }
@@ -3163,7 +3164,7 @@ void mxmlTree2MsrSkeletonBuilder::visitStart (S_part& elt)
       s >> fCurrentPartID;
   
       msrMusicXMLWarning (
-        gXml2lyOptions->fInputSourceName,
+        gXml2lyOptions ()->fInputSourceName,
         inputLineNumber,
         "part 'id' is empty, creating one as '" + fCurrentPartID + "'");
     }
@@ -3184,14 +3185,14 @@ void mxmlTree2MsrSkeletonBuilder::visitStart (S_part& elt)
       "\" is not known in the <part-list />";
     
     msrMusicXMLError (
-      gXml2lyOptions->fInputSourceName,
+      gXml2lyOptions ()->fInputSourceName,
       inputLineNumber,
       __FILE__, __LINE__,
       s.str ());
   }
 
 #ifdef TRACE_OPTIONS
-  if (gTraceOptions->fTraceParts) {
+  if (gTraceOptions ()->fTraceParts) {
     fLogOutputStream <<
       endl <<
       endl <<
@@ -3202,7 +3203,7 @@ void mxmlTree2MsrSkeletonBuilder::visitStart (S_part& elt)
   }
 #endif
 
-  gIndenter++;
+  gIndenter ()++;
 
   // measures
   fPartNumberOfMeasures = 0;
@@ -3217,17 +3218,17 @@ void mxmlTree2MsrSkeletonBuilder::visitEnd (S_part& elt)
   int inputLineNumber =
     elt->getInputLineNumber ();
     
-  if (gMusicXMLOptions->fTraceMusicXMLTreeVisitors) {
+  if (gMusicXMLOptions ()->fTraceMusicXMLTreeVisitors) {
     fLogOutputStream <<
       "--> End visiting S_part" <<
       ", line " << inputLineNumber <<
       endl;
   }
 
-  gIndenter--;
+  gIndenter ()--;
 
 #ifdef TRACE_OPTIONS
-  if (gTraceOptions->fTraceParts) {
+  if (gTraceOptions ()->fTraceParts) {
     fLogOutputStream <<
       "Analyzing part \"" << fCurrentPartID << "\" -- end" <<
       endl <<
@@ -3253,7 +3254,7 @@ void mxmlTree2MsrSkeletonBuilder::visitEnd (S_part& elt)
         " while the other ones have " << fScoreNumberOfMeasures;
         
       msrMusicXMLError (
-        gXml2lyOptions->fInputSourceName,
+        gXml2lyOptions ()->fInputSourceName,
         inputLineNumber,
       __FILE__, __LINE__,
         s.str ());
@@ -3277,7 +3278,7 @@ void mxmlTree2MsrSkeletonBuilder::visitStart (S_staves& elt)
   int inputLineNumber =
     elt->getInputLineNumber ();
     
-  if (gMusicXMLOptions->fTraceMusicXMLTreeVisitors) {
+  if (gMusicXMLOptions ()->fTraceMusicXMLTreeVisitors) {
     fLogOutputStream <<
       "--> Start visiting S_direction" <<
       ", line " << inputLineNumber <<
@@ -3287,7 +3288,7 @@ void mxmlTree2MsrSkeletonBuilder::visitStart (S_staves& elt)
   int stavesNumber = int(*elt);
 
 #ifdef TRACE_OPTIONS
-  if (gTraceOptions->fTraceStaves) {
+  if (gTraceOptions ()->fTraceStaves) {
     switch (stavesNumber) {
       case 0:
         fLogOutputStream <<
@@ -3331,7 +3332,7 @@ void mxmlTree2MsrSkeletonBuilder::visitStart (S_staff& elt)
   int inputLineNumber =
     elt->getInputLineNumber ();
     
-  if (gMusicXMLOptions->fTraceMusicXMLTreeVisitors) {
+  if (gMusicXMLOptions ()->fTraceMusicXMLTreeVisitors) {
     fLogOutputStream <<
       "--> Start visiting S_staff" <<
       ", line " << inputLineNumber <<
@@ -3363,7 +3364,7 @@ void mxmlTree2MsrSkeletonBuilder::visitStart (S_staff& elt)
 //________________________________________________________________________
 void mxmlTree2MsrSkeletonBuilder::visitStart (S_voice& elt )
 {
-  if (gMusicXMLOptions->fTraceMusicXMLTreeVisitors) {
+  if (gMusicXMLOptions ()->fTraceMusicXMLTreeVisitors) {
     fLogOutputStream <<
       "--> Start visiting S_staff_details" <<
       ", line " << elt->getInputLineNumber () <<
@@ -3390,7 +3391,7 @@ void mxmlTree2MsrSkeletonBuilder::visitStart (S_measure& elt)
   int inputLineNumber =
     elt->getInputLineNumber ();
     
-  if (gMusicXMLOptions->fTraceMusicXMLTreeVisitors) {
+  if (gMusicXMLOptions ()->fTraceMusicXMLTreeVisitors) {
     fLogOutputStream <<
       "--> Start visiting S_measure" <<
       ", line " << inputLineNumber <<
@@ -3403,10 +3404,10 @@ void mxmlTree2MsrSkeletonBuilder::visitStart (S_measure& elt)
 */
 
   fCurrentMeasureNumber = // JMI local variable???
-    elt->getAttributeValue ("number");
+    elt->getAttributeValue (attributeNames::number);
 
 #ifdef TRACE_OPTIONS
-  if (gTraceOptions->fTraceMeasures || gTraceOptions->fTracePasses) {
+  if (gTraceOptions ()->fTraceMeasures || gTraceOptions ()->fTracePasses) {
     fLogOutputStream <<
       endl <<
       "<!--=== measure " << fCurrentMeasureNumber <<
@@ -3421,7 +3422,7 @@ void mxmlTree2MsrSkeletonBuilder::visitStart (S_measure& elt)
 
 void mxmlTree2MsrSkeletonBuilder::visitEnd (S_measure& elt)
 {
-  if (gMusicXMLOptions->fTraceMusicXMLTreeVisitors) {
+  if (gMusicXMLOptions ()->fTraceMusicXMLTreeVisitors) {
     fLogOutputStream <<
       "--> End visiting S_measure" <<
       ", line " << elt->getInputLineNumber () <<
@@ -3432,7 +3433,7 @@ void mxmlTree2MsrSkeletonBuilder::visitEnd (S_measure& elt)
 //______________________________________________________________________________
 void mxmlTree2MsrSkeletonBuilder::visitStart ( S_note& elt ) 
 {
-  if (gMusicXMLOptions->fTraceMusicXMLTreeVisitors) {
+  if (gMusicXMLOptions ()->fTraceMusicXMLTreeVisitors) {
     fLogOutputStream <<
       "--> Start visiting S_note" <<
       ", line " << elt->getInputLineNumber () <<
@@ -3457,7 +3458,7 @@ void mxmlTree2MsrSkeletonBuilder::visitEnd ( S_note& elt )
   int inputLineNumber =
     elt->getInputLineNumber ();
     
-  if (gMusicXMLOptions->fTraceMusicXMLTreeVisitors) {
+  if (gMusicXMLOptions ()->fTraceMusicXMLTreeVisitors) {
     fLogOutputStream <<
       "--> End visiting S_note" <<
       ", line " << inputLineNumber <<
@@ -3481,11 +3482,11 @@ void mxmlTree2MsrSkeletonBuilder::visitEnd ( S_note& elt )
   
 #ifdef TRACE_OPTIONS
   if (
-    gTraceOptions->fTraceNotes
+    gTraceOptions ()->fTraceNotes
       ||
-    gTraceOptions->fTraceStaves
+    gTraceOptions ()->fTraceStaves
       ||
-    gTraceOptions->fTraceVoices
+    gTraceOptions ()->fTraceVoices
     ) {
     fLogOutputStream <<
       "--> S_note, fCurrentStaffMusicXMLNumber = " <<
@@ -3524,7 +3525,7 @@ void mxmlTree2MsrSkeletonBuilder::visitStart (S_lyric& elt )
   int inputLineNumber =
     elt->getInputLineNumber ();
     
-  if (gMusicXMLOptions->fTraceMusicXMLTreeVisitors) {
+  if (gMusicXMLOptions ()->fTraceMusicXMLTreeVisitors) {
     fLogOutputStream <<
       "--> Start visiting S_lyric" <<
       ", line " << inputLineNumber <<
@@ -3535,11 +3536,11 @@ void mxmlTree2MsrSkeletonBuilder::visitStart (S_lyric& elt )
 
   {
     fCurrentStanzaNumber =
-      elt->getAttributeValue ("number");
+      elt->getAttributeValue (attributeNames::number);
     
     if (fCurrentStanzaNumber.size () == 0) {
       msrMusicXMLWarning (
-        gXml2lyOptions->fInputSourceName,
+        gXml2lyOptions ()->fInputSourceName,
         inputLineNumber,
         "lyric number is empty, using \"1\" by default");
 
@@ -3548,7 +3549,7 @@ void mxmlTree2MsrSkeletonBuilder::visitStart (S_lyric& elt )
     
     else {
 #ifdef TRACE_OPTIONS
-      if (gTraceOptions->fTraceLyrics) {
+      if (gTraceOptions ()->fTraceLyrics) {
         fLogOutputStream <<
           "--> setting fCurrentStanzaNumber to " <<
           fCurrentStanzaNumber <<
@@ -3572,7 +3573,7 @@ void mxmlTree2MsrSkeletonBuilder::visitStart (S_lyric& elt )
     
     if (fCurrentStanzaName.size () == 0) {
 #ifdef TRACE_OPTIONS
-      if (gTraceOptions->fTraceLyrics) {
+      if (gTraceOptions ()->fTraceLyrics) {
         // lyrics names are not so frequent after all...
         stringstream s;
 
@@ -3582,7 +3583,7 @@ void mxmlTree2MsrSkeletonBuilder::visitStart (S_lyric& elt )
           "\" by default";
 
         msrMusicXMLWarning (
-          gXml2lyOptions->fInputSourceName,
+          gXml2lyOptions ()->fInputSourceName,
           inputLineNumber,
           s.str ());
 
@@ -3593,7 +3594,7 @@ void mxmlTree2MsrSkeletonBuilder::visitStart (S_lyric& elt )
     
     else {
 #ifdef TRACE_OPTIONS
-      if (gTraceOptions->fTraceLyrics) {
+      if (gTraceOptions ()->fTraceLyrics) {
         fLogOutputStream <<
           "--> setting fCurrentStanzaName to " <<
           fCurrentStanzaName <<
@@ -3615,7 +3616,7 @@ void mxmlTree2MsrSkeletonBuilder::visitEnd ( S_lyric& elt )
   int inputLineNumber =
     elt->getInputLineNumber ();
     
-  if (gMusicXMLOptions->fTraceMusicXMLTreeVisitors) {
+  if (gMusicXMLOptions ()->fTraceMusicXMLTreeVisitors) {
     fLogOutputStream <<
       "--> End visiting S_lyric" <<
       ", line " << inputLineNumber <<
@@ -3623,7 +3624,7 @@ void mxmlTree2MsrSkeletonBuilder::visitEnd ( S_lyric& elt )
   }
 
 #ifdef TRACE_OPTIONS
-  if (gTraceOptions->fTraceLyrics) {
+  if (gTraceOptions ()->fTraceLyrics) {
     fLogOutputStream <<
       endl <<
       "visitEnd ( S_lyric& )" <<
@@ -3631,14 +3632,14 @@ void mxmlTree2MsrSkeletonBuilder::visitEnd ( S_lyric& elt )
       ", with:" <<
       endl;
 
-    gIndenter++;
+    gIndenter ()++;
 
     fLogOutputStream <<
       "Lyric data:" <<
       endl;
 
     {
-      gIndenter++;
+      gIndenter ()++;
 
       const int fieldwidth = 28;
   
@@ -3647,10 +3648,10 @@ void mxmlTree2MsrSkeletonBuilder::visitEnd ( S_lyric& elt )
         "fCurrentStanzaNumber" << " = " << fCurrentStanzaNumber <<
         endl;
           
-      gIndenter--;
+      gIndenter ()--;
     }
     
-    gIndenter--;
+    gIndenter ()--;
   }
 #endif
 
@@ -3675,7 +3676,7 @@ void mxmlTree2MsrSkeletonBuilder::visitEnd ( S_lyric& elt )
 //______________________________________________________________________________
 void mxmlTree2MsrSkeletonBuilder::visitStart ( S_harmony& elt )
 {
-  if (gMusicXMLOptions->fTraceMusicXMLTreeVisitors) {
+  if (gMusicXMLOptions ()->fTraceMusicXMLTreeVisitors) {
     fLogOutputStream <<
       "--> Start visiting S_harmony" <<
       ", fHarmonyVoicesCounter = " << fHarmonyVoicesCounter <<
@@ -3700,7 +3701,7 @@ void mxmlTree2MsrSkeletonBuilder::visitStart ( S_figured_bass& elt )
   int inputLineNumber =
     elt->getInputLineNumber ();
     
-  if (gMusicXMLOptions->fTraceMusicXMLTreeVisitors) {
+  if (gMusicXMLOptions ()->fTraceMusicXMLTreeVisitors) {
     fLogOutputStream <<
       "--> Start visiting S_figured_bass" <<
       ", line " << inputLineNumber <<
@@ -24,6 +24,7 @@
 #include "conversions.h"
 
 #include "utilities.h"
+#include "profiling.h"
 
 #include "msr.h"
 
@@ -346,7 +347,7 @@ void mxmlTree2MsrTranslator::browseMxmlTree (
 {  
   if (mxmlTree) {
     // create a tree browser on this visitor
-    tree_browser<xmlelement> browser (this);
+    mxmlTreeBrowser browser (this);
     
     // browse the xmlelement tree
     browser.browse (*mxmlTree);
@@ -461,7 +462,7 @@ void mxmlTree2MsrTranslator::printVoicesLastMetNoteMap (
     endl;
    
   if (voicesLastMetNoteMapSize) {
-    gIndenter++;
+    gIndenter ()++;
     
 //    map<S_msrVoice, S_msrNote>::const_iterator
     map<pair<int, int>, S_msrNote>::const_iterator
@@ -476,13 +477,13 @@ void mxmlTree2MsrTranslator::printVoicesLastMetNoteMap (
         ":" <<
         endl;
 
-      gIndenter++;
+      gIndenter ()++;
       
       fLogOutputStream <<
         (*i).second <<
         endl;
         
-      gIndenter--;
+      gIndenter ()--;
 
       if (++i == iEnd) break;
       
@@ -490,7 +491,7 @@ void mxmlTree2MsrTranslator::printVoicesLastMetNoteMap (
         endl;
     } // for
 
-    gIndenter--;
+    gIndenter ()--;
   }
 }
 
@@ -510,7 +511,7 @@ void mxmlTree2MsrTranslator::checkStep (
         " is not a letter from A to G";
           
       msrMusicXMLError (
-        gXml2lyOptions->fInputSourceName,
+        gXml2lyOptions ()->fInputSourceName,
         inputLineNumber,
         __FILE__, __LINE__,
         s.str ());
@@ -525,7 +526,7 @@ void mxmlTree2MsrTranslator::checkStep (
       " should be a single letter from A to G";
       
       msrMusicXMLError (
-        gXml2lyOptions->fInputSourceName,
+        gXml2lyOptions ()->fInputSourceName,
         inputLineNumber,
         __FILE__, __LINE__,
       s.str ());
@@ -553,14 +554,14 @@ S_msrStaff mxmlTree2MsrTranslator::fetchStaffFromCurrentPart (
       fCurrentPart->getPartCombinedName ();
 
     msrInternalError (
-      gXml2lyOptions->fInputSourceName,
+      gXml2lyOptions ()->fInputSourceName,
       inputLineNumber,
       __FILE__, __LINE__,
       s.str ());
   }
     
 #ifdef TRACE_OPTIONS
-  if (gTraceOptions->fTraceStaves) {
+  if (gTraceOptions ()->fTraceStaves) {
     fLogOutputStream <<
       "--> fetchStaffFromCurrentPart returns " <<
       staff->getStaffName () <<
@@ -606,7 +607,7 @@ S_msrVoice mxmlTree2MsrTranslator::fetchVoiceFromPart (
       "\"";
 
     msrInternalError (
-      gXml2lyOptions->fInputSourceName,
+      gXml2lyOptions ()->fInputSourceName,
       inputLineNumber,
       __FILE__, __LINE__,
       s.str ());
@@ -619,7 +620,7 @@ S_msrVoice mxmlTree2MsrTranslator::fetchVoiceFromPart (
     */
 
 #ifdef TRACE_OPTIONS
-  if (gTraceOptions->fTraceVoices) {
+  if (gTraceOptions ()->fTraceVoices) {
     fLogOutputStream <<
       "--> fetchVoiceFromPart() returns " <<
       voice->getVoiceName () <<
@@ -636,17 +637,17 @@ void mxmlTree2MsrTranslator::visitStart (S_part& elt)
   int inputLineNumber =
     elt->getInputLineNumber ();
 
-  if (gMusicXMLOptions->fTraceMusicXMLTreeVisitors) {
+  if (gMusicXMLOptions ()->fTraceMusicXMLTreeVisitors) {
     fLogOutputStream <<
       "--> Start visiting S_part" <<
       ", line " << inputLineNumber <<
       endl;
   }
 
-  string partID = elt->getAttributeValue ("id");
+  string partID = elt->getAttributeValue (attributeNames::id);
 
 #ifdef TRACE_OPTIONS
-  if (gTraceOptions->fTraceParts || gTraceOptions->fTracePasses) {
+  if (gTraceOptions ()->fTraceParts || gTraceOptions ()->fTracePasses) {
     fLogOutputStream <<
       endl <<
       "<!--=== part \"" << partID << "\"" <<
@@ -690,7 +691,7 @@ void mxmlTree2MsrTranslator::visitStart (S_part& elt)
         "' since it is the only part in the <part-list />";
 
       msrMusicXMLWarning (
-        gXml2lyOptions->fInputSourceName,
+        gXml2lyOptions ()->fInputSourceName,
         inputLineNumber,
         s.str ());
     }
@@ -703,7 +704,7 @@ void mxmlTree2MsrTranslator::visitStart (S_part& elt)
         "\" not found in score skeleton";
   
       msrInternalError (
-        gXml2lyOptions->fInputSourceName,
+        gXml2lyOptions ()->fInputSourceName,
         inputLineNumber,
         __FILE__, __LINE__,
         s.str ());
@@ -711,7 +712,7 @@ void mxmlTree2MsrTranslator::visitStart (S_part& elt)
   }
     
 #ifdef TRACE_OPTIONS
-  if (gTraceOptions->fTraceParts) {
+  if (gTraceOptions ()->fTraceParts) {
     fLogOutputStream <<
       "--------------------------------------------" <<
       endl <<
@@ -754,7 +755,7 @@ void mxmlTree2MsrTranslator::visitStart (S_part& elt)
   fOnGoingRepeat = false;
   fOnGoingRepeatHasBeenCreated = false;
 
-  gIndenter++;
+  gIndenter ()++;
 }
 
 void mxmlTree2MsrTranslator::visitEnd (S_part& elt)
@@ -762,17 +763,17 @@ void mxmlTree2MsrTranslator::visitEnd (S_part& elt)
   int inputLineNumber =
     elt->getInputLineNumber ();
 
-  if (gMusicXMLOptions->fTraceMusicXMLTreeVisitors) {
+  if (gMusicXMLOptions ()->fTraceMusicXMLTreeVisitors) {
     fLogOutputStream <<
       "--> End visiting S_part" <<
       ", line " << inputLineNumber <<
       endl;
   }
 
-  gIndenter--;
+  gIndenter ()--;
 
 #ifdef TRACE_OPTIONS
-  if (gTraceOptions->fTraceParts) {
+  if (gTraceOptions ()->fTraceParts) {
     fLogOutputStream <<
       "Analyzing part " <<
       fCurrentPart->
@@ -788,13 +789,13 @@ void mxmlTree2MsrTranslator::visitEnd (S_part& elt)
   if (fOnGoingRepeat) {
     /*
     msrMusicXMLError (
-      gXml2lyOptions->fInputSourceName,
+      gXml2lyOptions ()->fInputSourceName,
       inputLineNumber,
       __FILE__, __LINE__,
       "unterminated repeat in MusicXML data, exiting");
     */
     msrMusicXMLWarning (
-      gXml2lyOptions->fInputSourceName,
+      gXml2lyOptions ()->fInputSourceName,
       inputLineNumber,
       "unterminated repeat in MusicXML data, ignoring the repeat altogether");
 
@@ -818,18 +819,18 @@ void mxmlTree2MsrTranslator::visitEnd (S_part& elt)
           2); // JMI
   
 #ifdef TRACE_OPTIONS
-    if (gTraceOptions->fTraceBarlines) {
+    if (gTraceOptions ()->fTraceBarlines) {
       fLogOutputStream <<
         "Creating an extra barline in part " <<
         fCurrentPart->getPartCombinedName () << ":" <<
         endl;
         
-      gIndenter++;
+      gIndenter ()++;
       
       fLogOutputStream <<
         barline;
         
-      gIndenter--;
+      gIndenter ()--;
     }
 #endif
 
@@ -848,7 +849,7 @@ void mxmlTree2MsrTranslator::visitEnd (S_part& elt)
 //________________________________________________________________________
 void mxmlTree2MsrTranslator::visitStart (S_attributes& elt)
 {
-  if (gMusicXMLOptions->fTraceMusicXMLTreeVisitors) {
+  if (gMusicXMLOptions ()->fTraceMusicXMLTreeVisitors) {
     fLogOutputStream <<
       "--> Start visiting S_attributes" <<
       ", line " << elt->getInputLineNumber () <<
@@ -861,7 +862,7 @@ void mxmlTree2MsrTranslator::visitEnd (S_attributes& elt)
   int inputLineNumber =
     elt->getInputLineNumber ();
 
-  if (gMusicXMLOptions->fTraceMusicXMLTreeVisitors) {
+  if (gMusicXMLOptions ()->fTraceMusicXMLTreeVisitors) {
     fLogOutputStream <<
       "--> End visiting S_attributes" <<
       ", line " << inputLineNumber <<
@@ -871,7 +872,7 @@ void mxmlTree2MsrTranslator::visitEnd (S_attributes& elt)
   // have the divisions been defined alright?
   if (! fCurrentDivisions) {
     msrMusicXMLError (
-      gXml2lyOptions->fInputSourceName,
+      gXml2lyOptions ()->fInputSourceName,
       inputLineNumber,
       __FILE__, __LINE__,
       "no <divisions/> markup found in MusicXML data, exiting");
@@ -900,7 +901,7 @@ void mxmlTree2MsrTranslator::visitStart ( S_divisions& elt )
   int inputLineNumber =
     elt->getInputLineNumber ();
 
-  if (gMusicXMLOptions->fTraceMusicXMLTreeVisitors) {
+  if (gMusicXMLOptions ()->fTraceMusicXMLTreeVisitors) {
     fLogOutputStream <<
       "--> Start visiting S_divisions" <<
       ", line " << inputLineNumber <<
@@ -915,7 +916,7 @@ void mxmlTree2MsrTranslator::visitStart ( S_divisions& elt )
     fCurrentDivisionsPerQuarterNote > 16383
   ) {
     msrMusicXMLError (
-      gXml2lyOptions->fInputSourceName,
+      gXml2lyOptions ()->fInputSourceName,
       inputLineNumber,
       __FILE__, __LINE__,
       "divisions per quarter note should be between 1 and 16383");
@@ -923,7 +924,7 @@ void mxmlTree2MsrTranslator::visitStart ( S_divisions& elt )
 
   // set current part's divisions per quarter note
 #ifdef TRACE_OPTIONS
-  if (gTraceOptions->fTraceDivisions) {
+  if (gTraceOptions ()->fTraceDivisions) {
     if (fCurrentDivisionsPerQuarterNote == 1) {
       fLogOutputStream <<
         "There is 1 division";
@@ -953,7 +954,7 @@ void mxmlTree2MsrTranslator::visitStart ( S_divisions& elt )
 //______________________________________________________________________________
 void mxmlTree2MsrTranslator::visitStart ( S_clef& elt )
 { 
-  if (gMusicXMLOptions->fTraceMusicXMLTreeVisitors) {
+  if (gMusicXMLOptions ()->fTraceMusicXMLTreeVisitors) {
     fLogOutputStream <<
       "--> Start visiting S_clef" <<
       ", line " << elt->getInputLineNumber () <<
@@ -966,7 +967,7 @@ void mxmlTree2MsrTranslator::visitStart ( S_clef& elt )
   // If absent (0), apply to all part staves.
   
   fCurrentClefStaffNumber =
-    elt->getAttributeIntValue ("number", 0); 
+    elt->getAttributeIntValue (attributeNames::number, 0); 
 
   fCurrentClefLine = 0;
   fCurrentClefOctaveChange = 0;
@@ -975,7 +976,7 @@ void mxmlTree2MsrTranslator::visitStart ( S_clef& elt )
 
 void mxmlTree2MsrTranslator::visitStart ( S_sign& elt )
 {
-  if (gMusicXMLOptions->fTraceMusicXMLTreeVisitors) {
+  if (gMusicXMLOptions ()->fTraceMusicXMLTreeVisitors) {
     fLogOutputStream <<
       "--> Start visiting S_sign" <<
       ", line " << elt->getInputLineNumber () <<
@@ -987,7 +988,7 @@ void mxmlTree2MsrTranslator::visitStart ( S_sign& elt )
 
 void mxmlTree2MsrTranslator::visitStart ( S_line& elt )
 {
-  if (gMusicXMLOptions->fTraceMusicXMLTreeVisitors) {
+  if (gMusicXMLOptions ()->fTraceMusicXMLTreeVisitors) {
     fLogOutputStream <<
       "--> Start visiting S_line" <<
       ", line " << elt->getInputLineNumber () <<
@@ -1002,7 +1003,7 @@ void mxmlTree2MsrTranslator::visitStart ( S_clef_octave_change& elt )
   int inputLineNumber =
     elt->getInputLineNumber ();
 
-  if (gMusicXMLOptions->fTraceMusicXMLTreeVisitors) {
+  if (gMusicXMLOptions ()->fTraceMusicXMLTreeVisitors) {
     fLogOutputStream <<
       "--> Start visiting S_clef_octave_change" <<
       ", line " << inputLineNumber <<
@@ -1019,7 +1020,7 @@ void mxmlTree2MsrTranslator::visitStart ( S_clef_octave_change& elt )
       "\" is unknown";
     
     msrMusicXMLError (
-      gXml2lyOptions->fInputSourceName,
+      gXml2lyOptions ()->fInputSourceName,
       inputLineNumber,
       __FILE__, __LINE__,
       s.str ());    
@@ -1031,7 +1032,7 @@ void mxmlTree2MsrTranslator::visitEnd ( S_clef& elt )
   int inputLineNumber =
     elt->getInputLineNumber ();
 
-  if (gMusicXMLOptions->fTraceMusicXMLTreeVisitors) {
+  if (gMusicXMLOptions ()->fTraceMusicXMLTreeVisitors) {
     fLogOutputStream <<
       "--> End visiting S_clef" <<
       ", line " << inputLineNumber <<
@@ -1084,7 +1085,7 @@ void mxmlTree2MsrTranslator::visitEnd ( S_clef& elt )
         "\" is unknown";
       
       msrMusicXMLError (
-        gXml2lyOptions->fInputSourceName,
+        gXml2lyOptions ()->fInputSourceName,
         inputLineNumber,
         __FILE__, __LINE__,
         s.str ());    
@@ -1152,7 +1153,7 @@ void mxmlTree2MsrTranslator::visitEnd ( S_clef& elt )
         "\" is unknown";
       
       msrMusicXMLError (
-        gXml2lyOptions->fInputSourceName,
+        gXml2lyOptions ()->fInputSourceName,
         inputLineNumber,
         __FILE__, __LINE__,
         s.str ());    
@@ -1186,7 +1187,7 @@ void mxmlTree2MsrTranslator::visitEnd ( S_clef& elt )
             "\" is unknown";
           
           msrMusicXMLError (
-            gXml2lyOptions->fInputSourceName,
+            gXml2lyOptions ()->fInputSourceName,
             inputLineNumber,
             __FILE__, __LINE__,
             s.str ());    
@@ -1218,7 +1219,7 @@ void mxmlTree2MsrTranslator::visitEnd ( S_clef& elt )
             "\" is unknown";
           
           msrMusicXMLError (
-            gXml2lyOptions->fInputSourceName,
+            gXml2lyOptions ()->fInputSourceName,
             inputLineNumber,
             __FILE__, __LINE__,
             s.str ());    
@@ -1247,7 +1248,7 @@ void mxmlTree2MsrTranslator::visitEnd ( S_clef& elt )
       "\" is unknown";
     
     msrMusicXMLError (
-      gXml2lyOptions->fInputSourceName,
+      gXml2lyOptions ()->fInputSourceName,
       inputLineNumber,
       __FILE__, __LINE__,
       s.str ());    
@@ -1280,7 +1281,7 @@ void mxmlTree2MsrTranslator::visitEnd ( S_clef& elt )
 //______________________________________________________________________________
 void mxmlTree2MsrTranslator::visitStart ( S_key& elt )
 {
-  if (gMusicXMLOptions->fTraceMusicXMLTreeVisitors) {
+  if (gMusicXMLOptions ()->fTraceMusicXMLTreeVisitors) {
     fLogOutputStream <<
       "--> Start visiting S_key" <<
       ", line " << elt->getInputLineNumber () <<
@@ -1290,7 +1291,7 @@ void mxmlTree2MsrTranslator::visitStart ( S_key& elt )
   // The optional number attribute refers to staff numbers.
   // If absent (0), apply to all part staves.
   fCurrentKeyStaffNumber =
-    elt->getAttributeIntValue ("number", 0);
+    elt->getAttributeIntValue (attributeNames::number, 0);
 
   fCurrentKeyKind = msrKey::kTraditionalKind;
   
@@ -1307,7 +1308,7 @@ void mxmlTree2MsrTranslator::visitStart ( S_key& elt )
   
 void mxmlTree2MsrTranslator::visitStart ( S_cancel& elt )
 {
-  if (gMusicXMLOptions->fTraceMusicXMLTreeVisitors) {
+  if (gMusicXMLOptions ()->fTraceMusicXMLTreeVisitors) {
     fLogOutputStream <<
       "--> Start visiting S_cancel" <<
       ", line " << elt->getInputLineNumber () <<
@@ -1319,7 +1320,7 @@ void mxmlTree2MsrTranslator::visitStart ( S_cancel& elt )
 
 void mxmlTree2MsrTranslator::visitStart ( S_fifths& elt )
 {
-  if (gMusicXMLOptions->fTraceMusicXMLTreeVisitors) {
+  if (gMusicXMLOptions ()->fTraceMusicXMLTreeVisitors) {
     fLogOutputStream <<
       "--> Start visiting S_fifths" <<
       ", line " << elt->getInputLineNumber () <<
@@ -1336,7 +1337,7 @@ void mxmlTree2MsrTranslator::visitStart ( S_mode& elt )
   int inputLineNumber =
     elt->getInputLineNumber ();
 
-  if (gMusicXMLOptions->fTraceMusicXMLTreeVisitors) {
+  if (gMusicXMLOptions ()->fTraceMusicXMLTreeVisitors) {
     fLogOutputStream <<
       "--> Start visiting S_mode" <<
       ", line " << inputLineNumber <<
@@ -1379,7 +1380,7 @@ void mxmlTree2MsrTranslator::visitStart ( S_mode& elt )
       "mode " << mode << " is unknown";
     
     msrMusicXMLError (
-      gXml2lyOptions->fInputSourceName,
+      gXml2lyOptions ()->fInputSourceName,
       inputLineNumber,
       __FILE__, __LINE__,
       s.str ());
@@ -1391,7 +1392,7 @@ void mxmlTree2MsrTranslator::visitStart ( S_key_step& elt )
   int inputLineNumber =
     elt->getInputLineNumber ();
 
-  if (gMusicXMLOptions->fTraceMusicXMLTreeVisitors) {
+  if (gMusicXMLOptions ()->fTraceMusicXMLTreeVisitors) {
     fLogOutputStream <<
       "--> Start visiting S_key_step" <<
       ", line " << inputLineNumber <<
@@ -1400,7 +1401,7 @@ void mxmlTree2MsrTranslator::visitStart ( S_key_step& elt )
 
   if (fCurrentHumdrumScotKeyItem) {
     msrMusicXMLError (
-      gXml2lyOptions->fInputSourceName,
+      gXml2lyOptions ()->fInputSourceName,
       inputLineNumber,
       __FILE__, __LINE__,
       "Humdrum/Scot key step found while another one is being handled");
@@ -1441,7 +1442,7 @@ void mxmlTree2MsrTranslator::visitStart ( S_key_alter& elt )
   int inputLineNumber =
     elt->getInputLineNumber ();
 
-  if (gMusicXMLOptions->fTraceMusicXMLTreeVisitors) {
+  if (gMusicXMLOptions ()->fTraceMusicXMLTreeVisitors) {
     fLogOutputStream <<
       "--> Start visiting S_key_alter" <<
       ", line " << inputLineNumber <<
@@ -1450,7 +1451,7 @@ void mxmlTree2MsrTranslator::visitStart ( S_key_alter& elt )
 
   if (! fCurrentHumdrumScotKeyItem) {
     msrMusicXMLError (
-      gXml2lyOptions->fInputSourceName,
+      gXml2lyOptions ()->fInputSourceName,
       inputLineNumber,
       __FILE__, __LINE__,
       "Humdrum/Scot key alter found while no key step is being handled");
@@ -1472,7 +1473,7 @@ void mxmlTree2MsrTranslator::visitStart ( S_key_alter& elt )
       "' should be -3, -2, -1.5, -1, -0.5, 0, +0.5, +1, +1.5, +2 or +3";
       
     msrMusicXMLError (
-      gXml2lyOptions->fInputSourceName,
+      gXml2lyOptions ()->fInputSourceName,
       inputLineNumber,
       __FILE__, __LINE__,
       s.str ());
@@ -1492,7 +1493,7 @@ void mxmlTree2MsrTranslator::visitStart ( S_key_octave& elt )
   int inputLineNumber =
     elt->getInputLineNumber ();
 
-  if (gMusicXMLOptions->fTraceMusicXMLTreeVisitors) {
+  if (gMusicXMLOptions ()->fTraceMusicXMLTreeVisitors) {
     fLogOutputStream <<
       "--> Start visiting S_key_octave" <<
       ", line " << inputLineNumber <<
@@ -1501,7 +1502,7 @@ void mxmlTree2MsrTranslator::visitStart ( S_key_octave& elt )
 
   int keyOctave = (int)(*elt);
 
-  int number = elt->getAttributeIntValue ("number", 0);
+  int number = elt->getAttributeIntValue (attributeNames::number, 0);
 
 /* JMI
 If the cancel attribute is
@@ -1526,7 +1527,7 @@ If the cancel attribute is
       "An exception number " << e << " occurred";
 
     msrMusicXMLError (
-      gXml2lyOptions->fInputSourceName,
+      gXml2lyOptions ()->fInputSourceName,
       inputLineNumber,
       __FILE__, __LINE__,
       s.str ());
@@ -1554,7 +1555,7 @@ If the cancel attribute is
       " not found in Humdrum/Scot key items";
 
     msrMusicXMLError (
-      gXml2lyOptions->fInputSourceName,
+      gXml2lyOptions ()->fInputSourceName,
       inputLineNumber,
       __FILE__, __LINE__,
       s.str ());
@@ -1571,7 +1572,7 @@ void mxmlTree2MsrTranslator::visitEnd ( S_key& elt )
   int inputLineNumber =
     elt->getInputLineNumber ();
 
-  if (gMusicXMLOptions->fTraceMusicXMLTreeVisitors) {
+  if (gMusicXMLOptions ()->fTraceMusicXMLTreeVisitors) {
     fLogOutputStream <<
       "--> End visiting S_key" <<
       ", line " << inputLineNumber <<
@@ -1699,7 +1700,7 @@ S_msrKey mxmlTree2MsrTranslator::handleTraditionalKey (
         "unknown key fifths number \"" << fCurrentKeyFifths << "\"";
         
       msrMusicXMLError (
-        gXml2lyOptions->fInputSourceName,
+        gXml2lyOptions ()->fInputSourceName,
         inputLineNumber,
         __FILE__, __LINE__,
         s.str ());
@@ -1752,7 +1753,7 @@ S_msrKey mxmlTree2MsrTranslator::handleHumdrumScotKey (
   
   else
     msrMusicXMLError (
-      gXml2lyOptions->fInputSourceName,
+      gXml2lyOptions ()->fInputSourceName,
       inputLineNumber,
       __FILE__, __LINE__,
       "Humdrum/Scot key is empty");
@@ -1767,7 +1768,7 @@ void mxmlTree2MsrTranslator::visitStart ( S_time& elt )
   int inputLineNumber =
     elt->getInputLineNumber ();
 
-  if (gMusicXMLOptions->fTraceMusicXMLTreeVisitors) {
+  if (gMusicXMLOptions ()->fTraceMusicXMLTreeVisitors) {
     fLogOutputStream <<
       "--> Start visiting S_time" <<
       ", line " << inputLineNumber <<
@@ -1775,7 +1776,7 @@ void mxmlTree2MsrTranslator::visitStart ( S_time& elt )
   }
   
   fCurrentTimeStaffNumber =
-    elt->getAttributeIntValue ("number", 0);
+    elt->getAttributeIntValue (attributeNames::number, 0);
     
   string timeSymbol =
     elt->getAttributeValue ("symbol");
@@ -1808,7 +1809,7 @@ void mxmlTree2MsrTranslator::visitStart ( S_time& elt )
         "time symbol " << timeSymbol << " is unknown";
       
       msrMusicXMLError (
-        gXml2lyOptions->fInputSourceName,
+        gXml2lyOptions ()->fInputSourceName,
         inputLineNumber,
         __FILE__, __LINE__,
         s.str ());
@@ -1822,7 +1823,7 @@ void mxmlTree2MsrTranslator::visitStart ( S_time& elt )
 
 void mxmlTree2MsrTranslator::visitStart ( S_beats& elt )
 {
-  if (gMusicXMLOptions->fTraceMusicXMLTreeVisitors) {
+  if (gMusicXMLOptions ()->fTraceMusicXMLTreeVisitors) {
     fLogOutputStream <<
       "--> Start visiting S_beats" <<
       ", line " << elt->getInputLineNumber () <<
@@ -1837,7 +1838,7 @@ void mxmlTree2MsrTranslator::visitStart ( S_beat_type& elt )
   int inputLineNumber =
     elt->getInputLineNumber ();
 
-  if (gMusicXMLOptions->fTraceMusicXMLTreeVisitors) {
+  if (gMusicXMLOptions ()->fTraceMusicXMLTreeVisitors) {
     fLogOutputStream <<
       "--> Start visiting S_beat_type" <<
       ", line " << inputLineNumber <<
@@ -1877,7 +1878,7 @@ void mxmlTree2MsrTranslator::visitStart ( S_beat_type& elt )
 
   else {
     msrMusicXMLError (
-      gXml2lyOptions->fInputSourceName,
+      gXml2lyOptions ()->fInputSourceName,
       inputLineNumber,
       __FILE__, __LINE__,
       "beat type doesn't contain any beats numbers");
@@ -1891,7 +1892,7 @@ void mxmlTree2MsrTranslator::visitStart ( S_beat_type& elt )
  
 void mxmlTree2MsrTranslator::visitStart ( S_senza_misura& elt )
 {
-  if (gMusicXMLOptions->fTraceMusicXMLTreeVisitors) {
+  if (gMusicXMLOptions ()->fTraceMusicXMLTreeVisitors) {
     fLogOutputStream <<
       "--> Start visiting S_senza_misura" <<
       ", line " << elt->getInputLineNumber () <<
@@ -1906,7 +1907,7 @@ void mxmlTree2MsrTranslator::visitStart ( S_interchangeable& elt )
   int inputLineNumber =
     elt->getInputLineNumber ();
 
-  if (gMusicXMLOptions->fTraceMusicXMLTreeVisitors) {
+  if (gMusicXMLOptions ()->fTraceMusicXMLTreeVisitors) {
     fLogOutputStream <<
       "--> Start visiting S_interchangeable" <<
       ", line " << inputLineNumber <<
@@ -1943,7 +1944,7 @@ void mxmlTree2MsrTranslator::visitStart ( S_interchangeable& elt )
         "interchangeable symbol " << interchangeableSymbol << " is unknown";
       
       msrMusicXMLError (
-        gXml2lyOptions->fInputSourceName,
+        gXml2lyOptions ()->fInputSourceName,
         inputLineNumber,
         __FILE__, __LINE__,
         s.str ());
@@ -1980,7 +1981,7 @@ void mxmlTree2MsrTranslator::visitStart ( S_interchangeable& elt )
         "interchangeable symbol " << interchangeableSymbol << " is unknown";
       
       msrMusicXMLError (
-        gXml2lyOptions->fInputSourceName,
+        gXml2lyOptions ()->fInputSourceName,
         inputLineNumber,
         __FILE__, __LINE__,
         s.str ());
@@ -1995,7 +1996,7 @@ void mxmlTree2MsrTranslator::visitStart ( S_time_relation& elt )
   int inputLineNumber =
     elt->getInputLineNumber ();
 
-  if (gMusicXMLOptions->fTraceMusicXMLTreeVisitors) {
+  if (gMusicXMLOptions ()->fTraceMusicXMLTreeVisitors) {
     fLogOutputStream <<
       "--> Start visiting S_time_relation" <<
       ", line " << inputLineNumber <<
@@ -2034,7 +2035,7 @@ void mxmlTree2MsrTranslator::visitStart ( S_time_relation& elt )
         "time-relation " << timeRelation << " is unknown";
       
       msrMusicXMLError (
-        gXml2lyOptions->fInputSourceName,
+        gXml2lyOptions ()->fInputSourceName,
         inputLineNumber,
         __FILE__, __LINE__,
         s.str ());
@@ -2047,7 +2048,7 @@ void mxmlTree2MsrTranslator::visitEnd ( S_time& elt )
   int inputLineNumber =
     elt->getInputLineNumber ();
 
-  if (gMusicXMLOptions->fTraceMusicXMLTreeVisitors) {
+  if (gMusicXMLOptions ()->fTraceMusicXMLTreeVisitors) {
     fLogOutputStream <<
       "--> End visiting S_time" <<
       ", line " << inputLineNumber <<
@@ -2078,7 +2079,7 @@ void mxmlTree2MsrTranslator::visitEnd ( S_time& elt )
     // only a 'semza misura' time may be empty
     if (  fCurrentTimeSymbolKind != msrTime::kTimeSymbolSenzaMisura) {
       msrMusicXMLError (
-        gXml2lyOptions->fInputSourceName,
+        gXml2lyOptions ()->fInputSourceName,
         inputLineNumber,
         __FILE__, __LINE__,
         "time is empty");
@@ -2104,7 +2105,7 @@ void mxmlTree2MsrTranslator::visitEnd ( S_time& elt )
 //______________________________________________________________________________
 void mxmlTree2MsrTranslator::visitStart ( S_instruments& elt )
 {
-  if (gMusicXMLOptions->fTraceMusicXMLTreeVisitors) {
+  if (gMusicXMLOptions ()->fTraceMusicXMLTreeVisitors) {
     fLogOutputStream <<
       "--> Start visiting S_time" <<
       ", line " << elt->getInputLineNumber () <<
@@ -2121,14 +2122,14 @@ void mxmlTree2MsrTranslator::visitStart ( S_instruments& elt )
 //______________________________________________________________________________
 void mxmlTree2MsrTranslator::visitStart ( S_transpose& elt )
 {
-  if (gMusicXMLOptions->fTraceMusicXMLTreeVisitors) {
+  if (gMusicXMLOptions ()->fTraceMusicXMLTreeVisitors) {
     fLogOutputStream <<
       "--> Start visiting S_transpose" <<
       ", line " << elt->getInputLineNumber () <<
       endl;
   }
 
-  fCurrentTransposeNumber = elt->getAttributeIntValue ("number", 0);
+  fCurrentTransposeNumber = elt->getAttributeIntValue (attributeNames::number, 0);
   
   fCurrentTransposeDiatonic     = 0;
   fCurrentTransposeChromatic    = 0;
@@ -2138,7 +2139,7 @@ void mxmlTree2MsrTranslator::visitStart ( S_transpose& elt )
 
 void mxmlTree2MsrTranslator::visitStart ( S_diatonic& elt )
 {
-  if (gMusicXMLOptions->fTraceMusicXMLTreeVisitors) {
+  if (gMusicXMLOptions ()->fTraceMusicXMLTreeVisitors) {
     fLogOutputStream <<
       "--> Start visiting S_diatonic" <<
       ", line " << elt->getInputLineNumber () <<
@@ -2150,7 +2151,7 @@ void mxmlTree2MsrTranslator::visitStart ( S_diatonic& elt )
   
 void mxmlTree2MsrTranslator::visitStart ( S_chromatic& elt )
 {
-  if (gMusicXMLOptions->fTraceMusicXMLTreeVisitors) {
+  if (gMusicXMLOptions ()->fTraceMusicXMLTreeVisitors) {
     fLogOutputStream <<
       "--> Start visiting S_chromatic" <<
       ", line " << elt->getInputLineNumber () <<
@@ -2162,7 +2163,7 @@ void mxmlTree2MsrTranslator::visitStart ( S_chromatic& elt )
  
 void mxmlTree2MsrTranslator::visitStart ( S_octave_change& elt )
 {
-  if (gMusicXMLOptions->fTraceMusicXMLTreeVisitors) {
+  if (gMusicXMLOptions ()->fTraceMusicXMLTreeVisitors) {
     fLogOutputStream <<
       "--> Start visiting octave_change" <<
       ", line " << elt->getInputLineNumber () <<
@@ -2174,7 +2175,7 @@ void mxmlTree2MsrTranslator::visitStart ( S_octave_change& elt )
  
 void mxmlTree2MsrTranslator::visitStart ( S_double& elt )
 {
-  if (gMusicXMLOptions->fTraceMusicXMLTreeVisitors) {
+  if (gMusicXMLOptions ()->fTraceMusicXMLTreeVisitors) {
     fLogOutputStream <<
       "--> Start visiting double" <<
       ", line " << elt->getInputLineNumber () <<
@@ -2189,7 +2190,7 @@ void mxmlTree2MsrTranslator::visitEnd ( S_transpose& elt )
   int inputLineNumber =
     elt->getInputLineNumber ();
 
-  if (gMusicXMLOptions->fTraceMusicXMLTreeVisitors) {
+  if (gMusicXMLOptions ()->fTraceMusicXMLTreeVisitors) {
     fLogOutputStream <<
       "--> End visiting S_transpose" <<
       ", line " << inputLineNumber <<
@@ -2217,7 +2218,7 @@ void mxmlTree2MsrTranslator::visitEnd ( S_transpose& elt )
       " and decrementing octave change by " << octaveOffset;
 
     msrMusicXMLWarning (
-      gXml2lyOptions->fInputSourceName,
+      gXml2lyOptions ()->fInputSourceName,
       inputLineNumber,
       s.str ());
 
@@ -2245,7 +2246,7 @@ void mxmlTree2MsrTranslator::visitEnd ( S_transpose& elt )
       " and incrementing octave change by " << octaveOffset;
 
     msrMusicXMLWarning (
-      gXml2lyOptions->fInputSourceName,
+      gXml2lyOptions ()->fInputSourceName,
       inputLineNumber,
       s.str ());
 
@@ -2284,7 +2285,7 @@ void mxmlTree2MsrTranslator::visitStart (S_direction& elt)
   int inputLineNumber =
     elt->getInputLineNumber ();
 
-  if (gMusicXMLOptions->fTraceMusicXMLTreeVisitors) {
+  if (gMusicXMLOptions ()->fTraceMusicXMLTreeVisitors) {
     fLogOutputStream <<
       "--> Start visiting S_direction" <<
       ", line " << inputLineNumber <<
@@ -2294,7 +2295,7 @@ void mxmlTree2MsrTranslator::visitStart (S_direction& elt)
   // placement
   
   string directionPlacementString =
-    elt->getAttributeValue ("placement");
+    elt->getAttributeValue (attributeNames::placement);
 
   fCurrentDirectionPlacementKind = kPlacementNone;
   
@@ -2310,7 +2311,7 @@ void mxmlTree2MsrTranslator::visitStart (S_direction& elt)
       "\" is unknown";
     
     msrMusicXMLError (
-      gXml2lyOptions->fInputSourceName,
+      gXml2lyOptions ()->fInputSourceName,
       inputLineNumber,
       __FILE__, __LINE__,
       s.str ());    
@@ -2324,7 +2325,7 @@ void mxmlTree2MsrTranslator::visitStart (S_direction& elt)
 
 void mxmlTree2MsrTranslator::visitEnd (S_direction& elt)
 {
-  if (gMusicXMLOptions->fTraceMusicXMLTreeVisitors) {
+  if (gMusicXMLOptions ()->fTraceMusicXMLTreeVisitors) {
     fLogOutputStream <<
       "--> End visiting S_direction" <<
       ", line " << elt->getInputLineNumber () <<
@@ -2345,7 +2346,7 @@ void mxmlTree2MsrTranslator::visitEnd (S_direction& elt)
           " <words/> markups";
           
         msrMusicXMLWarning (
-          gXml2lyOptions->fInputSourceName,
+          gXml2lyOptions ()->fInputSourceName,
           inputLineNumber,
           s.str ());
       }
@@ -2369,7 +2370,7 @@ void mxmlTree2MsrTranslator::visitEnd (S_direction& elt)
 
 void mxmlTree2MsrTranslator::visitStart (S_direction_type& elt)
 {
-  if (gMusicXMLOptions->fTraceMusicXMLTreeVisitors) {
+  if (gMusicXMLOptions ()->fTraceMusicXMLTreeVisitors) {
     fLogOutputStream <<
       "--> Start visiting S_direction_type" <<
       ", line " << elt->getInputLineNumber () <<
@@ -2385,7 +2386,7 @@ void mxmlTree2MsrTranslator::visitStart (S_offset& elt)
   int inputLineNumber =
     elt->getInputLineNumber ();
 
-  if (gMusicXMLOptions->fTraceMusicXMLTreeVisitors) {
+  if (gMusicXMLOptions ()->fTraceMusicXMLTreeVisitors) {
     fLogOutputStream <<
       "--> Start visiting S_offset" <<
       ", line " << inputLineNumber <<
@@ -2413,7 +2414,7 @@ void mxmlTree2MsrTranslator::visitStart (S_offset& elt)
         " should be 'yes' or 'no'";
       
       msrMusicXMLError (
-        gXml2lyOptions->fInputSourceName,
+        gXml2lyOptions ()->fInputSourceName,
         inputLineNumber,
         __FILE__, __LINE__,
         s.str ());
@@ -2434,7 +2435,7 @@ void mxmlTree2MsrTranslator::visitStart (S_octave_shift& elt)
   int inputLineNumber =
     elt->getInputLineNumber ();
 
-  if (gMusicXMLOptions->fTraceMusicXMLTreeVisitors) {
+  if (gMusicXMLOptions ()->fTraceMusicXMLTreeVisitors) {
     fLogOutputStream <<
       "--> Start visiting S_octave_shift" <<
       ", line " << inputLineNumber <<
@@ -2443,7 +2444,7 @@ void mxmlTree2MsrTranslator::visitStart (S_octave_shift& elt)
 
   // size
   
-  string octaveShiftSizeString = elt->getAttributeValue ("size");
+  string octaveShiftSizeString = elt->getAttributeValue (attributeNames::size);
   int    octaveShiftSize = 8;
 
   if (! octaveShiftSizeString.size ()) {
@@ -2453,7 +2454,7 @@ void mxmlTree2MsrTranslator::visitStart (S_octave_shift& elt)
       "octave shift size absent, assuming 8";
       
     msrMusicXMLWarning (
-      gXml2lyOptions->fInputSourceName,
+      gXml2lyOptions ()->fInputSourceName,
       inputLineNumber,
       s.str ());
   }
@@ -2482,7 +2483,7 @@ void mxmlTree2MsrTranslator::visitStart (S_octave_shift& elt)
         "\" is wrong, should be 8 or 15";
         
       msrMusicXMLError (
-        gXml2lyOptions->fInputSourceName,
+        gXml2lyOptions ()->fInputSourceName,
         inputLineNumber,
         __FILE__, __LINE__,
         s.str ());
@@ -2491,7 +2492,7 @@ void mxmlTree2MsrTranslator::visitStart (S_octave_shift& elt)
 
   // type
   
-  string type = elt->getAttributeValue ("type");
+  string type = elt->getAttributeValue (attributeNames::type);
 
   msrOctaveShift::msrOctaveShiftKind
     octaveShiftKind = msrOctaveShift::kOctaveShiftNone;
@@ -2513,7 +2514,7 @@ void mxmlTree2MsrTranslator::visitStart (S_octave_shift& elt)
       "\"" << "is unknown";
       
     msrMusicXMLError (
-      gXml2lyOptions->fInputSourceName,
+      gXml2lyOptions ()->fInputSourceName,
       inputLineNumber,
       __FILE__, __LINE__,
       s.str ());
@@ -2537,7 +2538,7 @@ void mxmlTree2MsrTranslator::visitStart (S_words& elt)
   int inputLineNumber =
     elt->getInputLineNumber ();
 
-  if (gMusicXMLOptions->fTraceMusicXMLTreeVisitors) {
+  if (gMusicXMLOptions ()->fTraceMusicXMLTreeVisitors) {
     fLogOutputStream <<
       "--> Start visiting S_words" <<
       ", line " << inputLineNumber <<
@@ -2571,7 +2572,7 @@ void mxmlTree2MsrTranslator::visitStart (S_words& elt)
         " should be 'left', 'center' or 'right'";
       
       msrMusicXMLError (
-        gXml2lyOptions->fInputSourceName,
+        gXml2lyOptions ()->fInputSourceName,
         inputLineNumber,
         __FILE__, __LINE__,
         s.str ());
@@ -2600,7 +2601,7 @@ void mxmlTree2MsrTranslator::visitStart (S_words& elt)
         " should be 'top', 'middle' or 'bottom'";
       
       msrMusicXMLError (
-        gXml2lyOptions->fInputSourceName,
+        gXml2lyOptions ()->fInputSourceName,
         inputLineNumber,
         __FILE__, __LINE__,
         s.str ());
@@ -2626,7 +2627,7 @@ void mxmlTree2MsrTranslator::visitStart (S_words& elt)
         " should be 'normal' or 'italic'";
       
       msrMusicXMLError (
-        gXml2lyOptions->fInputSourceName,
+        gXml2lyOptions ()->fInputSourceName,
         inputLineNumber,
         __FILE__, __LINE__,
         s.str ());
@@ -2702,7 +2703,7 @@ void mxmlTree2MsrTranslator::visitStart (S_words& elt)
         " should be 'normal' or 'bold'";
       
       msrMusicXMLError (
-        gXml2lyOptions->fInputSourceName,
+        gXml2lyOptions ()->fInputSourceName,
         inputLineNumber,
         __FILE__, __LINE__,
         s.str ());
@@ -2738,7 +2739,7 @@ void mxmlTree2MsrTranslator::visitStart (S_words& elt)
         "' should be 'it', 'en', 'de' or 'fr'";
       
       msrMusicXMLError (
-        gXml2lyOptions->fInputSourceName,
+        gXml2lyOptions ()->fInputSourceName,
         inputLineNumber,
         __FILE__, __LINE__,
         s.str ());
@@ -2748,7 +2749,7 @@ void mxmlTree2MsrTranslator::visitStart (S_words& elt)
   // create the words
   if (wordsValue.size ()) {
 #ifdef TRACE_OPTIONS
-    if (gTraceOptions->fTraceWords) {
+    if (gTraceOptions ()->fTraceWords) {
       fLogOutputStream <<
         "Creating words \"" << wordsValue << "\"" <<
         ", placement = \"" <<
@@ -2777,7 +2778,7 @@ void mxmlTree2MsrTranslator::visitStart (S_words& elt)
 
 void mxmlTree2MsrTranslator::visitStart ( S_accordion_registration& elt )
 {
-  if (gMusicXMLOptions->fTraceMusicXMLTreeVisitors) {
+  if (gMusicXMLOptions ()->fTraceMusicXMLTreeVisitors) {
     fLogOutputStream <<
       "--> Start visiting S_accordion_registration" <<
       ", line " << elt->getInputLineNumber () <<
@@ -2805,7 +2806,7 @@ void mxmlTree2MsrTranslator::visitStart ( S_accordion_registration& elt )
 
 void mxmlTree2MsrTranslator::visitStart ( S_accordion_high& elt )
 {
-  if (gMusicXMLOptions->fTraceMusicXMLTreeVisitors) {
+  if (gMusicXMLOptions ()->fTraceMusicXMLTreeVisitors) {
     fLogOutputStream <<
       "--> Start visiting S_accordion_high" <<
       ", line " << elt->getInputLineNumber () <<
@@ -2822,7 +2823,7 @@ void mxmlTree2MsrTranslator::visitStart ( S_accordion_middle& elt )
   int inputLineNumber =
     elt->getInputLineNumber ();
 
-  if (gMusicXMLOptions->fTraceMusicXMLTreeVisitors) {
+  if (gMusicXMLOptions ()->fTraceMusicXMLTreeVisitors) {
     fLogOutputStream <<
       "--> Start visiting S_accordion_middle" <<
        ", line " << inputLineNumber <<
@@ -2840,7 +2841,7 @@ void mxmlTree2MsrTranslator::visitStart ( S_accordion_middle& elt )
       ", replaced by 1";
     
     msrMusicXMLWarning (
-      gXml2lyOptions->fInputSourceName,
+      gXml2lyOptions ()->fInputSourceName,
       inputLineNumber,
       s.str ());
 
@@ -2852,7 +2853,7 @@ void mxmlTree2MsrTranslator::visitStart ( S_accordion_middle& elt )
 
 void mxmlTree2MsrTranslator::visitStart ( S_accordion_low& elt )
 {
-  if (gMusicXMLOptions->fTraceMusicXMLTreeVisitors) {
+  if (gMusicXMLOptions ()->fTraceMusicXMLTreeVisitors) {
     fLogOutputStream <<
       "--> Start visiting S_accordion_low" <<
       ", line " << elt->getInputLineNumber () <<
@@ -2869,7 +2870,7 @@ void mxmlTree2MsrTranslator::visitEnd ( S_accordion_registration& elt )
   int inputLineNumber =
     elt->getInputLineNumber ();
 
-  if (gMusicXMLOptions->fTraceMusicXMLTreeVisitors) {
+  if (gMusicXMLOptions ()->fTraceMusicXMLTreeVisitors) {
     fLogOutputStream <<
       "--> End visiting S_accordion_registration" <<
       ", line " << inputLineNumber <<
@@ -2881,7 +2882,7 @@ void mxmlTree2MsrTranslator::visitEnd ( S_accordion_registration& elt )
 
   if (fCurrentAccordionNumbersCounter == 0) {
     msrMusicXMLWarning (
-      gXml2lyOptions->fInputSourceName,
+      gXml2lyOptions ()->fInputSourceName,
       inputLineNumber,
       "accordion-registration has 0 child element, ignoring it");
   }
@@ -2905,7 +2906,7 @@ void mxmlTree2MsrTranslator::visitEnd ( S_accordion_registration& elt )
 
 void mxmlTree2MsrTranslator::visitEnd (S_direction_type& elt)
 {
-  if (gMusicXMLOptions->fTraceMusicXMLTreeVisitors) {
+  if (gMusicXMLOptions ()->fTraceMusicXMLTreeVisitors) {
     fLogOutputStream <<
       "--> End visiting S_direction_type" <<
       ", line " << elt->getInputLineNumber () <<
@@ -2921,7 +2922,7 @@ void mxmlTree2MsrTranslator::visitStart ( S_metronome& elt )
   int inputLineNumber =
     elt->getInputLineNumber ();
 
-  if (gMusicXMLOptions->fTraceMusicXMLTreeVisitors) {
+  if (gMusicXMLOptions ()->fTraceMusicXMLTreeVisitors) {
     fLogOutputStream <<
       "--> Start visiting S_metronome" <<
       ", line " << inputLineNumber <<
@@ -2943,7 +2944,7 @@ void mxmlTree2MsrTranslator::visitStart ( S_metronome& elt )
         " should be 'yes' or 'no'";
       
       msrMusicXMLError (
-        gXml2lyOptions->fInputSourceName,
+        gXml2lyOptions ()->fInputSourceName,
         inputLineNumber,
         __FILE__, __LINE__,
         s.str ());
@@ -2973,7 +2974,7 @@ void mxmlTree2MsrTranslator::visitStart ( S_beat_unit& elt )
   int inputLineNumber =
     elt->getInputLineNumber ();
 
-  if (gMusicXMLOptions->fTraceMusicXMLTreeVisitors) {
+  if (gMusicXMLOptions ()->fTraceMusicXMLTreeVisitors) {
     fLogOutputStream <<
       "--> Start visiting S_beat_unit" <<
       ", line " << inputLineNumber <<
@@ -3002,7 +3003,7 @@ void mxmlTree2MsrTranslator::visitStart ( S_beat_unit_dot& elt )
   int inputLineNumber =
     elt->getInputLineNumber ();
 
-  if (gMusicXMLOptions->fTraceMusicXMLTreeVisitors) {
+  if (gMusicXMLOptions ()->fTraceMusicXMLTreeVisitors) {
     fLogOutputStream <<
       "--> Start visiting S_beat_unit_dot" <<
       ", line " << inputLineNumber <<
@@ -3019,7 +3020,7 @@ void mxmlTree2MsrTranslator::visitStart ( S_beat_unit_dot& elt )
       "beat unit dot occurs without prior beat unit";
 
     msrMusicXMLError (
-      gXml2lyOptions->fInputSourceName,
+      gXml2lyOptions ()->fInputSourceName,
       inputLineNumber,
       __FILE__, __LINE__,
       s.str ());
@@ -3028,7 +3029,7 @@ void mxmlTree2MsrTranslator::visitStart ( S_beat_unit_dot& elt )
   
 void mxmlTree2MsrTranslator::visitStart ( S_per_minute& elt )
 {
-  if (gMusicXMLOptions->fTraceMusicXMLTreeVisitors) {
+  if (gMusicXMLOptions ()->fTraceMusicXMLTreeVisitors) {
     fLogOutputStream <<
       "--> Start visiting S_per_minute" <<
       ", line " << elt->getInputLineNumber () <<
@@ -3040,7 +3041,7 @@ void mxmlTree2MsrTranslator::visitStart ( S_per_minute& elt )
 
 void mxmlTree2MsrTranslator::visitStart ( S_metronome_note& elt )
 {
-  if (gMusicXMLOptions->fTraceMusicXMLTreeVisitors) {
+  if (gMusicXMLOptions ()->fTraceMusicXMLTreeVisitors) {
     fLogOutputStream <<
       "--> Start visiting S_metronome_note" <<
       ", line " << elt->getInputLineNumber () <<
@@ -3055,7 +3056,7 @@ void mxmlTree2MsrTranslator::visitStart ( S_metronome_type& elt )
   int inputLineNumber =
     elt->getInputLineNumber ();
 
-  if (gMusicXMLOptions->fTraceMusicXMLTreeVisitors) {
+  if (gMusicXMLOptions ()->fTraceMusicXMLTreeVisitors) {
     fLogOutputStream <<
       "--> Start visiting S_metronome_type" <<
       ", line " << inputLineNumber <<
@@ -3073,7 +3074,7 @@ void mxmlTree2MsrTranslator::visitStart ( S_metronome_type& elt )
 
 void mxmlTree2MsrTranslator::visitStart ( S_metronome_dot& elt )
 {
-  if (gMusicXMLOptions->fTraceMusicXMLTreeVisitors) {
+  if (gMusicXMLOptions ()->fTraceMusicXMLTreeVisitors) {
     fLogOutputStream <<
       "--> Start visiting S_metronome_dot" <<
       ", line " << elt->getInputLineNumber () <<
@@ -3088,7 +3089,7 @@ void mxmlTree2MsrTranslator::visitStart ( S_metronome_beam& elt )
   int inputLineNumber =
     elt->getInputLineNumber ();
 
-  if (gMusicXMLOptions->fTraceMusicXMLTreeVisitors) {
+  if (gMusicXMLOptions ()->fTraceMusicXMLTreeVisitors) {
     fLogOutputStream <<
       "--> Start visiting S_metronome_beam" <<
       ", line " << inputLineNumber <<
@@ -3124,7 +3125,7 @@ void mxmlTree2MsrTranslator::visitStart ( S_metronome_beam& elt )
       "\"" << "is not known";
       
     msrMusicXMLError (
-      gXml2lyOptions->fInputSourceName,
+      gXml2lyOptions ()->fInputSourceName,
       inputLineNumber,
       __FILE__, __LINE__,
       s.str ());
@@ -3133,7 +3134,7 @@ void mxmlTree2MsrTranslator::visitStart ( S_metronome_beam& elt )
   // number
   
   fCurrentBeamNumber = 
-    elt->getAttributeIntValue ("number", 0);
+    elt->getAttributeIntValue (attributeNames::number, 0);
 
   // create metronome note beam
   S_msrBeam
@@ -3154,7 +3155,7 @@ void mxmlTree2MsrTranslator::attachCurrentMetronomeBeamsToMetronomeNote (
   if (fPendingMetronomeBeams.size ()) {
 
 #ifdef TRACE_OPTIONS
-    if (gTraceOptions->fTraceNotes || gTraceOptions->fTraceBeams) {
+    if (gTraceOptions ()->fTraceNotes || gTraceOptions ()->fTraceBeams) {
       fLogOutputStream <<
         "Attaching current beams to tempoNote " <<
         tempoNote->asString () <<
@@ -3168,7 +3169,7 @@ void mxmlTree2MsrTranslator::attachCurrentMetronomeBeamsToMetronomeNote (
           fPendingMetronomeBeams.front();
         
 #ifdef TRACE_OPTIONS
-      if (gTraceOptions->fTraceNotes || gTraceOptions->fTraceBeams) {
+      if (gTraceOptions ()->fTraceNotes || gTraceOptions ()->fTraceBeams) {
         fLogOutputStream <<
           "Attaching beam '" <<
           beam->asString () <<
@@ -3191,7 +3192,7 @@ void mxmlTree2MsrTranslator::visitEnd ( S_metronome_note& elt )
   int inputLineNumber =
     elt->getInputLineNumber ();
 
-  if (gMusicXMLOptions->fTraceMusicXMLTreeVisitors) {
+  if (gMusicXMLOptions ()->fTraceMusicXMLTreeVisitors) {
     fLogOutputStream <<
       "--> End visiting S_metronome_note" <<
       ", line " << inputLineNumber <<
@@ -3210,7 +3211,6 @@ void mxmlTree2MsrTranslator::visitEnd ( S_metronome_note& elt )
     while (dots > 0) {
       fCurrentMetronomeNoteWholeNotesFromMetronomeType *=
         rational (3, 2);
-      fCurrentMetronomeNoteWholeNotesFromMetronomeType.rationalise ();
 
       dots--;
     } // while
@@ -3281,7 +3281,7 @@ void mxmlTree2MsrTranslator::visitStart ( S_metronome_relation& elt )
   int inputLineNumber =
     elt->getInputLineNumber ();
 
-  if (gMusicXMLOptions->fTraceMusicXMLTreeVisitors) {
+  if (gMusicXMLOptions ()->fTraceMusicXMLTreeVisitors) {
     fLogOutputStream <<
       "--> Start visiting S_metronome_relation" <<
       ", line " << inputLineNumber <<
@@ -3302,7 +3302,7 @@ void mxmlTree2MsrTranslator::visitStart ( S_metronome_relation& elt )
       "\" is unknown";
 
     msrMusicXMLError (
-      gXml2lyOptions->fInputSourceName,
+      gXml2lyOptions ()->fInputSourceName,
       inputLineNumber,
       __FILE__, __LINE__,
       s.str ());
@@ -3314,7 +3314,7 @@ void mxmlTree2MsrTranslator::visitStart ( S_metronome_tuplet& elt )
   int inputLineNumber =
     elt->getInputLineNumber ();
 
-  if (gMusicXMLOptions->fTraceMusicXMLTreeVisitors) {
+  if (gMusicXMLOptions ()->fTraceMusicXMLTreeVisitors) {
     fLogOutputStream <<
       "--> Start visiting S_metronome_tuplet" <<
       ", line " << inputLineNumber <<
@@ -3323,7 +3323,7 @@ void mxmlTree2MsrTranslator::visitStart ( S_metronome_tuplet& elt )
 
   // number
 
-  fCurrentTupletNumber = elt->getAttributeIntValue ("number", 0);
+  fCurrentTupletNumber = elt->getAttributeIntValue (attributeNames::number, 0);
 
   // bracket
 
@@ -3345,14 +3345,14 @@ void mxmlTree2MsrTranslator::visitStart ( S_metronome_tuplet& elt )
           "\" is unknown";
         
         msrMusicXMLError (
-          gXml2lyOptions->fInputSourceName,
+          gXml2lyOptions ()->fInputSourceName,
           inputLineNumber,
           __FILE__, __LINE__,
           s.str ());
       }
       else {
 #ifdef TRACE_OPTIONS
-        if (gTraceOptions->fTraceTuplets) {
+        if (gTraceOptions ()->fTraceTuplets) {
           stringstream s;
           
           s <<
@@ -3360,7 +3360,7 @@ void mxmlTree2MsrTranslator::visitStart ( S_metronome_tuplet& elt )
             " \"yes\" is assumed"; // option ??? JMI
           
           msrMusicXMLWarning (
-            gXml2lyOptions->fInputSourceName,
+            gXml2lyOptions ()->fInputSourceName,
             inputLineNumber,
             s.str ());
         }
@@ -3372,7 +3372,7 @@ void mxmlTree2MsrTranslator::visitStart ( S_metronome_tuplet& elt )
   // type
 
   {
-    string tupletType = elt->getAttributeValue ("type");
+    string tupletType = elt->getAttributeValue (attributeNames::type);
       
     fCurrentTempoTupletTypeKind = msrTempoTuplet::kTempoTupletTypeNone;
     
@@ -3388,7 +3388,7 @@ void mxmlTree2MsrTranslator::visitStart ( S_metronome_tuplet& elt )
         "\" is unknown";
       
       msrMusicXMLError (
-        gXml2lyOptions->fInputSourceName,
+        gXml2lyOptions ()->fInputSourceName,
         inputLineNumber,
         __FILE__, __LINE__,
         s.str ());
@@ -3415,7 +3415,7 @@ void mxmlTree2MsrTranslator::visitStart ( S_metronome_tuplet& elt )
     else {
       if (tupletShowNumber.size ()) {
         msrMusicXMLError (
-          gXml2lyOptions->fInputSourceName,
+          gXml2lyOptions ()->fInputSourceName,
           inputLineNumber,
           __FILE__, __LINE__,
           "tuplet show-number \"" + tupletShowNumber + "\" is unknown");
@@ -3425,9 +3425,9 @@ void mxmlTree2MsrTranslator::visitStart ( S_metronome_tuplet& elt )
   
 #ifdef TRACE_OPTIONS
   if (
-    gTraceOptions->fTraceNotesDetails
+    gTraceOptions ()->fTraceNotesDetails
       ||
-    gTraceOptions->fTraceTuplets) {
+    gTraceOptions ()->fTraceTuplets) {
     fLogOutputStream <<
       "fCurrentTempoTupletTypeKind: " <<
       msrTempoTuplet::tempoTupletTypeKindAsString (
@@ -3447,7 +3447,7 @@ void mxmlTree2MsrTranslator::visitStart ( S_metronome_tuplet& elt )
 
 void mxmlTree2MsrTranslator::visitStart ( S_normal_dot& elt )
 {
-  if (gMusicXMLOptions->fTraceMusicXMLTreeVisitors) {
+  if (gMusicXMLOptions ()->fTraceMusicXMLTreeVisitors) {
     fLogOutputStream <<
       "--> Start visiting S_normal_dot" <<
       ", line " << elt->getInputLineNumber () <<
@@ -3462,7 +3462,7 @@ void mxmlTree2MsrTranslator::visitEnd ( S_metronome_tuplet& elt )
   int inputLineNumber =
     elt->getInputLineNumber ();
 
-  if (gMusicXMLOptions->fTraceMusicXMLTreeVisitors) {
+  if (gMusicXMLOptions ()->fTraceMusicXMLTreeVisitors) {
     fLogOutputStream <<
       "--> End visiting S_metronome_tuplet" <<
       ", line " << inputLineNumber <<
@@ -3532,7 +3532,7 @@ void mxmlTree2MsrTranslator::visitEnd ( S_metronome& elt )
   int inputLineNumber =
     elt->getInputLineNumber ();
 
-  if (gMusicXMLOptions->fTraceMusicXMLTreeVisitors) {
+  if (gMusicXMLOptions ()->fTraceMusicXMLTreeVisitors) {
     fLogOutputStream <<
       "--> End visiting S_metronome" <<
       ", line " << inputLineNumber <<
@@ -3566,7 +3566,7 @@ void mxmlTree2MsrTranslator::visitEnd ( S_metronome& elt )
         " beat units";
         
     msrMusicXMLError (
-      gXml2lyOptions->fInputSourceName,
+      gXml2lyOptions ()->fInputSourceName,
       inputLineNumber,
       __FILE__, __LINE__,
       s.str ());    
@@ -3639,7 +3639,7 @@ void mxmlTree2MsrTranslator::visitEnd ( S_metronome& elt )
         " <words/> markups";
         
       msrMusicXMLWarning (
-        gXml2lyOptions->fInputSourceName,
+        gXml2lyOptions ()->fInputSourceName,
         inputLineNumber,
         s.str ());
     }
@@ -3665,7 +3665,7 @@ void mxmlTree2MsrTranslator::visitEnd ( S_metronome& elt )
 //________________________________________________________________________
 void mxmlTree2MsrTranslator::visitStart (S_staves& elt)
 {
-  if (gMusicXMLOptions->fTraceMusicXMLTreeVisitors) {
+  if (gMusicXMLOptions ()->fTraceMusicXMLTreeVisitors) {
     fLogOutputStream <<
       "--> Start visiting S_direction" <<
       ", line " << elt->getInputLineNumber () <<
@@ -3679,7 +3679,7 @@ void mxmlTree2MsrTranslator::visitStart (S_staff& elt)
   int inputLineNumber =
     elt->getInputLineNumber ();
 
-  if (gMusicXMLOptions->fTraceMusicXMLTreeVisitors) {
+  if (gMusicXMLOptions ()->fTraceMusicXMLTreeVisitors) {
     fLogOutputStream <<
       "--> Start visiting S_staff" <<
       ", line " << inputLineNumber <<
@@ -3706,7 +3706,7 @@ void mxmlTree2MsrTranslator::visitStart (S_staff& elt)
         inputLineNumber, fCurrentMusicXMLStaffNumber);
 
 #ifdef TRACE_OPTIONS
-  if (gTraceOptions->fTraceStaves) {
+  if (gTraceOptions ()->fTraceStaves) {
     fLogOutputStream <<
       "--> S_staff, fCurrentMusicXMLStaffNumber = " <<
       fCurrentMusicXMLStaffNumber <<
@@ -3740,7 +3740,7 @@ void mxmlTree2MsrTranslator::visitStart (S_staff& elt)
     s << "staff " << fCurrentMusicXMLStaffNumber << " is out of context";
     
     msrMusicXMLError (
-      gXml2lyOptions->fInputSourceName,
+      gXml2lyOptions ()->fInputSourceName,
       inputLineNumber,
       __FILE__, __LINE__,
       s.str ());    
@@ -3753,7 +3753,7 @@ void mxmlTree2MsrTranslator::visitStart (S_staff_details& elt )
   int inputLineNumber =
     elt->getInputLineNumber ();
 
-  if (gMusicXMLOptions->fTraceMusicXMLTreeVisitors) {
+  if (gMusicXMLOptions ()->fTraceMusicXMLTreeVisitors) {
     fLogOutputStream <<
       "--> Start visiting S_staff_details" <<
       ", line " << inputLineNumber <<
@@ -3763,7 +3763,7 @@ void mxmlTree2MsrTranslator::visitStart (S_staff_details& elt )
   // number
 
   fStaffDetailsStaffNumber =
-    elt->getAttributeIntValue ("number", 1); // default value is 1, as for clef
+    elt->getAttributeIntValue (attributeNames::number, 1); // default value is 1, as for clef
 
   // show-frets
 
@@ -3792,7 +3792,7 @@ void mxmlTree2MsrTranslator::visitStart (S_staff_details& elt )
         s << "show-frets " << showFrets << " unknown";
         
         msrMusicXMLError (
-          gXml2lyOptions->fInputSourceName,
+          gXml2lyOptions ()->fInputSourceName,
           inputLineNumber,
           __FILE__, __LINE__,
           s.str ());
@@ -3805,7 +3805,7 @@ void mxmlTree2MsrTranslator::visitStart (S_staff_details& elt )
   {
     string
       printObject =
-        elt->getAttributeValue ("print-object");
+        elt->getAttributeValue (attributeNames::print_object);
   
     fCurrentPrintObjectKind =
       msrStaffDetails::kPrintObjectYes; // default value
@@ -3825,7 +3825,7 @@ void mxmlTree2MsrTranslator::visitStart (S_staff_details& elt )
         s << "print-object " << printObject << " is unknown";
         
         msrMusicXMLError (
-          gXml2lyOptions->fInputSourceName,
+          gXml2lyOptions ()->fInputSourceName,
           inputLineNumber,
           __FILE__, __LINE__,
           s.str ());
@@ -3857,7 +3857,7 @@ void mxmlTree2MsrTranslator::visitStart (S_staff_details& elt )
       s << "print-spacing " << printSpacing << " is unknown";
       
       msrMusicXMLError (
-        gXml2lyOptions->fInputSourceName,
+        gXml2lyOptions ()->fInputSourceName,
         inputLineNumber,
         __FILE__, __LINE__,
         s.str ());
@@ -3865,11 +3865,11 @@ void mxmlTree2MsrTranslator::visitStart (S_staff_details& elt )
   }
 
 #ifdef TRACE_OPTIONS
-  if (gTraceOptions->fTraceStaves) {
+  if (gTraceOptions ()->fTraceStaves) {
     fLogOutputStream <<
       "Handling staff details:" <<
       endl <<
-      gTab << "StaffDetailsStaffNumber" << " = " <<
+      gTab () << "StaffDetailsStaffNumber" << " = " <<
       fStaffDetailsStaffNumber <<
       endl;
   }
@@ -3896,7 +3896,7 @@ void mxmlTree2MsrTranslator::visitStart (S_staff_details& elt )
       fCurrentPrintObjectKind,
       fCurrentPrintSpacingKind);
 
-  gIndenter++;
+  gIndenter ()++;
 }
 
 void mxmlTree2MsrTranslator::visitStart (S_staff_type& elt )
@@ -3904,7 +3904,7 @@ void mxmlTree2MsrTranslator::visitStart (S_staff_type& elt )
   int inputLineNumber =
     elt->getInputLineNumber ();
 
-  if (gMusicXMLOptions->fTraceMusicXMLTreeVisitors) {
+  if (gMusicXMLOptions ()->fTraceMusicXMLTreeVisitors) {
     fLogOutputStream <<
       "--> Start visiting S_staff_type" <<
       ", line " << inputLineNumber <<
@@ -3949,7 +3949,7 @@ void mxmlTree2MsrTranslator::visitStart (S_staff_type& elt )
     s << "staff-type" << staffType << "unknown";
     
     msrMusicXMLError (
-      gXml2lyOptions->fInputSourceName,
+      gXml2lyOptions ()->fInputSourceName,
       inputLineNumber,
       __FILE__, __LINE__,
       s.str ());      
@@ -3958,7 +3958,7 @@ void mxmlTree2MsrTranslator::visitStart (S_staff_type& elt )
 
 void mxmlTree2MsrTranslator::visitStart (S_staff_lines& elt )
 {
-  if (gMusicXMLOptions->fTraceMusicXMLTreeVisitors) {
+  if (gMusicXMLOptions ()->fTraceMusicXMLTreeVisitors) {
     fLogOutputStream <<
       "--> Start visiting S_staff_lines" <<
       ", line " << elt->getInputLineNumber () <<
@@ -3970,7 +3970,7 @@ void mxmlTree2MsrTranslator::visitStart (S_staff_lines& elt )
 
 void mxmlTree2MsrTranslator::visitStart (S_staff_tuning& elt )
 {
-  if (gMusicXMLOptions->fTraceMusicXMLTreeVisitors) {
+  if (gMusicXMLOptions ()->fTraceMusicXMLTreeVisitors) {
     fLogOutputStream <<
       "--> Start visiting S_staff_tuning" <<
       ", line " << elt->getInputLineNumber () <<
@@ -3991,7 +3991,7 @@ void mxmlTree2MsrTranslator::visitStart (S_tuning_step& elt )
   int inputLineNumber =
     elt->getInputLineNumber ();
 
-  if (gMusicXMLOptions->fTraceMusicXMLTreeVisitors) {
+  if (gMusicXMLOptions ()->fTraceMusicXMLTreeVisitors) {
     fLogOutputStream <<
       "--> Start visiting S_tuning_step" <<
       ", line " << inputLineNumber <<
@@ -4021,7 +4021,7 @@ void mxmlTree2MsrTranslator::visitStart (S_tuning_step& elt )
     s << "tuning step " << tuningStep << " is out of context";
     
     msrMusicXMLError (
-      gXml2lyOptions->fInputSourceName,
+      gXml2lyOptions ()->fInputSourceName,
       inputLineNumber,
       __FILE__, __LINE__,
       s.str ());
@@ -4033,7 +4033,7 @@ void mxmlTree2MsrTranslator::visitStart (S_tuning_octave& elt )
   int inputLineNumber =
     elt->getInputLineNumber ();
 
-  if (gMusicXMLOptions->fTraceMusicXMLTreeVisitors) {
+  if (gMusicXMLOptions ()->fTraceMusicXMLTreeVisitors) {
     fLogOutputStream <<
       "--> Start visiting S_tuning_octave" <<
       ", line " << inputLineNumber <<
@@ -4054,7 +4054,7 @@ void mxmlTree2MsrTranslator::visitStart (S_tuning_octave& elt )
     s << "tuning octave " << tuningOctave << " is out of context";
     
     msrMusicXMLError (
-      gXml2lyOptions->fInputSourceName,
+      gXml2lyOptions ()->fInputSourceName,
       inputLineNumber,
       __FILE__, __LINE__,
       s.str ());
@@ -4066,7 +4066,7 @@ void mxmlTree2MsrTranslator::visitStart (S_tuning_alter& elt )
   int inputLineNumber =
     elt->getInputLineNumber ();
 
-  if (gMusicXMLOptions->fTraceMusicXMLTreeVisitors) {
+  if (gMusicXMLOptions ()->fTraceMusicXMLTreeVisitors) {
     fLogOutputStream <<
       "--> Start visiting S_tuning_alter" <<
       ", line " << inputLineNumber <<
@@ -4088,7 +4088,7 @@ void mxmlTree2MsrTranslator::visitStart (S_tuning_alter& elt )
       "' should be -3, -2, -1.5, -1, -0.5, 0, +0.5, +1, +1.5, +2 or +3";
       
     msrMusicXMLError (
-      gXml2lyOptions->fInputSourceName,
+      gXml2lyOptions ()->fInputSourceName,
       inputLineNumber,
       __FILE__, __LINE__,
       s.str ());
@@ -4106,7 +4106,7 @@ void mxmlTree2MsrTranslator::visitStart (S_tuning_alter& elt )
     s << "tuning alter " << tuningAlter << " is out of context";
     
     msrMusicXMLError (
-      gXml2lyOptions->fInputSourceName,
+      gXml2lyOptions ()->fInputSourceName,
       inputLineNumber,
       __FILE__, __LINE__,
       s.str ());
@@ -4118,7 +4118,7 @@ void mxmlTree2MsrTranslator::visitEnd (S_staff_tuning& elt )
   int inputLineNumber =
     elt->getInputLineNumber ();
 
-  if (gMusicXMLOptions->fTraceMusicXMLTreeVisitors) {
+  if (gMusicXMLOptions ()->fTraceMusicXMLTreeVisitors) {
     fLogOutputStream <<
       "--> End visiting S_staff_tuning" <<
        ", line " << inputLineNumber <<
@@ -4141,12 +4141,12 @@ void mxmlTree2MsrTranslator::visitEnd (S_staff_tuning& elt )
 
   // create the staff tuning
 #ifdef TRACE_OPTIONS
-  if (gTraceOptions->fTraceStaffTuning) {
+  if (gTraceOptions ()->fTraceStaffTuning) {
     fLogOutputStream <<
       "Creating staff tuning:" <<
       endl;
 
-    gIndenter++;
+    gIndenter ()++;
 
     const int fieldWidth = 32;
 
@@ -4158,7 +4158,7 @@ void mxmlTree2MsrTranslator::visitEnd (S_staff_tuning& elt )
       setw (fieldWidth) <<
       "fCurrentStaffTuningDiatonicPitch" << " = " <<
       msrDiatonicPitchKindAsString (
-        gMsrOptions->fMsrQuarterTonesPitchesLanguageKind,
+        gMsrOptions ()->fMsrQuarterTonesPitchesLanguageKind,
         fCurrentStaffTuningDiatonicPitchKind) <<
       endl <<
       setw (fieldWidth) <<
@@ -4169,7 +4169,7 @@ void mxmlTree2MsrTranslator::visitEnd (S_staff_tuning& elt )
       setw (fieldWidth) <<
       "quarterTonesPitch" << " = " <<
       msrQuarterTonesPitchKindAsString (
-        gMsrOptions->fMsrQuarterTonesPitchesLanguageKind,
+        gMsrOptions ()->fMsrQuarterTonesPitchesLanguageKind,
         quarterTonesPitchKind) <<
       endl <<
       setw (fieldWidth) <<
@@ -4177,7 +4177,7 @@ void mxmlTree2MsrTranslator::visitEnd (S_staff_tuning& elt )
       fCurrentStaffTuningOctave <<
       endl;
 
-    gIndenter--;
+    gIndenter ()--;
   }
 #endif
 
@@ -4204,7 +4204,7 @@ void mxmlTree2MsrTranslator::visitStart (S_voice& elt )
   int inputLineNumber =
     elt->getInputLineNumber ();
 
-  if (gMusicXMLOptions->fTraceMusicXMLTreeVisitors) {
+  if (gMusicXMLOptions ()->fTraceMusicXMLTreeVisitors) {
     fLogOutputStream <<
       "--> Start visiting S_staff_details" <<
       ", line " << inputLineNumber <<
@@ -4227,7 +4227,7 @@ void mxmlTree2MsrTranslator::visitStart (S_voice& elt )
           fCurrentForwardVoiceNumber);
   
 #ifdef TRACE_OPTIONS
-    if (gTraceOptions->fTraceNotes || gTraceOptions->fTraceVoices) {
+    if (gTraceOptions ()->fTraceNotes || gTraceOptions ()->fTraceVoices) {
       fLogOutputStream <<
         "--> S_voice, fCurrentForwardVoiceNumber = " <<
         fCurrentForwardVoiceNumber << endl <<
@@ -4249,7 +4249,7 @@ void mxmlTree2MsrTranslator::visitStart (S_voice& elt )
     s << "voice " << fCurrentMusicXMLVoiceNumber << " is out of context";
     
     msrMusicXMLError (
-      gXml2lyOptions->fInputSourceName,
+      gXml2lyOptions ()->fInputSourceName,
       inputLineNumber,
       __FILE__, __LINE__,
       s.str ());
@@ -4262,7 +4262,7 @@ void mxmlTree2MsrTranslator::visitStart (S_backup& elt )
   int inputLineNumber =
     elt->getInputLineNumber ();
 
-  if (gMusicXMLOptions->fTraceMusicXMLTreeVisitors) {
+  if (gMusicXMLOptions ()->fTraceMusicXMLTreeVisitors) {
     fLogOutputStream <<
       "--> Start visiting S_backup" <<
       ", line " << inputLineNumber <<
@@ -4281,7 +4281,7 @@ void mxmlTree2MsrTranslator::visitEnd (S_backup& elt )
   int inputLineNumber =
     elt->getInputLineNumber ();
 
-  if (gMusicXMLOptions->fTraceMusicXMLTreeVisitors) {
+  if (gMusicXMLOptions ()->fTraceMusicXMLTreeVisitors) {
     fLogOutputStream <<
       "--> End visiting S_backup" <<
       ", line " << inputLineNumber <<
@@ -4290,17 +4290,17 @@ void mxmlTree2MsrTranslator::visitEnd (S_backup& elt )
 
 #ifdef TRACE_OPTIONS
   if (
-    gTraceOptions->fTraceNotes
+    gTraceOptions ()->fTraceNotes
       ||
-    gTraceOptions->fTraceChords
+    gTraceOptions ()->fTraceChords
       ||
-    gTraceOptions->fTraceMeasures
+    gTraceOptions ()->fTraceMeasures
       ||
-    gTraceOptions->fTraceVoices
+    gTraceOptions ()->fTraceVoices
       ||
-    gTraceOptions->fTraceStaves
+    gTraceOptions ()->fTraceStaves
       ||
-    gTraceOptions->fTraceLyrics
+    gTraceOptions ()->fTraceLyrics
     ) {
     fLogOutputStream <<
       "Handling 'backup <<< " << fCurrentBackupDurationDivisions <<
@@ -4333,7 +4333,7 @@ void mxmlTree2MsrTranslator::visitEnd (S_backup& elt )
 //______________________________________________________________________________
 void mxmlTree2MsrTranslator::visitStart ( S_forward& elt )
 {
-  if (gMusicXMLOptions->fTraceMusicXMLTreeVisitors) {
+  if (gMusicXMLOptions ()->fTraceMusicXMLTreeVisitors) {
     fLogOutputStream <<
       "--> Start visiting S_forward" <<
       ", line " << elt->getInputLineNumber () <<
@@ -4366,7 +4366,7 @@ void mxmlTree2MsrTranslator::visitEnd ( S_forward& elt )
   int inputLineNumber =
     elt->getInputLineNumber ();
 
-  if (gMusicXMLOptions->fTraceMusicXMLTreeVisitors) {
+  if (gMusicXMLOptions ()->fTraceMusicXMLTreeVisitors) {
     fLogOutputStream <<
       "--> End visiting S_forward" <<
       ", line " << inputLineNumber <<
@@ -4375,17 +4375,17 @@ void mxmlTree2MsrTranslator::visitEnd ( S_forward& elt )
 
 #ifdef TRACE_OPTIONS
   if (
-    gTraceOptions->fTraceNotes
+    gTraceOptions ()->fTraceNotes
       ||
-    gTraceOptions->fTraceChords
+    gTraceOptions ()->fTraceChords
       ||
-    gTraceOptions->fTraceMeasures
+    gTraceOptions ()->fTraceMeasures
       ||
-    gTraceOptions->fTraceVoices
+    gTraceOptions ()->fTraceVoices
       ||
-    gTraceOptions->fTraceStaves
+    gTraceOptions ()->fTraceStaves
       ||
-    gTraceOptions->fTraceLyrics
+    gTraceOptions ()->fTraceLyrics
     ) {
     fLogOutputStream <<
       "Handling 'forward <<< " << fCurrentBackupDurationDivisions <<
@@ -4450,7 +4450,7 @@ void mxmlTree2MsrTranslator::visitStart (S_tied& elt )
   int inputLineNumber =
     elt->getInputLineNumber ();
 
-  if (gMusicXMLOptions->fTraceMusicXMLTreeVisitors) {
+  if (gMusicXMLOptions ()->fTraceMusicXMLTreeVisitors) {
     fLogOutputStream <<
       "--> Start visiting S_tied" <<
       ", line " << inputLineNumber <<
@@ -4460,7 +4460,7 @@ void mxmlTree2MsrTranslator::visitStart (S_tied& elt )
 // <tied orientation="over" type="start"/>
 
   string tiedType =
-    elt->getAttributeValue ("type");
+    elt->getAttributeValue (attributeNames::type);
   
   fCurrentTiedOrientation =
     elt->getAttributeValue ("orientation");
@@ -4487,7 +4487,7 @@ void mxmlTree2MsrTranslator::visitStart (S_tied& elt )
         s << "tied type '" << fCurrentSlurType << "' inside a slur is unknown";
         
         msrMusicXMLError (
-          gXml2lyOptions->fInputSourceName,
+          gXml2lyOptions ()->fInputSourceName,
           inputLineNumber,
           __FILE__, __LINE__,
           s.str ());
@@ -4503,7 +4503,7 @@ void mxmlTree2MsrTranslator::visitStart (S_tied& elt )
         s << "tied type '" << fCurrentSlurType << "' inside a ligature is unknown";
         
         msrMusicXMLError (
-          gXml2lyOptions->fInputSourceName,
+          gXml2lyOptions ()->fInputSourceName,
           inputLineNumber,
           __FILE__, __LINE__,
           s.str ());
@@ -4536,7 +4536,7 @@ void mxmlTree2MsrTranslator::displaySlurStartsStack (
       iEnd   = fSlurStartsStack.end (),
       i      = iBegin;
         
-    gIndenter++;
+    gIndenter ()++;
   
     for ( ; ; ) {
       fLogOutputStream << "v " << (*i);
@@ -4544,7 +4544,7 @@ void mxmlTree2MsrTranslator::displaySlurStartsStack (
       // no endl here
     } // for
   
-    gIndenter--;
+    gIndenter ()--;
   }
   
   fLogOutputStream <<
@@ -4571,7 +4571,7 @@ void mxmlTree2MsrTranslator::displayTupletsStack (
       iEnd   = fTupletsStack.end (),
       i      = iBegin;
         
-    gIndenter++;
+    gIndenter ()++;
 
     int n = tupletStackSize;
     for ( ; ; ) {
@@ -4579,9 +4579,9 @@ void mxmlTree2MsrTranslator::displayTupletsStack (
         "v (" << n << ")" <<
         endl;
 
-      gIndenter++;
+      gIndenter ()++;
       (*i)->printShort (fLogOutputStream);
-      gIndenter--;
+      gIndenter ()--;
 
       n--;
       
@@ -4591,7 +4591,7 @@ void mxmlTree2MsrTranslator::displayTupletsStack (
         endl;
     } // for
   
-    gIndenter--;
+    gIndenter ()--;
   }
   
   fLogOutputStream <<
@@ -4606,7 +4606,7 @@ void mxmlTree2MsrTranslator::visitStart (S_slur& elt )
   int inputLineNumber =
     elt->getInputLineNumber ();
 
-  if (gMusicXMLOptions->fTraceMusicXMLTreeVisitors) {
+  if (gMusicXMLOptions ()->fTraceMusicXMLTreeVisitors) {
     fLogOutputStream <<
       "--> Start visiting S_slur" <<
       ", line " << inputLineNumber <<
@@ -4614,7 +4614,7 @@ void mxmlTree2MsrTranslator::visitStart (S_slur& elt )
   }
 
 #ifdef TRACE_OPTIONS
-  if (gTraceOptions->fTraceSlurs) {
+  if (gTraceOptions ()->fTraceSlurs) {
     displaySlurStartsStack ("BEFORE handling slur");
   }
 #endif
@@ -4632,7 +4632,7 @@ void mxmlTree2MsrTranslator::visitStart (S_slur& elt )
       "ignoring a slur in a chord member note other than the first one";
       
     msrMusicXMLWarning (
-      gXml2lyOptions->fInputSourceName,
+      gXml2lyOptions ()->fInputSourceName,
       inputLineNumber,
       s.str ());
   }
@@ -4641,14 +4641,14 @@ void mxmlTree2MsrTranslator::visitStart (S_slur& elt )
 
     // number
     
-    int slurNumber = elt->getAttributeIntValue ("number", 0);
+    int slurNumber = elt->getAttributeIntValue (attributeNames::number, 0);
   
     // type
     
-    fCurrentSlurType = elt->getAttributeValue ("type");
+    fCurrentSlurType = elt->getAttributeValue (attributeNames::type);
   
     fCurrentSlurPlacement =
-      elt->getAttributeValue ("placement");
+      elt->getAttributeValue (attributeNames::placement);
   
     // a phrasing slur is recognized as such
     // when the nested regular slur start is met
@@ -4671,7 +4671,7 @@ void mxmlTree2MsrTranslator::visitStart (S_slur& elt )
     
             // the stack top is in fact a phrasing slur start
 #ifdef TRACE_OPTIONS
-            if (gTraceOptions->fTraceSlurs) {
+            if (gTraceOptions ()->fTraceSlurs) {
               fLogOutputStream <<
                 "The slur start '" <<
                 containingSlur->asString () <<
@@ -4696,7 +4696,7 @@ void mxmlTree2MsrTranslator::visitStart (S_slur& elt )
             
       //      msrMusicXMLError ( // JMI
             msrMusicXMLWarning (
-              gXml2lyOptions->fInputSourceName,
+              gXml2lyOptions ()->fInputSourceName,
               inputLineNumber,
       //        __FILE__, __LINE__,
               s.str ());
@@ -4721,7 +4721,7 @@ void mxmlTree2MsrTranslator::visitStart (S_slur& elt )
               "a standalone slur 'stop' is meaningless, ignoring it";
             
             msrMusicXMLWarning (
-              gXml2lyOptions->fInputSourceName,
+              gXml2lyOptions ()->fInputSourceName,
               inputLineNumber,
               s.str ());
           }
@@ -4746,7 +4746,7 @@ void mxmlTree2MsrTranslator::visitStart (S_slur& elt )
             case msrSlur::kPhrasingSlurStart:
               // the stack top is in fact a phrasing slur start
 #ifdef TRACE_OPTIONS
-              if (gTraceOptions->fTraceSlurs) {
+              if (gTraceOptions ()->fTraceSlurs) {
                 fLogOutputStream <<
                   "A slur stop matches a phrasing slur start, it is thus a phrasing slur stop" <<
                   ", line " << inputLineNumber <<
@@ -4784,7 +4784,7 @@ void mxmlTree2MsrTranslator::visitStart (S_slur& elt )
             "\" is unknown";
           
           msrMusicXMLError (
-            gXml2lyOptions->fInputSourceName,
+            gXml2lyOptions ()->fInputSourceName,
             inputLineNumber,
             __FILE__, __LINE__,
             s.str ());
@@ -4815,7 +4815,7 @@ void mxmlTree2MsrTranslator::visitStart (S_slur& elt )
     else {
       if (slurLineType.size ()) {
         msrMusicXMLError (
-          gXml2lyOptions->fInputSourceName,
+          gXml2lyOptions ()->fInputSourceName,
           inputLineNumber,
           __FILE__, __LINE__,
           "slur line-type \"" + slurLineType + "\" is unknown");
@@ -4824,9 +4824,9 @@ void mxmlTree2MsrTranslator::visitStart (S_slur& elt )
   
 #ifdef TRACE_OPTIONS
     if (
-      gTraceOptions->fTraceNotesDetails
+      gTraceOptions ()->fTraceNotesDetails
         ||
-      gTraceOptions->fTraceSlurs) {
+      gTraceOptions ()->fTraceSlurs) {
       fLogOutputStream <<
         "slurNumber: " <<
         slurNumber <<
@@ -4862,7 +4862,7 @@ void mxmlTree2MsrTranslator::visitStart (S_slur& elt )
   }
 
 #ifdef TRACE_OPTIONS
-  if (gTraceOptions->fTraceSlurs) {
+  if (gTraceOptions ()->fTraceSlurs) {
     displaySlurStartsStack ("AFTER handling slur");
   }
 #endif
@@ -4874,7 +4874,7 @@ void mxmlTree2MsrTranslator::visitStart (S_bracket& elt )
   int inputLineNumber =
     elt->getInputLineNumber ();
 
-  if (gMusicXMLOptions->fTraceMusicXMLTreeVisitors) {
+  if (gMusicXMLOptions ()->fTraceMusicXMLTreeVisitors) {
     fLogOutputStream <<
       "--> Start visiting S_bracket" <<
       ", line " << inputLineNumber <<
@@ -4884,12 +4884,12 @@ void mxmlTree2MsrTranslator::visitStart (S_bracket& elt )
   // number
   
   int ligatureNumber =
-    elt->getAttributeIntValue ("number", 0);
+    elt->getAttributeIntValue (attributeNames::number, 0);
 
   // type
 
   string ligatureType =
-    elt->getAttributeValue ("type");
+    elt->getAttributeValue (attributeNames::type);
 
   fCurrentLigatureKind = msrLigature::kLigatureNone;
 
@@ -4917,7 +4917,7 @@ void mxmlTree2MsrTranslator::visitStart (S_bracket& elt )
           "\" is unknown";
         
         msrMusicXMLError (
-          gXml2lyOptions->fInputSourceName,
+          gXml2lyOptions ()->fInputSourceName,
           inputLineNumber,
           __FILE__, __LINE__,
           s.str ());
@@ -4956,7 +4956,7 @@ void mxmlTree2MsrTranslator::visitStart (S_bracket& elt )
         "\" is unknown";
       
       msrMusicXMLError (
-        gXml2lyOptions->fInputSourceName,
+        gXml2lyOptions ()->fInputSourceName,
         inputLineNumber,
         __FILE__, __LINE__,
         s.str ());
@@ -4986,7 +4986,7 @@ void mxmlTree2MsrTranslator::visitStart (S_bracket& elt )
   else {
     if (ligatureLineTypeValue.size ()) {
       msrMusicXMLError (
-        gXml2lyOptions->fInputSourceName,
+        gXml2lyOptions ()->fInputSourceName,
         inputLineNumber,
         __FILE__, __LINE__,
         "ligature line-type \"" + ligatureLineTypeValue + "\" is unknown");
@@ -5017,7 +5017,7 @@ void mxmlTree2MsrTranslator::visitStart (S_bracket& elt )
               "Bracket start found with no placement";
     
             msrMusicXMLError (
-              gXml2lyOptions->fInputSourceName,
+              gXml2lyOptions ()->fInputSourceName,
               inputLineNumber,
               __FILE__, __LINE__,
               s.str ());
@@ -5050,7 +5050,7 @@ void mxmlTree2MsrTranslator::visitStart (S_bracket& elt )
               "Bracket stop above found with no corresponding bracket start";
     
             msrMusicXMLError (
-              gXml2lyOptions->fInputSourceName,
+              gXml2lyOptions ()->fInputSourceName,
               inputLineNumber,
               __FILE__, __LINE__,
               s.str ());
@@ -5073,7 +5073,7 @@ void mxmlTree2MsrTranslator::visitStart (S_bracket& elt )
               "Bracket stop below found with no corresponding bracket start";
     
             msrMusicXMLError (
-              gXml2lyOptions->fInputSourceName,
+              gXml2lyOptions ()->fInputSourceName,
               inputLineNumber,
               __FILE__, __LINE__,
               s.str ());
@@ -5105,7 +5105,7 @@ void mxmlTree2MsrTranslator::visitStart ( S_wedge& elt )
   int inputLineNumber =
     elt->getInputLineNumber ();
 
-  if (gMusicXMLOptions->fTraceMusicXMLTreeVisitors) {
+  if (gMusicXMLOptions ()->fTraceMusicXMLTreeVisitors) {
     fLogOutputStream <<
       "--> Start visiting S_wedge" <<
       ", line " << inputLineNumber <<
@@ -5114,7 +5114,7 @@ void mxmlTree2MsrTranslator::visitStart ( S_wedge& elt )
 
   // type
   
-  string type = elt->getAttributeValue("type");
+  string type = elt->getAttributeValue(attributeNames::type);
   
   msrWedge::msrWedgeKind wedgeKind = msrWedge::kWedgeKindNone;
 
@@ -5137,7 +5137,7 @@ void mxmlTree2MsrTranslator::visitStart ( S_wedge& elt )
         "\", should be 'crescendo', 'diminuendo' or 'stop'";
       
       msrMusicXMLError (
-        gXml2lyOptions->fInputSourceName,
+        gXml2lyOptions ()->fInputSourceName,
         inputLineNumber,
         __FILE__, __LINE__,
         s.str ());
@@ -5166,7 +5166,7 @@ void mxmlTree2MsrTranslator::visitStart ( S_wedge& elt )
         "\" is unknown";
       
       msrMusicXMLError (
-        gXml2lyOptions->fInputSourceName,
+        gXml2lyOptions ()->fInputSourceName,
         inputLineNumber,
         __FILE__, __LINE__,
         s.str ());
@@ -5196,7 +5196,7 @@ void mxmlTree2MsrTranslator::visitStart ( S_wedge& elt )
   else {
     if (wedgeLineType.size ()) {
       msrMusicXMLError (
-        gXml2lyOptions->fInputSourceName,
+        gXml2lyOptions ()->fInputSourceName,
         inputLineNumber,
         __FILE__, __LINE__,
         "wedge line-type \"" + wedgeLineType + "\" is unknown");
@@ -5221,7 +5221,7 @@ void mxmlTree2MsrTranslator::visitStart (S_lyric& elt )
   int inputLineNumber =
     elt->getInputLineNumber ();
 
-  if (gMusicXMLOptions->fTraceMusicXMLTreeVisitors) {
+  if (gMusicXMLOptions ()->fTraceMusicXMLTreeVisitors) {
     fLogOutputStream <<
       "--> Start visiting S_lyric" <<
       ", line " << inputLineNumber <<
@@ -5232,11 +5232,11 @@ void mxmlTree2MsrTranslator::visitStart (S_lyric& elt )
 
   {
     fCurrentStanzaNumber =
-      elt->getAttributeValue ("number");
+      elt->getAttributeValue (attributeNames::number);
     
     if (fCurrentStanzaNumber.size () == 0) {
       msrMusicXMLWarning (
-        gXml2lyOptions->fInputSourceName,
+        gXml2lyOptions ()->fInputSourceName,
         inputLineNumber,
         "lyric number is empty, using \"1\" by default");
 
@@ -5244,7 +5244,7 @@ void mxmlTree2MsrTranslator::visitStart (S_lyric& elt )
     }
     
 #ifdef TRACE_OPTIONS
-    if (gTraceOptions->fTraceLyrics) {
+    if (gTraceOptions ()->fTraceLyrics) {
       fLogOutputStream <<
         "Setting fCurrentStanzaNumber to " <<
         fCurrentStanzaNumber <<
@@ -5268,7 +5268,7 @@ void mxmlTree2MsrTranslator::visitStart (S_lyric& elt )
     if (fCurrentStanzaName.size () == 0) {
       // lyrics names are not so frequent after all...
 #ifdef TRACE_OPTIONS
-      if (gTraceOptions->fTraceLyrics) {
+      if (gTraceOptions ()->fTraceLyrics) {
         fLogOutputStream <<
           "Lyric name is empty, using \"" <<
           K_NO_STANZA_NAME <<
@@ -5281,7 +5281,7 @@ void mxmlTree2MsrTranslator::visitStart (S_lyric& elt )
     }
     
 #ifdef TRACE_OPTIONS
-    if (gTraceOptions->fTraceLyrics) {
+    if (gTraceOptions ()->fTraceLyrics) {
       fLogOutputStream <<
         "Setting fCurrentStanzaName to \"" <<
         fCurrentStanzaName <<
@@ -5311,7 +5311,7 @@ void mxmlTree2MsrTranslator::visitStart ( S_syllabic& elt )
   int inputLineNumber =
     elt->getInputLineNumber ();
 
-  if (gMusicXMLOptions->fTraceMusicXMLTreeVisitors) {
+  if (gMusicXMLOptions ()->fTraceMusicXMLTreeVisitors) {
     fLogOutputStream <<
       "--> Start visiting S_syllabic" <<
       ", line " << inputLineNumber <<
@@ -5340,7 +5340,7 @@ void mxmlTree2MsrTranslator::visitStart ( S_syllabic& elt )
       "\" is unknown";
     
     msrMusicXMLError (
-      gXml2lyOptions->fInputSourceName,
+      gXml2lyOptions ()->fInputSourceName,
       inputLineNumber,
       __FILE__, __LINE__,
       s.str ());
@@ -5355,7 +5355,7 @@ void mxmlTree2MsrTranslator::visitStart ( S_text& elt )
   int inputLineNumber =
     elt->getInputLineNumber ();
 
-  if (gMusicXMLOptions->fTraceMusicXMLTreeVisitors) {
+  if (gMusicXMLOptions ()->fTraceMusicXMLTreeVisitors) {
     fLogOutputStream <<
       "--> Start visiting S_text" <<
       ", line " << inputLineNumber <<
@@ -5368,7 +5368,7 @@ void mxmlTree2MsrTranslator::visitStart ( S_text& elt )
   fCurrentLyricTextsList.push_back (textValue);
 
 #ifdef TRACE_OPTIONS
-  if (gTraceOptions->fTraceLyrics) {
+  if (gTraceOptions ()->fTraceLyrics) {
     fLogOutputStream <<
       "textValue = \""<< textValue << "\"" <<
       ", line " << inputLineNumber <<
@@ -5380,8 +5380,8 @@ void mxmlTree2MsrTranslator::visitStart ( S_text& elt )
   fCurrentStanzaHasText = true;
 
 #ifdef TRACE_OPTIONS
-  if (gTraceOptions->fTraceLyrics) {
-    gIndenter++;
+  if (gTraceOptions ()->fTraceLyrics) {
+    gIndenter ()++;
     
     const int fieldWidth = 20;
 
@@ -5408,7 +5408,7 @@ void mxmlTree2MsrTranslator::visitStart ( S_text& elt )
     fLogOutputStream <<
       endl;
 
-    gIndenter--;
+    gIndenter ()--;
   }
 #endif
 
@@ -5418,7 +5418,7 @@ void mxmlTree2MsrTranslator::visitStart ( S_text& elt )
 
 void mxmlTree2MsrTranslator::visitStart ( S_elision& elt ) 
 {
-  if (gMusicXMLOptions->fTraceMusicXMLTreeVisitors) {
+  if (gMusicXMLOptions ()->fTraceMusicXMLTreeVisitors) {
     fLogOutputStream <<
       "--> Start visiting S_elision" <<
       ", line " << elt->getInputLineNumber () <<
@@ -5442,7 +5442,7 @@ void mxmlTree2MsrTranslator::visitStart ( S_extend& elt )
   int inputLineNumber =
     elt->getInputLineNumber ();
 
-  if (gMusicXMLOptions->fTraceMusicXMLTreeVisitors) {
+  if (gMusicXMLOptions ()->fTraceMusicXMLTreeVisitors) {
     fLogOutputStream <<
       "--> Start visiting S_extend" <<
       ", line " << inputLineNumber <<
@@ -5450,7 +5450,7 @@ void mxmlTree2MsrTranslator::visitStart ( S_extend& elt )
   }
 
   string extendType =
-    elt->getAttributeValue ("type");
+    elt->getAttributeValue (attributeNames::type);
 
   if (fOnGoingLyric) {
     fCurrentSyllableExtendKind =
@@ -5477,7 +5477,7 @@ void mxmlTree2MsrTranslator::visitStart ( S_extend& elt )
           "\" is unknown";
         
         msrMusicXMLError (
-          gXml2lyOptions->fInputSourceName,
+          gXml2lyOptions ()->fInputSourceName,
           inputLineNumber,
           __FILE__, __LINE__,
           s.str ());
@@ -5497,7 +5497,7 @@ void mxmlTree2MsrTranslator::visitEnd ( S_lyric& elt )
   int inputLineNumber =
     elt->getInputLineNumber ();
 
-  if (gMusicXMLOptions->fTraceMusicXMLTreeVisitors) {
+  if (gMusicXMLOptions ()->fTraceMusicXMLTreeVisitors) {
     fLogOutputStream <<
       "--> End visiting S_lyric" <<
       ", line " << inputLineNumber <<
@@ -5512,7 +5512,7 @@ void mxmlTree2MsrTranslator::visitEnd ( S_lyric& elt )
       "<lyric /> has no <syllabic/> component, using 'single' by default";
 
     msrMusicXMLWarning (
-      gXml2lyOptions->fInputSourceName,
+      gXml2lyOptions ()->fInputSourceName,
       inputLineNumber,
       s.str ());
     
@@ -5533,7 +5533,7 @@ void mxmlTree2MsrTranslator::visitEnd ( S_lyric& elt )
       " is attached to a rest";
 
     msrMusicXMLWarning (
-      gXml2lyOptions->fInputSourceName,
+      gXml2lyOptions ()->fInputSourceName,
       inputLineNumber,
       s.str ());
       
@@ -5542,7 +5542,7 @@ void mxmlTree2MsrTranslator::visitEnd ( S_lyric& elt )
   }
 
 #ifdef TRACE_OPTIONS
-  if (gTraceOptions->fTraceLyricsDetails) {
+  if (gTraceOptions ()->fTraceLyricsDetails) {
     fLogOutputStream <<
       "==> visitEnd ( S_lyric&), fCurrentSyllableKind = " <<
       msrSyllable::syllableKindAsString (fCurrentSyllableKind) <<
@@ -5550,14 +5550,14 @@ void mxmlTree2MsrTranslator::visitEnd ( S_lyric& elt )
       ", with:" <<
       endl;
 
-    gIndenter++;
+    gIndenter ()++;
 
     fLogOutputStream <<
       "Lyric data:" <<
       endl;
 
     {
-      gIndenter++;
+      gIndenter ()++;
 
       const int fieldwidth = 28;
   
@@ -5660,10 +5660,10 @@ void mxmlTree2MsrTranslator::visitEnd ( S_lyric& elt )
         "\"" <<
       endl;
           
-      gIndenter--;
+      gIndenter ()--;
     }
     
-    gIndenter--;
+    gIndenter ()--;
   }
 #endif
 
@@ -5685,7 +5685,7 @@ void mxmlTree2MsrTranslator::visitEnd ( S_lyric& elt )
           fCurrentStanzaName);
 
 #ifdef TRACE_OPTIONS
-  if (gTraceOptions->fTraceLyrics) {      
+  if (gTraceOptions ()->fTraceLyrics) {      
     fLogOutputStream <<
       "Creating a syllable '" <<
       msrSyllable::syllableKindAsString (
@@ -5762,7 +5762,7 @@ void mxmlTree2MsrTranslator::visitStart (S_measure& elt)
   int inputLineNumber =
     elt->getInputLineNumber ();
 
-  if (gMusicXMLOptions->fTraceMusicXMLTreeVisitors) {
+  if (gMusicXMLOptions ()->fTraceMusicXMLTreeVisitors) {
     fLogOutputStream <<
       "--> Start visiting S_measure" <<
       ", line " << inputLineNumber <<
@@ -5773,8 +5773,8 @@ void mxmlTree2MsrTranslator::visitStart (S_measure& elt)
   fCurrentMeasureOrdinalNumber++;
   
 #ifdef TRACE_OPTIONS
-  if (gTraceOptions->fTraceMeasuresDetails) {
-    gLogIOstream <<
+  if (gTraceOptions ()->fTraceMeasuresDetails) {
+    gLogIOstream () <<
       "==> visitStart (S_measure" <<
       ", fCurrentMeasureOrdinalNumber = '" <<
         fCurrentMeasureOrdinalNumber <<
@@ -5790,10 +5790,10 @@ void mxmlTree2MsrTranslator::visitStart (S_measure& elt)
   // number
 
   fCurrentMeasureNumber =
-    elt->getAttributeValue ("number");
+    elt->getAttributeValue (attributeNames::number);
 
 #ifdef TRACE_OPTIONS
-  if (gTraceOptions->fTraceMeasures || gTraceOptions->fTracePasses) {
+  if (gTraceOptions ()->fTraceMeasures || gTraceOptions ()->fTracePasses) {
     fLogOutputStream <<
       endl <<
       "<!--=== measure '" << fCurrentMeasureNumber <<
@@ -5839,7 +5839,7 @@ void mxmlTree2MsrTranslator::visitStart (S_measure& elt)
         "\" is unknown";
       
       msrMusicXMLError (
-        gXml2lyOptions->fInputSourceName,
+        gXml2lyOptions ()->fInputSourceName,
         inputLineNumber,
         __FILE__, __LINE__,
         s.str ());
@@ -5870,19 +5870,19 @@ void mxmlTree2MsrTranslator::visitStart (S_measure& elt)
 /* JMI
   // is this measure number in the debug set?
 #ifdef TRACE_OPTIONS
-  if (gTraceOptions->fTraceDetailed) {
+  if (gTraceOptions ()->fTraceDetailed) {
     set<int>::const_iterator
       it =
-        gGeneralOptions->
+        gGeneralOptions ()->
           fTraceDetailedMeasureNumbersSet.find (fMeasuresCounter);
           
-    if (it != gTraceOptions->fTraceDetailedMeasureNumbersSet.end ()) {
+    if (it != gTraceOptions ()->fTraceDetailedMeasureNumbersSet.end ()) {
       // yes, activate detailed trace for it
-      gMusicXMLOptions = gMusicXMLOptionsWithDetailedTrace;
-      gGeneralOptions  = gGeneralOptionsWithDetailedTrace;
-      gMsrOptions      = gMsrOptionsWithDetailedTrace;
-      gLpsrOptions     = gLpsrOptionsWithDetailedTrace;
-      gLilypondOptions = gLilypondOptionsWithDetailedTrace;
+      gMusicXMLOptions () = gMusicXMLOptionsWithDetailedTrace ();
+      gGeneralOptions ()  = gGeneralOptionsWithDetailedTrace;
+      gMsrOptions ()      = gMsrOptionsWithDetailedTrace ();
+      gLpsrOptions ()     = gLpsrOptionsWithDetailedTrace ();
+      gLilypondOptions () = gLilypondOptionsWithDetailedTrace ();
     }
   }
 #endif
@@ -5894,7 +5894,7 @@ void mxmlTree2MsrTranslator::visitEnd (S_measure& elt)
   int inputLineNumber =
     elt->getInputLineNumber ();
 
-  if (gMusicXMLOptions->fTraceMusicXMLTreeVisitors) {
+  if (gMusicXMLOptions ()->fTraceMusicXMLTreeVisitors) {
     fLogOutputStream <<
       "--> End visiting S_measure" <<
       ", line " << inputLineNumber <<
@@ -5905,15 +5905,15 @@ void mxmlTree2MsrTranslator::visitEnd (S_measure& elt)
   if (fPendingGraceNotesGroup) {
 #ifdef TRACE_OPTIONS
     if (
-      gTraceOptions->fTraceGraceNotes
+      gTraceOptions ()->fTraceGraceNotes
         ||
-      gTraceOptions->fTraceNotes
+      gTraceOptions ()->fTraceNotes
     ) {
       fLogOutputStream <<
         endl <<
         endl <<
         "fCurrentGraceNotes IS NOT NULL at the end of measure '" << // JMI
-        elt->getAttributeValue ("number") <<
+        elt->getAttributeValue (attributeNames::number) <<
         "'" <<
         endl <<
         endl;
@@ -5970,7 +5970,7 @@ void mxmlTree2MsrTranslator::visitEnd (S_measure& elt)
         fCurrentMusicXMLVoiceNumber;
         
       msrInternalError (
-        gXml2lyOptions->fInputSourceName,
+        gXml2lyOptions ()->fInputSourceName,
         inputLineNumber,
         __FILE__, __LINE__,
         s.str ());
@@ -6012,15 +6012,15 @@ void mxmlTree2MsrTranslator::visitEnd (S_measure& elt)
   // so that the necessary staves/voices have been created
   if (fOnGoingMultipleRest) {
 #ifdef TRACE_OPTIONS
-    if (gTraceOptions->fTraceMultipleRests) {
+    if (gTraceOptions ()->fTraceMultipleRests) {
       fLogOutputStream <<
         "--> onGoingMultipleRest" <<
         endl <<
-        gTab << "fCurrentMultipleRestHasBeenCreated:" <<
+        gTab () << "fCurrentMultipleRestHasBeenCreated:" <<
         booleanAsString (
           fCurrentMultipleRestHasBeenCreated) <<
         endl <<
-        gTab << "fRemainingMultipleRestMeasuresNumber:" <<
+        gTab () << "fRemainingMultipleRestMeasuresNumber:" <<
         fRemainingMultipleRestMeasuresNumber <<
         endl <<
         endl;
@@ -6041,7 +6041,7 @@ void mxmlTree2MsrTranslator::visitEnd (S_measure& elt)
 
     if (fRemainingMultipleRestMeasuresNumber <= 0) {
       msrInternalError (
-        gXml2lyOptions->fInputSourceName,
+        gXml2lyOptions ()->fInputSourceName,
         inputLineNumber,
         __FILE__, __LINE__,
         "fRemainingMultipleRestMeasuresNumber problem");
@@ -6071,18 +6071,18 @@ void mxmlTree2MsrTranslator::visitEnd (S_measure& elt)
     }
 
 #ifdef TRACE_OPTIONS
-    if (gTraceOptions->fTraceMultipleRests) {
+    if (gTraceOptions ()->fTraceMultipleRests) {
       fLogOutputStream <<
         "<-- onGoingMultipleRest" <<
         endl <<
-        gTab << "fCurrentMultipleRestHasBeenCreated:" <<
+        gTab () << "fCurrentMultipleRestHasBeenCreated:" <<
         booleanAsString (
           fCurrentMultipleRestHasBeenCreated) <<
         endl <<
-        gTab << "fRemainingMultipleRestMeasuresNumber:" <<
+        gTab () << "fRemainingMultipleRestMeasuresNumber:" <<
         fRemainingMultipleRestMeasuresNumber <<
         endl <<
-        gTab << "fOnGoingMultipleRest:" <<
+        gTab () << "fOnGoingMultipleRest:" <<
         fOnGoingMultipleRest <<
         endl <<
         endl;
@@ -6092,11 +6092,11 @@ void mxmlTree2MsrTranslator::visitEnd (S_measure& elt)
 
 /* JMI
   // restore debug options in case they were set in visitStart()
-  gMusicXMLOptions = gMusicXMLOptionsUserChoices;
-  gGeneralOptions  = gGeneralOptionsUserChoices;
-  gMsrOptions      = gMsrOptionsUserChoices;
-  gLpsrOptions     = gLpsrOptionsUserChoices;
-  gLilypondOptions = gLilypondOptionsUserChoices;
+  gMusicXMLOptions () = gMusicXMLOptionsUserChoices ();
+  gGeneralOptions ()  = gGeneralOptionsUserChoices ();
+  gMsrOptions ()      = gMsrOptionsUserChoices ();
+  gLpsrOptions ()     = gLpsrOptionsUserChoices ();
+  gLilypondOptions () = gLilypondOptionsUserChoices ();
   */
 }
 
@@ -6106,7 +6106,7 @@ void mxmlTree2MsrTranslator::visitStart ( S_print& elt )
   int inputLineNumber =
     elt->getInputLineNumber ();
 
-  if (gMusicXMLOptions->fTraceMusicXMLTreeVisitors) {
+  if (gMusicXMLOptions ()->fTraceMusicXMLTreeVisitors) {
     fLogOutputStream <<
       "--> Start visiting S_print" <<
       ", line " << inputLineNumber <<
@@ -6128,7 +6128,7 @@ void mxmlTree2MsrTranslator::visitStart ( S_print& elt )
       
       // create a barNumberCheck
 #ifdef TRACE_OPTIONS
-      if (gTraceOptions->fTraceMeasures) {
+      if (gTraceOptions ()->fTraceMeasures) {
         fLogOutputStream << 
           "Creating a barnumber check, " <<
           "line = " << inputLineNumber <<
@@ -6158,7 +6158,7 @@ void mxmlTree2MsrTranslator::visitStart ( S_print& elt )
   
       // create a line break
 #ifdef TRACE_OPTIONS
-      if (gTraceOptions->fTraceMeasures) {
+      if (gTraceOptions ()->fTraceMeasures) {
         fLogOutputStream << 
           "Creating a line break, " <<
           "line = " << inputLineNumber << endl;
@@ -6188,7 +6188,7 @@ void mxmlTree2MsrTranslator::visitStart ( S_print& elt )
       "\" is unknown in '<print />', should be 'yes', 'no' or empty";
       
       msrMusicXMLError (
-        gXml2lyOptions->fInputSourceName,
+        gXml2lyOptions ()->fInputSourceName,
         inputLineNumber,
         __FILE__, __LINE__,
         s.str ());
@@ -6213,7 +6213,7 @@ void mxmlTree2MsrTranslator::visitStart ( S_print& elt )
   
       // create a page break
 #ifdef TRACE_OPTIONS
-      if (gTraceOptions->fTraceMeasures) {
+      if (gTraceOptions ()->fTraceMeasures) {
         fLogOutputStream << 
           "Creating a page break, " <<
           "line = " << inputLineNumber << endl;
@@ -6241,7 +6241,7 @@ void mxmlTree2MsrTranslator::visitStart ( S_print& elt )
       "\" is unknown in '<print />', should be 'yes', 'no' or empty";
       
       msrMusicXMLError (
-        gXml2lyOptions->fInputSourceName,
+        gXml2lyOptions ()->fInputSourceName,
         inputLineNumber,
         __FILE__, __LINE__,
         s.str ());
@@ -6262,7 +6262,7 @@ void mxmlTree2MsrTranslator::visitStart ( S_print& elt )
 //______________________________________________________________________________
 void mxmlTree2MsrTranslator::visitStart ( S_system_layout& elt ) 
 {
-  if (gMusicXMLOptions->fTraceMusicXMLTreeVisitors) {
+  if (gMusicXMLOptions ()->fTraceMusicXMLTreeVisitors) {
     fLogOutputStream <<
       "--> Start visiting S_system_layout" <<
       ", line " << elt->getInputLineNumber () <<
@@ -6294,7 +6294,7 @@ void mxmlTree2MsrTranslator::visitStart ( S_system_layout& elt )
   }
   else {
     msrMusicXMLError (
-      gXml2lyOptions->fInputSourceName,
+      gXml2lyOptions ()->fInputSourceName,
       inputLineNumber,
       __FILE__, __LINE__,
       "measure-numbering \"" + measureNumberingString + "\" is unknown");
@@ -6304,7 +6304,7 @@ void mxmlTree2MsrTranslator::visitStart ( S_system_layout& elt )
 
 void mxmlTree2MsrTranslator::visitStart ( S_measure_numbering& elt ) 
 {
-  if (gMusicXMLOptions->fTraceMusicXMLTreeVisitors) {
+  if (gMusicXMLOptions ()->fTraceMusicXMLTreeVisitors) {
     fLogOutputStream <<
       "--> Start visiting S_measure_numbering" <<
        ", line " << elt->getInputLineNumber () <<
@@ -6320,7 +6320,7 @@ void mxmlTree2MsrTranslator::visitStart ( S_barline& elt )
   int inputLineNumber =
     elt->getInputLineNumber ();
 
-  if (gMusicXMLOptions->fTraceMusicXMLTreeVisitors) {
+  if (gMusicXMLOptions ()->fTraceMusicXMLTreeVisitors) {
     fLogOutputStream <<
       "--> Start visiting S_barline" <<
       ", line " << inputLineNumber <<
@@ -6383,7 +6383,7 @@ void mxmlTree2MsrTranslator::visitStart ( S_barline& elt )
         "\" is unknown";
         
       msrMusicXMLError (
-        gXml2lyOptions->fInputSourceName,
+        gXml2lyOptions ()->fInputSourceName,
         inputLineNumber,
         __FILE__, __LINE__,
         s.str ());
@@ -6399,7 +6399,7 @@ void mxmlTree2MsrTranslator::visitStart ( S_bar_style& elt )
   int inputLineNumber =
     elt->getInputLineNumber ();
 
-  if (gMusicXMLOptions->fTraceMusicXMLTreeVisitors) {
+  if (gMusicXMLOptions ()->fTraceMusicXMLTreeVisitors) {
     fLogOutputStream <<
       "--> Start visiting S_bar_style" <<
       ", line " << inputLineNumber <<
@@ -6457,7 +6457,7 @@ void mxmlTree2MsrTranslator::visitStart ( S_bar_style& elt )
   }
   else {
     msrMusicXMLError (
-      gXml2lyOptions->fInputSourceName,
+      gXml2lyOptions ()->fInputSourceName,
       inputLineNumber,
       __FILE__, __LINE__,
       "bar-style \"" + barStyle + "\" is unknown");
@@ -6470,7 +6470,7 @@ void mxmlTree2MsrTranslator::visitStart ( S_segno& elt )
   int inputLineNumber =
     elt->getInputLineNumber ();
 
-  if (gMusicXMLOptions->fTraceMusicXMLTreeVisitors) {
+  if (gMusicXMLOptions ()->fTraceMusicXMLTreeVisitors) {
     fLogOutputStream <<
       "--> Start visiting S_segno" <<
       ", line " << inputLineNumber <<
@@ -6508,7 +6508,7 @@ void mxmlTree2MsrTranslator::visitStart ( S_coda& elt )
   int inputLineNumber =
     elt->getInputLineNumber ();
 
-  if (gMusicXMLOptions->fTraceMusicXMLTreeVisitors) {
+  if (gMusicXMLOptions ()->fTraceMusicXMLTreeVisitors) {
     fLogOutputStream <<
       "--> Start visiting S_coda" <<
       ", line " << inputLineNumber <<
@@ -6545,7 +6545,7 @@ void mxmlTree2MsrTranslator::visitStart ( S_eyeglasses& elt )
   int inputLineNumber =
     elt->getInputLineNumber ();
 
-  if (gMusicXMLOptions->fTraceMusicXMLTreeVisitors) {
+  if (gMusicXMLOptions ()->fTraceMusicXMLTreeVisitors) {
     fLogOutputStream <<
       "--> Start visiting S_eyeglasses" <<
       ", line " << inputLineNumber <<
@@ -6577,7 +6577,7 @@ void mxmlTree2MsrTranslator::visitStart ( S_pedal& elt )
   int inputLineNumber =
     elt->getInputLineNumber ();
 
-  if (gMusicXMLOptions->fTraceMusicXMLTreeVisitors) {
+  if (gMusicXMLOptions ()->fTraceMusicXMLTreeVisitors) {
     fLogOutputStream <<
       "--> Start visiting S_pedal" <<
       ", line " << inputLineNumber <<
@@ -6586,7 +6586,7 @@ void mxmlTree2MsrTranslator::visitStart ( S_pedal& elt )
 
   // type
   
-  string type = elt->getAttributeValue ("type");
+  string type = elt->getAttributeValue (attributeNames::type);
     
   msrPedal::msrPedalTypeKind pedalTypeKind = msrPedal::k_NoPedalType;
 
@@ -6608,7 +6608,7 @@ void mxmlTree2MsrTranslator::visitStart ( S_pedal& elt )
     s << "pedal type '" << type << "' is unknown";
     
     msrMusicXMLError (
-      gXml2lyOptions->fInputSourceName,
+      gXml2lyOptions ()->fInputSourceName,
       inputLineNumber,
       __FILE__, __LINE__,
       s.str ());
@@ -6635,7 +6635,7 @@ void mxmlTree2MsrTranslator::visitStart ( S_pedal& elt )
         "\" is unknown";
       
       msrMusicXMLError (
-        gXml2lyOptions->fInputSourceName,
+        gXml2lyOptions ()->fInputSourceName,
         inputLineNumber,
         __FILE__, __LINE__,
         s.str ());
@@ -6665,7 +6665,7 @@ void mxmlTree2MsrTranslator::visitStart ( S_pedal& elt )
         "\" is unknown";
       
       msrMusicXMLError (
-        gXml2lyOptions->fInputSourceName,
+        gXml2lyOptions ()->fInputSourceName,
         inputLineNumber,
         __FILE__, __LINE__,
         s.str ());
@@ -6701,7 +6701,7 @@ void mxmlTree2MsrTranslator::visitStart ( S_ending& elt )
   int inputLineNumber =
     elt->getInputLineNumber ();
 
-  if (gMusicXMLOptions->fTraceMusicXMLTreeVisitors) {
+  if (gMusicXMLOptions ()->fTraceMusicXMLTreeVisitors) {
     fLogOutputStream <<
       "--> Start visiting S_ending" <<
       ", line " << inputLineNumber <<
@@ -6712,11 +6712,11 @@ void mxmlTree2MsrTranslator::visitStart ( S_ending& elt )
 
   {
     fCurrentBarlineEndingNumber =
-      elt->getAttributeValue ("number"); // may be "1, 2"        
+      elt->getAttributeValue (attributeNames::number); // may be "1, 2"        
 
     if (! fCurrentBarlineEndingNumber.size ()) {
       msrMusicXMLWarning (
-        gXml2lyOptions->fInputSourceName,
+        gXml2lyOptions ()->fInputSourceName,
         inputLineNumber,
         "mandatory ending number is missing, assuming \"1\"");
 
@@ -6728,7 +6728,7 @@ void mxmlTree2MsrTranslator::visitStart ( S_ending& elt )
 
   {
     string type =
-      elt->getAttributeValue ("type");
+      elt->getAttributeValue (attributeNames::type);
         
     fCurrentBarlineEndingTypeKind =
       msrBarline::kBarlineEndingNone;
@@ -6753,7 +6753,7 @@ void mxmlTree2MsrTranslator::visitStart ( S_ending& elt )
         "\" is unknown";
       
       msrMusicXMLError (
-        gXml2lyOptions->fInputSourceName,
+        gXml2lyOptions ()->fInputSourceName,
         inputLineNumber,
         __FILE__, __LINE__,
         s.str ());
@@ -6767,7 +6767,7 @@ void mxmlTree2MsrTranslator::visitStart ( S_repeat& elt )
   int inputLineNumber =
     elt->getInputLineNumber ();
 
-  if (gMusicXMLOptions->fTraceMusicXMLTreeVisitors) {
+  if (gMusicXMLOptions ()->fTraceMusicXMLTreeVisitors) {
     fLogOutputStream <<
       "--> Start visiting S_repeat" <<
       ", line " << inputLineNumber <<
@@ -6777,7 +6777,7 @@ void mxmlTree2MsrTranslator::visitStart ( S_repeat& elt )
   // direction
 
   {
-    string direction = elt->getAttributeValue ("direction");
+    string direction = elt->getAttributeValue (attributeNames::direction);
   
     fCurrentBarlineRepeatDirectionKind =
       msrBarline::kBarlineRepeatDirectionNone;
@@ -6798,7 +6798,7 @@ void mxmlTree2MsrTranslator::visitStart ( S_repeat& elt )
         "\" is unknown";
       
       msrMusicXMLError (
-        gXml2lyOptions->fInputSourceName,
+        gXml2lyOptions ()->fInputSourceName,
         inputLineNumber,
         __FILE__, __LINE__,
         s.str ());
@@ -6842,7 +6842,7 @@ void mxmlTree2MsrTranslator::visitStart ( S_repeat& elt )
           "\" is unknown";
         
         msrMusicXMLError (
-          gXml2lyOptions->fInputSourceName,
+          gXml2lyOptions ()->fInputSourceName,
           inputLineNumber,
           __FILE__, __LINE__,
           s.str ());
@@ -6854,7 +6854,7 @@ void mxmlTree2MsrTranslator::visitStart ( S_repeat& elt )
 
   {
     fCurrentBarlineTimes =
-      elt->getAttributeIntValue ("times", 2); // default value JMI ???
+      elt->getAttributeIntValue (attributeNames::times, 2); // default value JMI ???
   }
 }
 
@@ -6864,7 +6864,7 @@ void mxmlTree2MsrTranslator::visitEnd ( S_barline& elt )
   int inputLineNumber =
     elt->getInputLineNumber ();
 
-  if (gMusicXMLOptions->fTraceMusicXMLTreeVisitors) {
+  if (gMusicXMLOptions ()->fTraceMusicXMLTreeVisitors) {
     fLogOutputStream <<
       "--> End visiting S_barline" <<
       ", line " << inputLineNumber <<
@@ -6896,18 +6896,18 @@ void mxmlTree2MsrTranslator::visitEnd ( S_barline& elt )
         fCurrentBarlineTimes);
 
 #ifdef TRACE_OPTIONS
-  if (gTraceOptions->fTraceBarlines) {
+  if (gTraceOptions ()->fTraceBarlines) {
     fLogOutputStream <<
       "Creating barline in part " <<
       fCurrentPart->getPartCombinedName () << ":" <<
       endl;
       
-    gIndenter++;
+    gIndenter ()++;
     
     fLogOutputStream <<
       barline;
       
-    gIndenter--;
+    gIndenter ()--;
   }
 #endif
 
@@ -7011,7 +7011,7 @@ void mxmlTree2MsrTranslator::visitEnd ( S_barline& elt )
         inputLineNumber);
 
 #ifdef TRACE_OPTIONS
-      if (gTraceOptions->fTraceRepeats) {
+      if (gTraceOptions ()->fTraceRepeats) {
         fLogOutputStream <<
           "Appending an implicit repeat to part " <<
           fCurrentPart->getPartCombinedName () <<
@@ -7064,18 +7064,18 @@ void mxmlTree2MsrTranslator::visitEnd ( S_barline& elt )
               
         // append the bar line to the current part
 #ifdef TRACE_OPTIONS
-        if (gTraceOptions->fTraceBarlines) {
+        if (gTraceOptions ()->fTraceBarlines) {
           fLogOutputStream <<
             "Appending a barline to part " <<
             fCurrentPart->getPartCombinedName () << ":" <<
             endl;
             
-          gIndenter++;
+          gIndenter ()++;
           
           fLogOutputStream <<
             barline;
             
-          gIndenter--;
+          gIndenter ()--;
         }
 #endif
       
@@ -7101,7 +7101,7 @@ void mxmlTree2MsrTranslator::visitEnd ( S_barline& elt )
       barline->asString ();
       
     msrInternalWarning (
-      gXml2lyOptions->fInputSourceName,
+      gXml2lyOptions ()->fInputSourceName,
       inputLineNumber,
       s.str ());
   }
@@ -7158,7 +7158,7 @@ void mxmlTree2MsrTranslator::visitStart ( S_note& elt )
   int inputLineNumber =
     elt->getInputLineNumber ();
 
-  if (gMusicXMLOptions->fTraceMusicXMLTreeVisitors) {
+  if (gMusicXMLOptions ()->fTraceMusicXMLTreeVisitors) {
     fLogOutputStream <<
       "--> Start visiting S_note" <<
       ", line " << inputLineNumber <<
@@ -7251,7 +7251,7 @@ void mxmlTree2MsrTranslator::visitStart ( S_note& elt )
   
   // note print kind
   
-  string notePrintObject = elt->getAttributeValue ("print-object");
+  string notePrintObject = elt->getAttributeValue (attributeNames::print_object);
   
   fCurrentNotePrintKind = msrNote::kNotePrintYes; // default value
       
@@ -7268,7 +7268,7 @@ void mxmlTree2MsrTranslator::visitStart ( S_note& elt )
         "\" is unknown";
       
       msrMusicXMLError (
-        gXml2lyOptions->fInputSourceName,
+        gXml2lyOptions ()->fInputSourceName,
         inputLineNumber,
         __FILE__, __LINE__,
         s.str ());
@@ -7284,7 +7284,7 @@ void mxmlTree2MsrTranslator::visitStart ( S_step& elt )
   int inputLineNumber =
     elt->getInputLineNumber ();
 
-  if (gMusicXMLOptions->fTraceMusicXMLTreeVisitors) {
+  if (gMusicXMLOptions ()->fTraceMusicXMLTreeVisitors) {
     fLogOutputStream <<
       "--> Start visiting S_step" <<
       ", line " << inputLineNumber <<
@@ -7306,7 +7306,7 @@ void mxmlTree2MsrTranslator::visitStart ( S_alter& elt)
   int inputLineNumber =
     elt->getInputLineNumber ();
 
-  if (gMusicXMLOptions->fTraceMusicXMLTreeVisitors) {
+  if (gMusicXMLOptions ()->fTraceMusicXMLTreeVisitors) {
     fLogOutputStream <<
       "--> Start visiting S_alter" <<
       ", line " << inputLineNumber <<
@@ -7327,7 +7327,7 @@ void mxmlTree2MsrTranslator::visitStart ( S_alter& elt)
       "' should be -3, -2, -1.5, -1, -0.5, 0, +0.5, +1, +1.5, +2 or +3";
       
     msrMusicXMLError (
-      gXml2lyOptions->fInputSourceName,
+      gXml2lyOptions ()->fInputSourceName,
       inputLineNumber,
       __FILE__, __LINE__,
       s.str ());
@@ -7336,7 +7336,7 @@ void mxmlTree2MsrTranslator::visitStart ( S_alter& elt)
 
 void mxmlTree2MsrTranslator::visitStart ( S_octave& elt)
 {
-  if (gMusicXMLOptions->fTraceMusicXMLTreeVisitors) {
+  if (gMusicXMLOptions ()->fTraceMusicXMLTreeVisitors) {
     fLogOutputStream <<
       "--> Start visiting S_octave" <<
       ", line " << elt->getInputLineNumber () <<
@@ -7353,7 +7353,7 @@ void mxmlTree2MsrTranslator::visitStart ( S_octave& elt)
       "' is not in the 0..9 range, '0' is assumed";
     
     msrMusicXMLWarning (
-      gXml2lyOptions->fInputSourceName,
+      gXml2lyOptions ()->fInputSourceName,
       elt->getInputLineNumber (),
       s.str ());
 
@@ -7366,7 +7366,7 @@ void mxmlTree2MsrTranslator::visitStart ( S_duration& elt )
   int inputLineNumber =
     elt->getInputLineNumber ();
 
-  if (gMusicXMLOptions->fTraceMusicXMLTreeVisitors) {
+  if (gMusicXMLOptions ()->fTraceMusicXMLTreeVisitors) {
     fLogOutputStream <<
       "--> Start visiting S_duration" <<
       ", line " << inputLineNumber <<
@@ -7376,7 +7376,7 @@ void mxmlTree2MsrTranslator::visitStart ( S_duration& elt )
   int duration = (int)(*elt); // divisions
 
 #ifdef TRACE_OPTIONS
-  if (gTraceOptions->fTraceNotesDetails) {
+  if (gTraceOptions ()->fTraceNotesDetails) {
     fLogOutputStream <<
       "Note duration: " << duration <<
       endl;
@@ -7398,7 +7398,7 @@ void mxmlTree2MsrTranslator::visitStart ( S_duration& elt )
   else if (fOnGoingNote) {
   
 #ifdef TRACE_OPTIONS
-    if (gTraceOptions->fTraceNotesDetails) {
+    if (gTraceOptions ()->fTraceNotesDetails) {
       fLogOutputStream <<
         "fCurrentDivisionsPerQuarterNote: " <<
         fCurrentDivisionsPerQuarterNote <<
@@ -7415,7 +7415,7 @@ void mxmlTree2MsrTranslator::visitStart ( S_duration& elt )
     fCurrentNoteSoundingWholeNotesFromDuration.rationalise ();
 
 #ifdef TRACE_OPTIONS
-    if (gTraceOptions->fTraceNotesDetails) {
+    if (gTraceOptions ()->fTraceNotesDetails) {
       fLogOutputStream <<
         "fCurrentNoteSoundingWholeNotesFromDuration: " <<
         fCurrentNoteSoundingWholeNotesFromDuration <<
@@ -7434,7 +7434,7 @@ void mxmlTree2MsrTranslator::visitStart ( S_duration& elt )
   else if (fOnGoingFiguredBass) {
 
 #ifdef TRACE_OPTIONS
-    if (gTraceOptions->fTraceFiguredBass) {
+    if (gTraceOptions ()->fTraceFiguredBass) {
       fLogOutputStream <<
         "fCurrentDivisionsPerQuarterNote: " <<
         fCurrentDivisionsPerQuarterNote <<
@@ -7451,7 +7451,7 @@ void mxmlTree2MsrTranslator::visitStart ( S_duration& elt )
     fCurrentFiguredBassSoundingWholeNotes.rationalise ();
 
 #ifdef TRACE_OPTIONS
-    if (gTraceOptions->fTraceFiguredBass) {
+    if (gTraceOptions ()->fTraceFiguredBass) {
       fLogOutputStream <<
         "fCurrentFiguredBassSoundingWholeNotes: " <<
         fCurrentFiguredBassSoundingWholeNotes <<
@@ -7467,7 +7467,7 @@ void mxmlTree2MsrTranslator::visitStart ( S_duration& elt )
     s << "duration " << duration << " is out of context";
     
     msrMusicXMLError (
-      gXml2lyOptions->fInputSourceName,
+      gXml2lyOptions ()->fInputSourceName,
       inputLineNumber,
       __FILE__, __LINE__,
       s.str ());
@@ -7478,7 +7478,7 @@ void mxmlTree2MsrTranslator::visitStart ( S_duration& elt )
 
 void mxmlTree2MsrTranslator::visitStart ( S_instrument& elt )
 {
-  if (gMusicXMLOptions->fTraceMusicXMLTreeVisitors) {
+  if (gMusicXMLOptions ()->fTraceMusicXMLTreeVisitors) {
     fLogOutputStream <<
       "--> Start visiting S_instrument" <<
       ", line " << elt->getInputLineNumber () <<
@@ -7488,12 +7488,12 @@ void mxmlTree2MsrTranslator::visitStart ( S_instrument& elt )
 /*
   <instrument id="P2-I4"/>
 */
- string id = elt->getAttributeValue ("id"); // JMI
+ string id = elt->getAttributeValue (attributeNames::id); // JMI
 }
        
 void mxmlTree2MsrTranslator::visitStart ( S_dot& elt )
 {
-  if (gMusicXMLOptions->fTraceMusicXMLTreeVisitors) {
+  if (gMusicXMLOptions ()->fTraceMusicXMLTreeVisitors) {
     fLogOutputStream <<
       "--> Start visiting S_dot" <<
       ", line " << elt->getInputLineNumber () <<
@@ -7508,7 +7508,7 @@ void mxmlTree2MsrTranslator::visitStart ( S_type& elt )
   int inputLineNumber =
     elt->getInputLineNumber ();
 
-  if (gMusicXMLOptions->fTraceMusicXMLTreeVisitors) {
+  if (gMusicXMLOptions ()->fTraceMusicXMLTreeVisitors) {
     fLogOutputStream <<
       "--> Start visiting S_type" <<
       ", line " << inputLineNumber <<
@@ -7532,7 +7532,7 @@ void mxmlTree2MsrTranslator::visitStart ( S_type& elt )
   // size
   
   {
-    string noteTypeSize = elt->getAttributeValue ("size");
+    string noteTypeSize = elt->getAttributeValue (attributeNames::size);
   
     if (noteTypeSize == "full") {
       // a regular note
@@ -7543,7 +7543,7 @@ void mxmlTree2MsrTranslator::visitStart ( S_type& elt )
     else {
       if (noteTypeSize.size ()) {
         msrMusicXMLError (
-          gXml2lyOptions->fInputSourceName,
+          gXml2lyOptions ()->fInputSourceName,
           inputLineNumber,
           __FILE__, __LINE__,
             "note type size \"" + noteTypeSize + "\" is unknown");
@@ -7552,7 +7552,7 @@ void mxmlTree2MsrTranslator::visitStart ( S_type& elt )
   }
   
 #ifdef TRACE_OPTIONS
-  if (gTraceOptions->fTraceNotesDetails) {
+  if (gTraceOptions ()->fTraceNotesDetails) {
     /* JMI
     fLogOutputStream <<
       "noteType: \"" <<
@@ -7573,7 +7573,7 @@ void mxmlTree2MsrTranslator::visitStart ( S_notehead& elt )
   int inputLineNumber =
     elt->getInputLineNumber ();
 
-  if (gMusicXMLOptions->fTraceMusicXMLTreeVisitors) {
+  if (gMusicXMLOptions ()->fTraceMusicXMLTreeVisitors) {
     fLogOutputStream <<
       "--> Start visiting S_notehead" <<
       ", line " << inputLineNumber <<
@@ -7643,7 +7643,7 @@ void mxmlTree2MsrTranslator::visitStart ( S_notehead& elt )
         "\" is unknown";
   
       msrMusicXMLError (
-        gXml2lyOptions->fInputSourceName,
+        gXml2lyOptions ()->fInputSourceName,
         inputLineNumber,
         __FILE__, __LINE__,
         s.str ());
@@ -7668,7 +7668,7 @@ void mxmlTree2MsrTranslator::visitStart ( S_notehead& elt )
           "\" is unknown";
         
         msrMusicXMLError (
-          gXml2lyOptions->fInputSourceName,
+          gXml2lyOptions ()->fInputSourceName,
           inputLineNumber,
           __FILE__, __LINE__,
           s.str ());
@@ -7694,7 +7694,7 @@ void mxmlTree2MsrTranslator::visitStart ( S_notehead& elt )
           "\" is unknown";
         
         msrMusicXMLError (
-          gXml2lyOptions->fInputSourceName,
+          gXml2lyOptions ()->fInputSourceName,
           inputLineNumber,
           __FILE__, __LINE__,
           s.str ());
@@ -7708,7 +7708,7 @@ void mxmlTree2MsrTranslator::visitStart ( S_accidental& elt ) // JMI
   int inputLineNumber =
     elt->getInputLineNumber ();
 
-  if (gMusicXMLOptions->fTraceMusicXMLTreeVisitors) {
+  if (gMusicXMLOptions ()->fTraceMusicXMLTreeVisitors) {
     fLogOutputStream <<
       "--> Start visiting S_accidental" <<
       ", line " << inputLineNumber <<
@@ -7800,7 +7800,7 @@ void mxmlTree2MsrTranslator::visitStart ( S_accidental& elt ) // JMI
           "\" is unknown";
         
         msrMusicXMLError (
-      gXml2lyOptions->fInputSourceName,
+      gXml2lyOptions ()->fInputSourceName,
       inputLineNumber,
       __FILE__, __LINE__,
           s.str ());
@@ -7831,7 +7831,7 @@ void mxmlTree2MsrTranslator::visitStart ( S_accidental& elt ) // JMI
           "\" is unknown";
         
         msrMusicXMLError (
-      gXml2lyOptions->fInputSourceName,
+      gXml2lyOptions ()->fInputSourceName,
       inputLineNumber,
       __FILE__, __LINE__,
           s.str ());
@@ -7862,7 +7862,7 @@ void mxmlTree2MsrTranslator::visitStart ( S_accidental& elt ) // JMI
           "\" is unknown";
         
         msrMusicXMLError (
-          gXml2lyOptions->fInputSourceName,
+          gXml2lyOptions ()->fInputSourceName,
           inputLineNumber,
           __FILE__, __LINE__,
           s.str ());
@@ -7876,7 +7876,7 @@ void mxmlTree2MsrTranslator::visitStart ( S_stem& elt )
   int inputLineNumber =
     elt->getInputLineNumber ();
 
-  if (gMusicXMLOptions->fTraceMusicXMLTreeVisitors) {
+  if (gMusicXMLOptions ()->fTraceMusicXMLTreeVisitors) {
     fLogOutputStream <<
       "--> Start visiting S_stem" <<
       ", line " << inputLineNumber <<
@@ -7907,7 +7907,7 @@ void mxmlTree2MsrTranslator::visitStart ( S_stem& elt )
       "\" is unknown";
       
     msrMusicXMLError (
-      gXml2lyOptions->fInputSourceName,
+      gXml2lyOptions ()->fInputSourceName,
       inputLineNumber,
       __FILE__, __LINE__,
       s.str ());
@@ -7924,7 +7924,7 @@ void mxmlTree2MsrTranslator::visitStart ( S_beam& elt )
   int inputLineNumber =
     elt->getInputLineNumber ();
 
-  if (gMusicXMLOptions->fTraceMusicXMLTreeVisitors) {
+  if (gMusicXMLOptions ()->fTraceMusicXMLTreeVisitors) {
     fLogOutputStream <<
       "--> Start visiting S_beam" <<
       ", line " << inputLineNumber <<
@@ -7960,7 +7960,7 @@ void mxmlTree2MsrTranslator::visitStart ( S_beam& elt )
       "\"" << "is not known";
       
     msrMusicXMLError (
-      gXml2lyOptions->fInputSourceName,
+      gXml2lyOptions ()->fInputSourceName,
       inputLineNumber,
       __FILE__, __LINE__,
       s.str ());
@@ -7969,7 +7969,7 @@ void mxmlTree2MsrTranslator::visitStart ( S_beam& elt )
   // number
   
   fCurrentBeamNumber = 
-    elt->getAttributeIntValue ("number", 0);
+    elt->getAttributeIntValue (attributeNames::number, 0);
 
   S_msrBeam
     beam =
@@ -7984,7 +7984,7 @@ void mxmlTree2MsrTranslator::visitStart ( S_beam& elt )
 //______________________________________________________________________________
 void mxmlTree2MsrTranslator::visitStart ( S_measure_style& elt )
 {
-  if (gMusicXMLOptions->fTraceMusicXMLTreeVisitors) {
+  if (gMusicXMLOptions ()->fTraceMusicXMLTreeVisitors) {
     fLogOutputStream <<
       "--> Start visiting S_measure_style" <<
       ", line " << elt->getInputLineNumber () <<
@@ -7994,7 +7994,7 @@ void mxmlTree2MsrTranslator::visitStart ( S_measure_style& elt )
        
 void mxmlTree2MsrTranslator::visitStart ( S_beat_repeat& elt )
 {
-  if (gMusicXMLOptions->fTraceMusicXMLTreeVisitors) {
+  if (gMusicXMLOptions ()->fTraceMusicXMLTreeVisitors) {
     fLogOutputStream <<
       "--> Start visiting S_beat_repeat" <<
       ", line " << elt->getInputLineNumber () <<
@@ -8016,7 +8016,7 @@ void mxmlTree2MsrTranslator::visitStart ( S_beat_repeat& elt )
     s << "beat repeat use dots " << beatRepeatUseDots << " is unknown";
     
     msrMusicXMLError (
-      gXml2lyOptions->fInputSourceName,
+      gXml2lyOptions ()->fInputSourceName,
       inputLineNumber,
       __FILE__, __LINE__,
       s.str ());
@@ -8029,7 +8029,7 @@ void mxmlTree2MsrTranslator::visitStart ( S_measure_repeat& elt )
   int inputLineNumber =
     elt->getInputLineNumber ();
 
-  if (gMusicXMLOptions->fTraceMusicXMLTreeVisitors) {
+  if (gMusicXMLOptions ()->fTraceMusicXMLTreeVisitors) {
     fLogOutputStream <<
       "--> Start visiting S_measure_repeat" <<
       ", line " << inputLineNumber <<
@@ -8056,7 +8056,7 @@ void mxmlTree2MsrTranslator::visitStart ( S_measure_repeat& elt )
   // type
   
   string measuresRepeatType =
-    elt->getAttributeValue ("type");
+    elt->getAttributeValue (attributeNames::type);
 
   fCurrentMeasuresRepeatKind = msrMeasuresRepeat::k_NoMeasuresRepeat;
   
@@ -8086,7 +8086,7 @@ void mxmlTree2MsrTranslator::visitStart ( S_measure_repeat& elt )
       "\" is unknown";
     
     msrMusicXMLError (
-      gXml2lyOptions->fInputSourceName,
+      gXml2lyOptions ()->fInputSourceName,
       inputLineNumber,
       __FILE__, __LINE__,
       s.str ());
@@ -8098,7 +8098,7 @@ void mxmlTree2MsrTranslator::visitStart ( S_multiple_rest& elt )
   int inputLineNumber =
     elt->getInputLineNumber ();
 
-  if (gMusicXMLOptions->fTraceMusicXMLTreeVisitors) {
+  if (gMusicXMLOptions ()->fTraceMusicXMLTreeVisitors) {
     fLogOutputStream <<
       "--> Start visiting S_multiple_rest" <<
       ", line " << inputLineNumber <<
@@ -8125,7 +8125,7 @@ void mxmlTree2MsrTranslator::visitStart ( S_multiple_rest& elt )
         " is unknown";
       
       msrMusicXMLError (
-        gXml2lyOptions->fInputSourceName,
+        gXml2lyOptions ()->fInputSourceName,
         inputLineNumber,
         __FILE__, __LINE__,
         s.str ());
@@ -8147,7 +8147,7 @@ void mxmlTree2MsrTranslator::visitStart ( S_slash& elt )
   int inputLineNumber =
     elt->getInputLineNumber ();
 
-  if (gMusicXMLOptions->fTraceMusicXMLTreeVisitors) {
+  if (gMusicXMLOptions ()->fTraceMusicXMLTreeVisitors) {
     fLogOutputStream <<
       "--> Start visiting S_slash" <<
       ", line " << inputLineNumber <<
@@ -8156,7 +8156,7 @@ void mxmlTree2MsrTranslator::visitStart ( S_slash& elt )
 
   // type
   
-  string slashType = elt->getAttributeValue ("type");
+  string slashType = elt->getAttributeValue (attributeNames::type);
 
   if      (slashType == "start")
     fCurrentSlashTypeKind = kSlashTypeStart;
@@ -8170,7 +8170,7 @@ void mxmlTree2MsrTranslator::visitStart ( S_slash& elt )
       "\" is unknown";
     
     msrMusicXMLError (
-      gXml2lyOptions->fInputSourceName,
+      gXml2lyOptions ()->fInputSourceName,
       inputLineNumber,
       __FILE__, __LINE__,
       s.str ());
@@ -8193,7 +8193,7 @@ void mxmlTree2MsrTranslator::visitStart ( S_slash& elt )
         "\" is unknown";
       
       msrMusicXMLError (
-        gXml2lyOptions->fInputSourceName,
+        gXml2lyOptions ()->fInputSourceName,
         inputLineNumber,
         __FILE__, __LINE__,
         s.str ());
@@ -8217,7 +8217,7 @@ void mxmlTree2MsrTranslator::visitStart ( S_slash& elt )
         "\" is unknown";
       
       msrMusicXMLError (
-        gXml2lyOptions->fInputSourceName,
+        gXml2lyOptions ()->fInputSourceName,
         inputLineNumber,
         __FILE__, __LINE__,
         s.str ());
@@ -8232,7 +8232,7 @@ void mxmlTree2MsrTranslator::visitStart ( S_slash_type& elt )
   int inputLineNumber =
     elt->getInputLineNumber ();
 
-  if (gMusicXMLOptions->fTraceMusicXMLTreeVisitors) {
+  if (gMusicXMLOptions ()->fTraceMusicXMLTreeVisitors) {
     fLogOutputStream <<
       "--> Start visiting S_slash_type" <<
       ", line " << inputLineNumber <<
@@ -8249,7 +8249,7 @@ void mxmlTree2MsrTranslator::visitStart ( S_slash_type& elt )
         
   // size
   
-  string slashTypeSize = elt->getAttributeValue ("size");
+  string slashTypeSize = elt->getAttributeValue (attributeNames::size);
 
   if (slashTypeSize == "cue") { // USE IT! JMI ???
   }
@@ -8257,7 +8257,7 @@ void mxmlTree2MsrTranslator::visitStart ( S_slash_type& elt )
   else {
     if (slashTypeSize.size ()) {
       msrMusicXMLError (
-        gXml2lyOptions->fInputSourceName,
+        gXml2lyOptions ()->fInputSourceName,
         inputLineNumber,
         __FILE__, __LINE__,
           "slash type size \"" + slashTypeSize + "\" is unknown");
@@ -8265,7 +8265,7 @@ void mxmlTree2MsrTranslator::visitStart ( S_slash_type& elt )
   }
 
 #ifdef TRACE_OPTIONS
-  if (gTraceOptions->fTraceSlashes) {
+  if (gTraceOptions ()->fTraceSlashes) {
     fLogOutputStream <<
       "slashType: \"" <<
       slashType <<
@@ -8281,7 +8281,7 @@ void mxmlTree2MsrTranslator::visitStart ( S_slash_type& elt )
 
 void mxmlTree2MsrTranslator::visitStart ( S_slash_dot& elt )
 {
-  if (gMusicXMLOptions->fTraceMusicXMLTreeVisitors) {
+  if (gMusicXMLOptions ()->fTraceMusicXMLTreeVisitors) {
     fLogOutputStream <<
       "--> Start visiting S_slash_dot" <<
       ", line " << elt->getInputLineNumber () <<
@@ -8296,7 +8296,7 @@ void mxmlTree2MsrTranslator::visitEnd ( S_slash& elt )
   int inputLineNumber =
     elt->getInputLineNumber ();
 
-  if (gMusicXMLOptions->fTraceMusicXMLTreeVisitors) {
+  if (gMusicXMLOptions ()->fTraceMusicXMLTreeVisitors) {
     fLogOutputStream <<
       "--> End visiting S_slash" <<
       ", line " << inputLineNumber <<
@@ -8317,7 +8317,7 @@ void mxmlTree2MsrTranslator::visitEnd ( S_slash& elt )
 //______________________________________________________________________________
 void mxmlTree2MsrTranslator::visitStart ( S_articulations& elt )
 {
-  if (gMusicXMLOptions->fTraceMusicXMLTreeVisitors) {
+  if (gMusicXMLOptions ()->fTraceMusicXMLTreeVisitors) {
     fLogOutputStream <<
       "--> Start visiting S_articulations" <<
       ", line " << elt->getInputLineNumber () <<
@@ -8330,7 +8330,7 @@ void mxmlTree2MsrTranslator::visitStart ( S_accent& elt )
   int inputLineNumber =
     elt->getInputLineNumber ();
 
-  if (gMusicXMLOptions->fTraceMusicXMLTreeVisitors) {
+  if (gMusicXMLOptions ()->fTraceMusicXMLTreeVisitors) {
     fLogOutputStream <<
       "--> Start visiting S_accent" <<
       ", line " << inputLineNumber <<
@@ -8339,7 +8339,7 @@ void mxmlTree2MsrTranslator::visitStart ( S_accent& elt )
 
   // placement
   
-  string placementString = elt->getAttributeValue ("placement");
+  string placementString = elt->getAttributeValue (attributeNames::placement);
 
   msrPlacementKind placementKind = kPlacementNone;
 
@@ -8356,7 +8356,7 @@ void mxmlTree2MsrTranslator::visitStart ( S_accent& elt )
         "\" is unknown";
       
       msrMusicXMLError (
-        gXml2lyOptions->fInputSourceName,
+        gXml2lyOptions ()->fInputSourceName,
         inputLineNumber,
         __FILE__, __LINE__,
         s.str ());    
@@ -8379,7 +8379,7 @@ void mxmlTree2MsrTranslator::visitStart ( S_breath_mark& elt )
   int inputLineNumber =
     elt->getInputLineNumber ();
 
-  if (gMusicXMLOptions->fTraceMusicXMLTreeVisitors) {
+  if (gMusicXMLOptions ()->fTraceMusicXMLTreeVisitors) {
     fLogOutputStream <<
       "--> Start visiting S_breath_mark" <<
       ", line " << inputLineNumber <<
@@ -8388,7 +8388,7 @@ void mxmlTree2MsrTranslator::visitStart ( S_breath_mark& elt )
 
   // placement
   
-  string placementString = elt->getAttributeValue ("placement");
+  string placementString = elt->getAttributeValue (attributeNames::placement);
 
   msrPlacementKind placementKind = kPlacementNone;
 
@@ -8405,7 +8405,7 @@ void mxmlTree2MsrTranslator::visitStart ( S_breath_mark& elt )
         "\" is unknown";
       
       msrMusicXMLError (
-        gXml2lyOptions->fInputSourceName,
+        gXml2lyOptions ()->fInputSourceName,
         inputLineNumber,
         __FILE__, __LINE__,
         s.str ());    
@@ -8428,7 +8428,7 @@ void mxmlTree2MsrTranslator::visitStart ( S_caesura& elt )
   int inputLineNumber =
     elt->getInputLineNumber ();
 
-  if (gMusicXMLOptions->fTraceMusicXMLTreeVisitors) {
+  if (gMusicXMLOptions ()->fTraceMusicXMLTreeVisitors) {
     fLogOutputStream <<
       "--> Start visiting S_caesura" <<
       ", line " << inputLineNumber <<
@@ -8437,7 +8437,7 @@ void mxmlTree2MsrTranslator::visitStart ( S_caesura& elt )
 
   // placement
   
-  string placementString = elt->getAttributeValue ("placement");
+  string placementString = elt->getAttributeValue (attributeNames::placement);
 
   msrPlacementKind placementKind = kPlacementNone;
 
@@ -8454,7 +8454,7 @@ void mxmlTree2MsrTranslator::visitStart ( S_caesura& elt )
         "\" is unknown";
       
       msrMusicXMLError (
-        gXml2lyOptions->fInputSourceName,
+        gXml2lyOptions ()->fInputSourceName,
         inputLineNumber,
         __FILE__, __LINE__,
         s.str ());    
@@ -8477,7 +8477,7 @@ void mxmlTree2MsrTranslator::visitStart ( S_spiccato& elt )
   int inputLineNumber =
     elt->getInputLineNumber ();
 
-  if (gMusicXMLOptions->fTraceMusicXMLTreeVisitors) {
+  if (gMusicXMLOptions ()->fTraceMusicXMLTreeVisitors) {
     fLogOutputStream <<
       "--> Start visiting S_spiccato" <<
       ", line " << inputLineNumber <<
@@ -8486,7 +8486,7 @@ void mxmlTree2MsrTranslator::visitStart ( S_spiccato& elt )
 
   // placement
   
-  string placementString = elt->getAttributeValue ("placement");
+  string placementString = elt->getAttributeValue (attributeNames::placement);
 
   msrPlacementKind placementKind = kPlacementNone;
 
@@ -8503,7 +8503,7 @@ void mxmlTree2MsrTranslator::visitStart ( S_spiccato& elt )
         "\" is unknown";
       
       msrMusicXMLError (
-        gXml2lyOptions->fInputSourceName,
+        gXml2lyOptions ()->fInputSourceName,
         inputLineNumber,
         __FILE__, __LINE__,
         s.str ());    
@@ -8526,7 +8526,7 @@ void mxmlTree2MsrTranslator::visitStart ( S_staccato& elt )
   int inputLineNumber =
     elt->getInputLineNumber ();
 
-  if (gMusicXMLOptions->fTraceMusicXMLTreeVisitors) {
+  if (gMusicXMLOptions ()->fTraceMusicXMLTreeVisitors) {
     fLogOutputStream <<
       "--> Start visiting S_staccato" <<
       ", line " << inputLineNumber <<
@@ -8535,7 +8535,7 @@ void mxmlTree2MsrTranslator::visitStart ( S_staccato& elt )
 
   // placement
   
-  string placementString = elt->getAttributeValue ("placement");
+  string placementString = elt->getAttributeValue (attributeNames::placement);
 
   msrPlacementKind placementKind = kPlacementNone;
 
@@ -8552,7 +8552,7 @@ void mxmlTree2MsrTranslator::visitStart ( S_staccato& elt )
         "\" is unknown";
       
       msrMusicXMLError (
-        gXml2lyOptions->fInputSourceName,
+        gXml2lyOptions ()->fInputSourceName,
         inputLineNumber,
         __FILE__, __LINE__,
         s.str ());    
@@ -8575,7 +8575,7 @@ void mxmlTree2MsrTranslator::visitStart ( S_staccatissimo& elt )
   int inputLineNumber =
     elt->getInputLineNumber ();
 
-  if (gMusicXMLOptions->fTraceMusicXMLTreeVisitors) {
+  if (gMusicXMLOptions ()->fTraceMusicXMLTreeVisitors) {
     fLogOutputStream <<
       "--> Start visiting S_staccatissimo" <<
       ", line " << inputLineNumber <<
@@ -8584,7 +8584,7 @@ void mxmlTree2MsrTranslator::visitStart ( S_staccatissimo& elt )
 
   // placement
   
-  string placementString = elt->getAttributeValue ("placement");
+  string placementString = elt->getAttributeValue (attributeNames::placement);
 
   msrPlacementKind placementKind = kPlacementNone;
 
@@ -8601,7 +8601,7 @@ void mxmlTree2MsrTranslator::visitStart ( S_staccatissimo& elt )
         "\" is unknown";
       
       msrMusicXMLError (
-        gXml2lyOptions->fInputSourceName,
+        gXml2lyOptions ()->fInputSourceName,
         inputLineNumber,
         __FILE__, __LINE__,
         s.str ());    
@@ -8624,7 +8624,7 @@ void mxmlTree2MsrTranslator::visitStart ( S_stress& elt )
   int inputLineNumber =
     elt->getInputLineNumber ();
 
-  if (gMusicXMLOptions->fTraceMusicXMLTreeVisitors) {
+  if (gMusicXMLOptions ()->fTraceMusicXMLTreeVisitors) {
     fLogOutputStream <<
       "--> Start visiting S_stress" <<
       ", line " << inputLineNumber <<
@@ -8633,7 +8633,7 @@ void mxmlTree2MsrTranslator::visitStart ( S_stress& elt )
 
   // placement
   
-  string placementString = elt->getAttributeValue ("placement");
+  string placementString = elt->getAttributeValue (attributeNames::placement);
 
   msrPlacementKind placementKind = kPlacementNone;
 
@@ -8650,7 +8650,7 @@ void mxmlTree2MsrTranslator::visitStart ( S_stress& elt )
         "\" is unknown";
       
       msrMusicXMLError (
-        gXml2lyOptions->fInputSourceName,
+        gXml2lyOptions ()->fInputSourceName,
         inputLineNumber,
         __FILE__, __LINE__,
         s.str ());    
@@ -8673,7 +8673,7 @@ void mxmlTree2MsrTranslator::visitStart ( S_unstress& elt )
    int inputLineNumber =
     elt->getInputLineNumber ();
 
- if (gMusicXMLOptions->fTraceMusicXMLTreeVisitors) {
+ if (gMusicXMLOptions ()->fTraceMusicXMLTreeVisitors) {
     fLogOutputStream <<
       "--> Start visiting S_unstress" <<
       ", line " << inputLineNumber <<
@@ -8682,7 +8682,7 @@ void mxmlTree2MsrTranslator::visitStart ( S_unstress& elt )
 
   // placement
   
-  string placementString = elt->getAttributeValue ("placement");
+  string placementString = elt->getAttributeValue (attributeNames::placement);
 
   msrPlacementKind placementKind = kPlacementNone;
 
@@ -8699,7 +8699,7 @@ void mxmlTree2MsrTranslator::visitStart ( S_unstress& elt )
         "\" is unknown";
       
       msrMusicXMLError (
-        gXml2lyOptions->fInputSourceName,
+        gXml2lyOptions ()->fInputSourceName,
         inputLineNumber,
         __FILE__, __LINE__,
         s.str ());    
@@ -8722,7 +8722,7 @@ void mxmlTree2MsrTranslator::visitStart ( S_detached_legato& elt )
   int inputLineNumber =
     elt->getInputLineNumber ();
 
- if (gMusicXMLOptions->fTraceMusicXMLTreeVisitors) {
+ if (gMusicXMLOptions ()->fTraceMusicXMLTreeVisitors) {
     fLogOutputStream <<
       "--> Start visiting S_detached_legato" <<
       ", line " << inputLineNumber <<
@@ -8731,7 +8731,7 @@ void mxmlTree2MsrTranslator::visitStart ( S_detached_legato& elt )
     
   // placement
   
-  string placementString = elt->getAttributeValue ("placement");
+  string placementString = elt->getAttributeValue (attributeNames::placement);
 
   msrPlacementKind placementKind = kPlacementNone;
 
@@ -8748,7 +8748,7 @@ void mxmlTree2MsrTranslator::visitStart ( S_detached_legato& elt )
         "\" is unknown";
       
       msrMusicXMLError (
-        gXml2lyOptions->fInputSourceName,
+        gXml2lyOptions ()->fInputSourceName,
         inputLineNumber,
         __FILE__, __LINE__,
         s.str ());    
@@ -8771,7 +8771,7 @@ void mxmlTree2MsrTranslator::visitStart ( S_strong_accent& elt )
   int inputLineNumber =
     elt->getInputLineNumber ();
 
-  if (gMusicXMLOptions->fTraceMusicXMLTreeVisitors) {
+  if (gMusicXMLOptions ()->fTraceMusicXMLTreeVisitors) {
     fLogOutputStream <<
       "--> Start visiting S_strong_accent" <<
       ", line " << inputLineNumber <<
@@ -8780,7 +8780,7 @@ void mxmlTree2MsrTranslator::visitStart ( S_strong_accent& elt )
 
   // placement
   
-  string placementString = elt->getAttributeValue ("placement");
+  string placementString = elt->getAttributeValue (attributeNames::placement);
 
   msrPlacementKind placementKind = kPlacementNone;
 
@@ -8797,7 +8797,7 @@ void mxmlTree2MsrTranslator::visitStart ( S_strong_accent& elt )
         "\" is unknown";
       
       msrMusicXMLError (
-        gXml2lyOptions->fInputSourceName,
+        gXml2lyOptions ()->fInputSourceName,
         inputLineNumber,
         __FILE__, __LINE__,
         s.str ());    
@@ -8821,7 +8821,7 @@ void mxmlTree2MsrTranslator::visitStart ( S_tenuto& elt )
   int inputLineNumber =
     elt->getInputLineNumber ();
 
-  if (gMusicXMLOptions->fTraceMusicXMLTreeVisitors) {
+  if (gMusicXMLOptions ()->fTraceMusicXMLTreeVisitors) {
     fLogOutputStream <<
       "--> Start visiting S_tenuto" <<
       ", line " << inputLineNumber <<
@@ -8830,7 +8830,7 @@ void mxmlTree2MsrTranslator::visitStart ( S_tenuto& elt )
 
   // placement
   
-  string placementString = elt->getAttributeValue ("placement");
+  string placementString = elt->getAttributeValue (attributeNames::placement);
 
   msrPlacementKind placementKind = kPlacementNone;
 
@@ -8847,7 +8847,7 @@ void mxmlTree2MsrTranslator::visitStart ( S_tenuto& elt )
         "\" is unknown";
       
       msrMusicXMLError (
-        gXml2lyOptions->fInputSourceName,
+        gXml2lyOptions ()->fInputSourceName,
         inputLineNumber,
         __FILE__, __LINE__,
         s.str ());    
@@ -8871,7 +8871,7 @@ void mxmlTree2MsrTranslator::visitStart ( S_doit& elt )
   int inputLineNumber =
     elt->getInputLineNumber ();
 
-  if (gMusicXMLOptions->fTraceMusicXMLTreeVisitors) {
+  if (gMusicXMLOptions ()->fTraceMusicXMLTreeVisitors) {
     fLogOutputStream <<
       "--> Start visiting S_doit" <<
       ", line " << inputLineNumber <<
@@ -8880,7 +8880,7 @@ void mxmlTree2MsrTranslator::visitStart ( S_doit& elt )
 
   // placement
   
-  string placementString = elt->getAttributeValue ("placement");
+  string placementString = elt->getAttributeValue (attributeNames::placement);
 
   msrPlacementKind placementKind = kPlacementNone;
 
@@ -8897,7 +8897,7 @@ void mxmlTree2MsrTranslator::visitStart ( S_doit& elt )
         "\" is unknown";
       
       msrMusicXMLError (
-        gXml2lyOptions->fInputSourceName,
+        gXml2lyOptions ()->fInputSourceName,
         inputLineNumber,
         __FILE__, __LINE__,
         s.str ());    
@@ -8920,7 +8920,7 @@ void mxmlTree2MsrTranslator::visitStart ( S_falloff& elt )
   int inputLineNumber =
     elt->getInputLineNumber ();
 
-  if (gMusicXMLOptions->fTraceMusicXMLTreeVisitors) {
+  if (gMusicXMLOptions ()->fTraceMusicXMLTreeVisitors) {
     fLogOutputStream <<
       "--> Start visiting S_falloff" <<
       ", line " << inputLineNumber <<
@@ -8929,7 +8929,7 @@ void mxmlTree2MsrTranslator::visitStart ( S_falloff& elt )
 
   // placement
   
-  string placementString = elt->getAttributeValue ("placement");
+  string placementString = elt->getAttributeValue (attributeNames::placement);
 
   msrPlacementKind placementKind = kPlacementNone;
 
@@ -8946,7 +8946,7 @@ void mxmlTree2MsrTranslator::visitStart ( S_falloff& elt )
         "\" is unknown";
       
       msrMusicXMLError (
-        gXml2lyOptions->fInputSourceName,
+        gXml2lyOptions ()->fInputSourceName,
         inputLineNumber,
         __FILE__, __LINE__,
         s.str ());    
@@ -8969,7 +8969,7 @@ void mxmlTree2MsrTranslator::visitStart ( S_plop& elt )
   int inputLineNumber =
     elt->getInputLineNumber ();
 
-  if (gMusicXMLOptions->fTraceMusicXMLTreeVisitors) {
+  if (gMusicXMLOptions ()->fTraceMusicXMLTreeVisitors) {
     fLogOutputStream <<
       "--> Start visiting S_plop" <<
       ", line " << inputLineNumber <<
@@ -8978,7 +8978,7 @@ void mxmlTree2MsrTranslator::visitStart ( S_plop& elt )
 
   // placement
   
-  string placementString = elt->getAttributeValue ("placement");
+  string placementString = elt->getAttributeValue (attributeNames::placement);
 
   msrPlacementKind placementKind = kPlacementNone;
 
@@ -8995,7 +8995,7 @@ void mxmlTree2MsrTranslator::visitStart ( S_plop& elt )
         "\" is unknown";
       
       msrMusicXMLError (
-        gXml2lyOptions->fInputSourceName,
+        gXml2lyOptions ()->fInputSourceName,
         inputLineNumber,
         __FILE__, __LINE__,
         s.str ());    
@@ -9018,7 +9018,7 @@ void mxmlTree2MsrTranslator::visitStart ( S_scoop& elt )
   int inputLineNumber =
     elt->getInputLineNumber ();
 
-  if (gMusicXMLOptions->fTraceMusicXMLTreeVisitors) {
+  if (gMusicXMLOptions ()->fTraceMusicXMLTreeVisitors) {
     fLogOutputStream <<
       "--> Start visiting S_scoop" <<
       ", line " << inputLineNumber <<
@@ -9027,7 +9027,7 @@ void mxmlTree2MsrTranslator::visitStart ( S_scoop& elt )
 
   // placement
   
-  string placementString = elt->getAttributeValue ("placement");
+  string placementString = elt->getAttributeValue (attributeNames::placement);
 
   msrPlacementKind placementKind = kPlacementNone;
 
@@ -9044,7 +9044,7 @@ void mxmlTree2MsrTranslator::visitStart ( S_scoop& elt )
         "\" is unknown";
       
       msrMusicXMLError (
-        gXml2lyOptions->fInputSourceName,
+        gXml2lyOptions ()->fInputSourceName,
         inputLineNumber,
         __FILE__, __LINE__,
         s.str ());    
@@ -9064,7 +9064,7 @@ void mxmlTree2MsrTranslator::visitStart ( S_scoop& elt )
 
 void mxmlTree2MsrTranslator::visitEnd ( S_articulations& elt )
 {
-  if (gMusicXMLOptions->fTraceMusicXMLTreeVisitors) {
+  if (gMusicXMLOptions ()->fTraceMusicXMLTreeVisitors) {
     fLogOutputStream <<
       "--> End visiting S_articulations" <<
       ", line " << elt->getInputLineNumber () <<
@@ -9080,7 +9080,7 @@ void mxmlTree2MsrTranslator::visitStart ( S_arpeggiate& elt )
   int inputLineNumber =
     elt->getInputLineNumber ();
 
-  if (gMusicXMLOptions->fTraceMusicXMLTreeVisitors) {
+  if (gMusicXMLOptions ()->fTraceMusicXMLTreeVisitors) {
     fLogOutputStream <<
       "--> Start visiting S_arpeggiate" <<
       ", line " << inputLineNumber <<
@@ -9089,7 +9089,7 @@ void mxmlTree2MsrTranslator::visitStart ( S_arpeggiate& elt )
 
   // placement
   
-  string placementString = elt->getAttributeValue ("placement");
+  string placementString = elt->getAttributeValue (attributeNames::placement);
 
   msrPlacementKind placementKind = kPlacementNone; // default value
 
@@ -9106,7 +9106,7 @@ void mxmlTree2MsrTranslator::visitStart ( S_arpeggiate& elt )
         "\" is unknown";
       
       msrMusicXMLError (
-        gXml2lyOptions->fInputSourceName,
+        gXml2lyOptions ()->fInputSourceName,
         inputLineNumber,
         __FILE__, __LINE__,
         s.str ());    
@@ -9115,11 +9115,11 @@ void mxmlTree2MsrTranslator::visitStart ( S_arpeggiate& elt )
 
   // number
 
-  int number = elt->getAttributeIntValue ("number", 0);
+  int number = elt->getAttributeIntValue (attributeNames::number, 0);
 
   // direction
   
-  string directionString = elt->getAttributeValue ("direction");
+  string directionString = elt->getAttributeValue (attributeNames::direction);
 
   msrDirectionKind directionKind = kDirectionNone; // default value
   
@@ -9135,7 +9135,7 @@ void mxmlTree2MsrTranslator::visitStart ( S_arpeggiate& elt )
         "arpeggiate direction \"" << directionString << "\"" << "is unknown";
         
       msrMusicXMLError (
-        gXml2lyOptions->fInputSourceName,
+        gXml2lyOptions ()->fInputSourceName,
         inputLineNumber,
         __FILE__, __LINE__,
         s.str ());
@@ -9160,7 +9160,7 @@ void mxmlTree2MsrTranslator::visitStart ( S_non_arpeggiate& elt )
   int inputLineNumber =
     elt->getInputLineNumber ();
 
-  if (gMusicXMLOptions->fTraceMusicXMLTreeVisitors) {
+  if (gMusicXMLOptions ()->fTraceMusicXMLTreeVisitors) {
     fLogOutputStream <<
       "--> Start visiting S_non_arpeggiate" << // JMI
       ", line " << inputLineNumber <<
@@ -9169,7 +9169,7 @@ void mxmlTree2MsrTranslator::visitStart ( S_non_arpeggiate& elt )
 
   // placement
   
-  string placementString = elt->getAttributeValue ("placement");
+  string placementString = elt->getAttributeValue (attributeNames::placement);
 
   msrPlacementKind placementKind = kPlacementNone; // default value
 
@@ -9186,7 +9186,7 @@ void mxmlTree2MsrTranslator::visitStart ( S_non_arpeggiate& elt )
         "\" is unknown";
       
       msrMusicXMLError (
-        gXml2lyOptions->fInputSourceName,
+        gXml2lyOptions ()->fInputSourceName,
         inputLineNumber,
         __FILE__, __LINE__,
         s.str ());    
@@ -9195,7 +9195,7 @@ void mxmlTree2MsrTranslator::visitStart ( S_non_arpeggiate& elt )
 
   // type
 
-  string typeString = elt->getAttributeValue ("type");
+  string typeString = elt->getAttributeValue (attributeNames::type);
 
   msrNonArpeggiato::msrNonArpeggiatoTypeKind
     nonArpeggiatoTypeKind =
@@ -9217,7 +9217,7 @@ void mxmlTree2MsrTranslator::visitStart ( S_non_arpeggiate& elt )
         "\" is unknown";
       
       msrMusicXMLError (
-        gXml2lyOptions->fInputSourceName,
+        gXml2lyOptions ()->fInputSourceName,
         inputLineNumber,
         __FILE__, __LINE__,
         s.str ());    
@@ -9226,7 +9226,7 @@ void mxmlTree2MsrTranslator::visitStart ( S_non_arpeggiate& elt )
 
   // number
 
-  int number = elt->getAttributeIntValue ("number", 0);
+  int number = elt->getAttributeIntValue (attributeNames::number, 0);
 
   // create the non arpeggiato  
   S_msrNonArpeggiato
@@ -9243,7 +9243,7 @@ void mxmlTree2MsrTranslator::visitStart ( S_non_arpeggiate& elt )
 //______________________________________________________________________________
 void mxmlTree2MsrTranslator::visitStart ( S_technical& elt )
 {
-  if (gMusicXMLOptions->fTraceMusicXMLTreeVisitors) {
+  if (gMusicXMLOptions ()->fTraceMusicXMLTreeVisitors) {
     fLogOutputStream <<
       "--> Start visiting S_technical" <<
       ", line " << elt->getInputLineNumber () <<
@@ -9255,7 +9255,7 @@ void mxmlTree2MsrTranslator::visitStart ( S_technical& elt )
 
 void mxmlTree2MsrTranslator::visitEnd ( S_technical& elt )
 {
-  if (gMusicXMLOptions->fTraceMusicXMLTreeVisitors) {
+  if (gMusicXMLOptions ()->fTraceMusicXMLTreeVisitors) {
     fLogOutputStream <<
       "--> Start visiting S_technical" <<
       ", line " << elt->getInputLineNumber () <<
@@ -9270,14 +9270,14 @@ void mxmlTree2MsrTranslator::visitStart ( S_arrow& elt )
   int inputLineNumber =
     elt->getInputLineNumber ();
 
-  if (gMusicXMLOptions->fTraceMusicXMLTreeVisitors) {
+  if (gMusicXMLOptions ()->fTraceMusicXMLTreeVisitors) {
     fLogOutputStream <<
       "--> Start visiting S_arrow" <<
       ", line " << inputLineNumber <<
       endl;
   }
 
-  string placement = elt->getAttributeValue ("placement");
+  string placement = elt->getAttributeValue (attributeNames::placement);
 
   msrPlacementKind
     arrowPlacementKind = kPlacementNone;
@@ -9295,7 +9295,7 @@ void mxmlTree2MsrTranslator::visitStart ( S_arrow& elt )
       "\" is unknown";
     
     msrMusicXMLError (
-      gXml2lyOptions->fInputSourceName,
+      gXml2lyOptions ()->fInputSourceName,
       inputLineNumber,
       __FILE__, __LINE__,
       s.str ());    
@@ -9313,7 +9313,7 @@ void mxmlTree2MsrTranslator::visitStart ( S_arrow& elt )
 
 void mxmlTree2MsrTranslator::visitStart ( S_bend_alter& elt )
 {
-  if (gMusicXMLOptions->fTraceMusicXMLTreeVisitors) {
+  if (gMusicXMLOptions ()->fTraceMusicXMLTreeVisitors) {
     fLogOutputStream <<
       "--> Start visiting S_bend_alter" <<
       ", line " << elt->getInputLineNumber () <<
@@ -9325,7 +9325,7 @@ void mxmlTree2MsrTranslator::visitStart ( S_bend_alter& elt )
   
 void mxmlTree2MsrTranslator::visitStart ( S_bend& elt ) // JMI
 {
-  if (gMusicXMLOptions->fTraceMusicXMLTreeVisitors) {
+  if (gMusicXMLOptions ()->fTraceMusicXMLTreeVisitors) {
     fLogOutputStream <<
       "--> Start visiting S_bend" <<
       ", line " << elt->getInputLineNumber () <<
@@ -9338,14 +9338,14 @@ void mxmlTree2MsrTranslator::visitEnd ( S_bend& elt )
   int inputLineNumber =
     elt->getInputLineNumber ();
 
-  if (gMusicXMLOptions->fTraceMusicXMLTreeVisitors) {
+  if (gMusicXMLOptions ()->fTraceMusicXMLTreeVisitors) {
     fLogOutputStream <<
       "--> Start visiting S_bend" <<
       ", line " << inputLineNumber <<
       endl;
   }
 
-  string placement = elt->getAttributeValue ("placement");
+  string placement = elt->getAttributeValue (attributeNames::placement);
 
   msrPlacementKind
     bendPlacementKind = kPlacementNone;
@@ -9362,7 +9362,7 @@ void mxmlTree2MsrTranslator::visitEnd ( S_bend& elt )
       "\" is unknown";
     
     msrMusicXMLError (
-      gXml2lyOptions->fInputSourceName,
+      gXml2lyOptions ()->fInputSourceName,
       inputLineNumber,
       __FILE__, __LINE__,
       s.str ());    
@@ -9385,7 +9385,7 @@ void mxmlTree2MsrTranslator::visitStart ( S_double_tongue& elt )
   int inputLineNumber =
     elt->getInputLineNumber ();
 
-  if (gMusicXMLOptions->fTraceMusicXMLTreeVisitors) {
+  if (gMusicXMLOptions ()->fTraceMusicXMLTreeVisitors) {
     fLogOutputStream <<
       "--> Start visiting S_double_tongue" <<
       ", line " << inputLineNumber <<
@@ -9394,7 +9394,7 @@ void mxmlTree2MsrTranslator::visitStart ( S_double_tongue& elt )
 
   string
     placement =
-      elt->getAttributeValue ("placement");
+      elt->getAttributeValue (attributeNames::placement);
 
   msrPlacementKind
     doubleTonguePlacementKind = kPlacementNone;
@@ -9411,7 +9411,7 @@ void mxmlTree2MsrTranslator::visitStart ( S_double_tongue& elt )
       "\" is unknown";
     
     msrMusicXMLError (
-      gXml2lyOptions->fInputSourceName,
+      gXml2lyOptions ()->fInputSourceName,
       inputLineNumber,
       __FILE__, __LINE__,
       s.str ());    
@@ -9432,7 +9432,7 @@ void mxmlTree2MsrTranslator::visitStart ( S_down_bow& elt )
   int inputLineNumber =
     elt->getInputLineNumber ();
 
-  if (gMusicXMLOptions->fTraceMusicXMLTreeVisitors) {
+  if (gMusicXMLOptions ()->fTraceMusicXMLTreeVisitors) {
     fLogOutputStream <<
       "--> Start visiting S_down_bow" <<
       ", line " << inputLineNumber <<
@@ -9441,7 +9441,7 @@ void mxmlTree2MsrTranslator::visitStart ( S_down_bow& elt )
 
   string
     placement =
-      elt->getAttributeValue ("placement");
+      elt->getAttributeValue (attributeNames::placement);
 
   msrPlacementKind
     downBowPlacementKind = kPlacementNone;
@@ -9458,7 +9458,7 @@ void mxmlTree2MsrTranslator::visitStart ( S_down_bow& elt )
       "\" is unknown";
     
     msrMusicXMLError (
-      gXml2lyOptions->fInputSourceName,
+      gXml2lyOptions ()->fInputSourceName,
       inputLineNumber,
       __FILE__, __LINE__,
       s.str ());    
@@ -9479,7 +9479,7 @@ void mxmlTree2MsrTranslator::visitStart ( S_fingering& elt )
   int inputLineNumber =
     elt->getInputLineNumber ();
 
-  if (gMusicXMLOptions->fTraceMusicXMLTreeVisitors) {
+  if (gMusicXMLOptions ()->fTraceMusicXMLTreeVisitors) {
     fLogOutputStream <<
       "--> Start visiting S_fingering" <<
       ", line " << inputLineNumber <<
@@ -9489,7 +9489,7 @@ void mxmlTree2MsrTranslator::visitStart ( S_fingering& elt )
   int fingeringValue = (int)(*elt);
 
   if (fOnGoingTechnical) {
-    string placement = elt->getAttributeValue ("placement");
+    string placement = elt->getAttributeValue (attributeNames::placement);
   
     msrPlacementKind
       fingeringPlacementKind = kPlacementNone;
@@ -9506,7 +9506,7 @@ void mxmlTree2MsrTranslator::visitStart ( S_fingering& elt )
         "\" is unknown";
       
       msrMusicXMLError (
-        gXml2lyOptions->fInputSourceName,
+        gXml2lyOptions ()->fInputSourceName,
         inputLineNumber,
         __FILE__, __LINE__,
         s.str ());    
@@ -9536,7 +9536,7 @@ void mxmlTree2MsrTranslator::visitStart ( S_fingering& elt )
       "\" is out of context";
     
     msrMusicXMLError (
-      gXml2lyOptions->fInputSourceName,
+      gXml2lyOptions ()->fInputSourceName,
       inputLineNumber,
       __FILE__, __LINE__,
       s.str ());    
@@ -9548,7 +9548,7 @@ void mxmlTree2MsrTranslator::visitStart ( S_fingernails& elt )
   int inputLineNumber =
     elt->getInputLineNumber ();
 
-  if (gMusicXMLOptions->fTraceMusicXMLTreeVisitors) {
+  if (gMusicXMLOptions ()->fTraceMusicXMLTreeVisitors) {
     fLogOutputStream <<
       "--> Start visiting S_fingernails" <<
       ", line " << inputLineNumber <<
@@ -9557,7 +9557,7 @@ void mxmlTree2MsrTranslator::visitStart ( S_fingernails& elt )
 
   string
     placement =
-      elt->getAttributeValue ("placement");
+      elt->getAttributeValue (attributeNames::placement);
 
   msrPlacementKind
     fingernailsPlacementKind = kPlacementNone;
@@ -9574,7 +9574,7 @@ void mxmlTree2MsrTranslator::visitStart ( S_fingernails& elt )
       "\" is unknown";
     
     msrMusicXMLError (
-      gXml2lyOptions->fInputSourceName,
+      gXml2lyOptions ()->fInputSourceName,
       inputLineNumber,
       __FILE__, __LINE__,
       s.str ());    
@@ -9595,7 +9595,7 @@ void mxmlTree2MsrTranslator::visitStart ( S_fret& elt )
   int inputLineNumber =
     elt->getInputLineNumber ();
 
-  if (gMusicXMLOptions->fTraceMusicXMLTreeVisitors) {
+  if (gMusicXMLOptions ()->fTraceMusicXMLTreeVisitors) {
     fLogOutputStream <<
       "--> Start visiting S_fret" <<
       ", line " << inputLineNumber <<
@@ -9605,7 +9605,7 @@ void mxmlTree2MsrTranslator::visitStart ( S_fret& elt )
   int fretValue = (int)(*elt);
 
   if (fOnGoingTechnical) {
-    string placement = elt->getAttributeValue ("placement");
+    string placement = elt->getAttributeValue (attributeNames::placement);
   
     msrPlacementKind
       fretPlacementKind =  kPlacementNone;
@@ -9622,7 +9622,7 @@ void mxmlTree2MsrTranslator::visitStart ( S_fret& elt )
         "\" is unknown";
       
       msrMusicXMLError (
-        gXml2lyOptions->fInputSourceName,
+        gXml2lyOptions ()->fInputSourceName,
         inputLineNumber,
         __FILE__, __LINE__,
         s.str ());    
@@ -9652,7 +9652,7 @@ void mxmlTree2MsrTranslator::visitStart ( S_fret& elt )
       "\" is out of context";
     
     msrMusicXMLError (
-      gXml2lyOptions->fInputSourceName,
+      gXml2lyOptions ()->fInputSourceName,
       inputLineNumber,
       __FILE__, __LINE__,
       s.str ());
@@ -9664,7 +9664,7 @@ void mxmlTree2MsrTranslator::visitStart ( S_hammer_on& elt )
   int inputLineNumber =
     elt->getInputLineNumber ();
 
-  if (gMusicXMLOptions->fTraceMusicXMLTreeVisitors) {
+  if (gMusicXMLOptions ()->fTraceMusicXMLTreeVisitors) {
     fLogOutputStream <<
       "--> Start visiting S_hammer_on" <<
       ", line " << inputLineNumber <<
@@ -9673,7 +9673,7 @@ void mxmlTree2MsrTranslator::visitStart ( S_hammer_on& elt )
 
   // type
   
-  string hammerOnType = elt->getAttributeValue ("type");
+  string hammerOnType = elt->getAttributeValue (attributeNames::type);
   
   msrTechnicalTypeKind hammerOnTechnicalTypeKind = k_NoTechnicalType;
 
@@ -9690,7 +9690,7 @@ void mxmlTree2MsrTranslator::visitStart ( S_hammer_on& elt )
         "\" is unknown";
       
       msrMusicXMLError (
-        gXml2lyOptions->fInputSourceName,
+        gXml2lyOptions ()->fInputSourceName,
         inputLineNumber,
         __FILE__, __LINE__,
         s.str ());
@@ -9701,7 +9701,7 @@ void mxmlTree2MsrTranslator::visitStart ( S_hammer_on& elt )
   
   string hammerOnValue = elt->getValue ();
     
-  string placement = elt->getAttributeValue ("placement");
+  string placement = elt->getAttributeValue (attributeNames::placement);
 
   msrPlacementKind
     hammerOnPlacementKind = kPlacementNone;
@@ -9718,7 +9718,7 @@ void mxmlTree2MsrTranslator::visitStart ( S_hammer_on& elt )
       "\" is unknown";
     
     msrMusicXMLError (
-      gXml2lyOptions->fInputSourceName,
+      gXml2lyOptions ()->fInputSourceName,
       inputLineNumber,
       __FILE__, __LINE__,
       s.str ());    
@@ -9741,7 +9741,7 @@ void mxmlTree2MsrTranslator::visitStart ( S_handbell& elt )
   int inputLineNumber =
     elt->getInputLineNumber ();
 
-  if (gMusicXMLOptions->fTraceMusicXMLTreeVisitors) {
+  if (gMusicXMLOptions ()->fTraceMusicXMLTreeVisitors) {
     fLogOutputStream <<
       "--> Start visiting S_handbell" <<
       ", line " << inputLineNumber <<
@@ -9754,7 +9754,7 @@ void mxmlTree2MsrTranslator::visitStart ( S_handbell& elt )
   
   string
     placement =
-      elt->getAttributeValue ("placement");
+      elt->getAttributeValue (attributeNames::placement);
 
   msrPlacementKind
     handbellPlacementKind = kPlacementNone;
@@ -9771,7 +9771,7 @@ void mxmlTree2MsrTranslator::visitStart ( S_handbell& elt )
       "\" is unknown";
     
     msrMusicXMLError (
-      gXml2lyOptions->fInputSourceName,
+      gXml2lyOptions ()->fInputSourceName,
       inputLineNumber,
       __FILE__, __LINE__,
       s.str ());    
@@ -9794,7 +9794,7 @@ void mxmlTree2MsrTranslator::visitStart ( S_harmonic& elt )
   int inputLineNumber =
     elt->getInputLineNumber ();
 
-  if (gMusicXMLOptions->fTraceMusicXMLTreeVisitors) {
+  if (gMusicXMLOptions ()->fTraceMusicXMLTreeVisitors) {
     fLogOutputStream <<
       "--> Start visiting S_harmonic" <<
       ", line " << inputLineNumber <<
@@ -9803,7 +9803,7 @@ void mxmlTree2MsrTranslator::visitStart ( S_harmonic& elt )
 
   string
     placement =
-      elt->getAttributeValue ("placement");
+      elt->getAttributeValue (attributeNames::placement);
 
   msrPlacementKind
     harmonicPlacementKind = kPlacementNone;
@@ -9820,7 +9820,7 @@ void mxmlTree2MsrTranslator::visitStart ( S_harmonic& elt )
       "\" is unknown";
     
     msrMusicXMLError (
-      gXml2lyOptions->fInputSourceName,
+      gXml2lyOptions ()->fInputSourceName,
       inputLineNumber,
       __FILE__, __LINE__,
       s.str ());    
@@ -9841,7 +9841,7 @@ void mxmlTree2MsrTranslator::visitStart ( S_heel& elt )
   int inputLineNumber =
     elt->getInputLineNumber ();
 
-  if (gMusicXMLOptions->fTraceMusicXMLTreeVisitors) {
+  if (gMusicXMLOptions ()->fTraceMusicXMLTreeVisitors) {
     fLogOutputStream <<
       "--> Start visiting S_heel" <<
       ", line " << inputLineNumber <<
@@ -9850,7 +9850,7 @@ void mxmlTree2MsrTranslator::visitStart ( S_heel& elt )
 
   string
     placement =
-      elt->getAttributeValue ("placement");
+      elt->getAttributeValue (attributeNames::placement);
 
   msrPlacementKind
     heelPlacementKind = kPlacementNone;
@@ -9867,7 +9867,7 @@ void mxmlTree2MsrTranslator::visitStart ( S_heel& elt )
       "\" is unknown";
     
     msrMusicXMLError (
-      gXml2lyOptions->fInputSourceName,
+      gXml2lyOptions ()->fInputSourceName,
       inputLineNumber,
       __FILE__, __LINE__,
       s.str ());    
@@ -9888,7 +9888,7 @@ void mxmlTree2MsrTranslator::visitStart ( S_hole& elt )
   int inputLineNumber =
     elt->getInputLineNumber ();
 
-  if (gMusicXMLOptions->fTraceMusicXMLTreeVisitors) {
+  if (gMusicXMLOptions ()->fTraceMusicXMLTreeVisitors) {
     fLogOutputStream <<
       "--> Start visiting S_hole" <<
       ", line " << inputLineNumber <<
@@ -9897,7 +9897,7 @@ void mxmlTree2MsrTranslator::visitStart ( S_hole& elt )
     
   string
     placement =
-      elt->getAttributeValue ("placement");
+      elt->getAttributeValue (attributeNames::placement);
 
   msrPlacementKind
     holePlacementKind = kPlacementNone;
@@ -9914,7 +9914,7 @@ void mxmlTree2MsrTranslator::visitStart ( S_hole& elt )
       "\" is unknown";
     
     msrMusicXMLError (
-      gXml2lyOptions->fInputSourceName,
+      gXml2lyOptions ()->fInputSourceName,
       inputLineNumber,
       __FILE__, __LINE__,
       s.str ());    
@@ -9935,7 +9935,7 @@ void mxmlTree2MsrTranslator::visitStart ( S_open_string& elt )
   int inputLineNumber =
     elt->getInputLineNumber ();
 
-  if (gMusicXMLOptions->fTraceMusicXMLTreeVisitors) {
+  if (gMusicXMLOptions ()->fTraceMusicXMLTreeVisitors) {
     fLogOutputStream <<
       "--> Start visiting S_open_string" <<
       ", line " << inputLineNumber <<
@@ -9944,7 +9944,7 @@ void mxmlTree2MsrTranslator::visitStart ( S_open_string& elt )
 
   string
     placement =
-      elt->getAttributeValue ("placement");
+      elt->getAttributeValue (attributeNames::placement);
 
   msrPlacementKind
     openStringPlacementKind = kPlacementNone;
@@ -9961,7 +9961,7 @@ void mxmlTree2MsrTranslator::visitStart ( S_open_string& elt )
       "\" is unknown";
     
     msrMusicXMLError (
-      gXml2lyOptions->fInputSourceName,
+      gXml2lyOptions ()->fInputSourceName,
       inputLineNumber,
       __FILE__, __LINE__,
       s.str ());    
@@ -9982,7 +9982,7 @@ void mxmlTree2MsrTranslator::visitStart ( S_other_technical& elt )
   int inputLineNumber =
     elt->getInputLineNumber ();
 
-  if (gMusicXMLOptions->fTraceMusicXMLTreeVisitors) {
+  if (gMusicXMLOptions ()->fTraceMusicXMLTreeVisitors) {
     fLogOutputStream <<
       "--> Start visiting S_other_technical" <<
       ", line " << inputLineNumber <<
@@ -9993,7 +9993,7 @@ void mxmlTree2MsrTranslator::visitStart ( S_other_technical& elt )
     
   string
     placement =
-      elt->getAttributeValue ("placement");
+      elt->getAttributeValue (attributeNames::placement);
 
   msrPlacementKind
     otherTechnicalWithStringPlacementKind = kPlacementNone;
@@ -10010,7 +10010,7 @@ void mxmlTree2MsrTranslator::visitStart ( S_other_technical& elt )
       "\" is unknown";
     
     msrMusicXMLError (
-      gXml2lyOptions->fInputSourceName,
+      gXml2lyOptions ()->fInputSourceName,
       inputLineNumber,
       __FILE__, __LINE__,
       s.str ());    
@@ -10033,7 +10033,7 @@ void mxmlTree2MsrTranslator::visitStart ( S_pluck& elt )
   int inputLineNumber =
     elt->getInputLineNumber ();
 
-  if (gMusicXMLOptions->fTraceMusicXMLTreeVisitors) {
+  if (gMusicXMLOptions ()->fTraceMusicXMLTreeVisitors) {
     fLogOutputStream <<
       "--> Start visiting S_pluck" <<
       ", line " << inputLineNumber <<
@@ -10044,7 +10044,7 @@ void mxmlTree2MsrTranslator::visitStart ( S_pluck& elt )
     
   string
     placement =
-      elt->getAttributeValue ("placement");
+      elt->getAttributeValue (attributeNames::placement);
 
   msrPlacementKind
     pluckPlacementKind = kPlacementNone;
@@ -10061,7 +10061,7 @@ void mxmlTree2MsrTranslator::visitStart ( S_pluck& elt )
       "\" is unknown";
     
     msrMusicXMLError (
-      gXml2lyOptions->fInputSourceName,
+      gXml2lyOptions ()->fInputSourceName,
       inputLineNumber,
       __FILE__, __LINE__,
       s.str ());    
@@ -10084,7 +10084,7 @@ void mxmlTree2MsrTranslator::visitStart ( S_pull_off& elt )
   int inputLineNumber =
     elt->getInputLineNumber ();
 
-  if (gMusicXMLOptions->fTraceMusicXMLTreeVisitors) {
+  if (gMusicXMLOptions ()->fTraceMusicXMLTreeVisitors) {
     fLogOutputStream <<
       "--> Start visiting S_pull_off" <<
       ", line " << inputLineNumber <<
@@ -10095,7 +10095,7 @@ void mxmlTree2MsrTranslator::visitStart ( S_pull_off& elt )
     
   // type
   
-  string pullOffType = elt->getAttributeValue ("type");
+  string pullOffType = elt->getAttributeValue (attributeNames::type);
   
   msrTechnicalTypeKind pullOffTechnicalTypeKind = k_NoTechnicalType;
 
@@ -10112,7 +10112,7 @@ void mxmlTree2MsrTranslator::visitStart ( S_pull_off& elt )
         "\" is unknown";
       
       msrMusicXMLError (
-        gXml2lyOptions->fInputSourceName,
+        gXml2lyOptions ()->fInputSourceName,
         inputLineNumber,
         __FILE__, __LINE__,
         s.str ());
@@ -10123,7 +10123,7 @@ void mxmlTree2MsrTranslator::visitStart ( S_pull_off& elt )
   
   string
     placement =
-      elt->getAttributeValue ("placement");
+      elt->getAttributeValue (attributeNames::placement);
 
   msrPlacementKind
     pullOffPlacementKind = kPlacementNone;
@@ -10140,7 +10140,7 @@ void mxmlTree2MsrTranslator::visitStart ( S_pull_off& elt )
       "\" is unknown";
     
     msrMusicXMLError (
-      gXml2lyOptions->fInputSourceName,
+      gXml2lyOptions ()->fInputSourceName,
       inputLineNumber,
       __FILE__, __LINE__,
       s.str ());    
@@ -10163,7 +10163,7 @@ void mxmlTree2MsrTranslator::visitStart ( S_snap_pizzicato& elt )
   int inputLineNumber =
     elt->getInputLineNumber ();
 
-  if (gMusicXMLOptions->fTraceMusicXMLTreeVisitors) {
+  if (gMusicXMLOptions ()->fTraceMusicXMLTreeVisitors) {
     fLogOutputStream <<
       "--> Start visiting S_snap_pizzicato" <<
       ", line " << inputLineNumber <<
@@ -10172,7 +10172,7 @@ void mxmlTree2MsrTranslator::visitStart ( S_snap_pizzicato& elt )
 
   string
     placement =
-      elt->getAttributeValue ("placement");
+      elt->getAttributeValue (attributeNames::placement);
 
   msrPlacementKind
     snapPizzicatoPlacementKind = kPlacementNone;
@@ -10189,7 +10189,7 @@ void mxmlTree2MsrTranslator::visitStart ( S_snap_pizzicato& elt )
       "\" is unknown";
     
     msrMusicXMLError (
-      gXml2lyOptions->fInputSourceName,
+      gXml2lyOptions ()->fInputSourceName,
       inputLineNumber,
       __FILE__, __LINE__,
       s.str ());    
@@ -10210,7 +10210,7 @@ void mxmlTree2MsrTranslator::visitStart ( S_stopped& elt )
   int inputLineNumber =
     elt->getInputLineNumber ();
 
-  if (gMusicXMLOptions->fTraceMusicXMLTreeVisitors) {
+  if (gMusicXMLOptions ()->fTraceMusicXMLTreeVisitors) {
     fLogOutputStream <<
       "--> Start visiting S_stopped" <<
       ", line " << inputLineNumber <<
@@ -10219,7 +10219,7 @@ void mxmlTree2MsrTranslator::visitStart ( S_stopped& elt )
 
   string
     placement =
-      elt->getAttributeValue ("placement");
+      elt->getAttributeValue (attributeNames::placement);
 
   msrPlacementKind
     stoppedPlacementKind = kPlacementNone;
@@ -10236,7 +10236,7 @@ void mxmlTree2MsrTranslator::visitStart ( S_stopped& elt )
       "\" is unknown";
     
     msrMusicXMLError (
-      gXml2lyOptions->fInputSourceName,
+      gXml2lyOptions ()->fInputSourceName,
       inputLineNumber,
       __FILE__, __LINE__,
       s.str ());    
@@ -10257,7 +10257,7 @@ void mxmlTree2MsrTranslator::visitStart ( S_string& elt )
   int inputLineNumber =
     elt->getInputLineNumber ();
 
-  if (gMusicXMLOptions->fTraceMusicXMLTreeVisitors) {
+  if (gMusicXMLOptions ()->fTraceMusicXMLTreeVisitors) {
     fLogOutputStream <<
       "--> Start visiting S_string" <<
       ", line " << inputLineNumber <<
@@ -10291,13 +10291,13 @@ void mxmlTree2MsrTranslator::visitStart ( S_string& elt )
       "\" is empoty, '" << stringIntegerValue << "' is assumed";
     
     msrMusicXMLWarning (
-      gXml2lyOptions->fInputSourceName,
+      gXml2lyOptions ()->fInputSourceName,
       inputLineNumber,
       s.str ());    
   }
 
   if (fOnGoingTechnical) {
-    string placement = elt->getAttributeValue ("placement");
+    string placement = elt->getAttributeValue (attributeNames::placement);
   
     msrPlacementKind
       stringPlacementKind = kPlacementNone;
@@ -10314,7 +10314,7 @@ void mxmlTree2MsrTranslator::visitStart ( S_string& elt )
         "\" is unknown";
       
       msrMusicXMLError (
-        gXml2lyOptions->fInputSourceName,
+        gXml2lyOptions ()->fInputSourceName,
         inputLineNumber,
         __FILE__, __LINE__,
         s.str ());    
@@ -10344,7 +10344,7 @@ void mxmlTree2MsrTranslator::visitStart ( S_string& elt )
       "\" is out of context";
     
     msrMusicXMLError (
-      gXml2lyOptions->fInputSourceName,
+      gXml2lyOptions ()->fInputSourceName,
       inputLineNumber,
       __FILE__, __LINE__,
       s.str ());
@@ -10356,7 +10356,7 @@ void mxmlTree2MsrTranslator::visitStart ( S_tap& elt )
   int inputLineNumber =
     elt->getInputLineNumber ();
 
-  if (gMusicXMLOptions->fTraceMusicXMLTreeVisitors) {
+  if (gMusicXMLOptions ()->fTraceMusicXMLTreeVisitors) {
     fLogOutputStream <<
       "--> Start visiting S_tap" <<
       ", line " << inputLineNumber <<
@@ -10365,7 +10365,7 @@ void mxmlTree2MsrTranslator::visitStart ( S_tap& elt )
 
   string
     placement =
-      elt->getAttributeValue ("placement");
+      elt->getAttributeValue (attributeNames::placement);
 
   msrPlacementKind
     tapPlacementKind = kPlacementNone;
@@ -10382,7 +10382,7 @@ void mxmlTree2MsrTranslator::visitStart ( S_tap& elt )
       "\" is unknown";
     
     msrMusicXMLError (
-      gXml2lyOptions->fInputSourceName,
+      gXml2lyOptions ()->fInputSourceName,
       inputLineNumber,
       __FILE__, __LINE__,
       s.str ());    
@@ -10403,7 +10403,7 @@ void mxmlTree2MsrTranslator::visitStart ( S_thumb_position& elt )
   int inputLineNumber =
     elt->getInputLineNumber ();
 
-  if (gMusicXMLOptions->fTraceMusicXMLTreeVisitors) {
+  if (gMusicXMLOptions ()->fTraceMusicXMLTreeVisitors) {
     fLogOutputStream <<
       "--> Start visiting S_thumb_position" <<
       ", line " << inputLineNumber <<
@@ -10412,7 +10412,7 @@ void mxmlTree2MsrTranslator::visitStart ( S_thumb_position& elt )
 
   string
     placement =
-      elt->getAttributeValue ("placement");
+      elt->getAttributeValue (attributeNames::placement);
 
   msrPlacementKind
     thumbPositionPlacementKind = kPlacementNone;
@@ -10429,7 +10429,7 @@ void mxmlTree2MsrTranslator::visitStart ( S_thumb_position& elt )
       "\" is unknown";
     
     msrMusicXMLError (
-      gXml2lyOptions->fInputSourceName,
+      gXml2lyOptions ()->fInputSourceName,
       inputLineNumber,
       __FILE__, __LINE__,
       s.str ());    
@@ -10450,7 +10450,7 @@ void mxmlTree2MsrTranslator::visitStart ( S_toe& elt )
   int inputLineNumber =
     elt->getInputLineNumber ();
 
-  if (gMusicXMLOptions->fTraceMusicXMLTreeVisitors) {
+  if (gMusicXMLOptions ()->fTraceMusicXMLTreeVisitors) {
     fLogOutputStream <<
       "--> Start visiting S_toe" <<
       ", line " << inputLineNumber <<
@@ -10459,7 +10459,7 @@ void mxmlTree2MsrTranslator::visitStart ( S_toe& elt )
 
   string
     placement =
-      elt->getAttributeValue ("placement");
+      elt->getAttributeValue (attributeNames::placement);
 
   msrPlacementKind
     toePlacementKind = kPlacementNone;
@@ -10476,7 +10476,7 @@ void mxmlTree2MsrTranslator::visitStart ( S_toe& elt )
       "\" is unknown";
     
     msrMusicXMLError (
-      gXml2lyOptions->fInputSourceName,
+      gXml2lyOptions ()->fInputSourceName,
       inputLineNumber,
       __FILE__, __LINE__,
       s.str ());    
@@ -10497,7 +10497,7 @@ void mxmlTree2MsrTranslator::visitStart ( S_triple_tongue& elt )
   int inputLineNumber =
     elt->getInputLineNumber ();
 
-  if (gMusicXMLOptions->fTraceMusicXMLTreeVisitors) {
+  if (gMusicXMLOptions ()->fTraceMusicXMLTreeVisitors) {
     fLogOutputStream <<
       "--> Start visiting S_triple_tongue" <<
       ", line " << inputLineNumber <<
@@ -10506,7 +10506,7 @@ void mxmlTree2MsrTranslator::visitStart ( S_triple_tongue& elt )
 
   string
     placement =
-      elt->getAttributeValue ("placement");
+      elt->getAttributeValue (attributeNames::placement);
 
   msrPlacementKind
     tripleTonguePlacementKind = kPlacementNone;
@@ -10523,7 +10523,7 @@ void mxmlTree2MsrTranslator::visitStart ( S_triple_tongue& elt )
       "\" is unknown";
     
     msrMusicXMLError (
-      gXml2lyOptions->fInputSourceName,
+      gXml2lyOptions ()->fInputSourceName,
       inputLineNumber,
       __FILE__, __LINE__,
       s.str ());    
@@ -10544,7 +10544,7 @@ void mxmlTree2MsrTranslator::visitStart ( S_up_bow& elt )
   int inputLineNumber =
     elt->getInputLineNumber ();
 
-  if (gMusicXMLOptions->fTraceMusicXMLTreeVisitors) {
+  if (gMusicXMLOptions ()->fTraceMusicXMLTreeVisitors) {
     fLogOutputStream <<
       "--> Start visiting S_up_bow" <<
       ", line " << inputLineNumber <<
@@ -10553,7 +10553,7 @@ void mxmlTree2MsrTranslator::visitStart ( S_up_bow& elt )
 
   string
     placement =
-      elt->getAttributeValue ("placement");
+      elt->getAttributeValue (attributeNames::placement);
 
   msrPlacementKind
     upBowPlacementKind = kPlacementNone;
@@ -10570,7 +10570,7 @@ void mxmlTree2MsrTranslator::visitStart ( S_up_bow& elt )
       "\" is unknown";
     
     msrMusicXMLError (
-      gXml2lyOptions->fInputSourceName,
+      gXml2lyOptions ()->fInputSourceName,
       inputLineNumber,
       __FILE__, __LINE__,
       s.str ());    
@@ -10592,7 +10592,7 @@ void mxmlTree2MsrTranslator::visitStart ( S_fermata& elt )
   int inputLineNumber =
     elt->getInputLineNumber ();
 
-  if (gMusicXMLOptions->fTraceMusicXMLTreeVisitors) {
+  if (gMusicXMLOptions ()->fTraceMusicXMLTreeVisitors) {
     fLogOutputStream <<
       "--> Start visiting S_fermata" <<
       ", line " << inputLineNumber <<
@@ -10625,7 +10625,7 @@ void mxmlTree2MsrTranslator::visitStart ( S_fermata& elt )
         "\" is unknown";
       
       msrMusicXMLError (
-        gXml2lyOptions->fInputSourceName,
+        gXml2lyOptions ()->fInputSourceName,
         inputLineNumber,
         __FILE__, __LINE__,
         s.str ());
@@ -10634,7 +10634,7 @@ void mxmlTree2MsrTranslator::visitStart ( S_fermata& elt )
 
   // type
   
-  string fermataTypeValue = elt->getAttributeValue ("type");
+  string fermataTypeValue = elt->getAttributeValue (attributeNames::type);
   
   msrFermata::msrFermataTypeKind
     fermataTypeKind =
@@ -10655,7 +10655,7 @@ void mxmlTree2MsrTranslator::visitStart ( S_fermata& elt )
         "\" is unknown";
       
       msrMusicXMLError (
-        gXml2lyOptions->fInputSourceName,
+        gXml2lyOptions ()->fInputSourceName,
         inputLineNumber,
         __FILE__, __LINE__,
         s.str ());
@@ -10676,7 +10676,7 @@ void mxmlTree2MsrTranslator::visitStart ( S_fermata& elt )
 //______________________________________________________________________________
 void mxmlTree2MsrTranslator::visitStart ( S_ornaments& elt )
 {
-  if (gMusicXMLOptions->fTraceMusicXMLTreeVisitors) {
+  if (gMusicXMLOptions ()->fTraceMusicXMLTreeVisitors) {
     fLogOutputStream <<
       "--> Start visiting S_ornaments" <<
       ", line " << elt->getInputLineNumber () <<
@@ -10689,7 +10689,7 @@ void mxmlTree2MsrTranslator::visitStart ( S_tremolo& elt )
   int inputLineNumber =
     elt->getInputLineNumber ();
 
-  if (gMusicXMLOptions->fTraceMusicXMLTreeVisitors) {
+  if (gMusicXMLOptions ()->fTraceMusicXMLTreeVisitors) {
     fLogOutputStream <<
       "--> Start visiting tremolo" <<
       ", line " << inputLineNumber <<
@@ -10712,7 +10712,7 @@ void mxmlTree2MsrTranslator::visitStart ( S_tremolo& elt )
       "--> tremolo value is missing, '" << tremoloMarksNumber << "' assumed";
     
     msrMusicXMLWarning (
-      gXml2lyOptions->fInputSourceName,
+      gXml2lyOptions ()->fInputSourceName,
       inputLineNumber,
       s.str ());
   }
@@ -10725,7 +10725,7 @@ void mxmlTree2MsrTranslator::visitStart ( S_tremolo& elt )
       "\" should be between 0 and 8";
     
     msrMusicXMLError (
-      gXml2lyOptions->fInputSourceName,
+      gXml2lyOptions ()->fInputSourceName,
       inputLineNumber,
       __FILE__, __LINE__,
       s.str ());
@@ -10733,7 +10733,7 @@ void mxmlTree2MsrTranslator::visitStart ( S_tremolo& elt )
 
   // type
   
-  string tremoloType = elt->getAttributeValue ("type");
+  string tremoloType = elt->getAttributeValue (attributeNames::type);
 
   fCurrentTremoloTypeKind = kTremoloTypeSingle; // default value
     
@@ -10754,7 +10754,7 @@ void mxmlTree2MsrTranslator::visitStart ( S_tremolo& elt )
       "\" is unknown";
     
     msrMusicXMLError (
-      gXml2lyOptions->fInputSourceName,
+      gXml2lyOptions ()->fInputSourceName,
       inputLineNumber,
       __FILE__, __LINE__,
       s.str ());
@@ -10764,7 +10764,7 @@ void mxmlTree2MsrTranslator::visitStart ( S_tremolo& elt )
   
   string
     tremoloPlacement =
-      elt->getAttributeValue ("placement");
+      elt->getAttributeValue (attributeNames::placement);
 
   msrPlacementKind
     singleTremoloPlacementKind = kPlacementNone;
@@ -10815,7 +10815,7 @@ void mxmlTree2MsrTranslator::visitStart ( S_tremolo& elt )
       "\" is unknown";
     
     msrMusicXMLError (
-      gXml2lyOptions->fInputSourceName,
+      gXml2lyOptions ()->fInputSourceName,
       inputLineNumber,
       __FILE__, __LINE__,
       s.str ());    
@@ -10831,7 +10831,7 @@ void mxmlTree2MsrTranslator::visitStart ( S_tremolo& elt )
       // create a single tremolo, it will be attached to current note
       // in attachCurrentSingleTremoloToNote()
 #ifdef TRACE_OPTIONS
-      if (gTraceOptions->fTraceTremolos) {
+      if (gTraceOptions ()->fTraceTremolos) {
         fLogOutputStream <<
           "Creating a single tremolo" <<
           ", line " << inputLineNumber <<
@@ -10865,7 +10865,7 @@ void mxmlTree2MsrTranslator::visitStart ( S_tremolo& elt )
 
         // create a double tremolo start
 #ifdef TRACE_OPTIONS
-        if (gTraceOptions->fTraceTremolos) {
+        if (gTraceOptions ()->fTraceTremolos) {
           fLogOutputStream <<
             "Creating a double tremolo" <<
             ", line " << inputLineNumber <<
@@ -10896,7 +10896,7 @@ void mxmlTree2MsrTranslator::visitStart ( S_tremolo& elt )
           "<tremolo/> start when a current double tremolo is already open";
 
         msrMusicXMLError (
-          gXml2lyOptions->fInputSourceName,
+          gXml2lyOptions ()->fInputSourceName,
           inputLineNumber,
           __FILE__, __LINE__,
           s.str ());    
@@ -10907,7 +10907,7 @@ void mxmlTree2MsrTranslator::visitStart ( S_tremolo& elt )
     case kTremoloTypeStop:
       if (fCurrentDoubleTremolo) {
 #ifdef TRACE_OPTIONS
-        if (gTraceOptions->fTraceTremolos) {
+        if (gTraceOptions ()->fTraceTremolos) {
           fLogOutputStream <<
             "Meeting a double tremolo stop" <<
             ", line " << inputLineNumber <<
@@ -10926,7 +10926,7 @@ void mxmlTree2MsrTranslator::visitStart ( S_tremolo& elt )
           "<tremolo/> stop whit no preceeding <tremolo/> start";
 
         msrMusicXMLError (
-          gXml2lyOptions->fInputSourceName,
+          gXml2lyOptions ()->fInputSourceName,
           inputLineNumber,
           __FILE__, __LINE__,
           s.str ());    
@@ -10940,7 +10940,7 @@ void mxmlTree2MsrTranslator::visitStart ( S_trill_mark& elt )
   int inputLineNumber =
     elt->getInputLineNumber ();
 
-  if (gMusicXMLOptions->fTraceMusicXMLTreeVisitors) {
+  if (gMusicXMLOptions ()->fTraceMusicXMLTreeVisitors) {
     fLogOutputStream <<
       "--> Start visiting S_trill_mark" <<
       ", line " << inputLineNumber <<
@@ -10952,7 +10952,7 @@ void mxmlTree2MsrTranslator::visitStart ( S_trill_mark& elt )
   // placement
   
   string placement =
-    elt->getAttributeValue ("placement");
+    elt->getAttributeValue (attributeNames::placement);
 
   msrPlacementKind
     ornamentPlacementKind = kPlacementNone;
@@ -10970,7 +10970,7 @@ void mxmlTree2MsrTranslator::visitStart ( S_trill_mark& elt )
       "\" is unknown";
     
     msrMusicXMLError (
-      gXml2lyOptions->fInputSourceName,
+      gXml2lyOptions ()->fInputSourceName,
       inputLineNumber,
       __FILE__, __LINE__,
       s.str ());    
@@ -10991,7 +10991,7 @@ void mxmlTree2MsrTranslator::visitStart ( S_dashes& elt )
   int inputLineNumber =
     elt->getInputLineNumber ();
 
-  if (gMusicXMLOptions->fTraceMusicXMLTreeVisitors) {
+  if (gMusicXMLOptions ()->fTraceMusicXMLTreeVisitors) {
     fLogOutputStream <<
       "--> Start visiting S_dashes" <<
       ", line " << inputLineNumber <<
@@ -11002,11 +11002,11 @@ void mxmlTree2MsrTranslator::visitStart ( S_dashes& elt )
 
   // number
 
-  int dashesNumber = elt->getAttributeIntValue ("number", 0); // JMI
+  int dashesNumber = elt->getAttributeIntValue (attributeNames::number, 0); // JMI
 
   // type
   
-  string dashesType = elt->getAttributeValue ("type");
+  string dashesType = elt->getAttributeValue (attributeNames::type);
   
   msrSpannerTypeKind fDashesSpannerTypeKind = k_NoSpannerType;
 
@@ -11025,7 +11025,7 @@ void mxmlTree2MsrTranslator::visitStart ( S_dashes& elt )
         "\" is unknown";
       
       msrMusicXMLError (
-        gXml2lyOptions->fInputSourceName,
+        gXml2lyOptions ()->fInputSourceName,
         inputLineNumber,
         __FILE__, __LINE__,
         s.str ());
@@ -11035,7 +11035,7 @@ void mxmlTree2MsrTranslator::visitStart ( S_dashes& elt )
   // placement
   
   string placement =
-    elt->getAttributeValue ("placement");
+    elt->getAttributeValue (attributeNames::placement);
 
   msrPlacementKind
     ornamentPlacementKind = kPlacementNone;
@@ -11053,7 +11053,7 @@ void mxmlTree2MsrTranslator::visitStart ( S_dashes& elt )
       "\" is unknown";
     
     msrMusicXMLError (
-      gXml2lyOptions->fInputSourceName,
+      gXml2lyOptions ()->fInputSourceName,
       inputLineNumber,
       __FILE__, __LINE__,
       s.str ());    
@@ -11077,7 +11077,7 @@ void mxmlTree2MsrTranslator::visitStart ( S_wavy_line& elt )
   int inputLineNumber =
     elt->getInputLineNumber ();
 
-  if (gMusicXMLOptions->fTraceMusicXMLTreeVisitors) {
+  if (gMusicXMLOptions ()->fTraceMusicXMLTreeVisitors) {
     fLogOutputStream <<
       "--> Start visiting S_wavy_line" <<
       ", line " << inputLineNumber <<
@@ -11098,11 +11098,11 @@ void mxmlTree2MsrTranslator::visitStart ( S_wavy_line& elt )
 
   // number
 
-  int wavyLineNumber = elt->getAttributeIntValue ("number", 0); // JMI
+  int wavyLineNumber = elt->getAttributeIntValue (attributeNames::number, 0); // JMI
 
   // type
   
-  string wavyLineType = elt->getAttributeValue ("type");
+  string wavyLineType = elt->getAttributeValue (attributeNames::type);
   
   msrSpannerTypeKind fWavyLineSpannerTypeKind = k_NoSpannerType;
 
@@ -11121,7 +11121,7 @@ void mxmlTree2MsrTranslator::visitStart ( S_wavy_line& elt )
         "\" is unknown";
       
       msrMusicXMLError (
-        gXml2lyOptions->fInputSourceName,
+        gXml2lyOptions ()->fInputSourceName,
         inputLineNumber,
         __FILE__, __LINE__,
         s.str ());
@@ -11131,7 +11131,7 @@ void mxmlTree2MsrTranslator::visitStart ( S_wavy_line& elt )
   // placement
 
   string placement =
-    elt->getAttributeValue ("placement");
+    elt->getAttributeValue (attributeNames::placement);
 
   msrPlacementKind
     ornamentPlacementKind = kPlacementNone;
@@ -11148,7 +11148,7 @@ void mxmlTree2MsrTranslator::visitStart ( S_wavy_line& elt )
       "\" is unknown";
     
     msrMusicXMLError (
-      gXml2lyOptions->fInputSourceName,
+      gXml2lyOptions ()->fInputSourceName,
       inputLineNumber,
       __FILE__, __LINE__,
       s.str ());    
@@ -11182,7 +11182,7 @@ void mxmlTree2MsrTranslator::visitStart ( S_wavy_line& elt )
           "wavy-line stop found without corresponding start, ignoring it";
         
         msrMusicXMLWarning (
-          gXml2lyOptions->fInputSourceName,
+          gXml2lyOptions ()->fInputSourceName,
           inputLineNumber,
           s.str ());    
       }
@@ -11209,7 +11209,7 @@ void mxmlTree2MsrTranslator::visitStart ( S_turn& elt )
   int inputLineNumber =
     elt->getInputLineNumber ();
 
-  if (gMusicXMLOptions->fTraceMusicXMLTreeVisitors) {
+  if (gMusicXMLOptions ()->fTraceMusicXMLTreeVisitors) {
     fLogOutputStream <<
       "--> Start visiting S_turn" <<
       ", line " << inputLineNumber <<
@@ -11219,7 +11219,7 @@ void mxmlTree2MsrTranslator::visitStart ( S_turn& elt )
   // placement
   
   string placement =
-    elt->getAttributeValue ("placement");
+    elt->getAttributeValue (attributeNames::placement);
 
   msrPlacementKind
     ornamentPlacementKind = kPlacementNone;
@@ -11237,7 +11237,7 @@ void mxmlTree2MsrTranslator::visitStart ( S_turn& elt )
       "\" is unknown";
     
     msrMusicXMLError (
-      gXml2lyOptions->fInputSourceName,
+      gXml2lyOptions ()->fInputSourceName,
       inputLineNumber,
       __FILE__, __LINE__,
       s.str ());    
@@ -11258,7 +11258,7 @@ void mxmlTree2MsrTranslator::visitStart ( S_inverted_turn& elt )
   int inputLineNumber =
     elt->getInputLineNumber ();
 
-  if (gMusicXMLOptions->fTraceMusicXMLTreeVisitors) {
+  if (gMusicXMLOptions ()->fTraceMusicXMLTreeVisitors) {
     fLogOutputStream <<
       "--> Start visiting S_inverted_turn" <<
       ", line " << inputLineNumber <<
@@ -11268,7 +11268,7 @@ void mxmlTree2MsrTranslator::visitStart ( S_inverted_turn& elt )
   // placement
   
   string placement =
-    elt->getAttributeValue ("placement");
+    elt->getAttributeValue (attributeNames::placement);
 
   msrPlacementKind
     ornamentPlacementKind = kPlacementNone;
@@ -11286,7 +11286,7 @@ void mxmlTree2MsrTranslator::visitStart ( S_inverted_turn& elt )
       "\" is unknown";
     
     msrMusicXMLError (
-      gXml2lyOptions->fInputSourceName,
+      gXml2lyOptions ()->fInputSourceName,
       inputLineNumber,
       __FILE__, __LINE__,
       s.str ());    
@@ -11307,7 +11307,7 @@ void mxmlTree2MsrTranslator::visitStart ( S_delayed_turn& elt )
   int inputLineNumber =
     elt->getInputLineNumber ();
 
-  if (gMusicXMLOptions->fTraceMusicXMLTreeVisitors) {
+  if (gMusicXMLOptions ()->fTraceMusicXMLTreeVisitors) {
     fLogOutputStream <<
       "--> Start visiting S_delayed_turn" <<
       ", line " << inputLineNumber <<
@@ -11317,7 +11317,7 @@ void mxmlTree2MsrTranslator::visitStart ( S_delayed_turn& elt )
   // placement
   
   string placement =
-    elt->getAttributeValue ("placement");
+    elt->getAttributeValue (attributeNames::placement);
 
   msrPlacementKind
     ornamentPlacementKind = kPlacementNone;
@@ -11335,7 +11335,7 @@ void mxmlTree2MsrTranslator::visitStart ( S_delayed_turn& elt )
       "\" is unknown";
     
     msrMusicXMLError (
-      gXml2lyOptions->fInputSourceName,
+      gXml2lyOptions ()->fInputSourceName,
       inputLineNumber,
       __FILE__, __LINE__,
       s.str ());    
@@ -11356,7 +11356,7 @@ void mxmlTree2MsrTranslator::visitStart ( S_delayed_inverted_turn& elt )
   int inputLineNumber =
     elt->getInputLineNumber ();
 
-  if (gMusicXMLOptions->fTraceMusicXMLTreeVisitors) {
+  if (gMusicXMLOptions ()->fTraceMusicXMLTreeVisitors) {
     fLogOutputStream <<
       "--> Start visiting S_delayed_inverted_turn" <<
       ", line " << inputLineNumber <<
@@ -11366,7 +11366,7 @@ void mxmlTree2MsrTranslator::visitStart ( S_delayed_inverted_turn& elt )
   // placement
   
   string placement =
-    elt->getAttributeValue ("placement");
+    elt->getAttributeValue (attributeNames::placement);
 
   msrPlacementKind
     ornamentPlacementKind = kPlacementNone;
@@ -11384,7 +11384,7 @@ void mxmlTree2MsrTranslator::visitStart ( S_delayed_inverted_turn& elt )
       "\" is unknown";
     
     msrMusicXMLError (
-      gXml2lyOptions->fInputSourceName,
+      gXml2lyOptions ()->fInputSourceName,
       inputLineNumber,
       __FILE__, __LINE__,
       s.str ());    
@@ -11405,7 +11405,7 @@ void mxmlTree2MsrTranslator::visitStart ( S_vertical_turn& elt )
   int inputLineNumber =
     elt->getInputLineNumber ();
 
-  if (gMusicXMLOptions->fTraceMusicXMLTreeVisitors) {
+  if (gMusicXMLOptions ()->fTraceMusicXMLTreeVisitors) {
     fLogOutputStream <<
       "--> Start visiting S_vertical_turn" <<
       ", line " << inputLineNumber <<
@@ -11415,7 +11415,7 @@ void mxmlTree2MsrTranslator::visitStart ( S_vertical_turn& elt )
   // placement
   
   string placement =
-    elt->getAttributeValue ("placement");
+    elt->getAttributeValue (attributeNames::placement);
 
   msrPlacementKind
     ornamentPlacementKind = kPlacementNone;
@@ -11433,7 +11433,7 @@ void mxmlTree2MsrTranslator::visitStart ( S_vertical_turn& elt )
       "\" is unknown";
     
     msrMusicXMLError (
-      gXml2lyOptions->fInputSourceName,
+      gXml2lyOptions ()->fInputSourceName,
       inputLineNumber,
       __FILE__, __LINE__,
       s.str ());    
@@ -11454,7 +11454,7 @@ void mxmlTree2MsrTranslator::visitStart ( S_mordent& elt )
   int inputLineNumber =
     elt->getInputLineNumber ();
 
-  if (gMusicXMLOptions->fTraceMusicXMLTreeVisitors) {
+  if (gMusicXMLOptions ()->fTraceMusicXMLTreeVisitors) {
     fLogOutputStream <<
       "--> Start visiting S_mordent" <<
       ", line " << inputLineNumber <<
@@ -11464,7 +11464,7 @@ void mxmlTree2MsrTranslator::visitStart ( S_mordent& elt )
   // placement
   
   string placement =
-    elt->getAttributeValue ("placement");
+    elt->getAttributeValue (attributeNames::placement);
 
   msrPlacementKind
     ornamentPlacementKind = kPlacementNone;
@@ -11482,7 +11482,7 @@ void mxmlTree2MsrTranslator::visitStart ( S_mordent& elt )
       "\" is unknown";
     
     msrMusicXMLError (
-      gXml2lyOptions->fInputSourceName,
+      gXml2lyOptions ()->fInputSourceName,
       inputLineNumber,
       __FILE__, __LINE__,
       s.str ());    
@@ -11503,7 +11503,7 @@ void mxmlTree2MsrTranslator::visitStart ( S_inverted_mordent& elt )
   int inputLineNumber =
     elt->getInputLineNumber ();
 
-  if (gMusicXMLOptions->fTraceMusicXMLTreeVisitors) {
+  if (gMusicXMLOptions ()->fTraceMusicXMLTreeVisitors) {
     fLogOutputStream <<
       "--> Start visiting S_inverted_mordent" <<
       ", line " << inputLineNumber <<
@@ -11513,7 +11513,7 @@ void mxmlTree2MsrTranslator::visitStart ( S_inverted_mordent& elt )
   // placement
   
   string placement =
-    elt->getAttributeValue ("placement");
+    elt->getAttributeValue (attributeNames::placement);
 
   msrPlacementKind
     ornamentPlacementKind = kPlacementNone;
@@ -11531,7 +11531,7 @@ void mxmlTree2MsrTranslator::visitStart ( S_inverted_mordent& elt )
       "\" is unknown";
     
     msrMusicXMLError (
-      gXml2lyOptions->fInputSourceName,
+      gXml2lyOptions ()->fInputSourceName,
       inputLineNumber,
       __FILE__, __LINE__,
       s.str ());    
@@ -11552,7 +11552,7 @@ void mxmlTree2MsrTranslator::visitStart ( S_schleifer& elt )
   int inputLineNumber =
     elt->getInputLineNumber ();
 
-  if (gMusicXMLOptions->fTraceMusicXMLTreeVisitors) {
+  if (gMusicXMLOptions ()->fTraceMusicXMLTreeVisitors) {
     fLogOutputStream <<
       "--> Start visiting S_schleifer" <<
       ", line " << inputLineNumber <<
@@ -11562,7 +11562,7 @@ void mxmlTree2MsrTranslator::visitStart ( S_schleifer& elt )
   // placement
   
   string placement =
-    elt->getAttributeValue ("placement");
+    elt->getAttributeValue (attributeNames::placement);
 
   msrPlacementKind
     ornamentPlacementKind = kPlacementNone;
@@ -11580,7 +11580,7 @@ void mxmlTree2MsrTranslator::visitStart ( S_schleifer& elt )
       "\" is unknown";
     
     msrMusicXMLError (
-      gXml2lyOptions->fInputSourceName,
+      gXml2lyOptions ()->fInputSourceName,
       inputLineNumber,
       __FILE__, __LINE__,
       s.str ());    
@@ -11601,7 +11601,7 @@ void mxmlTree2MsrTranslator::visitStart ( S_shake& elt )
   int inputLineNumber =
     elt->getInputLineNumber ();
 
-  if (gMusicXMLOptions->fTraceMusicXMLTreeVisitors) {
+  if (gMusicXMLOptions ()->fTraceMusicXMLTreeVisitors) {
     fLogOutputStream <<
       "--> Start visiting S_shake" <<
       ", line " << inputLineNumber <<
@@ -11611,7 +11611,7 @@ void mxmlTree2MsrTranslator::visitStart ( S_shake& elt )
   // placement
   
   string placement =
-    elt->getAttributeValue ("placement");
+    elt->getAttributeValue (attributeNames::placement);
 
   msrPlacementKind
     ornamentPlacementKind = kPlacementNone;
@@ -11629,7 +11629,7 @@ void mxmlTree2MsrTranslator::visitStart ( S_shake& elt )
       "\" is unknown";
     
     msrMusicXMLError (
-      gXml2lyOptions->fInputSourceName,
+      gXml2lyOptions ()->fInputSourceName,
       inputLineNumber,
       __FILE__, __LINE__,
       s.str ());    
@@ -11650,7 +11650,7 @@ void mxmlTree2MsrTranslator::visitStart ( S_accidental_mark& elt )
   int inputLineNumber =
     elt->getInputLineNumber ();
 
-  if (gMusicXMLOptions->fTraceMusicXMLTreeVisitors) {
+  if (gMusicXMLOptions ()->fTraceMusicXMLTreeVisitors) {
     fLogOutputStream <<
       "--> Start visiting S_accidental_mark" <<
       ", line " << inputLineNumber <<
@@ -11698,7 +11698,7 @@ void mxmlTree2MsrTranslator::visitStart ( S_accidental_mark& elt )
       "\" is unknown";
     
     msrMusicXMLError (
-      gXml2lyOptions->fInputSourceName,
+      gXml2lyOptions ()->fInputSourceName,
       inputLineNumber,
       __FILE__, __LINE__,
       s.str ());    
@@ -11707,7 +11707,7 @@ void mxmlTree2MsrTranslator::visitStart ( S_accidental_mark& elt )
   // placement
   
   string placement =
-    elt->getAttributeValue ("placement");
+    elt->getAttributeValue (attributeNames::placement);
 
   msrPlacementKind
     ornamentPlacementKind = kPlacementNone;
@@ -11724,7 +11724,7 @@ void mxmlTree2MsrTranslator::visitStart ( S_accidental_mark& elt )
       "\" is unknown";
     
     msrMusicXMLError (
-      gXml2lyOptions->fInputSourceName,
+      gXml2lyOptions ()->fInputSourceName,
       inputLineNumber,
       __FILE__, __LINE__,
       s.str ());    
@@ -11746,7 +11746,7 @@ void mxmlTree2MsrTranslator::visitStart ( S_accidental_mark& elt )
 
 void mxmlTree2MsrTranslator::visitEnd ( S_ornaments& elt )
 {
-  if (gMusicXMLOptions->fTraceMusicXMLTreeVisitors) {
+  if (gMusicXMLOptions ()->fTraceMusicXMLTreeVisitors) {
     fLogOutputStream <<
       "--> End visiting S_ornaments" <<
       ", line " << elt->getInputLineNumber () <<
@@ -11760,7 +11760,7 @@ void mxmlTree2MsrTranslator::visitStart( S_f& elt)
   int inputLineNumber =
     elt->getInputLineNumber ();
 
-  if (gMusicXMLOptions->fTraceMusicXMLTreeVisitors) {
+  if (gMusicXMLOptions ()->fTraceMusicXMLTreeVisitors) {
     fLogOutputStream <<
       "--> Start visiting S_f" <<
       ", line " << inputLineNumber <<
@@ -11770,7 +11770,7 @@ void mxmlTree2MsrTranslator::visitStart( S_f& elt)
   // placement
   
   string placement =
-    elt->getAttributeValue ("placement");
+    elt->getAttributeValue (attributeNames::placement);
 
   msrPlacementKind
     dynamicsPlacementKind = kPlacementNone;
@@ -11788,7 +11788,7 @@ void mxmlTree2MsrTranslator::visitStart( S_f& elt)
       "\" is unknown";
     
     msrMusicXMLError (
-      gXml2lyOptions->fInputSourceName,
+      gXml2lyOptions ()->fInputSourceName,
       inputLineNumber,
       __FILE__, __LINE__,
       s.str ());    
@@ -11808,7 +11808,7 @@ void mxmlTree2MsrTranslator::visitStart( S_ff& elt)
   int inputLineNumber =
     elt->getInputLineNumber ();
 
-  if (gMusicXMLOptions->fTraceMusicXMLTreeVisitors) {
+  if (gMusicXMLOptions ()->fTraceMusicXMLTreeVisitors) {
     fLogOutputStream <<
       "--> Start visiting S_ff" <<
       ", line " << inputLineNumber <<
@@ -11816,7 +11816,7 @@ void mxmlTree2MsrTranslator::visitStart( S_ff& elt)
   }
 
   string placement =
-    elt->getAttributeValue ("placement");
+    elt->getAttributeValue (attributeNames::placement);
 
   msrPlacementKind
     dynamicsPlacementKind = kPlacementNone;
@@ -11834,7 +11834,7 @@ void mxmlTree2MsrTranslator::visitStart( S_ff& elt)
       "\" is unknown";
     
     msrMusicXMLError (
-      gXml2lyOptions->fInputSourceName,
+      gXml2lyOptions ()->fInputSourceName,
       inputLineNumber,
       __FILE__, __LINE__,
       s.str ());    
@@ -11854,7 +11854,7 @@ void mxmlTree2MsrTranslator::visitStart( S_fff& elt)
   int inputLineNumber =
     elt->getInputLineNumber ();
 
-  if (gMusicXMLOptions->fTraceMusicXMLTreeVisitors) {
+  if (gMusicXMLOptions ()->fTraceMusicXMLTreeVisitors) {
     fLogOutputStream <<
       "--> Start visiting S_fff" <<
       ", line " << inputLineNumber <<
@@ -11862,7 +11862,7 @@ void mxmlTree2MsrTranslator::visitStart( S_fff& elt)
   }
 
   string placement =
-    elt->getAttributeValue ("placement");
+    elt->getAttributeValue (attributeNames::placement);
 
   msrPlacementKind
     dynamicsPlacementKind = kPlacementNone;
@@ -11880,7 +11880,7 @@ void mxmlTree2MsrTranslator::visitStart( S_fff& elt)
       "\" is unknown";
     
     msrMusicXMLError (
-      gXml2lyOptions->fInputSourceName,
+      gXml2lyOptions ()->fInputSourceName,
       inputLineNumber,
       __FILE__, __LINE__,
       s.str ());    
@@ -11900,7 +11900,7 @@ void mxmlTree2MsrTranslator::visitStart( S_ffff& elt)
   int inputLineNumber =
     elt->getInputLineNumber ();
 
-  if (gMusicXMLOptions->fTraceMusicXMLTreeVisitors) {
+  if (gMusicXMLOptions ()->fTraceMusicXMLTreeVisitors) {
     fLogOutputStream <<
       "--> Start visiting S_ffff" <<
       ", line " << inputLineNumber <<
@@ -11908,7 +11908,7 @@ void mxmlTree2MsrTranslator::visitStart( S_ffff& elt)
   }
 
   string placement =
-    elt->getAttributeValue ("placement");
+    elt->getAttributeValue (attributeNames::placement);
 
   msrPlacementKind
     dynamicsPlacementKind = kPlacementNone;
@@ -11926,7 +11926,7 @@ void mxmlTree2MsrTranslator::visitStart( S_ffff& elt)
       "\" is unknown";
     
     msrMusicXMLError (
-      gXml2lyOptions->fInputSourceName,
+      gXml2lyOptions ()->fInputSourceName,
       inputLineNumber,
       __FILE__, __LINE__,
       s.str ());    
@@ -11946,7 +11946,7 @@ void mxmlTree2MsrTranslator::visitStart( S_fffff& elt)
   int inputLineNumber =
     elt->getInputLineNumber ();
 
-  if (gMusicXMLOptions->fTraceMusicXMLTreeVisitors) {
+  if (gMusicXMLOptions ()->fTraceMusicXMLTreeVisitors) {
     fLogOutputStream <<
       "--> Start visiting S_fffff" <<
       ", line " << inputLineNumber <<
@@ -11954,7 +11954,7 @@ void mxmlTree2MsrTranslator::visitStart( S_fffff& elt)
   }
 
   string placement =
-    elt->getAttributeValue ("placement");
+    elt->getAttributeValue (attributeNames::placement);
 
   msrPlacementKind
     dynamicsPlacementKind = kPlacementNone;
@@ -11972,7 +11972,7 @@ void mxmlTree2MsrTranslator::visitStart( S_fffff& elt)
       "\" is unknown";
     
     msrMusicXMLError (
-      gXml2lyOptions->fInputSourceName,
+      gXml2lyOptions ()->fInputSourceName,
       inputLineNumber,
       __FILE__, __LINE__,
       s.str ());    
@@ -11992,7 +11992,7 @@ void mxmlTree2MsrTranslator::visitStart( S_ffffff& elt)
   int inputLineNumber =
     elt->getInputLineNumber ();
 
-  if (gMusicXMLOptions->fTraceMusicXMLTreeVisitors) {
+  if (gMusicXMLOptions ()->fTraceMusicXMLTreeVisitors) {
     fLogOutputStream <<
       "--> Start visiting S_ffffff" <<
       ", line " << inputLineNumber <<
@@ -12000,7 +12000,7 @@ void mxmlTree2MsrTranslator::visitStart( S_ffffff& elt)
   }
 
   string placement =
-    elt->getAttributeValue ("placement");
+    elt->getAttributeValue (attributeNames::placement);
 
   msrPlacementKind
     dynamicsPlacementKind = kPlacementNone;
@@ -12018,7 +12018,7 @@ void mxmlTree2MsrTranslator::visitStart( S_ffffff& elt)
       "\" is unknown";
     
     msrMusicXMLError (
-      gXml2lyOptions->fInputSourceName,
+      gXml2lyOptions ()->fInputSourceName,
       inputLineNumber,
       __FILE__, __LINE__,
       s.str ());    
@@ -12039,7 +12039,7 @@ void mxmlTree2MsrTranslator::visitStart( S_p& elt)
   int inputLineNumber =
     elt->getInputLineNumber ();
 
-  if (gMusicXMLOptions->fTraceMusicXMLTreeVisitors) {
+  if (gMusicXMLOptions ()->fTraceMusicXMLTreeVisitors) {
     fLogOutputStream <<
       "--> Start visiting S_p" <<
       ", line " << inputLineNumber <<
@@ -12047,7 +12047,7 @@ void mxmlTree2MsrTranslator::visitStart( S_p& elt)
   }
 
   string placement =
-    elt->getAttributeValue ("placement");
+    elt->getAttributeValue (attributeNames::placement);
 
   msrPlacementKind
     dynamicsPlacementKind = kPlacementNone;
@@ -12065,7 +12065,7 @@ void mxmlTree2MsrTranslator::visitStart( S_p& elt)
       "\" is unknown";
     
     msrMusicXMLError (
-      gXml2lyOptions->fInputSourceName,
+      gXml2lyOptions ()->fInputSourceName,
       inputLineNumber,
       __FILE__, __LINE__,
       s.str ());    
@@ -12085,7 +12085,7 @@ void mxmlTree2MsrTranslator::visitStart( S_pp& elt)
   int inputLineNumber =
     elt->getInputLineNumber ();
 
-  if (gMusicXMLOptions->fTraceMusicXMLTreeVisitors) {
+  if (gMusicXMLOptions ()->fTraceMusicXMLTreeVisitors) {
     fLogOutputStream <<
       "--> Start visiting S_pp" <<
       ", line " << inputLineNumber <<
@@ -12093,7 +12093,7 @@ void mxmlTree2MsrTranslator::visitStart( S_pp& elt)
   }
 
   string placement =
-    elt->getAttributeValue ("placement");
+    elt->getAttributeValue (attributeNames::placement);
 
   msrPlacementKind
     dynamicsPlacementKind = kPlacementNone;
@@ -12111,7 +12111,7 @@ void mxmlTree2MsrTranslator::visitStart( S_pp& elt)
       "\" is unknown";
     
     msrMusicXMLError (
-      gXml2lyOptions->fInputSourceName,
+      gXml2lyOptions ()->fInputSourceName,
       inputLineNumber,
       __FILE__, __LINE__,
       s.str ());    
@@ -12131,7 +12131,7 @@ void mxmlTree2MsrTranslator::visitStart( S_ppp& elt)
   int inputLineNumber =
     elt->getInputLineNumber ();
 
-  if (gMusicXMLOptions->fTraceMusicXMLTreeVisitors) {
+  if (gMusicXMLOptions ()->fTraceMusicXMLTreeVisitors) {
     fLogOutputStream <<
       "--> Start visiting S_ppp" <<
       ", line " << inputLineNumber <<
@@ -12139,7 +12139,7 @@ void mxmlTree2MsrTranslator::visitStart( S_ppp& elt)
   }
 
   string placement =
-    elt->getAttributeValue ("placement");
+    elt->getAttributeValue (attributeNames::placement);
 
   msrPlacementKind
     dynamicsPlacementKind = kPlacementNone;
@@ -12157,7 +12157,7 @@ void mxmlTree2MsrTranslator::visitStart( S_ppp& elt)
       "\" is unknown";
     
     msrMusicXMLError (
-      gXml2lyOptions->fInputSourceName,
+      gXml2lyOptions ()->fInputSourceName,
       inputLineNumber,
       __FILE__, __LINE__,
       s.str ());    
@@ -12177,7 +12177,7 @@ void mxmlTree2MsrTranslator::visitStart( S_pppp& elt)
   int inputLineNumber =
     elt->getInputLineNumber ();
 
-  if (gMusicXMLOptions->fTraceMusicXMLTreeVisitors) {
+  if (gMusicXMLOptions ()->fTraceMusicXMLTreeVisitors) {
     fLogOutputStream <<
       "--> Start visiting S_pppp" <<
       ", line " << inputLineNumber <<
@@ -12185,7 +12185,7 @@ void mxmlTree2MsrTranslator::visitStart( S_pppp& elt)
   }
 
   string placement =
-    elt->getAttributeValue ("placement");
+    elt->getAttributeValue (attributeNames::placement);
 
   msrPlacementKind
     dynamicsPlacementKind = kPlacementNone;
@@ -12203,7 +12203,7 @@ void mxmlTree2MsrTranslator::visitStart( S_pppp& elt)
       "\" is unknown";
     
     msrMusicXMLError (
-      gXml2lyOptions->fInputSourceName,
+      gXml2lyOptions ()->fInputSourceName,
       inputLineNumber,
       __FILE__, __LINE__,
       s.str ());    
@@ -12223,7 +12223,7 @@ void mxmlTree2MsrTranslator::visitStart( S_ppppp& elt)
   int inputLineNumber =
     elt->getInputLineNumber ();
 
-  if (gMusicXMLOptions->fTraceMusicXMLTreeVisitors) {
+  if (gMusicXMLOptions ()->fTraceMusicXMLTreeVisitors) {
     fLogOutputStream <<
       "--> Start visiting S_ppppp" <<
       ", line " << inputLineNumber <<
@@ -12231,7 +12231,7 @@ void mxmlTree2MsrTranslator::visitStart( S_ppppp& elt)
   }
 
   string placement =
-    elt->getAttributeValue ("placement");
+    elt->getAttributeValue (attributeNames::placement);
 
   msrPlacementKind
     dynamicsPlacementKind = kPlacementNone;
@@ -12249,7 +12249,7 @@ void mxmlTree2MsrTranslator::visitStart( S_ppppp& elt)
       "\" is unknown";
     
     msrMusicXMLError (
-      gXml2lyOptions->fInputSourceName,
+      gXml2lyOptions ()->fInputSourceName,
       inputLineNumber,
       __FILE__, __LINE__,
       s.str ());    
@@ -12269,7 +12269,7 @@ void mxmlTree2MsrTranslator::visitStart( S_pppppp& elt)
   int inputLineNumber =
     elt->getInputLineNumber ();
 
-  if (gMusicXMLOptions->fTraceMusicXMLTreeVisitors) {
+  if (gMusicXMLOptions ()->fTraceMusicXMLTreeVisitors) {
     fLogOutputStream <<
       "--> Start visiting S_pppppp" <<
       ", line " << inputLineNumber <<
@@ -12277,7 +12277,7 @@ void mxmlTree2MsrTranslator::visitStart( S_pppppp& elt)
   }
 
   string placement =
-    elt->getAttributeValue ("placement");
+    elt->getAttributeValue (attributeNames::placement);
 
   msrPlacementKind
     dynamicsPlacementKind = kPlacementNone;
@@ -12295,7 +12295,7 @@ void mxmlTree2MsrTranslator::visitStart( S_pppppp& elt)
       "\" is unknown";
     
     msrMusicXMLError (
-      gXml2lyOptions->fInputSourceName,
+      gXml2lyOptions ()->fInputSourceName,
       inputLineNumber,
       __FILE__, __LINE__,
       s.str ());    
@@ -12317,7 +12317,7 @@ void mxmlTree2MsrTranslator::visitStart( S_mf& elt)
   int inputLineNumber =
     elt->getInputLineNumber ();
 
-  if (gMusicXMLOptions->fTraceMusicXMLTreeVisitors) {
+  if (gMusicXMLOptions ()->fTraceMusicXMLTreeVisitors) {
     fLogOutputStream <<
       "--> Start visiting S_mf" <<
       ", line " << inputLineNumber <<
@@ -12325,7 +12325,7 @@ void mxmlTree2MsrTranslator::visitStart( S_mf& elt)
   }
 
   string placement =
-    elt->getAttributeValue ("placement");
+    elt->getAttributeValue (attributeNames::placement);
 
   msrPlacementKind
     dynamicsPlacementKind = kPlacementNone;
@@ -12343,7 +12343,7 @@ void mxmlTree2MsrTranslator::visitStart( S_mf& elt)
       "\" is unknown";
     
     msrMusicXMLError (
-      gXml2lyOptions->fInputSourceName,
+      gXml2lyOptions ()->fInputSourceName,
       inputLineNumber,
       __FILE__, __LINE__,
       s.str ());    
@@ -12363,7 +12363,7 @@ void mxmlTree2MsrTranslator::visitStart( S_mp& elt)
   int inputLineNumber =
     elt->getInputLineNumber ();
 
-  if (gMusicXMLOptions->fTraceMusicXMLTreeVisitors) {
+  if (gMusicXMLOptions ()->fTraceMusicXMLTreeVisitors) {
     fLogOutputStream <<
       "--> Start visiting S_mp" <<
       ", line " << inputLineNumber <<
@@ -12371,7 +12371,7 @@ void mxmlTree2MsrTranslator::visitStart( S_mp& elt)
   }
 
   string placement =
-    elt->getAttributeValue ("placement");
+    elt->getAttributeValue (attributeNames::placement);
 
   msrPlacementKind
     dynamicsPlacementKind = kPlacementNone;
@@ -12389,7 +12389,7 @@ void mxmlTree2MsrTranslator::visitStart( S_mp& elt)
       "\" is unknown";
     
     msrMusicXMLError (
-      gXml2lyOptions->fInputSourceName,
+      gXml2lyOptions ()->fInputSourceName,
       inputLineNumber,
       __FILE__, __LINE__,
       s.str ());    
@@ -12410,7 +12410,7 @@ void mxmlTree2MsrTranslator::visitStart( S_fp& elt)
   int inputLineNumber =
     elt->getInputLineNumber ();
 
-  if (gMusicXMLOptions->fTraceMusicXMLTreeVisitors) {
+  if (gMusicXMLOptions ()->fTraceMusicXMLTreeVisitors) {
     fLogOutputStream <<
       "--> Start visiting S_fp" <<
       ", line " << inputLineNumber <<
@@ -12418,7 +12418,7 @@ void mxmlTree2MsrTranslator::visitStart( S_fp& elt)
   }
 
   string placement =
-    elt->getAttributeValue ("placement");
+    elt->getAttributeValue (attributeNames::placement);
 
   msrPlacementKind
     dynamicsPlacementKind = kPlacementNone;
@@ -12436,7 +12436,7 @@ void mxmlTree2MsrTranslator::visitStart( S_fp& elt)
       "\" is unknown";
     
     msrMusicXMLError (
-      gXml2lyOptions->fInputSourceName,
+      gXml2lyOptions ()->fInputSourceName,
       inputLineNumber,
       __FILE__, __LINE__,
       s.str ());    
@@ -12456,7 +12456,7 @@ void mxmlTree2MsrTranslator::visitStart( S_fz& elt)
   int inputLineNumber =
     elt->getInputLineNumber ();
 
-  if (gMusicXMLOptions->fTraceMusicXMLTreeVisitors) {
+  if (gMusicXMLOptions ()->fTraceMusicXMLTreeVisitors) {
     fLogOutputStream <<
       "--> Start visiting S_fz" <<
       ", line " << inputLineNumber <<
@@ -12464,7 +12464,7 @@ void mxmlTree2MsrTranslator::visitStart( S_fz& elt)
   }
 
   string placement =
-    elt->getAttributeValue ("placement");
+    elt->getAttributeValue (attributeNames::placement);
 
   msrPlacementKind
     dynamicsPlacementKind = kPlacementNone;
@@ -12482,7 +12482,7 @@ void mxmlTree2MsrTranslator::visitStart( S_fz& elt)
       "\" is unknown";
     
     msrMusicXMLError (
-      gXml2lyOptions->fInputSourceName,
+      gXml2lyOptions ()->fInputSourceName,
       inputLineNumber,
       __FILE__, __LINE__,
       s.str ());    
@@ -12503,7 +12503,7 @@ void mxmlTree2MsrTranslator::visitStart( S_rf& elt)
   int inputLineNumber =
     elt->getInputLineNumber ();
 
-  if (gMusicXMLOptions->fTraceMusicXMLTreeVisitors) {
+  if (gMusicXMLOptions ()->fTraceMusicXMLTreeVisitors) {
     fLogOutputStream <<
       "--> Start visiting S_rf" <<
       ", line " << inputLineNumber <<
@@ -12511,7 +12511,7 @@ void mxmlTree2MsrTranslator::visitStart( S_rf& elt)
   }
 
   string placement =
-    elt->getAttributeValue ("placement");
+    elt->getAttributeValue (attributeNames::placement);
 
   msrPlacementKind
     dynamicsPlacementKind = kPlacementNone;
@@ -12529,7 +12529,7 @@ void mxmlTree2MsrTranslator::visitStart( S_rf& elt)
       "\" is unknown";
     
     msrMusicXMLError (
-      gXml2lyOptions->fInputSourceName,
+      gXml2lyOptions ()->fInputSourceName,
       inputLineNumber,
       __FILE__, __LINE__,
       s.str ());    
@@ -12550,7 +12550,7 @@ void mxmlTree2MsrTranslator::visitStart( S_sf& elt)
   int inputLineNumber =
     elt->getInputLineNumber ();
 
-  if (gMusicXMLOptions->fTraceMusicXMLTreeVisitors) {
+  if (gMusicXMLOptions ()->fTraceMusicXMLTreeVisitors) {
     fLogOutputStream <<
       "--> Start visiting S_sf" <<
       ", line " << inputLineNumber <<
@@ -12558,7 +12558,7 @@ void mxmlTree2MsrTranslator::visitStart( S_sf& elt)
   }
 
   string placement =
-    elt->getAttributeValue ("placement");
+    elt->getAttributeValue (attributeNames::placement);
 
   msrPlacementKind
     dynamicsPlacementKind = kPlacementNone;
@@ -12576,7 +12576,7 @@ void mxmlTree2MsrTranslator::visitStart( S_sf& elt)
       "\" is unknown";
     
     msrMusicXMLError (
-      gXml2lyOptions->fInputSourceName,
+      gXml2lyOptions ()->fInputSourceName,
       inputLineNumber,
       __FILE__, __LINE__,
       s.str ());    
@@ -12597,7 +12597,7 @@ void mxmlTree2MsrTranslator::visitStart( S_rfz& elt)
   int inputLineNumber =
     elt->getInputLineNumber ();
 
-  if (gMusicXMLOptions->fTraceMusicXMLTreeVisitors) {
+  if (gMusicXMLOptions ()->fTraceMusicXMLTreeVisitors) {
     fLogOutputStream <<
       "--> Start visiting S_rfz" <<
       ", line " << inputLineNumber <<
@@ -12605,7 +12605,7 @@ void mxmlTree2MsrTranslator::visitStart( S_rfz& elt)
   }
 
   string placement =
-    elt->getAttributeValue ("placement");
+    elt->getAttributeValue (attributeNames::placement);
 
   msrPlacementKind
     dynamicsPlacementKind = kPlacementNone;
@@ -12622,7 +12622,7 @@ void mxmlTree2MsrTranslator::visitStart( S_rfz& elt)
       "\" is unknown";
     
     msrMusicXMLError (
-      gXml2lyOptions->fInputSourceName,
+      gXml2lyOptions ()->fInputSourceName,
       inputLineNumber,
       __FILE__, __LINE__,
       s.str ());    
@@ -12643,7 +12643,7 @@ void mxmlTree2MsrTranslator::visitStart( S_sfz& elt)
   int inputLineNumber =
     elt->getInputLineNumber ();
 
-  if (gMusicXMLOptions->fTraceMusicXMLTreeVisitors) {
+  if (gMusicXMLOptions ()->fTraceMusicXMLTreeVisitors) {
     fLogOutputStream <<
       "--> Start visiting S_sfz" <<
       ", line " << inputLineNumber <<
@@ -12651,7 +12651,7 @@ void mxmlTree2MsrTranslator::visitStart( S_sfz& elt)
   }
 
   string placement =
-    elt->getAttributeValue ("placement");
+    elt->getAttributeValue (attributeNames::placement);
 
   msrPlacementKind
     dynamicsPlacementKind = kPlacementNone;
@@ -12668,7 +12668,7 @@ void mxmlTree2MsrTranslator::visitStart( S_sfz& elt)
       "\" is unknown";
     
     msrMusicXMLError (
-      gXml2lyOptions->fInputSourceName,
+      gXml2lyOptions ()->fInputSourceName,
       inputLineNumber,
       __FILE__, __LINE__,
       s.str ());    
@@ -12689,7 +12689,7 @@ void mxmlTree2MsrTranslator::visitStart( S_sfp& elt)
   int inputLineNumber =
     elt->getInputLineNumber ();
 
-  if (gMusicXMLOptions->fTraceMusicXMLTreeVisitors) {
+  if (gMusicXMLOptions ()->fTraceMusicXMLTreeVisitors) {
     fLogOutputStream <<
       "--> Start visiting S_sfp" <<
       ", line " << inputLineNumber <<
@@ -12697,7 +12697,7 @@ void mxmlTree2MsrTranslator::visitStart( S_sfp& elt)
   }
 
   string placement =
-    elt->getAttributeValue ("placement");
+    elt->getAttributeValue (attributeNames::placement);
 
   msrPlacementKind
     dynamicsPlacementKind = kPlacementNone;
@@ -12714,7 +12714,7 @@ void mxmlTree2MsrTranslator::visitStart( S_sfp& elt)
       "\" is unknown";
     
     msrMusicXMLError (
-      gXml2lyOptions->fInputSourceName,
+      gXml2lyOptions ()->fInputSourceName,
       inputLineNumber,
       __FILE__, __LINE__,
       s.str ());    
@@ -12735,7 +12735,7 @@ void mxmlTree2MsrTranslator::visitStart( S_sfpp& elt)
   int inputLineNumber =
     elt->getInputLineNumber ();
 
-  if (gMusicXMLOptions->fTraceMusicXMLTreeVisitors) {
+  if (gMusicXMLOptions ()->fTraceMusicXMLTreeVisitors) {
     fLogOutputStream <<
       "--> Start visiting S_sfpp" <<
       ", line " << inputLineNumber <<
@@ -12743,7 +12743,7 @@ void mxmlTree2MsrTranslator::visitStart( S_sfpp& elt)
   }
 
   string placement =
-    elt->getAttributeValue ("placement");
+    elt->getAttributeValue (attributeNames::placement);
 
   msrPlacementKind
     dynamicsPlacementKind = kPlacementNone;
@@ -12760,7 +12760,7 @@ void mxmlTree2MsrTranslator::visitStart( S_sfpp& elt)
       "\" is unknown";
     
     msrMusicXMLError (
-      gXml2lyOptions->fInputSourceName,
+      gXml2lyOptions ()->fInputSourceName,
       inputLineNumber,
       __FILE__, __LINE__,
       s.str ());    
@@ -12781,7 +12781,7 @@ void mxmlTree2MsrTranslator::visitStart( S_sffz& elt)
   int inputLineNumber =
     elt->getInputLineNumber ();
 
- if (gMusicXMLOptions->fTraceMusicXMLTreeVisitors) {
+ if (gMusicXMLOptions ()->fTraceMusicXMLTreeVisitors) {
     fLogOutputStream <<
       "--> Start visiting S_sffz" <<
       ", line " << inputLineNumber <<
@@ -12789,7 +12789,7 @@ void mxmlTree2MsrTranslator::visitStart( S_sffz& elt)
   }
 
   string placement =
-    elt->getAttributeValue ("placement");
+    elt->getAttributeValue (attributeNames::placement);
 
   msrPlacementKind
     dynamicsPlacementKind = kPlacementNone;
@@ -12807,7 +12807,7 @@ void mxmlTree2MsrTranslator::visitStart( S_sffz& elt)
       "\" is unknown";
     
     msrMusicXMLError (
-      gXml2lyOptions->fInputSourceName,
+      gXml2lyOptions ()->fInputSourceName,
       inputLineNumber,
       __FILE__, __LINE__,
       s.str ());    
@@ -12828,7 +12828,7 @@ void mxmlTree2MsrTranslator::visitStart( S_other_dynamics& elt)
   int inputLineNumber =
     elt->getInputLineNumber ();
 
-  if (gMusicXMLOptions->fTraceMusicXMLTreeVisitors) {
+  if (gMusicXMLOptions ()->fTraceMusicXMLTreeVisitors) {
     fLogOutputStream <<
       "--> Start visiting S_other_dynamics" <<
       ", line " << inputLineNumber <<
@@ -12838,7 +12838,7 @@ void mxmlTree2MsrTranslator::visitStart( S_other_dynamics& elt)
   string otherDynamicsValue = elt->getValue ();
 
   string placement =
-    elt->getAttributeValue ("placement");
+    elt->getAttributeValue (attributeNames::placement);
 
   msrPlacementKind
     otherDynamicsPlacementKind = kPlacementNone;
@@ -12856,7 +12856,7 @@ void mxmlTree2MsrTranslator::visitStart( S_other_dynamics& elt)
       "\" is unknown";
     
     msrMusicXMLError (
-      gXml2lyOptions->fInputSourceName,
+      gXml2lyOptions ()->fInputSourceName,
       inputLineNumber,
       __FILE__, __LINE__,
       s.str ());    
@@ -12894,7 +12894,7 @@ void mxmlTree2MsrTranslator::visitStart( S_damper_pedal& elt)
   int inputLineNumber =
     elt->getInputLineNumber ();
 
-  if (gMusicXMLOptions->fTraceMusicXMLTreeVisitors) {
+  if (gMusicXMLOptions ()->fTraceMusicXMLTreeVisitors) {
     fLogOutputStream <<
       "--> Start visiting S_damper_pedal" <<
       ", line " << inputLineNumber <<
@@ -12960,7 +12960,7 @@ void mxmlTree2MsrTranslator::visitStart( S_soft_pedal& elt)
   int inputLineNumber =
     elt->getInputLineNumber ();
 
-  if (gMusicXMLOptions->fTraceMusicXMLTreeVisitors) {
+  if (gMusicXMLOptions ()->fTraceMusicXMLTreeVisitors) {
     fLogOutputStream <<
       "--> Start visiting S_soft_pedal" <<
        ", line " << inputLineNumber <<
@@ -12983,7 +12983,7 @@ void mxmlTree2MsrTranslator::visitStart( S_sostenuto_pedal& elt)
   int inputLineNumber =
     elt->getInputLineNumber ();
 
-  if (gMusicXMLOptions->fTraceMusicXMLTreeVisitors) {
+  if (gMusicXMLOptions ()->fTraceMusicXMLTreeVisitors) {
     fLogOutputStream <<
       "--> Start visiting S_sostenuto_pedal" <<
       ", line " << inputLineNumber <<
@@ -13005,7 +13005,7 @@ void mxmlTree2MsrTranslator::visitStart( S_sostenuto_pedal& elt)
 //______________________________________________________________________________
 void mxmlTree2MsrTranslator::visitStart ( S_cue& elt )
 {
-  if (gMusicXMLOptions->fTraceMusicXMLTreeVisitors) {
+  if (gMusicXMLOptions ()->fTraceMusicXMLTreeVisitors) {
     fLogOutputStream <<
       "--> Start visiting S_cue" <<
       ", line " << elt->getInputLineNumber () <<
@@ -13021,7 +13021,7 @@ void mxmlTree2MsrTranslator::visitStart ( S_grace& elt )
   int inputLineNumber =
     elt->getInputLineNumber ();
 
-  if (gMusicXMLOptions->fTraceMusicXMLTreeVisitors) {
+  if (gMusicXMLOptions ()->fTraceMusicXMLTreeVisitors) {
     fLogOutputStream <<
       "--> Start visiting S_grace" <<
       ", line " << inputLineNumber <<
@@ -13046,7 +13046,7 @@ void mxmlTree2MsrTranslator::visitStart ( S_grace& elt )
   else {
     if (slash.size ()) {
       msrMusicXMLError (
-        gXml2lyOptions->fInputSourceName,
+        gXml2lyOptions ()->fInputSourceName,
         inputLineNumber,
         __FILE__, __LINE__,
         "grace slash \"" + slash + "\" unknown, should be 'yes' or 'no'");
@@ -13079,7 +13079,7 @@ void mxmlTree2MsrTranslator::visitStart ( S_grace& elt )
 //______________________________________________________________________________
 void mxmlTree2MsrTranslator::visitStart ( S_chord& elt)
 {
-  if (gMusicXMLOptions->fTraceMusicXMLTreeVisitors) {
+  if (gMusicXMLOptions ()->fTraceMusicXMLTreeVisitors) {
     fLogOutputStream <<
       "--> Start visiting S_chord" <<
       ", line " << elt->getInputLineNumber () <<
@@ -13098,7 +13098,7 @@ void mxmlTree2MsrTranslator::visitStart ( S_chord& elt)
 //______________________________________________________________________________
 void mxmlTree2MsrTranslator::visitStart ( S_time_modification& elt )
 {
-  if (gMusicXMLOptions->fTraceMusicXMLTreeVisitors) {
+  if (gMusicXMLOptions ()->fTraceMusicXMLTreeVisitors) {
     fLogOutputStream <<
       "--> Start visiting S_time_modification" <<
       ", line " << elt->getInputLineNumber () <<
@@ -13116,7 +13116,7 @@ void mxmlTree2MsrTranslator::visitStart ( S_actual_notes& elt )
   int inputLineNumber =
     elt->getInputLineNumber ();
 
-  if (gMusicXMLOptions->fTraceMusicXMLTreeVisitors) {
+  if (gMusicXMLOptions ()->fTraceMusicXMLTreeVisitors) {
     fLogOutputStream <<
       "--> Start visiting S_actual_notes" <<
       ", line " << inputLineNumber <<
@@ -13130,9 +13130,9 @@ void mxmlTree2MsrTranslator::visitStart ( S_actual_notes& elt )
     
 #ifdef TRACE_OPTIONS
     if (
-      gTraceOptions->fTraceNotesDetails
+      gTraceOptions ()->fTraceNotesDetails
         ||
-      gTraceOptions->fTraceTuplets) {
+      gTraceOptions ()->fTraceTuplets) {
       fLogOutputStream <<
         "fCurrentNoteActualNotes: " <<
         fCurrentNoteActualNotes <<
@@ -13156,9 +13156,9 @@ void mxmlTree2MsrTranslator::visitStart ( S_actual_notes& elt )
     
 #ifdef TRACE_OPTIONS
     if (
-      gTraceOptions->fTraceTempos
+      gTraceOptions ()->fTraceTempos
         ||
-      gTraceOptions->fTraceTuplets) {
+      gTraceOptions ()->fTraceTuplets) {
       fLogOutputStream <<
         "fCurrentMetronomeNoteActualNotes: " <<
         fCurrentMetronomeNoteActualNotes <<
@@ -13175,7 +13175,7 @@ void mxmlTree2MsrTranslator::visitStart ( S_actual_notes& elt )
       "\" is out of context";
     
     msrMusicXMLError (
-      gXml2lyOptions->fInputSourceName,
+      gXml2lyOptions ()->fInputSourceName,
       inputLineNumber,
       __FILE__, __LINE__,
       s.str ());
@@ -13187,7 +13187,7 @@ void mxmlTree2MsrTranslator::visitStart ( S_normal_notes& elt )
   int inputLineNumber =
     elt->getInputLineNumber ();
 
-  if (gMusicXMLOptions->fTraceMusicXMLTreeVisitors) {
+  if (gMusicXMLOptions ()->fTraceMusicXMLTreeVisitors) {
     fLogOutputStream <<
       "--> Start visiting S_normal_notes" <<
       ", line " << inputLineNumber <<
@@ -13201,9 +13201,9 @@ void mxmlTree2MsrTranslator::visitStart ( S_normal_notes& elt )
     
 #ifdef TRACE_OPTIONS
     if (
-      gTraceOptions->fTraceNotesDetails
+      gTraceOptions ()->fTraceNotesDetails
         ||
-      gTraceOptions->fTraceTuplets) {
+      gTraceOptions ()->fTraceTuplets) {
       fLogOutputStream <<
         "fCurrentNoteNormalNotes: " <<
         fCurrentNoteNormalNotes <<
@@ -13227,9 +13227,9 @@ void mxmlTree2MsrTranslator::visitStart ( S_normal_notes& elt )
     
 #ifdef TRACE_OPTIONS
     if (
-      gTraceOptions->fTraceTempos
+      gTraceOptions ()->fTraceTempos
         ||
-      gTraceOptions->fTraceTuplets) {
+      gTraceOptions ()->fTraceTuplets) {
       fLogOutputStream <<
         "fCurrentMetronomeNoteNormalNotes: " <<
         fCurrentMetronomeNoteNormalNotes <<
@@ -13246,7 +13246,7 @@ void mxmlTree2MsrTranslator::visitStart ( S_normal_notes& elt )
       "\" is out of context";
     
     msrMusicXMLError (
-      gXml2lyOptions->fInputSourceName,
+      gXml2lyOptions ()->fInputSourceName,
       inputLineNumber,
       __FILE__, __LINE__,
       s.str ());
@@ -13258,7 +13258,7 @@ void mxmlTree2MsrTranslator::visitStart ( S_normal_type& elt )
   int inputLineNumber =
     elt->getInputLineNumber ();
 
-  if (gMusicXMLOptions->fTraceMusicXMLTreeVisitors) {
+  if (gMusicXMLOptions ()->fTraceMusicXMLTreeVisitors) {
     fLogOutputStream <<
       "--> Start visiting S_normal_type" <<
       ", line " << inputLineNumber <<
@@ -13270,9 +13270,9 @@ void mxmlTree2MsrTranslator::visitStart ( S_normal_type& elt )
   if (fOnGoingNote) {        
 #ifdef TRACE_OPTIONS
     if (
-      gTraceOptions->fTraceNotesDetails
+      gTraceOptions ()->fTraceNotesDetails
         ||
-      gTraceOptions->fTraceTuplets) {
+      gTraceOptions ()->fTraceTuplets) {
       fLogOutputStream <<
         "normalTypeString: " <<
         normalTypeString <<
@@ -13301,9 +13301,9 @@ void mxmlTree2MsrTranslator::visitStart ( S_normal_type& elt )
     
 #ifdef TRACE_OPTIONS
     if (
-      gTraceOptions->fTraceTempos
+      gTraceOptions ()->fTraceTempos
         ||
-      gTraceOptions->fTraceTuplets) {
+      gTraceOptions ()->fTraceTuplets) {
       fLogOutputStream <<
         "fCurrentMetronomeNoteNormalType: " <<
         fCurrentMetronomeNoteNormalType <<
@@ -13321,7 +13321,7 @@ void mxmlTree2MsrTranslator::visitStart ( S_normal_type& elt )
       "\" is out of context";
     
     msrMusicXMLError (
-      gXml2lyOptions->fInputSourceName,
+      gXml2lyOptions ()->fInputSourceName,
       inputLineNumber,
       __FILE__, __LINE__,
       s.str ());
@@ -13334,7 +13334,7 @@ void mxmlTree2MsrTranslator::visitStart ( S_tuplet& elt )
   int inputLineNumber =
     elt->getInputLineNumber ();
 
-  if (gMusicXMLOptions->fTraceMusicXMLTreeVisitors) {
+  if (gMusicXMLOptions ()->fTraceMusicXMLTreeVisitors) {
     fLogOutputStream <<
       "--> Start visiting S_tuplet" <<
       ", line " << inputLineNumber <<
@@ -13345,7 +13345,7 @@ void mxmlTree2MsrTranslator::visitStart ( S_tuplet& elt )
 
   fPreviousTupletNumber = fCurrentTupletNumber;
   
-  fCurrentTupletNumber = elt->getAttributeIntValue ("number", 0);
+  fCurrentTupletNumber = elt->getAttributeIntValue (attributeNames::number, 0);
 
   // bracket
 
@@ -13367,14 +13367,14 @@ void mxmlTree2MsrTranslator::visitStart ( S_tuplet& elt )
           "\" is unknown";
         
         msrMusicXMLError (
-          gXml2lyOptions->fInputSourceName,
+          gXml2lyOptions ()->fInputSourceName,
           inputLineNumber,
           __FILE__, __LINE__,
           s.str ());
       }
       else {
 #ifdef TRACE_OPTIONS
-        if (gTraceOptions->fTraceTuplets) {
+        if (gTraceOptions ()->fTraceTuplets) {
           stringstream s;
           
           s <<
@@ -13382,7 +13382,7 @@ void mxmlTree2MsrTranslator::visitStart ( S_tuplet& elt )
             " \"yes\" is assumed"; // option ??? JMI
           
           msrMusicXMLWarning (
-            gXml2lyOptions->fInputSourceName,
+            gXml2lyOptions ()->fInputSourceName,
             inputLineNumber,
             s.str ());
         }
@@ -13412,7 +13412,7 @@ void mxmlTree2MsrTranslator::visitStart ( S_tuplet& elt )
           "\" is unknown";
         
         msrMusicXMLError (
-          gXml2lyOptions->fInputSourceName,
+          gXml2lyOptions ()->fInputSourceName,
           inputLineNumber,
           __FILE__, __LINE__,
           s.str ());
@@ -13423,7 +13423,7 @@ void mxmlTree2MsrTranslator::visitStart ( S_tuplet& elt )
   // type
 
   {
-    string tupletType = elt->getAttributeValue ("type");
+    string tupletType = elt->getAttributeValue (attributeNames::type);
 
     msrTuplet::msrTupletTypeKind
       previousTupletTypeKind = fCurrentTupletTypeKind;
@@ -13432,7 +13432,7 @@ void mxmlTree2MsrTranslator::visitStart ( S_tuplet& elt )
     
     if      (tupletType == "start") {
 #ifdef TRACE_OPTIONS
-      if (gTraceOptions->fTraceTuplets) {
+      if (gTraceOptions ()->fTraceTuplets) {
         fLogOutputStream <<
           "--> There is a tuplet start (kTupletTypeStart)" <<
           ", line " << inputLineNumber <<
@@ -13444,7 +13444,7 @@ void mxmlTree2MsrTranslator::visitStart ( S_tuplet& elt )
     }
     else if (tupletType == "continue") {
 #ifdef TRACE_OPTIONS
-      if (gTraceOptions->fTraceTuplets) {
+      if (gTraceOptions ()->fTraceTuplets) {
         fLogOutputStream <<
           "--> There is a tuplet continue (kTupletTypeContinue)" <<
           ", line " << inputLineNumber <<
@@ -13468,7 +13468,7 @@ void mxmlTree2MsrTranslator::visitStart ( S_tuplet& elt )
         // for one and the same tuplet number:
         // possible if the note is a tremolo
 #ifdef TRACE_OPTIONS
-        if (gTraceOptions->fTraceTuplets) {
+        if (gTraceOptions ()->fTraceTuplets) {
           fLogOutputStream <<
             "--> There is a tuplet stop right after a tuplet start for tuplet nummber " << fCurrentTupletNumber <<
             " (kTupletTypeStartAndStopInARow)" <<
@@ -13482,7 +13482,7 @@ void mxmlTree2MsrTranslator::visitStart ( S_tuplet& elt )
       else {
         // this is a 'regular' tuplet stop
 #ifdef TRACE_OPTIONS
-        if (gTraceOptions->fTraceTuplets) {
+        if (gTraceOptions ()->fTraceTuplets) {
           fLogOutputStream <<
             "--> There is a tuplet stop (kTupletTypeStop)" <<
             ", line " << inputLineNumber <<
@@ -13501,7 +13501,7 @@ void mxmlTree2MsrTranslator::visitStart ( S_tuplet& elt )
         "\" is unknown";
       
       msrMusicXMLError (
-        gXml2lyOptions->fInputSourceName,
+        gXml2lyOptions ()->fInputSourceName,
         inputLineNumber,
         __FILE__, __LINE__,
         s.str ());
@@ -13528,7 +13528,7 @@ void mxmlTree2MsrTranslator::visitStart ( S_tuplet& elt )
     else {
       if (tupletShowNumber.size ()) {
         msrMusicXMLError (
-          gXml2lyOptions->fInputSourceName,
+          gXml2lyOptions ()->fInputSourceName,
           inputLineNumber,
           __FILE__, __LINE__,
           "tuplet show-number \"" + tupletShowNumber + "\" is unknown");
@@ -13555,7 +13555,7 @@ void mxmlTree2MsrTranslator::visitStart ( S_tuplet& elt )
     else {
       if (tupletShowType.size ()) {
         msrMusicXMLError (
-          gXml2lyOptions->fInputSourceName,
+          gXml2lyOptions ()->fInputSourceName,
           inputLineNumber,
           __FILE__, __LINE__,
           "tuplet show-type \"" + tupletShowType + "\" is unknown");
@@ -13565,9 +13565,9 @@ void mxmlTree2MsrTranslator::visitStart ( S_tuplet& elt )
 
 #ifdef TRACE_OPTIONS
   if (
-    gTraceOptions->fTraceNotesDetails
+    gTraceOptions ()->fTraceNotesDetails
       ||
-    gTraceOptions->fTraceTuplets) {
+    gTraceOptions ()->fTraceTuplets) {
     fLogOutputStream <<
       "fCurrentTupletNumber: " <<
       fCurrentTupletNumber <<
@@ -13592,7 +13592,7 @@ void mxmlTree2MsrTranslator::visitStart ( S_tuplet& elt )
 
 void mxmlTree2MsrTranslator::visitStart ( S_tuplet_actual& elt )
 {
-  if (gMusicXMLOptions->fTraceMusicXMLTreeVisitors) {
+  if (gMusicXMLOptions ()->fTraceMusicXMLTreeVisitors) {
     fLogOutputStream <<
       "--> Start visiting S_tuplet_actual" <<
       ", line " << elt->getInputLineNumber () <<
@@ -13604,7 +13604,7 @@ void mxmlTree2MsrTranslator::visitStart ( S_tuplet_actual& elt )
 
 void mxmlTree2MsrTranslator::visitEnd ( S_tuplet_actual& elt )
 {
-  if (gMusicXMLOptions->fTraceMusicXMLTreeVisitors) {
+  if (gMusicXMLOptions ()->fTraceMusicXMLTreeVisitors) {
     fLogOutputStream <<
       "--> End visiting S_tuplet_actual" <<
       ", line " << elt->getInputLineNumber () <<
@@ -13616,7 +13616,7 @@ void mxmlTree2MsrTranslator::visitEnd ( S_tuplet_actual& elt )
 
 void mxmlTree2MsrTranslator::visitStart ( S_tuplet_normal& elt )
 {
-  if (gMusicXMLOptions->fTraceMusicXMLTreeVisitors) {
+  if (gMusicXMLOptions ()->fTraceMusicXMLTreeVisitors) {
     fLogOutputStream <<
       "--> Start visiting S_tuplet_normal" <<
       ", line " << elt->getInputLineNumber () <<
@@ -13628,7 +13628,7 @@ void mxmlTree2MsrTranslator::visitStart ( S_tuplet_normal& elt )
 
 void mxmlTree2MsrTranslator::visitEnd ( S_tuplet_normal& elt )
 {
-  if (gMusicXMLOptions->fTraceMusicXMLTreeVisitors) {
+  if (gMusicXMLOptions ()->fTraceMusicXMLTreeVisitors) {
     fLogOutputStream <<
       "--> End visiting S_tuplet_normal" <<
       ", line " << elt->getInputLineNumber () <<
@@ -13643,7 +13643,7 @@ void mxmlTree2MsrTranslator::visitStart ( S_tuplet_number& elt )
   int inputLineNumber =
     elt->getInputLineNumber ();
 
-  if (gMusicXMLOptions->fTraceMusicXMLTreeVisitors) {
+  if (gMusicXMLOptions ()->fTraceMusicXMLTreeVisitors) {
     fLogOutputStream <<
       "--> Start visiting S_tuplet_number" <<
       ", line " << inputLineNumber <<
@@ -13661,7 +13661,7 @@ void mxmlTree2MsrTranslator::visitStart ( S_tuplet_number& elt )
   }
   else {
     msrMusicXMLError (
-      gXml2lyOptions->fInputSourceName,
+      gXml2lyOptions ()->fInputSourceName,
       inputLineNumber,
       __FILE__, __LINE__,
       "found a tuplet number out of context");
@@ -13669,9 +13669,9 @@ void mxmlTree2MsrTranslator::visitStart ( S_tuplet_number& elt )
 
 #ifdef TRACE_OPTIONS
   if (
-    gTraceOptions->fTraceNotesDetails
+    gTraceOptions ()->fTraceNotesDetails
       ||
-    gTraceOptions->fTraceTuplets) {
+    gTraceOptions ()->fTraceTuplets) {
     fLogOutputStream <<
       "tuplet number (not handled): " <<
       tupletNumberValue <<
@@ -13685,7 +13685,7 @@ void mxmlTree2MsrTranslator::visitStart ( S_tuplet_type& elt )
   int inputLineNumber =
     elt->getInputLineNumber ();
 
-  if (gMusicXMLOptions->fTraceMusicXMLTreeVisitors) {
+  if (gMusicXMLOptions ()->fTraceMusicXMLTreeVisitors) {
     fLogOutputStream <<
       "--> Start visiting S_tuplet_type" <<
       ", line " << inputLineNumber <<
@@ -13703,7 +13703,7 @@ void mxmlTree2MsrTranslator::visitStart ( S_tuplet_type& elt )
   }
   else {
     msrMusicXMLError (
-      gXml2lyOptions->fInputSourceName,
+      gXml2lyOptions ()->fInputSourceName,
       inputLineNumber,
       __FILE__, __LINE__,
       "found a tuplet number out of context");
@@ -13711,9 +13711,9 @@ void mxmlTree2MsrTranslator::visitStart ( S_tuplet_type& elt )
 
 #ifdef TRACE_OPTIONS
   if (
-    gTraceOptions->fTraceNotesDetails
+    gTraceOptions ()->fTraceNotesDetails
       ||
-    gTraceOptions->fTraceTuplets) {
+    gTraceOptions ()->fTraceTuplets) {
     fLogOutputStream <<
       "tuplet type (not handled): " <<
       tupletTypeValue <<
@@ -13727,7 +13727,7 @@ void mxmlTree2MsrTranslator::visitStart ( S_tuplet_dot& elt )
   int inputLineNumber =
     elt->getInputLineNumber ();
 
-  if (gMusicXMLOptions->fTraceMusicXMLTreeVisitors) {
+  if (gMusicXMLOptions ()->fTraceMusicXMLTreeVisitors) {
     fLogOutputStream <<
       "--> Start visiting S_tuplet_dot" <<
       ", line " << inputLineNumber <<
@@ -13742,7 +13742,7 @@ void mxmlTree2MsrTranslator::visitStart ( S_tuplet_dot& elt )
   }
   else {
     msrMusicXMLError (
-      gXml2lyOptions->fInputSourceName,
+      gXml2lyOptions ()->fInputSourceName,
       inputLineNumber,
       __FILE__, __LINE__,
       "found a tuplet dot out of context");
@@ -13755,7 +13755,7 @@ void mxmlTree2MsrTranslator::visitStart ( S_glissando& elt )
   int inputLineNumber =
     elt->getInputLineNumber ();
 
-  if (gMusicXMLOptions->fTraceMusicXMLTreeVisitors) {
+  if (gMusicXMLOptions ()->fTraceMusicXMLTreeVisitors) {
     fLogOutputStream <<
       "--> Start visiting S_glissando" <<
       ", line " << inputLineNumber <<
@@ -13767,11 +13767,11 @@ void mxmlTree2MsrTranslator::visitStart ( S_glissando& elt )
 
   // number
 
-  int glissandoNumber = elt->getAttributeIntValue ("number", 0);
+  int glissandoNumber = elt->getAttributeIntValue (attributeNames::number, 0);
 
   // type
 
-  string glissandoType = elt->getAttributeValue ("type");
+  string glissandoType = elt->getAttributeValue (attributeNames::type);
     
   msrGlissando::msrGlissandoTypeKind
     glissandoTypeKind = msrGlissando::kGlissandoTypeNone;
@@ -13788,7 +13788,7 @@ void mxmlTree2MsrTranslator::visitStart ( S_glissando& elt )
       "\" is unknown";
     
     msrMusicXMLError (
-      gXml2lyOptions->fInputSourceName,
+      gXml2lyOptions ()->fInputSourceName,
       inputLineNumber,
       __FILE__, __LINE__,
       s.str ());
@@ -13817,7 +13817,7 @@ void mxmlTree2MsrTranslator::visitStart ( S_glissando& elt )
   else {
     if (glissandoLineType.size ()) {
       msrMusicXMLError (
-        gXml2lyOptions->fInputSourceName,
+        gXml2lyOptions ()->fInputSourceName,
         inputLineNumber,
         __FILE__, __LINE__,
         "glissando line-type \"" + glissandoLineType + "\" is unknown");
@@ -13826,9 +13826,9 @@ void mxmlTree2MsrTranslator::visitStart ( S_glissando& elt )
 
 #ifdef TRACE_OPTIONS
   if (
-    gTraceOptions->fTraceNotesDetails
+    gTraceOptions ()->fTraceNotesDetails
       ||
-    gTraceOptions->fTraceGlissandos) {
+    gTraceOptions ()->fTraceGlissandos) {
     fLogOutputStream <<
       "glissandoNumber: " <<
       glissandoNumber <<
@@ -13857,9 +13857,9 @@ void mxmlTree2MsrTranslator::visitStart ( S_glissando& elt )
   // register glissando in this visitor
 #ifdef TRACE_OPTIONS
   if (
-    gTraceOptions->fTraceNotesDetails
+    gTraceOptions ()->fTraceNotesDetails
       ||
-    gTraceOptions->fTraceGlissandos) {
+    gTraceOptions ()->fTraceGlissandos) {
     fLogOutputStream <<
       "Appending glissando '" <<
       glissando->asString () <<
@@ -13877,7 +13877,7 @@ void mxmlTree2MsrTranslator::visitStart ( S_slide& elt )
   int inputLineNumber =
     elt->getInputLineNumber ();
 
-  if (gMusicXMLOptions->fTraceMusicXMLTreeVisitors) {
+  if (gMusicXMLOptions ()->fTraceMusicXMLTreeVisitors) {
     fLogOutputStream <<
       "--> Start visiting S_slide" <<
       ", line " << inputLineNumber <<
@@ -13889,11 +13889,11 @@ void mxmlTree2MsrTranslator::visitStart ( S_slide& elt )
 
   // number
 
-  int slideNumber = elt->getAttributeIntValue ("number", 0);
+  int slideNumber = elt->getAttributeIntValue (attributeNames::number, 0);
 
   // type
 
-  string slideType = elt->getAttributeValue ("type");
+  string slideType = elt->getAttributeValue (attributeNames::type);
     
   msrSlide::msrSlideTypeKind
     slideTypeKind = msrSlide::kSlideTypeNone;
@@ -13910,7 +13910,7 @@ void mxmlTree2MsrTranslator::visitStart ( S_slide& elt )
       "\" is unknown";
     
     msrMusicXMLError (
-      gXml2lyOptions->fInputSourceName,
+      gXml2lyOptions ()->fInputSourceName,
       inputLineNumber,
       __FILE__, __LINE__,
       s.str ());
@@ -13939,7 +13939,7 @@ void mxmlTree2MsrTranslator::visitStart ( S_slide& elt )
   else {
     if (slideLineType.size ()) {
       msrMusicXMLError (
-        gXml2lyOptions->fInputSourceName,
+        gXml2lyOptions ()->fInputSourceName,
         inputLineNumber,
         __FILE__, __LINE__,
         "slide line-type \"" + slideLineType + "\" is unknown");
@@ -13948,9 +13948,9 @@ void mxmlTree2MsrTranslator::visitStart ( S_slide& elt )
 
 #ifdef TRACE_OPTIONS
   if (
-    gTraceOptions->fTraceNotesDetails
+    gTraceOptions ()->fTraceNotesDetails
       ||
-    gTraceOptions->fTraceSlides) {
+    gTraceOptions ()->fTraceSlides) {
     fLogOutputStream <<
       "slideNumber: " <<
       slideNumber <<
@@ -13977,9 +13977,9 @@ void mxmlTree2MsrTranslator::visitStart ( S_slide& elt )
   // register glissando in this visitor
 #ifdef TRACE_OPTIONS
   if (
-    gTraceOptions->fTraceNotesDetails
+    gTraceOptions ()->fTraceNotesDetails
       ||
-    gTraceOptions->fTraceSlides) {
+    gTraceOptions ()->fTraceSlides) {
     fLogOutputStream <<
       "Appending slide '" <<
       slide->asString () <<
@@ -13997,7 +13997,7 @@ void mxmlTree2MsrTranslator::visitStart ( S_rest& elt)
   int inputLineNumber =
     elt->getInputLineNumber ();
 
-  if (gMusicXMLOptions->fTraceMusicXMLTreeVisitors) {
+  if (gMusicXMLOptions ()->fTraceMusicXMLTreeVisitors) {
     fLogOutputStream <<
       "--> Start visiting S_rest" <<
       ", line " << inputLineNumber <<
@@ -14036,7 +14036,7 @@ void mxmlTree2MsrTranslator::visitStart ( S_rest& elt)
   else {
     if (restMeasure.size ()) {
       msrMusicXMLError (
-        gXml2lyOptions->fInputSourceName,
+        gXml2lyOptions ()->fInputSourceName,
         inputLineNumber,
         __FILE__, __LINE__,
         "rest measure \"" + restMeasure + "\" is unknown");
@@ -14050,7 +14050,7 @@ void mxmlTree2MsrTranslator::visitStart ( S_display_step& elt)
   int inputLineNumber =
     elt->getInputLineNumber ();
 
-  if (gMusicXMLOptions->fTraceMusicXMLTreeVisitors) {
+  if (gMusicXMLOptions ()->fTraceMusicXMLTreeVisitors) {
     fLogOutputStream <<
       "--> Start visiting S_display_step" <<
       ", line " << inputLineNumber <<
@@ -14074,7 +14074,7 @@ void mxmlTree2MsrTranslator::visitStart ( S_display_step& elt)
 
 void mxmlTree2MsrTranslator::visitStart ( S_display_octave& elt)
 {
-  if (gMusicXMLOptions->fTraceMusicXMLTreeVisitors) {
+  if (gMusicXMLOptions ()->fTraceMusicXMLTreeVisitors) {
     fLogOutputStream <<
       "--> Start visiting S_display_octave" <<
       ", line " << elt->getInputLineNumber () <<
@@ -14086,7 +14086,7 @@ void mxmlTree2MsrTranslator::visitStart ( S_display_octave& elt)
 
 void mxmlTree2MsrTranslator::visitEnd ( S_unpitched& elt)
 {
-  if (gMusicXMLOptions->fTraceMusicXMLTreeVisitors) {
+  if (gMusicXMLOptions ()->fTraceMusicXMLTreeVisitors) {
     fLogOutputStream <<
       "--> End visiting S_unpitched" <<
       ", line " << elt->getInputLineNumber () <<
@@ -14110,7 +14110,7 @@ S_msrChord mxmlTree2MsrTranslator::createChordFromItsFirstNote (
     chordFirstNote->getInputLineNumber ();
     
 #ifdef TRACE_OPTIONS
-  if (gTraceOptions->fTraceChords || gTraceOptions->fTraceNotes) {
+  if (gTraceOptions ()->fTraceChords || gTraceOptions ()->fTraceNotes) {
     fLogOutputStream <<
       "--> creating a chord from its first note '" <<
       chordFirstNote->asShortString () <<
@@ -14140,7 +14140,7 @@ S_msrChord mxmlTree2MsrTranslator::createChordFromItsFirstNote (
   
   // register note as first member of chord
 #ifdef TRACE_OPTIONS
-  if (gTraceOptions->fTraceChords || gTraceOptions->fTraceNotes) {
+  if (gTraceOptions ()->fTraceChords || gTraceOptions ()->fTraceNotes) {
     fLogOutputStream <<
       "Adding first note " <<
       chordFirstNote->
@@ -14164,7 +14164,7 @@ S_msrChord mxmlTree2MsrTranslator::createChordFromItsFirstNote (
     chordFirstNote, chord);
 
 #ifdef TRACE_OPTIONS
-  if (false && (gTraceOptions->fTraceChords || gTraceOptions->fTraceNotes)) {
+  if (false && (gTraceOptions ()->fTraceChords || gTraceOptions ()->fTraceNotes)) {
     fLogOutputStream << // JMI
       endl <<
       endl <<
@@ -14207,7 +14207,7 @@ void mxmlTree2MsrTranslator::registerVoiceCurrentChordInMap (
   S_msrChord chord)
 {
 #ifdef TRACE_OPTIONS
-  if (gTraceOptions->fTraceChords) {
+  if (gTraceOptions ()->fTraceChords) {
     fLogOutputStream <<
       "Registering chord '" <<
       chord->asString () <<
@@ -14227,7 +14227,7 @@ void mxmlTree2MsrTranslator::registerVoiceCurrentChordInMap (
       chord;
 
 #ifdef TRACE_OPTIONS
-  if (gTraceOptions->fTraceChordsDetails) {
+  if (gTraceOptions ()->fTraceChordsDetails) {
     printCurrentChord ();
   }
 #endif
@@ -14250,7 +14250,7 @@ void mxmlTree2MsrTranslator::printVoicesCurrentChordMap ()
     fLogOutputStream <<
       endl;
 
-    gIndenter++;
+    gIndenter ()++;
 
 //    map<S_msrVoice, S_msrChord>::const_iterator
     map<pair<int, int>, S_msrChord>::const_iterator
@@ -14259,7 +14259,7 @@ void mxmlTree2MsrTranslator::printVoicesCurrentChordMap ()
       i      = iBegin;
 
     for ( ; ; ) {
-      gIndenter++;
+      gIndenter ()++;
 
       / * JMI
       S_msrVoice voice = (*i).first;
@@ -14279,14 +14279,14 @@ void mxmlTree2MsrTranslator::printVoicesCurrentChordMap ()
         chord;
 // * /
         
-      gIndenter--;
+      gIndenter ()--;
 
       if (++i == iEnd) break;
       
       fLogOutputStream << endl;
     } // for
 
-    gIndenter--;
+    gIndenter ()--;
   }
 
   fLogOutputStream <<
@@ -14307,12 +14307,12 @@ void mxmlTree2MsrTranslator::printCurrentChord ()
       "fCurrentChord contains:" <<
       endl;
        
-    gIndenter++;
+    gIndenter ()++;
 
     fLogOutputStream <<
       fCurrentChord;
 
-    gIndenter--;
+    gIndenter ()--;
   }
   
   else {
@@ -14344,7 +14344,7 @@ void mxmlTree2MsrTranslator::copyNoteArticulationsToChord (
     i++) {
 
 #ifdef TRACE_OPTIONS
-    if (gTraceOptions->fTraceChords || gTraceOptions->fTraceNotes) {
+    if (gTraceOptions ()->fTraceChords || gTraceOptions ()->fTraceNotes) {
       fLogOutputStream <<
         "Copying articulation '" <<
         (*i)->articulationKindAsString () <<
@@ -14377,9 +14377,9 @@ void mxmlTree2MsrTranslator::copyNoteTechnicalsToChord (
 
 #ifdef TRACE_OPTIONS
   if (
-    gTraceOptions->fTraceNotesDetails
+    gTraceOptions ()->fTraceNotesDetails
       ||
-    gTraceOptions->fTraceTechnicals
+    gTraceOptions ()->fTraceTechnicals
     ) {
     fLogOutputStream <<
       "Copying technical '" <<
@@ -14413,9 +14413,9 @@ void mxmlTree2MsrTranslator::copyNoteTechnicalWithIntegersToChord (
 
 #ifdef TRACE_OPTIONS
   if (
-    gTraceOptions->fTraceNotesDetails
+    gTraceOptions ()->fTraceNotesDetails
       ||
-    gTraceOptions->fTraceTechnicals
+    gTraceOptions ()->fTraceTechnicals
     ) {
     fLogOutputStream <<
       "Copying technical '" <<
@@ -14449,9 +14449,9 @@ void mxmlTree2MsrTranslator::copyNoteTechnicalWithFloatsToChord (
 
 #ifdef TRACE_OPTIONS
     if (
-      gTraceOptions->fTraceNotesDetails
+      gTraceOptions ()->fTraceNotesDetails
         ||
-      gTraceOptions->fTraceTechnicals
+      gTraceOptions ()->fTraceTechnicals
       ) {
       fLogOutputStream <<
         "Copying technical '" <<
@@ -14485,9 +14485,9 @@ void mxmlTree2MsrTranslator::copyNoteTechnicalWithStringsToChord (
 
 #ifdef TRACE_OPTIONS
     if (
-      gTraceOptions->fTraceTechnicals
+      gTraceOptions ()->fTraceTechnicals
         ||
-      gTraceOptions->fTraceChords
+      gTraceOptions ()->fTraceChords
       ) {
       fLogOutputStream <<
         "Copying technical '" <<
@@ -14521,9 +14521,9 @@ void mxmlTree2MsrTranslator::copyNoteOrnamentsToChord (
 
 #ifdef TRACE_OPTIONS
     if (
-      gTraceOptions->fTraceOrnaments
+      gTraceOptions ()->fTraceOrnaments
         ||
-      gTraceOptions->fTraceChords) {
+      gTraceOptions ()->fTraceChords) {
       fLogOutputStream <<
         "Copying ornament '" <<
         (*i)->ornamentKindAsString () <<
@@ -14557,9 +14557,9 @@ void mxmlTree2MsrTranslator::copyNoteSpannersToChord (
 
 #ifdef TRACE_OPTIONS
     if (
-      gTraceOptions->fTraceSpanners
+      gTraceOptions ()->fTraceSpanners
         ||
-      gTraceOptions->fTraceChords) {
+      gTraceOptions ()->fTraceChords) {
       fLogOutputStream <<
         "Copying spanner '" <<
         (*i)->spannerKindAsString () <<
@@ -14587,7 +14587,7 @@ void mxmlTree2MsrTranslator::copyNoteSingleTremoloToChord (
 
   if (noteSingleTremolo) {
 #ifdef TRACE_OPTIONS
-    if (gTraceOptions->fTraceTremolos || gTraceOptions->fTraceChords) {
+    if (gTraceOptions ()->fTraceTremolos || gTraceOptions ()->fTraceChords) {
       fLogOutputStream <<
         "Copying singleTremolo '" <<
         noteSingleTremolo->asString () <<
@@ -14620,7 +14620,7 @@ void mxmlTree2MsrTranslator::copyNoteDynamicsToChord (
     i++) {
 
 #ifdef TRACE_OPTIONS
-    if (gTraceOptions->fTraceChords || gTraceOptions->fTraceDynamics) {
+    if (gTraceOptions ()->fTraceChords || gTraceOptions ()->fTraceDynamics) {
       fLogOutputStream <<
         "Copying dynamics '" <<
         (*i)->dynamicsKindAsString () <<
@@ -14653,7 +14653,7 @@ void mxmlTree2MsrTranslator::copyNoteOtherDynamicsToChord (
     i++) {
 
 #ifdef TRACE_OPTIONS
-    if (gTraceOptions->fTraceChords || gTraceOptions->fTraceDynamics) {
+    if (gTraceOptions ()->fTraceChords || gTraceOptions ()->fTraceDynamics) {
       fLogOutputStream <<
         "Copying other dynamics '" <<
         (*i)->asString () <<
@@ -14686,7 +14686,7 @@ void mxmlTree2MsrTranslator::copyNoteWordsToChord (
     i++) {
 
 #ifdef TRACE_OPTIONS
-    if (gTraceOptions->fTraceChords || gTraceOptions->fTraceWords) {
+    if (gTraceOptions ()->fTraceChords || gTraceOptions ()->fTraceWords) {
       fLogOutputStream <<
         "Copying words '" <<
         (*i)->asString () <<
@@ -14714,7 +14714,7 @@ void mxmlTree2MsrTranslator::copyNoteStemToChord (
 
   if (noteStem) {
 #ifdef TRACE_OPTIONS
-    if (gTraceOptions->fTraceStems || gTraceOptions->fTraceChords) {
+    if (gTraceOptions ()->fTraceStems || gTraceOptions ()->fTraceChords) {
       fLogOutputStream <<
         "Copying stem '" <<
         noteStem->asString () <<
@@ -14747,7 +14747,7 @@ void mxmlTree2MsrTranslator::copyNoteBeamsToChord (
     i++) {
 
 #ifdef TRACE_OPTIONS
-    if (gTraceOptions->fTraceBeams || gTraceOptions->fTraceChords) {
+    if (gTraceOptions ()->fTraceBeams || gTraceOptions ()->fTraceChords) {
       fLogOutputStream <<
         "Copying beam '" <<
         (*i)->asString () <<
@@ -14762,18 +14762,18 @@ void mxmlTree2MsrTranslator::copyNoteBeamsToChord (
   } // for      
 
 #ifdef TRACE_OPTIONS
-  if (gTraceOptions->fTraceBeams || gTraceOptions->fTraceChords) {
+  if (gTraceOptions ()->fTraceBeams || gTraceOptions ()->fTraceChords) {
     fLogOutputStream <<
       "==> AFTER copying beams to chord:" <<
       endl;
 
-    gIndenter++;
+    gIndenter ()++;
     
     fLogOutputStream <<
       chord <<
       endl;
 
-    gIndenter--;
+    gIndenter ()--;
   }
 #endif
 }
@@ -14791,7 +14791,7 @@ void mxmlTree2MsrTranslator::copyNoteTieToChord (
 
   if (noteTie) {
 #ifdef TRACE_OPTIONS
-    if (gTraceOptions->fTraceChords || gTraceOptions->fTraceTies) {
+    if (gTraceOptions ()->fTraceChords || gTraceOptions ()->fTraceTies) {
       fLogOutputStream <<
         "Copying tie '" <<
         noteTie->asString () <<
@@ -14824,7 +14824,7 @@ void mxmlTree2MsrTranslator::copyNoteSlursToChord (
     i++) {
 
 #ifdef TRACE_OPTIONS
-    if (gTraceOptions->fTraceChords || gTraceOptions->fTraceSlurs) {
+    if (gTraceOptions ()->fTraceChords || gTraceOptions ()->fTraceSlurs) {
       fLogOutputStream <<
         "Copying slur '" <<
         (*i)->asString () <<
@@ -14857,7 +14857,7 @@ void mxmlTree2MsrTranslator::copyNoteLigaturesToChord (
     i++) {
 
 #ifdef TRACE_OPTIONS
-    if (gTraceOptions->fTraceChords || gTraceOptions->fTraceLigatures) {
+    if (gTraceOptions ()->fTraceChords || gTraceOptions ()->fTraceLigatures) {
       fLogOutputStream <<
         "Copying ligature '" <<
         (*i)->ligatureKindAsString () <<
@@ -14890,7 +14890,7 @@ void mxmlTree2MsrTranslator::copyNotePedalsToChord (
     i++) {
 
 #ifdef TRACE_OPTIONS
-    if (gTraceOptions->fTraceChords || gTraceOptions->fTracePedals) {
+    if (gTraceOptions ()->fTraceChords || gTraceOptions ()->fTracePedals) {
       fLogOutputStream <<
         "Copying pedal '" <<
         (*i)->pedalTypeAsString () <<
@@ -14923,7 +14923,7 @@ void mxmlTree2MsrTranslator::copyNoteSlashesToChord (
     i++) {
 
 #ifdef TRACE_OPTIONS
-    if (gTraceOptions->fTraceChords || gTraceOptions->fTraceSlashes) {
+    if (gTraceOptions ()->fTraceChords || gTraceOptions ()->fTraceSlashes) {
       fLogOutputStream <<
         "Copying slash '" <<
         (*i)->asString () <<
@@ -14956,7 +14956,7 @@ void mxmlTree2MsrTranslator::copyNoteWedgesToChord (
     i++) {
 
 #ifdef TRACE_OPTIONS
-    if (gTraceOptions->fTraceChords || gTraceOptions->fTraceWedges) {
+    if (gTraceOptions ()->fTraceChords || gTraceOptions ()->fTraceWedges) {
       fLogOutputStream <<
         "Copying wedges '" <<
         (*i)->wedgeKindAsString () <<
@@ -14982,7 +14982,7 @@ void mxmlTree2MsrTranslator::copyNoteGraceNotesGroupsToChord (
                           
   if (graceNotesGroupBefore) {
 #ifdef TRACE_OPTIONS
-    if (gTraceOptions->fTraceGraceNotes || gTraceOptions->fTraceChords) {
+    if (gTraceOptions ()->fTraceGraceNotes || gTraceOptions ()->fTraceChords) {
       fLogOutputStream <<
         "Copying grace notes group before '" <<
         graceNotesGroupBefore->asShortString () <<
@@ -15004,7 +15004,7 @@ void mxmlTree2MsrTranslator::copyNoteGraceNotesGroupsToChord (
                           
   if (graceNotesGroupAfter) {
 #ifdef TRACE_OPTIONS
-    if (gTraceOptions->fTraceGraceNotes || gTraceOptions->fTraceChords) {
+    if (gTraceOptions ()->fTraceGraceNotes || gTraceOptions ()->fTraceChords) {
       fLogOutputStream <<
         "Copying grace notes group after '" <<
         graceNotesGroupAfter->asShortString () <<
@@ -15033,7 +15033,7 @@ void mxmlTree2MsrTranslator::copyNoteHarmonyToChord (
                           
   if (harmony) {
 #ifdef TRACE_OPTIONS
-    if (gTraceOptions->fTraceHarmonies || gTraceOptions->fTraceChords) {
+    if (gTraceOptions ()->fTraceHarmonies || gTraceOptions ()->fTraceChords) {
       fLogOutputStream <<
         "Copying harmony '" <<
         harmony->asString () <<
@@ -15120,7 +15120,7 @@ void mxmlTree2MsrTranslator::createTupletWithItsFirstNoteAndPushItToTupletsStack
 
   // create a tuplet
 #ifdef TRACE_OPTIONS
-  if (gTraceOptions->fTraceTuplets) {
+  if (gTraceOptions ()->fTraceTuplets) {
     fLogOutputStream <<
       "Creating a '" <<
       fCurrentNoteActualNotes <<
@@ -15168,7 +15168,7 @@ void mxmlTree2MsrTranslator::createTupletWithItsFirstNoteAndPushItToTupletsStack
       nullptr /* JMI */);
 
 #ifdef TRACE_OPTIONS
-  if (gTraceOptions->fTraceTuplets) {
+  if (gTraceOptions ()->fTraceTuplets) {
     // only after addNoteToTuplet() has set the note's tuplet uplink
     fLogOutputStream <<
       "Adding first note " <<
@@ -15183,7 +15183,7 @@ void mxmlTree2MsrTranslator::createTupletWithItsFirstNoteAndPushItToTupletsStack
       
   // register tuplet in this visitor
 #ifdef TRACE_OPTIONS
-  if (gTraceOptions->fTraceTuplets || gTraceOptions->fTraceNotes) {
+  if (gTraceOptions ()->fTraceTuplets || gTraceOptions ()->fTraceNotes) {
     fLogOutputStream <<
       "++> pushing tuplet '" <<
       tuplet->asString () <<
@@ -15195,7 +15195,7 @@ void mxmlTree2MsrTranslator::createTupletWithItsFirstNoteAndPushItToTupletsStack
   fTupletsStack.push_front (tuplet);
 
 #ifdef TRACE_OPTIONS
-  if (gTraceOptions->fTraceTupletsDetails) {
+  if (gTraceOptions ()->fTraceTupletsDetails) {
     displayTupletsStack (
       "############## After  createTupletWithItsFirstNoteAndPushItToTupletsStack()");
   }
@@ -15225,7 +15225,7 @@ void mxmlTree2MsrTranslator::createTupletWithItsFirstNoteAndPushItToTupletsStack
     tuplet;
 
 #ifdef TRACE_OPTIONS
-  if (gTraceOptions->fTraceTupletsDetails) {
+  if (gTraceOptions ()->fTraceTupletsDetails) {
     displayLastHandledTupletInVoiceMap (
       "############## Before fLastHandledTupletInVoiceMap");
   }
@@ -15237,7 +15237,7 @@ void mxmlTree2MsrTranslator::finalizeTupletAndPopItFromTupletsStack (
   int inputLineNumber)
 {
 #ifdef TRACE_OPTIONS
-  if (gTraceOptions->fTraceTuplets) {
+  if (gTraceOptions ()->fTraceTuplets) {
     fLogOutputStream <<
       "mxmlTree2MsrTranslator::finalizeTupletAndPopItFromTupletsStack(), " <<
       "line " << inputLineNumber <<
@@ -15246,7 +15246,7 @@ void mxmlTree2MsrTranslator::finalizeTupletAndPopItFromTupletsStack (
 #endif
 
 #ifdef TRACE_OPTIONS
-  if (gTraceOptions->fTraceTuplets) {
+  if (gTraceOptions ()->fTraceTuplets) {
     displayTupletsStack (
       "############## Before  finalizeTupletAndPopItFromTupletsStack()");
   }
@@ -15275,7 +15275,7 @@ void mxmlTree2MsrTranslator::finalizeTupletAndPopItFromTupletsStack (
 /* JMI
   // add lastNote to the tuplet
 #ifdef TRACE_OPTIONS
-  if (gTraceOptions->fTraceTuplets) {
+  if (gTraceOptions ()->fTraceTuplets) {
     fLogOutputStream <<
       "==> adding last note " << lastNote->asString () <<
       " to tuplets stack top " <<
@@ -15289,7 +15289,7 @@ void mxmlTree2MsrTranslator::finalizeTupletAndPopItFromTupletsStack (
 
   // pop from the tuplets stack
 #ifdef TRACE_OPTIONS
-  if (gTraceOptions->fTraceTuplets) {
+  if (gTraceOptions ()->fTraceTuplets) {
     fLogOutputStream <<
       "Popping tuplet '" <<
       tuplet->asString () <<
@@ -15304,7 +15304,7 @@ void mxmlTree2MsrTranslator::finalizeTupletAndPopItFromTupletsStack (
   if (fTupletsStack.size ()) {
     // tuplet is a nested tuplet
 #ifdef TRACE_OPTIONS
-    if (gTraceOptions->fTraceTuplets) {
+    if (gTraceOptions ()->fTraceTuplets) {
       fLogOutputStream <<
         "=== adding nested tuplet '" <<
       tuplet->asString () <<
@@ -15323,7 +15323,7 @@ void mxmlTree2MsrTranslator::finalizeTupletAndPopItFromTupletsStack (
   else {
     // tuplet is a top level tuplet
 #ifdef TRACE_OPTIONS
-    if (gTraceOptions->fTraceTuplets) {
+    if (gTraceOptions ()->fTraceTuplets) {
       fLogOutputStream <<
         "=== adding top level tuplet '" <<
       tuplet->asString () <<
@@ -15343,7 +15343,7 @@ void mxmlTree2MsrTranslator::finalizeTupletAndPopItFromTupletsStack (
   }
 
 #ifdef TRACE_OPTIONS
-  if (gTraceOptions->fTraceTuplets) {
+  if (gTraceOptions ()->fTraceTuplets) {
     displayTupletsStack (
       "############## After  finalizeTupletAndPopItFromTupletsStack()");
   }
@@ -15358,7 +15358,7 @@ void mxmlTree2MsrTranslator::attachCurrentArticulationsToNote (
   if (fCurrentArticulations.size ()) {
 
 #ifdef TRACE_OPTIONS
-    if (gTraceOptions->fTraceNotes || gTraceOptions->fTraceArticulations) {
+    if (gTraceOptions ()->fTraceNotes || gTraceOptions ()->fTraceArticulations) {
       fLogOutputStream <<
         "Attaching current articulations to note " <<
         note->asString () <<
@@ -15372,7 +15372,7 @@ void mxmlTree2MsrTranslator::attachCurrentArticulationsToNote (
           fCurrentArticulations.front();
           
 #ifdef TRACE_OPTIONS
-      if (gTraceOptions->fTraceNotes) {
+      if (gTraceOptions ()->fTraceNotes) {
         fLogOutputStream <<
           "Attaching articulation '" <<
           art->articulationKindAsString () <<
@@ -15398,7 +15398,7 @@ void mxmlTree2MsrTranslator::attachCurrentTechnicalsToNote (
   if (fCurrentTechnicalsList.size ()) {
     
 #ifdef TRACE_OPTIONS
-    if (gTraceOptions->fTraceNotes || gTraceOptions->fTraceTechnicals) {
+    if (gTraceOptions ()->fTraceNotes || gTraceOptions ()->fTraceTechnicals) {
       fLogOutputStream <<
         "Attaching current technicals to note " <<
         note->asString () <<
@@ -15412,7 +15412,7 @@ void mxmlTree2MsrTranslator::attachCurrentTechnicalsToNote (
           fCurrentTechnicalsList.front();
           
 #ifdef TRACE_OPTIONS
-      if (gTraceOptions->fTraceNotes || gTraceOptions->fTraceTechnicals) {
+      if (gTraceOptions ()->fTraceNotes || gTraceOptions ()->fTraceTechnicals) {
         fLogOutputStream <<
           "Attaching technical '" <<
           tech->asString () <<
@@ -15438,7 +15438,7 @@ void mxmlTree2MsrTranslator::attachCurrentTechnicalWithIntegersToNote (
   if (fCurrentTechnicalWithIntegersList.size ()) {
     
 #ifdef TRACE_OPTIONS
-    if (gTraceOptions->fTraceNotes || gTraceOptions->fTraceTechnicals) {
+    if (gTraceOptions ()->fTraceNotes || gTraceOptions ()->fTraceTechnicals) {
       fLogOutputStream <<
         "Attaching current technical with integers to note " <<
         note->asString () <<
@@ -15452,7 +15452,7 @@ void mxmlTree2MsrTranslator::attachCurrentTechnicalWithIntegersToNote (
           fCurrentTechnicalWithIntegersList.front();
           
 #ifdef TRACE_OPTIONS
-      if (gTraceOptions->fTraceNotes || gTraceOptions->fTraceTechnicals) {
+      if (gTraceOptions ()->fTraceNotes || gTraceOptions ()->fTraceTechnicals) {
         fLogOutputStream <<
           "Attaching technical with integer '" <<
           tech->asString () <<
@@ -15478,7 +15478,7 @@ void mxmlTree2MsrTranslator::attachCurrentTechnicalWithFloatsToNote (
   if (fCurrentTechnicalWithFloatsList.size ()) {
     
 #ifdef TRACE_OPTIONS
-    if (gTraceOptions->fTraceNotes || gTraceOptions->fTraceTechnicals) {
+    if (gTraceOptions ()->fTraceNotes || gTraceOptions ()->fTraceTechnicals) {
       fLogOutputStream <<
         "Attaching current technical with floats to note " <<
         note->asString () <<
@@ -15492,7 +15492,7 @@ void mxmlTree2MsrTranslator::attachCurrentTechnicalWithFloatsToNote (
           fCurrentTechnicalWithFloatsList.front();
           
 #ifdef TRACE_OPTIONS
-  if (gTraceOptions->fTraceNotes || gTraceOptions->fTraceTechnicals) {
+  if (gTraceOptions ()->fTraceNotes || gTraceOptions ()->fTraceTechnicals) {
         fLogOutputStream <<
           "Attaching technical with integer '" <<
           tech->asString () <<
@@ -15518,7 +15518,7 @@ void mxmlTree2MsrTranslator::attachCurrentTechnicalWithStringsToNote (
   if (fCurrentTechnicalWithStringsList.size ()) {
     
 #ifdef TRACE_OPTIONS
-    if (gTraceOptions->fTraceNotes || gTraceOptions->fTraceTechnicals) {
+    if (gTraceOptions ()->fTraceNotes || gTraceOptions ()->fTraceTechnicals) {
       fLogOutputStream <<
         "Attaching current technical with strings to note " <<
         note->asString () <<
@@ -15532,7 +15532,7 @@ void mxmlTree2MsrTranslator::attachCurrentTechnicalWithStringsToNote (
           fCurrentTechnicalWithStringsList.front();
           
 #ifdef TRACE_OPTIONS
-      if (gTraceOptions->fTraceTechnicals) {
+      if (gTraceOptions ()->fTraceTechnicals) {
         fLogOutputStream <<
           "Attaching technical with string '" <<
           tech->asString () <<
@@ -15558,7 +15558,7 @@ void mxmlTree2MsrTranslator::attachCurrentOrnamentsToNote (
   if (fCurrentOrnamentsList.size ()) {
     
 #ifdef TRACE_OPTIONS
-    if (gTraceOptions->fTraceOrnaments) {
+    if (gTraceOptions ()->fTraceOrnaments) {
       fLogOutputStream <<
         "Attaching current ornaments to note " <<
         note->asString () <<
@@ -15572,7 +15572,7 @@ void mxmlTree2MsrTranslator::attachCurrentOrnamentsToNote (
           fCurrentOrnamentsList.front();
           
 #ifdef TRACE_OPTIONS
-      if (gTraceOptions->fTraceNotes) {
+      if (gTraceOptions ()->fTraceNotes) {
         fLogOutputStream <<
           "Attaching ornament '" <<
           orn->ornamentKindAsString () <<
@@ -15598,7 +15598,7 @@ void mxmlTree2MsrTranslator::attachCurrentSpannersToNote (
   if (fCurrentSpannersList.size ()) {
     
 #ifdef TRACE_OPTIONS
-    if (gTraceOptions->fTraceSpanners) {
+    if (gTraceOptions ()->fTraceSpanners) {
       fLogOutputStream <<
         "Attaching current spanners to note " <<
         note->asString () <<
@@ -15654,7 +15654,7 @@ void mxmlTree2MsrTranslator::attachCurrentSpannersToNote (
 
       if (doHandleSpanner) {
 #ifdef TRACE_OPTIONS
-        if (gTraceOptions->fTraceSpanners) {
+        if (gTraceOptions ()->fTraceSpanners) {
           fLogOutputStream <<
             "Attaching spanner '" <<
             spanner->spannerKindAsString () <<
@@ -15676,7 +15676,7 @@ void mxmlTree2MsrTranslator::attachCurrentSpannersToNote (
 
       else { // check it is the same spanner kind JMI
 #ifdef TRACE_OPTIONS
-        if (gTraceOptions->fTraceSpanners) {
+        if (gTraceOptions ()->fTraceSpanners) {
           fLogOutputStream <<
             "Spanner start amd stop on one and the same note' to note " <<
             note->asString () <<
@@ -15709,7 +15709,7 @@ void mxmlTree2MsrTranslator::attachCurrentSingleTremoloToNote (
   if (fCurrentSingleTremolo) {
     
 #ifdef TRACE_OPTIONS
-    if (gTraceOptions->fTraceNotes) {
+    if (gTraceOptions ()->fTraceNotes) {
       fLogOutputStream <<
         "Attaching current singleTremolo to note " <<
         note->asString () <<
@@ -15739,7 +15739,7 @@ void mxmlTree2MsrTranslator::attachCurrentArticulationsToChord ( // JMI
   if (fCurrentArticulations.size ()) {
 
 #ifdef TRACE_OPTIONS
-    if (gTraceOptions->fTraceChords) {
+    if (gTraceOptions ()->fTraceChords) {
       fLogOutputStream <<
         "Attaching current articulations to chord " <<
         chord->asString () <<
@@ -15753,7 +15753,7 @@ void mxmlTree2MsrTranslator::attachCurrentArticulationsToChord ( // JMI
       i!=fCurrentArticulations.end ();
       i++) {
 #ifdef TRACE_OPTIONS
-      if (gTraceOptions->fTraceChords) {
+      if (gTraceOptions ()->fTraceChords) {
         fLogOutputStream <<
           "Attaching articulation " <<  (*i) <<
           " to chord " << chord <<
@@ -15776,7 +15776,7 @@ void mxmlTree2MsrTranslator::attachCurrentOrnamentsToChord ( // JMI
   if (fCurrentOrnamentsList.size ()) {
 
 #ifdef TRACE_OPTIONS
-    if (gTraceOptions->fTraceChords) {
+    if (gTraceOptions ()->fTraceChords) {
       fLogOutputStream <<
         "Attaching current ornaments to chord " <<
         chord->asString () <<
@@ -15790,7 +15790,7 @@ void mxmlTree2MsrTranslator::attachCurrentOrnamentsToChord ( // JMI
       i!=fCurrentOrnamentsList.end ();
       i++) {
 #ifdef TRACE_OPTIONS
-      if (gTraceOptions->fTraceChords) {
+      if (gTraceOptions ()->fTraceChords) {
         fLogOutputStream <<
           "Attaching ornament " <<  (*i) << " to chord " <<
           chord <<
@@ -15812,7 +15812,7 @@ void mxmlTree2MsrTranslator::attachPendingTemposToTheVoiceOfNote (
  // attach the pending tempos if any to the note
   if (fPendingTempos.size ()) {
 #ifdef TRACE_OPTIONS
-    if (gTraceOptions->fTracePasses) { // tempos ??? JMI
+    if (gTraceOptions ()->fTracePasses) { // tempos ??? JMI
       fLogOutputStream <<
         "Attaching pending tempos to note " <<
         note->asString () <<
@@ -15849,7 +15849,7 @@ void mxmlTree2MsrTranslator::attachPendingRehearsalsToTheVoiceOfNote (
  // attach the pending rehearsals if any to the note
   if (fPendingRehearsals.size ()) {
 #ifdef TRACE_OPTIONS
-    if (gTraceOptions->fTracePasses) { // Rehearsals ??? JMI
+    if (gTraceOptions ()->fTracePasses) { // Rehearsals ??? JMI
       fLogOutputStream <<
         "Attaching pending rehearsals to note " <<
         note->asString () <<
@@ -15886,7 +15886,7 @@ void mxmlTree2MsrTranslator::attachPendingEyeGlassesToNote (
  // attach the pending eyeglasses if any to the note
   if (fPendingEyeGlasses.size ()) {
 #ifdef TRACE_OPTIONS
-    if (gTraceOptions->fTracePasses) { // EyeGlasses ??? JMI
+    if (gTraceOptions ()->fTracePasses) { // EyeGlasses ??? JMI
       fLogOutputStream <<
         "Attaching pending eyeglasses to note " <<
         note->asString () <<
@@ -15914,7 +15914,7 @@ void mxmlTree2MsrTranslator::attachPendingDampsToNote (
  // attach the pending damps if any to the note
   if (fPendingDamps.size ()) {
 #ifdef TRACE_OPTIONS
-    if (gTraceOptions->fTracePasses) {
+    if (gTraceOptions ()->fTracePasses) {
       fLogOutputStream <<
         "Attaching pending damps to note " <<
         note->asString () <<
@@ -15942,7 +15942,7 @@ void mxmlTree2MsrTranslator::attachPendingDampAllsToNote (
  // attach the pending damp alls if any to the note
   if (fPendingDampAlls.size ()) {
 #ifdef TRACE_OPTIONS
-    if (gTraceOptions->fTracePasses) {
+    if (gTraceOptions ()->fTracePasses) {
       fLogOutputStream <<
         "Attaching pending damp alls to note " <<
         note->asString () <<
@@ -15970,7 +15970,7 @@ void mxmlTree2MsrTranslator::attachPendingOctaveShiftsToNote (
  // attach the pending octave shifts if any to the note
   if (fPendingOctaveShifts.size ()) {
 #ifdef TRACE_OPTIONS
-    if (gTraceOptions->fTraceOctaveShifts) {
+    if (gTraceOptions ()->fTraceOctaveShifts) {
       fLogOutputStream <<
         "Attaching pending octave shifts to note " <<
         note->asString () <<
@@ -16008,7 +16008,7 @@ void mxmlTree2MsrTranslator::attachPendingScordaturasToNote (
  // attach the pending scordatura if any to the note
   if (fPendingScordaturas.size ()) {
 #ifdef TRACE_OPTIONS
-    if (gTraceOptions->fTracePasses) {
+    if (gTraceOptions ()->fTracePasses) {
       fLogOutputStream <<
         "Attaching pending scordaturas to note " <<
         note->asString () <<
@@ -16038,7 +16038,7 @@ void mxmlTree2MsrTranslator::attachPendingDynamicsToNote (
     bool delayAttachment = false;
     
 #ifdef TRACE_OPTIONS
-    if (gTraceOptions->fTraceDynamics) {
+    if (gTraceOptions ()->fTraceDynamics) {
       fLogOutputStream <<
         "Attaching pending dynamics to note " <<
         note->asString () <<
@@ -16047,7 +16047,7 @@ void mxmlTree2MsrTranslator::attachPendingDynamicsToNote (
 #endif
 
     if (fCurrentNoteIsARest) {
-      if (gMsrOptions->fDelayRestsDynamics) {
+      if (gMsrOptions ()->fDelayRestsDynamics) {
         fLogOutputStream <<
           "Delaying dynamics attached to a rest until next note" <<
           endl;
@@ -16072,7 +16072,7 @@ void mxmlTree2MsrTranslator::attachPendingDynamicsToNote (
           " attached to a rest";
           
         msrMusicXMLWarning (
-          gXml2lyOptions->fInputSourceName,
+          gXml2lyOptions ()->fInputSourceName,
           note->getInputLineNumber (),
           s.str ());
       }
@@ -16100,7 +16100,7 @@ void mxmlTree2MsrTranslator::attachPendingOtherDynamicsToNote (
     bool delayAttachment = false;
         
 #ifdef TRACE_OPTIONS
-    if (gTraceOptions->fTraceDynamics) {
+    if (gTraceOptions ()->fTraceDynamics) {
       fLogOutputStream <<
         "Attaching pending other dynamics to note " <<
         note->asString () <<
@@ -16109,7 +16109,7 @@ void mxmlTree2MsrTranslator::attachPendingOtherDynamicsToNote (
 #endif
 
     if (fCurrentNoteIsARest) {
-      if (gMsrOptions->fDelayRestsDynamics) {
+      if (gMsrOptions ()->fDelayRestsDynamics) {
         fLogOutputStream <<
           "Delaying dynamics attached to a rest until next note" <<
           endl;
@@ -16134,7 +16134,7 @@ void mxmlTree2MsrTranslator::attachPendingOtherDynamicsToNote (
           " attached to a rest";
           
         msrMusicXMLWarning (
-          gXml2lyOptions->fInputSourceName,
+          gXml2lyOptions ()->fInputSourceName,
           note->getInputLineNumber (),
           s.str ());
       }
@@ -16162,7 +16162,7 @@ void mxmlTree2MsrTranslator::attachPendingWordsToNote (
     bool delayAttachment = false;
     
 #ifdef TRACE_OPTIONS
-    if (gTraceOptions->fTraceWords) {
+    if (gTraceOptions ()->fTraceWords) {
       fLogOutputStream <<
         "Attaching pending words to note " <<
         note->asString () <<
@@ -16171,7 +16171,7 @@ void mxmlTree2MsrTranslator::attachPendingWordsToNote (
 #endif
 
     if (fCurrentNoteIsARest) {
-      if (gMsrOptions->fDelayRestsWords) {
+      if (gMsrOptions ()->fDelayRestsWords) {
         fLogOutputStream <<
           "Delaying word(s) attached to a rest until next note" <<
           endl;
@@ -16196,7 +16196,7 @@ void mxmlTree2MsrTranslator::attachPendingWordsToNote (
           " attached to a rest";
           
         msrMusicXMLWarning (
-          gXml2lyOptions->fInputSourceName,
+          gXml2lyOptions ()->fInputSourceName,
           note->getInputLineNumber (),
           s.str ());
       }
@@ -16225,7 +16225,7 @@ void mxmlTree2MsrTranslator::attachPendingBeamsToNote (
     bool delayAttachment = false;
         
 #ifdef TRACE_OPTIONS
-    if (gTraceOptions->fTraceBeams) {
+    if (gTraceOptions ()->fTraceBeams) {
       fLogOutputStream <<
         "Attaching pending beams to note " <<
         note->asString () <<
@@ -16234,7 +16234,7 @@ void mxmlTree2MsrTranslator::attachPendingBeamsToNote (
 #endif
 
     if (fCurrentNoteIsARest) {
-      if (gMsrOptions->fDelayRestsBeams) {
+      if (gMsrOptions ()->fDelayRestsBeams) {
         fLogOutputStream <<
           "Delaying beam attached to a rest until next note" <<
           endl;
@@ -16259,7 +16259,7 @@ void mxmlTree2MsrTranslator::attachPendingBeamsToNote (
           " attached to a rest";
           
         msrMusicXMLWarning (
-          gXml2lyOptions->fInputSourceName,
+          gXml2lyOptions ()->fInputSourceName,
           note->getInputLineNumber (),
           s.str ());
       }
@@ -16287,7 +16287,7 @@ void mxmlTree2MsrTranslator::attachPendingSlursToNote (
     bool delayAttachment = false;
         
 #ifdef TRACE_OPTIONS
-    if (gTraceOptions->fTraceSlurs) {
+    if (gTraceOptions ()->fTraceSlurs) {
       fLogOutputStream <<
         "Attaching pending slurs to note " <<
         note->asString () <<
@@ -16296,7 +16296,7 @@ void mxmlTree2MsrTranslator::attachPendingSlursToNote (
 #endif
 
     if (fCurrentNoteIsARest) {
-      if (gMsrOptions->fDelayRestsSlurs) {
+      if (gMsrOptions ()->fDelayRestsSlurs) {
         fLogOutputStream <<
           "Delaying slur attached to a rest until next note" <<
           endl;
@@ -16321,7 +16321,7 @@ void mxmlTree2MsrTranslator::attachPendingSlursToNote (
           " attached to a rest";
           
         msrMusicXMLWarning (
-          gXml2lyOptions->fInputSourceName,
+          gXml2lyOptions ()->fInputSourceName,
           note->getInputLineNumber (),
           s.str ());
       }
@@ -16349,7 +16349,7 @@ void mxmlTree2MsrTranslator::attachPendingLigaturesToNote (
     bool delayAttachment = false;
         
     if (fCurrentNoteIsARest) {
-      if (gMsrOptions->fDelayRestsLigatures) {
+      if (gMsrOptions ()->fDelayRestsLigatures) {
         fLogOutputStream <<
           "Delaying ligature attached to a rest until next note" <<
           endl;
@@ -16374,7 +16374,7 @@ void mxmlTree2MsrTranslator::attachPendingLigaturesToNote (
           " attached to a rest";
           
         msrMusicXMLWarning (
-          gXml2lyOptions->fInputSourceName,
+          gXml2lyOptions ()->fInputSourceName,
           note->getInputLineNumber (),
           s.str ());
       }
@@ -16394,7 +16394,7 @@ void mxmlTree2MsrTranslator::attachPendingLigaturesToNote (
           "There is 1 pending ligature";
       }
       msrMusicXMLWarning (
-        gXml2lyOptions->fInputSourceName,
+        gXml2lyOptions ()->fInputSourceName,
         note->getInputLineNumber (),
         s.str ());
 
@@ -16438,7 +16438,7 @@ void mxmlTree2MsrTranslator::attachPendingLigaturesToNote (
               case 1:
               case 3:
 #ifdef TRACE_OPTIONS
-                if (gTraceOptions->fTraceLigatures) {
+                if (gTraceOptions ()->fTraceLigatures) {
                   fLogOutputStream <<
                     "Attaching pending ligature above to note '" <<
                     note->asString () <<
@@ -16463,7 +16463,7 @@ void mxmlTree2MsrTranslator::attachPendingLigaturesToNote (
               case 2:
               case 4:
 #ifdef TRACE_OPTIONS
-                if (gTraceOptions->fTraceLigatures) {
+                if (gTraceOptions ()->fTraceLigatures) {
                   fLogOutputStream <<
                     "Attaching pending ligature below to note '" <<
                     note->asString () <<
@@ -16510,7 +16510,7 @@ void mxmlTree2MsrTranslator::attachPendingPedalsToNote (
     bool delayAttachment = false;
         
 #ifdef TRACE_OPTIONS
-    if (gTraceOptions->fTracePedals) {
+    if (gTraceOptions ()->fTracePedals) {
       fLogOutputStream <<
         "Attaching pending pedals to note " <<
         note->asString () <<
@@ -16519,7 +16519,7 @@ void mxmlTree2MsrTranslator::attachPendingPedalsToNote (
 #endif
 
     if (fCurrentNoteIsARest) {
-      if (gMsrOptions->fDelayRestsPedals) {
+      if (gMsrOptions ()->fDelayRestsPedals) {
         fLogOutputStream <<
           "Delaying pedal attached to a rest until next note" <<
           endl;
@@ -16544,7 +16544,7 @@ void mxmlTree2MsrTranslator::attachPendingPedalsToNote (
           " attached to a rest";
           
         msrMusicXMLWarning (
-          gXml2lyOptions->fInputSourceName,
+          gXml2lyOptions ()->fInputSourceName,
           note->getInputLineNumber (),
           s.str ());
       }
@@ -16572,7 +16572,7 @@ void mxmlTree2MsrTranslator::attachPendingSlashesToNote (
     bool delayAttachment = false;
         
 #ifdef TRACE_OPTIONS
-    if (gTraceOptions->fTraceSlashes) {
+    if (gTraceOptions ()->fTraceSlashes) {
       fLogOutputStream <<
         "Attaching pending slashes to note " <<
         note->asString () <<
@@ -16581,7 +16581,7 @@ void mxmlTree2MsrTranslator::attachPendingSlashesToNote (
 #endif
 
     if (fCurrentNoteIsARest) {
-      if (gMsrOptions->fDelayRestsSlashes) {
+      if (gMsrOptions ()->fDelayRestsSlashes) {
         fLogOutputStream <<
           "Delaying slash attached to a rest until next note" <<
       endl;
@@ -16606,7 +16606,7 @@ void mxmlTree2MsrTranslator::attachPendingSlashesToNote (
           " attached to a rest";
           
         msrMusicXMLWarning (
-          gXml2lyOptions->fInputSourceName,
+          gXml2lyOptions ()->fInputSourceName,
           note->getInputLineNumber (),
           s.str ());
       }
@@ -16634,7 +16634,7 @@ void mxmlTree2MsrTranslator::attachPendingWedgesToNote (
     bool delayAttachment = false;
         
 #ifdef TRACE_OPTIONS
-    if (gTraceOptions->fTraceWedges) {
+    if (gTraceOptions ()->fTraceWedges) {
       fLogOutputStream <<
         "Attaching pending wedges to note " <<
         note->asString () <<
@@ -16643,7 +16643,7 @@ void mxmlTree2MsrTranslator::attachPendingWedgesToNote (
 #endif
 
     if (fCurrentNoteIsARest) {
-      if (gMsrOptions->fDelayRestsWedges) {
+      if (gMsrOptions ()->fDelayRestsWedges) {
         fLogOutputStream <<
           "Delaying wedge attached to a rest until next note" <<
       endl;
@@ -16668,7 +16668,7 @@ void mxmlTree2MsrTranslator::attachPendingWedgesToNote (
           " attached to a rest";
           
         msrMusicXMLWarning (
-          gXml2lyOptions->fInputSourceName,
+          gXml2lyOptions ()->fInputSourceName,
           note->getInputLineNumber (),
           s.str ());
       }
@@ -16694,7 +16694,7 @@ void mxmlTree2MsrTranslator::attachPendingGlissandosToNote (
  // attach the pending glissandos if any to the note
   if (fPendingGlissandos.size ()) {
 #ifdef TRACE_OPTIONS
-    if (gTraceOptions->fTraceGlissandos) {
+    if (gTraceOptions ()->fTraceGlissandos) {
       fLogOutputStream <<
         "Attaching pending glissandos to note " <<
         note->asString () <<
@@ -16736,7 +16736,7 @@ void mxmlTree2MsrTranslator::attachPendingGlissandosToNote (
                 getVoiceStanzasMap ();
                     
 #ifdef TRACE_OPTIONS
-              if (gTraceOptions->fTraceGlissandos) {
+              if (gTraceOptions ()->fTraceGlissandos) {
                 fLogOutputStream <<
                   "--> attachPendingGlissandosToNote()"
                   ", voiceStanzasMap.size () = " <<
@@ -16754,7 +16754,7 @@ void mxmlTree2MsrTranslator::attachPendingGlissandosToNote (
             if (! fCurrentNoteHasLyrics) {
               // append a skip to lyrics the same duration as the note
 #ifdef TRACE_OPTIONS
-              if (gTraceOptions->fTraceGlissandos) {
+              if (gTraceOptions ()->fTraceGlissandos) {
                 fLogOutputStream <<
                   "Attaching a skip syllable to note '" <<
                   note->asString () <<
@@ -16807,7 +16807,7 @@ void mxmlTree2MsrTranslator::attachPendingSlidesToNote (
  // attach the pending slides if any to the note
   if (fPendingSlides.size ()) {
 #ifdef TRACE_OPTIONS
-    if (gTraceOptions->fTracePasses) { // slides ??? JMI
+    if (gTraceOptions ()->fTracePasses) { // slides ??? JMI
       fLogOutputStream <<
         "Attaching pending slides to note " <<
         note->asString () <<
@@ -16849,7 +16849,7 @@ void mxmlTree2MsrTranslator::attachPendingSlidesToNote (
                 getVoiceStanzasMap ();
                     
 #ifdef TRACE_OPTIONS
-              if (gTraceOptions->fTraceSlides) {
+              if (gTraceOptions ()->fTraceSlides) {
                 fLogOutputStream <<
                   "--> attachPendingSlidesToNote()"
                   ", voiceStanzasMap.size () = " <<
@@ -16867,7 +16867,7 @@ void mxmlTree2MsrTranslator::attachPendingSlidesToNote (
             if (! fCurrentNoteHasLyrics) {
               // append a skip to lyrics the same duration as the note
 #ifdef TRACE_OPTIONS
-              if (gTraceOptions->fTraceSlides) {
+              if (gTraceOptions ()->fTraceSlides) {
                 fLogOutputStream <<
                   "Attaching a skip syllable to note '" <<
                   note->asString () <<
@@ -16977,7 +16977,7 @@ void mxmlTree2MsrTranslator::visitEnd ( S_note& elt )
   int inputLineNumber =
     elt->getInputLineNumber ();
 
-  if (gMusicXMLOptions->fTraceMusicXMLTreeVisitors) {
+  if (gMusicXMLOptions ()->fTraceMusicXMLTreeVisitors) {
     fLogOutputStream <<
       "--> End visiting S_note" <<
       ", line " << inputLineNumber <<
@@ -17031,7 +17031,7 @@ void mxmlTree2MsrTranslator::visitEnd ( S_note& elt )
           fCurrentNoteGraphicDurationKind);
 
 #ifdef TRACE_OPTIONS
-      if (gTraceOptions->fTraceNotesDetails) {
+      if (gTraceOptions ()->fTraceNotesDetails) {
         fLogOutputStream <<
           endl <<
           "(1):" <<
@@ -17068,7 +17068,7 @@ void mxmlTree2MsrTranslator::visitEnd ( S_note& elt )
           dots--;
 
 #ifdef TRACE_OPTIONS
-          if (gTraceOptions->fTraceNotesDetails) {
+          if (gTraceOptions ()->fTraceNotesDetails) {
             fLogOutputStream <<
               endl <<
               "(2):" <<
@@ -17091,7 +17091,7 @@ void mxmlTree2MsrTranslator::visitEnd ( S_note& elt )
       }
       
 #ifdef TRACE_OPTIONS
-      if (gTraceOptions->fTraceNotesDetails) {
+      if (gTraceOptions ()->fTraceNotesDetails) {
         fLogOutputStream <<
           endl <<
           "(3):" <<
@@ -17121,7 +17121,7 @@ void mxmlTree2MsrTranslator::visitEnd ( S_note& elt )
         );
 
 #ifdef TRACE_OPTIONS
-  if (gTraceOptions->fTraceNotes || gTraceOptions->fTraceVoices) {
+  if (gTraceOptions ()->fTraceNotes || gTraceOptions ()->fTraceVoices) {
     fLogOutputStream <<
       "--> fCurrentMusicXMLVoiceNumber        = " <<
       fCurrentMusicXMLVoiceNumber <<
@@ -17145,12 +17145,12 @@ void mxmlTree2MsrTranslator::visitEnd ( S_note& elt )
 */
 
 #ifdef TRACE_OPTIONS
-  if (gTraceOptions->fTraceNotes) {
+  if (gTraceOptions ()->fTraceNotes) {
     fLogOutputStream <<
       "--> Gathered note information:" <<
       endl;
 
-    gIndenter++;
+    gIndenter ()++;
 
     const int fieldWidth = 42;
     
@@ -17218,13 +17218,13 @@ void mxmlTree2MsrTranslator::visitEnd ( S_note& elt )
       endl <<
       endl;
 
-    gIndenter--;
+    gIndenter ()--;
   }
 #endif
 
 /* JMI
 #ifdef TRACE_OPTIONS
-  if (gTraceOptions->fTraceNotes) { // JMI
+  if (gTraceOptions ()->fTraceNotes) { // JMI
     fLogOutputStream <<
       endl <<
       "==> BEFORE visitEnd (S_note&)" <<
@@ -17232,7 +17232,7 @@ void mxmlTree2MsrTranslator::visitEnd ( S_note& elt )
       " we have:" <<
       endl;
 
-    gIndenter++;
+    gIndenter ()++;
 
     const int fieldWidth = 27;
 
@@ -17247,7 +17247,7 @@ void mxmlTree2MsrTranslator::visitEnd ( S_note& elt )
       currentVoice->getVoiceName () << "\"" <<
       endl;
 
-    gIndenter--;
+    gIndenter ()--;
 
     fLogOutputStream <<
       "<==" <<
@@ -17275,7 +17275,7 @@ void mxmlTree2MsrTranslator::visitEnd ( S_note& elt )
         "double tremolo note lacks a <type/>"; // JMI a completer
 
       msrMusicXMLError (
-        gXml2lyOptions->fInputSourceName,
+        gXml2lyOptions ()->fInputSourceName,
         inputLineNumber,
         __FILE__, __LINE__,
         s.str ());
@@ -17384,18 +17384,18 @@ void mxmlTree2MsrTranslator::visitEnd ( S_note& elt )
         fCurrentNoteHeadParenthesesKind);
 
 #ifdef TRACE_OPTIONS
-  if (gTraceOptions->fTraceNotesDetails) {
+  if (gTraceOptions ()->fTraceNotesDetails) {
     fLogOutputStream <<
       "Creating note:" <<
       endl;
 
-    gIndenter++;
+    gIndenter ()++;
     
     fLogOutputStream <<
       newNote <<
       endl;
 
-    gIndenter--;
+    gIndenter ()--;
   }
 #endif
   
@@ -17435,7 +17435,7 @@ void mxmlTree2MsrTranslator::visitEnd ( S_note& elt )
   // set current staff number to insert into if needed JMI ???
   if (fCurrentStaffNumberToInsertInto == K_NO_STAFF_NUMBER) {
 #ifdef TRACE_OPTIONS
-    if (gTraceOptions->fTraceNotes || gTraceOptions->fTraceStaves) {
+    if (gTraceOptions ()->fTraceNotes || gTraceOptions ()->fTraceStaves) {
       fLogOutputStream <<
         "==> setting fCurrentStaffNumberToInsertInto to " <<
         fCurrentMusicXMLStaffNumber <<
@@ -17451,7 +17451,7 @@ void mxmlTree2MsrTranslator::visitEnd ( S_note& elt )
   }
     
 #ifdef TRACE_OPTIONS
-  if (gTraceOptions->fTraceNotes || gTraceOptions->fTraceStaves) {
+  if (gTraceOptions ()->fTraceNotes || gTraceOptions ()->fTraceStaves) {
     fLogOutputStream <<
       "==> fetching voice to insert into" <<
       ", fCurrentStaffNumberToInsertInto = " <<
@@ -17481,7 +17481,7 @@ void mxmlTree2MsrTranslator::visitEnd ( S_note& elt )
     "voiceToInsertInto is null");
         
 #ifdef TRACE_OPTIONS
-  if (gTraceOptions->fTraceNotes || gTraceOptions->fTraceStaves) {
+  if (gTraceOptions ()->fTraceNotes || gTraceOptions ()->fTraceStaves) {
     fLogOutputStream <<
       "==> is there a staff change?" <<
       ", fCurrentStaffNumberToInsertInto = " <<
@@ -17531,9 +17531,9 @@ void mxmlTree2MsrTranslator::visitEnd ( S_note& elt )
 
 #ifdef TRACE_OPTIONS
       if (
-        gTraceOptions->fTraceStaves
+        gTraceOptions ()->fTraceStaves
           ||
-        gTraceOptions->fTraceVoices
+        gTraceOptions ()->fTraceVoices
       ) {
         fLogOutputStream <<
           "*** There is staff change for chord member note '" <<
@@ -17564,9 +17564,9 @@ void mxmlTree2MsrTranslator::visitEnd ( S_note& elt )
 
 #ifdef TRACE_OPTIONS
       if (
-        gTraceOptions->fTraceStaves
+        gTraceOptions ()->fTraceStaves
           ||
-        gTraceOptions->fTraceVoices
+        gTraceOptions ()->fTraceVoices
       ) {
         fLogOutputStream <<
           "*** There is staff change for note '" <<
@@ -17701,7 +17701,7 @@ void mxmlTree2MsrTranslator::visitEnd ( S_note& elt )
             ", using the latter";
       
           msrMusicXMLWarning (
-            gXml2lyOptions->fInputSourceName,
+            gXml2lyOptions ()->fInputSourceName,
             inputLineNumber,
             s.str ());
         }
@@ -17763,7 +17763,7 @@ void mxmlTree2MsrTranslator::visitEnd ( S_note& elt )
 
 /* JMI
 #ifdef TRACE_OPTIONS
-  if (gTraceOptions->fTraceNotes) { // JMI
+  if (gTraceOptions ()->fTraceNotes) { // JMI
      const int fieldWidth = 27;
 
     fLogOutputStream << left <<
@@ -17853,13 +17853,13 @@ void mxmlTree2MsrTranslator::visitEnd ( S_note& elt )
   // so that it gets attached to the note right now
   if (fPendingFiguredBass) {
 #ifdef TRACE_OPTIONS
-    if (gTraceOptions->fTraceFiguredBass) {
+    if (gTraceOptions ()->fTraceFiguredBass) {
       fLogOutputStream <<
         "--> figured bass" <<
         ", line " << inputLineNumber << ":" <<
         endl;
   
-      gIndenter++;
+      gIndenter ()++;
 
       const int fieldWidth = 31;
       
@@ -17871,7 +17871,7 @@ void mxmlTree2MsrTranslator::visitEnd ( S_note& elt )
         fCurrentFiguredBassSoundingWholeNotes <<
         endl;
           
-      gIndenter--;
+      gIndenter ()--;
     }
 #endif
   
@@ -17957,7 +17957,7 @@ void mxmlTree2MsrTranslator::visitEnd ( S_note& elt )
 
   // register newNote as the last found note for the current voice  
 #ifdef TRACE_OPTIONS
-  if (gTraceOptions->fTraceChords) {
+  if (gTraceOptions ()->fTraceChords) {
     fLogOutputStream <<
       "--> STORING " <<
       newNote->asShortString () <<
@@ -17989,7 +17989,7 @@ void mxmlTree2MsrTranslator::visitEnd ( S_note& elt )
       newNote;
 
 #ifdef TRACE_OPTIONS
-  if (gTraceOptions->fTraceChords) {
+  if (gTraceOptions ()->fTraceChords) {
     fLogOutputStream <<
       "--> AFTER STORING " <<
       endl;
@@ -18058,15 +18058,15 @@ void mxmlTree2MsrTranslator::handleStandaloneOrDoubleTremoloNoteOrGraceNoteOrRes
   }
 
 #ifdef TRACE_OPTIONS
-  if (gTraceOptions->fTraceChords) { // JMI
+  if (gTraceOptions ()->fTraceChords) { // JMI
     fLogOutputStream <<
       "handleStandaloneOrDoubleTremoloNoteOrGraceNoteOrRest(), newNote = " <<
       endl;
-    gIndenter++;
+    gIndenter ()++;
     fLogOutputStream <<
       newNote <<
       endl;
-    gIndenter--;
+    gIndenter ()--;
   }
 #endif
   
@@ -18079,7 +18079,7 @@ void mxmlTree2MsrTranslator::handleStandaloneOrDoubleTremoloNoteOrGraceNoteOrRes
         fCurrentMusicXMLVoiceNumber);
   
 #ifdef TRACE_OPTIONS
-  if (gTraceOptions->fTraceNotes) {    
+  if (gTraceOptions ()->fTraceNotes) {    
     fLogOutputStream <<
       "Handling a standalone, double tremolo or grace note or rest" <<
       ", currentVoice = \"" <<
@@ -18088,7 +18088,7 @@ void mxmlTree2MsrTranslator::handleStandaloneOrDoubleTremoloNoteOrGraceNoteOrRes
       ":" <<
       endl;
 
-    gIndenter++;
+    gIndenter ()++;
 
     fLogOutputStream <<
       newNote->asString () <<
@@ -18107,7 +18107,7 @@ void mxmlTree2MsrTranslator::handleStandaloneOrDoubleTremoloNoteOrGraceNoteOrRes
       booleanAsString (fCurrentNoteIsAGraceNote) <<
       endl;
 
-    if (gTraceOptions->fTraceNotesDetails) {
+    if (gTraceOptions ()->fTraceNotesDetails) {
       fLogOutputStream <<
         setw (fieldWidth) << "fPendingGraceNotesGroup" << " : " <<
         endl <<
@@ -18133,7 +18133,7 @@ void mxmlTree2MsrTranslator::handleStandaloneOrDoubleTremoloNoteOrGraceNoteOrRes
         endl;
     }
 
-    gIndenter--;
+    gIndenter ()--;
   }
 #endif
 
@@ -18150,7 +18150,7 @@ void mxmlTree2MsrTranslator::handleStandaloneOrDoubleTremoloNoteOrGraceNoteOrRes
       // this is the first grace note in grace notes
 
 #ifdef TRACE_OPTIONS
-      if (gTraceOptions->fTraceTuplets || gTraceOptions->fTraceGraceNotes) {
+      if (gTraceOptions ()->fTraceTuplets || gTraceOptions ()->fTraceGraceNotes) {
         fLogOutputStream <<
           "Creating grace notes for note '" <<
           newNote->asString () <<
@@ -18202,7 +18202,7 @@ void mxmlTree2MsrTranslator::handleStandaloneOrDoubleTremoloNoteOrGraceNoteOrRes
 
     // append newNote to the current grace notes
 #ifdef TRACE_OPTIONS
-    if (gTraceOptions->fTraceTuplets || gTraceOptions->fTraceGraceNotes) {
+    if (gTraceOptions ()->fTraceTuplets || gTraceOptions ()->fTraceGraceNotes) {
       fLogOutputStream <<
         "Appending note " <<
         newNote->asString () <<
@@ -18229,7 +18229,7 @@ void mxmlTree2MsrTranslator::handleStandaloneOrDoubleTremoloNoteOrGraceNoteOrRes
       case kTremoloTypeSingle:
         // append newNote to the current voice
 #ifdef TRACE_OPTIONS
-        if (gTraceOptions->fTraceNotes) {
+        if (gTraceOptions ()->fTraceNotes) {
           fLogOutputStream <<
             "Appending standalone " <<
             newNote->asString () <<
@@ -18251,7 +18251,7 @@ void mxmlTree2MsrTranslator::handleStandaloneOrDoubleTremoloNoteOrGraceNoteOrRes
       case kTremoloTypeStart:
         // register newNote as first element of the current double tremolo
 #ifdef TRACE_OPTIONS
-        if (gTraceOptions->fTraceNotes) {
+        if (gTraceOptions ()->fTraceNotes) {
           fLogOutputStream <<
             "Setting standalone note '" <<
             newNote->asString () <<
@@ -18272,7 +18272,7 @@ void mxmlTree2MsrTranslator::handleStandaloneOrDoubleTremoloNoteOrGraceNoteOrRes
       case kTremoloTypeStop:
         // register newNote as second element of the current double tremolo
 #ifdef TRACE_OPTIONS
-        if (gTraceOptions->fTraceNotes) {
+        if (gTraceOptions ()->fTraceNotes) {
           fLogOutputStream <<
             "Setting standalone note '" <<
             newNote->asString () <<
@@ -18311,7 +18311,7 @@ void mxmlTree2MsrTranslator::handleStandaloneOrDoubleTremoloNoteOrGraceNoteOrRes
     
     // append newNote to the current voice
 #ifdef TRACE_OPTIONS
-    if (gTraceOptions->fTraceNotes) {
+    if (gTraceOptions ()->fTraceNotes) {
       fLogOutputStream <<
         "Appending standalone " <<
         newNote->asString () <<
@@ -18378,14 +18378,14 @@ void mxmlTree2MsrTranslator::handleLyricsForNote (
     newNote->getInputLineNumber ();
 
 #ifdef TRACE_OPTIONS
-  if (gTraceOptions->fTraceLyrics) {
+  if (gTraceOptions ()->fTraceLyrics) {
     fLogOutputStream <<
       "Handling lyrics for note '" <<
       newNote->asShortString () <<
       "', line " << inputLineNumber <<
       endl;
 
-    gIndenter++;
+    gIndenter ()++;
 
     const int fieldWidth = 33;
     
@@ -18439,14 +18439,14 @@ void mxmlTree2MsrTranslator::handleLyricsForNote (
     fLogOutputStream <<
       endl;
 
-    gIndenter--;
+    gIndenter ()--;
   }
 #endif
 
   if (fCurrentNoteHasLyrics) {
     // newNote has lyrics attached to it
 #ifdef TRACE_OPTIONS
-    if (gTraceOptions->fTraceNotesDetails || gTraceOptions->fTraceLyricsDetails) {
+    if (gTraceOptions ()->fTraceNotesDetails || gTraceOptions ()->fTraceLyricsDetails) {
       fLogOutputStream <<
         "Note '" <<
         newNote->asShortString () <<
@@ -18582,24 +18582,24 @@ void mxmlTree2MsrTranslator::handleNoteBelongingToAChord (
       msrNote::kChordMemberNote);
 
 #ifdef TRACE_OPTIONS
-  if (gTraceOptions->fTraceChords) {
+  if (gTraceOptions ()->fTraceChords) {
     fLogOutputStream <<
       "Handling a note belonging to a chord" <<
       ", newChordNote:" <<
       endl;
 
-    gIndenter++;
+    gIndenter ()++;
 
     fLogOutputStream << newChordNote <<
       endl;
 
-    gIndenter--;
+    gIndenter ()--;
   }
 #endif
 
   if (fCurrentNoteIsARest) {
     msrMusicXMLError (
-      gXml2lyOptions->fInputSourceName,
+      gXml2lyOptions ()->fInputSourceName,
       inputLineNumber,
       __FILE__, __LINE__,
       "a rest cannot belong to a chord");
@@ -18635,9 +18635,9 @@ void mxmlTree2MsrTranslator::handleNoteBelongingToAChord (
           
 #ifdef TRACE_OPTIONS
   if (
-    gTraceOptions->fTraceNotes
+    gTraceOptions ()->fTraceNotes
       ||
-    gTraceOptions->fTraceChords
+    gTraceOptions ()->fTraceChords
     ) {
     fLogOutputStream << // JMI
       endl <<
@@ -18669,7 +18669,7 @@ void mxmlTree2MsrTranslator::handleNoteBelongingToAChord (
       "currentVoice is null");
     
 #ifdef TRACE_OPTIONS
-  if (gTraceOptions->fTraceNotes || gTraceOptions->fTraceChords) {
+  if (gTraceOptions ()->fTraceNotes || gTraceOptions ()->fTraceChords) {
     fLogOutputStream <<
       "Handling a chord member note" <<
       ", currentVoice = \"" <<
@@ -18683,9 +18683,9 @@ void mxmlTree2MsrTranslator::handleNoteBelongingToAChord (
 
 #ifdef TRACE_OPTIONS
   if (
-    gTraceOptions->fTraceNotesDetails
+    gTraceOptions ()->fTraceNotesDetails
       ||
-    gTraceOptions->fTraceChordsDetails
+    gTraceOptions ()->fTraceChordsDetails
   ) {
     fLogOutputStream <<
       endl <<
@@ -18722,7 +18722,7 @@ void mxmlTree2MsrTranslator::handleNoteBelongingToAChord (
     // i.e the last handled note for this voice
 
 #ifdef TRACE_OPTIONS
-    if (gTraceOptions->fTraceChords) {
+    if (gTraceOptions ()->fTraceChords) {
       printVoicesLastMetNoteMap (
         inputLineNumber);
     }
@@ -18755,26 +18755,26 @@ void mxmlTree2MsrTranslator::handleNoteBelongingToAChord (
         "fCurrentMusicXMLVoiceNumber = " << fCurrentMusicXMLVoiceNumber;
         
       msrInternalError (
-        gXml2lyOptions->fInputSourceName,
+        gXml2lyOptions ()->fInputSourceName,
         inputLineNumber,
         __FILE__, __LINE__,
         s.str ());
     }
         
 #ifdef TRACE_OPTIONS
-    if (gTraceOptions->fTraceChords) {
+    if (gTraceOptions ()->fTraceChords) {
       fLogOutputStream <<
         "mxmlTree2MsrTranslator::handleNoteBelongingToAChord()" <<
         ", chordFirstNote:" <<
         endl;
 
-      gIndenter++;
+      gIndenter ()++;
 
       fLogOutputStream <<
         chordFirstNote <<
         endl;
 
-      gIndenter--;
+      gIndenter ()--;
     }
 #endif
 
@@ -18785,20 +18785,20 @@ void mxmlTree2MsrTranslator::handleNoteBelongingToAChord (
         chordFirstNote->getNoteKind ();
         
 #ifdef TRACE_OPTIONS
-    if (gTraceOptions->fTraceChords) {
+    if (gTraceOptions ()->fTraceChords) {
       fLogOutputStream <<
         "Handling a note belonging to a chord" <<
         ", savedChordFirstNoteKind = " <<
         msrNote::noteKindAsString (savedChordFirstNoteKind) <<
         endl;
 
-      gIndenter++;
+      gIndenter ()++;
 
       fLogOutputStream <<
         chordFirstNote <<
         endl;
 
-      gIndenter--;
+      gIndenter ()--;
     }
 #endif
 
@@ -18822,7 +18822,7 @@ void mxmlTree2MsrTranslator::handleNoteBelongingToAChord (
       case msrNote::kStandaloneNote:
         // remove last handled (previous current) note from the current voice
 #ifdef TRACE_OPTIONS
-        if (gTraceOptions->fTraceNotes || gTraceOptions->fTraceChords) {
+        if (gTraceOptions ()->fTraceNotes || gTraceOptions ()->fTraceChords) {
           fLogOutputStream <<
             "Removing chord first note " <<
             chordFirstNote->asShortString () <<
@@ -18835,9 +18835,9 @@ void mxmlTree2MsrTranslator::handleNoteBelongingToAChord (
     
 #ifdef TRACE_OPTIONS
         if (
-          gTraceOptions->fTraceNotesDetails
+          gTraceOptions ()->fTraceNotesDetails
             ||
-          gTraceOptions->fTraceChordsDetails
+          gTraceOptions ()->fTraceChordsDetails
         ) {
           fLogOutputStream <<
             endl << endl <<
@@ -18851,15 +18851,15 @@ void mxmlTree2MsrTranslator::handleNoteBelongingToAChord (
         
 #ifdef TRACE_OPTIONS
         if (
-          gTraceOptions->fTraceNotes
+          gTraceOptions ()->fTraceNotes
             ||
-          gTraceOptions->fTraceChords
+          gTraceOptions ()->fTraceChords
             ||
-          gTraceOptions->fTraceStaves
+          gTraceOptions ()->fTraceStaves
             ||
-          gTraceOptions->fTraceMeasures
+          gTraceOptions ()->fTraceMeasures
             ||
-          gTraceOptions->fTraceLyrics
+          gTraceOptions ()->fTraceLyrics
         ) {
           fLogOutputStream << // JMI
             endl <<
@@ -18881,7 +18881,7 @@ void mxmlTree2MsrTranslator::handleNoteBelongingToAChord (
     
         // add chord to the voice instead
 #ifdef TRACE_OPTIONS
-        if (gTraceOptions->fTraceChords) {
+        if (gTraceOptions ()->fTraceChords) {
           fLogOutputStream <<
             "Appending chord " << fCurrentChord->asString () <<
             " to voice \"" <<
@@ -18908,7 +18908,7 @@ void mxmlTree2MsrTranslator::handleNoteBelongingToAChord (
           /* JMI
           // updating chord's divisions // JMI
 #ifdef TRACE_OPTIONS
-          if (gTraceOptions->fTraceNotes || gTraceOptions->fTraceChords) {
+          if (gTraceOptions ()->fTraceNotes || gTraceOptions ()->fTraceChords) {
             fLogOutputStream <<
               "Updating sounding divisions for double tremolo chord '" <<
               "' " << chord->asString () <<
@@ -18948,7 +18948,7 @@ void mxmlTree2MsrTranslator::handleNoteBelongingToAChord (
               "' belongs to a double tremolo, but is not marked as such";
   
             msrInternalError (
-              gXml2lyOptions->fInputSourceName,
+              gXml2lyOptions ()->fInputSourceName,
               inputLineNumber,
               __FILE__, __LINE__,
               s.str ());
@@ -18983,7 +18983,7 @@ void mxmlTree2MsrTranslator::handleNoteBelongingToAChord (
 
 /* JMI
 #ifdef TRACE_OPTIONS
-    if (gTraceOptions->fTraceChords) {
+    if (gTraceOptions ()->fTraceChords) {
       fLogOutputStream <<
         "is newChordNote in the same chord but in another voice?" <<
         ", currentVoice = " <<
@@ -18997,7 +18997,7 @@ void mxmlTree2MsrTranslator::handleNoteBelongingToAChord (
   
   // register newChordNote as another member of chord
 #ifdef TRACE_OPTIONS
-    if (gTraceOptions->fTraceChords) {
+    if (gTraceOptions ()->fTraceChords) {
       fLogOutputStream <<
         "Adding another note " <<
         newChordNote->asString() <<
@@ -19019,7 +19019,7 @@ void mxmlTree2MsrTranslator::handleNoteBelongingToAChord (
     newChordNote, fCurrentChord);
 
 #ifdef TRACE_OPTIONS
-  if (gTraceOptions->fTraceChordsDetails) {
+  if (gTraceOptions ()->fTraceChordsDetails) {
     printCurrentChord ();
   }
 #endif
@@ -19034,7 +19034,7 @@ void mxmlTree2MsrTranslator::handlePendingTupletStopIfAny (
     // finalize the tuplet, only now
     // in case the last element is a chord
 #ifdef TRACE_OPTIONS
-    if (gTraceOptions->fTraceTuplets) {
+    if (gTraceOptions ()->fTraceTuplets) {
       fLogOutputStream <<
         "--> kTupletTypeStart: handling pending tuplet stop, note '" <<
         note->
@@ -19078,7 +19078,7 @@ void mxmlTree2MsrTranslator::handleNoteBelongingToATuplet (
   }
 
 #ifdef TRACE_OPTIONS
-  if (gTraceOptions->fTraceNotes || gTraceOptions->fTraceTuplets) {
+  if (gTraceOptions ()->fTraceNotes || gTraceOptions ()->fTraceTuplets) {
     fLogOutputStream <<
       "Handling a note belonging to a tuplet" <<
       ", note: " <<
@@ -19099,7 +19099,7 @@ void mxmlTree2MsrTranslator::handleNoteBelongingToATuplet (
     case msrTuplet::kTupletTypeStart:
       {
 #ifdef TRACE_OPTIONS
-        if (gTraceOptions->fTraceNotes || gTraceOptions->fTraceTuplets) {
+        if (gTraceOptions ()->fTraceNotes || gTraceOptions ()->fTraceTuplets) {
           fLogOutputStream <<
             "--> kTupletTypeStart: note = '" <<
             note->
@@ -19117,7 +19117,7 @@ void mxmlTree2MsrTranslator::handleNoteBelongingToATuplet (
           // finalize the tuplet, only now
           // in case the last element is a chord
 #ifdef TRACE_OPTIONS
-          if (gTraceOptions->fTraceTuplets) {
+          if (gTraceOptions ()->fTraceTuplets) {
             fLogOutputStream <<
               "--> kTupletTypeStart: handling pending tuplet stop, note '" <<
               note->
@@ -19155,7 +19155,7 @@ void mxmlTree2MsrTranslator::handleNoteBelongingToATuplet (
               
           // populate the tuplet at the top of the stack
 #ifdef TRACE_OPTIONS
-          if (gTraceOptions->fTraceNotes || gTraceOptions->fTraceTuplets) {
+          if (gTraceOptions ()->fTraceNotes || gTraceOptions ()->fTraceTuplets) {
             fLogOutputStream <<
               "--> kTupletTypeContinue: adding tuplet member note '" <<
               note->
@@ -19173,7 +19173,7 @@ void mxmlTree2MsrTranslator::handleNoteBelongingToATuplet (
               nullptr /* JMI */);
 
 #ifdef TRACE_OPTIONS
-          if (gTraceOptions->fTraceTupletsDetails) {
+          if (gTraceOptions ()->fTraceTupletsDetails) {
             displayTupletsStack (
               "############## kTupletTypeContinue");
           }
@@ -19200,7 +19200,7 @@ void mxmlTree2MsrTranslator::handleNoteBelongingToATuplet (
             "' cannot be added, tuplets stack is empty";
 
           msrInternalError (
-            gXml2lyOptions->fInputSourceName,
+            gXml2lyOptions ()->fInputSourceName,
             inputLineNumber,
             __FILE__, __LINE__,
             s.str ());
@@ -19224,7 +19224,7 @@ void mxmlTree2MsrTranslator::handleNoteBelongingToATuplet (
                 "' cannot be added, tuplets stack is empty";
     
               msrInternalError (
-                gXml2lyOptions->fInputSourceName,
+                gXml2lyOptions ()->fInputSourceName,
                 inputLineNumber,
                 __FILE__, __LINE__,
                 s.str ());
@@ -19241,7 +19241,7 @@ void mxmlTree2MsrTranslator::handleNoteBelongingToATuplet (
                 
               // populate the tuplet at the top of the stack
 #ifdef TRACE_OPTIONS
-              if (gTraceOptions->fTraceNotes || gTraceOptions->fTraceTuplets) {
+              if (gTraceOptions ()->fTraceNotes || gTraceOptions ()->fTraceTuplets) {
                 fLogOutputStream <<
                   "--> kTupletTypeStop: adding outer-most tuplet member note '" <<
                   note->
@@ -19259,7 +19259,7 @@ void mxmlTree2MsrTranslator::handleNoteBelongingToATuplet (
                   nullptr /* JMI */);
 
 #ifdef TRACE_OPTIONS
-              if (gTraceOptions->fTraceTupletsDetails) {
+              if (gTraceOptions ()->fTraceTupletsDetails) {
                 displayTupletsStack (
                   "############## kTupletTypeStop, outer-most");
               }
@@ -19269,7 +19269,7 @@ void mxmlTree2MsrTranslator::handleNoteBelongingToATuplet (
               if (fCurrentATupletStopIsPending) {
                 // end of a tuplet forces handling of the pending one 
 #ifdef TRACE_OPTIONS
-                if (gTraceOptions->fTraceTuplets) {
+                if (gTraceOptions ()->fTraceTuplets) {
                   fLogOutputStream <<
                     "--> kTupletTypeStop: finalizing pending tuplet" <<
                     ", line " << inputLineNumber <<
@@ -19285,7 +19285,7 @@ void mxmlTree2MsrTranslator::handleNoteBelongingToATuplet (
               }
               else {
 #ifdef TRACE_OPTIONS
-                if (gTraceOptions->fTraceTuplets) {
+                if (gTraceOptions ()->fTraceTuplets) {
                   fLogOutputStream <<
                     "--> kTupletTypeStop: finalizing non-pending tuplet" << // JMI ???
                     ", line " << inputLineNumber <<
@@ -19315,7 +19315,7 @@ void mxmlTree2MsrTranslator::handleNoteBelongingToATuplet (
               if (fCurrentATupletStopIsPending) {
                 // end of a tuplet forces handling of the pending one 
 #ifdef TRACE_OPTIONS
-                if (gTraceOptions->fTraceTuplets) {
+                if (gTraceOptions ()->fTraceTuplets) {
                   fLogOutputStream <<
                     "--> kTupletTypeStop: finalizing tuplet" <<
                     ", line " << inputLineNumber <<
@@ -19337,7 +19337,7 @@ void mxmlTree2MsrTranslator::handleNoteBelongingToATuplet (
                 
               // populate the tuplet at the top of the stack
 #ifdef TRACE_OPTIONS
-              if (gTraceOptions->fTraceNotes || gTraceOptions->fTraceTuplets) {
+              if (gTraceOptions ()->fTraceNotes || gTraceOptions ()->fTraceTuplets) {
                 fLogOutputStream <<
                   "--> kTupletTypeStop: adding nested tuplet member note '" <<
                   note->
@@ -19356,7 +19356,7 @@ void mxmlTree2MsrTranslator::handleNoteBelongingToATuplet (
                 
 
 #ifdef TRACE_OPTIONS
-              if (gTraceOptions->fTraceTupletsDetails) {
+              if (gTraceOptions ()->fTraceTupletsDetails) {
                 displayTupletsStack (
                   "############## kTupletTypeStop, nested");
               }
@@ -19384,7 +19384,7 @@ void mxmlTree2MsrTranslator::handleNoteBelongingToATuplet (
     case msrTuplet::kTupletTypeStartAndStopInARow:
       {
 #ifdef TRACE_OPTIONS
-        if (gTraceOptions->fTraceNotes || gTraceOptions->fTraceTuplets) {
+        if (gTraceOptions ()->fTraceNotes || gTraceOptions ()->fTraceTuplets) {
           fLogOutputStream <<
             "--> kTupletTypeStartAndStopInARow: note = '" <<
             note->
@@ -19404,7 +19404,7 @@ void mxmlTree2MsrTranslator::handleNoteBelongingToATuplet (
             "one-note tuplet with a non single tremolo contents met";
           
           msrMusicXMLError (
-            gXml2lyOptions->fInputSourceName,
+            gXml2lyOptions ()->fInputSourceName,
             inputLineNumber,
             __FILE__, __LINE__,
             s.str ());
@@ -19466,11 +19466,11 @@ void mxmlTree2MsrTranslator::handleNoteBelongingToAChordInATuplet (
 
 #ifdef TRACE_OPTIONS
   if (
-    gTraceOptions->fTraceNotes
+    gTraceOptions ()->fTraceNotes
       ||
-    gTraceOptions->fTraceChords
+    gTraceOptions ()->fTraceChords
       ||
-      gTraceOptions->fTraceTuplets
+      gTraceOptions ()->fTraceTuplets
     ) {
     fLogOutputStream <<
       "Handling a note belonging to a chord in a tuplet" <<
@@ -19483,7 +19483,7 @@ void mxmlTree2MsrTranslator::handleNoteBelongingToAChordInATuplet (
 
   if (fCurrentNoteIsARest) {
     msrMusicXMLError (
-      gXml2lyOptions->fInputSourceName,
+      gXml2lyOptions ()->fInputSourceName,
       inputLineNumber,
       __FILE__, __LINE__,
       "a rest cannot belong to a chord");
@@ -19519,7 +19519,7 @@ void mxmlTree2MsrTranslator::handleNoteBelongingToAChordInATuplet (
         "cannot be added, tuplets stack is empty";
   
       msrInternalError (
-        gXml2lyOptions->fInputSourceName,
+        gXml2lyOptions ()->fInputSourceName,
         inputLineNumber,
         __FILE__, __LINE__,
         s.str ());
@@ -19556,7 +19556,7 @@ void mxmlTree2MsrTranslator::handleNoteBelongingToAChordInATuplet (
 */
 
 #ifdef TRACE_OPTIONS
-    if (gTraceOptions->fTraceTupletsDetails) {
+    if (gTraceOptions ()->fTraceTupletsDetails) {
       displayTupletsStack (
         "############## After  removeLastNoteFromTuplet()");
     }
@@ -19584,11 +19584,11 @@ void mxmlTree2MsrTranslator::handleNoteBelongingToAChordInATuplet (
     // add chord to the current tuplet instead of tupletLastNote
 #ifdef TRACE_OPTIONS
     if (
-      gTraceOptions->fTraceNotes
+      gTraceOptions ()->fTraceNotes
         ||
-      gTraceOptions->fTraceChords
+      gTraceOptions ()->fTraceChords
         ||
-      gTraceOptions->fTraceTuplets
+      gTraceOptions ()->fTraceTuplets
       ) {
       fLogOutputStream <<
         "Adding chord '" <<
@@ -19618,7 +19618,7 @@ void mxmlTree2MsrTranslator::handleNoteBelongingToAChordInATuplet (
 
   // register note as another member of chord
 #ifdef TRACE_OPTIONS
-  if (gTraceOptions->fTraceNotes || gTraceOptions->fTraceChords) {
+  if (gTraceOptions ()->fTraceNotes || gTraceOptions ()->fTraceChords) {
     fLogOutputStream <<
       "Adding another note " <<
       newChordNote->
@@ -19639,7 +19639,7 @@ void mxmlTree2MsrTranslator::handleNoteBelongingToAChordInATuplet (
     newChordNote, fCurrentChord);
 
 #ifdef TRACE_OPTIONS
-  if (gTraceOptions->fTraceChordsDetails) {
+  if (gTraceOptions ()->fTraceChordsDetails) {
     printCurrentChord ();
   }
 #endif
@@ -19667,11 +19667,11 @@ void mxmlTree2MsrTranslator::handleNoteBelongingToAChordInAGraceNotesGroup (
 
 #ifdef TRACE_OPTIONS
   if (
-    gTraceOptions->fTraceNotes
+    gTraceOptions ()->fTraceNotes
       ||
-    gTraceOptions->fTraceChords
+    gTraceOptions ()->fTraceChords
       ||
-    gTraceOptions->fTraceGraceNotes
+    gTraceOptions ()->fTraceGraceNotes
     ) {
     fLogOutputStream <<
       "Handling a note belonging to a chord in grace notes" <<
@@ -19685,7 +19685,7 @@ void mxmlTree2MsrTranslator::handleNoteBelongingToAChordInAGraceNotesGroup (
 
   if (fCurrentNoteIsARest) {
     msrMusicXMLError (
-      gXml2lyOptions->fInputSourceName,
+      gXml2lyOptions ()->fInputSourceName,
       inputLineNumber,
       __FILE__, __LINE__,
       "a rest cannot belong to a chord");
@@ -19732,7 +19732,7 @@ void mxmlTree2MsrTranslator::handleNoteBelongingToAChordInAGraceNotesGroup (
           newChordNote->asString ();
           
         msrInternalError (
-        gXml2lyOptions->fInputSourceName,
+        gXml2lyOptions ()->fInputSourceName,
         inputLineNumber,
         __FILE__, __LINE__,
           s.str ());
@@ -19741,11 +19741,11 @@ void mxmlTree2MsrTranslator::handleNoteBelongingToAChordInAGraceNotesGroup (
        
 #ifdef TRACE_OPTIONS
     if (
-      gTraceOptions->fTraceNotes
+      gTraceOptions ()->fTraceNotes
         ||
-      gTraceOptions->fTraceChords
+      gTraceOptions ()->fTraceChords
         ||
-      gTraceOptions->fTraceGraceNotes
+      gTraceOptions ()->fTraceGraceNotes
     ) {
       fLogOutputStream <<
         "The grace notes chord's first note is '" <<
@@ -19806,7 +19806,7 @@ void mxmlTree2MsrTranslator::handleNoteBelongingToAChordInAGraceNotesGroup (
         "cannot be added, tuplets stack is empty";
 
       msrInternalError (
-        gXml2lyOptions->fInputSourceName,
+        gXml2lyOptions ()->fInputSourceName,
         inputLineNumber,
         __FILE__, __LINE__,
         s.str ());
@@ -19819,7 +19819,7 @@ void mxmlTree2MsrTranslator::handleNoteBelongingToAChordInAGraceNotesGroup (
 
   // register note as another member of chord
 #ifdef TRACE_OPTIONS
-  if (gTraceOptions->fTraceNotes || gTraceOptions->fTraceChords) {
+  if (gTraceOptions ()->fTraceNotes || gTraceOptions ()->fTraceChords) {
     fLogOutputStream <<
       "Adding another note " <<
       newChordNote->
@@ -19840,7 +19840,7 @@ void mxmlTree2MsrTranslator::handleNoteBelongingToAChordInAGraceNotesGroup (
     newChordNote, fCurrentChord);
 
 #ifdef TRACE_OPTIONS
-  if (gTraceOptions->fTraceChordsDetails) {
+  if (gTraceOptions ()->fTraceChordsDetails) {
     printCurrentChord ();
   }
 #endif
@@ -19851,7 +19851,7 @@ void mxmlTree2MsrTranslator::handleTupletsPendingOnTupletsStack (
   int inputLineNumber)
 {
 #ifdef TRACE_OPTIONS
-  if (gTraceOptions->fTraceTuplets) {
+  if (gTraceOptions ()->fTraceTuplets) {
     fLogOutputStream <<
       "Handling tuplets pending on tuplet stack" <<
       ", fCurrentStaffNumberToInsertInto = " <<
@@ -19862,7 +19862,7 @@ void mxmlTree2MsrTranslator::handleTupletsPendingOnTupletsStack (
       endl;
   }
 
-  if (gTraceOptions->fTraceTupletsDetails) {
+  if (gTraceOptions ()->fTraceTupletsDetails) {
     displayTupletsStack (
       "############## Before  handleTupletsPendingOnTupletsStack()");
   }
@@ -19890,7 +19890,7 @@ void mxmlTree2MsrTranslator::handleTupletsPendingOnTupletsStack (
   } // while
 
 #ifdef TRACE_OPTIONS
-  if (gTraceOptions->fTraceTupletsDetails) {
+  if (gTraceOptions ()->fTraceTupletsDetails) {
     displayTupletsStack (
       "############## Before  handleTupletsPendingOnTupletsStack()");
   }
@@ -19919,7 +19919,7 @@ void mxmlTree2MsrTranslator::displayLastHandledTupletInVoiceMap (string header)
     fLogOutputStream <<
       endl;
     
-    gIndenter++;
+    gIndenter ()++;
     
     for ( ; ; ) {
       fLogOutputStream <<
@@ -19935,7 +19935,7 @@ void mxmlTree2MsrTranslator::displayLastHandledTupletInVoiceMap (string header)
     fLogOutputStream <<
       endl;
       
-    gIndenter--;
+    gIndenter ()--;
   }
 
   fLogOutputStream <<
@@ -19947,7 +19947,7 @@ void mxmlTree2MsrTranslator::createAndPrependImplicitBarLine (
   int inputLineNumber)
 {     
 #ifdef TRACE_OPTIONS
-  if (gTraceOptions->fTraceBarlines || gTraceOptions->fTraceRepeats) {
+  if (gTraceOptions ()->fTraceBarlines || gTraceOptions ()->fTraceRepeats) {
     fLogOutputStream <<
       "Prepending an implicit repeat start barline at the beginning of part" <<
       fCurrentPart->getPartCombinedName () <<
@@ -19981,12 +19981,12 @@ void mxmlTree2MsrTranslator::createAndPrependImplicitBarLine (
         fCurrentBarlineTimes);
 
   // prepend the implicit barline to the voice
-  gIndenter++;
+  gIndenter ()++;
   
   currentVoice->
     prependBarlineToVoice (implicitBarline);
 
-  gIndenter--;
+  gIndenter ()--;
 }
 
 //______________________________________________________________________________
@@ -19997,7 +19997,7 @@ void mxmlTree2MsrTranslator::handleRepeatStart (
     barline->getInputLineNumber ();
 
 #ifdef TRACE_OPTIONS
-  if (gTraceOptions->fTraceRepeats) {
+  if (gTraceOptions ()->fTraceRepeats) {
     fLogOutputStream <<
       "Handling repeat start" <<
     /* JMI
@@ -20037,7 +20037,7 @@ void mxmlTree2MsrTranslator::handleRepeatEnd (
     barline->getInputLineNumber ();
 
 #ifdef TRACE_OPTIONS
-  if (gTraceOptions->fTraceRepeats) {
+  if (gTraceOptions ()->fTraceRepeats) {
     fLogOutputStream <<
       "Handling repeat end" <<
     /* JMI
@@ -20064,14 +20064,14 @@ void mxmlTree2MsrTranslator::handleRepeatEnd (
   if (
     ! fOnGoingRepeat
       &&
-    gMsrOptions->fCreateImplicitInitialRepeatBarline
+    gMsrOptions ()->fCreateImplicitInitialRepeatBarline
   ) {
     createAndPrependImplicitBarLine (
       inputLineNumber);
    }
 
 #ifdef TRACE_OPTIONS
-  if (gTraceOptions->fTraceRepeats) {
+  if (gTraceOptions ()->fTraceRepeats) {
     fLogOutputStream <<
       "Appending a repeat to part " <<
       fCurrentPart->getPartCombinedName () <<
@@ -20099,7 +20099,7 @@ void mxmlTree2MsrTranslator::handleEndingStart (
     barline->getInputLineNumber ();
 
 #ifdef TRACE_OPTIONS
-  if (gTraceOptions->fTraceRepeats) {
+  if (gTraceOptions ()->fTraceRepeats) {
     fLogOutputStream <<
       "Handling repeat ending start" <<
     /* JMI
@@ -20125,7 +20125,7 @@ void mxmlTree2MsrTranslator::handleEndingStart (
     // yes
 
 #ifdef TRACE_OPTIONS
-    if (gTraceOptions->fTraceRepeats) {
+    if (gTraceOptions ()->fTraceRepeats) {
       fLogOutputStream <<
         endl <<
         endl <<
@@ -20156,7 +20156,7 @@ void mxmlTree2MsrTranslator::handleEndingStart (
 
       // create the enclosing repeat and append it to the part
 #ifdef TRACE_OPTIONS
-      if (gTraceOptions->fTraceRepeats) {
+      if (gTraceOptions ()->fTraceRepeats) {
         fLogOutputStream <<
           "Creating a regular repeat in part " <<
           fCurrentPart->getPartCombinedName () <<
@@ -20180,7 +20180,7 @@ void mxmlTree2MsrTranslator::handleEndingStart (
 
     // append an implicit repeat to the current part
 #ifdef TRACE_OPTIONS
-    if (gTraceOptions->fTraceRepeats) {
+    if (gTraceOptions ()->fTraceRepeats) {
       fLogOutputStream <<
         "Prepending an implicit barline ahead of part " <<
         fCurrentPart->getPartCombinedName () <<
@@ -20194,7 +20194,7 @@ void mxmlTree2MsrTranslator::handleEndingStart (
  
     // create the enclosing repeat and append it to the part
 #ifdef TRACE_OPTIONS
-    if (gTraceOptions->fTraceRepeats) {
+    if (gTraceOptions ()->fTraceRepeats) {
       fLogOutputStream <<
         "Creating a repeat enclosing everything from the beginning of part " <<
         fCurrentPart->getPartCombinedName () <<
@@ -20216,7 +20216,7 @@ void mxmlTree2MsrTranslator::handleEndingStart (
 /* JMI
   // create a new last segment to collect the repeat ending contents
 #ifdef TRACE_OPTIONS
-  if (gTraceOptions->fTraceSegments || gTraceOptions->fTraceVoices) {
+  if (gTraceOptions ()->fTraceSegments || gTraceOptions ()->fTraceVoices) {
     fLogOutputStream <<
       "Creating a new last segment for a repeat ending contents for voice \"" <<
       currentVoice->getVoiceName () << "\"" <<
@@ -20249,7 +20249,7 @@ void mxmlTree2MsrTranslator::handleHookedEndingEnd (
     barline->getInputLineNumber ();
 
 #ifdef TRACE_OPTIONS
-  if (gTraceOptions->fTraceRepeats) {
+  if (gTraceOptions ()->fTraceRepeats) {
     fLogOutputStream <<
       "Handling repeat hooked ending end" <<
     /* JMI
@@ -20275,7 +20275,7 @@ void mxmlTree2MsrTranslator::handleHookedEndingEnd (
 
   if (! fOnGoingRepeat) {
     msrMusicXMLError (
-      gXml2lyOptions->fInputSourceName,
+      gXml2lyOptions ()->fInputSourceName,
       inputLineNumber,
       __FILE__, __LINE__,
       "found a repeat hooked ending out of context");
@@ -20297,7 +20297,7 @@ void mxmlTree2MsrTranslator::handleHookedEndingEnd (
 
   // create a hooked repeat ending from the current segment
 #ifdef TRACE_OPTIONS
-  if (gTraceOptions->fTraceRepeats) {
+  if (gTraceOptions ()->fTraceRepeats) {
     fLogOutputStream <<
       "Appending a new hooked repeat ending to part " <<
       fCurrentPart->getPartCombinedName () <<
@@ -20330,7 +20330,7 @@ void mxmlTree2MsrTranslator::handleHooklessEndingEnd (
     barline->getInputLineNumber ();
   
 #ifdef TRACE_OPTIONS
-  if (gTraceOptions->fTraceRepeats) {
+  if (gTraceOptions ()->fTraceRepeats) {
     fLogOutputStream <<
       "Handling repeat hookless ending end" <<
     /* JMI
@@ -20356,7 +20356,7 @@ void mxmlTree2MsrTranslator::handleHooklessEndingEnd (
 
   if (! fOnGoingRepeat) {
     msrMusicXMLError (
-      gXml2lyOptions->fInputSourceName,
+      gXml2lyOptions ()->fInputSourceName,
       inputLineNumber,
       __FILE__, __LINE__,
       "found a repeat hookless ending out of context");
@@ -20378,7 +20378,7 @@ void mxmlTree2MsrTranslator::handleHooklessEndingEnd (
 
   // create a hookless repeat ending from the current segment
 #ifdef TRACE_OPTIONS
-  if (gTraceOptions->fTraceRepeats) {
+  if (gTraceOptions ()->fTraceRepeats) {
     fLogOutputStream <<
       "Appending a new hookless repeat ending to part " <<
       fCurrentPart->getPartCombinedName () <<
@@ -20406,7 +20406,7 @@ void mxmlTree2MsrTranslator::visitStart ( S_rehearsal& elt )
   int inputLineNumber =
     elt->getInputLineNumber ();
 
-  if (gMusicXMLOptions->fTraceMusicXMLTreeVisitors) {
+  if (gMusicXMLOptions ()->fTraceMusicXMLTreeVisitors) {
     fLogOutputStream <<
       "--> Start visiting S_rehearsal" <<
       ", line " << inputLineNumber <<
@@ -20486,7 +20486,7 @@ void mxmlTree2MsrTranslator::visitStart ( S_rehearsal& elt )
         "\"" << " is not handled, ignored";
         
       msrMusicXMLWarning (
-        gXml2lyOptions->fInputSourceName,
+        gXml2lyOptions ()->fInputSourceName,
         inputLineNumber,
         s.str ());
     }    
@@ -20494,7 +20494,7 @@ void mxmlTree2MsrTranslator::visitStart ( S_rehearsal& elt )
 
   // create a rehearsal
 #ifdef TRACE_OPTIONS
-  if (gTraceOptions->fTraceRehearsals) {
+  if (gTraceOptions ()->fTraceRehearsals) {
     fLogOutputStream <<
       "Creating rehearsal \"" << rehearsalValue << "\"" <<
       " in part " <<
@@ -20521,7 +20521,7 @@ void mxmlTree2MsrTranslator::visitStart ( S_harmony& elt )
   int inputLineNumber =
     elt->getInputLineNumber ();
 
-  if (gMusicXMLOptions->fTraceMusicXMLTreeVisitors) {
+  if (gMusicXMLOptions ()->fTraceMusicXMLTreeVisitors) {
     fLogOutputStream <<
       "--> Start visiting S_harmony" <<
       ", line " << inputLineNumber <<
@@ -20547,7 +20547,7 @@ void mxmlTree2MsrTranslator::visitStart ( S_root_step& elt )
   int inputLineNumber =
     elt->getInputLineNumber ();
 
-  if (gMusicXMLOptions->fTraceMusicXMLTreeVisitors) {
+  if (gMusicXMLOptions ()->fTraceMusicXMLTreeVisitors) {
     fLogOutputStream <<
       "--> Start visiting S_root_step" <<
       ", line " << inputLineNumber <<
@@ -20570,7 +20570,7 @@ void mxmlTree2MsrTranslator::visitStart ( S_root_alter& elt )
   int inputLineNumber =
     elt->getInputLineNumber ();
 
-  if (gMusicXMLOptions->fTraceMusicXMLTreeVisitors) {
+  if (gMusicXMLOptions ()->fTraceMusicXMLTreeVisitors) {
     fLogOutputStream <<
       "--> Start visiting S_root_alter" <<
       ", line " << inputLineNumber <<
@@ -20591,7 +20591,7 @@ void mxmlTree2MsrTranslator::visitStart ( S_root_alter& elt )
       "' should be -3, -2, -1.5, -1, -0.5, 0, +0.5, +1, +1.5, +2 or +3";
       
     msrMusicXMLError (
-      gXml2lyOptions->fInputSourceName,
+      gXml2lyOptions ()->fInputSourceName,
       inputLineNumber,
       __FILE__, __LINE__,
       s.str ());
@@ -20603,7 +20603,7 @@ void mxmlTree2MsrTranslator::visitStart ( S_kind& elt )
   int inputLineNumber =
     elt->getInputLineNumber ();
 
-  if (gMusicXMLOptions->fTraceMusicXMLTreeVisitors) {
+  if (gMusicXMLOptions ()->fTraceMusicXMLTreeVisitors) {
     fLogOutputStream <<
       "--> Start visiting S_kind" <<
       ", line " << inputLineNumber <<
@@ -20699,14 +20699,14 @@ void mxmlTree2MsrTranslator::visitStart ( S_kind& elt )
   else {
     if (kind.size ()) {
       msrMusicXMLError (
-        gXml2lyOptions->fInputSourceName,
+        gXml2lyOptions ()->fInputSourceName,
         inputLineNumber,
         __FILE__, __LINE__,
         "harmony kind \"" + kind + "\" os unknown");
     }
     else {
       msrMusicXMLWarning (
-        gXml2lyOptions->fInputSourceName,
+        gXml2lyOptions ()->fInputSourceName,
         inputLineNumber,
         "empty harmony kind, replaced by 'major'");
 
@@ -20733,7 +20733,7 @@ void mxmlTree2MsrTranslator::visitStart ( S_kind& elt )
         "\" is unknown";
       
       msrMusicXMLError (
-        gXml2lyOptions->fInputSourceName,
+        gXml2lyOptions ()->fInputSourceName,
         inputLineNumber,
         __FILE__, __LINE__,
         s.str ());
@@ -20760,7 +20760,7 @@ void mxmlTree2MsrTranslator::visitStart ( S_kind& elt )
         "\" is unknown";
       
       msrMusicXMLError (
-        gXml2lyOptions->fInputSourceName,
+        gXml2lyOptions ()->fInputSourceName,
         inputLineNumber,
         __FILE__, __LINE__,
         s.str ());
@@ -20787,7 +20787,7 @@ void mxmlTree2MsrTranslator::visitStart ( S_kind& elt )
         "\" is unknown";
       
       msrMusicXMLError (
-        gXml2lyOptions->fInputSourceName,
+        gXml2lyOptions ()->fInputSourceName,
         inputLineNumber,
         __FILE__, __LINE__,
         s.str ());
@@ -20814,7 +20814,7 @@ void mxmlTree2MsrTranslator::visitStart ( S_kind& elt )
         "\" is unknown";
       
       msrMusicXMLError (
-        gXml2lyOptions->fInputSourceName,
+        gXml2lyOptions ()->fInputSourceName,
         inputLineNumber,
         __FILE__, __LINE__,
         s.str ());
@@ -20825,7 +20825,7 @@ void mxmlTree2MsrTranslator::visitStart ( S_kind& elt )
 
 void mxmlTree2MsrTranslator::visitStart ( S_inversion& elt )
 {
-  if (gMusicXMLOptions->fTraceMusicXMLTreeVisitors) {
+  if (gMusicXMLOptions ()->fTraceMusicXMLTreeVisitors) {
     fLogOutputStream <<
       "--> Start visiting S_bass_step" <<
       ", line " << elt->getInputLineNumber () <<
@@ -20845,7 +20845,7 @@ void mxmlTree2MsrTranslator::visitStart ( S_bass_step& elt )
   int inputLineNumber =
     elt->getInputLineNumber ();
 
-  if (gMusicXMLOptions->fTraceMusicXMLTreeVisitors) {
+  if (gMusicXMLOptions ()->fTraceMusicXMLTreeVisitors) {
     fLogOutputStream <<
       "--> Start visiting S_bass_step" <<
       ", line " << inputLineNumber <<
@@ -20868,7 +20868,7 @@ void mxmlTree2MsrTranslator::visitStart ( S_bass_alter& elt )
   int inputLineNumber =
     elt->getInputLineNumber ();
 
-  if (gMusicXMLOptions->fTraceMusicXMLTreeVisitors) {
+  if (gMusicXMLOptions ()->fTraceMusicXMLTreeVisitors) {
     fLogOutputStream <<
       "--> Start visiting S_bass_alter" <<
       ", line " << inputLineNumber <<
@@ -20889,7 +20889,7 @@ void mxmlTree2MsrTranslator::visitStart ( S_bass_alter& elt )
       "' should be -3, -2, -1.5, -1, -0.5, 0, +0.5, +1, +1.5, +2 or +3";
       
     msrMusicXMLError (
-      gXml2lyOptions->fInputSourceName,
+      gXml2lyOptions ()->fInputSourceName,
       inputLineNumber,
       __FILE__, __LINE__,
       s.str ());
@@ -20898,7 +20898,7 @@ void mxmlTree2MsrTranslator::visitStart ( S_bass_alter& elt )
 
 void mxmlTree2MsrTranslator::visitStart ( S_degree& elt )
 {
-  if (gMusicXMLOptions->fTraceMusicXMLTreeVisitors) {
+  if (gMusicXMLOptions ()->fTraceMusicXMLTreeVisitors) {
     fLogOutputStream <<
       "--> Start visiting S_degree" <<
       ", line " << elt->getInputLineNumber () <<
@@ -20908,7 +20908,7 @@ void mxmlTree2MsrTranslator::visitStart ( S_degree& elt )
 
 void mxmlTree2MsrTranslator::visitStart ( S_degree_value& elt )
 {
-  if (gMusicXMLOptions->fTraceMusicXMLTreeVisitors) {
+  if (gMusicXMLOptions ()->fTraceMusicXMLTreeVisitors) {
     fLogOutputStream <<
       "--> Start visiting S_degree_value" <<
        ", line " << elt->getInputLineNumber () <<
@@ -20923,7 +20923,7 @@ void mxmlTree2MsrTranslator::visitStart ( S_degree_alter& elt )
   int inputLineNumber =
     elt->getInputLineNumber ();
 
-  if (gMusicXMLOptions->fTraceMusicXMLTreeVisitors) {
+  if (gMusicXMLOptions ()->fTraceMusicXMLTreeVisitors) {
     fLogOutputStream <<
       "--> Start visiting S_degree_alter" <<
       ", line " << inputLineNumber <<
@@ -20944,7 +20944,7 @@ void mxmlTree2MsrTranslator::visitStart ( S_degree_alter& elt )
       "' should be -3, -2, -1.5, -1, -0.5, 0, +0.5, +1, +1.5, +2 or +3";
       
     msrMusicXMLError (
-      gXml2lyOptions->fInputSourceName,
+      gXml2lyOptions ()->fInputSourceName,
       inputLineNumber,
       __FILE__, __LINE__,
       s.str ());
@@ -20956,7 +20956,7 @@ void mxmlTree2MsrTranslator::visitStart ( S_degree_type& elt )
   int inputLineNumber =
     elt->getInputLineNumber ();
 
-  if (gMusicXMLOptions->fTraceMusicXMLTreeVisitors) {
+  if (gMusicXMLOptions ()->fTraceMusicXMLTreeVisitors) {
     fLogOutputStream <<
       "--> Start visiting S_degree_type" <<
       ", line " << inputLineNumber <<
@@ -20980,7 +20980,7 @@ void mxmlTree2MsrTranslator::visitStart ( S_degree_type& elt )
     
   else {
       msrMusicXMLError (
-        gXml2lyOptions->fInputSourceName,
+        gXml2lyOptions ()->fInputSourceName,
         inputLineNumber,
         __FILE__, __LINE__,
         "harmony degree-type \"" + degreeType + "\" is unknown");
@@ -20992,7 +20992,7 @@ void mxmlTree2MsrTranslator::visitEnd ( S_degree& elt )
   int inputLineNumber =
     elt->getInputLineNumber ();
 
-  if (gMusicXMLOptions->fTraceMusicXMLTreeVisitors) {
+  if (gMusicXMLOptions ()->fTraceMusicXMLTreeVisitors) {
     fLogOutputStream <<
       "--> End visiting S_degree" <<
       ", line " << inputLineNumber <<
@@ -21018,7 +21018,7 @@ void mxmlTree2MsrTranslator::visitEnd ( S_harmony& elt )
   int inputLineNumber =
     elt->getInputLineNumber ();
 
-  if (gMusicXMLOptions->fTraceMusicXMLTreeVisitors) {
+  if (gMusicXMLOptions ()->fTraceMusicXMLTreeVisitors) {
     fLogOutputStream <<
       "--> End visiting S_harmony" <<
       ", line " << inputLineNumber <<
@@ -21045,7 +21045,7 @@ void mxmlTree2MsrTranslator::visitEnd ( S_harmony& elt )
       &&
     fCurrentHarmonyDegreesList.size () == 0) {
     msrMusicXMLWarning (
-      gXml2lyOptions->fInputSourceName,
+      gXml2lyOptions ()->fInputSourceName,
       inputLineNumber,
       "harmony kind is 'other' but there are no harmony degrees, this is strange...");
   }
@@ -21059,14 +21059,14 @@ void mxmlTree2MsrTranslator::visitEnd ( S_harmony& elt )
     s <<
       "harmony root and bass notes are both equal to '" <<
       msrDiatonicPitchKindAsString (
-        gMsrOptions->fMsrQuarterTonesPitchesLanguageKind,
+        gMsrOptions ()->fMsrQuarterTonesPitchesLanguageKind,
         diatonicPitchKindFromQuarterTonesPitchKind (
           inputLineNumber,
           fCurrentHarmonyRootQuarterTonesPitchKind)) <<        
       "', ignoring the latter";
 
     msrMusicXMLWarning (
-      gXml2lyOptions->fInputSourceName,
+      gXml2lyOptions ()->fInputSourceName,
       inputLineNumber,
       s.str ());
 
@@ -21076,13 +21076,13 @@ void mxmlTree2MsrTranslator::visitEnd ( S_harmony& elt )
 
   // create the harmony
 #ifdef TRACE_OPTIONS
-  if (gTraceOptions->fTraceHarmonies) {
+  if (gTraceOptions ()->fTraceHarmonies) {
     fLogOutputStream <<
       "Creating a harmony" <<
       ", line " << inputLineNumber << ":" <<
       endl;
 
-    gIndenter++;
+    gIndenter ()++;
 
     const int fieldWidth = 32;
     
@@ -21098,7 +21098,7 @@ void mxmlTree2MsrTranslator::visitEnd ( S_harmony& elt )
       
       setw (fieldWidth) << "fCurrentHarmonyRootDiatonicPitch" << " = " <<
       msrDiatonicPitchKindAsString (
-        gMsrOptions->fMsrQuarterTonesPitchesLanguageKind,
+        gMsrOptions ()->fMsrQuarterTonesPitchesLanguageKind,
         fCurrentHarmonyRootDiatonicPitchKind) <<
       endl <<
       setw (fieldWidth) << "fCurrentHarmonyRootAlteration" << " = " <<
@@ -21120,7 +21120,7 @@ void mxmlTree2MsrTranslator::visitEnd ( S_harmony& elt )
       
       setw (fieldWidth) << "fCurrentHarmonyBassDiatonicPitch" << " = " <<
       msrDiatonicPitchKindAsString (
-        gMsrOptions->fMsrQuarterTonesPitchesLanguageKind,
+        gMsrOptions ()->fMsrQuarterTonesPitchesLanguageKind,
         fCurrentHarmonyBassDiatonicPitchKind) <<
       endl <<
       
@@ -21133,7 +21133,7 @@ void mxmlTree2MsrTranslator::visitEnd ( S_harmony& elt )
       fCurrentNoteSoundingWholeNotes <<
       endl;
         
-    gIndenter--;
+    gIndenter ()--;
   }
 #endif
 
@@ -21184,7 +21184,7 @@ void mxmlTree2MsrTranslator::visitStart ( S_frame& elt )
   int inputLineNumber =
     elt->getInputLineNumber ();
 
-  if (gMusicXMLOptions->fTraceMusicXMLTreeVisitors) {
+  if (gMusicXMLOptions ()->fTraceMusicXMLTreeVisitors) {
     fLogOutputStream <<
       "--> Start visiting S_frame" <<
       ", line " << inputLineNumber <<
@@ -21242,7 +21242,7 @@ void mxmlTree2MsrTranslator::visitStart ( S_frame& elt )
       "' should be -3, -2, -1.5, -1, -0.5, 0, +0.5, +1, +1.5, +2 or +3";
       
     msrMusicXMLError (
-      gXml2lyOptions->fInputSourceName,
+      gXml2lyOptions ()->fInputSourceName,
       inputLineNumber,
       __FILE__, __LINE__,
       s.str ());
@@ -21253,7 +21253,7 @@ void mxmlTree2MsrTranslator::visitStart ( S_frame& elt )
 
 void mxmlTree2MsrTranslator::visitStart ( S_frame_strings& elt )
 {
-  if (gMusicXMLOptions->fTraceMusicXMLTreeVisitors) {
+  if (gMusicXMLOptions ()->fTraceMusicXMLTreeVisitors) {
     fLogOutputStream <<
       "--> Start visiting S_frame_strings" <<
       ", line " << elt->getInputLineNumber () <<
@@ -21265,7 +21265,7 @@ void mxmlTree2MsrTranslator::visitStart ( S_frame_strings& elt )
 
 void mxmlTree2MsrTranslator::visitStart ( S_frame_frets& elt )
 {
-  if (gMusicXMLOptions->fTraceMusicXMLTreeVisitors) {
+  if (gMusicXMLOptions ()->fTraceMusicXMLTreeVisitors) {
     fLogOutputStream <<
       "--> Start visiting S_frame_frets" <<
       ", line " << elt->getInputLineNumber () <<
@@ -21277,7 +21277,7 @@ void mxmlTree2MsrTranslator::visitStart ( S_frame_frets& elt )
 
 void mxmlTree2MsrTranslator::visitStart ( S_first_fret& elt )
 {
-  if (gMusicXMLOptions->fTraceMusicXMLTreeVisitors) {
+  if (gMusicXMLOptions ()->fTraceMusicXMLTreeVisitors) {
     fLogOutputStream <<
       "--> Start visiting S_first_fret" <<
       ", line " << elt->getInputLineNumber () <<
@@ -21297,7 +21297,7 @@ void mxmlTree2MsrTranslator::visitStart ( S_first_fret& elt )
 
 void mxmlTree2MsrTranslator::visitStart ( S_frame_note& elt )
 {
-  if (gMusicXMLOptions->fTraceMusicXMLTreeVisitors) {
+  if (gMusicXMLOptions ()->fTraceMusicXMLTreeVisitors) {
     fLogOutputStream <<
       "--> Start visiting S_frame_note" <<
       ", line " << elt->getInputLineNumber () <<
@@ -21317,14 +21317,14 @@ void mxmlTree2MsrTranslator::visitStart ( S_barre& elt )
   int inputLineNumber =
     elt->getInputLineNumber ();
 
-  if (gMusicXMLOptions->fTraceMusicXMLTreeVisitors) {
+  if (gMusicXMLOptions ()->fTraceMusicXMLTreeVisitors) {
     fLogOutputStream <<
       "--> Start visiting S_barre" <<
       ", line " << inputLineNumber <<
       endl;
   }
  
-  string barreType = elt->getAttributeValue ("type");
+  string barreType = elt->getAttributeValue (attributeNames::type);
     
   fCurrentFrameNoteBarreTypeKind = msrFrameNote::kBarreTypeNone;
   
@@ -21340,7 +21340,7 @@ void mxmlTree2MsrTranslator::visitStart ( S_barre& elt )
       "\" is unknown";
     
     msrMusicXMLError (
-      gXml2lyOptions->fInputSourceName,
+      gXml2lyOptions ()->fInputSourceName,
       inputLineNumber,
       __FILE__, __LINE__,
       s.str ());
@@ -21352,7 +21352,7 @@ void mxmlTree2MsrTranslator::visitEnd ( S_frame_note& elt )
   int inputLineNumber =
     elt->getInputLineNumber ();
 
-  if (gMusicXMLOptions->fTraceMusicXMLTreeVisitors) {
+  if (gMusicXMLOptions ()->fTraceMusicXMLTreeVisitors) {
     fLogOutputStream <<
       "--> Start visiting S_frame_note" <<
       ", line " << inputLineNumber <<
@@ -21380,7 +21380,7 @@ void mxmlTree2MsrTranslator::visitEnd ( S_frame& elt )
   int inputLineNumber =
     elt->getInputLineNumber ();
 
-  if (gMusicXMLOptions->fTraceMusicXMLTreeVisitors) {
+  if (gMusicXMLOptions ()->fTraceMusicXMLTreeVisitors) {
     fLogOutputStream <<
       "--> End visiting S_frame" <<
       ", line " << inputLineNumber <<
@@ -21425,7 +21425,7 @@ void mxmlTree2MsrTranslator::visitStart ( S_figured_bass& elt )
   int inputLineNumber =
     elt->getInputLineNumber ();
 
-  if (gMusicXMLOptions->fTraceMusicXMLTreeVisitors) {
+  if (gMusicXMLOptions ()->fTraceMusicXMLTreeVisitors) {
     fLogOutputStream <<
       "--> Start visiting S_figured_bass" <<
       ", line " << inputLineNumber <<
@@ -21454,7 +21454,7 @@ void mxmlTree2MsrTranslator::visitStart ( S_figured_bass& elt )
         " should be 'yes' or 'no'";
       
       msrMusicXMLError (
-        gXml2lyOptions->fInputSourceName,
+        gXml2lyOptions ()->fInputSourceName,
         inputLineNumber,
         __FILE__, __LINE__,
         s.str ());
@@ -21476,7 +21476,7 @@ void mxmlTree2MsrTranslator::visitStart ( S_figured_bass& elt )
 
 void mxmlTree2MsrTranslator::visitStart ( S_figure& elt )
 {
-  if (gMusicXMLOptions->fTraceMusicXMLTreeVisitors) {
+  if (gMusicXMLOptions ()->fTraceMusicXMLTreeVisitors) {
     fLogOutputStream <<
       "--> Start visiting S_figure" <<
       ", line " << elt->getInputLineNumber () <<
@@ -21489,7 +21489,7 @@ void mxmlTree2MsrTranslator::visitStart ( S_prefix& elt )
   int inputLineNumber =
     elt->getInputLineNumber ();
 
-  if (gMusicXMLOptions->fTraceMusicXMLTreeVisitors) {
+  if (gMusicXMLOptions ()->fTraceMusicXMLTreeVisitors) {
     fLogOutputStream <<
       "--> Start visiting S_prefix" <<
       ", line " << inputLineNumber <<
@@ -21530,7 +21530,7 @@ void mxmlTree2MsrTranslator::visitStart ( S_prefix& elt )
       "\" is unknown";
     
     msrMusicXMLError (
-      gXml2lyOptions->fInputSourceName,
+      gXml2lyOptions ()->fInputSourceName,
       inputLineNumber,
       __FILE__, __LINE__,
       s.str ());    
@@ -21543,7 +21543,7 @@ void mxmlTree2MsrTranslator::visitStart ( S_figure_number& elt )
   int inputLineNumber =
     elt->getInputLineNumber ();
 
-  if (gMusicXMLOptions->fTraceMusicXMLTreeVisitors) {
+  if (gMusicXMLOptions ()->fTraceMusicXMLTreeVisitors) {
     fLogOutputStream <<
       "--> Start visiting S_figure_number" <<
       ", line " << inputLineNumber <<
@@ -21560,7 +21560,7 @@ void mxmlTree2MsrTranslator::visitStart ( S_figure_number& elt )
       "' is greater that 13, that's strange...";
 
     msrMusicXMLWarning (
-      gXml2lyOptions->fInputSourceName,
+      gXml2lyOptions ()->fInputSourceName,
       inputLineNumber,
       s.str ());
   }
@@ -21571,7 +21571,7 @@ void mxmlTree2MsrTranslator::visitStart ( S_suffix& elt )
   int inputLineNumber =
     elt->getInputLineNumber ();
 
-  if (gMusicXMLOptions->fTraceMusicXMLTreeVisitors) {
+  if (gMusicXMLOptions ()->fTraceMusicXMLTreeVisitors) {
     fLogOutputStream <<
       "--> Start visiting S_suffix" <<
       ", line " << inputLineNumber <<
@@ -21615,7 +21615,7 @@ void mxmlTree2MsrTranslator::visitStart ( S_suffix& elt )
       "\" is unknown";
     
     msrMusicXMLError (
-      gXml2lyOptions->fInputSourceName,
+      gXml2lyOptions ()->fInputSourceName,
       inputLineNumber,
       __FILE__, __LINE__,
       s.str ());    
@@ -21627,7 +21627,7 @@ void mxmlTree2MsrTranslator::visitEnd ( S_figure& elt )
   int inputLineNumber =
     elt->getInputLineNumber ();
 
-  if (gMusicXMLOptions->fTraceMusicXMLTreeVisitors) {
+  if (gMusicXMLOptions ()->fTraceMusicXMLTreeVisitors) {
     fLogOutputStream <<
       "--> End visiting S_figure" <<
       ", line " << inputLineNumber <<
@@ -21654,7 +21654,7 @@ void mxmlTree2MsrTranslator::visitEnd ( S_figured_bass& elt )
   int inputLineNumber =
     elt->getInputLineNumber ();
 
-  if (gMusicXMLOptions->fTraceMusicXMLTreeVisitors) {
+  if (gMusicXMLOptions ()->fTraceMusicXMLTreeVisitors) {
     fLogOutputStream <<
       "--> End visiting S_figured_bass" <<
       ", line " << inputLineNumber <<
@@ -21663,7 +21663,7 @@ void mxmlTree2MsrTranslator::visitEnd ( S_figured_bass& elt )
 
   if (! fPendingFiguredBassFigures.size ()) {
     msrMusicXMLWarning (
-      gXml2lyOptions->fInputSourceName,
+      gXml2lyOptions ()->fInputSourceName,
       inputLineNumber,
       "figured-bass has no figures contents");
   }
@@ -21677,7 +21677,7 @@ void mxmlTree2MsrTranslator::visitStart (S_harp_pedals& elt )
   int inputLineNumber =
     elt->getInputLineNumber ();
 
-  if (gMusicXMLOptions->fTraceMusicXMLTreeVisitors) {
+  if (gMusicXMLOptions ()->fTraceMusicXMLTreeVisitors) {
     fLogOutputStream <<
       "--> Start visiting S_harp_pedals" <<
       ", line " << inputLineNumber <<
@@ -21748,7 +21748,7 @@ void mxmlTree2MsrTranslator::visitStart (S_harp_pedals& elt )
 
   // create the harp pedals tuning
 #ifdef TRACE_OPTIONS
-  if (gTraceOptions->fTraceHarpPedalsTuning) {
+  if (gTraceOptions ()->fTraceHarpPedalsTuning) {
     fLogOutputStream <<
       "Creating harp pedals tuning:" <<
       endl;
@@ -21768,7 +21768,7 @@ void mxmlTree2MsrTranslator::visitStart (S_harp_pedals& elt )
 
 void mxmlTree2MsrTranslator::visitStart (S_pedal_tuning& elt )
 {
-  if (gMusicXMLOptions->fTraceMusicXMLTreeVisitors) {
+  if (gMusicXMLOptions ()->fTraceMusicXMLTreeVisitors) {
     fLogOutputStream <<
       "--> Start visiting S_pedal_tuning" <<
       ", line " << elt->getInputLineNumber () <<
@@ -21781,7 +21781,7 @@ void mxmlTree2MsrTranslator::visitStart (S_pedal_step& elt )
   int inputLineNumber =
     elt->getInputLineNumber ();
 
-  if (gMusicXMLOptions->fTraceMusicXMLTreeVisitors) {
+  if (gMusicXMLOptions ()->fTraceMusicXMLTreeVisitors) {
     fLogOutputStream <<
       "--> Start visiting S_pedal_step" <<
       ", line " << inputLineNumber <<
@@ -21804,7 +21804,7 @@ void mxmlTree2MsrTranslator::visitStart (S_pedal_alter& elt )
   int inputLineNumber =
     elt->getInputLineNumber ();
 
-  if (gMusicXMLOptions->fTraceMusicXMLTreeVisitors) {
+  if (gMusicXMLOptions ()->fTraceMusicXMLTreeVisitors) {
     fLogOutputStream <<
       "--> Start visiting S_pedal_alter" <<
       ", line " << inputLineNumber <<
@@ -21825,7 +21825,7 @@ void mxmlTree2MsrTranslator::visitStart (S_pedal_alter& elt )
       "' should be -3, -2, -1.5, -1, -0.5, 0, +0.5, +1, +1.5, +2 or +3";
       
     msrMusicXMLError (
-      gXml2lyOptions->fInputSourceName,
+      gXml2lyOptions ()->fInputSourceName,
       inputLineNumber,
       __FILE__, __LINE__,
       s.str ());
@@ -21837,7 +21837,7 @@ void mxmlTree2MsrTranslator::visitEnd (S_pedal_tuning& elt )
   int inputLineNumber =
     elt->getInputLineNumber ();
 
-  if (gMusicXMLOptions->fTraceMusicXMLTreeVisitors) {
+  if (gMusicXMLOptions ()->fTraceMusicXMLTreeVisitors) {
     fLogOutputStream <<
       "--> End visiting S_pedal_tuning" <<
       ", line " << inputLineNumber <<
@@ -21846,12 +21846,12 @@ void mxmlTree2MsrTranslator::visitEnd (S_pedal_tuning& elt )
 
   // create a harp pedals tuning
 #ifdef TRACE_OPTIONS
-  if (gTraceOptions->fTraceStaffTuning) {
+  if (gTraceOptions ()->fTraceStaffTuning) {
     fLogOutputStream <<
       "Creating harp pedal tuning:" <<
       endl;
 
-    gIndenter++;
+    gIndenter ()++;
 
     const int fieldWidth = 31;
 
@@ -21859,7 +21859,7 @@ void mxmlTree2MsrTranslator::visitEnd (S_pedal_tuning& elt )
       setw (fieldWidth) <<
       "fCurrentHarpPedalDiatonicPitch" << " = " <<
       msrDiatonicPitchKindAsString (
-        gMsrOptions->fMsrQuarterTonesPitchesLanguageKind,
+        gMsrOptions ()->fMsrQuarterTonesPitchesLanguageKind,
         fCurrentHarpPedalDiatonicPitchKind) <<
       endl <<
       setw (fieldWidth) <<
@@ -21868,7 +21868,7 @@ void mxmlTree2MsrTranslator::visitEnd (S_pedal_tuning& elt )
         fCurrentHarpPedalAlterationKind) <<
       endl;
 
-    gIndenter--;
+    gIndenter ()--;
   }
 #endif
     
@@ -21884,7 +21884,7 @@ void mxmlTree2MsrTranslator::visitStart( S_damp& elt)
   int inputLineNumber =
     elt->getInputLineNumber ();
 
-  if (gMusicXMLOptions->fTraceMusicXMLTreeVisitors) {
+  if (gMusicXMLOptions ()->fTraceMusicXMLTreeVisitors) {
     fLogOutputStream <<
       "--> Start visiting S_damp" <<
       ", line " << inputLineNumber <<
@@ -21916,7 +21916,7 @@ void mxmlTree2MsrTranslator::visitStart( S_damp_all& elt)
   int inputLineNumber =
     elt->getInputLineNumber ();
 
-  if (gMusicXMLOptions->fTraceMusicXMLTreeVisitors) {
+  if (gMusicXMLOptions ()->fTraceMusicXMLTreeVisitors) {
     fLogOutputStream <<
       "--> Start visiting S_damp_all" <<
       ", line " << inputLineNumber <<
@@ -21946,7 +21946,7 @@ void mxmlTree2MsrTranslator::visitStart( S_damp_all& elt)
 //________________________________________________________________________
 void mxmlTree2MsrTranslator::visitStart (S_capo& elt )
 {
-  if (gMusicXMLOptions->fTraceMusicXMLTreeVisitors) {
+  if (gMusicXMLOptions ()->fTraceMusicXMLTreeVisitors) {
     fLogOutputStream <<
       "--> Start visiting S_capo" <<
       ", line " << elt->getInputLineNumber () <<
@@ -21958,7 +21958,7 @@ void mxmlTree2MsrTranslator::visitStart (S_capo& elt )
 
 void mxmlTree2MsrTranslator::visitStart (S_staff_size& elt )
 {
-  if (gMusicXMLOptions->fTraceMusicXMLTreeVisitors) {
+  if (gMusicXMLOptions ()->fTraceMusicXMLTreeVisitors) {
     fLogOutputStream <<
       "--> Start visiting S_staff_size" <<
       ", line " << elt->getInputLineNumber () <<
@@ -21974,7 +21974,7 @@ void mxmlTree2MsrTranslator::visitEnd (S_staff_details& elt )
   int inputLineNumber =
     elt->getInputLineNumber ();
 
-  if (gMusicXMLOptions->fTraceMusicXMLTreeVisitors) {
+  if (gMusicXMLOptions ()->fTraceMusicXMLTreeVisitors) {
     fLogOutputStream <<
       "--> End visiting S_staff_details" <<
       ", line " << inputLineNumber <<
@@ -21982,7 +21982,7 @@ void mxmlTree2MsrTranslator::visitEnd (S_staff_details& elt )
   }
 
 #ifdef TRACE_OPTIONS
-  if (gTraceOptions->fTraceStaves) {
+  if (gTraceOptions ()->fTraceStaves) {
     const int fieldWidth = 29;
 
     fLogOutputStream << left <<
@@ -22005,7 +22005,7 @@ void mxmlTree2MsrTranslator::visitEnd (S_staff_details& elt )
   }
 #endif
 
-  gIndenter--;
+  gIndenter ()--;
 
   // set staff details line number
   fCurrentStaffDetails->
@@ -22040,7 +22040,7 @@ void mxmlTree2MsrTranslator::visitStart (S_scordatura& elt )
   int inputLineNumber =
     elt->getInputLineNumber ();
 
-  if (gMusicXMLOptions->fTraceMusicXMLTreeVisitors) {
+  if (gMusicXMLOptions ()->fTraceMusicXMLTreeVisitors) {
     fLogOutputStream <<
       "--> Start visiting S_scordatura" <<
       ", line " << inputLineNumber <<
@@ -22075,7 +22075,7 @@ void mxmlTree2MsrTranslator::visitStart (S_scordatura& elt )
 
 void mxmlTree2MsrTranslator::visitStart (S_accord& elt )
 {
-  if (gMusicXMLOptions->fTraceMusicXMLTreeVisitors) {
+  if (gMusicXMLOptions ()->fTraceMusicXMLTreeVisitors) {
     fLogOutputStream <<
       "--> Start visiting S_accord" <<
       ", line " << elt->getInputLineNumber () <<
@@ -22103,7 +22103,7 @@ void mxmlTree2MsrTranslator::visitEnd (S_accord& elt)
   int inputLineNumber =
     elt->getInputLineNumber ();
 
-  if (gMusicXMLOptions->fTraceMusicXMLTreeVisitors) {
+  if (gMusicXMLOptions ()->fTraceMusicXMLTreeVisitors) {
     fLogOutputStream <<
       "--> End visiting S_accord" <<
       ", line " << inputLineNumber <<
@@ -22126,7 +22126,7 @@ void mxmlTree2MsrTranslator::visitEnd (S_accord& elt)
 
 void mxmlTree2MsrTranslator::visitEnd (S_scordatura& elt)
 {
-  if (gMusicXMLOptions->fTraceMusicXMLTreeVisitors) {
+  if (gMusicXMLOptions ()->fTraceMusicXMLTreeVisitors) {
     fLogOutputStream <<
       "--> End visiting S_scordatura" <<
       ", line " << elt->getInputLineNumber () <<
@@ -22143,7 +22143,7 @@ void mxmlTree2MsrTranslator::visitEnd (S_scordatura& elt)
 //______________________________________________________________________________
 void mxmlTree2MsrTranslator::visitStart ( S_sound& elt )
 {
-  if (gMusicXMLOptions->fTraceMusicXMLTreeVisitors) {
+  if (gMusicXMLOptions ()->fTraceMusicXMLTreeVisitors) {
     fLogOutputStream <<
       "--> Start visiting S_sound" <<
       ", line " << elt->getInputLineNumber () <<
@@ -22153,7 +22153,7 @@ void mxmlTree2MsrTranslator::visitStart ( S_sound& elt )
 
 void mxmlTree2MsrTranslator::visitEnd ( S_sound& elt )
 {
-  if (gMusicXMLOptions->fTraceMusicXMLTreeVisitors) {
+  if (gMusicXMLOptions ()->fTraceMusicXMLTreeVisitors) {
     fLogOutputStream <<
       "--> End visiting S_sound" <<
       ", line " << elt->getInputLineNumber () <<
@@ -22164,7 +22164,7 @@ void mxmlTree2MsrTranslator::visitEnd ( S_sound& elt )
 //______________________________________________________________________________
 void mxmlTree2MsrTranslator::visitStart ( S_instrument_sound& elt )
 {
-  if (gMusicXMLOptions->fTraceMusicXMLTreeVisitors) {
+  if (gMusicXMLOptions ()->fTraceMusicXMLTreeVisitors) {
     fLogOutputStream <<
       "--> Start visiting S_instrument_sound" <<
       ", line " << elt->getInputLineNumber () <<
@@ -22175,7 +22175,7 @@ void mxmlTree2MsrTranslator::visitStart ( S_instrument_sound& elt )
 //______________________________________________________________________________
 void mxmlTree2MsrTranslator::visitStart ( S_virtual_instrument& elt )
 {
-  if (gMusicXMLOptions->fTraceMusicXMLTreeVisitors) {
+  if (gMusicXMLOptions ()->fTraceMusicXMLTreeVisitors) {
     fLogOutputStream <<
       "--> Start visiting S_virtual_instrument" <<
       ", line " << elt->getInputLineNumber () <<
@@ -22186,7 +22186,7 @@ void mxmlTree2MsrTranslator::visitStart ( S_virtual_instrument& elt )
 //______________________________________________________________________________
 void mxmlTree2MsrTranslator::visitStart ( S_midi_device& elt )
 {
-  if (gMusicXMLOptions->fTraceMusicXMLTreeVisitors) {
+  if (gMusicXMLOptions ()->fTraceMusicXMLTreeVisitors) {
     fLogOutputStream <<
       "--> Start visiting S_midi_device" <<
       ", line " << elt->getInputLineNumber () <<
@@ -22201,7 +22201,7 @@ void mxmlTree2MsrTranslator::visitStart ( S_midi_device& elt )
 //______________________________________________________________________________
 void mxmlTree2MsrTranslator::visitStart ( S_midi_instrument& elt )
 {
-  if (gMusicXMLOptions->fTraceMusicXMLTreeVisitors) {
+  if (gMusicXMLOptions ()->fTraceMusicXMLTreeVisitors) {
     fLogOutputStream <<
       "--> Start visiting S_midi_instrument" <<
       ", line " << elt->getInputLineNumber () <<
@@ -177,14 +177,14 @@ void optionsElement::printHeader (ostream& os) const
     endl;
 
   // indent a bit more for readability
-  gIndenter.increment (K_OPTIONS_ELEMENTS_INDENTER_OFFSET);
+  gIndenter ().increment (K_OPTIONS_ELEMENTS_INDENTER_OFFSET);
   
   os <<
-    gIndenter.indentMultiLineString (
+    gIndenter ().indentMultiLineString (
       fOptionsElementDescription) <<
     endl;
 
-  gIndenter.decrement (K_OPTIONS_ELEMENTS_INDENTER_OFFSET);
+  gIndenter ().decrement (K_OPTIONS_ELEMENTS_INDENTER_OFFSET);
 }
 
 void optionsElement::printElementEssentials (
@@ -228,14 +228,14 @@ void optionsElement::printHelp (ostream& os) const
     endl;
 
   // indent a bit more for readability
-  gIndenter.increment (K_OPTIONS_ELEMENTS_INDENTER_OFFSET);
+  gIndenter ().increment (K_OPTIONS_ELEMENTS_INDENTER_OFFSET);
   
   os <<
-    gIndenter.indentMultiLineString (
+    gIndenter ().indentMultiLineString (
       fOptionsElementDescription) <<
     endl;
 
-  gIndenter.decrement (K_OPTIONS_ELEMENTS_INDENTER_OFFSET);
+  gIndenter ().decrement (K_OPTIONS_ELEMENTS_INDENTER_OFFSET);
 }
 
 ostream& operator<< (ostream& os, const S_optionsElement& elt)
@@ -301,12 +301,12 @@ void optionsItem::print (ostream& os) const
     "OptionsItem ???:" <<
       endl;
 
-  gIndenter++;
+  gIndenter ()++;
 
   optionsElement::printElementEssentials (
     os, fieldWidth);
 
-  gIndenter--;
+  gIndenter ()--;
 }
 
 void optionsItem::printOptionsValues (
@@ -360,19 +360,19 @@ void optionsHelpUsageItem::print (ostream& os) const
     "OptionsHelpUsageItem:" <<
     endl;
 
-  gIndenter++;
+  gIndenter ()++;
 
   optionsElement::printElementEssentials (
     os, fieldWidth);
 
-  gIndenter++;
+  gIndenter ()++;
   os <<
-    gIndenter.indentMultiLineString (
+    gIndenter ().indentMultiLineString (
       fOptionsElementDescription) <<
     endl;
-  gIndenter--;
+  gIndenter ()--;
 
-  gIndenter--;
+  gIndenter ()--;
 }
 
 void optionsHelpUsageItem::printHelpUsage (ostream& os) const
@@ -385,10 +385,10 @@ void optionsHelpUsageItem::printHelpUsage (ostream& os) const
     endl <<
     endl;
 
-  gIndenter++;
+  gIndenter ()++;
   
   os <<
-    gIndenter.indentMultiLineString (
+    gIndenter ().indentMultiLineString (
 R"(As an argument, '-' represents standard input.
 
 A number of options exist to fine tune the generated LilyPond code
@@ -410,7 +410,7 @@ provided item values immediately follow the corresponding items.)") <<
     endl <<
     endl;
 
-  gIndenter--;
+  gIndenter ()--;
 }
 
 void optionsHelpUsageItem::printOptionsValues (
@@ -462,19 +462,19 @@ void optionsHelpSummaryItem::print (ostream& os) const
     "OptionsHelpSummaryItem:" <<
     endl;
 
-  gIndenter++;
+  gIndenter ()++;
 
   optionsElement::printElementEssentials (
     os, fieldWidth);
 
-  gIndenter++;
+  gIndenter ()++;
   os <<
-    gIndenter.indentMultiLineString (
+    gIndenter ().indentMultiLineString (
       fOptionsElementDescription) <<
     endl;
-  gIndenter--;
+  gIndenter ()--;
 
-  gIndenter--;
+  gIndenter ()--;
 }
 
 void optionsHelpSummaryItem::printHelpSummary (ostream& os) const
@@ -649,7 +649,7 @@ void optionsCombinedItemsItem::print (ostream& os) const
     "OptionsCombinedItemsItem:" <<
     endl;
 
-  gIndenter++;
+  gIndenter ()++;
 
   printElementEssentials (
     os, fieldWidth);
@@ -667,7 +667,7 @@ void optionsCombinedItemsItem::print (ostream& os) const
     os <<
       endl;
 
-    gIndenter++;
+    gIndenter ()++;
 
     os <<
         "'";
@@ -686,10 +686,10 @@ void optionsCombinedItemsItem::print (ostream& os) const
     os <<
       "'";
 
-    gIndenter--;
+    gIndenter ()--;
   }
 
-  gIndenter--;
+  gIndenter ()--;
   
   os <<
     endl;
@@ -703,10 +703,10 @@ void optionsCombinedItemsItem::printHelp (ostream& os) const
     endl;
 
   // indent a bit more for readability
-  gIndenter.increment (K_OPTIONS_ELEMENTS_INDENTER_OFFSET);
+  gIndenter ().increment (K_OPTIONS_ELEMENTS_INDENTER_OFFSET);
   
   os <<
-    gIndenter.indentMultiLineString (
+    gIndenter ().indentMultiLineString (
       fOptionsElementDescription) <<
     endl;
 
@@ -723,7 +723,7 @@ void optionsCombinedItemsItem::printHelp (ostream& os) const
     os <<
       endl;
 
-    gIndenter++;
+    gIndenter ()++;
           
     list<S_optionsItem>::const_iterator
       iBegin = fOptionsCombinedItemsList.begin (),
@@ -740,10 +740,10 @@ void optionsCombinedItemsItem::printHelp (ostream& os) const
     os <<
       endl;
   
-    gIndenter--;
+    gIndenter ()--;
   }
 
-  gIndenter.decrement (K_OPTIONS_ELEMENTS_INDENTER_OFFSET);
+  gIndenter ().decrement (K_OPTIONS_ELEMENTS_INDENTER_OFFSET);
     
   os <<
     endl;
@@ -762,9 +762,9 @@ void optionsCombinedItemsItem::printOptionsValues (
     endl;
 
   int fieldWidth =
-    valueFieldWidth - gIndenter.getIndent () + 1;
+    valueFieldWidth - gIndenter ().getIndent () + 1;
     
-  gIndenter++; // only now
+  gIndenter ()++; // only now
 
   if (! fOptionsCombinedItemsList.size ()) {
     os <<
@@ -800,7 +800,7 @@ void optionsCombinedItemsItem::printOptionsValues (
     } // for
   }
 
-  gIndenter--;
+  gIndenter ()--;
 
 }
 
@@ -856,17 +856,17 @@ void optionsBooleanItem::print (ostream& os) const
     "OptionsBooleanItem:" <<
     endl;
 
-  gIndenter++;
+  gIndenter ()++;
 
   optionsElement::printElementEssentials (
     os, fieldWidth);
 
-  gIndenter++;
+  gIndenter ()++;
   os <<
-    gIndenter.indentMultiLineString (
+    gIndenter ().indentMultiLineString (
       fOptionsElementDescription) <<
     endl;
-  gIndenter--;
+  gIndenter ()--;
 
   os << left <<
     setw (fieldWidth) <<
@@ -879,7 +879,7 @@ void optionsBooleanItem::print (ostream& os) const
       fOptionsBooleanItemVariable) <<
     endl;
 
-  gIndenter--;
+  gIndenter ()--;
 }
 
 void optionsBooleanItem::printOptionsValues (
@@ -952,17 +952,17 @@ void optionsTwoBooleansItem::print (ostream& os) const
     "OptionsTwoBooleansItem:" <<
     endl;
 
-  gIndenter++;
+  gIndenter ()++;
 
   optionsElement::printElementEssentials (
     os, fieldWidth);
 
-  gIndenter++;
+  gIndenter ()++;
   os <<
-    gIndenter.indentMultiLineString (
+    gIndenter ().indentMultiLineString (
       fOptionsElementDescription) <<
     endl;
-  gIndenter--;
+  gIndenter ()--;
 
   os << left <<
     setw (fieldWidth) <<
@@ -975,7 +975,7 @@ void optionsTwoBooleansItem::print (ostream& os) const
       fOptionsTwoBooleansItemVariable) <<
     endl;
 
-  gIndenter--;
+  gIndenter ()--;
 }
 
 void optionsTwoBooleansItem::printOptionsValues (
@@ -1053,17 +1053,17 @@ void optionsThreeBooleansItem::print (ostream& os) const
     "OptionsThreeBooleansItem:" <<
     endl;
 
-  gIndenter++;
+  gIndenter ()++;
 
   optionsElement::printElementEssentials (
     os, fieldWidth);
 
-  gIndenter++;
+  gIndenter ()++;
   os <<
-    gIndenter.indentMultiLineString (
+    gIndenter ().indentMultiLineString (
       fOptionsElementDescription) <<
     endl;
-  gIndenter--;
+  gIndenter ()--;
 
   os << left <<
     setw (fieldWidth) <<
@@ -1076,7 +1076,7 @@ void optionsThreeBooleansItem::print (ostream& os) const
       fOptionsThreeBooleansItemVariable) <<
     endl;
 
-  gIndenter--;
+  gIndenter ()--;
 }
 
 void optionsThreeBooleansItem::printOptionsValues (
@@ -1180,12 +1180,12 @@ void optionsValuedItem::print (ostream& os) const
     "OptionsValuedItem ???:" <<
     endl;
 
-  gIndenter++;
+  gIndenter ()++;
 
   printValuedItemEssentials (
     os, fieldWidth);
 
-  gIndenter--;
+  gIndenter ()--;
 }
 
 void optionsValuedItem::printHelp (ostream& os) const
@@ -1198,14 +1198,14 @@ void optionsValuedItem::printHelp (ostream& os) const
     endl;
 
   // indent a bit more for readability
-  gIndenter.increment (K_OPTIONS_ELEMENTS_INDENTER_OFFSET);
+  gIndenter ().increment (K_OPTIONS_ELEMENTS_INDENTER_OFFSET);
   
   os <<
-    gIndenter.indentMultiLineString (
+    gIndenter ().indentMultiLineString (
       fOptionsElementDescription) <<
     endl;
 
-  gIndenter.decrement (K_OPTIONS_ELEMENTS_INDENTER_OFFSET);
+  gIndenter ().decrement (K_OPTIONS_ELEMENTS_INDENTER_OFFSET);
 }
 
 void optionsValuedItem::printOptionsValues (
@@ -1263,12 +1263,12 @@ void optionsItemHelpItem::print (ostream& os) const
     "OptionsItemHelpItem:" <<
     endl;
 
-  gIndenter++;
+  gIndenter ()++;
 
   optionsItemHelpItem::printValuedItemEssentials (
     os, fieldWidth);
 
-  gIndenter--;
+  gIndenter ()--;
 }
 
 void optionsItemHelpItem::printOptionsValues (
@@ -1334,7 +1334,7 @@ void optionsIntegerItem::print (ostream& os) const
     "OptionsIntegerItem:" <<
     endl;
 
-  gIndenter++;
+  gIndenter ()++;
 
   printValuedItemEssentials (
     os, fieldWidth);
@@ -1349,7 +1349,7 @@ void optionsIntegerItem::print (ostream& os) const
     fOptionsIntegerItemVariable <<
     endl;
 
-  gIndenter--;
+  gIndenter ()--;
 }
 
 void optionsIntegerItem::printOptionsValues (
@@ -1420,7 +1420,7 @@ void optionsFloatItem::print (ostream& os) const
     "OptionsFloatItem:" <<
     endl;
 
-  gIndenter++;
+  gIndenter ()++;
 
   printValuedItemEssentials (
     os, fieldWidth);
@@ -1435,7 +1435,7 @@ void optionsFloatItem::print (ostream& os) const
     fOptionsFloatItemVariable <<
     endl;
 
-  gIndenter--;
+  gIndenter ()--;
 }
 
 void optionsFloatItem::printOptionsValues (
@@ -1506,7 +1506,7 @@ void optionsStringItem::print (ostream& os) const
     "OptionsStringItem:" <<
     endl;
 
-  gIndenter++;
+  gIndenter ()++;
 
   printValuedItemEssentials (
     os, fieldWidth);
@@ -1521,7 +1521,7 @@ void optionsStringItem::print (ostream& os) const
     fOptionsStringItemVariable <<
     endl;
 
-  gIndenter--;
+  gIndenter ()--;
 }
 
 void optionsStringItem::printOptionsValues (
@@ -1596,7 +1596,7 @@ void optionsRationalItem::print (ostream& os) const
     "OptionsRationalItem:" <<
     endl;
 
-  gIndenter++;
+  gIndenter ()++;
 
   printValuedItemEssentials (
     os, fieldWidth);
@@ -1611,7 +1611,7 @@ void optionsRationalItem::print (ostream& os) const
     fOptionsRationalItemVariable <<
     endl;
 
-  gIndenter--;
+  gIndenter ()--;
 }
 
 void optionsRationalItem::printOptionsValues (
@@ -1682,7 +1682,7 @@ void optionsNumbersSetItem::print (ostream& os) const
     "OptionsNumbersSetItem:" <<
     endl;
 
-  gIndenter++;
+  gIndenter ()++;
 
   printValuedItemEssentials (
     os, fieldWidth);
@@ -1722,7 +1722,7 @@ void optionsNumbersSetItem::print (ostream& os) const
   os <<
     endl;
 
-  gIndenter--;
+  gIndenter ()--;
 }
 
 void optionsNumbersSetItem::printOptionsValues (
@@ -1911,7 +1911,7 @@ void optionsSubGroup::print (ostream& os) const
    "OptionsSubGroup:" <<
     endl;
 
-  gIndenter++;
+  gIndenter ()++;
 
   optionsElement::printElementEssentials (
     os, fieldWidth);
@@ -1934,7 +1934,7 @@ void optionsSubGroup::print (ostream& os) const
   if (fOptionsSubGroupItemsList.size ()) {
     os << endl;
     
-    gIndenter++;
+    gIndenter ()++;
     
     list<S_optionsItem>::const_iterator
       iBegin = fOptionsSubGroupItemsList.begin (),
@@ -1947,10 +1947,10 @@ void optionsSubGroup::print (ostream& os) const
       os << endl;
     } // for
 
-    gIndenter--;
+    gIndenter ()--;
   }
 
-  gIndenter--;
+  gIndenter ()--;
 }
 
 void optionsSubGroup::printHelp (ostream& os) const
@@ -1982,12 +1982,12 @@ void optionsSubGroup::printHelp (ostream& os) const
 
   // print the description if any
   if (fOptionsElementDescription.size ()) {
-    gIndenter++;
+    gIndenter ()++;
     os <<
-      gIndenter.indentMultiLineString (
+      gIndenter ().indentMultiLineString (
         fOptionsElementDescription) <<
       endl;
-    gIndenter--;
+    gIndenter ()--;
 
     os <<
       endl;  
@@ -1996,7 +1996,7 @@ void optionsSubGroup::printHelp (ostream& os) const
   switch (fOptionsSubGroupDescriptionVisibilityKind) {
     case kAlwaysShowDescription:
       if (fOptionsSubGroupItemsList.size ()) {    
-        gIndenter++;
+        gIndenter ()++;
     
         list<S_optionsItem>::const_iterator
           iBegin = fOptionsSubGroupItemsList.begin (),
@@ -2021,7 +2021,7 @@ void optionsSubGroup::printHelp (ostream& os) const
           }
         } // for
           
-        gIndenter--;
+        gIndenter ()--;
       }
       break;
       
@@ -2058,19 +2058,19 @@ void optionsSubGroup::printOptionsSubGroupForcedHelp (ostream& os) const
 
   // print the description if any
   if (fOptionsElementDescription.size ()) {
-    gIndenter++;
+    gIndenter ()++;
     os <<
-      gIndenter.indentMultiLineString (
+      gIndenter ().indentMultiLineString (
         fOptionsElementDescription) <<
       endl;
-    gIndenter--;
+    gIndenter ()--;
 
     os <<
       endl;  
   }
       
   if (fOptionsSubGroupItemsList.size ()) {    
-    gIndenter++;
+    gIndenter ()++;
 
     list<S_optionsItem>::const_iterator
       iBegin = fOptionsSubGroupItemsList.begin (),
@@ -2083,7 +2083,7 @@ void optionsSubGroup::printOptionsSubGroupForcedHelp (ostream& os) const
       os << endl;
     } // for
 
-    gIndenter--;
+    gIndenter ()--;
   }
 
   os <<
@@ -2129,12 +2129,12 @@ void optionsSubGroup::printHelpSummary (
 
   // print the description if any
   if (fOptionsElementDescription.size ()) {
-    gIndenter++;
+    gIndenter ()++;
     os <<
-      gIndenter.indentMultiLineString (
+      gIndenter ().indentMultiLineString (
         fOptionsElementDescription) <<
       endl;
-    gIndenter--;
+    gIndenter ()--;
   }
 }
 
@@ -2174,7 +2174,7 @@ void optionsSubGroup::printOptionsItemForcedHelp (
 
   // print the options items
   if (fOptionsSubGroupItemsList.size ()) {    
-    gIndenter++;
+    gIndenter ()++;
 
     list<S_optionsItem>::const_iterator
       iBegin = fOptionsSubGroupItemsList.begin (),
@@ -2198,7 +2198,7 @@ void optionsSubGroup::printOptionsItemForcedHelp (
       }
     } // for
     
-    gIndenter--;
+    gIndenter ()--;
   }
 }
 
@@ -2219,7 +2219,7 @@ void optionsSubGroup::printOptionsValues (
 
   // print the options items values
   if (fOptionsSubGroupItemsList.size ()) {    
-    gIndenter++;
+    gIndenter ()++;
 
     list<S_optionsItem>::const_iterator
       iBegin = fOptionsSubGroupItemsList.begin (),
@@ -2234,7 +2234,7 @@ void optionsSubGroup::printOptionsValues (
   //    os << endl;
     } // for
 
-    gIndenter--;
+    gIndenter ()--;
   }
 }
 
@@ -2412,7 +2412,7 @@ void optionsGroup::print (ostream& os) const
     "OptionsGroup:" <<
     endl;
 
-  gIndenter++;
+  gIndenter ()++;
 
   optionsElement::printElementEssentials (
     os, fieldWidth);
@@ -2427,7 +2427,7 @@ void optionsGroup::print (ostream& os) const
   if (fOptionsGroupSubGroupsList.size ()) {
     os << endl;
     
-    gIndenter++;
+    gIndenter ()++;
     
     list<S_optionsSubGroup>::const_iterator
       iBegin = fOptionsGroupSubGroupsList.begin (),
@@ -2440,10 +2440,10 @@ void optionsGroup::print (ostream& os) const
       os << endl;
     } // for
 
-    gIndenter--;
+    gIndenter ()--;
   }
 
-  gIndenter--;
+  gIndenter ()--;
 }
 
 void optionsGroup::printHelp (ostream& os) const
@@ -2463,12 +2463,12 @@ void optionsGroup::printHelp (ostream& os) const
 
   // print the description if any
   if (fOptionsElementDescription.size ()) {
-    gIndenter++;
+    gIndenter ()++;
     os <<
-      gIndenter.indentMultiLineString (
+      gIndenter ().indentMultiLineString (
         fOptionsElementDescription) <<
       endl;
-    gIndenter--;
+    gIndenter ()--;
 
     os <<
       endl;  
@@ -2476,7 +2476,7 @@ void optionsGroup::printHelp (ostream& os) const
     
   // print the options subgroups
   if (fOptionsGroupSubGroupsList.size ()) {    
-    gIndenter++;
+    gIndenter ()++;
 
     list<S_optionsSubGroup>::const_iterator
       iBegin = fOptionsGroupSubGroupsList.begin (),
@@ -2489,7 +2489,7 @@ void optionsGroup::printHelp (ostream& os) const
       os << endl;
     } // for
       
-    gIndenter--;
+    gIndenter ()--;
   }
 }
 
@@ -2512,12 +2512,12 @@ void optionsGroup::printOptionsSubGroupForcedHelp (
 
   // print the description if any
   if (fOptionsElementDescription.size ()) {
-    gIndenter++;
+    gIndenter ()++;
     os <<
-      gIndenter.indentMultiLineString (
+      gIndenter ().indentMultiLineString (
         fOptionsElementDescription) <<
       endl;
-    gIndenter--;
+    gIndenter ()--;
 
     os <<
       endl;  
@@ -2525,7 +2525,7 @@ void optionsGroup::printOptionsSubGroupForcedHelp (
     
   // print the target options subgroup
   if (fOptionsGroupSubGroupsList.size ()) {    
-    gIndenter++;
+    gIndenter ()++;
 
     list<S_optionsSubGroup>::const_iterator
       iBegin = fOptionsGroupSubGroupsList.begin (),
@@ -2548,7 +2548,7 @@ void optionsGroup::printOptionsSubGroupForcedHelp (
       }
     } // for
       
-    gIndenter--;
+    gIndenter ()--;
   }
 }
 
@@ -2572,12 +2572,12 @@ void optionsGroup::printOptionsItemForcedHelp (
 
   // print the description if any
   if (fOptionsElementDescription.size ()) {
-    gIndenter++;
+    gIndenter ()++;
     os <<
-      gIndenter.indentMultiLineString (
+      gIndenter ().indentMultiLineString (
         fOptionsElementDescription) <<
       endl;
-    gIndenter--;
+    gIndenter ()--;
 
     os <<
       endl;  
@@ -2585,7 +2585,7 @@ void optionsGroup::printOptionsItemForcedHelp (
     
   // print the target options subgroup
   if (fOptionsGroupSubGroupsList.size ()) {    
-    gIndenter++;
+    gIndenter ()++;
 
     list<S_optionsSubGroup>::const_iterator
       iBegin = fOptionsGroupSubGroupsList.begin (),
@@ -2613,7 +2613,7 @@ void optionsGroup::printOptionsItemForcedHelp (
     os <<
       endl;  
       
-    gIndenter--;
+    gIndenter ()--;
   }
 }
 
@@ -2634,12 +2634,12 @@ void optionsGroup::printHelpSummary (ostream& os) const
 
   // print the description if any
   if (fOptionsElementDescription.size ()) {
-    gIndenter++;
+    gIndenter ()++;
     os <<
-      gIndenter.indentMultiLineString (
+      gIndenter ().indentMultiLineString (
         fOptionsElementDescription) <<
       endl;
-    gIndenter--;
+    gIndenter ()--;
 
     os <<
       endl;  
@@ -2647,7 +2647,7 @@ void optionsGroup::printHelpSummary (ostream& os) const
     
   // print the options subgroups
   if (fOptionsGroupSubGroupsList.size ()) {    
-    gIndenter++;
+    gIndenter ()++;
 
     list<S_optionsSubGroup>::const_iterator
       iBegin = fOptionsGroupSubGroupsList.begin (),
@@ -2661,7 +2661,7 @@ void optionsGroup::printHelpSummary (ostream& os) const
  //     os << endl;
     } // for
       
-    gIndenter--;
+    gIndenter ()--;
   }
 }
 
@@ -2686,12 +2686,12 @@ void optionsGroup::printSpecificSubGroupHelp (
 
   // print the description if any
   if (fOptionsElementDescription.size ()) {
-    gIndenter++;
+    gIndenter ()++;
     os <<
-      gIndenter.indentMultiLineString (
+      gIndenter ().indentMultiLineString (
         fOptionsElementDescription) <<
       endl;
-    gIndenter--;
+    gIndenter ()--;
 
     os <<
       endl;  
@@ -2699,7 +2699,7 @@ void optionsGroup::printSpecificSubGroupHelp (
     
   // print the options subgroups
   if (fOptionsGroupSubGroupsList.size ()) {    
-    gIndenter++;
+    gIndenter ()++;
 
     list<S_optionsSubGroup>::const_iterator
       iBegin = fOptionsGroupSubGroupsList.begin (),
@@ -2714,7 +2714,7 @@ void optionsGroup::printSpecificSubGroupHelp (
       os << endl;
     } // for
 
-    gIndenter--;
+    gIndenter ()--;
   }
 }
 
@@ -2737,7 +2737,7 @@ void optionsGroup::printOptionsValues (
 
   // print the options subgroups values
   if (fOptionsGroupSubGroupsList.size ()) {    
-    gIndenter++;
+    gIndenter ()++;
 
     list<S_optionsSubGroup>::const_iterator
       iBegin = fOptionsGroupSubGroupsList.begin (),
@@ -2752,7 +2752,7 @@ void optionsGroup::printOptionsValues (
       os << endl;
     } // for
 
-    gIndenter--;
+    gIndenter ()--;
   }
 }
 
@@ -3060,7 +3060,7 @@ void optionsHandler::print (ostream& os) const
     "OptionsHandler:" <<
     endl;
 
-  gIndenter++;
+  gIndenter ()++;
   
   printElementEssentials (os, fieldWidth);
 
@@ -3086,7 +3086,7 @@ void optionsHandler::print (ostream& os) const
     os <<
       endl;
     
-    gIndenter++;
+    gIndenter ()++;
     
     list<S_optionsGroup>::const_iterator
       iBegin = fOptionsHandlerOptionsGroupsList.begin (),
@@ -3099,17 +3099,17 @@ void optionsHandler::print (ostream& os) const
       os << endl;
     } // for
 
-    gIndenter--;
+    gIndenter ()--;
   }
 
-  gIndenter--;
+  gIndenter ()--;
 }
 
 void optionsHandler::printHelp (ostream& os) const
 {
   // print the options handler preamble
   os <<
-    gIndenter.indentMultiLineString (
+    gIndenter ().indentMultiLineString (
       fOptionHandlerPreamble) <<
       endl;
 
@@ -3122,17 +3122,17 @@ void optionsHandler::printHelp (ostream& os) const
     endl;
   
   // print the options handler description
-  gIndenter++;
+  gIndenter ()++;
   os <<
-    gIndenter.indentMultiLineString (
+    gIndenter ().indentMultiLineString (
       fOptionsElementDescription) <<
       endl <<
     endl;
-  gIndenter--;
+  gIndenter ()--;
     
   // print the options groups helps
   if (fOptionsHandlerOptionsGroupsList.size ()) {    
-    gIndenter++;
+    gIndenter ()++;
 
     list<S_optionsGroup>::const_iterator
       iBegin = fOptionsHandlerOptionsGroupsList.begin (),
@@ -3145,7 +3145,7 @@ void optionsHandler::printHelp (ostream& os) const
       os << endl;
     } // for
     
-    gIndenter--;
+    gIndenter ()--;
   }
 }
 
@@ -3153,7 +3153,7 @@ void optionsHandler::printHelpSummary (ostream& os) const
 {
   // print the options handler preamble
   os <<
-    gIndenter.indentMultiLineString (
+    gIndenter ().indentMultiLineString (
       fOptionHandlerPreamble) <<
       endl;
     
@@ -3166,17 +3166,17 @@ void optionsHandler::printHelpSummary (ostream& os) const
     endl;
 
   // print the options handler description
-  gIndenter++;
+  gIndenter ()++;
   os <<
-    gIndenter.indentMultiLineString (
+    gIndenter ().indentMultiLineString (
       fOptionsElementDescription) <<
       endl <<
     endl;
-  gIndenter--;
+  gIndenter ()--;
     
   // print the options groups help summaries
   if (fOptionsHandlerOptionsGroupsList.size ()) {    
-    gIndenter++;
+    gIndenter ()++;
 
     list<S_optionsGroup>::const_iterator
       iBegin = fOptionsHandlerOptionsGroupsList.begin (),
@@ -3189,7 +3189,7 @@ void optionsHandler::printHelpSummary (ostream& os) const
       os << endl;
     } // for
 
-    gIndenter--;
+    gIndenter ()--;
   }
 }
 
@@ -3208,7 +3208,7 @@ void optionsHandler::printSpecificSubGroupHelp (
 
   // print the optons group subgroups specific help
   if (fOptionsHandlerOptionsGroupsList.size ()) {    
-    gIndenter++;
+    gIndenter ()++;
 
     list<S_optionsGroup>::const_iterator
       iBegin = fOptionsHandlerOptionsGroupsList.begin (),
@@ -3224,7 +3224,7 @@ void optionsHandler::printSpecificSubGroupHelp (
       os << endl;
     } // for
       
-    gIndenter--;
+    gIndenter ()--;
   }
 }
 
@@ -3412,7 +3412,7 @@ void optionsHandler::printAllOptionsValues (
   if (fOptionsHandlerOptionsGroupsList.size ()) {
     os << endl;
     
-    gIndenter++;
+    gIndenter ()++;
 
     list<S_optionsGroup>::const_iterator
       iBegin = fOptionsHandlerOptionsGroupsList.begin (),
@@ -3427,7 +3427,7 @@ void optionsHandler::printAllOptionsValues (
       os << endl;
     } // for
 
-    gIndenter--;
+    gIndenter ()--;
   }
 }
 
@@ -3481,7 +3481,7 @@ const vector<string> optionsHandler::decipherOptionsAndArguments (
   char* argv[])
 {
 #ifdef TRACE_OPTIONS
-  if (gTraceOptions->fTraceOptions && ! gGeneralOptions->fQuiet) {
+  if (gTraceOptions ()->fTraceOptions && ! gGeneralOptions ()->fQuiet) {
     // print the options elements map  
     fOptionsHandlerLogIOstream <<
       "Options elements map (" <<
@@ -3489,7 +3489,7 @@ const vector<string> optionsHandler::decipherOptionsAndArguments (
       " elements):" <<
       endl;
     if (fOptionsElementsMap.size ()) {
-      gIndenter++;
+      gIndenter ()++;
       
       map<string, S_optionsElement>::const_iterator
         iBegin = fOptionsElementsMap.begin (),
@@ -3500,7 +3500,7 @@ const vector<string> optionsHandler::decipherOptionsAndArguments (
           (*i).first << "-->" <<
           endl;
           
-        gIndenter++;
+        gIndenter ()++;
         
         (*i).second->
           printHeader (
@@ -3511,10 +3511,10 @@ const vector<string> optionsHandler::decipherOptionsAndArguments (
         fOptionsHandlerLogIOstream <<
           endl;
           
-        gIndenter--;
+        gIndenter ()--;
       } // for
       
-      gIndenter--;
+      gIndenter ()--;
     }
     
     fOptionsHandlerLogIOstream <<
@@ -3538,7 +3538,7 @@ const vector<string> optionsHandler::decipherOptionsAndArguments (
     string currentElement = string (argv [n]);
     
 #ifdef TRACE_OPTIONS
-    if (gTraceOptions->fTraceOptions && ! gGeneralOptions->fQuiet) {
+    if (gTraceOptions ()->fTraceOptions && ! gGeneralOptions ()->fQuiet) {
       // print current element
       fOptionsHandlerLogIOstream <<
         "Command line element " << n <<
@@ -3554,7 +3554,7 @@ const vector<string> optionsHandler::decipherOptionsAndArguments (
       if (currentElement.size () == 1) {
         // this is the stdin indicator
 #ifdef TRACE_OPTIONS
-          if (gTraceOptions->fTraceOptions && ! gGeneralOptions->fQuiet) {
+          if (gTraceOptions ()->fTraceOptions && ! gGeneralOptions ()->fQuiet) {
           fOptionsHandlerLogIOstream <<
             "'" << currentElement <<
               "' is the '-' stdin indicator" <<
@@ -3590,7 +3590,7 @@ const vector<string> optionsHandler::decipherOptionsAndArguments (
               elementTrailer.substr (1, string::npos);
           
 #ifdef TRACE_OPTIONS
-            if (gTraceOptions->fTraceOptions && ! gGeneralOptions->fQuiet) {
+            if (gTraceOptions ()->fTraceOptions && ! gGeneralOptions ()->fQuiet) {
               fOptionsHandlerLogIOstream <<
                 "'" << currentOptionName << "' is a double-dashed option" <<
                 endl;
@@ -3603,7 +3603,7 @@ const vector<string> optionsHandler::decipherOptionsAndArguments (
               elementTrailer; //.substr (1, string::npos);
 
 #ifdef TRACE_OPTIONS
-            if (gTraceOptions->fTraceOptions && ! gGeneralOptions->fQuiet) {
+            if (gTraceOptions ()->fTraceOptions && ! gGeneralOptions ()->fQuiet) {
               fOptionsHandlerLogIOstream <<
                 "'" << currentOptionName << "' is a single-dashed option" <<
                 endl;
@@ -3614,7 +3614,7 @@ const vector<string> optionsHandler::decipherOptionsAndArguments (
         
         else {
 #ifdef TRACE_OPTIONS
-          if (gTraceOptions->fTraceOptions && ! gGeneralOptions->fQuiet) {
+          if (gTraceOptions ()->fTraceOptions && ! gGeneralOptions ()->fQuiet) {
             fOptionsHandlerLogIOstream <<
               "'-' is the minimal single-dashed option" <<
               endl;
@@ -3641,7 +3641,7 @@ const vector<string> optionsHandler::decipherOptionsAndArguments (
     fArgumentsVector.size ();
 
 #ifdef TRACE_OPTIONS
-  if (gTraceOptions->fTraceOptions && ! gGeneralOptions->fQuiet) {
+  if (gTraceOptions ()->fTraceOptions && ! gGeneralOptions ()->fQuiet) {
     // print the arguments vector
     fOptionsHandlerLogIOstream <<
       "Arguments vector (" <<
@@ -3650,13 +3650,13 @@ const vector<string> optionsHandler::decipherOptionsAndArguments (
       endl;
   
     if (argumentsVectorSize) {
-      gIndenter++;
+      gIndenter ()++;
       for (unsigned int i = 0; i < argumentsVectorSize; i++) {
         fOptionsHandlerLogIOstream <<
           fArgumentsVector [i] <<
           endl;
       } // for
-      gIndenter--;
+      gIndenter ()--;
     }
   }
 #endif
@@ -3687,7 +3687,7 @@ void optionsHandler::handleOptionsItemName (
   string optionsItemName)
 {
 #ifdef TRACE_OPTIONS
-  if (gTraceOptions->fTraceOptions && ! gGeneralOptions->fQuiet) {
+  if (gTraceOptions ()->fTraceOptions && ! gGeneralOptions ()->fQuiet) {
     fOptionsHandlerLogIOstream <<
       "==> handleOptionsItemName (), optionsItemName = \"" <<
       optionsItemName <<
@@ -3757,7 +3757,7 @@ void optionsHandler::handleOptionsItemName (
       ) {
       // print the option handler help or help summary
 #ifdef TRACE_OPTIONS
-      if (gTraceOptions->fTraceOptions && ! gGeneralOptions->fQuiet) {
+      if (gTraceOptions ()->fTraceOptions && ! gGeneralOptions ()->fQuiet) {
         fOptionsHandlerLogIOstream <<
           "==> optionsElement is of type 'optionsHandler'" <<
           endl;
@@ -3794,7 +3794,7 @@ void optionsHandler::handleOptionsItemName (
           dynamic_cast<optionsGroup*>(&(*optionsElement))
       ) {
 #ifdef TRACE_OPTIONS
-      if (gTraceOptions->fTraceOptions && ! gGeneralOptions->fQuiet) {
+      if (gTraceOptions ()->fTraceOptions && ! gGeneralOptions ()->fQuiet) {
         fOptionsHandlerLogIOstream <<
           "==> optionsElement is of type 'optionsGroup'" <<
           endl;
@@ -3823,7 +3823,7 @@ void optionsHandler::handleOptionsItemName (
           dynamic_cast<optionsSubGroup*>(&(*optionsElement))
       ) {
 #ifdef TRACE_OPTIONS
-      if (gTraceOptions->fTraceOptions && ! gGeneralOptions->fQuiet) {
+      if (gTraceOptions ()->fTraceOptions && ! gGeneralOptions ()->fQuiet) {
         fOptionsHandlerLogIOstream <<
           "==> optionsElement is of type 'optionsSubGroup'" <<
           endl;
@@ -3863,7 +3863,7 @@ void optionsHandler::handleOptionsItemName (
           dynamic_cast<optionsItem*>(&(*optionsElement))
       ) {
 #ifdef TRACE_OPTIONS
-      if (gTraceOptions->fTraceOptions && ! gGeneralOptions->fQuiet) {
+      if (gTraceOptions ()->fTraceOptions && ! gGeneralOptions ()->fQuiet) {
         fOptionsHandlerLogIOstream <<
           "==> optionsElement is of type 'optionsItem'" <<
           endl;
@@ -3877,7 +3877,7 @@ void optionsHandler::handleOptionsItemName (
             dynamic_cast<optionsHelpUsageItem*>(&(*optionsElement))
         ) {
 #ifdef TRACE_OPTIONS
-        if (gTraceOptions->fTraceOptions && ! gGeneralOptions->fQuiet) {
+        if (gTraceOptions ()->fTraceOptions && ! gGeneralOptions ()->fQuiet) {
           fOptionsHandlerLogIOstream <<
             "==> optionsElement is of type 'optionsHelpUsageItem'" <<
             endl;
@@ -3900,7 +3900,7 @@ void optionsHandler::handleOptionsItemName (
             dynamic_cast<optionsHelpSummaryItem*>(&(*optionsElement))
         ) {
 #ifdef TRACE_OPTIONS
-        if (gTraceOptions->fTraceOptions && ! gGeneralOptions->fQuiet) {
+        if (gTraceOptions ()->fTraceOptions && ! gGeneralOptions ()->fQuiet) {
           fOptionsHandlerLogIOstream <<
             "==> optionsElement is of type 'optionsHelpSummaryItem'" <<
             endl;
@@ -3922,7 +3922,7 @@ void optionsHandler::handleOptionsItemName (
             dynamic_cast<optionsCombinedItemsItem*>(&(*optionsElement))
         ) {
 #ifdef TRACE_OPTIONS
-        if (gTraceOptions->fTraceOptions && ! gGeneralOptions->fQuiet) {
+        if (gTraceOptions ()->fTraceOptions && ! gGeneralOptions ()->fQuiet) {
           fOptionsHandlerLogIOstream <<
             "==> optionsElement is of type 'optionsCombinedItemsItem'" <<
             endl;
@@ -3941,7 +3941,7 @@ void optionsHandler::handleOptionsItemName (
             dynamic_cast<optionsBooleanItem*>(&(*optionsElement))
         ) {
 #ifdef TRACE_OPTIONS
-        if (gTraceOptions->fTraceOptions && ! gGeneralOptions->fQuiet) {
+        if (gTraceOptions ()->fTraceOptions && ! gGeneralOptions ()->fQuiet) {
           fOptionsHandlerLogIOstream <<
             "==> optionsElement is of type 'optionsBooleanItem'" <<
             endl;
@@ -3960,7 +3960,7 @@ void optionsHandler::handleOptionsItemName (
             dynamic_cast<optionsTwoBooleansItem*>(&(*optionsElement))
         ) {
 #ifdef TRACE_OPTIONS
-        if (gTraceOptions->fTraceOptions && ! gGeneralOptions->fQuiet) {
+        if (gTraceOptions ()->fTraceOptions && ! gGeneralOptions ()->fQuiet) {
           fOptionsHandlerLogIOstream <<
             "==> optionsElement is of type 'optionsTwoBooleansItem'" <<
             endl;
@@ -3979,7 +3979,7 @@ void optionsHandler::handleOptionsItemName (
             dynamic_cast<optionsThreeBooleansItem*>(&(*optionsElement))
         ) {
 #ifdef TRACE_OPTIONS
-        if (gTraceOptions->fTraceOptions && ! gGeneralOptions->fQuiet) {
+        if (gTraceOptions ()->fTraceOptions && ! gGeneralOptions ()->fQuiet) {
           fOptionsHandlerLogIOstream <<
             "==> optionsElement is of type 'optionsThreeBooleansItem'" <<
             endl;
@@ -3998,7 +3998,7 @@ void optionsHandler::handleOptionsItemName (
             dynamic_cast<optionsItemHelpItem*>(&(*optionsElement))
         ) {
 #ifdef TRACE_OPTIONS
-        if (gTraceOptions->fTraceOptions && ! gGeneralOptions->fQuiet) {
+        if (gTraceOptions ()->fTraceOptions && ! gGeneralOptions ()->fQuiet) {
           fOptionsHandlerLogIOstream <<
             "==> optionsElement is of type 'optionsItemHelpItem'" <<
             endl;
@@ -4016,7 +4016,7 @@ void optionsHandler::handleOptionsItemName (
             dynamic_cast<optionsIntegerItem*>(&(*optionsElement))
         ) {
 #ifdef TRACE_OPTIONS
-        if (gTraceOptions->fTraceOptions && ! gGeneralOptions->fQuiet) {
+        if (gTraceOptions ()->fTraceOptions && ! gGeneralOptions ()->fQuiet) {
           fOptionsHandlerLogIOstream <<
             "==> optionsElement is of type 'optionsIntegerItem'" <<
             endl;
@@ -4034,7 +4034,7 @@ void optionsHandler::handleOptionsItemName (
             dynamic_cast<optionsFloatItem*>(&(*optionsElement))
         ) {              
 #ifdef TRACE_OPTIONS
-        if (gTraceOptions->fTraceOptions && ! gGeneralOptions->fQuiet) {
+        if (gTraceOptions ()->fTraceOptions && ! gGeneralOptions ()->fQuiet) {
           fOptionsHandlerLogIOstream <<
             "==> optionsElement is of type 'optionsFloatItem'" <<
             endl;
@@ -4052,7 +4052,7 @@ void optionsHandler::handleOptionsItemName (
             dynamic_cast<optionsStringItem*>(&(*optionsElement))
         ) {
 #ifdef TRACE_OPTIONS
-        if (gTraceOptions->fTraceOptions && ! gGeneralOptions->fQuiet) {
+        if (gTraceOptions ()->fTraceOptions && ! gGeneralOptions ()->fQuiet) {
           fOptionsHandlerLogIOstream <<
             "==> optionsElement is of type 'optionsStringItem'" <<
             endl;
@@ -4070,7 +4070,7 @@ void optionsHandler::handleOptionsItemName (
             dynamic_cast<optionsRationalItem*>(&(*optionsElement))
         ) {
 #ifdef TRACE_OPTIONS
-        if (gTraceOptions->fTraceOptions && ! gGeneralOptions->fQuiet) {
+        if (gTraceOptions ()->fTraceOptions && ! gGeneralOptions ()->fQuiet) {
           fOptionsHandlerLogIOstream <<
             "==> optionsElement is of type 'optionsRationalItem'" <<
             endl;
@@ -4088,7 +4088,7 @@ void optionsHandler::handleOptionsItemName (
             dynamic_cast<optionsNumbersSetItem*>(&(*optionsElement))
         ) {
 #ifdef TRACE_OPTIONS
-        if (gTraceOptions->fTraceOptions && ! gGeneralOptions->fQuiet) {
+        if (gTraceOptions ()->fTraceOptions && ! gGeneralOptions ()->fQuiet) {
           fOptionsHandlerLogIOstream <<
             "==> optionsElement is of type 'optionsNumbersSetItem'" <<
             endl;
@@ -4104,7 +4104,7 @@ void optionsHandler::handleOptionsItemName (
         // let the optionsGroup handle it
 
 #ifdef TRACE_OPTIONS
-        if (gTraceOptions->fTraceOptions && ! gGeneralOptions->fQuiet) {
+        if (gTraceOptions ()->fTraceOptions && ! gGeneralOptions ()->fQuiet) {
           fOptionsHandlerLogIOstream <<
             "==> fPendingOptionsItem is of another type" <<
             ", let the optionsGroup handle it" <<
@@ -4143,18 +4143,18 @@ void optionsHandler::handleOptionsItemValueOrArgument (
   string theString)
 {
 #ifdef TRACE_OPTIONS
-  if (gTraceOptions->fTraceOptions && ! gGeneralOptions->fQuiet) {
+  if (gTraceOptions ()->fTraceOptions && ! gGeneralOptions ()->fQuiet) {
     fOptionsHandlerLogIOstream <<
       "==> handleOptionsItemValueOrArgument ()" <<
       endl;
       
-    gIndenter++;
+    gIndenter ()++;
     
     fOptionsHandlerLogIOstream <<
       "fPendingOptionsItem:" <<
       endl;
       
-    gIndenter++;
+    gIndenter ()++;
     if (fPendingOptionsItem) {
       fOptionsHandlerLogIOstream <<
         fPendingOptionsItem;
@@ -4164,21 +4164,21 @@ void optionsHandler::handleOptionsItemValueOrArgument (
         "null" <<
         endl;
     }
-    gIndenter--;
+    gIndenter ()--;
     
     fOptionsHandlerLogIOstream <<
       "theString:" <<
       endl;
       
-    gIndenter++;
+    gIndenter ()++;
     fOptionsHandlerLogIOstream <<
       " \"" <<
       theString <<
       "\"" <<
       endl;
-    gIndenter--;
+    gIndenter ()--;
 
-    gIndenter--;
+    gIndenter ()--;
   }
 #endif
 
@@ -4280,7 +4280,7 @@ void optionsHandler::handleOptionsItemValueOrArgument (
 
       if (sm.size ()) {
 #ifdef TRACE_OPTIONS
-        if (gTraceOptions->fTraceOptions && ! gGeneralOptions->fQuiet) {
+        if (gTraceOptions ()->fTraceOptions && ! gGeneralOptions ()->fQuiet) {
           fOptionsHandlerLogIOstream <<
             "There are " << sm.size () << " matches" <<
             " for rational string '" << theString <<
@@ -4336,7 +4336,7 @@ void optionsHandler::handleOptionsItemValueOrArgument (
           rational (numerator, denominator);     
 
 #ifdef TRACE_OPTIONS
-      if (gTraceOptions->fTraceOptions && ! gGeneralOptions->fQuiet) {
+      if (gTraceOptions ()->fTraceOptions && ! gGeneralOptions ()->fQuiet) {
         fOptionsHandlerLogIOstream << // JMI
           "rationalValue = " <<
           rationalValue <<
@@ -4373,7 +4373,7 @@ void optionsHandler::handleOptionsItemValueOrArgument (
       // let the optionsGroup handle it
 
 #ifdef TRACE_OPTIONS
-      if (gTraceOptions->fTraceOptions && ! gGeneralOptions->fQuiet) {
+      if (gTraceOptions ()->fTraceOptions && ! gGeneralOptions ()->fQuiet) {
         fOptionsHandlerLogIOstream <<
           "==> fPendingOptionsItem is of another type" <<
           ", let the optionsGroup handle it" <<
@@ -0,0 +1,370 @@
+/*
+  MusicXML Library
+  Copyright (C) Grame 2006-2013
+
+  This Source Code Form is subject to the terms of the Mozilla Public
+  License, v. 2.0. If a copy of the MPL was not distributed with this
+  file, You can obtain one at http://mozilla.org/MPL/2.0/.
+
+  Grame Research Laboratory, 11, cours de Verdun Gensoul 69002 Lyon - France
+  research@grame.fr
+*/
+
+#ifdef VC6
+# pragma warning (disable : 4786)
+#endif
+
+#include <sstream>
+#include <vector>
+#include <algorithm>
+#include <iomanip>      // setprecision, ...
+#include <cstdlib>      // free
+
+#ifdef __GNUC__
+  #include <cxxabi.h>   // __cxa_demangle
+#endif
+
+#include "version.h"
+#include "utilities.h"
+
+#include "profiling.h"
+#include "conversionContext.h"
+
+using namespace std;
+
+namespace MusicXML2 {
+
+profiling::profiling ()
+{
+  fIsActive = false;
+
+  fAllocationsCounter       = nullptr;
+  fPreviousAllocationsCount = 0;
+  fPreviousAllocatedBytes   = 0;
+}
+
+profiling::~profiling ()
+{}
+
+void profiling::activate ()
+{
+  fIsActive = true;
+
+  // the allocations made so far don't belong to any activity
+  takeAllocationsSnapshot (
+    fPreviousAllocationsCount,
+    fPreviousAllocatedBytes);
+}
+
+void profiling::takeAllocationsSnapshot (
+  size_t& allocationsCount,
+  size_t& allocatedBytes) const
+{
+  allocationsCount = 0;
+  allocatedBytes   = 0;
+
+  if (fAllocationsCounter)
+    fAllocationsCounter (
+      allocationsCount,
+      allocatedBytes);
+}
+
+//______________________________________________________________________________
+static string elementTypeName (const char* mangledName)
+{
+  string result = mangledName;
+
+#ifdef __GNUC__
+  int   status;
+  char* demangled =
+    abi::__cxa_demangle (
+      mangledName, nullptr, nullptr, &status);
+
+  if (status == 0 && demangled) {
+    result = demangled;
+  }
+  free (demangled);
+#endif
+
+  // drop the namespace
+  size_t pos = result.rfind ("::");
+
+  if (pos != string::npos)
+    result.erase (0, pos + 2);
+
+  return result;
+}
+
+void profiling::activityDone (
+  const string& activity,
+  const string& description,
+  bool          isMandatory,
+  double        cpuSeconds)
+{
+  activityProfile profile;
+
+  profile.fActivity    = activity;
+  profile.fDescription = description;
+  profile.fIsMandatory = isMandatory;
+  profile.fCpuSeconds  = cpuSeconds;
+
+  // allocations
+  if (fAllocationsCounter) {
+    size_t allocationsCount, allocatedBytes;
+
+    takeAllocationsSnapshot (
+      allocationsCount,
+      allocatedBytes);
+
+    profile.fAllocationsCount =
+      allocationsCount - fPreviousAllocationsCount;
+    profile.fAllocatedBytes =
+      allocatedBytes - fPreviousAllocatedBytes;
+
+    fPreviousAllocationsCount = allocationsCount;
+    fPreviousAllocatedBytes   = allocatedBytes;
+  }
+  else {
+    profile.fAllocationsCount = -1;
+    profile.fAllocatedBytes   = -1;
+  }
+
+  profile.fPeakMemoryKB = timing::peakMemoryKB ();
+
+  // visits, the MusicXML element names are lower case
+  // and don't clash with the MSR and LPSR class names
+  profile.fVisits.swap (fCurrentMxmlVisits);
+
+  for (
+    unordered_map<type_index, visitsCount>::const_iterator i =
+      fCurrentMsrVisits.begin ();
+    i != fCurrentMsrVisits.end ();
+    i++
+  ) {
+    visitsCount&
+      count =
+        profile.fVisits [elementTypeName ((*i).first.name ())];
+
+    count.fCount   += (*i).second.fCount;
+    count.fSeconds += (*i).second.fSeconds;
+  } // for
+
+  fCurrentMsrVisits.clear ();
+
+  fActivityProfilesList.push_back (profile);
+}
+
+//______________________________________________________________________________
+static string quotedJSONString (const string& theString)
+{
+  stringstream s;
+
+  s << "\"";
+
+  for (
+    string::const_iterator i = theString.begin ();
+    i != theString.end ();
+    i++
+  ) {
+    unsigned char c = (*i);
+
+    switch (c) {
+      case '"':
+        s << "\\\"";
+        break;
+      case '\\':
+        s << "\\\\";
+        break;
+      case '\n':
+        s << "\\n";
+        break;
+      case '\t':
+        s << "\\t";
+        break;
+      default:
+        if (c < 0x20) {
+          s <<
+            "\\u" <<
+            hex << setw (4) << setfill ('0') << int (c) <<
+            dec << setfill (' ');
+        }
+        else
+          s << c;
+    } // switch
+  } // for
+
+  s << "\"";
+
+  return s.str ();
+}
+
+static bool compareVisitsBySeconds (
+  const pair<string, profiling::visitsCount>& first,
+  const pair<string, profiling::visitsCount>& second)
+{
+  return first.second.fSeconds > second.second.fSeconds;
+}
+
+void profiling::printJSON (
+  ostream&      os,
+  const string& inputSourceName) const
+{
+  os <<
+    "{" <<
+    endl <<
+    "  \"version\": " <<
+    quotedJSONString (currentVersionNumber ()) <<
+    "," <<
+    endl <<
+    "  \"input\": " <<
+    quotedJSONString (inputSourceName) <<
+    "," <<
+    endl <<
+    "  \"activities\": [";
+
+  for (
+    list<activityProfile>::const_iterator i =
+      fActivityProfilesList.begin ();
+    i != fActivityProfilesList.end ();
+    i++
+  ) {
+    const activityProfile& profile = (*i);
+
+    if (i != fActivityProfilesList.begin ())
+      os << ",";
+
+    os <<
+      endl <<
+      "    {" <<
+      endl <<
+      "      \"activity\": " <<
+      quotedJSONString (profile.fActivity) <<
+      "," <<
+      endl <<
+      "      \"description\": " <<
+      quotedJSONString (profile.fDescription) <<
+      "," <<
+      endl <<
+      "      \"kind\": " <<
+      (profile.fIsMandatory ? "\"mandatory\"" : "\"optional\"") <<
+      "," <<
+      endl <<
+      "      \"cpuSeconds\": " <<
+      setprecision (6) << fixed << profile.fCpuSeconds <<
+      "," <<
+      endl;
+
+    // unknown values are null
+    os << "      \"allocations\": ";
+    if (profile.fAllocationsCount >= 0)
+      os << profile.fAllocationsCount;
+    else
+      os << "null";
+    os << "," << endl;
+
+    os << "      \"allocatedBytes\": ";
+    if (profile.fAllocatedBytes >= 0)
+      os << profile.fAllocatedBytes;
+    else
+      os << "null";
+    os << "," << endl;
+
+    os << "      \"peakMemoryKB\": ";
+    if (profile.fPeakMemoryKB >= 0)
+      os << profile.fPeakMemoryKB;
+    else
+      os << "null";
+    os << "," << endl;
+
+    // the visits, most time consuming first
+    vector<pair<string, visitsCount> >
+      visitsVector (
+        profile.fVisits.begin (),
+        profile.fVisits.end ());
+
+    stable_sort (
+      visitsVector.begin (),
+      visitsVector.end (),
+      compareVisitsBySeconds);
+
+    os << "      \"visits\": [";
+
+    for (
+      vector<pair<string, visitsCount> >::const_iterator j =
+        visitsVector.begin ();
+      j != visitsVector.end ();
+      j++
+    ) {
+      if (j != visitsVector.begin ())
+        os << ",";
+
+      os <<
+        endl <<
+        "        { " <<
+        "\"element\": " << quotedJSONString ((*j).first) <<
+        ", \"count\": " << (*j).second.fCount <<
+        ", \"seconds\": " << (*j).second.fSeconds <<
+        " }";
+    } // for
+
+    if (visitsVector.size ())
+      os << endl << "      ";
+
+    os <<
+      "]" <<
+      endl <<
+      "    }";
+  } // for
+
+  if (fActivityProfilesList.size ())
+    os << endl << "  ";
+
+  os <<
+    "]" <<
+    endl <<
+    "}" <<
+    endl;
+
+  // restore the default floating point format
+  os.unsetf (ios_base::floatfield);
+}
+
+//______________________________________________________________________________
+void mxmlTreeBrowser::enter (xmlelement& t)
+{
+  if (gProfiling ().isActive ())
+    profiledVisit (t, true);
+  else
+    t.acceptIn (*fVisitor);
+}
+
+void mxmlTreeBrowser::leave (xmlelement& t)
+{
+  if (gProfiling ().isActive ())
+    profiledVisit (t, false);
+  else
+    t.acceptOut (*fVisitor);
+}
+
+void mxmlTreeBrowser::profiledVisit (xmlelement& t, bool entered)
+{
+  profiling::visitsClock::time_point
+    startTime =
+      profiling::visitsClock::now ();
+
+  if (entered)
+    t.acceptIn (*fVisitor);
+  else
+    t.acceptOut (*fVisitor);
+
+  chrono::duration<double>
+    visitDuration =
+      profiling::visitsClock::now () - startTime;
+
+  gProfiling ().registerMxmlVisit (
+    t.getName (),
+    entered,
+    visitDuration.count ());
+}
+
+} // namespace MusicXML2
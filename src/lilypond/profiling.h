@@ -0,0 +1,185 @@
+/*
+  MusicXML Library
+  Copyright (C) Grame 2006-2013
+
+  This Source Code Form is subject to the terms of the Mozilla Public
+  License, v. 2.0. If a copy of the MPL was not distributed with this
+  file, You can obtain one at http://mozilla.org/MPL/2.0/.
+
+  Grame Research Laboratory, 11, cours de Verdun Gensoul 69002 Lyon - France
+  research@grame.fr
+*/
+
+#ifndef ___profiling___
+#define ___profiling___
+
+#include <cstddef>
+#include <ctime>
+#include <chrono>
+#include <string>
+#include <list>
+#include <map>
+#include <typeinfo>
+#include <typeindex>
+#include <unordered_map>
+#include <iostream>
+
+#include "exports.h"
+#include "xml.h"
+#include "tree_browser.h"
+
+
+namespace MusicXML2
+{
+
+/*!
+\brief an opt-in profiling of the xml2ly passes
+
+  When active, the activities registered in gTiming () are
+  complemented with their allocations count and bytes, the peak memory
+  use at their end, and the number of visits and time spent in the visitor
+  methods per element type. The MusicXML elements are counted by
+  mxmlTreeBrowser, the MSR and LPSR elements by msrBrowser.
+
+  The library can't count the allocations by itself: the application
+  provides an allocations counter, typically fed by its own operator new.
+
+  gProfiling () is the profiling of the current conversion context.
+*/
+//______________________________________________________________________________
+class EXP profiling
+{
+  public:
+
+    typedef std::chrono::steady_clock visitsClock;
+
+    // the application's allocations count and bytes so far
+    typedef void (*allocationsCounter) (
+      size_t& allocationsCount,
+      size_t& allocatedBytes);
+
+    struct visitsCount {
+      visitsCount () : fCount (0), fSeconds (0.0) {}
+
+      unsigned long         fCount;
+      double                fSeconds;
+    };
+
+                          profiling ();
+    virtual               ~profiling ();
+
+    // activation
+    void                  activate ();
+
+    bool                  isActive () const
+                              { return fIsActive; }
+
+    void                  setAllocationsCounter (
+                            allocationsCounter counter)
+                              { fAllocationsCounter = counter; }
+
+    // visits, the element is counted when it is entered
+    void                  registerMxmlVisit (
+                            const std::string& elementName,
+                            bool               entered,
+                            double             seconds)
+                              {
+                                visitsCount&
+                                  count =
+                                    fCurrentMxmlVisits [elementName];
+                                if (entered) count.fCount++;
+                                count.fSeconds += seconds;
+                              }
+
+    void                  registerMsrVisit (
+                            const std::type_info& elementType,
+                            bool                  entered,
+                            double                seconds)
+                              {
+                                visitsCount&
+                                  count =
+                                    fCurrentMsrVisits [
+                                      std::type_index (elementType)];
+                                if (entered) count.fCount++;
+                                count.fSeconds += seconds;
+                              }
+
+    // called by timing::appendTimingItem:
+    // what has been counted since the previous activity belongs to this one
+    void                  activityDone (
+                            const std::string& activity,
+                            const std::string& description,
+                            bool               isMandatory,
+                            double             cpuSeconds);
+
+    // print
+    void                  printJSON (
+                            std::ostream&      os,
+                            const std::string& inputSourceName) const;
+
+  private:
+
+    struct activityProfile {
+      std::string           fActivity;
+      std::string           fDescription;
+      bool                  fIsMandatory;
+      double                fCpuSeconds;
+      long                  fAllocationsCount;  // -1 if unknown
+      long                  fAllocatedBytes;    // -1 if unknown
+      long                  fPeakMemoryKB;      // -1 if unknown
+
+      std::map<std::string, visitsCount>
+                            fVisits;
+    };
+
+    void                  takeAllocationsSnapshot (
+                            size_t& allocationsCount,
+                            size_t& allocatedBytes) const;
+
+    bool                  fIsActive;
+
+    allocationsCounter    fAllocationsCounter;
+    size_t                fPreviousAllocationsCount;
+    size_t                fPreviousAllocatedBytes;
+
+    // the visits since the previous activity
+    std::map<std::string, visitsCount>
+                          fCurrentMxmlVisits;
+    std::unordered_map<std::type_index, visitsCount>
+                          fCurrentMsrVisits;
+
+    std::list<activityProfile>
+                          fActivityProfilesList;
+};
+
+//______________________________________________________________________________
+// a tree browser feeding the profiling visits counts when it is active
+class EXP mxmlTreeBrowser : public tree_browser<xmlelement>
+{
+  public:
+
+    mxmlTreeBrowser (basevisitor* v) : tree_browser<xmlelement> (v)
+    {}
+
+    virtual ~mxmlTreeBrowser ()
+    {}
+
+  protected:
+
+    virtual void enter (xmlelement& t);
+    virtual void leave (xmlelement& t);
+
+  private:
+
+    void         profiledVisit (xmlelement& t, bool entered);
+};
+
+
+// gProfiling () is that of the current conversion context, see
+// conversionContext.h
+
+
+} // namespace MusicXML2
+
+
+#endif
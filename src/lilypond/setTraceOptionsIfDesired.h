@@ -14,8 +14,12 @@
 #define ___setTraceOptionsIfDesired___
 
 
-// comment the following definition if no trace options are wanted
+// comment the following definition if no trace options are wanted,
+// or define NO_TRACE_OPTIONS (cmake -DTRACE=off) for a release build:
+// the trace code is then not compiled at all
+#ifndef NO_TRACE_OPTIONS
 #define TRACE_OPTIONS
+#endif
 
 
 #endif
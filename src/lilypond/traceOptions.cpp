@@ -23,10 +23,6 @@ namespace MusicXML2
 {
 
 //_______________________________________________________________________________
-S_traceOptions gTraceOptions;
-S_traceOptions gTraceOptionsUserChoices;
-S_traceOptions gTraceOptionsWithDetailedTrace;
-
 S_traceOptions traceOptions::create (
   S_optionsHandler optionsHandler)
 {
@@ -1443,21 +1439,21 @@ void traceOptions::checkOptionsConsistency ()
 //______________________________________________________________________________
 void traceOptions::printTraceOptionsValues (int fieldWidth)
 {  
-  gLogIOstream <<
+  gLogIOstream () <<
     "The trace options are:" <<
     endl;
 
-  gIndenter++;
+  gIndenter ()++;
 
 /* JMI
   // command line
   // --------------------------------------
 
-  gLogIOstream << left <<
+  gLogIOstream () << left <<
 
-  gIndenter++;
+  gIndenter ()++;
 
-  gLogIOstream << left <<
+  gLogIOstream () << left <<
     setw (fieldWidth) << "input source name" << " : " <<
     fInputSourceName <<
     endl <<
@@ -1466,18 +1462,18 @@ void traceOptions::printTraceOptionsValues (int fieldWidth)
     fTranslationDate <<
     endl;
 
-  gIndenter--;
+  gIndenter ()--;
 
   // output file
   // --------------------------------------
 
-  gLogIOstream << left <<
+  gLogIOstream () << left <<
     setw (fieldWidth) << "Output file:" <<
     endl;
 
-  gIndenter++;
+  gIndenter ()++;
 
-  gLogIOstream << left <<        
+  gLogIOstream () << left <<        
     setw (fieldWidth) << "inputSourceName" << " : \"" <<
     fInputSourceName <<
     "\"" <<
@@ -1487,30 +1483,30 @@ void traceOptions::printTraceOptionsValues (int fieldWidth)
     "\"" <<
     endl;
 
-  gIndenter--;
+  gIndenter ()--;
 */
 
   // trace and display
   // --------------------------------------
 
-  gLogIOstream << left <<
+  gLogIOstream () << left <<
     setw (fieldWidth) << "Trace and display:" <<
     endl;
 
-  gIndenter++;
+  gIndenter ()++;
 
-  gLogIOstream << left <<
+  gLogIOstream () << left <<
     setw (fieldWidth) << "tracePasses" << " : " <<
     booleanAsString (fTracePasses) <<
      endl <<
     setw (fieldWidth) << "traceDetailedMeasureNumbersSet" << " : ";
         
   if (! fTraceDetailedMeasureNumbersSet.size ()) {
-    gLogIOstream << "none";
+    gLogIOstream () << "none";
   }
     
   else {
-    gLogIOstream <<
+    gLogIOstream () <<
       "'";
       
     set<int>::const_iterator
@@ -1519,31 +1515,31 @@ void traceOptions::printTraceOptionsValues (int fieldWidth)
       i      = iBegin;
       
     for ( ; ; ) {
-      gLogIOstream << (*i);
+      gLogIOstream () << (*i);
       if (++i == iEnd) break;
-      gLogIOstream << " ";
+      gLogIOstream () << " ";
     } // for
   
-    gLogIOstream <<
+    gLogIOstream () <<
       "'";
   }
     
-  gLogIOstream <<
+  gLogIOstream () <<
     endl;
 
-  gIndenter--;
+  gIndenter ()--;
   
 
   // specific trace    
   // --------------------------------------
 
-  gLogIOstream << left <<
+  gLogIOstream () << left <<
     setw (fieldWidth) << "Specific trace:" <<
     endl;
 
-  gIndenter++;
+  gIndenter ()++;
 
-  gLogIOstream << left <<
+  gLogIOstream () << left <<
     // fTraceEncoding
     setw (fieldWidth) << "traceEncoding" << " : " <<
     booleanAsString (fTraceEncoding) <<
@@ -1775,9 +1771,9 @@ void traceOptions::printTraceOptionsValues (int fieldWidth)
     booleanAsString (fTraceCredits) <<
     endl;
 
-  gIndenter--;
+  gIndenter ()--;
 
-  gIndenter--;
+  gIndenter ()--;
 }
 
 S_optionsItem traceOptions::handleOptionsItem (
@@ -1802,18 +1798,18 @@ void initializeTraceOptionsHandling (
   // create the options variables
   // ------------------------------------------------------
   
-  gTraceOptionsUserChoices = traceOptions::create (
+  gTraceOptionsUserChoices () = traceOptions::create (
     optionsHandler);
-  assert(gTraceOptionsUserChoices != 0);
+  assert(gTraceOptionsUserChoices () != 0);
 
-  gTraceOptions =
-    gTraceOptionsUserChoices;
+  gTraceOptions () =
+    gTraceOptionsUserChoices ();
 
   // prepare for measure detailed trace
   // ------------------------------------------------------
 
-  gTraceOptionsWithDetailedTrace =
-    gTraceOptions->
+  gTraceOptionsWithDetailedTrace () =
+    gTraceOptions ()->
       createCloneWithDetailedTrace ();
 }
 
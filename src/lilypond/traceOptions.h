@@ -276,9 +276,9 @@ class traceOptions : public optionsGroup
 typedef SMARTP<traceOptions> S_traceOptions;
 EXP ostream& operator<< (ostream& os, const S_traceOptions& elt);
 
-EXP extern S_traceOptions gTraceOptions;
-EXP extern S_traceOptions gTraceOptionsUserChoices;
-EXP extern S_traceOptions gTraceOptionsWithDetailedTrace;
+// gTraceOptions (), gTraceOptionsUserChoices () and
+// gTraceOptionsWithDetailedTrace () are those of the current conversion
+// context, see conversionContext.h
 
 //______________________________________________________________________________
 void initializeTraceOptionsHandling (
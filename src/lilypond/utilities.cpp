@@ -18,6 +18,7 @@
   // JMI
 #else
   #include "unistd.h"
+  #include <sys/resource.h> // getrusage
 #endif
 
 #include <iostream>
@@ -31,6 +32,7 @@
 
 #include "rational.h"
 #include "utilities.h"
+#include "profiling.h"
 
 using namespace std;
 
@@ -42,14 +44,16 @@ S_timingItem timingItem::createTimingItem (
   string         description,
   timingItemKind kind,
   clock_t        startClock,
-  clock_t        endClock)
+  clock_t        endClock,
+  long           memoryKB)
 {
   timingItem* o = new timingItem (
     activity,
     description,
     kind,
     startClock,
-    endClock);
+    endClock,
+    memoryKB);
   assert(o!=0);
   return o;
 }
@@ -59,13 +63,15 @@ timingItem::timingItem (
   string         description,
   timingItemKind kind,
   clock_t        startClock,
-  clock_t        endClock)
+  clock_t        endClock,
+  long           memoryKB)
 {
   fActivity    = activity;
   fDescription = description;
   fKind        = kind;
   fStartClock  = startClock;
   fEndClock    = endClock;
+  fMemoryKB    = memoryKB;
 }
 
 timing::timing ()
@@ -74,6 +80,25 @@ timing::timing ()
 timing::~timing ()
 {}
 
+long timing::peakMemoryKB ()
+{
+#ifdef WIN32
+  return -1; // JMI
+#else
+  struct rusage usage;
+
+  if (getrusage (RUSAGE_SELF, &usage) != 0)
+    return -1;
+
+#ifdef __APPLE__
+  // ru_maxrss is in bytes on Mac OS X
+  return usage.ru_maxrss / 1024;
+#else
+  return usage.ru_maxrss;
+#endif
+#endif
+}
+
 
 void timing::appendTimingItem (
   string         activity,
@@ -81,7 +106,8 @@ void timing::appendTimingItem (
   timingItem::timingItemKind
                  kind,
   clock_t        startClock,
-  clock_t        endClock)
+  clock_t        endClock,
+  long           memoryKB)
 {
   S_timingItem
     timingItem =
@@ -90,9 +116,17 @@ void timing::appendTimingItem (
         description,
         kind,
         startClock,
-        endClock);
+        endClock,
+        memoryKB);
     
   fTimingItemsList.push_back (timingItem);
+
+  if (gProfiling ().isActive ())
+    gProfiling ().activityDone (
+      activity,
+      description,
+      kind == timingItem::kMandatory,
+      float(endClock - startClock) / CLOCKS_PER_SEC);
 }
 
 ostream& operator<< (ostream& os, const timing& tim) {
@@ -107,7 +141,18 @@ void timing::print (ostream& os) const
     descriptionWidth  = 31,
     kindWidth         =  9,
     secondsWidth      =  9,
-    secondsPrecision  =  6;
+    secondsPrecision  =  6,
+    memoryWidth       = 11;
+
+  // the memory column is shown only if some activity measured it
+  bool memoryIsKnown = false;
+  
+  for ( list<S_timingItem>::const_iterator i=fTimingItemsList.begin (); i!=fTimingItemsList.end (); i++) {
+    if ((*i)->fMemoryKB >= 0) {
+      memoryIsKnown = true;
+      break;
+    }
+  } // for
 
   clock_t
     totalClock          = 0.0,
@@ -118,11 +163,17 @@ void timing::print (ostream& os) const
     setw (activityWidth) << "Activity" << "  " <<
     setw (descriptionWidth) << "Description" << "  " <<
     setw (kindWidth)     << "Kind" << "  " <<
-    setw (secondsWidth)  << "CPU (sec)" << endl <<
+    setw (secondsWidth)  << "CPU (sec)";
+  if (memoryIsKnown)
+    os << "  " << setw (memoryWidth) << "Memory (KB)";
+  os << endl <<
     setw (activityWidth) << replicateString ("-", activityWidth) << "  " <<
     setw (descriptionWidth) << replicateString ("-", descriptionWidth) << "  " <<
     setw (kindWidth) << replicateString ("-", kindWidth) << "  " <<
-    setw (secondsWidth) << replicateString ("-", secondsWidth) << endl << endl;
+    setw (secondsWidth) << replicateString ("-", secondsWidth);
+  if (memoryIsKnown)
+    os << "  " << setw (memoryWidth) << replicateString ("-", memoryWidth);
+  os << endl << endl;
 
   for ( list<S_timingItem>::const_iterator i=fTimingItemsList.begin (); i!=fTimingItemsList.end (); i++) {
     clock_t timingItemClock = (*i)->fEndClock - (*i)->fStartClock;
@@ -145,7 +196,11 @@ void timing::print (ostream& os) const
 
     os << "  " <<
       setw (secondsWidth) << setprecision(secondsPrecision) <<
-    left << float(timingItemClock) / CLOCKS_PER_SEC << endl;
+    left << float(timingItemClock) / CLOCKS_PER_SEC;
+
+    if ((*i)->fMemoryKB >= 0)
+      os << "  " << setw (memoryWidth) << (*i)->fMemoryKB;
+    os << endl;
   } // for
 
   const int
@@ -186,7 +241,6 @@ void timing::print (ostream& os) const
     endl;
 }
 
-timing timing::gTiming;
 
 //______________________________________________________________________________
 //#define DEBUG_INDENTER
@@ -205,7 +259,7 @@ indenter& indenter::operator++ (const int value)
   fIndent++;
   
 #ifdef DEBUG_INDENTER
-  gLogIOstream <<
+  gLogIOstream () <<
     "% INDENTER: " << fIndent <<
     endl;
 #endif
@@ -218,7 +272,7 @@ indenter& indenter::operator-- (const int value)
   fIndent--;
 
   if (fIndent < 0) {
-    gLogIOstream <<
+    gLogIOstream () <<
       endl <<
       "% ### Indentation has become negative: " <<  fIndent <<
       endl << endl;
@@ -230,7 +284,7 @@ indenter& indenter::operator-- (const int value)
 
 #ifdef DEBUG_INDENTER
   else {
-    gLogIOstream <<
+    gLogIOstream () <<
       "% INDENTER: " << fIndent <<
       endl;
   }
@@ -244,7 +298,7 @@ indenter& indenter::increment (int value)
   fIndent += value;
 
   if (fIndent < 0) {
-    gLogIOstream <<
+    gLogIOstream () <<
       endl <<
       "% ### Indentation has become negative: " <<  fIndent <<
       endl << endl;
@@ -256,7 +310,7 @@ indenter& indenter::increment (int value)
 
 #ifdef DEBUG_INDENTER
   else {
-    gLogIOstream <<
+    gLogIOstream () <<
       "% INDENTER: " << fIndent <<
       endl;
   }
@@ -270,7 +324,7 @@ indenter& indenter::decrement (int value)
   fIndent -= value;
 
   if (fIndent < 0) {
-    gLogIOstream <<
+    gLogIOstream () <<
       endl <<
       "% ### Indentation has become negative: " <<  fIndent <<
       endl << endl;
@@ -282,7 +336,7 @@ indenter& indenter::decrement (int value)
 
 #ifdef DEBUG_INDENTER
   else {
-    gLogIOstream <<
+    gLogIOstream () <<
       "% INDENTER: " << fIndent <<
       endl;
   }
@@ -323,43 +377,6 @@ void indenter::print (ostream& os) const
   while (i-- > 0) os << fSpacer;
 }
 
-indenter indenter::gIndenter;
-
-//______________________________________________________________________________
-indentedOstream indentedOstream::gOutputIndentedOstream (
-  cout, indenter::gIndenter);
-
-indentedOstream indentedOstream::gLogIndentedOstream (
-  cerr, indenter::gIndenter);
-
-// code taken from:
-// http://comp.lang.cpp.moderated.narkive.com/fylLGJgp/redirect-output-to-dev-null
-template<typename Ch, typename Traits = std::char_traits<Ch> >
-struct basic_nullbuf : std::basic_streambuf<Ch, Traits>
-{
-  typedef std::basic_streambuf<Ch, Traits> base_type;
-  typedef typename base_type::int_type int_type;
-  typedef typename base_type::traits_type traits_type;
-  
-  virtual int_type overflow (int_type c) {
-    return traits_type::not_eof (c);
-  }
-};
-
-// convenient typedefs
-typedef basic_nullbuf <char>    nullbuf;
-//typedef basic_nullbuf <wchar_t> wnullbuf;
-
-// buffers and streams
-nullbuf cnull_obj;
-//wnullbuf wcnull_obj;
-
-std::ostream cnull  (& cnull_obj);
-//std::wostream wcnull (& wcnull_obj);
-
-indentedOstream indentedOstream::gNullIndentedOstream (
-  cnull, indenter::gIndenter);
-
 //______________________________________________________________________________
 string replicateString (
   string str,
@@ -584,7 +601,7 @@ int consumeDecimalNumber (
   int    number = 0;
 
   if (! isdigit (*cursor)) {
-    gLogIOstream <<
+    gLogIOstream () <<
       "consumeDecimalNumber (" << *cursor <<
       "), " << *cursor << " is no decimal digit!" <<
       endl;
@@ -592,7 +609,7 @@ int consumeDecimalNumber (
 
   while (isdigit (*cursor)) {
     if (debugMode) {
-      gLogIOstream <<
+      gLogIOstream () <<
         "--> consumeDecimalNumber: cursor = |" <<
         *cursor <<
         "|" <<
@@ -607,7 +624,7 @@ int consumeDecimalNumber (
   remainingStringIterator = cursor;
 
   if (debugMode) {
-    gLogIOstream <<
+    gLogIOstream () <<
       "--> consumeDecimalNumber: number = " << number <<
       ", *remainingStringIterator = |" << *remainingStringIterator <<
       "|" <<
@@ -627,7 +644,7 @@ set<int> decipherNumbersSetSpecification (
   set<int> selectedNumbers;
   
   if (debugMode) {
-    gLogIOstream <<
+    gLogIOstream () <<
       "--> decipherNumbersSetSpecification, theString = |" << theString <<
       "|" <<
       endl;
@@ -638,7 +655,7 @@ set<int> decipherNumbersSetSpecification (
 
   while (1) {
     if (debugMode) {
-      gLogIOstream <<
+      gLogIOstream () <<
         "--> decipherNumbersSpecification: cursor = |" <<
         *cursor << "|" <<
         endl;
@@ -660,7 +677,7 @@ set<int> decipherNumbersSetSpecification (
       cursor++;
 
       if (debugMode) {
-        gLogIOstream <<
+        gLogIOstream () <<
           "--> decipherNumbersSpecification after '-' : cursor = |" <<
           *cursor <<
           "|" <<
@@ -677,7 +694,7 @@ set<int> decipherNumbersSetSpecification (
     }
 
     if (debugMode) {
-      gLogIOstream <<
+      gLogIOstream () <<
         "--> decipherNumbersSpecification, intervalStartNumber = " << intervalStartNumber <<
         ", intervalEndNumber = " << intervalEndNumber <<
         ": *cursor = |" << *cursor << "|" <<
@@ -695,7 +712,7 @@ set<int> decipherNumbersSetSpecification (
 
     if (*cursor != ',') {
       if (debugMode) {
-        gLogIOstream <<
+        gLogIOstream () <<
           "--> decipherNumbersSpecification, after non ',' : cursor = |" <<
           *cursor <<
           "|" <<
@@ -708,7 +725,7 @@ set<int> decipherNumbersSetSpecification (
     cursor++;
 
     if (debugMode) {
-      gLogIOstream <<
+      gLogIOstream () <<
         "--> decipherNumbersSpecification after ',' : cursor = |" <<
         *cursor <<
         "|"
@@ -718,7 +735,7 @@ set<int> decipherNumbersSetSpecification (
   } // while 
 
   if (* cursor != '\0') {
-    gLogIOstream <<
+    gLogIOstream () <<
       "--> Extraneous characters |" << *cursor <<
       "| in numbers spec" <<
       endl << endl;
@@ -735,7 +752,7 @@ list<int> extractNumbersFromString (
   list<int> foundNumbers;
 
   if (debugMode) {
-    gLogIOstream <<
+    gLogIOstream () <<
       "--> extractNumbersFromString, theString = |" << theString <<
       "|" <<
       endl;
@@ -749,7 +766,7 @@ list<int> extractNumbersFromString (
       break;
       
     if (debugMode) {
-      gLogIOstream <<
+      gLogIOstream () <<
         "--> extractNumbersFromString: cursor = |" <<
         *cursor << "|" <<
         endl;
@@ -785,7 +802,7 @@ pair<string, string> extractNamesPairFromString (
   string name2;
 
   if (debugMode) {
-    gLogIOstream <<
+    gLogIOstream () <<
       "--> extractNamesPairFromString, theString = |" << theString <<
       "|" <<
       endl;
@@ -800,7 +817,7 @@ pair<string, string> extractNamesPairFromString (
       break;
       
     if (debugMode) {
-      gLogIOstream <<
+      gLogIOstream () <<
         "--> extractNamesPairFromString: cursor = |" <<
         *cursor << "|" <<
         endl;
@@ -819,14 +836,14 @@ pair<string, string> extractNamesPairFromString (
   name1 = trim (name1);
   if (! name1.size ()) {
     // found an empty name1
-    gLogIOstream <<
+    gLogIOstream () <<
       "### ERROR: the first name before the " << separator <<
       " separator is empty in '" << theString << "'" <<
       endl;
   }
 
   if (cursor == theString.end ())
-    gLogIOstream <<
+    gLogIOstream () <<
       "### ERROR: the " << separator <<
       " separator is missing in string '" <<
       theString << "'" <<
@@ -841,7 +858,7 @@ pair<string, string> extractNamesPairFromString (
       break;
       
     if (debugMode) {
-      gLogIOstream <<
+      gLogIOstream () <<
         "--> extractNamesPairFromString: cursor = |" <<
         *cursor << "|" <<
         endl;
@@ -849,7 +866,7 @@ pair<string, string> extractNamesPairFromString (
 
     if ((*cursor) == '=') {
       // found the separator
-      gLogIOstream <<
+      gLogIOstream () <<
         "### ERROR: the " << separator <<
         " separator occurs more than once in string '" <<
         theString << "'" <<
@@ -865,7 +882,7 @@ pair<string, string> extractNamesPairFromString (
   name2 = trim (name2);
   if (! name2.size ()) {
     // found an empty name2
-    gLogIOstream <<
+    gLogIOstream () <<
       "### ERROR: the second name after the " << separator <<
       " separator is empty in '" << theString << "'" <<
       endl;
@@ -996,7 +1013,7 @@ string singularOrPluralWithoutNumber (
 //______________________________________________________________________________
 void optionError (string errorMessage)
 {
-  gLogIOstream <<
+  gLogIOstream () <<
     endl <<
     "### ERROR in the options:" <<
     endl <<
@@ -1057,7 +1074,7 @@ void splitRegularStringContainingEndOfLines (
 //#define DEBUG_SPLITTING
 
 #ifdef DEBUG_SPLITTING
-  gLogIOstream <<
+  gLogIOstream () <<
     "---> splitting |" << theString << "|" <<
     endl <<
     endl;
@@ -1096,7 +1113,7 @@ void splitRegularStringContainingEndOfLines (
         chunk);
 
 #ifdef DEBUG_SPLITTING
-      gLogIOstream <<
+      gLogIOstream () <<
         "theStringSize = " << theStringSize <<
         endl <<
         "currentPosition = " << currentPosition <<
@@ -1141,7 +1158,7 @@ void splitRegularStringContainingEndOfLines (
         theString.substr (
           currentPosition);
 
-      gLogIOstream <<
+      gLogIOstream () <<
         "theStringSize = " << theStringSize <<
         endl <<
         "currentPosition = " << currentPosition <<
@@ -1168,7 +1185,7 @@ void splitHTMLStringContainingEndOfLines (
 //#define DEBUG_SPLITTING
 
 #ifdef DEBUG_SPLITTING
-  gLogIOstream <<
+  gLogIOstream () <<
     "---> splitting |" << theString << "|" <<
     endl <<
     endl;
@@ -1225,7 +1242,7 @@ void splitHTMLStringContainingEndOfLines (
         chunk);
 
 #ifdef DEBUG_SPLITTING
-      gLogIOstream <<
+      gLogIOstream () <<
         "theStringSize = " << theStringSize <<
         endl <<
         "currentPosition = " << currentPosition <<
@@ -1270,7 +1287,7 @@ void splitHTMLStringContainingEndOfLines (
         theString.substr (
           currentPosition);
 
-      gLogIOstream <<
+      gLogIOstream () <<
         "theStringSize = " << theStringSize <<
         endl <<
         "currentPosition = " << currentPosition <<
@@ -1376,7 +1393,7 @@ bool IConv::convert (char* input, char* output, size_t& outputSize)
   size_t outBytesLeft = fOutputBufferSize;
 
   if (doTrace) {
-    gLogIOstream <<
+    gLogIOstream () <<
       "saveInputSize = " << saveInputSize <<
       endl <<
       "fInputBufferSize = " << fInputBufferSize <<
@@ -1395,7 +1412,7 @@ bool IConv::convert (char* input, char* output, size_t& outputSize)
     const size_t newSize = saveInputSize + 1;
     
     if (doTrace) {
-      gLogIOstream <<
+      gLogIOstream () <<
         "Bringing fInputBuffer from " <<
         fInputBufferSize <<
         " to " <<
@@ -1418,7 +1435,7 @@ bool IConv::convert (char* input, char* output, size_t& outputSize)
   
   if (fOutputBufferSize < twiceAsMuch) {
     if (doTrace) {
-      gLogIOstream <<
+      gLogIOstream () <<
         "Bringing fOutputBuffer from " <<
         fOutputBufferSize <<
         " to " <<
@@ -1437,7 +1454,7 @@ bool IConv::convert (char* input, char* output, size_t& outputSize)
   }
 
   if (doTrace) {
-    gLogIOstream <<
+    gLogIOstream () <<
       "saveInputSize = " << saveInputSize <<
       endl <<
       "fInputBufferSize = " << fInputBufferSize <<
@@ -1453,7 +1470,7 @@ bool IConv::convert (char* input, char* output, size_t& outputSize)
 
   // do the conversion
   if (doTrace) {
-    gLogIOstream <<
+    gLogIOstream () <<
       "Doing the encoding conversion" <<
       endl <<
       endl;
@@ -1472,7 +1489,7 @@ bool IConv::convert (char* input, char* output, size_t& outputSize)
         &outputBufferAux, &outBytesLeft);
 
   if (doTrace) {
-    gLogIOstream <<
+    gLogIOstream () <<
       "saveInputSize = " << saveInputSize <<
       endl <<
       "fInputBuffer = *" << fInputBuffer << "*" <<
@@ -1522,7 +1539,7 @@ bool IConv::convert (std::string& input, std::string& output)
   
   if (fOutputBufferSize < twiceAsMuch) {
     if (doTrace) {
-      gLogIOstream <<
+      gLogIOstream () <<
         "Bringing fOutputBuffer from " <<
         fOutputBufferSize <<
         " to " <<
@@ -1541,7 +1558,7 @@ bool IConv::convert (std::string& input, std::string& output)
   }
 
   if (doTrace) {
-    gLogIOstream <<
+    gLogIOstream () <<
       "input = *" << input << "*" <<
       endl <<
       "saveInputSize = " << saveInputSize <<
@@ -1574,7 +1591,7 @@ bool IConv::convert (std::string& input, std::string& output)
 
   
   if (doTrace) {
-    gLogIOstream <<
+    gLogIOstream () <<
       "fInputBuffer = *" << fInputBuffer << "*" <<
       endl <<
       "inputBufferAux = *" << inputBufferAux << "*" <<
@@ -1847,15 +1864,15 @@ int main(int argc, char **argv)
     size_t outsize = BUF_SIZE; // you will need it
           
     if (iConverter.convert (flute, result, outsize)) {
-      gLogIOstream <<
+      gLogIOstream () <<
         "Buffer iconv result = |" << result << "|";
     }
     else {
-      gLogIOstream <<
+      gLogIOstream () <<
         "ERROR in icon()";
     }
     
-    gLogIOstream <<
+    gLogIOstream () <<
       endl <<
       endl;
   }
@@ -1867,15 +1884,15 @@ int main(int argc, char **argv)
     IConv iConverter ("ISO-8859-1", "UTF8");
       
     if (iConverter.convert (flute, result)) {
-      gLogIOstream <<
+      gLogIOstream () <<
         "String iconv result = |" << result << "|";
     }
     else {
-      gLogIOstream <<
+      gLogIOstream () <<
         "ERROR in icon()";
     }
     
-    gLogIOstream <<
+    gLogIOstream () <<
       endl <<
       endl;
   }
@@ -1887,11 +1904,11 @@ int main(int argc, char **argv)
     IConv iConverter ("ISO-8859-1", "UTF8");
 
     if (iConverter.convert (flute, result)) {
-      gLogIOstream <<
+      gLogIOstream () <<
         "String iconv result = |" << result << "|";
     }
     else {
-      gLogIOstream <<
+      gLogIOstream () <<
         "ERROR in icon()";
 / * JMI
       if (errno == EINVAL)
@@ -1902,7 +1919,7 @@ int main(int argc, char **argv)
 * /
     }
     
-    gLogIOstream <<
+    gLogIOstream () <<
       endl <<
       endl;
   }
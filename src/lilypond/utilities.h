@@ -55,20 +55,25 @@ class EXP timingItem : public smartable
       std::string    description,
       timingItemKind kind,
       std::clock_t   startClock,
-      std::clock_t   endClock);
+      std::clock_t   endClock,
+      long           memoryKB = -1);
 
     timingItem (
       std::string    activity,
       std::string    description,
       timingItemKind kind,
       std::clock_t   startClock,
-      std::clock_t   endClock);
+      std::clock_t   endClock,
+      long           memoryKB = -1);
       
     std::string           fActivity;
     std::string           fDescription;
     timingItemKind        fKind;
     clock_t               fStartClock;
     clock_t               fEndClock;
+
+    // the growth of the peak memory use during the activity, -1 if unknown
+    long                  fMemoryKB;
 };
 
 typedef SMARTP<timingItem> S_timingItem;
@@ -78,8 +83,8 @@ class EXP timing {
        timing ();
     virtual ~timing ();
 
-    // global variable for general use
-    static timing gTiming; 
+    // the peak memory use of the process so far, -1 if unknown
+    static long           peakMemoryKB ();
 
     // add an item
     void                  appendTimingItem (
@@ -88,7 +93,8 @@ class EXP timing {
                             timingItem::timingItemKind
                                            kind,
                             clock_t        startClock,
-                            clock_t        endClock);
+                            clock_t        endClock,
+                            long           memoryKB = -1);
       
     // print
     void                  print (std::ostream& os) const;
@@ -100,6 +106,9 @@ class EXP timing {
 };
 std::ostream& operator<< (std::ostream& os, const timing& tim);
 
+// gTiming () is that of the current conversion context, see
+// conversionContext.h
+
 //______________________________________________________________________________
 class EXP indenter
 {
@@ -139,18 +148,14 @@ class EXP indenter
     // indent a multiline 'R"(...)"' std::string
     std::string                indentMultiLineString (std::string value);
     
-    // global variable for general use
-    static indenter       gIndenter; 
-
   private:
     int                   fIndent;
     std::string           fSpacer;
 };
 std::ostream& operator<< (std::ostream& os, const indenter& idtr);
 
-// useful shortcut macros
-#define gIndenter indenter::gIndenter
-#define gTab      indenter::gIndenter.getSpacer ()
+// gIndenter () and gTab () are those of the current conversion context,
+// see conversionContext.h
 
 //______________________________________________________________________________
 class EXP indentedOstream: public std::ostream
@@ -177,31 +182,64 @@ Usage:
       std::ostream& fOutput;
       indenter&     fIndenter;
 
+      // when buffered, the indented lines are batched in fBuffer
+      // and written to fOutput only when it is large enough
+      bool          fBuffered;
+      std::string   fBuffer;
+
+      enum { kBufferSize = 64 * 1024 };
+
+      // write the batched lines to fOutput
+      void writeBuffer ()
+          {
+            fOutput.write (fBuffer.data (), fBuffer.size ());
+            fBuffer.clear ();
+          }
+          
     public:
     
       // constructor
       indentedStreamBuf (
         std::ostream& str,
-        indenter&     idtr)
+        indenter&     idtr,
+        bool          buffered)
         : fOutput (str),
-          fIndenter (idtr)
-          {}
+          fIndenter (idtr),
+          fBuffered (buffered)
+          {
+            if (fBuffered)
+              fBuffer.reserve (kBufferSize);
+          }
 
       // flush
       void flush ()
           {
+            if (fBuffer.size ())
+              writeBuffer ();
             fOutput.flush ();
           }
     
       // When we sync the stream with fOutput:
       // 1) output the indentation then the buffer
       // 2) reset the buffer
-      // 3) flush the actual output stream we are using.
+      // 3) flush the actual output stream we are using,
+      //    or batch the line when buffered
       virtual int sync ()
           {
-            fOutput << fIndenter << str ();
-            str ("");
-            fOutput.flush ();
+            if (fBuffered) {
+              std::string spacer = fIndenter.getSpacer ();
+              for (int i = fIndenter.getIndent (); i > 0; i--)
+                fBuffer += spacer;
+              fBuffer += str ();
+              str ("");
+              if (fBuffer.size () >= kBufferSize)
+                writeBuffer ();
+            }
+            else {
+              fOutput << fIndenter << str ();
+              str ("");
+              fOutput.flush ();
+            }
             return 0;
           }
   };
@@ -213,17 +251,22 @@ Usage:
   public:
   
     // constructor
+    // a buffered stream doesn't flush the actual output stream at each line:
+    // lines are written by large chunks, and flushed on request or on destruction
     indentedOstream (
       std::ostream&  str,
-      indenter&      idtr)
+      indenter&      idtr,
+      bool           buffered = false)
       : std::ostream (&fIndentedStreamBuf),
         fIndentedStreamBuf (
-          str, idtr)
+          str, idtr, buffered)
       {}
 
     // destructor
     virtual ~indentedOstream ()
-        {};
+        {
+          fIndentedStreamBuf.flush ();
+        };
 
     // flush
     void flush ()
@@ -231,19 +274,10 @@ Usage:
           fIndentedStreamBuf.flush ();
         }
     
-    // global variables for general use
-    static indentedOstream
-                          gOutputIndentedOstream; 
-    static indentedOstream
-                          gLogIndentedOstream; 
-    static indentedOstream
-                          gNullIndentedOstream; 
 };
 
-// useful shortcut macros
-#define gOutputIOstream indentedOstream::gOutputIndentedOstream
-#define gLogIOstream    indentedOstream::gLogIndentedOstream
-#define gNullIOstream   indentedOstream::gNullIndentedOstream
+// gOutputIOstream (), gLogIOstream () and gNullIOstream () are those of
+// the current conversion context, see conversionContext.h
 
 //______________________________________________________________________________
 struct stringQuoteEscaper
@@ -560,4 +594,8 @@ typedef SMARTP<OFdnStreambuf> S_OFdnStreambuf;
 } // namespace MusicXML2
 
 
+// the accessors to the current conversion context
+#include "conversionContext.h"
+
+
 #endif
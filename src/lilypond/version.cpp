@@ -24,8 +24,6 @@ namespace MusicXML2
 {
 
 //______________________________________________________________________________
-list<versionInfo> gVersionInfoList;
-
 versionInfo::versionInfo (
   string versionNumber,
   string versionDate,
@@ -42,30 +40,37 @@ versionInfo::~versionInfo ()
 void versionInfo::print (ostream& os) const
 {
   os << left <<
-    indenter::gIndenter <<
+    gIndenter () <<
       setw (5) << fVersionNumber << " " <<
       "(" << fVersionDate << "):" <<
       endl <<
     
-  indenter::gIndenter++;
+  gIndenter ()++;
 
   os <<
-    indenter::gIndenter <<
+    gIndenter () <<
       fVersionDescription;
 
-  indenter::gIndenter--;  
+  gIndenter ()--;  
 }
 
-void enlistVersion (
-  string versionNumber,
-  string versionDate,
-  string versionDescription)
+//______________________________________________________________________________
+// the history is built once, at the first call, and never modified:
+// it can be shared by concurrent conversions
+static const list<versionInfo>& versionsHistory ()
 {
-  gVersionInfoList.push_front (
+  static const list<versionInfo> history = {
+    // most recent first
+    versionInfo (
+      "0.9", "October 2018",
+      "First draft version"),
+    
     versionInfo (
-      versionNumber,
-      versionDate,
-      versionDescription));
+      "Initial", "early 2016",
+      "Start as a clone of xml2guido")
+  };
+  
+  return history;
 }
 
 void printVersionsHistory (ostream& os)
@@ -74,11 +79,11 @@ void printVersionsHistory (ostream& os)
     "Versions history:" <<
     endl << endl;
 
-  indenter::gIndenter++;
+  gIndenter ()++;
 
   list<versionInfo>::const_iterator
-    iBegin = gVersionInfoList.begin (),
-    iEnd   = gVersionInfoList.end (),
+    iBegin = versionsHistory ().begin (),
+    iEnd   = versionsHistory ().end (),
     i      = iBegin;
   for ( ; ; ) {
     (*i).print (os);
@@ -89,13 +94,13 @@ void printVersionsHistory (ostream& os)
   os <<
     endl << endl;
 
-  indenter::gIndenter--;
+  gIndenter ()--;
 }
 
 string currentVersionNumber ()
 {
   return
-    gVersionInfoList.front ().fVersionNumber;
+    versionsHistory ().front ().fVersionNumber;
 }
 
 
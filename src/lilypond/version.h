@@ -42,13 +42,6 @@ class EXP versionInfo
     std::string           fVersionDescription;
 };
 
-extern std::list<versionInfo> gVersionInfoList;
-
-void enlistVersion (
-  std::string versionNumber,
-  std::string versionDate,
-  std::string versionDescription);
-
 void printVersionsHistory (std::ostream& os);
 
 std::string EXP currentVersionNumber ();
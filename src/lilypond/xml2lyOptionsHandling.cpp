@@ -74,19 +74,19 @@ void xml2lyOptionsVersionItem::print (ostream& os) const
     "xml2lyOptionsVersionItem:" <<
     endl;
 
-  gIndenter++;
+  gIndenter ()++;
 
   optionsElement::printElementEssentials (
     os, fieldWidth);
 
-  gIndenter++;
+  gIndenter ()++;
   os <<
-    gIndenter.indentMultiLineString (
+    gIndenter ().indentMultiLineString (
       fOptionsElementDescription) <<
     endl;
-  gIndenter--;
+  gIndenter ()--;
 
-  gIndenter--;
+  gIndenter ()--;
 }
 
 void xml2lyOptionsVersionItem::printVersion (ostream& os) const
@@ -151,19 +151,19 @@ void xml2lyOptionsAboutItem::print (ostream& os) const
     "xml2lyOptionsAboutItem:" <<
     endl;
 
-  gIndenter++;
+  gIndenter ()++;
 
   optionsElement::printElementEssentials (
     os, fieldWidth);
 
-  gIndenter++;
+  gIndenter ()++;
   os <<
-    gIndenter.indentMultiLineString (
+    gIndenter ().indentMultiLineString (
       fOptionsElementDescription) <<
     endl;
-  gIndenter--;
+  gIndenter ()--;
 
-  gIndenter--;
+  gIndenter ()--;
 }
 
 void xml2lyOptionsAboutItem::printAbout (ostream& os) const
@@ -241,19 +241,19 @@ void xml2lyOptionsContactItem::print (ostream& os) const
     "xml2lyOptionsContactItem:" <<
     endl;
 
-  gIndenter++;
+  gIndenter ()++;
 
   optionsElement::printElementEssentials (
     os, fieldWidth);
 
-  gIndenter++;
+  gIndenter ()++;
   os <<
-    gIndenter.indentMultiLineString (
+    gIndenter ().indentMultiLineString (
       fOptionsElementDescription) <<
     endl;
-  gIndenter--;
+  gIndenter ()--;
 
-  gIndenter--;
+  gIndenter ()--;
 }
 
 void xml2lyOptionsContactItem::printContact (ostream& os) const
@@ -353,13 +353,13 @@ void xml2lyOptionsHandler::initializeOptionsHandler ()
     this);
     
 #ifdef TRACE_OPTIONS
-  if (gTraceOptions->fTraceOptions && ! gGeneralOptions->fQuiet) {
+  if (gTraceOptions ()->fTraceOptions && ! gGeneralOptions ()->fQuiet) {
     // print the options handler initial state
     fOptionsHandlerLogIOstream <<
       "xml2lyOptionsHandler has been initialized as:" <<
       endl;
   
-    gIndenter++;
+    gIndenter ()++;
   
     print (
       fOptionsHandlerLogIOstream);
@@ -367,7 +367,7 @@ void xml2lyOptionsHandler::initializeOptionsHandler ()
       endl <<
       endl;
     
-    gIndenter--;
+    gIndenter ()--;
   }
 #endif
 
@@ -377,7 +377,7 @@ void xml2lyOptionsHandler::initializeOptionsHandler ()
     registerOptionsHandlerInItself ();
 
 #ifdef TRACE_OPTIONS
-  if (gTraceOptions->fTraceOptions && ! gGeneralOptions->fQuiet) {
+  if (gTraceOptions ()->fTraceOptions && ! gGeneralOptions ()->fQuiet) {
     fOptionsHandlerLogIOstream <<
       "xml2lyOptionsHandler help:" <<
       endl;
@@ -395,7 +395,7 @@ void xml2lyOptionsHandler::checkOptionsAndArguments ()
     fArgumentsVector.size ();
 
 #ifdef TRACE_OPTIONS
-  if (gTraceOptions->fTraceOptions && ! gGeneralOptions->fQuiet) {
+  if (gTraceOptions ()->fTraceOptions && ! gGeneralOptions ()->fQuiet) {
     if (argumentsNumber > 0) {
       fOptionsHandlerLogIOstream <<
         singularOrPluralWithoutNumber (
@@ -408,7 +408,7 @@ void xml2lyOptionsHandler::checkOptionsAndArguments ()
         ":" <<
         endl;
 
-      gIndenter++;
+      gIndenter ()++;
       
       for (unsigned int i = 0; i < argumentsNumber; i++) {
         fOptionsHandlerLogIOstream <<
@@ -419,7 +419,7 @@ void xml2lyOptionsHandler::checkOptionsAndArguments ()
       fOptionsHandlerLogIOstream <<
         endl;
 
-      gIndenter--;
+      gIndenter ()--;
     }
     else {
       fOptionsHandlerLogIOstream <<
@@ -435,7 +435,7 @@ void xml2lyOptionsHandler::checkOptionsAndArguments ()
   switch (argumentsNumber) {
     case 1 :
       // register intput file name
-      gXml2lyOptions->fInputSourceName =
+      gXml2lyOptions ()->fInputSourceName =
         fArgumentsVector [0];
       break;
 
@@ -455,12 +455,12 @@ void xml2lyOptionsHandler::checkOptionsAndArguments ()
 
   string potentialOutputFileName;
     
-  if (gXml2lyOptions->fInputSourceName != "-") {
+  if (gXml2lyOptions ()->fInputSourceName != "-") {
     // determine potential output file name,
     // may be set differently by '--ofn, --outputFileName' option
     potentialOutputFileName =
       baseName (
-        gXml2lyOptions->fInputSourceName);
+        gXml2lyOptions ()->fInputSourceName);
 
     // set '.ly' suffix
     size_t
@@ -475,11 +475,48 @@ void xml2lyOptionsHandler::checkOptionsAndArguments ()
     }
   }
 
+  // check batch option usage
+  // ------------------------------------------------------
+
+  if (gXml2lyOptions ()->fBatch) {
+    if (
+      gXml2lyOptions ()->fOutputFileName.size ()
+        ||
+      gXml2lyOptions ()->fAutoOutputFile
+    ) {
+      stringstream s;
+  
+      s <<
+        "option '-batch, -batch-conversion' cannot be used"  <<
+        endl <<
+        "with '-o, -output-filename' or '-aof, -auto-output-filename',"  <<
+        endl <<
+        "use '-od, -output-directory' instead";
+        
+      optionError (s.str ());
+
+      exit (5);
+    }
+
+    else if (gXml2lyOptions ()->fInputSourceName == "-") {
+      stringstream s;
+  
+      s <<
+        "option '-batch, -batch-conversion'"  <<
+        endl <<
+        "cannot be used when reading from standard input";
+        
+      optionError (s.str ());
+
+      exit (5);
+    }
+  }
+
   // check auto output file option usage
   // ------------------------------------------------------
 
-  if (gXml2lyOptions->fAutoOutputFile) {
-    if (gXml2lyOptions->fOutputFileName.size ()) {
+  if (gXml2lyOptions ()->fAutoOutputFile) {
+    if (gXml2lyOptions ()->fOutputFileName.size ()) {
       stringstream s;
   
       s <<
@@ -492,7 +529,7 @@ void xml2lyOptionsHandler::checkOptionsAndArguments ()
       exit (3);
     }
   
-    else if (gXml2lyOptions->fInputSourceName == "-") {
+    else if (gXml2lyOptions ()->fInputSourceName == "-") {
       stringstream s;
   
       s <<
@@ -506,20 +543,20 @@ void xml2lyOptionsHandler::checkOptionsAndArguments ()
     }
 
     else {
-      gXml2lyOptions->fOutputFileName =
+      gXml2lyOptions ()->fOutputFileName =
         potentialOutputFileName;
     }
   }
 
-  // register command line informations in gGeneralOptions
+  // register command line informations in gGeneralOptions ()
   // ------------------------------------------------------
 
-  gGeneralOptions->fProgramName =
+  gGeneralOptions ()->fProgramName =
     fProgramName;
 
-  gGeneralOptions->fCommandLineWithShortOptions =
+  gGeneralOptions ()->fCommandLineWithShortOptions =
     fCommandLineWithShortOptions;
-  gGeneralOptions->fCommandLineWithLongOptions =
+  gGeneralOptions ()->fCommandLineWithLongOptions =
     fCommandLineWithLongOptions;
 }
 
@@ -527,29 +564,29 @@ void xml2lyOptionsHandler::checkOptionsAndArguments ()
 void xml2lyOptionsHandler::enforceOptionsHandlerQuietness ()
 {
 #ifdef TRACE_OPTIONS
-  gTraceOptions->
+  gTraceOptions ()->
     enforceQuietness ();
 #endif
   
-  gGeneralOptions->
+  gGeneralOptions ()->
     enforceQuietness ();
   
-  gMusicXMLOptions->
+  gMusicXMLOptions ()->
     enforceQuietness ();
   
-  gMsrOptions->
+  gMsrOptions ()->
     enforceQuietness ();
   
-  gLpsrOptions->
+  gLpsrOptions ()->
     enforceQuietness ();
   
-  gLilypondOptions->
+  gLilypondOptions ()->
     enforceQuietness ();
   
-  gExtraOptions->
+  gExtraOptions ()->
     enforceQuietness ();
   
-  gXml2lyOptions->
+  gXml2lyOptions ()->
     enforceQuietness ();
 }
 
@@ -560,33 +597,33 @@ void xml2lyOptions::enforceQuietness ()
 //______________________________________________________________________________
 void xml2lyOptions::checkOptionsConsistency ()
 {
-  gLogIOstream <<
+  gLogIOstream () <<
     "xml2lyOptions::checkOptionsConsistency ()" <<
     endl;
     
 #ifdef TRACE_OPTIONS
-  gTraceOptions->
+  gTraceOptions ()->
     checkOptionsConsistency ();
 #endif
-  gGeneralOptions->
+  gGeneralOptions ()->
     checkOptionsConsistency ();
   
-  gMusicXMLOptions->
+  gMusicXMLOptions ()->
     checkOptionsConsistency ();
   
-  gMsrOptions->
+  gMsrOptions ()->
     checkOptionsConsistency ();
   
-  gLpsrOptions->
+  gLpsrOptions ()->
     checkOptionsConsistency ();
   
-  gLilypondOptions->
+  gLilypondOptions ()->
     checkOptionsConsistency ();
   
-  gExtraOptions->
+  gExtraOptions ()->
     checkOptionsConsistency ();
   
-  gXml2lyOptions->
+  gXml2lyOptions ()->
     checkOptionsConsistency ();
 }
 
@@ -599,7 +636,7 @@ void xml2lyOptionsHandler::print (ostream& os) const
     "xml2lyOptionsHandler:" <<
     endl;
 
-  gIndenter++;
+  gIndenter ()++;
 
   os << left <<
     setw (fieldWidth) <<
@@ -623,7 +660,7 @@ void xml2lyOptionsHandler::print (ostream& os) const
   if (fOptionsHandlerOptionsGroupsList.size ()) {
     os << endl;
     
-    gIndenter++;
+    gIndenter ()++;
 
     list<S_optionsGroup>::const_iterator
       iBegin = fOptionsHandlerOptionsGroupsList.begin (),
@@ -636,10 +673,10 @@ void xml2lyOptionsHandler::print (ostream& os) const
       os << endl;
     } // for
 
-    gIndenter--;
+    gIndenter ()--;
   }
 
-  gIndenter--;
+  gIndenter ()--;
   
   os << endl;
 }
@@ -651,8 +688,6 @@ ostream& operator<< (ostream& os, const S_xml2lyOptionsHandler& elt)
 }
 
 //_______________________________________________________________________________
-S_xml2lyOptions gXml2lyOptions;
-
 S_xml2lyOptions xml2lyOptions::create (
   S_optionsHandler optionsHandler)
 {
@@ -693,13 +728,18 @@ void xml2lyOptions::initializeXml2lyOptions ()
 
   {
     time_t      translationRawtime;
-    struct tm*  translationTimeinfo;
+    struct tm   translationTimeinfo;
     char buffer [80];
   
     time (&translationRawtime);
-    translationTimeinfo = localtime (&translationRawtime);
+    // localtime () returns a static buffer shared by the threads
+#ifdef WIN32
+    localtime_s (&translationTimeinfo, &translationRawtime);
+#else
+    localtime_r (&translationRawtime, &translationTimeinfo);
+#endif
   
-    strftime (buffer, 80, "%A %F @ %T %Z", translationTimeinfo);
+    strftime (buffer, 80, "%A %F @ %T %Z", &translationTimeinfo);
     fTranslationDate = buffer;
   }
 
@@ -827,24 +867,86 @@ or adding '.ly' if none is present.)",
           "autoOutputFileName",
           fAutoOutputFile));
   }
+
+
+  // batch
+  // --------------------------------------
+
+  {
+    // variables  
+  
+    fBatch = false;
+    fJobs  = 0;
+    fOutputDirectoryName = ".";
+    
+    // options
+  
+    S_optionsSubGroup
+      batchSubGroup =
+        optionsSubGroup::create (
+          "Batch",
+          "hxb", "help=xml2ly-batch",
+R"()",
+        optionsSubGroup::kAlwaysShowDescription,
+        this);
+            
+    appendOptionsSubGroup (batchSubGroup);
+    
+    batchSubGroup->
+      appendOptionsItem (
+        optionsBooleanItem::create (
+          "batch", "batch-conversion",
+R"(Convert many files in one run: the argument is either a manifest file
+listing the MusicXML files, one per line, or a directory
+whose '.xml', '.musicxml' and '.mxl' files are converted.
+Each file is converted with the other options to a file in the output directory,
+and the failures don't stop the conversion of the other files.
+A report of the conversions is written to standard error at the end.)",
+          "batch",
+          fBatch));
+  
+    batchSubGroup->
+      appendOptionsItem (
+        optionsIntegerItem::create (
+          "jobs", "batch-jobs",
+R"(Convert N files at the same time in batch mode.
+The default is the number of processor cores.)",
+          "N",
+          "jobs",
+          fJobs));
+  
+    batchSubGroup->
+      appendOptionsItem (
+        optionsStringItem::create (
+          "od", "output-directory",
+R"(Write the LilyPond code to directory 'dirName' in batch mode,
+the files names are derived from those of the input files
+as with '-aof, -auto-output-filename'.
+Input files with the same name in different directories are
+prefixed with their directories names, e.g. 'misc_Repeat.ly'.
+The default is the current working directory.)",
+          "dirName",
+          "outputDirectoryName",
+          fOutputDirectoryName));
+  }
 }
 
 void xml2lyOptions::printXml2lyOptionsValues (int fieldWidth)
 {  
-  gLogIOstream <<
+  gLogIOstream () <<
     "The xml2ly options are:" <<
     endl;
 
-  gIndenter++;
+  gIndenter ()++;
 
   // command line
   // --------------------------------------
 
-  gLogIOstream << left <<
+  gLogIOstream () << left <<
 
-  gIndenter++;
+  gIndenter ()++;
 
-  gLogIOstream << left <<
+  gLogIOstream () << left <<
     setw (fieldWidth) << "input source name" << " : " <<
     fInputSourceName <<
     endl <<
@@ -853,18 +955,18 @@ void xml2lyOptions::printXml2lyOptionsValues (int fieldWidth)
     fTranslationDate <<
     endl;
 
-  gIndenter--;
+  gIndenter ()--;
 
   // output file
   // --------------------------------------
 
-  gLogIOstream << left <<
+  gLogIOstream () << left <<
     setw (fieldWidth) << "Output file:" <<
     endl;
 
-  gIndenter++;
+  gIndenter ()++;
 
-  gLogIOstream << left <<        
+  gLogIOstream () << left <<        
     setw (fieldWidth) << "inputSourceName" << " : \"" <<
     fInputSourceName <<
     "\"" <<
@@ -874,7 +976,30 @@ void xml2lyOptions::printXml2lyOptionsValues (int fieldWidth)
     "\"" <<
     endl;
 
-  gIndenter--;
+  gIndenter ()--;
+
+  // batch
+  // --------------------------------------
+
+  gLogIOstream () << left <<
+    setw (fieldWidth) << "Batch:" <<
+    endl;
+
+  gIndenter ()++;
+
+  gLogIOstream () << left <<        
+    setw (fieldWidth) << "batch" << " : " <<
+    booleanAsString (fBatch) <<
+    endl <<
+    setw (fieldWidth) << "jobs" << " : " <<
+    fJobs <<
+    endl <<
+    setw (fieldWidth) << "outputDirectoryName" << " : \"" <<
+    fOutputDirectoryName <<
+    "\"" <<
+    endl;
+
+  gIndenter ()--;
 }
 
 S_optionsItem xml2lyOptions::handleOptionsItem (
@@ -884,7 +1009,7 @@ S_optionsItem xml2lyOptions::handleOptionsItem (
   S_optionsItem result;
   
 #ifdef TRACE_OPTIONS
-  if (gTraceOptions->fTraceOptions && ! gGeneralOptions->fQuiet) {
+  if (gTraceOptions ()->fTraceOptions && ! gGeneralOptions ()->fQuiet) {
     os <<
       "---> Handling options item '" <<
       item <<
@@ -900,7 +1025,7 @@ S_optionsItem xml2lyOptions::handleOptionsItem (
         dynamic_cast<xml2lyOptionsVersionItem*>(&(*item))
     ) {
 #ifdef TRACE_OPTIONS
-    if (gTraceOptions->fTraceOptions && ! gGeneralOptions->fQuiet) {
+    if (gTraceOptions ()->fTraceOptions && ! gGeneralOptions ()->fQuiet) {
       os <<
         "==> optionsItem is of type 'optionsVersionItem'" <<
         endl;
@@ -922,7 +1047,7 @@ S_optionsItem xml2lyOptions::handleOptionsItem (
         dynamic_cast<xml2lyOptionsAboutItem*>(&(*item))
     ) {
 #ifdef TRACE_OPTIONS
-    if (gTraceOptions->fTraceOptions && ! gGeneralOptions->fQuiet) {
+    if (gTraceOptions ()->fTraceOptions && ! gGeneralOptions ()->fQuiet) {
       os <<
         "==> optionsItem is of type 'optionsAboutItem'" <<
         endl;
@@ -944,7 +1069,7 @@ S_optionsItem xml2lyOptions::handleOptionsItem (
         dynamic_cast<xml2lyOptionsContactItem*>(&(*item))
     ) {
 #ifdef TRACE_OPTIONS
-    if (gTraceOptions->fTraceOptions && ! gGeneralOptions->fQuiet) {
+    if (gTraceOptions ()->fTraceOptions && ! gGeneralOptions ()->fQuiet) {
       os <<
         "==> optionsItem is of type 'optionsContactItem'" <<
         endl;
@@ -966,23 +1091,12 @@ S_optionsItem xml2lyOptions::handleOptionsItem (
 void initializeXml2lyOptionsHandling (
   S_optionsHandler optionsHandler)
 {  
-  // enlist versions information
-  // ------------------------------------------------------
-
-  enlistVersion (
-    "Initial", "early 2016",
-    "Start as a clone of xml2guido");
-    
-  enlistVersion (
-    "0.9", "October 2018",
-    "First draft version");
-  
   // create the options variables
   // ------------------------------------------------------
   
-  gXml2lyOptions = xml2lyOptions::create (
+  gXml2lyOptions () = xml2lyOptions::create (
     optionsHandler);
-  assert (gXml2lyOptions != 0);
+  assert (gXml2lyOptions () != 0);
 
   
 }
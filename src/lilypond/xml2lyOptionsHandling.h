@@ -299,12 +299,21 @@ class xml2lyOptions : public optionsGroup
     string                fOutputFileName;
     bool                  fAutoOutputFile;
 
+
+    // batch
+    // --------------------------------------
+
+    bool                  fBatch;
+    int                   fJobs;
+    string                fOutputDirectoryName;
+
     
 };
 typedef SMARTP<xml2lyOptions> S_xml2lyOptions;
 EXP ostream& operator<< (ostream& os, const S_xml2lyOptions& elt);
 
-EXP extern S_xml2lyOptions gXml2lyOptions;
+// gXml2lyOptions () is that of the current conversion context, see
+// conversionContext.h
 
 //______________________________________________________________________________
 void initializeXml2lyOptionsHandling (
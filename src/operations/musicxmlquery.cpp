@@ -127,7 +127,7 @@ namespace MusicXML2
     //________________________________________________________________________
     void musicxmlQuery::visitStart ( S_part& elt)
     {
-        currentPart = elt->getAttributeValue("id");
+        currentPart = elt->getAttributeValue(attributeNames::id);
         stavesInPart[currentPart] = 1;
     }
     
@@ -332,7 +332,7 @@ void transposition::visitEnd ( S_encoding& elt )
 				Sxmlattribute attr = i->getAttribute("element");
 				if (attr) {
 					if (attr->getValue() == "stem") {
-						Sxmlattribute type = i->getAttribute("type");
+						Sxmlattribute type = i->getAttribute(attributeNames::type);
 						if (type) {
 							type->setValue ("no");
 							nostem = true;
@@ -340,7 +340,7 @@ void transposition::visitEnd ( S_encoding& elt )
 						else next = elt->erase(i);
 					}
 					if (attr->getValue() == "accidental") {
-						Sxmlattribute type = i->getAttribute("type");
+						Sxmlattribute type = i->getAttribute(attributeNames::type);
 						if (type) {
 							type->setValue ("no");
 							doacc = true;
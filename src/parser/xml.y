@@ -18,55 +18,55 @@
 
 using namespace std;
 
-int yyline = 1;
+#define MAXLEN	1024
+#define VLEN	256
+
+// the state of a parse: the parser is a pure parser and the scanner state
+// is thread local, thus different threads can parse concurrently
+struct parsecontext {
+	reader * fReader;
+	int  xmlStandalone;
+	char attributeName[MAXLEN];
+	char attributeVal[MAXLEN];
+	char xmlversion[VLEN];
+	char xmlencoding[MAXLEN];
+	char eltName[MAXLEN];
+	char doctypeStart[MAXLEN];
+	char doctypePub[MAXLEN];
+	char doctypeSys[MAXLEN];
+};
 
 #ifdef __cplusplus
 extern "C" {
 #endif
-//int		yyparse (void);
-void	yyerror(const char *s);
+void	yyerror(parsecontext * context, const char *s);
 int		libmxmlwrap();
 bool	readfile   (const char * file, reader * r);
 bool	readstream (FILE * file, reader * r);
 bool	readbuffer (const char * buffer, reader * r);
+bool	readbytes  (char * buffer, size_t size, reader * r);
 #ifdef __cplusplus
 }
 #endif
 
-int   yylex (void);
-extern char * libmxmltext;
-extern int libmxmllineno;
-extern FILE * libmxmlin;
-
-#define YYERROR_VERBOSE
-#define ERROR(str)	{ yyerror(str); YYABORT; }
-#define MAXLEN	1024
-#define VLEN	256
-char attributeName[MAXLEN];
-char attributeVal[MAXLEN];
-
-char xmlversion[VLEN];
-char xmlencoding[MAXLEN];
-int xmlStandalone = -1;
-
-char eltName[MAXLEN];
-char doctypeStart[MAXLEN];
-char doctypePub[MAXLEN];
-char doctypeSys[MAXLEN];
-
-reader * gReader;
-
-static void init (reader * r) {
-	gReader = r;
-	xmlStandalone = -1;
-	eltName[0]		= 0;
-	attributeName[0] = 0;
-	attributeVal[0] = 0;
-	xmlversion[0]   = 0;
-	xmlencoding[0]  = 0;
-	doctypeStart[0]	= 0;
-	doctypePub[0]	= 0;
-	doctypeSys[0]	= 0;
+int   yylex (YYSTYPE * lvalp);
+extern thread_local char * libmxmltext;
+extern thread_local int libmxmllineno;
+extern thread_local FILE * libmxmlin;
+
+#define ERROR(str)	{ yyerror(context, str); YYABORT; }
+
+static void init (parsecontext * context, reader * r) {
+	context->fReader = r;
+	context->xmlStandalone = -1;
+	context->eltName[0]		= 0;
+	context->attributeName[0] = 0;
+	context->attributeVal[0] = 0;
+	context->xmlversion[0]   = 0;
+	context->xmlencoding[0]  = 0;
+	context->doctypeStart[0]	= 0;
+	context->doctypePub[0]	= 0;
+	context->doctypeSys[0]	= 0;
 }
 
 static char * unquote (char * text) {
@@ -87,6 +87,11 @@ int		libmxmlwrap()		{ return(1); }
 %}
 
 
+%code requires { struct parsecontext; }
+%define api.pure full
+%define parse.error verbose
+%parse-param { parsecontext * context }
+
 %start document
 
 %token XMLDECL VERSION ENCODING STANDALONE YES NO ENDXMLDECL
@@ -113,15 +118,15 @@ eltstart	: LT eltname GT
 
 eltstop		: ENDXMLS endname GT;
 
-emptyelt	: LT eltname ENDXMLE					{ if (!gReader->endElement(eltName)) ERROR("end element error") }
-			| LT eltname SPACE attributes ENDXMLE   { if (!gReader->endElement(eltName)) ERROR("end element error") }
+emptyelt	: LT eltname ENDXMLE					{ if (!context->fReader->endElement(context->eltName)) ERROR("end element error") }
+			| LT eltname SPACE attributes ENDXMLE   { if (!context->fReader->endElement(context->eltName)) ERROR("end element error") }
 
-eltname		: NAME							{ store(eltName, libmxmltext); if (!gReader->newElement(libmxmltext)) ERROR("element error") }
-endname		: NAME							{ if (!gReader->endElement(libmxmltext)) ERROR("end element error") }
+eltname		: NAME							{ store(context->eltName, libmxmltext); if (!context->fReader->newElement(libmxmltext)) ERROR("element error") }
+endname		: NAME							{ if (!context->fReader->endElement(libmxmltext)) ERROR("end element error") }
 
-attribute	: attrname EQ value				{ if (!gReader->newAttribute (attributeName, attributeVal)) ERROR("attribute error") }
-attrname	: NAME							{ store(attributeName, libmxmltext); }
-value		: QUOTEDSTR						{ store(attributeVal, unquote(libmxmltext)); }
+attribute	: attrname EQ value				{ if (!context->fReader->newAttribute (context->attributeName, context->attributeVal)) ERROR("attribute error") }
+attrname	: NAME							{ store(context->attributeName, libmxmltext); }
+value		: QUOTEDSTR						{ store(context->attributeVal, unquote(libmxmltext)); }
 
 attributes  : attribute	
 			| attributes SPACE attribute;
@@ -130,10 +135,10 @@ data		: /* empty */
 			| cdata
 			| elements ;
 
-cdata		: DATA							{ gReader->setValue (libmxmltext); }
+cdata		: DATA							{ context->fReader->setValue (libmxmltext); }
 
-procinstr	: PI							{ gReader->newProcessingInstruction (libmxmltext); }
-comment		: COMMENT						{ gReader->newComment (libmxmltext); }
+procinstr	: PI							{ context->fReader->newProcessingInstruction (libmxmltext); }
+comment		: COMMENT						{ context->fReader->newComment (libmxmltext); }
 
 comments 	:  comment
      		|  comments comment;
@@ -143,24 +148,24 @@ elements	: element
 
 
 xmldecl		: /* empty */
-			| XMLDECL versiondec decl ENDXMLDECL { if (!gReader->xmlDecl (xmlversion, xmlencoding, xmlStandalone)) ERROR("xmlDecl error") }
+			| XMLDECL versiondec decl ENDXMLDECL { if (!context->fReader->xmlDecl (context->xmlversion, context->xmlencoding, context->xmlStandalone)) ERROR("xmlDecl error") }
 
 decl		: /* empty */
 			| encodingdec 
 			| stdalonedec
 			| encodingdec stdalonedec ;
 
-versiondec	: SPACE VERSION EQ QUOTEDSTR 		{ store(xmlversion, unquote(libmxmltext)); }
-encodingdec	: SPACE ENCODING EQ QUOTEDSTR 		{ store(xmlencoding, unquote(libmxmltext)); }
-stdalonedec	: SPACE STANDALONE EQ bool  		{ xmlStandalone = yylval; }
+versiondec	: SPACE VERSION EQ QUOTEDSTR 		{ store(context->xmlversion, unquote(libmxmltext)); }
+encodingdec	: SPACE ENCODING EQ QUOTEDSTR 		{ store(context->xmlencoding, unquote(libmxmltext)); }
+stdalonedec	: SPACE STANDALONE EQ bool  		{ context->xmlStandalone = $4; }
 bool		: YES | NO ;
 
 doctype		: DOCTYPE SPACE startname SPACE id GT
-startname	: NAME 							{ store(doctypeStart, libmxmltext); }
-id			: PUBLIC SPACE publitteral SPACE syslitteral	{ gReader->docType (doctypeStart, true, doctypePub, doctypeSys); }
-			| SYSTEM SPACE syslitteral						{ gReader->docType (doctypeStart, false, doctypePub, doctypeSys); }
-publitteral : QUOTEDSTR 						{ store(doctypePub, unquote(libmxmltext)); }
-syslitteral : QUOTEDSTR 						{ store(doctypeSys, unquote(libmxmltext)); }
+startname	: NAME 							{ store(context->doctypeStart, libmxmltext); }
+id			: PUBLIC SPACE publitteral SPACE syslitteral	{ context->fReader->docType (context->doctypeStart, true, context->doctypePub, context->doctypeSys); }
+			| SYSTEM SPACE syslitteral						{ context->fReader->docType (context->doctypeStart, false, context->doctypePub, context->doctypeSys); }
+publitteral : QUOTEDSTR 						{ store(context->doctypePub, unquote(libmxmltext)); }
+syslitteral : QUOTEDSTR 						{ store(context->doctypeSys, unquote(libmxmltext)); }
 
 misc		: /* empty */
 			| SPACE ;
@@ -168,23 +173,39 @@ misc		: /* empty */
 
 %%
 
-#define yy_delete_buffer	libmxml_delete_buffer
 #define yy_scan_string		libmxml_scan_string
+#define yy_scan_buffer		libmxml_scan_buffer
+#define yylex_destroy		libmxmllex_destroy
+
+// runs the parser on the current scanner input and releases the scanner
+// state of the calling thread
+static bool parse (reader * r)
+{
+	parsecontext context;
+	init(&context, r);
+	int ret = yyparse(&context);
+	yylex_destroy();
+	return ret==0;
+}
 
 bool readbuffer (const char * buffer, reader * r) 
 {
 	if (!buffer) return false;		// error for empty buffers
 
-	init(r);
-	YY_BUFFER_STATE b;
     // Copy string into new buffer and Switch buffers
-    b = yy_scan_string (buffer);
+	yy_scan_string (buffer);
     // Parse the string
-	int ret = yyparse();
-    // Delete the new buffer
-	yy_delete_buffer(b);
-	BEGIN(INITIAL);
- 	return ret==0;
+	return parse (r);
+}
+
+// parses a buffer in place: the buffer is modified during the parse
+// and its last two bytes must be null (they are included in size)
+bool readbytes (char * buffer, size_t size, reader * r) 
+{
+	if (!buffer || (size < 2) || buffer[size-2] || buffer[size-1]) return false;
+
+	if (!yy_scan_buffer (buffer, size)) return false;
+	return parse (r);
 }
 
 bool readfile (const char * file, reader * r) 
@@ -194,27 +215,22 @@ bool readfile (const char * file, reader * r)
 		cerr << "can't open file " << file << endl;
 		return false;
 	}
-	init(r);
-	libmxmlrestart(fd);
+	lexinit(fd);		// also resets the UTF-16 detection
 	libmxmlin = fd;
- 	int ret = yyparse();
+	bool ret = parse (r);
  	fclose (fd);
-	BEGIN(INITIAL);
- 	return ret==0;
+ 	return ret;
 }
 
 bool readstream (FILE * fd, reader * r) 
 {
 	if (!fd) return false;
-	init(r);
-	libmxmlrestart(fd);
+	lexinit(fd);		// also resets the UTF-16 detection
 	libmxmlin = fd;
- 	int ret = yyparse();
-	BEGIN(INITIAL);
- 	return ret==0;
+	return parse (r);
 }
 
-void	yyerror(const char *s)	{ gReader->error (s, libmxmllineno); }
+void	yyerror(parsecontext * context, const char *s)	{ context->fReader->error (s, libmxmllineno); }
 
 #ifdef MAIN
 
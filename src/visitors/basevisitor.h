@@ -14,6 +14,8 @@
 #define __basevisitor__
 
 
+#include <vector>
+
 #ifdef WIN32
 #pragma warning (disable : 4251 4275)
 #endif
@@ -23,8 +25,40 @@ namespace MusicXML2
 
 class basevisitor 
 {
+	typedef struct { void* fVisitor; bool fResolved; } dispatchEntry;
+	std::vector<dispatchEntry>	fDispatch;
+	bool						fCached;
+
 	public:
+				 basevisitor() : fCached(true) {}
+				 basevisitor(const basevisitor&) : fCached(true) {}		// the dispatch table refers to this object and can't be copied
 		virtual ~basevisitor() {}
+
+		basevisitor& operator= (const basevisitor&)	{ return *this; }
+
+		//! when false, the cross cast is done at each call, as without the table (for benchmarks)
+		void	useDispatchTable (bool state)	{ fCached = state; }
+
+		/*!
+		\brief gives the visitor interface V implemented by this visitor (or null)
+		
+			The cross cast is resolved once per element type and cached in a table
+			indexed by \c type, so that subsequent calls cost an indexed access.
+			A given type must always be queried with the same interface V.
+		*/
+		template <typename V> V* dispatch (int type) {
+			if (!fCached) return dynamic_cast<V*>(this);
+			if (type >= int(fDispatch.size())) {
+				dispatchEntry unresolved = { 0, false };
+				fDispatch.resize ((type < 256) ? 256 : 2*type, unresolved);
+			}
+			dispatchEntry& entry = fDispatch[type];
+			if (!entry.fResolved) {
+				entry.fVisitor = dynamic_cast<V*>(this);
+				entry.fResolved = true;
+			}
+			return static_cast<V*>(entry.fVisitor);
+		}
 };
 
 }
@@ -30,7 +30,7 @@ void clefvisitor::reset ()
 void clefvisitor::visitStart ( S_clef& elt )
 { 
 	reset(); 
-	fNumber = elt->getAttributeIntValue("number", kNoNumber); 
+	fNumber = elt->getAttributeIntValue(attributeNames::number, kNoNumber); 
 }
 
 void clefvisitor::visitStart ( S_clef_octave_change& elt )	{ fOctaveChange = (int)(*elt); }
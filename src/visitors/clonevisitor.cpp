@@ -25,11 +25,11 @@ namespace MusicXML2
 //______________________________________________________________________________
 void clonevisitor::copyAttributes (const Sxmlelement& src, Sxmlelement& dst )
 {
-	vector<Sxmlattribute> attr = src->attributes();
-	vector<Sxmlattribute>::const_iterator iter;
+	const xmlelement::attributesList& attr = src->attributes();
+	xmlelement::attributesList::const_iterator iter;
 	for (iter=attr.begin(); iter != attr.end(); iter++) {
 		Sxmlattribute attrcopy = xmlattribute::create();
-		attrcopy->setName( (*iter)->getName());
+		attrcopy->setName( (*iter)->getNameSymbol());
 		attrcopy->setValue( (*iter)->getValue());
 		dst->add( attrcopy );
 	}
@@ -40,7 +40,7 @@ Sxmlelement clonevisitor::copy (const Sxmlelement& src)
 {
 	Sxmlelement copy = xmlelement::create(src->getInputLineNumber());
 	if (copy) {
-		copy->setName( src->getName());
+		copy->setName( src->getNameSymbol());
 		copy->setValue( src->getValue());
 		copyAttributes (src, copy);
 	}
@@ -52,7 +52,7 @@ void clonevisitor::visitStart ( Sxmlelement& elt )
 {
 	if (!fClone) return;
 	Sxmlelement copy = xmlelement::create(elt->getInputLineNumber());
-	copy->setName( elt->getName());
+	copy->setName( elt->getNameSymbol());
 	copy->setValue( elt->getValue());
 	copyAttributes (elt, copy);
 	fLastCopy = copy;
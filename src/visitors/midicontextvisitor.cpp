@@ -43,7 +43,7 @@ void scoreInstrument::reset ()
 void scoreInstrument::visitStart ( S_score_instrument& elt )
 {
 	reset();
-	fID = elt->getAttributeValue("id");
+	fID = elt->getAttributeValue(attributeNames::id);
 }
 
 void scoreInstrument::visitStart ( S_instrument_name& elt )			{ fName = elt->getValue(); }
@@ -63,7 +63,7 @@ void midiInstrument::reset ()
 void midiInstrument::visitStart ( S_midi_instrument& elt )
 {
 	reset();
-	fID = elt->getAttributeValue("id");
+	fID = elt->getAttributeValue(attributeNames::id);
 }
 
 void midiInstrument::visitStart ( S_midi_channel& elt )		{ fChan = (int)(*elt); }
@@ -258,7 +258,7 @@ void midicontextvisitor::visitStart ( S_part& elt )
     fTranspose = 0;
     fDivisions = 1;
 
-	fCurrentPartID = elt->getAttributeValue("id");
+	fCurrentPartID = elt->getAttributeValue(attributeNames::id);
 	int instrCount = fScoreInstruments.count(fCurrentPartID);
 	if (fMidiWriter) {
 		fMidiWriter->startPart(instrCount);
@@ -274,7 +274,7 @@ void midicontextvisitor::visitStart ( S_part& elt )
 //________________________________________________________________________
 void midicontextvisitor::visitEnd ( S_part& elt )		{ if (fMidiWriter) fMidiWriter->endPart (fCurrentDate); }
 void midicontextvisitor::visitEnd ( S_note& elt )		{ playNote (*this); }
-void midicontextvisitor::visitStart( S_score_part& elt )	{ fCurrentPartID = elt->getAttributeValue("id"); }
+void midicontextvisitor::visitStart( S_score_part& elt )	{ fCurrentPartID = elt->getAttributeValue(attributeNames::id); }
 void midicontextvisitor::visitEnd  ( S_score_part& elt )	{ fCurrentPartID = ""; }
 
 //________________________________________________________________________
@@ -291,17 +291,17 @@ void midicontextvisitor::visitEnd ( S_score_instrument& elt )
 void midicontextvisitor::visitStart ( S_sound& elt )
 {
 	fInSound = true;
-	Sxmlattribute attr = elt->getAttribute("dynamics");
+	Sxmlattribute attr = elt->getAttribute(attributeNames::dynamics);
 	if (attr) fCurrentDynamics = convert2Vel(long(*attr));
 
-	attr = elt->getAttribute("tempo");
+	attr = elt->getAttribute(attributeNames::tempo);
 	if (attr) playTempoChange( long(*attr) );
 
 	attr = elt->getAttribute("damper-pedal");
-	if (attr) playPedalChange( midiwriter::kSostenutoPedal, attr->getValue() );
+	if (attr) playPedalChange( midiwriter::kDamperPedal, attr->getValue() );
 
 	attr = elt->getAttribute("soft-pedal");
-	if (attr) playPedalChange( midiwriter::kSostenutoPedal, attr->getValue() );
+	if (attr) playPedalChange( midiwriter::kSoftpedal, attr->getValue() );
 
 	attr = elt->getAttribute("sostenuto-pedal");
 	if (attr) playPedalChange( midiwriter::kSostenutoPedal, attr->getValue() );
@@ -135,7 +135,7 @@ void notevisitor::visitStart ( S_time_modification& elt )
 //________________________________________________________________________
 void notevisitor::visitStart ( S_tie& elt )
 {
-	const string& value = elt->getAttributeValue("type");
+	const string& value = elt->getAttributeValue(attributeNames::type);
 	fTie = StartStop::type(fTie | StartStop::xml(value));
 /*
 	if (value == "start") fTie |= kTieStart;
@@ -183,7 +183,7 @@ void notevisitor::print (ostream& out) const
     {
         fLyric.push_back (elt);
         // get attributes
-        float posy = elt->getAttributeFloatValue("default-y", 0) + elt->getAttributeFloatValue("relative-y", 0);
+        float posy = elt->getAttributeFloatValue(attributeNames::default_y, 0) + elt->getAttributeFloatValue(attributeNames::relative_y, 0);
         fLyricsDy = (posy / 10) * 2;   // convert to half spaces
         fLyricsDy += 8;		  // anchor point convertion (defaults to upper line in xml)
         
@@ -208,7 +208,7 @@ void notevisitor::visitStart ( S_note& elt )
 {
 	fInNote = true;
 	reset();
-	fDynamics = elt->getAttributeLongValue("dynamics", kUndefinedDynamics);
+	fDynamics = elt->getAttributeLongValue(attributeNames::dynamics, kUndefinedDynamics);
     fAccidental = elt->getValue(k_accidental);
     if (!fAccidental.empty()) {
         auto accidental = elt->find(k_accidental);
@@ -216,7 +216,7 @@ void notevisitor::visitStart ( S_note& elt )
     }
     
     fThisSNote = elt;
-    x_default = elt->getAttributeIntValue("default-x", -1);
+    x_default = elt->getAttributeIntValue(attributeNames::default_x, -1);
 }
 
 //________________________________________________________________________
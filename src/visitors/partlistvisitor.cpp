@@ -95,9 +95,9 @@ namespace MusicXML2
     
     void partlistvisitor::visitStart ( S_part_group& elt )
     {
-        int partGroupNumber = elt->getAttributeIntValue("number", 0);
+        int partGroupNumber = elt->getAttributeIntValue(attributeNames::number, 0);
         /// IMPORTANT NOTE: the number attribute is NOT sequential and can be repeated! So we need to do further book-keeping.
-        std::string partGroupType = elt->getAttributeValue("type");
+        std::string partGroupType = elt->getAttributeValue(attributeNames::type);
         
         if (partGroupType=="start")
         {
@@ -147,7 +147,7 @@ namespace MusicXML2
     
     void partlistvisitor::visitStart( S_score_part& elt)
     {
-        std::string PartID = elt->getAttributeValue("id");
+        std::string PartID = elt->getAttributeValue(attributeNames::id);
         part2staffmap[PartID] = staffCreatorCounter;
         staffCreatorCounter++;
         
@@ -43,7 +43,7 @@ void partsummary::visitStart ( S_staves& elt)
         
         while (sLayout != elt->end() )
         {
-            int number = sLayout->getAttributeIntValue("number", 0);
+            int number = sLayout->getAttributeIntValue(attributeNames::number, 0);
             //if (number> fStaffDistances.size())
             //    fStaffDistances.reserve(number+1);
             int thisDistance = sLayout->getIntValue(k_staff_distance, 0);
@@ -35,7 +35,7 @@ void timesignvisitor::reset ()
 
 void timesignvisitor::visitStart ( S_time& elt ) {
 	reset();
-	fStaffNumber = elt->getAttributeIntValue("number", kNoStaffNumber);
+	fStaffNumber = elt->getAttributeIntValue(attributeNames::number, kNoStaffNumber);
 	fSymbol = elt->getAttributeValue("symbol");
 }
 
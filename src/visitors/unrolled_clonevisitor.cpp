@@ -25,7 +25,7 @@ namespace MusicXML2
 void unrolled_clonevisitor::visitStart( S_measure& elt)
 {
 	start(elt);
-	Sxmlattribute attr = lastCopy()->getAttribute("number");
+	Sxmlattribute attr = lastCopy()->getAttribute(attributeNames::number);
 	if (attr) {
 		attr->setValue(fMeasureNum++);
 	}
@@ -92,8 +92,8 @@ void unrolled_clonevisitor::visitEnd  ( S_time& elt)	{ if (fTimeCopy) end( elt )
 void unrolled_clonevisitor::visitStart( S_sound& elt)
 {
 	start(elt);
-	vector<Sxmlattribute> attr = lastCopy()->attributes();
-	vector<Sxmlattribute>::iterator iter;
+	xmlelement::attributesList attr = lastCopy()->attributes();
+	xmlelement::attributesList::iterator iter;
 	for (iter=attr.begin(); iter != attr.end();) {
 		const string name = (*iter)->getName();
 		if ((name == "segno" ) ||
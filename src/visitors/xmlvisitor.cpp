@@ -28,7 +28,7 @@ ostream& operator<< (ostream& os, const xmlendl& endl)
 //______________________________________________________________________________
 void xmlendl::print(std::ostream& os) const { 
 	int i = fIndent;
-    os << std::endl;
+    os << '\n';
     while (i-- > 0)  os << "    ";
 }
 
@@ -49,7 +49,7 @@ void xmlvisitor::visitStart ( Sxmlelement& elt )
 {
 	fOut <<  fendl << "<" << elt->getName();
 	// print the element attributes first
-	vector<Sxmlattribute>::const_iterator attr; 
+	xmlelement::attributesList::const_iterator attr; 
 	for (attr = elt->attributes().begin(); attr != elt->attributes().end(); attr++)
 		fOut << " " << (*attr)->getName() << "=\"" << (*attr)->getValue() << "\"";				
 	if (elt->empty()) {
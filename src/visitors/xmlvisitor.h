@@ -28,8 +28,9 @@ namespace MusicXML2
 \internal
 \brief to be used in place of std::endl
 	to provide a correct indentation of the xml output.
+	The stream is not flushed.
 */
-class xmlendl {
+class EXP xmlendl {
 	private:
 		int fIndent;
 	public:
@@ -43,10 +44,16 @@ class xmlendl {
 		//! reset the indentation to none
 		void print(std::ostream& os) const;
 };
-std::ostream& operator<< (std::ostream& os, const xmlendl& eol);
+EXP std::ostream& operator<< (std::ostream& os, const xmlendl& eol);
 
 //______________________________________________________________________________
-class xmlvisitor : 
+/*!
+\brief prints a tree of elements as xml, without escaping the values.
+
+	The documents are printed by the xmlwriter, which is faster and escapes
+	the values: the visitor is kept for derived visitors.
+*/
+class EXP xmlvisitor : 
 	public visitor<S_comment>,
 	public visitor<S_processing_instruction>,
 	public visitor<Sxmlelement>
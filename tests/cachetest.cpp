@@ -0,0 +1,133 @@
+/*
+  MusicXML Library
+  Copyright (C) Grame 2006-2013
+
+  This Source Code Form is subject to the terms of the Mozilla Public
+  License, v. 2.0. If a copy of the MPL was not distributed with this
+  file, You can obtain one at http://mozilla.org/MPL/2.0/.
+
+  Grame Research Laboratory, 11, cours de Verdun Gensoul 69002 Lyon - France
+  research@grame.fr
+*/
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <fstream>
+#include <iostream>
+#include <sstream>
+#include <string>
+
+#ifdef WIN32
+# include <direct.h>
+# define rmdir _rmdir
+#else
+# include <unistd.h>
+#endif
+
+#include "xml.h"
+#include "xmlfile.h"
+#include "xmlreader.h"
+#include "xmlcache.h"
+#include "filebuffer.h"
+
+using namespace std;
+using namespace MusicXML2;
+
+//_______________________________________________________________________________
+// checks that a document read back from the cache is the parsed document:
+// after the entry is written, when it is read again, with and without arenas,
+// and that a damaged entry is detected and replaced
+//_______________________________________________________________________________
+static int gErrors = 0;
+
+static void check (bool result, const char* what, const char* file, int line)
+{
+	if (!result) {
+		cerr << "cachetest line " << line << ": " << file << ": " << what << " failed" << endl;
+		gErrors++;
+	}
+}
+
+#define CHECK(x)	check ((x), #x, file, __LINE__)
+
+static void usage()
+{
+	cerr << "usage: cachetest <cache directory> <musicxml files>" << endl;
+	cerr << "       writes the files to the cache and reads them back, the cache directory is removed at the end" << endl;
+	exit(1);
+}
+
+//_______________________________________________________________________________
+// the printed document, or an empty string when there is no document
+static string asString (SXMLFile xml)
+{
+	if (!xml) return "";
+	stringstream out;
+	xml->print (out);
+	return out.str();
+}
+
+static bool exists (const string& path)
+{
+	ifstream in (path.c_str());
+	return in.is_open();
+}
+
+// keeps the first half of a file
+static void truncate (const string& path)
+{
+	filebuffer buffer;
+	if (!buffer.open (path.c_str())) return;
+	string half (buffer.data(), buffer.size() / 2);
+	ofstream out (path.c_str(), ios::binary | ios::trunc);
+	out << half;
+}
+
+//_______________________________________________________________________________
+int main(int argc, char *argv[])
+{
+	if (argc < 3) usage();
+	xmlcache cache (argv[1]);
+
+	int files = 0;
+	for (int i = 2; i < argc; i++) {
+		const char* file = argv[i];
+		xmlreader r;
+		string expected = asString (r.read (file));
+		if (expected.empty()) continue;		// not a MusicXML file
+
+		filebuffer buffer;
+		CHECK (buffer.open (file));
+		string entry = cache.entry (buffer.data(), buffer.size());
+		remove (entry.c_str());				// left by a previous run
+
+		// the first read parses the file and writes the entry
+		CHECK (asString (cache.read (file)) == expected);
+		CHECK (exists (entry));
+		CHECK (asString (xmlcache::load (entry)) == expected);
+		CHECK (asString (xmlcache::load (entry, true)) == expected);
+
+		// the next reads load the entry
+		CHECK (asString (cache.read (file)) == expected);
+		cache.useArena (true);
+		CHECK (asString (cache.read (file)) == expected);
+		cache.useArena (false);
+
+		// a damaged entry is rejected, the file is parsed again and the entry rewritten
+		truncate (entry);
+		CHECK (!xmlcache::load (entry));
+		CHECK (asString (cache.read (file)) == expected);
+		CHECK (asString (xmlcache::load (entry)) == expected);
+
+		remove (entry.c_str());
+		files++;
+	}
+	rmdir (argv[1]);
+
+	if (!files) {
+		cerr << "cachetest: no MusicXML file read" << endl;
+		return 1;
+	}
+	if (gErrors) cerr << "cachetest: " << gErrors << " errors" << endl;
+	return gErrors ? 1 : 0;
+}
@@ -0,0 +1,141 @@
+/*
+  MusicXML Library
+  Copyright (C) Grame 2006-2013
+
+  This Source Code Form is subject to the terms of the Mozilla Public
+  License, v. 2.0. If a copy of the MPL was not distributed with this
+  file, You can obtain one at http://mozilla.org/MPL/2.0/.
+
+  Grame Research Laboratory, 11, cours de Verdun Gensoul 69002 Lyon - France
+  research@grame.fr
+*/
+
+#include <iostream>
+#include <string>
+
+#include "elements.h"
+#include "xml.h"
+#include "xmlfile.h"
+#include "xmlreader.h"
+#include "xmlwriter.h"
+
+using namespace std;
+using namespace MusicXML2;
+
+//_______________________________________________________________________________
+// checks the xmlwriter escaping, and that the written documents read back
+// to the same documents: a built one with values to escape, and the files
+// given on the command line, in indented and compact form
+//_______________________________________________________________________________
+static int gErrors = 0;
+
+static void check (bool result, const char* what, const char* context, int line)
+{
+	if (!result) {
+		cerr << "escapetest line " << line << ": " << context << ": " << what << " failed" << endl;
+		gErrors++;
+	}
+}
+
+#define CHECK(x)	check ((x), #x, context, __LINE__)
+
+static string escaped (const string& value, bool attribute)
+{
+	string out;
+	xmlwriter::escape (value, attribute, out);
+	return out;
+}
+
+// the indented output of the document read back from data
+static string reread (const string& data)
+{
+	xmlreader r;
+	SXMLFile xml = r.readbuff (data.c_str());
+	if (!xml) return "";
+	xmlwriter w;
+	return w.write (xml);
+}
+
+//_______________________________________________________________________________
+static void escaping ()
+{
+	const char* context = "escape";
+	CHECK (escaped ("a < b", false) == "a &lt; b");
+	CHECK (escaped ("R&B", false) == "R&amp;B");
+	CHECK (escaped ("a > b 'c'", true) == "a > b 'c'");
+	CHECK (escaped ("\"live\"", false) == "\"live\"");
+	CHECK (escaped ("\"live\"", true) == "&quot;live&quot;");
+	// the references are kept, the parser doesn't expand them
+	CHECK (escaped ("&amp; &lt; &#60; &#x3C; &eacute;", false) == "&amp; &lt; &#60; &#x3C; &eacute;");
+	// what only looks like a reference is escaped
+	CHECK (escaped ("& &; &#; &#x; &#12 &1a; &amp", false) == "&amp; &amp;; &amp;#; &amp;#x; &amp;#12 &amp;1a; &amp;amp");
+	CHECK (escaped ("", true) == "");
+}
+
+//_______________________________________________________________________________
+// a document with values and attributes to escape
+static void builtDocument ()
+{
+	const char* context = "built document";
+	xmlreader r;
+	SXMLFile xml = r.readbuff ("<?xml version=\"1.0\" encoding=\"UTF-8\"?>\n"
+		"<!DOCTYPE score-partwise PUBLIC \"-//Recordare//DTD MusicXML 3.0 Partwise//EN\" \"http://www.musicxml.org/dtds/partwise.dtd\">\n"
+		"<score-partwise version=\"3.0\"><work><work-title>title</work-title></work></score-partwise>");
+	CHECK (xml != 0);
+	if (!xml) return;
+
+	Sxmlelement root = xml->elements();
+	ctree<xmlelement>::iterator title = root->find (k_work_title);
+	CHECK (title != root->end());
+	if (title == root->end()) return;
+	title->setValue ("Rock & Roll < \"Live\" &amp; &#60;");
+	Sxmlattribute version = root->getAttribute ("version");
+	version->setValue ("3.0 \"<&>\"");
+
+	xmlwriter w;
+	string written = w.write (xml);
+	CHECK (written.find ("<work-title>Rock &amp; Roll &lt; \"Live\" &amp; &#60;</work-title>") != string::npos);
+	CHECK (written.find ("version=\"3.0 &quot;&lt;&amp;>&quot;\"") != string::npos);
+
+	// the parser accepts no '&', '<', '>' or quote in the attributes values:
+	// only the elements values are read back
+	version->setValue ("3.0");
+	written = w.write (xml);
+	xmlreader r2;
+	SXMLFile back = r2.readbuff (written.c_str());
+	CHECK (back != 0);
+	if (!back) return;
+	title = back->elements()->find (k_work_title);
+	CHECK (title != back->elements()->end());
+	if (title != back->elements()->end())
+		CHECK (title->getValue() == "Rock &amp; Roll &lt; \"Live\" &amp; &#60;");
+	// the escaped forms are written unchanged
+	CHECK (reread (written) == written);
+}
+
+//_______________________________________________________________________________
+// the written files read back to the same documents
+static void files (int argc, char *argv[])
+{
+	for (int i = 1; i < argc; i++) {
+		const char* context = argv[i];
+		xmlreader r;
+		SXMLFile xml = r.read (argv[i]);
+		if (!xml) continue;
+
+		xmlwriter w, compact (false);
+		string written = w.write (xml);
+		CHECK (reread (written) == written);
+		CHECK (reread (compact.write (xml)) == written);
+	}
+}
+
+//_______________________________________________________________________________
+int main(int argc, char *argv[])
+{
+	escaping ();
+	builtDocument ();
+	files (argc, argv);
+	if (gErrors) cerr << "escapetest: " << gErrors << " errors" << endl;
+	return gErrors ? 1 : 0;
+}
@@ -0,0 +1,209 @@
+/*
+  MusicXML Library
+  Copyright (C) Grame 2006-2013
+
+  This Source Code Form is subject to the terms of the Mozilla Public
+  License, v. 2.0. If a copy of the MPL was not distributed with this
+  file, You can obtain one at http://mozilla.org/MPL/2.0/.
+
+  Grame Research Laboratory, 11, cours de Verdun Gensoul 69002 Lyon - France
+  research@grame.fr
+*/
+
+#include <iostream>
+#include <string>
+#include <vector>
+
+#include "elements.h"
+#include "playbackplan.h"
+#include "xml.h"
+#include "xmlfile.h"
+#include "xmlreader.h"
+
+using namespace std;
+using namespace MusicXML2;
+
+//_______________________________________________________________________________
+// checks the playback order of the measures: repeats, endings and jumps,
+// the truncation of the plans that loop for ever and the sharing of the
+// plans between parts, next the plans of the scores given on the command line
+//_______________________________________________________________________________
+static int gErrors = 0;
+
+static void check (bool result, const char* what, const char* context, int line)
+{
+	if (!result) {
+		cerr << "playbacktest line " << line << ": " << context << ": " << what << " failed" << endl;
+		gErrors++;
+	}
+}
+
+#define CHECK(x)	check ((x), #x, context, __LINE__)
+
+//_______________________________________________________________________________
+// a part made of measures only, with controls added to its measures
+class part {
+	playbackplan::controls	fControls;
+	vector<bool>			fMeasures;
+
+	public:
+		part (int measures) : fControls(measures), fMeasures(measures, true) {}
+
+		part& add (int measure, int type, int value = 0) {
+			playbackplan::control c = { type, value };
+			fControls[measure].push_back (c);
+			return *this;
+		}
+		Splaybackplan plan () const		{ return playbackplan::create (fControls, fMeasures); }
+};
+
+// the plan order as a string, e.g. "0 1 2 1 2 3"
+static string order (const Splaybackplan& plan)
+{
+	string s;
+	for (size_t i = 0; i < plan->size(); i++) {
+		if (i) s += ' ';
+		s += to_string (plan->order()[i]);
+	}
+	return s;
+}
+
+//_______________________________________________________________________________
+static void repeats ()
+{
+	const char* context = "repeats";
+	CHECK (order (part(4).plan()) == "0 1 2 3");
+	CHECK (order (part(4).add(1, playbackplan::kForwardRepeat).add(2, playbackplan::kBackwardRepeat, 1).plan()) == "0 1 2 1 2 3");
+	// without forward repeat, the section starts at the beginning
+	CHECK (order (part(3).add(1, playbackplan::kBackwardRepeat, 1).plan()) == "0 1 0 1 2");
+	// the times attribute
+	CHECK (order (part(4).add(1, playbackplan::kForwardRepeat).add(2, playbackplan::kBackwardRepeat, 2).plan()) == "0 1 2 1 2 1 2 3");
+	// first and second endings
+	part endings (4);
+	endings.add(1, playbackplan::kEndingStart, 1).add(1, playbackplan::kEndingStop).add(1, playbackplan::kBackwardRepeat, 1);
+	endings.add(2, playbackplan::kEndingStart, 2).add(2, playbackplan::kEndingStop);
+	CHECK (order (endings.plan()) == "0 1 0 2 3");
+}
+
+static void jumps ()
+{
+	const char* context = "jumps";
+	// da capo al fine
+	CHECK (order (part(3).add(1, playbackplan::kSound, playbackplan::kFine).add(2, playbackplan::kSound, playbackplan::kDaCapo).plan()) == "0 1 2 0 1");
+	// dal segno al coda
+	part coda (6);
+	coda.add(1, playbackplan::kSound, playbackplan::kSegno).add(2, playbackplan::kSound, playbackplan::kToCoda);
+	coda.add(3, playbackplan::kSound, playbackplan::kDalSegno).add(4, playbackplan::kSound, playbackplan::kCoda);
+	Splaybackplan plan = coda.plan();
+	CHECK (order (plan) == "0 1 2 3 1 2 4 5");
+	CHECK (!plan->truncated());
+
+	// a coda sign before a da capo loops for ever
+	part loop (3);
+	loop.add(0, playbackplan::kSound, playbackplan::kCoda).add(1, playbackplan::kSound, playbackplan::kToCoda);
+	loop.add(2, playbackplan::kSound, playbackplan::kDaCapo);
+	plan = loop.plan();
+	CHECK (plan->truncated());
+	CHECK (plan->size() > 3);
+}
+
+//_______________________________________________________________________________
+// the controls collected from a score, the plans shared by the parts
+static const char* kScore =
+	"<?xml version=\"1.0\" encoding=\"UTF-8\"?>\n"
+	"<!DOCTYPE score-partwise PUBLIC \"-//Recordare//DTD MusicXML 3.0 Partwise//EN\" \"http://www.musicxml.org/dtds/partwise.dtd\">\n"
+	"<score-partwise version=\"3.0\">"
+	"<part-list>"
+		"<score-part id=\"P1\"><part-name>A</part-name></score-part>"
+		"<score-part id=\"P2\"><part-name>B</part-name></score-part>"
+		"<score-part id=\"P3\"><part-name>C</part-name></score-part>"
+	"</part-list>"
+	"<part id=\"P1\">"
+		"<measure number=\"1\"><note><rest/><duration>4</duration></note></measure>"
+		"<measure number=\"2\"><barline location=\"left\"><repeat direction=\"forward\"/></barline></measure>"
+		"<measure number=\"3\"><barline location=\"right\"><repeat direction=\"backward\"/></barline></measure>"
+		"<measure number=\"4\"></measure>"
+	"</part>"
+	"<part id=\"P2\">"
+		"<measure number=\"1\"></measure>"
+		"<measure number=\"2\"><barline location=\"left\"><repeat direction=\"forward\"/></barline></measure>"
+		"<measure number=\"3\"><barline location=\"right\"><repeat direction=\"backward\"/></barline></measure>"
+		"<measure number=\"4\"><note><rest/><duration>4</duration></note></measure>"
+	"</part>"
+	"<part id=\"P3\">"
+		"<measure number=\"1\"></measure>"
+		"<measure number=\"2\"></measure>"
+		"<measure number=\"3\"><direction><sound dacapo=\"yes\"/></direction></measure>"
+		"<measure number=\"4\"></measure>"
+	"</part>"
+	"</score-partwise>";
+
+static void score ()
+{
+	const char* context = "score";
+	xmlreader r;
+	SXMLFile file = r.readbuff (kScore);
+	CHECK (file != 0);
+	if (!file) return;
+
+	vector<Sxmlelement> parts;
+	const ctree<xmlelement>::branchs& elts = file->elements()->elements();
+	for (size_t i = 0; i < elts.size(); i++)
+		if (elts[i]->getType() == k_part) parts.push_back (elts[i]);
+	CHECK (parts.size() == 3);
+	if (parts.size() != 3) return;
+
+	CHECK (order (playbackplan::create (*parts[0])) == "0 1 2 1 2 3");
+	CHECK (order (playbackplan::create (*parts[2])) == "0 1 2 0 1 2 3");
+
+	// the first two parts have the same structure
+	playbackplans plans;
+	Splaybackplan p1 = plans.get (parts[0]);
+	CHECK (plans.get (parts[1]) == p1);
+	CHECK (plans.get (parts[0]) == p1);
+	CHECK (plans.size() == 1);
+	CHECK (order (plans.get (parts[2])) == "0 1 2 0 1 2 3");
+	CHECK (plans.size() == 2);
+	plans.clear ();
+	CHECK (plans.size() == 0);
+	CHECK (plans.get (parts[0]) != p1);
+	CHECK (order (plans.get (parts[0])) == "0 1 2 1 2 3");
+}
+
+//_______________________________________________________________________________
+// the cached plans are the plans of the parts and play measures only
+static void files (int argc, char *argv[])
+{
+	for (int i = 1; i < argc; i++) {
+		const char* context = argv[i];
+		xmlreader r;
+		SXMLFile file = r.read (argv[i]);
+		if (!file || !file->elements()) continue;
+
+		playbackplans plans;
+		const ctree<xmlelement>::branchs& elts = file->elements()->elements();
+		for (size_t p = 0; p < elts.size(); p++) {
+			if (elts[p]->getType() != k_part) continue;
+			Splaybackplan plan = playbackplan::create (*elts[p]);
+			CHECK (order (plans.get (elts[p])) == order (plan));
+			const ctree<xmlelement>::branchs& measures = elts[p]->elements();
+			bool valid = true;
+			for (size_t m = 0; m < plan->size(); m++) {
+				int index = plan->order()[m];
+				valid = valid && (index >= 0) && (size_t(index) < measures.size()) && (measures[index]->getType() == k_measure);
+			}
+			CHECK (valid);
+		}
+	}
+}
+
+//_______________________________________________________________________________
+int main(int argc, char *argv[])
+{
+	repeats ();
+	jumps ();
+	score ();
+	files (argc, argv);
+	if (gErrors) cerr << "playbacktest: " << gErrors << " errors" << endl;
+	return gErrors ? 1 : 0;
+}
@@ -0,0 +1,134 @@
+/*
+  MusicXML Library
+  Copyright (C) Grame 2006-2013
+
+  This Source Code Form is subject to the terms of the Mozilla Public
+  License, v. 2.0. If a copy of the MPL was not distributed with this
+  file, You can obtain one at http://mozilla.org/MPL/2.0/.
+
+  Grame Research Laboratory, 11, cours de Verdun Gensoul 69002 Lyon - France
+  research@grame.fr
+*/
+
+#include <climits>
+#include <iostream>
+
+#include "rational.h"
+
+using namespace std;
+
+//_______________________________________________________________________________
+// checks the rational comparisons and arithmetic, including negative denominators
+//_______________________________________________________________________________
+static int gErrors = 0;
+
+static void check (bool result, const char* what, int line)
+{
+	if (!result) {
+		cerr << "rationaltest line " << line << ": " << what << " failed" << endl;
+		gErrors++;
+	}
+}
+
+#define CHECK(x)	check ((x), #x, __LINE__)
+
+//_______________________________________________________________________________
+// a rational with a negative denominator, which the constructors don't keep
+static rational negative (long int num, long int denom)
+{
+	rational r;
+	r.set (num, denom);
+	return r;
+}
+
+int main(int argc, char *argv[])
+{
+	// the sign is carried by the numerator
+	CHECK (rational(1, -2).getNumerator() == -1);
+	CHECK (rational(1, -2).getDenominator() == 2);
+	CHECK (rational("3/-4").getNumerator() == -3);
+	CHECK (rational("3").getDenominator() == 1);
+	CHECK (rational(6, 8).getDenominator() == 8);		// not reduced
+
+	// same denominators
+	CHECK (rational(1, 4) < rational(3, 4));
+	CHECK (rational(-3, 4) < rational(-1, 4));
+	CHECK (negative (1, -4) > negative (3, -4));		// -1/4 > -3/4
+	CHECK (negative (-1, -4) < negative (-3, -4));		// 1/4 < 3/4
+	CHECK (negative (1, -4) == rational(-1, 4));
+
+	// different denominators, mixed signs
+	CHECK (negative (1, -2) < rational(1, 3));
+	CHECK (rational(1, 3) > negative (1, -2));
+	CHECK (negative (1, -2) < negative (1, -3));		// -1/2 < -1/3
+	CHECK (negative (2, -4) == rational(-1, 2));
+	CHECK (!(negative (2, -4) != rational(-1, 2)));
+	CHECK (negative (1, -2) <= rational(-1, 2));
+	CHECK (negative (1, -2) >= rational(-1, 2));
+
+	// the operations results are reduced with a positive denominator
+	rational r = rational(1, 2) / rational(-3, 4);		// -2/3
+	CHECK (r.getNumerator() == -2);
+	CHECK (r.getDenominator() == 3);
+	r = negative (1, -6) + rational(1, 3);				// 1/6
+	CHECK (r == rational(1, 6));
+	CHECK (r.getDenominator() == 6);
+	r = negative (1, -2) * rational(2, 3);				// -1/3
+	CHECK (r == rational(-1, 3));
+	CHECK (r.getDenominator() == 3);
+	r = negative (3, -6);
+	r.rationalise();
+	CHECK ((r.getNumerator() == -1) && (r.getDenominator() == 2));
+
+	// durations
+	rational d;
+	for (int i = 0; i < 3; i++) d += rational(1, 12);
+	CHECK (d == rational(1, 4));
+	CHECK (d.getDenominator() == 4);
+	CHECK (rational(3, 8) * 2 == rational(3, 4));
+	CHECK (rational(1, 4) - rational(1, 2) == rational(-1, 4));
+
+	// the results are reduced, whether the operands are or not
+	r = rational(6, 8) + rational(1, 3);				// 13/12
+	CHECK ((r.getNumerator() == 13) && (r.getDenominator() == 12));
+	r = rational(6, 8) + rational(2, 8);				// 1
+	CHECK ((r.getNumerator() == 1) && (r.getDenominator() == 1));
+	r = rational(2, 4) + rational(0, 1);				// 1/2
+	CHECK ((r.getNumerator() == 1) && (r.getDenominator() == 2));
+	r = rational(2, 6) + rational(1, 4);				// 7/12
+	CHECK ((r.getNumerator() == 7) && (r.getDenominator() == 12));
+	r = rational(6, 8) * 1;
+	CHECK ((r.getNumerator() == 3) && (r.getDenominator() == 4));
+	CHECK (rational::status() == rational::kExact);
+
+	// division by zero
+	r = rational(3, 4) / rational(0, 1);
+	CHECK ((r.getNumerator() == LONG_MAX) && (r.getDenominator() == 1));
+	CHECK (rational::status() == rational::kDivisionByZero);
+	rational::clearStatus();
+	r = rational(-3, 4);
+	r /= 0L;
+	CHECK (r.getNumerator() == -LONG_MAX);
+	CHECK (rational(0, 1) / rational(0, 1) == rational(0, 1));
+	CHECK (rational::status() == rational::kDivisionByZero);
+	rational::clearStatus();
+
+	// overflows are approximated and reported
+	r = rational(LONG_MAX, 1) + rational(1, 1);
+	CHECK (rational::status() == rational::kOverflow);
+	CHECK (r.getNumerator() == LONG_MAX);
+	rational::clearStatus();
+	r = rational(LONG_MAX / 2, 7) * rational(4, 1);		// about 2.635e18
+	CHECK (rational::status() == rational::kOverflow);
+	CHECK ((r > 2.63e18) && (r < 2.64e18));
+	rational::clearStatus();
+
+	// overflow checked comparisons
+	CHECK (rational(LONG_MAX, 3) > rational(LONG_MAX - 1, 3));
+	CHECK (rational(LONG_MAX / 2, LONG_MAX) < rational(1, 2));
+	CHECK (negative (LONG_MAX, -2) < rational(1, 2));
+
+	if (gErrors) cerr << gErrors << " errors" << endl;
+	else cout << "rational tests passed" << endl;
+	return gErrors ? 1 : 0;
+}
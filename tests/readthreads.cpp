@@ -0,0 +1,109 @@
+/*
+  MusicXML Library
+  Copyright (C) Grame 2006-2013
+
+  This Source Code Form is subject to the terms of the Mozilla Public
+  License, v. 2.0. If a copy of the MPL was not distributed with this
+  file, You can obtain one at http://mozilla.org/MPL/2.0/.
+
+  Grame Research Laboratory, 11, cours de Verdun Gensoul 69002 Lyon - France
+  research@grame.fr
+*/
+
+#include <stdlib.h>
+#include <string.h>
+#include <atomic>
+#include <iostream>
+#include <sstream>
+#include <string>
+#include <thread>
+#include <vector>
+
+#include "xml.h"
+#include "xmlfile.h"
+#include "xmlreader.h"
+
+using namespace std;
+using namespace MusicXML2;
+
+//_______________________________________________________________________________
+// checks that concurrent parses give the same documents as serial ones:
+// the threads read the same files at the same time, with and without arenas
+//_______________________________________________________________________________
+static void usage()
+{
+	cerr << "usage: readthreads [options] <musicxml files>" << endl;
+	cerr << "       parses the files on several threads and compares with serial parses" << endl;
+	cerr << "       options: -t <threads> the number of threads (defaults to 4)" << endl;
+	cerr << "                -n <runs>    the number of concurrent runs (defaults to 4)" << endl;
+	exit(1);
+}
+
+//_______________________________________________________________________________
+// the printed document, or an empty string when the file can't be read
+static string parse (const string& file, bool arena)
+{
+	xmlreader r;
+	r.useArena (arena);
+	SXMLFile xml = r.read (file.c_str());
+	if (!xml) return "";
+	stringstream out;
+	xml->print (out);
+	return out.str();
+}
+
+//_______________________________________________________________________________
+// each thread parses all the files, starting at a different one
+static void worker (const vector<string>* files, vector<string>* outputs, int first, bool arena)
+{
+	size_t n = files->size();
+	for (size_t i = 0; i < n; i++) {
+		size_t f = (first + i) % n;
+		(*outputs)[f] = parse ((*files)[f], arena);
+	}
+}
+
+//_______________________________________________________________________________
+int main(int argc, char *argv[])
+{
+	int threads = 4, runs = 4;
+	int i = 1;
+	for (; (i < argc) && (argv[i][0] == '-'); i++) {
+		if (!strcmp (argv[i], "-t") && (i + 1 < argc)) threads = atoi (argv[++i]);
+		else if (!strcmp (argv[i], "-n") && (i + 1 < argc)) runs = atoi (argv[++i]);
+		else usage();
+	}
+	if ((i == argc) || (threads <= 0) || (runs <= 0)) usage();
+
+	vector<string> files (argv + i, argv + argc);
+	vector<string> expected (files.size());
+	int read = 0;
+	for (size_t f = 0; f < files.size(); f++) {
+		expected[f] = parse (files[f], false);
+		if (!expected[f].empty()) read++;
+	}
+
+	int errors = 0;
+	for (int n = 0; n < runs; n++) {
+		bool arena = n % 2;
+		vector<vector<string> > outputs (threads, vector<string>(files.size()));
+		vector<thread> pool;
+		for (int t = 0; t < threads; t++)
+			pool.push_back (thread (worker, &files, &outputs[t], int(t * files.size() / threads), arena));
+		for (size_t t = 0; t < pool.size(); t++)
+			pool[t].join();
+
+		for (int t = 0; t < threads; t++) {
+			for (size_t f = 0; f < files.size(); f++) {
+				if (outputs[t][f] != expected[f]) {
+					cerr << files[f] << ": the concurrent parse differs from the serial one (run " << n + 1
+						 << ", thread " << t + 1 << (arena ? ", arena" : "") << ")" << endl;
+					errors++;
+				}
+			}
+		}
+	}
+	cout << read << " of " << files.size() << " files read, "
+		 << runs << " runs on " << threads << " threads: " << errors << " differences" << endl;
+	return errors ? 1 : 0;
+}
@@ -0,0 +1,258 @@
+/*
+  MusicXML Library
+  Copyright (C) Grame 2006-2013
+
+  This Source Code Form is subject to the terms of the Mozilla Public
+  License, v. 2.0. If a copy of the MPL was not distributed with this
+  file, You can obtain one at http://mozilla.org/MPL/2.0/.
+
+  Grame Research Laboratory, 11, cours de Verdun Gensoul 69002 Lyon - France
+  research@grame.fr
+*/
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <fstream>
+#include <iostream>
+#include <iterator>
+#include <string>
+#include <vector>
+
+#include "elements.h"
+#include "xml.h"
+#include "xmlfile.h"
+#include "xmlreader.h"
+#include "smfwriter.h"
+
+using namespace std;
+using namespace MusicXML2;
+
+//_______________________________________________________________________________
+// checks the Standard MIDI Files written by the smfwriter: the variable length
+// quantities, the running status and the notes order are checked byte per byte
+// on tracks written through the midiwriter calls, next the structure of the
+// files written from the scores given on the command line
+//_______________________________________________________________________________
+static int gErrors = 0;
+
+static void check (bool result, const char* what, const char* context, int line)
+{
+	if (!result) {
+		cerr << "smftest line " << line << ": " << context << ": " << what << " failed" << endl;
+		gErrors++;
+	}
+}
+
+#define CHECK(x)	check ((x), #x, context, __LINE__)
+
+static void usage()
+{
+	cerr << "usage: smftest <output file> <musicxml files>" << endl;
+	cerr << "       writes Standard MIDI Files to the output file and checks them, the output file is removed at the end" << endl;
+	exit(1);
+}
+
+//_______________________________________________________________________________
+// a Standard MIDI File, split into its chunks
+typedef struct {
+	int				fFormat;
+	int				fTPQ;
+	vector<string>	fTracks;	// the tracks data, without their header
+} smffile;
+
+static unsigned long bigEndian (const string& data, size_t pos, int bytes)
+{
+	unsigned long v = 0;
+	for (int i = 0; i < bytes; i++) v = (v << 8) | (unsigned char)data[pos + i];
+	return v;
+}
+
+// checks the chunks sizes, returns false when the file is incorrect
+static bool readFile (const string& path, smffile& smf)
+{
+	ifstream in (path.c_str(), ios::binary);
+	string data ((istreambuf_iterator<char>(in)), istreambuf_iterator<char>());
+	if ((data.size() < 14) || data.compare (0, 4, "MThd") || (bigEndian (data, 4, 4) != 6)) return false;
+	smf.fFormat = int(bigEndian (data, 8, 2));
+	unsigned long tracks = bigEndian (data, 10, 2);
+	smf.fTPQ = int(bigEndian (data, 12, 2));
+	smf.fTracks.clear();
+	size_t pos = 14;
+	for (unsigned long t = 0; t < tracks; t++) {
+		if ((data.size() - pos < 8) || data.compare (pos, 4, "MTrk")) return false;
+		unsigned long size = bigEndian (data, pos + 4, 4);
+		pos += 8;
+		if (size > data.size() - pos) return false;
+		smf.fTracks.push_back (data.substr (pos, size));
+		pos += size;
+	}
+	return pos == data.size();
+}
+
+static bool readVlq (const string& track, size_t& pos, unsigned long& v)
+{
+	v = 0;
+	for (int i = 0; (i < 4) && (pos < track.size()); i++) {
+		unsigned char c = track[pos++];
+		v = (v << 7) | (c & 0x7f);
+		if (!(c & 0x80)) return true;
+	}
+	return false;
+}
+
+// checks the events of a track: the delta times, the running status, the
+// notes on and off balance and the end of track, returns the events count or -1
+static long checkTrack (const string& track)
+{
+	size_t pos = 0;
+	unsigned char status = 0;
+	long events = 0, notes = 0;
+	bool eot = false;
+	while (pos < track.size()) {
+		unsigned long delta, len;
+		if (eot || !readVlq (track, pos, delta) || (pos >= track.size())) return -1;
+		unsigned char c = track[pos];
+		if (c == 0xff) {
+			if (track.size() - pos < 3) return -1;
+			eot = ((unsigned char)track[pos + 1] == 0x2f);
+			pos += 2;
+			if (!readVlq (track, pos, len) || (len > track.size() - pos)) return -1;
+			pos += len;
+			status = 0;
+		}
+		else {
+			if (c & 0x80) { status = c; pos++; }
+			if (!status) return -1;
+			size_t n = ((status & 0xf0) == 0xc0) || ((status & 0xf0) == 0xd0) ? 1 : 2;
+			if (track.size() - pos < n) return -1;
+			if ((status & 0xf0) == 0x90) notes += track[pos + 1] ? 1 : -1;
+			pos += n;
+		}
+		events++;
+	}
+	return (eot && !notes) ? events : -1;
+}
+
+static string bytes (const unsigned char* data, size_t size)	{ return string ((const char*)data, size); }
+
+//_______________________________________________________________________________
+// the delta times encoding, the programs numbering
+static void deltas (const char* path)
+{
+	const char* context = "delta times";
+	smfwriter w (480);
+	CHECK (w.open (path));
+	w.startPart (1);
+	long date = 0;
+	w.progChange (date, 1, 1);
+	w.progChange (date += 127, 1, 0);			// the programs are clipped
+	w.progChange (date += 128, 1, 200);
+	w.progChange (date += 16383, 1, 1);
+	w.progChange (date += 16384, 1, 2);
+	w.progChange (date += 0x0FFFFFFF, 1, 6);	// the largest delta time
+	w.progChange (date += 0x0FFFFFFF + 1000L, 1, 7);
+	w.endPart (date);
+	CHECK (w.close ());
+
+	smffile smf;
+	CHECK (readFile (path, smf));
+	CHECK (smf.fFormat == 1);
+	CHECK (smf.fTPQ == 480);
+	CHECK (smf.fTracks.size() == 2);
+	if (smf.fTracks.size() != 2) return;
+
+	// the larger delta times are clamped to the 4 bytes quantities
+	const unsigned char conductor[] = { 0xff, 0xff, 0xff, 0x7f, 0xff, 0x2f, 0x00 };
+	CHECK (smf.fTracks[0] == bytes (conductor, sizeof(conductor)));
+	const unsigned char part[] = {
+		0x00, 0xc0, 0x00,
+		0x7f, 0x00,					// running status
+		0x81, 0x00, 0x7f,
+		0xff, 0x7f, 0x00,
+		0x81, 0x80, 0x00, 0x01,
+		0xff, 0xff, 0xff, 0x7f, 0x05,
+		0xff, 0xff, 0xff, 0x7f, 0x06,
+		0x00, 0xff, 0x2f, 0x00 };
+	CHECK (smf.fTracks[1] == bytes (part, sizeof(part)));
+}
+
+//_______________________________________________________________________________
+// the notes on sorted and merged with the notes off, the tempo in the conductor track
+static void notes (const char* path)
+{
+	const char* context = "notes";
+	smfwriter w (480);
+	CHECK (w.open (path));
+	w.tempoChange (0, 120);
+	w.startPart (1);
+	w.newInstrument ("Piano", 2);
+	w.newNote (480, -1, 67.f, 90, 480);			// before the earlier notes, as after a backup
+	w.newNote (0, -1, 60.f, 100, 480);
+	w.newNote (0, -1, 64.f, 100, 480);
+	w.endPart (960);
+	CHECK (w.close ());
+
+	smffile smf;
+	CHECK (readFile (path, smf));
+	CHECK (smf.fTracks.size() == 2);
+	if (smf.fTracks.size() != 2) return;
+
+	const unsigned char conductor[] = {
+		0x00, 0xff, 0x51, 0x03, 0x07, 0xa1, 0x20,	// 500000 us per quarter
+		0x87, 0x40, 0xff, 0x2f, 0x00 };
+	CHECK (smf.fTracks[0] == bytes (conductor, sizeof(conductor)));
+	// the instrument channel is the part channel, notes off come first at the same date
+	const unsigned char part[] = {
+		0x00, 0xff, 0x03, 0x05, 'P', 'i', 'a', 'n', 'o',
+		0x00, 0xff, 0x04, 0x05, 'P', 'i', 'a', 'n', 'o',
+		0x00, 0x91, 0x3c, 0x64,
+		0x00, 0x40, 0x64,
+		0x83, 0x60, 0x3c, 0x00,
+		0x00, 0x40, 0x00,
+		0x00, 0x43, 0x5a,
+		0x83, 0x60, 0x43, 0x00,
+		0x00, 0xff, 0x2f, 0x00 };
+	CHECK (smf.fTracks[1] == bytes (part, sizeof(part)));
+	CHECK (checkTrack (smf.fTracks[1]) == 9);
+}
+
+//_______________________________________________________________________________
+// the files written from scores: one track per part after the conductor track
+static void scores (const char* path, int argc, char* argv[])
+{
+	for (int i = 2; i < argc; i++) {
+		const char* context = argv[i];
+		xmlreader r;
+		SXMLFile file = r.read (argv[i]);
+		if (!file || !file->elements()) continue;
+
+		Sxmlelement score = file->elements();
+		int parts = 0;
+		for (size_t e = 0; e < score->elements().size(); e++)
+			if (score->elements()[e]->getType() == k_part) parts++;
+
+		CHECK (smfwriter::write (score, path, 480));
+		smffile smf;
+		CHECK (readFile (path, smf));
+		CHECK (smf.fFormat == 1);
+		CHECK (int(smf.fTracks.size()) == parts + 1);
+		for (size_t t = 0; t < smf.fTracks.size(); t++)
+			CHECK (checkTrack (smf.fTracks[t]) > 0);
+	}
+}
+
+//_______________________________________________________________________________
+int main(int argc, char *argv[])
+{
+	if (argc < 2) usage();
+	const char* path = argv[1];
+
+	deltas (path);
+	notes (path);
+	scores (path, argc, argv);
+	remove (path);
+
+	if (gErrors) cerr << "smftest: " << gErrors << " errors" << endl;
+	return gErrors ? 1 : 0;
+}
@@ -0,0 +1,142 @@
+/*
+  MusicXML Library
+  Copyright (C) Grame 2006-2013
+
+  This Source Code Form is subject to the terms of the Mozilla Public
+  License, v. 2.0. If a copy of the MPL was not distributed with this
+  file, You can obtain one at http://mozilla.org/MPL/2.0/.
+
+  Grame Research Laboratory, 11, cours de Verdun Gensoul 69002 Lyon - France
+  research@grame.fr
+*/
+
+#include <stdlib.h>
+#include <string.h>
+#include <atomic>
+#include <iostream>
+#include <sstream>
+#include <string>
+#include <thread>
+#include <vector>
+
+#include "xml.h"
+#include "xmlfile.h"
+#include "xmlreader.h"
+
+#include "conversionContext.h"
+#include "messagesHandling.h"
+#include "msr.h"
+#include "lpsr.h"
+#include "xml2lyOptionsHandling.h"
+#include "mxmlTree2MsrSkeletonBuilderInterface.h"
+#include "mxmlTree2MsrTranslatorInterface.h"
+#include "msr2LpsrInterface.h"
+#include "lpsr2LilypondInterface.h"
+
+using namespace std;
+using namespace MusicXML2;
+
+//_______________________________________________________________________________
+// checks that concurrent xml2ly conversions give the same output as a
+// single threaded run: each thread uses its own conversion context
+//_______________________________________________________________________________
+static void usage()
+{
+	cerr << "usage: xml2lythreads [options] <musicxml files>" << endl;
+	cerr << "       converts the files to lilypond on several threads and compares with a single threaded run" << endl;
+	cerr << "       options: -t <threads> the number of threads (defaults to 4)" << endl;
+	cerr << "                -n <runs>    the number of concurrent runs (defaults to 2)" << endl;
+	exit(1);
+}
+
+//_______________________________________________________________________________
+// the lilypond code of a file, or an empty string when the conversion fails
+static string convert (const string& file)
+{
+	conversionContext& context = conversionContext::current ();
+	context.reset ();
+	context.fErrorsThrowExceptions = true;
+
+	stringstream out;
+	try {
+		xmlreader r;
+		SXMLFile xml = r.read (file.c_str());
+		if (!xml || !xml->elements()) return "";
+		Sxmlelement tree = xml->elements();
+
+		// the xml2ly options: quiet, the file name is required but not used
+		string a0 = "xml2lythreads", a1 = "-q", a2 = file;
+		char* argv[] = { &a0[0], &a1[0], &a2[0], 0 };
+		S_xml2lyOptionsHandler handler = xml2lyOptionsHandler::create (gOutputIOstream ());
+		handler->decipherOptionsAndArguments (3, argv);
+		gXml2lyOptions ()->fInputSourceName = file;
+		gXml2lyOptions ()->fTranslationDate = "";		// the output would depend on the conversion time
+
+		S_msrScore mScore = buildMsrSkeletonFromElementsTree (gMsrOptions (), tree, gLogIOstream ());
+		if (!mScore) return "";
+		populateMsrSkeletonFromMxmlTree (gMsrOptions (), tree, mScore, gLogIOstream ());
+		S_lpsrScore lpScore = buildLpsrScoreFromMsrScore (mScore, gMsrOptions (), gLpsrOptions (), gLogIOstream ());
+
+		indentedOstream lilypondCode (out, gIndenter (), true);
+		generateLilypondCodeFromLpsrScore (lpScore, gMsrOptions (), gLpsrOptions (), gLogIOstream (), lilypondCode);
+	}
+	catch (const msrException& e) {
+		gIndenter ().resetToZero ();
+		return "";
+	}
+	gIndenter ().resetToZero ();
+	return out.str();
+}
+
+//_______________________________________________________________________________
+static void worker (const vector<string>* files, vector<string>* outputs, atomic<size_t>* next)
+{
+	for (size_t i = (*next)++; i < files->size(); i = (*next)++)
+		(*outputs)[i] = convert ((*files)[i]);
+}
+
+//_______________________________________________________________________________
+int main(int argc, char *argv[])
+{
+	int threads = 4, runs = 2;
+	int i = 1;
+	for (; (i < argc) && (argv[i][0] == '-'); i++) {
+		if (!strcmp (argv[i], "-t") && (i + 1 < argc)) threads = atoi (argv[++i]);
+		else if (!strcmp (argv[i], "-n") && (i + 1 < argc)) runs = atoi (argv[++i]);
+		else usage();
+	}
+	if ((i == argc) || (threads <= 0) || (runs <= 0)) usage();
+
+	// the tables shared by the conversions are built before the threads start
+	initializeMSR ();
+	initializeLPSR ();
+
+	vector<string> files (argv + i, argv + argc);
+	vector<string> expected (files.size());
+	int converted = 0;
+	for (size_t f = 0; f < files.size(); f++) {
+		expected[f] = convert (files[f]);
+		if (!expected[f].empty()) converted++;
+	}
+
+	int errors = 0;
+	for (int n = 0; n < runs; n++) {
+		vector<string> outputs (files.size());
+		atomic<size_t> next (0);
+		vector<thread> pool;
+		for (int t = 0; t < threads; t++)
+			pool.push_back (thread (worker, &files, &outputs, &next));
+		for (size_t t = 0; t < pool.size(); t++)
+			pool[t].join();
+
+		for (size_t f = 0; f < files.size(); f++) {
+			if (outputs[f] != expected[f]) {
+				cerr << files[f] << ": output differs from the single threaded conversion (run " << n + 1 << ")" << endl;
+				errors++;
+			}
+		}
+	}
+	cout << converted << " of " << files.size() << " files converted, "
+		 << runs << " runs on " << threads << " threads: " << errors << " differences" << endl;
+	return errors ? 1 : 0;
+}